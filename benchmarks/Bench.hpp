@@ -0,0 +1,258 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARKS_BENCH_HPP
+#define EL_BENCHMARKS_BENCH_HPP
+
+#include <El.hpp>
+
+// A common harness for the benchmark drivers: each driver registers its
+// kernels with a Suite, which sweeps them over process grids and problem
+// sizes with a fixed set of command-line arguments:
+//
+//   --sizes     comma-separated problem sizes (the per-process base sizes
+//               when weak scaling)
+//   --scaling   "strong" (fixed sizes) or "weak" (the sizes grow with the
+//               number of processes so that the memory per process is fixed)
+//   --minProcs  the smallest number of processes to sweep over; the sweep
+//               then doubles up to the full communicator
+//   --allShapes whether to benchmark every grid shape for each number of
+//               processes rather than only the most square
+//   --reps      the number of repetitions (the fastest is reported)
+//   --format    "json" or "csv"
+//   --output    the file to write the results to (stdout if empty)
+//
+// Each record holds the slowest process's time of the fastest repetition
+// along with the implied GFLOP/s (and GB/s for data movement) and, for the
+// kernels which were given an accuracy check, the (relative) error of the
+// result of the last repetition.
+
+namespace bench {
+
+using namespace El;
+
+struct Record
+{
+    string benchmark;
+    string variant;
+    Int n;
+    int numProcs;
+    int gridHeight;
+    int gridWidth;
+    double seconds;
+    double flops;
+    double bytes;
+    bool checked;
+    double error;
+};
+
+inline vector<Int> ParseSizes( const string& sizeString )
+{
+    vector<Int> sizes;
+    std::istringstream stream( sizeString );
+    string token;
+    while( std::getline( stream, token, ',' ) )
+        if( !token.empty() )
+            sizes.push_back( std::stoll(token) );
+    if( sizes.empty() )
+        LogicError("No problem sizes were specified");
+    return sizes;
+}
+
+inline string RateString( double work, double seconds, bool json )
+{
+    if( work <= 0 || seconds <= 0 )
+        return json ? "null" : "";
+    ostringstream os;
+    os << work/seconds/1.e9;
+    return os.str();
+}
+
+class Suite
+{
+public:
+    Suite( const string& name, const string& defaultSizes="1000,2000,4000" )
+    : name_(name)
+    {
+        sizes_ = ParseSizes
+          ( Input<string>("--sizes","comma-separated sizes",defaultSizes) );
+        const string scaling =
+          Input<string>("--scaling","strong or weak scaling",string("strong"));
+        if( scaling != "strong" && scaling != "weak" )
+            LogicError("Invalid scaling type ",scaling);
+        weak_ = ( scaling == "weak" );
+        minProcs_ = Input("--minProcs","smallest number of processes",1);
+        allShapes_ = Input("--allShapes","sweep all grid shapes?",false);
+        numReps_ = Input("--reps","number of repetitions",3);
+        format_ = Input<string>("--format","json or csv",string("json"));
+        if( format_ != "json" && format_ != "csv" )
+            LogicError("Invalid output format ",format_);
+        output_ = Input<string>("--output","output file",string(""));
+    }
+
+    // The size of a problem whose storage is proportional to n^dim should
+    // grow as the dim'th root of the number of processes when weak scaling
+    void SetDimension( double dim ) { dim_ = dim; }
+
+    // Runs body(grid,n) for each process grid and problem size of the sweep,
+    // where body is expected to call Time for each of its kernels
+    void Sweep( function<void(const Grid&,Int)> body )
+    {
+        const mpi::Comm worldComm = mpi::COMM_WORLD;
+        const int worldSize = mpi::Size( worldComm );
+        const int worldRank = mpi::Rank( worldComm );
+
+        vector<int> procCounts;
+        for( int p=Max(minProcs_,1); p<worldSize; p*=2 )
+            procCounts.push_back( p );
+        procCounts.push_back( worldSize );
+
+        for( const int p : procCounts )
+        {
+            mpi::Comm comm;
+            mpi::Split( worldComm, worldRank < p ? 0 : 1, worldRank, comm );
+            if( worldRank < p )
+            {
+                vector<int> heights;
+                if( allShapes_ )
+                {
+                    for( int height=1; height<=p; ++height )
+                        if( p % height == 0 )
+                            heights.push_back( height );
+                }
+                else
+                    heights.push_back( Grid::FindFactor(p) );
+
+                for( const int height : heights )
+                {
+                    const Grid grid( comm, height );
+                    for( const Int baseSize : sizes_ )
+                    {
+                        Int n = baseSize;
+                        if( weak_ )
+                            n = Int(baseSize*Pow(double(p),1./dim_));
+                        body( grid, n );
+                    }
+                }
+            }
+            mpi::Free( comm );
+            mpi::Barrier( worldComm );
+        }
+    }
+
+    // Times op() (after calling setup()) numReps times, recording the
+    // fastest repetition as measured by the slowest process. If a check is
+    // given, it is called collectively after the last repetition and should
+    // return the relative error of the result.
+    void Time
+    ( const Grid& grid, const string& variant, Int n,
+      double flops, double bytes,
+      function<void()> setup, function<void()> op,
+      function<double()> check=function<double()>() )
+    {
+        const mpi::Comm comm = grid.Comm();
+        double seconds = std::numeric_limits<double>::max();
+        Timer timer;
+        for( Int rep=0; rep<numReps_; ++rep )
+        {
+            setup();
+            mpi::Barrier( comm );
+            timer.Start();
+            op();
+            mpi::Barrier( comm );
+            const double repSeconds =
+              mpi::AllReduce( timer.Stop(), mpi::MAX, comm );
+            seconds = Min( seconds, repSeconds );
+        }
+        const bool checked = bool(check);
+        const double error = ( checked ? check() : 0. );
+        if( grid.Rank() == 0 )
+        {
+            Record record
+            { name_, variant, n, grid.Size(), grid.Height(), grid.Width(),
+              seconds, flops, bytes, checked, error };
+            records_.push_back( record );
+            if( checked )
+                Output
+                (name_," ",variant,": n=",n,", grid=",grid.Height(),"x",
+                 grid.Width(),", ",seconds," seconds, error=",error);
+            else
+                Output
+                (name_," ",variant,": n=",n,", grid=",grid.Height(),"x",
+                 grid.Width(),", ",seconds," seconds");
+        }
+    }
+
+    // Writes the records from the root of COMM_WORLD (which is the root of
+    // every grid in the sweep)
+    void Write() const
+    {
+        if( mpi::Rank() != 0 )
+            return;
+        ofstream file;
+        if( !output_.empty() )
+        {
+            file.open( output_.c_str() );
+            if( !file.is_open() )
+                RuntimeError("Could not open ",output_);
+        }
+        ostream& os = ( output_.empty() ? cout : file );
+        const bool json = ( format_ == "json" );
+        if( json )
+            os << "[\n";
+        else
+            os << "benchmark,variant,n,processes,gridHeight,gridWidth,"
+                  "seconds,gflops,gbps,error\n";
+        for( size_t i=0; i<records_.size(); ++i )
+        {
+            const Record& r = records_[i];
+            const string gflops = RateString( r.flops, r.seconds, json );
+            const string gbps = RateString( r.bytes, r.seconds, json );
+            ostringstream error;
+            if( r.checked )
+                error << r.error;
+            else if( json )
+                error << "null";
+            if( json )
+                os << "  {\"benchmark\": \"" << r.benchmark << "\", "
+                   << "\"variant\": \"" << r.variant << "\", "
+                   << "\"n\": " << r.n << ", "
+                   << "\"processes\": " << r.numProcs << ", "
+                   << "\"gridHeight\": " << r.gridHeight << ", "
+                   << "\"gridWidth\": " << r.gridWidth << ", "
+                   << "\"seconds\": " << r.seconds << ", "
+                   << "\"gflops\": " << gflops << ", "
+                   << "\"gbps\": " << gbps << ", "
+                   << "\"error\": " << error.str() << "}"
+                   << ( i+1 < records_.size() ? ",\n" : "\n" );
+            else
+                os << r.benchmark << "," << r.variant << "," << r.n << ","
+                   << r.numProcs << "," << r.gridHeight << ","
+                   << r.gridWidth << "," << r.seconds << ","
+                   << gflops << "," << gbps << "," << error.str() << "\n";
+        }
+        if( json )
+            os << "]\n";
+    }
+
+private:
+    string name_;
+    vector<Int> sizes_;
+    bool weak_=false;
+    double dim_=2;
+    int minProcs_=1;
+    bool allShapes_=false;
+    Int numReps_=3;
+    string format_;
+    string output_;
+    vector<Record> records_;
+};
+
+} // namespace bench
+
+#endif // ifndef EL_BENCHMARKS_BENCH_HPP
@@ -0,0 +1,50 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("Cholesky");
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            DistMatrix<double> A(g);
+            const double flops = double(n)*n*n/3.;
+            // A Hermitian, strictly diagonally dominant matrix
+            auto setup =
+              [&]()
+              {
+                Uniform( A, n, n );
+                MakeSymmetric( LOWER, A );
+                ShiftDiagonal( A, 2.*n );
+              };
+            suite.Time
+            ( g, "Lower", n, flops, 0, setup,
+              [&]() { Cholesky( LOWER, A ); } );
+            suite.Time
+            ( g, "Upper", n, flops, 0, setup,
+              [&]() { Cholesky( UPPER, A ); } );
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+// Times the redistribution of an [MC,MR] matrix into the distribution of B
+// (the reported bandwidth is that of the matrix size over the time)
+template<Dist U,Dist V>
+void Redistribute
+( bench::Suite& suite, const DistMatrix<double>& A,
+  const string& variant )
+{
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    DistMatrix<double,U,V> B(g);
+    suite.Time
+    ( g, variant, n, 0, double(n)*n*sizeof(double),
+      [&]() { B.Empty(); },
+      [&]() { B = A; } );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("Copy");
+        ProcessInput();
+        PrintInputReport();
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            DistMatrix<double> A(g);
+            Uniform( A, n, n );
+            Redistribute<MC,  STAR>( suite, A, "[MC,MR]->[MC,STAR]" );
+            Redistribute<STAR,MR  >( suite, A, "[MC,MR]->[STAR,MR]" );
+            Redistribute<MR,  MC  >( suite, A, "[MC,MR]->[MR,MC]" );
+            Redistribute<VC,  STAR>( suite, A, "[MC,MR]->[VC,STAR]" );
+            Redistribute<VR,  STAR>( suite, A, "[MC,MR]->[VR,STAR]" );
+            Redistribute<STAR,VR  >( suite, A, "[MC,MR]->[STAR,VR]" );
+            Redistribute<MD,  STAR>( suite, A, "[MC,MR]->[MD,STAR]" );
+            Redistribute<STAR,STAR>( suite, A, "[MC,MR]->[STAR,STAR]" );
+            Redistribute<CIRC,CIRC>( suite, A, "[MC,MR]->[CIRC,CIRC]" );
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("Gemm");
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        const vector<pair<string,GemmAlgorithm>> algs =
+          { {"Default",GEMM_DEFAULT},
+            {"SUMMA_A",GEMM_SUMMA_A},
+            {"SUMMA_B",GEMM_SUMMA_B},
+            {"SUMMA_C",GEMM_SUMMA_C},
+            {"SUMMA_Dot",GEMM_SUMMA_DOT},
+            {"Cannon",GEMM_CANNON},
+            {"2.5D",GEMM_25D} };
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            DistMatrix<double> A(g), B(g), C(g);
+            Uniform( A, n, n );
+            Uniform( B, n, n );
+            const double flops = 2.*n*n*n;
+            for( const auto& alg : algs )
+            {
+                // Cannon's algorithm requires a square grid
+                if( alg.second == GEMM_CANNON && g.Height() != g.Width() )
+                    continue;
+                suite.Time
+                ( g, alg.first, n, flops, 0,
+                  [&]() { Zeros( C, n, n ); },
+                  [&]()
+                  { Gemm( NORMAL, NORMAL, 1., A, B, 0., C, alg.second ); } );
+            }
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
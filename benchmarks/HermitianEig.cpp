@@ -0,0 +1,50 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("HermitianEig");
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            DistMatrix<double> A(g), Q(g);
+            DistMatrix<double,VR,STAR> w(g);
+            auto setup =
+              [&]()
+              {
+                Uniform( A, n, n );
+                MakeSymmetric( LOWER, A );
+              };
+            // The nominal operation counts of the tridiagonal reduction
+            // (4/3 n^3) and of the back-transformation (2 n^3)
+            suite.Time
+            ( g, "Eigenvalues", n, 4.*n*n*n/3., 0, setup,
+              [&]() { HermitianEig( LOWER, A, w ); } );
+            suite.Time
+            ( g, "Eigenpairs", n, 4.*n*n*n/3.+2.*n*n*n, 0, setup,
+              [&]() { HermitianEig( LOWER, A, w, Q ); } );
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+void Apply
+( Orientation orientation,
+  double alpha, const DistMatrix<double>& A, const DistMatrix<double>& x,
+  double beta,                                     DistMatrix<double>& y )
+{ Gemv( orientation, alpha, A, x, beta, y ); }
+
+void Apply
+( Orientation orientation,
+  double alpha, const DistSparseMatrix<double>& A,
+  const DistMultiVec<double>& x,
+  double beta, DistMultiVec<double>& y )
+{ Multiply( orientation, alpha, A, x, beta, y ); }
+
+// Form a feasible right-hand side and cost vector, b := A x0 and
+// c := A^T y0 + z0, from a strictly positive primal point x0, an arbitrary
+// dual point y0, and a strictly positive dual slack z0
+template<class MatrixType,class VectorType>
+void FeasibleData
+( const MatrixType& A, VectorType& b, VectorType& c,
+  VectorType& x0, VectorType& y0, VectorType& z0 )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Uniform( x0, n, 1, 1., 0.5 );
+    Uniform( y0, m, 1 );
+    Uniform( z0, n, 1, 1., 0.5 );
+    Zeros( b, m, 1 );
+    Apply( NORMAL, 1., A, x0, 0., b );
+    c = z0;
+    Apply( TRANSPOSE, 1., A, y0, 1., c );
+}
+
+// The dense problems have n/2 equality constraints on n variables, whereas
+// the sparse problems have the n^3 x 2 n^3 constraint matrix [L, I], where L
+// is a three-dimensional finite-difference Laplacian on an n x n x n grid
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("IPM","500,1000,2000");
+        const Int sparseDim =
+          Input("--sparseDim","grid dimension of the sparse LPs",20);
+        const bool sparse = Input("--sparse","benchmark the sparse LP?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            const mpi::Comm comm = g.Comm();
+
+            DistMatrix<double> A(g), b(g), c(g), x0(g), y0(g), z0(g);
+            DistMatrix<double> x(g), y(g), z(g);
+            Gaussian( A, n/2, n );
+            FeasibleData( A, b, c, x0, y0, z0 );
+            suite.Time
+            ( g, "DenseLP", n, 0, 0,
+              [&]() { },
+              [&]() { LP( A, b, c, x, y, z ); } );
+
+            // Solve min 1/2 x^T Q x + c^T x, s.t. A x = b, x >= 0, with a
+            // Hermitian positive semi-definite Q = G^T G
+            DistMatrix<double> G(g), Q(g);
+            Gaussian( G, n, n );
+            Zeros( Q, n, n );
+            Herk( LOWER, TRANSPOSE, 1., G, 0., Q );
+            MakeSymmetric( LOWER, Q );
+            suite.Time
+            ( g, "DenseQP", n, 0, 0,
+              [&]() { },
+              [&]() { QP( Q, A, b, c, x, y, z ); } );
+
+            if( !sparse )
+                return;
+            const Int N = sparseDim*sparseDim*sparseDim;
+            DistSparseMatrix<double> L(comm), ASparse(comm);
+            Laplacian( L, sparseDim, sparseDim, sparseDim );
+            ASparse.Resize( N, 2*N );
+            const Int localHeight = L.LocalHeight();
+            ASparse.Reserve( L.NumLocalEntries()+localHeight );
+            for( Int e=0; e<L.NumLocalEntries(); ++e )
+                ASparse.QueueLocalUpdate
+                ( L.Row(e)-L.FirstLocalRow(), L.Col(e), L.Value(e) );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                ASparse.QueueLocalUpdate( iLoc, N+L.GlobalRow(iLoc), 1. );
+            ASparse.ProcessLocalQueues();
+
+            DistMultiVec<double> bSparse(comm), cSparse(comm),
+              x0Sparse(comm), y0Sparse(comm), z0Sparse(comm),
+              xSparse(comm), ySparse(comm), zSparse(comm);
+            FeasibleData
+            ( ASparse, bSparse, cSparse, x0Sparse, y0Sparse, z0Sparse );
+            suite.Time
+            ( g, "SparseLP", sparseDim, 0, 0,
+              [&]() { },
+              [&]()
+              { LP( ASparse, bSparse, cSparse, xSparse, ySparse, zSparse ); } );
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("LU");
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            DistMatrix<double> A(g);
+            DistPermutation P(g);
+            const double flops = 2.*n*n*n/3.;
+            auto setup = [&]() { Uniform( A, n, n ); };
+
+            LUCtrl ctrl;
+            ctrl.pivot = LU_PARTIAL;
+            suite.Time
+            ( g, "Partial", n, flops, 0, setup,
+              [&]() { LU( A, P, ctrl ); } );
+
+            ctrl.pivot = LU_TOURNAMENT;
+            suite.Time
+            ( g, "Tournament", n, flops, 0, setup,
+              [&]() { LU( A, P, ctrl ); } );
+
+            suite.Time
+            ( g, "Full", n, flops, 0, setup,
+              [&]()
+              {
+                DistPermutation Q(g);
+                LU( A, P, Q );
+              } );
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
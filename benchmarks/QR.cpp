@@ -0,0 +1,52 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("QR");
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int tsWidth =
+          Input("--tsWidth","width of the tall-skinny matrices",64);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            // Square Householder QR
+            DistMatrix<double> A(g);
+            DistMatrix<double,MD,STAR> householderScalars(g), signature(g);
+            suite.Time
+            ( g, "Householder", n, 4.*n*n*n/3., 0,
+              [&]() { Uniform( A, n, n ); },
+              [&]() { QR( A, householderScalars, signature ); } );
+
+            // Tall-skinny QR of an n x tsWidth matrix
+            DistMatrix<double,VC,STAR> ATall(g);
+            DistMatrix<double,STAR,STAR> R(g);
+            const double k = tsWidth;
+            suite.Time
+            ( g, "TSQR", n, 2.*n*k*k-2.*k*k*k/3., 0,
+              [&]() { Uniform( ATall, n, tsWidth ); },
+              [&]() { qr::ExplicitTS( ATall, R ); } );
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
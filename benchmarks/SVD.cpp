@@ -0,0 +1,45 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("SVD");
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            DistMatrix<double> A(g), U(g), V(g);
+            DistMatrix<double,VR,STAR> s(g);
+            auto setup = [&]() { Uniform( A, n, n ); };
+            // The nominal operation counts of the bidiagonal reduction
+            // (8/3 n^3) and of forming both sets of singular vectors (4 n^3)
+            suite.Time
+            ( g, "SingularValues", n, 8.*n*n*n/3., 0, setup,
+              [&]() { SVD( A, s ); } );
+            suite.Time
+            ( g, "SingularTriplets", n, 8.*n*n*n/3.+4.*n*n*n, 0, setup,
+              [&]() { SVD( A, U, s, V ); } );
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
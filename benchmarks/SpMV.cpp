@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+// The problem size is the number of grid points in each dimension of a
+// three-dimensional finite-difference Laplacian
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("SpMV","50,100,200");
+        const Int numRHS = Input("--numRHS","number of right-hand sides",1);
+        const Int numMults =
+          Input("--numMults","number of products per repetition",10);
+        ProcessInput();
+        PrintInputReport();
+        suite.SetDimension( 3 );
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            const mpi::Comm comm = g.Comm();
+            const Int N = n*n*n;
+            DistSparseMatrix<double> A(comm);
+            Laplacian( A, n, n, n );
+            DistMultiVec<double> X( N, numRHS, comm ), Y( N, numRHS, comm );
+            MakeUniform( X );
+            Zero( Y );
+
+            // Each nonzero contributes a multiply and an add, and the matrix
+            // (values and column indices) must be streamed through for
+            // every product
+            const double numNonzeros = A.NumEntries();
+            const double flops = 2.*numNonzeros*numRHS*numMults;
+            const double bytes =
+              (numNonzeros*(sizeof(double)+sizeof(Int)) +
+               2.*N*numRHS*sizeof(double))*numMults;
+            suite.Time
+            ( g, "Normal", n, flops, bytes,
+              [&]() { },
+              [&]()
+              {
+                for( Int mult=0; mult<numMults; ++mult )
+                    Multiply( NORMAL, 1., A, X, 0., Y );
+              } );
+            suite.Time
+            ( g, "Transpose", n, flops, bytes,
+              [&]() { },
+              [&]()
+              {
+                for( Int mult=0; mult<numMults; ++mult )
+                    Multiply( TRANSPOSE, 1., A, X, 0., Y );
+              } );
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+// The problem size is the number of grid points in each dimension of a
+// three-dimensional finite-difference Laplacian
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("SparseLDL","20,40,60");
+        const bool intraPiv =
+          Input("--intraPiv","frontal pivoting?",false);
+        ProcessInput();
+        PrintInputReport();
+        suite.SetDimension( 3 );
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+            const mpi::Comm comm = g.Comm();
+            DistSparseMatrix<double> A(comm);
+            Laplacian( A, n, n, n );
+            A *= -1.;
+
+            ldl::DistNodeInfo info;
+            ldl::DistSeparator sep;
+            DistMap map;
+            BisectCtrl ctrl;
+            ctrl.sequential = false;
+            suite.Time
+            ( g, "NestedDissection", n, 0, 0,
+              [&]() { },
+              [&]()
+              {
+                ldl::NestedDissection( A.DistGraph(), map, sep, info, ctrl );
+              } );
+
+            const LDLFrontType type = ( intraPiv ? LDL_INTRAPIV_2D : LDL_2D );
+            unique_ptr<ldl::DistFront<double>> front;
+            front.reset( new ldl::DistFront<double>( A, map, sep, info ) );
+            const double flops =
+              1.e9*mpi::AllReduce( front->LocalFactorGFlops(), comm );
+            suite.Time
+            ( g, "Factorization", n, flops, 0,
+              [&]()
+              {
+                front.reset( new ldl::DistFront<double>( A, map, sep, info ) );
+              },
+              [&]() { LDL( info, *front, type ); } );
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,287 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Bench.hpp"
+using namespace El;
+
+// Compares Elemental's Gemm, LU, and HermitianEig against the vendor
+// ScaLAPACK/PBLAS routines (pdgemm, pdgetrf, and pdsyevr) on the same
+// inputs over each grid of the sweep. The vendor routines are handed
+// block-cyclic copies of the inputs (formed outside of the timed region)
+// through a BLACS context over the same grid. Every variant reports the
+// relative residual of its result so that faster configurations of
+// GemmAlgorithm and HermitianEigCtrl can be checked for accuracy.
+//
+// The variants are prefixed by their kernel, e.g., "Gemm:SUMMA_C" and
+// "Gemm:pdgemm"; the vendor variants are only run when Elemental was
+// configured with ScaLAPACK.
+
+// || C x - A (B x) ||_2 / (|| A ||_F || B ||_F || x ||_2)
+double GemmError
+( const DistMatrix<double>& A,
+  const DistMatrix<double>& B,
+  const AbstractDistMatrix<double>& CPre )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<double> C(CPre), x(g), y(g), z(g);
+    Gaussian( x, B.Width(), 1 );
+    Zeros( y, B.Height(), 1 );
+    Gemv( NORMAL, 1., B, x, 0., y );
+    Zeros( z, A.Height(), 1 );
+    Gemv( NORMAL, 1., A, y, 0., z );
+    Gemv( NORMAL, 1., C, x, -1., z );
+    return FrobeniusNorm(z) /
+      (FrobeniusNorm(A)*FrobeniusNorm(B)*FrobeniusNorm(x));
+}
+
+// || P A x - L (U x) ||_2 / (|| A ||_F || x ||_2)
+double LUError
+( const DistMatrix<double>& A,
+  const AbstractDistMatrix<double>& LUPre,
+  const DistPermutation& P )
+{
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    DistMatrix<double> ALU(LUPre), x(g), b(g);
+    Gaussian( x, n, 1 );
+    Zeros( b, n, 1 );
+    Gemv( NORMAL, 1., A, x, 0., b );
+    P.PermuteRows( b );
+    const double xNorm = FrobeniusNorm( x );
+    Trmm( LEFT, UPPER, NORMAL, NON_UNIT, 1., ALU, x );
+    Trmm( LEFT, LOWER, NORMAL, UNIT, 1., ALU, x );
+    b -= x;
+    return FrobeniusNorm(b) / (FrobeniusNorm(A)*xNorm);
+}
+
+// Since the sum of the squares of the eigenvalues of a symmetric matrix is
+// its squared Frobenius norm, | || w ||_2^2 - || A ||_F^2 | / || A ||_F^2
+double EigenvalueError
+( const DistMatrix<double>& A, const DistMatrix<double,STAR,STAR>& w )
+{
+    const double frobA = FrobeniusNorm( A );
+    const double twoNormW = FrobeniusNorm( w );
+    return Abs(twoNormW*twoNormW-frobA*frobA) / (frobA*frobA);
+}
+
+// || A Z - Z diag(w) ||_F / || A ||_F
+double EigenpairError
+( const DistMatrix<double>& A,
+  const DistMatrix<double,STAR,STAR>& w,
+  const AbstractDistMatrix<double>& ZPre )
+{
+    DistMatrix<double> Z(ZPre), R(A.Grid());
+    R = Z;
+    DiagonalScale( RIGHT, NORMAL, w, R );
+    Gemm( NORMAL, NORMAL, 1., A, Z, -1., R );
+    return FrobeniusNorm(R) / FrobeniusNorm(A);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        bench::Suite suite("Vendor");
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool benchGemm = Input("--gemm","compare Gemm?",true);
+        const bool benchLU = Input("--lu","compare LU?",true);
+        const bool benchEig = Input("--eig","compare HermitianEig?",true);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+#ifndef EL_HAVE_SCALAPACK
+        if( mpi::Rank() == 0 )
+            Output
+            ("Elemental was not configured with ScaLAPACK, so only the "
+             "Elemental variants will be run");
+#endif
+
+        const vector<pair<string,GemmAlgorithm>> gemmAlgs =
+          { {"Gemm:Default",GEMM_DEFAULT},
+            {"Gemm:SUMMA_A",GEMM_SUMMA_A},
+            {"Gemm:SUMMA_B",GEMM_SUMMA_B},
+            {"Gemm:SUMMA_C",GEMM_SUMMA_C},
+            {"Gemm:SUMMA_Dot",GEMM_SUMMA_DOT},
+            {"Gemm:Cannon",GEMM_CANNON},
+            {"Gemm:2.5D",GEMM_25D} };
+
+        HermitianEigCtrl<double> mrrrCtrl, qdwhCtrl, sliceCtrl;
+        qdwhCtrl.useQDWHEig = true;
+        sliceCtrl.useSpectrumSlicing = true;
+        const vector<pair<string,HermitianEigCtrl<double>>> eigCtrls =
+          { {"Default",mrrrCtrl},
+            {"QDWH",qdwhCtrl},
+            {"Slicing",sliceCtrl} };
+
+        suite.Sweep
+        ( [&]( const Grid& g, Int n )
+          {
+#ifdef EL_HAVE_SCALAPACK
+            const blacs::GridContext context( g );
+#endif
+            if( benchGemm )
+            {
+                DistMatrix<double> A(g), B(g), C(g);
+                Uniform( A, n, n );
+                Uniform( B, n, n );
+                const double flops = 2.*n*n*n;
+                for( const auto& alg : gemmAlgs )
+                {
+                    // Cannon's algorithm requires a square grid
+                    if( alg.second == GEMM_CANNON && g.Height() != g.Width() )
+                        continue;
+                    suite.Time
+                    ( g, alg.first, n, flops, 0,
+                      [&]() { Zeros( C, n, n ); },
+                      [&]()
+                      { Gemm( NORMAL, NORMAL, 1., A, B, 0., C, alg.second ); },
+                      [&]() { return GemmError( A, B, C ); } );
+                }
+#ifdef EL_HAVE_SCALAPACK
+                DistMatrix<double,MC,MR,BLOCK>
+                  ABlock(g), BBlock(g), CBlock(g);
+                ABlock = A;
+                BBlock = B;
+                Zeros( CBlock, n, n );
+                auto descA = context.Descriptor( ABlock );
+                auto descB = context.Descriptor( BBlock );
+                auto descC = context.Descriptor( CBlock );
+                suite.Time
+                ( g, "Gemm:pdgemm", n, flops, 0,
+                  [&]() { Zero( CBlock ); },
+                  [&]()
+                  {
+                    pblas::Gemm
+                    ( 'N', 'N', n, n, n,
+                      1., ABlock.LockedBuffer(), descA.data(),
+                          BBlock.LockedBuffer(), descB.data(),
+                      0., CBlock.Buffer(),       descC.data() );
+                  },
+                  [&]() { return GemmError( A, B, CBlock ); } );
+#endif
+            }
+
+            if( benchLU )
+            {
+                DistMatrix<double> A(g), ALU(g);
+                DistPermutation P(g);
+                Uniform( A, n, n );
+                const double flops = 2.*n*n*n/3.;
+                suite.Time
+                ( g, "LU:Partial", n, flops, 0,
+                  [&]() { ALU = A; },
+                  [&]() { LU( ALU, P ); },
+                  [&]() { return LUError( A, ALU, P ); } );
+
+                LUCtrl ctrl;
+                ctrl.pivot = LU_TOURNAMENT;
+                suite.Time
+                ( g, "LU:Tournament", n, flops, 0,
+                  [&]() { ALU = A; },
+                  [&]() { LU( ALU, P, ctrl ); },
+                  [&]() { return LUError( A, ALU, P ); } );
+#ifdef EL_HAVE_SCALAPACK
+                DistMatrix<double,MC,MR,BLOCK> LUBlock(g);
+                LUBlock = A;
+                auto descLU = context.Descriptor( LUBlock );
+                vector<int> ipiv( LUBlock.LocalHeight()+LUBlock.BlockHeight() );
+                suite.Time
+                ( g, "LU:pdgetrf", n, flops, 0,
+                  [&]() { LUBlock = A; },
+                  [&]()
+                  {
+                    scalapack::LU
+                    ( n, n, LUBlock.Buffer(), descLU.data(), ipiv.data() );
+                  },
+                  [&]()
+                  {
+                    // The (one-based) pivots are distributed like the rows
+                    // of A and are redundant over each process row
+                    vector<Int> pivots( n, 0 );
+                    for( Int iLoc=0; iLoc<LUBlock.LocalHeight(); ++iLoc )
+                        pivots[LUBlock.GlobalRow(iLoc)] = ipiv[iLoc]-1;
+                    mpi::AllReduce( pivots.data(), n, LUBlock.ColComm() );
+                    DistPermutation PBlock(g);
+                    PBlock.MakeIdentity( n );
+                    PBlock.ReserveSwaps( n );
+                    for( Int i=0; i<n; ++i )
+                        PBlock.Swap( i, pivots[i] );
+                    return LUError( A, LUBlock, PBlock );
+                  } );
+#endif
+            }
+
+            if( benchEig )
+            {
+                // The nominal operation counts of the tridiagonal reduction
+                // (4/3 n^3) and of the back-transformation (2 n^3)
+                const double valFlops = 4.*n*n*n/3.;
+                const double vecFlops = valFlops + 2.*n*n*n;
+                DistMatrix<double> A(g), ACopy(g), Z(g);
+                DistMatrix<double,STAR,STAR> w(g);
+                Uniform( A, n, n );
+                MakeSymmetric( LOWER, A );
+                auto setup = [&]() { ACopy = A; };
+
+                suite.Time
+                ( g, "HermitianEig:Eigenvalues", n, valFlops, 0, setup,
+                  [&]() { HermitianEig( LOWER, ACopy, w ); },
+                  [&]() { return EigenvalueError( A, w ); } );
+                for( const auto& eigCtrl : eigCtrls )
+                    suite.Time
+                    ( g, "HermitianEig:"+eigCtrl.first, n, vecFlops, 0, setup,
+                      [&]()
+                      { HermitianEig( LOWER, ACopy, w, Z, eigCtrl.second ); },
+                      [&]() { return EigenpairError( A, w, Z ); } );
+#ifdef EL_HAVE_SCALAPACK
+                // HermitianEigCtrl::useScaLAPACK, which includes the
+                // redistributions to and from the block-cyclic layout
+                HermitianEigCtrl<double> scalapackCtrl;
+                scalapackCtrl.useScaLAPACK = true;
+                suite.Time
+                ( g, "HermitianEig:useScaLAPACK", n, valFlops, 0, setup,
+                  [&]() { HermitianEig( LOWER, ACopy, w, scalapackCtrl ); },
+                  [&]() { return EigenvalueError( A, w ); } );
+
+                DistMatrix<double,MC,MR,BLOCK> ABlock(g), ZBlock(g);
+                ABlock = A;
+                Zeros( ZBlock, n, n );
+                w.Resize( n, 1 );
+                auto descA = context.Descriptor( ABlock );
+                auto descZ = context.Descriptor( ZBlock );
+                suite.Time
+                ( g, "HermitianEig:pdsyevr-Eigenvalues", n, valFlops, 0,
+                  [&]() { ABlock = A; },
+                  [&]()
+                  {
+                    scalapack::HermitianEig
+                    ( 'L', n, ABlock.Buffer(), descA.data(), w.Buffer() );
+                  },
+                  [&]() { return EigenvalueError( A, w ); } );
+                suite.Time
+                ( g, "HermitianEig:pdsyevr", n, vecFlops, 0,
+                  [&]() { ABlock = A; },
+                  [&]()
+                  {
+                    scalapack::HermitianEig
+                    ( 'L', n, ABlock.Buffer(), descA.data(), w.Buffer(),
+                      ZBlock.Buffer(), descZ.data() );
+                  },
+                  [&]() { return EigenpairError( A, w, ZBlock ); } );
+#endif
+            }
+          } );
+        suite.Write();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+set(EL_HAVE_CUBLAS FALSE)
+if(EL_USE_CUBLAS)
+  find_package(CUDA)
+  if(CUDA_FOUND AND CUDA_CUBLAS_LIBRARIES)
+    set(EL_HAVE_CUBLAS TRUE)
+    set(CUBLAS_LIBS ${CUDA_CUBLAS_LIBRARIES} ${CUDA_LIBRARIES})
+    message(STATUS "Appending ${CUDA_INCLUDE_DIRS} for cuBLAS headers")
+    include_directories(${CUDA_INCLUDE_DIRS})
+    message(STATUS "Found cuBLAS: ${CUDA_CUBLAS_LIBRARIES}")
+  else()
+    message(STATUS "Did NOT find cuBLAS")
+  endif()
+endif()
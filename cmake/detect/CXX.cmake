@@ -44,6 +44,74 @@ set(NOEXCEPT_CODE
 check_cxx_source_compiles("${STEADYCLOCK_CODE}" EL_HAVE_STEADYCLOCK)
 check_cxx_source_compiles("${NOEXCEPT_CODE}" EL_HAVE_NOEXCEPT)
 
+# Huge-page and NUMA-aware allocation
+# ===================================
+set(MADV_HUGEPAGE_CODE
+    "#include <sys/mman.h>
+     int main()
+     {
+         void* ptr = mmap
+           ( 0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0 );
+         madvise( ptr, 4096, MADV_HUGEPAGE );
+         munmap( ptr, 4096 );
+         return 0;
+     }")
+set(MBIND_SYSCALL_CODE
+    "#include <sys/mman.h>
+     #include <unistd.h>
+     #include <sys/syscall.h>
+     int main()
+     {
+         unsigned long mask = 1;
+         syscall( SYS_mbind, (void*)0, 0, 0, &mask, 2, 0 );
+         return 0;
+     }")
+check_cxx_source_compiles("${MADV_HUGEPAGE_CODE}" EL_HAVE_MADV_HUGEPAGE)
+check_cxx_source_compiles("${MBIND_SYSCALL_CODE}" EL_HAVE_MBIND_SYSCALL)
+
+# Memory-mapped files
+# ===================
+set(MMAP_FILE_CODE
+    "#include <fcntl.h>
+     #include <sys/mman.h>
+     #include <sys/stat.h>
+     #include <unistd.h>
+     int main()
+     {
+         int fd = open( \"matrix.bin\", O_RDONLY );
+         struct stat info;
+         fstat( fd, &info );
+         void* ptr = mmap( 0, info.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+         madvise( ptr, info.st_size, MADV_WILLNEED );
+         munmap( ptr, info.st_size );
+         close( fd );
+         return 0;
+     }")
+check_cxx_source_compiles("${MMAP_FILE_CODE}" EL_HAVE_MMAP_FILES)
+
+# Hardware performance counters (via Linux's perf_event interface)
+# ================================================================
+set(PERF_EVENT_CODE
+    "#include <cstring>
+     #include <linux/perf_event.h>
+     #include <sys/syscall.h>
+     #include <unistd.h>
+     int main()
+     {
+         struct perf_event_attr attr;
+         std::memset( &attr, 0, sizeof(attr) );
+         attr.type = PERF_TYPE_HARDWARE;
+         attr.size = sizeof(attr);
+         attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+         attr.exclude_kernel = 1;
+         long fd = syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+         long long count;
+         if( fd >= 0 && read( fd, &count, sizeof(count) ) > 0 )
+             close( fd );
+         return 0;
+     }")
+check_cxx_source_compiles("${PERF_EVENT_CODE}" EL_HAVE_PERF_EVENT)
+
 # C++11 random number generation
 # ==============================
 # Note: It was noticed that, for certain relatively recent Intel compiler
@@ -0,0 +1,82 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Typedef our real and complex types to 'Real' and 'C' for convenience
+typedef double Real;
+typedef Complex<Real> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--size","size of Hermitian matrix",100);
+        const Int numRHS = Input("--numRHS","number of vectors",4);
+        const Real time = Input("--time","propagation time",1.);
+        const Int basisSize = Input("--basisSize","Krylov blocks",30);
+        const bool hermitian =
+          Input("--hermitian","use block Lanczos?",false);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // Form the propagator exp(-i t H) of a Hermitian H in three ways
+        DistMatrix<C> H, U, UEVD, B, X, Y;
+        HermitianUniformSpectrum( H, n, -1, 1 );
+        const C t( 0, -time );
+
+        U = H;
+        U *= t;
+        Timer timer;
+        timer.Start();
+        Exp( U );
+        const double padeTime = timer.Stop();
+
+        UEVD = H;
+        auto expFunc = [&]( Real alpha ) { return Exp(t*alpha); };
+        timer.Start();
+        HermitianFunction( LOWER, UEVD, function<C(Real)>(expFunc) );
+        const double evdTime = timer.Stop();
+        MakeHermitian( LOWER, UEVD );
+
+        Gaussian( B, n, numRHS );
+        X = B;
+        ExpMultiplyCtrl<Real> ctrl;
+        ctrl.basisSize = basisSize;
+        ctrl.hermitian = hermitian;
+        ctrl.progress = progress;
+        timer.Start();
+        auto info = ExpMultiply( t, H, X, ctrl );
+        const double krylovTime = timer.Stop();
+
+        // Compare the Pade and Krylov results against the EVD
+        const Real frobU = FrobeniusNorm( UEVD );
+        U -= UEVD;
+        const Real padeError = FrobeniusNorm( U ) / frobU;
+        Gemm( NORMAL, NORMAL, C(1), UEVD, B, Y );
+        const Real frobY = FrobeniusNorm( Y );
+        Y -= X;
+        const Real krylovError = FrobeniusNorm( Y ) / frobY;
+        if( mpi::Rank() == 0 )
+        {
+            Output("Pade:   ",padeTime," seconds, relative error ",padeError);
+            Output("EVD:    ",evdTime," seconds");
+            Output
+            ("Krylov: ",krylovTime," seconds, relative error ",krylovError,
+             ", ",info.numSteps," steps, ",info.numRejections," rejections");
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
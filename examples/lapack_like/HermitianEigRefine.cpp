@@ -0,0 +1,71 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Typedef our real and complex types to 'Real' and 'C' for convenience
+typedef double Real;
+typedef Complex<Real> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--size","size of matrix",200);
+        const Int k = Input("--numEigs","number of eigenpairs",20);
+        const Int numSteps = Input("--numSteps","number of time steps",5);
+        const Real perturb =
+          Input("--perturb","relative perturbation per step",1e-4);
+        const Int degree = Input("--degree","Chebyshev degree",8);
+        const Int maxIts = Input("--maxIts","max refinement its",5);
+        const bool largest =
+          Input("--largest","refine the largest eigenpairs?",false);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // Compute the initial eigenpairs from scratch
+        DistMatrix<C> A, ACopy, Q, E;
+        DistMatrix<Real,VR,STAR> w;
+        HermitianUniformSpectrum( A, n, -10, 10 );
+        ACopy = A;
+        HermitianEigCtrl<C> ctrl;
+        ctrl.tridiagEigCtrl.subset.indexSubset = true;
+        ctrl.tridiagEigCtrl.subset.lowerIndex = ( largest ? n-k : 0 );
+        ctrl.tridiagEigCtrl.subset.upperIndex = ( largest ? n-1 : k-1 );
+        HermitianEig( LOWER, ACopy, w, Q, ctrl );
+
+        HermitianEigRefineCtrl<Real> refineCtrl;
+        refineCtrl.chebyshevDegree = degree;
+        refineCtrl.maxIts = maxIts;
+        refineCtrl.largest = largest;
+        refineCtrl.progress = progress;
+        for( Int step=0; step<numSteps; ++step )
+        {
+            // Slightly perturb A and refine the previous eigenvectors
+            HermitianUniformSpectrum( E, n, -10*perturb, 10*perturb );
+            A += E;
+            Timer timer;
+            timer.Start();
+            auto info = HermitianEigRefine( LOWER, A, w, Q, refineCtrl, ctrl );
+            const double runTime = timer.Stop();
+            if( mpi::Rank() == 0 )
+                Output
+                ("Step ",step,": ",info.numIts," iterations, residual=",
+                 info.residual,( info.fellBack ? " (fell back)" : "" ),
+                 ", ",runTime," seconds");
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -72,6 +72,12 @@ main( int argc, char* argv[] )
         const Int basisSize = Input("--basisSize","num Arnoldi vectors",10);
         const Int maxIts = Input("--maxIts","maximum pseudospec iter's",200);
         const Real psTol = Input("--psTol","tolerance for pseudospectra",1e-6);
+        const Real contour =
+            Input("--contour","refine about this contour (0: uniform)",0.);
+        const Int refineLevels =
+            Input("--refineLevels","levels of adaptive refinement",3);
+        const Int shiftGroupSize =
+            Input("--shiftGroupSize","processes per shift batch (0: all)",0);
         // Uniform options
         const Real uniformRealCenter = 
             Input("--uniformRealCenter","real center of uniform dist",0.);
@@ -248,6 +254,10 @@ main( int argc, char* argv[] )
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
         psCtrl.progress = progress;
+        if( contour > Real(0) )
+            psCtrl.contours.push_back( contour );
+        psCtrl.refineLevels = refineLevels;
+        psCtrl.shiftGroupSize = shiftGroupSize;
 #ifdef EL_HAVE_SCALAPACK
         psCtrl.schurCtrl.hessSchurCtrl.blockHeight = nbDist;
         psCtrl.schurCtrl.hessSchurCtrl.scalapack = false;
@@ -24,6 +24,8 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const bool colPiv = Input("--colPiv","QR with col pivoting?",false);
         const Int maxIts = Input("--maxIts","maximum number of QDWH it's",20);
+        const bool mixed =
+          Input("--mixed","start in single precision?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -38,6 +40,7 @@ main( int argc, char* argv[] )
         ctrl.qdwh = true;
         ctrl.qdwhCtrl.colPiv = colPiv;
         ctrl.qdwhCtrl.maxIts = maxIts;
+        ctrl.qdwhCtrl.mixedPrecision = mixed;
         auto info = Polar( Q, ctrl );
         Zeros( P, n, n );
         Gemm( ADJOINT, NORMAL, C(1), Q, A, C(0), P );
@@ -46,6 +49,8 @@ main( int argc, char* argv[] )
             Output("Total QDWH iterations: ",info.qdwhInfo.numIts);
             Output("  QR iterations:       ",info.qdwhInfo.numQRIts);
             Output("  Cholesky iterations: ",info.qdwhInfo.numCholIts);
+            if( mixed )
+                Output("  Single-precision its:",info.qdwhInfo.numLowIts);
         }
 
         // Check and report overall and orthogonality error
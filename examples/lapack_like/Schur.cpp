@@ -36,6 +36,8 @@ main( int argc, char* argv[] )
         const Real sdcTol = Input("--sdcTol","SDC split tolerance",Real(0));
         const Real spreadFactor = Input("--spreadFactor","median pert.",1e-6);
         const bool random = Input("--random","random RRQR?",true);
+        const bool inverseFree =
+          Input("--inverseFree","inverse-free iteration?",false);
         const bool progress = Input("--progress","output progress?",false);
 #endif
         const bool display = Input("--display","display matrices?",false);
@@ -66,6 +68,7 @@ main( int argc, char* argv[] )
         ctrl.sdcCtrl.tol = sdcTol;
         ctrl.sdcCtrl.spreadFactor = spreadFactor;
         ctrl.sdcCtrl.random = random;
+        ctrl.sdcCtrl.inverseFree = inverseFree;
         ctrl.sdcCtrl.progress = progress;
         ctrl.sdcCtrl.signCtrl.tol = signTol;
         ctrl.sdcCtrl.signCtrl.progress = progress;
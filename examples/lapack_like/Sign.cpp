@@ -23,6 +23,10 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const SignScaling scaling = 
             static_cast<SignScaling>(Input("--scaling","scaling strategy",0));
+        const SignMethod method =
+            static_cast<SignMethod>(Input("--method","sign method",0));
+        const bool realSpectrum =
+          Input("--realSpectrum","use a Hermitian matrix?",false);
         const Int maxIts = Input("--maxIts","max number of iter's",100);
         const double tol = Input("--tol","convergence tolerance",1e-6);
         const bool progress = Input("--progress","print sign progress?",true);
@@ -32,7 +36,10 @@ main( int argc, char* argv[] )
         PrintInputReport();
 
         DistMatrix<C> A;
-        Uniform( A, m, n );
+        if( realSpectrum )
+            HermitianUniformSpectrum( A, n, -10, 10 );
+        else
+            Uniform( A, m, n );
         if( print )
             Print( A, "A" );
         if( display )
@@ -43,6 +50,8 @@ main( int argc, char* argv[] )
         signCtrl.tol = tol;
         signCtrl.progress = progress;
         signCtrl.scaling = scaling;
+        signCtrl.method = method;
+        signCtrl.realSpectrum = realSpectrum;
 
         Timer timer;
         // Compute sgn(A)
@@ -57,6 +66,14 @@ main( int argc, char* argv[] )
             Display( A, "A" );
         if( mpi::Rank() == 0 )
             Output("Sign time: ",timer.Total()," secs");
+
+        // Check that sgn(A) is an involution
+        DistMatrix<C> E( A.Grid() );
+        Identity( E, n, n );
+        Gemm( NORMAL, NORMAL, C(-1), A, A, C(1), E );
+        const Real involutionError = FrobeniusNorm( E );
+        if( mpi::Rank() == 0 )
+            Output("|| I - sgn(A)^2 ||_F = ",involutionError);
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -52,6 +52,18 @@ int main( int argc, char* argv[] )
             }
         }
 
+        // Generate the primes in [B1,2 B1] in bulk without storing them
+        {
+            timer.Start();
+
+            DynamicSieve<TSieve,TSieveSmall> sieve;
+            auto primes = sieve.Generate( B1, 2*B1 );
+
+            Output
+            ("Generated the ",primes.size()," primes in [",B1,",",2*B1,
+             "] in ",timer.Stop()," seconds");
+        }
+
         // Count the number of primes below the given bound by sequentially
         // generating each
         {
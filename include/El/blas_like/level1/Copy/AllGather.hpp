@@ -39,28 +39,54 @@ void AllGather
             const Int maxLocalHeight = MaxLength(height,colStride);
             const Int maxLocalWidth = MaxLength(width,rowStride);
             const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
-            vector<T> buf;
-            FastResize( buf, (distStride+1)*portionSize );
-            T* sendBuf = &buf[0];
-            T* recvBuf = &buf[portionSize];
 
-            // Pack
-            util::InterleaveMatrix
-            ( A.LocalHeight(), A.LocalWidth(),
-              A.LockedBuffer(), 1, A.LDim(),
-              sendBuf,          1, A.LocalHeight() );
+            // Within a node, pack directly into our portion of a shared
+            // window and unpack directly from those of our peers
+            mpi::SharedWindow* window = A.Grid().NodeWindow( A.DistComm() );
+            if( IsPacked<T>::value && window != nullptr &&
+                window->Reserve( A.DistComm(), portionSize*sizeof(T) ) )
+            {
+                T* portions = reinterpret_cast<T*>(window->Portion(0));
+                const Int portionStride = window->PortionBytes()/sizeof(T);
+                util::InterleaveMatrix
+                ( A.LocalHeight(), A.LocalWidth(),
+                  A.LockedBuffer(), 1, A.LDim(),
+                  &portions[A.DistRank()*portionStride], 1, A.LocalHeight() );
+                window->Sync( A.DistComm() );
+                util::StridedUnpack
+                ( height, width,
+                  A.ColAlign(), colStride,
+                  A.RowAlign(), rowStride,
+                  portions,   portionStride,
+                  B.Buffer(), B.LDim() );
+                // Our peers must finish reading before the window is reused
+                window->Sync( A.DistComm() );
+            }
+            else
+            {
+                ScratchBuffer<T> buf;
+                FastResize( buf, (distStride+1)*portionSize );
+                T* sendBuf = &buf[0];
+                T* recvBuf = &buf[portionSize];
+
+                // Pack
+                util::InterleaveMatrix
+                ( A.LocalHeight(), A.LocalWidth(),
+                  A.LockedBuffer(), 1, A.LDim(),
+                  sendBuf,          1, A.LocalHeight() );
 
-            // Communicate
-            mpi::AllGather
-            ( sendBuf, portionSize, recvBuf, portionSize, A.DistComm() );
+                // Communicate
+                mpi::AllGather
+                ( sendBuf, portionSize, recvBuf, portionSize, A.DistComm() );
 
-            // Unpack
-            util::StridedUnpack
-            ( height, width,
-              A.ColAlign(), colStride,
-              A.RowAlign(), rowStride,
-              recvBuf, portionSize,
-              B.Buffer(), B.LDim() );
+                // Unpack
+                util::StridedUnpack
+                ( height, width,
+                  A.ColAlign(), colStride,
+                  A.RowAlign(), rowStride,
+                  recvBuf, portionSize,
+                  B.Buffer(), B.LDim() );
+            }
         }
     }
     if( A.Grid().InGrid() && A.CrossComm() != mpi::COMM_SELF )
@@ -68,7 +94,7 @@ void AllGather
         // Pack from the root
         const Int BLocalHeight = B.LocalHeight();
         const Int BLocalWidth = B.LocalWidth();
-        vector<T> buf;
+        ScratchBuffer<T> buf;
         FastResize( buf, BLocalHeight*BLocalWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
@@ -48,7 +48,7 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
             else if( height == 1 )
             {
                 const Int localWidthB = B.LocalWidth();
-                vector<T> bcastBuf;
+                ScratchBuffer<T> bcastBuf;
                 FastResize( bcastBuf, localWidthB );
 
                 if( A.ColRank() == A.ColAlign() )
@@ -75,7 +75,7 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int localWidth = A.LocalWidth();
                 const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
 
-                vector<T> buffer;
+                ScratchBuffer<T> buffer;
                 FastResize( buffer, (colStride+1)*portionSize );
                 T* sendBuf = &buffer[0];
                 T* recvBuf = &buffer[portionSize];
@@ -109,7 +109,7 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
             if( height == 1 )
             {
                 const Int localWidthB = B.LocalWidth();
-                vector<T> buffer;
+                ScratchBuffer<T> buffer;
                 T* bcastBuf;
 
                 if( A.ColRank() == A.ColAlign() )
@@ -150,7 +150,7 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int portionSize =
                     mpi::Pad( maxLocalHeight*maxLocalWidth );
 
-                vector<T> buffer;
+                ScratchBuffer<T> buffer;
                 FastResize( buffer, (colStride+1)*portionSize );
                 T* firstBuf  = &buffer[0];
                 T* secondBuf = &buffer[portionSize];
@@ -184,7 +184,7 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         // Pack from the root
         const Int localHeight = B.LocalHeight();
         const Int localWidth = B.LocalWidth();
-        vector<T> buf;
+        ScratchBuffer<T> buf;
         FastResize( buf, localHeight*localWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
@@ -45,31 +45,63 @@ void ColAllToAllPromote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
-
-            // Pack            
-            util::RowStridedPack
-            ( A.LocalHeight(), width,
-              B.RowAlign(), colStrideUnion,
-              A.LockedBuffer(), A.LDim(),
-              firstBuf,         portionSize );
-
-            // Simultaneously Gather in columns and Scatter in rows
-            mpi::AllToAll
-            ( firstBuf,  portionSize,
-              secondBuf, portionSize, A.PartialUnionColComm() );
-
-            // Unpack
-            util::PartialColStridedUnpack 
-            ( height, B.LocalWidth(),
-              A.ColAlign(), colStride,
-              colStrideUnion, colStridePart, colRankPart,
-              B.ColShift(),
-              secondBuf,  portionSize,
-              B.Buffer(), B.LDim() );
+            // Within a node, each process packs all of its outgoing portions
+            // into its part of a shared window, and the portion destined for
+            // process q is read directly from offset q*portionSize of each
+            // peer's part
+            mpi::Comm unionComm = A.PartialUnionColComm();
+            mpi::SharedWindow* window = A.Grid().NodeWindow( unionComm );
+            if( IsPacked<T>::value && window != nullptr &&
+                window->Reserve
+                ( unionComm, colStrideUnion*portionSize*sizeof(T) ) )
+            {
+                T* parts = reinterpret_cast<T*>(window->Portion(0));
+                const Int partStride = window->PortionBytes()/sizeof(T);
+                const Int unionRank = A.PartialUnionColRank();
+                util::RowStridedPack
+                ( A.LocalHeight(), width,
+                  B.RowAlign(), colStrideUnion,
+                  A.LockedBuffer(), A.LDim(),
+                  &parts[unionRank*partStride], portionSize );
+                window->Sync( unionComm );
+                util::PartialColStridedUnpack 
+                ( height, B.LocalWidth(),
+                  A.ColAlign(), colStride,
+                  colStrideUnion, colStridePart, colRankPart,
+                  B.ColShift(),
+                  &parts[unionRank*portionSize], partStride,
+                  B.Buffer(), B.LDim() );
+                // Our peers must finish reading before the window is reused
+                window->Sync( unionComm );
+            }
+            else
+            {
+                ScratchBuffer<T> buffer;
+                FastResize( buffer, 2*colStrideUnion*portionSize );
+                T* firstBuf  = &buffer[0];
+                T* secondBuf = &buffer[colStrideUnion*portionSize];
+
+                // Pack            
+                util::RowStridedPack
+                ( A.LocalHeight(), width,
+                  B.RowAlign(), colStrideUnion,
+                  A.LockedBuffer(), A.LDim(),
+                  firstBuf,         portionSize );
+
+                // Simultaneously Gather in columns and Scatter in rows
+                mpi::AllToAll
+                ( firstBuf,  portionSize,
+                  secondBuf, portionSize, unionComm );
+
+                // Unpack
+                util::PartialColStridedUnpack 
+                ( height, B.LocalWidth(),
+                  A.ColAlign(), colStride,
+                  colStrideUnion, colStridePart, colRankPart,
+                  B.ColShift(),
+                  secondBuf,  portionSize,
+                  B.Buffer(), B.LDim() );
+            }
         }
     }
     else
@@ -81,7 +113,7 @@ void ColAllToAllPromote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
+        ScratchBuffer<T> buffer;
         FastResize( buffer, 2*colStrideUnion*portionSize );
         T* firstBuf  = &buffer[0];
         T* secondBuf = &buffer[colStrideUnion*portionSize];
@@ -52,7 +52,7 @@ void Gather
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
     int totalRecv = Scan( recvCounts, recvOffsets );
-    vector<T> sendBuf, recvBuf;
+    ScratchBuffer<T> sendBuf, recvBuf;
     FastResize( sendBuf, totalSend );
     FastResize( recvBuf, totalRecv );
     if( !irrelevant )
@@ -127,7 +127,7 @@ void Gather
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
     int totalRecv = Scan( recvCounts, recvOffsets );
-    vector<T> sendBuf, recvBuf;
+    ScratchBuffer<T> sendBuf, recvBuf;
     FastResize( sendBuf, totalSend );
     FastResize( recvBuf, totalRecv );
     if( !irrelevant )
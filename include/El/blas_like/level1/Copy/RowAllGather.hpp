@@ -50,7 +50,7 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
-                vector<T> buffer;
+                ScratchBuffer<T> buffer;
                 FastResize( buffer, (rowStride+1)*portionSize );
                 T* sendBuf = &buffer[0];
                 T* recvBuf = &buffer[portionSize];
@@ -103,7 +103,7 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
+                ScratchBuffer<T> buffer;
                 FastResize( buffer, (rowStride+1)*portionSize );
                 T* firstBuf = &buffer[0];
                 T* secondBuf = &buffer[portionSize];
@@ -137,7 +137,7 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         // Pack from the root
         const Int localHeight = B.LocalHeight();
         const Int localWidth = B.LocalWidth();
-        vector<T> buf;
+        ScratchBuffer<T> buf;
         FastResize( buf, localHeight*localWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
@@ -214,7 +214,7 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   MaxBlockedLength(width,blockWidth,rowCut,rowStride);
 
                 const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
-                vector<T> buffer;
+                ScratchBuffer<T> buffer;
                 FastResize( buffer, (rowStride+1)*portionSize );
                 T* sendBuf = &buffer[0];
                 T* recvBuf = &buffer[portionSize];
@@ -271,7 +271,7 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   MaxBlockedLength(width,blockWidth,rowCut,rowStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
+                ScratchBuffer<T> buffer;
                 FastResize( buffer, (rowStride+1)*portionSize );
                 T* firstBuf = &buffer[0];
                 T* secondBuf = &buffer[portionSize];
@@ -305,7 +305,7 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
         // Pack from the root
         const Int localHeight = B.LocalHeight();
         const Int localWidth = B.LocalWidth();
-        vector<T> buf;
+        ScratchBuffer<T> buf;
         FastResize( buf, localHeight*localWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
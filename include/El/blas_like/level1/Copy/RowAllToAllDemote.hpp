@@ -46,7 +46,7 @@ void RowAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
+            ScratchBuffer<T> buffer;
             FastResize( buffer, 2*rowStrideUnion*portionSize );
             T* firstBuf  = &buffer[0];
             T* secondBuf = &buffer[rowStrideUnion*portionSize];
@@ -82,7 +82,7 @@ void RowAllToAllDemote
         const Int sendRowRankPart = Mod( rowRankPart+rowDiff, rowStridePart );
         const Int recvRowRankPart = Mod( rowRankPart-rowDiff, rowStridePart );
 
-        vector<T> buffer;
+        ScratchBuffer<T> buffer;
         FastResize( buffer, 2*rowStrideUnion*portionSize );
         T* firstBuf  = &buffer[0];
         T* secondBuf = &buffer[rowStrideUnion*portionSize];
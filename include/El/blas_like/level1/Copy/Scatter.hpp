@@ -50,7 +50,7 @@ void Scatter
         return;
     }
 
-    vector<T> buffer;
+    ScratchBuffer<T> buffer;
     T* recvBuf=0; // some compilers (falsely) warn otherwise
     if( A.CrossRank() == root )
     {
@@ -115,7 +115,7 @@ void Scatter
     if( B.Participating() )
     {
         const Int pkgSize = mpi::Pad( height*width );
-        vector<T> buffer;
+        ScratchBuffer<T> buffer;
         FastResize( buffer, pkgSize );
 
         // Pack            
@@ -107,7 +107,7 @@ void TranslateBetweenGrids
         requiredMemory += maxSendSize;
     if( inBGrid )
         requiredMemory += maxSendSize;
-    vector<T> auxBuf;
+    ScratchBuffer<T> auxBuf;
     FastResize( auxBuf, requiredMemory );
     Int offset = 0;
     T* sendBuf = &auxBuf[offset];
@@ -290,7 +290,7 @@ void TranslateBetweenGrids
         requiredMemory += height*width;
     if( B.Participating() )
         requiredMemory += height*width;
-    vector<T> buffer;
+    ScratchBuffer<T> buffer;
     FastResize( buffer, requiredMemory );
     Int offset = 0;
     T* sendBuf = &buffer[offset];
@@ -336,6 +336,33 @@ void TranslateBetweenGrids
         mpi::Wait( sendRequest );
 }
 
+template<typename T,Dist U,Dist V>
+void TranslateBetweenGrids
+( const DistMatrix<T,U,V>& A,
+        DistMatrix<T,U,V>& B,
+  Int panelWidth,
+  function<void(Range<Int>)> onPanel )
+{
+    DEBUG_CSE
+    if( panelWidth <= 0 )
+        LogicError("Panel width must be positive");
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.Resize( height, width );
+
+    // Every process viewing both grids must take part in each panel's
+    // translation (and callback), so all of them walk the same panels
+    for( Int j=0; j<width; j+=panelWidth )
+    {
+        const Range<Int> J( j, Min(j+panelWidth,width) );
+        auto APanel = A( ALL, J );
+        auto BPanel = B( ALL, J );
+        TranslateBetweenGrids( APanel, BPanel );
+        if( onPanel )
+            onPanel( J );
+    }
+}
+
 } // namespace copy
 } // namespace El
 
@@ -44,6 +44,14 @@ void TranslateBetweenGrids
 template<typename T,Dist U,Dist V>
 void TranslateBetweenGrids
 ( const DistMatrix<T,U,V>& A, DistMatrix<T,U,V>& B );
+// Stream A into B one column panel at a time so that the temporary buffers
+// are bounded by the panel width rather than the full matrix. After each
+// panel has arrived, 'onPanel' (if nonempty) is called with its columns so
+// that work on B's grid may begin before the remaining panels are moved.
+template<typename T,Dist U,Dist V>
+void TranslateBetweenGrids
+( const DistMatrix<T,U,V>& A, DistMatrix<T,U,V>& B, Int panelWidth,
+  function<void(Range<Int>)> onPanel=function<void(Range<Int>)>() );
 
 // NOTE: Only instantiated for (U,V)=(MC,MR) and (U,V)=(MR,MC)
 template<typename T,Dist U,Dist V>
@@ -13,12 +13,56 @@ namespace El {
 namespace copy {
 namespace util {
 
+// Pack and unpack operations involving fewer than PACK_PARALLEL_CUTOFF entries
+// are not worth the overhead of launching threads
+const Int PACK_PARALLEL_CUTOFF = 32768;
+// The (square) tile size used by the multithreaded pack and unpack kernels so
+// that both the source and destination tiles remain in cache
+const Int PACK_TILE_SIZE = 64;
+
+#ifdef EL_HYBRID
+template<typename T>
+void ThreadedInterleaveMatrix
+( Int height, Int width,
+  const T* A, Int colStrideA, Int rowStrideA,
+        T* B, Int colStrideB, Int rowStrideB )
+{
+    const Int numRowTiles = (height+PACK_TILE_SIZE-1) / PACK_TILE_SIZE;
+    const Int numColTiles = (width+PACK_TILE_SIZE-1) / PACK_TILE_SIZE;
+    EL_PARALLEL_FOR_COLLAPSE2
+    for( Int jTile=0; jTile<numColTiles; ++jTile )
+    {
+        for( Int iTile=0; iTile<numRowTiles; ++iTile )
+        {
+            const Int i = iTile*PACK_TILE_SIZE;
+            const Int j = jTile*PACK_TILE_SIZE;
+            const Int tileHeight = Min(PACK_TILE_SIZE,height-i);
+            const Int tileWidth = Min(PACK_TILE_SIZE,width-j);
+            for( Int jSub=j; jSub<j+tileWidth; ++jSub )
+                StridedMemCopy
+                ( &B[i*colStrideB+jSub*rowStrideB], colStrideB,
+                  &A[i*colStrideA+jSub*rowStrideA], colStrideA, tileHeight );
+        }
+    }
+}
+#endif
+
 template<typename T>
 void InterleaveMatrix
 ( Int height, Int width,
   const T* A, Int colStrideA, Int rowStrideA,
         T* B, Int colStrideB, Int rowStrideB )
 {
+#ifdef EL_HYBRID
+    if( height*width >= PACK_PARALLEL_CUTOFF )
+    {
+        ThreadedInterleaveMatrix
+        ( height, width,
+          A, colStrideA, rowStrideA,
+          B, colStrideB, rowStrideB );
+        return;
+    }
+#endif
     if( colStrideA == 1 && colStrideB == 1 )
     {
         lapack::Copy( 'F', height, width, A, rowStrideA, B, rowStrideB );
@@ -121,10 +165,10 @@ void BlockedColStridedUnpack
                 firstBlockHeight :
                 Min(blockHeight,height-rowIndex) );
 
-            lapack::Copy
-            ( 'F', thisBlockHeight, width,
-              &APortion[packedRowIndex], localHeight,
-              &B[rowIndex],              BLDim );
+            InterleaveMatrix
+            ( thisBlockHeight, width,
+              &APortion[packedRowIndex], 1, localHeight,
+              &B[rowIndex],              1, BLDim );
 
             blockRow += colStride;
             rowIndex += thisBlockHeight + (colStride-1)*blockHeight;
@@ -230,10 +274,10 @@ void RowStridedPack
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth, 
-          &A[rowShift*ALDim],        rowStride*ALDim,
-          &BPortions[k*portionSize], height );
+        InterleaveMatrix
+        ( height, localWidth,
+          &A[rowShift*ALDim],        1, rowStride*ALDim,
+          &BPortions[k*portionSize], 1, height );
     }
 }
 
@@ -248,10 +292,10 @@ void RowStridedUnpack
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowShift*BLDim],        rowStride*BLDim );
+        InterleaveMatrix
+        ( height, localWidth,
+          &APortions[k*portionSize], 1, height,
+          &B[rowShift*BLDim],        1, rowStride*BLDim );
     }
 }
 
@@ -280,10 +324,10 @@ void BlockedRowStridedUnpack
                 firstBlockWidth :
                 Min(blockWidth,width-colIndex) );
 
-            lapack::Copy
-            ( 'F', height, thisBlockWidth,
-              &APortion[packedColIndex*height], height,
-              &B[colIndex*BLDim],               BLDim );
+            InterleaveMatrix
+            ( height, thisBlockWidth,
+              &APortion[packedColIndex*height], 1, height,
+              &B[colIndex*BLDim],               1, BLDim );
 
             blockCol += rowStride;
             colIndex += thisBlockWidth + (rowStride-1)*blockWidth;
@@ -307,10 +351,10 @@ void PartialRowStridedPack
             Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
         const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
-          &BPortions[k*portionSize], height );
+        InterleaveMatrix
+        ( height, localWidth,
+          &A[rowOffset*ALDim],       1, rowStrideUnion*ALDim,
+          &BPortions[k*portionSize], 1, height );
     }
 }
 template<typename T>
@@ -328,10 +372,10 @@ void PartialRowStridedUnpack
             Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
         const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowOffset*BLDim],       rowStrideUnion*BLDim );
+        InterleaveMatrix
+        ( height, localWidth,
+          &APortions[k*portionSize], 1, height,
+          &B[rowOffset*BLDim],       1, rowStrideUnion*BLDim );
     }
 }
 
@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPYPLAN_HPP
+#define EL_BLAS_COPYPLAN_HPP
+
+namespace El {
+
+// The parameters of the latency-bandwidth model used to compare the
+// candidate redistributions
+struct CopyPlanCtrl
+{
+    double latency=2e-6;           // seconds per message
+    double inverseBandwidth=1e-10; // seconds per byte
+};
+
+// A single application of one of the existing redistribution kernels, e.g.,
+// copy::RowAllGather, with the modeled number of messages sent and entries
+// received by each process
+struct CopyStep
+{
+    Dist colDist, rowDist; // the distribution produced by this step
+    string kernel;
+    double messages, words;
+};
+
+struct CopyPlan
+{
+    Dist colDist, rowDist; // the source distribution
+    // Redistributions involving [MD,* ], [* ,MD], or [o ,o ] are not modeled
+    // and are simply dispatched to Copy
+    bool modeled;
+    // If true, 'steps' is empty and copy::GeneralPurpose is used
+    bool generalPurpose;
+    vector<CopyStep> steps;
+
+    double messages, words, cost;
+    // The modeled cost of copy::GeneralPurpose, for comparison
+    double generalPurposeCost;
+};
+
+// Return the cheapest (modeled) sequence of existing redistribution kernels
+// for the given change of distribution. Plans are cached by the pair of
+// distributions, the grid dimensions, the entry size, the model parameters,
+// and the power of two nearest to height*width, so that subsequent calls
+// with similarly-sized matrices reuse the same plan.
+const CopyPlan& PlanCopy
+( Dist colDistA, Dist rowDistA, Dist colDistB, Dist rowDistB,
+  const Grid& grid, Int height, Int width, Int entrySize,
+  const CopyPlanCtrl& ctrl=CopyPlanCtrl() );
+
+void PrintCopyPlan( const CopyPlan& plan, ostream& os=cout );
+// Print every cached plan
+void PrintCopyPlans( ostream& os=cout );
+void ClearCopyPlans();
+
+namespace copy {
+
+template<typename T>
+unique_ptr<ElementalMatrix<T>>
+MakeIntermediate( Dist colDist, Dist rowDist, const Grid& grid )
+{
+    DEBUG_CSE
+    unique_ptr<ElementalMatrix<T>> C;
+    #define GUARD(CDIST,RDIST) colDist == CDIST && rowDist == RDIST
+    #define PAYLOAD(CDIST,RDIST) \
+      C.reset( new DistMatrix<T,CDIST,RDIST>(grid) );
+    #include <El/macros/GuardAndPayload.h>
+    return C;
+}
+
+} // namespace copy
+
+// B := A, routed through the intermediate distributions chosen by PlanCopy
+template<typename T>
+void PlannedCopy
+( const ElementalMatrix<T>& A,
+        ElementalMatrix<T>& B,
+  const CopyPlanCtrl& ctrl=CopyPlanCtrl() )
+{
+    DEBUG_CSE
+    if( A.Grid() != B.Grid() )
+    {
+        Copy( A, B );
+        return;
+    }
+    const CopyPlan& plan =
+      PlanCopy
+      ( A.ColDist(), A.RowDist(), B.ColDist(), B.RowDist(),
+        A.Grid(), A.Height(), A.Width(), sizeof(T), ctrl );
+    if( plan.generalPurpose )
+    {
+        copy::GeneralPurpose( A, B );
+        return;
+    }
+
+    const Int numSteps = plan.steps.size();
+    unique_ptr<ElementalMatrix<T>> C;
+    const ElementalMatrix<T>* source = &A;
+    for( Int step=0; step<numSteps-1; ++step )
+    {
+        auto next =
+          copy::MakeIntermediate<T>
+          ( plan.steps[step].colDist, plan.steps[step].rowDist, A.Grid() );
+        Copy( *source, *next );
+        C = std::move( next );
+        source = C.get();
+    }
+    Copy( *source, B );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPYPLAN_HPP
@@ -0,0 +1,279 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_EXPRESSION_HPP
+#define EL_BLAS_EXPRESSION_HPP
+
+// A small expression-template layer for fusing chains of entrywise updates,
+// e.g.,
+//
+//   Evaluate( alpha*Expr(X) + beta*Hadamard(Expr(Z),Expr(W)), Y );
+//
+// performs Y := alpha X + beta (Z o W) in a single pass over the local data
+// without forming any temporaries. Y may itself appear within the expression
+// since each entry of Y only depends upon the same entry of the operands.
+//
+// All distributed operands must share the distribution and alignments of
+// the first distributed operand, and local and distributed operands may not
+// be mixed.
+
+namespace El {
+
+namespace expr {
+
+template<class Derived>
+struct Expression
+{
+    const Derived& Get() const { return static_cast<const Derived&>(*this); }
+};
+
+template<typename T>
+class Leaf : public Expression<Leaf<T>>
+{
+public:
+    typedef T Scalar;
+
+    explicit Leaf( const Matrix<T>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim()),
+      height_(A.Height()), width_(A.Width()),
+      localHeight_(A.Height()), localWidth_(A.Width()),
+      dist_(nullptr)
+    { }
+
+    explicit Leaf( const ElementalMatrix<T>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim()),
+      height_(A.Height()), width_(A.Width()),
+      localHeight_(A.LocalHeight()), localWidth_(A.LocalWidth()),
+      dist_(&A)
+    { }
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    Int LocalHeight() const EL_NO_EXCEPT { return localHeight_; }
+    Int LocalWidth() const EL_NO_EXCEPT { return localWidth_; }
+
+    const ElementalMatrix<T>* DistLeaf() const EL_NO_EXCEPT { return dist_; }
+    bool Conforms( const ElementalData& data ) const
+    { return dist_ != nullptr && ElementalData(*dist_) == data; }
+
+    T operator()( Int iLoc, Int jLoc ) const EL_NO_EXCEPT
+    { return buffer_[iLoc+jLoc*ldim_]; }
+
+private:
+    const T* buffer_;
+    Int ldim_, height_, width_, localHeight_, localWidth_;
+    const ElementalMatrix<T>* dist_;
+};
+
+template<class E>
+class Scaled : public Expression<Scaled<E>>
+{
+public:
+    typedef typename E::Scalar Scalar;
+
+    Scaled( Scalar alpha, const E& e ) : alpha_(alpha), e_(e) { }
+
+    Int Height() const EL_NO_EXCEPT { return e_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return e_.Width(); }
+    Int LocalHeight() const EL_NO_EXCEPT { return e_.LocalHeight(); }
+    Int LocalWidth() const EL_NO_EXCEPT { return e_.LocalWidth(); }
+
+    const ElementalMatrix<Scalar>* DistLeaf() const EL_NO_EXCEPT
+    { return e_.DistLeaf(); }
+    bool Conforms( const ElementalData& data ) const
+    { return e_.Conforms( data ); }
+
+    Scalar operator()( Int iLoc, Int jLoc ) const EL_NO_EXCEPT
+    { return alpha_*e_(iLoc,jLoc); }
+
+private:
+    Scalar alpha_;
+    E e_;
+};
+
+template<class E,class Function>
+class Map : public Expression<Map<E,Function>>
+{
+public:
+    typedef typename E::Scalar Scalar;
+
+    Map( const E& e, Function func ) : e_(e), func_(func) { }
+
+    Int Height() const EL_NO_EXCEPT { return e_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return e_.Width(); }
+    Int LocalHeight() const EL_NO_EXCEPT { return e_.LocalHeight(); }
+    Int LocalWidth() const EL_NO_EXCEPT { return e_.LocalWidth(); }
+
+    const ElementalMatrix<Scalar>* DistLeaf() const EL_NO_EXCEPT
+    { return e_.DistLeaf(); }
+    bool Conforms( const ElementalData& data ) const
+    { return e_.Conforms( data ); }
+
+    Scalar operator()( Int iLoc, Int jLoc ) const
+    { return func_(e_(iLoc,jLoc)); }
+
+private:
+    E e_;
+    Function func_;
+};
+
+// The entrywise binary operations only differ in how they combine entries
+template<class L,class R,class Op>
+class Binary : public Expression<Binary<L,R,Op>>
+{
+public:
+    typedef typename L::Scalar Scalar;
+    static_assert
+    ( std::is_same<Scalar,typename R::Scalar>::value,
+      "Operands of an expression must have the same scalar type" );
+
+    Binary( const L& left, const R& right )
+    : left_(left), right_(right)
+    {
+        if( left.Height() != right.Height() || left.Width() != right.Width() )
+            LogicError
+            ("Nonconformal entrywise expression: ",
+             left.Height()," x ",left.Width()," vs. ",
+             right.Height()," x ",right.Width());
+    }
+
+    Int Height() const EL_NO_EXCEPT { return left_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return left_.Width(); }
+    Int LocalHeight() const EL_NO_EXCEPT { return left_.LocalHeight(); }
+    Int LocalWidth() const EL_NO_EXCEPT { return left_.LocalWidth(); }
+
+    const ElementalMatrix<Scalar>* DistLeaf() const EL_NO_EXCEPT
+    {
+        const ElementalMatrix<Scalar>* dist = left_.DistLeaf();
+        return dist != nullptr ? dist : right_.DistLeaf();
+    }
+    bool Conforms( const ElementalData& data ) const
+    { return left_.Conforms( data ) && right_.Conforms( data ); }
+
+    Scalar operator()( Int iLoc, Int jLoc ) const EL_NO_EXCEPT
+    { return Op::Apply( left_(iLoc,jLoc), right_(iLoc,jLoc) ); }
+
+private:
+    L left_;
+    R right_;
+};
+
+struct SumOp
+{ template<typename T> static T Apply( T a, T b ) { return a+b; } };
+struct DifferenceOp
+{ template<typename T> static T Apply( T a, T b ) { return a-b; } };
+struct ProductOp
+{ template<typename T> static T Apply( T a, T b ) { return a*b; } };
+
+template<class L,class R>
+inline Binary<L,R,SumOp>
+operator+( const Expression<L>& left, const Expression<R>& right )
+{ return Binary<L,R,SumOp>( left.Get(), right.Get() ); }
+
+template<class L,class R>
+inline Binary<L,R,DifferenceOp>
+operator-( const Expression<L>& left, const Expression<R>& right )
+{ return Binary<L,R,DifferenceOp>( left.Get(), right.Get() ); }
+
+template<class E>
+inline Scaled<E>
+operator*( typename E::Scalar alpha, const Expression<E>& e )
+{ return Scaled<E>( alpha, e.Get() ); }
+
+template<class E>
+inline Scaled<E>
+operator*( const Expression<E>& e, typename E::Scalar alpha )
+{ return Scaled<E>( alpha, e.Get() ); }
+
+template<class E>
+inline Scaled<E>
+operator-( const Expression<E>& e )
+{ return Scaled<E>( typename E::Scalar(-1), e.Get() ); }
+
+// C(i,j) := A(i,j) B(i,j)
+template<class L,class R>
+inline Binary<L,R,ProductOp>
+Hadamard( const Expression<L>& left, const Expression<R>& right )
+{ return Binary<L,R,ProductOp>( left.Get(), right.Get() ); }
+
+// B(i,j) := func(A(i,j))
+template<class E,class Function>
+inline Map<E,Function>
+EntrywiseMap( const Expression<E>& e, Function func )
+{ return Map<E,Function>( e.Get(), func ); }
+
+template<class E>
+void EvaluateLocal
+( const Expression<E>& expression, Matrix<typename E::Scalar>& Y )
+{
+    DEBUG_CSE
+    const E& e = expression.Get();
+    const Int localHeight = e.LocalHeight();
+    const Int localWidth = e.LocalWidth();
+    auto* YBuf = Y.Buffer();
+    const Int YLDim = Y.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        auto* YCol = &YBuf[jLoc*YLDim];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            YCol[iLoc] = e(iLoc,jLoc);
+    }
+}
+
+} // namespace expr
+
+template<typename T>
+inline expr::Leaf<T> Expr( const Matrix<T>& A )
+{ return expr::Leaf<T>( A ); }
+
+template<typename T>
+inline expr::Leaf<T> Expr( const ElementalMatrix<T>& A )
+{ return expr::Leaf<T>( A ); }
+
+// Y := expression
+template<class E>
+void Evaluate
+( const expr::Expression<E>& expression, Matrix<typename E::Scalar>& Y )
+{
+    DEBUG_CSE
+    const E& e = expression.Get();
+    if( e.DistLeaf() != nullptr )
+        LogicError("Cannot evaluate a distributed expression into a Matrix");
+    if( Y.Height() != e.Height() || Y.Width() != e.Width() )
+        Y.Resize( e.Height(), e.Width() );
+    expr::EvaluateLocal( e, Y );
+}
+
+template<class E>
+void Evaluate
+( const expr::Expression<E>& expression,
+  ElementalMatrix<typename E::Scalar>& Y )
+{
+    DEBUG_CSE
+    const E& e = expression.Get();
+    const auto* A = e.DistLeaf();
+    if( A == nullptr )
+        LogicError("Cannot evaluate a local expression into a DistMatrix");
+    const ElementalData AData( *A );
+    if( !e.Conforms( AData ) )
+        LogicError
+        ("All operands of a distributed expression must share a "
+         "distribution and alignments");
+    if( Y.ColDist() != AData.colDist || Y.RowDist() != AData.rowDist )
+        LogicError("Y must share the distribution of the operands");
+    AssertSameGrids( *A, Y );
+    Y.AlignWith( AData );
+    if( Y.Height() != e.Height() || Y.Width() != e.Width() )
+        Y.Resize( e.Height(), e.Width() );
+    expr::EvaluateLocal( e, Y.Matrix() );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_EXPRESSION_HPP
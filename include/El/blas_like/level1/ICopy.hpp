@@ -0,0 +1,241 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_ICOPY_HPP
+#define EL_BLAS_ICOPY_HPP
+
+namespace El {
+
+// A handle on a (possibly) in-flight redistribution started by ICopy. The
+// communication proceeds while the caller performs other work, e.g., the
+// local update for the current panel of a blocked algorithm, and the result
+// is only guaranteed to reside in the target matrix once Test() has returned
+// true or Wait() has returned. The target matrix must not be read, modified,
+// or resized in the meantime.
+//
+// A request which is destroyed while still active is waited upon.
+template<typename T>
+class CopyRequest
+{
+public:
+    CopyRequest() : active_(false) { }
+    ~CopyRequest() { Wait(); }
+
+    CopyRequest( CopyRequest<T>&& request )
+    : request_(std::move(request.request_)),
+      buffer_(std::move(request.buffer_)),
+      unpack_(std::move(request.unpack_)),
+      active_(request.active_)
+    { request.active_ = false; }
+
+    CopyRequest<T>& operator=( CopyRequest<T>&& request )
+    {
+        Wait();
+        request_ = std::move(request.request_);
+        buffer_ = std::move(request.buffer_);
+        unpack_ = std::move(request.unpack_);
+        active_ = request.active_;
+        request.active_ = false;
+        return *this;
+    }
+
+    CopyRequest( const CopyRequest<T>& ) = delete;
+    CopyRequest<T>& operator=( const CopyRequest<T>& ) = delete;
+
+    // Whether or not the redistribution has yet to be completed
+    bool Active() const EL_NO_EXCEPT { return active_; }
+
+    // Complete the redistribution if its communication has finished
+    bool Test()
+    {
+        DEBUG_CSE
+        if( !active_ )
+            return true;
+        if( !mpi::Test( request_ ) )
+            return false;
+        Finish();
+        return true;
+    }
+
+    // Block until the redistribution is complete
+    void Wait()
+    {
+        DEBUG_CSE
+        if( !active_ )
+            return;
+        mpi::Wait( request_ );
+        Finish();
+    }
+
+    // For use by the non-blocking kernels: 'buffer' holds the send and
+    // receive buffers of the communication tracked by 'request', and 'unpack'
+    // is run once said communication completes
+    vector<T>& Buffer() EL_NO_EXCEPT { return buffer_; }
+    mpi::Request<T>& Request() EL_NO_EXCEPT { return request_; }
+    void Start( function<void()> unpack )
+    {
+        unpack_ = unpack;
+        active_ = true;
+    }
+
+private:
+    mpi::Request<T> request_;
+    vector<T> buffer_;
+    function<void()> unpack_;
+    bool active_;
+
+    void Finish()
+    {
+        unpack_();
+        unpack_ = function<void()>();
+        SwapClear( buffer_ );
+        active_ = false;
+    }
+};
+
+namespace copy {
+
+// (U,V) |-> (U,Collect(V)), where the AllGather within the row communicator
+// is non-blocking. Only the aligned, multi-column case without a cross
+// communicator is overlapped; all others are performed immediately.
+template<typename T>
+void IRowAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  CopyRequest<T>& request )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int rowStride = A.RowStride();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( !EL_HAVE_NONBLOCKING || !IsPacked<T>::value ||
+        B.ColAlign() != A.ColAlign() || rowStride == 1 || width == 1 ||
+        A.CrossComm() != mpi::COMM_SELF )
+    {
+        Copy( A, B );
+        return;
+    }
+    if( !A.Participating() )
+        return;
+
+    const Int localHeight = A.LocalHeight();
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
+    vector<T>& buffer = request.Buffer();
+    FastResize( buffer, (rowStride+1)*portionSize );
+    T* sendBuf = &buffer[0];
+    T* recvBuf = &buffer[portionSize];
+
+    // Pack
+    util::InterleaveMatrix
+    ( localHeight, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf,          1, localHeight );
+
+    // Start the communication
+    mpi::IAllGather
+    ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm(),
+      request.Request() );
+
+    // Unpack upon completion
+    const Int rowAlign = A.RowAlign();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    request.Start
+    ( [=]()
+      {
+          util::RowStridedUnpack
+          ( localHeight, width, rowAlign, rowStride,
+            recvBuf, portionSize, BBuf, BLDim );
+      } );
+}
+
+// (U,V) |-> (Collect(U),V), where the AllGather within the column
+// communicator is non-blocking. Only the aligned, multi-row case without a
+// cross communicator is overlapped; all others are performed immediately.
+template<typename T>
+void IColAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  CopyRequest<T>& request )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int colStride = A.ColStride();
+    B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+    if( !EL_HAVE_NONBLOCKING || !IsPacked<T>::value ||
+        B.RowAlign() != A.RowAlign() || colStride == 1 || height == 1 ||
+        A.CrossComm() != mpi::COMM_SELF )
+    {
+        Copy( A, B );
+        return;
+    }
+    if( !A.Participating() )
+        return;
+
+    const Int localWidth = A.LocalWidth();
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
+    vector<T>& buffer = request.Buffer();
+    FastResize( buffer, (colStride+1)*portionSize );
+    T* sendBuf = &buffer[0];
+    T* recvBuf = &buffer[portionSize];
+
+    // Pack
+    util::InterleaveMatrix
+    ( A.LocalHeight(), localWidth,
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf,          1, A.LocalHeight() );
+
+    // Start the communication
+    mpi::IAllGather
+    ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm(),
+      request.Request() );
+
+    // Unpack upon completion
+    const Int colAlign = A.ColAlign();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    request.Start
+    ( [=]()
+      {
+          util::ColStridedUnpack
+          ( height, localWidth, colAlign, colStride,
+            recvBuf, portionSize, BBuf, BLDim );
+      } );
+}
+
+} // namespace copy
+
+// Begin the redistribution B := A and return a handle for completing it.
+// The gathers of a single distribution, e.g., [MC,MR] -> [MC,STAR] or
+// [VC,STAR] -> [STAR,STAR], are overlapped with subsequent computation when
+// MPI supports non-blocking collectives; all other redistributions (and
+// non-grid processes) are performed immediately and return an inactive
+// request. A may be modified as soon as ICopy returns.
+template<typename T>
+CopyRequest<T> ICopy( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    DEBUG_CSE
+    CopyRequest<T> request;
+    if( A.Grid() == B.Grid() &&
+        A.ColDist() == B.ColDist() && A.RowDist() != B.RowDist() &&
+        Collect(A.RowDist()) == B.RowDist() )
+        copy::IRowAllGather( A, B, request );
+    else if( A.Grid() == B.Grid() &&
+             A.RowDist() == B.RowDist() && A.ColDist() != B.ColDist() &&
+             Collect(A.ColDist()) == B.ColDist() )
+        copy::IColAllGather( A, B, request );
+    else
+        Copy( A, B );
+    return request;
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_ICOPY_HPP
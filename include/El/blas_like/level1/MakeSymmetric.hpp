@@ -52,6 +52,25 @@ void MakeSymmetric( UpperOrLower uplo, Matrix<T>& A, bool conjugate )
     }
 }
 
+template<typename T,Int N>
+void MakeSymmetric( UpperOrLower uplo, FixedMatrix<T,N,N>& A, bool conjugate )
+{
+    if( conjugate )
+        for( Int j=0; j<N; ++j )
+            A(j,j) = RealPart(A(j,j));
+
+    for( Int j=0; j<N; ++j )
+    {
+        for( Int i=j+1; i<N; ++i )
+        {
+            if( uplo == LOWER )
+                A(j,i) = ( conjugate ? Conj(A(i,j)) : A(i,j) );
+            else
+                A(i,j) = ( conjugate ? Conj(A(j,i)) : A(j,i) );
+        }
+    }
+}
+
 template<typename T>
 void MakeSymmetric
 ( UpperOrLower uplo, ElementalMatrix<T>& A, bool conjugate )
@@ -0,0 +1,219 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_REDISTPLAN_HPP
+#define EL_BLAS_REDISTPLAN_HPP
+
+namespace El {
+
+// A precomputed redistribution between two fixed (distribution, alignment,
+// root, size) configurations over the same grid, for iterations which
+// repeatedly perform the same redistribution of same-shaped matrices.
+//
+// The send/recv counts and displacements, as well as the local index of each
+// sent and received entry, are computed (with a single metadata exchange)
+// upon construction so that each Apply only packs, exchanges the values,
+// and unpacks. With MPI-4, the exchange is a persistent MPI_Alltoallv_init
+// request which is restarted upon each application.
+template<typename T>
+class RedistPlan
+{
+public:
+    // Plan B := A; B is resized to match A
+    RedistPlan( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+    ~RedistPlan();
+
+    RedistPlan( const RedistPlan<T>& ) = delete;
+    RedistPlan<T>& operator=( const RedistPlan<T>& ) = delete;
+
+    // Whether A and B have the configurations the plan was formed for
+    bool Matches
+    ( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B ) const;
+
+    // B := A
+    void Apply( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+private:
+    ElementalData AData_, BData_;
+    Int height_, width_;
+    mpi::Comm comm_;
+
+    vector<int> sendCounts_, sendOffs_, recvCounts_, recvOffs_;
+    vector<Int> sendRows_, sendCols_, recvRows_, recvCols_;
+    vector<T> sendBuf_, recvBuf_;
+
+    bool persistent_;
+    mpi::Request<T> request_;
+};
+
+template<typename T>
+RedistPlan<T>::RedistPlan
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+: height_(A.Height()), width_(A.Width()), persistent_(false)
+{
+    DEBUG_CSE
+    if( A.Grid() != B.Grid() )
+        LogicError("RedistPlan requires both matrices to share a grid");
+    B.Resize( height_, width_ );
+    AData_ = ElementalData( A );
+    BData_ = ElementalData( B );
+
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    comm_ = g.VCComm();
+    const int commSize = mpi::Size( comm_ );
+    const Dist colDist = B.ColDist(), rowDist = B.RowDist();
+    const int root = B.Root();
+    const int colStride = B.ColStride();
+    const int redundantSize = B.RedundantSize();
+
+    // Count the entries destined for each process, including every redundant
+    // copy within B (which avoids the broadcast of copy::GeneralPurpose)
+    const bool sending = A.Participating() && A.RedundantRank() == 0;
+    const Int localHeight = ( sending ? A.LocalHeight() : 0 );
+    const Int localWidth = ( sending ? A.LocalWidth() : 0 );
+    vector<int> ownerRows( localHeight ), ownerCols( localWidth );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        ownerRows[iLoc] = B.RowOwner( A.GlobalRow(iLoc) );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        ownerCols[jLoc] = B.ColOwner( A.GlobalCol(jLoc) );
+    const int distSize = B.DistSize();
+    vector<int> distMap( distSize*redundantSize );
+    for( int q=0; q<distSize; ++q )
+        for( int r=0; r<redundantSize; ++r )
+            distMap[q*redundantSize+r] =
+              g.CoordsToVC( colDist, rowDist, q, root, r );
+
+    sendCounts_.assign( commSize, 0 );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int distOwner = ownerRows[iLoc] + colStride*ownerCols[jLoc];
+            for( int r=0; r<redundantSize; ++r )
+                ++sendCounts_[distMap[distOwner*redundantSize+r]];
+        }
+    const int totalSend = Scan( sendCounts_, sendOffs_ );
+
+    // Pack the local indices for each destination
+    sendRows_.resize( totalSend );
+    sendCols_.resize( totalSend );
+    vector<Int> sendIndices( 2*totalSend );
+    auto offs = sendOffs_;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const int ownerCol = ownerCols[jLoc];
+        const Int jLocB = B.LocalCol( A.GlobalCol(jLoc), ownerCol );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int ownerRow = ownerRows[iLoc];
+            const Int iLocB = B.LocalRow( A.GlobalRow(iLoc), ownerRow );
+            const int distOwner = ownerRow + colStride*ownerCol;
+            for( int r=0; r<redundantSize; ++r )
+            {
+                const int k = offs[distMap[distOwner*redundantSize+r]]++;
+                sendRows_[k] = iLoc;
+                sendCols_[k] = jLoc;
+                sendIndices[2*k  ] = iLocB;
+                sendIndices[2*k+1] = jLocB;
+            }
+        }
+    }
+
+    // Exchange the metadata once
+    recvCounts_.resize( commSize );
+    mpi::AllToAll( sendCounts_.data(), 1, recvCounts_.data(), 1, comm_ );
+    const int totalRecv = Scan( recvCounts_, recvOffs_ );
+    vector<int> indexSendCounts( commSize ), indexSendOffs( commSize ),
+                indexRecvCounts( commSize ), indexRecvOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        indexSendCounts[q] = 2*sendCounts_[q];
+        indexSendOffs[q] = 2*sendOffs_[q];
+        indexRecvCounts[q] = 2*recvCounts_[q];
+        indexRecvOffs[q] = 2*recvOffs_[q];
+    }
+    vector<Int> recvIndices( 2*totalRecv );
+    mpi::AllToAll
+    ( sendIndices.data(),
+      indexSendCounts.data(), indexSendOffs.data(),
+      recvIndices.data(),
+      indexRecvCounts.data(), indexRecvOffs.data(), comm_ );
+    recvRows_.resize( totalRecv );
+    recvCols_.resize( totalRecv );
+    for( Int k=0; k<totalRecv; ++k )
+    {
+        recvRows_[k] = recvIndices[2*k];
+        recvCols_[k] = recvIndices[2*k+1];
+    }
+
+    sendBuf_.resize( totalSend );
+    recvBuf_.resize( totalRecv );
+#ifdef EL_HAVE_MPI_PERSISTENT_COLLECTIVES
+    if( IsPacked<T>::value )
+    {
+        mpi::AllToAllInit
+        ( sendBuf_.data(), sendCounts_.data(), sendOffs_.data(),
+          recvBuf_.data(), recvCounts_.data(), recvOffs_.data(),
+          comm_, request_ );
+        persistent_ = true;
+    }
+#endif
+}
+
+template<typename T>
+RedistPlan<T>::~RedistPlan()
+{
+    if( persistent_ && !mpi::Finalized() )
+        mpi::Free( request_ );
+}
+
+template<typename T>
+bool RedistPlan<T>::Matches
+( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B ) const
+{
+    return A.Height() == height_ && A.Width() == width_ &&
+           B.Height() == height_ && B.Width() == width_ &&
+           ElementalData(A) == AData_ && ElementalData(B) == BData_;
+}
+
+template<typename T>
+void RedistPlan<T>::Apply( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    DEBUG_CSE
+    if( !Matches( A, B ) )
+        LogicError("RedistPlan does not match the given matrices");
+    if( !A.Grid().InGrid() )
+        return;
+
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    const Int totalSend = sendBuf_.size();
+    for( Int k=0; k<totalSend; ++k )
+        sendBuf_[k] = ABuf[sendRows_[k]+sendCols_[k]*ALDim];
+
+    if( persistent_ )
+    {
+        mpi::Start( request_ );
+        mpi::Wait( request_ );
+    }
+    else
+        mpi::AllToAll
+        ( sendBuf_.data(), sendCounts_.data(), sendOffs_.data(),
+          recvBuf_.data(), recvCounts_.data(), recvOffs_.data(), comm_ );
+
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    const Int totalRecv = recvBuf_.size();
+    for( Int k=0; k<totalRecv; ++k )
+        BBuf[recvRows_[k]+recvCols_[k]*BLDim] = recvBuf_[k];
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_REDISTPLAN_HPP
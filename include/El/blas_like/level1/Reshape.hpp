@@ -27,18 +27,88 @@ void Reshape
          " did not preserve the total number of entries");
 
     B.Resize( mNew, nNew );
-    Zero( B );
-    for( Int j=0; j<n; ++j )
+    if( A.LDim() == m || n <= 1 )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            const Int iNew = (i+j*m) % mNew;
-            const Int jNew = (i+j*m) / mNew;
-            B.Set( iNew, jNew, A.Get(i,j) );
-        }
+        // The source is contiguous, so each column of B is a single span
+        const T* ABuf = A.LockedBuffer();
+        for( Int jNew=0; jNew<nNew; ++jNew )
+            MemCopy( B.Buffer(0,jNew), &ABuf[jNew*mNew], mNew );
+        return;
+    }
+
+    // Copy the maximal spans which lie within a single column of both A and B
+    const Int numEntries = m*n;
+    Int k = 0;
+    while( k < numEntries )
+    {
+        const Int i = k % m, j = k / m;
+        const Int iNew = k % mNew, jNew = k / mNew;
+        const Int spanSize = Min( m-i, mNew-iNew );
+        MemCopy( B.Buffer(iNew,jNew), A.LockedBuffer(i,j), spanSize );
+        k += spanSize;
     }
 }
 
+// Reinterpret the column-major data of A as an mNew x nNew matrix without
+// copying, which is only possible if the columns of A are contiguous
+template<typename T>
+void ReshapeView
+( Int mNew,
+  Int nNew,
+  Matrix<T>& A,
+  Matrix<T>& B )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m*n != mNew*nNew )
+        LogicError
+        ("Reshape from ",m," x ",n," to ",mNew," x ",nNew,
+         " did not preserve the total number of entries");
+    if( A.LDim() != m && n > 1 )
+        LogicError
+        ("Cannot view a ",m," x ",n," matrix with leading dimension ",
+         A.LDim()," as ",mNew," x ",nNew);
+    B.Attach( mNew, nNew, A.Buffer(), Max(mNew,1) );
+}
+
+template<typename T>
+void LockedReshapeView
+(       Int mNew,
+        Int nNew,
+  const Matrix<T>& A,
+        Matrix<T>& B )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m*n != mNew*nNew )
+        LogicError
+        ("Reshape from ",m," x ",n," to ",mNew," x ",nNew,
+         " did not preserve the total number of entries");
+    if( A.LDim() != m && n > 1 )
+        LogicError
+        ("Cannot view a ",m," x ",n," matrix with leading dimension ",
+         A.LDim()," as ",mNew," x ",nNew);
+    B.LockedAttach( mNew, nNew, A.LockedBuffer(), Max(mNew,1) );
+}
+
+template<typename T>
+Matrix<T> ReshapeView( Int mNew, Int nNew, Matrix<T>& A )
+{
+    Matrix<T> B;
+    ReshapeView( mNew, nNew, A, B );
+    return B;
+}
+
+template<typename T>
+Matrix<T> LockedReshapeView( Int mNew, Int nNew, const Matrix<T>& A )
+{
+    Matrix<T> B;
+    LockedReshapeView( mNew, nNew, A, B );
+    return B;
+}
+
 template<typename T>
 Matrix<T> Reshape( Int mNew, Int nNew, const Matrix<T>& A )
 {
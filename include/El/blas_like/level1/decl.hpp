@@ -239,6 +239,26 @@ template<typename F>
 void ColumnMaxNorms
 ( const DistSparseMatrix<F>& X, DistMultiVec<Base<F>>& norms );
 
+// Two norms and max norms
+// -----------------------
+// Both are computed with a single pass over the entries (and, in the
+// distributed case, without any communication beyond that of ColumnTwoNorms)
+template<typename F>
+void ColumnTwoAndMaxNorms
+( const Matrix<F>& X,
+        Matrix<Base<F>>& twoNorms,
+        Matrix<Base<F>>& maxNorms );
+template<typename F,Dist U,Dist V>
+void ColumnTwoAndMaxNorms
+( const DistMatrix<F,U,V>& X,
+        DistMatrix<Base<F>,V,STAR>& twoNorms,
+        DistMatrix<Base<F>,V,STAR>& maxNorms );
+template<typename F>
+void ColumnTwoAndMaxNorms
+( const DistMultiVec<F>& X,
+        Matrix<Base<F>>& twoNorms,
+        Matrix<Base<F>>& maxNorms );
+
 // Column minimum absolute values
 // ==============================
 // NOTE: While this is not a norm, it is often colloquially referred to as the
@@ -1236,6 +1256,9 @@ void MakeSymmetric( UpperOrLower uplo, Matrix<T>& A, bool conjugate=false );
 template<typename T>
 void MakeSymmetric
 ( UpperOrLower uplo, ElementalMatrix<T>& A, bool conjugate=false );
+template<typename T,Int N>
+void MakeSymmetric
+( UpperOrLower uplo, FixedMatrix<T,N,N>& A, bool conjugate=false );
 
 template<typename T>
 void MakeSymmetric
@@ -1512,6 +1535,16 @@ void Reshape( Int m, Int n, const Matrix<T>& A, Matrix<T>& B );
 template<typename T>
 Matrix<T> Reshape( Int m, Int n, const Matrix<T>& A );
 
+// Views of contiguous column-major data as an m x n matrix (without copying)
+template<typename T>
+void ReshapeView( Int m, Int n, Matrix<T>& A, Matrix<T>& B );
+template<typename T>
+void LockedReshapeView( Int m, Int n, const Matrix<T>& A, Matrix<T>& B );
+template<typename T>
+Matrix<T> ReshapeView( Int m, Int n, Matrix<T>& A );
+template<typename T>
+Matrix<T> LockedReshapeView( Int m, Int n, const Matrix<T>& A );
+
 template<typename T>
 void Reshape
 ( Int m, Int n, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
@@ -1577,6 +1610,14 @@ template<typename T>
 void Transform2x2Rows
 ( const AbstractDistMatrix<T>& G,
         AbstractDistMatrix<T>& A, Int i1, Int i2 );
+template<typename T>
+void Transform2x2Rows
+( const FixedMatrix<T,2,2>& G,
+        Matrix<T>& A, Int i1, Int i2 );
+template<typename T>
+void Transform2x2Rows
+( const FixedMatrix<T,2,2>& G,
+        AbstractDistMatrix<T>& A, Int i1, Int i2 );
 
 // A(:,[j1,j2]) := A(:,[j1,j2]) G, where G is 2x2
 // ----------------------------------------------
@@ -1592,6 +1633,14 @@ template<typename T>
 void Transform2x2Cols
 ( const AbstractDistMatrix<T>& G,
         AbstractDistMatrix<T>& A, Int j1, Int j2 );
+template<typename T>
+void Transform2x2Cols
+( const FixedMatrix<T,2,2>& G,
+        Matrix<T>& A, Int j1, Int j2 );
+template<typename T>
+void Transform2x2Cols
+( const FixedMatrix<T,2,2>& G,
+        AbstractDistMatrix<T>& A, Int j1, Int j2 );
 
 // TODO: SymmetricTransform2x2?
 
@@ -1797,6 +1846,9 @@ void HermitianSwap
 // ===============
 template<typename F>
 void Symmetric2x2Inv( UpperOrLower uplo, Matrix<F>& D, bool conjugate=false );
+template<typename F>
+void Symmetric2x2Inv
+( UpperOrLower uplo, FixedMatrix<F,2,2>& D, bool conjugate=false );
 
 // Shift
 // =====
@@ -20,12 +20,16 @@
 #include <El/blas_like/level1/ConjugateSubmatrix.hpp>
 #include <El/blas_like/level1/Contract.hpp>
 #include <El/blas_like/level1/Copy.hpp>
+#include <El/blas_like/level1/ICopy.hpp>
+#include <El/blas_like/level1/CopyPlan.hpp>
+#include <El/blas_like/level1/RedistPlan.hpp>
 #include <El/blas_like/level1/DiagonalScale.hpp>
 #include <El/blas_like/level1/DiagonalScaleTrapezoid.hpp>
 #include <El/blas_like/level1/DiagonalSolve.hpp>
 #include <El/blas_like/level1/Dot.hpp>
 #include <El/blas_like/level1/EntrywiseFill.hpp>
 #include <El/blas_like/level1/EntrywiseMap.hpp>
+#include <El/blas_like/level1/Expression.hpp>
 #include <El/blas_like/level1/Fill.hpp>
 #include <El/blas_like/level1/FillDiagonal.hpp>
 #include <El/blas_like/level1/Full.hpp>
@@ -59,6 +59,17 @@ void Gemv
   T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
            const DistMatrix<T,MC,MR,BLOCK>& x,
                  DistMatrix<T,MC,MR,BLOCK>& y );
+// Forward the orientation recorded by a TransposedView
+template<typename T>
+void Gemv
+( T alpha, const TransposedView<Matrix<T>>& A,
+           const Matrix<T>& x,
+  T beta,        Matrix<T>& y );
+template<typename T>
+void Gemv
+( T alpha, const TransposedView<AbstractDistMatrix<T>>& A,
+           const AbstractDistMatrix<T>& x,
+  T beta,        AbstractDistMatrix<T>& y );
 template<typename T>
 void LocalGemv
 ( Orientation orientation,
@@ -256,6 +267,16 @@ void Trsv
 ( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
   const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& x );
 
+// Solve against the orientation recorded by a TransposedView
+template<typename F>
+void Trsv
+( UpperOrLower uplo, UnitOrNonUnit diag,
+  const TransposedView<Matrix<F>>& A, Matrix<F>& x );
+template<typename F>
+void Trsv
+( UpperOrLower uplo, UnitOrNonUnit diag,
+  const TransposedView<AbstractDistMatrix<F>>& A, AbstractDistMatrix<F>& x );
+
 // Apply a sequence of Givens rotations in the style of LAPACK's {s,d,c,z}lasr
 // ===========================================================================
 enum GivensSequenceType
@@ -278,6 +299,64 @@ void ApplyGivensSequence
   const Matrix<Base<F>>& sList,
   Matrix<F>& A );
 
+// Apply the variable Givens sequences stored in the columns of cList and sList
+// (in order) by accumulating wavefront-ordered groups of 'blocksize' rotations
+// from each sequence into small unitary matrices which are applied with Gemm.
+// Since the rows (for side=RIGHT) or columns (for side=LEFT) of A are
+// independent, panels of A are processed in parallel over OpenMP threads.
+template<typename F,typename=DisableIf<IsReal<F>>>
+void ApplyGivensSequences
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<F>& sList,
+  Matrix<F>& A,
+  Int blocksize=Blocksize() );
+template<typename F>
+void ApplyGivensSequences
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<Base<F>>& sList,
+  Matrix<F>& A,
+  Int blocksize=Blocksize() );
+
+// Defer the application of (real) variable Givens sequences from the right to
+// the columns of a matrix so that up to 'maxSequences' of them can be applied
+// at once via ApplyGivensSequences. A sequence over a subset of the columns of
+// the pending sequences is padded with identity rotations; otherwise, or if
+// its direction differs, the pending sequences are first applied. Flush must
+// be called before the matrix is otherwise accessed.
+template<typename F>
+class GivensSequenceAccumulator
+{
+public:
+    GivensSequenceAccumulator
+    ( Matrix<F>& A, Int maxSequences=32, Int blocksize=Blocksize() );
+
+    // Push the sequence rotating columns offset+j and offset+j+1 by
+    // (cList(j),sList(j))
+    void Push
+    ( ForwardOrBackward direction,
+      Int offset,
+      const Matrix<Base<F>>& cList,
+      const Matrix<Base<F>>& sList );
+
+    // Push a single rotation of columns j and j+1
+    void PushRotation( Int j, const Base<F>& c, const Base<F>& s );
+
+    void Flush();
+
+    Int NumPending() const EL_NO_EXCEPT;
+
+private:
+    Matrix<F>& A_;
+    Int maxSequences_, blocksize_;
+    ForwardOrBackward direction_=FORWARD;
+    Int winBeg_=0, winEnd_=0, numPending_=0;
+    Matrix<Base<F>> cList_, sList_;
+
+    void Reserve( ForwardOrBackward direction, Int winBeg, Int winEnd );
+};
+
 } // namespace El
 
 #endif // ifndef EL_BLAS2_HPP
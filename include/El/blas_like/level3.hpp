@@ -17,6 +17,11 @@ template<typename T> Int LocalTrrkBlocksize();
 template<typename T> void SetLocalTrr2kBlocksize( Int blocksize );
 template<typename T> Int LocalTrr2kBlocksize();
 
+// The size of the diagonal blocks of C formed by the dot-product variants of
+// Syrk/Herk (which are used when A is much wider than C)
+template<typename T> void SetSyrkDotBlocksize( Int blocksize );
+template<typename T> Int SyrkDotBlocksize();
+
 // Gemm
 // ====
 namespace GemmAlgorithmNS {
@@ -26,11 +31,20 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The number of layers (the replication factor of C) used by GEMM_25D. If
+// zero (the default), the largest divisor of the number of processes which
+// is at most its cube root is used. GEMM_DEFAULT only selects the 2.5D
+// algorithm for large products whose extra memory comfortably fits within
+// the memory that is currently available.
+void SetGemm25DLayers( Int numLayers );
+Int Gemm25DLayers();
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -53,6 +67,47 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// Forward the orientations recorded by TransposedView
+template<typename T>
+void Gemm
+( T alpha, const TransposedView<Matrix<T>>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C );
+template<typename T>
+void Gemm
+( T alpha, const Matrix<T>& A,
+           const TransposedView<Matrix<T>>& B,
+  T beta,        Matrix<T>& C );
+template<typename T>
+void Gemm
+( T alpha, const TransposedView<Matrix<T>>& A,
+           const TransposedView<Matrix<T>>& B,
+  T beta,        Matrix<T>& C );
+
+template<typename T>
+void Gemm
+( T alpha, const TransposedView<AbstractDistMatrix<T>>& A,
+           const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+template<typename T>
+void Gemm
+( T alpha, const AbstractDistMatrix<T>& A,
+           const TransposedView<AbstractDistMatrix<T>>& B,
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+template<typename T>
+void Gemm
+( T alpha, const TransposedView<AbstractDistMatrix<T>>& A,
+           const TransposedView<AbstractDistMatrix<T>>& B,
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+
+// C(k) := alpha op(A(k)) op(B(k)) + beta C(k) for each member of the batches,
+// with each sub-grid proceeding independently
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrixBatch<T>& A, const DistMatrixBatch<T>& B,
+  T beta,        DistMatrixBatch<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -182,6 +237,25 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// C := alpha A B for sparse A, B, and C (SpGEMM), formed by a symbolic phase
+// which sizes each row of C followed by a numeric phase which accumulates it
+// with a hash table, both threaded over blocks of rows. If the sparsity of C
+// is frozen (see FreezeSparsity), then it must contain that of A B and only
+// the values of C are refreshed, e.g., when reforming A D A^T for new
+// diagonal scalings D within an Interior Point Method.
+//
+// The distributed product fetches the rows of B referenced by each process's
+// rows of A (a sparsity-aware 1D algorithm, as DistSparseMatrix is only
+// distributed by rows).
+template<typename T>
+void Multiply
+( T alpha, const SparseMatrix<T>& A, const SparseMatrix<T>& B,
+                 SparseMatrix<T>& C );
+template<typename T>
+void Multiply
+( T alpha, const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B,
+                 DistSparseMatrix<T>& C );
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
@@ -229,11 +303,14 @@ template<typename F>
 void MultiShiftTrsm
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
   F alpha, Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X );
+// If 'shiftGroupSize' is positive (and less than the size of the grid), the
+// shifts are split into batches which are each solved by a sub-grid of that
+// many processes holding its own copy of U
 template<typename F>
 void MultiShiftTrsm
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
   F alpha, const AbstractDistMatrix<F>& U, const AbstractDistMatrix<F>& shifts,
-  AbstractDistMatrix<F>& X );
+  AbstractDistMatrix<F>& X, int shiftGroupSize=0 );
 
 // SafeMultiShiftTrsm
 // ==================
@@ -246,7 +323,8 @@ template<typename F>
 void SafeMultiShiftTrsm
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
   F alpha, const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& shifts,
-  AbstractDistMatrix<F>& B, AbstractDistMatrix<F>& scales );
+  AbstractDistMatrix<F>& B, AbstractDistMatrix<F>& scales,
+  int shiftGroupSize=0 );
   
 // QuasiTrsm
 // =========
@@ -447,7 +525,8 @@ enum TrsmAlgorithm {
   TRSM_DEFAULT,
   TRSM_LARGE,
   TRSM_MEDIUM,
-  TRSM_SMALL
+  TRSM_SMALL,
+  TRSM_NARROW
 };
 }
 using namespace TrsmAlgorithmNS;
@@ -466,6 +545,30 @@ void Trsm
   const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
+// Solve in place with the block-cyclic distribution via PBLAS (without any
+// redistribution), falling back to the element-cyclic algorithms for
+// datatypes or builds without ScaLAPACK support
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B );
+
+// Solve against the orientation recorded by a TransposedView
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo, UnitOrNonUnit diag,
+  F alpha, const TransposedView<Matrix<F>>& A, Matrix<F>& B,
+  bool checkIfSingular=false );
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo, UnitOrNonUnit diag,
+  F alpha,
+  const TransposedView<AbstractDistMatrix<F>>& A,
+        AbstractDistMatrix<F>& B,
+  bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
 
 template<typename F>
 void LocalTrsm
@@ -476,6 +579,16 @@ void LocalTrsm
         AbstractDistMatrix<F>& X,
   bool checkIfSingular=false );
 
+// Solve against the 'uplo' triangle of a sparse matrix, where all of the
+// columns of B are updated during a single traversal of the nonzeros of A.
+// Only side=LEFT is currently supported.
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const SparseMatrix<F>& A, Matrix<F>& B,
+  bool checkIfSingular=false );
+
 // Trstrm
 // ======
 template<typename F>
@@ -649,6 +762,228 @@ void NormalFromEVD
   const AbstractDistMatrix<Complex<Real>>& w,
   const AbstractDistMatrix<Complex<Real>>& Z );
 
+// Kronecker-product and Kronecker-sum operators
+// =============================================
+// Implicit representations of the Kronecker product A \otimes B, and, for
+// square A and B, of the Kronecker sum
+//
+//   A \oplus B = A \otimes I + I \otimes B,
+//
+// which are applied to each column x = vec(X), with X being nB x nA, via
+//
+//   (A \otimes B) vec(X) = vec(B X A^T),
+//   (A \oplus  B) vec(X) = vec(B X + X A^T),
+//
+// rather than by forming the (mA mB) x (nA nB) matrix. The factors are
+// referenced rather than copied, and so they must outlive the operator.
+// Since the operators are applied as op( X, Y ), i.e., Y := op X, they can be
+// passed directly to Lanczos, BlockLanczos, KrylovSchur, and KrylovSolve.
+
+template<typename F>
+class KroneckerOperator
+{
+public:
+    KroneckerOperator( const Matrix<F>& A, const Matrix<F>& B );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+
+    // Y := op(A \otimes B) X = op(A) \otimes op(B) X
+    void Apply
+    ( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const;
+    void operator()( const Matrix<F>& X, Matrix<F>& Y ) const;
+
+private:
+    const Matrix<F>& A_;
+    const Matrix<F>& B_;
+};
+
+template<typename F>
+class KroneckerSumOperator
+{
+public:
+    KroneckerSumOperator( const Matrix<F>& A, const Matrix<F>& B );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+
+    // Y := op(A \oplus B) X = op(A) \oplus op(B) X
+    void Apply
+    ( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const;
+    void operator()( const Matrix<F>& X, Matrix<F>& Y ) const;
+
+private:
+    const Matrix<F>& A_;
+    const Matrix<F>& B_;
+};
+
+// The distributed operators apply the vec-trick with two distributed Gemm's
+// (the first of which is shared by all of the columns of X) after
+// redistributing the columns of X from a DistMultiVec, whose communicator must
+// contain the same processes as the grid of the factors, into the matricized
+// forms. The matricized applications are also exposed directly.
+
+template<typename F>
+class DistKroneckerOperator
+{
+public:
+    DistKroneckerOperator( const DistMatrix<F>& A, const DistMatrix<F>& B );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+
+    void Apply
+    ( Orientation orientation,
+      const DistMultiVec<F>& X,
+            DistMultiVec<F>& Y ) const;
+    void operator()( const DistMultiVec<F>& X, DistMultiVec<F>& Y ) const;
+
+    // Y := op(B) X op(A)^T
+    void ApplyMatricized
+    ( Orientation orientation,
+      const DistMatrix<F>& X,
+            DistMatrix<F>& Y ) const;
+
+private:
+    const DistMatrix<F>& A_;
+    const DistMatrix<F>& B_;
+};
+
+template<typename F>
+class DistKroneckerSumOperator
+{
+public:
+    DistKroneckerSumOperator( const DistMatrix<F>& A, const DistMatrix<F>& B );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+
+    void Apply
+    ( Orientation orientation,
+      const DistMultiVec<F>& X,
+            DistMultiVec<F>& Y ) const;
+    void operator()( const DistMultiVec<F>& X, DistMultiVec<F>& Y ) const;
+
+    // Y := op(B) X + X op(A)^T
+    void ApplyMatricized
+    ( Orientation orientation,
+      const DistMatrix<F>& X,
+            DistMatrix<F>& Y ) const;
+
+private:
+    const DistMatrix<F>& A_;
+    const DistMatrix<F>& B_;
+};
+
+// Block-composite matrices
+// ========================
+// A (possibly hierarchical) matrix of blocks which reference dense, sparse,
+// diagonal, or composite matrices (each scaled and optionally transposed)
+// without copying them, e.g., the KKT matrix
+//
+//   | -D   A^T |
+//   |  A    0  |
+//
+// of an Interior Point Method. Products are formed block-wise with the native
+// kernels of each block, and an explicit dense or sparse copy is only formed
+// on demand via Materialize. Since the referenced matrices are not copied,
+// they must outlive the composite matrix, and updates to their values are
+// automatically reflected.
+//
+// The height of each block row (and width of each block column) is
+// determined by the blocks placed within it; SetZeroBlock can be used to
+// specify the dimensions of a block row or column which is otherwise empty.
+
+template<typename T>
+class CompositeMatrix
+{
+public:
+    CompositeMatrix( Int numBlockRows=0, Int numBlockCols=0 );
+
+    // Remove all of the blocks and change the number of block rows/columns
+    void Resize( Int numBlockRows, Int numBlockCols );
+
+    // Block (i,j) := alpha op(A)
+    void SetBlock
+    ( Int i, Int j, const Matrix<T>& A,
+      T alpha=T(1), Orientation orientation=NORMAL );
+    void SetBlock
+    ( Int i, Int j, const SparseMatrix<T>& A,
+      T alpha=T(1), Orientation orientation=NORMAL );
+    void SetBlock
+    ( Int i, Int j, const CompositeMatrix<T>& A,
+      T alpha=T(1), Orientation orientation=NORMAL );
+
+    // Block (i,j) := alpha diag(d)
+    void SetDiagonalBlock( Int i, Int j, const Matrix<T>& d, T alpha=T(1) );
+    // Block (i,j) := alpha I, where I is n x n
+    void SetIdentityBlock( Int i, Int j, Int n, T alpha=T(1) );
+    // Block (i,j) := 0, where 0 is height x width
+    void SetZeroBlock( Int i, Int j, Int height, Int width );
+
+    Int NumBlockRows() const EL_NO_EXCEPT;
+    Int NumBlockCols() const EL_NO_EXCEPT;
+    Int BlockHeight( Int i ) const EL_NO_RELEASE_EXCEPT;
+    Int BlockWidth( Int j ) const EL_NO_RELEASE_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+
+    // Y := alpha op(A) X + beta Y
+    void Apply
+    ( Orientation orientation,
+      T alpha, const Matrix<T>& X,
+      T beta,        Matrix<T>& Y ) const;
+    // Y := A X (for use with Lanczos, KrylovSolve, etc.)
+    void operator()( const Matrix<T>& X, Matrix<T>& Y ) const;
+
+    void Materialize( Matrix<T>& A ) const;
+    void Materialize( SparseMatrix<T>& A ) const;
+
+private:
+    enum BlockType
+    {
+      ZERO_BLOCK,
+      DENSE_BLOCK,
+      SPARSE_BLOCK,
+      COMPOSITE_BLOCK,
+      DIAGONAL_BLOCK,
+      IDENTITY_BLOCK
+    };
+
+    struct Block
+    {
+        BlockType type=ZERO_BLOCK;
+        Orientation orientation=NORMAL;
+        T alpha=T(1);
+        const Matrix<T>* dense=nullptr;
+        const SparseMatrix<T>* sparse=nullptr;
+        const CompositeMatrix<T>* composite=nullptr;
+    };
+
+    Int numBlockRows_=0, numBlockCols_=0;
+    // Block (i,j) is stored in blocks_[i+j*numBlockRows_]
+    vector<Block> blocks_;
+    // The block heights and widths, which are -1 until specified
+    vector<Int> blockHeights_, blockWidths_;
+
+    void SetDimensions( Int i, Int j, Int height, Int width );
+    void ApplyBlock
+    ( const Block& block, Orientation orientation, bool conjugate,
+      T alpha, const Matrix<T>& X, Matrix<T>& Y ) const;
+};
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const CompositeMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                     Matrix<T>& Y );
+
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const CompositeMatrix<T>& A, const Matrix<T>& x,
+  T beta,                                     Matrix<T>& y );
+
 } // namespace El
 
 #endif // ifndef EL_BLAS3_HPP
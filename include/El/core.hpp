@@ -14,19 +14,23 @@
 #include <mpi.h>
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <random>
 #include <type_traits> // std::enable_if
 #include <vector>
@@ -78,6 +82,11 @@ typedef int Int;
 typedef unsigned Unsigned;
 #endif
 
+// Indices into process-local data, such as the compressed column space of a
+// distributed sparse matrix, remain 32-bit even when Int is 64-bit so that the
+// index arrays streamed by the sparse kernels stay compact
+typedef int LocalInt;
+
 #ifdef EL_HAVE_QUAD
 typedef __float128 Quad;
 #endif
@@ -205,12 +214,14 @@ template<typename T> struct IsStdScalar<Complex<T>>
 #include <El/core/environment/decl.hpp>
 
 #include <El/core/Timer.hpp>
+#include <El/core/Profile.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #include <El/core/imports/lapack.hpp>
 #include <El/core/imports/flame.hpp>
 #include <El/core/imports/mkl.hpp>
 #include <El/core/imports/openblas.hpp>
+#include <El/core/imports/cublas.hpp>
 #include <El/core/imports/pmrrr.hpp>
 #include <El/core/imports/scalapack.hpp>
 
@@ -221,6 +232,7 @@ template<typename T> struct IsStdScalar<Complex<T>>
 namespace El {
 
 template<typename T=double> class Matrix;
+template<typename T,Int M,Int N> class FixedMatrix;
 
 template<typename T=double> class AbstractDistMatrix;
 
@@ -230,6 +242,8 @@ template<typename T=double> class BlockMatrix;
 template<typename T=double,Dist U=MC,Dist V=MR,DistWrap wrap=ELEMENT>
 class DistMatrix;
 
+class Checkpoint;
+
 } // namespace El
 
 #include <El/core/Matrix/decl.hpp>
@@ -243,6 +257,7 @@ class DistMatrix;
 #include <El/blas_like/level1/decl.hpp>
 
 #include <El/core/Matrix/impl.hpp>
+#include <El/core/FixedMatrix.hpp>
 #include <El/core/Grid.hpp>
 #include <El/core/DistMatrix.hpp>
 #include <El/core/Proxy.hpp>
@@ -255,7 +270,9 @@ class DistMatrix;
 // Declare and implement the decoupled parts of the core of the library
 // (perhaps these should be moved into their own directory?)
 #include <El/core/View/impl.hpp>
+#include <El/core/TransposedView.hpp>
 #include <El/core/FlamePart.hpp>
+#include <El/core/TaskGraph.hpp>
 #include <El/core/random/decl.hpp>
 #include <El/core/random/impl.hpp>
 
@@ -266,5 +283,7 @@ class DistMatrix;
 #include <El/core/DistMap.hpp>
 #include <El/core/DistMultiVec/impl.hpp>
 #include <El/core/DistSparseMatrix/impl.hpp>
+#include <El/core/SparseBuilder.hpp>
+#include <El/core/DistMatrixBatch.hpp>
 
 #endif // ifndef EL_CORE_HPP
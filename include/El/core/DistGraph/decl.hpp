@@ -15,6 +15,17 @@
 
 namespace El {
 
+// Whether the metadata of distributed sparse products forms a pair of MPI
+// distributed-graph communicators (when neighborhood collectives are
+// available) so that each exchange only involves the processes which share
+// indices. Each communicator consumes an MPI context id until the metadata is
+// cleared or rebuilt, so long runs which form the metadata of many matrices
+// may prefer to disable them and fall back to AllToAll over the entire
+// communicator. Enabled by default.
+void EnableNeighborCollectives();
+void DisableNeighborCollectives();
+bool NeighborCollectives();
+
 struct DistGraphMultMeta
 {
     bool ready;
@@ -22,7 +33,31 @@ struct DistGraphMultMeta
     Int numRecvInds;
     vector<int> sendSizes, sendOffs,
                 recvSizes, recvOffs;
-    vector<Int> sendInds, colOffs;
+    vector<Int> sendInds;
+    // The offset of the target of each local edge into the compressed set of
+    // (unique) targets that we receive; since this set is local, the offsets
+    // are stored with 32-bit indices (as is 'localColOffs')
+    vector<LocalInt> colOffs;
+
+    // The local sources whose targets all lie within our own block of the
+    // vector ('interiorSources'), whose products can be formed while the
+    // exchange is in flight, and the remaining 'boundarySources', along with
+    // the prefix sums of their numbers of edges (for load balancing). The
+    // edges of the interior sources are offset into our block of the vector
+    // by 'localColOffs' (its other entries are unused).
+    vector<Int> interiorSources, boundarySources,
+                interiorEdgeOffs, boundaryEdgeOffs;
+    vector<LocalInt> localColOffs;
+
+    // When neighborhood collectives are available, the exchanges are
+    // restricted to the processes which actually share indices:
+    // 'neighborComm' has an edge from each owner of needed indices to the
+    // process which needs them (the direction of a normal multiply), and
+    // 'adjointNeighborComm' has the reversed edges. The in (out) neighbors of
+    // the former, which are the out (in) neighbors of the latter, are given
+    // by 'neighborSources' ('neighborDests').
+    shared_ptr<mpi::Comm> neighborComm, adjointNeighborComm;
+    vector<int> neighborSources, neighborDests;
 
     DistGraphMultMeta() : ready(false), numRecvInds(0) { }
 
@@ -36,6 +71,15 @@ struct DistGraphMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( interiorSources );
+        SwapClear( boundarySources );
+        SwapClear( interiorEdgeOffs );
+        SwapClear( boundaryEdgeOffs );
+        SwapClear( localColOffs );
+        neighborComm.reset();
+        adjointNeighborComm.reset();
+        SwapClear( neighborSources );
+        SwapClear( neighborDests );
     }
 
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
@@ -48,8 +92,48 @@ struct DistGraphMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        interiorSources = meta.interiorSources;
+        boundarySources = meta.boundarySources;
+        interiorEdgeOffs = meta.interiorEdgeOffs;
+        boundaryEdgeOffs = meta.boundaryEdgeOffs;
+        localColOffs = meta.localColOffs;
+        neighborComm = meta.neighborComm;
+        adjointNeighborComm = meta.adjointNeighborComm;
+        neighborSources = meta.neighborSources;
+        neighborDests = meta.neighborDests;
         return *this;
     }
+
+    // The per-neighbor counts and displacements of an exchange of 'width'
+    // values per index over neighborComm (or adjointNeighborComm if 'adjoint')
+    void NeighborCounts
+    ( bool adjoint, Int width,
+      vector<int>& sendCounts, vector<int>& sendDispls,
+      vector<int>& recvCounts, vector<int>& recvDispls ) const
+    {
+        const auto& sendRanks = ( adjoint ? neighborSources : neighborDests );
+        const auto& recvRanks = ( adjoint ? neighborDests : neighborSources );
+        const auto& sendSizesDir = ( adjoint ? recvSizes : sendSizes );
+        const auto& sendOffsDir = ( adjoint ? recvOffs : sendOffs );
+        const auto& recvSizesDir = ( adjoint ? sendSizes : recvSizes );
+        const auto& recvOffsDir = ( adjoint ? sendOffs : recvOffs );
+        const Int numSendRanks = sendRanks.size();
+        const Int numRecvRanks = recvRanks.size();
+        sendCounts.resize( numSendRanks );
+        sendDispls.resize( numSendRanks );
+        recvCounts.resize( numRecvRanks );
+        recvDispls.resize( numRecvRanks );
+        for( Int k=0; k<numSendRanks; ++k )
+        {
+            sendCounts[k] = sendSizesDir[sendRanks[k]]*width;
+            sendDispls[k] = sendOffsDir[sendRanks[k]]*width;
+        }
+        for( Int k=0; k<numRecvRanks; ++k )
+        {
+            recvCounts[k] = recvSizesDir[recvRanks[k]]*width;
+            recvDispls[k] = recvOffsDir[recvRanks[k]]*width;
+        }
+    }
 };
 
 
@@ -190,6 +274,10 @@ private:
     Int numLocalSources_;
 
     bool frozenSparsity_ = false;
+    // NOTE: The targets are global indices and are exposed as Int buffers
+    //       (e.g., through LockedTargetBuffer), so they remain of type Int;
+    //       the 32-bit compressed column offsets used by the multiplies are
+    //       kept in 'multMeta'
     vector<Int> sources_, targets_;
     set<pair<Int,Int>> markedForRemoval_;
 
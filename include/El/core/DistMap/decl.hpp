@@ -13,6 +13,24 @@
 
 namespace El {
 
+// A reusable plan for translating a fixed set of local indices through any
+// DistMap over the same communicator and number of sources, so that each
+// translation requires a single exchange rather than three
+struct DistMapTranslationPlan
+{
+    Int numSources=0;
+
+    vector<int> requestSizes, requestOffs,
+                fulfillSizes, fulfillOffs;
+
+    // The local sources whose images were requested by the other processes
+    vector<Int> fulfillLocalSources;
+
+    // The position of the image of each local index within the packed
+    // requests (or -1 if the index is outside of the map's domain)
+    vector<Int> requestSlots;
+};
+
 // Use a simple 1d distribution where each process owns a fixed number of 
 // indices,
 //     if last process,  height - (commSize-1)*floor(height/commSize)
@@ -32,6 +50,17 @@ public:
     void Translate
     ( vector<Int>& localInds, const vector<int>& origOwners ) const;
 
+    // Amortize the metadata exchanges of Translate over repeated translations
+    // of the same set of indices
+    void FormTranslationPlan
+    ( const vector<Int>& localInds, DistMapTranslationPlan& plan ) const;
+    void FormTranslationPlan
+    ( const vector<Int>& localInds,
+      const vector<int>& origOwners,
+            DistMapTranslationPlan& plan ) const;
+    void Translate
+    ( vector<Int>& localInds, const DistMapTranslationPlan& plan ) const;
+
     // composite(i) := second(first(i))
     void Extend( DistMap& firstMap ) const;
     void Extend( const DistMap& firstMap, DistMap& compositeMap ) const;
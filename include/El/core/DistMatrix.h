@@ -1241,6 +1241,24 @@ EL_EXPORT ElError ElDistMatrixQueueUpdate_c
 EL_EXPORT ElError ElDistMatrixQueueUpdate_z
 ( ElDistMatrix_z A, ElInt i, ElInt j, complex_double value );
 
+/* Queue numUpdates updates of the form A(rows[k],cols[k]) += values[k]
+   -------------------------------------------------------------------- */
+EL_EXPORT ElError ElDistMatrixQueueUpdates_i
+( ElDistMatrix_i A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_s
+( ElDistMatrix_s A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_d
+( ElDistMatrix_d A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_c
+( ElDistMatrix_c A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_z
+( ElDistMatrix_z A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_double* values );
+
 /* void AbstractDistMatrix<T>::ProcessQueues()
    ------------------------------------------- */
 EL_EXPORT ElError ElDistMatrixProcessQueues_i( ElDistMatrix_i A );
@@ -1301,6 +1319,72 @@ EL_EXPORT ElError ElDistMatrixGetLocal_c
 EL_EXPORT ElError ElDistMatrixGetLocal_z
 ( ElConstDistMatrix_z A, ElInt iLoc, ElInt jLoc, complex_double* val );
 
+/* Batched versions of QueuePull and of the local entry accessors
+   --------------------------------------------------------------- */
+EL_EXPORT ElError ElDistMatrixQueuePulls_i
+( ElConstDistMatrix_i A, ElInt numPulls,
+  const ElInt* rows, const ElInt* cols );
+EL_EXPORT ElError ElDistMatrixQueuePulls_s
+( ElConstDistMatrix_s A, ElInt numPulls,
+  const ElInt* rows, const ElInt* cols );
+EL_EXPORT ElError ElDistMatrixQueuePulls_d
+( ElConstDistMatrix_d A, ElInt numPulls,
+  const ElInt* rows, const ElInt* cols );
+EL_EXPORT ElError ElDistMatrixQueuePulls_c
+( ElConstDistMatrix_c A, ElInt numPulls,
+  const ElInt* rows, const ElInt* cols );
+EL_EXPORT ElError ElDistMatrixQueuePulls_z
+( ElConstDistMatrix_z A, ElInt numPulls,
+  const ElInt* rows, const ElInt* cols );
+
+EL_EXPORT ElError ElDistMatrixGetLocalBlock_i
+( ElConstDistMatrix_i A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, ElInt* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixGetLocalBlock_s
+( ElConstDistMatrix_s A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, float* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixGetLocalBlock_d
+( ElConstDistMatrix_d A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, double* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixGetLocalBlock_c
+( ElConstDistMatrix_c A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, complex_float* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixGetLocalBlock_z
+( ElConstDistMatrix_z A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, complex_double* buf, ElInt ldim );
+
+EL_EXPORT ElError ElDistMatrixSetLocalBlock_i
+( ElDistMatrix_i A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const ElInt* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixSetLocalBlock_s
+( ElDistMatrix_s A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const float* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixSetLocalBlock_d
+( ElDistMatrix_d A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const double* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixSetLocalBlock_c
+( ElDistMatrix_c A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const complex_float* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixSetLocalBlock_z
+( ElDistMatrix_z A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const complex_double* buf, ElInt ldim );
+
+EL_EXPORT ElError ElDistMatrixUpdateLocalBlock_i
+( ElDistMatrix_i A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const ElInt* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixUpdateLocalBlock_s
+( ElDistMatrix_s A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const float* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixUpdateLocalBlock_d
+( ElDistMatrix_d A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const double* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixUpdateLocalBlock_c
+( ElDistMatrix_c A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const complex_float* buf, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixUpdateLocalBlock_z
+( ElDistMatrix_z A, ElInt iLoc, ElInt jLoc,
+  ElInt height, ElInt width, const complex_double* buf, ElInt ldim );
+
 /* Base<T> AbstractDistMatrix<T>::GetLocalRealPart( Int iLoc, Int jLoc ) const
    ---------------------------------------------------------------------------*/
 EL_EXPORT ElError ElDistMatrixGetLocalRealPart_c
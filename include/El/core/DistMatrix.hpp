@@ -106,6 +106,86 @@ FillDesc( const AbstractDistMatrix<scalarType>& A, int context )
           A.ColAlign(), A.RowAlign(), int(A.LDim()) };
     return desc;
 }
+
+namespace blacs {
+
+// A BLACS context over the process grid of an Elemental Grid which is freed
+// upon destruction, so that a DistMatrix<T,MC,MR,BLOCK> over the grid may be
+// handed to ScaLAPACK, without copying, as the pair
+// (A.Buffer(), context.Descriptor(A))
+class GridContext
+{
+public:
+    explicit GridContext( const El::Grid& grid )
+    {
+        handle_ = Handle( grid.VCComm().comm );
+        context_ =
+          GridInit
+          ( handle_, grid.Order()==COLUMN_MAJOR, grid.Height(), grid.Width() );
+    }
+    ~GridContext()
+    {
+        FreeGrid( context_ );
+        FreeHandle( handle_ );
+    }
+    GridContext( const GridContext& ) = delete;
+    const GridContext& operator=( const GridContext& ) = delete;
+
+    int Context() const { return context_; }
+
+    template<typename scalarType>
+    Desc Descriptor( const AbstractDistMatrix<scalarType>& A ) const
+    { return FillDesc( A, context_ ); }
+
+private:
+    int handle_, context_;
+};
+
+} // namespace blacs
+
+// Ensure that 'grid' places each process at the same position as the BLACS
+// context of a ScaLAPACK descriptor (e.g., because it is a Grid over the
+// communicator that the context was formed from, with the same ordering)
+inline void AssertDescMatchesGrid( const blacs::Desc& desc, const Grid& grid )
+{
+    if( desc[0] != 1 )
+        LogicError("Only dense block-cyclic descriptors are supported");
+    const int context = desc[1];
+    if( grid.Height() != blacs::GridHeight(context) ||
+        grid.Width() != blacs::GridWidth(context) )
+        LogicError
+        ("The ",grid.Height()," x ",grid.Width()," grid did not match the ",
+         blacs::GridHeight(context)," x ",blacs::GridWidth(context),
+         " BLACS grid");
+    if( grid.Row() != blacs::GridRow(context) ||
+        grid.Col() != blacs::GridCol(context) )
+        LogicError("The process positions of the grid and BLACS differed");
+}
+
+// Attach a block-cyclic DistMatrix to the local portion of an existing
+// ScaLAPACK array (with the given descriptor) without copying; the array must
+// outlive its use through A
+template<typename T>
+inline void AttachToDesc
+( DistMatrix<T,MC,MR,BLOCK>& A,
+  const Grid& grid, T* buffer, const blacs::Desc& desc )
+{
+    AssertDescMatchesGrid( desc, grid );
+    A.Attach
+    ( desc[2], desc[3], grid, desc[4], desc[5], desc[6], desc[7], 0, 0,
+      buffer, desc[8] );
+}
+
+template<typename T>
+inline void LockedAttachToDesc
+( DistMatrix<T,MC,MR,BLOCK>& A,
+  const Grid& grid, const T* buffer, const blacs::Desc& desc )
+{
+    AssertDescMatchesGrid( desc, grid );
+    A.LockedAttach
+    ( desc[2], desc[3], grid, desc[4], desc[5], desc[6], desc[7], 0, 0,
+      buffer, desc[8] );
+}
 #endif
 
 template<typename scalarType>
@@ -57,6 +57,11 @@ public:
     // Move constructor
     DistMatrix( type&& A ) EL_NO_EXCEPT;
 
+    // Steal the buffer of an rvalue with the same distribution (otherwise, the
+    // rvalue is redistributed as if it were an lvalue)
+    DistMatrix( absType&& A );
+    DistMatrix( blockType&& A );
+
     // Destructor
     ~DistMatrix();
 
@@ -90,6 +95,8 @@ public:
     // Move assignment
     // ---------------
     type& operator=( type&& A );
+    type& operator=( absType&& A );
+    type& operator=( blockType&& A );
 
     // Rescaling
     // ---------
@@ -59,6 +59,11 @@ public:
     // Move constructor
     DistMatrix( type&& A ) EL_NO_EXCEPT;
 
+    // Steal the buffer of an rvalue with the same distribution (otherwise, the
+    // rvalue is redistributed as if it were an lvalue)
+    DistMatrix( absType&& A );
+    DistMatrix( blockType&& A );
+
     // Destructor
     ~DistMatrix();
 
@@ -105,6 +110,8 @@ public:
     // Move assignment
     // ---------------
     type& operator=( type&& A );
+    type& operator=( absType&& A );
+    type& operator=( blockType&& A );
 
     // Rescaling
     // ---------
@@ -0,0 +1,232 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTMATRIXBATCH_HPP
+#define EL_CORE_DISTMATRIXBATCH_HPP
+
+namespace El {
+
+// A collection of (typically small) matrices which are each distributed over
+// one of several disjoint sub-grids of a parent grid.
+//
+// The processes of the parent grid are split into groups of 'groupSize'
+// consecutive processes (any remainder is left idle), and matrix k is owned
+// by group k % NumGroups(). A groupSize of one assigns each matrix to a
+// single process. Every process of the parent grid holds a (possibly
+// non-participating) DistMatrix for each member of the batch, so that Scatter
+// and Gather may move matrices to and from any grid with the same viewers,
+// but the batched drivers only touch the matrices owned by the local group,
+// which allows each group to proceed independently.
+template<typename T>
+class DistMatrixBatch
+{
+public:
+    DistMatrixBatch
+    ( const El::Grid& grid, Int numMatrices, int groupSize=1 );
+    // Use the same sub-grids and assignment as another batch (with empty
+    // members)
+    template<typename S>
+    explicit DistMatrixBatch( const DistMatrixBatch<S>& layout );
+    // Copy the layout and each member of another batch
+    DistMatrixBatch( const DistMatrixBatch<T>& batch );
+
+    // Resize a single member, or every member, of the batch
+    void Resize( Int k, Int height, Int width );
+    void Resize( Int height, Int width );
+
+    // Queries
+    // =======
+    const El::Grid& Grid() const EL_NO_EXCEPT { return *grid_; }
+    Int NumMatrices() const EL_NO_EXCEPT { return numMatrices_; }
+    int GroupSize() const EL_NO_EXCEPT { return groupSize_; }
+    int NumGroups() const EL_NO_EXCEPT { return numGroups_; }
+    // The group which owns matrix k
+    int Group( Int k ) const EL_NO_EXCEPT { return int(k % numGroups_); }
+    // The group owned by this process (-1 if it is idle)
+    int LocalGroup() const EL_NO_EXCEPT { return localGroup_; }
+    const El::Grid& SubGrid( int group ) const;
+    bool IsLocal( Int k ) const EL_NO_EXCEPT
+    { return localGroup_ >= 0 && Group(k) == localGroup_; }
+    // The indices of the matrices owned by this process's group
+    vector<Int> LocalIndices() const;
+    // Whether the two batches have the same members on the same sub-grids
+    // (which the batched drivers require of their arguments)
+    template<typename S>
+    bool SharesLayout( const DistMatrixBatch<S>& other ) const EL_NO_EXCEPT
+    { return subGrids_ == other.subGrids_ &&
+             numMatrices_ == other.numMatrices_; }
+
+    // Matrix k, distributed over SubGrid(Group(k))
+          DistMatrix<T>& operator()( Int k );
+    const DistMatrix<T>& operator()( Int k ) const;
+
+    // Redistribution
+    // ==============
+    // Both routines must be called by every process viewing the parent grid.
+    // Matrix k := A
+    void Scatter( Int k, const ElementalMatrix<T>& A );
+    // B := matrix k
+    void Gather( Int k, ElementalMatrix<T>& B ) const;
+
+private:
+    template<typename S> friend class DistMatrixBatch;
+
+    const El::Grid* grid_;
+    Int numMatrices_;
+    int groupSize_, numGroups_, localGroup_;
+    // Shared between batches with the same layout
+    shared_ptr<vector<unique_ptr<El::Grid>>> subGrids_;
+    vector<unique_ptr<DistMatrix<T>>> matrices_;
+
+    void SetUpMatrices();
+};
+
+template<typename T>
+DistMatrixBatch<T>::DistMatrixBatch
+( const El::Grid& grid, Int numMatrices, int groupSize )
+: grid_(&grid), numMatrices_(numMatrices), groupSize_(groupSize)
+{
+    DEBUG_CSE
+    if( numMatrices < 0 )
+        LogicError("The number of matrices must be non-negative");
+    if( groupSize < 1 || groupSize > grid.Size() )
+        LogicError
+        ("Invalid group size of ",groupSize," for a grid of ",grid.Size(),
+         " processes");
+    numGroups_ = grid.Size() / groupSize;
+    localGroup_ =
+      ( grid.InGrid() && grid.VCRank() < numGroups_*groupSize ?
+        grid.VCRank() / groupSize : -1 );
+
+    // Form the (disjoint) owning groups from consecutive ranks in the VC
+    // ordering of the parent grid, using the parent's viewers for each
+    vector<int> viewingRanks( grid.Size() );
+    for( int q=0; q<grid.Size(); ++q )
+        viewingRanks[q] = grid.VCToViewing( q );
+    mpi::Group viewingGroup;
+    mpi::CommGroup( grid.ViewingComm(), viewingGroup );
+    subGrids_ = std::make_shared<vector<unique_ptr<El::Grid>>>();
+    subGrids_->resize( numGroups_ );
+    const int height = El::Grid::FindFactor( groupSize );
+    for( int group=0; group<numGroups_; ++group )
+    {
+        mpi::Group owners;
+        mpi::Incl
+        ( viewingGroup, groupSize, &viewingRanks[group*groupSize], owners );
+        (*subGrids_)[group].reset
+        ( new El::Grid( grid.ViewingComm(), owners, height, grid.Order() ) );
+        mpi::Free( owners );
+    }
+    mpi::Free( viewingGroup );
+    SetUpMatrices();
+}
+
+template<typename T>
+template<typename S>
+DistMatrixBatch<T>::DistMatrixBatch( const DistMatrixBatch<S>& layout )
+: grid_(layout.grid_), numMatrices_(layout.numMatrices_),
+  groupSize_(layout.groupSize_), numGroups_(layout.numGroups_),
+  localGroup_(layout.localGroup_), subGrids_(layout.subGrids_)
+{
+    DEBUG_CSE
+    SetUpMatrices();
+}
+
+template<typename T>
+DistMatrixBatch<T>::DistMatrixBatch( const DistMatrixBatch<T>& batch )
+: grid_(batch.grid_), numMatrices_(batch.numMatrices_),
+  groupSize_(batch.groupSize_), numGroups_(batch.numGroups_),
+  localGroup_(batch.localGroup_), subGrids_(batch.subGrids_)
+{
+    DEBUG_CSE
+    matrices_.resize( numMatrices_ );
+    for( Int k=0; k<numMatrices_; ++k )
+        matrices_[k].reset( new DistMatrix<T>( *batch.matrices_[k] ) );
+}
+
+template<typename T>
+void DistMatrixBatch<T>::SetUpMatrices()
+{
+    DEBUG_CSE
+    matrices_.resize( numMatrices_ );
+    for( Int k=0; k<numMatrices_; ++k )
+        matrices_[k].reset( new DistMatrix<T>( SubGrid(Group(k)) ) );
+}
+
+template<typename T>
+void DistMatrixBatch<T>::Resize( Int k, Int height, Int width )
+{
+    DEBUG_CSE
+    (*this)(k).Resize( height, width );
+}
+
+template<typename T>
+void DistMatrixBatch<T>::Resize( Int height, Int width )
+{
+    DEBUG_CSE
+    for( Int k=0; k<numMatrices_; ++k )
+        matrices_[k]->Resize( height, width );
+}
+
+template<typename T>
+const El::Grid& DistMatrixBatch<T>::SubGrid( int group ) const
+{
+    DEBUG_ONLY(
+      if( group < 0 || group >= numGroups_ )
+          LogicError("Invalid group index ",group);
+    )
+    return *(*subGrids_)[group];
+}
+
+template<typename T>
+vector<Int> DistMatrixBatch<T>::LocalIndices() const
+{
+    vector<Int> indices;
+    if( localGroup_ >= 0 )
+        for( Int k=localGroup_; k<numMatrices_; k+=numGroups_ )
+            indices.push_back( k );
+    return indices;
+}
+
+template<typename T>
+DistMatrix<T>& DistMatrixBatch<T>::operator()( Int k )
+{
+    DEBUG_ONLY(
+      if( k < 0 || k >= numMatrices_ )
+          LogicError("Invalid batch index ",k);
+    )
+    return *matrices_[k];
+}
+
+template<typename T>
+const DistMatrix<T>& DistMatrixBatch<T>::operator()( Int k ) const
+{
+    DEBUG_ONLY(
+      if( k < 0 || k >= numMatrices_ )
+          LogicError("Invalid batch index ",k);
+    )
+    return *matrices_[k];
+}
+
+template<typename T>
+void DistMatrixBatch<T>::Scatter( Int k, const ElementalMatrix<T>& A )
+{
+    DEBUG_CSE
+    Copy( A, (*this)(k) );
+}
+
+template<typename T>
+void DistMatrixBatch<T>::Gather( Int k, ElementalMatrix<T>& B ) const
+{
+    DEBUG_CSE
+    Copy( (*this)(k), B );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTMATRIXBATCH_HPP
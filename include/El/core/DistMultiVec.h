@@ -265,6 +265,24 @@ EL_EXPORT ElError ElDistMultiVecQueueUpdate_c
 EL_EXPORT ElError ElDistMultiVecQueueUpdate_z
 ( ElDistMultiVec_z A, ElInt i, ElInt j, complex_double value );
 
+/* Queue numUpdates updates of the form A(rows[k],cols[k]) += values[k]
+   -------------------------------------------------------------------- */
+EL_EXPORT ElError ElDistMultiVecQueueUpdates_i
+( ElDistMultiVec_i A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElDistMultiVecQueueUpdates_s
+( ElDistMultiVec_s A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElDistMultiVecQueueUpdates_d
+( ElDistMultiVec_d A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElDistMultiVecQueueUpdates_c
+( ElDistMultiVec_c A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElDistMultiVecQueueUpdates_z
+( ElDistMultiVec_z A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_double* values );
+
 /* void DistMultiVec<T>::ProcessQueues()
    ------------------------------------- */
 EL_EXPORT ElError ElDistMultiVecProcessQueues_i( ElDistMultiVec_i A );
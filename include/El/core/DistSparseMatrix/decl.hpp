@@ -78,6 +78,14 @@ public:
     void ProcessQueues();
     void ProcessLocalQueues();
 
+    // Bulk assembly (see SparseBuilder)
+    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+    // Take ownership of coordinate arrays for the local rows (without copying
+    // them) which should be sorted by row and then column without duplicates;
+    // unsorted arrays are sorted and combined as if they had been queued
+    void AdoptLocalEntries
+    ( vector<Int>&& sources, vector<Int>&& targets, vector<T>&& values );
+
     // Operator overloading
     // ====================
 
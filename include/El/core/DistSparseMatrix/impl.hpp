@@ -333,8 +333,34 @@ void DistSparseMatrix<T>::ProcessLocalQueues()
     if( distGraph_.locallyConsistent_ )
         return;
 
-    Int numRemoved = 0;
+    // Entries which were directly written in sorted order without duplicates
+    // (e.g., after ForceNumLocalEntries) only require their offsets to be
+    // formed
     const Int numLocalEntries = vals_.size();
+    if( distGraph_.markedForRemoval_.size() == 0 )
+    {
+        const Int* sourceBuf = distGraph_.sources_.data();
+        const Int* targetBuf = distGraph_.targets_.data();
+        bool sorted = true;
+        for( Int s=1; s<numLocalEntries; ++s )
+        {
+            if( sourceBuf[s] < sourceBuf[s-1] ||
+                (sourceBuf[s] == sourceBuf[s-1] &&
+                 targetBuf[s] <= targetBuf[s-1]) )
+            {
+                sorted = false;
+                break;
+            }
+        }
+        if( sorted )
+        {
+            distGraph_.ComputeSourceOffsets();
+            distGraph_.locallyConsistent_ = true;
+            return;
+        }
+    }
+
+    Int numRemoved = 0;
     vector<Entry<T>> entries( numLocalEntries );
     if( distGraph_.markedForRemoval_.size() != 0 )
     {
@@ -393,6 +419,34 @@ void DistSparseMatrix<T>::ProcessLocalQueues()
     distGraph_.locallyConsistent_ = true;
 }
 
+template<typename T>
+void DistSparseMatrix<T>::AdoptLocalEntries
+( vector<Int>&& sources, vector<Int>&& targets, vector<T>&& values )
+{
+    DEBUG_CSE
+    if( sources.size() != targets.size() || targets.size() != values.size() )
+        LogicError("Inconsistent adopted buffer sizes");
+    if( FrozenSparsity() )
+        LogicError("Cannot adopt entries into a frozen sparsity pattern");
+    DEBUG_ONLY(
+      const Int firstLocalRow = FirstLocalRow();
+      const Int numEntries = sources.size();
+      for( Int e=0; e<numEntries; ++e )
+          if( sources[e] < firstLocalRow ||
+              sources[e] >= firstLocalRow+LocalHeight() ||
+              targets[e] < 0 || targets[e] >= Width() )
+              LogicError
+              ("Entry (",sources[e],",",targets[e],") is not in the local "
+               "rows of the ",Height()," x ",Width()," matrix");
+    )
+    distGraph_.sources_ = std::move(sources);
+    distGraph_.targets_ = std::move(targets);
+    vals_ = std::move(values);
+    SwapClear( distGraph_.markedForRemoval_ );
+    distGraph_.locallyConsistent_ = false;
+    ProcessLocalQueues();
+}
+
 // Operator overloading
 // ====================
 
@@ -159,6 +159,23 @@ template<typename Real> struct PromoteHelper<Complex<Real>>
 
 template<typename F> using Promote = typename PromoteHelper<F>::type;
 
+// Decrease the precision (if there is a significantly faster alternative)
+// -----------------------------------------------------------------------
+template<typename F> struct DemoteHelper { typedef F type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+#ifdef EL_HAVE_QD
+template<> struct DemoteHelper<DoubleDouble> { typedef double type; };
+template<> struct DemoteHelper<QuadDouble> { typedef double type; };
+#endif
+#ifdef EL_HAVE_QUAD
+template<> struct DemoteHelper<Quad> { typedef double type; };
+#endif
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+
+template<typename F> using Demote = typename DemoteHelper<F>::type;
+
 template<typename S,typename T>
 struct CanCast
 {   
@@ -1039,6 +1056,15 @@ void UpdateScaledSquare
 template<typename F,typename=EnableIf<IsScalar<F>>>
 void DowndateScaledSquare
 ( const F& alpha, Base<F>& scale, Base<F>& scaledSquare ) EL_NO_RELEASE_EXCEPT;
+// Update the scaled sum of squares with the n entries x[0], x[incx], ... and
+// return their maximum magnitude. Unlike repeated calls to UpdateScaledSquare,
+// the squares are first accumulated without scaling in a single branch-free
+// pass, and a second pass relative to the maximum magnitude is only performed
+// if said sum overflowed or its smallest terms might have underflowed.
+template<typename F,typename=EnableIf<IsScalar<F>>>
+Base<F> UpdateScaledSquares
+( Int n, const F* x, Int incx,
+  Base<F>& scale, Base<F>& scaledSquare ) EL_NO_EXCEPT;
 
 // Solve a quadratic equation
 // ==========================
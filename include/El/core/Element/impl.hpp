@@ -678,6 +678,54 @@ void UpdateScaledSquare
     }
 }
 
+template<typename F,typename>
+Base<F> UpdateScaledSquares
+( Int n, const F* x, Int incx,
+  Base<F>& scale, Base<F>& scaledSquare ) EL_NO_EXCEPT
+{
+    typedef Base<F> Real;
+    Real maxAbs=0, sumSquares=0;
+    for( Int i=0; i<n; ++i )
+    {
+        const Real alphaAbs = Abs(x[i*incx]);
+        maxAbs = Max(maxAbs,alphaAbs);
+        sumSquares += alphaAbs*alphaAbs;
+    }
+    if( maxAbs == Real(0) )
+        return maxAbs;
+
+    // Squares below the square of limits::SafeMinToSquare are negligible
+    // relative to maxAbs^2 unless maxAbs is itself that small
+    Real blockScaledSquare;
+    if( limits::IsFinite(sumSquares) &&
+        maxAbs >= limits::SafeMinToSquare(maxAbs) )
+    {
+        blockScaledSquare = (sumSquares/maxAbs)/maxAbs;
+    }
+    else
+    {
+        blockScaledSquare = 0;
+        for( Int i=0; i<n; ++i )
+        {
+            const Real relAbs = Abs(x[i*incx])/maxAbs;
+            blockScaledSquare += relAbs*relAbs;
+        }
+    }
+
+    if( maxAbs <= scale )
+    {
+        const Real relScale = maxAbs/scale;
+        scaledSquare += blockScaledSquare*relScale*relScale;
+    }
+    else
+    {
+        const Real relScale = scale/maxAbs;
+        scaledSquare = scaledSquare*relScale*relScale + blockScaledSquare;
+        scale = maxAbs;
+    }
+    return maxAbs;
+}
+
 template<typename F,typename>
 void DowndateScaledSquare
 ( const F& alpha, Base<F>& scale, Base<F>& scaledSquare ) EL_NO_RELEASE_EXCEPT
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FIXEDMATRIX_HPP
+#define EL_FIXEDMATRIX_HPP
+
+namespace El {
+
+// A column-major M x N matrix with compile-time dimensions and stack storage.
+// It is meant for the tiny (e.g., 2x2 and 3x3) blocks manipulated within inner
+// kernels, where a dynamically-sized Matrix would cost a heap allocation.
+// Since the trip counts of the loops below are known at compile-time, the
+// compiler is free to fully unroll them.
+//
+// View() and LockedView() wrap the storage in a Matrix (without allocating) so
+// that the general-purpose routines may still be applied.
+template<typename T,Int M,Int N>
+class FixedMatrix
+{
+public:
+    static_assert( M >= 0 && N >= 0, "FixedMatrix dimensions must be >= 0" );
+
+    FixedMatrix() { }
+
+    explicit FixedMatrix( const Matrix<T>& A )
+    {
+        DEBUG_ONLY(
+          if( A.Height() != M || A.Width() != N )
+              LogicError
+              ("Cannot form a ",M," x ",N," FixedMatrix from a ",
+               A.Height()," x ",A.Width()," Matrix");
+        )
+        const T* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+        for( Int j=0; j<N; ++j )
+            for( Int i=0; i<M; ++i )
+                data_[i+j*M] = ABuf[i+j*ALDim];
+    }
+
+    static constexpr Int Height() { return M; }
+    static constexpr Int Width() { return N; }
+    static constexpr Int LDim() { return M; }
+
+    T* Buffer() EL_NO_EXCEPT { return data_; }
+    const T* LockedBuffer() const EL_NO_EXCEPT { return data_; }
+
+    T& operator()( Int i, Int j ) EL_NO_EXCEPT
+    { return data_[i+j*M]; }
+    const T& operator()( Int i, Int j ) const EL_NO_EXCEPT
+    { return data_[i+j*M]; }
+
+    T Get( Int i, Int j ) const EL_NO_EXCEPT { return data_[i+j*M]; }
+    void Set( Int i, Int j, T alpha ) EL_NO_EXCEPT { data_[i+j*M] = alpha; }
+
+    Matrix<T> View() { return Matrix<T>( M, N, data_, M ); }
+    const Matrix<T> LockedView() const
+    { return Matrix<T>( M, N, static_cast<const T*>(data_), M ); }
+
+    // Overwrite the (equally-sized) matrix A with this matrix
+    void CopyTo( Matrix<T>& A ) const
+    {
+        DEBUG_ONLY(
+          if( A.Height() != M || A.Width() != N )
+              LogicError("Nonconformal FixedMatrix::CopyTo");
+        )
+        T* ABuf = A.Buffer();
+        const Int ALDim = A.LDim();
+        for( Int j=0; j<N; ++j )
+            for( Int i=0; i<M; ++i )
+                ABuf[i+j*ALDim] = data_[i+j*M];
+    }
+
+private:
+    // Avoid zero-length arrays for empty matrices
+    T data_[M*N > 0 ? M*N : 1];
+};
+
+template<typename T,Int M,Int N>
+inline void Zero( FixedMatrix<T,M,N>& A )
+{
+    for( Int j=0; j<N; ++j )
+        for( Int i=0; i<M; ++i )
+            A(i,j) = T(0);
+}
+
+template<typename T,Int M,Int N>
+inline void Transpose
+( const FixedMatrix<T,M,N>& A, FixedMatrix<T,N,M>& B, bool conjugate=false )
+{
+    for( Int j=0; j<N; ++j )
+        for( Int i=0; i<M; ++i )
+            B(j,i) = ( conjugate ? Conj(A(i,j)) : A(i,j) );
+}
+
+template<typename T,Int M,Int N>
+inline void Adjoint( const FixedMatrix<T,M,N>& A, FixedMatrix<T,N,M>& B )
+{ Transpose( A, B, true ); }
+
+// C := alpha A B + beta C
+template<typename T,Int M,Int K,Int N>
+inline void Gemm
+( T alpha, const FixedMatrix<T,M,K>& A,
+           const FixedMatrix<T,K,N>& B,
+  T beta,        FixedMatrix<T,M,N>& C )
+{
+    for( Int j=0; j<N; ++j )
+    {
+        for( Int i=0; i<M; ++i )
+        {
+            T gamma = 0;
+            for( Int k=0; k<K; ++k )
+                gamma += A(i,k)*B(k,j);
+            if( beta == T(0) )
+                C(i,j) = alpha*gamma;
+            else
+                C(i,j) = alpha*gamma + beta*C(i,j);
+        }
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_FIXEDMATRIX_HPP
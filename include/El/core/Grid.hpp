@@ -18,6 +18,10 @@ public:
     explicit Grid
     ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
     explicit Grid( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+    // Reorder the processes so that those sharing a node are contiguous
+    // within either the process columns or rows
+    explicit Grid
+    ( mpi::Comm comm, GridLayout layout, GridOrder order=COLUMN_MAJOR );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -86,6 +90,43 @@ public:
 
     static int FindFactor( int p ) EL_NO_EXCEPT;
 
+    // Node topology
+    // ^^^^^^^^^^^^^
+    // The processes sharing memory with this one (mpi::COMM_NULL if not in the
+    // grid)
+    mpi::Comm NodeComm() const EL_NO_EXCEPT;
+    int NodeSize() const EL_NO_EXCEPT;
+    int NumNodes() const EL_NO_EXCEPT;
+    // The maximum number of processes within a single node, and the maximum
+    // number of distinct nodes, over the communicators for the given
+    // distribution
+    int IntraNodeSize( Dist dist ) const EL_NO_EXCEPT;
+    int InterNodeSize( Dist dist ) const EL_NO_EXCEPT;
+    // Whether every communicator for the given distribution is within a node
+    bool NodeLocal( Dist dist ) const EL_NO_EXCEPT;
+    void PrintTopology( ostream& os=cout ) const;
+    // A shared-memory window over the given communicator of this grid if it
+    // is node-local (and nullptr otherwise), for use by the redistributions
+    mpi::SharedWindow* NodeWindow( mpi::Comm comm ) const EL_NO_EXCEPT;
+
+    // The stream number of the next counter-based random matrix over this
+    // grid; since random fills are collective over the viewing processes,
+    // every process agrees on the sequence
+    std::uint64_t NextRandomStream() const EL_NO_EXCEPT;
+
+    // 2.5D algorithms
+    // ^^^^^^^^^^^^^^^
+    // A column-major grid of the same shape over the owning processes alone
+    // whose VC ordering matches this one's, so that the local data of a
+    // distributed matrix may be attached to it without communication
+    const Grid& OwnerGrid() const;
+    // The owner grid's splitting into 'numLayers' identically-shaped layers
+    // of consecutive VC ranks, and the communicator over the corresponding
+    // processes of the layers (ranked by layer). Both are formed collectively
+    // over the owning processes on first use and are cached with this grid.
+    const vector<unique_ptr<Grid>>& LayerGrids( int numLayers ) const;
+    mpi::Comm LayerDepthComm( int numLayers ) const;
+
     // To be used internally by Elemental
     static void InitializeDefault();
     static void FinalizeDefault(); 
@@ -118,7 +159,24 @@ private:
         mdRank_, mdPerpRank_,
         vcRank_, vrRank_;
 
+    mpi::Comm nodeComm_;
+    int nodeSize_, numNodes_, maxNodeSize_;
+    int mcIntraNodeSize_, mcInterNodeSize_,
+        mrIntraNodeSize_, mrInterNodeSize_;
+    mutable mpi::SharedWindow mcWindow_, mrWindow_, vcWindow_, vrWindow_;
+    mutable std::uint64_t randomStream_=0;
+
+    struct Layers
+    {
+        vector<unique_ptr<Grid>> grids;
+        mpi::Comm depthComm;
+    };
+    mutable unique_ptr<Grid> ownerGrid_;
+    mutable std::map<int,Layers> layers_;
+
     void SetUpGrid();
+    void SetUpTopology();
+    const Layers& FormLayers( int numLayers ) const;
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -27,7 +27,7 @@ Matrix<T>::Matrix( bool fixed )
 template<typename T>
 Matrix<T>::Matrix( Int height, Int width, bool fixed )
 : viewType_( fixed ? OWNER_FIXED : OWNER ),
-  height_(height), width_(width), ldim_(Max(height,1))
+  height_(height), width_(width), ldim_(DefaultLDim<T>(height))
 {
     DEBUG_CSE
     DEBUG_ONLY(AssertValidDimensions( height, width ))
@@ -696,7 +696,7 @@ void Matrix<T>::Resize_( Int height, Int width )
     // possible.
     if( reallocate )
     {
-        ldim_ = Max( height, 1 );
+        ldim_ = DefaultLDim<T>( height );
         memory_.Require( ldim_ * width );
         data_ = memory_.Buffer();
     }
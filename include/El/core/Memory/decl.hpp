@@ -11,12 +11,76 @@
 
 namespace El {
 
+// The assumed cache line size (in bytes) used for aligning buffers and for
+// padding leading dimensions
+static const size_t CACHE_LINE_SIZE = 64;
+
+// Low-level allocation of uninitialized buffers which respects the current
+// MemoryPolicy
+void* RawAllocate( size_t bytes );
+void RawFree( void* ptr );
+
+// Low-level routines for drawing raw buffers from (and returning them to)
+// the size-class pool. Buffers returned by PoolAllocate are at least 'bytes'
+// bytes long and must be returned via PoolFree with the same 'bytes'.
+void* PoolAllocate( size_t bytes );
+void PoolFree( void* ptr, size_t bytes );
+
+// Low-level routines for borrowing cache-line-aligned buffers from (and
+// returning them to) the grow-only scratch arena (which is thread-local when
+// EL_HYBRID is defined). Buffers should be returned in roughly the reverse
+// order that they were borrowed in.
+void* BorrowScratch( size_t bytes );
+void ReturnScratch( void* ptr );
+
+// Record the allocation (or deallocation) of the 'bytes' bytes requested for
+// a Memory<G> buffer within the footprint counters (and, when call-site
+// tracking is enabled, attribute it to the innermost call-stack entry)
+void TrackAllocation( const void* ptr, size_t bytes );
+void TrackDeallocation( const void* ptr, size_t bytes );
+
+// A temporary, uninitialized buffer for packing and unpacking data during
+// redistributions. Packed datatypes are borrowed from the scratch arena, while
+// all others fall back to a standard vector.
+template<typename T>
+class ScratchBuffer
+{
+public:
+    ScratchBuffer();
+    ScratchBuffer( size_t size );
+    ~ScratchBuffer();
+
+    ScratchBuffer( const ScratchBuffer<T>& ) = delete;
+    const ScratchBuffer<T>& operator=( const ScratchBuffer<T>& ) = delete;
+
+    void Resize( size_t size );
+    void Empty();
+
+          T* data() EL_NO_EXCEPT { return data_; }
+    const T* data() const EL_NO_EXCEPT { return data_; }
+    size_t size() const EL_NO_EXCEPT { return size_; }
+
+          T& operator[]( size_t i ) EL_NO_EXCEPT { return data_[i]; }
+    const T& operator[]( size_t i ) const EL_NO_EXCEPT { return data_[i]; }
+
+private:
+    T* data_;
+    size_t size_;
+    vector<T> fallback_;
+};
+
+template<typename T>
+inline void FastResize( ScratchBuffer<T>& buffer, Int numEntries )
+{ buffer.Resize( numEntries ); }
+
 template<typename G>
 class Memory
 {
     size_t size_;
     G* rawBuffer_;
     G* buffer_;
+    // Whether or not rawBuffer_ was drawn from the memory pool
+    bool pooled_;
 public:
     Memory();
     Memory( size_t size );
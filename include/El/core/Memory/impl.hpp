@@ -11,15 +11,50 @@ namespace El {
 
 namespace {
 
-template<typename G>
-static G* New( size_t size )
+// Packed datatypes do not require construction and can therefore be drawn
+// from the memory pool (if it is enabled) or directly from RawAllocate. Such
+// buffers are overallocated by a cache line so that the usable portion can
+// be aligned to a cache-line boundary.
+template<typename G,typename=EnableIf<IsPacked<G>>>
+static G* New( size_t size, bool& pooled, G*& alignedBuffer )
 {
-    return new G[size];
+    const size_t bytes = size*sizeof(G) + CACHE_LINE_SIZE;
+    pooled = MemoryPoolEnabled();
+    void* ptr = ( pooled ? PoolAllocate(bytes) : RawAllocate(bytes) );
+    const size_t address = reinterpret_cast<size_t>(ptr);
+    const size_t offset = 
+      (CACHE_LINE_SIZE - address % CACHE_LINE_SIZE) % CACHE_LINE_SIZE;
+    alignedBuffer = reinterpret_cast<G*>( static_cast<byte*>(ptr) + offset );
+    TrackAllocation( ptr, size*sizeof(G) );
+    return static_cast<G*>( ptr );
 }
 
-template<typename G>
-static void Delete( G*& ptr )
+template<typename G,typename=EnableIf<IsPacked<G>>>
+static void Delete( G*& ptr, size_t size, bool pooled )
+{
+    if( ptr != nullptr )
+        TrackDeallocation( ptr, size*sizeof(G) );
+    if( pooled )
+        PoolFree( ptr, size*sizeof(G) + CACHE_LINE_SIZE );
+    else
+        RawFree( ptr );
+    ptr = nullptr;
+}
+
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+static G* New( size_t size, bool& pooled, G*& alignedBuffer )
 {
+    pooled = false;
+    alignedBuffer = new G[size];
+    TrackAllocation( alignedBuffer, size*sizeof(G) );
+    return alignedBuffer;
+}
+
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+static void Delete( G*& ptr, size_t size, bool pooled )
+{
+    if( ptr != nullptr )
+        TrackDeallocation( ptr, size*sizeof(G) );
     delete[] ptr;
     ptr = nullptr;
 }
@@ -28,17 +63,17 @@ static void Delete( G*& ptr )
 
 template<typename G>
 Memory<G>::Memory()
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), pooled_(false)
 { }
 
 template<typename G>
 Memory<G>::Memory( size_t size )
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), pooled_(false)
 { Require( size ); }
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), pooled_(false)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -51,12 +86,13 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
     std::swap(size_,mem.size_);
     std::swap(rawBuffer_,mem.rawBuffer_);
     std::swap(buffer_,mem.buffer_);
+    std::swap(pooled_,mem.pooled_);
 }
 
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, pooled_ );
 }
 
 template<typename G>
@@ -70,15 +106,14 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_, pooled_ );
+        size_ = 0;
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
-            rawBuffer_ = New<G>( size );
-            buffer_ = rawBuffer_;
+            rawBuffer_ = New<G>( size, pooled_, buffer_ );
 
             size_ = size;
 #ifndef EL_RELEASE
@@ -110,11 +145,61 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, pooled_ );
     buffer_ = nullptr;
     size_ = 0;
 }
 
+template<typename T>
+ScratchBuffer<T>::ScratchBuffer()
+: data_(nullptr), size_(0)
+{ }
+
+template<typename T>
+ScratchBuffer<T>::ScratchBuffer( size_t size )
+: data_(nullptr), size_(0)
+{ Resize( size ); }
+
+template<typename T>
+ScratchBuffer<T>::~ScratchBuffer()
+{ Empty(); }
+
+template<typename T>
+void ScratchBuffer<T>::Resize( size_t size )
+{
+    Empty();
+    if( IsPacked<T>::value )
+    {
+        data_ = static_cast<T*>( BorrowScratch( size*sizeof(T) ) );
+    }
+    else
+    {
+        fallback_.resize( size );
+        data_ = fallback_.data();
+    }
+    size_ = size;
+#ifdef EL_ZERO_INIT
+    MemZero( data_, size_ );
+#elif defined(EL_HAVE_VALGRIND)
+    if( EL_RUNNING_ON_VALGRIND )
+        MemZero( data_, size_ );
+#endif
+}
+
+template<typename T>
+void ScratchBuffer<T>::Empty()
+{
+    if( IsPacked<T>::value )
+    {
+        if( data_ != nullptr )
+            ReturnScratch( data_ );
+    }
+    else
+        SwapClear( fallback_ );
+    data_ = nullptr;
+    size_ = 0;
+}
+
 #ifdef EL_INSTANTIATE_CORE
 # define EL_EXTERN
 #else
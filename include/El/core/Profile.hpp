@@ -0,0 +1,124 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+
+// A lightweight hierarchical profiler which, unlike the call stack, is
+// available in release builds. Each region is named by a string literal
+// (whose address identifies it), and, while profiling is enabled, every
+// thread accumulates the inclusive and exclusive times and call counts of
+// its regions and records the individual calls into a fixed-size ring
+// buffer (so that only the most recent calls are kept for the trace).
+//
+// When profiling is disabled, entering a region costs a single (relaxed)
+// load of a global flag.
+
+// The modeled work of a kernel: its floating-point operations (where a
+// complex operation counts as four real ones) and the bytes of memory which
+// it reads and writes
+struct KernelWork
+{
+    double flops=0, bytes=0;
+};
+
+namespace profile {
+
+extern std::atomic<bool> enabled;
+
+void Push( const char* name );
+void Pop();
+// Attribute work to the innermost open region of this thread (the work
+// also counts towards each of the enclosing regions)
+void AddWork( const KernelWork& work );
+
+} // namespace profile
+
+void EnableProfiling();
+void DisableProfiling();
+bool Profiling();
+
+// Discard all of the statistics and events (on this process)
+void ClearProfile();
+
+// The number of calls which each thread keeps for the trace
+void SetProfileBufferSize( Int numEvents );
+Int ProfileBufferSize();
+
+struct ProfileStats
+{
+    string name;
+    Int count;
+    // In seconds
+    double inclusive, exclusive;
+    // The (inclusive) modeled work
+    double flops, bytes;
+    // The (inclusive) hardware counts, which are only accumulated while
+    // the hardware counters are enabled
+    HardwareCounts counts;
+};
+
+// The statistics of each region on this process (merged over the threads)
+vector<ProfileStats> ProfileSummary();
+
+// Print the call counts, the minimum, average, and maximum (over the
+// processes) of the inclusive and exclusive times, and the achieved rates
+// (the total modeled work divided by the maximum inclusive time) of each
+// region from the root of the communicator, sorted by the maximum inclusive
+// time. If hardware counts were collected, the minimum, average, and
+// maximum of each counter are also printed.
+void ReportProfile( ostream& os=cout, mpi::Comm comm=mpi::COMM_WORLD );
+
+// Write the buffered calls of every process into a single file in the
+// Chrome trace (JSON) format, which can be loaded by Perfetto or
+// chrome://tracing, with one 'pid' per process and one 'tid' per thread
+void WriteProfileTrace
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+class ProfileRegion
+{
+public:
+    explicit ProfileRegion( const char* name )
+    : active_(profile::enabled.load(std::memory_order_relaxed))
+    {
+        if( active_ )
+            profile::Push( name );
+    }
+    // A kernel whose modeled work is attributed to the region
+    ProfileRegion( const char* name, const KernelWork& work )
+    : active_(profile::enabled.load(std::memory_order_relaxed))
+    {
+        if( active_ )
+        {
+            profile::Push( name );
+            profile::AddWork( work );
+        }
+    }
+    ~ProfileRegion()
+    {
+        if( active_ )
+            profile::Pop();
+    }
+
+    ProfileRegion( const ProfileRegion& ) = delete;
+    const ProfileRegion& operator=( const ProfileRegion& ) = delete;
+private:
+    bool active_;
+};
+
+#define EL_PROFILE_CONCAT_INNER(a,b) a ## b
+#define EL_PROFILE_CONCAT(a,b) EL_PROFILE_CONCAT_INNER(a,b)
+#define EL_PROFILE_REGION(name) \
+  El::ProfileRegion EL_PROFILE_CONCAT(elProfileRegion,__LINE__)(name)
+#define EL_PROFILE_FUNCTION EL_PROFILE_REGION(EL_FUNCTION)
+
+} // namespace El
+
+#endif // ifndef EL_PROFILE_HPP
@@ -37,6 +37,7 @@ class MatrixReadProxy<T,T,void>
 {
 private:
     bool locked_;
+    Matrix<T> stolen_;
     Matrix<T>& orig_;
 
 public:
@@ -50,6 +51,14 @@ public:
       orig_(A)
     { }
 
+    // An rvalue will not outlive the proxy, so take over its buffer (or, if
+    // it is a view, its view) rather than referencing it
+    MatrixReadProxy( Matrix<T>&& A )
+    : locked_(false),
+      stolen_(std::move(A)),
+      orig_(stolen_)
+    { }
+
     ~MatrixReadProxy() { }
 
     const Matrix<T>& GetLocked() const { return orig_; }
@@ -301,6 +310,37 @@ public:
         Copy( A, *prox_ );
     }
 
+    // An rvalue will not outlive the proxy, so a conforming rvalue is moved
+    // into the proxy (without copying its data) rather than referenced
+    DistMatrixReadProxy
+    ( AbstractDistMatrix<T>&& A,
+      const ElementalProxyCtrl& ctrl=ElementalProxyCtrl() )
+    : locked_(false), madeCopy_(true)
+    { 
+        if( A.ColDist() == U && A.RowDist() == V && A.Wrap() == ELEMENT )
+        {
+            const bool colMisalign = 
+              ( ctrl.colConstrain && A.ColAlign() != ctrl.colAlign );
+            const bool rowMisalign = 
+              ( ctrl.rowConstrain && A.RowAlign() != ctrl.rowAlign );
+            const bool rootMisalign = 
+              ( ctrl.rootConstrain && A.Root() != ctrl.root );
+            if( !colMisalign && !rowMisalign && !rootMisalign )
+            {
+                prox_ = new proxType( std::move(static_cast<proxType&>(A)) );
+                return;
+            }
+        }
+        prox_ = new proxType(A.Grid());
+        if( ctrl.rootConstrain )
+            prox_->SetRoot( ctrl.root );
+        if( ctrl.colConstrain )
+            prox_->AlignCols( ctrl.colAlign );    
+        if( ctrl.rowConstrain )
+            prox_->AlignRows( ctrl.rowAlign );
+        Copy( A, *prox_ );
+    }
+
     ~DistMatrixReadProxy() 
     { 
         if( madeCopy_ )
@@ -458,6 +498,43 @@ public:
         Copy( A, *prox_ );
     }
 
+    // An rvalue will not outlive the proxy, so a conforming rvalue is moved
+    // into the proxy (without copying its data) rather than referenced
+    DistMatrixReadProxy
+    ( AbstractDistMatrix<T>&& A,
+      const ProxyCtrl& ctrl=ProxyCtrl() )
+    : locked_(false), madeCopy_(true)
+    { 
+        if( A.ColDist() == U && A.RowDist() == V && A.Wrap() == BLOCK )
+        {
+            const bool colMisalign = 
+              ( ctrl.colConstrain && 
+                (A.ColAlign() != ctrl.colAlign ||
+                 A.BlockHeight() != ctrl.blockHeight ||
+                 A.ColCut() != ctrl.colCut) );
+            const bool rowMisalign = 
+              ( ctrl.rowConstrain && 
+                (A.RowAlign() != ctrl.rowAlign ||
+                 A.BlockWidth() != ctrl.blockWidth ||
+                 A.RowCut() != ctrl.rowCut) );
+            const bool rootMisalign = 
+              ( ctrl.rootConstrain && A.Root() != ctrl.root );
+            if( !colMisalign && !rowMisalign && !rootMisalign )
+            {
+                prox_ = new proxType( std::move(static_cast<proxType&>(A)) );
+                return;
+            }
+        }
+        prox_ = new proxType(A.Grid());
+        if( ctrl.rootConstrain )
+            prox_->SetRoot( ctrl.root );
+        if( ctrl.colConstrain )
+            prox_->AlignCols( ctrl.blockHeight, ctrl.colAlign, ctrl.colCut );
+        if( ctrl.rowConstrain )
+            prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
+        Copy( A, *prox_ );
+    }
+
     ~DistMatrixReadProxy() 
     { 
         if( madeCopy_ )
@@ -0,0 +1,489 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SPARSEBUILDER_HPP
+#define EL_CORE_SPARSEBUILDER_HPP
+
+namespace El {
+
+// Bulk assembly of a SparseMatrix or the local rows of a DistSparseMatrix.
+//
+// Entries are accumulated in a fixed number of independent buffers (by
+// default, one per OpenMP thread), each of which may be filled by a
+// different thread without synchronization, either as (possibly repeated)
+// triplets or as chunks of rows in CSR form whose columns are sorted and
+// unique within each row. Finish then merges every buffer with a parallel
+// counting (radix) sort on the rows followed by independent sorts of the
+// (typically few) columns of each row, combines duplicates in a
+// deterministic order, and moves the resulting arrays into the matrix.
+//
+// If the buffers only contain row chunks which are ordered and disjoint, the
+// chunks are concatenated without sorting (and a single chunk's column and
+// value arrays are moved into the matrix without any copy).
+//
+// For a DistSparseMatrix, triplets may lie in any row (they are sent to the
+// owning process within Finish, which is collective), but row chunks must
+// lie within the local rows.
+template<typename T>
+class SparseBuilder
+{
+public:
+    explicit SparseBuilder( Int numBuffers=DefaultNumBuffers() );
+
+    Int NumBuffers() const EL_NO_EXCEPT;
+    void Reserve( Int buffer, Int numEntries );
+
+    void QueueUpdate( Int buffer, const Entry<T>& entry )
+    EL_NO_RELEASE_EXCEPT;
+    void QueueUpdate( Int buffer, Int row, Int col, T value )
+    EL_NO_RELEASE_EXCEPT;
+    // Take ownership of a buffer of triplets (e.g., from a threaded parser)
+    void QueueUpdates( Int buffer, vector<Entry<T>>&& entries );
+
+    // Queue rows [firstRow,firstRow+numRows), where the entries of row
+    // firstRow+k are given by indices [rowOffsets[k],rowOffsets[k+1]) of the
+    // column and value arrays
+    void QueueRows
+    ( Int buffer, Int firstRow, Int numRows,
+      const Int* rowOffsets, const Int* colIndices, const T* values );
+    void QueueRows
+    ( Int buffer, Int firstRow,
+      vector<Int>&& rowOffsets, vector<Int>&& colIndices,
+      vector<T>&& values );
+
+    // Overwrite A (whose dimensions must already be set) with the sum of the
+    // queued entries and empty the buffers
+    void Finish( SparseMatrix<T>& A );
+    void Finish( DistSparseMatrix<T>& A );
+
+    static Int DefaultNumBuffers() EL_NO_EXCEPT;
+
+private:
+    struct RowChunk
+    {
+        Int firstRow;
+        vector<Int> rowOffsets, colIndices;
+        vector<T> values;
+    };
+
+    vector<vector<Entry<T>>> triplets_;
+    vector<vector<RowChunk>> chunks_;
+
+    bool ChunksOnly() const;
+    void Assemble
+    ( Int firstRow, Int numRows,
+      vector<Int>& sources, vector<Int>& targets, vector<T>& values );
+    void Concatenate
+    ( vector<Int>& sources, vector<Int>& targets, vector<T>& values );
+    void Clear();
+};
+
+template<typename T>
+Int SparseBuilder<T>::DefaultNumBuffers() EL_NO_EXCEPT
+{
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+template<typename T>
+SparseBuilder<T>::SparseBuilder( Int numBuffers )
+: triplets_(numBuffers), chunks_(numBuffers)
+{
+    DEBUG_CSE
+    if( numBuffers < 1 )
+        LogicError("A SparseBuilder requires at least one buffer");
+}
+
+template<typename T>
+Int SparseBuilder<T>::NumBuffers() const EL_NO_EXCEPT
+{ return triplets_.size(); }
+
+template<typename T>
+void SparseBuilder<T>::Reserve( Int buffer, Int numEntries )
+{ triplets_[buffer].reserve( numEntries ); }
+
+template<typename T>
+void SparseBuilder<T>::QueueUpdate( Int buffer, const Entry<T>& entry )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(
+      if( buffer < 0 || buffer >= NumBuffers() )
+          LogicError("Invalid buffer index ",buffer);
+    )
+    triplets_[buffer].push_back( entry );
+}
+
+template<typename T>
+void SparseBuilder<T>::QueueUpdate( Int buffer, Int row, Int col, T value )
+EL_NO_RELEASE_EXCEPT
+{ QueueUpdate( buffer, Entry<T>{row,col,value} ); }
+
+template<typename T>
+void SparseBuilder<T>::QueueUpdates( Int buffer, vector<Entry<T>>&& entries )
+{
+    DEBUG_CSE
+    auto& triplets = triplets_[buffer];
+    if( triplets.empty() )
+        triplets = std::move(entries);
+    else
+        triplets.insert( triplets.end(), entries.begin(), entries.end() );
+}
+
+template<typename T>
+void SparseBuilder<T>::QueueRows
+( Int buffer, Int firstRow, Int numRows,
+  const Int* rowOffsets, const Int* colIndices, const T* values )
+{
+    DEBUG_CSE
+    const Int offset = rowOffsets[0];
+    const Int numEntries = rowOffsets[numRows] - offset;
+    vector<Int> chunkOffsets( numRows+1 );
+    for( Int k=0; k<=numRows; ++k )
+        chunkOffsets[k] = rowOffsets[k] - offset;
+    vector<Int> chunkIndices( colIndices+offset, colIndices+offset+numEntries );
+    vector<T> chunkValues( values+offset, values+offset+numEntries );
+    QueueRows
+    ( buffer, firstRow, std::move(chunkOffsets), std::move(chunkIndices),
+      std::move(chunkValues) );
+}
+
+template<typename T>
+void SparseBuilder<T>::QueueRows
+( Int buffer, Int firstRow,
+  vector<Int>&& rowOffsets, vector<Int>&& colIndices, vector<T>&& values )
+{
+    DEBUG_CSE
+    if( rowOffsets.empty() || rowOffsets[0] != 0 ||
+        rowOffsets.back() != Int(colIndices.size()) ||
+        colIndices.size() != values.size() )
+        LogicError("Inconsistent row chunk");
+    DEBUG_ONLY(
+      const Int numRows = rowOffsets.size()-1;
+      for( Int k=0; k<numRows; ++k )
+          for( Int e=rowOffsets[k]+1; e<rowOffsets[k+1]; ++e )
+              if( colIndices[e] <= colIndices[e-1] )
+                  LogicError
+                  ("Columns of row ",firstRow+k," were not sorted and unique");
+    )
+    RowChunk chunk;
+    chunk.firstRow = firstRow;
+    chunk.rowOffsets = std::move(rowOffsets);
+    chunk.colIndices = std::move(colIndices);
+    chunk.values = std::move(values);
+    chunks_[buffer].push_back( std::move(chunk) );
+}
+
+template<typename T>
+bool SparseBuilder<T>::ChunksOnly() const
+{
+    for( const auto& triplets : triplets_ )
+        if( !triplets.empty() )
+            return false;
+
+    // The chunks must be ordered and disjoint in the order of the buffers
+    Int nextRow = 0;
+    for( const auto& chunks : chunks_ )
+    {
+        for( const auto& chunk : chunks )
+        {
+            if( chunk.firstRow < nextRow )
+                return false;
+            nextRow = chunk.firstRow + Int(chunk.rowOffsets.size()) - 1;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+void SparseBuilder<T>::Concatenate
+( vector<Int>& sources, vector<Int>& targets, vector<T>& values )
+{
+    DEBUG_CSE
+    vector<RowChunk*> chunkList;
+    for( auto& chunks : chunks_ )
+        for( auto& chunk : chunks )
+            chunkList.push_back( &chunk );
+    const Int numChunks = chunkList.size();
+    vector<Int> chunkStarts( numChunks+1, 0 );
+    for( Int c=0; c<numChunks; ++c )
+        chunkStarts[c+1] = chunkStarts[c] + chunkList[c]->colIndices.size();
+    const Int numEntries = chunkStarts[numChunks];
+
+    if( numChunks == 1 )
+    {
+        targets = std::move(chunkList[0]->colIndices);
+        values = std::move(chunkList[0]->values);
+    }
+    else
+    {
+        targets.resize( numEntries );
+        values.resize( numEntries );
+    }
+    sources.resize( numEntries );
+
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numChunks; ++c )
+    {
+        const RowChunk& chunk = *chunkList[c];
+        const Int start = chunkStarts[c];
+        const Int numRows = chunk.rowOffsets.size()-1;
+        for( Int k=0; k<numRows; ++k )
+            for( Int e=chunk.rowOffsets[k]; e<chunk.rowOffsets[k+1]; ++e )
+                sources[start+e] = chunk.firstRow + k;
+        if( numChunks != 1 )
+        {
+            std::copy
+            ( chunk.colIndices.begin(), chunk.colIndices.end(),
+              targets.begin()+start );
+            std::copy
+            ( chunk.values.begin(), chunk.values.end(),
+              values.begin()+start );
+        }
+    }
+}
+
+template<typename T>
+void SparseBuilder<T>::Assemble
+( Int firstRow, Int numRows,
+  vector<Int>& sources, vector<Int>& targets, vector<T>& values )
+{
+    DEBUG_CSE
+    const Int numBuffers = NumBuffers();
+
+    // Histogram the rows of each buffer
+    // =================================
+    vector<Int> counts( numBuffers*numRows, 0 );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<numBuffers; ++b )
+    {
+        Int* bufferCounts = &counts[b*numRows];
+        for( const auto& entry : triplets_[b] )
+            ++bufferCounts[entry.i-firstRow];
+        for( const auto& chunk : chunks_[b] )
+        {
+            const Int chunkRows = chunk.rowOffsets.size()-1;
+            for( Int k=0; k<chunkRows; ++k )
+                bufferCounts[chunk.firstRow+k-firstRow] +=
+                  chunk.rowOffsets[k+1] - chunk.rowOffsets[k];
+        }
+    }
+
+    // Convert the counts into the positions of each (row,buffer) segment
+    // ==================================================================
+    vector<Int> rowStarts( numRows+1 );
+    Int numEntries = 0;
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        rowStarts[iLoc] = numEntries;
+        for( Int b=0; b<numBuffers; ++b )
+        {
+            const Int count = counts[b*numRows+iLoc];
+            counts[b*numRows+iLoc] = numEntries;
+            numEntries += count;
+        }
+    }
+    rowStarts[numRows] = numEntries;
+
+    // Scatter the entries (stably within each buffer)
+    // ===============================================
+    vector<pair<Int,T>> rowEntries( numEntries );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<numBuffers; ++b )
+    {
+        Int* next = &counts[b*numRows];
+        for( const auto& entry : triplets_[b] )
+            rowEntries[next[entry.i-firstRow]++] =
+              pair<Int,T>(entry.j,entry.value);
+        for( const auto& chunk : chunks_[b] )
+        {
+            const Int chunkRows = chunk.rowOffsets.size()-1;
+            for( Int k=0; k<chunkRows; ++k )
+            {
+                Int& pos = next[chunk.firstRow+k-firstRow];
+                for( Int e=chunk.rowOffsets[k]; e<chunk.rowOffsets[k+1]; ++e )
+                    rowEntries[pos++] =
+                      pair<Int,T>(chunk.colIndices[e],chunk.values[e]);
+            }
+        }
+    }
+    Clear();
+
+    // Sort and combine the entries of each row
+    // ========================================
+    vector<Int> uniqueStarts( numRows+1, 0 );
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        auto beg = rowEntries.begin() + rowStarts[iLoc];
+        auto end = rowEntries.begin() + rowStarts[iLoc+1];
+        std::stable_sort
+        ( beg, end,
+          []( const pair<Int,T>& a, const pair<Int,T>& b )
+          { return a.first < b.first; } );
+        Int numUnique = 0;
+        for( auto it=beg; it!=end; ++it )
+        {
+            if( numUnique > 0 && (beg+numUnique-1)->first == it->first )
+                (beg+numUnique-1)->second += it->second;
+            else
+                *(beg+numUnique++) = *it;
+        }
+        uniqueStarts[iLoc+1] = numUnique;
+    }
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+        uniqueStarts[iLoc+1] += uniqueStarts[iLoc];
+
+    // Compress the rows into the coordinate arrays
+    // ============================================
+    const Int numUnique = uniqueStarts[numRows];
+    sources.resize( numUnique );
+    targets.resize( numUnique );
+    values.resize( numUnique );
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        const Int rowSize = uniqueStarts[iLoc+1] - uniqueStarts[iLoc];
+        for( Int k=0; k<rowSize; ++k )
+        {
+            const auto& rowEntry = rowEntries[rowStarts[iLoc]+k];
+            const Int e = uniqueStarts[iLoc] + k;
+            sources[e] = firstRow + iLoc;
+            targets[e] = rowEntry.first;
+            values[e] = rowEntry.second;
+        }
+    }
+}
+
+template<typename T>
+void SparseBuilder<T>::Clear()
+{
+    for( auto& triplets : triplets_ )
+        SwapClear( triplets );
+    for( auto& chunks : chunks_ )
+        SwapClear( chunks );
+}
+
+template<typename T>
+void SparseBuilder<T>::Finish( SparseMatrix<T>& A )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    DEBUG_ONLY(
+      const Int width = A.Width();
+      for( const auto& triplets : triplets_ )
+          for( const auto& entry : triplets )
+              if( entry.i < 0 || entry.i >= height ||
+                  entry.j < 0 || entry.j >= width )
+                  LogicError
+                  ("Entry (",entry.i,",",entry.j,") is out of bounds of ",
+                   height," x ",width," matrix");
+    )
+    for( const auto& chunks : chunks_ )
+        for( const auto& chunk : chunks )
+            if( chunk.firstRow < 0 ||
+                chunk.firstRow+Int(chunk.rowOffsets.size())-1 > height )
+                LogicError("Row chunk is out of bounds");
+
+    vector<Int> sources, targets;
+    vector<T> values;
+    if( ChunksOnly() )
+    {
+        Concatenate( sources, targets, values );
+        Clear();
+    }
+    else
+        Assemble( 0, height, sources, targets, values );
+    A.AdoptEntries
+    ( std::move(sources), std::move(targets), std::move(values) );
+}
+
+template<typename T>
+void SparseBuilder<T>::Finish( DistSparseMatrix<T>& A )
+{
+    DEBUG_CSE
+    const Int numBuffers = NumBuffers();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    for( const auto& chunks : chunks_ )
+        for( const auto& chunk : chunks )
+            if( chunk.firstRow < firstLocalRow ||
+                chunk.firstRow+Int(chunk.rowOffsets.size())-1 >
+                firstLocalRow+localHeight )
+                LogicError("Row chunks must lie within the local rows");
+
+    // Send the nonlocal triplets to their owners
+    // ==========================================
+    const mpi::Comm comm = A.Comm();
+    const int commSize = mpi::Size( comm );
+    vector<int> sendCounts(commSize,0);
+    for( const auto& triplets : triplets_ )
+    {
+        for( const auto& entry : triplets )
+        {
+            DEBUG_ONLY(
+              if( entry.i < 0 || entry.i >= A.Height() ||
+                  entry.j < 0 || entry.j >= A.Width() )
+                  LogicError
+                  ("Entry (",entry.i,",",entry.j,") is out of bounds of ",
+                   A.Height()," x ",A.Width()," matrix");
+            )
+            if( entry.i < firstLocalRow ||
+                entry.i >= firstLocalRow+localHeight )
+                ++sendCounts[A.RowOwner(entry.i)];
+        }
+    }
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Entry<T>> sendBuf(totalSend);
+    for( auto& triplets : triplets_ )
+    {
+        Int numKept = 0;
+        for( const auto& entry : triplets )
+        {
+            if( entry.i < firstLocalRow ||
+                entry.i >= firstLocalRow+localHeight )
+                sendBuf[offs[A.RowOwner(entry.i)]++] = entry;
+            else
+                triplets[numKept++] = entry;
+        }
+        triplets.resize( numKept );
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    SwapClear( sendBuf );
+    if( !recvBuf.empty() )
+    {
+        // Append the received triplets to the smallest buffer
+        Int smallest = 0;
+        for( Int b=1; b<numBuffers; ++b )
+            if( triplets_[b].size() < triplets_[smallest].size() )
+                smallest = b;
+        QueueUpdates( smallest, std::move(recvBuf) );
+    }
+
+    // Assemble the local rows
+    // =======================
+    vector<Int> sources, targets;
+    vector<T> values;
+    if( ChunksOnly() )
+    {
+        Concatenate( sources, targets, values );
+        Clear();
+    }
+    else
+        Assemble( firstLocalRow, localHeight, sources, targets, values );
+    A.AdoptLocalEntries
+    ( std::move(sources), std::move(targets), std::move(values) );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_SPARSEBUILDER_HPP
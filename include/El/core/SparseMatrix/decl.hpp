@@ -16,6 +16,34 @@ namespace El {
 // Forward declaration for constructor
 template<typename T> class DistSparseMatrix;
 
+// SELL-C-sigma storage: the rows are sorted by decreasing length within each
+// window of 'sortWindow' consecutive rows and then grouped into chunks of
+// 'chunkHeight' rows. The k'th entry of the row in slot r is stored at
+// index chunkOffsets[r/chunkHeight] + k*chunkHeight + (r % chunkHeight), and
+// each row is padded (with explicit zeros) to the longest row of its chunk.
+template<typename T>
+struct SELLStorage
+{
+    Int chunkHeight=1, sortWindow=1;
+    vector<Int> rowPerm;      // rowPerm[r] is the row stored in slot r
+    vector<Int> rowLengths;   // the (unpadded) length of slot r
+    vector<Int> chunkOffsets;
+    vector<Int> colIndices;
+    vector<T> values;
+};
+
+// Blocked CSR storage: the nonzero blockSize x blockSize blocks of each block
+// row are stored (column-major, padded with explicit zeros) in order of
+// increasing block column
+template<typename T>
+struct BCSRStorage
+{
+    Int blockSize=1;
+    vector<Int> blockRowOffsets;
+    vector<Int> blockColIndices;
+    vector<T> values;
+};
+
 template<typename T>
 class SparseMatrix
 {
@@ -59,6 +87,24 @@ public:
     void QueueZero( Int row, Int col ) EL_NO_RELEASE_EXCEPT;
     void ProcessQueues();
 
+    // Bulk assembly (see SparseBuilder)
+    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+    // Take ownership of coordinate arrays (without copying them) which
+    // should be sorted by row and then column without duplicates; unsorted
+    // arrays are sorted and combined as if they had been queued
+    void AdoptEntries
+    ( vector<Int>&& sources, vector<Int>&& targets, vector<T>&& values );
+
+    // Alternate storage formats
+    // ^^^^^^^^^^^^^^^^^^^^^^^^^
+    // The conversions require a consistent matrix with a frozen sparsity
+    // pattern and store a snapshot of the entries alongside the CSR data (which
+    // all other routines continue to use); any subsequent modification of the
+    // matrix reverts it to CSR_FORMAT.
+    void ConvertToCSR() EL_NO_EXCEPT;
+    void ConvertToSELL( Int chunkHeight=8, Int sortWindow=256 );
+    void ConvertToBCSR( Int blockSize=4 );
+
     // Operator overloading
     // ====================
 
@@ -114,6 +160,9 @@ public:
     bool Consistent() const EL_NO_EXCEPT;
     El::Graph& Graph() EL_NO_EXCEPT;
     const El::Graph& LockedGraph() const EL_NO_EXCEPT;
+    SparseFormat Format() const EL_NO_EXCEPT;
+    const SELLStorage<T>& LockedSELL() const EL_NO_EXCEPT;
+    const BCSRStorage<T>& LockedBCSR() const EL_NO_EXCEPT;
 
     // Entrywise information
     // ---------------------
@@ -132,6 +181,10 @@ private:
     El::Graph graph_;
     vector<T> vals_;
 
+    SparseFormat format_=CSR_FORMAT;
+    SELLStorage<T> sell_;
+    BCSRStorage<T> bcsr_;
+
     struct CompareEntriesFunctor
     {
         bool operator()(const Entry<T>& a, const Entry<T>& b ) 
@@ -55,6 +55,7 @@ SparseMatrix<T>::~SparseMatrix() { }
 template<typename T>
 void SparseMatrix<T>::Empty( bool clearMemory )
 {
+    ConvertToCSR();
     graph_.Empty( clearMemory );
     if( clearMemory )
         SwapClear( vals_ );
@@ -68,6 +69,7 @@ void SparseMatrix<T>::Resize( Int height, Int width )
     DEBUG_CSE
     if( Height() == height && Width() == width )
         return;
+    ConvertToCSR();
     graph_.Resize( height, width );
     vals_.resize( 0 );
 }
@@ -87,7 +89,10 @@ void SparseMatrix<T>::FreezeSparsity() EL_NO_EXCEPT
 { graph_.frozenSparsity_ = true; }
 template<typename T>
 void SparseMatrix<T>::UnfreezeSparsity() EL_NO_EXCEPT
-{ graph_.frozenSparsity_ = false; }
+{
+    ConvertToCSR();
+    graph_.frozenSparsity_ = false;
+}
 template<typename T>
 bool SparseMatrix<T>::FrozenSparsity() const EL_NO_EXCEPT
 { return graph_.frozenSparsity_; }
@@ -117,6 +122,7 @@ void SparseMatrix<T>::QueueUpdate( Int row, Int col, T value )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    ConvertToCSR();
     if( FrozenSparsity() )
     {
         const Int offset = Offset( row, col );
@@ -139,6 +145,7 @@ void SparseMatrix<T>::QueueZero( Int row, Int col )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    ConvertToCSR();
     if( FrozenSparsity() )
     {
         const Int offset = Offset( row, col );
@@ -161,6 +168,9 @@ const SparseMatrix<T>& SparseMatrix<T>::operator=( const SparseMatrix<T>& A )
     DEBUG_CSE
     graph_ = A.graph_;
     vals_ = A.vals_;
+    format_ = A.format_;
+    sell_ = A.sell_;
+    bcsr_ = A.bcsr_;
     return *this;
 }
 
@@ -174,6 +184,7 @@ SparseMatrix<T>::operator=( const DistSparseMatrix<T>& A )
     if( commSize != 1 )
         LogicError("Can not yet construct from distributed sparse matrix");
 
+    ConvertToCSR();
     graph_ = A.distGraph_;
     vals_ = A.vals_;
     return *this;
@@ -281,11 +292,24 @@ bool SparseMatrix<T>::Consistent() const EL_NO_EXCEPT
 
 template<typename T>
 El::Graph& SparseMatrix<T>::Graph() EL_NO_EXCEPT
-{ return graph_; }
+{
+    ConvertToCSR();
+    return graph_;
+}
 template<typename T>
 const El::Graph& SparseMatrix<T>::LockedGraph() const EL_NO_EXCEPT
 { return graph_; }
 
+template<typename T>
+SparseFormat SparseMatrix<T>::Format() const EL_NO_EXCEPT
+{ return format_; }
+template<typename T>
+const SELLStorage<T>& SparseMatrix<T>::LockedSELL() const EL_NO_EXCEPT
+{ return sell_; }
+template<typename T>
+const BCSRStorage<T>& SparseMatrix<T>::LockedBCSR() const EL_NO_EXCEPT
+{ return bcsr_; }
+
 // Entrywise information
 // ---------------------
 template<typename T>
@@ -354,6 +378,7 @@ void SparseMatrix<T>::Set( Int row, Int col, T val) EL_NO_RELEASE_EXCEPT
     Int index = Offset( row, col );  
     if( Row(index) == row && Col(index) == col )
     {
+        ConvertToCSR();
         vals_[index] = val; 
     }
     else
@@ -365,16 +390,28 @@ void SparseMatrix<T>::Set( Int row, Int col, T val) EL_NO_RELEASE_EXCEPT
 
 template<typename T>
 Int* SparseMatrix<T>::SourceBuffer() EL_NO_EXCEPT
-{ return graph_.SourceBuffer(); }
+{
+    ConvertToCSR();
+    return graph_.SourceBuffer();
+}
 template<typename T>
 Int* SparseMatrix<T>::TargetBuffer() EL_NO_EXCEPT
-{ return graph_.TargetBuffer(); }
+{
+    ConvertToCSR();
+    return graph_.TargetBuffer();
+}
 template<typename T>
 Int* SparseMatrix<T>::OffsetBuffer() EL_NO_EXCEPT
-{ return graph_.OffsetBuffer(); }
+{
+    ConvertToCSR();
+    return graph_.OffsetBuffer();
+}
 template<typename T>
 T* SparseMatrix<T>::ValueBuffer() EL_NO_EXCEPT
-{ return vals_.data(); }
+{
+    ConvertToCSR();
+    return vals_.data();
+}
 
 template<typename T>
 const Int* SparseMatrix<T>::LockedSourceBuffer() const EL_NO_EXCEPT
@@ -393,6 +430,7 @@ template<typename T>
 void SparseMatrix<T>::ForceNumEntries( Int numEntries )
 {
     DEBUG_CSE
+    ConvertToCSR();
     graph_.ForceNumEdges( numEntries );
     vals_.resize( numEntries );
 }
@@ -416,8 +454,33 @@ void SparseMatrix<T>::ProcessQueues()
     if( graph_.consistent_ )
         return;
 
-    Int numRemoved = 0;
+    // Entries which were directly written in sorted order without duplicates
+    // (e.g., after ForceNumEntries) only require their offsets to be formed
     const Int numEntries = vals_.size();
+    if( graph_.markedForRemoval_.size() == 0 )
+    {
+        const Int* sourceBuf = graph_.sources_.data();
+        const Int* targetBuf = graph_.targets_.data();
+        bool sorted = true;
+        for( Int s=1; s<numEntries; ++s )
+        {
+            if( sourceBuf[s] < sourceBuf[s-1] ||
+                (sourceBuf[s] == sourceBuf[s-1] &&
+                 targetBuf[s] <= targetBuf[s-1]) )
+            {
+                sorted = false;
+                break;
+            }
+        }
+        if( sorted )
+        {
+            graph_.ComputeSourceOffsets();
+            graph_.consistent_ = true;
+            return;
+        }
+    }
+
+    Int numRemoved = 0;
     vector<Entry<T>> entries( numEntries );
     if( graph_.markedForRemoval_.size() != 0 )
     {
@@ -476,6 +539,197 @@ void SparseMatrix<T>::ProcessQueues()
     graph_.consistent_ = true;
 }
 
+template<typename T>
+void SparseMatrix<T>::AdoptEntries
+( vector<Int>&& sources, vector<Int>&& targets, vector<T>&& values )
+{
+    DEBUG_CSE
+    if( sources.size() != targets.size() || targets.size() != values.size() )
+        LogicError("Inconsistent adopted buffer sizes");
+    if( FrozenSparsity() )
+        LogicError("Cannot adopt entries into a frozen sparsity pattern");
+    DEBUG_ONLY(
+      const Int numEntries = sources.size();
+      for( Int e=0; e<numEntries; ++e )
+          if( sources[e] < 0 || sources[e] >= Height() ||
+              targets[e] < 0 || targets[e] >= Width() )
+              LogicError
+              ("Entry (",sources[e],",",targets[e],") is out of bounds of ",
+               Height()," x ",Width()," matrix");
+    )
+    ConvertToCSR();
+    graph_.sources_ = std::move(sources);
+    graph_.targets_ = std::move(targets);
+    vals_ = std::move(values);
+    graph_.markedForRemoval_.clear();
+    graph_.consistent_ = false;
+    ProcessQueues();
+}
+
+template<typename T>
+void SparseMatrix<T>::ConvertToCSR() EL_NO_EXCEPT
+{
+    if( format_ == CSR_FORMAT )
+        return;
+    format_ = CSR_FORMAT;
+    sell_ = SELLStorage<T>();
+    bcsr_ = BCSRStorage<T>();
+}
+
+template<typename T>
+void SparseMatrix<T>::ConvertToSELL( Int chunkHeight, Int sortWindow )
+{
+    DEBUG_CSE
+    if( !FrozenSparsity() )
+        LogicError("The sparsity pattern must be frozen before conversion");
+    if( !Consistent() )
+        LogicError("The matrix must be consistent before conversion");
+    if( chunkHeight < 1 || sortWindow < 1 )
+        LogicError
+        ("Invalid SELL parameters: chunkHeight=",chunkHeight,
+         ", sortWindow=",sortWindow);
+    ConvertToCSR();
+    const Int height = Height();
+    const Int* offsetBuf = LockedOffsetBuffer();
+    const Int* targetBuf = LockedTargetBuffer();
+
+    SELLStorage<T> sell;
+    sell.chunkHeight = chunkHeight;
+    sell.sortWindow = sortWindow;
+
+    // Sort the rows by decreasing length within each window
+    sell.rowPerm.resize( height );
+    for( Int i=0; i<height; ++i )
+        sell.rowPerm[i] = i;
+    auto longer = [&]( const Int& i, const Int& j )
+      { return offsetBuf[i+1]-offsetBuf[i] > offsetBuf[j+1]-offsetBuf[j]; };
+    for( Int r=0; r<height; r+=sortWindow )
+        std::stable_sort
+        ( sell.rowPerm.begin()+r,
+          sell.rowPerm.begin()+Min(r+sortWindow,height), longer );
+    sell.rowLengths.resize( height );
+    for( Int r=0; r<height; ++r )
+    {
+        const Int i = sell.rowPerm[r];
+        sell.rowLengths[r] = offsetBuf[i+1] - offsetBuf[i];
+    }
+
+    // Pad each row of a chunk to the length of its longest row
+    const Int numChunks = (height+chunkHeight-1) / chunkHeight;
+    sell.chunkOffsets.resize( numChunks+1 );
+    sell.chunkOffsets[0] = 0;
+    for( Int c=0; c<numChunks; ++c )
+    {
+        Int chunkWidth = 0;
+        for( Int r=c*chunkHeight; r<Min((c+1)*chunkHeight,height); ++r )
+            chunkWidth = Max( chunkWidth, sell.rowLengths[r] );
+        sell.chunkOffsets[c+1] = sell.chunkOffsets[c] + chunkWidth*chunkHeight;
+    }
+    const Int numSlots = sell.chunkOffsets[numChunks];
+    sell.colIndices.resize( numSlots );
+    sell.values.resize( numSlots );
+    for( Int c=0; c<numChunks; ++c )
+    {
+        const Int chunkWidth =
+          (sell.chunkOffsets[c+1]-sell.chunkOffsets[c]) / chunkHeight;
+        for( Int lane=0; lane<chunkHeight; ++lane )
+        {
+            const Int r = c*chunkHeight + lane;
+            const Int length = ( r < height ? sell.rowLengths[r] : 0 );
+            const Int offset = ( r < height ? offsetBuf[sell.rowPerm[r]] : 0 );
+            // Padding reuses the last column of the row so that it only
+            // touches entries of x which the row already depends upon
+            const Int padCol = ( length > 0 ? targetBuf[offset+length-1] : 0 );
+            for( Int k=0; k<chunkWidth; ++k )
+            {
+                const Int index = sell.chunkOffsets[c] + k*chunkHeight + lane;
+                if( k < length )
+                {
+                    sell.colIndices[index] = targetBuf[offset+k];
+                    sell.values[index] = vals_[offset+k];
+                }
+                else
+                {
+                    sell.colIndices[index] = padCol;
+                    sell.values[index] = 0;
+                }
+            }
+        }
+    }
+
+    sell_ = std::move(sell);
+    format_ = SELL_FORMAT;
+}
+
+template<typename T>
+void SparseMatrix<T>::ConvertToBCSR( Int blockSize )
+{
+    DEBUG_CSE
+    if( !FrozenSparsity() )
+        LogicError("The sparsity pattern must be frozen before conversion");
+    if( !Consistent() )
+        LogicError("The matrix must be consistent before conversion");
+    if( blockSize < 1 )
+        LogicError("Invalid BCSR block size: ",blockSize);
+    ConvertToCSR();
+    const Int height = Height();
+    const Int width = Width();
+    const Int* offsetBuf = LockedOffsetBuffer();
+    const Int* targetBuf = LockedTargetBuffer();
+    const Int blockArea = blockSize*blockSize;
+
+    BCSRStorage<T> bcsr;
+    bcsr.blockSize = blockSize;
+    const Int numBlockRows = (height+blockSize-1) / blockSize;
+    const Int numBlockCols = (width+blockSize-1) / blockSize;
+    bcsr.blockRowOffsets.resize( numBlockRows+1 );
+    bcsr.blockRowOffsets[0] = 0;
+
+    // Record the position of each block column within the current block row
+    vector<Int> blockPos( numBlockCols, -1 );
+    vector<Int> blockCols;
+    for( Int I=0; I<numBlockRows; ++I )
+    {
+        const Int iBeg = I*blockSize;
+        const Int iEnd = Min(iBeg+blockSize,height);
+        blockCols.resize( 0 );
+        for( Int e=offsetBuf[iBeg]; e<offsetBuf[iEnd]; ++e )
+        {
+            const Int J = targetBuf[e] / blockSize;
+            if( blockPos[J] < 0 )
+            {
+                blockPos[J] = 0;
+                blockCols.push_back( J );
+            }
+        }
+        std::sort( blockCols.begin(), blockCols.end() );
+        const Int blockOffset = bcsr.blockRowOffsets[I];
+        const Int numBlocks = blockCols.size();
+        for( Int s=0; s<numBlocks; ++s )
+        {
+            blockPos[blockCols[s]] = blockOffset + s;
+            bcsr.blockColIndices.push_back( blockCols[s] );
+        }
+        bcsr.values.resize( (blockOffset+numBlocks)*blockArea, T(0) );
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+            {
+                const Int j = targetBuf[e];
+                const Int s = blockPos[j/blockSize];
+                bcsr.values[s*blockArea+(i-iBeg)+(j%blockSize)*blockSize] =
+                  vals_[e];
+            }
+        }
+        for( Int s=0; s<numBlocks; ++s )
+            blockPos[blockCols[s]] = -1;
+        bcsr.blockRowOffsets[I+1] = blockOffset + numBlocks;
+    }
+
+    bcsr_ = std::move(bcsr);
+    format_ = BCSR_FORMAT;
+}
+
 template<typename T>
 void SparseMatrix<T>::AssertConsistent() const
 { graph_.AssertConsistent(); }
@@ -0,0 +1,76 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_TASKGRAPH_HPP
+#define EL_CORE_TASKGRAPH_HPP
+
+namespace El {
+
+// A sequential-task-flow runtime: tasks are inserted in an order in which it
+// would be valid to run them sequentially, along with the handles of the data
+// (e.g., tiles) which they read and write, and the dependencies between the
+// tasks are inferred from the order of the accesses to each handle. Execute
+// then dynamically schedules each task as soon as all of its predecessors
+// have completed, favoring the ready tasks of highest priority (and, among
+// those, the ones which were inserted first).
+//
+// The tasks are run by a team of OpenMP threads, and so they are run
+// sequentially (in insertion order) unless EL_HYBRID is defined.
+class TaskGraph
+{
+public:
+    // The task may be run concurrently with any other tasks which do not
+    // write to one of its handles (or read one of the handles it writes)
+    void Insert
+    ( function<void()> task,
+      const vector<Int>& reads,
+      const vector<Int>& writes,
+      Int priority=0 );
+
+    // A numThreads of zero selects omp_get_max_threads(). If any task throws,
+    // no further tasks are started and the first exception is rethrown once
+    // the running tasks have completed.
+    void Execute( Int numThreads=0 );
+
+    void Clear();
+
+    Int NumTasks() const EL_NO_EXCEPT;
+    Int NumDependencies() const EL_NO_EXCEPT;
+    // The number of tasks along the longest chain of dependencies
+    Int CriticalPathLength() const EL_NO_EXCEPT;
+
+private:
+    struct Task
+    {
+        function<void()> func;
+        Int priority=0;
+        Int depth=1;
+        Int numPredecessors=0;
+        vector<Int> successors;
+    };
+    vector<Task> tasks_;
+    std::map<Int,Int> lastWriter_;
+    std::map<Int,vector<Int>> readersSinceWrite_;
+    Int numDependencies_=0;
+
+    void AddDependency( Int predecessor, Int successor );
+};
+
+struct TileCtrl
+{
+    // The tiles are tileSize x tileSize (except along the bottom and right
+    // edges of the matrix)
+    Int tileSize=128;
+
+    // See TaskGraph::Execute
+    Int numThreads=0;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_TASKGRAPH_HPP
@@ -22,6 +22,39 @@ typedef std::chrono::steady_clock Clock;
 typedef std::chrono::high_resolution_clock Clock;
 #endif
 
+// Hardware performance counters
+// ==============================
+// When Elemental was configured with EL_HAVE_PERF_EVENT (i.e., on Linux) and
+// the counters have been enabled, each thread lazily opens the following
+// (user-space) counters, which are accumulated by Timers and by profiling
+// regions. Counters which the processor (or the 'perf_event_paranoid'
+// setting) does not allow remain zero.
+namespace HardwareCounterNS {
+enum HardwareCounter
+{
+  HW_CYCLES,
+  HW_INSTRUCTIONS,
+  HW_CACHE_REFERENCES,
+  HW_CACHE_MISSES,
+  HW_BRANCH_MISSES,
+  HW_L1D_READ_MISSES,
+  NUM_HW_COUNTERS
+};
+}
+using namespace HardwareCounterNS;
+
+typedef std::array<long long,NUM_HW_COUNTERS> HardwareCounts;
+
+// Returns whether any of the counters could be opened by this thread
+bool EnableHardwareCounters();
+void DisableHardwareCounters();
+bool HardwareCountersEnabled();
+
+string HardwareCounterName( HardwareCounter counter );
+
+// The current values of this thread's counters (or zeros if disabled)
+void ReadHardwareCounters( HardwareCounts& counts );
+
 class Timer
 {
 public:
@@ -35,11 +68,15 @@ public:
     double Total() const; // total elapsed time
 
     void Reset( const string& name="[blank]" );
+
+    // The hardware counts accumulated between each Start and Stop
+    const HardwareCounts& Counts() const;
 private:
-    bool running_ = false;
+    bool running_ = false, countingHardware_ = false;
     string name_ = "[blank]";
     double totalTime_=0, lastPartialTime_=0;
     Clock::time_point lastTime_;
+    HardwareCounts lastCounts_, counts_{};
 };
 
 } // namespace El
@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TRANSPOSEDVIEW_HPP
+#define EL_TRANSPOSEDVIEW_HPP
+
+namespace El {
+
+// A non-owning record of a matrix together with the orientation in which it
+// should be applied. Unlike Transpose(A,B) and Adjoint(A,B), forming a
+// TransposedView neither allocates nor communicates; the routines which
+// accept one (e.g., Gemm, Gemv, Trsm, and Trsv) simply forward the recorded
+// orientation to their orientation-aware kernels.
+//
+// The referenced matrix must outlive the view.
+template<class MatType>
+class TransposedView
+{
+public:
+    TransposedView( const MatType& A, El::Orientation orientation=TRANSPOSE )
+    : parent_(A), orientation_(orientation)
+    { }
+
+    const MatType& Parent() const EL_NO_EXCEPT { return parent_; }
+    El::Orientation Orientation() const EL_NO_EXCEPT { return orientation_; }
+    bool Conjugated() const EL_NO_EXCEPT { return orientation_ == ADJOINT; }
+
+    // The dimensions of the implicitly-oriented matrix
+    Int Height() const EL_NO_EXCEPT
+    { return orientation_ == NORMAL ? parent_.Height() : parent_.Width(); }
+    Int Width() const EL_NO_EXCEPT
+    { return orientation_ == NORMAL ? parent_.Width() : parent_.Height(); }
+
+private:
+    const MatType& parent_;
+    El::Orientation orientation_;
+};
+
+template<typename T>
+inline TransposedView<Matrix<T>>
+Transposed( const Matrix<T>& A, bool conjugate=false )
+{ return TransposedView<Matrix<T>>( A, conjugate ? ADJOINT : TRANSPOSE ); }
+
+template<typename T>
+inline TransposedView<AbstractDistMatrix<T>>
+Transposed( const AbstractDistMatrix<T>& A, bool conjugate=false )
+{
+    return
+      TransposedView<AbstractDistMatrix<T>>
+      ( A, conjugate ? ADJOINT : TRANSPOSE );
+}
+
+template<typename T>
+inline TransposedView<Matrix<T>> Adjointed( const Matrix<T>& A )
+{ return Transposed( A, true ); }
+
+template<typename T>
+inline TransposedView<AbstractDistMatrix<T>>
+Adjointed( const AbstractDistMatrix<T>& A )
+{ return Transposed( A, true ); }
+
+// Transposing a view either cancels the recorded orientation or, when the
+// conjugations do not match, would require an explicit conjugation
+template<class MatType>
+inline TransposedView<MatType>
+Transposed( const TransposedView<MatType>& A, bool conjugate=false )
+{
+    DEBUG_CSE
+    const Orientation orient = A.Orientation();
+    if( orient == NORMAL )
+        return TransposedView<MatType>
+               ( A.Parent(), conjugate ? ADJOINT : TRANSPOSE );
+    if( (orient == ADJOINT) != conjugate )
+        LogicError("Conjugating a TransposedView requires an explicit copy");
+    return TransposedView<MatType>( A.Parent(), NORMAL );
+}
+
+} // namespace El
+
+#endif // ifndef EL_TRANSPOSEDVIEW_HPP
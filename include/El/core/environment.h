@@ -51,6 +51,12 @@ EL_EXPORT ElError ElSetBlocksize( ElInt blocksize );
 EL_EXPORT ElError ElPushBlocksizeStack( ElInt blocksize );
 EL_EXPORT ElError ElPopBlocksizeStack();
 
+EL_EXPORT ElError ElEnableMemoryPool();
+EL_EXPORT ElError ElDisableMemoryPool();
+EL_EXPORT ElError ElReleaseMemoryPool();
+EL_EXPORT ElError ElMemoryPoolResidentBytes( size_t* bytes );
+EL_EXPORT ElError ElMemoryPoolPeakBytes( size_t* bytes );
+
 #define EL_ABORT_ON_ERROR(error) \
   do \
   { \
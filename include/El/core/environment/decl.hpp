@@ -93,6 +93,148 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// For autotuned, per-kernel blocksizes and algorithm variants
+// -----------------------------------------------------------
+// The tuning table is keyed on the kernel, the process grid shape, and the
+// problem size (rounded to a power of two). Lookups with a matching kernel
+// and grid shape fall back to the nearest tuned problem size, and lookups
+// without any such entry fall back to the global Blocksize() and the
+// kernel's default heuristics. If the environment variable EL_TUNING_FILE
+// is set, the table is loaded from that file within Initialize.
+namespace TunedKernelNS {
+enum TunedKernel {
+  TUNE_CHOLESKY,
+  TUNE_LU,
+  TUNE_QR,
+  TUNE_HERMITIAN_TRIDIAG,
+  TUNE_TRSM,
+  TUNE_GEMM,
+  NUM_TUNED_KERNELS
+};
+}
+using namespace TunedKernelNS;
+
+string TunedKernelName( TunedKernel kernel );
+TunedKernel TunedKernelFromName( const string& name );
+
+struct TuningEntry
+{
+    Int blocksize=0;
+    // The kernel-specific algorithm (e.g., a GemmAlgorithm or a
+    // HermitianTridiagApproach), or -1 if the default should be used
+    Int variant=-1;
+    // The (maximum over the processes) time of the tuned configuration
+    double seconds=0;
+};
+
+void SetTuning
+( TunedKernel kernel, int gridHeight, int gridWidth, Int n,
+  const TuningEntry& entry );
+bool LookupTuning
+( TunedKernel kernel, int gridHeight, int gridWidth, Int n,
+  TuningEntry& entry );
+void ClearTuning();
+
+// Returns the tuned blocksize if one is available and Blocksize() otherwise
+Int Blocksize( TunedKernel kernel, Int n, int gridHeight, int gridWidth );
+// Returns the tuned algorithm variant if one is available and -1 otherwise
+Int TunedVariant( TunedKernel kernel, Int n, int gridHeight, int gridWidth );
+
+// The tuning file holds one entry per line:
+//   kernel gridHeight gridWidth n blocksize variant seconds
+// Loading merges the file's entries into the current table, and only the
+// root of the communicator writes the file when saving.
+void LoadTuning( const string& filename );
+void SaveTuning( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+// Pushes the tuned blocksize onto the blocksize stack for the lifetime of
+// the object so that the underlying variants, which query Blocksize(),
+// make use of it
+class TunedBlocksizeScope
+{
+public:
+    TunedBlocksizeScope
+    ( TunedKernel kernel, Int n, int gridHeight, int gridWidth );
+    ~TunedBlocksizeScope();
+};
+
+// For controlling the placement of large local buffers
+struct MemoryPolicy
+{
+    // Request transparent huge pages (2MB on x86-64)
+    bool hugePages=false;
+    NumaPolicy numa=NUMA_DEFAULT;
+    // Only buffers of at least this many bytes are subject to the policy
+    size_t threshold=size_t(1)<<21;
+};
+void SetMemoryPolicy( const MemoryPolicy& policy );
+const MemoryPolicy& GetMemoryPolicy();
+
+// For optionally padding the leading dimension of newly-allocated matrices
+// to a multiple of the cache line size, with an additional skew of one cache
+// line when the column stride would otherwise be a multiple of 2KB (which
+// leads to cache-set aliasing)
+void EnableLDimPadding();
+void DisableLDimPadding();
+bool LDimPadding();
+// The leading dimension used when allocating a matrix of the given height
+template<typename T>
+Int DefaultLDim( Int height );
+
+// For toggling the size-class pool behind Memory<G> and querying its usage
+// (the pool is thread-local when EL_HYBRID is defined)
+void EnableMemoryPool();
+void DisableMemoryPool();
+bool MemoryPoolEnabled();
+// Return all cached (but currently unused) pooled buffers to the system
+void ReleaseMemoryPool();
+// The number of bytes currently held by the pool (whether in use or cached)
+// and the high-water mark of said quantity
+size_t MemoryPoolResidentBytes();
+size_t MemoryPoolPeakBytes();
+
+// For querying the footprint of the buffers underlying Memory<G> (and hence
+// every Matrix and DistMatrix) on this process: the number of bytes currently
+// live and the high-water mark of said quantity since the last reset
+size_t MemoryLiveBytes();
+size_t MemoryPeakBytes();
+void ResetMemoryPeak();
+// The number of bytes available for new allocations on this node (the
+// MemAvailable entry of /proc/meminfo), or zero if it cannot be determined
+size_t NodeAvailableMemory();
+// For additionally attributing each allocation to the innermost entry of the
+// call stack (which is not a member of Matrix, DistMatrix, etc.). Call sites
+// are only available in non-release builds; otherwise, and for allocations
+// from OpenMP worker threads, a placeholder site is used.
+void EnableMemoryTracking();
+void DisableMemoryTracking();
+bool MemoryTracking();
+// Print this process's live and peak footprints along with the (at most)
+// 'maxSites' call sites with the largest peaks
+void PrintMemoryReport( ostream& os=cout, Int maxSites=10 );
+// Have Finalize() write each process's memory report to the file
+// '<basename>-ProcXXX.txt' (this implies EnableMemoryTracking)
+void EnableMemoryReport( const string& basename="El-Memory" );
+void DisableMemoryReport();
+// Write the report requested via EnableMemoryReport, if any (Finalize() calls
+// this before finalizing MPI)
+void WriteMemoryReport();
+
+// Free the (unborrowed) contents of the scratch arena used for packing
+// and unpacking during redistributions, e.g., after a large solve
+void ReleaseScratch();
+// The number of bytes currently reserved by the scratch arena
+size_t ScratchCapacity();
+
+// Have the scratch arena carve pack/unpack buffers out of a user-supplied
+// (e.g., pinned or NIC-registered) region before allocating any memory of
+// its own, so that the buffers handed to MPI by the redistribution routines
+// lie within the registered region. The region is never freed by Elemental
+// and must outlive its registration. When EL_HYBRID is defined, only the
+// calling thread's arena is affected.
+void RegisterScratchRegion( void* buffer, size_t bytes );
+void UnregisterScratchRegion();
+
 template<typename T,typename=EnableIf<IsScalar<T>>>
 inline const T& Max( const T& m, const T& n ) EL_NO_EXCEPT
 { return std::max(m,n); }
@@ -287,6 +429,10 @@ DEBUG_ONLY(
     void PushCallStack( string s );
     void PopCallStack();
     void DumpCallStack( ostream& os=cerr );
+    // The innermost entry of the call stack which is neither a member function
+    // of one of the matrix or memory classes nor an mpi:: wrapper (or an empty
+    // string)
+    string CallSite();
 
     class CallStackEntry 
     {
@@ -389,7 +535,15 @@ Int Find( const vector<Int>& sortedInds, Int index );
  LogicError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
 #define RUNTIME_ERROR(...) \
  RuntimeError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
-#define DEBUG_CSE DEBUG_ONLY(CSE cse(EL_FUNCTION))
+// If Elemental was configured with EL_PROFILE_CALLS, every function which
+// marks itself with DEBUG_CSE is also a profiling region (see Profile.hpp)
+#ifdef EL_PROFILE_CALLS
+# define DEBUG_CSE \
+  DEBUG_ONLY(CSE cse(EL_FUNCTION)) \
+  El::ProfileRegion elProfileFunction(EL_FUNCTION);
+#else
+# define DEBUG_CSE DEBUG_ONLY(CSE cse(EL_FUNCTION))
+#endif
 
 } // namespace El
 
@@ -114,6 +114,24 @@ inline void MemZero( T* buffer, size_t numEntries )
 template<typename T>
 inline void SwapClear( T& x ) { T().swap( x ); }
 
+template<typename T>
+inline Int DefaultLDim( Int height )
+{
+    const Int minLDim = Max( height, 1 );
+    if( !LDimPadding() || CACHE_LINE_SIZE % sizeof(T) != 0 )
+        return minLDim;
+    // Avoid wasting more than a quarter of the storage on short columns
+    const Int entriesPerLine = CACHE_LINE_SIZE / sizeof(T);
+    if( height < 4*entriesPerLine )
+        return minLDim;
+
+    Int ldim = ((height+entriesPerLine-1)/entriesPerLine)*entriesPerLine;
+    const size_t aliasingStride = 2048;
+    if( (ldim*sizeof(T)) % aliasingStride == 0 )
+        ldim += entriesPerLine;
+    return ldim;
+}
+
 template<typename T>
 inline T 
 Scan( const vector<T>& counts, vector<T>& offsets )
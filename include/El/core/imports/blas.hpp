@@ -81,6 +81,18 @@ void Axpy
   const dcomplex& alpha, 
   const dcomplex* x, BlasInt incx,
         dcomplex* y, BlasInt incy );
+#ifdef EL_HAVE_MPC
+void Axpy
+( BlasInt n,
+  const BigInt& alpha,
+  const BigInt* x, BlasInt incx,
+        BigInt* y, BlasInt incy );
+void Axpy
+( BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* x, BlasInt incx,
+        BigFloat* y, BlasInt incy );
+#endif
 
 template<typename T>
 void Copy
@@ -114,6 +126,12 @@ double Dot
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+#ifdef EL_HAVE_MPC
+BigFloat Dot
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy );
+#endif
 
 template<typename T>
 T Dotc
@@ -124,6 +142,12 @@ double Dotc
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+#ifdef EL_HAVE_MPC
+BigFloat Dotc
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy );
+#endif
 
 template<typename T>
 T Dotu
@@ -134,6 +158,12 @@ double Dotu
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+#ifdef EL_HAVE_MPC
+BigFloat Dotu
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy );
+#endif
 
 template<typename F>
 Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx );
@@ -254,6 +284,39 @@ void Gemv
   const dcomplex& beta,
         dcomplex* y, BlasInt incy );
 
+#ifdef EL_HAVE_QD
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy );
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble* x, BlasInt incx,
+  const QuadDouble& beta,
+        QuadDouble* y, BlasInt incy );
+#endif
+#ifdef EL_HAVE_MPC
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+  const BigInt* x, BlasInt incx,
+  const BigInt& beta,
+        BigInt* y, BlasInt incy );
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat& beta,
+        BigFloat* y, BlasInt incy );
+#endif
+
 template<typename T>
 void Ger
 ( BlasInt m, BlasInt n,
@@ -604,6 +667,48 @@ void Gemm
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim );
 
+#ifdef EL_HAVE_QD
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble* B, BlasInt BLDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim );
+#endif
+#ifdef EL_HAVE_QUAD
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad* B, BlasInt BLDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* A, BlasInt ALDim,
+  const Complex<Quad>* B, BlasInt BLDim,
+  const Complex<Quad>& beta,
+        Complex<Quad>* C, BlasInt CLDim );
+#endif
+#ifdef EL_HAVE_MPC
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* B, BlasInt BLDim,
+  const BigFloat& beta,
+        BigFloat* C, BlasInt CLDim );
+#endif
+
 template<typename T>
 void Hemm
 ( char side, char uplo, BlasInt m, BlasInt n,
@@ -913,6 +1018,21 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim );
 
+#ifdef EL_HAVE_QD
+void Trsm
+( char side,  char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* B, BlasInt BLDim );
+void Trsm
+( char side,  char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+        QuadDouble* B, BlasInt BLDim );
+#endif
+
 } // namespace blas
 } // namespace El
 
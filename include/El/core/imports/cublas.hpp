@@ -0,0 +1,71 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_CUBLAS_HPP
+#define EL_IMPORTS_CUBLAS_HPP
+
+#ifdef EL_HAVE_CUBLAS
+
+namespace El {
+
+// Release the cuBLAS handle, stream, and device workspace (if they were
+// ever created)
+void FinalizeCuBLAS();
+
+namespace cublas {
+
+// Local products whose number of multiply-adds, m n k, is at least the
+// offload threshold are computed on the device by blas::Gemm; since the
+// operands must cross the PCIe bus, small updates are kept on the host
+bool ShouldOffload( BlasInt m, BlasInt n, BlasInt k );
+void SetOffloadThreshold( double numMultiplyAdds );
+double OffloadThreshold();
+
+// The operands are staged through a persistent device workspace which only
+// ever grows, so that the sequence of equally-sized updates issued by the
+// distributed level-3 routines (and the trailing updates of LU and
+// Cholesky) does not repeatedly allocate device memory
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* A, BlasInt ALDim,
+  const float* B, BlasInt BLDim,
+  const float& beta,
+        float* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* A, BlasInt ALDim,
+  const double* B, BlasInt BLDim,
+  const double& beta,
+        double* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim,
+  const scomplex* B, BlasInt BLDim,
+  const scomplex& beta,
+        scomplex* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim,
+  const dcomplex* B, BlasInt BLDim,
+  const dcomplex& beta,
+        dcomplex* C, BlasInt CLDim );
+
+} // namespace cublas
+} // namespace El
+
+#endif // ifdef EL_HAVE_CUBLAS
+
+#endif // ifndef EL_IMPORTS_CUBLAS_HPP
@@ -26,6 +26,11 @@ void RandomState( gmp_randstate_t randState );
 mpfr_prec_t Precision();
 size_t NumLimbs();
 void SetPrecision( mpfr_prec_t precision );
+// MPFR's default precision is per-thread, so the body of a threaded loop over
+// BigFloat data should adopt the precision of the spawning thread. Unlike
+// SetPrecision, this leaves the (global) MPI datatypes untouched and is only
+// valid for the precision that they were created with.
+void SetThreadPrecision( mpfr_prec_t precision );
 
 int NumIntBits();
 int NumIntLimbs();
@@ -37,6 +42,12 @@ void FreeMPI();
 
 mpfr_rnd_t RoundingMode();
 
+// Destroyed BigFloat's donate their (already initialized) storage to a
+// per-thread free list for their precision, which is drawn upon by the
+// next BigFloat of the same precision. This frees the calling thread's
+// cached storage, e.g., after a change of precision.
+void ReleaseBigFloatPool();
+
 } // namespace mpfr
 
 namespace mpc {
@@ -505,6 +516,13 @@ public:
     const byte* Deserialize( const byte* buf );
 };
 
+// In-place fused updates which round only once and do not form the
+// product as a temporary:
+//   MultiplyAdd:      c := c + a b,
+//   MultiplySubtract: c := c - a b.
+void MultiplyAdd( const BigFloat& a, const BigFloat& b, BigFloat& c );
+void MultiplySubtract( const BigFloat& a, const BigFloat& b, BigFloat& c );
+
 BigFloat operator+( const BigFloat& a, const BigFloat& b );
 BigFloat operator-( const BigFloat& a, const BigFloat& b );
 BigFloat operator*( const BigFloat& a, const BigFloat& b );
@@ -20,10 +20,19 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
 
+#if MPI_VERSION >= 3
+#define EL_HAVE_MPI_SHARED_WINDOWS
+#define EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+#endif
+#if MPI_VERSION >= 4
+#define EL_HAVE_MPI_PERSISTENT_COLLECTIVES
+#endif
+
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
 #define EL_NONBLOCKING_COLL(name) MPI_ ## name
@@ -150,38 +159,163 @@ struct MPIBaseHelper<Entry<T>> { typedef T value; };
 template<typename T>
 using MPIBase = typename MPIBaseHelper<T>::value;
 
+// Since few programs communicate extended-precision data, the datatypes and
+// ops for the DoubleDouble/QuadDouble and Quad families are only created
+// (locally, without communication) upon the first access through the
+// routines below rather than within El::Initialize
+#ifdef EL_HAVE_QD
+extern bool createdQDFamily;
+void CreateQDFamily() EL_NO_RELEASE_EXCEPT;
+#endif
+#ifdef EL_HAVE_QUAD
+extern bool createdQuadFamily;
+void CreateQuadFamily() EL_NO_RELEASE_EXCEPT;
+#endif
+
+template<typename Real>
+struct LazyFamily
+{ static void Ensure() EL_NO_EXCEPT { } };
+#ifdef EL_HAVE_QD
+template<>
+struct LazyFamily<DoubleDouble>
+{
+    static void Ensure() EL_NO_EXCEPT
+    { if( !createdQDFamily ) CreateQDFamily(); }
+};
+template<>
+struct LazyFamily<QuadDouble>
+{
+    static void Ensure() EL_NO_EXCEPT
+    { if( !createdQDFamily ) CreateQDFamily(); }
+};
+#endif
+#ifdef EL_HAVE_QUAD
+template<>
+struct LazyFamily<Quad>
+{
+    static void Ensure() EL_NO_EXCEPT
+    { if( !createdQuadFamily ) CreateQuadFamily(); }
+};
+#endif
+
+template<typename T>
+void EnsureFamily() EL_NO_EXCEPT
+{ LazyFamily<Base<MPIBase<T>>>::Ensure(); }
+
 template<typename T>
 Datatype& TypeMap() EL_NO_EXCEPT
-{ return Types<T>::type; }
+{ EnsureFamily<T>(); return Types<T>::type; }
 
 template<typename T>
-Op& UserOp() { return Types<T>::userOp; }
+Op& UserOp() { EnsureFamily<T>(); return Types<T>::userOp; }
 template<typename T>
-Op& UserCommOp() { return Types<T>::userCommOp; }
+Op& UserCommOp() { EnsureFamily<T>(); return Types<T>::userCommOp; }
 template<typename T>
-Op& SumOp() { return Types<T>::sumOp; }
+Op& SumOp() { EnsureFamily<T>(); return Types<T>::sumOp; }
 template<typename T>
-Op& ProdOp() { return Types<T>::prodOp; }
+Op& ProdOp() { EnsureFamily<T>(); return Types<T>::prodOp; }
 // The following are currently only defined for real datatypes but could 
 // potentially use lexicographic ordering for complex numbers
 template<typename T>
-Op& MaxOp() { return Types<T>::maxOp; }
+Op& MaxOp() { EnsureFamily<T>(); return Types<T>::maxOp; }
 template<typename T>
-Op& MinOp() { return Types<T>::minOp; }
+Op& MinOp() { EnsureFamily<T>(); return Types<T>::minOp; }
 template<typename T>
-Op& MaxLocOp() { return Types<ValueInt<T>>::maxOp; }
+Op& MaxLocOp() { EnsureFamily<T>(); return Types<ValueInt<T>>::maxOp; }
 template<typename T>
-Op& MinLocOp() { return Types<ValueInt<T>>::minOp; }
+Op& MinLocOp() { EnsureFamily<T>(); return Types<ValueInt<T>>::minOp; }
 template<typename T>
-Op& MaxLocPairOp() { return Types<Entry<T>>::maxOp; }
+Op& MaxLocPairOp() { EnsureFamily<T>(); return Types<Entry<T>>::maxOp; }
 template<typename T>
-Op& MinLocPairOp() { return Types<Entry<T>>::minOp; }
+Op& MinLocPairOp() { EnsureFamily<T>(); return Types<Entry<T>>::minOp; }
 
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
 inline int Pad( int count ) EL_NO_EXCEPT
 { return std::max(count,MIN_COLL_MSG); }
 
+// A buffer within an MPI-3 shared-memory window over a node-local
+// communicator. Each process owns an equally-sized portion, and the portions
+// are contiguous, so that the portion of process q begins at Portion(0) plus
+// q times the portion size and may be read directly by its peers.
+//
+// Reserve and Free are collective over the communicator, and the window is
+// only (re)allocated when the requested portion size grows. Without MPI-3
+// (or if the implementation does not provide contiguous portions), Active()
+// is always false.
+class SharedWindow
+{
+public:
+    SharedWindow() EL_NO_EXCEPT;
+
+    bool Reserve( Comm comm, size_t portionBytes ) EL_NO_RELEASE_EXCEPT;
+    bool Active() const EL_NO_EXCEPT { return base_ != nullptr; }
+    size_t PortionBytes() const EL_NO_EXCEPT { return portionBytes_; }
+    byte* Portion( int rank ) const EL_NO_EXCEPT
+    { return base_ + rank*portionBytes_; }
+
+    // Make the local writes to every portion visible to the other processes
+    void Sync( Comm comm ) const EL_NO_RELEASE_EXCEPT;
+
+    void Free() EL_NO_RELEASE_EXCEPT;
+
+private:
+#ifdef EL_HAVE_MPI_SHARED_WINDOWS
+    MPI_Win win_;
+#endif
+    byte* base_;
+    size_t portionBytes_;
+    bool allocated_;
+};
+
+// A file which is collectively opened over a communicator with MPI-IO.
+//
+// ReadAll and WriteAll are collective and transfer the entries of a
+// column-major array of 'entrySize'-byte entries (with the given height and
+// beginning at byte 'offset' of the file) which lie in the given (sorted)
+// rows and columns, into or out of a column-major local buffer with the
+// given leading dimension. The contiguous runs of rows become the blocks of
+// the file view, so that each process only touches its own entries.
+// ReadAt and WriteAt are independent, byte-addressed transfers (e.g., of a
+// header).
+class File
+{
+public:
+    File() EL_NO_EXCEPT;
+    ~File();
+
+    void Open( Comm comm, const std::string& filename, bool write );
+    void Close() EL_NO_RELEASE_EXCEPT;
+    bool IsOpen() const EL_NO_EXCEPT { return open_; }
+
+    long long Size() const EL_NO_RELEASE_EXCEPT;
+    void SetSize( long long numBytes ) EL_NO_RELEASE_EXCEPT;
+
+    void ReadAt
+    ( long long offset, byte* buf, int numBytes ) const EL_NO_RELEASE_EXCEPT;
+    void WriteAt
+    ( long long offset, const byte* buf, int numBytes ) EL_NO_RELEASE_EXCEPT;
+
+    void ReadAll
+    ( long long offset, int entrySize, Int height,
+      const vector<Int>& rows, const vector<Int>& cols,
+      byte* buf, Int ldim ) EL_NO_RELEASE_EXCEPT;
+    void WriteAll
+    ( long long offset, int entrySize, Int height,
+      const vector<Int>& rows, const vector<Int>& cols,
+      const byte* buf, Int ldim ) EL_NO_RELEASE_EXCEPT;
+
+private:
+    MPI_File file_;
+    bool open_;
+
+    void SetView
+    ( long long offset, int entrySize, Int height,
+      const vector<Int>& rows, const vector<Int>& cols, Int ldim,
+      Datatype& entryType, Datatype& memType ) EL_NO_RELEASE_EXCEPT;
+    void ResetView() EL_NO_RELEASE_EXCEPT;
+};
+
 bool CommSameSizeAsInteger() EL_NO_EXCEPT;
 bool GroupSameSizeAsInteger() EL_NO_EXCEPT;
 
@@ -194,6 +328,48 @@ bool Finalized() EL_NO_EXCEPT;
 int QueryThread() EL_NO_EXCEPT;
 void Abort( Comm comm, int errCode ) EL_NO_EXCEPT;
 double Time() EL_NO_EXCEPT;
+
+// Reduced-precision communication
+// -------------------------------
+// An opt-in setting under which the packed AllGather and AllToAll routines
+// (and hence the redistributions built upon them) convert double-precision
+// data to single precision (or, for BFLOAT16_COMM_PRECISION, both double and
+// single-precision data to bfloat16) before sending it and convert it back
+// upon receipt. Integer data is always sent exactly, and the results are only
+// accurate to the reduced precision, so this is only appropriate for
+// computations, such as the corrections within iterative refinement, which
+// tolerate the loss.
+enum CommPrecision
+{
+    FULL_COMM_PRECISION,
+    SINGLE_COMM_PRECISION,
+    BFLOAT16_COMM_PRECISION
+};
+void SetCommPrecision( CommPrecision precision );
+CommPrecision GetCommPrecision();
+
+// Traffic profiling
+// -----------------
+// When enabled, the wrappers below record, for each combination of call site
+// (the innermost entry of the call stack outside of the matrix, memory, and
+// mpi:: routines, which is only available in non-release builds),
+// operation, and communicator, the number of calls, the number of bytes
+// sent by this process (or, for receives, the size of the receive buffer),
+// and the wall time spent within the calls (which, for non-blocking routines,
+// only measures the initiation).
+void EnableTrafficProfiling();
+void DisableTrafficProfiling();
+bool TrafficProfiling();
+void ResetTrafficProfile();
+// Print this process's profile as a JSON object
+void PrintTrafficProfile( std::ostream& os=std::cout );
+// Have Finalize() write each process's profile to the file
+// '<basename>-ProcXXX.json' (this implies EnableTrafficProfiling)
+void EnableTrafficReport( const std::string& basename="El-Traffic" );
+void DisableTrafficReport();
+// Write the report requested via EnableTrafficReport, if any (Finalize()
+// calls this before finalizing MPI)
+void WriteTrafficReport();
 void Create( UserFunction* func, bool commutes, Op& op ) EL_NO_RELEASE_EXCEPT;
 void Free( Op& op ) EL_NO_RELEASE_EXCEPT;
 void Free( Datatype& type ) EL_NO_RELEASE_EXCEPT;
@@ -205,6 +381,9 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into the subcommunicators of processes which can share memory (e.g.,
+// that are on the same node). Without MPI-3, each process is its own node.
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
@@ -217,6 +396,24 @@ void CartCreate
 void CartSub
 ( Comm comm, const int* remainingDims, Comm& subComm ) EL_NO_RELEASE_EXCEPT;
 
+// Distributed graph communicator routines
+// NOTE: These (and the neighborhood collectives) require MPI-3
+// Each process may specify any of the edges: sources[k] has an edge to each of
+// the next degrees[k] entries of 'dests'
+void DistGraphCreate
+( Comm comm, int numSources, const int* sources, const int* degrees,
+  const int* dests, Comm& graphComm ) EL_NO_RELEASE_EXCEPT;
+// Each process specifies exactly its own in and out neighbors
+void DistGraphCreateAdjacent
+( Comm comm, int numSources, const int* sources,
+             int numDests,   const int* dests, Comm& graphComm )
+EL_NO_RELEASE_EXCEPT;
+// The in and out neighbors of this process (in the order used by the
+// neighborhood collectives)
+void DistGraphNeighbors
+( Comm graphComm, vector<int>& sources, vector<int>& dests )
+EL_NO_RELEASE_EXCEPT;
+
 // Group manipulation
 int Rank( Group group ) EL_NO_RELEASE_EXCEPT;
 int Size( Group group ) EL_NO_RELEASE_EXCEPT;
@@ -546,6 +743,8 @@ void Broadcast( T& b, int root, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
 // Non-blocking broadcast
 // ----------------------
+// NOTE: Non-packed datatypes are broadcast in a blocking manner, and the
+//       request is immediately complete
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
 void IBroadcast
 ( Real* buf, int count, int root, Comm comm, Request<Real>& request );
@@ -584,6 +783,8 @@ void Gather
 
 // Non-blocking gather
 // -------------------
+// NOTE: Non-packed datatypes are gathered in a blocking manner, and the
+//       request is immediately complete
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
 void IGather
 ( const Real* sbuf, int sc,
@@ -637,6 +838,26 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+// NOTE: Non-packed datatypes are gathered in a blocking manner, and the
+//       request is immediately complete
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -730,6 +951,128 @@ vector<T> AllToAll
   const vector<int>& sendDispls,
   Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllToAll
+// ---------------------
+// NOTE: Non-packed datatypes are exchanged in a blocking manner, and the
+//       request is immediately complete
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
+// Non-blocking AllToAll with non-uniform send/recv sizes
+// ------------------------------------------------------
+// NOTE: The count and displacement arrays must remain valid until the
+//       request has completed (the doubled arrays needed when avoiding
+//       complex MPI datatypes are held by the request).
+//       Non-packed datatypes are exchanged in a blocking manner, and the
+//       request is immediately complete
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request );
+
+// Neighborhood AllToAll
+// ---------------------
+// Exchange with the neighbors of a distributed graph communicator, where the
+// sends are to the out neighbors and the receives are from the in neighbors
+// (both in the order returned by DistGraphNeighbors)
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void NeighborAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm graphComm ) EL_NO_RELEASE_EXCEPT;
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void NeighborAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm graphComm )
+EL_NO_RELEASE_EXCEPT;
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void NeighborAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm graphComm ) EL_NO_RELEASE_EXCEPT;
+
+// Neighborhood AllToAll with non-uniform send/recv sizes
+// ------------------------------------------------------
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void NeighborAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm graphComm )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void NeighborAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds,
+  Comm graphComm )
+EL_NO_RELEASE_EXCEPT;
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void NeighborAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm graphComm )
+EL_NO_RELEASE_EXCEPT;
+
+// Non-blocking neighborhood AllToAll with non-uniform send/recv sizes
+// -------------------------------------------------------------------
+// NOTE: As with IAllToAll, the count and displacement arrays must remain
+//       valid until the request has completed, and non-packed datatypes are
+//       exchanged in a blocking manner
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void INeighborAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm graphComm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void INeighborAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds,
+  Comm graphComm, Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void INeighborAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm graphComm,
+  Request<T>& request );
+
+// Persistent AllToAll with non-uniform send/recv sizes
+// ----------------------------------------------------
+// Each Start(request) begins an instance of the exchange over the buffers
+// given at initialization, Wait(request) completes it, and Free(request)
+// releases it. Only packed datatypes with MPI-4 support are allowed.
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void AllToAllInit
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds,
+  Comm comm, Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void AllToAllInit
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds,
+  Comm comm, Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void Free( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+
 // Reduce
 // ------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -889,6 +1232,45 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllReduce
+// ----------------------
+// NOTE: Non-packed datatypes are reduced in a blocking manner, and the
+//       request is immediately complete
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request );
+
+// Single-buffer non-blocking AllReduce
+// ------------------------------------
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request );
+
 // ReduceScatter
 // -------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -919,6 +1301,28 @@ template<typename T>
 void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking ReduceScatter
+// --------------------------
+// NOTE: Non-packed datatypes are reduced in a blocking manner, and the
+//       request is immediately complete
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IReduceScatter
+( T* sbuf, T* rbuf, int rc, Op op, Comm comm,
+  Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IReduceScatter
+( T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // Single-buffer ReduceScatter
 // ---------------------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
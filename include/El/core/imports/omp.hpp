@@ -12,6 +12,7 @@
 #ifdef EL_HYBRID
 # include <omp.h>
 # define EL_PARALLEL_FOR _Pragma("omp parallel for")
+# define EL_PARALLEL_FOR_DYNAMIC _Pragma("omp parallel for schedule(dynamic)")
 # ifdef EL_HAVE_OMP_COLLAPSE
 #  define EL_PARALLEL_FOR_COLLAPSE2 _Pragma("omp parallel for collapse(2)")
 # else
@@ -19,6 +20,7 @@
 # endif
 #else
 # define EL_PARALLEL_FOR 
+# define EL_PARALLEL_FOR_DYNAMIC
 # define EL_PARALLEL_FOR_COLLAPSE2
 #endif
 
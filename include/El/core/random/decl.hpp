@@ -99,6 +99,60 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// ======================================
+// The Philox4x32-10 generator of Salmon et al., "Parallel random numbers: as
+// easy as 1, 2, 3", maps a 128-bit counter and a 64-bit key to 128 random
+// bits. Since the counter is formed from the global (i,j) index of an entry
+// and from a stream number which is unique to each random matrix, every entry
+// can be drawn independently: the local entries of a distributed matrix are
+// filled by each process (and thread) without communication, and the result
+// is identical over any process grid.
+namespace philox {
+
+typedef array<std::uint32_t,4> Counter;
+typedef array<std::uint32_t,2> Key;
+
+Counter Philox4x32( Counter counter, const Key& key );
+
+} // namespace philox
+
+// The seed of the counter-based generator, which, unlike the seed of
+// Generator(), is the same on every process
+std::uint64_t CounterSeed();
+void SetCounterSeed( std::uint64_t seed );
+
+// Whether MakeUniform and MakeGaussian use the counter-based generator for
+// float, double, and their complex counterparts (the default)
+bool CounterBasedRandom();
+void SetCounterBasedRandom( bool counterBased );
+
+// A stream number for a sequential random matrix, which is unique to this
+// process (distributed matrices instead use Grid::NextRandomStream so that
+// every process agrees on the stream)
+std::uint64_t NextLocalRandomStream();
+
+// The samples are formed from (at most) 53 random bits per component
+template<typename T>
+struct IsCounterSamplable
+{ static const bool value = std::is_same<Base<T>,float>::value ||
+                            std::is_same<Base<T>,double>::value; };
+
+// Fill the local matrix of an (implicitly) distributed matrix whose
+// (iLoc,jLoc) entry is the global entry
+// (colShift+iLoc*colStride,rowShift+jLoc*rowStride) of random matrix number
+// 'stream'
+template<typename T,typename=EnableIf<IsCounterSamplable<T>>>
+void CounterUniform
+( Matrix<T>& ALoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  std::uint64_t stream, const T& center, const Base<T>& radius );
+template<typename F,typename=EnableIf<IsCounterSamplable<F>>>
+void CounterGaussian
+( Matrix<F>& ALoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  std::uint64_t stream, const F& mean, const Base<F>& stddev );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
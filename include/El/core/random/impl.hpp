@@ -223,6 +223,144 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+namespace philox {
+
+inline Counter Philox4x32( Counter counter, const Key& key )
+{
+    const std::uint32_t mult0=0xD2511F53, mult1=0xCD9E8D57;
+    const std::uint32_t weyl0=0x9E3779B9, weyl1=0xBB67AE85;
+    std::uint32_t key0=key[0], key1=key[1];
+    for( int round=0; round<10; ++round )
+    {
+        const std::uint64_t prod0 = std::uint64_t(mult0)*counter[0];
+        const std::uint64_t prod1 = std::uint64_t(mult1)*counter[2];
+        counter =
+          Counter{{ std::uint32_t(prod1>>32)^counter[1]^key0,
+                    std::uint32_t(prod1),
+                    std::uint32_t(prod0>>32)^counter[3]^key1,
+                    std::uint32_t(prod0) }};
+        key0 += weyl0;
+        key1 += weyl1;
+    }
+    return counter;
+}
+
+} // namespace philox
+
+namespace counter_random {
+
+inline philox::Counter Block( Int i, Int j, std::uint64_t stream )
+{
+    const std::uint64_t iU=i, jU=j;
+    const philox::Counter counter{{
+      std::uint32_t(iU),
+      std::uint32_t(jU),
+      std::uint32_t(stream),
+      std::uint32_t(stream>>32) ^
+      (std::uint32_t(iU>>32)<<16) ^ (std::uint32_t(jU>>32)<<24) }};
+    const std::uint64_t seed = CounterSeed();
+    const philox::Key key{{ std::uint32_t(seed), std::uint32_t(seed>>32) }};
+    return philox::Philox4x32( counter, key );
+}
+
+// A sample from [0,1) (or (0,1] if 'open' is true) with 53 random bits
+inline double Unit( std::uint32_t hi, std::uint32_t lo, bool open=false )
+{
+    const std::uint64_t bits = ((std::uint64_t(hi)<<32) | lo) >> 11;
+    return ( open ? bits+1 : bits ) * (1./9007199254740992.);
+}
+
+template<typename Real>
+void BallSample
+( const philox::Counter& block, const Real& center, const Real& radius,
+  Real& sample )
+{ sample = center + radius*Real(2*Unit(block[0],block[1])-1); }
+
+template<typename Real>
+void BallSample
+( const philox::Counter& block, const Complex<Real>& center,
+  const Real& radius, Complex<Real>& sample )
+{
+    const double r = radius*Unit(block[0],block[1]);
+    const double angle = 2*Pi<double>()*Unit(block[2],block[3]);
+    sample = center + Complex<Real>( Real(r*Cos(angle)), Real(r*Sin(angle)) );
+}
+
+// Box-Muller transforms of the two 53-bit samples of each block
+template<typename Real>
+void NormalSample
+( const philox::Counter& block, const Real& mean, const Real& stddev,
+  Real& sample )
+{
+    const double radius = Sqrt(-2*Log(Unit(block[0],block[1],true)));
+    const double angle = 2*Pi<double>()*Unit(block[2],block[3]);
+    sample = mean + stddev*Real(radius*Cos(angle));
+}
+
+template<typename Real>
+void NormalSample
+( const philox::Counter& block, const Complex<Real>& mean,
+  const Real& stddev, Complex<Real>& sample )
+{
+    const double radius =
+      (stddev/Sqrt(2.))*Sqrt(-2*Log(Unit(block[0],block[1],true)));
+    const double angle = 2*Pi<double>()*Unit(block[2],block[3]);
+    sample =
+      mean + Complex<Real>( Real(radius*Cos(angle)), Real(radius*Sin(angle)) );
+}
+
+template<typename T,typename Param,typename Sampler>
+void Fill
+( Matrix<T>& ALoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  std::uint64_t stream, const T& shift, const Param& scale,
+  Sampler sampler )
+{
+    const Int localHeight = ALoc.Height();
+    const Int localWidth = ALoc.Width();
+    T* ABuf = ALoc.Buffer();
+    const Int ALDim = ALoc.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = rowShift + jLoc*rowStride;
+        T* aCol = &ABuf[jLoc*ALDim];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = colShift + iLoc*colStride;
+            sampler( Block(i,j,stream), shift, scale, aCol[iLoc] );
+        }
+    }
+}
+
+} // namespace counter_random
+
+template<typename T,typename>
+void CounterUniform
+( Matrix<T>& ALoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  std::uint64_t stream, const T& center, const Base<T>& radius )
+{
+    counter_random::Fill
+    ( ALoc, colShift, colStride, rowShift, rowStride, stream, center, radius,
+      []( const philox::Counter& block, const T& center,
+          const Base<T>& radius, T& sample )
+      { counter_random::BallSample( block, center, radius, sample ); } );
+}
+
+template<typename F,typename>
+void CounterGaussian
+( Matrix<F>& ALoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  std::uint64_t stream, const F& mean, const Base<F>& stddev )
+{
+    counter_random::Fill
+    ( ALoc, colShift, colStride, rowShift, rowStride, stream, mean, stddev,
+      []( const philox::Counter& block, const F& mean,
+          const Base<F>& stddev, F& sample )
+      { counter_random::NormalSample( block, mean, stddev, sample ); } );
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
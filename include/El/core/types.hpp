@@ -401,6 +401,16 @@ enum GridOrder
 }
 using namespace GridOrderNS;
 
+// Which of the process grid's communicators should be kept within a node
+namespace GridLayoutNS {
+enum GridLayout
+{
+    NODE_LOCAL_COLS, // [MC] communicators are node-local
+    NODE_LOCAL_ROWS  // [MR] communicators are node-local
+};
+}
+using namespace GridLayoutNS;
+
 namespace LeftOrRightNS {
 enum LeftOrRight
 {
@@ -479,6 +489,38 @@ enum VerticalOrHorizontal
 }
 using namespace VerticalOrHorizontalNS;
 
+namespace NumaPolicyNS {
+enum NumaPolicy
+{
+    NUMA_DEFAULT,    // Leave page placement to the operating system
+    NUMA_INTERLEAVE, // Interleave pages over all online NUMA nodes
+    NUMA_LOCAL       // Bind pages to the node of the allocating thread
+};
+}
+using namespace NumaPolicyNS;
+
+namespace SparseFormatNS {
+enum SparseFormat
+{
+    CSR_FORMAT,  // Compressed Sparse Row (the native format)
+    SELL_FORMAT, // Sliced ELLPACK with sorting windows (SELL-C-sigma)
+    BCSR_FORMAT  // Blocked Compressed Sparse Row
+};
+}
+using namespace SparseFormatNS;
+
+namespace SketchTypeNS {
+enum SketchType
+{
+    GAUSSIAN_SKETCH,    // A dense matrix with i.i.d. standard normal entries
+    SRFT_SKETCH,        // A subsampled randomized (Walsh-)Hadamard transform
+    SPARSE_SIGN_SKETCH, // A fixed number of random signs per row
+    FOURIER_SKETCH,     // A subsampled randomized discrete Fourier transform
+    COUNT_SKETCH        // A single random sign per row
+};
+}
+using namespace SketchTypeNS;
+
 // TODO: Distributed file formats?
 namespace FileFormatNS {
 enum FileFormat
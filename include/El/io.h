@@ -38,6 +38,11 @@ EL_EXPORT ElError ElGetColorMap( ElColorMap* map );
 EL_EXPORT ElError ElSetNumDiscreteColors( ElInt numColors );
 EL_EXPORT ElError ElNumDiscreteColors( ElInt* numColors );
 
+/* Downsampling
+   ============ */
+EL_EXPORT ElError ElSetMaxRenderSize( ElInt maxSize );
+EL_EXPORT ElError ElMaxRenderSize( ElInt* maxSize );
+
 /* Display
    ======= */
 EL_EXPORT ElError ElProcessEvents( int numMsecs );
@@ -37,12 +37,60 @@ ColorMap GetColorMap();
 void SetNumDiscreteColors( Int numColors );
 Int NumDiscreteColors();
 
+// Downsampling
+// ============
+namespace DownsampleModeNS {
+enum DownsampleMode
+{
+    DOWNSAMPLE_DENSITY, // fraction of entries with magnitude greater than tol
+    DOWNSAMPLE_MAX_ABS  // maximum magnitude of the entries
+};
+}
+using namespace DownsampleModeNS;
+
+// Matrices with more than MaxRenderSize() rows or columns are downsampled to
+// at most MaxRenderSize() pixels in each dimension before being displayed,
+// spied, or written as an image (default: 1024)
+void SetMaxRenderSize( Int maxSize );
+Int MaxRenderSize();
+
+// Reduce A to a tile with min(m,mPix) rows and min(n,nPix) columns, where
+// each pixel summarizes a contiguous block of entries of A.
+//
+// In the distributed cases, each process only reduces its local entries and
+// the tiles are then summed (or maxed) onto a single process: the process
+// with rank zero in A.DistComm() and RedundantRank() zero for DistMatrix,
+// and the process with rank zero in A.Comm() otherwise. The tile is
+// unspecified on every other process.
+template<typename T>
+void Downsample
+( const Matrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode=DOWNSAMPLE_DENSITY, Base<T> tol=0 );
+template<typename T>
+void Downsample
+( const AbstractDistMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode=DOWNSAMPLE_DENSITY, Base<T> tol=0 );
+template<typename T>
+void Downsample
+( const DistMultiVec<T>& X, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode=DOWNSAMPLE_DENSITY, Base<T> tol=0 );
+template<typename T>
+void Downsample
+( const SparseMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode=DOWNSAMPLE_DENSITY, Base<T> tol=0 );
+template<typename T>
+void Downsample
+( const DistSparseMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode=DOWNSAMPLE_DENSITY, Base<T> tol=0 );
+
 // Display
 // =======
 void ProcessEvents( int numMsecs );
 
 // Dense
 // -----
+// As with the sparse matrices below, matrices larger than MaxRenderSize() are
+// shown as (progressively rendered) max-abs tiles
 template<typename Real>
 void Display( const Matrix<Real>& A, string title="Matrix" );
 template<typename Real>
@@ -57,12 +105,11 @@ void Display( const DistMultiVec<T>& X, string title="DistMultiVec" );
 void Display( const Graph& graph, string title="Graph" );
 void Display( const DistGraph& graph, string title="DistGraph" );
 
-template<typename Real>
-void Display
-( const SparseMatrix<Real>& A, string title="SparseMatrix" );
-template<typename Real>
-void Display
-( const SparseMatrix<Complex<Real>>& A, string title="SparseMatrix" );
+// Matrices larger than MaxRenderSize() are shown as a max-abs tile; in the
+// distributed cases, the tile is reduced and rendered progressively, one
+// slab of pixel columns at a time
+template<typename T>
+void Display( const SparseMatrix<T>& A, string title="SparseMatrix" );
 template<typename T>
 void Display( const DistSparseMatrix<T>& A, string title="DistSparseMatrix" );
 
@@ -115,11 +162,16 @@ void Print( const vector<T>& x, string title="vector", ostream& os=cout );
 // ====
 template<typename T>
 void Read( Matrix<T>& A, const string filename, FileFormat format=AUTO );
+// Unless 'sequential' is true, the BINARY and BINARY_FLAT formats are read
+// collectively with MPI-IO, with each process reading its own entries
 template<typename T>
 void Read
 ( AbstractDistMatrix<T>& A, 
   const string filename, FileFormat format=AUTO, bool sequential=false );
 
+// Sparse matrices may be read from either the MATRIX_MARKET format or the
+// binary (CSR) format written by WriteSparseBinary, which is selected by
+// BINARY; in the distributed case, each process reads its own rows
 template<typename T>
 void Read
 ( SparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
@@ -127,13 +179,150 @@ template<typename T>
 void Read
 ( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
 
+// Streaming reads of matrices stored in the BINARY format
+// -------------------------------------------------------
+// Only the requested rows, [rowBeg,rowEnd), are read from the file so that
+// matrices which do not fit in memory can be processed in row blocks
+void ReadBinaryDimensions( const string filename, Int& height, Int& width );
+template<typename T>
+void ReadBinaryRows
+( Matrix<T>& A, const string filename, Int rowBeg, Int rowEnd );
+
+// Memory-mapped matrices
+// ======================
+// A read-only matrix which is locked-attached to a (shared, read-only)
+// mapping of a file in the BINARY format (whose header is checked against
+// the size of the file) or the BINARY_FLAT format (given the dimensions),
+// so that no data is copied when it is opened and every process on a node
+// which maps the same file shares its pages through the page cache. The
+// advice is forwarded to madvise. If memory-mapped files are not supported,
+// or the entries of a BINARY file would be misaligned, the matrix is
+// instead read into memory.
+enum MapAdvice
+{
+    ADVISE_NORMAL,
+    ADVISE_SEQUENTIAL,
+    ADVISE_RANDOM,
+    ADVISE_WILLNEED
+};
+
+template<typename T>
+class MappedMatrix
+{
+public:
+    MappedMatrix();
+    explicit MappedMatrix
+    ( const string filename, MapAdvice advice=ADVISE_NORMAL );
+    MappedMatrix
+    ( const string filename, Int height, Int width,
+      MapAdvice advice=ADVISE_NORMAL );
+    ~MappedMatrix();
+
+    MappedMatrix( const MappedMatrix<T>& ) = delete;
+    const MappedMatrix<T>& operator=( const MappedMatrix<T>& ) = delete;
+
+    // Map a BINARY file
+    void Map( const string filename, MapAdvice advice=ADVISE_NORMAL );
+    // Map a BINARY_FLAT file
+    void Map
+    ( const string filename, Int height, Int width,
+      MapAdvice advice=ADVISE_NORMAL );
+    void Unmap();
+    bool Mapped() const EL_NO_EXCEPT { return base_ != nullptr; }
+
+    const El::Matrix<T>& Matrix() const EL_NO_EXCEPT { return A_; }
+
+private:
+    El::Matrix<T> A_;
+    // The copy of the matrix when it could not be mapped
+    El::Matrix<T> copy_;
+    void* base_;
+    size_t numBytes_;
+
+    void MapFile
+    ( const string filename, size_t metaBytes, Int height, Int width,
+      bool header, MapAdvice advice );
+};
+
+// Checkpointing
+// =============
+// A two-generation, per-process checkpoint of the state of an iterative
+// solver. Record makes a deep copy of a named object into the pending
+// snapshot, and Save writes the pending snapshot for the given step to the
+// file '<basename>-<generation>-<rank>.ckpt' (in a background thread if
+// 'async' is true, so that the solver is only delayed by the copies). The
+// generations alternate, and each file is renamed into place once it is
+// complete, so that Load, which is collective, restores the latest step
+// that every process finished saving even if a failure interrupted a save.
+//
+// Distributed matrices are stored as their local data (along with their
+// alignments), and so a run may only be resumed on the same process grid.
+class Checkpoint
+{
+public:
+    explicit Checkpoint
+    ( const string& basename, mpi::Comm comm=mpi::COMM_WORLD );
+    ~Checkpoint();
+
+    Checkpoint( const Checkpoint& ) = delete;
+    const Checkpoint& operator=( const Checkpoint& ) = delete;
+
+    template<typename T>
+    void RecordValue( const string& name, const T& value );
+    template<typename T>
+    void Record( const string& name, const Matrix<T>& A );
+    template<typename T>
+    void Record( const string& name, const AbstractDistMatrix<T>& A );
+    template<typename T>
+    void Record( const string& name, const DistMultiVec<T>& A );
+
+    void Save( Int step, bool async=true );
+    // Block until the background write (if any) has finished
+    void Wait();
+
+    // Returns whether a complete snapshot was found
+    bool Load();
+    Int Step() const EL_NO_EXCEPT { return step_; }
+    bool Has( const string& name ) const;
+
+    template<typename T>
+    void RestoreValue( const string& name, T& value ) const;
+    template<typename T>
+    void Restore( const string& name, Matrix<T>& A ) const;
+    template<typename T>
+    void Restore( const string& name, AbstractDistMatrix<T>& A ) const;
+    template<typename T>
+    void Restore( const string& name, DistMultiVec<T>& A ) const;
+
+private:
+    string basename_;
+    mpi::Comm comm_;
+    Int step_;
+    int nextGeneration_;
+    std::map<string,vector<byte>> pending_, loaded_;
+    std::unique_ptr<std::thread> writer_;
+    string writerError_;
+
+    string Filename( int generation ) const;
+    const vector<byte>& Loaded( const string& name ) const;
+};
+
 // Spy
 // ===
+// Matrices larger than MaxRenderSize() are shown as density tiles, i.e., each
+// pixel is shaded by the fraction of its entries with magnitude above 'tol'
 template<typename T>
 void Spy( const Matrix<T>& A, string title="Matrix", Base<T> tol=0 );
 template<typename T>
 void Spy
 ( const AbstractDistMatrix<T>& A, string title="DistMatrix", Base<T> tol=0 );
+template<typename T>
+void Spy
+( const SparseMatrix<T>& A, string title="SparseMatrix", Base<T> tol=0 );
+template<typename T>
+void Spy
+( const DistSparseMatrix<T>& A, string title="DistSparseMatrix",
+  Base<T> tol=0 );
 
 // Write
 // =====
@@ -141,10 +330,40 @@ template<typename T>
 void Write
 ( const Matrix<T>& A, string basename="Matrix", FileFormat format=BINARY,
   string title="" );
+// The BINARY and BINARY_FLAT formats are written collectively with MPI-IO,
+// whereas the remaining formats are gathered to a single process. Matrices
+// larger than MaxRenderSize() are written to the image formats as max-abs
+// tiles, which are downsampled in place so that only the tile is gathered.
 template<typename T>
 void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
   FileFormat format=BINARY, string title="" );
+// Sparse matrices may only be written as images of their max-abs tiles (see
+// WriteSparseBinary for a lossless format); as with the dense image formats,
+// matrices larger than MaxRenderSize() are downsampled, and, in the
+// distributed case, only the tile is gathered
+template<typename T>
+void Write
+( const SparseMatrix<T>& A, string basename="SparseMatrix",
+  FileFormat format=PNG, string title="" );
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename="DistSparseMatrix",
+  FileFormat format=PNG, string title="" );
+
+// Write a sparse matrix in a versioned binary CSR format (with the BINARY
+// file extension), where, in the distributed case, each process writes its
+// own rows with MPI-IO. If 'symmetric' is true, only the lower triangle is
+// stored, and the matrix is symmetrized (or, if 'conjugate' is also true,
+// made Hermitian) when it is read.
+template<typename T>
+void WriteSparseBinary
+( const SparseMatrix<T>& A, string basename="SparseMatrix",
+  bool symmetric=false, bool conjugate=false );
+template<typename T>
+void WriteSparseBinary
+( const DistSparseMatrix<T>& A, string basename="DistSparseMatrix",
+  bool symmetric=false, bool conjugate=false );
 
 } // namespace El
 
@@ -16,6 +16,54 @@ namespace El {
 // Bidiag
 // ======
 
+struct BidiagCtrl
+{
+    // If enabled (and A is at least as tall as it is wide), A is first
+    // reduced to an upper band matrix of the given bandwidth using level 3
+    // updates, and the bulges of the band matrix are then chased down to
+    // upper bidiagonal form
+    bool twoStage=false;
+    Int bandwidth=32;
+};
+
+namespace bidiag {
+
+// The Householder reflectors generated while chasing an upper band matrix
+// down to bidiagonal form in the second stage of a two-stage reduction.
+// The j'th reflector applied from the left is
+//
+//   H_j = I - householderScalarsQ(j) u_j u_j^H,
+//
+// where u_j = reflectorsQ(0:lengthsQ(j)-1,j) acts upon rows
+// offsetsQ(j),...,offsetsQ(j)+lengthsQ(j)-1, and the j'th reflector applied
+// from the right is
+//
+//   G_j = I - householderScalarsP(j) v_j v_j^H,
+//
+// where v_j = reflectorsP(0:lengthsP(j)-1,j) acts upon columns
+// offsetsP(j),...,offsetsP(j)+lengthsP(j)-1. The band matrix is then
+// Q2 B P2^H, where Q2 = H_0^H H_1^H ... and P2 = G_0 G_1 .... A bandwidth of
+// one signifies that a one-stage reduction was performed, so that there are
+// no such reflectors.
+//
+// NOTE: The reflectors are redundantly stored on each process and require
+//       roughly n^2 entries of memory.
+template<typename F>
+struct BulgeReflectors
+{
+    Int bandwidth=1;
+    Matrix<F> reflectorsQ;
+    Matrix<F> householderScalarsQ;
+    Matrix<Int> offsetsQ;
+    Matrix<Int> lengthsQ;
+    Matrix<F> reflectorsP;
+    Matrix<F> householderScalarsP;
+    Matrix<Int> offsetsP;
+    Matrix<Int> lengthsP;
+};
+
+} // namespace bidiag
+
 // Return the packed reduction to bidiagonal form
 // ----------------------------------------------
 template<typename F>
@@ -34,6 +82,16 @@ void Bidiag
 ( AbstractDistMatrix<F>& A, 
   AbstractDistMatrix<F>& householderScalarsP,
   AbstractDistMatrix<F>& householderScalarsQ );
+// The reflectors from the first stage are stored below the main diagonal of
+// A and above the bandwidth'th superdiagonal (or above the first
+// superdiagonal for a one-stage reduction)
+template<typename F>
+void Bidiag
+( AbstractDistMatrix<F>& A, 
+  AbstractDistMatrix<F>& householderScalarsP,
+  AbstractDistMatrix<F>& householderScalarsQ,
+  bidiag::BulgeReflectors<F>& bulgeReflectors,
+  const BidiagCtrl& ctrl=BidiagCtrl() );
 
 namespace bidiag {
 
@@ -72,6 +130,13 @@ void ApplyQ
   const AbstractDistMatrix<F>& A,
   const AbstractDistMatrix<F>& householderScalars,
         AbstractDistMatrix<F>& B );
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B );
 
 template<typename F>
 void ApplyP
@@ -85,6 +150,13 @@ void ApplyP
   const AbstractDistMatrix<F>& A,
   const AbstractDistMatrix<F>& householderScalars,
         AbstractDistMatrix<F>& B );
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B );
 
 } // namespace bidiag
 
@@ -107,17 +179,60 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<F> symvCtrl;
+
+    // If enabled (and lower-triangular storage is used), A is first reduced
+    // to a band matrix of the given bandwidth using level 3 updates, and the
+    // bulges of the band matrix are then chased down to tridiagonal form
+    bool twoStage=false;
+    Int bandwidth=32;
 };
 
+namespace herm_tridiag {
+
+// The Householder reflectors generated while chasing a Hermitian band matrix
+// down to tridiagonal form in the second stage of a two-stage reduction.
+// The j'th reflector is
+//
+//   I - householderScalars(j) v_j v_j^H,
+//
+// where v_j = reflectors(0:lengths(j)-1,j) acts upon rows
+// offsets(j),...,offsets(j)+lengths(j)-1. A bandwidth of one signifies that
+// a one-stage reduction was performed, so that there are no such reflectors.
+//
+// NOTE: The reflectors are redundantly stored on each process and require
+//       roughly n^2/2 entries of memory.
+template<typename F>
+struct BulgeReflectors
+{
+    Int bandwidth=1;
+    Matrix<F> reflectors;
+    Matrix<F> householderScalars;
+    Matrix<Int> offsets;
+    Matrix<Int> lengths;
+};
+
+} // namespace herm_tridiag
+
 template<typename F>
 void HermitianTridiag
 ( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& householderScalars );
+// NOTE: If ctrl.twoStage is enabled, the reflectors from the second stage are
+//       discarded, and so only the condensed matrix is meaningful
 template<typename F>
 void HermitianTridiag
 ( UpperOrLower uplo,
   AbstractDistMatrix<F>& A,
   AbstractDistMatrix<F>& householderScalars,
   const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
+// The reflectors from the first stage are stored below the -bandwidth'th
+// diagonal of A (or below the first subdiagonal for a one-stage reduction)
+template<typename F>
+void HermitianTridiag
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  herm_tridiag::BulgeReflectors<F>& bulgeReflectors,
+  const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
 
 namespace herm_tridiag {
 
@@ -140,6 +255,25 @@ void ApplyQ
   const AbstractDistMatrix<F>& A,
   const AbstractDistMatrix<F>& householderScalars, 
         AbstractDistMatrix<F>& B );
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B );
+
+// A tile-based variant of the two-stage reduction of a matrix in
+// lower-triangular storage (with a bandwidth equal to the tile size) whose
+// band reduction is dynamically scheduled (as a TaskGraph) over a team of
+// threads. The result is in the same form as that of HermitianTridiag with
+// a two-stage control structure.
+template<typename F>
+void Tiled
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  BulgeReflectors<F>& bulgeReflectors,
+  const TileCtrl& ctrl=TileCtrl() );
 
 } // namespace herm_tridiag
 
@@ -152,6 +286,12 @@ template<typename F>
 void Hessenberg
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A,
   AbstractDistMatrix<F>& householderScalars );
+// A native block-cyclic reduction (currently only for uplo=UPPER) which
+// avoids redistributing the input of a ScaLAPACK HessenbergSchur
+template<typename F>
+void Hessenberg
+( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars );
 
 namespace hessenberg {
 
@@ -159,6 +299,8 @@ template<typename F>
 void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A );
 template<typename F>
 void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A );
+template<typename F>
+void ExplicitCondensed( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A );
 
 template<typename F>
 void ApplyQ
@@ -185,6 +327,13 @@ void FormQ
   const AbstractDistMatrix<F>& A,
   const AbstractDistMatrix<F>& householderScalars, 
         AbstractDistMatrix<F>& Q );
+// Accumulates each panel of reflectors in compact WY form
+template<typename F>
+void FormQ
+( UpperOrLower uplo,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+  const DistMatrix<F,STAR,STAR>& householderScalars,
+        DistMatrix<F,MC,MR,BLOCK>& Q );
 
 } // namespace hessenberg
 
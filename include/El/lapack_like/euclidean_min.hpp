@@ -138,6 +138,207 @@ void Ridge
         Base<F> gamma,                DistMultiVec<F>& X, 
   const LeastSquaresCtrl<Base<F>>& ctrl=LeastSquaresCtrl<Base<F>>() );
 
+// Ridge regression for a sequence of regularization parameters
+// ------------------------------------------------------------
+// The thin SVD op(A) = U Sigma V^H is computed (and kept) once, so that, after
+// forming U^H B, the solution for each gamma,
+//
+//   X(gamma) = V diag(sigma/(sigma^2+gamma^2)) U^H B,
+//
+// only requires a diagonal filter and a single Gemm. Unlike the factored
+// approaches above, both height(op(A)) >= width(op(A)) and
+// height(op(A)) < width(op(A)) are supported.
+template<typename F>
+class RidgeSolver
+{
+public:
+    RidgeSolver();
+    RidgeSolver( Orientation orientation, const Matrix<F>& A );
+
+    void Initialize( Orientation orientation, const Matrix<F>& A );
+
+    void Solve( const Matrix<F>& B, Base<F> gamma, Matrix<F>& X ) const;
+    void Solve
+    ( const Matrix<F>& B,
+      const vector<Base<F>>& gammas,
+            vector<Matrix<F>>& X ) const;
+
+    bool Initialized() const;
+    const Matrix<F>& U() const;
+    const Matrix<Base<F>>& SingularValues() const;
+    const Matrix<F>& V() const;
+
+private:
+    bool initialized_;
+    Matrix<F> U_, V_;
+    Matrix<Base<F>> s_;
+
+    void Filter
+    ( const Matrix<F>& UAdjB, Base<F> gamma, Matrix<F>& X ) const;
+};
+
+template<typename F>
+class DistRidgeSolver
+{
+public:
+    DistRidgeSolver( const Grid& g=Grid::Default() );
+    DistRidgeSolver( Orientation orientation, const ElementalMatrix<F>& A );
+
+    void Initialize( Orientation orientation, const ElementalMatrix<F>& A );
+
+    void Solve
+    ( const ElementalMatrix<F>& B, Base<F> gamma, ElementalMatrix<F>& X ) const;
+    // Each member of X is reconfigured to the grid of A
+    void Solve
+    ( const ElementalMatrix<F>& B,
+      const vector<Base<F>>& gammas,
+            vector<DistMatrix<F>>& X ) const;
+
+    bool Initialized() const;
+    const DistMatrix<F>& U() const;
+    const DistMatrix<Base<F>,VR,STAR>& SingularValues() const;
+    const DistMatrix<F>& V() const;
+
+private:
+    bool initialized_;
+    DistMatrix<F> U_, V_;
+    DistMatrix<Base<F>,VR,STAR> s_;
+
+    void Filter
+    ( const DistMatrix<F>& UAdjB, Base<F> gamma,
+      ElementalMatrix<F>& X ) const;
+};
+
+template<typename F>
+void Ridge
+( Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<Matrix<F>>& X );
+template<typename F>
+void Ridge
+( Orientation orientation,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<DistMatrix<F>>& X );
+
+// The sparse analogue factors the quasi-definite augmented system
+//
+//   | -gammaRef^2 I   W^H | | X |   | -W^H B |
+//   |       W          I  | | R | = |    0   |,
+//
+// with W = op(A), once for a reference parameter, gammaRef, which must not
+// exceed any of the gammas which are later solved for. Writing
+// M = W^H W + gammaRef^2 I and delta = gamma^2 - gammaRef^2, the normal
+// equations (M + delta I) X = W^H B are equivalent to
+//
+//   (inv(M) + (1/delta) I) X = inv(M) W^H B / delta,
+//
+// so that the systems for every gamma > gammaRef are shifts of the single
+// HPD operator inv(M), which is applied through the existing factorization.
+// They are solved simultaneously by a multi-shift Conjugate Gradient method,
+// which performs a single factored solve per iteration for all of the gammas.
+template<typename Real>
+struct RidgeSweepCtrl
+{
+    // A shifted system has converged when its residual norm is at most relTol
+    // times the norm of inv(M) W^H B
+    Real relTol;
+    Int maxIts=1000;
+    // Iterative refinement of the factored solves against the augmented system
+    Int maxRefineIts=2;
+    bool progress=false;
+
+    RidgeSweepCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        relTol = Pow(eps,Real(0.75));
+    }
+};
+
+template<typename F>
+class SparseRidgeSolver
+{
+public:
+    SparseRidgeSolver();
+
+    void Initialize
+    ( Orientation orientation,
+      const SparseMatrix<F>& A,
+      Base<F> gammaRef );
+
+    void Solve
+    ( const Matrix<F>& B,
+      const vector<Base<F>>& gammas,
+            vector<Matrix<F>>& X,
+      const RidgeSweepCtrl<Base<F>>& ctrl=RidgeSweepCtrl<Base<F>>() ) const;
+
+    bool Initialized() const;
+    Base<F> ReferenceGamma() const;
+    const SparseLDLFactorization<F>& Factorization() const;
+
+private:
+    bool initialized_;
+    Base<F> gammaRef_;
+    SparseMatrix<F> W_, J_;
+    SparseLDLFactorization<F> factorization_;
+
+    // X := inv(W^H W + gammaRef^2 I) X
+    void ApplyInverse( Matrix<F>& X, Int maxRefineIts ) const;
+};
+
+template<typename F>
+class DistSparseRidgeSolver
+{
+public:
+    DistSparseRidgeSolver();
+
+    void Initialize
+    ( Orientation orientation,
+      const DistSparseMatrix<F>& A,
+      Base<F> gammaRef );
+
+    // Each member of X is reconfigured to the communicator of A
+    void Solve
+    ( const DistMultiVec<F>& B,
+      const vector<Base<F>>& gammas,
+            vector<DistMultiVec<F>>& X,
+      const RidgeSweepCtrl<Base<F>>& ctrl=RidgeSweepCtrl<Base<F>>() ) const;
+
+    bool Initialized() const;
+    Base<F> ReferenceGamma() const;
+    const DistSparseLDLFactorization<F>& Factorization() const;
+
+private:
+    bool initialized_;
+    Base<F> gammaRef_;
+    DistSparseMatrix<F> W_, J_;
+    DistSparseLDLFactorization<F> factorization_;
+
+    // X := inv(W^H W + gammaRef^2 I) X
+    void ApplyInverse( DistMultiVec<F>& X, Int maxRefineIts ) const;
+};
+
+// The smallest of the gammas is used as the reference parameter
+template<typename F>
+void Ridge
+( Orientation orientation,
+  const SparseMatrix<F>& A,
+  const Matrix<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<Matrix<F>>& X,
+  const RidgeSweepCtrl<Base<F>>& ctrl=RidgeSweepCtrl<Base<F>>() );
+template<typename F>
+void Ridge
+( Orientation orientation,
+  const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<DistMultiVec<F>>& X,
+  const RidgeSweepCtrl<Base<F>>& ctrl=RidgeSweepCtrl<Base<F>>() );
+
 // Tikhonov regularization
 // =======================
 
@@ -232,6 +433,56 @@ void Overwrite
 
 } // namespace lse
 
+// LSE solvers which retain the Generalized RQ factorization of (B,A)
+// ------------------------------------------------------------------
+// The factorization is computed once, after which each call to Solve applies
+// Z^H and Q^H and performs the triangular solves for an entire batch of
+// right-hand sides (C,D) with level-3 operations. The distributed solver also
+// caches the compact-WY representation of Z.
+template<typename F>
+class LSESolver
+{
+public:
+    LSESolver();
+    LSESolver( const Matrix<F>& A, const Matrix<F>& B );
+
+    void Initialize( const Matrix<F>& A, const Matrix<F>& B );
+
+    void Solve( const Matrix<F>& C, const Matrix<F>& D, Matrix<F>& X ) const;
+
+    bool Initialized() const;
+
+private:
+    bool initialized_;
+    Matrix<F> A_, B_;
+    Matrix<F> householderScalarsA_, householderScalarsB_;
+    Matrix<Base<F>> signatureA_, signatureB_;
+};
+
+template<typename F>
+class DistLSESolver
+{
+public:
+    DistLSESolver( const Grid& g=Grid::Default() );
+    DistLSESolver( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B );
+
+    void Initialize( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B );
+
+    void Solve
+    ( const ElementalMatrix<F>& C,
+      const ElementalMatrix<F>& D,
+            ElementalMatrix<F>& X ) const;
+
+    bool Initialized() const;
+
+private:
+    bool initialized_;
+    DistMatrix<F> A_, B_;
+    DistMatrix<F,MD,STAR> householderScalarsA_, householderScalarsB_;
+    DistMatrix<Base<F>,MD,STAR> signatureA_, signatureB_;
+    CompactWY<F> wyA_;
+};
+
 // Generalized (Gauss-Markov) Linear Model
 // =======================================
 // Solve 
@@ -276,6 +527,56 @@ void Overwrite
 
 } // namespace glm
 
+// GLM solvers which retain the Generalized QR factorization of (A,B)
+// ------------------------------------------------------------------
+// The factorization is computed once, after which each call to Solve applies
+// Q^H and Z^H and performs the triangular solves for an entire batch of
+// right-hand sides D with level-3 operations. The distributed solver also
+// caches the compact-WY representation of Q.
+template<typename F>
+class GLMSolver
+{
+public:
+    GLMSolver();
+    GLMSolver( const Matrix<F>& A, const Matrix<F>& B );
+
+    void Initialize( const Matrix<F>& A, const Matrix<F>& B );
+
+    void Solve( const Matrix<F>& D, Matrix<F>& X, Matrix<F>& Y ) const;
+
+    bool Initialized() const;
+
+private:
+    bool initialized_;
+    Matrix<F> A_, B_;
+    Matrix<F> householderScalarsA_, householderScalarsB_;
+    Matrix<Base<F>> signatureA_, signatureB_;
+};
+
+template<typename F>
+class DistGLMSolver
+{
+public:
+    DistGLMSolver( const Grid& g=Grid::Default() );
+    DistGLMSolver( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B );
+
+    void Initialize( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B );
+
+    void Solve
+    ( const ElementalMatrix<F>& D,
+            ElementalMatrix<F>& X,
+            ElementalMatrix<F>& Y ) const;
+
+    bool Initialized() const;
+
+private:
+    bool initialized_;
+    DistMatrix<F> A_, B_;
+    DistMatrix<F,MD,STAR> householderScalarsA_, householderScalarsB_;
+    DistMatrix<Base<F>,MD,STAR> signatureA_, signatureB_;
+    CompactWY<F> wyA_;
+};
+
 // TODO: Generalized Tikhonov regularization
 
 // TODO: Total Least Squares
@@ -18,13 +18,34 @@ namespace El {
 
 // Cholesky
 // ========
+struct CholeskyCtrl
+{
+    bool scalapack=false;
+
+    // If positive, the next diagonal panel is updated first so that its
+    // redistribution can be overlapped (via ICopy) with the remainder of the
+    // trailing update. Depths beyond one are currently treated as one.
+    Int lookAhead=0;
+};
+
 template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A );
 template<typename F>
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack=false );
 template<typename F>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl );
+template<typename F>
 void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A );
+// Factor a block-cyclic matrix in place via ScaLAPACK (see the analogous LU)
+template<typename F>
+void Cholesky( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A );
+// Factor each member of the batch over its own sub-grid
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, DistMatrixBatch<F>& A,
+  const CholeskyCtrl& ctrl=CholeskyCtrl() );
 
 template<typename F>
 void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A );
@@ -59,6 +80,12 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A );
 
 namespace cholesky {
 
+// A tile-based variant which is dynamically scheduled (as a TaskGraph) over
+// a team of threads
+template<typename F>
+void Tiled
+( UpperOrLower uplo, Matrix<F>& A, const TileCtrl& ctrl=TileCtrl() );
+
 template<typename F>
 void SolveAfter
 ( UpperOrLower uplo,
@@ -87,6 +114,34 @@ void SolveAfter
   const DistPermutation& P,
         AbstractDistMatrix<F>& B );
 
+// Estimate norms of inv(A) using an implicit Cholesky factorization
+// -----------------------------------------------------------------
+// See the analogous routines in the 'lu' namespace; the one and infinity
+// norms of the Hermitian inverse coincide.
+template<typename F>
+Base<F> InverseOneNormEstimate
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  Int numVecs=2,
+  Int maxIts=5 );
+template<typename F>
+Base<F> InverseOneNormEstimate
+( UpperOrLower uplo,
+  const ElementalMatrix<F>& A,
+  Int numVecs=2,
+  Int maxIts=5 );
+
+template<typename F>
+Base<F> InverseTwoNormEstimate
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  Int basisSize=15 );
+template<typename F>
+Base<F> InverseTwoNormEstimate
+( UpperOrLower uplo,
+  const ElementalMatrix<F>& A,
+  Int basisSize=15 );
+
 } // namespace cholesky
 
 // LDL
@@ -161,18 +216,58 @@ void LDL
   bool conjugate,
   const LDLPivotCtrl<Base<F>>& ctrl=LDLPivotCtrl<Base<F>>() );
 
+// Return an LDL factorization of a randomized butterfly transformation of A
+// -------------------------------------------------------------------------
+// A recursive butterfly U of depth d is the product of d levels of
+// block-diagonal butterfly matrices, each built from random diagonals (see
+// Parker's "Random butterfly transformations with applications in
+// computational linear algebra" and Baboulin et al.'s "Accelerating linear
+// system solutions using randomization techniques"). With high probability,
+// U^T A U can be safely factored without pivoting, so that the blocked,
+// level-3 unpivoted algorithm applies to symmetric indefinite matrices
+// without any pivot searches. Since U is real, U^T = U^H, and applying U
+// only requires O(d n) flops per vector.
+template<typename Real>
+struct ButterflyTransform
+{
+    // Column l holds the random diagonal of level l, where level 0 is the
+    // single butterfly of the full index range
+    Matrix<Real> diags;
+
+    Int Height() const { return diags.Height(); }
+    Int Depth() const { return diags.Width(); }
+};
+
+// Overwrite A with the unpivoted LDL factorization of U^T A U (the lower
+// triangle of A is referenced) and return the random butterfly U
+template<typename F>
+void LDL
+( Matrix<F>& A,
+  ButterflyTransform<Base<F>>& U,
+  bool conjugate,
+  Int depth=2 );
+template<typename F>
+void LDL
+( ElementalMatrix<F>& A,
+  ButterflyTransform<Base<F>>& U,
+  bool conjugate,
+  Int depth=2 );
+
 // All fronts of L are required to be initialized to the expansions of the 
-// original sparse matrix before calling LDL.
+// original sparse matrix before calling LDL. The BLR control structure is only
+// used by the BLR_LDL_1D and BLR_LDL_2D front types.
 template<typename F>
 void LDL
 ( const ldl::NodeInfo& info,
         ldl::Front<F>& L, 
-  LDLFrontType newType=LDL_2D );
+  LDLFrontType newType=LDL_2D,
+  const ldl::BLRCtrl<Base<F>>& blrCtrl=ldl::BLRCtrl<Base<F>>() );
 template<typename F>
 void LDL
 ( const ldl::DistNodeInfo& info,
         ldl::DistFront<F>& L, 
-  LDLFrontType newType=LDL_2D );
+  LDLFrontType newType=LDL_2D,
+  const ldl::BLRCtrl<Base<F>>& blrCtrl=ldl::BLRCtrl<Base<F>>() );
 
 namespace ldl {
 
@@ -217,6 +312,19 @@ void MultiplyAfter
         ElementalMatrix<F>& B,
   bool conjugated );
 
+// Apply a butterfly transformation (or its transpose) from the left
+// -----------------------------------------------------------------
+template<typename F>
+void ApplyButterfly
+( Orientation orientation,
+  const ButterflyTransform<Base<F>>& U,
+        Matrix<F>& B );
+template<typename F>
+void ApplyButterfly
+( Orientation orientation,
+  const ButterflyTransform<Base<F>>& U,
+        ElementalMatrix<F>& B );
+
 // Solve linear systems using an implicit LDL factorization
 // --------------------------------------------------------
 template<typename F>
@@ -230,6 +338,27 @@ void SolveAfter
         ElementalMatrix<F>& B,
   bool conjugated );
 
+// Solve A X = B using the LDL factorization 'AFact' of U^T A U followed by
+// at most 'maxRefineIts' steps of iterative refinement against the lower
+// triangle of the original matrix A (which compensates for the lack of
+// pivoting); the number of refinement steps is returned
+template<typename F>
+Int SolveAfter
+( const Matrix<F>& A,
+  const Matrix<F>& AFact,
+  const ButterflyTransform<Base<F>>& U,
+        Matrix<F>& B,
+  bool conjugated,
+  Int maxRefineIts=2 );
+template<typename F>
+Int SolveAfter
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& AFact,
+  const ButterflyTransform<Base<F>>& U,
+        ElementalMatrix<F>& B,
+  bool conjugated,
+  Int maxRefineIts=2 );
+
 template<typename F>
 void SolveAfter
 ( const vector<Int>& invMap, const NodeInfo& info,
@@ -265,6 +394,20 @@ Int SolveWithIterativeRefinement
   const DistFront<F>& front, DistMultiVec<F>& y,
   Base<F> relTolRefine, Int maxRefineIts );
 
+// Selected inversion using a sparse LDL factorization
+// ---------------------------------------------------
+// Return the diagonal of inv(A) in the original ordering
+template<typename F>
+void SelectedInversion
+( const vector<Int>& invMap, const NodeInfo& info,
+  const Front<F>& front, Matrix<F>& diagInv );
+// Return the entries of inv(A) within the (symmetric) sparsity pattern of A
+template<typename F>
+void SelectedInversion
+( const SparseMatrix<F>& A,
+  const vector<Int>& invMap, const NodeInfo& info,
+  const Front<F>& front, SparseMatrix<F>& AInv );
+
 // Solve linear system with the implicit representations of L, D, and P
 // --------------------------------------------------------------------
 template<typename F>
@@ -284,6 +427,199 @@ void SolveAfter
 
 } // namespace ldl
 
+// Sparse LDL factorizations which retain their symbolic analysis
+// --------------------------------------------------------------
+// The reordering, the elimination tree, the (reordered) indices used for
+// assembling the fronts, and the metadata for exchanging the child updates
+// and for redistributing the right-hand sides are kept so that matrices with
+// the same sparsity pattern can be refactored (and solved against) while
+// only repeating the numeric work.
+template<typename F>
+class SparseLDLFactorization
+{
+public:
+    SparseLDLFactorization();
+
+    // Reorder and analyze the sparsity pattern of A before factoring it
+    void Initialize
+    ( const SparseMatrix<F>& A,
+      bool hermitian=true,
+      LDLFrontType frontType=LDL_2D,
+      const BisectCtrl& ctrl=BisectCtrl() );
+
+    // Factor a matrix with the same sparsity pattern as in Initialize
+    void Refactor( const SparseMatrix<F>& A );
+
+    void Solve( Matrix<F>& B ) const;
+    Int SolveWithIterativeRefinement
+    ( const SparseMatrix<F>& A,
+            Matrix<F>& B,
+      Base<F> minReductionFactor=Base<F>(2),
+      Int maxRefineIts=10 ) const;
+
+    bool Initialized() const;
+    const ldl::NodeInfo& Info() const;
+    const ldl::Front<F>& Front() const;
+    const vector<Int>& Map() const;
+    const vector<Int>& InverseMap() const;
+
+private:
+    bool initialized_;
+    bool hermitian_;
+    LDLFrontType frontType_;
+    ldl::Separator sep_;
+    ldl::NodeInfo info_;
+    vector<Int> map_, invMap_;
+    ldl::Front<F> front_;
+};
+
+template<typename F>
+class DistSparseLDLFactorization
+{
+public:
+    DistSparseLDLFactorization();
+
+    // Reorder and analyze the sparsity pattern of A before factoring it
+    void Initialize
+    ( const DistSparseMatrix<F>& A,
+      bool hermitian=true,
+      LDLFrontType frontType=LDL_2D,
+      const BisectCtrl& ctrl=BisectCtrl() );
+
+    // Factor a matrix with the same sparsity pattern as in Initialize
+    void Refactor( const DistSparseMatrix<F>& A );
+
+    void Solve( DistMultiVec<F>& B ) const;
+    Int SolveWithIterativeRefinement
+    ( const DistSparseMatrix<F>& A,
+            DistMultiVec<F>& B,
+      Base<F> minReductionFactor=Base<F>(2),
+      Int maxRefineIts=10 ) const;
+
+    bool Initialized() const;
+    const ldl::DistNodeInfo& Info() const;
+    const ldl::DistFront<F>& Front() const;
+    const DistMap& Map() const;
+    const DistMap& InverseMap() const;
+
+private:
+    bool initialized_;
+    bool hermitian_;
+    LDLFrontType frontType_;
+    ldl::DistSeparator sep_;
+    ldl::DistNodeInfo info_;
+    DistMap map_, invMap_;
+    ldl::DistFront<F> front_;
+    vector<Int> mappedSources_, mappedTargets_, colOffs_;
+
+    // Workspace (and its metadata) for redistributing the right-hand sides
+    mutable ldl::DistMultiVecNodeMeta multiVecMeta_;
+    mutable unique_ptr<ldl::DistMultiVecNode<F>> XNodal_;
+};
+
+// Threshold-based incomplete LDL factorizations
+// ---------------------------------------------
+// The matrix is reordered with the same nested dissection as the sparse LDL
+// factorizations and is then factored one column at a time (in Crout order).
+// Each entry of a column of L whose (unscaled) magnitude is below dropTol
+// times the two-norm of the corresponding column of A is discarded, and only
+// the largest fillFactor times as many entries as the column of A has (on and
+// below the diagonal) are kept. Pivots smaller than pivotTol times the column
+// norm are replaced with values of that magnitude so that the factorization
+// cannot break down.
+template<typename Real>
+struct IncompleteLDLCtrl
+{
+    Real dropTol=Real(1)/Real(1000);
+    Real fillFactor=Real(10);
+    Real pivotTol;
+    bool hermitian=true;
+    BisectCtrl bisectCtrl;
+
+    IncompleteLDLCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        pivotTol = Pow(eps,Real(0.5));
+    }
+};
+
+template<typename F>
+class IncompleteLDLFactorization
+{
+public:
+    IncompleteLDLFactorization();
+
+    void Initialize
+    ( const SparseMatrix<F>& A,
+      const IncompleteLDLCtrl<Base<F>>& ctrl=IncompleteLDLCtrl<Base<F>>() );
+
+    // B := inv(P^T L D L^H P) B (or with L^T if the factorization is
+    // symmetric rather than Hermitian)
+    void Solve( Matrix<F>& B ) const;
+
+    // Allow for direct use as a preconditioner for Krylov methods
+    void operator()( Matrix<F>& B ) const { Solve( B ); }
+
+    bool Initialized() const;
+    // The number of (strictly lower-triangular) nonzeros in L
+    Int NumEntries() const;
+
+private:
+    bool initialized_;
+    bool hermitian_;
+    vector<Int> map_, invMap_;
+    // The strictly lower triangle of L in compressed sparse column format
+    vector<Int> colOffs_, rowInds_;
+    vector<F> values_, diag_;
+};
+
+// Block Jacobi preconditioners
+// ----------------------------
+// Each subdomain consists of the rows owned by procsPerSubdomain consecutive
+// processes, and the diagonal block of A corresponding to the subdomain is
+// factored with a sparse LDL factorization over the subdomain's
+// sub-communicator (or, if 'incomplete' is true, which requires a single
+// process per subdomain, with an incomplete LDL factorization). The
+// subdomains do not overlap, so this is also the simplest form of additive
+// Schwarz.
+template<typename Real>
+struct BlockJacobiCtrl
+{
+    Int procsPerSubdomain=1;
+    bool hermitian=true;
+    bool incomplete=false;
+    IncompleteLDLCtrl<Real> incompleteCtrl;
+    BisectCtrl bisectCtrl;
+};
+
+template<typename F>
+class BlockJacobiPreconditioner
+{
+public:
+    BlockJacobiPreconditioner();
+    ~BlockJacobiPreconditioner();
+
+    void Initialize
+    ( const DistSparseMatrix<F>& A,
+      const BlockJacobiCtrl<Base<F>>& ctrl=BlockJacobiCtrl<Base<F>>() );
+
+    // B := inv(blockdiag(A)) B
+    void Solve( DistMultiVec<F>& B ) const;
+
+    // Allow for direct use as a preconditioner for Krylov methods
+    void operator()( DistMultiVec<F>& B ) const { Solve( B ); }
+
+    bool Initialized() const;
+
+private:
+    bool initialized_;
+    bool incomplete_;
+    mpi::Comm subdomainComm_;
+    Int firstSubdomainRow_, subdomainHeight_;
+    unique_ptr<DistSparseLDLFactorization<F>> factorization_;
+    IncompleteLDLFactorization<F> incompleteFactorization_;
+};
+
 // Solve a linear system with a regularized factorization
 // ======================================================
 enum RegSolveAlg
@@ -454,6 +790,72 @@ Int SolveAfter
         ldl::DistMultiVecNodeMeta& meta,
   const RegSolveCtrl<Base<F>>& ctrl );
 
+// Variants of SolveAfter which accept a factorization of the regularized
+// matrix stored in the demoted precision (e.g., single-precision factors of
+// a double-precision matrix, or double-precision factors of a DoubleDouble
+// matrix); the iterative refinement and the outer FGMRES or LGMRES iteration
+// are still performed in the original precision.
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl );
+
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl );
+
 } // namespace reg_ldl
 
 // LU
@@ -468,7 +870,8 @@ enum LUPivotType
     LU_PARTIAL, 
     LU_FULL,
     LU_ROOK, /* not yet supported */
-    LU_WITHOUT_PIVOTING
+    LU_WITHOUT_PIVOTING,
+    LU_TOURNAMENT /* communication-avoiding partial pivoting (CALU) */
 };
 }
 using namespace LUPivotTypeNS;
@@ -484,10 +887,37 @@ void LU( DistMatrix<F,STAR,STAR>& A );
 
 // LU with partial pivoting
 // ------------------------
+struct LUCtrl
+{
+    // Either LU_PARTIAL or LU_TOURNAMENT. The latter selects each panel's
+    // pivots via a reduction tree over the process column rather than with
+    // one AllReduce per column, at the cost of (usually slightly) weaker
+    // stability guarantees.
+    LUPivotType pivot=LU_PARTIAL;
+
+    // If positive, the next panel is updated first so that its
+    // redistribution can be overlapped (via ICopy) with the remainder of the
+    // trailing update. Depths beyond one are currently treated as one.
+    Int lookAhead=0;
+};
+
 template<typename F>
 void LU( Matrix<F>& A, Permutation& P );
 template<typename F>
-void LU( ElementalMatrix<F>& A, DistPermutation& P );
+void LU
+( ElementalMatrix<F>& A, DistPermutation& P, const LUCtrl& ctrl=LUCtrl() );
+// Factor a block-cyclic matrix in place, with the algorithmic blocksize equal
+// to the distribution blocksize, via ScaLAPACK rather than through an
+// element-cyclic redistribution (which is only used as a fallback for
+// datatypes or builds without ScaLAPACK support)
+template<typename F>
+void LU( DistMatrix<F,MC,MR,BLOCK>& A, DistPermutation& P );
+// Factor each member of the batch over its own sub-grid, returning the
+// explicit permutation vectors (see DistPermutation::ExplicitVector) in 'p',
+// which must share the layout of 'A'
+template<typename F>
+void LU
+( DistMatrixBatch<F>& A, DistMatrixBatch<Int>& p, const LUCtrl& ctrl=LUCtrl() );
 
 // LU with full pivoting
 // ---------------------
@@ -524,6 +954,11 @@ void LUMod
 
 namespace lu {
 
+// A tile-based variant of LU with partial pivoting which is dynamically
+// scheduled (as a TaskGraph) over a team of threads
+template<typename F>
+void Tiled( Matrix<F>& A, Permutation& P, const TileCtrl& ctrl=TileCtrl() );
+
 // Solve linear systems using an implicit unpivoted LU factorization
 // -----------------------------------------------------------------
 template<typename F>
@@ -569,6 +1004,51 @@ void SolveAfter
   const DistPermutation& Q,
         ElementalMatrix<F>& B );
 
+// Estimate norms of inv(A) using an implicit partially-pivoted LU
+// ---------------------------------------------------------------
+// Rather than forming inv(A), the one and infinity norms are estimated with
+// the block 1-norm estimator of Higham and Tisseur (using numVecs columns),
+// and the two-norm with basisSize steps of Lanczos on inv(A)^H inv(A), so
+// that each iteration only requires O(n^2) work in solves with the factors.
+// The results are lower bounds which are almost always within a small
+// factor of the true values.
+template<typename F>
+Base<F> InverseOneNormEstimate
+( const Matrix<F>& A,
+  const Permutation& P,
+  Int numVecs=2,
+  Int maxIts=5 );
+template<typename F>
+Base<F> InverseOneNormEstimate
+( const ElementalMatrix<F>& A,
+  const DistPermutation& P,
+  Int numVecs=2,
+  Int maxIts=5 );
+
+template<typename F>
+Base<F> InverseInfinityNormEstimate
+( const Matrix<F>& A,
+  const Permutation& P,
+  Int numVecs=2,
+  Int maxIts=5 );
+template<typename F>
+Base<F> InverseInfinityNormEstimate
+( const ElementalMatrix<F>& A,
+  const DistPermutation& P,
+  Int numVecs=2,
+  Int maxIts=5 );
+
+template<typename F>
+Base<F> InverseTwoNormEstimate
+( const Matrix<F>& A,
+  const Permutation& P,
+  Int basisSize=15 );
+template<typename F>
+Base<F> InverseTwoNormEstimate
+( const ElementalMatrix<F>& A,
+  const DistPermutation& P,
+  Int basisSize=15 );
+
 } // namespace lu
 
 // LQ
@@ -671,6 +1151,34 @@ struct QRCtrl
     // instead, as it is often the case that one may desire a custom pivoting
     // rule.
     bool smallestFirst=false;
+
+    // Choose an entire panel of Blocksize() pivots at once from a Gaussian
+    // sketch of the trailing matrix (as in HQRRP) so that the trailing update
+    // is level-3 rather than selecting each pivot from the updated column
+    // norms. Since the sketch is downdated rather than the column norms,
+    // 'alwaysRecomputeNorms' is ignored, and 'smallestFirst' is not supported.
+    bool randomizedPivoting=false;
+    Int sketchOversample=8;
+};
+
+namespace CholeskyQRVariantNS {
+enum CholeskyQRVariant
+{
+    CHOLESKY_QR,         // A single pass (only stable for well-conditioned A)
+    CHOLESKY_QR2,        // Two passes: reliable up to cond(A) ~ 1/sqrt(eps)
+    SHIFTED_CHOLESKY_QR3 // A shifted pass followed by CholeskyQR2
+};
+}
+using namespace CholeskyQRVariantNS;
+
+template<typename Real>
+struct CholeskyQRCtrl
+{
+    CholeskyQRVariant variant=CHOLESKY_QR;
+
+    // The diagonal shift for the first pass of SHIFTED_CHOLESKY_QR3. If zero,
+    // 11 (m n + n (n+1)) eps || A ||_F^2 is used.
+    Real shift=Real(0);
 };
 
 // Return an implicit representation of Q and R such that A = Q R
@@ -712,6 +1220,15 @@ void QR
 
 namespace qr {
 
+// A tile-based variant of Householder QR which is dynamically scheduled (as a
+// TaskGraph) over a team of threads
+template<typename F>
+void Tiled
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  const TileCtrl& ctrl=TileCtrl() );
+
 // Apply Q using its implicit representation
 // -----------------------------------------
 template<typename F>
@@ -731,6 +1248,17 @@ void ApplyQ
   const ElementalMatrix<Base<F>>& signature,
         ElementalMatrix<F>& B );
 
+// Apply Q using a cached compact-WY representation of its reflectors, i.e.,
+// CompactWY<F>( 0, A, householderScalars ), which amortizes the formation and
+// redistribution of the Householder panels over many applications
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const CompactWY<F>& wy,
+  const ElementalMatrix<Base<F>>& signature,
+        ElementalMatrix<F>& B );
+
 // Solve a linear system with the implicit QR factorization
 // --------------------------------------------------------
 template<typename F>
@@ -754,9 +1282,15 @@ void SolveAfter
 // Cholesky-based QR
 // -----------------
 template<typename F>
-void Cholesky( Matrix<F>& A, Matrix<F>& R );
+void Cholesky
+( Matrix<F>& A,
+  Matrix<F>& R,
+  const CholeskyQRCtrl<Base<F>>& ctrl=CholeskyQRCtrl<Base<F>>() );
 template<typename F>
-void Cholesky( ElementalMatrix<F>& A, ElementalMatrix<F>& R );
+void Cholesky
+( ElementalMatrix<F>& A,
+  ElementalMatrix<F>& R,
+  const CholeskyQRCtrl<Base<F>>& ctrl=CholeskyQRCtrl<Base<F>>() );
 
 // Return R (with non-negative diagonal) such that A = Q R or A Omega^T = Q R
 // --------------------------------------------------------------------------
@@ -831,6 +1365,61 @@ void DisjointNeighborColSwaps
         Matrix<F>& R,
   const Matrix<Int>& colSwaps );
 
+// Update a full QR factorization, A = Q R, with Q square, after inserting or
+// deleting rows or columns of A
+// --------------------------------------------------------------------------
+template<typename F>
+void InsertRows
+(       Matrix<F>& Q,
+        Matrix<F>& R,
+        Int i,
+  const Matrix<F>& B );
+template<typename F>
+void InsertRows
+(       ElementalMatrix<F>& Q,
+        ElementalMatrix<F>& R,
+        Int i,
+  const ElementalMatrix<F>& B );
+
+template<typename F>
+void DeleteRows
+( Matrix<F>& Q,
+  Matrix<F>& R,
+  Int i,
+  Int numRows=1 );
+template<typename F>
+void DeleteRows
+( ElementalMatrix<F>& Q,
+  ElementalMatrix<F>& R,
+  Int i,
+  Int numRows=1 );
+
+template<typename F>
+void InsertCols
+(       Matrix<F>& Q,
+        Matrix<F>& R,
+        Int j,
+  const Matrix<F>& C );
+template<typename F>
+void InsertCols
+(       ElementalMatrix<F>& Q,
+        ElementalMatrix<F>& R,
+        Int j,
+  const ElementalMatrix<F>& C );
+
+template<typename F>
+void DeleteCols
+( Matrix<F>& Q,
+  Matrix<F>& R,
+  Int j,
+  Int numCols=1 );
+template<typename F>
+void DeleteCols
+( ElementalMatrix<F>& Q,
+  ElementalMatrix<F>& R,
+  Int j,
+  Int numCols=1 );
+
 template<typename F>
 struct TreeData
 {
@@ -871,6 +1460,13 @@ struct TreeData
 template<typename F>
 TreeData<F> TS( const ElementalMatrix<F>& A );
 
+// Overwrite 'treeData' with an implicit tall-skinny QR factorization of A.
+// When 'treeData' was produced from a matrix of the same shape and
+// distribution (e.g., by a previous iteration of a solver), all of its
+// storage is reused rather than reallocated.
+template<typename F>
+void TS( const ElementalMatrix<F>& A, TreeData<F>& treeData );
+
 // Return an explicit tall-skinny QR factorization
 template<typename F>
 void ExplicitTS( ElementalMatrix<F>& A, ElementalMatrix<F>& R );
@@ -888,6 +1484,13 @@ const Matrix<F>& RootQR
 template<typename F>
 void Reduce( const ElementalMatrix<F>& A, TreeData<F>& treeData );
 
+// Factor the local block of A and then run the tree reduction, leaving the
+// root's stacked pair of triangles unfactored so that it may be operated on
+// directly (e.g., by an SVD) before the result is sent back down the tree
+// via Scatter. The storage of 'treeData' is reused as in TS.
+template<typename F>
+void Refactor( const ElementalMatrix<F>& A, TreeData<F>& treeData );
+
 template<typename F>
 void Scatter( ElementalMatrix<F>& A, const TreeData<F>& treeData );
 
@@ -1060,6 +1663,101 @@ void Skeleton
         ElementalMatrix<F>& Z,
   const QRCtrl<Base<F>>& ctrl=QRCtrl<Base<F>>() );
 
+// Randomized low-rank approximation
+// =================================
+// See Halko, Martinsson, and Tropp's "Finding structure with randomness:
+// Probabilistic algorithms for constructing approximate matrix
+// decompositions" and Martinsson and Tropp's "Randomized numerical linear
+// algebra: Foundations & algorithms".
+
+template<typename Real>
+struct RandomizedCtrl
+{
+    SketchType sketch=GAUSSIAN_SKETCH;
+
+    // The sketch is of size rank+oversample (truncated to the dimensions of
+    // the matrix)
+    Int oversample=10;
+
+    // The number of applications of (A A^H) used to sharpen the decay of the
+    // singular values; each is preceded by a re-orthonormalization
+    Int numPowerIts=1;
+
+    // The number of nonzeros per row of a sparse sign embedding
+    Int sparsity=8;
+
+    bool progress=false;
+};
+
+// Return Y := A Omega, where Omega is a random n x sketchSize embedding
+// ---------------------------------------------------------------------
+template<typename F>
+void Sketch
+( const Matrix<F>& A,
+        Matrix<F>& Y,
+        Int sketchSize,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+template<typename F>
+void Sketch
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& Y,
+        Int sketchSize,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+
+// Return an orthonormal Q whose range approximates that of A's dominant
+// rank-'rank' subspace
+// ---------------------------------------------------------------------
+template<typename F>
+void RangeFinder
+( const Matrix<F>& A,
+        Matrix<F>& Q,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+template<typename F>
+void RangeFinder
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& Q,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+
+// Return an approximation A ~= U diag(s) V^H of the given rank
+// ------------------------------------------------------------
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+template<typename F>
+void RandomizedSVD
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& U,
+        ElementalMatrix<Base<F>>& s,
+        ElementalMatrix<F>& V,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+
+// Return an interpolative decomposition of (at most) the given rank whose
+// column pivots are chosen by a pivoted QR of a row sketch, S A, rather than
+// of A itself
+// --------------------------------------------------------------------------
+template<typename F>
+void RandomizedID
+( const Matrix<F>& A,
+        Permutation& P,
+        Matrix<F>& Z,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+template<typename F>
+void RandomizedID
+( const ElementalMatrix<F>& A,
+        DistPermutation& P,
+        ElementalMatrix<F>& Z,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+
 } // namespace El
 
 #include <El/lapack_like/factor/qr/ProxyHouseholder.hpp>
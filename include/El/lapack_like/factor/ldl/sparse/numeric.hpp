@@ -35,7 +35,8 @@ enum LDLFrontType
   LDL_INTRAPIV_1D,        LDL_INTRAPIV_2D,
   LDL_INTRAPIV_SELINV_1D, LDL_INTRAPIV_SELINV_2D,
   BLOCK_LDL_1D,           BLOCK_LDL_2D,
-  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D
+  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D,
+  BLR_LDL_1D,             BLR_LDL_2D
 };
 
 bool Unfactored( LDLFrontType type );
@@ -43,6 +44,7 @@ bool FrontIs1D( LDLFrontType type );
 bool BlockFactorization( LDLFrontType type );
 bool SelInvFactorization( LDLFrontType type );
 bool PivotedFactorization( LDLFrontType type );
+bool BLRFactorization( LDLFrontType type );
 LDLFrontType ConvertTo2D( LDLFrontType type );
 LDLFrontType ConvertTo1D( LDLFrontType type );
 LDLFrontType AppendSelInv( LDLFrontType type );
@@ -51,6 +53,23 @@ LDLFrontType InitialFactorType( LDLFrontType type );
 
 namespace ldl {
 
+// Control structure for the block low-rank (BLR) compression of the fronts of
+// a BLR_LDL_1D or BLR_LDL_2D factorization
+template<typename Real>
+struct BLRCtrl
+{
+    // Fronts with fewer than this many rows are factored without compression
+    Int minFrontSize=512;
+
+    // The (maximum) height and width of the tiles of each front
+    Int tileSize=128;
+
+    // Each tile below the diagonal is truncated once the remaining column
+    // norms of its pivoted QR factorization fall below 'tol' times its largest
+    // column norm
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+};
+
 template<typename T>
 struct DistMatrixNode;
 template<typename T>
@@ -73,9 +73,63 @@ void NaturalNestedDissection
         Int cutoff,
         bool storeFactRecvInds=false );
 
+// Merge small supernodes into their parents according to the amalgamation
+// parameters of the BisectCtrl. The resulting trees must be (re)analyzed.
+void Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl );
+void Amalgamate
+( DistSeparator& rootSep, DistNodeInfo& rootInfo, const BisectCtrl& ctrl );
+
 void BuildMap( const Separator& rootSep, vector<Int>& map );
 void BuildMap( const DistSeparator& rootSep, DistMap& map );
 
+// Save the output of NestedDissection so that it may be reloaded (e.g., for
+// another matrix with the same sparsity pattern) rather than recomputed.
+// Loading rebuilds the map and reruns the symbolic analysis. The distributed
+// variants write one file per process, "<basename>.<rank>.nd", and must be
+// reloaded over the same number of processes.
+void SaveNestedDissection
+( const string& filename,
+  const Separator& rootSep,
+  const NodeInfo& rootInfo );
+void LoadNestedDissection
+( const string& filename,
+        vector<Int>& map,
+        Separator& rootSep,
+        NodeInfo& rootInfo );
+void SaveNestedDissection
+( const string& basename,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo );
+void LoadNestedDissection
+( const string& basename,
+        mpi::Comm comm,
+        DistMap& map,
+        DistSeparator& rootSep,
+        DistNodeInfo& rootInfo,
+        bool storeFactRecvInds=true );
+
+// Predictions of the cost of factoring with an analyzed elimination tree.
+// The nonzero and flop counts are for real fields (and ignore pivoting), the
+// largest front counts the entries of both its factor and its update matrix,
+// and the peak update storage is that of the memory-bounded schedule of the
+// sequential subtree(s).
+struct SymbolicSummary
+{
+    Int numNodes;
+    double numNonzeros;
+    double factorFlops;
+    double maxFrontEntries;
+    double peakUpdateEntries;
+
+    SymbolicSummary()
+    : numNodes(0), numNonzeros(0), factorFlops(0), maxFrontEntries(0),
+      peakUpdateEntries(0)
+    { }
+};
+SymbolicSummary Summarize( const NodeInfo& rootInfo );
+SymbolicSummary Summarize( const DistNodeInfo& rootInfo );
+
 } // namespace ldl
 } // namespace El
 
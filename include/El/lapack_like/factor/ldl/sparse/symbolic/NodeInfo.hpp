@@ -35,6 +35,15 @@ struct NodeInfo
     // (maps from the child update indices to our frontal indices).
     vector<vector<Int>> childRelInds;
 
+    // Memory-bounded scheduling of the numeric factorization: the order in
+    // which to process the children, whether the update matrix of this node
+    // is allocated before processing them (so that each child's update can
+    // be assembled and freed immediately), and the resulting peak number of
+    // update-matrix entries simultaneously held while processing the subtree
+    vector<Int> childOrder;
+    bool assembleEagerly;
+    double peakUpdateEntries;
+
     // Symbolic analysis for modification of SuiteSparse LDL
     // -----------------------------------------------------
     // NOTE: These are only used within leaf nodes
@@ -42,7 +51,8 @@ struct NodeInfo
     vector<Int> LParents;
 
     NodeInfo( NodeInfo* parentNode=nullptr )
-    : parent(parentNode), duplicate(nullptr)
+    : parent(parentNode), duplicate(nullptr),
+      assembleEagerly(true), peakUpdateEntries(0)
     { }
 
     NodeInfo( DistNodeInfo* duplicateNode );
@@ -113,7 +123,8 @@ struct DistNodeInfo
 };
 
 inline NodeInfo::NodeInfo( DistNodeInfo* duplicateNode )
-: parent(nullptr), duplicate(duplicateNode)
+: parent(nullptr), duplicate(duplicateNode),
+  assembleEagerly(true), peakUpdateEntries(0)
 {
     size = duplicate->size;
     off = duplicate->off;
@@ -23,6 +23,25 @@ enum SignScaling {
 }
 using namespace SignScalingNS;
 
+namespace SignMethodNS {
+enum SignMethod {
+    // Newton's method, which forms an explicit inverse in each iteration
+    SIGN_NEWTON,
+    // Newton's method until || I - X^2 || is estimated to be small, followed
+    // by the inverse-free (Gemm-only) Newton-Schulz iteration
+    SIGN_NEWTON_SCHULZ,
+    // Iterated Zolotarev rational approximants, each of which requires a
+    // handful of independent shifted solves, followed by Newton-Schulz. Only
+    // appropriate for real spectra, and, since X^2 is formed, for condition
+    // numbers well below the inverse of the square-root of the unit roundoff
+    SIGN_ZOLOTAREV,
+    // Choose between Newton-Schulz and Zolotarev using estimates of the
+    // two-norms of the matrix and its inverse
+    SIGN_AUTO
+};
+}
+using namespace SignMethodNS;
+
 template<typename Real>
 struct SignCtrl 
 {
@@ -31,8 +50,25 @@ struct SignCtrl
     Real power=1;
     SignScaling scaling=SIGN_SCALE_FROB;
     bool progress=false;
+
+    SignMethod method=SIGN_NEWTON;
+    // Switch from Newton to Newton-Schulz once || I - X^2 ||_1 is estimated
+    // to be below this (it must be less than one for convergence)
+    Real newtonSchulzThreshold=Real(1)/Real(2);
+    // The number of shifted solves per Zolotarev iteration; zero selects the
+    // smallest number for which two iterations suffice
+    Int zolotarevDegree=0;
+    // Whether the eigenvalues are known to be real, without which SIGN_AUTO
+    // will not select Zolotarev iterations
+    bool realSpectrum=false;
+    // The smallest estimated condition number for which SIGN_AUTO will select
+    // Zolotarev iterations
+    Real zolotarevCondition=Real(100);
 };
 
+// The square-root is computed via the sign of [0, A; I, 0], and so the same
+// methods are available (SIGN_NEWTON corresponds to the original, uncoupled
+// Newton iteration)
 template<typename Real>
 struct SquareRootCtrl 
 {
@@ -40,8 +76,62 @@ struct SquareRootCtrl
     Real tol=0;
     Real power=1;
     bool progress=false;
+
+    SignMethod method=SIGN_NEWTON;
+    Real newtonSchulzThreshold=Real(1)/Real(2);
+    Int zolotarevDegree=0;
+    // Whether the eigenvalues are known to be real and positive
+    bool realSpectrum=false;
+    Real zolotarevCondition=Real(100);
+};
+
+template<typename Real>
+struct ExpMultiplyCtrl
+{
+    // The maximum number of blocks in each Krylov basis
+    Int basisSize=30;
+    Int maxSteps=1000;
+    // Zero selects the square-root of the unit roundoff
+    Real tol=0;
+    // Only orthogonalize against the previous two blocks (block Lanczos)
+    bool hermitian=false;
+    bool progress=false;
 };
 
+template<typename Real>
+struct ExpMultiplyInfo
+{
+    Int numSteps=0;
+    Int numRejections=0;
+    Real errorEst=0;
+};
+
+// Exponential
+// ===========
+// Overwrite A with exp(A) using scaling and squaring of a Pade approximant
+// (Higham's 2005 algorithm)
+template<typename F>
+void Exp( Matrix<F>& A );
+template<typename F>
+void Exp( ElementalMatrix<F>& A );
+
+// Overwrite B with exp(t A) B by taking adaptive time steps, each of which
+// projects exp onto a block Krylov subspace generated from the current B
+template<typename F>
+ExpMultiplyInfo<Base<F>>
+ExpMultiply
+( F t,
+  const Matrix<F>& A,
+        Matrix<F>& B,
+  const ExpMultiplyCtrl<Base<F>>& ctrl=ExpMultiplyCtrl<Base<F>>() );
+template<typename F>
+ExpMultiplyInfo<Base<F>>
+ExpMultiply
+( F t,
+  const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& B,
+  const ExpMultiplyCtrl<Base<F>>& ctrl=ExpMultiplyCtrl<Base<F>>() );
+
 // Hermitian function
 // ==================
 template<typename F>
@@ -78,6 +168,13 @@ template<typename F>
 void AfterLUPartialPiv
 (       ElementalMatrix<F>& A,
   const DistPermutation& P );
+// In-place, blocked Gauss-Jordan elimination with partial pivoting, which
+// only requires workspace for a single panel (Inverse still defaults to
+// the LU-based approach)
+template<typename F>
+void GaussJordan( Matrix<F>& A );
+template<typename F>
+void GaussJordan( ElementalMatrix<F>& A );
 } // namespace inverse
 
 template<typename F>
@@ -68,6 +68,7 @@ inline PermutationMeta CReflect( const ElPermutationMeta& metaC )
         vector<int>( metaC.recvIdx, metaC.recvIdx+metaC.numRecvIdx );
     meta.recvRanks =
         vector<int>( metaC.recvRanks, metaC.recvRanks+metaC.numRecvIdx );
+    meta.FormPlan();
 
     return meta;
 }
@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PERM_CYCLES_HPP
+#define EL_PERM_CYCLES_HPP
+
+namespace El {
+
+// The cycle decomposition of a permutation of the rows (or columns) of a
+// matrix, which allows the permutation to be applied in place rather than
+// through copies of each row (or column) that moves. Cycle c visits the
+// indices inds[offs[c]:offs[c+1]), each of which receives the row (column) of
+// the next index of the cycle (and the last receives that of the first).
+struct PermutationCycles
+{
+    vector<Int> offs, inds;
+
+    PermutationCycles() : offs(1,0) { }
+
+    Int NumCycles() const { return offs.size()-1; }
+
+    // Form the cycles of the permutation which moves index sources[k] to
+    // index dests[k] for each k < numMoves (and fixes all other indices),
+    // where the moves must permute the set of indices which they involve
+    void Form( Int numMoves, const Int* sources, const Int* dests )
+    {
+        DEBUG_CSE
+        Int size = 0;
+        for( Int k=0; k<numMoves; ++k )
+            size = Max( size, Max(sources[k],dests[k])+1 );
+        // source[i] is the index whose row (column) moves to index i
+        vector<Int> source( size, -1 );
+        for( Int k=0; k<numMoves; ++k )
+            source[dests[k]] = sources[k];
+
+        offs.assign( 1, 0 );
+        inds.clear();
+        vector<bool> visited( size, false );
+        for( Int i=0; i<size; ++i )
+        {
+            if( visited[i] || source[i] < 0 || source[i] == i )
+                continue;
+            Int j = i;
+            do
+            {
+                DEBUG_ONLY(
+                  if( source[j] < 0 )
+                      LogicError("The moves did not form a permutation");
+                )
+                visited[j] = true;
+                inds.push_back( j );
+                j = source[j];
+            } while( j != i );
+            offs.push_back( inds.size() );
+        }
+    }
+};
+
+// Apply the permutation (or its inverse) to the rows of A; since each column
+// is permuted independently, no workspace is required
+template<typename T>
+void ApplyCyclesToRows
+( const PermutationCycles& cycles, Matrix<T>& A, bool inverse=false )
+{
+    DEBUG_CSE
+    const Int numCycles = cycles.NumCycles();
+    const Int* offs = cycles.offs.data();
+    const Int* inds = cycles.inds.data();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        T* col = &ABuf[j*ALDim];
+        for( Int c=0; c<numCycles; ++c )
+        {
+            const Int beg = offs[c];
+            const Int end = offs[c+1];
+            if( inverse )
+            {
+                const T last = col[inds[end-1]];
+                for( Int t=end-1; t>beg; --t )
+                    col[inds[t]] = col[inds[t-1]];
+                col[inds[beg]] = last;
+            }
+            else
+            {
+                const T first = col[inds[beg]];
+                for( Int t=beg; t<end-1; ++t )
+                    col[inds[t]] = col[inds[t+1]];
+                col[inds[end-1]] = first;
+            }
+        }
+    }
+}
+
+// Apply the permutation (or its inverse) to the columns of A using a single
+// column of workspace per thread, as distinct cycles are independent
+template<typename T>
+void ApplyCyclesToCols
+( const PermutationCycles& cycles, Matrix<T>& A, bool inverse=false )
+{
+    DEBUG_CSE
+    const Int numCycles = cycles.NumCycles();
+    const Int* offs = cycles.offs.data();
+    const Int* inds = cycles.inds.data();
+    const Int m = A.Height();
+    if( m == 0 )
+        return;
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    Int numChunks = 1;
+#ifdef EL_HYBRID
+    numChunks = Max( Min( Int(omp_get_max_threads()), numCycles ), Int(1) );
+#endif
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        vector<T> workspace( m );
+        const Int cBeg = (chunk*numCycles) / numChunks;
+        const Int cEnd = ((chunk+1)*numCycles) / numChunks;
+        for( Int c=cBeg; c<cEnd; ++c )
+        {
+            const Int beg = offs[c];
+            const Int end = offs[c+1];
+            if( inverse )
+            {
+                MemCopy( workspace.data(), &ABuf[inds[end-1]*ALDim], m );
+                for( Int t=end-1; t>beg; --t )
+                    MemCopy
+                    ( &ABuf[inds[t]*ALDim], &ABuf[inds[t-1]*ALDim], m );
+                MemCopy( &ABuf[inds[beg]*ALDim], workspace.data(), m );
+            }
+            else
+            {
+                MemCopy( workspace.data(), &ABuf[inds[beg]*ALDim], m );
+                for( Int t=beg; t<end-1; ++t )
+                    MemCopy
+                    ( &ABuf[inds[t]*ALDim], &ABuf[inds[t+1]*ALDim], m );
+                MemCopy( &ABuf[inds[end-1]*ALDim], workspace.data(), m );
+            }
+        }
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_PERM_CYCLES_HPP
@@ -11,6 +11,8 @@
 
 #include <map>
 
+#include <El/lapack_like/perm/Cycles.hpp>
+
 namespace El {
 
 struct PermutationMeta
@@ -25,6 +27,14 @@ struct PermutationMeta
     vector<int> sendIdx, sendRanks,
                 recvIdx, recvRanks;
 
+    // The exchange plan: the position of each send (recv) within the packed
+    // send (recv) buffer, in units of a single row or column
+    vector<int> sendOffs, recvOffs;
+
+    // If the communicator consists of a single process, the exchange is
+    // instead applied in place by following the cycles of the permutation
+    PermutationCycles cycles;
+
     int TotalSend() const { return sendCounts.back()+sendDispls.back(); }
     int TotalRecv() const { return recvCounts.back()+recvDispls.back(); }
 
@@ -63,6 +73,9 @@ struct PermutationMeta
             Int permAlign,
             mpi::Comm permComm );
 
+    // Form sendOffs, recvOffs, and cycles from the remaining members
+    void FormPlan();
+
     void Update
     ( const DistMatrix<Int,STAR,STAR>& p,
       const DistMatrix<Int,STAR,STAR>& pInv,
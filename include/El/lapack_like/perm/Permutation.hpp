@@ -9,6 +9,8 @@
 #ifndef EL_PERM_PERMUTATION_HPP
 #define EL_PERM_PERMUTATION_HPP
 
+#include <El/lapack_like/perm/Cycles.hpp>
+
 namespace El {
 
 class Permutation
@@ -114,6 +116,13 @@ private:
     mutable Matrix<Int> invPerm_;
     mutable bool staleInverse_=true;
 
+    // The cycle decomposition of perm_, which is used to apply general
+    // permutations in place
+    mutable PermutationCycles cycles_;
+    mutable bool staleCycles_=true;
+
+    const PermutationCycles& Cycles() const;
+
     friend class DistPermutation;
 };
 
@@ -43,6 +43,29 @@ Base<F> TwoCondition( const Matrix<F>& A );
 template<typename F>
 Base<F> TwoCondition( const ElementalMatrix<F>& A );
 
+// Condition number estimates
+// --------------------------
+// These factor A once (with partial pivoting) and then combine the norm of A
+// with an estimate of the norm of inv(A) which only requires solves with the
+// factors (see lu::InverseOneNormEstimate); the two-norm of A is also
+// estimated with Lanczos. When a factorization is already available, the
+// 'lu' and 'cholesky' routines should be called directly.
+template<typename F>
+Base<F> OneConditionEstimate( const Matrix<F>& A );
+template<typename F>
+Base<F> OneConditionEstimate( const ElementalMatrix<F>& A );
+
+template<typename F>
+Base<F> InfinityConditionEstimate( const Matrix<F>& A );
+template<typename F>
+Base<F> InfinityConditionEstimate( const ElementalMatrix<F>& A );
+
+template<typename F>
+Base<F> TwoConditionEstimate( const Matrix<F>& A, Int basisSize=15 );
+template<typename F>
+Base<F> TwoConditionEstimate
+( const ElementalMatrix<F>& A, Int basisSize=15 );
+
 // Determinant
 // ===========
 template<typename F>
@@ -89,6 +112,42 @@ template<typename F>
 Base<F> HPDDeterminant
 ( UpperOrLower uplo, ElementalMatrix<F>& A, bool canOverwrite=false );
 
+// Sparse Hermitian positive-definite matrices are factored with a sparse LDL^H
+// factorization (see SparseLDLFactorization), and the determinant is read off
+// of the diagonals of the fronts. A nonzero rho is only returned if every
+// pivot was positive.
+template<typename F>
+SafeProduct<Base<F>> SafeHPDDeterminant
+( const SparseMatrix<F>& A, const BisectCtrl& ctrl=BisectCtrl() );
+template<typename F>
+SafeProduct<Base<F>> SafeHPDDeterminant
+( const DistSparseMatrix<F>& A, const BisectCtrl& ctrl=BisectCtrl() );
+
+// Stochastic Lanczos quadrature
+// -----------------------------
+// When even a sparse factorization of an HPD matrix is too expensive, its
+// log-determinant, trace(log(A)), can be estimated from the Gauss quadrature
+// rules for z^H log(A) z generated by a few steps of Lanczos started from
+// each of several Rademacher probe vectors z. See Ubaru, Chen, and Saad's
+// "Fast estimation of tr(f(A)) via stochastic Lanczos quadrature",
+// SIAM J. Matrix Anal. Appl., 38(4), 2017.
+struct LanczosQuadratureCtrl
+{
+    Int numProbes=30;
+    // The number of Lanczos steps (and quadrature nodes) per probe
+    Int numSteps=30;
+    bool progress=false;
+};
+
+template<typename F>
+Base<F> HPDLogDeterminantEstimate
+( const SparseMatrix<F>& A,
+  const LanczosQuadratureCtrl& ctrl=LanczosQuadratureCtrl() );
+template<typename F>
+Base<F> HPDLogDeterminantEstimate
+( const DistSparseMatrix<F>& A,
+  const LanczosQuadratureCtrl& ctrl=LanczosQuadratureCtrl() );
+
 namespace hpd_det {
 
 template<typename F>
@@ -109,6 +168,14 @@ template<typename F>
 SafeProduct<F> AfterLUPartialPiv
 ( const ElementalMatrix<F>& A, const DistPermutation& P );
 
+// The determinant of a sparse symmetric or Hermitian matrix from the (possibly
+// intra-front pivoted) diagonal blocks of its sparse LDL factorization
+template<typename F>
+SafeProduct<F> AfterLDL( const ldl::NodeInfo& info, const ldl::Front<F>& front );
+template<typename F>
+SafeProduct<F> AfterLDL
+( const ldl::DistNodeInfo& info, const ldl::DistFront<F>& front );
+
 } // namespace det
 
 // Inertia
@@ -455,6 +522,70 @@ Base<F> SymmetricTwoNormEstimate
 ( UpperOrLower uplo, const ElementalMatrix<F>& A, 
   Base<F> tol=1e-6, Int maxIts=1000 );
 
+// Partial-SVD bounds on unitarily-invariant norms
+// -----------------------------------------------
+// The leading singular values are approximated by those of B := Q^H A, where
+// Q is an orthonormal basis from RangeFinder, so that only O(m n r) work is
+// required for a sketch of rank r. Since these are Ritz values, they are
+// lower bounds on the true singular values. With tail := || A - Q B ||_F,
+// Weyl's inequality implies that sigma_i(A) <= sigma_i(B) + tail and that the
+// squares of the singular values not captured by B sum to at most tail^2,
+// which yields the upper bounds.
+template<typename Real>
+struct NormBounds
+{
+    Real lower=0;
+    Real upper=0;
+};
+
+// Ky Fan (p,k) norms use a sketch of rank k
+template<typename F>
+NormBounds<Base<F>> KyFanSchattenNormBounds
+( const Matrix<F>& A, Int k, Base<F> p,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+template<typename F>
+NormBounds<Base<F>> KyFanSchattenNormBounds
+( const ElementalMatrix<F>& A, Int k, Base<F> p,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+
+template<typename F>
+NormBounds<Base<F>> KyFanNormBounds
+( const Matrix<F>& A, Int k,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+template<typename F>
+NormBounds<Base<F>> KyFanNormBounds
+( const ElementalMatrix<F>& A, Int k,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+
+// Schatten norms are bounded using a sketch of the given rank, and the bounds
+// are only tight when A is numerically of at most that rank
+template<typename F>
+NormBounds<Base<F>> SchattenNormBounds
+( const Matrix<F>& A, Base<F> p, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+template<typename F>
+NormBounds<Base<F>> SchattenNormBounds
+( const ElementalMatrix<F>& A, Base<F> p, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+
+template<typename F>
+NormBounds<Base<F>> NuclearNormBounds
+( const Matrix<F>& A, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+template<typename F>
+NormBounds<Base<F>> NuclearNormBounds
+( const ElementalMatrix<F>& A, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+
+template<typename F>
+NormBounds<Base<F>> TwoNormBounds
+( const Matrix<F>& A, Int rank=1,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+template<typename F>
+NormBounds<Base<F>> TwoNormBounds
+( const ElementalMatrix<F>& A, Int rank=1,
+  const RandomizedCtrl<Base<F>>& ctrl=RandomizedCtrl<Base<F>>() );
+
 // Trace
 // =====
 template<typename T>
@@ -31,6 +31,58 @@ void ApplyPackedReflectors
   const AbstractDistMatrix<F>& householderScalars, 
         AbstractDistMatrix<F>& A );
 
+// Compact-WY representations of packed reflectors
+// ------------------------------------------------
+// ApplyPackedReflectors forms the explicit Householder vectors of each panel,
+// redistributes them, and reduces their Gram matrix on every call. When the
+// same reflectors are applied many times (e.g., by qr::ApplyQ to successive
+// batches of right-hand sides), CompactWY instead forms the panels and their
+// Gram matrices once and lazily caches their [MC,STAR] and [MR,STAR]
+// redistributions for left and right applications. Each panel aggregates
+// 'aggregation' of the panels of width Blocksize() used by
+// ApplyPackedReflectors into a single WY block so that fewer, larger
+// reductions are performed.
+//
+// Only the LOWER VERTICAL storage format (e.g., that of QR) is supported, and
+// Apply( side, order, conjugation, A ) is equivalent to
+// ApplyPackedReflectors( side, LOWER, VERTICAL, order, conjugation, offset,
+// H, householderScalars, A ).
+template<typename F>
+class CompactWY
+{
+public:
+    CompactWY() { }
+    CompactWY
+    ( Int offset,
+      const AbstractDistMatrix<F>& H,
+      const AbstractDistMatrix<F>& householderScalars,
+      Int aggregation=4 );
+
+    Int Height() const { return height_; }
+    Int NumReflectors() const { return householderScalars_.Height(); }
+    Int Blocksize() const { return blocksize_; }
+
+    void Apply
+    ( LeftOrRight side,
+      ForwardOrBackward order,
+      Conjugation conjugation,
+      AbstractDistMatrix<F>& A ) const;
+
+private:
+    Int height_=0, blocksize_=0, iOff_=0;
+    Matrix<F> householderScalars_;
+
+    // The explicit Householder vectors of each panel, restricted to the rows
+    // beginning with the panel's diagonal, and their (full) Gram matrices
+    vector<DistMatrix<F,VC,STAR>> panels_;
+    vector<Matrix<F>> grams_;
+
+    // The panels redistributed (and aligned) for applications to [MC,MR]
+    // matrices with zero alignments
+    mutable vector<DistMatrix<F,MC,STAR>> panels_MC_STAR_;
+    mutable vector<DistMatrix<F,MR,STAR>> panels_MR_STAR_;
+};
+
 // ExpandPackedReflectors
 // ======================
 template<typename F>
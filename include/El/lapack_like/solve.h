@@ -50,6 +50,25 @@ EL_EXPORT ElError ElLinearSolveDistSparse_c
 EL_EXPORT ElError ElLinearSolveDistSparse_z
 ( ElConstDistSparseMatrix_z A, ElDistMultiVec_z B );
 
+/* Batches of small, dense systems
+   ------------------------------- */
+EL_EXPORT ElError ElLinearSolveBatch_s
+( ElInt numProblems, ElInt n, ElInt numRHS,
+  const float* A, ElInt ALDim, ElInt AStride,
+        float* B, ElInt BLDim, ElInt BStride );
+EL_EXPORT ElError ElLinearSolveBatch_d
+( ElInt numProblems, ElInt n, ElInt numRHS,
+  const double* A, ElInt ALDim, ElInt AStride,
+        double* B, ElInt BLDim, ElInt BStride );
+EL_EXPORT ElError ElLinearSolveBatch_c
+( ElInt numProblems, ElInt n, ElInt numRHS,
+  const complex_float* A, ElInt ALDim, ElInt AStride,
+        complex_float* B, ElInt BLDim, ElInt BStride );
+EL_EXPORT ElError ElLinearSolveBatch_z
+( ElInt numProblems, ElInt n, ElInt numRHS,
+  const complex_double* A, ElInt ALDim, ElInt AStride,
+        complex_double* B, ElInt BLDim, ElInt BStride );
+
 /* Expert versions
    --------------- */
 EL_EXPORT ElError ElLinearSolveXSparse_s
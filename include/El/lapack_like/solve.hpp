@@ -40,6 +40,21 @@ void Overwrite( Matrix<F>& A, Matrix<F>& B );
 template<typename F>
 void Overwrite( ElementalMatrix<F>& A, ElementalMatrix<F>& B );
 
+// Factor A in the lower precision Demote<F> (e.g., float for double and
+// double for DoubleDouble) and recover a working-precision solution with
+// GMRES-based iterative refinement, where each correction equation is solved
+// by FGMRES preconditioned with the low-precision factorization. If there is
+// no lower precision, this is equivalent to LinearSolve. The maximum number
+// of refinement steps over the columns of B is returned.
+template<typename F>
+Int MixedPrecision
+( const Matrix<F>& A, Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl=RegSolveCtrl<Base<F>>() );
+template<typename F>
+Int MixedPrecision
+( const ElementalMatrix<F>& A, ElementalMatrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl=RegSolveCtrl<Base<F>>() );
+
 } // namespace lin_solve
 
 // Hermitian
@@ -155,8 +170,99 @@ void Overwrite
 ( UpperOrLower uplo, Orientation orientation,
   ElementalMatrix<F>& A, ElementalMatrix<F>& B );
 
+// The HPD analogue of lin_solve::MixedPrecision, using a Cholesky
+// factorization in the precision Demote<F>
+template<typename F>
+Int MixedPrecision
+( UpperOrLower uplo, Orientation orientation,
+  const Matrix<F>& A, Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl=RegSolveCtrl<Base<F>>() );
+template<typename F>
+Int MixedPrecision
+( UpperOrLower uplo, Orientation orientation,
+  const ElementalMatrix<F>& A, ElementalMatrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl=RegSolveCtrl<Base<F>>() );
+
 } // namespace hpd_solve
 
+// Cauchy-like
+// ===========
+// A Cauchy-like matrix A satisfies the displacement equation
+//
+//   diag(x) A - A diag(y) = G H^T,
+//
+// with x[i] != y[j], so that A(i,j) = G(i,:) H(j,:)^T / (x[i]-y[j]) is
+// determined by its n x r generators (e.g., r=1, G=r, and H=s for CauchyLike).
+// Since row interchanges preserve this structure, as do Schur complements, the
+// Gohberg-Kailath-Olshevsky (GKO) algorithm forms P A = L U with partial
+// pivoting by eliminating on the generators in O(r n^2) work. The factors are
+// returned in the format of LU( A, P ), so that lu::SolveAfter applies.
+template<typename F>
+void CauchyLikeLU
+( const Matrix<F>& G, const Matrix<F>& H,
+  const vector<F>& x, const vector<F>& y,
+  Matrix<F>& A, Permutation& P );
+
+template<typename F>
+void CauchyLikeSolve
+( const Matrix<F>& G, const Matrix<F>& H,
+  const vector<F>& x, const vector<F>& y,
+  Matrix<F>& B );
+
+// Toeplitz
+// ========
+// Overwrite B with the solution of T X = B, where T(i,j) = a[i-j+(n-1)], as in
+// Toeplitz. With Z_phi the down-shift whose top-right entry is phi,
+// Z_1 T - T Z_{-1} has rank at most two, and Z_1 and Z_{-1} are respectively
+// diagonalized by the DFT and a diagonally-scaled DFT. T is thus unitarily
+// equivalent to a (complex) Cauchy-like matrix whose generators are formed with
+// FFTs, and the Cauchy-like system is solved in O(n^2) work with GKO.
+template<typename F>
+void ToeplitzSolve( const vector<F>& a, Matrix<F>& B );
+
+// Kronecker sums
+// ==============
+// Overwrite the nB x nA matrix X with the solution of
+//
+//   (A \oplus B) vec(X) = vec(C),  i.e.,  B X + X A^T = C,
+//
+// where A and B are Hermitian, via their eigendecompositions
+// A = Z_A diag(w_A) Z_A^H and B = Z_B diag(w_B) Z_B^H, which reduce the system
+// to the diagonal one diag(w_B) Y + Y diag(w_A) = Z_B^H C conj(Z_A), with
+// X = Z_B Y Z_A^T. Only the uplo triangles of A and B are accessed. When
+// several systems involving the same factors are to be solved, the
+// eigendecompositions can be computed once and passed in instead.
+// A SingularMatrixException is thrown if w_B(i) + w_A(j) = 0 for some (i,j).
+// General (non-Hermitian) Kronecker sums are Sylvester operators and may be
+// solved with Sylvester.
+template<typename F>
+void KroneckerSumSolve
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X );
+template<typename F>
+void KroneckerSumSolve
+( UpperOrLower uplo,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+        ElementalMatrix<F>& X );
+
+template<typename F>
+void KroneckerSumSolve
+( const Matrix<Base<F>>& wA,
+  const Matrix<F>& ZA,
+  const Matrix<Base<F>>& wB,
+  const Matrix<F>& ZB,
+        Matrix<F>& X );
+template<typename F>
+void KroneckerSumSolve
+( const ElementalMatrix<Base<F>>& wA,
+  const ElementalMatrix<F>& ZA,
+  const ElementalMatrix<Base<F>>& wB,
+  const ElementalMatrix<F>& ZB,
+        ElementalMatrix<F>& X );
+
 // Multi-shift Hessenberg
 // ======================
 template<typename F>
@@ -170,10 +276,76 @@ void MultiShiftHessSolve
   F alpha, const ElementalMatrix<F>& H, const ElementalMatrix<F>& shifts,
   ElementalMatrix<F>& X );
 
+// Preconditioned Krylov solvers
+// =============================
+enum KrylovSolveAlg
+{
+  KRYLOV_CG,
+  KRYLOV_MINRES,
+  KRYLOV_GMRES,
+  KRYLOV_BICGSTAB
+};
+
+template<typename Real>
+struct KrylovSolveCtrl
+{
+    KrylovSolveAlg alg=KRYLOV_GMRES;
+    // A right-hand side has converged when its residual norm is at most
+    // relTol times its norm (MINRES measures both in the norm induced by the
+    // inverse of the preconditioner)
+    Real relTol;
+    Int maxIts=1000;
+    Int restart=30;
+    // Whether CG and GMRES should overlap their (single) reduction per
+    // iteration with the application of the preconditioner and operator
+    bool pipelined=true;
+    bool progress=false;
+
+    KrylovSolveCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        relTol = Pow(eps,Real(0.5));
+    }
+};
+
+struct KrylovSolveInfo
+{
+    Int numIts=0;
+    Int numConverged=0;
+};
+
+// Overwrite B with the solutions of A X = B, using zero initial guesses
+template<typename F>
+KrylovSolveInfo KrylovSolve
+( const SparseMatrix<F>& A,
+        Matrix<F>& B,
+  const KrylovSolveCtrl<Base<F>>& ctrl=KrylovSolveCtrl<Base<F>>() );
+template<typename F>
+KrylovSolveInfo KrylovSolve
+( const DistSparseMatrix<F>& A,
+        DistMultiVec<F>& B,
+  const KrylovSolveCtrl<Base<F>>& ctrl=KrylovSolveCtrl<Base<F>>() );
+
+// Precondition with an existing factorization of a nearby matrix (e.g., a
+// regularized or lower-precision version of A)
+template<typename F>
+KrylovSolveInfo KrylovSolve
+( const SparseMatrix<F>& A,
+  const SparseLDLFactorization<F>& factorization,
+        Matrix<F>& B,
+  const KrylovSolveCtrl<Base<F>>& ctrl=KrylovSolveCtrl<Base<F>>() );
+template<typename F>
+KrylovSolveInfo KrylovSolve
+( const DistSparseMatrix<F>& A,
+  const DistSparseLDLFactorization<F>& factorization,
+        DistMultiVec<F>& B,
+  const KrylovSolveCtrl<Base<F>>& ctrl=KrylovSolveCtrl<Base<F>>() );
+
 } // namespace El
 
 #include <El/lapack_like/solve/FGMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
+#include <El/lapack_like/solve/Krylov.hpp>
 
 #endif // ifndef EL_SOLVE_HPP
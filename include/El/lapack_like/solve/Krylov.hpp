@@ -0,0 +1,1469 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_KRYLOV_HPP
+#define EL_SOLVE_KRYLOV_HPP
+
+// Preconditioned Krylov solvers for A X = B which only access the operator
+// through applyA( X, Y ), i.e., Y := A X, and the preconditioner through
+// precond( X ), i.e., X := inv(M) X, so that both may be matrix-free.
+//
+// Each right-hand side has its own (independent) recurrence, but the operator
+// and preconditioner are always applied to the entire block of vectors and the
+// inner products of all of the columns are combined into a single reduction.
+// The pipelined variants of CG and GMRES only perform a single, non-blocking,
+// reduction per iteration, which is overlapped with an application of the
+// preconditioner and operator. They are (respectively) due to
+//
+//   P. Ghysels and W. Vanroose,
+//   "Hiding global synchronization latency in the preconditioned Conjugate
+//    Gradient algorithm", Parallel Computing, Vol. 40, No. 7, 2014,
+//
+// and
+//
+//   P. Ghysels, T.J. Ashby, K. Meerbergen, and W. Vanroose,
+//   "Hiding global communication latency in the GMRES algorithm on massively
+//    parallel machines", SIAM J. Sci. Comput., Vol. 35, No. 1, 2013.
+//
+// The cores operate on the local rows of the vectors, with the inner products
+// summed over 'comm', so that both Matrix and DistMultiVec are supported.
+
+namespace El {
+
+namespace krylov_solve {
+
+// dots(j,k) := X(:,j)^H Y(:,j), summed over only the local rows
+template<typename F>
+void LocalColumnDots
+( const Matrix<F>& X,
+  const Matrix<F>& Y,
+        Matrix<F>& dots,
+        Int k )
+{
+    const Int height = X.Height();
+    for( Int j=0; j<X.Width(); ++j )
+        dots(j,k) =
+          blas::Dot
+          ( height, X.LockedBuffer(0,j), 1, Y.LockedBuffer(0,j), 1 );
+}
+
+template<typename F>
+void SumDots( Matrix<F>& dots, mpi::Comm comm )
+{ AllReduce( dots, comm ); }
+
+// A non-blocking version of SumDots which is completed by FinishDots. Since
+// the reduction is still in flight between the two calls, a padded 'dots' is
+// reduced within 'packed' and only unpacked by FinishDots.
+template<typename F>
+void StartDots
+( Matrix<F>& dots, vector<F>& packed,
+  mpi::Comm comm, mpi::Request<F>& request )
+{
+    packed.clear();
+    if( mpi::Size(comm) == 1 )
+        return;
+    const Int height = dots.Height();
+    const Int width = dots.Width();
+    if( dots.LDim() == height )
+    {
+        mpi::IAllReduce( dots.Buffer(), height*width, comm, request );
+        return;
+    }
+    packed.resize( height*width );
+    copy::util::InterleaveMatrix
+    ( height, width,
+      dots.LockedBuffer(), 1, dots.LDim(),
+      packed.data(),       1, height );
+    mpi::IAllReduce( packed.data(), height*width, comm, request );
+}
+
+template<typename F>
+void FinishDots
+( Matrix<F>& dots, const vector<F>& packed,
+  mpi::Comm comm, mpi::Request<F>& request )
+{
+    if( mpi::Size(comm) == 1 )
+        return;
+    mpi::Wait( request );
+    if( !packed.empty() )
+        copy::util::InterleaveMatrix
+        ( dots.Height(), dots.Width(),
+          packed.data(), 1, dots.Height(),
+          dots.Buffer(), 1, dots.LDim() );
+}
+
+// Y(:,j) += alpha(j) X(:,j)
+template<typename F>
+void ColumnAxpy( const Matrix<F>& alpha, const Matrix<F>& X, Matrix<F>& Y )
+{
+    const Int height = X.Height();
+    for( Int j=0; j<X.Width(); ++j )
+        if( alpha(j) != F(0) )
+            blas::Axpy
+            ( height, alpha(j), X.LockedBuffer(0,j), 1, Y.Buffer(0,j), 1 );
+}
+
+// Y(:,j) := X(:,j) + beta(j) Y(:,j)
+template<typename F>
+void ColumnXpby( const Matrix<F>& X, const Matrix<F>& beta, Matrix<F>& Y )
+{
+    const Int height = X.Height();
+    for( Int j=0; j<X.Width(); ++j )
+    {
+        const F betaj = beta(j);
+        if( betaj == F(0) )
+        {
+            for( Int i=0; i<height; ++i )
+                Y(i,j) = X(i,j);
+        }
+        else
+        {
+            for( Int i=0; i<height; ++i )
+                Y(i,j) = X(i,j) + betaj*Y(i,j);
+        }
+    }
+}
+
+// R := B - A X
+template<typename F,class ApplyAType>
+void Residual
+( const ApplyAType& applyA,
+  const Matrix<F>& B,
+  const Matrix<F>& X,
+        Matrix<F>& R )
+{
+    applyA( X, R );
+    R *= F(-1);
+    Axpy( F(1), B, R );
+}
+
+// Set targets(j) := relTol || B(:,j) ||_2 (or, if M is non-null, the norm
+// induced by inv(M)), and mark the columns with a zero right-hand side as
+// inactive after zeroing their solutions.
+template<typename F,class PrecondType>
+Int Targets
+( const PrecondType* precond,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+        Base<F> relTol,
+        Matrix<Base<F>>& targets,
+        vector<bool>& active,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int width = B.Width();
+    Matrix<F> dots;
+    Zeros( dots, width, 1 );
+    if( precond == nullptr )
+    {
+        LocalColumnDots( B, B, dots, 0 );
+    }
+    else
+    {
+        auto MInvB( B );
+        (*precond)( MInvB );
+        LocalColumnDots( B, MInvB, dots, 0 );
+    }
+    SumDots( dots, comm );
+
+    Int numActive = 0;
+    targets.Resize( width, 1 );
+    active.resize( width );
+    for( Int j=0; j<width; ++j )
+    {
+        const Real bNormSq = RealPart(dots(j));
+        if( bNormSq < Real(0) )
+            RuntimeError("The preconditioner was not HPD");
+        targets(j) = relTol*Sqrt(bNormSq);
+        active[j] = ( bNormSq > Real(0) );
+        if( active[j] )
+            ++numActive;
+        else
+        {
+            auto x = X( ALL, IR(j) );
+            Zero( x );
+        }
+    }
+    return numActive;
+}
+
+// Deactivate each active column whose residual norm, given by the square root
+// of residNormsSq(j,k), has met its target (or is not finite), and return the
+// number of columns which remain active
+template<typename F>
+Int Converge
+( const Matrix<F>& residNormsSq,
+        Int k,
+  const Matrix<Base<F>>& targets,
+        vector<bool>& active,
+        KrylovSolveInfo& info,
+        bool progress,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int width = targets.Height();
+    Int numActive = 0;
+    Real maxRelResid = 0;
+    for( Int j=0; j<width; ++j )
+    {
+        if( !active[j] )
+            continue;
+        const Real residNorm =
+          Sqrt(Max(RealPart(residNormsSq(j,k)),Real(0)));
+        if( !limits::IsFinite(residNorm) )
+        {
+            active[j] = false;
+            continue;
+        }
+        maxRelResid = Max( maxRelResid, residNorm/(targets(j)) );
+        if( residNorm <= targets(j) )
+        {
+            active[j] = false;
+            ++info.numConverged;
+        }
+        else
+            ++numActive;
+    }
+    if( progress )
+        OutputFromRoot
+        (comm,"iteration ",info.numIts,": ",numActive," active, max ",
+         "residual norm relative to its target: ",maxRelResid);
+    return numActive;
+}
+
+// Preconditioned Conjugate Gradient for HPD A and M
+template<typename F,class ApplyAType,class PrecondType>
+KrylovSolveInfo CG
+( mpi::Comm comm,
+  const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    KrylovSolveInfo info;
+    Matrix<Real> targets;
+    vector<bool> active;
+    const PrecondType* noPrecond = nullptr;
+    Targets( noPrecond, B, X, ctrl.relTol, targets, active, comm );
+
+    Matrix<F> R, U, P, S;
+    Residual( applyA, B, X, R );
+    U = R;
+    precond( U );
+    Zeros( P, height, width );
+
+    Matrix<F> dots, delta, alpha, beta, gammaOld;
+    Zeros( dots, width, 2 );
+    Zeros( delta, width, 1 );
+    Zeros( alpha, width, 1 );
+    Zeros( beta, width, 1 );
+    Zeros( gammaOld, width, 1 );
+    while( true )
+    {
+        // gamma := (r,u) and || r ||_2^2
+        LocalColumnDots( R, U, dots, 0 );
+        LocalColumnDots( R, R, dots, 1 );
+        SumDots( dots, comm );
+        const Int numActive =
+          Converge( dots, 1, targets, active, info, ctrl.progress, comm );
+        if( numActive == 0 || info.numIts >= ctrl.maxIts )
+            break;
+
+        // p := u + beta p
+        for( Int j=0; j<width; ++j )
+        {
+            beta(j) = 0;
+            if( active[j] && info.numIts > 0 )
+                beta(j) = dots(j,0)/gammaOld(j);
+            gammaOld(j) = dots(j,0);
+        }
+        ColumnXpby( U, beta, P );
+
+        // s := A p and alpha := gamma / (p,s)
+        applyA( P, S );
+        LocalColumnDots( P, S, delta, 0 );
+        SumDots( delta, comm );
+        for( Int j=0; j<width; ++j )
+        {
+            alpha(j) = 0;
+            if( active[j] )
+            {
+                if( delta(j) == F(0) )
+                    active[j] = false;
+                else
+                    alpha(j) = gammaOld(j)/delta(j);
+            }
+        }
+
+        // x := x + alpha p, r := r - alpha s, u := inv(M) r
+        ColumnAxpy( alpha, P, X );
+        alpha *= F(-1);
+        ColumnAxpy( alpha, S, R );
+        U = R;
+        precond( U );
+        ++info.numIts;
+    }
+    return info;
+}
+
+// The pipelined preconditioned Conjugate Gradient method of Ghysels and
+// Vanroose, which overlaps the reduction for (r,u), (w,u), and (r,r) with the
+// computation of m := inv(M) w and n := A m, where u = inv(M) r and w = A u
+template<typename F,class ApplyAType,class PrecondType>
+KrylovSolveInfo PipelinedCG
+( mpi::Comm comm,
+  const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    KrylovSolveInfo info;
+    Matrix<Real> targets;
+    vector<bool> active;
+    const PrecondType* noPrecond = nullptr;
+    Targets( noPrecond, B, X, ctrl.relTol, targets, active, comm );
+
+    Matrix<F> R, U, W, M, N, P, S, Q, Z;
+    Residual( applyA, B, X, R );
+    U = R;
+    precond( U );
+    applyA( U, W );
+    Zeros( P, height, width );
+    Zeros( S, height, width );
+    Zeros( Q, height, width );
+    Zeros( Z, height, width );
+
+    Matrix<F> dots, alpha, beta, gammaOld, alphaOld;
+    Zeros( dots, width, 3 );
+    Zeros( alpha, width, 1 );
+    Zeros( beta, width, 1 );
+    Zeros( gammaOld, width, 1 );
+    Zeros( alphaOld, width, 1 );
+    vector<F> packedDots;
+    mpi::Request<F> request;
+    while( true )
+    {
+        // Overlap the reduction of gamma := (r,u), delta := (w,u), and
+        // || r ||_2^2 with m := inv(M) w and n := A m
+        LocalColumnDots( R, U, dots, 0 );
+        LocalColumnDots( W, U, dots, 1 );
+        LocalColumnDots( R, R, dots, 2 );
+        StartDots( dots, packedDots, comm, request );
+        M = W;
+        precond( M );
+        applyA( M, N );
+        FinishDots( dots, packedDots, comm, request );
+
+        const Int numActive =
+          Converge( dots, 2, targets, active, info, ctrl.progress, comm );
+        if( numActive == 0 || info.numIts >= ctrl.maxIts )
+            break;
+
+        for( Int j=0; j<width; ++j )
+        {
+            alpha(j) = beta(j) = 0;
+            if( !active[j] )
+                continue;
+            const F gamma = dots(j,0);
+            const F delta = dots(j,1);
+            F denom = delta;
+            if( info.numIts > 0 )
+            {
+                beta(j) = gamma/gammaOld(j);
+                denom -= beta(j)*gamma/alphaOld(j);
+            }
+            if( denom == F(0) )
+            {
+                active[j] = false;
+                beta(j) = 0;
+                continue;
+            }
+            alpha(j) = gamma/denom;
+            gammaOld(j) = gamma;
+            alphaOld(j) = alpha(j);
+        }
+
+        // z := n + beta z, q := m + beta q, s := w + beta s, p := u + beta p
+        ColumnXpby( N, beta, Z );
+        ColumnXpby( M, beta, Q );
+        ColumnXpby( W, beta, S );
+        ColumnXpby( U, beta, P );
+
+        // x := x + alpha p, r := r - alpha s, u := u - alpha q,
+        // w := w - alpha z
+        ColumnAxpy( alpha, P, X );
+        alpha *= F(-1);
+        ColumnAxpy( alpha, S, R );
+        ColumnAxpy( alpha, Q, U );
+        ColumnAxpy( alpha, Z, W );
+        ++info.numIts;
+    }
+    return info;
+}
+
+// Conjugate Gradients for the family of HPD systems (A + shifts[k] I) X = B
+// with zero initial guesses. The Krylov subspaces of the shifted systems
+// coincide, and their residuals are collinear with those of the seed system
+// (the smallest shift), r_k = zeta_k r, so that A is only applied to the
+// search directions of the seed system. The recurrences for zeta_k are due to
+//
+//   B. Jegerlehner, "Krylov space solvers for shifted linear systems",
+//   arXiv:hep-lat/9612014, 1996.
+//
+// A column is deactivated once the residual norms of all of its shifted
+// systems, |zeta_k| || r ||_2, have met their targets (the seed system, having
+// the smallest shift, is typically the last to converge).
+template<typename F,class ApplyAType>
+KrylovSolveInfo MultiShiftCG
+( mpi::Comm comm,
+  const ApplyAType& applyA,
+  const Matrix<F>& B,
+  const vector<Base<F>>& shifts,
+        vector<Matrix<F>>& X,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    const Int numShifts = shifts.size();
+    KrylovSolveInfo info;
+    X.resize( numShifts );
+    for( auto& XShift : X )
+        Zeros( XShift, height, width );
+    if( numShifts == 0 )
+        return info;
+    const Int seed =
+      std::min_element( shifts.begin(), shifts.end() ) - shifts.begin();
+    const Real seedShift = shifts[seed];
+
+    Matrix<Real> targets;
+    vector<bool> active;
+    const function<void(Matrix<F>&)>* noPrecond = nullptr;
+    Targets( noPrecond, B, X[seed], ctrl.relTol, targets, active, comm );
+
+    Matrix<F> R( B ), S;
+    vector<Matrix<F>> P( numShifts );
+    for( auto& PShift : P )
+        PShift = B;
+
+    // The residual scalings are kept for the current and previous iterations
+    Matrix<Real> zeta, zetaOld, zetaNew;
+    Ones( zeta, numShifts, width );
+    Ones( zetaOld, numShifts, width );
+    Ones( zetaNew, numShifts, width );
+    Matrix<Real> alphaOld, betaOld;
+    Ones( alphaOld, width, 1 );
+    Zeros( betaOld, width, 1 );
+
+    Matrix<F> rhos, residNormsSq, delta, alpha, coef, beta;
+    Zeros( rhos, width, 1 );
+    Zeros( residNormsSq, width, 1 );
+    Zeros( delta, width, 1 );
+    Zeros( alpha, width, 1 );
+    Zeros( coef, width, 1 );
+    Zeros( beta, width, 1 );
+    LocalColumnDots( R, R, rhos, 0 );
+    SumDots( rhos, comm );
+    while( true )
+    {
+        // The residual norms of the least-converged shifts
+        for( Int j=0; j<width; ++j )
+        {
+            Real maxZetaSq = 0;
+            for( Int k=0; k<numShifts; ++k )
+                maxZetaSq = Max( maxZetaSq, zeta(k,j)*zeta(k,j) );
+            residNormsSq(j) = maxZetaSq*RealPart(rhos(j));
+        }
+        const Int numActive =
+          Converge
+          ( residNormsSq, 0, targets, active, info, ctrl.progress, comm );
+        if( numActive == 0 || info.numIts >= ctrl.maxIts )
+            break;
+
+        // s := (A + seedShift I) p and alpha := rho / (p,s)
+        applyA( P[seed], S );
+        if( seedShift != Real(0) )
+            Axpy( F(seedShift), P[seed], S );
+        LocalColumnDots( P[seed], S, delta, 0 );
+        SumDots( delta, comm );
+        for( Int j=0; j<width; ++j )
+        {
+            alpha(j) = 0;
+            if( active[j] )
+            {
+                if( RealPart(delta(j)) <= Real(0) )
+                    active[j] = false;
+                else
+                    alpha(j) = RealPart(rhos(j))/RealPart(delta(j));
+            }
+        }
+
+        // x_k := x_k + alpha_k p_k for each shifted system
+        for( Int k=0; k<numShifts; ++k )
+        {
+            if( k == seed )
+                continue;
+            const Real sigma = shifts[k] - seedShift;
+            for( Int j=0; j<width; ++j )
+            {
+                coef(j) = 0;
+                if( !active[j] )
+                    continue;
+                const Real alphaj = RealPart(alpha(j));
+                const Real zetakj = zeta(k,j);
+                const Real zetaOldkj = zetaOld(k,j);
+                const Real denom =
+                  alphaj*betaOld(j)*(zetaOldkj-zetakj) +
+                  zetaOldkj*alphaOld(j)*(1+sigma*alphaj);
+                zetaNew(k,j) =
+                  ( denom == Real(0) ? Real(0) :
+                    zetakj*zetaOldkj*alphaOld(j)/denom );
+                if( zetakj != Real(0) )
+                    coef(j) = alphaj*zetaNew(k,j)/zetakj;
+            }
+            ColumnAxpy( coef, P[k], X[k] );
+        }
+
+        // x := x + alpha p and r := r - alpha s
+        ColumnAxpy( alpha, P[seed], X[seed] );
+        for( Int j=0; j<width; ++j )
+            coef(j) = -alpha(j);
+        ColumnAxpy( coef, S, R );
+
+        // p := r + beta p, where beta := rho_new / rho
+        LocalColumnDots( R, R, delta, 0 );
+        SumDots( delta, comm );
+        for( Int j=0; j<width; ++j )
+        {
+            beta(j) = 0;
+            if( active[j] )
+            {
+                beta(j) = RealPart(delta(j))/RealPart(rhos(j));
+                alphaOld(j) = RealPart(alpha(j));
+                betaOld(j) = RealPart(beta(j));
+                rhos(j) = delta(j);
+            }
+        }
+        ColumnXpby( R, beta, P[seed] );
+
+        // p_k := zeta_k r + beta (zeta_k/zeta_k^old)^2 p_k
+        for( Int k=0; k<numShifts; ++k )
+        {
+            if( k == seed )
+                continue;
+            for( Int j=0; j<width; ++j )
+            {
+                if( !active[j] )
+                    continue;
+                const Real zetaNewkj = zetaNew(k,j);
+                const Real ratio =
+                  ( zeta(k,j) == Real(0) ? Real(0) : zetaNewkj/zeta(k,j) );
+                const F betakj = RealPart(beta(j))*ratio*ratio;
+                F* pBuf = P[k].Buffer(0,j);
+                const F* rBuf = R.LockedBuffer(0,j);
+                for( Int i=0; i<height; ++i )
+                    pBuf[i] = zetaNewkj*rBuf[i] + betakj*pBuf[i];
+                zetaOld(k,j) = zeta(k,j);
+                zeta(k,j) = zetaNewkj;
+            }
+        }
+        ++info.numIts;
+    }
+    return info;
+}
+
+// Preconditioned MINRES (following Paige and Saunders) for Hermitian A and HPD
+// M, where the residuals are measured in the norm induced by inv(M)
+template<typename F,class ApplyAType,class PrecondType>
+KrylovSolveInfo MINRES
+( mpi::Comm comm,
+  const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    const Real eps = limits::Epsilon<Real>();
+    KrylovSolveInfo info;
+    Matrix<Real> targets;
+    vector<bool> active;
+    Targets( &precond, B, X, ctrl.relTol, targets, active, comm );
+
+    // r1 := b - A x, y := inv(M) r1, and beta := sqrt((r1,y))
+    Matrix<F> R1, R2, Y, V, W, W2;
+    Residual( applyA, B, X, R1 );
+    Y = R1;
+    precond( Y );
+    Matrix<F> dots;
+    Zeros( dots, width, 1 );
+    LocalColumnDots( R1, Y, dots, 0 );
+    SumDots( dots, comm );
+    if( Converge( dots, 0, targets, active, info, ctrl.progress, comm ) == 0 )
+        return info;
+    R2 = R1;
+    Zeros( V, height, width );
+    Zeros( W, height, width );
+    Zeros( W2, height, width );
+
+    vector<Real> beta(width), oldBeta(width,0), dBar(width,0),
+      epsilon(width,0), phiBar(width), cs(width,-1), sn(width,0);
+    for( Int j=0; j<width; ++j )
+    {
+        beta[j] = Sqrt(Max(RealPart(dots(j)),Real(0)));
+        phiBar[j] = beta[j];
+    }
+
+    while( info.numIts < ctrl.maxIts )
+    {
+        // v := y / beta and y := A v - (beta/oldBeta) r1
+        for( Int j=0; j<width; ++j )
+        {
+            const F scale = ( active[j] ? F(1/beta[j]) : F(0) );
+            for( Int i=0; i<height; ++i )
+                V(i,j) = scale*Y(i,j);
+        }
+        applyA( V, Y );
+        if( info.numIts > 0 )
+            for( Int j=0; j<width; ++j )
+                if( active[j] )
+                    blas::Axpy
+                    ( height, F(-beta[j]/oldBeta[j]),
+                      R1.LockedBuffer(0,j), 1, Y.Buffer(0,j), 1 );
+
+        // alpha := (v,y) and y := y - (alpha/beta) r2
+        LocalColumnDots( V, Y, dots, 0 );
+        SumDots( dots, comm );
+        vector<Real> alpha(width,0);
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            alpha[j] = RealPart(dots(j));
+            blas::Axpy
+            ( height, F(-alpha[j]/beta[j]),
+              R2.LockedBuffer(0,j), 1, Y.Buffer(0,j), 1 );
+        }
+
+        // r1 := r2, r2 := y, y := inv(M) r2, and beta := sqrt((r2,y))
+        R1 = R2;
+        R2 = Y;
+        precond( Y );
+        LocalColumnDots( R2, Y, dots, 0 );
+        SumDots( dots, comm );
+        ++info.numIts;
+
+        Int numActive = 0;
+        Real maxRelResid = 0;
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            const Real betaSq = RealPart(dots(j));
+            if( betaSq < Real(0) )
+                RuntimeError("The preconditioner was not HPD");
+            oldBeta[j] = beta[j];
+            beta[j] = Sqrt(betaSq);
+
+            // Apply the previous rotation and generate the next one
+            const Real oldEpsilon = epsilon[j];
+            const Real delta = cs[j]*dBar[j] + sn[j]*alpha[j];
+            const Real gammaBar = sn[j]*dBar[j] - cs[j]*alpha[j];
+            epsilon[j] = sn[j]*beta[j];
+            dBar[j] = -cs[j]*beta[j];
+            const Real gamma = Max( SafeNorm(gammaBar,beta[j]), eps );
+            cs[j] = gammaBar/gamma;
+            sn[j] = beta[j]/gamma;
+            const Real phi = cs[j]*phiBar[j];
+            phiBar[j] = sn[j]*phiBar[j];
+
+            // w := (v - oldEpsilon w2 - delta w) / gamma, w2 := w_old, and
+            // x := x + phi w
+            for( Int i=0; i<height; ++i )
+            {
+                const F wOld = W(i,j);
+                W(i,j) = (V(i,j) - oldEpsilon*W2(i,j) - delta*wOld)/gamma;
+                W2(i,j) = wOld;
+                X(i,j) += phi*W(i,j);
+            }
+
+            if( !limits::IsFinite(phiBar[j]) )
+            {
+                active[j] = false;
+                continue;
+            }
+            maxRelResid = Max( maxRelResid, phiBar[j]/targets(j) );
+            if( phiBar[j] <= targets(j) || beta[j] == Real(0) )
+            {
+                active[j] = false;
+                ++info.numConverged;
+            }
+            else
+                ++numActive;
+        }
+        if( ctrl.progress )
+            OutputFromRoot
+            (comm,"iteration ",info.numIts,": ",numActive," active, max ",
+             "residual norm relative to its target: ",maxRelResid);
+        if( numActive == 0 )
+            break;
+    }
+    return info;
+}
+
+// BiCGStab with right preconditioning, where the inner products of each
+// iteration are combined into two reductions by recovering (rHat,r) from
+// (rHat,s) - omega (rHat,t). The residual norm of each iterate is checked
+// (as part of the first reduction) at the beginning of the next iteration.
+template<typename F,class ApplyAType,class PrecondType>
+KrylovSolveInfo BiCGStab
+( mpi::Comm comm,
+  const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    KrylovSolveInfo info;
+    Matrix<Real> targets;
+    vector<bool> active;
+    const PrecondType* noPrecond = nullptr;
+    Targets( noPrecond, B, X, ctrl.relTol, targets, active, comm );
+
+    Matrix<F> R, RHat, P, PHat, V, SHat, T;
+    Residual( applyA, B, X, R );
+    RHat = R;
+    Zeros( P, height, width );
+    Zeros( V, height, width );
+
+    Matrix<F> dots;
+    Zeros( dots, width, 5 );
+    LocalColumnDots( RHat, R, dots, 0 );
+    SumDots( dots, comm );
+    vector<F> rho(width,1), rhoNew(width), alpha(width,1), omega(width,1);
+    for( Int j=0; j<width; ++j )
+        rhoNew[j] = dots(j,0);
+
+    while( true )
+    {
+        // p := r + beta (p - omega v), where beta := (rhoNew/rho)(alpha/omega)
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            const F beta = (rhoNew[j]/rho[j])*(alpha[j]/omega[j]);
+            rho[j] = rhoNew[j];
+            for( Int i=0; i<height; ++i )
+                P(i,j) = R(i,j) + beta*(P(i,j)-omega[j]*V(i,j));
+        }
+
+        // pHat := inv(M) p, v := A pHat, and reduce (rHat,v) and (r,r)
+        PHat = P;
+        precond( PHat );
+        applyA( PHat, V );
+        LocalColumnDots( RHat, V, dots, 0 );
+        LocalColumnDots( R, R, dots, 1 );
+        SumDots( dots, comm );
+        const Int numActive =
+          Converge( dots, 1, targets, active, info, ctrl.progress, comm );
+        if( numActive == 0 || info.numIts >= ctrl.maxIts )
+            break;
+
+        // s := r - alpha v (overwriting r)
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            if( dots(j,0) == F(0) || rho[j] == F(0) )
+            {
+                active[j] = false;
+                continue;
+            }
+            alpha[j] = rho[j]/dots(j,0);
+            blas::Axpy
+            ( height, -alpha[j], V.LockedBuffer(0,j), 1, R.Buffer(0,j), 1 );
+        }
+
+        // sHat := inv(M) s, t := A sHat, and reduce (t,s), (t,t), (rHat,s),
+        // (rHat,t), and (s,s)
+        SHat = R;
+        precond( SHat );
+        applyA( SHat, T );
+        LocalColumnDots( T, R, dots, 0 );
+        LocalColumnDots( T, T, dots, 1 );
+        LocalColumnDots( RHat, R, dots, 2 );
+        LocalColumnDots( RHat, T, dots, 3 );
+        LocalColumnDots( R, R, dots, 4 );
+        SumDots( dots, comm );
+
+        // x := x + alpha pHat + omega sHat and r := s - omega t
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            blas::Axpy
+            ( height, alpha[j], PHat.LockedBuffer(0,j), 1, X.Buffer(0,j), 1 );
+            const Real sNorm = Sqrt(Max(RealPart(dots(j,4)),Real(0)));
+            if( sNorm <= targets(j) || dots(j,1) == F(0) )
+            {
+                // The half-step already met the target
+                active[j] = false;
+                if( sNorm <= targets(j) )
+                    ++info.numConverged;
+                continue;
+            }
+            omega[j] = dots(j,0)/dots(j,1);
+            blas::Axpy
+            ( height, omega[j], SHat.LockedBuffer(0,j), 1, X.Buffer(0,j), 1 );
+            blas::Axpy
+            ( height, -omega[j], T.LockedBuffer(0,j), 1, R.Buffer(0,j), 1 );
+            rhoNew[j] = dots(j,2) - omega[j]*dots(j,3);
+            if( omega[j] == F(0) )
+                active[j] = false;
+        }
+        ++info.numIts;
+    }
+    return info;
+}
+
+// The state of the restarted GMRES recurrence for a single right-hand side
+template<typename F>
+struct GMRESColumn
+{
+    // The local rows of the Krylov basis and, for the pipelined variant, of
+    // A inv(M) V shifted right by one column
+    Matrix<F> V, Z;
+
+    // The Hessenberg matrix (which is rotated into upper-triangular form), the
+    // rotated residual vector, and the Givens rotations
+    Matrix<F> H, t, sn;
+    Matrix<Base<F>> cs;
+
+    // The number of rotated columns of H
+    Int length=0;
+    bool inCycle=false;
+
+    void Start( const Matrix<F>& r, Base<F> beta, Int restart, bool pipelined )
+    {
+        const Int height = r.Height();
+        Zeros( V, height, restart+1 );
+        if( pipelined )
+            Zeros( Z, height, restart+1 );
+        Zeros( H, restart+1, restart );
+        Zeros( t, restart+1, 1 );
+        Zeros( sn, restart, 1 );
+        Zeros( cs, restart, 1 );
+        t(0) = beta;
+        for( Int i=0; i<height; ++i )
+            V(i,0) = r(i)/beta;
+        length = 0;
+        inCycle = true;
+    }
+
+    // Rotate column k of H (whose subdiagonal entry has been filled in) into
+    // upper-triangular form and return the residual norm estimate |t(k+1)|
+    Base<F> Rotate( Int k )
+    {
+        typedef Base<F> Real;
+        for( Int i=0; i<k; ++i )
+        {
+            const Real c = cs(i);
+            const F s = sn(i);
+            const F eta_i_k = H(i,k);
+            const F eta_ip1_k = H(i+1,k);
+            H(i,  k) =  c      *eta_i_k + s*eta_ip1_k;
+            H(i+1,k) = -Conj(s)*eta_i_k + c*eta_ip1_k;
+        }
+        Real c;
+        F s;
+        const F rho = Givens( H(k,k), H(k+1,k), c, s );
+        if( !limits::IsFinite(c) ||
+            !limits::IsFinite(RealPart(s)) ||
+            !limits::IsFinite(ImagPart(s)) ||
+            !limits::IsFinite(RealPart(rho)) ||
+            !limits::IsFinite(ImagPart(rho)) )
+            RuntimeError("Givens rotation produced a non-finite number");
+        H(k,k) = rho;
+        H(k+1,k) = 0;
+        cs(k) = c;
+        sn(k) = s;
+        const F tau_k = t(k);
+        const F tau_kp1 = t(k+1);
+        t(k)   =  c      *tau_k + s*tau_kp1;
+        t(k+1) = -Conj(s)*tau_k + c*tau_kp1;
+        length = k+1;
+        return Abs(t(k+1));
+    }
+
+    // d := V y, where y minimizes the residual over the current cycle
+    void Correction( Matrix<F>& d ) const
+    {
+        if( length == 0 )
+        {
+            Zero( d );
+            return;
+        }
+        auto tT = t( IR(0,length), ALL );
+        Matrix<F> y( tT );
+        auto HTL = H( IR(0,length), IR(0,length) );
+        Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+        auto VL = V( ALL, IR(0,length) );
+        Gemv( NORMAL, F(1), VL, y, F(0), d );
+    }
+};
+
+// Y(:,j) := columns(j)(:,k) for each column in the current cycle (and zero
+// otherwise)
+template<typename F>
+void GatherBasisVectors
+( const vector<GMRESColumn<F>>& cols,
+  bool fromZ,
+  Int k,
+  Matrix<F>& Y )
+{
+    const Int width = Y.Width();
+    Zero( Y );
+    for( Int j=0; j<width; ++j )
+    {
+        if( !cols[j].inCycle )
+            continue;
+        const auto& basis = ( fromZ ? cols[j].Z : cols[j].V );
+        auto y = Y( ALL, IR(j) );
+        y = basis( ALL, IR(k) );
+    }
+}
+
+// One cycle of GMRES(restart) with right preconditioning, where each new
+// vector is orthogonalized with two passes of classical Gram-Schmidt (the
+// second of which also computes the norm of the result)
+template<typename F,class ApplyAType,class PrecondType>
+void GMRESCycle
+( mpi::Comm comm,
+  const ApplyAType& applyA,
+  const PrecondType& precond,
+        vector<GMRESColumn<F>>& cols,
+  const Matrix<Base<F>>& targets,
+        KrylovSolveInfo& info,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int width = cols.size();
+    const Int height = cols[0].V.Height();
+    Matrix<F> U, W, dots;
+    Zeros( U, height, width );
+    for( Int k=0; k<ctrl.restart && info.numIts<ctrl.maxIts; ++k )
+    {
+        // w := A inv(M) v_k
+        GatherBasisVectors( cols, false, k, U );
+        precond( U );
+        applyA( U, W );
+
+        for( Int pass=0; pass<2; ++pass )
+        {
+            // h := V^H w (and, on the second pass, || w ||_2^2)
+            Zeros( dots, k+2, width );
+            for( Int j=0; j<width; ++j )
+            {
+                if( !cols[j].inCycle )
+                    continue;
+                auto VL = cols[j].V( ALL, IR(0,k+1) );
+                auto w = W( ALL, IR(j) );
+                auto h = dots( IR(0,k+1), IR(j) );
+                Gemv( ADJOINT, F(1), VL, w, F(0), h );
+                dots(k+1,j) =
+                  blas::Dot
+                  ( height, W.LockedBuffer(0,j), 1, W.LockedBuffer(0,j), 1 );
+            }
+            SumDots( dots, comm );
+
+            // w := w - V h
+            for( Int j=0; j<width; ++j )
+            {
+                if( !cols[j].inCycle )
+                    continue;
+                auto VL = cols[j].V( ALL, IR(0,k+1) );
+                auto w = W( ALL, IR(j) );
+                auto h = dots( IR(0,k+1), IR(j) );
+                Gemv( NORMAL, F(-1), VL, h, F(1), w );
+                for( Int i=0; i<=k; ++i )
+                    cols[j].H(i,k) += h(i);
+                if( pass == 1 )
+                {
+                    // The Pythagorean theorem is accurate here since the
+                    // second-pass coefficients are small
+                    const Real wNormSq = RealPart(dots(k+1,j));
+                    const Real hNorm = FrobeniusNorm( h );
+                    const Real wNorm =
+                      Sqrt(Max(wNormSq-hNorm*hNorm,Real(0)));
+                    cols[j].H(k+1,k) =
+                      ( wNorm <= eps*Sqrt(wNormSq) ? Real(0) : wNorm );
+                }
+            }
+        }
+        ++info.numIts;
+
+        // v_{k+1} := w / || w ||_2
+        for( Int j=0; j<width; ++j )
+        {
+            auto& col = cols[j];
+            if( !col.inCycle )
+                continue;
+            const Real wNorm = RealPart(col.H(k+1,k));
+            if( wNorm > Real(0) )
+                for( Int i=0; i<height; ++i )
+                    col.V(i,k+1) = W(i,j)/wNorm;
+            const Real residEst = col.Rotate( k );
+            if( residEst <= targets(j) || wNorm == Real(0) )
+                col.inCycle = false;
+        }
+    }
+}
+
+// One cycle of the pipelined GMRES(restart) of Ghysels et al. (their
+// p(1)-GMRES), with right preconditioning. Column k-1 of H is formed from the
+// inner products of z_k = A inv(M) v_{k-1} against the basis and itself, whose
+// (non-blocking) reduction is overlapped with the computation of
+// A inv(M) z_k, which yields z_{k+1} without another application of the
+// operator. When the Pythagorean computation of the norm of the new vector is
+// inaccurate, an explicit reorthogonalization pass (with a blocking
+// reduction) is performed.
+template<typename F,class ApplyAType,class PrecondType>
+void PipelinedGMRESCycle
+( mpi::Comm comm,
+  const ApplyAType& applyA,
+  const PrecondType& precond,
+        vector<GMRESColumn<F>>& cols,
+  const Matrix<Base<F>>& targets,
+        KrylovSolveInfo& info,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real sqrtEps = Sqrt(eps);
+    const Int width = cols.size();
+    const Int height = cols[0].V.Height();
+    Matrix<F> U, W, dots, reorthDots;
+    Zeros( U, height, width );
+
+    // z_1 := A inv(M) v_0
+    GatherBasisVectors( cols, false, 0, U );
+    precond( U );
+    applyA( U, W );
+    for( Int j=0; j<width; ++j )
+    {
+        if( !cols[j].inCycle )
+            continue;
+        auto z = cols[j].Z( ALL, IR(1) );
+        z = W( ALL, IR(j) );
+    }
+
+    // Start the reduction of [V(:,0:k)^H z_k; || z_k ||_2^2] for k=1
+    vector<F> packedDots;
+    auto startDots = [&]( Int k, mpi::Request<F>& request )
+      {
+          Zeros( dots, k+1, width );
+          for( Int j=0; j<width; ++j )
+          {
+              if( !cols[j].inCycle )
+                  continue;
+              auto VL = cols[j].V( ALL, IR(0,k) );
+              auto z = cols[j].Z( ALL, IR(k) );
+              auto h = dots( IR(0,k), IR(j) );
+              Gemv( ADJOINT, F(1), VL, z, F(0), h );
+              dots(k,j) =
+                blas::Dot
+                ( height, z.LockedBuffer(), 1, z.LockedBuffer(), 1 );
+          }
+          StartDots( dots, packedDots, comm, request );
+      };
+    mpi::Request<F> request;
+    startDots( 1, request );
+
+    vector<Real> zNorms(width);
+    vector<bool> reorth(width);
+    for( Int k=1; k<=ctrl.restart && info.numIts<ctrl.maxIts; ++k )
+    {
+        // Overlap the reduction with w := A inv(M) z_k (which is only needed
+        // if the cycle continues)
+        const bool lastStep =
+          ( k == ctrl.restart || info.numIts+1 == ctrl.maxIts );
+        if( !lastStep )
+        {
+            GatherBasisVectors( cols, true, k, U );
+            precond( U );
+            applyA( U, W );
+        }
+        FinishDots( dots, packedDots, comm, request );
+        ++info.numIts;
+
+        // H(0:k-1,k-1) := h and v_k := z_k - V(:,0:k-1) h
+        Int numReorth = 0;
+        for( Int j=0; j<width; ++j )
+        {
+            auto& col = cols[j];
+            reorth[j] = false;
+            if( !col.inCycle )
+                continue;
+            auto h = dots( IR(0,k), IR(j) );
+            const Real zNormSq = RealPart(dots(k,j));
+            const Real hNorm = FrobeniusNorm( h );
+            const Real vNormSq = zNormSq - hNorm*hNorm;
+            for( Int i=0; i<k; ++i )
+                col.H(i,k-1) = h(i);
+            auto v = col.V( ALL, IR(k) );
+            v = col.Z( ALL, IR(k) );
+            auto VL = col.V( ALL, IR(0,k) );
+            Gemv( NORMAL, F(-1), VL, h, F(1), v );
+            zNorms[j] = Sqrt(Max(zNormSq,Real(0)));
+            if( vNormSq <= sqrtEps*zNormSq )
+            {
+                reorth[j] = true;
+                ++numReorth;
+            }
+            else
+                col.H(k,k-1) = Sqrt(vNormSq);
+        }
+        if( numReorth > 0 )
+        {
+            // The decision to reorthogonalize is made from reduced values and
+            // is therefore consistent across the team
+            Zeros( reorthDots, k+1, width );
+            for( Int j=0; j<width; ++j )
+            {
+                if( !reorth[j] )
+                    continue;
+                auto VL = cols[j].V( ALL, IR(0,k) );
+                auto v = cols[j].V( ALL, IR(k) );
+                auto h = reorthDots( IR(0,k), IR(j) );
+                Gemv( ADJOINT, F(1), VL, v, F(0), h );
+                reorthDots(k,j) =
+                  blas::Dot
+                  ( height, v.LockedBuffer(), 1, v.LockedBuffer(), 1 );
+            }
+            SumDots( reorthDots, comm );
+            for( Int j=0; j<width; ++j )
+            {
+                if( !reorth[j] )
+                    continue;
+                auto& col = cols[j];
+                auto VL = col.V( ALL, IR(0,k) );
+                auto v = col.V( ALL, IR(k) );
+                auto h = reorthDots( IR(0,k), IR(j) );
+                Gemv( NORMAL, F(-1), VL, h, F(1), v );
+                for( Int i=0; i<k; ++i )
+                {
+                    col.H(i,k-1) += h(i);
+                    dots(i,j) = col.H(i,k-1);
+                }
+                const Real hNorm = FrobeniusNorm( h );
+                const Real vNormSq = RealPart(reorthDots(k,j));
+                const Real vNorm = Sqrt(Max(vNormSq-hNorm*hNorm,Real(0)));
+                col.H(k,k-1) = ( vNorm <= eps*zNorms[j] ? Real(0) : vNorm );
+            }
+        }
+
+        // v_k := v_k / H(k,k-1) and
+        // z_{k+1} := (w - Z(:,1:k) H(0:k-1,k-1)) / H(k,k-1)
+        for( Int j=0; j<width; ++j )
+        {
+            auto& col = cols[j];
+            if( !col.inCycle )
+                continue;
+            const Real vNorm = RealPart(col.H(k,k-1));
+            if( vNorm > Real(0) )
+            {
+                auto v = col.V( ALL, IR(k) );
+                v *= F(1/vNorm);
+                if( !lastStep )
+                {
+                    auto z = col.Z( ALL, IR(k+1) );
+                    z = W( ALL, IR(j) );
+                    auto ZL = col.Z( ALL, IR(1,k+1) );
+                    auto h = dots( IR(0,k), IR(j) );
+                    Gemv( NORMAL, F(-1), ZL, h, F(1), z );
+                    z *= F(1/vNorm);
+                }
+            }
+            const Real residEst = col.Rotate( k-1 );
+            if( residEst <= targets(j) || vNorm == Real(0) )
+                col.inCycle = false;
+        }
+
+        if( lastStep )
+            break;
+        Int numInCycle = 0;
+        for( Int j=0; j<width; ++j )
+            if( cols[j].inCycle )
+                ++numInCycle;
+        if( numInCycle == 0 )
+            break;
+        startDots( k+1, request );
+    }
+}
+
+// Restarted GMRES with right preconditioning, where the cycles of all of the
+// right-hand sides are synchronized and each begins with an explicit
+// computation of the residual
+template<typename F,class ApplyAType,class PrecondType>
+KrylovSolveInfo GMRES
+( mpi::Comm comm,
+  const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.restart < 1 )
+        LogicError("The GMRES restart parameter must be positive");
+    const Int height = B.Height();
+    const Int width = B.Width();
+    KrylovSolveInfo info;
+    Matrix<Real> targets;
+    vector<bool> active;
+    const PrecondType* noPrecond = nullptr;
+    Targets( noPrecond, B, X, ctrl.relTol, targets, active, comm );
+
+    vector<GMRESColumn<F>> cols( width );
+    Matrix<F> R, D, dots;
+    Zeros( dots, width, 1 );
+    while( true )
+    {
+        Residual( applyA, B, X, R );
+        LocalColumnDots( R, R, dots, 0 );
+        SumDots( dots, comm );
+        const Int numActive =
+          Converge( dots, 0, targets, active, info, ctrl.progress, comm );
+        if( numActive == 0 || info.numIts >= ctrl.maxIts )
+            break;
+
+        for( Int j=0; j<width; ++j )
+        {
+            cols[j].inCycle = false;
+            cols[j].length = 0;
+            if( active[j] )
+            {
+                const Real beta = Sqrt(RealPart(dots(j)));
+                auto r = R( ALL, IR(j) );
+                cols[j].Start( r, beta, ctrl.restart, ctrl.pipelined );
+            }
+        }
+        if( ctrl.pipelined )
+            PipelinedGMRESCycle
+            ( comm, applyA, precond, cols, targets, info, ctrl );
+        else
+            GMRESCycle( comm, applyA, precond, cols, targets, info, ctrl );
+
+        // x := x + inv(M) V y
+        Zeros( D, height, width );
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            auto d = D( ALL, IR(j) );
+            cols[j].Correction( d );
+        }
+        precond( D );
+        X += D;
+    }
+    return info;
+}
+
+template<typename F,class ApplyAType,class PrecondType>
+KrylovSolveInfo Solve
+( mpi::Comm comm,
+  const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( X.Height() != B.Height() || X.Width() != B.Width() )
+        LogicError("The initial guess and right-hand sides did not conform");
+    switch( ctrl.alg )
+    {
+    case KRYLOV_CG:
+        if( ctrl.pipelined )
+            return PipelinedCG( comm, applyA, precond, B, X, ctrl );
+        else
+            return CG( comm, applyA, precond, B, X, ctrl );
+    case KRYLOV_MINRES:
+        return MINRES( comm, applyA, precond, B, X, ctrl );
+    case KRYLOV_BICGSTAB:
+        return BiCGStab( comm, applyA, precond, B, X, ctrl );
+    default:
+        return GMRES( comm, applyA, precond, B, X, ctrl );
+    }
+}
+
+template<typename F,class ApplyAType>
+function<void(const Matrix<F>&,Matrix<F>&)>
+LocalApplication
+( Int n,
+  const ApplyAType& applyA,
+  DistMultiVec<F>& XBlock,
+  DistMultiVec<F>& YBlock )
+{
+    return
+      [&applyA,&XBlock,&YBlock,n]( const Matrix<F>& XLoc, Matrix<F>& YLoc )
+      {
+          XBlock.Resize( n, XLoc.Width() );
+          XBlock.Matrix() = XLoc;
+          applyA( XBlock, YBlock );
+          YLoc = YBlock.LockedMatrix();
+      };
+}
+
+template<typename F,class PrecondType>
+function<void(Matrix<F>&)>
+LocalPreconditioner
+( Int n,
+  const PrecondType& precond,
+  DistMultiVec<F>& XBlock )
+{
+    return
+      [&precond,&XBlock,n]( Matrix<F>& XLoc )
+      {
+          XBlock.Resize( n, XLoc.Width() );
+          XBlock.Matrix() = XLoc;
+          precond( XBlock );
+          XLoc = XBlock.LockedMatrix();
+      };
+}
+
+} // namespace krylov_solve
+
+// Solve A X = B, using the incoming X as the initial guess, where the operator
+// is applied as applyA( X, Y ), i.e., Y := A X, and the preconditioner as
+// precond( X ), i.e., X := inv(M) X
+template<typename F,class ApplyAType,class PrecondType>
+KrylovSolveInfo KrylovSolve
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const KrylovSolveCtrl<Base<F>>& ctrl=KrylovSolveCtrl<Base<F>>() )
+{
+    DEBUG_CSE
+    return krylov_solve::Solve
+      ( mpi::COMM_SELF, applyA, precond, B, X, ctrl );
+}
+
+// X must be distributed in the same manner as B
+template<typename F,class ApplyAType,class PrecondType>
+KrylovSolveInfo KrylovSolve
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const DistMultiVec<F>& B,
+        DistMultiVec<F>& X,
+  const KrylovSolveCtrl<Base<F>>& ctrl=KrylovSolveCtrl<Base<F>>() )
+{
+    DEBUG_CSE
+    const Int n = B.Height();
+    mpi::Comm comm = B.Comm();
+    if( X.Height() != n || X.Width() != B.Width() )
+        LogicError("The initial guess and right-hand sides did not conform");
+    DistMultiVec<F> XBlock(comm), YBlock(comm), PBlock(comm);
+    auto applyLocal =
+      krylov_solve::LocalApplication( n, applyA, XBlock, YBlock );
+    auto precondLocal =
+      krylov_solve::LocalPreconditioner( n, precond, PBlock );
+    return krylov_solve::Solve
+      ( comm, applyLocal, precondLocal, B.LockedMatrix(), X.Matrix(), ctrl );
+}
+
+// Overwrite B with the solution of A X = B using the FGMRES or LGMRES method
+// selected by a RegSolveCtrl, but with an arbitrary preconditioner (e.g., an
+// IncompleteLDLFactorization or a BlockJacobiPreconditioner) in place of a
+// regularized factorization. The refinement parameters are unused.
+template<typename F,class PrecondType>
+Int SolveWithPreconditioner
+( const SparseMatrix<F>& A,
+  const PrecondType& precond,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl=RegSolveCtrl<Base<F>>() )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename F,class PrecondType>
+Int SolveWithPreconditioner
+( const DistSparseMatrix<F>& A,
+  const PrecondType& precond,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl=RegSolveCtrl<Base<F>>() )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_KRYLOV_HPP
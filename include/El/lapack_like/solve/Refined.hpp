@@ -15,12 +15,13 @@
 //  2) a pair of right-hand sides, and
 //  3) an arbitrary number of right-hand sides.
 //
-// In the first and second cases, proper iterative refinement is performed.
-// In the third case, "batch" iterative refinement is performed for a 
-// specified number of iterations. While batch refinement will occasionally 
-// result in higher residual norms than necessary (as monotonicity must be
-// specifically enforced), and more iterations than necessary may be performed, 
-// it is a compromise between performance and accuracy.
+// In each case, proper iterative refinement is performed: an update is only
+// accepted if it decreases the (max-norm) residual, and refinement stops once
+// the relative residual falls below the tolerance or stagnates. In the third
+// case, the convergence test is applied to each column independently, and the
+// columns which have not yet converged are refined together so that each
+// iteration involves a single (blocked) application of A and of its inverse,
+// and hence a single round of communication in the distributed case.
 
 // TODO: DistMatrix implementations
 // TODO: Simplify once DistMultiVec is eliminated
@@ -287,6 +288,7 @@ Int Batch
 ( const ApplyAType& applyA,
   const ApplyAInvType& applyAInv,
         Matrix<F>& B,
+        Base<F> relTol,
         Int maxRefineIts,
         bool progress )
 {
@@ -296,40 +298,80 @@ Int Batch
         applyAInv( B );    
         return 0;
     }
+    typedef Base<F> Real;
+    const Int height = B.Height();
+    const Int width = B.Width();
 
-    // TODO: Allow for early exits
+    auto BOrig = B;
+    Matrix<Real> bNorms;
+    ColumnMaxNorms( BOrig, bNorms );
 
     // Compute the initial guesses
     // ===========================
-    auto BOrig = B;
     auto X = B;
     applyAInv( X );
 
-    Matrix<F> dX, Y;
-    Zeros( Y, X.Height(), X.Width() );
+    Matrix<F> Y;
+    Zeros( Y, height, width );
     applyA( X, Y );
     B -= Y;
+    Matrix<Real> errorNorms;
+    ColumnMaxNorms( B, errorNorms );
 
+    vector<Int> active;
+    for( Int j=0; j<width; ++j )
+        if( errorNorms(j) > relTol*bNorms(j) )
+            active.push_back( j );
+    if( progress )
+        Output(active.size()," of ",width," right-hand sides unconverged");
+
+    Matrix<F> dX, XCand, R;
+    Matrix<Real> newErrorNorms;
+    vector<Int> stillActive;
     Int refineIt = 0;
-    while( true )
+    while( !active.empty() && refineIt < maxRefineIts )
     {
-        // Compute the updates to the solutions
-        // ------------------------------------
-        dX = B;
-        applyAInv( dX );
-        X += dX;
+        const Int numActive = active.size();
 
-        ++refineIt;
-        if( refineIt < maxRefineIts )
+        // Compute the proposed updates to the unconverged solutions
+        // ---------------------------------------------------------
+        dX = B( ALL, active );
+        applyAInv( dX );
+        XCand = X( ALL, active );
+        XCand += dX;
+
+        // Compute the new residuals
+        // -------------------------
+        Zeros( Y, height, numActive );
+        applyA( XCand, Y );
+        R = BOrig( ALL, active );
+        R -= Y;
+        ColumnMaxNorms( R, newErrorNorms );
+
+        // Accept the updates which reduced the residual, and retire the
+        // columns which either converged or stagnated
+        // -------------------------------------------------------------
+        stillActive.resize( 0 );
+        for( Int k=0; k<numActive; ++k )
         {
-            // Compute the new residual
-            // ------------------------
-            applyA( X, Y );
-            B = BOrig;
-            B -= Y;
+            const Int j = active[k];
+            if( newErrorNorms(k) >= errorNorms(j) )
+                continue;
+            auto xj = X( ALL, IR(j) );
+            auto bj = B( ALL, IR(j) );
+            xj = XCand( ALL, IR(k) );
+            bj = R( ALL, IR(k) );
+            errorNorms(j) = newErrorNorms(k);
+            if( errorNorms(j) > relTol*bNorms(j) )
+                stillActive.push_back( j );
         }
-        else
-            break;
+        active.swap( stillActive );
+
+        ++refineIt;
+        if( progress )
+            Output
+            (active.size()," of ",width," right-hand sides unconverged after ",
+             refineIt," refinements");
     }
     B = X;
     return refineIt;
@@ -355,7 +397,7 @@ Int RefinedSolve
                ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
     else
         return refined_solve::Batch
-               ( applyA, applyAInv, B, maxRefineIts, progress );
+               ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
 namespace refined_solve {
@@ -638,6 +680,7 @@ Int PromotedBatch
 ( const ApplyAType& applyA,
   const ApplyAInvType& applyAInv,
         Matrix<F>& B,
+        Base<F> relTol,
         Int maxRefineIts,
         bool progress )
 {
@@ -647,11 +690,17 @@ Int PromotedBatch
         applyAInv( B );
         return 0;
     }
+    typedef Base<F> Real;
+    typedef Promote<Real> PReal;
     typedef Promote<F> PF;
+    const Int height = B.Height();
+    const Int width = B.Width();
 
     Matrix<PF> BProm, BOrigProm;
     Copy( B, BProm );
     Copy( B, BOrigProm );
+    Matrix<PReal> bNorms;
+    ColumnMaxNorms( BOrigProm, bNorms );
 
     // Compute the initial guesses
     // ===========================
@@ -659,32 +708,69 @@ Int PromotedBatch
     Matrix<PF> XProm;
     Copy( B, XProm );
 
-    Matrix<PF> dXProm, YProm;
-    Zeros( YProm, XProm.Height(), XProm.Width() );
+    Matrix<PF> YProm;
+    Zeros( YProm, height, width );
     applyA( XProm, YProm );
     BProm -= YProm;
+    Matrix<PReal> errorNorms;
+    ColumnMaxNorms( BProm, errorNorms );
+
+    vector<Int> active;
+    for( Int j=0; j<width; ++j )
+        if( errorNorms(j) > PReal(relTol)*bNorms(j) )
+            active.push_back( j );
+    if( progress )
+        Output(active.size()," of ",width," right-hand sides unconverged");
 
+    Matrix<F> dX;
+    Matrix<PF> dXProm, XCandProm, RProm;
+    Matrix<PReal> newErrorNorms;
+    vector<Int> stillActive;
     Int refineIt = 0;
-    while( true )
+    while( !active.empty() && refineIt < maxRefineIts )
     {
-        // Update the solutions
-        // --------------------
-        Copy( BProm, B );
-        applyAInv( B );
-        Copy( B, dXProm );
-        XProm += dXProm;
+        const Int numActive = active.size();
 
-        ++refineIt;
-        if( refineIt < maxRefineIts )
+        // Compute the proposed updates to the unconverged solutions
+        // ---------------------------------------------------------
+        Copy( BProm( ALL, active ), dX );
+        applyAInv( dX );
+        Copy( dX, dXProm );
+        XCandProm = XProm( ALL, active );
+        XCandProm += dXProm;
+
+        // Form the new residuals
+        // ----------------------
+        Zeros( YProm, height, numActive );
+        applyA( XCandProm, YProm );
+        RProm = BOrigProm( ALL, active );
+        RProm -= YProm;
+        ColumnMaxNorms( RProm, newErrorNorms );
+
+        // Accept the updates which reduced the residual, and retire the
+        // columns which either converged or stagnated
+        // -------------------------------------------------------------
+        stillActive.resize( 0 );
+        for( Int k=0; k<numActive; ++k )
         {
-            // Form the new residuals
-            // ----------------------
-            applyA( XProm, YProm );
-            BProm = BOrigProm;
-            BProm -= YProm;
+            const Int j = active[k];
+            if( newErrorNorms(k) >= errorNorms(j) )
+                continue;
+            auto xj = XProm( ALL, IR(j) );
+            auto bj = BProm( ALL, IR(j) );
+            xj = XCandProm( ALL, IR(k) );
+            bj = RProm( ALL, IR(k) );
+            errorNorms(j) = newErrorNorms(k);
+            if( errorNorms(j) > PReal(relTol)*bNorms(j) )
+                stillActive.push_back( j );
         }
-        else
-            break;
+        active.swap( stillActive );
+
+        ++refineIt;
+        if( progress )
+            Output
+            (active.size()," of ",width," right-hand sides unconverged after ",
+             refineIt," refinements");
     }
     Copy( XProm, B );
     return refineIt;
@@ -711,7 +797,7 @@ PromotedRefinedSolve
                ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
     else
         return refined_solve::PromotedBatch
-               ( applyA, applyAInv, B, maxRefineIts, progress );
+               ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
 template<typename F,class ApplyAType,class ApplyAInvType>
@@ -815,6 +901,7 @@ Int Batch
 ( const ApplyAType& applyA,
   const ApplyAInvType& applyAInv,
         DistMultiVec<F>& B,
+        Base<F> relTol,
         Int maxRefineIts,
         bool progress )
 {
@@ -824,41 +911,86 @@ Int Batch
         applyAInv( B );
         return 0;
     }
+    typedef Base<F> Real;
     mpi::Comm comm = B.Comm();
+    const int commRank = mpi::Rank(comm);
+    const Int height = B.Height();
+    const Int width = B.Width();
 
+    // The column norms are computed with a single reduction over all of the
+    // right-hand sides
     auto BOrig = B;
+    Matrix<Real> bNorms;
+    ColumnMaxNorms( BOrig, bNorms );
 
     // Compute the initial guess
     // =========================
     auto X = B;
     applyAInv( X );
 
-    DistMultiVec<F> dX(comm), Y(comm);
-    Zeros( Y, X.Height(), X.Width() );
+    DistMultiVec<F> Y(comm);
+    Zeros( Y, height, width );
     applyA( X, Y );
     B -= Y;
+    Matrix<Real> errorNorms;
+    ColumnMaxNorms( B, errorNorms );
+
+    vector<Int> active;
+    for( Int j=0; j<width; ++j )
+        if( errorNorms(j) > relTol*bNorms(j) )
+            active.push_back( j );
+    if( progress && commRank == 0 )
+        Output(active.size()," of ",width," right-hand sides unconverged");
 
+    DistMultiVec<F> dX(comm), XCand(comm), R(comm);
+    Matrix<Real> newErrorNorms;
+    vector<Int> stillActive;
     Int refineIt = 0;
     const Int indent = PushIndent();
-    while( true )
+    while( !active.empty() && refineIt < maxRefineIts )
     {
-        // Compute the proposed updates to the solutions
-        // ---------------------------------------------
-        dX = B;
-        applyAInv( dX );
-        X += dX;
+        const Int numActive = active.size();
 
-        ++refineIt;
-        if( refineIt < maxRefineIts )
+        // Compute the proposed updates to the unconverged solutions
+        // ---------------------------------------------------------
+        dX = B( ALL, active );
+        applyAInv( dX );
+        XCand = X( ALL, active );
+        XCand += dX;
+
+        // Compute the new residuals
+        // -------------------------
+        Zeros( Y, height, numActive );
+        applyA( XCand, Y );
+        R = BOrig( ALL, active );
+        R -= Y;
+        ColumnMaxNorms( R, newErrorNorms );
+
+        // Accept the updates which reduced the residual, and retire the
+        // columns which either converged or stagnated (every process makes
+        // the same decisions since the norms are replicated)
+        // -----------------------------------------------------------------
+        stillActive.resize( 0 );
+        for( Int k=0; k<numActive; ++k )
         {
-            // Compute the new residual
-            // ------------------------
-            applyA( X, Y );
-            B = BOrig;
-            B -= Y;
+            const Int j = active[k];
+            if( newErrorNorms(k) >= errorNorms(j) )
+                continue;
+            auto xj = X.Matrix()( ALL, IR(j) );
+            auto bj = B.Matrix()( ALL, IR(j) );
+            xj = XCand.LockedMatrix()( ALL, IR(k) );
+            bj = R.LockedMatrix()( ALL, IR(k) );
+            errorNorms(j) = newErrorNorms(k);
+            if( errorNorms(j) > relTol*bNorms(j) )
+                stillActive.push_back( j );
         }
-        else
-            break;
+        active.swap( stillActive );
+
+        ++refineIt;
+        if( progress && commRank == 0 )
+            Output
+            (active.size()," of ",width," right-hand sides unconverged after ",
+             refineIt," refinements");
     }
     SetIndent( indent );
     B = X;
@@ -882,7 +1014,7 @@ Int RefinedSolve
                ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
     else
         return refined_solve::Batch
-               ( applyA, applyAInv, B, maxRefineIts, progress );
+               ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
 namespace refined_solve {
@@ -977,6 +1109,7 @@ Int PromotedBatch
 ( const ApplyAType& applyA,
   const ApplyAInvType& applyAInv,
         DistMultiVec<F>& B,
+        Base<F> relTol,
         Int maxRefineIts,
         bool progress )
 {
@@ -986,12 +1119,19 @@ Int PromotedBatch
         applyAInv( B );
         return 0;
     }
+    typedef Base<F> Real;
+    typedef Promote<Real> PReal;
     typedef Promote<F> PF;
     mpi::Comm comm = B.Comm();
+    const int commRank = mpi::Rank(comm);
+    const Int height = B.Height();
+    const Int width = B.Width();
 
     DistMultiVec<PF> BProm(comm), BOrigProm(comm);
     Copy( B, BProm );
     Copy( B, BOrigProm );
+    Matrix<PReal> bNorms;
+    ColumnMaxNorms( BOrigProm, bNorms );
 
     // Compute the initial guess
     // =========================
@@ -999,33 +1139,70 @@ Int PromotedBatch
     DistMultiVec<PF> XProm(comm);
     Copy( B, XProm );
 
-    DistMultiVec<PF> dXProm(comm), YProm(comm);
-    Zeros( YProm, XProm.Height(), XProm.Width() );
+    DistMultiVec<PF> YProm(comm);
+    Zeros( YProm, height, width );
     applyA( XProm, YProm );
     BProm -= YProm;
+    Matrix<PReal> errorNorms;
+    ColumnMaxNorms( BProm, errorNorms );
+
+    vector<Int> active;
+    for( Int j=0; j<width; ++j )
+        if( errorNorms(j) > PReal(relTol)*bNorms(j) )
+            active.push_back( j );
+    if( progress && commRank == 0 )
+        Output(active.size()," of ",width," right-hand sides unconverged");
 
+    DistMultiVec<F> dX(comm);
+    DistMultiVec<PF> dXProm(comm), XCandProm(comm), RProm(comm);
+    Matrix<PReal> newErrorNorms;
+    vector<Int> stillActive;
     Int refineIt = 0;
     const Int indent = PushIndent();
-    while( true )
+    while( !active.empty() && refineIt < maxRefineIts )
     {
-        // Compute the proposed updates to the solutions
-        // ---------------------------------------------
-        Copy( BProm, B );
-        applyAInv( B );
-        Copy( B, dXProm );
-        XProm += dXProm;
+        const Int numActive = active.size();
 
-        ++refineIt;
-        if( refineIt < maxRefineIts )
+        // Compute the proposed updates to the unconverged solutions
+        // ---------------------------------------------------------
+        Copy( BProm( ALL, active ), dX );
+        applyAInv( dX );
+        Copy( dX, dXProm );
+        XCandProm = XProm( ALL, active );
+        XCandProm += dXProm;
+
+        // Form the new residuals
+        // ----------------------
+        Zeros( YProm, height, numActive );
+        applyA( XCandProm, YProm );
+        RProm = BOrigProm( ALL, active );
+        RProm -= YProm;
+        ColumnMaxNorms( RProm, newErrorNorms );
+
+        // Accept the updates which reduced the residual, and retire the
+        // columns which either converged or stagnated
+        // -------------------------------------------------------------
+        stillActive.resize( 0 );
+        for( Int k=0; k<numActive; ++k )
         {
-            // Form the new residuals
-            // ----------------------
-            applyA( XProm, YProm );
-            BProm = BOrigProm;
-            BProm -= YProm;
+            const Int j = active[k];
+            if( newErrorNorms(k) >= errorNorms(j) )
+                continue;
+            auto xj = XProm.Matrix()( ALL, IR(j) );
+            auto bj = BProm.Matrix()( ALL, IR(j) );
+            xj = XCandProm.LockedMatrix()( ALL, IR(k) );
+            bj = RProm.LockedMatrix()( ALL, IR(k) );
+            errorNorms(j) = newErrorNorms(k);
+            if( errorNorms(j) > PReal(relTol)*bNorms(j) )
+                stillActive.push_back( j );
         }
-        else
-            break;
+        active.swap( stillActive );
+
+        ++refineIt;
+        if( progress && commRank == 0 )
+            Output
+            (active.size()," of ",width," right-hand sides unconverged after ",
+             refineIt," refinements");
     }
     SetIndent( indent );
     Copy( XProm, B );
@@ -1050,7 +1227,7 @@ PromotedRefinedSolve
                ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
     else
         return refined_solve::PromotedBatch
-               ( applyA, applyAInv, B, maxRefineIts, progress );
+               ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
 template<typename F,class ApplyAType,class ApplyAInvType>
@@ -381,6 +381,39 @@ struct HermitianSDCCtrl
     Real tol=Real(0);
     Real spreadFactor=Real(1e-6);
     bool progress=false;
+
+    // Split with QDWH-eig rather than with a randomized rank-revealing
+    // factorization of the spectral projector (set by
+    // HermitianEigCtrl::useQDWHEig). Each split shifts by the median of the
+    // diagonal and runs this many steps of subspace iteration on the
+    // projectors from the QDWH polar decomposition.
+    bool qdwhEig=false;
+    Int numSubspaceIts=2;
+};
+
+// Spectrum slicing computes the subset requested through
+// HermitianTridiagEigCtrl::subset without tridiagonalizing: the subset is
+// bracketed (and split into slices holding roughly equal numbers of
+// eigenvalues) using inertia counts from pivoted LDL factorizations of shifted
+// copies of A, and each slice is then solved independently with shift-invert
+// Lanczos about its midpoint.
+template<typename Real>
+struct HermitianSliceCtrl
+{
+    // The number of slices; zero selects one per sub-grid (and a single slice
+    // for sequential matrices)
+    Int numSlices=0;
+    // The number of processes in each of the sub-grids that distributed slices
+    // are dealt out to
+    int groupSize=1;
+    // The initial Lanczos basis of a slice holding k eigenvalues has
+    // 2 k + extraBasis vectors, and is doubled until every eigenvalue converges
+    Int extraBasis=20;
+    // The maximum number of inertia counts used to place each slice boundary
+    Int maxBisectIts=30;
+    // The relative residual tolerance for a Ritz pair; zero selects eps^(3/4)
+    Real tol=Real(0);
+    bool progress=false;
 };
 
 template<typename F>
@@ -389,8 +422,13 @@ struct HermitianEigCtrl
     HermitianTridiagCtrl<F> tridiagCtrl;
     HermitianTridiagEigCtrl<Base<F>> tridiagEigCtrl;
     HermitianSDCCtrl<Base<F>> sdcCtrl;
+    HermitianSliceCtrl<Base<F>> sliceCtrl;
     bool useScaLAPACK=false;
     bool useSDC=false;
+    // Use spectral divide and conquer with QDWH-eig splits (configured through
+    // sdcCtrl); this is mostly Gemm and QR and targets large matrices
+    bool useQDWHEig=false;
+    bool useSpectrumSlicing=false;
     bool timeStages=false;
 };
 
@@ -416,6 +454,14 @@ HermitianEig
         AbstractDistMatrix<F>& A,
         AbstractDistMatrix<Base<F>>& w,
   const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() );
+// Solve each member of the batch over its own sub-grid; 'w' must share the
+// layout of 'A'
+template<typename F>
+void HermitianEig
+(       UpperOrLower uplo,
+        DistMatrixBatch<F>& A,
+        DistMatrixBatch<Base<F>>& w,
+  const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() );
 
 // Compute eigenpairs
 // ------------------
@@ -435,6 +481,63 @@ HermitianEig
         AbstractDistMatrix<Base<F>>& w, 
         AbstractDistMatrix<F>& Q,
   const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() );
+template<typename F>
+void HermitianEig
+(       UpperOrLower uplo,
+        DistMatrixBatch<F>& A,
+        DistMatrixBatch<Base<F>>& w,
+        DistMatrixBatch<F>& Q,
+  const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() );
+
+// Refine approximate eigenvectors
+// -------------------------------
+// The columns of Q are taken to approximate the eigenvectors of the
+// k=Q.Width() smallest (or, if 'largest' is true, largest) eigenvalues of A,
+// e.g., from the previous step of a time-stepping loop. They are improved
+// with Chebyshev-filtered subspace iterations and Rayleigh-Ritz projections,
+// and, if the relative residual max_j ||A q_j - w_j q_j||_2 / ||A||_1 does not
+// fall below the tolerance, the eigenpairs are instead recomputed from
+// scratch using the HermitianEigCtrl.
+template<typename Real>
+struct HermitianEigRefineCtrl
+{
+    Int maxIts=5;
+    Int chebyshevDegree=8;
+    Real tol=Real(0); // zero selects the square-root of the unit roundoff
+    bool largest=false;
+    bool fallback=true;
+    bool progress=false;
+};
+
+template<typename Real>
+struct HermitianEigRefineInfo
+{
+    Int numIts=0;
+    Real residual=Real(0);
+    bool fellBack=false;
+    HermitianEigInfo eigInfo;
+};
+
+template<typename F>
+HermitianEigRefineInfo<Base<F>>
+HermitianEigRefine
+(       UpperOrLower uplo,
+  const Matrix<F>& A,
+        Matrix<Base<F>>& w,
+        Matrix<F>& Q,
+  const HermitianEigRefineCtrl<Base<F>>& refineCtrl=
+        HermitianEigRefineCtrl<Base<F>>(),
+  const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() );
+template<typename F>
+HermitianEigRefineInfo<Base<F>>
+HermitianEigRefine
+(       UpperOrLower uplo,
+  const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<Base<F>>& w,
+        AbstractDistMatrix<F>& Q,
+  const HermitianEigRefineCtrl<Base<F>>& refineCtrl=
+        HermitianEigRefineCtrl<Base<F>>(),
+  const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() );
 
 namespace herm_eig {
 
@@ -555,12 +658,92 @@ HermitianGenDefEig
         AbstractDistMatrix<F>& X,
   const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() );
 
+// Solvers which retain the Cholesky factor of B
+// ---------------------------------------------
+// When a sequence of pencils shares the same B (e.g., the iterations of a
+// self-consistent field loop), the factorization of B is only performed once.
+// Each call to Eig overwrites A with its reduction to a standard Hermitian
+// eigenvalue problem and, if requested, back-transforms the eigenvectors in
+// place; the subset options of the HermitianEigCtrl are respected.
+template<typename F>
+class HermitianGenDefEigSolver
+{
+public:
+    HermitianGenDefEigSolver();
+    HermitianGenDefEigSolver
+    ( Pencil pencil, UpperOrLower uplo, const Matrix<F>& B );
+
+    // Form (and keep) the Cholesky factor of B, which is left untouched
+    void Initialize( Pencil pencil, UpperOrLower uplo, const Matrix<F>& B );
+
+    HermitianEigInfo Eig
+    ( Matrix<F>& A,
+      Matrix<Base<F>>& w,
+      const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() ) const;
+    HermitianEigInfo Eig
+    ( Matrix<F>& A,
+      Matrix<Base<F>>& w,
+      Matrix<F>& X,
+      const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() ) const;
+
+    bool Initialized() const;
+    Pencil GetPencil() const;
+    UpperOrLower GetUpperOrLower() const;
+    const Matrix<F>& Factor() const;
+
+private:
+    bool initialized_;
+    Pencil pencil_;
+    UpperOrLower uplo_;
+    Matrix<F> factor_;
+};
+
+template<typename F>
+class DistHermitianGenDefEigSolver
+{
+public:
+    DistHermitianGenDefEigSolver( const Grid& g=Grid::Default() );
+    DistHermitianGenDefEigSolver
+    ( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<F>& B );
+
+    // Form (and keep) the Cholesky factor of B, which is left untouched
+    void Initialize
+    ( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<F>& B );
+
+    // A (and X) should be in an [MC,MR] distribution over the grid of B in
+    // order to avoid redistributions
+    HermitianEigInfo Eig
+    ( AbstractDistMatrix<F>& A,
+      AbstractDistMatrix<Base<F>>& w,
+      const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() ) const;
+    HermitianEigInfo Eig
+    ( AbstractDistMatrix<F>& A,
+      AbstractDistMatrix<Base<F>>& w,
+      AbstractDistMatrix<F>& X,
+      const HermitianEigCtrl<F>& ctrl=HermitianEigCtrl<F>() ) const;
+
+    bool Initialized() const;
+    Pencil GetPencil() const;
+    UpperOrLower GetUpperOrLower() const;
+    const DistMatrix<F>& Factor() const;
+
+private:
+    bool initialized_;
+    Pencil pencil_;
+    UpperOrLower uplo_;
+    DistMatrix<F> factor_;
+};
+
 // Polar decomposition
 // ===================
 struct QDWHCtrl
 {
     bool colPiv=false;
     Int maxIts=20;
+
+    // Converge in the lower precision Demote<F> (e.g., float for double)
+    // before finishing in the working precision?
+    bool mixedPrecision=false;
 };
 
 struct PolarCtrl 
@@ -574,6 +757,8 @@ struct QDWHInfo
     Int numIts=0;
     Int numQRIts=0;
     Int numCholIts=0;
+    // The number of iterations in the lower precision (if mixedPrecision)
+    Int numLowIts=0;
 };
 
 struct PolarInfo
@@ -687,6 +872,11 @@ inline Int SufficientDeflation( Int deflationSize )
     return (nibble*deflationSize) / 100;
 }
 
+// The distributed AED solves each deflation window on a square subgrid with
+// (roughly) two blocks per process row and column
+inline Int SubgridDimension( Int deflationSize, Int blockHeight )
+{ return Max( Int(1), deflationSize/(2*blockHeight) ); }
+
 } // namespace aed
 
 } // namespace hess_schur
@@ -734,6 +924,11 @@ struct HessenbergSchurCtrl
     // the distributed multibulge algorithm.
     function<Int(Int)> numBulgesPerBlock =
       function<Int(Int)>(hess_schur::multibulge::NumBulgesPerBlock);
+    // A map from the deflation window size and the block height to the
+    // dimension of the square process subgrid used to solve each AED window
+    // in the distributed algorithm (a value of one implies a redundant solve).
+    function<Int(Int,Int)> aedSubgridDimension =
+      function<Int(Int,Int)>(hess_schur::aed::SubgridDimension);
 };
 
 template<typename F>
@@ -795,6 +990,10 @@ struct SDCCtrl
     Real tol=Real(0);
     Real spreadFactor=Real(1e-6);
     bool random=true;
+    // Split with the inverse-free (QR and matrix multiplication based)
+    // alternative to the sign function, followed by a randomized
+    // rank-revealing decomposition, rather than with the sign function
+    bool inverseFree=false;
     bool progress=false;
 
     SignCtrl<Real> signCtrl;
@@ -1166,6 +1365,23 @@ BidiagSVD
 struct SVDInfo
 {
     BidiagSVDInfo bidiagSVDInfo;
+    Int numJacobiSweeps=0;
+};
+
+template<typename Real>
+struct JacobiSVDCtrl
+{
+    // The columns are orthogonalized in pairs of blocks of roughly this
+    // width, each of which is reduced to a small triangular matrix so that the
+    // accumulated rotations can be applied with matrix-matrix products
+    Int blockSize=32;
+    Int maxSweeps=40;
+
+    // Two columns are treated as orthogonal when the cosine of the angle
+    // between them is at most 'tol' (if zero, sqrt(m) eps is used)
+    Real tol=Real(0);
+
+    bool progress=false;
 };
 
 template<typename Real>
@@ -1191,7 +1407,19 @@ struct SVDCtrl
     // decomposition when computing a full SVD
     double fullChanRatio=1.5;
 
+    // The reduction to bidiagonal form within the distributed SVD
+    BidiagCtrl bidiagCtrl;
+
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
+
+    // One-sided block Jacobi
+    // ----------------------
+
+    // Use one-sided block Jacobi (with a parallel ordering of the column
+    // blocks over the processes) for THIN_SVD, COMPACT_SVD, and FULL_SVD? Its
+    // singular values are computed to high relative accuracy.
+    bool useJacobi=false;
+    JacobiSVDCtrl<Real> jacobiCtrl;
 };
 
 // Compute the singular values
@@ -1217,6 +1445,13 @@ SVDInfo SVD
 ( const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<Base<F>>& s, 
   const SVDCtrl<Base<F>>& ctrl=SVDCtrl<Base<F>>() );
+// Solve each member of the batch over its own sub-grid; 's' must share the
+// layout of 'A'
+template<typename F>
+void SVD
+(       DistMatrixBatch<F>& A,
+        DistMatrixBatch<Base<F>>& s,
+  const SVDCtrl<Base<F>>& ctrl=SVDCtrl<Base<F>>() );
 
 namespace svd {
 
@@ -1229,6 +1464,13 @@ template<typename F>
 SVDInfo TSQR
 ( const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<Base<F>>& s );
+// The same, but reusing the tall-skinny QR storage of a previous call on a
+// matrix of the same shape and distribution
+template<typename F>
+SVDInfo TSQR
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<Base<F>>& s,
+        qr::TreeData<F>& treeData );
 
 template<typename Real,typename=EnableIf<IsReal<Real>>>
 void TwoByTwoUpper
@@ -1296,6 +1538,15 @@ SVDInfo SVD
         AbstractDistMatrix<Base<F>>& s, 
         AbstractDistMatrix<F>& V,
   const SVDCtrl<Base<F>>& ctrl=SVDCtrl<Base<F>>() );
+// Solve each member of the batch over its own sub-grid; 'U', 's', and 'V'
+// must share the layout of 'A'
+template<typename F>
+void SVD
+(       DistMatrixBatch<F>& A,
+        DistMatrixBatch<F>& U,
+        DistMatrixBatch<Base<F>>& s,
+        DistMatrixBatch<F>& V,
+  const SVDCtrl<Base<F>>& ctrl=SVDCtrl<Base<F>>() );
 
 namespace svd {
 
@@ -1305,6 +1556,13 @@ SVDInfo TSQR
         AbstractDistMatrix<F>& U,
         AbstractDistMatrix<Base<F>>& s,
         AbstractDistMatrix<F>& V );
+template<typename F>
+SVDInfo TSQR
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& s,
+        AbstractDistMatrix<F>& V,
+        qr::TreeData<F>& treeData );
 
 } // namespace svd
 
@@ -1473,6 +1731,105 @@ Base<F> ProductLanczosDecomp
         DistMultiVec<F>& v,
         Int basisSize=15 );
 
+// Thick-restart block Lanczos and block Krylov-Schur
+// ===================================================
+// Compute a few eigenpairs of a large (typically sparse) operator which is
+// applied to blocks of vectors at a time. The Hermitian solver (BlockLanczos)
+// uses thick restarts with the wanted Ritz vectors, and the non-Hermitian
+// solver (KrylovSchur) restarts with an orthonormal basis for the wanted
+// Ritz vectors, which is a Schur basis of the projection. Converged
+// (Schur) vectors are locked and deflated from further iterations. The
+// templated-operator versions live in El/lapack_like/spectral/BlockKrylov.hpp.
+
+enum KrylovTarget
+{
+  KRYLOV_LARGEST_MAGNITUDE,
+  KRYLOV_LARGEST_REAL,
+  KRYLOV_SMALLEST_REAL
+};
+
+template<typename Real>
+struct BlockKrylovCtrl
+{
+    Int numWanted=6;
+    // The number of vectors the operator is applied to at once
+    Int blockSize=1;
+    // Zero selects Max(2 numWanted,numWanted+2 blockSize)
+    Int maxBasisSize=0;
+    Int maxRestarts=300;
+    KrylovTarget target=KRYLOV_LARGEST_MAGNITUDE;
+    // A Ritz pair is converged when its residual norm is at most
+    // tol Max(|theta|,eps^(2/3)); zero selects machine epsilon
+    Real tol=Real(0);
+    // If true, the operator is assumed to apply inv(A - shift I), the
+    // eigenvalues of largest magnitude are sought, and they are mapped back to
+    // the (nearest to 'shift') eigenvalues of A. The sparse drivers apply the
+    // inverse with a sparse LDL factorization.
+    bool shiftInvert=false;
+    Real shift=Real(0);
+    bool progress=false;
+};
+
+struct BlockKrylovInfo
+{
+    Int numConverged=0;
+    Int numRestarts=0;
+    Int numBlockApplications=0;
+};
+
+template<typename F>
+BlockKrylovInfo BlockLanczos
+( const SparseMatrix<F>& A,
+        Matrix<Base<F>>& w,
+        Matrix<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl=BlockKrylovCtrl<Base<F>>() );
+template<typename F>
+BlockKrylovInfo BlockLanczos
+( const DistSparseMatrix<F>& A,
+        Matrix<Base<F>>& w,
+        DistMultiVec<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl=BlockKrylovCtrl<Base<F>>() );
+// Shift-invert with an existing factorization of A - ctrl.shift I
+template<typename F>
+BlockKrylovInfo BlockLanczos
+( const SparseLDLFactorization<F>& factorization,
+        Matrix<Base<F>>& w,
+        Matrix<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl );
+template<typename F>
+BlockKrylovInfo BlockLanczos
+( const DistSparseLDLFactorization<F>& factorization,
+        Matrix<Base<F>>& w,
+        DistMultiVec<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl );
+
+template<typename F>
+BlockKrylovInfo KrylovSchur
+( const SparseMatrix<F>& A,
+        Matrix<Complex<Base<F>>>& w,
+        Matrix<Complex<Base<F>>>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl=BlockKrylovCtrl<Base<F>>() );
+template<typename F>
+BlockKrylovInfo KrylovSchur
+( const DistSparseMatrix<F>& A,
+        Matrix<Complex<Base<F>>>& w,
+        DistMultiVec<Complex<Base<F>>>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl=BlockKrylovCtrl<Base<F>>() );
+// Shift-invert with an existing (symmetric, but not necessarily Hermitian)
+// factorization of A - ctrl.shift I
+template<typename Real>
+BlockKrylovInfo KrylovSchur
+( const SparseLDLFactorization<Complex<Real>>& factorization,
+        Matrix<Complex<Real>>& w,
+        Matrix<Complex<Real>>& X,
+  const BlockKrylovCtrl<Real>& ctrl );
+template<typename Real>
+BlockKrylovInfo KrylovSchur
+( const DistSparseLDLFactorization<Complex<Real>>& factorization,
+        Matrix<Complex<Real>>& w,
+        DistMultiVec<Complex<Real>>& X,
+  const BlockKrylovCtrl<Real>& ctrl );
+
 // Extremal singular value estimates
 // =================================
 // Form a product Lanczos decomposition and use the square-roots of the 
@@ -1558,6 +1915,21 @@ struct PseudospecCtrl
 
     SnapshotCtrl snapCtrl;
 
+    // Adaptive refinement of spectral windows and portraits. If 'contours'
+    // is nonempty, the grid is first sampled every 2^refineLevels pixels, and
+    // a cell is only subdivided if log10 of the inverse norm might cross
+    // log10(1/eps), to within 'refineMargin', for one of the contour levels
+    // eps. The inverse norms of the remaining pixels are interpolated (and
+    // their iteration counts are zero).
+    vector<Real> contours;
+    Int refineLevels=3;
+    Real refineMargin=Real(0.25);
+
+    // If positive, the shifts of a distributed cloud are split into batches
+    // which are each handled independently by a sub-grid of this many
+    // processes holding its own copy of the (reduced) matrix
+    int shiftGroupSize=0;
+
     mutable Complex<Real> center = Complex<Real>(0);
     mutable Real realWidth=Real(0), imagWidth=Real(0);
 };
@@ -1954,6 +2326,100 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
         ElementalMatrix<Base<F>>& invNorms,
         PseudospecCtrl<Base<F>> psCtrl=PseudospecCtrl<Base<F>>() );
 
+// Batches of small dense problems
+// ===============================
+// Member k of a batch of 'numMatrices' matrices is stored in a single buffer
+// starting at offset k*stride, with the given leading dimension (and the
+// eigenvalues or singular values of member k start at offset k*stride of
+// their own buffer).
+//
+// Problems of order at most 'jacobiCutoff' are solved with cyclic Jacobi
+// applied to chunks of 'batch::NUM_LANES' members at once, which are
+// interleaved so that each SIMD lane holds a different member, and the chunks
+// are threaded over when EL_HYBRID is defined. Larger problems (and the
+// Schur decompositions) call the standard dense routines one member at a
+// time so that they may use a threaded BLAS.
+template<typename F>
+struct BatchSpectralCtrl
+{
+    Int jacobiCutoff=32;
+    Int maxSweeps=30;
+
+    // Off-diagonal entries (or column cosines) at most this size relative to
+    // the Frobenius norm of the member (or the column norms) are ignored; zero
+    // selects the unit roundoff
+    Base<F> tol=Base<F>(0);
+
+    HermitianEigCtrl<F> hermEigCtrl;
+    SVDCtrl<Base<F>> svdCtrl;
+    SchurCtrl<Base<F>> schurCtrl;
+};
+
+namespace batch {
+
+// The number of batch members handled by each call of a Jacobi kernel
+const Int NUM_LANES = 8;
+
+} // namespace batch
+
+// The eigenvalues are returned in ascending order, and A is overwritten
+template<typename F>
+void HermitianEigBatch
+( UpperOrLower uplo,
+  Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Base<F>* w, Int wStride,
+  const BatchSpectralCtrl<F>& ctrl=BatchSpectralCtrl<F>() );
+template<typename F>
+void HermitianEigBatch
+( UpperOrLower uplo,
+  Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Base<F>* w, Int wStride,
+  F* Q, Int QLDim, Int QStride,
+  const BatchSpectralCtrl<F>& ctrl=BatchSpectralCtrl<F>() );
+
+// The Min(m,n) singular values are returned in descending order, along with
+// the thin factors U (m x Min(m,n)) and V (n x Min(m,n))
+template<typename F>
+void SVDBatch
+( Int m,
+  Int n,
+  Int numMatrices,
+  const F* A, Int ALDim, Int AStride,
+  Base<F>* s, Int sStride,
+  const BatchSpectralCtrl<F>& ctrl=BatchSpectralCtrl<F>() );
+template<typename F>
+void SVDBatch
+( Int m,
+  Int n,
+  Int numMatrices,
+  const F* A, Int ALDim, Int AStride,
+  F* U, Int ULDim, Int UStride,
+  Base<F>* s, Int sStride,
+  F* V, Int VLDim, Int VStride,
+  const BatchSpectralCtrl<F>& ctrl=BatchSpectralCtrl<F>() );
+
+// There is no Jacobi analogue for the Schur decomposition, so each member is
+// handled by Schur (and A is overwritten with its Schur form)
+template<typename F>
+void SchurBatch
+( Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Complex<Base<F>>* w, Int wStride,
+  const BatchSpectralCtrl<F>& ctrl=BatchSpectralCtrl<F>() );
+template<typename F>
+void SchurBatch
+( Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Complex<Base<F>>* w, Int wStride,
+  F* Q, Int QLDim, Int QStride,
+  const BatchSpectralCtrl<F>& ctrl=BatchSpectralCtrl<F>() );
+
 } // namespace El
 
 #include <El/lapack_like/spectral/Schur.hpp>
@@ -1961,5 +2427,6 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 #include <El/lapack_like/spectral/SVD.hpp>
 #include <El/lapack_like/spectral/Lanczos.hpp>
 #include <El/lapack_like/spectral/ProductLanczos.hpp>
+#include <El/lapack_like/spectral/BlockKrylov.hpp>
 
 #endif // ifndef EL_SPECTRAL_HPP
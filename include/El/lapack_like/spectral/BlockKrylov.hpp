@@ -0,0 +1,605 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_BLOCKKRYLOV_HPP
+#define EL_SPECTRAL_BLOCKKRYLOV_HPP
+
+namespace El {
+
+// Both solvers maintain a block Krylov decomposition
+//
+//   A V = V H + W R E^H,
+//
+// where V has orthonormal columns, W is the (orthonormal) residual block, and
+// E selects the last block of V. The first columns of V are locked (converged)
+// Ritz (or Schur) vectors, and only the trailing, active, portion of H is used
+// for the Rayleigh-Ritz projections. Each new block is orthogonalized against
+// the entire basis with classical Gram-Schmidt followed by SVQB (an
+// eigendecomposition of the block's Gram matrix), repeated twice, so that the
+// projection H can be assembled directly from the orthogonalization
+// coefficients.
+//
+// The cores operate on the local rows of the basis, with the inner products
+// summed over 'comm', so that both Matrix and DistMultiVec blocks are
+// supported.
+
+namespace krylov {
+
+template<typename F>
+void InnerProducts
+( const Matrix<F>& V,
+  const Matrix<F>& W,
+        Matrix<F>& C,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    C.Resize( V.Width(), W.Width() );
+    Gemm( ADJOINT, NORMAL, F(1), V, W, F(0), C );
+    AllReduce( C, comm );
+}
+
+// Overwrite W with an orthonormal basis for the portion of its column space
+// orthogonal to the (orthonormal) columns of V, so that
+//
+//   W_orig = V C + W R.
+//
+// Directions in which W is numerically dependent are replaced with random
+// ones (which have zero rows in R) when there is room for them, and are
+// otherwise zeroed.
+template<typename F>
+void Orthonormalize
+( const Matrix<F>& V,
+        Matrix<F>& W,
+        Matrix<F>& C,
+        Matrix<F>& R,
+        Int n,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int b = W.Width();
+    const bool canReplace = ( V.Width()+b <= n );
+
+    Matrix<F> CPass, G, U, WU, RPass;
+    Matrix<Real> lambda;
+    Zeros( C, V.Width(), b );
+    Identity( R, b, b );
+
+    InnerProducts( W, W, G, comm );
+    Real normW = 0;
+    for( Int j=0; j<b; ++j )
+        normW += RealPart(G(j,j));
+    normW = Sqrt( normW );
+
+    const Int maxPasses = 4;
+    for( Int pass=0; pass<maxPasses; ++pass )
+    {
+        // W := W - V (V^H W), with C := C + (V^H W) R
+        if( V.Width() > 0 )
+        {
+            InnerProducts( V, W, CPass, comm );
+            Gemm( NORMAL, NORMAL, F(-1), V, CPass, F(1), W );
+            Gemm( NORMAL, NORMAL, F(1), CPass, R, F(1), C );
+        }
+
+        // W := W U inv(sqrt(Lambda)), R := sqrt(Lambda) U^H R, where
+        // W^H W = U Lambda U^H
+        InnerProducts( W, W, G, comm );
+        HermitianEig( LOWER, G, lambda, U );
+        Gemm( NORMAL, NORMAL, F(1), W, U, WU );
+        W = WU;
+        bool deficient = false, orthonormal = true;
+        for( Int j=0; j<b; ++j )
+        {
+            const Real lambdaj = Max( lambda(j), Real(0) );
+            if( lambdaj <= eps*eps*normW*normW || lambdaj == Real(0) )
+            {
+                deficient = true;
+                auto wj = W( ALL, IR(j) );
+                if( canReplace )
+                    MakeGaussian( wj );
+                else
+                    Zero( wj );
+                lambda(j) = 0;
+            }
+            else
+            {
+                auto wj = W( ALL, IR(j) );
+                wj *= F(1)/Sqrt(lambdaj);
+                lambda(j) = Sqrt(lambdaj);
+                if( Abs(lambdaj-Real(1)) > Real(1)/Real(2) )
+                    orthonormal = false;
+            }
+        }
+        Adjoint( U, RPass );
+        DiagonalScale( LEFT, NORMAL, lambda, RPass );
+        auto RCopy( R );
+        Gemm( NORMAL, NORMAL, F(1), RPass, RCopy, F(0), R );
+        if( !canReplace && deficient )
+            deficient = false;
+        if( pass > 0 && !deficient && orthonormal )
+            break;
+    }
+}
+
+// Return the indices of the Ritz values in order of decreasing preference
+template<typename F>
+vector<Int> TargetOrder( const Matrix<F>& theta, KrylovTarget target )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int k = theta.Height();
+    vector<pair<Real,Int>> keys(k);
+    for( Int i=0; i<k; ++i )
+    {
+        Real key;
+        if( target == KRYLOV_LARGEST_MAGNITUDE )
+            key = -Abs(theta(i));
+        else if( target == KRYLOV_LARGEST_REAL )
+            key = -RealPart(theta(i));
+        else
+            key = RealPart(theta(i));
+        keys[i] = pair<Real,Int>(key,i);
+    }
+    std::sort( keys.begin(), keys.end() );
+    vector<Int> order(k);
+    for( Int i=0; i<k; ++i )
+        order[i] = keys[i].second;
+    return order;
+}
+
+template<typename Real>
+void CheckSizes
+( Int n,
+  const BlockKrylovCtrl<Real>& ctrl,
+        Int& numWanted,
+        Int& blockSize,
+        Int& maxBasis )
+{
+    DEBUG_CSE
+    numWanted = ctrl.numWanted;
+    blockSize = ctrl.blockSize;
+    if( numWanted < 1 || blockSize < 1 )
+        LogicError("Must request at least one eigenpair with blocks of at "
+                   "least one vector");
+    maxBasis =
+      ( ctrl.maxBasisSize > 0 ? ctrl.maxBasisSize :
+        Max(2*numWanted,numWanted+2*blockSize) );
+    maxBasis = Min( maxBasis, n );
+    if( maxBasis < numWanted+2*blockSize )
+        LogicError
+        ("The basis size of ",maxBasis," must be at least numWanted+2 blockSize"
+         " = ",numWanted+2*blockSize);
+}
+
+// Start the iteration from a random block
+template<typename F>
+void StartBasis
+( Matrix<F>& V, Int blockSize, Int n, mpi::Comm comm )
+{
+    DEBUG_CSE
+    Matrix<F> W, C, R;
+    Gaussian( W, V.Height(), blockSize );
+    Orthonormalize( V(ALL,IR(0,0)), W, C, R, n, comm );
+    auto VStart = V( ALL, IR(0,blockSize) );
+    VStart = W;
+}
+
+template<typename F,class ApplyAType>
+BlockKrylovInfo LanczosCore
+(       Int n,
+        mpi::Comm comm,
+  const ApplyAType& applyA,
+        Matrix<Base<F>>& w,
+        Matrix<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol == Real(0) ? eps : ctrl.tol );
+    const Real minScale = Pow( eps, Real(2)/Real(3) );
+    const KrylovTarget target =
+      ( ctrl.shiftInvert ? KRYLOV_LARGEST_MAGNITUDE : ctrl.target );
+    const Int localHeight = X.Height();
+    Int numWanted, b, maxBasis;
+    CheckSizes( n, ctrl, numWanted, b, maxBasis );
+
+    BlockKrylovInfo info;
+    Matrix<F> V, W, C, R, T, TActive, Z, RZ, ZSel, Y;
+    Matrix<Real> theta, residuals;
+    Zeros( V, localHeight, maxBasis );
+    Zeros( T, maxBasis, maxBasis );
+    StartBasis( V, b, n, comm );
+    Int numLocked=0, lastBlock=0, k=b;
+    while( true )
+    {
+        // Expand the basis a block at a time until there is no room left
+        while( true )
+        {
+            applyA( V(ALL,IR(lastBlock,k)), W );
+            ++info.numBlockApplications;
+            Orthonormalize( V(ALL,IR(0,k)), W, C, R, n, comm );
+            // Since A is Hermitian, C holds both a column block and (the
+            // adjoint of) a row block of the projection
+            for( Int j=lastBlock; j<k; ++j )
+            {
+                for( Int i=0; i<lastBlock; ++i )
+                {
+                    T(i,j) = C(i,j-lastBlock);
+                    T(j,i) = Conj(C(i,j-lastBlock));
+                }
+                for( Int i=lastBlock; i<k; ++i )
+                    T(i,j) = (C(i,j-lastBlock)+Conj(C(j,i-lastBlock)))/F(2);
+            }
+            if( k+b > maxBasis )
+                break;
+            auto VNext = V( ALL, IR(k,k+b) );
+            VNext = W;
+            lastBlock = k;
+            k += b;
+        }
+
+        // Rayleigh-Ritz on the active portion of the basis, where the residual
+        // of Ritz pair i is || R Z(lastRows,i) ||_2
+        const Int numActive = k - numLocked;
+        TActive = T( IR(numLocked,k), IR(numLocked,k) );
+        HermitianEig( LOWER, TActive, theta, Z );
+        Gemm
+        ( NORMAL, NORMAL, F(1), R, Z(IR(lastBlock-numLocked,numActive),ALL),
+          F(0), RZ );
+        ColumnTwoNorms( RZ, residuals );
+        const auto order = TargetOrder( theta, target );
+
+        const Int numRemaining = numWanted - numLocked;
+        vector<Int> sel;
+        for( Int t=0; t<numRemaining; ++t )
+        {
+            const Int i = order[t];
+            if( residuals(i) <= tol*Max(Abs(theta(i)),minScale) )
+                sel.push_back( i );
+        }
+        const Int numNewlyLocked = sel.size();
+        info.numConverged = numLocked + numNewlyLocked;
+        if( ctrl.progress )
+            Output
+            ("restart ",info.numRestarts,": ",info.numConverged," of ",
+             numWanted," converged");
+        const bool finished =
+          info.numConverged == numWanted ||
+          info.numRestarts == ctrl.maxRestarts;
+
+        // Keep the newly converged Ritz vectors followed (unless finished)
+        // by the most wanted of the remaining ones
+        if( !finished )
+        {
+            const Int numKeep =
+              Min
+              ( numRemaining + (numActive-numRemaining)/2,
+                maxBasis - numLocked - 2*b );
+            for( Int t=0; t<numActive && Int(sel.size())<numKeep; ++t )
+                if( std::find(sel.begin(),sel.end(),order[t]) == sel.end() )
+                    sel.push_back( order[t] );
+        }
+        const Int numKeep = sel.size();
+        ZSel.Resize( numActive, numKeep );
+        for( Int t=0; t<numKeep; ++t )
+        {
+            auto zSel = ZSel( ALL, IR(t) );
+            zSel = Z( ALL, IR(sel[t]) );
+        }
+        Gemm( NORMAL, NORMAL, F(1), V(ALL,IR(numLocked,k)), ZSel, F(0), Y );
+        auto VKeep = V( ALL, IR(numLocked,numLocked+numKeep) );
+        VKeep = Y;
+        auto TTrail = T( IR(numLocked,maxBasis), ALL );
+        Zero( TTrail );
+        auto TRight = T( ALL, IR(numLocked,maxBasis) );
+        Zero( TRight );
+        for( Int t=0; t<numKeep; ++t )
+            T(numLocked+t,numLocked+t) = theta(sel[t]);
+        numLocked += numNewlyLocked;
+        if( finished )
+            break;
+
+        // Thick restart with the residual block, whose coupling with the kept
+        // Ritz vectors is recomputed by the next orthogonalization
+        const Int p = numLocked + (numKeep-numNewlyLocked);
+        auto VResid = V( ALL, IR(p,p+b) );
+        VResid = W;
+        lastBlock = p;
+        k = p + b;
+        ++info.numRestarts;
+    }
+
+    // Return the locked pairs in order of preference
+    Matrix<Real> lockedValues( numLocked, 1 );
+    for( Int i=0; i<numLocked; ++i )
+        lockedValues(i) = RealPart(T(i,i));
+    const auto order = TargetOrder( lockedValues, target );
+    w.Resize( numLocked, 1 );
+    X.Resize( localHeight, numLocked );
+    for( Int t=0; t<numLocked; ++t )
+    {
+        const Int i = order[t];
+        w(t) = ( ctrl.shiftInvert ? ctrl.shift + Real(1)/lockedValues(i) :
+                                    lockedValues(i) );
+        auto x = X( ALL, IR(t) );
+        x = V( ALL, IR(i) );
+    }
+    return info;
+}
+
+// F must be complex
+template<typename F,class ApplyAType>
+BlockKrylovInfo SchurCore
+(       Int n,
+        mpi::Comm comm,
+  const ApplyAType& applyA,
+        Matrix<F>& w,
+        Matrix<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol == Real(0) ? eps : ctrl.tol );
+    const Real minScale = Pow( eps, Real(2)/Real(3) );
+    const KrylovTarget target =
+      ( ctrl.shiftInvert ? KRYLOV_LARGEST_MAGNITUDE : ctrl.target );
+    const Int localHeight = X.Height();
+    Int numWanted, b, maxBasis;
+    CheckSizes( n, ctrl, numWanted, b, maxBasis );
+
+    BlockKrylovInfo info;
+    Matrix<F> V, W, C, R, H, HActive, theta, Z, RZ, Q, QH, HQ, Y;
+    Matrix<Real> residuals;
+    Zeros( V, localHeight, maxBasis );
+    Zeros( H, maxBasis, maxBasis );
+    StartBasis( V, b, n, comm );
+    Int numLocked=0, lastBlock=0, k=b;
+    while( true )
+    {
+        while( true )
+        {
+            applyA( V(ALL,IR(lastBlock,k)), W );
+            ++info.numBlockApplications;
+            Orthonormalize( V(ALL,IR(0,k)), W, C, R, n, comm );
+            auto HCol = H( IR(0,k), IR(lastBlock,k) );
+            HCol = C;
+            if( k+b > maxBasis )
+                break;
+            auto HSub = H( IR(k,k+b), IR(lastBlock,k) );
+            HSub = R;
+            auto VNext = V( ALL, IR(k,k+b) );
+            VNext = W;
+            lastBlock = k;
+            k += b;
+        }
+
+        // Rayleigh-Ritz on the active portion of the basis with normalized
+        // Ritz vectors
+        const Int numActive = k - numLocked;
+        HActive = H( IR(numLocked,k), IR(numLocked,k) );
+        Eig( HActive, theta, Z );
+        for( Int i=0; i<numActive; ++i )
+        {
+            auto z = Z( ALL, IR(i) );
+            z *= F(1)/FrobeniusNorm(z);
+        }
+        Gemm
+        ( NORMAL, NORMAL, F(1), R, Z(IR(lastBlock-numLocked,numActive),ALL),
+          F(0), RZ );
+        ColumnTwoNorms( RZ, residuals );
+        const auto order = TargetOrder( theta, target );
+
+        const Int numRemaining = numWanted - numLocked;
+        vector<Int> sel;
+        for( Int t=0; t<numRemaining; ++t )
+        {
+            const Int i = order[t];
+            if( residuals(i) <= tol*Max(Abs(theta(i)),minScale) )
+                sel.push_back( i );
+        }
+        const Int numNewlyLocked = sel.size();
+        info.numConverged = numLocked + numNewlyLocked;
+        if( ctrl.progress )
+            Output
+            ("restart ",info.numRestarts,": ",info.numConverged," of ",
+             numWanted," converged");
+        const bool finished =
+          info.numConverged == numWanted ||
+          info.numRestarts == ctrl.maxRestarts;
+        if( !finished )
+        {
+            const Int numKeep =
+              Min
+              ( numRemaining + (numActive-numRemaining)/2,
+                maxBasis - numLocked - 2*b );
+            for( Int t=0; t<numActive && Int(sel.size())<numKeep; ++t )
+                if( std::find(sel.begin(),sel.end(),order[t]) == sel.end() )
+                    sel.push_back( order[t] );
+        }
+
+        // Since the span of each leading subset of the selected Ritz vectors
+        // is invariant under the active projection, an orthonormal basis for
+        // them (in order) is a Schur basis: Q^H H_active Q is upper triangular
+        // up to the convergence of the Ritz vectors
+        const Int numKeep = sel.size();
+        Q.Resize( numActive, numKeep );
+        for( Int t=0; t<numKeep; ++t )
+        {
+            auto q = Q( ALL, IR(t) );
+            q = Z( ALL, IR(sel[t]) );
+        }
+        qr::ExplicitUnitary( Q );
+        HActive = H( IR(numLocked,k), IR(numLocked,k) );
+        Gemm( NORMAL, NORMAL, F(1), HActive, Q, F(0), HQ );
+        Gemm( ADJOINT, NORMAL, F(1), Q, HQ, F(0), QH );
+        Matrix<F> HLockedActive;
+        Gemm
+        ( NORMAL, NORMAL, F(1), H(IR(0,numLocked),IR(numLocked,k)), Q,
+          F(0), HLockedActive );
+        Gemm( NORMAL, NORMAL, F(1), V(ALL,IR(numLocked,k)), Q, F(0), Y );
+
+        auto VKeep = V( ALL, IR(numLocked,numLocked+numKeep) );
+        VKeep = Y;
+        auto HTrail = H( IR(numLocked,maxBasis), ALL );
+        Zero( HTrail );
+        auto HRight = H( ALL, IR(numLocked,maxBasis) );
+        Zero( HRight );
+        auto HLockedKeep = H( IR(0,numLocked), IR(numLocked,numLocked+numKeep) );
+        HLockedKeep = HLockedActive;
+        auto HKeep =
+          H( IR(numLocked,numLocked+numKeep), IR(numLocked,numLocked+numKeep) );
+        HKeep = QH;
+        // The newly locked Schur vectors are decoupled from the active ones
+        auto HDecoupled =
+          H( IR(numLocked+numNewlyLocked,numLocked+numKeep),
+             IR(numLocked,numLocked+numNewlyLocked) );
+        Zero( HDecoupled );
+        numLocked += numNewlyLocked;
+        if( finished )
+            break;
+
+        // Restart with the residual block, whose coupling with the kept
+        // vectors is R Q(lastRows,:)
+        const Int p = numLocked + (numKeep-numNewlyLocked);
+        auto VResid = V( ALL, IR(p,p+b) );
+        VResid = W;
+        auto HResid = H( IR(p,p+b), IR(numLocked,p) );
+        Gemm
+        ( NORMAL, NORMAL, F(1), R,
+          Q(IR(lastBlock-(numLocked-numNewlyLocked),numActive),
+            IR(numNewlyLocked,numKeep)),
+          F(0), HResid );
+        lastBlock = p;
+        k = p + b;
+        ++info.numRestarts;
+    }
+
+    // The eigenvectors of the locked (upper-triangular) Schur form map to
+    // eigenvectors of A
+    Matrix<F> S( H(IR(0,numLocked),IR(0,numLocked)) ), lockedValues, ZLocked;
+    MakeTrapezoidal( UPPER, S );
+    Eig( S, lockedValues, ZLocked );
+    for( Int i=0; i<numLocked; ++i )
+    {
+        auto z = ZLocked( ALL, IR(i) );
+        z *= F(1)/FrobeniusNorm(z);
+    }
+    Gemm( NORMAL, NORMAL, F(1), V(ALL,IR(0,numLocked)), ZLocked, F(0), Y );
+    const auto order = TargetOrder( lockedValues, target );
+    w.Resize( numLocked, 1 );
+    X.Resize( localHeight, numLocked );
+    for( Int t=0; t<numLocked; ++t )
+    {
+        const Int i = order[t];
+        w(t) = ( ctrl.shiftInvert ? F(ctrl.shift) + F(1)/lockedValues(i) :
+                                    lockedValues(i) );
+        auto x = X( ALL, IR(t) );
+        x = Y( ALL, IR(i) );
+    }
+    return info;
+}
+
+// Run a core over the local rows of DistMultiVec blocks
+template<typename F,class ApplyAType>
+function<void(const Matrix<F>&,Matrix<F>&)>
+LocalApplication
+( Int n,
+  const ApplyAType& applyA,
+  DistMultiVec<F>& XBlock,
+  DistMultiVec<F>& YBlock )
+{
+    return
+      [&applyA,&XBlock,&YBlock,n]( const Matrix<F>& XLoc, Matrix<F>& YLoc )
+      {
+          XBlock.Resize( n, XLoc.Width() );
+          XBlock.Matrix() = XLoc;
+          applyA( XBlock, YBlock );
+          YLoc = YBlock.LockedMatrix();
+      };
+}
+
+} // namespace krylov
+
+// The operator is applied as applyA( X, Y ), i.e., Y := A X, where A is
+// Hermitian
+template<typename F,class ApplyAType>
+BlockKrylovInfo BlockLanczos
+(       Int n,
+  const ApplyAType& applyA,
+        Matrix<Base<F>>& w,
+        Matrix<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl=BlockKrylovCtrl<Base<F>>() )
+{
+    DEBUG_CSE
+    X.Resize( n, 0 );
+    return krylov::LanczosCore<F>( n, mpi::COMM_SELF, applyA, w, X, ctrl );
+}
+
+// X must be configured with the communicator of the operator
+template<typename F,class ApplyAType>
+BlockKrylovInfo BlockLanczos
+(       Int n,
+  const ApplyAType& applyA,
+        Matrix<Base<F>>& w,
+        DistMultiVec<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl=BlockKrylovCtrl<Base<F>>() )
+{
+    DEBUG_CSE
+    mpi::Comm comm = X.Comm();
+    X.Resize( n, 0 );
+    DistMultiVec<F> XBlock(comm), YBlock(comm);
+    auto applyLocal = krylov::LocalApplication( n, applyA, XBlock, YBlock );
+    Matrix<F> XLoc( X.LocalHeight(), 0 );
+    auto info = krylov::LanczosCore<F>( n, comm, applyLocal, w, XLoc, ctrl );
+    X.Resize( n, XLoc.Width() );
+    X.Matrix() = XLoc;
+    return info;
+}
+
+template<typename Real,class ApplyAType>
+BlockKrylovInfo KrylovSchur
+(       Int n,
+  const ApplyAType& applyA,
+        Matrix<Complex<Real>>& w,
+        Matrix<Complex<Real>>& X,
+  const BlockKrylovCtrl<Real>& ctrl=BlockKrylovCtrl<Real>() )
+{
+    DEBUG_CSE
+    X.Resize( n, 0 );
+    return krylov::SchurCore<Complex<Real>>
+      ( n, mpi::COMM_SELF, applyA, w, X, ctrl );
+}
+
+template<typename Real,class ApplyAType>
+BlockKrylovInfo KrylovSchur
+(       Int n,
+  const ApplyAType& applyA,
+        Matrix<Complex<Real>>& w,
+        DistMultiVec<Complex<Real>>& X,
+  const BlockKrylovCtrl<Real>& ctrl=BlockKrylovCtrl<Real>() )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    mpi::Comm comm = X.Comm();
+    X.Resize( n, 0 );
+    DistMultiVec<C> XBlock(comm), YBlock(comm);
+    auto applyLocal = krylov::LocalApplication( n, applyA, XBlock, YBlock );
+    Matrix<C> XLoc( X.LocalHeight(), 0 );
+    auto info = krylov::SchurCore<C>( n, comm, applyLocal, w, XLoc, ctrl );
+    X.Resize( n, XLoc.Width() );
+    X.Matrix() = XLoc;
+    return info;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_BLOCKKRYLOV_HPP
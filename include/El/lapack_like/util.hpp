@@ -25,9 +25,18 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // Relaxed supernode amalgamation of the sequential part of the tree:
+    // a child is merged into its parent if the merged supernode has at most
+    // 'amalgamateSize' indices or if at most a fraction 'amalgamateFillTol'
+    // of the merged front's lower triangle would be explicit zeros.
+    bool amalgamate;
+    Int amalgamateSize;
+    double amalgamateFillTol;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false),
+      amalgamate(false), amalgamateSize(16), amalgamateFillTol(0.05)
     { }
 };
 
@@ -46,6 +55,16 @@ Int Bisect
         bool& onLeft,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// A native multilevel bisection of a distributed graph, which Bisect uses
+// for non-sequential partitions when ParMETIS is not available
+// NOTE: for two or more processes
+Int MultilevelBisect
+( const DistGraph& graph,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 Int NaturalBisect
 ( Int nx, Int ny, Int nz,
   const Graph& graph,
@@ -73,6 +92,76 @@ void BuildChildFromPerm
   Int leftChildSize, Int rightChildSize,
   bool& onLeft, DistGraph& child );
 
+// Graph analysis
+// ==============
+// The following assume that the edges of the graph are stored symmetrically
+// and ignore any targets outside of the range of the sources.
+
+// Label each vertex with the index of its connected component, where the
+// components are numbered in order of their smallest vertex, and return the
+// number of components. The distributed version propagates the minimum label
+// between processes, with a single exchange of the labels of the non-local
+// neighbors per round.
+Int ConnectedComponents( const Graph& graph, vector<Int>& components );
+Int ConnectedComponents( const DistGraph& graph, DistMap& components );
+
+// A Reverse Cuthill-McKee ordering (started from a pseudo-peripheral vertex
+// of each component), where perm[i] is the new index of vertex i.
+// NOTE: The distributed version gathers the graph onto every process.
+void ReverseCuthillMcKee( const Graph& graph, vector<Int>& perm );
+void ReverseCuthillMcKee( const DistGraph& graph, DistMap& perm );
+
+// Repartitioning
+// ==============
+// Distributed sparse matrices (and vectors) assign contiguous blocks of rows
+// to the processes, which, for irregular matrices, can lead to large
+// communication volumes and load imbalance. Repartition symmetrically
+// relabels the rows and columns of a square matrix with a nested dissection
+// of the graph of A + A^T so that the processes' blocks of rows correspond
+// to the subdomains of the dissection.
+//
+// 'map' takes each original index to its new index and 'invMap' takes it
+// back, so that the solution x of A x = b may be recovered from the solution
+// of the repartitioned system via
+//
+//   ApplyRepartition( info, b, bNew );
+//   ... solve ANew xNew = bNew ...
+//   RevertRepartition( info, xNew, x );
+//
+// The edge cut counts the off-diagonal nonzeros whose row and column are owned
+// by different processes, and the imbalance is that of DistSparseMatrix.
+struct RepartitionInfo
+{
+    DistMap map, invMap;
+    Int edgeCutBefore=0, edgeCutAfter=0;
+    double imbalanceBefore=1, imbalanceAfter=1;
+
+    RepartitionInfo() { }
+    RepartitionInfo( const RepartitionInfo& info ) = delete;
+    const RepartitionInfo& operator=( const RepartitionInfo& info ) = delete;
+};
+
+template<typename T>
+void Repartition
+( const DistSparseMatrix<T>& A,
+        DistSparseMatrix<T>& ANew,
+        RepartitionInfo& info,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// XNew(map(i),:) := X(i,:)
+template<typename T>
+void ApplyRepartition
+( const RepartitionInfo& info,
+  const DistMultiVec<T>& X,
+        DistMultiVec<T>& XNew );
+
+// X(i,:) := XNew(map(i),:)
+template<typename T>
+void RevertRepartition
+( const RepartitionInfo& info,
+  const DistMultiVec<T>& XNew,
+        DistMultiVec<T>& X );
+
 // Median
 // ======
 template<typename Real,typename=DisableIf<IsComplex<Real>>>
@@ -127,6 +216,27 @@ void MergeSortingPermutation
 ( Int n0, Int n1, const Matrix<Real>& x, Permutation& sortPerm,
   SortType sort=ASCENDING );
 
+// Autotuning
+// ==========
+struct AutotuneCtrl
+{
+    vector<Int> blocksizes{ 32, 64, 96, 128, 192, 256 };
+    // Whether to also benchmark the algorithm variants of Gemm, Trsm, and
+    // HermitianTridiag (otherwise only the default heuristics are used)
+    bool tuneVariants=true;
+    Int numReps=3;
+    bool progress=false;
+};
+
+// Benchmarks each candidate configuration of the given kernel on a random
+// n x n double-precision problem distributed over the grid, records the
+// fastest (as measured by the slowest process) in the tuning table, and
+// returns it. The table may then be persisted with SaveTuning.
+TuningEntry Autotune
+( TunedKernel kernel, Int n,
+  const Grid& grid=Grid::Default(),
+  const AutotuneCtrl& ctrl=AutotuneCtrl() );
+
 } // namespace El
 
 #endif // ifndef EL_UTIL_HPP
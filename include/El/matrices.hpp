@@ -776,6 +776,229 @@ void Wigner( Matrix<F>& A, Int n, F mean=0, Base<F> stddev=1 );
 template<typename F>
 void Wigner( ElementalMatrix<F>& A, Int n, F mean=0, Base<F> stddev=1 );
 
+// Sketching operators
+// ===================
+// A random sketchSize x n embedding, S, which is applied from the left,
+// Y := S A, without being formed. The embedding is a pure function of its
+// type, dimensions, and counter-based random stream, so that it can be
+// reapplied (e.g., to the columns of a second matrix) and so that no
+// communication is required to agree upon it.
+//
+//   GAUSSIAN_SKETCH:    i.i.d. normal entries scaled by 1/sqrt(sketchSize)
+//   SRFT_SKETCH:        sqrt(N/sketchSize) R H D, where D holds random signs,
+//                       H is the unitary Walsh-Hadamard transform of order
+//                       N=2^k >= n (see Walsh), and R samples sketchSize
+//                       rows without replacement; O(N log N) per column
+//   FOURIER_SKETCH:     the same with H the unitary discrete Fourier
+//                       transform of order N (see Fourier); complex only
+//   SPARSE_SIGN_SKETCH: 'sparsity' random signs in each column, scaled by
+//                       1/sqrt(sparsity); O(sparsity) per entry of A
+//   COUNT_SKETCH:       a single random sign in each column; O(1) per entry
+struct SketchOperator
+{
+    SketchType type=GAUSSIAN_SKETCH;
+    Int height=0; // the sketch size
+    Int width=0;  // the height of the sketched matrices
+    Int sparsity=8;
+    std::uint64_t stream=0;
+};
+
+// An embedding drawn independently by each process
+SketchOperator MakeSketch
+( SketchType type, Int sketchSize, Int n, Int sparsity=8 );
+// An embedding shared by every process in the grid (the call is collective
+// in the sense that each process must make it in the same order)
+SketchOperator MakeSketch
+( SketchType type, Int sketchSize, Int n, const Grid& grid,
+  Int sparsity=8 );
+
+namespace sketch {
+
+// Y := S A
+template<typename F>
+void Apply( const Matrix<F>& A, const SketchOperator& S, Matrix<F>& Y );
+template<typename F>
+void Apply
+( const ElementalMatrix<F>& A, const SketchOperator& S,
+  ElementalMatrix<F>& Y );
+template<typename F>
+void Apply
+( const SparseMatrix<F>& A, const SketchOperator& S, Matrix<F>& Y );
+template<typename F>
+void Apply
+( const DistSparseMatrix<F>& A, const SketchOperator& S,
+  ElementalMatrix<F>& Y );
+
+} // namespace sketch
+
+// Fast transforms
+// ===============
+// In-place, unnormalized radix-two FFTs of each column of X, whose height
+// must be a power of two, with the sign convention of Fourier (the inverse
+// transform instead uses the conjugate roots of unity)
+template<typename Real>
+void FFT( Matrix<Complex<Real>>& X, bool inverse=false );
+
+// In-place, unnormalized fast Walsh-Hadamard transform of each column of X,
+// whose height must be a power of two (see Walsh)
+template<typename F>
+void WalshHadamard( Matrix<F>& X );
+
+// Fast structured operators
+// =========================
+// Implicit representations of the Toeplitz, Hankel, circulant, Fourier, and
+// Walsh matrices which are applied in O(N log N) work per column (with N the
+// length of the underlying power-of-two transform) rather than being formed.
+// Each provides Y := op(A) X through Apply, and Y := A X through operator(),
+// so that it can be passed as the 'applyA' functor of Lanczos, the Krylov
+// solvers, and the pseudospectral drivers. The distributed variants apply
+// the transforms to the columns of X redistributed as [STAR,VR].
+
+// A(i,j) = a[i-j+(n-1)], as in Toeplitz
+template<typename F>
+class ToeplitzOperator
+{
+public:
+    ToeplitzOperator() { }
+    ToeplitzOperator( Int m, Int n, const vector<F>& a );
+
+    Int Height() const { return m_; }
+    Int Width() const { return n_; }
+
+    void Apply
+    ( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const;
+    void Apply
+    ( Orientation orientation,
+      const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const;
+
+    void operator()( const Matrix<F>& X, Matrix<F>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+    void operator()( const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+
+private:
+    Int m_=0, n_=0;
+    // The FFTs of the zero-padded generators of A and A^T
+    Matrix<Complex<Base<F>>> symbol_, transSymbol_;
+};
+
+// A(i,j) = a[i+j], as in Hankel
+template<typename F>
+class HankelOperator
+{
+public:
+    HankelOperator() { }
+    HankelOperator( Int m, Int n, const vector<F>& a );
+
+    Int Height() const { return toeplitz_.Height(); }
+    Int Width() const { return toeplitz_.Width(); }
+
+    void Apply
+    ( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const;
+    void Apply
+    ( Orientation orientation,
+      const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const;
+
+    void operator()( const Matrix<F>& X, Matrix<F>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+    void operator()( const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+
+private:
+    // A = T J, where J reverses the order of the rows
+    ToeplitzOperator<F> toeplitz_;
+};
+
+// A(i,j) = a[(i-j) mod n], as in Circulant
+template<typename F>
+class CirculantOperator
+{
+public:
+    CirculantOperator() { }
+    CirculantOperator( const vector<F>& a );
+
+    Int Height() const { return toeplitz_.Height(); }
+    Int Width() const { return toeplitz_.Width(); }
+
+    void Apply
+    ( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const
+    { toeplitz_.Apply( orientation, X, Y ); }
+    void Apply
+    ( Orientation orientation,
+      const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const
+    { toeplitz_.Apply( orientation, X, Y ); }
+
+    void operator()( const Matrix<F>& X, Matrix<F>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+    void operator()( const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+
+private:
+    ToeplitzOperator<F> toeplitz_;
+};
+
+// The unitary DFT of order n, as in Fourier; orders which are not powers of
+// two are handled with Bluestein's chirp-z convolution
+template<typename Real>
+class FourierOperator
+{
+public:
+    FourierOperator() { }
+    FourierOperator( Int n );
+
+    Int Height() const { return n_; }
+    Int Width() const { return n_; }
+
+    void Apply
+    ( Orientation orientation,
+      const Matrix<Complex<Real>>& X, Matrix<Complex<Real>>& Y ) const;
+    void Apply
+    ( Orientation orientation,
+      const ElementalMatrix<Complex<Real>>& X,
+            ElementalMatrix<Complex<Real>>& Y ) const;
+
+    void operator()
+    ( const Matrix<Complex<Real>>& X, Matrix<Complex<Real>>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+    void operator()
+    ( const ElementalMatrix<Complex<Real>>& X,
+            ElementalMatrix<Complex<Real>>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+
+private:
+    Int n_=0;
+    // Only used if n_ is not a power of two
+    Matrix<Complex<Real>> chirp_;
+    ToeplitzOperator<Complex<Real>> chirpConv_;
+};
+
+// The Walsh matrix of order 2^k, as in Walsh
+template<typename F>
+class WalshOperator
+{
+public:
+    WalshOperator() { }
+    WalshOperator( Int k, bool binary=false );
+
+    Int Height() const { return n_; }
+    Int Width() const { return n_; }
+
+    void Apply
+    ( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const;
+    void Apply
+    ( Orientation orientation,
+      const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const;
+
+    void operator()( const Matrix<F>& X, Matrix<F>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+    void operator()( const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const
+    { Apply( NORMAL, X, Y ); }
+
+private:
+    Int n_=0;
+    bool binary_=false;
+};
+
 } // namespace El
 
 // TODO: Group these into a small number of includes of parent dir's
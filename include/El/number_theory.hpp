@@ -11,6 +11,11 @@
 
 namespace El {
 
+// A segmented sieve of Eratosthenes over the integers coprime to 30: each
+// byte of a segment table represents thirty consecutive integers, with one bit
+// for each of the eight residues modulo 30 which are coprime to 30. The
+// default segment of 32768 bytes (i.e., 983040 integers) is meant to fit in
+// the L1 cache, and bulk generation sieves independent segments in parallel.
 template<typename T=unsigned long long,
          typename TSmall=unsigned>
 struct DynamicSieve
@@ -23,8 +28,14 @@ public:
 
     void SetLowerBound( T lowerBound );
     void SetStorage( bool keepAll );
+
+    // Ensure that 'oddPrimes' contains every odd prime up to 'upperBound'
     void Generate( T upperBound );
 
+    // Return all of the primes in [lowerBound,upperBound] without storing
+    // them
+    vector<T> Generate( T lowerBound, T upperBound );
+
     T NextPrime();
 
     // We could use TSmall if keepAll was false
@@ -33,26 +44,30 @@ public:
 private:
     bool keepAll_;
     T lowerBound_; // always return the first prime >= lowerBound_
-    T oddPrimeBound_;
-    vector<TSmall> oddPrimeStarts_;
 
-    // The segment offset will be odd (>=3) and the associated numbers are
-    // the offset plus twice the index.
-    vector<char> segmentTable_;
+    // The segment offset is a multiple of 30 and the table covers the
+    // integers in [segmentOffset_,segmentOffset_+30*segmentSize_)
+    vector<byte> segmentTable_;
     TSmall segmentSize_;
     T segmentOffset_;
+    // The bit index (eight per byte) of the current prime within the table
     TSmall segmentIndex_;
-    // Attempt to update 'halvedIndex' until oddOffset + 2*halvedIndex is 
-    // corresponds to a precomputed prime (i.e., table[halvedIndex] is one)
+    // Attempt to update 'segmentIndex_' until it corresponds to the first
+    // prime in the table which is at least 'lowerBound_'
     bool SeekSegmentPrime();
-    TSmall ComputeSegmentStart( const TSmall& p ) const;
 
     void AugmentPrimes( T numPrimes );
+    void EnsureSievingPrimes( T largestCandidate );
     void MoveSegmentOffset( T segmentOffset );
 
     T PrimeCountingEstimate( T n ) const;
 
-    void SieveSegment();
+    // Sieve the table of 'segmentSize_' bytes starting at the given multiple
+    // of 30 using the stored primes (which may be called concurrently)
+    void SieveSegment( T segmentOffset, vector<byte>& table ) const;
+    // Push the primes in [lowerBound,upperBound] onto 'primes' using
+    // independent segments which are sieved in parallel
+    void SieveRange( T lowerBound, T upperBound, vector<T>& primes ) const;
     void FormNewSegment();
 };
 
@@ -105,6 +120,52 @@ Primality PrimalityTest( const BigInt& n, Int numReps=30 );
 BigInt NextProbablePrime( const BigInt& n, Int numReps=30 );
 void NextProbablePrime( const BigInt& n, BigInt& nextPrime, Int numReps=30 );
 
+// Arithmetic modulo an odd n in the Montgomery representation a R (mod n),
+// where R = 2^(s GMP_NUMB_BITS) and s is the number of limbs of n, so that
+// each product is reduced with word-by-word REDC rather than a division.
+// The reductions make use of an internal workspace, so each thread should
+// construct its own instance.
+class Montgomery
+{
+public:
+    Montgomery( const BigInt& n );
+
+    const BigInt& Modulus() const { return n_; }
+    // The representation of one, i.e., R mod n
+    const BigInt& One() const { return one_; }
+
+    // aHat := a R (mod n) for an arbitrary integer a
+    void ToMontgomery( const BigInt& a, BigInt& aHat ) const;
+    // a := aHat / R (mod n)
+    void FromMontgomery( const BigInt& aHat, BigInt& a ) const;
+
+    // cHat := aHat bHat / R (mod n) for aHat and bHat in [0,n)
+    void Multiply
+    ( const BigInt& aHat, const BigInt& bHat, BigInt& cHat ) const;
+    void Square( const BigInt& aHat, BigInt& cHat ) const;
+    // cHat := aHat^exponent / R^(exponent-1) (mod n)
+    void PowMod
+    ( const BigInt& aHat, unsigned long long exponent, BigInt& cHat ) const;
+
+    // Reduce a + b (or a - b) modulo n for a and b in [0,n)
+    void AddMod( const BigInt& a, const BigInt& b, BigInt& c ) const;
+    void SubtractMod( const BigInt& a, const BigInt& b, BigInt& c ) const;
+
+private:
+    BigInt n_, one_, rSquared_;
+    mp_size_t numLimbs_;
+    // -n^{-1} mod 2^GMP_NUMB_BITS
+    mp_limb_t nInv_;
+
+    // Room for a double-length product and two padded operands
+    mutable vector<mp_limb_t> workspace_;
+
+    void Load( const BigInt& a, mp_limb_t* buffer ) const;
+    // c := t / R (mod n), where t is the double-length product stored at
+    // the beginning of the workspace
+    void Reduce( BigInt& c ) const;
+};
+
 namespace factor {
 
 struct PollardRhoCtrl
@@ -130,6 +191,12 @@ vector<BigInt> PollardRho
 ( const BigInt& n,
   const PollardRhoCtrl& ctrl=PollardRhoCtrl() );
 
+// Factor each of the given integers, with the searches for the factors of
+// the composite cofactors distributed over the available threads
+vector<vector<BigInt>> PollardRho
+( const vector<BigInt>& numbers,
+  const PollardRhoCtrl& ctrl=PollardRhoCtrl() );
+
 namespace pollard_rho {
 
 BigInt FindDivisor
@@ -272,6 +339,7 @@ BigInt PollardRho
 #include <El/number_theory/MillerRabin.hpp>
 #include <El/number_theory/PrimalityTest.hpp>
 #include <El/number_theory/NextProbablePrime.hpp>
+#include <El/number_theory/Montgomery.hpp>
 #include <El/number_theory/factor/PollardRho.hpp>
 #include <El/number_theory/factor/PollardPMinusOne.hpp>
 #include <El/number_theory/PrimitiveRoot.hpp>
@@ -2,8 +2,8 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #ifndef EL_NUMBER_THEORY_DYNAMIC_SIEVE_HPP
@@ -11,6 +11,26 @@
 
 namespace El {
 
+namespace dynamic_sieve {
+
+// The i'th residue modulo 30 which is coprime to 30
+inline unsigned WheelResidue( unsigned i )
+{
+    static const unsigned residues[8] = { 1, 7, 11, 13, 17, 19, 23, 29 };
+    return residues[i];
+}
+
+// The bit representing the residue r modulo 30 (which must be coprime to 30)
+inline unsigned WheelBit( unsigned r )
+{
+    static const unsigned bits[30] =
+      { 8, 0, 8, 8, 8, 8, 8, 1, 8, 8, 8, 2, 8, 3, 8,
+        8, 8, 4, 8, 5, 8, 8, 8, 6, 8, 8, 8, 8, 8, 7 };
+    return bits[r];
+}
+
+} // namespace dynamic_sieve
+
 template<typename T,typename TSmall>
 DynamicSieve<T,TSmall>::DynamicSieve
 ( T lowerBound,
@@ -18,15 +38,16 @@ DynamicSieve<T,TSmall>::DynamicSieve
   TSmall segmentSize )
 {
     keepAll_ = false;
-    oddPrimeBound_ = 0;
 
     // Ensure that the lower bound is odd
     if( lowerBound % 2 == 0 )
         ++lowerBound;
+    lowerBound_ = lowerBound;
 
-    // Ensure that the segment size is even
-    if( segmentSize % 2 == 1 )
-        ++segmentSize;
+    if( segmentSize == 0 )
+        LogicError("The segment size must be positive");
+    segmentSize_ = segmentSize;
+    segmentTable_.resize( segmentSize );
 
     // This could be an arbitrary number of the first several odd primes,
     // but testing up to 53 being a good default for trial division is common
@@ -48,27 +69,14 @@ DynamicSieve<T,TSmall>::DynamicSieve
     oddPrimes[13] = 47;
     oddPrimes[14] = 53;
 
-    segmentOffset_ = lowerBound_ = ( keepAll ? 3 : lowerBound );
-    segmentOffset_ = std::max( segmentOffset_, oddPrimes.back()+2 );
-    segmentSize_ = segmentSize;
-    segmentTable_.resize( segmentSize );
-
     // Initialize the sieve table
-    T largestCandidate = segmentOffset_ + 2*(segmentSize-1);
-    while( oddPrimes.back()*oddPrimes.back() < largestCandidate )
-    {
-        AugmentPrimes( 2*oddPrimes.size() );
-    }
-    SieveSegment();
+    MoveSegmentOffset( std::max( lowerBound_, oddPrimes.back()+2 ) );
 
+    // Since it has been requested that we start generating primes at
+    // 'lowerBound', to keep all primes, we should now generate all primes
+    // before 'lowerBound'
     if( keepAll )
-    {
-        // Since it has been requested that we start generating primes at
-        // 'lowerBound', to keep all primes, we should now generate all
-        // primes before 'lowerBound'
-        Generate( lowerBound );
-        lowerBound_ = lowerBound;
-    }
+        SetStorage( true );
 }
 
 template<typename T,typename TSmall>
@@ -84,24 +92,26 @@ void DynamicSieve<T,TSmall>::SetLowerBound( T lowerBound )
     if( lowerBound != lowerBound_ )
     {
         lowerBound_ = lowerBound;
-        // TODO: Decide if we always need to pay this price
-        MoveSegmentOffset( lowerBound_ );
+        // Only resieve if the new bound lies outside of the current segment
+        if( lowerBound_ < segmentOffset_ ||
+            lowerBound_ >= segmentOffset_ + 30*T(segmentSize_) )
+            MoveSegmentOffset( lowerBound_ );
     }
 }
 
 template<typename T,typename TSmall>
-void DynamicSieve<T,TSmall>::MoveSegmentOffset( T segmentOffset )
+void DynamicSieve<T,TSmall>::EnsureSievingPrimes( T largestCandidate )
 {
-    // TODO: Decide if this should only be enabled in debug mode
-    if( segmentOffset % 2 == 0 )
-        LogicError("Cannot choose an even segment offset");
+    while( oddPrimes.back()*oddPrimes.back() < largestCandidate )
+        AugmentPrimes( 2*oddPrimes.size() );
+}
 
-    if( segmentOffset_ != segmentOffset )
-    {
-        segmentOffset_ = segmentOffset;
-        for( TSmall i=0; i<oddPrimeBound_; ++i )
-            oddPrimeStarts_[i] = ComputeSegmentStart( oddPrimes[i] );
-    }
+template<typename T,typename TSmall>
+void DynamicSieve<T,TSmall>::MoveSegmentOffset( T segmentOffset )
+{
+    segmentOffset_ = segmentOffset - segmentOffset % 30;
+    EnsureSievingPrimes( segmentOffset_ + 30*T(segmentSize_) );
+    SieveSegment( segmentOffset_, segmentTable_ );
 }
 
 template<typename T,typename TSmall>
@@ -111,15 +121,7 @@ void DynamicSieve<T,TSmall>::SetStorage( bool keepAll )
     {
         // Ensure that we have all of the primes below lowerBound_ stored
         if( lowerBound_ > oddPrimes.back()+2 )
-        {
-            T lowerBoundSave = lowerBound_;
-            lowerBound_ = oddPrimes.back()+2;
-            MoveSegmentOffset( lowerBound_ );
-
-            keepAll_ = true;
-            while( lowerBound_ < lowerBoundSave )
-                NextPrime(); 
-        }
+            Generate( lowerBound_-1 );
     }
     keepAll_ = keepAll;
 }
@@ -127,36 +129,70 @@ void DynamicSieve<T,TSmall>::SetStorage( bool keepAll )
 template<typename T,typename TSmall>
 void DynamicSieve<T,TSmall>::Generate( T upperBound )
 {
-    SetStorage( true );
+    if( upperBound <= oddPrimes.back() )
+        return;
 
     // Compute all of the needed "small" odd primes for testing candidates
-    // up to a (loose) upper bound of upperBound + 2*(segmentSize-1)
-    T largestCandidate = upperBound + 2*(segmentSize_-1);
-    oddPrimes.reserve( PrimeCountingEstimate(largestCandidate) );
-    while( oddPrimes.back()*oddPrimes.back() < largestCandidate )
-    {
-        AugmentPrimes( 2*oddPrimes.size() );
-    }
+    // up to upperBound (which extends the stored primes by trial division)
+    EnsureSievingPrimes( upperBound );
+    if( upperBound <= oddPrimes.back() )
+        return;
 
-    if( segmentOffset_ < oddPrimes.back()+2 )
-    {
-        MoveSegmentOffset( oddPrimes.back()+2 );
-    }
+    oddPrimes.reserve( PrimeCountingEstimate(upperBound) );
+    SieveRange( oddPrimes.back()+2, upperBound, oddPrimes );
+}
+
+template<typename T,typename TSmall>
+vector<T> DynamicSieve<T,TSmall>::Generate( T lowerBound, T upperBound )
+{
+    vector<T> primes;
+    if( lowerBound > upperBound )
+        return primes;
+    for( const T p : { T(2), T(3), T(5) } )
+        if( lowerBound <= p && p <= upperBound )
+            primes.push_back( p );
+    EnsureSievingPrimes( upperBound );
+    SieveRange( std::max(lowerBound,T(7)), upperBound, primes );
+    return primes;
+}
 
-    for( ; segmentOffset_<upperBound; segmentOffset_+=2*segmentSize_ )
+template<typename T,typename TSmall>
+void DynamicSieve<T,TSmall>::SieveRange
+( T lowerBound, T upperBound, vector<T>& primes ) const
+{
+    if( lowerBound > upperBound )
+        return;
+    const T span = 30*T(segmentSize_);
+    const T rangeOffset = lowerBound - lowerBound % 30;
+    const T numSegments = (upperBound-rangeOffset)/span + 1;
+
+    // Sieve the segments independently and then concatenate their primes
+    vector<vector<T>> segmentPrimes( numSegments );
+    EL_PARALLEL_FOR
+    for( T s=0; s<numSegments; ++s )
     {
-        SieveSegment();
+        const T segmentOffset = rangeOffset + s*span;
+        vector<byte> table;
+        SieveSegment( segmentOffset, table );
+
+        auto& localPrimes = segmentPrimes[s];
         for( TSmall k=0; k<segmentSize_; ++k )
         {
-            if( segmentTable_[k] )
+            byte flags = table[k];
+            for( unsigned bit=0; flags != 0; ++bit, flags >>= 1 )
             {
-                T p = segmentOffset_ + 2*k;
-                oddPrimes.push_back( p );
+                if( flags & 1 )
+                {
+                    const T p = segmentOffset + 30*T(k) +
+                      dynamic_sieve::WheelResidue(bit);
+                    if( p >= lowerBound && p <= upperBound )
+                        localPrimes.push_back( p );
+                }
             }
         }
     }
-
-    SetStorage( false );
+    for( const auto& localPrimes : segmentPrimes )
+        primes.insert( primes.end(), localPrimes.begin(), localPrimes.end() );
 }
 
 template<typename T,typename TSmall>
@@ -167,42 +203,29 @@ bool DynamicSieve<T,TSmall>::SeekSegmentPrime()
     const TSmall start =
       ( segmentOffset_ >= lowerBound_ ?
         0 :
-        (lowerBound_-segmentOffset_+1) / 2 );
-    for( TSmall i=start; i<segmentSize_; ++i )
+        TSmall((lowerBound_-segmentOffset_)/30) );
+    for( TSmall k=start; k<segmentSize_; ++k )
     {
-        if( segmentTable_[i] != 0 )
+        const byte flags = segmentTable_[k];
+        if( flags == 0 )
+            continue;
+        for( unsigned bit=0; bit<8; ++bit )
         {
-            segmentIndex_ = i;
-            return true;
+            if( (flags >> bit) & 1 )
+            {
+                const T p =
+                  segmentOffset_ + 30*T(k) + dynamic_sieve::WheelResidue(bit);
+                if( p >= lowerBound_ )
+                {
+                    segmentIndex_ = 8*k + bit;
+                    return true;
+                }
+            }
         }
     }
     return false;
 }
 
-// Find the integer k such that segmentOffset_ + 2*k is the first odd 
-// multiple of p that is greater than or equal to Max(segmentOffset_,p^2)
-template<typename T,typename TSmall>
-TSmall DynamicSieve<T,TSmall>::ComputeSegmentStart
-( const TSmall& p ) const
-{
-    if( p*p >= segmentOffset_ )
-    {
-        return (p*p - segmentOffset_) / 2;
-    }
-    else
-    {
-        auto complement = (p - (segmentOffset_ % p)) % p;
-        if( complement % 2 == 0 )
-        {
-            return complement / 2;
-        }
-        else
-        {
-            return (complement + p) / 2;
-        }
-    }
-}
-
 template<typename T,typename TSmall>
 void DynamicSieve<T,TSmall>::AugmentPrimes
 ( T numPrimes )
@@ -250,72 +273,54 @@ void DynamicSieve<T,TSmall>::AugmentPrimes
 }
 
 template<typename T,typename TSmall>
-void DynamicSieve<T,TSmall>::SieveSegment()
+void DynamicSieve<T,TSmall>::SieveSegment
+( T segmentOffset, vector<byte>& table ) const
 {
-    std::fill( segmentTable_.begin(), segmentTable_.end(), char(1) );
+    table.resize( segmentSize_ );
+    std::fill( table.begin(), table.end(), byte(0xff) );
+    // One is not prime
+    if( segmentOffset == 0 )
+        table[0] &= byte(~1u);
 
-    // Since sqrt(n) is an upper-bound on the smallest prime factor of 
+    // Since sqrt(n) is an upper-bound on the smallest prime factor of
     // a number n, we can a priori compute which of our stored primes is
     // the last that we need to sieve with in this segment
-    T largestCandidate = segmentOffset_ + 2*(segmentSize_-1);
-    auto factorBound = TSmall(std::sqrt(largestCandidate)) + 1;
+    const T segmentEnd = segmentOffset + 30*T(segmentSize_);
+    const T factorBound = T(std::sqrt(segmentEnd)) + 1;
     auto boundIter =
-      std::lower_bound( oddPrimes.begin(), oddPrimes.end(), factorBound );
-    auto indexEnd = TSmall(boundIter-oddPrimes.begin());
-
-    // Compute the starting index in this segment of all of the newly
-    // incorporated small primes 
-    while( oddPrimeBound_ < indexEnd )
-    {
-        oddPrimeStarts_.push_back
-        ( ComputeSegmentStart(oddPrimes[oddPrimeBound_]) );
-        ++oddPrimeBound_;
-    }
+      std::upper_bound( oddPrimes.begin(), oddPrimes.end(), factorBound );
 
-    for( TSmall j=0; j<indexEnd; ++j )
+    // Skip 3 and 5, which are handled by the wheel
+    for( auto iter=oddPrimes.begin()+2; iter<boundIter; ++iter )
     {
-        TSmall p = oddPrimes[j];
-
-        // Iterate over the indices corresponding to odd multiples of p that
-        // are at least as large as Max(segmentOffset_,p^2)
-        auto k = oddPrimeStarts_[j];
-        for( ; k<segmentSize_; k+=p )
+        const T p = *iter;
+        // Each residue class of the cofactor q modulo 30 yields multiples p q
+        // in a fixed bit position which are p bytes apart
+        const T qMin = std::max( p, (segmentOffset+p-1)/p );
+        for( unsigned i=0; i<8; ++i )
         {
-            segmentTable_[k] = 0;
+            const T residue = dynamic_sieve::WheelResidue(i);
+            const T q = qMin + (residue+30-qMin%30) % 30;
+            const T multiple = p*q;
+            if( multiple >= segmentEnd )
+                continue;
+            const byte mask =
+              byte(~(1u << dynamic_sieve::WheelBit(unsigned(multiple%30))));
+            for( T k=(multiple-segmentOffset)/30; k<segmentSize_; k+=p )
+                table[k] &= mask;
         }
-
-        // Store the next starting index of the j'th small prime
-        // (under the assumption that the next segment will begin where the
-        // current one ends)
-        oddPrimeStarts_[j] = k - segmentSize_;
     }
 }
 
 template<typename T,typename TSmall>
 void DynamicSieve<T,TSmall>::FormNewSegment()
 {
-    // The current table handles the odd integers in the inclusive interval
-    // [segmentOffset,segmentOffset+2*(segmentSize-1)], so the next table
-    // should begin at 2*segmentSize (unless lowerBound_ is larger).
-    segmentOffset_ += 2*segmentSize_;
-
-    // Ensure that every prime factor of a number in the range covered by the
-    // table, [segmentOffset_,segmentOffset_+2*segmentSize), is in our list of
-    //  primes
-    const T largestCandidate = segmentOffset_ + 2*(segmentSize_-1);
+    // The current table handles the integers in
+    // [segmentOffset_,segmentOffset_+30*segmentSize_), so the next table
+    // should begin where it ends.
+    MoveSegmentOffset( segmentOffset_ + 30*T(segmentSize_) );
     if( keepAll_ )
-    {
-        oddPrimes.reserve( PrimeCountingEstimate(largestCandidate) );
-    }
-    else
-    {
-        while( oddPrimes.back()*oddPrimes.back() < largestCandidate )
-        {
-            AugmentPrimes( 2*oddPrimes.size() );
-        }
-    }
-
-    SieveSegment();
+        oddPrimes.reserve( PrimeCountingEstimate(segmentOffset_) );
 }
 
 template<typename T,typename TSmall>
@@ -332,13 +337,18 @@ T DynamicSieve<T,TSmall>::NextPrime()
     }
 
     // Fall back to the segment table
+    if( lowerBound_ < segmentOffset_ ||
+        lowerBound_ >= segmentOffset_ + 30*T(segmentSize_) )
+        MoveSegmentOffset( lowerBound_ );
     while( !SeekSegmentPrime() )
     {
         FormNewSegment();
     }
 
     // We have guaranteed that we are currently pointing to a prime
-    T currentPrime = segmentOffset_ + 2*segmentIndex_;
+    T currentPrime =
+      segmentOffset_ + 30*T(segmentIndex_/8) +
+      dynamic_sieve::WheelResidue(segmentIndex_%8);
     if( keepAll_ && currentPrime > oddPrimes.back() )
     {
         oddPrimes.push_back( currentPrime );
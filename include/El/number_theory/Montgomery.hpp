@@ -0,0 +1,162 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NUMBER_THEORY_MONTGOMERY_HPP
+#define EL_NUMBER_THEORY_MONTGOMERY_HPP
+
+namespace El {
+
+#ifdef EL_HAVE_MPC
+
+// See
+//
+//   P. L. Montgomery, "Modular multiplication without trial division",
+//   Mathematics of Computation, Vol. 44, No. 170, pp. 519--521, 1985.
+//
+// The reduction is the word-by-word variant, which only requires a
+// single-limb inverse of n.
+//
+
+inline Montgomery::Montgomery( const BigInt& n )
+: n_(n)
+{
+    DEBUG_CSE
+    if( n <= BigInt(1) || n % 2U == 0 )
+        LogicError("Montgomery arithmetic requires an odd modulus > 1");
+    numLimbs_ = mpz_size( n_.LockedPointer() );
+    workspace_.resize( 4*numLimbs_+1 );
+
+    // Newton's iteration for the inverse of n modulo 2^GMP_NUMB_BITS doubles
+    // the number of correct bits (starting from three) at each step
+    const mp_limb_t n0 = mpz_getlimbn( n_.LockedPointer(), 0 );
+    mp_limb_t inv = n0;
+    for( Int bits=3; bits<GMP_NUMB_BITS; bits*=2 )
+        inv *= 2 - n0*inv;
+    nInv_ = -inv;
+
+    one_ = 1;
+    one_ <<= static_cast<unsigned long>(numLimbs_*GMP_NUMB_BITS);
+    rSquared_ = one_;
+    one_ %= n_;
+    rSquared_ *= rSquared_;
+    rSquared_ %= n_;
+}
+
+inline void Montgomery::Load( const BigInt& a, mp_limb_t* buffer ) const
+{
+    const mp_size_t aSize = mpz_size( a.LockedPointer() );
+    const mp_limb_t* aBuf = mpz_limbs_read( a.LockedPointer() );
+    for( mp_size_t i=0; i<aSize; ++i )
+        buffer[i] = aBuf[i];
+    for( mp_size_t i=aSize; i<numLimbs_; ++i )
+        buffer[i] = 0;
+}
+
+inline void Montgomery::Reduce( BigInt& c ) const
+{
+    const mp_size_t s = numLimbs_;
+    const mp_limb_t* nBuf = mpz_limbs_read( n_.LockedPointer() );
+    mp_limb_t* t = workspace_.data();
+
+    // Zero the trailing limb of t so that it can absorb the carries
+    t[2*s] = 0;
+    for( mp_size_t i=0; i<s; ++i )
+    {
+        // Add the multiple of n which zeroes the i'th limb of t
+        const mp_limb_t q = t[i]*nInv_;
+        const mp_limb_t carry = mpn_addmul_1( t+i, nBuf, s, q );
+        mpn_add_1( t+i+s, t+i+s, s+1-i, carry );
+    }
+
+    // t / R is now stored in t[s:2s] and is less than 2n
+    mp_limb_t* cBuf = mpz_limbs_write( c.Pointer(), s );
+    if( t[2*s] != 0 || mpn_cmp( t+s, nBuf, s ) >= 0 )
+        mpn_sub_n( cBuf, t+s, nBuf, s );
+    else
+        mpn_copyi( cBuf, t+s, s );
+    mpz_limbs_finish( c.Pointer(), s );
+}
+
+inline void Montgomery::Multiply
+( const BigInt& aHat, const BigInt& bHat, BigInt& cHat ) const
+{
+    const mp_size_t s = numLimbs_;
+    mp_limb_t* aBuf = workspace_.data() + 2*s+1;
+    mp_limb_t* bBuf = aBuf + s;
+    Load( aHat, aBuf );
+    Load( bHat, bBuf );
+    mpn_mul_n( workspace_.data(), aBuf, bBuf, s );
+    Reduce( cHat );
+}
+
+inline void Montgomery::Square( const BigInt& aHat, BigInt& cHat ) const
+{
+    const mp_size_t s = numLimbs_;
+    mp_limb_t* aBuf = workspace_.data() + 2*s+1;
+    Load( aHat, aBuf );
+    mpn_sqr( workspace_.data(), aBuf, s );
+    Reduce( cHat );
+}
+
+inline void Montgomery::ToMontgomery( const BigInt& a, BigInt& aHat ) const
+{
+    aHat = a;
+    aHat %= n_;
+    Multiply( aHat, rSquared_, aHat );
+}
+
+inline void Montgomery::FromMontgomery( const BigInt& aHat, BigInt& a ) const
+{
+    const mp_size_t s = numLimbs_;
+    mp_limb_t* t = workspace_.data();
+    Load( aHat, t );
+    for( mp_size_t i=s; i<2*s; ++i )
+        t[i] = 0;
+    Reduce( a );
+}
+
+inline void Montgomery::PowMod
+( const BigInt& aHat, unsigned long long exponent, BigInt& cHat ) const
+{
+    // Left-to-right binary exponentiation
+    BigInt base( aHat );
+    cHat = one_;
+    if( exponent == 0 )
+        return;
+    unsigned long long mask = 1ULL << 63;
+    while( !(exponent & mask) )
+        mask >>= 1;
+    for( ; mask != 0; mask >>= 1 )
+    {
+        Square( cHat, cHat );
+        if( exponent & mask )
+            Multiply( cHat, base, cHat );
+    }
+}
+
+inline void Montgomery::AddMod
+( const BigInt& a, const BigInt& b, BigInt& c ) const
+{
+    mpz_add( c.Pointer(), a.LockedPointer(), b.LockedPointer() );
+    if( c >= n_ )
+        c -= n_;
+}
+
+inline void Montgomery::SubtractMod
+( const BigInt& a, const BigInt& b, BigInt& c ) const
+{
+    mpz_sub( c.Pointer(), a.LockedPointer(), b.LockedPointer() );
+    if( c < 0 )
+        c += n_;
+}
+
+#endif // ifdef EL_HAVE_MPC
+
+} // namespace El
+
+#endif // ifndef EL_NUMBER_THEORY_MONTGOMERY_HPP
@@ -47,6 +47,10 @@ void RepeatedPowMod
         PowMod( a, p, n, a );
 }
 
+// Rather than performing a separate modular exponentiation for each prime
+// power, the prime powers are accumulated into an exponent of roughly
+// 'batchBits' bits so that the (Montgomery-based) windowed exponentiation of
+// GMP can amortize its setup over many primes
 template<typename Iterator>
 void RepeatedPowModRange
 ( BigInt& a,
@@ -55,21 +59,34 @@ void RepeatedPowModRange
   const BigInt& n,
   const double& nLog,
   bool checkpoint=false,
-  Int checkpointFreq=1000000 )
+  Int checkpointFreq=1000000,
+  Int batchBits=1024 )
 {
+    BigInt exponent(1), primePower;
     Int checkpointCounter = 0;
     for( auto pPtr=pBeg; pPtr<pEnd; ++pPtr )
     {
         auto p = *pPtr;
-        RepeatedPowMod( a, p, n, nLog );
+        const unsigned power = unsigned(nLog/double(Log(double(p))));
+        mpz_ui_pow_ui
+        ( primePower.Pointer(), static_cast<unsigned long>(p), power );
+        exponent *= primePower;
 
         ++checkpointCounter;
-        if( checkpoint && checkpointCounter >= checkpointFreq )
+        const bool flushCheckpoint =
+          checkpoint && checkpointCounter >= checkpointFreq;
+        if( exponent.NumBits() >= batchBits || flushCheckpoint )
+        {
+            PowMod( a, exponent, n, a );
+            exponent = 1;
+        }
+        if( flushCheckpoint )
         {
             Output("After p=",p,", exponential was a=",a); 
             checkpointCounter = 0;
         }
     }
+    PowMod( a, exponent, n, a );
 }
 
 // NOTE: Returns the GCD of stage 1 and overwrites a with a power of a
@@ -157,7 +174,13 @@ BigInt StageOne
     return gcd;
 }
 
-// NOTE: Returns the GCD of stage 1 and overwrites a with a power of a
+// The standard continuation: for each prime q in (previousBound,newBound],
+// c = a^q is formed by multiplying the previous such power by a cached power
+// a^(q-qPrev), and the product of the (c-1) is accumulated (in the
+// Montgomery representation) so that a GCD is only computed every
+// 'gcdDelay2' primes.
+//
+// NOTE: Returns the GCD of stage 2 and overwrites a with a power of a
 template<typename TSieve,typename TSieveSmall>
 BigInt StageTwo
 ( const BigInt& n,
@@ -168,57 +191,50 @@ BigInt StageTwo
   const PollardPMinusOneCtrl<TSieve>& ctrl )
 {
     const BigInt& one = BigIntOne();
+    Montgomery mont( n );
     sieve.SetLowerBound( previousBound+1 );
 
-    BigInt diffPower, tmp, gcd;
+    BigInt aHat, cHat, diffHat, QHat, tmp, gcd=one;
+    TSieve q = sieve.NextPrime();
+    PowMod( a, q, n, tmp );
+    mont.ToMontgomery( a, aHat );
+    mont.ToMontgomery( tmp, cHat );
+    QHat = mont.One();
 
     Int delayCounter=1;
-    TSieve p, pLast=sieve.NextPrime();
     std::map<TSieve,BigInt> diffPowers;
-    while( pLast <= newBound )
+    while( q <= newBound )
     {
-        p = sieve.NextPrime();
-        TSieve diff = p - pLast;
-        auto search = diffPowers.find( diff );
+        // Q := Q (c-1)
+        mont.SubtractMod( cHat, mont.One(), tmp );
+        mont.Multiply( QHat, tmp, QHat );
 
-        if( search == diffPowers.end() )
+        const TSieve qNext = sieve.NextPrime();
+        if( delayCounter >= ctrl.gcdDelay2 || qNext > newBound )
         {
-            PowMod( a, diff, n, diffPower );
-            diffPowers.insert( std::make_pair(diff,diffPower) );
-        }
-
-        a *= diffPowers[diff];
-        a %= n;
-        
-        if( delayCounter >= ctrl.gcdDelay2 )
-        {
-            // gcd = GCD( a-1, n );
-            tmp = a;
-            tmp -= 1;
-            GCD( tmp, n, gcd );
-            if( gcd > one && gcd < n )
+            GCD( QHat, n, gcd );
+            if( gcd > one )
             {
-                if( ctrl.progress )
+                if( ctrl.progress && gcd < n )
                     Output("Found stage-2 factor of ",gcd);
-                return gcd;
+                break;
             }
             delayCounter = 0;
         }
         ++delayCounter;
-    }
 
-    // If the last iteration did not perform a GCD due to the delay
-    if( ctrl.gcdDelay2 > 1 && delayCounter != 1 )
-    {
-        tmp = a;
-        tmp -= 1;
-        GCD( tmp, n, gcd );
-        if( gcd > one && gcd < n )
+        // c := c a^(qNext-q)
+        const TSieve diff = qNext - q;
+        auto search = diffPowers.find( diff );
+        if( search == diffPowers.end() )
         {
-            if( ctrl.progress )
-                Output("Found stage-2 factor of ",gcd);
+            mont.PowMod( aHat, diff, diffHat );
+            search = diffPowers.insert( std::make_pair(diff,diffHat) ).first;
         }
+        mont.Multiply( cHat, search->second, cHat );
+        q = qNext;
     }
+    mont.FromMontgomery( cHat, a );
 
     return gcd;
 }
@@ -231,6 +247,9 @@ BigInt FindFactor
 {
     const BigInt& one = BigIntOne();
     const BigInt& two = BigIntTwo();
+    // Stage two makes use of Montgomery arithmetic, which requires odd n
+    if( n % 2U == 0 )
+        return two;
 
     TSieve smooth1 = ctrl.smooth1;
     TSieve smooth2 = ctrl.smooth2;
@@ -243,7 +262,7 @@ BigInt FindFactor
     Int maxGCDFailures=10;
     Int numGCDFailures=0;
 
-    BigInt gcd, tmp, diffPower;
+    BigInt gcd;
     while( true )
     {
         // Uniformly select a in (Z/(n))* \ {1}
@@ -17,6 +17,18 @@ namespace factor {
 
 namespace pollard_rho {
 
+// Brent's variant of the rho method, which replaces Floyd's cycle detection
+// (three evaluations of the iteration per comparison) with comparisons
+// against an iterate which is saved at doubling intervals, and accumulates
+// the differences into a product so that a GCD is only computed every
+// 'gcdDelay' steps, as in
+//
+//   R. P. Brent, "An improved Monte Carlo factorization algorithm",
+//   BIT Numerical Mathematics, Vol. 20, No. 2, pp. 176--184, 1980.
+//
+// The iterates are stored in the Montgomery representation, which does not
+// change the GCD of a difference with n.
+//
 // TODO: Add the ability to set a maximum number of iterations
 inline BigInt FindFactor
 ( const BigInt& n,
@@ -27,89 +39,69 @@ inline BigInt FindFactor
 
     if( a == 0 || a == -2 )
         Output("WARNING: Problematic choice of Pollard rho shift");
-    BigInt tmp, gcd;
+    if( n % 2U == 0 )
+        return BigIntTwo();
+
+    Montgomery mont( n );
+    BigInt aHat;
+    mont.ToMontgomery( BigInt(a), aHat );
 
     auto xAdvance =
       [&]( BigInt& x )
       {
         if( ctrl.numSteps == 1 )
-        {
-            x *= x;
-            x += a;
-            x %= n;
-        }
+            mont.Square( x, x );
         else
-        {
-            PowMod( x, 2*ctrl.numSteps, n, x );
-            x += a;
-            x %= n;
-        }
-      };
-
-    auto QAdvance =
-      [&]( const BigInt& x, const BigInt& x2, BigInt& Q )
-      {
-        tmp = x2;
-        tmp -= x;
-        Q *= tmp;
-        Q %= n;
+            mont.PowMod( x, 2*ctrl.numSteps, x );
+        mont.AddMod( x, aHat, x );
       };
 
-    Int gcdDelay = ctrl.gcdDelay;
-    BigInt xi=ctrl.x0;
-    BigInt x2i(xi);
-    BigInt xiSave=xi, x2iSave=x2i;
-    BigInt Qi(1);
-    Int delayCounter=1, i=1;
-    while( true )
+    const Int gcdDelay = Max( ctrl.gcdDelay, Int(1) );
+    BigInt x, y, ySave, diff, QHat, gcd;
+    mont.ToMontgomery( ctrl.x0, y );
+    QHat = mont.One();
+    gcd = one;
+    Int r=1, i=0;
+    while( gcd == one )
     {
-        // Advance xi once
-        xAdvance( xi );
-
-        // Advance x2i twice
-        xAdvance( x2i );
-        xAdvance( x2i );
+        x = y;
+        for( Int k=0; k<r; ++k )
+            xAdvance( y );
+        i += r;
 
-        // Advance Qi
-        QAdvance( xi, x2i, Qi );
-
-        if( delayCounter >= gcdDelay )
+        for( Int k=0; k<r && gcd == one; k+=gcdDelay )
         {
-            GCD( Qi, n, gcd );
-            if( gcd > one )
+            ySave = y;
+            const Int numSteps = Min( gcdDelay, r-k );
+            for( Int step=0; step<numSteps; ++step )
             {
-                if( gcd == n )
-                {
-                    if( gcdDelay == 1 )
-                    {
-                        RuntimeError("(x) converged before (x mod p) at i=",i);
-                    }
-                    else
-                    {
-                        if( ctrl.progress )
-                            Output("Backtracking at i=",i);
-                        i = Max( i-(gcdDelay+1), 0 );
-                        gcdDelay = 1;
-                        xi = xiSave;
-                        x2i = x2iSave;
-                    }
-                }
-                else
-                {
-                    if( ctrl.progress )
-                        Output("Found factor ",gcd," at i=",i); 
-                    return gcd;
-                }
+                xAdvance( y );
+                mont.SubtractMod( x, y, diff );
+                mont.Multiply( QHat, diff, QHat );
             }
-
-            delayCounter = 0;
-            xiSave = xi;
-            x2iSave = x2i;
-            Qi = 1;
+            i += numSteps;
+            GCD( QHat, n, gcd );
         }
-        ++delayCounter;
-        ++i;
+        r *= 2;
     }
+
+    if( gcd == n )
+    {
+        // Retrace the last batch of steps one GCD at a time
+        if( ctrl.progress )
+            Output("Backtracking at i=",i);
+        do
+        {
+            xAdvance( ySave );
+            mont.SubtractMod( x, ySave, diff );
+            GCD( diff, n, gcd );
+        } while( gcd == one );
+        if( gcd == n )
+            RuntimeError("(x) converged before (x mod p) at i=",i);
+    }
+    if( ctrl.progress )
+        Output("Found factor ",gcd," at i=",i);
+    return gcd;
 }
 
 } // namespace pollard_rho
@@ -204,6 +196,100 @@ inline vector<BigInt> PollardRho
     return factors;
 }
 
+inline vector<vector<BigInt>> PollardRho
+( const vector<BigInt>& numbers,
+  const PollardRhoCtrl& ctrl )
+{
+    const Int numNumbers = numbers.size();
+    vector<vector<BigInt>> factors( numNumbers );
+
+    // The trial divisions and primality tests make use of the global sieve
+    // and random number generator and are therefore performed sequentially,
+    // whereas the rho searches are independent
+    vector<Int> owners;
+    vector<BigInt> composites;
+    auto classify =
+      [&]( Int j, const BigInt& m )
+      {
+        if( m <= BigInt(1) )
+            return;
+        Primality primality = PrimalityTest( m, ctrl.numReps );
+        if( primality == PRIME || primality == PROBABLY_PRIME )
+        {
+            factors[j].push_back( m );
+        }
+        else
+        {
+            owners.push_back( j );
+            composites.push_back( m );
+        }
+      };
+    for( Int j=0; j<numNumbers; ++j )
+    {
+        BigInt nRem = numbers[j];
+        if( !ctrl.avoidTrialDiv )
+        {
+            auto tinyFactors = TrialDivision( nRem, ctrl.trialDivLimit );
+            for( auto tinyFactor : tinyFactors )
+            {
+                factors[j].push_back( tinyFactor );
+                nRem /= tinyFactor;
+            }
+        }
+        classify( j, nRem );
+    }
+
+    PollardRhoCtrl searchCtrl( ctrl );
+    searchCtrl.progress = false;
+    while( !composites.empty() )
+    {
+        const Int numComposites = composites.size();
+        if( ctrl.progress )
+            Output("Searching for factors of ",numComposites," composites");
+        vector<BigInt> divisors( numComposites );
+        EL_PARALLEL_FOR_DYNAMIC
+        for( Int k=0; k<numComposites; ++k )
+        {
+            // Exceptions cannot escape the parallel region, so a failure is
+            // marked with a divisor of one
+            try
+            {
+                divisors[k] =
+                  pollard_rho::FindFactor( composites[k], ctrl.a0, searchCtrl );
+            }
+            catch( const exception& )
+            {
+                try
+                {
+                    divisors[k] =
+                      pollard_rho::FindFactor
+                      ( composites[k], ctrl.a1, searchCtrl );
+                }
+                catch( const exception& )
+                {
+                    divisors[k] = 1;
+                }
+            }
+        }
+
+        auto oldOwners = std::move( owners );
+        auto oldComposites = std::move( composites );
+        owners.clear();
+        composites.clear();
+        for( Int k=0; k<numComposites; ++k )
+        {
+            if( divisors[k] == BigInt(1) )
+                RuntimeError("Could not find a factor of ",oldComposites[k]);
+            classify( oldOwners[k], divisors[k] );
+            classify( oldOwners[k], oldComposites[k] / divisors[k] );
+        }
+    }
+
+    for( auto& numberFactors : factors )
+        sort( numberFactors.begin(), numberFactors.end() );
+    return factors;
+}
+
 } // namespace factor
 
 } // namespace El
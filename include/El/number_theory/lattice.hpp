@@ -90,6 +90,34 @@ Int ZDependenceSearch
         Matrix<F>& U, 
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// The same search with the weight increased over 'numStages' stages, i.e.,
+//
+//   sqrt(N_k) = sqrt(N)^((k+1)/numStages),  k=0,...,numStages-1,
+//
+// where each stage reduces B_k = [U_{k-1}; sqrt(N_k) z^T U_{k-1}], with
+// U_{k-1} the unimodular transformation found by the previous stage. The
+// early stages only resolve the leading digits of z, and each later stage
+// begins from a nearly-reduced basis and requires few additional swaps.
+template<typename F>
+Int ZDependenceSearch
+( const Matrix<F>& z,
+        Base<F> NSqrt,
+        Matrix<F>& B,
+        Matrix<F>& U,
+        Int numStages,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+// Run (staged) searches for each of the given weights in parallel, returning
+// the number of (nearly) exact Z-dependences found for each
+template<typename F>
+vector<Int> ZDependenceSearch
+( const Matrix<F>& z,
+  const vector<Base<F>>& NSqrtList,
+        vector<Matrix<F>>& BList,
+        vector<Matrix<F>>& UList,
+        Int numStages=1,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
 // Search for an algebraic relation
 // ================================
 // Search for the (Gaussian) integer coefficients of a polynomial of alpha
@@ -103,6 +131,29 @@ Int AlgebraicRelationSearch
   Matrix<F>& U, 
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// The staged variant of the search (see ZDependenceSearch)
+template<typename F>
+Int AlgebraicRelationSearch
+( F alpha,
+  Int n,
+  Base<F> NSqrt,
+  Matrix<F>& B,
+  Matrix<F>& U,
+  Int numStages,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+// Run (staged) searches for each of the given numbers of coefficients (i.e.,
+// the degree plus one) in parallel
+template<typename F>
+vector<Int> AlgebraicRelationSearch
+( F alpha,
+  const vector<Int>& nList,
+  Base<F> NSqrt,
+  vector<Matrix<F>>& BList,
+  vector<Matrix<F>>& UList,
+  Int numStages=1,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
 } // namespace El
 
 #include <El/number_theory/lattice/Enumerate.hpp>
@@ -110,6 +161,39 @@ Int AlgebraicRelationSearch
 
 namespace El {
 
+// Distributed lattice reduction
+// =============================
+// Reduce a basis stored in a distributed matrix via a block scheme:
+// contiguous segments of 'segmentSize' columns are gathered onto the
+// processes which own them (cyclically) and reduced with the sequential
+// algorithm, alternating with the segments which straddle the previous
+// boundaries. Each round then ends with a distributed Householder QR
+// factorization of the entire basis, from which the size reduction is
+// computed (redundantly) and applied with a distributed Gemm, along with
+// the disjoint swaps of each adjacent pair of columns which violates the
+// Lovasz condition. If a round ends without any such violations, the basis
+// is LLL-reduced; after 'segmentSweeps' rounds, the reduction is instead
+// finished on a single process.
+template<typename F>
+LLLInfo<Base<F>> LLL
+( AbstractDistMatrix<F>& B,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+template<typename F>
+LLLInfo<Base<F>> LLL
+( AbstractDistMatrix<F>& B,
+  AbstractDistMatrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+// Run BKZ on each segment (of width at least twice the blocksize) of a
+// distributed basis, alternating between aligned and straddling segments,
+// with the LLL reduction across the segment boundaries restored by the
+// distributed LLL after each round. The result is LLL-reduced, and each of
+// its segments is BKZ-reduced.
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( AbstractDistMatrix<F>& B,
+  const BKZCtrl<Base<F>>& ctrl=BKZCtrl<Base<F>>() );
+
 // Lattice coordinates
 // ===================
 // Seek the coordinates x in Z^n of a vector y within a lattice B, i.e.,
@@ -131,6 +215,64 @@ void EnrichLattice( Matrix<F>& B, Matrix<F>& U, const Matrix<F>& v );
 // Closest vector problem
 // ======================
 
+template<typename Real>
+struct NearestPlaneCtrl
+{
+    // Used for the reduction of the basis (when it is not already reduced)
+    // and for the rounding threshold, 'eta', of Babai's algorithm
+    LLLCtrl<Real> lllCtrl;
+
+    // Babai's algorithm is applied to 'blockSize' rows of R at a time for
+    // every target, followed by a single matrix-matrix update of the rows
+    // above the block
+    Int blockSize=32;
+
+    // Distribute the targets over the available threads
+    bool parallel=true;
+
+    // If 'refine' is true, each of Babai's approximations is improved by a
+    // depth-first enumeration of the lattice points within its distance
+    // of the target, where the bound on the last j+1 coordinates is the j'th
+    // pruning coefficient times the current distance (see
+    // svp::PruningCoefficients). At most 'maxEnumNodes' nodes are visited
+    // per target (if it is positive).
+    //
+    // NOTE: There is not currently a complex implementation.
+    bool refine=false;
+    bool linearPruning=false;
+    bool customPruning=false;
+    Matrix<Real> pruningCoeffs;
+    Int maxEnumNodes=1000000;
+
+    bool progress=false;
+    bool time=false;
+
+    template<typename OtherReal>
+    NearestPlaneCtrl<Real>& operator=( const NearestPlaneCtrl<OtherReal>& ctrl )
+    {
+        lllCtrl = ctrl.lllCtrl;
+        blockSize = ctrl.blockSize;
+        parallel = ctrl.parallel;
+        refine = ctrl.refine;
+        linearPruning = ctrl.linearPruning;
+        customPruning = ctrl.customPruning;
+        Copy( ctrl.pruningCoeffs, pruningCoeffs );
+        maxEnumNodes = ctrl.maxEnumNodes;
+        progress = ctrl.progress;
+        time = ctrl.time;
+        return *this;
+    }
+
+    NearestPlaneCtrl() { }
+    NearestPlaneCtrl( const NearestPlaneCtrl<Real>& ctrl ) { *this = ctrl; }
+    template<typename OtherReal>
+    NearestPlaneCtrl( const NearestPlaneCtrl<OtherReal>& ctrl )
+    { *this = ctrl; }
+};
+
+// Fill each column of X with an approximation of the lattice point (within
+// the lattice generated by the columns of B) which is nearest to the
+// corresponding column of T.
 template<typename F>
 void NearestPlane
 ( const Matrix<F>& B,
@@ -138,6 +280,8 @@ void NearestPlane
         Matrix<F>& X,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// The same, but with the QR factorization of an LLL-reduced B (as returned
+// by LLLWithQ) provided so that it may be shared between many calls
 template<typename F>
 void NearestPlane
 ( const Matrix<F>& B,
@@ -148,6 +292,23 @@ void NearestPlane
         Matrix<F>& X,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+template<typename F>
+void NearestPlane
+( const Matrix<F>& B,
+  const Matrix<F>& T,
+        Matrix<F>& X,
+  const NearestPlaneCtrl<Base<F>>& ctrl );
+
+template<typename F>
+void NearestPlane
+( const Matrix<F>& B,
+  const Matrix<F>& QR,
+  const Matrix<F>& t,
+  const Matrix<Base<F>>& d,
+  const Matrix<F>& T,
+        Matrix<F>& X,
+  const NearestPlaneCtrl<Base<F>>& ctrl );
+
 } // namespace El
 
 #include <El/number_theory/lattice/NearestPlane.hpp>
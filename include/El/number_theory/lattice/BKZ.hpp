@@ -86,6 +86,45 @@ struct BKZCtrl
     // with shuffling at each merge.
     bool recursive=false;
 
+    // BKZ 2.0
+    // -------
+    // C.f. Y. Chen and P. Q. Nguyen, "BKZ 2.0: Better lattice security
+    // estimates", ASIACRYPT 2011.
+    //
+    // If 'preprocess' is true, each block is locally reduced before its
+    // enumeration by a single tour of BKZ over the block with blocksize
+    // preprocessBlocksizeFunc(bsize); since that BKZ preprocesses its own
+    // blocks in the same manner, the recursion ends once the function returns
+    // a blocksize less than two.
+    bool preprocess=false;
+    function<Int(Int)> preprocessBlocksizeFunc =
+      function<Int(Int)>( []( Int bsize )
+      { return ( bsize >= 40 ? bsize/2 : Int(0) ); } );
+
+    // If 'prune' is true, blocks of size at least 'pruneMinBlocksize' are
+    // searched with 'pruneNumTrials' trials of extreme pruning (GNR_ENUM).
+    // The pruning coefficients are computed once per block size.
+    bool prune=false;
+    Int pruneMinBlocksize=30;
+    Int pruneNumTrials=1;
+
+    // If 'sieve' is true, blocks of size at least 'sieveMinBlocksize' are
+    // solved with a Gauss sieve (SIEVE_ENUM, configured by 'enumCtrl') rather
+    // than by enumeration (which takes precedence over 'prune')
+    bool sieve=false;
+    Int sieveMinBlocksize=60;
+
+    // If 'progressive' is true, the tours are scheduled with blocksizes
+    // increasing from 'progressiveStart' to 'blocksize' in increments of
+    // 'progressiveStep'; every blocksize but the last is aborted after
+    // 'progressiveTours' tours.
+    bool progressive=false;
+    Int progressiveStart=10;
+    Int progressiveStep=10;
+    Int progressiveTours=4;
+
+    // The logs are buffered in memory and written to their files in chunks
+    // of roughly 'logBufferSize' bytes (and when the reduction completes)
     bool logFailedEnums=false;
     std::string failedEnumFile="BKZFailedEnums.txt";
 
@@ -101,11 +140,23 @@ struct BKZCtrl
     bool logProjNorms=false;
     std::string projNormsFile="BKZProjNorms.txt";
 
+    Int logBufferSize=1<<20;
+
     bool checkpoint=false;
     FileFormat checkpointFormat=ASCII;
     std::string checkpointFileBase="BKZCheckpoint";
     std::string tourFileBase="BKZTour";
 
+    // If non-null, the basis (and transformation) is recorded into the given
+    // checkpoint and saved in the background at the beginning of every
+    // 'checkpointFreq' tours. If 'resume' is true, the latest complete
+    // snapshot, if any, is loaded and the reduction continues from it.
+    // Since the snapshots are in the working precision, the attempts to
+    // reduce integer bases in a lower precision are skipped.
+    Checkpoint* checkpointer=nullptr;
+    Int checkpointFreq=1;
+    bool resume=false;
+
     LLLCtrl<Real> lllCtrl;
 
     // We frequently need to convert datatypes, so make this easy
@@ -140,6 +191,21 @@ struct BKZCtrl
 
         recursive = ctrl.recursive;
 
+        preprocess = ctrl.preprocess;
+        preprocessBlocksizeFunc = ctrl.preprocessBlocksizeFunc;
+
+        prune = ctrl.prune;
+        pruneMinBlocksize = ctrl.pruneMinBlocksize;
+        pruneNumTrials = ctrl.pruneNumTrials;
+
+        sieve = ctrl.sieve;
+        sieveMinBlocksize = ctrl.sieveMinBlocksize;
+
+        progressive = ctrl.progressive;
+        progressiveStart = ctrl.progressiveStart;
+        progressiveStep = ctrl.progressiveStep;
+        progressiveTours = ctrl.progressiveTours;
+
         logFailedEnums = ctrl.logFailedEnums;
         logStreakSizes = ctrl.logStreakSizes;
         logNontrivialCoords = ctrl.logNontrivialCoords;
@@ -151,9 +217,13 @@ struct BKZCtrl
         nontrivialCoordsFile = ctrl.nontrivialCoordsFile;
         normsFile = ctrl.normsFile;
         projNormsFile = ctrl.projNormsFile;
+        logBufferSize = ctrl.logBufferSize;
         checkpointFileBase = ctrl.checkpointFileBase;
         tourFileBase = ctrl.tourFileBase;
         checkpointFormat = ctrl.checkpointFormat;
+        checkpointer = ctrl.checkpointer;
+        checkpointFreq = ctrl.checkpointFreq;
+        resume = ctrl.resume;
 
         lllCtrl = ctrl.lllCtrl;
         return *this;
@@ -219,6 +289,287 @@ bool TrivialCoordinates( const Matrix<F>& v )
     return true;
 }
 
+// Accumulate a diagnostic log in memory so that the file is only written to
+// once per (roughly) 'bufferSize' bytes
+class LogBuffer
+{
+public:
+    void Open( const string& filename, Int bufferSize )
+    {
+        file_.open( filename.c_str() );
+        bufferSize_ = bufferSize;
+    }
+
+    template<typename T>
+    LogBuffer& operator<<( const T& x )
+    {
+        buffer_ << x;
+        return *this;
+    }
+
+    // Manipulators such as std::endl end a record
+    LogBuffer& operator<<( std::ostream& (*manip)(std::ostream&) )
+    {
+        manip( buffer_ );
+        if( Int(buffer_.tellp()) >= bufferSize_ )
+            Flush();
+        return *this;
+    }
+
+    void Flush()
+    {
+        if( file_.is_open() )
+            file_ << buffer_.str() << std::flush;
+        buffer_.str("");
+    }
+
+    void Close()
+    {
+        Flush();
+        if( file_.is_open() )
+            file_.close();
+    }
+
+    ~LogBuffer() { Close(); }
+
+private:
+    ofstream file_;
+    std::ostringstream buffer_;
+    Int bufferSize_=0;
+};
+
+// The pruning coefficients of each block size are only computed once
+template<typename Real>
+class PruningCache
+{
+public:
+    const Matrix<Real>& Coefficients( Int bsize, bool linear )
+    {
+        auto it = coeffs_.find( bsize );
+        if( it == coeffs_.end() )
+            it = coeffs_.insert
+              ( std::make_pair
+                ( bsize, svp::PruningCoefficients<Real>(bsize,linear) ) ).first;
+        return it->second;
+    }
+
+private:
+    std::map<Int,Matrix<Real>> coeffs_;
+};
+
+// Choose the enumeration strategy for the block beginning at index j
+template<typename Real>
+void SetBlockEnumCtrl
+( EnumCtrl<Real>& enumCtrl,
+  Int j,
+  Int bsize,
+  const BKZCtrl<Real>& ctrl,
+  PruningCache<Real>& pruningCache )
+{
+    enumCtrl.enumType =
+      ( ctrl.variableEnumType ? ctrl.enumTypeFunc(j) : ctrl.enumCtrl.enumType );
+    if( ctrl.sieve && bsize >= ctrl.sieveMinBlocksize )
+        enumCtrl.enumType = SIEVE_ENUM;
+    else if( ctrl.prune && bsize >= ctrl.pruneMinBlocksize )
+    {
+        enumCtrl.enumType = GNR_ENUM;
+        enumCtrl.numTrials = ctrl.pruneNumTrials;
+        enumCtrl.customPruning = true;
+        enumCtrl.pruningCoeffs =
+          pruningCache.Coefficients( bsize, ctrl.enumCtrl.linearBounding );
+    }
+    else if( ctrl.prune )
+    {
+        enumCtrl.numTrials = ctrl.enumCtrl.numTrials;
+        enumCtrl.customPruning = ctrl.enumCtrl.customPruning;
+        if( enumCtrl.customPruning )
+            enumCtrl.pruningCoeffs = ctrl.enumCtrl.pruningCoeffs;
+    }
+}
+
+// The control structure for a single tour of BKZ over the block [j,k] which
+// prepares it for enumeration
+template<typename Real>
+BKZCtrl<Real> PreprocessCtrl( const BKZCtrl<Real>& ctrl, Int j, Int k )
+{
+    BKZCtrl<Real> subCtrl( ctrl );
+    subCtrl.blocksize = ctrl.preprocessBlocksizeFunc(k+1-j);
+    subCtrl.time = false;
+    subCtrl.progress = false;
+    subCtrl.jumpstart = true;
+    subCtrl.startCol = j;
+    // Stop upon reaching the end of the block for the first time
+    subCtrl.earlyAbort = true;
+    subCtrl.numEnumsBeforeAbort = 1;
+    subCtrl.subBKZ = false;
+    subCtrl.progressive = false;
+    subCtrl.variableBlocksize = false;
+    subCtrl.variableEnumType = false;
+    subCtrl.recursive = false;
+    subCtrl.logFailedEnums = false;
+    subCtrl.logStreakSizes = false;
+    subCtrl.logNontrivialCoords = false;
+    subCtrl.logNorms = false;
+    subCtrl.logProjNorms = false;
+    subCtrl.checkpoint = false;
+    subCtrl.enumCtrl.disablePrecDrop = true;
+    subCtrl.enumCtrl.time = false;
+    subCtrl.enumCtrl.progress = false;
+    subCtrl.lllCtrl.jumpstart = false;
+    subCtrl.lllCtrl.recursive = false;
+    return subCtrl;
+}
+
+// Return true if the preprocessing of the block [j,k] modified the basis
+template<typename F>
+bool PreprocessBlock
+( Matrix<F>& B,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  Int j,
+  Int k,
+  const BKZCtrl<Base<F>>& ctrl,
+  Int& numSwaps )
+{
+    DEBUG_CSE
+    auto subCtrl = PreprocessCtrl( ctrl, j, k );
+    if( subCtrl.blocksize < 2 || subCtrl.blocksize >= k+1-j )
+        return false;
+    const auto subInd = IR(0,k+1);
+    auto BSub = B( ALL, subInd );
+    auto QRSub = QR( ALL, subInd );
+    auto tSub = t( subInd, ALL );
+    auto dSub = d( subInd, ALL );
+    auto info = BKZWithQ( BSub, QRSub, tSub, dSub, subCtrl );
+    numSwaps += info.numSwaps;
+    return info.numSwaps != 0 || info.numEnumFailures != 0;
+}
+
+template<typename F>
+bool PreprocessBlock
+( Matrix<F>& B,
+  Matrix<F>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  Int j,
+  Int k,
+  const BKZCtrl<Base<F>>& ctrl,
+  Int& numSwaps )
+{
+    DEBUG_CSE
+    auto subCtrl = PreprocessCtrl( ctrl, j, k );
+    if( subCtrl.blocksize < 2 || subCtrl.blocksize >= k+1-j )
+        return false;
+    const auto subInd = IR(0,k+1);
+    auto BSub = B( ALL, subInd );
+    auto QRSub = QR( ALL, subInd );
+    auto tSub = t( subInd, ALL );
+    auto dSub = d( subInd, ALL );
+    Matrix<F> W;
+    Identity( W, k+1, k+1 );
+    auto info = BKZWithQ( BSub, W, QRSub, tSub, dSub, subCtrl );
+    auto USub = U( ALL, subInd );
+    auto USubCopy( USub );
+    Gemm( NORMAL, NORMAL, F(1), USubCopy, W, USub );
+    numSwaps += info.numSwaps;
+    return info.numSwaps != 0 || info.numEnumFailures != 0;
+}
+
+// The control structure for the tours with blocksize 'bsize' within a
+// progressive BKZ
+template<typename Real>
+BKZCtrl<Real> ProgressiveCtrl
+( const BKZCtrl<Real>& ctrl, Int bsize, bool firstStage, Int n )
+{
+    BKZCtrl<Real> stageCtrl( ctrl );
+    stageCtrl.progressive = false;
+    stageCtrl.blocksize = bsize;
+    if( !firstStage )
+    {
+        stageCtrl.jumpstart = true;
+        stageCtrl.startCol = 0;
+    }
+    if( bsize < ctrl.blocksize )
+    {
+        const Int numEnumsBeforeAbort = ctrl.progressiveTours*n;
+        stageCtrl.earlyAbort = true;
+        stageCtrl.numEnumsBeforeAbort =
+          ( ctrl.earlyAbort ?
+            Min(numEnumsBeforeAbort,ctrl.numEnumsBeforeAbort) :
+            numEnumsBeforeAbort );
+    }
+    return stageCtrl;
+}
+
+template<typename Real>
+void AccumulateProgressive( BKZInfo<Real>& info, const BKZInfo<Real>& stage )
+{
+    const Int numSwaps = info.numSwaps + stage.numSwaps;
+    const Int numEnums = info.numEnums + stage.numEnums;
+    const Int numEnumFailures = info.numEnumFailures + stage.numEnumFailures;
+    info = stage;
+    info.numSwaps = numSwaps;
+    info.numEnums = numEnums;
+    info.numEnumFailures = numEnumFailures;
+}
+
+template<typename F>
+BKZInfo<Base<F>> Progressive
+( Matrix<F>& B,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.progressiveStep < 1 )
+        LogicError("progressiveStep must be positive");
+    BKZInfo<Base<F>> info;
+    info.numSwaps = info.numEnums = info.numEnumFailures = 0;
+    Int bsize = Max(Min(ctrl.progressiveStart,ctrl.blocksize),Int(2));
+    for( bool firstStage=true; ; firstStage=false )
+    {
+        if( ctrl.progress )
+            Output("Progressive BKZ with blocksize=",bsize);
+        auto stageCtrl = ProgressiveCtrl( ctrl, bsize, firstStage, B.Width() );
+        AccumulateProgressive( info, BKZWithQ( B, QR, t, d, stageCtrl ) );
+        if( bsize == ctrl.blocksize )
+            break;
+        bsize = Min(bsize+ctrl.progressiveStep,ctrl.blocksize);
+    }
+    return info;
+}
+
+template<typename F>
+BKZInfo<Base<F>> Progressive
+( Matrix<F>& B,
+  Matrix<F>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.progressiveStep < 1 )
+        LogicError("progressiveStep must be positive");
+    BKZInfo<Base<F>> info;
+    info.numSwaps = info.numEnums = info.numEnumFailures = 0;
+    Int bsize = Max(Min(ctrl.progressiveStart,ctrl.blocksize),Int(2));
+    for( bool firstStage=true; ; firstStage=false )
+    {
+        if( ctrl.progress )
+            Output("Progressive BKZ with blocksize=",bsize);
+        auto stageCtrl = ProgressiveCtrl( ctrl, bsize, firstStage, B.Width() );
+        AccumulateProgressive( info, BKZWithQ( B, U, QR, t, d, stageCtrl ) );
+        if( bsize == ctrl.blocksize )
+            break;
+        bsize = Min(bsize+ctrl.progressiveStep,ctrl.blocksize);
+    }
+    return info;
+}
+
 template<typename RealLower,typename F>
 bool TryLowerPrecision
 ( Matrix<F>& B,
@@ -427,11 +778,23 @@ BKZInfo<Base<F>> BKZWithQ
   const BKZCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("BKZ");
     typedef Base<F> Real;
     const Int n = B.Width();
 
+    if( ctrl.checkpointer && ctrl.resume && ctrl.checkpointer->Load() )
+    {
+        ctrl.checkpointer->Restore( "B", B );
+        ctrl.checkpointer->Restore( "U", U );
+        auto ctrlMod( ctrl );
+        ctrlMod.resume = false;
+        ctrlMod.jumpstart = true;
+        ctrlMod.startCol = 0;
+        return BKZWithQ( B, U, QR, t, d, ctrlMod );
+    }
+
     const bool isInteger = IsInteger( B );
-    if( isInteger )
+    if( isInteger && !ctrl.checkpointer )
     {
         const Real BOneNorm = OneNorm(B);
         const Real fudge = 2; // TODO: Make tunable
@@ -472,6 +835,9 @@ BKZInfo<Base<F>> BKZWithQ
         //return RecursiveBKZWithQ( B, U, QR, t, d, ctrl );
         Output("Warning: Computation of U not yet supported for recursive BKZ");
     }
+    if( ctrl.progressive && !ctrl.variableBlocksize &&
+        ctrl.progressiveStart < ctrl.blocksize )
+        return bkz::Progressive( B, U, QR, t, d, ctrl );
 
     if( ctrl.time )
     {
@@ -538,26 +904,28 @@ BKZInfo<Base<F>> BKZWithQ
     // The zero columns should be at the end of B
     const Int rank = lllInfo.rank;
 
-    ofstream failedEnumFile, streakSizesFile,
-             normsFile, projNormsFile,
-             nontrivialCoordsFile;
+    bkz::LogBuffer failedEnumFile, streakSizesFile,
+                   normsFile, projNormsFile,
+                   nontrivialCoordsFile;
     if( ctrl.logFailedEnums )
-        failedEnumFile.open( ctrl.failedEnumFile.c_str() );
+        failedEnumFile.Open( ctrl.failedEnumFile, ctrl.logBufferSize );
     if( ctrl.logStreakSizes )
-        streakSizesFile.open( ctrl.streakSizesFile.c_str() );
+        streakSizesFile.Open( ctrl.streakSizesFile, ctrl.logBufferSize );
     if( ctrl.logNorms )
-        normsFile.open( ctrl.normsFile.c_str() );
+        normsFile.Open( ctrl.normsFile, ctrl.logBufferSize );
     if( ctrl.logProjNorms )
-        projNormsFile.open( ctrl.projNormsFile.c_str() );
+        projNormsFile.Open( ctrl.projNormsFile, ctrl.logBufferSize );
     if( ctrl.logNontrivialCoords )
-        nontrivialCoordsFile.open( ctrl.nontrivialCoordsFile.c_str() );
+        nontrivialCoordsFile.Open
+        ( ctrl.nontrivialCoordsFile, ctrl.logBufferSize );
 
     auto enumCtrl = ctrl.enumCtrl;
     enumCtrl.disablePrecDrop = true;
+    bkz::PruningCache<Real> pruningCache;
 
     Int z=0;
     Int j = ( ctrl.jumpstart ? ctrl.startCol : 0 ) - 1;
-    Int numEnums=0, numEnumFailures=0;
+    Int numEnums=0, numEnumFailures=0, numTours=0;
     const Int indent = PushIndent(); 
     while( z < rank-1 ) 
     {
@@ -573,6 +941,16 @@ BKZInfo<Base<F>> BKZWithQ
             if( j == 0 )
                 Write( B, ctrl.tourFileBase, ctrl.checkpointFormat, "B" );
         }
+        if( ctrl.checkpointer && j == 0 )
+        {
+            if( numTours % ctrl.checkpointFreq == 0 )
+            {
+                ctrl.checkpointer->Record( "B", B );
+                ctrl.checkpointer->Record( "U", U );
+                ctrl.checkpointer->Save( numTours );
+            }
+            ++numTours;
+        }
         if( j == 0 )
         {
             if( ctrl.logNorms )
@@ -588,15 +966,19 @@ BKZInfo<Base<F>> BKZWithQ
                 projNormsFile << endl;
             }
         }
-        
+
+        bool preprocessChanged = false;
+        if( ctrl.preprocess )
+            preprocessChanged = bkz::PreprocessBlock
+              ( B, U, QR, t, d, j, k, ctrl, numSwaps );
+
         Matrix<F> v;
         auto BEnum = B( ALL, IR(j,k+1) );
         auto UEnum = U( ALL, IR(j,k+1) );
         auto QREnum = QR( IR(j,k+1), IR(j,k+1) );
         if( ctrl.time )
             bkz::enumTimer.Start();
-        if( ctrl.variableEnumType )
-            enumCtrl.enumType = ctrl.enumTypeFunc(j);
+        bkz::SetBlockEnumCtrl( enumCtrl, j, k+1-j, ctrl, pruningCache );
         const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
         auto normUpperBounds = GetRealPartOfDiagonal(QR(windowInd,windowInd));
         Scale( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
@@ -648,7 +1030,7 @@ BKZInfo<Base<F>> BKZWithQ
         Matrix<F> W;
         Identity( W, h+1, h+1 );
         
-        bool changed = false;
+        bool changed = preprocessChanged;
         const auto subInd = IR(0,h+1);
         auto BSub = B( ALL, subInd );
         auto QRSub = QR( ALL, subInd );
@@ -664,6 +1046,7 @@ BKZInfo<Base<F>> BKZWithQ
             subCtrl.jumpstart = true;
             // Only if we insist on only one level of recursion
             subCtrl.subBKZ = false;
+            subCtrl.progressive = false;
             subCtrl.blocksize = ctrl.subBlocksizeFunc(ctrl.blocksize);
             subCtrl.earlyAbort = ctrl.subEarlyAbort;
             subCtrl.numEnumsBeforeAbort = ctrl.subNumEnumsBeforeAbort;
@@ -740,15 +1123,15 @@ BKZInfo<Base<F>> BKZWithQ
     numSwaps += lllInfo.numSwaps;
 
     if( ctrl.logFailedEnums )
-        failedEnumFile.close();
+        failedEnumFile.Close();
     if( ctrl.logStreakSizes )
-        streakSizesFile.close();
+        streakSizesFile.Close();
     if( ctrl.logNorms )
-        normsFile.close();
+        normsFile.Close();
     if( ctrl.logProjNorms )
-        projNormsFile.close();
+        projNormsFile.Close();
     if( ctrl.logNontrivialCoords )
-        nontrivialCoordsFile.close();
+        nontrivialCoordsFile.Close();
 
     if( ctrl.time )
     {
@@ -793,11 +1176,22 @@ BKZInfo<Base<F>> BKZWithQ
   const BKZCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("BKZ");
     typedef Base<F> Real;
     const Int n = B.Width();
 
+    if( ctrl.checkpointer && ctrl.resume && ctrl.checkpointer->Load() )
+    {
+        ctrl.checkpointer->Restore( "B", B );
+        auto ctrlMod( ctrl );
+        ctrlMod.resume = false;
+        ctrlMod.jumpstart = true;
+        ctrlMod.startCol = 0;
+        return BKZWithQ( B, QR, t, d, ctrlMod );
+    }
+
     const bool isInteger = IsInteger(B);
-    if( isInteger )
+    if( isInteger && !ctrl.checkpointer )
     {
         const Real BOneNorm = OneNorm(B);
         const Real fudge = 2; // TODO: Make tunable
@@ -835,6 +1229,9 @@ BKZInfo<Base<F>> BKZWithQ
         Max(ctrl.blocksize,ctrl.lllCtrl.cutoff) < n &&
         !ctrl.jumpstart )
         return RecursiveBKZWithQ( B, QR, t, d, ctrl );
+    if( ctrl.progressive && !ctrl.variableBlocksize &&
+        ctrl.progressiveStart < ctrl.blocksize )
+        return bkz::Progressive( B, QR, t, d, ctrl );
 
     if( ctrl.time )
     {
@@ -900,26 +1297,28 @@ BKZInfo<Base<F>> BKZWithQ
     // The zero columns should be at the end of B
     const Int rank = lllInfo.rank;
 
-    ofstream failedEnumFile, streakSizesFile,
-             normsFile, projNormsFile,
-             nontrivialCoordsFile;
+    bkz::LogBuffer failedEnumFile, streakSizesFile,
+                   normsFile, projNormsFile,
+                   nontrivialCoordsFile;
     if( ctrl.logFailedEnums )
-        failedEnumFile.open( ctrl.failedEnumFile.c_str() );
+        failedEnumFile.Open( ctrl.failedEnumFile, ctrl.logBufferSize );
     if( ctrl.logStreakSizes )
-        streakSizesFile.open( ctrl.streakSizesFile.c_str() );
+        streakSizesFile.Open( ctrl.streakSizesFile, ctrl.logBufferSize );
     if( ctrl.logNorms )
-        normsFile.open( ctrl.normsFile.c_str() );
+        normsFile.Open( ctrl.normsFile, ctrl.logBufferSize );
     if( ctrl.logProjNorms )
-        projNormsFile.open( ctrl.projNormsFile.c_str() );
+        projNormsFile.Open( ctrl.projNormsFile, ctrl.logBufferSize );
     if( ctrl.logNontrivialCoords )
-        nontrivialCoordsFile.open( ctrl.nontrivialCoordsFile.c_str() );
+        nontrivialCoordsFile.Open
+        ( ctrl.nontrivialCoordsFile, ctrl.logBufferSize );
 
     auto enumCtrl = ctrl.enumCtrl;
     enumCtrl.disablePrecDrop = true;
+    bkz::PruningCache<Real> pruningCache;
 
     Int z=0;
     Int j = ( ctrl.jumpstart ? ctrl.startCol : 0 ) - 1;
-    Int numEnums=0, numEnumFailures=0;
+    Int numEnums=0, numEnumFailures=0, numTours=0;
     const Int indent = PushIndent(); 
     while( z < rank-1 ) 
     {
@@ -935,6 +1334,15 @@ BKZInfo<Base<F>> BKZWithQ
             if( j == 0 )
                 Write( B, ctrl.tourFileBase, ctrl.checkpointFormat, "B" );
         }
+        if( ctrl.checkpointer && j == 0 )
+        {
+            if( numTours % ctrl.checkpointFreq == 0 )
+            {
+                ctrl.checkpointer->Record( "B", B );
+                ctrl.checkpointer->Save( numTours );
+            }
+            ++numTours;
+        }
         if( j == 0 )
         {
             if( ctrl.logNorms )
@@ -950,14 +1358,18 @@ BKZInfo<Base<F>> BKZWithQ
                 projNormsFile << endl;
             }
         }
-        
+
+        bool preprocessChanged = false;
+        if( ctrl.preprocess )
+            preprocessChanged = bkz::PreprocessBlock
+              ( B, QR, t, d, j, k, ctrl, numSwaps );
+
         Matrix<F> v;
         auto BEnum = B( ALL, IR(j,k+1) );
         auto QREnum = QR( IR(j,k+1), IR(j,k+1) );
         if( ctrl.time )
             bkz::enumTimer.Start();
-        if( ctrl.variableEnumType )
-            enumCtrl.enumType = ctrl.enumTypeFunc(j);
+        bkz::SetBlockEnumCtrl( enumCtrl, j, k+1-j, ctrl, pruningCache );
         const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
         auto normUpperBounds = GetRealPartOfDiagonal(QR(windowInd,windowInd));
         Scale( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
@@ -1006,7 +1418,7 @@ BKZInfo<Base<F>> BKZWithQ
                  " with j=",j,", z=",z);
         }
         
-        bool changed = false;
+        bool changed = preprocessChanged;
         const auto subInd = IR(0,h+1);
         auto BSub = B( ALL, subInd );
         auto QRSub = QR( ALL, subInd );
@@ -1022,6 +1434,7 @@ BKZInfo<Base<F>> BKZWithQ
             subCtrl.jumpstart = true;
             // Only if we insist on only one level of recursion
             subCtrl.subBKZ = false;
+            subCtrl.progressive = false;
             subCtrl.blocksize = ctrl.subBlocksizeFunc(ctrl.blocksize);
             subCtrl.earlyAbort = ctrl.subEarlyAbort;
             subCtrl.numEnumsBeforeAbort = ctrl.subNumEnumsBeforeAbort;
@@ -1096,15 +1509,15 @@ BKZInfo<Base<F>> BKZWithQ
     numSwaps += lllInfo.numSwaps;
 
     if( ctrl.logFailedEnums )
-        failedEnumFile.close();
+        failedEnumFile.Close();
     if( ctrl.logStreakSizes )
-        streakSizesFile.close();
+        streakSizesFile.Close();
     if( ctrl.logNontrivialCoords )
-        nontrivialCoordsFile.close();
+        nontrivialCoordsFile.Close();
     if( ctrl.logNorms )
-        normsFile.close();
+        normsFile.Close();
     if( ctrl.logProjNorms )
-        projNormsFile.close();
+        projNormsFile.Close();
 
     if( ctrl.time )
     {
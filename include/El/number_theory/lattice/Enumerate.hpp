@@ -14,7 +14,8 @@ namespace El {
 enum EnumType {
   FULL_ENUM,
   GNR_ENUM,
-  YSPARSE_ENUM
+  YSPARSE_ENUM,
+  SIEVE_ENUM
 };
 
 template<typename Real>
@@ -40,6 +41,12 @@ struct EnumCtrl
     bool linearBounding=false;
     Int numTrials=1000;
 
+    // If 'customPruning' is true, the bound on the last j+1 coordinates of
+    // an n-dimensional enumeration is pruningCoeffs(j) times the norm bound,
+    // where 'pruningCoeffs' must have height n (see svp::PruningCoefficients)
+    bool customPruning=false;
+    Matrix<Real> pruningCoeffs;
+
     // YSPARSE_ENUM
     // ------------
     Int phaseLength=10;
@@ -62,6 +69,34 @@ struct EnumCtrl
 
     Int progressLevel=0;
 
+    // SIEVE_ENUM
+    // ----------
+    // The Gauss sieve terminates after
+    //   sieveMinCollisions + sieveCollisionRatio |L|
+    // collisions, where |L| is the current list size, or once the list holds
+    // 'sieveMaxListSize' vectors. New vectors are sampled using Klein's
+    // algorithm with a width of 'sieveWidth' times the norm of the first
+    // basis vector.
+    Int sieveMinCollisions=200;
+    double sieveCollisionRatio=0.1;
+    Int sieveMaxListSize=1<<20;
+    double sieveWidth=1.;
+
+    // Parallel enumeration
+    // --------------------
+    // If 'parallel' is true, FULL_ENUM splits the enumeration tree into the
+    // subtrees rooted 'splitDepth' levels below the top nonzero coordinate,
+    // which are distributed cyclically over the processes in 'comm' and
+    // dynamically over their threads. The radius of the shortest vector found
+    // so far is shared immediately between threads and after every
+    // 'syncInterval' subtrees between processes. GNR_ENUM instead runs its
+    // pruning trials concurrently. Every process in 'comm' must make the
+    // call with the same input.
+    bool parallel=false;
+    Int splitDepth=4;
+    Int syncInterval=64;
+    mpi::Comm comm=mpi::COMM_SELF;
+
     template<typename OtherReal>
     EnumCtrl<Real>& operator=( const EnumCtrl<OtherReal>& ctrl )
     {
@@ -77,6 +112,8 @@ struct EnumCtrl
         // --------
         linearBounding = ctrl.linearBounding;
         numTrials = ctrl.numTrials;
+        customPruning = ctrl.customPruning;
+        Copy( ctrl.pruningCoeffs, pruningCoeffs );
 
         // YSPARSE_ENUM
         // ------------
@@ -97,6 +134,16 @@ struct EnumCtrl
 
         progressLevel = ctrl.progressLevel;
 
+        sieveMinCollisions = ctrl.sieveMinCollisions;
+        sieveCollisionRatio = ctrl.sieveCollisionRatio;
+        sieveMaxListSize = ctrl.sieveMaxListSize;
+        sieveWidth = ctrl.sieveWidth;
+
+        parallel = ctrl.parallel;
+        splitDepth = ctrl.splitDepth;
+        syncInterval = ctrl.syncInterval;
+        comm = ctrl.comm;
+
         return *this;
     }
 
@@ -386,6 +433,39 @@ Base<F> GNREnumeration
         Matrix<F>& v,
   const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
 
+// A parallel analogue of GNREnumeration (see the 'parallel' member of
+// EnumCtrl) which, rather than returning the first lattice vector satisfying
+// the bounds, returns the shortest one, as the bounds are scaled down each
+// time a shorter vector is found.
+template<typename F>
+Base<F> ParallelGNREnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& u,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
+
+// A Gauss sieve (see SIEVE_ENUM) which returns the shortest vector it found
+// if its norm is less than 'normUpperBound' and a value greater than the
+// bound otherwise. Its list of vectors is stored in single precision with
+// int16 coordinates, and its scans of the list are multithreaded.
+//
+// NOTE: There is not currently a complex implementation.
+template<typename F>
+Base<F> GaussSieve
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
+
+// Return the default pruning coefficients of an n-dimensional GNR_ENUM: the
+// bound on the last j+1 coordinates is the j'th coefficient times the norm
+// bound. The coefficients are either linear or interpolated from the
+// profile of Aono.
+template<typename Real>
+Matrix<Real> PruningCoefficients( Int n, bool linear=false );
+
 // Convert to/from the so-called "y-sparse" representation of
 //
 //   Dan Ding, Guizhen Zhu, Yang Yu, and Zhongxiang Zheng,
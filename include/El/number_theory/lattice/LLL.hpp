@@ -166,6 +166,15 @@ struct LLLCtrl
     bool recursive=false;
     Int cutoff=10;
 
+    // If 'segmented' is true, the columns are split into segments of width
+    // 'segmentSize' which are reduced independently (and concurrently, when
+    // OpenMP is enabled), followed by reductions of the segments straddling
+    // the previous boundaries, for at most 'segmentSweeps' sweeps before a
+    // final pass over the entire basis
+    bool segmented=false;
+    Int segmentSize=32;
+    Int segmentSweeps=4;
+
     // Fudge factor for determining whether to drop precision
     Real precisionFudge=Real(2);
 
@@ -222,6 +231,9 @@ struct LLLCtrl
         variant = ctrl.variant;
         recursive = ctrl.recursive;
         cutoff = ctrl.cutoff;
+        segmented = ctrl.segmented;
+        segmentSize = ctrl.segmentSize;
+        segmentSweeps = ctrl.segmentSweeps;
         presort = ctrl.presort;
         smallestFirst = ctrl.smallestFirst;
         reorthogTol = Real(ctrl.reorthogTol);
@@ -255,6 +267,9 @@ struct LLLCtrl
         variant = ctrl.variant;
         recursive = ctrl.recursive;
         cutoff = ctrl.cutoff;
+        segmented = ctrl.segmented;
+        segmentSize = ctrl.segmentSize;
+        segmentSweeps = ctrl.segmentSweeps;
         presort = ctrl.presort;
         smallestFirst = ctrl.smallestFirst;
         reorthogTol = Real(ctrl.reorthogTol);
@@ -274,7 +289,14 @@ struct LLLCtrl
     LLLCtrl( const LLLCtrl<OtherReal>& ctrl ) { *this = ctrl; }
 };
 
-// TODO: Maintain B in BigInt form
+// NOTE: The basis B (and transformation U) may be stored in an exact
+//       integer type Z (e.g., BigInt, or Int when the entries are known to
+//       remain bounded) while the QR factorization is stored in the
+//       floating-point type F. The size reductions of a BigInt basis then
+//       use the fused (mpz_addmul-based) BLAS kernels rather than BigFloat
+//       arithmetic. AdaptiveLLL (below) additionally escalates the
+//       precision of F only as needed.
+
 
 template<typename Z,typename F=Z>
 LLLInfo<Base<F>> LLL
@@ -311,6 +333,21 @@ LLLInfo<Base<F>> LLLWithQ
   Matrix<Base<F>>& d,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// Reduce B using an L^2-style driver which keeps B exact and performs the
+// orthogonalization in double, DoubleDouble, QuadDouble, or BigFloat as
+// needed for each block of 'blockSize' columns
+template<typename Z>
+LLLInfo<double> AdaptiveLLL
+( Matrix<Z>& B,
+  const LLLCtrl<double>& ctrl=LLLCtrl<double>(),
+  Int blockSize=32 );
+template<typename Z>
+LLLInfo<double> AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  const LLLCtrl<double>& ctrl=LLLCtrl<double>(),
+  Int blockSize=32 );
+
 namespace lll {
 
 static Timer stepTimer, houseStepTimer,
@@ -437,6 +474,8 @@ LLLInfo<Base<F>> LLLWithQ
     const Int n = B.Width();
     if( ctrl.recursive && ctrl.cutoff < n )
         return RecursiveLLLWithQ( B, U, QR, t, d, ctrl );
+    if( ctrl.segmented && ctrl.segmentSize < n )
+        return SegmentedLLLWithQ( B, U, QR, t, d, ctrl );
 
     if( ctrl.delta < Real(1)/Real(2) )
         LogicError("delta is assumed to be at least 1/2");
@@ -521,6 +560,8 @@ LLLWithQ
     const Int n = B.Width();
     if( ctrl.recursive && ctrl.cutoff < n )
         return RecursiveLLLWithQ( B, QR, t, d, ctrl );
+    if( ctrl.segmented && ctrl.segmentSize < n )
+        return SegmentedLLLWithQ( B, QR, t, d, ctrl );
 
     if( ctrl.delta < Real(1)/Real(2) )
         LogicError("delta is assumed to be at least 1/2");
@@ -1080,6 +1121,199 @@ RecursiveLLLWithQ
       ( B, U, QR, t, d, numShuffles, maintainU, ctrlMod );
 }
 
+// Segment (block-parallel) LLL: split the basis into contiguous segments of
+// columns which are reduced independently, then reduce the segments that
+// straddle the previous boundaries (shifted by half of a segment) so that
+// short vectors can migrate between neighbouring segments, alternating until
+// a phase performs no swaps. Since the segments are disjoint, each phase is
+// embarrassingly parallel. Each reduction uses the requested variant, and a
+// final (jumpstarted) pass over the entire basis ensures that the result
+// satisfies the requested reduction properties, though it is usually cheap
+// since the segments are then nearly reduced.
+//
+// C.f. the segment reduction of
+//
+//   C.P. Schnorr, "A more efficient algorithm for lattice basis reduction",
+//   Journal of Algorithms, Vol. 9, No. 1, pp. 47--62, 1988.
+//
+
+namespace lll {
+
+// Reduce the segments B(:,starts[k]:starts[k+1]-1) independently and return
+// the total number of swaps.
+//
+// The segments are only reduced concurrently for fixed-precision data: the
+// reductions of BigFloat data may temporarily change the MPFR precision
+// (see TryLowerPrecisionBigFloatMerge), which is per-thread in MPFR but
+// global in the BigFloat MPI datatypes. The segments neither print nor use
+// the (shared) timers, and exceptions are rethrown after the loop.
+template<typename Z,typename F>
+Int ReduceSegments
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  const vector<Int>& starts,
+  bool maintainU,
+  Int& firstSwap,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int numSegments = starts.size()-1;
+    vector<Int> numSwaps(numSegments,0), firstSwaps(numSegments,B.Width());
+    vector<std::exception_ptr> errors(numSegments);
+
+    auto ctrlSeg( ctrl );
+    ctrlSeg.progress = false;
+    ctrlSeg.time = false;
+
+#ifdef EL_HYBRID
+    #pragma omp parallel for if( IsFixedPrecision<Real>::value )
+#endif
+    for( Int k=0; k<numSegments; ++k )
+    {
+        const Range<Int> ind(starts[k],starts[k+1]);
+        if( ind.end-ind.beg < 2 )
+            continue;
+        try
+        {
+            auto BSeg = B( ALL, ind );
+            Matrix<F> QRSeg, tSeg;
+            Matrix<Real> dSeg;
+            LLLInfo<Real> segInfo;
+            if( maintainU )
+            {
+                Matrix<Z> USeg;
+                segInfo = LLLWithQ( BSeg, USeg, QRSeg, tSeg, dSeg, ctrlSeg );
+
+                auto UBlock = U( ALL, ind );
+                auto UBlockCopy( UBlock );
+                Gemm( NORMAL, NORMAL, Z(1), UBlockCopy, USeg, Z(0), UBlock );
+            }
+            else
+            {
+                segInfo = LLLWithQ( BSeg, QRSeg, tSeg, dSeg, ctrlSeg );
+            }
+            numSwaps[k] = segInfo.numSwaps;
+            if( segInfo.numSwaps > 0 )
+                firstSwaps[k] = ind.beg + segInfo.firstSwap;
+        }
+        catch( ... ) { errors[k] = std::current_exception(); }
+    }
+    for( const auto& error : errors )
+        if( error )
+            std::rethrow_exception( error );
+
+    Int totalSwaps = 0;
+    for( Int k=0; k<numSegments; ++k )
+    {
+        totalSwaps += numSwaps[k];
+        firstSwap = Min( firstSwap, firstSwaps[k] );
+    }
+    return totalSwaps;
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+SegmentedHelper
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = B.Width();
+    const Int segmentSize = Max( ctrl.segmentSize, Int(2) );
+    if( maintainU )
+        Identity( U, n, n );
+
+    auto ctrlSeg( ctrl );
+    ctrlSeg.segmented = false;
+    ctrlSeg.jumpstart = false;
+    ctrlSeg.startCol = 0;
+
+    vector<Int> alignedStarts, shiftedStarts;
+    for( Int j=0; j<n; j+=segmentSize )
+        alignedStarts.push_back( j );
+    alignedStarts.push_back( n );
+    for( Int j=segmentSize/2; j<n; j+=segmentSize )
+        shiftedStarts.push_back( j );
+    shiftedStarts.push_back( n );
+
+    Int numSwaps=0, firstSwap=n;
+    for( Int sweep=0; sweep<ctrl.segmentSweeps; ++sweep )
+    {
+        const Int alignedSwaps = ReduceSegments<Z,F>
+          ( B, U, alignedStarts, maintainU, firstSwap, ctrlSeg );
+        numSwaps += alignedSwaps;
+        if( ctrl.progress )
+            Output("Sweep ",sweep,": aligned swaps=",alignedSwaps);
+        if( sweep > 0 && alignedSwaps == 0 )
+            break;
+
+        // Merge across the boundaries of the aligned segments
+        const Int shiftedSwaps = ReduceSegments<Z,F>
+          ( B, U, shiftedStarts, maintainU, firstSwap, ctrlSeg );
+        numSwaps += shiftedSwaps;
+        if( ctrl.progress )
+            Output("Sweep ",sweep,": shifted swaps=",shiftedSwaps);
+        if( shiftedSwaps == 0 )
+            break;
+    }
+
+    auto ctrlMod( ctrl );
+    ctrlMod.segmented = false;
+    ctrlMod.recursive = false;
+    ctrlMod.jumpstart = true;
+    ctrlMod.startCol = 0;
+    LLLInfo<Base<F>> info;
+    if( maintainU )
+        info = LLLWithQ( B, U, QR, t, d, ctrlMod );
+    else
+        info = LLLWithQ( B, QR, t, d, ctrlMod );
+    info.numSwaps += numSwaps;
+    info.firstSwap = Min( info.firstSwap, firstSwap );
+    return info;
+}
+
+} // namespace lll
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+SegmentedLLLWithQ
+( Matrix<Z>& B,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        Output("Warning: Segmented LLL ignores jumpstarts");
+    Matrix<Z> U;
+    bool maintainU=false;
+    return lll::SegmentedHelper( B, U, QR, t, d, maintainU, ctrl );
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+SegmentedLLLWithQ
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        Output("Warning: Segmented LLL ignores jumpstarts");
+    bool maintainU=true;
+    return lll::SegmentedHelper( B, U, QR, t, d, maintainU, ctrl );
+}
+
 template<typename Z, typename F>
 LLLInfo<Base<F>>
 LLL
@@ -1127,4 +1361,6 @@ void DeepRowSwap( Matrix<Z>& B, Int i, Int k )
 
 } // namespace El
 
+#include <El/number_theory/lattice/LLL/Adaptive.hpp>
+
 #endif // ifndef EL_LATTICE_LLL_HPP
@@ -0,0 +1,204 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_ADAPTIVE_HPP
+#define EL_LATTICE_LLL_ADAPTIVE_HPP
+
+// An L^2-style driver in the spirit of
+//
+//   P. Q. Nguyen and D. Stehle, "An LLL algorithm with quadratic complexity",
+//   SIAM Journal on Computing, Vol. 39, No. 3, pp. 874--903, 2009.
+//
+// The basis B is kept exact (e.g., as a BigInt matrix) and the leading
+// columns are reduced incrementally, 'blockSize' columns at a time. Each
+// block runs LLL upon a copy of the basis in the cheapest floating-point
+// type (starting with double) and the resulting unimodular transformation is
+// applied to B in exact arithmetic. Precision loss is detected either by
+// the overflow checks within LLL itself, by a transformation which is not
+// exactly representable, or by a failure of the updated basis to satisfy
+// the requested (delta,eta) reduction when its QR factorization is
+// recomputed from scratch; in each case the block is retried in the next
+// type (DoubleDouble, QuadDouble, and then BigFloat with increasing
+// precision) before the following block drops back down to double.
+//
+
+namespace El {
+namespace lll {
+
+// Return true if the block was successfully reduced using Real arithmetic.
+// Even when false is returned, B and U may have been updated by a unimodular
+// transformation.
+template<typename Z,typename Real>
+bool TryAdaptiveBlock
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  const LLLCtrl<double>& ctrl,
+  LLLInfo<double>& info )
+{
+    DEBUG_CSE
+    typedef ConvertBase<Z,Real> F;
+    const string typeString = TypeName<Real>();
+    const Real eps = limits::Epsilon<Real>();
+
+    LLLCtrl<Real> ctrlLower( ctrl );
+    ctrlLower.recursive = false;
+    ctrlLower.segmented = false;
+    ctrlLower.jumpstart = false;
+    ctrlLower.startCol = 0;
+    ctrlLower.progress = false;
+    ctrlLower.time = false;
+
+    Matrix<F> BLower, UNewLower, QRLower, tLower;
+    Matrix<Real> dLower;
+    Copy( B, BLower );
+    LLLInfo<Real> infoLower;
+    try
+    {
+        infoLower =
+          LLLWithQ( BLower, UNewLower, QRLower, tLower, dLower, ctrlLower );
+    }
+    catch( std::exception& e )
+    {
+        if( ctrl.progress )
+            Output("  ",typeString," LLL failed: ",e.what());
+        return false;
+    }
+
+    // The transformation must be exactly representable to be applied
+    const Int n = UNewLower.Width();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            if( Abs(UNewLower(i,j)) >= 1/eps )
+            {
+                if( ctrl.progress )
+                    Output("  ",typeString," transformation is inexact");
+                return false;
+            }
+    if( !IsInteger( UNewLower ) )
+    {
+        if( ctrl.progress )
+            Output("  ",typeString," transformation is not integral");
+        return false;
+    }
+
+    Matrix<Z> UNew;
+    Copy( UNewLower, UNew );
+    auto BCopy( B );
+    Gemm( NORMAL, NORMAL, Z(1), BCopy, UNew, Z(0), B );
+    auto UCopy( U );
+    Gemm( NORMAL, NORMAL, Z(1), UCopy, UNew, Z(0), U );
+
+    // Verify the reduction of the exact basis
+    Copy( B, BLower );
+    El::QR( BLower, tLower, dLower );
+    auto achieved = lll::Achieved( BLower, ctrlLower );
+    const Real tol = Sqrt(eps);
+    if( achieved.first < ctrlLower.delta*(1-tol) ||
+        achieved.second > ctrlLower.eta*(1+tol) )
+    {
+        if( ctrl.progress )
+            Output
+            ("  ",typeString," LLL only achieved delta=",achieved.first,
+             " and eta=",achieved.second);
+        return false;
+    }
+    if( ctrl.progress )
+        Output("  Reduced in ",typeString);
+    info = infoLower;
+    return true;
+}
+
+template<typename Z>
+bool AdaptiveBlock
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  const LLLCtrl<double>& ctrl,
+  LLLInfo<double>& info )
+{
+    DEBUG_CSE
+    if( TryAdaptiveBlock<Z,double>( B, U, ctrl, info ) )
+        return true;
+#ifdef EL_HAVE_QD
+    if( TryAdaptiveBlock<Z,DoubleDouble>( B, U, ctrl, info ) )
+        return true;
+    if( TryAdaptiveBlock<Z,QuadDouble>( B, U, ctrl, info ) )
+        return true;
+#elif defined(EL_HAVE_QUAD)
+    if( TryAdaptiveBlock<Z,Quad>( B, U, ctrl, info ) )
+        return true;
+#endif
+#ifdef EL_HAVE_MPC
+    // Double the BigFloat precision until the block is reduced
+    const mpfr_prec_t inputPrec = mpfr::Precision();
+    const mpfr_prec_t maxPrec = 65536;
+    bool succeeded = false;
+    for( mpfr_prec_t prec=512; prec<=maxPrec && !succeeded; prec*=2 )
+    {
+        mpfr::SetPrecision( prec );
+        succeeded = TryAdaptiveBlock<Z,BigFloat>( B, U, ctrl, info );
+    }
+    mpfr::SetPrecision( inputPrec );
+    return succeeded;
+#else
+    return false;
+#endif
+}
+
+} // namespace lll
+
+template<typename Z>
+LLLInfo<double> AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  const LLLCtrl<double>& ctrl,
+  Int blockSize )
+{
+    DEBUG_CSE
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        LogicError("Cannot jumpstart the adaptive-precision LLL");
+    if( blockSize < 1 )
+        LogicError("Invalid block size of ",blockSize);
+    const Int n = B.Width();
+    Identity( U, n, n );
+
+    LLLInfo<double> info;
+    Int numSwaps=0, firstSwap=n;
+    for( Int end=Min(blockSize,n); end>0; end=Min(end+blockSize,n) )
+    {
+        if( ctrl.progress )
+            Output("Reducing the first ",end," columns");
+        auto BLead = B( ALL, IR(0,end) );
+        auto ULead = U( ALL, IR(0,end) );
+        if( !lll::AdaptiveBlock( BLead, ULead, ctrl, info ) )
+            RuntimeError
+            ("Could not reduce the first ",end,
+             " columns in any available precision");
+        numSwaps += info.numSwaps;
+        firstSwap = Min( firstSwap, info.firstSwap );
+        if( end == n )
+            break;
+    }
+    info.numSwaps = numSwaps;
+    info.firstSwap = firstSwap;
+    return info;
+}
+
+template<typename Z>
+LLLInfo<double> AdaptiveLLL
+( Matrix<Z>& B,
+  const LLLCtrl<double>& ctrl,
+  Int blockSize )
+{
+    DEBUG_CSE
+    Matrix<Z> U;
+    return AdaptiveLLL( B, U, ctrl, blockSize );
+}
+
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_ADAPTIVE_HPP
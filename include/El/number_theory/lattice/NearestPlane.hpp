@@ -2,8 +2,8 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #ifndef EL_LATTICE_NEAREST_PLANE_HPP
@@ -11,7 +11,212 @@
 
 namespace El {
 
-// TODO: Add correctness tests for this routine
+namespace nearest_plane {
+
+// Run Babai's nearest plane algorithm on each column of the n x k matrix
+// RY, which initially holds the components of the targets in the directions
+// of the columns of Q, filling the (zero-initialized) n x k matrix X with
+// the rounded coefficients and overwriting RY with the residuals, RY - R X.
+//
+// Rather than sweeping over all n rows of R for one target at a time, the
+// rows are processed in blocks: each target is rounded within the diagonal
+// block, and then the rows above the block are updated for all of the
+// targets at once with a single Gemm.
+template<typename F>
+void Babai
+( const Matrix<F>& QR,
+        Matrix<F>& RY,
+        Matrix<F>& X,
+  const NearestPlaneCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = QR.Width();
+    const Int numRHS = RY.Width();
+    const Int blockSize = Max( ctrl.blockSize, Int(1) );
+    const Real eta = ctrl.lllCtrl.eta;
+
+    for( Int iEnd=n; iEnd>0; iEnd-=blockSize )
+    {
+        const Int iBeg = Max( iEnd-blockSize, Int(0) );
+        for( Int j=0; j<numRHS; ++j )
+        {
+            F* rYBuf = RY.Buffer(0,j);
+            for( Int i=iEnd-1; i>=iBeg; --i )
+            {
+                F chi = rYBuf[i] / QR(i,i);
+                if( Abs(RealPart(chi)) > eta || Abs(ImagPart(chi)) > eta )
+                {
+                    chi = Round(chi);
+                    blas::Axpy
+                    ( i-iBeg+1, -chi,
+                      QR.LockedBuffer(iBeg,i), 1,
+                      &rYBuf[iBeg],            1 );
+                    X(i,j) = chi;
+                }
+            }
+        }
+        if( iBeg > 0 )
+        {
+            auto RY0 = RY( IR(0,iBeg), ALL );
+            auto R01 = QR( IR(0,iBeg), IR(iBeg,iEnd) );
+            auto X1 = X( IR(iBeg,iEnd), ALL );
+            Gemm( NORMAL, NORMAL, F(-1), R01, X1, F(1), RY0 );
+        }
+    }
+}
+
+// Search for an integer correction z to Babai's coefficients which
+// decreases || r - R z ||_2, where r is the Babai residual, using a
+// Schnorr-Euchner enumeration with the given (squared) pruning coefficients.
+// The return value is whether a correction was found, in which case it is
+// stored in 'z'.
+template<typename Real>
+bool EnumerateCorrection
+( const Matrix<Real>& QR,
+  const Real* r,
+        Real* z,
+  const Matrix<Real>& pruningCoeffsSquared,
+        Int maxNodes )
+{
+    DEBUG_CSE
+    const Int n = QR.Width();
+    Real radiusSq = 0;
+    for( Int i=0; i<n; ++i )
+        radiusSq += r[i]*r[i];
+    if( radiusSq == Real(0) )
+        return false;
+
+    vector<Real> x(n), center(n), partial(n+1), step(n), stepDelta(n);
+    auto setCenter =
+      [&]( Int k )
+      {
+        Real gamma = r[k];
+        for( Int j=k+1; j<n; ++j )
+            gamma -= QR(k,j)*x[j];
+        center[k] = gamma / QR(k,k);
+        x[k] = Round(center[k]);
+        step[k] = stepDelta[k] = ( center[k] >= x[k] ? Real(1) : Real(-1) );
+      };
+    // Zig-zag outward from the center, e.g., 0, 1, -1, 2, -2, ...
+    auto advance =
+      [&]( Int k )
+      {
+        x[k] += step[k];
+        stepDelta[k] = -stepDelta[k];
+        step[k] = stepDelta[k] - step[k];
+      };
+
+    bool improved = false;
+    partial[n] = 0;
+    Int k = n-1;
+    setCenter( k );
+    for( Int numNodes=1; maxNodes <= 0 || numNodes <= maxNodes; ++numNodes )
+    {
+        const Real diff = (x[k]-center[k])*QR(k,k);
+        const Real dist = partial[k+1] + diff*diff;
+        if( dist < pruningCoeffsSquared(n-1-k)*radiusSq )
+        {
+            if( k == 0 )
+            {
+                if( dist < radiusSq )
+                {
+                    radiusSq = dist;
+                    for( Int i=0; i<n; ++i )
+                        z[i] = x[i];
+                    improved = true;
+                }
+                advance( k );
+            }
+            else
+            {
+                partial[k] = dist;
+                --k;
+                setCenter( k );
+            }
+        }
+        else
+        {
+            ++k;
+            if( k == n )
+                break;
+            advance( k );
+        }
+    }
+    return improved;
+}
+
+template<typename Real>
+void Refine
+( const Matrix<Real>& QR,
+  const Matrix<Real>& RY,
+        Matrix<Real>& X,
+  const NearestPlaneCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = QR.Width();
+    const Int numRHS = RY.Width();
+
+    Matrix<Real> pruningCoeffsSquared;
+    if( ctrl.customPruning )
+    {
+        if( ctrl.pruningCoeffs.Height() != n ||
+            ctrl.pruningCoeffs.Width() != 1 )
+            LogicError
+            ("Expected ",n," x 1 pruning coefficients but they were ",
+             ctrl.pruningCoeffs.Height()," x ",ctrl.pruningCoeffs.Width());
+        pruningCoeffsSquared = ctrl.pruningCoeffs;
+    }
+    else
+        pruningCoeffsSquared =
+          svp::PruningCoefficients<Real>( n, ctrl.linearPruning );
+    for( Int j=0; j<n; ++j )
+        pruningCoeffsSquared(j) *= pruningCoeffsSquared(j);
+
+    // The enumerations are independent and of highly variable length
+    vector<byte> improved( numRHS, 0 );
+    Matrix<Real> Z;
+    Zeros( Z, n, numRHS );
+#ifdef EL_HAVE_MPC
+    const mpfr_prec_t prec = mpfr::Precision();
+#endif
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int j=0; j<numRHS; ++j )
+    {
+#ifdef EL_HAVE_MPC
+        mpfr::SetThreadPrecision( prec );
+#endif
+        if( EnumerateCorrection
+            ( QR, RY.LockedBuffer(0,j), Z.Buffer(0,j),
+              pruningCoeffsSquared, ctrl.maxEnumNodes ) )
+        {
+            for( Int i=0; i<n; ++i )
+                X(i,j) += Z(i,j);
+            improved[j] = 1;
+        }
+    }
+    if( ctrl.progress )
+    {
+        Int numImproved = 0;
+        for( Int j=0; j<numRHS; ++j )
+            numImproved += improved[j];
+        Output("Enumeration improved ",numImproved," of ",numRHS," targets");
+    }
+}
+
+template<typename Real>
+void Refine
+( const Matrix<Complex<Real>>& QR,
+  const Matrix<Complex<Real>>& RY,
+        Matrix<Complex<Real>>& X,
+  const NearestPlaneCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    LogicError("Enumeration refinement is not yet supported for complex data");
+}
+
+} // namespace nearest_plane
+
 template<typename F>
 void NearestPlane
 ( const Matrix<F>& B,
@@ -20,73 +225,64 @@ void NearestPlane
   const Matrix<Base<F>>& d,
   const Matrix<F>& T,
         Matrix<F>& Y,
-  const LLLCtrl<Base<F>>& ctrl )
+  const NearestPlaneCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    const Int m = B.Height();
     const Int n = B.Width();
     const Int numRHS = T.Width();
+    Timer timer;
 
     // Compute the components of T in the directions of the columns of Q
-    Y = T;
-    Matrix<F> RY( Y );
+    // (for all of the targets at once)
+    if( ctrl.time )
+        timer.Start();
+    Matrix<F> RY( T );
     qr::ApplyQ( LEFT, ADJOINT, QR, t, d, RY );
+    auto RYTop = RY( IR(0,n), ALL );
+    if( ctrl.time )
+        Output("  ApplyQ: ",timer.Stop()," seconds");
 
-    // Run Babai's nearest plane algorithm on each column of Y.
-    // The result is an approximation of the difference between each column
-    // of Y and the nearest lattice point.
-    // TODO: Extract this into a separate routine that is shared with LLL
-    vector<F> xBuf(n);
-    for( Int j=0; j<numRHS; ++j )
+    // Distribute contiguous subsets of the targets over the threads
+    if( ctrl.time )
+        timer.Start();
+    Matrix<F> X;
+    Zeros( X, n, numRHS );
+    Int numChunks = 1;
+#ifdef EL_HYBRID
+    if( ctrl.parallel )
+        numChunks = Max( Min( Int(omp_get_max_threads()), numRHS ), Int(1) );
+#endif
+#ifdef EL_HAVE_MPC
+    // MPFR's default precision is per-thread
+    const mpfr_prec_t prec = mpfr::Precision();
+#endif
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
     {
-        F* yBuf = &Y(0,j);
-        F* rYBuf = &RY(0,j);
+#ifdef EL_HAVE_MPC
+        mpfr::SetThreadPrecision( prec );
+#endif
+        const Int jBeg = (chunk*numRHS) / numChunks;
+        const Int jEnd = ((chunk+1)*numRHS) / numChunks;
+        auto RYChunk = RYTop( ALL, IR(jBeg,jEnd) );
+        auto XChunk = X( ALL, IR(jBeg,jEnd) );
+        nearest_plane::Babai( QR, RYChunk, XChunk, ctrl );
+    }
+    if( ctrl.time )
+        Output("  Babai: ",timer.Stop()," seconds");
 
-        Int numNonzero=0;
-        for( Int i=n-1; i>=0; --i )
-        {
-            F chi = rYBuf[i] / QR(i,i);
-            if( Abs(RealPart(chi)) > ctrl.eta ||
-                Abs(ImagPart(chi)) > ctrl.eta )
-            {
-                chi = Round(chi);
-                blas::Axpy
-                ( i+1, -chi,
-                  &QR(0,i), 1,
-                  rYBuf,    1 );
-                ++numNonzero;
-            }
-            else
-                chi = 0;
-            xBuf[i] = chi;
-        }
-        const float nonzeroRatio = float(numNonzero)/float(n);
-        if( nonzeroRatio >= ctrl.blockingThresh )    
-        {
-            blas::Gemv
-            ( 'N', m, n,
-              F(-1), B.Buffer(), B.LDim(),
-                     &xBuf[0],   1,
-              F(+1), yBuf,       1 );
-        }
-        else
-        {
-            for( Int i=n-1; i>=0; --i )
-            {
-                const F chi = xBuf[i];
-                if( chi == F(0) )
-                    continue;
-                blas::Axpy
-                ( m, -chi,
-                  &B(0,i), 1,
-                  yBuf,    1 );
-            }
-        }
+    if( ctrl.refine )
+    {
+        if( ctrl.time )
+            timer.Start();
+        auto QRTop = QR( IR(0,n), ALL );
+        nearest_plane::Refine( QRTop, RYTop, X, ctrl );
+        if( ctrl.time )
+            Output("  Enumeration: ",timer.Stop()," seconds");
     }
 
-    // Y := T - Y
-    Y *= -1;
-    Y += T; 
+    // Y := B X
+    Gemm( NORMAL, NORMAL, F(1), B, X, Y );
 }
 
 template<typename F>
@@ -94,17 +290,14 @@ void NearestPlane
 ( const Matrix<F>& B,
   const Matrix<F>& T,
         Matrix<F>& Y,
-  const LLLCtrl<Base<F>>& ctrl )
+  const NearestPlaneCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    const Int m = B.Height();
-    const Int n = B.Width();
-    const Int numRHS = T.Width();
 
     // LLL-reduce B
     Matrix<F> BRed( B ), QR, t;
     Matrix<Base<F>> d;
-    auto info = LLLWithQ( BRed, QR, t, d, ctrl );
+    auto info = LLLWithQ( BRed, QR, t, d, ctrl.lllCtrl );
 
     auto BRedLeft = BRed( ALL, IR(0,info.rank) );
     auto QRLeft = QR( ALL, IR(0,info.rank) );
@@ -113,6 +306,35 @@ void NearestPlane
     NearestPlane( BRedLeft, QRLeft, tLeft, dLeft, T, Y, ctrl );
 }
 
+template<typename F>
+void NearestPlane
+( const Matrix<F>& B,
+  const Matrix<F>& QR,
+  const Matrix<F>& t,
+  const Matrix<Base<F>>& d,
+  const Matrix<F>& T,
+        Matrix<F>& Y,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    NearestPlaneCtrl<Base<F>> npCtrl;
+    npCtrl.lllCtrl = ctrl;
+    NearestPlane( B, QR, t, d, T, Y, npCtrl );
+}
+
+template<typename F>
+void NearestPlane
+( const Matrix<F>& B,
+  const Matrix<F>& T,
+        Matrix<F>& Y,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    NearestPlaneCtrl<Base<F>> npCtrl;
+    npCtrl.lllCtrl = ctrl;
+    NearestPlane( B, T, Y, npCtrl );
+}
+
 } // namespace El
 
 #endif // ifndef EL_LATTICE_NEAREST_PLANE_HPP
@@ -209,6 +209,85 @@ Int ModelFit
         ElementalMatrix<Real>& w,
   const ModelFitCtrl<Real>& ctrl=ModelFitCtrl<Real>() );
 
+// Proximal gradient model fits
+// ----------------------------
+// Rather than applying ADMM to proximal maps of the loss and regularizer,
+// the following solve
+//
+//   min_w sum_i f((A w + b)_i) + g(w),
+//
+// where the entrywise loss f is smooth and g is a CompositeReg (see prox.hpp).
+// The function 'loss' should return f(y) and overwrite its second argument
+// with f'(y), which should be 'lipschitz'-Lipschitz continuous. If 'w' has
+// the appropriate size on input, it is used as the initial guess.
+namespace model_fit {
+
+template<typename Real>
+struct ProxGradCtrl {
+  Real lipschitz=1;
+  // If nonpositive, the step size is 1/(lipschitz || A ||_2^2) (with || A ||_2
+  // replaced by the two-norm of the local block for BlockCoordinate)
+  Real stepSize=0;
+  Int maxIter=500;
+  // Stop once || w - wOld ||_2 <= tol (1 + || w ||_2)
+  Real tol=Real(1e-6);
+  // Reset the FISTA momentum whenever (v - w)^T (w - wOld) > 0, where v is
+  // the extrapolated point
+  bool restart=true;
+  bool progress=false;
+};
+
+// Accelerated proximal gradient (FISTA) with adaptive restart
+template<typename Real>
+Int FISTA
+( function<Real(Real,Real&)> loss,
+  const CompositeReg<Real>& reg,
+  const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& w,
+  const ProxGradCtrl<Real>& ctrl=ProxGradCtrl<Real>() );
+template<typename Real>
+Int FISTA
+( function<Real(Real,Real&)> loss,
+  const CompositeReg<Real>& reg,
+  const ElementalMatrix<Real>& A,
+  const ElementalMatrix<Real>& b,
+        ElementalMatrix<Real>& w,
+  const ProxGradCtrl<Real>& ctrl=ProxGradCtrl<Real>() );
+
+// Parallel block-coordinate descent over blocks of columns of A, where each
+// process simultaneously updates its own block using the residual from the
+// start of the sweep. The Frobenius penalty is not supported.
+template<typename Real>
+Int BlockCoordinate
+( function<Real(Real,Real&)> loss,
+  const CompositeReg<Real>& reg,
+  const ElementalMatrix<Real>& A,
+  const ElementalMatrix<Real>& b,
+        ElementalMatrix<Real>& w,
+  const ProxGradCtrl<Real>& ctrl=ProxGradCtrl<Real>() );
+
+} // namespace model_fit
+
+// Fit a model by streaming its data from disk
+// ===========================================
+// The out-of-core variants of the models below read their design matrix and
+// labels (stored in the BINARY format) in blocks of 'batchSize' rows, which
+// are visited in a random order within each of at most 'maxEpochs' epochs.
+// Iteration stops once the relative change in the model over an epoch is at
+// most 'tol'.
+
+template<typename Real>
+struct StreamingCtrl {
+  Int batchSize=1024;
+  Int maxEpochs=50;
+  Real tol=Real(1e-6);
+  // The step size of the stochastic gradient methods; if nonpositive, the
+  // inverse of the largest Lipschitz constant of the individual losses is used
+  Real stepSize=0;
+  bool progress=true;
+};
+
 // Logistic Regression
 // ===================
 // NOTE: This routine is still a prototype
@@ -230,6 +309,16 @@ Int LogisticRegression
   Real gamma,
   Regularization penalty=L1_PENALTY,
   const ModelFitCtrl<Real>& ctrl=ModelFitCtrl<Real>() );
+// Minibatch proximal Stochastic Variance Reduced Gradient (SVRG) over the
+// rows of G and q, which are streamed from the given files
+template<typename Real>
+Int LogisticRegression
+( const string& GFile,
+  const string& qFile,
+        Matrix<Real>& z,
+  Real gamma,
+  Regularization penalty=L1_PENALTY,
+  const StreamingCtrl<Real>& ctrl=StreamingCtrl<Real>() );
 
 // Robust least squares
 // ====================
@@ -300,17 +389,33 @@ namespace NNLSApproachNS {
 enum NNLSApproach {
     NNLS_ADMM, // The ADMM implementation is still a prototype
     NNLS_QP,
-    NNLS_SOCP
+    NNLS_SOCP,
+    NNLS_ACTIVE_SET // Lawson-Hanson using the cached Gram matrix A^T A
 };
 } // namespace NNLSApproachNS
 using namespace NNLSApproachNS;
 
+namespace nnls {
+
+template<typename Real>
+struct ActiveSetCtrl {
+  // Stop once no entry of the dual residual A^T (b - A x) restricted to the
+  // zero variables exceeds 'tol' times || A^T b ||_max
+  Real tol=Pow(limits::Epsilon<Real>(),Real(0.75));
+  // The maximum number of additions to the passive set per right-hand side
+  // (a nonpositive value selects three times the number of variables)
+  Int maxIts=0;
+};
+
+} // namespace nnls
+
 template<typename Real>
 struct NNLSCtrl {
   NNLSApproach approach=NNLS_SOCP;
   ADMMCtrl<Real> admmCtrl;
   qp::direct::Ctrl<Real> qpCtrl;    
   socp::affine::Ctrl<Real> socpCtrl;
+  nnls::ActiveSetCtrl<Real> activeSetCtrl;
 };
 
 template<typename Real>
@@ -338,6 +443,27 @@ void NNLS
         DistMultiVec<Real>& X,
   const NNLSCtrl<Real>& ctrl=NNLSCtrl<Real>() );
 
+namespace nnls {
+
+// Solve the NNLS problem for each column of B given the cached Gram matrix
+// G = A^T A and C = A^T B, so that a shared A need only be processed once.
+// The distributed version replicates G and distributes the right-hand sides
+// by columns. The maximum number of iterations over all columns is returned.
+template<typename Real>
+Int GramActiveSet
+( const Matrix<Real>& G,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl=ActiveSetCtrl<Real>() );
+template<typename Real>
+Int GramActiveSet
+( const ElementalMatrix<Real>& G,
+  const ElementalMatrix<Real>& C,
+        ElementalMatrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl=ActiveSetCtrl<Real>() );
+
+} // namespace nnls
+
 // Robust non-negative least squares
 // =================================
 // Given || [dA, db] ||_2 <= rho, minimize the worst-case error of
@@ -399,10 +525,32 @@ void RNNLS
 
 // Non-negative matrix factorization
 // =================================
+// Approximate A ~= X Y with X and Y entrywise non-negative
+
+namespace NMFApproachNS {
+enum NMFApproach {
+    NMF_NNLS,    // Alternate full NNLS solves using 'nnlsCtrl'
+    NMF_HALS,    // Accelerated hierarchical alternating least squares
+    NMF_ANLS_BPP // Alternating NNLS via block principal pivoting
+};
+} // namespace NMFApproachNS
+using namespace NMFApproachNS;
+
 template<typename Real>
 struct NMFCtrl {
+  NMFApproach approach=NMF_NNLS;
   NNLSCtrl<Real> nnlsCtrl;
   Int maxIter=20;
+
+  // The maximum number of HALS sweeps reusing the same Gram matrices
+  Int maxInnerSweeps=5;
+  // The maximum number of principal pivoting steps per NNLS subproblem
+  Int maxPivotIts=100;
+
+  // Stop once the relative change in || A - X Y ||_F falls below 'tol'
+  // (a value of zero disables the test)
+  Real tol=Real(0);
+  bool progress=false;
 };
 
 template<typename Real>
@@ -417,7 +565,19 @@ void NMF
         ElementalMatrix<Real>& X,
         ElementalMatrix<Real>& Y,
   const NMFCtrl<Real>& ctrl=NMFCtrl<Real>() );
-// TODO: Sparse versions
+// NOTE: The sparse versions do not support the NMF_NNLS approach
+template<typename Real>
+void NMF
+( const SparseMatrix<Real>& A,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl=NMFCtrl<Real>() );
+template<typename Real>
+void NMF
+( const DistSparseMatrix<Real>& A,
+        ElementalMatrix<Real>& X,
+        ElementalMatrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl=NMFCtrl<Real>() );
 
 // Basis pursuit denoising (BPDN), a.k.a.,
 // Least absolute selection and shrinkage operator (Lasso):
@@ -515,6 +675,61 @@ void EN
         DistMultiVec<Real>& x,
   const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
 
+// Regularization paths for BPDN and EN
+// ====================================
+// Solve for a nonincreasing sequence of l1 penalties, warm-starting each
+// solve from the previous solution and discarding columns via the SAFE and
+// sequential strong rules (the latter verified through a KKT check). If
+// 'lambdas' is empty on entry, it is overwritten with 'numLambdas'
+// logarithmically-spaced penalties descending from the smallest penalty
+// with a zero solution. Column k of X holds the solution for lambdas(k).
+
+template<typename Real>
+struct PathCtrl {
+  // Solve each screened subproblem with an IPM rather than with coordinate
+  // descent (only supported for dense matrices)
+  bool useIPM=false;
+  bool screen=true;
+  Int numLambdas=100;
+  Real minLambdaRatio=Real(1e-3);
+  Int maxSweeps=1000;
+  Real tol=Real(1e-7);
+  qp::affine::Ctrl<Real> ipmCtrl;
+  bool progress=false;
+};
+
+template<typename Real>
+void BPDNPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl=PathCtrl<Real>() );
+template<typename Real>
+void BPDNPath
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl=PathCtrl<Real>() );
+
+template<typename Real>
+void ENPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda2,
+        Matrix<Real>& lambda1s,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl=PathCtrl<Real>() );
+template<typename Real>
+void ENPath
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda2,
+        Matrix<Real>& lambda1s,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl=PathCtrl<Real>() );
+
 // Robust Principal Component Analysis (RPCA)
 // ==========================================
 
@@ -523,11 +738,17 @@ struct RPCACtrl
 {
     bool useALM=true;
     bool usePivQR=false;
+    // Use a randomized SVT warm-started from the previous iteration's
+    // singular subspace (takes precedence over 'usePivQR')
+    bool useRandomized=false;
     bool progress=true;
 
     Int numPivSteps=75;
     Int maxIts=1000;
 
+    Int svtOversample=10;
+    Int svtPowerIts=2;
+
     Real tau=Real(0);
     Real beta=Real(1);
     Real rho=Real(6);
@@ -559,6 +780,15 @@ struct SparseInvCovCtrl
     Real absTol=Real(1e-6);
     Real relTol=Real(1e-4);
     bool progress=true;
+
+    // Use the second-order QUIC method (for real data only) rather than
+    // ADMM, in which case 'maxIter' bounds the number of Newton steps and
+    // convergence is declared once the minimum-norm subgradient is at most
+    // 'relTol' times || X ||_1
+    bool useQUIC=false;
+    // Split the QUIC problem into the connected components of the graph
+    // with edges |S(i,j)| > lambda, which are solved independently
+    bool screen=true;
 };
 
 template<typename F>
@@ -573,6 +803,13 @@ Int SparseInvCov
         Base<F> lambda,
         ElementalMatrix<F>& Z,
   const SparseInvCovCtrl<Base<F>>& ctrl=SparseInvCovCtrl<Base<F>>() );
+// NOTE: Only supported when ctrl.useQUIC is true
+template<typename F>
+Int SparseInvCov
+( const Matrix<F>& D,
+        Base<F> lambda,
+        SparseMatrix<F>& Z,
+  const SparseInvCovCtrl<Base<F>>& ctrl=SparseInvCovCtrl<Base<F>>() );
 
 // Support Vector Machine (soft-margin)
 // ====================================
@@ -627,6 +864,22 @@ void SVM
         DistMultiVec<Real>& x,
   const SVMCtrl<Real>& ctrl=SVMCtrl<Real>() );
 
+// Minibatch dual block-coordinate ascent over the rows of A and d, which are
+// streamed from the given files. The bias is appended to the weights as an
+// extra feature (and is therefore also regularized), i.e., this solves
+//
+//   min_x (1/2) || x ||_2^2 + lambda sum_i max(0, 1 - d_i [a_i; 1]^T x),
+//
+// where x := [w; beta]. The dual variables (one per example) are kept in
+// memory.
+template<typename Real>
+Int SVM
+( const string& AFile,
+  const string& dFile,
+        Real lambda,
+        Matrix<Real>& x,
+  const StreamingCtrl<Real>& ctrl=StreamingCtrl<Real>() );
+
 // 1D total variation denoising (TV):
 //
 //   min (1/2) || b - x ||_2^2 + lambda || D x ||_1,
@@ -640,6 +893,9 @@ void SVM
 //
 // where x is in R^n and y is in R^(n-1).
 //
+// NOTE: TVProx solves the same problem (for many signals at once) with a
+//       direct algorithm which is far cheaper than the IPM used here.
+//
 // TODO: Generalize to complex after SOCP support
 
 template<typename Real>
@@ -709,6 +965,72 @@ void LongOnlyPortfolio
         DistMultiVec<Real>& x,
   const socp::affine::Ctrl<Real>& ctrl=socp::affine::Ctrl<Real>() );
 
+// Repeated rebalancing with a fixed factored covariance
+// -----------------------------------------------------
+// These objects retain D, F, and gamma so that the allocation can be cheaply
+// recomputed for a sequence of (slowly varying) expected returns. Each solve
+// is warm-started from the previous primal-dual solution and runs an
+// Interior Point Method whose KKT solves only factor an r x r matrix via the
+// Sherman-Morrison-Woodbury identity, where r is the width of F. The
+// 'targetTol', 'minTol', 'maxIts', 'maxStepRatio', 'mehrotra',
+// 'warmStartShift', 'warmStartCentrality', and 'print' members of the
+// control structure are respected.
+template<typename Real>
+class LongOnlyPortfolioSolver
+{
+public:
+    LongOnlyPortfolioSolver
+    ( const Matrix<Real>& d,
+      const SparseMatrix<Real>& F,
+            Real gamma,
+      const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+
+    // Compute the allocation for the expected returns 'c' and return the
+    // number of Interior Point iterations
+    Int Solve( const Matrix<Real>& c, Matrix<Real>& x );
+
+    // Cold-start the next solve
+    void Reset();
+
+private:
+    Real gamma_;
+    MehrotraCtrl<Real> ctrl_;
+    Matrix<Real> d_;
+    SparseMatrix<Real> F_;
+
+    bool haveSolution_;
+    Matrix<Real> x_, z_;
+    Real y_;
+};
+
+template<typename Real>
+class DistLongOnlyPortfolioSolver
+{
+public:
+    DistLongOnlyPortfolioSolver
+    ( const DistMultiVec<Real>& d,
+      const DistSparseMatrix<Real>& F,
+            Real gamma,
+      const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+
+    Int Solve( const DistMultiVec<Real>& c, DistMultiVec<Real>& x );
+
+    void Reset();
+
+private:
+    mpi::Comm comm_;
+    Real gamma_;
+    MehrotraCtrl<Real> ctrl_;
+
+    // The local rows of d and F
+    Matrix<Real> dLoc_;
+    SparseMatrix<Real> FLoc_;
+
+    bool haveSolution_;
+    Matrix<Real> xLoc_, zLoc_;
+    Real y_;
+};
+
 } // namespace El
 
 #endif // ifndef EL_OPTIMIZATION_MODELS_HPP
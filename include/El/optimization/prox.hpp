@@ -51,6 +51,33 @@ void FrobeniusProx( Matrix<F>& A, Base<F> rho );
 template<typename F>
 void FrobeniusProx( AbstractDistMatrix<F>& A, Base<F> rho );
 
+// Composite proximal map
+// ----------------------
+// Returns the solution to
+//     arg min tau g(A) + 1/2 || A - A0 ||_F^2
+//        A
+// for the penalty
+//     g(A) = l1 || vec(A) ||_1 + frobenius || A ||_F + ridge/2 || A ||_F^2
+// restricted to lower <= A <= upper. This fuses SoftThreshold, FrobeniusProx,
+// and Clip into a single pass over the local entries (preceded by the
+// reduction of a norm when 'frobenius' is nonzero). Since the Frobenius
+// penalty is not separable, it may not be combined with finite bounds.
+template<typename Real>
+struct CompositeReg
+{
+    Real l1=0;
+    Real frobenius=0;
+    Real ridge=0;
+    Real lower=-limits::Infinity<Real>();
+    Real upper=limits::Infinity<Real>();
+};
+
+template<typename Real>
+void CompositeProx( Matrix<Real>& A, const CompositeReg<Real>& reg, Real tau );
+template<typename Real>
+void CompositeProx
+( AbstractDistMatrix<Real>& A, const CompositeReg<Real>& reg, Real tau );
+
 // Hinge-loss proximal map
 // -----------------------
 // TODO: Description
@@ -109,6 +136,26 @@ Int PivotedQR
 
 template<typename F>
 Int TSQR( ElementalMatrix<F>& A, Base<F> rho, bool relative=false );
+// The same, but reusing the tall-skinny QR storage of a previous call on a
+// matrix of the same shape and distribution (e.g., within an iterative
+// method which soft-thresholds a sequence of such matrices)
+template<typename F>
+Int TSQR
+( ElementalMatrix<F>& A,
+  Base<F> rho,
+  qr::TreeData<F>& treeData,
+  bool relative=false );
+
+// Randomized SVT warm-started from (and overwriting) the right singular
+// subspace 'V' of a previous call; the width of 'V' is the rank estimate
+template<typename F>
+Int Randomized
+( Matrix<F>& A, Base<F> rho, Matrix<F>& V,
+  Int oversample=10, Int numPowerIts=2, bool relative=false );
+template<typename F>
+Int Randomized
+( ElementalMatrix<F>& A, Base<F> rho, ElementalMatrix<F>& V,
+  Int oversample=10, Int numPowerIts=2, bool relative=false );
 
 } // namespace svt
 
@@ -128,6 +175,41 @@ template<typename F>
 void SoftThreshold
 ( AbstractDistMatrix<F>& A, Base<F> rho, bool relative=false );
 
+// Total variation
+// ---------------
+// Overwrites each column a of A with the solution to
+//     arg min (1/2) || a - x ||_2^2 + rho || D x ||_1,
+//        x
+// where D is the 1D finite-difference operator, using Condat's direct
+// algorithm. The columns are processed independently (and, in the
+// distributed case, after redistributing A so that each column is local).
+template<typename Real>
+void TVProx( Matrix<Real>& A, Real rho );
+template<typename Real>
+void TVProx( AbstractDistMatrix<Real>& A, Real rho );
+
+template<typename Real>
+struct TV2DCtrl {
+  Int maxIter=100;
+  // Stop once the Frobenius norm of the change in an iterate falls below
+  // 'tol' times that of the input image
+  Real tol=Real(1e-6);
+  bool progress=false;
+};
+
+// Overwrites the image A with the solution to
+//     arg min (1/2) || A - X ||_F^2 + rho (|| D X ||_1 + || X D^T ||_1)
+//        X
+// using Dykstra's algorithm over the column and row 1D maps; the number of
+// iterations is returned.
+template<typename Real>
+Int TV2DProx
+( Matrix<Real>& A, Real rho, const TV2DCtrl<Real>& ctrl=TV2DCtrl<Real>() );
+template<typename Real>
+Int TV2DProx
+( AbstractDistMatrix<Real>& A, Real rho,
+  const TV2DCtrl<Real>& ctrl=TV2DCtrl<Real>() );
+
 } // namespace El
 
 #endif // ifndef EL_OPTIMIZATION_PROX_HPP
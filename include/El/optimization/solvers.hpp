@@ -20,6 +20,15 @@ enum KKTSystem {
 }
 using namespace KKTSystemNS;
 
+namespace IPMStatusNS {
+enum IPMStatus {
+  IPM_SOLVED,
+  IPM_PRIMAL_INFEASIBLE,
+  IPM_DUAL_INFEASIBLE
+};
+}
+using namespace IPMStatusNS;
+
 // Mehrotra's Predictor-Corrector Infeasible Interior Point Method
 // ===============================================================
 template<typename Real>
@@ -32,6 +41,51 @@ inline Real MehrotraCentrality
 ( Real mu, Real muAff, Real alphaAffPri, Real alphaAffDual )
 { return Min(Pow(muAff/mu,Real(3)),Real(1)); }
 
+// Data which may be reused by a sequence of sparse Interior Point Method
+// solves of problems with identical sparsity patterns (e.g., within a
+// model-predictive control loop): the outer equilibration and the reordering
+// and symbolic analysis of the KKT system. Each member is filled in (and the
+// corresponding flag is set) by the first solve which makes use of the cache;
+// a fresh cache should be constructed if the sparsity pattern changes.
+template<typename Real>
+struct MehrotraCache
+{
+    bool equilibrated=false;
+    Matrix<Real> dRowA, dRowG, dCol;
+
+    bool analyzed=false;
+    KKTSystem system=FULL_KKT;
+    vector<Int> map, invMap;
+    ldl::Separator rootSep;
+    ldl::NodeInfo info;
+
+    MehrotraCache() { }
+    // The separator and node trees own their children
+    MehrotraCache( const MehrotraCache<Real>& cache ) = delete;
+    const MehrotraCache<Real>&
+    operator=( const MehrotraCache<Real>& cache ) = delete;
+};
+
+template<typename Real>
+struct DistMehrotraCache
+{
+    bool equilibrated=false;
+    DistMultiVec<Real> dRowA, dRowG, dCol;
+
+    bool analyzed=false;
+    KKTSystem system=FULL_KKT;
+    DistMap map, invMap;
+    ldl::DistSeparator rootSep;
+    ldl::DistNodeInfo info;
+    vector<Int> mappedSources, mappedTargets, colOffs;
+
+    DistMehrotraCache() { }
+    // The separator and node trees own their children
+    DistMehrotraCache( const DistMehrotraCache<Real>& cache ) = delete;
+    const DistMehrotraCache<Real>&
+    operator=( const DistMehrotraCache<Real>& cache ) = delete;
+};
+
 template<typename Real>
 struct MehrotraCtrl 
 {
@@ -47,6 +101,37 @@ struct MehrotraCtrl
     //       trivial bug.
     bool primalInit=false, dualInit=false;
 
+    // Treat the input variables as the solution of a closely related problem
+    // (e.g., from the previous step of a model-predictive control loop).
+    // This implies both primalInit and dualInit, but, rather than requiring
+    // the variables to be strictly within the cone, they are backed off of its
+    // boundary by 'warmStartShift' (relative to their maximum entries) and any
+    // complementary pair whose product falls below 'warmStartCentrality'
+    // times the average is then scaled up to it.
+    bool warmStart=false;
+    Real warmStartShift=Pow(limits::Epsilon<Real>(),Real(0.25));
+    Real warmStartCentrality=Real(0.1);
+
+    // If non-null, the outer equilibration and the symbolic analysis of the
+    // KKT system are taken from (or, on first use, stored into) the given
+    // cache by the sparse (or distributed sparse) Interior Point Methods.
+    MehrotraCache<Real>* cache=nullptr;
+    DistMehrotraCache<Real>* distCache=nullptr;
+
+    // NOTE: Warm starts and caches are currently only supported by the
+    //       'direct' LP solvers and the 'affine' QP and SOCP solvers.
+
+    // If non-null, the scaled iterates are recorded into the given checkpoint
+    // (and saved in the background) every 'checkpointFreq' iterations. If
+    // 'resume' is true, the latest complete snapshot, if any, is loaded at
+    // the beginning of the solve and the iteration continues from it.
+    //
+    // NOTE: Checkpointing is currently only supported by the 'direct' LP
+    //       solvers.
+    Checkpoint* checkpoint=nullptr;
+    Int checkpointFreq=1;
+    bool resume=false;
+
     // Throw an exception if this tolerance could not be achieved.
     Real minTol=Pow(limits::Epsilon<Real>(),Real(0.3));
 
@@ -73,9 +158,51 @@ struct MehrotraCtrl
     KKTSystem system=FULL_KKT;
 
     // Use Mehrotra's second-order corrector?
-    // TODO: Add support for Gondzio's correctors
     bool mehrotra=true;
 
+    // Apply Gondzio's multiple centrality correctors to the combined
+    // direction? Each corrector requires an additional solve with the existing
+    // factorization and aims to lengthen the step by 'gondzioStepIncrease'
+    // by moving the trial complementarity products into the interval
+    // [sigma mu / gondzioBeta, sigma mu gondzioBeta]. A corrector is only
+    // kept if it lengthens the step by at least 'gondzioAcceptRatio' times the
+    // targeted increase, and the correction process stops otherwise.
+    //
+    // The number of correctors is adapted to the ratio of the cost of a
+    // factorization to that of a solve, i.e., one per 'gondzioCostRatio'
+    // factor of the ratio, and is then limited to 'maxGondzioCorrectors'.
+    //
+    // NOTE: This is currently only supported by the sparse (and distributed
+    //       sparse) 'direct' LP solvers.
+    bool gondzio=false;
+    Int maxGondzioCorrectors=4;
+    Real gondzioCostRatio=Real(10);
+    Real gondzioStepIncrease=Real(0.1);
+    Real gondzioAcceptRatio=Real(0.1);
+    Real gondzioBeta=Real(10);
+
+    // Solve the NORMAL_KKT system with a matrix-free Preconditioned Conjugate
+    // Gradient method rather than a sparse Cholesky factorization of
+    // A D^2 A^T, which becomes prohibitively dense when A has (nearly) dense
+    // columns. Columns with more than 'pcgDenseColumnRatio' times the height
+    // of A nonzeros are split out of the preconditioner and reincorporated
+    // via the Sherman-Morrison-Woodbury formula. The remaining sparse part
+    // is preconditioned with a partial Cholesky factorization of rank
+    // 'pcgRank' (pivoting on its largest diagonal entries) whose trailing
+    // Schur complement is approximated by its diagonal; the rank is doubled,
+    // up to 'pcgMaxRank', after each solve requiring more than
+    // 'pcgTargetIts' iterations.
+    //
+    // NOTE: This is currently only supported by the sequential sparse
+    //       'direct' LP solver.
+    bool normalPCG=false;
+    Real pcgDenseColumnRatio=Real(0.1);
+    Real pcgRelTol=Pow(limits::Epsilon<Real>(),Real(0.6));
+    Int pcgMaxIts=1000;
+    Int pcgRank=16;
+    Int pcgMaxRank=512;
+    Int pcgTargetIts=40;
+
     // Force the primal and dual step lengths to be the same size?
     bool forceSameStep=true;
 
@@ -163,13 +290,93 @@ struct ADMMCtrl
     bool print=true;
 };
 
+// Primal-Dual Hybrid Gradient
+// ===========================
+
+// Control structure for a matrix-free first-order method for "direct"
+// conic-form programs which only requires sparse matrix-vector products and
+// projections onto the cone. The problem is first diagonally equilibrated,
+// the primal and dual step sizes are balanced by a primal weight which is
+// updated at each restart, and the iterates are restarted from the better of
+// the current and average iterates once the KKT error has sufficiently
+// decayed. Convergence is declared once the relative primal residual, dual
+// residual, and duality gap are all below 'tol'.
+template<typename Real>
+struct PDHGCtrl
+{
+    Int maxIter=100000;
+    Real tol=Real(1e-4);
+    bool equilibrate=true;
+
+    // The number of power iterations used to estimate || A ||_2 and the
+    // fraction of 1/|| A ||_2 used for the geometric mean of the step sizes
+    Int powerIters=20;
+    Real stepRatio=Real(0.9);
+
+    // The KKT error is only evaluated every 'checkFreq' iterations
+    Int checkFreq=64;
+    bool restart=true;
+    Real sufficientDecay=Real(0.2);
+    Real necessaryDecay=Real(0.8);
+    Real artificialRestartRatio=Real(0.36);
+    Real primalWeightSmoothing=Real(0.5);
+
+    bool print=false;
+};
+
+// Presolve
+// ========
+
+// Control structure for the removal of trivial rows and columns from a
+// "direct" conic-form LP or QP before it is handed to an Interior Point
+// Method. Rows which are empty, duplicates (up to scaling) of an earlier row,
+// singletons, or forcing (all active coefficients share a sign and the
+// right-hand side is zero) are removed, the latter two by fixing their
+// variables, and columns with no remaining coefficients (and no quadratic
+// term) are fixed at zero when that is optimal. The reductions are repeated
+// in rounds until no further progress is made.
+template<typename Real>
+struct PresolveCtrl
+{
+    bool singletonRows=true;
+    bool forcingRows=true;
+    bool duplicateRows=true;
+    bool emptyCols=true;
+    Int maxRounds=20;
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.7));
+    bool print=false;
+};
+
+// The record needed to map a solution of a presolved problem back to the
+// original problem: the reduced index of each row and column (-1 if it was
+// removed), the round in which each removed row was removed (-1 if it was
+// kept), the row whose removal fixed each column (-1 if none), and the values
+// of the fixed variables
+template<typename Real>
+struct PresolveInfo
+{
+    Int numRounds=0;
+    Matrix<Int> rowMap, colMap, rowRounds, colFixers;
+    Matrix<Real> xFixed;
+};
+
+template<typename Real>
+struct DistPresolveInfo
+{
+    Int numRounds=0;
+    DistMultiVec<Int> rowMap, colMap, rowRounds, colFixers;
+    DistMultiVec<Real> xFixed;
+};
+
 // Linear program
 // ==============
 
 namespace LPApproachNS {
 enum LPApproach {
   LP_ADMM,
-  LP_MEHROTRA
+  LP_MEHROTRA,
+  LP_HSD,
+  LP_PDHG
 };
 } // namespace LPApproachNS
 using namespace LPApproachNS;
@@ -195,11 +402,99 @@ struct Ctrl
     LPApproach approach=LP_MEHROTRA;
     ADMMCtrl<Real> admmCtrl;
     MehrotraCtrl<Real> mehrotraCtrl;
+    // Only supported for sparse problems
+    PDHGCtrl<Real> pdhgCtrl;
+
+    // Only supported for sparse problems; initial guesses are ignored
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
 
     Ctrl( bool isSparse ) 
     { mehrotraCtrl.system = ( isSparse ? AUGMENTED_KKT : NORMAL_KKT ); }
 };
 
+// Solve the homogeneous self-dual embedding of the above pair,
+//
+//   A x - b tau = 0,
+//   A^T y - z + c tau = 0,
+//   c^T x + b^T y + kappa = 0,
+//   x, z, tau, kappa >= 0,
+//
+// with a predictor-corrector Interior Point Method which reuses the
+// augmented KKT system of the Mehrotra solvers (the 'system' member of the
+// control structure is ignored). Upon success, (x,y,z) is returned as the
+// solution and IPM_SOLVED is returned. If tau vanishes relative to kappa,
+// then either (y,z), normalized so that -b^T y = 1, is returned as a
+// certificate of primal infeasibility (A^T y - z ~= 0), or x, normalized so
+// that -c^T x = 1, is returned as a certificate of dual infeasibility
+// (A x ~= 0). A certificate is accepted once its residual falls below the
+// target tolerance.
+template<typename Real>
+IPMStatus HSD
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+template<typename Real>
+IPMStatus HSD
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+
+// Remove trivial rows and columns from a sparse "direct" conic-form LP (see
+// the PresolveCtrl documentation) and map solutions of the reduced problem
+// back to solutions of the original problem
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        DistPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+
+template<typename Real>
+void Postsolve
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const PresolveInfo<Real>& info,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z );
+template<typename Real>
+void Postsolve
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DistPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z );
+
 } // namespace direct
 
 namespace affine {
@@ -220,6 +515,13 @@ struct Ctrl
 {
     LPApproach approach=LP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+
+    // Models built upon this solver which have both dense and sparse
+    // formulations (currently LAV, DS, and CP) switch a dense input matrix to
+    // the sparse formulation when at most 'sparseDensity' of its entries are
+    // nonzero; a nonpositive value disables the switch. The decision is
+    // printed if 'mehrotraCtrl.print' is true.
+    Real sparseDensity=Real(0.1);
 };
 
 } // namespace affine
@@ -348,9 +650,66 @@ struct Ctrl
     QPApproach approach=QP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Only supported for sparse problems; initial guesses are ignored
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl() { mehrotraCtrl.system = AUGMENTED_KKT; }
 };
 
+// Remove trivial rows and columns from a sparse "direct" conic-form QP (see
+// the PresolveCtrl documentation) and map solutions of the reduced problem
+// back to solutions of the original problem
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        DistPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+
+template<typename Real>
+void Postsolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const PresolveInfo<Real>& info,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z );
+template<typename Real>
+void Postsolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DistPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z );
+
 } // namespace direct
 
 namespace affine {
@@ -507,7 +866,8 @@ void QP
 namespace SOCPApproachNS {
 enum SOCPApproach {
   SOCP_ADMM,     // NOTE: Not yet supported
-  SOCP_MEHROTRA
+  SOCP_MEHROTRA,
+  SOCP_PDHG      // NOTE: Only supported for sparse direct-form problems
 };
 } // namespace SOCPApproachNS
 using namespace SOCPApproachNS;
@@ -533,6 +893,7 @@ struct Ctrl
 {
     SOCPApproach approach=SOCP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+    PDHGCtrl<Real> pdhgCtrl;
 
     Ctrl()
     {
@@ -681,6 +1042,30 @@ void SOCP
         DistMultiVec<Real>& s,
   const socp::affine::Ctrl<Real>& ctrl=socp::affine::Ctrl<Real>() );
 
+// Products of second-order cones and (small) positive semi-definite cones
+// -----------------------------------------------------------------------
+// The first orders.Height() entries of s and z lie in a product of
+// second-order cones, while the remaining entries hold the (full,
+// column-major) vectorizations of symmetric positive semi-definite blocks
+// described by psdOrders and psdFirstInds. Only sequential dense matrices are
+// currently supported.
+template<typename Real>
+void SOCP
+( const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+  const socp::affine::Ctrl<Real>& ctrl=socp::affine::Ctrl<Real>() );
+
 } // namespace El
 
 #endif // ifndef EL_OPTIMIZATION_SOLVERS_HPP
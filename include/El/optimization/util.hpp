@@ -11,6 +11,7 @@
 
 #include <El/optimization/util/cone.hpp>
 #include <El/optimization/util/pos_orth.hpp>
+#include <El/optimization/util/psd.hpp>
 #include <El/optimization/util/soc.hpp>
 
 namespace El {
@@ -29,6 +30,54 @@ void Covariance( const Matrix<F>& D, Matrix<F>& S );
 template<typename F>
 void Covariance( const ElementalMatrix<F>& D, ElementalMatrix<F>& S );
 
+// Streaming covariance
+// --------------------
+// Accumulates the mean and the scatter matrix,
+//
+//   M = sum_i (d_i - mean) (d_i - mean)^H,
+//
+// of observations (the rows d_i^T) which arrive in blocks, e.g., as they are
+// read from disk or generated, by merging the statistics of each block with
+// those of the previous blocks via the pairwise update of Chan, Golub, and
+// LeVeque. Neither the full data matrix nor a centered copy of it is formed.
+template<typename F>
+class CovarianceAccumulator
+{
+public:
+    CovarianceAccumulator();
+    explicit CovarianceAccumulator( Int n );
+
+    // Discard all observations and expect n variables
+    void Reset( Int n );
+
+    // Accumulate the rows of 'DBlock' as additional observations
+    void Update( const Matrix<F>& DBlock );
+
+    // Accumulate the observations of another accumulator
+    void Merge( const CovarianceAccumulator<F>& other );
+
+    Int NumObservations() const;
+    const Matrix<F>& Mean() const;
+
+    // S := M / (numObs-1)
+    void Finalize( Matrix<F>& S ) const;
+
+    // The same, but over the union of the observations accumulated by each
+    // process in the grid of S (which must call this routine collectively).
+    // The per-process means are combined with a summation over the grid,
+    // and the scatter matrices with a single reduce-scatter into S.
+    void Finalize( ElementalMatrix<F>& S ) const;
+
+private:
+    Int numObs_;
+    // The mean (as a column vector) and the lower triangle of conj(M)
+    Matrix<F> mean_, scatter_;
+
+    // Update the mean and add the between-set correction to the scatter
+    // matrix for a set of observations whose own scatter was already added
+    void Combine( Int numObsB, const Matrix<F>& meanB );
+};
+
 // Log barrier
 // ===========
 template<typename F>
@@ -45,6 +45,32 @@ Real MaxStep
   const DistMultiVec<Real>& ds, 
   Real upperBound=std::numeric_limits<Real>::max() );
 
+// Maximum primal and dual steps
+// =============================
+// Equivalent to MaxStep(s,ds,upperBound) and MaxStep(z,dz,upperBound), but
+// with the two (distributed) minimizations sharing a single reduction
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+pair<Real,Real> MaxSteps
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  Real upperBound=std::numeric_limits<Real>::max() );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+pair<Real,Real> MaxSteps
+( const ElementalMatrix<Real>& s,
+  const ElementalMatrix<Real>& ds,
+  const ElementalMatrix<Real>& z,
+  const ElementalMatrix<Real>& dz,
+  Real upperBound=std::numeric_limits<Real>::max() );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+pair<Real,Real> MaxSteps
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+  Real upperBound=std::numeric_limits<Real>::max() );
+
 // Number of members outside of cone
 // =================================
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -99,6 +125,72 @@ void PushPairInto
   const DistMultiVec<Real>& w,
   Real wMaxNormLimit );
 
+// Back a pair away from the boundary for a warm start
+// ===================================================
+// Raise each entry of s and z to at least 'shift' times the maximum of
+// || s ||_max, || z ||_max, and one, and then scale each pair (s_i,z_i)
+// whose product is less than 'centrality' times the average product,
+// mu = s^T z / k, up to centrality*mu.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void WarmStart
+( Matrix<Real>& s,
+  Matrix<Real>& z,
+  Real shift,
+  Real centrality );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void WarmStart
+( ElementalMatrix<Real>& s,
+  ElementalMatrix<Real>& z,
+  Real shift,
+  Real centrality );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void WarmStart
+( DistMultiVec<Real>& s,
+  DistMultiVec<Real>& z,
+  Real shift,
+  Real centrality );
+
+// Gondzio's multiple centrality correction
+// ========================================
+// Given a search direction (ds,dz) and trial step lengths, subtract from the
+// complementarity residual, r_mu, the (linearized) change needed to move each
+// trial product, (s_i + alphaPri ds_i) (z_i + alphaDual dz_i), into the
+// interval [target/beta, target*beta]. The decrease of large products is
+// limited to target*beta.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real beta,
+        Matrix<Real>& rmu );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+( const ElementalMatrix<Real>& s,
+  const ElementalMatrix<Real>& ds,
+  const ElementalMatrix<Real>& z,
+  const ElementalMatrix<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real beta,
+        ElementalMatrix<Real>& rmu );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real beta,
+        DistMultiVec<Real>& rmu );
+
 } // namespace pos_orth
 } // namespace El
 
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_UTIL_PSD_HPP
+#define EL_OPTIMIZATION_UTIL_PSD_HPP
+
+namespace El {
+namespace psd {
+
+// Members of a product of (small) cones of symmetric positive semi-definite
+// matrices are stored within a column vector x, with each n_i x n_i block
+// X_i occupying n_i^2 contiguous entries in column-major order (both
+// triangles are stored, and so inner products of the vectorizations are
+// trace inner products). As with the second-order cone utilities, each entry
+// of 'orders' holds the order, n_i, of the block it belongs to, and each
+// entry of 'firstInds' holds the index of the first entry of the block.
+//
+// Only sequential implementations are currently provided.
+
+// Degree
+// ======
+// The sum of the orders of the blocks
+Int Degree( const Matrix<Int>& orders, const Matrix<Int>& firstInds );
+
+// Identity
+// ========
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Identity
+(       Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+
+// Symmetric (Jordan) product
+// ==========================
+// Z_i := (X_i Y_i + Y_i X_i) / 2
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Apply
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+        Matrix<Real>& z,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+
+// Solve against a diagonal member of the cone
+// ===========================================
+// Overwrite each X_i with the solution of the Lyapunov equation
+//
+//   (Lambda_i X_i + X_i Lambda_i) / 2 = X_i,
+//
+// where Lambda_i is the (assumed positive) diagonal of the i'th block of
+// 'lambda'.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void SymmetricSolve
+( const Matrix<Real>& lambda,
+        Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+
+// Minimum eigenvalue
+// ==================
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+Real MinEig
+( const Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+
+// Push into the cone
+// ==================
+// Shift each block so that its minimum eigenvalue is at least 'minDist'
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void PushInto
+(       Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real minDist=0 );
+
+// Maximum step
+// ============
+// The largest alpha in [0,upperBound] such that x + alpha y lies within the
+// (closure of the) cone, given that x lies within its interior
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+Real MaxStep
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real upperBound );
+
+// Nesterov-Todd scaling
+// =====================
+// Given positive-definite blocks S_i and Z_i, compute a factor R_i of the
+// Nesterov-Todd scaling point W_i = R_i R_i^T, which satisfies
+//
+//   W_i Z_i W_i = S_i,
+//
+// along with the diagonal matrix Lambda_i = R_i^T Z_i R_i = inv(R_i) S_i
+// inv(R_i)^T. Each R_i and Lambda_i is stored with the same layout as S_i.
+// The blocks are factored with a Cholesky decomposition of S_i and Z_i
+// followed by a singular value decomposition of the product of the factors.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void NesterovTodd
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+        Matrix<Real>& r,
+        Matrix<Real>& lambda,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+
+// Apply a scaling
+// ===============
+// Overwrite each X_i with R_i X_i R_i^T if orientation is NORMAL, or with
+// R_i^T X_i R_i otherwise
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void ApplyScaling
+( Orientation orientation,
+  const Matrix<Real>& r,
+        Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+
+} // namespace psd
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_UTIL_PSD_HPP
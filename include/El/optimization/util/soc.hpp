@@ -434,6 +434,28 @@ void PushInto
   Real minDist=0,
   Int cutoff=1000 );
 
+// Project onto SOC
+// ================
+// Replace each member of a product of second-order cones with its Euclidean
+// projection onto its cone
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Project
+(       Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Project
+(       ElementalMatrix<Real>& x,
+  const ElementalMatrix<Int>& orders,
+  const ElementalMatrix<Int>& firstInds,
+  Int cutoff=1000 );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Project
+(       DistMultiVec<Real>& x,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff=1000 );
+
 // Push pair into SOC
 // ==================
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -463,6 +485,40 @@ void PushPairInto
   Real wMaxNormLimit,
   Int cutoff=1000 );
 
+// Back a pair away from the boundary for a warm start
+// ===================================================
+// Shift s and z by multiples of the identity so that their minimum
+// eigenvalues are at least 'shift' times the maximum of || s ||_max,
+// || z ||_max, and one, and then scale each pair of cone members whose
+// inner product is less than 'centrality' times mu = s^T z / degree up to
+// centrality*mu.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void WarmStart
+(       Matrix<Real>& s,
+        Matrix<Real>& z,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real shift,
+  Real centrality );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void WarmStart
+(       ElementalMatrix<Real>& s,
+        ElementalMatrix<Real>& z,
+  const ElementalMatrix<Int>& orders,
+  const ElementalMatrix<Int>& firstInds,
+  Real shift,
+  Real centrality,
+  Int cutoff=1000 );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void WarmStart
+(       DistMultiVec<Real>& s,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real shift,
+  Real centrality,
+  Int cutoff=1000 );
+
 // Reflect
 // =======
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -1726,6 +1726,50 @@ class DistMatrix(object):
     elif self.tag == zTag: lib.ElDistMatrixProcessPullQueue_z(*args)
     else: DataExcept()
 
+  lib.ElDistMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueUpdates(self,rows,cols,values):
+    rows = numpy.ascontiguousarray(rows,dtype=iNpType).ravel()
+    cols = numpy.ascontiguousarray(cols,dtype=iNpType).ravel()
+    values = \
+      numpy.ascontiguousarray(values,dtype=TagToNumpyType(self.tag)).ravel()
+    numUpdates = values.size
+    if rows.size != numUpdates or cols.size != numUpdates:
+      raise Exception('rows, cols, and values must be the same size')
+    args = [self.obj,numUpdates,
+            rows.ctypes.data_as(POINTER(iType)),
+            cols.ctypes.data_as(POINTER(iType)),
+            values.ctypes.data_as(POINTER(TagToType(self.tag)))]
+    if   self.tag == iTag: lib.ElDistMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
+  # The local data can be viewed (without a copy) as a NumPy array
+  @property
+  def __array_interface__(self):
+    return self.Matrix(self.Locked()).__array_interface__
+
+  def ToNumPy(self):
+    return numpy.asarray(self)
+
+  def SetLocalFromNumPy(self,ALoc):
+    ALoc = numpy.asarray(ALoc)
+    if ALoc.ndim == 1: ALoc = ALoc.reshape((ALoc.shape[0],1))
+    if ALoc.shape != (self.LocalHeight(),self.LocalWidth()):
+      raise Exception('Local NumPy array was of the wrong size')
+    self.ToNumPy()[:,:] = ALoc
+
   def GetLocal(self,iLoc,jLoc): 
     return self.LockedMatrix().Get(iLoc,jLoc)
 
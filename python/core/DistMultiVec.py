@@ -9,6 +9,8 @@
 from environment import *
 from imports     import mpi
 
+import numpy as np
+
 import Matrix as M
 
 class DistMultiVec(object):
@@ -177,7 +179,7 @@ class DistMultiVec(object):
   lib.ElDistMultiVecLockedMatrix_z.argtypes = \
     [c_void_p,POINTER(c_void_p)]
   def Matrix(self,locked=False):
-    A = M.Matrix(dTag,False)
+    A = M.Matrix(self.tag,False)
     args = [self.obj,pointer(A.obj)]
     if locked:
       if   self.tag == iTag: lib.ElDistMultiVecLockedMatrix_i(*args)
@@ -339,6 +341,49 @@ class DistMultiVec(object):
     elif self.tag == zTag: lib.ElDistMultiVecProcessQueues_z(*args)
     else: DataExcept()
 
+  lib.ElDistMultiVecQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistMultiVecQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistMultiVecQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistMultiVecQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistMultiVecQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueUpdates(self,rows,cols,values):
+    rows = np.ascontiguousarray(rows,dtype=iNpType).ravel()
+    cols = np.ascontiguousarray(cols,dtype=iNpType).ravel()
+    values = np.ascontiguousarray(values,dtype=TagToNumpyType(self.tag)).ravel()
+    numUpdates = values.size
+    if rows.size != numUpdates or cols.size != numUpdates:
+      raise Exception('rows, cols, and values must be the same size')
+    args = [self.obj,numUpdates,
+            rows.ctypes.data_as(POINTER(iType)),
+            cols.ctypes.data_as(POINTER(iType)),
+            values.ctypes.data_as(POINTER(TagToType(self.tag)))]
+    if   self.tag == iTag: lib.ElDistMultiVecQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistMultiVecQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistMultiVecQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistMultiVecQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistMultiVecQueueUpdates_z(*args)
+    else: DataExcept()
+
+  # The local rows can be viewed (without a copy) as a NumPy array
+  @property
+  def __array_interface__(self):
+    return self.Matrix(False).__array_interface__
+
+  def ToNumPy(self):
+    return np.asarray(self)
+
+  def SetLocalFromNumPy(self,ALoc):
+    ALoc = np.asarray(ALoc)
+    if ALoc.ndim == 1: ALoc = ALoc.reshape((ALoc.shape[0],1))
+    if ALoc.shape != (self.LocalHeight(),self.Width()):
+      raise Exception('Local NumPy array was of the wrong size')
+    self.ToNumPy()[:,:] = ALoc
+
   lib.ElDistMultiVecGetLocal_i.argtypes = [c_void_p,iType,iType,POINTER(iType)]
   lib.ElDistMultiVecGetLocal_s.argtypes = [c_void_p,iType,iType,POINTER(sType)]
   lib.ElDistMultiVecGetLocal_d.argtypes = [c_void_p,iType,iType,POINTER(dType)]
@@ -9,12 +9,6 @@
 from environment import *
 import numpy as np
 
-buffer_from_memory = pythonapi.PyBuffer_FromMemory
-buffer_from_memory.restype = ctypes.py_object
-
-buffer_from_memory_RW = pythonapi.PyBuffer_FromReadWriteMemory
-buffer_from_memory_RW.restype = ctypes.py_object
-
 class Matrix(object):
   # Create an instance
   # ------------------
@@ -429,18 +423,27 @@ class Matrix(object):
     if   self.tag == cTag: lib.ElMatrixConjugate_c(self.obj,i,j)
     elif self.tag == zTag: lib.ElMatrixConjugate_z(self.obj,i,j)
 
-  def ToNumPy(self):
-    m = self.Height()
-    n = self.Width()
-    ldim = self.LDim()
+  # NumPy arrays built from this object (e.g., via numpy.asarray) directly
+  # view the column-major buffer and hold a reference to this object
+  @property
+  def __array_interface__(self):
     locked = self.Locked()
     entrySize = TagToSize(self.tag)
-    npType = TagToNumpyType(self.tag)
-    bufSize = entrySize*ldim*n
-    if locked: buf = buffer_from_memory(self.LockedBuffer(),bufSize)
-    else:      buf = buffer_from_memory_RW(self.Buffer(),bufSize)
-    return np.ndarray(shape=(m,n),strides=(entrySize,ldim*entrySize),
-                        buffer=buf,dtype=npType)
+    address = ctypes.cast(self.Buffer(locked),c_void_p).value
+    return {'shape':(self.Height(),self.Width()),
+            'strides':(entrySize,self.LDim()*entrySize),
+            'typestr':np.dtype(TagToNumpyType(self.tag)).str,
+            'data':(address if address is not None else 0,locked),
+            'version':3}
+
+  def ToNumPy(self):
+    return np.asarray(self)
+
+  def FromNumPy(self,A):
+    A = np.asarray(A,dtype=TagToNumpyType(self.tag))
+    if A.ndim == 1: A = A.reshape((A.shape[0],1))
+    self.Resize(A.shape[0],A.shape[1])
+    self.ToNumPy()[:,:] = A
 
   lib.ElView_i.argtypes = \
   lib.ElView_s.argtypes = \
@@ -30,6 +30,11 @@ struct LocalTrr2kBlocksizeHelper { static Int value; };
 template<typename T>
 Int LocalTrr2kBlocksizeHelper<T>::value = 64;
 
+template<typename T>
+struct SyrkDotBlocksizeHelper { static Int value; };
+template<typename T>
+Int SyrkDotBlocksizeHelper<T>::value = 2000;
+
 }
 
 namespace El {
@@ -94,13 +99,23 @@ template<typename T>
 Int LocalTrr2kBlocksize()
 { return LocalTrr2kBlocksizeHelper<T>::value; }
 
+template<typename T>
+void SetSyrkDotBlocksize( Int blocksize )
+{ SyrkDotBlocksizeHelper<T>::value = blocksize; }
+
+template<typename T>
+Int SyrkDotBlocksize()
+{ return SyrkDotBlocksizeHelper<T>::value; }
+
 #define PROTO(T) \
   template void SetLocalSymvBlocksize<T>( Int blocksize ); \
   template Int LocalSymvBlocksize<T>(); \
   template void SetLocalTrrkBlocksize<T>( Int blocksize ); \
   template Int LocalTrrkBlocksize<T>(); \
   template void SetLocalTrr2kBlocksize<T>( Int blocksize ); \
-  template Int LocalTrr2kBlocksize<T>(); 
+  template Int LocalTrr2kBlocksize<T>(); \
+  template void SetSyrkDotBlocksize<T>( Int blocksize ); \
+  template Int SyrkDotBlocksize<T>();
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -14,7 +14,10 @@ namespace El {
 
 template<typename F>
 void ColumnTwoNormsHelper
-( const Matrix<F>& ALoc, Matrix<Base<F>>& normsLoc, mpi::Comm comm )
+( const Matrix<F>& ALoc,
+        Matrix<Base<F>>& normsLoc,
+        Matrix<Base<F>>& maxNormsLoc,
+        mpi::Comm comm )
 {
     DEBUG_CSE
     typedef Base<F> Real;
@@ -28,15 +31,27 @@ void ColumnTwoNormsHelper
     {
         Real localScale = 0;
         Real localScaledSquare = 1;
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
+        UpdateScaledSquares
+        ( mLocal, ALoc.LockedBuffer(0,jLoc), 1,
+          localScale, localScaledSquare );
 
         localScales(jLoc) = localScale;
         localScaledSquares(jLoc) = localScaledSquare;
     }
 
-    NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
+    // Since each local scale is the maximum local magnitude of its column,
+    // the combined scales are the max norms
+    NormsFromScaledSquares
+    ( localScales, localScaledSquares, normsLoc, maxNormsLoc, comm );
+}
+
+template<typename F>
+void ColumnTwoNormsHelper
+( const Matrix<F>& ALoc, Matrix<Base<F>>& normsLoc, mpi::Comm comm )
+{
+    DEBUG_CSE
+    Matrix<Base<F>> maxNormsLoc;
+    ColumnTwoNormsHelper( ALoc, normsLoc, maxNormsLoc, comm );
 }
 
 template<typename Real>
@@ -85,6 +100,28 @@ void ColumnTwoNorms( const Matrix<F>& X, Matrix<Base<F>>& norms )
         norms(j) = blas::Nrm2( m, &X(0,j), 1 );
 }
 
+template<typename F>
+void ColumnTwoAndMaxNorms
+( const Matrix<F>& X,
+        Matrix<Base<F>>& twoNorms,
+        Matrix<Base<F>>& maxNorms )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = X.Height();
+    const Int n = X.Width();
+    twoNorms.Resize( n, 1 );
+    maxNorms.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        Real scale = 0;
+        Real scaledSquare = 1;
+        maxNorms(j) =
+          UpdateScaledSquares( m, X.LockedBuffer(0,j), 1, scale, scaledSquare );
+        twoNorms(j) = scale*Sqrt(scaledSquare);
+    }
+}
+
 template<typename F>
 void ColumnMaxNorms( const Matrix<F>& X, Matrix<Base<F>>& norms )
 {
@@ -118,6 +155,27 @@ void ColumnTwoNorms
     ColumnTwoNormsHelper( A.LockedMatrix(), norms.Matrix(), A.ColComm() );
 }
 
+template<typename F,Dist U,Dist V>
+void ColumnTwoAndMaxNorms
+( const DistMatrix<F,U,V>& A,
+        DistMatrix<Base<F>,V,STAR>& twoNorms,
+        DistMatrix<Base<F>,V,STAR>& maxNorms )
+{
+    DEBUG_CSE
+    twoNorms.AlignWith( A );
+    maxNorms.AlignWith( A );
+    twoNorms.Resize( A.Width(), 1 );
+    maxNorms.Resize( A.Width(), 1 );
+    if( A.Height() == 0 )
+    {
+        Zero( twoNorms );
+        Zero( maxNorms );
+        return;
+    }
+    ColumnTwoNormsHelper
+    ( A.LockedMatrix(), twoNorms.Matrix(), maxNorms.Matrix(), A.ColComm() );
+}
+
 template<typename F,Dist U,Dist V>
 void ColumnMaxNorms
 ( const DistMatrix<F,U,V>& A, DistMatrix<Base<F>,V,STAR>& norms )
@@ -137,6 +195,17 @@ void ColumnTwoNorms( const DistMultiVec<F>& X, Matrix<Base<F>>& norms )
     ColumnTwoNormsHelper( X.LockedMatrix(), norms, X.Comm() );
 }
 
+template<typename F>
+void ColumnTwoAndMaxNorms
+( const DistMultiVec<F>& X,
+        Matrix<Base<F>>& twoNorms,
+        Matrix<Base<F>>& maxNorms )
+{
+    DEBUG_CSE
+    twoNorms.Resize( X.Width(), 1 );
+    ColumnTwoNormsHelper( X.LockedMatrix(), twoNorms, maxNorms, X.Comm() );
+}
+
 template<typename F>
 void ColumnMaxNorms( const DistMultiVec<F>& X, Matrix<Base<F>>& norms )
 {
@@ -367,12 +436,24 @@ void ColumnTwoNorms
           DistMatrix<Base<F>,V,STAR>& norms ); \
   template void ColumnMaxNorms \
   ( const DistMatrix<F,U,V>& X, \
-          DistMatrix<Base<F>,V,STAR>& norms );
+          DistMatrix<Base<F>,V,STAR>& norms ); \
+  template void ColumnTwoAndMaxNorms \
+  ( const DistMatrix<F,U,V>& X, \
+          DistMatrix<Base<F>,V,STAR>& twoNorms, \
+          DistMatrix<Base<F>,V,STAR>& maxNorms );
 
 #define PROTO(F) \
   template void ColumnTwoNorms \
   ( const Matrix<F>& X, \
           Matrix<Base<F>>& norms ); \
+  template void ColumnTwoAndMaxNorms \
+  ( const Matrix<F>& X, \
+          Matrix<Base<F>>& twoNorms, \
+          Matrix<Base<F>>& maxNorms ); \
+  template void ColumnTwoAndMaxNorms \
+  ( const DistMultiVec<F>& X, \
+          Matrix<Base<F>>& twoNorms, \
+          Matrix<Base<F>>& maxNorms ); \
   template void ColumnMaxNorms \
   ( const Matrix<F>& X, \
           Matrix<Base<F>>& norms ); \
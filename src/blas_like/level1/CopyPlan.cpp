@@ -0,0 +1,319 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+namespace {
+
+struct DistPair
+{
+    Dist colDist, rowDist;
+};
+
+// The distributions which may appear within a plan
+const DistPair modeledDists[] =
+{ {MC,  MR  }, {MC,  STAR}, {MR,  MC  }, {MR,  STAR},
+  {STAR,MC  }, {STAR,MR  }, {STAR,STAR}, {STAR,VC  },
+  {STAR,VR  }, {VC,  STAR}, {VR,  STAR} };
+const int numModeledDists = 11;
+
+typedef std::tuple<int,int,int,int,int,int,int,Int,double,double> PlanKey;
+std::map<PlanKey,CopyPlan> planCache;
+
+double Stride( Dist dist, const Grid& grid )
+{
+    switch( dist )
+    {
+    case MC: return grid.Height();
+    case MR: return grid.Width();
+    case VC:
+    case VR: return grid.Size();
+    default: return 1;
+    }
+}
+
+// Whether the distribution 'fine' can be formed locally from 'coarse'
+bool Refines( Dist coarse, Dist fine )
+{ return coarse == fine || coarse == STAR || Partial(fine) == coarse; }
+
+bool IsVector( Dist dist ) { return dist == VC || dist == VR; }
+
+// Fill 'step' with the model of the single redistribution kernel which
+// DistMatrix assignment uses to map A to B (if there is one)
+bool ModelStep
+( const DistPair& A, const DistPair& B,
+  const Grid& grid, double volume,
+  CopyStep& step )
+{
+    const Dist U1=A.colDist, V1=A.rowDist, U2=B.colDist, V2=B.rowDist;
+    if( U1 == U2 && V1 == V2 )
+        return false;
+    const double strideA = Stride(U1,grid)*Stride(V1,grid);
+    const double strideB = Stride(U2,grid)*Stride(V2,grid);
+    const double localA = volume / strideA;
+    const double localB = volume / strideB;
+
+    step.colDist = U2;
+    step.rowDist = V2;
+    if( Refines(U1,U2) && Refines(V1,V2) )
+    {
+        if( V1 == V2 )
+            step.kernel = ( U1 == STAR ? "ColFilter" : "PartialColFilter" );
+        else if( U1 == U2 )
+            step.kernel = ( V1 == STAR ? "RowFilter" : "PartialRowFilter" );
+        else
+            step.kernel = "Filter";
+        step.messages = 0;
+        step.words = 0;
+        return true;
+    }
+    if( Refines(U2,U1) && Refines(V2,V1) )
+    {
+        if( V1 == V2 )
+            step.kernel =
+              ( U2 == STAR ? "ColAllGather" : "PartialColAllGather" );
+        else if( U1 == U2 )
+            step.kernel =
+              ( V2 == STAR ? "RowAllGather" : "PartialRowAllGather" );
+        else
+            step.kernel = "AllGather";
+        step.messages = Ceil( Log2( strideA/strideB ) );
+        step.words = localB - localA;
+        return true;
+    }
+
+    double numProcs = 0;
+    if( IsVector(U1) && V1 == STAR &&
+        U2 == Partial(U1) && V2 == PartialUnionRow(U1,V1) )
+    {
+        step.kernel = "ColAllToAllPromote";
+        numProcs = Stride(U1,grid) / Stride(U2,grid);
+    }
+    else if( IsVector(U2) && V2 == STAR &&
+             U1 == Partial(U2) && V1 == PartialUnionRow(U2,V2) )
+    {
+        step.kernel = "ColAllToAllDemote";
+        numProcs = Stride(U2,grid) / Stride(U1,grid);
+    }
+    else if( IsVector(V1) && U1 == STAR &&
+             V2 == Partial(V1) && U2 == PartialUnionCol(U1,V1) )
+    {
+        step.kernel = "RowAllToAllPromote";
+        numProcs = Stride(V1,grid) / Stride(V2,grid);
+    }
+    else if( IsVector(V2) && U2 == STAR &&
+             V1 == Partial(V2) && U1 == PartialUnionCol(U2,V2) )
+    {
+        step.kernel = "RowAllToAllDemote";
+        numProcs = Stride(V2,grid) / Stride(V1,grid);
+    }
+    if( numProcs > 0 )
+    {
+        step.messages = numProcs - 1;
+        step.words = localA*(numProcs-1)/numProcs;
+        return true;
+    }
+
+    const bool vectorExchange =
+      ( IsVector(U1) && IsVector(U2) && V1 == STAR && V2 == STAR ) ||
+      ( IsVector(V1) && IsVector(V2) && U1 == STAR && U2 == STAR );
+    const bool transposeExchange =
+      ( grid.Height() == grid.Width() && U1 == V2 && V1 == U2 &&
+        ((U1 == MC && V1 == MR) || (U1 == MR && V1 == MC)) );
+    if( vectorExchange || transposeExchange )
+    {
+        step.kernel = "Exchange";
+        step.messages = ( grid.Size() > 1 ? 1 : 0 );
+        step.words = ( grid.Size() > 1 ? localA : 0 );
+        return true;
+    }
+    return false;
+}
+
+int ModeledIndex( Dist colDist, Dist rowDist )
+{
+    for( int k=0; k<numModeledDists; ++k )
+        if( modeledDists[k].colDist == colDist &&
+            modeledDists[k].rowDist == rowDist )
+            return k;
+    return -1;
+}
+
+double ModelCost( double messages, double words, Int entrySize,
+  const CopyPlanCtrl& ctrl )
+{ return ctrl.latency*messages + ctrl.inverseBandwidth*words*entrySize; }
+
+CopyPlan FormPlan
+( Dist colDistA, Dist rowDistA, Dist colDistB, Dist rowDistB,
+  const Grid& grid, double volume, Int entrySize, const CopyPlanCtrl& ctrl )
+{
+    DEBUG_CSE
+    CopyPlan plan;
+    plan.colDist = colDistA;
+    plan.rowDist = rowDistA;
+    plan.generalPurpose = false;
+    plan.messages = plan.words = plan.cost = 0;
+
+    // copy::GeneralPurpose sends each entry (with its local indices) to the
+    // first process which owns it and then broadcasts over the redundant
+    // communicator
+    const double p = grid.Size();
+    const double entryRatio = double(entrySize+2*sizeof(Int))/entrySize;
+    const double localA =
+      volume / (Stride(colDistA,grid)*Stride(rowDistA,grid));
+    const double localB =
+      volume / (Stride(colDistB,grid)*Stride(rowDistB,grid));
+    const double redundantSize =
+      p / (Stride(colDistB,grid)*Stride(rowDistB,grid));
+    const double gpMessages =
+      Min(p-1,localA) + Ceil(Log2(Max(redundantSize,1.)));
+    const double gpWords =
+      entryRatio*(localA + (redundantSize > 1 ? localB : 0));
+    plan.generalPurposeCost = ModelCost( gpMessages, gpWords, entrySize, ctrl );
+
+    const int source = ModeledIndex( colDistA, rowDistA );
+    const int target = ModeledIndex( colDistB, rowDistB );
+    plan.modeled = ( source >= 0 && target >= 0 );
+    if( !plan.modeled || source == target )
+    {
+        if( source != target )
+        {
+            CopyStep step;
+            step.colDist = colDistB;
+            step.rowDist = rowDistB;
+            step.kernel = "Copy";
+            step.messages = step.words = 0;
+            plan.steps.push_back( step );
+        }
+        return plan;
+    }
+
+    // Dijkstra's algorithm over the (small) graph of single-kernel steps
+    vector<double> dist( numModeledDists, limits::Infinity<double>() );
+    vector<int> prev( numModeledDists, -1 );
+    vector<CopyStep> prevStep( numModeledDists );
+    vector<bool> done( numModeledDists, false );
+    dist[source] = 0;
+    while( true )
+    {
+        int k = -1;
+        for( int j=0; j<numModeledDists; ++j )
+            if( !done[j] && (k < 0 || dist[j] < dist[k]) )
+                k = j;
+        if( k < 0 || dist[k] == limits::Infinity<double>() || k == target )
+            break;
+        done[k] = true;
+        for( int j=0; j<numModeledDists; ++j )
+        {
+            CopyStep step;
+            if( done[j] ||
+                !ModelStep( modeledDists[k], modeledDists[j], grid, volume,
+                            step ) )
+                continue;
+            // Slightly penalize each step for the extra local copies
+            const double stepCost =
+              ModelCost( step.messages, step.words, entrySize, ctrl ) +
+              ctrl.inverseBandwidth*entrySize*volume/p;
+            if( dist[k]+stepCost < dist[j] )
+            {
+                dist[j] = dist[k] + stepCost;
+                prev[j] = k;
+                prevStep[j] = step;
+            }
+        }
+    }
+
+    for( int k=target; k!=source && k>=0; k=prev[k] )
+        plan.steps.push_back( prevStep[k] );
+    std::reverse( plan.steps.begin(), plan.steps.end() );
+    for( const auto& step : plan.steps )
+    {
+        plan.messages += step.messages;
+        plan.words += step.words;
+    }
+    plan.cost = ModelCost( plan.messages, plan.words, entrySize, ctrl );
+
+    if( prev[target] < 0 || plan.generalPurposeCost < plan.cost )
+    {
+        plan.steps.clear();
+        plan.generalPurpose = true;
+        plan.messages = gpMessages;
+        plan.words = gpWords;
+        plan.cost = plan.generalPurposeCost;
+    }
+    return plan;
+}
+
+} // anonymous namespace
+
+const CopyPlan& PlanCopy
+( Dist colDistA, Dist rowDistA, Dist colDistB, Dist rowDistB,
+  const Grid& grid, Int height, Int width, Int entrySize,
+  const CopyPlanCtrl& ctrl )
+{
+    DEBUG_CSE
+    const double volume = Max( double(height)*double(width), 1. );
+    const int volumeClass = int(Round(Log2(volume)));
+    const PlanKey key
+      ( colDistA, rowDistA, colDistB, rowDistB,
+        grid.Height(), grid.Width(), volumeClass, entrySize,
+        ctrl.latency, ctrl.inverseBandwidth );
+    auto it = planCache.find( key );
+    if( it == planCache.end() )
+    {
+        // Model using the representative volume of the class so that the
+        // plan does not depend upon which matrix happened to be seen first
+        const double classVolume = Pow( 2., double(volumeClass) );
+        it = planCache.insert
+        ( std::make_pair
+          ( key,
+            FormPlan
+            ( colDistA, rowDistA, colDistB, rowDistB,
+              grid, classVolume, entrySize, ctrl ) ) ).first;
+    }
+    return it->second;
+}
+
+void PrintCopyPlan( const CopyPlan& plan, ostream& os )
+{
+    DEBUG_CSE
+    os << "[" << DistToString(plan.colDist) << ","
+       << DistToString(plan.rowDist) << "]";
+    if( plan.generalPurpose )
+        os << " -> GeneralPurpose";
+    for( const auto& step : plan.steps )
+        os << " -> " << step.kernel << " -> ["
+           << DistToString(step.colDist) << ","
+           << DistToString(step.rowDist) << "]";
+    if( plan.modeled )
+        os << "\n  modeled: " << plan.messages << " messages, " << plan.words
+           << " words, " << plan.cost << " seconds (general-purpose: "
+           << plan.generalPurposeCost << " seconds)";
+    else
+        os << "\n  (not modeled)";
+    os << endl;
+}
+
+void PrintCopyPlans( ostream& os )
+{
+    DEBUG_CSE
+    for( const auto& entry : planCache )
+    {
+        os << std::get<4>(entry.first) << " x " << std::get<5>(entry.first)
+           << " grid, ~2^" << std::get<6>(entry.first) << " entries of "
+           << std::get<7>(entry.first) << " bytes: ";
+        PrintCopyPlan( entry.second, os );
+    }
+}
+
+void ClearCopyPlans() { planCache.clear(); }
+
+} // namespace El
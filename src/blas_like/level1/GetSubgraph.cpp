@@ -11,7 +11,10 @@
 
 namespace El {
 
-// TODO: Avoid sorting since the ordering can easily be preserved
+// Since the edges of a consistent graph are sorted by source and then by
+// target, and the subgraph's indices are a shift of the original ones, the
+// surviving edges are already in sorted order and are written directly into
+// the subgraph's buffers (rather than being queued and then sorted).
 
 void GetSubgraph
 ( const Graph& graph,
@@ -32,34 +35,38 @@ void GetSubgraph
     subgraph.Empty();
     subgraph.Resize( mSub, nSub );
 
-    // Reserve the number of edges that live within the subgraph
+    // Count the number of edges that live within the subgraph
     Int numEdgesSub = 0;
     for( Int i=I.beg; i<I.end; ++i )
     {
-        const Int offset = offsetBuf[i];
-        const Int numConn = offsetBuf[i+1] - offset;
-        for( Int e=offset; e<offset+numConn; ++e )
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
         {
             const Int j = targetBuf[e];
             if( j >= J.beg && j < J.end )
                 ++numEdgesSub;
         }
     }
-    subgraph.Reserve( numEdgesSub );
 
     // Insert the edges
+    subgraph.ForceNumEdges( numEdgesSub );
+    Int* subSourceBuf = subgraph.SourceBuffer();
+    Int* subTargetBuf = subgraph.TargetBuffer();
+    Int eSub = 0;
     for( Int i=I.beg; i<I.end; ++i ) 
     {
-        const Int offset = offsetBuf[i];
-        const Int numConn = offsetBuf[i+1] - offset;
-        for( Int e=offset; e<offset+numConn; ++e )
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
         {
             const Int j = targetBuf[e];
             if( j >= J.beg && j < J.end )
-                subgraph.QueueConnection( i-I.beg, j-J.beg );
+            {
+                subSourceBuf[eSub] = i-I.beg;
+                subTargetBuf[eSub] = j-J.beg;
+                ++eSub;
+            }
         }
     }
-    subgraph.ProcessQueues();
+    subgraph.ComputeSourceOffsets();
+    subgraph.ForceConsistency();
 }
 
 void GetSubgraph
@@ -120,6 +127,7 @@ void GetSubgraph
 
     // Compute the metadata
     // ====================
+    // Each edge is sent as a (source,target) pair
     vector<int> sendCounts(commSize,0);
     for( Int e=0; e<numEdges; ++e )
     {
@@ -128,7 +136,7 @@ void GetSubgraph
         if( i >= I.end )
             break;
         else if( i >= I.beg && j >= J.beg && j < J.end )
-            ++sendCounts[ subgraph.SourceOwner(i-I.beg) ];
+            sendCounts[ subgraph.SourceOwner(i-I.beg) ] += 2;
     }
 
     // Pack the data
@@ -136,7 +144,7 @@ void GetSubgraph
     vector<int> sendOffs;
     const int totalSend = Scan( sendCounts, sendOffs );
     auto offs = sendOffs;
-    vector<Int> sendSources(totalSend), sendTargets(totalSend);
+    vector<Int> sendEdges(totalSend);
     for( Int e=0; e<numEdges; ++e )
     {
         const Int i = sourceBuf[e];
@@ -146,23 +154,29 @@ void GetSubgraph
         else if( i >= I.beg && j >= J.beg && j < J.end )
         {
             const Int iSub = i - I.beg;
-            const Int jSub = j - J.beg;
             const int owner = subgraph.SourceOwner( iSub );
-            sendSources[offs[owner]] = iSub;
-            sendTargets[offs[owner]] = jSub;
-            ++offs[owner];
+            sendEdges[offs[owner]++] = iSub;
+            sendEdges[offs[owner]++] = j - J.beg;
         }
     }
     
     // Exchange and unpack the data
     // ============================
-    auto recvSources = mpi::AllToAll( sendSources, sendCounts, sendOffs, comm );
-    auto recvTargets = mpi::AllToAll( sendTargets, sendCounts, sendOffs, comm );
-    const Int totalRecv = recvSources.size();
-    subgraph.Reserve( totalRecv );
-    for( Int i=0; i<totalRecv; ++i )
-        subgraph.QueueConnection( recvSources[i], recvTargets[i] );
-    subgraph.ProcessQueues();
+    // Each process contributes a contiguous, sorted range of sources, and so
+    // concatenating the received edges in the order of the process ranks
+    // preserves the sorted order of the subgraph's edges
+    auto recvEdges = mpi::AllToAll( sendEdges, sendCounts, sendOffs, comm );
+    const Int numRecvEdges = recvEdges.size()/2;
+    subgraph.ForceNumLocalEdges( numRecvEdges );
+    Int* subSourceBuf = subgraph.SourceBuffer();
+    Int* subTargetBuf = subgraph.TargetBuffer();
+    for( Int e=0; e<numRecvEdges; ++e )
+    {
+        subSourceBuf[e] = recvEdges[2*e];
+        subTargetBuf[e] = recvEdges[2*e+1];
+    }
+    subgraph.ComputeSourceOffsets();
+    subgraph.ForceConsistency();
 }
 
 void GetSubgraph
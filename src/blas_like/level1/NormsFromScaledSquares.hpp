@@ -11,18 +11,78 @@
 
 namespace El {
 
+// Compute the scale (the maximum magnitude) and the scaled sum of squares of
+// each row of A with passes over its columns so that the inner loops are
+// contiguous and branch-free. As in UpdateScaledSquares, the squares are
+// first accumulated without scaling, and only the rows whose sums were unsafe
+// are revisited relative to their maximum magnitudes.
+template<typename F>
+void RowScaledSquares
+( const Matrix<F>& A,
+        Matrix<Base<F>>& scales,
+        Matrix<Base<F>>& scaledSquares )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    scales.Resize( m, 1 );
+    scaledSquares.Resize( m, 1 );
+    Zero( scales );
+    Zero( scaledSquares );
+    Real* scaleBuf = scales.Buffer();
+    Real* scaledSquareBuf = scaledSquares.Buffer();
+    for( Int j=0; j<n; ++j )
+    {
+        const F* aCol = A.LockedBuffer(0,j);
+        for( Int i=0; i<m; ++i )
+        {
+            const Real alphaAbs = Abs(aCol[i]);
+            scaleBuf[i] = Max(scaleBuf[i],alphaAbs);
+            scaledSquareBuf[i] += alphaAbs*alphaAbs;
+        }
+    }
+
+    vector<Int> unsafeRows;
+    for( Int i=0; i<m; ++i )
+    {
+        const Real maxAbs = scaleBuf[i];
+        if( maxAbs == Real(0) )
+            scaledSquareBuf[i] = 1;
+        else if( limits::IsFinite(scaledSquareBuf[i]) &&
+                 maxAbs >= limits::SafeMinToSquare(maxAbs) )
+            scaledSquareBuf[i] = (scaledSquareBuf[i]/maxAbs)/maxAbs;
+        else
+        {
+            scaledSquareBuf[i] = 0;
+            unsafeRows.push_back( i );
+        }
+    }
+    for( const Int i : unsafeRows )
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            const Real relAbs = Abs(A(i,j))/scaleBuf[i];
+            scaledSquareBuf[i] += relAbs*relAbs;
+        }
+    }
+}
+
+// The maximum of the local scales is also returned since, when the local
+// scales are the local maximum magnitudes, they are the max norms
 template<typename Real>
 void NormsFromScaledSquares
 ( const Matrix<Real>& localScales,
         Matrix<Real>& localScaledSquares,
         Matrix<Real>& normsLoc,
+        Matrix<Real>& scales,
         mpi::Comm comm )
 {
     DEBUG_CSE
     const Int nLocal = localScales.Height();
 
     // Find the maximum relative scales
-    Matrix<Real> scales( nLocal, 1 );
+    scales.Resize( nLocal, 1 );
     mpi::AllReduce
     ( localScales.LockedBuffer(), scales.Buffer(), nLocal, mpi::MAX, comm );
 
@@ -49,4 +109,17 @@ void NormsFromScaledSquares
         normsLoc(jLoc) = scales(jLoc)*Sqrt(scaledSquares(jLoc));
 }
 
+template<typename Real>
+void NormsFromScaledSquares
+( const Matrix<Real>& localScales,
+        Matrix<Real>& localScaledSquares,
+        Matrix<Real>& normsLoc,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    Matrix<Real> scales;
+    NormsFromScaledSquares
+    ( localScales, localScaledSquares, normsLoc, scales, comm );
+}
+
 } // namespace El
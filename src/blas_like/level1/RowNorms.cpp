@@ -18,22 +18,10 @@ void RowTwoNormsHelper
 {
     DEBUG_CSE
     typedef Base<F> Real;
-    const Int mLocal = ALoc.Height();
-    const Int nLocal = ALoc.Width();
 
     // TODO: Ensure that NaN's propagate
-    Matrix<Real> localScales(mLocal,1 ), localScaledSquares(mLocal,1);
-    for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-    {
-        Real localScale = 0;
-        Real localScaledSquare = 1;
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(iLoc) = localScale;
-        localScaledSquares(iLoc) = localScaledSquare;
-    }
+    Matrix<Real> localScales, localScaledSquares;
+    RowScaledSquares( ALoc, localScales, localScaledSquares );
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
 }
@@ -42,16 +30,13 @@ template<typename F>
 void RowTwoNorms( const Matrix<F>& A, Matrix<Base<F>>& norms )
 {
     DEBUG_CSE
+    typedef Base<F> Real;
     const Int m = A.Height();
-    const Int n = A.Width();
+    Matrix<Real> scales, scaledSquares;
+    RowScaledSquares( A, scales, scaledSquares );
     norms.Resize( m, 1 );
-    if( n == 0 )
-    {
-        Zero( norms );
-        return;
-    }
     for( Int i=0; i<m; ++i )
-        norms(i) = blas::Nrm2( n, &A(i,0), A.LDim() );
+        norms(i) = scales(i)*Sqrt(scaledSquares(i));
 }
 
 template<typename F>
@@ -131,8 +116,8 @@ void RowTwoNorms( const SparseMatrix<F>& A, Matrix<Base<F>>& norms )
         Real scaledSquare = 1;
         const Int offset = offsetBuf[i];
         const Int numConn = offsetBuf[i+1] - offset;
-        for( Int e=offset; e<offset+numConn; ++e )
-            UpdateScaledSquare( valBuf[e], scale, scaledSquare );
+        UpdateScaledSquares
+        ( numConn, &valBuf[offset], 1, scale, scaledSquare );
         norms(i) = scale*Sqrt(scaledSquare);
     }
 }
@@ -176,8 +161,8 @@ void RowTwoNorms( const DistSparseMatrix<F>& A, DistMultiVec<Base<F>>& norms )
         Real scaledSquare = 1;
         const Int offset = offsetBuf[iLoc];
         const Int numConn = offsetBuf[iLoc+1] - offset;
-        for( Int e=offset; e<offset+numConn; ++e )
-            UpdateScaledSquare( valBuf[e], scale, scaledSquare );
+        UpdateScaledSquares
+        ( numConn, &valBuf[offset], 1, scale, scaledSquare );
         normLoc(iLoc) = scale*Sqrt(scaledSquare);
     }
 }
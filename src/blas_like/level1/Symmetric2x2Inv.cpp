@@ -12,7 +12,8 @@
 namespace El {
 
 template<typename F>
-void Symmetric2x2Inv( UpperOrLower uplo, Matrix<F>& D, bool conjugate )
+void Symmetric2x2Inv
+( UpperOrLower uplo, FixedMatrix<F,2,2>& D, bool conjugate )
 {
     DEBUG_CSE
     typedef Base<F> Real;
@@ -20,40 +21,51 @@ void Symmetric2x2Inv( UpperOrLower uplo, Matrix<F>& D, bool conjugate )
     {
         if( conjugate )
         {
-            const Real delta11 = D.GetRealPart(0,0);
-            const F delta21 = D.Get(1,0);
-            const Real delta22 = D.GetRealPart(1,1);
+            const Real delta11 = RealPart(D(0,0));
+            const F delta21 = D(1,0);
+            const Real delta22 = RealPart(D(1,1));
             const Real delta21Abs = SafeAbs( delta21 );
             const Real phi21To11 = delta22 / delta21Abs;
             const Real phi21To22 = delta11 / delta21Abs;
             const F phi21 = delta21 / delta21Abs;
             const Real xi = (Real(1)/(phi21To11*phi21To22-Real(1)))/delta21Abs;
 
-            D.SetRealPart( 0, 0,  xi*phi21To11 );
-            D.Set(         1, 0, -xi*phi21     );
-            D.SetRealPart( 1, 1,  xi*phi21To22 );
+            D(0,0) =  xi*phi21To11;
+            D(1,0) = -xi*phi21;
+            D(1,1) =  xi*phi21To22;
         }
         else
         {
-            const F delta11 = D.Get(0,0);
-            const F delta21 = D.Get(1,0);
-            const F delta22 = D.Get(1,1);
+            const F delta11 = D(0,0);
+            const F delta21 = D(1,0);
+            const F delta22 = D(1,1);
             const F chi21To11 = -delta22 / delta21;
             const F chi21To22 = -delta11 / delta21;
             const F chi21 = (F(1)/(F(1)-chi21To11*chi21To22))/delta21;
 
-            D.Set( 0, 0, chi21*chi21To11 );
-            D.Set( 1, 0, chi21           );
-            D.Set( 1, 1, chi21*chi21To22 );
+            D(0,0) = chi21*chi21To11;
+            D(1,0) = chi21;
+            D(1,1) = chi21*chi21To22;
         }
     }
     else
         LogicError("This option not yet supported");
 }
 
+template<typename F>
+void Symmetric2x2Inv( UpperOrLower uplo, Matrix<F>& D, bool conjugate )
+{
+    DEBUG_CSE
+    FixedMatrix<F,2,2> DFixed( D );
+    Symmetric2x2Inv( uplo, DFixed, conjugate );
+    DFixed.CopyTo( D );
+}
+
 #define PROTO(F) \
   template void Symmetric2x2Inv \
-  ( UpperOrLower uplo, Matrix<F>& A, bool conjugate );
+  ( UpperOrLower uplo, Matrix<F>& A, bool conjugate ); \
+  template void Symmetric2x2Inv \
+  ( UpperOrLower uplo, FixedMatrix<F,2,2>& A, bool conjugate );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -266,6 +266,47 @@ void Transform2x2Cols
     Transform2x2Cols( G.LockedMatrix(), A, j1, j2 );
 }
 
+template<typename T>
+void Transform2x2Rows
+( const FixedMatrix<T,2,2>& G,
+        Matrix<T>& A, Int i1, Int i2 )
+{
+    DEBUG_CSE
+    Transform2x2
+    ( A.Width(), G(0,0), G(0,1), G(1,0), G(1,1),
+      A.Buffer(i1,0), A.LDim(), A.Buffer(i2,0), A.LDim() );
+}
+
+template<typename T>
+void Transform2x2Rows
+( const FixedMatrix<T,2,2>& G,
+        AbstractDistMatrix<T>& A, Int i1, Int i2 )
+{
+    DEBUG_CSE
+    Transform2x2Rows( G.LockedView(), A, i1, i2 );
+}
+
+template<typename T>
+void Transform2x2Cols
+( const FixedMatrix<T,2,2>& G,
+        Matrix<T>& A, Int j1, Int j2 )
+{
+    DEBUG_CSE
+    // See the Matrix<T> version for why G is implicitly transposed
+    Transform2x2
+    ( A.Height(), G(0,0), G(1,0), G(0,1), G(1,1),
+      A.Buffer(0,j1), 1, A.Buffer(0,j2), 1 );
+}
+
+template<typename T>
+void Transform2x2Cols
+( const FixedMatrix<T,2,2>& G,
+        AbstractDistMatrix<T>& A, Int j1, Int j2 )
+{
+    DEBUG_CSE
+    Transform2x2Cols( G.LockedView(), A, j1, j2 );
+}
+
 #define PROTO(T) \
   template void Transform2x2 \
   ( const Matrix<T>& G, \
@@ -296,6 +337,18 @@ void Transform2x2Cols
           AbstractDistMatrix<T>& A, Int j1, Int j2 ); \
   template void Transform2x2Cols \
   ( const AbstractDistMatrix<T>& G, \
+          AbstractDistMatrix<T>& A, Int j1, Int j2 ); \
+  template void Transform2x2Rows \
+  ( const FixedMatrix<T,2,2>& G, \
+          Matrix<T>& A, Int i1, Int i2 ); \
+  template void Transform2x2Rows \
+  ( const FixedMatrix<T,2,2>& G, \
+          AbstractDistMatrix<T>& A, Int i1, Int i2 ); \
+  template void Transform2x2Cols \
+  ( const FixedMatrix<T,2,2>& G, \
+          Matrix<T>& A, Int j1, Int j2 ); \
+  template void Transform2x2Cols \
+  ( const FixedMatrix<T,2,2>& G, \
           AbstractDistMatrix<T>& A, Int j1, Int j2 );
 
 #define EL_ENABLE_DOUBLEDOUBLE
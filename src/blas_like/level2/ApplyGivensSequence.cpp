@@ -8,6 +8,7 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level2.hpp>
+#include <El/blas_like/level3.hpp>
 
 namespace El {
 
@@ -557,12 +558,271 @@ void ApplyGivensSequence
     }
 }
 
+namespace givens_seq {
+
+// Since rotation j of sequence p must follow rotation j-1 of sequence p and
+// (the last rotation of sequence p-1 touching columns j and j+1) rotation j+1
+// of sequence p-1, the rotations can be grouped by the "wave" index j+p (or,
+// for backward sequences, (n-2-j)+p) into blocks of 'blocksize' consecutive
+// waves, where each group only depends upon its predecessors. Each group only
+// touches blocksize+numSequences columns, and so its rotations can be
+// accumulated into a small unitary matrix.
+template<typename F,typename FS>
+void AccumulateGroups
+( ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<FS>& sList,
+  Int blocksize,
+  vector<Matrix<F>>& groups,
+  vector<Int>& offsets )
+{
+    DEBUG_CSE
+    const Int numRots = cList.Height();
+    const Int numSeqs = cList.Width();
+    const Int numGroups = (numRots+numSeqs-1+blocksize-1) / blocksize;
+    groups.resize( numGroups );
+    offsets.resize( numGroups );
+
+    F tmp;
+    for( Int b=0; b<numGroups; ++b )
+    {
+        // The range [waveBeg,waveEnd) of rotation indices of sequence p
+        // (counting from the first rotation to be applied) in this group
+        auto waveBeg = [&]( Int p ) { return Max(b*blocksize-p,Int(0)); };
+        auto waveEnd =
+          [&]( Int p ) { return Min((b+1)*blocksize-p,numRots); };
+        auto rotIndex =
+          [&]( Int r ) { return direction==FORWARD ? r : numRots-1-r; };
+
+        Int colBeg=numRots+1, colEnd=0;
+        for( Int p=0; p<numSeqs; ++p )
+        {
+            if( waveBeg(p) >= waveEnd(p) )
+                continue;
+            const Int j0 = rotIndex(waveBeg(p));
+            const Int j1 = rotIndex(waveEnd(p)-1);
+            colBeg = Min( colBeg, Min(j0,j1) );
+            colEnd = Max( colEnd, Max(j0,j1)+2 );
+        }
+        offsets[b] = colBeg;
+        auto& G = groups[b];
+        G.Resize( colEnd-colBeg, colEnd-colBeg );
+        Zero( G );
+        FillDiagonal( G, F(1) );
+        for( Int p=0; p<numSeqs; ++p )
+        {
+            for( Int r=waveBeg(p); r<waveEnd(p); ++r )
+            {
+                const Int j = rotIndex(r);
+                ApplyVariableRight( j-colBeg, cList(j,p), sList(j,p), G, tmp );
+            }
+        }
+    }
+}
+
+template<typename F,typename FS>
+void Apply
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<FS>& sList,
+  Matrix<F>& A,
+  Int blocksize )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numSeqs = cList.Width();
+    const Int numRotated = ( side==LEFT ? m : n );
+    DEBUG_ONLY(
+      if( cList.Height() != numRotated-1 || sList.Height() != numRotated-1 )
+          LogicError("Expected sequences of length ",numRotated-1);
+      if( sList.Width() != numSeqs )
+          LogicError("cList and sList must have the same number of sequences");
+    )
+    if( blocksize <= 0 )
+        LogicError("The blocksize must be positive");
+    if( m == 0 || n == 0 || numSeqs == 0 )
+        return;
+
+    // Applying an individual sequence as a Gemm would require O(blocksize)
+    // times more work than the rotations themselves, so the accumulation is
+    // only worthwhile over several sequences and a sufficiently large matrix
+    const Int numIndep = ( side==LEFT ? n : m );
+    if( numSeqs == 1 || numRotated <= 2 || numIndep < blocksize )
+    {
+        Matrix<Base<F>> c;
+        Matrix<FS> s;
+        for( Int p=0; p<numSeqs; ++p )
+        {
+            LockedView( c, cList, ALL, IR(p) );
+            LockedView( s, sList, ALL, IR(p) );
+            ApplyGivensSequence
+            ( side, VARIABLE_GIVENS_SEQUENCE, direction, c, s, A );
+        }
+        return;
+    }
+
+    vector<Matrix<F>> groups;
+    vector<Int> offsets;
+    AccumulateGroups( direction, cList, sList, blocksize, groups, offsets );
+    const Int numGroups = groups.size();
+
+    // Apply every group to each panel of A in turn so that the panel remains
+    // in cache
+    const Int numPanels = (numIndep+blocksize-1) / blocksize;
+#ifdef EL_HYBRID
+    #pragma omp parallel for schedule(dynamic)
+#endif
+    for( Int k=0; k<numPanels; ++k )
+    {
+        const IR indPanel( k*blocksize, Min((k+1)*blocksize,numIndep) );
+        Matrix<F> T;
+        for( Int b=0; b<numGroups; ++b )
+        {
+            const auto& G = groups[b];
+            const IR indWin( offsets[b], offsets[b]+G.Height() );
+            if( side == LEFT )
+            {
+                // Rotating rows from the left is equivalent to rotating the
+                // columns of the transpose from the right
+                auto AWin = A( indWin, indPanel );
+                Gemm( TRANSPOSE, NORMAL, F(1), G, AWin, T );
+                AWin = T;
+            }
+            else
+            {
+                auto AWin = A( indPanel, indWin );
+                Gemm( NORMAL, NORMAL, F(1), AWin, G, T );
+                AWin = T;
+            }
+        }
+    }
+}
+
+} // namespace givens_seq
+
+template<typename F,typename>
+void ApplyGivensSequences
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<F>& sList,
+  Matrix<F>& A,
+  Int blocksize )
+{
+    DEBUG_CSE
+    givens_seq::Apply( side, direction, cList, sList, A, blocksize );
+}
+
+template<typename F>
+void ApplyGivensSequences
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<Base<F>>& sList,
+  Matrix<F>& A,
+  Int blocksize )
+{
+    DEBUG_CSE
+    givens_seq::Apply( side, direction, cList, sList, A, blocksize );
+}
+
+template<typename F>
+GivensSequenceAccumulator<F>::GivensSequenceAccumulator
+( Matrix<F>& A, Int maxSequences, Int blocksize )
+: A_(A), maxSequences_(maxSequences), blocksize_(blocksize)
+{
+    DEBUG_CSE
+    if( maxSequences <= 0 )
+        LogicError("The maximum number of sequences must be positive");
+}
+
+template<typename F>
+void GivensSequenceAccumulator<F>::Reserve
+( ForwardOrBackward direction, Int winBeg, Int winEnd )
+{
+    DEBUG_CSE
+    if( numPending_ > 0 &&
+        (direction != direction_ || winBeg < winBeg_ || winEnd > winEnd_) )
+        Flush();
+    if( numPending_ == 0 )
+    {
+        direction_ = direction;
+        winBeg_ = winBeg;
+        winEnd_ = winEnd;
+        cList_.Resize( winEnd-winBeg-1, maxSequences_ );
+        sList_.Resize( winEnd-winBeg-1, maxSequences_ );
+    }
+    auto c = cList_( ALL, IR(numPending_) );
+    auto s = sList_( ALL, IR(numPending_) );
+    Fill( c, Base<F>(1) );
+    Zero( s );
+}
+
+template<typename F>
+void GivensSequenceAccumulator<F>::Push
+( ForwardOrBackward direction,
+  Int offset,
+  const Matrix<Base<F>>& cList,
+  const Matrix<Base<F>>& sList )
+{
+    DEBUG_CSE
+    const Int numRots = cList.Height();
+    if( numRots == 0 )
+        return;
+    Reserve( direction, offset, offset+numRots+1 );
+    for( Int j=0; j<numRots; ++j )
+    {
+        cList_(offset-winBeg_+j,numPending_) = cList(j);
+        sList_(offset-winBeg_+j,numPending_) = sList(j);
+    }
+    if( ++numPending_ == maxSequences_ )
+        Flush();
+}
+
+template<typename F>
+void GivensSequenceAccumulator<F>::PushRotation
+( Int j, const Base<F>& c, const Base<F>& s )
+{
+    DEBUG_CSE
+    // A single rotation is compatible with either direction
+    const ForwardOrBackward direction =
+      ( numPending_ > 0 ? direction_ : FORWARD );
+    Reserve( direction, j, j+2 );
+    cList_(j-winBeg_,numPending_) = c;
+    sList_(j-winBeg_,numPending_) = s;
+    if( ++numPending_ == maxSequences_ )
+        Flush();
+}
+
+template<typename F>
+void GivensSequenceAccumulator<F>::Flush()
+{
+    DEBUG_CSE
+    if( numPending_ == 0 )
+        return;
+    auto AWin = A_( ALL, IR(winBeg_,winEnd_) );
+    auto cList = cList_( ALL, IR(0,numPending_) );
+    auto sList = sList_( ALL, IR(0,numPending_) );
+    ApplyGivensSequences( RIGHT, direction_, cList, sList, AWin, blocksize_ );
+    numPending_ = 0;
+}
+
+template<typename F>
+Int GivensSequenceAccumulator<F>::NumPending() const EL_NO_EXCEPT
+{ return numPending_; }
+
 #define PROTO_REAL(F) \
   template void ApplyGivensSequence \
   ( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction, \
     const Matrix<Base<F>>& cList, \
     const Matrix<Base<F>>& sList, \
-    Matrix<F>& A );
+    Matrix<F>& A ); \
+  template void ApplyGivensSequences \
+  ( LeftOrRight side, ForwardOrBackward direction, \
+    const Matrix<Base<F>>& cList, \
+    const Matrix<Base<F>>& sList, \
+    Matrix<F>& A, \
+    Int blocksize ); \
+  template class GivensSequenceAccumulator<F>;
 
 #define PROTO(F) \
   PROTO_REAL(F) \
@@ -570,7 +830,13 @@ void ApplyGivensSequence
   ( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction, \
     const Matrix<Base<F>>& cList, \
     const Matrix<F>& sList, \
-    Matrix<F>& A );
+    Matrix<F>& A ); \
+  template void ApplyGivensSequences \
+  ( LeftOrRight side, ForwardOrBackward direction, \
+    const Matrix<Base<F>>& cList, \
+    const Matrix<F>& sList, \
+    Matrix<F>& A, \
+    Int blocksize );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -235,6 +235,26 @@ void Gemv
     Gemv( orientation, alpha, A, x, T(0), y );
 }
 
+template<typename T>
+void Gemv
+( T alpha, const TransposedView<Matrix<T>>& A,
+           const Matrix<T>& x,
+  T beta,        Matrix<T>& y )
+{
+    DEBUG_CSE
+    Gemv( A.Orientation(), alpha, A.Parent(), x, beta, y );
+}
+
+template<typename T>
+void Gemv
+( T alpha, const TransposedView<AbstractDistMatrix<T>>& A,
+           const AbstractDistMatrix<T>& x,
+  T beta,        AbstractDistMatrix<T>& y )
+{
+    DEBUG_CSE
+    Gemv( A.Orientation(), alpha, A.Parent(), x, beta, y );
+}
+
 #define PROTO(T) \
   template void Gemv \
   ( Orientation orientation, \
@@ -257,6 +277,14 @@ void Gemv
              const AbstractDistMatrix<T>& x, \
                    AbstractDistMatrix<T>& y ); \
   template void Gemv \
+  ( T alpha, const TransposedView<Matrix<T>>& A, \
+             const Matrix<T>& x, \
+    T beta,        Matrix<T>& y ); \
+  template void Gemv \
+  ( T alpha, const TransposedView<AbstractDistMatrix<T>>& A, \
+             const AbstractDistMatrix<T>& x, \
+    T beta,        AbstractDistMatrix<T>& y ); \
+  template void Gemv \
   ( Orientation orientation, \
     T alpha, const DistMatrix<T,MC,MR,BLOCK>& A, \
              const DistMatrix<T,MC,MR,BLOCK>& x, \
@@ -63,13 +63,37 @@ void Trsv
     }
 }
 
+template<typename F>
+void Trsv
+( UpperOrLower uplo, UnitOrNonUnit diag,
+  const TransposedView<Matrix<F>>& A, Matrix<F>& x )
+{
+    DEBUG_CSE
+    Trsv( uplo, A.Orientation(), diag, A.Parent(), x );
+}
+
+template<typename F>
+void Trsv
+( UpperOrLower uplo, UnitOrNonUnit diag,
+  const TransposedView<AbstractDistMatrix<F>>& A, AbstractDistMatrix<F>& x )
+{
+    DEBUG_CSE
+    Trsv( uplo, A.Orientation(), diag, A.Parent(), x );
+}
+
 #define PROTO(F) \
   template void Trsv \
   ( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag, \
     const Matrix<F>& A, Matrix<F>& x ); \
   template void Trsv \
   ( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag, \
-    const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& x );
+    const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& x ); \
+  template void Trsv \
+  ( UpperOrLower uplo, UnitOrNonUnit diag, \
+    const TransposedView<Matrix<F>>& A, Matrix<F>& x ); \
+  template void Trsv \
+  ( UpperOrLower uplo, UnitOrNonUnit diag, \
+    const TransposedView<AbstractDistMatrix<F>>& A, AbstractDistMatrix<F>& x );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
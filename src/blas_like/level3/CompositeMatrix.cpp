@@ -0,0 +1,535 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+template<typename T>
+CompositeMatrix<T>::CompositeMatrix( Int numBlockRows, Int numBlockCols )
+{
+    DEBUG_CSE
+    Resize( numBlockRows, numBlockCols );
+}
+
+template<typename T>
+void CompositeMatrix<T>::Resize( Int numBlockRows, Int numBlockCols )
+{
+    DEBUG_CSE
+    if( numBlockRows < 0 || numBlockCols < 0 )
+        LogicError
+        ("Invalid number of block rows and columns: ",
+         numBlockRows,", ",numBlockCols);
+    numBlockRows_ = numBlockRows;
+    numBlockCols_ = numBlockCols;
+    blocks_.assign( numBlockRows*numBlockCols, Block() );
+    blockHeights_.assign( numBlockRows, -1 );
+    blockWidths_.assign( numBlockCols, -1 );
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetDimensions
+( Int i, Int j, Int height, Int width )
+{
+    DEBUG_CSE
+    if( i < 0 || i >= numBlockRows_ || j < 0 || j >= numBlockCols_ )
+        LogicError
+        ("Block (",i,",",j,") is out of bounds of the ",
+         numBlockRows_," x ",numBlockCols_," block grid");
+    if( blockHeights_[i] >= 0 && blockHeights_[i] != height )
+        LogicError
+        ("Block row ",i," has height ",blockHeights_[i],
+         " but the new block has height ",height);
+    if( blockWidths_[j] >= 0 && blockWidths_[j] != width )
+        LogicError
+        ("Block column ",j," has width ",blockWidths_[j],
+         " but the new block has width ",width);
+    blockHeights_[i] = height;
+    blockWidths_[j] = width;
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetBlock
+( Int i, Int j, const Matrix<T>& A, T alpha, Orientation orientation )
+{
+    DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    SetDimensions
+    ( i, j, normal ? A.Height() : A.Width(), normal ? A.Width() : A.Height() );
+    Block& block = blocks_[i+j*numBlockRows_];
+    block = Block();
+    block.type = DENSE_BLOCK;
+    block.orientation = orientation;
+    block.alpha = alpha;
+    block.dense = &A;
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetBlock
+( Int i, Int j, const SparseMatrix<T>& A, T alpha, Orientation orientation )
+{
+    DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    SetDimensions
+    ( i, j, normal ? A.Height() : A.Width(), normal ? A.Width() : A.Height() );
+    Block& block = blocks_[i+j*numBlockRows_];
+    block = Block();
+    block.type = SPARSE_BLOCK;
+    block.orientation = orientation;
+    block.alpha = alpha;
+    block.sparse = &A;
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetBlock
+( Int i, Int j, const CompositeMatrix<T>& A,
+  T alpha, Orientation orientation )
+{
+    DEBUG_CSE
+    if( &A == this )
+        LogicError("A composite matrix cannot contain itself");
+    const bool normal = ( orientation == NORMAL );
+    SetDimensions
+    ( i, j, normal ? A.Height() : A.Width(), normal ? A.Width() : A.Height() );
+    Block& block = blocks_[i+j*numBlockRows_];
+    block = Block();
+    block.type = COMPOSITE_BLOCK;
+    block.orientation = orientation;
+    block.alpha = alpha;
+    block.composite = &A;
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetDiagonalBlock
+( Int i, Int j, const Matrix<T>& d, T alpha )
+{
+    DEBUG_CSE
+    if( d.Width() != 1 )
+        LogicError("d must be a column vector");
+    SetDimensions( i, j, d.Height(), d.Height() );
+    Block& block = blocks_[i+j*numBlockRows_];
+    block = Block();
+    block.type = DIAGONAL_BLOCK;
+    block.alpha = alpha;
+    block.dense = &d;
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetIdentityBlock( Int i, Int j, Int n, T alpha )
+{
+    DEBUG_CSE
+    SetDimensions( i, j, n, n );
+    Block& block = blocks_[i+j*numBlockRows_];
+    block = Block();
+    block.type = IDENTITY_BLOCK;
+    block.alpha = alpha;
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetZeroBlock( Int i, Int j, Int height, Int width )
+{
+    DEBUG_CSE
+    SetDimensions( i, j, height, width );
+    blocks_[i+j*numBlockRows_] = Block();
+}
+
+template<typename T>
+Int CompositeMatrix<T>::NumBlockRows() const EL_NO_EXCEPT
+{ return numBlockRows_; }
+
+template<typename T>
+Int CompositeMatrix<T>::NumBlockCols() const EL_NO_EXCEPT
+{ return numBlockCols_; }
+
+template<typename T>
+Int CompositeMatrix<T>::BlockHeight( Int i ) const EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(
+      if( i < 0 || i >= numBlockRows_ )
+          LogicError("Block row ",i," is out of bounds");
+    )
+    return Max( blockHeights_[i], Int(0) );
+}
+
+template<typename T>
+Int CompositeMatrix<T>::BlockWidth( Int j ) const EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(
+      if( j < 0 || j >= numBlockCols_ )
+          LogicError("Block column ",j," is out of bounds");
+    )
+    return Max( blockWidths_[j], Int(0) );
+}
+
+template<typename T>
+Int CompositeMatrix<T>::Height() const EL_NO_EXCEPT
+{
+    Int height = 0;
+    for( Int i=0; i<numBlockRows_; ++i )
+        height += Max( blockHeights_[i], Int(0) );
+    return height;
+}
+
+template<typename T>
+Int CompositeMatrix<T>::Width() const EL_NO_EXCEPT
+{
+    Int width = 0;
+    for( Int j=0; j<numBlockCols_; ++j )
+        width += Max( blockWidths_[j], Int(0) );
+    return width;
+}
+
+// Y := alpha op(B) X + Y, or, if conjugate=true, Y := alpha conj(op(B)) X + Y,
+// for the matrix B referenced by the block (excluding its own scaling and
+// orientation, which have already been folded into alpha and orientation)
+template<typename T>
+void CompositeMatrix<T>::ApplyBlock
+( const Block& block, Orientation orientation, bool conjugate,
+  T alpha, const Matrix<T>& X, Matrix<T>& Y ) const
+{
+    DEBUG_CSE
+    if( conjugate )
+    {
+        // alpha conj(op(B)) X = alpha conj(op(B) conj(X))
+        Matrix<T> XConj, Z;
+        Conjugate( X, XConj );
+        Z.Resize( Y.Height(), Y.Width() );
+        Zero( Z );
+        ApplyBlock( block, orientation, false, T(1), XConj, Z );
+        Conjugate( Z );
+        Axpy( alpha, Z, Y );
+        return;
+    }
+
+    switch( block.type )
+    {
+    case DENSE_BLOCK:
+        Gemm( orientation, NORMAL, alpha, *block.dense, X, T(1), Y );
+        break;
+    case SPARSE_BLOCK:
+        Multiply( orientation, alpha, *block.sparse, X, T(1), Y );
+        break;
+    case COMPOSITE_BLOCK:
+        block.composite->Apply( orientation, alpha, X, T(1), Y );
+        break;
+    case DIAGONAL_BLOCK:
+    {
+        const Matrix<T>& d = *block.dense;
+        const bool adjoint = ( orientation == ADJOINT );
+        const Int n = d.Height();
+        for( Int k=0; k<X.Width(); ++k )
+            for( Int r=0; r<n; ++r )
+                Y(r,k) += alpha*( adjoint ? Conj(d(r)) : d(r) )*X(r,k);
+        break;
+    }
+    case IDENTITY_BLOCK:
+        Axpy( alpha, X, Y );
+        break;
+    case ZERO_BLOCK:
+        break;
+    }
+}
+
+template<typename T>
+void CompositeMatrix<T>::Apply
+( Orientation orientation,
+  T alpha, const Matrix<T>& X,
+  T beta,        Matrix<T>& Y ) const
+{
+    DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    const bool adjoint = ( orientation == ADJOINT );
+    const Int m = ( normal ? Height() : Width() );
+    const Int n = ( normal ? Width() : Height() );
+    if( X.Height() != n )
+        LogicError
+        ("X was ",X.Height()," x ",X.Width()," but op(A) was ",m," x ",n);
+    if( beta == T(0) )
+    {
+        Y.Resize( m, X.Width() );
+        Zero( Y );
+    }
+    else
+    {
+        if( Y.Height() != m || Y.Width() != X.Width() )
+            LogicError
+            ("Y was ",Y.Height()," x ",Y.Width()," but should have been ",
+             m," x ",X.Width());
+        if( beta != T(1) )
+            Y *= beta;
+    }
+
+    vector<Int> rowOffs(numBlockRows_+1,0), colOffs(numBlockCols_+1,0);
+    for( Int i=0; i<numBlockRows_; ++i )
+        rowOffs[i+1] = rowOffs[i] + BlockHeight(i);
+    for( Int j=0; j<numBlockCols_; ++j )
+        colOffs[j+1] = colOffs[j] + BlockWidth(j);
+
+    for( Int j=0; j<numBlockCols_; ++j )
+    {
+        const IR colInd( colOffs[j], colOffs[j+1] );
+        for( Int i=0; i<numBlockRows_; ++i )
+        {
+            const Block& block = blocks_[i+j*numBlockRows_];
+            if( block.type == ZERO_BLOCK )
+                continue;
+            const IR rowInd( rowOffs[i], rowOffs[i+1] );
+
+            // Block (i,j) of A is alpha_B op_B(B), and so block (j,i) of
+            // op(A) is op(alpha_B) op(op_B(B)). The composition of two
+            // orientations is an orientation, except for the transpose of an
+            // adjoint (or vice versa), which is the conjugate.
+            const T blockAlpha =
+              alpha*( adjoint ? Conj(block.alpha) : block.alpha );
+            Orientation blockOrient = block.orientation;
+            bool conjugate = false;
+            if( !normal )
+            {
+                if( block.orientation == NORMAL )
+                    blockOrient = orientation;
+                else if( block.orientation == orientation )
+                    blockOrient = NORMAL;
+                else
+                {
+                    blockOrient = NORMAL;
+                    conjugate = true;
+                }
+            }
+
+            auto Xj = X( normal ? colInd : rowInd, ALL );
+            auto Yi = Y( normal ? rowInd : colInd, ALL );
+            ApplyBlock( block, blockOrient, conjugate, blockAlpha, Xj, Yi );
+        }
+    }
+}
+
+template<typename T>
+void CompositeMatrix<T>::operator()( const Matrix<T>& X, Matrix<T>& Y ) const
+{
+    DEBUG_CSE
+    Apply( NORMAL, T(1), X, T(0), Y );
+}
+
+template<typename T>
+void CompositeMatrix<T>::Materialize( Matrix<T>& A ) const
+{
+    DEBUG_CSE
+    A.Resize( Height(), Width() );
+    Zero( A );
+
+    Int colOff = 0;
+    for( Int j=0; j<numBlockCols_; ++j )
+    {
+        const Int width = BlockWidth(j);
+        Int rowOff = 0;
+        for( Int i=0; i<numBlockRows_; ++i )
+        {
+            const Int height = BlockHeight(i);
+            const Block& block = blocks_[i+j*numBlockRows_];
+            auto ABlock =
+              A( IR(rowOff,rowOff+height), IR(colOff,colOff+width) );
+            const Orientation orient = block.orientation;
+            const T alpha = block.alpha;
+            switch( block.type )
+            {
+            case DENSE_BLOCK:
+            case COMPOSITE_BLOCK:
+            {
+                Matrix<T> BExpl;
+                if( block.type == COMPOSITE_BLOCK )
+                    block.composite->Materialize( BExpl );
+                else
+                    LockedView( BExpl, *block.dense );
+                if( orient == NORMAL )
+                    ABlock = BExpl;
+                else
+                    Transpose( BExpl, ABlock, orient == ADJOINT );
+                if( alpha != T(1) )
+                    ABlock *= alpha;
+                break;
+            }
+            case SPARSE_BLOCK:
+            {
+                const SparseMatrix<T>& B = *block.sparse;
+                const Int numEntries = B.NumEntries();
+                for( Int e=0; e<numEntries; ++e )
+                {
+                    const T value = B.Value(e);
+                    if( orient == NORMAL )
+                        ABlock(B.Row(e),B.Col(e)) += alpha*value;
+                    else
+                        ABlock(B.Col(e),B.Row(e)) +=
+                          alpha*( orient == ADJOINT ? Conj(value) : value );
+                }
+                break;
+            }
+            case DIAGONAL_BLOCK:
+            {
+                const Matrix<T>& d = *block.dense;
+                for( Int k=0; k<height; ++k )
+                    ABlock(k,k) = alpha*d(k);
+                break;
+            }
+            case IDENTITY_BLOCK:
+                for( Int k=0; k<height; ++k )
+                    ABlock(k,k) = alpha;
+                break;
+            case ZERO_BLOCK:
+                break;
+            }
+            rowOff += height;
+        }
+        colOff += width;
+    }
+}
+
+template<typename T>
+void CompositeMatrix<T>::Materialize( SparseMatrix<T>& A ) const
+{
+    DEBUG_CSE
+    // Explicitly form the composite blocks so that the number of entries is
+    // known up front
+    vector<SparseMatrix<T>> compositeBlocks( blocks_.size() );
+    Int numEntries = 0;
+    for( Int j=0; j<numBlockCols_; ++j )
+    {
+        for( Int i=0; i<numBlockRows_; ++i )
+        {
+            const Int index = i+j*numBlockRows_;
+            const Block& block = blocks_[index];
+            switch( block.type )
+            {
+            case DENSE_BLOCK:
+                numEntries += block.dense->Height()*block.dense->Width();
+                break;
+            case SPARSE_BLOCK:
+                numEntries += block.sparse->NumEntries();
+                break;
+            case COMPOSITE_BLOCK:
+                block.composite->Materialize( compositeBlocks[index] );
+                numEntries += compositeBlocks[index].NumEntries();
+                break;
+            case DIAGONAL_BLOCK:
+            case IDENTITY_BLOCK:
+                numEntries += BlockHeight(i);
+                break;
+            case ZERO_BLOCK:
+                break;
+            }
+        }
+    }
+
+    A.Empty();
+    A.Resize( Height(), Width() );
+    A.Reserve( numEntries );
+    Int colOff = 0;
+    for( Int j=0; j<numBlockCols_; ++j )
+    {
+        Int rowOff = 0;
+        for( Int i=0; i<numBlockRows_; ++i )
+        {
+            const Int index = i+j*numBlockRows_;
+            const Block& block = blocks_[index];
+            const Orientation orient = block.orientation;
+            const T alpha = block.alpha;
+            // Queue alpha op(B)(r,c) given B(s,t) = value
+            auto queueEntry = [&]( Int s, Int t, T value )
+            {
+                if( orient == NORMAL )
+                    A.QueueUpdate( rowOff+s, colOff+t, alpha*value );
+                else
+                    A.QueueUpdate
+                    ( rowOff+t, colOff+s,
+                      alpha*( orient == ADJOINT ? Conj(value) : value ) );
+            };
+            switch( block.type )
+            {
+            case DENSE_BLOCK:
+            {
+                const Matrix<T>& B = *block.dense;
+                for( Int t=0; t<B.Width(); ++t )
+                    for( Int s=0; s<B.Height(); ++s )
+                        if( B(s,t) != T(0) )
+                            queueEntry( s, t, B(s,t) );
+                break;
+            }
+            case SPARSE_BLOCK:
+            case COMPOSITE_BLOCK:
+            {
+                const SparseMatrix<T>& B =
+                  ( block.type == SPARSE_BLOCK ? *block.sparse
+                                               : compositeBlocks[index] );
+                const Int numBlockEntries = B.NumEntries();
+                for( Int e=0; e<numBlockEntries; ++e )
+                    queueEntry( B.Row(e), B.Col(e), B.Value(e) );
+                break;
+            }
+            case DIAGONAL_BLOCK:
+            {
+                const Matrix<T>& d = *block.dense;
+                for( Int k=0; k<d.Height(); ++k )
+                    A.QueueUpdate( rowOff+k, colOff+k, alpha*d(k) );
+                break;
+            }
+            case IDENTITY_BLOCK:
+                for( Int k=0; k<BlockHeight(i); ++k )
+                    A.QueueUpdate( rowOff+k, colOff+k, alpha );
+                break;
+            case ZERO_BLOCK:
+                break;
+            }
+            rowOff += BlockHeight(i);
+        }
+        colOff += BlockWidth(j);
+    }
+    A.ProcessQueues();
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const CompositeMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                     Matrix<T>& Y )
+{
+    DEBUG_CSE
+    A.Apply( orientation, alpha, X, beta, Y );
+}
+
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const CompositeMatrix<T>& A, const Matrix<T>& x,
+  T beta,                                     Matrix<T>& y )
+{
+    DEBUG_CSE
+    if( x.Width() != 1 )
+        LogicError("x must be a column vector");
+    A.Apply( orientation, alpha, x, beta, y );
+}
+
+#define PROTO(T) \
+  template class CompositeMatrix<T>; \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const CompositeMatrix<T>& A, const Matrix<T>& X, \
+    T beta,                                     Matrix<T>& Y ); \
+  template void Gemv \
+  ( Orientation orientation, \
+    T alpha, const CompositeMatrix<T>& A, const Matrix<T>& x, \
+    T beta,                                     Matrix<T>& y );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -13,6 +13,7 @@
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/25D.hpp"
 
 namespace El {
 
@@ -24,6 +25,7 @@ void Gemm
   T beta,        Matrix<T>& C )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Gemm");
     if( orientA == NORMAL && orientB == NORMAL )
     {
         if( A.Height() != C.Height() ||
@@ -86,16 +88,29 @@ void Gemm
     Gemm( orientA, orientB, alpha, A, B, T(0), C );
 }
 
+namespace {
+Int gemm25DLayers = 0;
+}
+
+void SetGemm25DLayers( Int numLayers )
+{
+    if( numLayers < 0 )
+        LogicError("The number of layers must be non-negative");
+    gemm25DLayers = numLayers;
+}
+Int Gemm25DLayers() { return gemm25DLayers; }
+
+namespace gemm {
+
 template<typename T>
-void Gemm
+void SUMMA
 ( Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A,
            const AbstractDistMatrix<T>& B,
-  T beta,        AbstractDistMatrix<T>& C, 
+                 AbstractDistMatrix<T>& C,
   GemmAlgorithm alg )
 {
     DEBUG_CSE
-    C *= beta;
     if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
@@ -117,6 +132,48 @@ void Gemm
     }
 }
 
+} // namespace gemm
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C, 
+  GemmAlgorithm alg )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("Gemm");
+    C *= beta;
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int sumDim = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const Grid& g = C.Grid();
+    const Int tuneSize = Max( Max(m,n), sumDim );
+    TunedBlocksizeScope scope( TUNE_GEMM, tuneSize, g.Height(), g.Width() );
+    if( alg == GEMM_DEFAULT )
+    {
+        const Int variant =
+          TunedVariant( TUNE_GEMM, tuneSize, g.Height(), g.Width() );
+        if( variant > GEMM_DEFAULT && variant <= GEMM_25D )
+            alg = static_cast<GemmAlgorithm>(variant);
+    }
+    Int numLayers = 1;
+    if( alg == GEMM_25D )
+        numLayers =
+          ( Gemm25DLayers() > 0 ? Gemm25DLayers() :
+            gemm::DefaultNumLayers(C.Grid().Size()) );
+    else if( alg == GEMM_DEFAULT )
+        numLayers = gemm::Choose25DLayers<T>( m, n, sumDim, C.Grid() );
+
+    if( numLayers > 1 )
+        gemm::SUMMA25D( orientA, orientB, alpha, A, B, C, numLayers );
+    else
+        gemm::SUMMA
+        ( orientA, orientB, alpha, A, B, C,
+          alg == GEMM_25D ? GEMM_DEFAULT : alg );
+}
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -258,6 +315,83 @@ void LocalGemm
     LocalGemm( orientA, orientB, alpha, A, B, T(0), C );
 }
 
+template<typename T>
+void Gemm
+( T alpha, const TransposedView<Matrix<T>>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    DEBUG_CSE
+    Gemm( A.Orientation(), NORMAL, alpha, A.Parent(), B, beta, C );
+}
+
+template<typename T>
+void Gemm
+( T alpha, const Matrix<T>& A,
+           const TransposedView<Matrix<T>>& B,
+  T beta,        Matrix<T>& C )
+{
+    DEBUG_CSE
+    Gemm( NORMAL, B.Orientation(), alpha, A, B.Parent(), beta, C );
+}
+
+template<typename T>
+void Gemm
+( T alpha, const TransposedView<Matrix<T>>& A,
+           const TransposedView<Matrix<T>>& B,
+  T beta,        Matrix<T>& C )
+{
+    DEBUG_CSE
+    Gemm
+    ( A.Orientation(), B.Orientation(),
+      alpha, A.Parent(), B.Parent(), beta, C );
+}
+
+template<typename T>
+void Gemm
+( T alpha, const TransposedView<AbstractDistMatrix<T>>& A,
+           const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg )
+{
+    DEBUG_CSE
+    Gemm( A.Orientation(), NORMAL, alpha, A.Parent(), B, beta, C, alg );
+}
+
+template<typename T>
+void Gemm
+( T alpha, const AbstractDistMatrix<T>& A,
+           const TransposedView<AbstractDistMatrix<T>>& B,
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg )
+{
+    DEBUG_CSE
+    Gemm( NORMAL, B.Orientation(), alpha, A, B.Parent(), beta, C, alg );
+}
+
+template<typename T>
+void Gemm
+( T alpha, const TransposedView<AbstractDistMatrix<T>>& A,
+           const TransposedView<AbstractDistMatrix<T>>& B,
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg )
+{
+    DEBUG_CSE
+    Gemm
+    ( A.Orientation(), B.Orientation(),
+      alpha, A.Parent(), B.Parent(), beta, C, alg );
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrixBatch<T>& A, const DistMatrixBatch<T>& B,
+  T beta,        DistMatrixBatch<T>& C, GemmAlgorithm alg )
+{
+    DEBUG_CSE
+    if( !A.SharesLayout(B) || !A.SharesLayout(C) )
+        LogicError("Batched Gemm requires batches with a common layout");
+    for( const Int k : C.LocalIndices() )
+        Gemm( orientA, orientB, alpha, A(k), B(k), beta, C(k), alg );
+}
+
 #define PROTO(T) \
   template void Gemm \
   ( Orientation orientA, Orientation orientB, \
@@ -288,7 +422,36 @@ void LocalGemm
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
-                   AbstractDistMatrix<T>& C );
+                   AbstractDistMatrix<T>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const DistMatrixBatch<T>& A, \
+             const DistMatrixBatch<T>& B, \
+    T beta,        DistMatrixBatch<T>& C, GemmAlgorithm alg ); \
+  template void Gemm \
+  ( T alpha, const TransposedView<Matrix<T>>& A, \
+             const Matrix<T>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void Gemm \
+  ( T alpha, const Matrix<T>& A, \
+             const TransposedView<Matrix<T>>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void Gemm \
+  ( T alpha, const TransposedView<Matrix<T>>& A, \
+             const TransposedView<Matrix<T>>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void Gemm \
+  ( T alpha, const TransposedView<AbstractDistMatrix<T>>& A, \
+             const AbstractDistMatrix<T>& B, \
+    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+  template void Gemm \
+  ( T alpha, const AbstractDistMatrix<T>& A, \
+             const TransposedView<AbstractDistMatrix<T>>& B, \
+    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+  template void Gemm \
+  ( T alpha, const TransposedView<AbstractDistMatrix<T>>& A, \
+             const TransposedView<AbstractDistMatrix<T>>& B, \
+    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
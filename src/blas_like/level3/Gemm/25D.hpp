@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The two-dimensional dispatch (defined in Gemm.cpp)
+template<typename T>
+void SUMMA
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+                 AbstractDistMatrix<T>& C,
+  GemmAlgorithm alg );
+
+// The largest divisor of p which is at most its cube root
+inline Int DefaultNumLayers( int p )
+{
+    Int numLayers = 1;
+    for( Int d=2; d*d*d<=p; ++d )
+        if( p % d == 0 )
+            numLayers = d;
+    return numLayers;
+}
+
+// The number of layers GEMM_DEFAULT should use (one if the 2D algorithms
+// should be used instead). Replication is only chosen when each layer would
+// still perform a substantial SUMMA and the extra memory fits comfortably
+// within the memory available to every process. Only the owning processes
+// of the grid communicate; the others fall back to the 2D dispatch.
+template<typename T>
+Int Choose25DLayers( Int m, Int n, Int sumDim, const Grid& g )
+{
+    DEBUG_CSE
+    if( !g.InGrid() )
+        return 1;
+    const int p = g.Size();
+    const Int numLayers =
+      ( Gemm25DLayers() > 0 ? Gemm25DLayers() : DefaultNumLayers(p) );
+    if( numLayers <= 1 || p % numLayers != 0 )
+        return 1;
+    const double layerDim = Sqrt( double(p/numLayers) );
+    const double bsize = Blocksize();
+    if( Min(m,n) < 4*bsize*layerDim || sumDim < numLayers*bsize*layerDim )
+        return 1;
+
+    // Each process stores its portion of the slices of A and B, its layer's
+    // contribution to C, and its portion of the sum over the layers. The
+    // node's memory is only probed once per process.
+    static const double nodeAvailable = double(NodeAvailableMemory());
+    const double extraBytes =
+      sizeof(T)*(double(m)*sumDim+double(sumDim)*n+2.*numLayers*m*n)/p;
+    const double available = nodeAvailable / Max(g.NodeSize(),1);
+    const double minAvailable =
+      mpi::AllReduce( available, mpi::MIN, g.VCComm() );
+    return ( extraBytes <= minAvailable/2 ? numLayers : 1 );
+}
+
+// 2.5D matrix multiplication: the processes are split into 'numLayers'
+// identically-shaped layers, each of which computes the contribution of its
+// slice of the summation dimension with a 2D algorithm before the layers'
+// contributions are summed. Relative to the 2D algorithms over all of the
+// processes, this reduces the bandwidth by a factor of sqrt(numLayers) at
+// the cost of numLayers times as much memory for C.
+//
+// All of the communication is over the owning processes of the grid (the
+// matrices are attached to Grid::OwnerGrid), and the layer grids are cached
+// with the grid, so that repeated products over (sub)grids with extra
+// viewing processes neither deadlock nor create new communicators.
+template<typename T>
+void SUMMA25D
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& APre,
+           const AbstractDistMatrix<T>& BPre,
+                 AbstractDistMatrix<T>& CPre,
+  Int numLayers )
+{
+    DEBUG_CSE
+    const Grid& g = CPre.Grid();
+    const int p = g.Size();
+    if( numLayers < 1 || p % numLayers != 0 )
+        LogicError
+        ("The number of layers, ",numLayers,", must divide the number of "
+         "processes, ",p);
+    if( numLayers == 1 )
+    {
+        SUMMA( orientA, orientB, alpha, APre, BPre, CPre, GEMM_DEFAULT );
+        return;
+    }
+    const int layerSize = p / numLayers;
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int sumDim = ( orientA == NORMAL ? APre.Width() : APre.Height() );
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    if( !g.InGrid() )
+        return;
+    auto& APrx = AProx.GetLocked();
+    auto& BPrx = BProx.GetLocked();
+    auto& CPrx = CProx.Get();
+
+    // Attach the local data to the owner grid
+    const Grid& gOwn = g.OwnerGrid();
+    DistMatrix<T> A(gOwn), B(gOwn), C(gOwn);
+    A.LockedAttach
+    ( APrx.Height(), APrx.Width(), gOwn, APrx.ColAlign(), APrx.RowAlign(),
+      APrx.LockedBuffer(), APrx.LDim() );
+    B.LockedAttach
+    ( BPrx.Height(), BPrx.Width(), gOwn, BPrx.ColAlign(), BPrx.RowAlign(),
+      BPrx.LockedBuffer(), BPrx.LDim() );
+    C.Attach
+    ( CPrx.Height(), CPrx.Width(), gOwn, CPrx.ColAlign(), CPrx.RowAlign(),
+      CPrx.Buffer(), CPrx.LDim() );
+
+    // The layers are formed from consecutive ranks of the VC ordering. Since
+    // each layer has the same shape, corresponding processes of the layers
+    // own the same entries of their contributions to C.
+    const auto& layerGrids = g.LayerGrids( numLayers );
+    const int layer = gOwn.VCRank() / layerSize;
+
+    // Move each layer's slices of A and B onto the layer
+    unique_ptr<DistMatrix<T>> ALayer, BLayer;
+    for( int l=0; l<numLayers; ++l )
+    {
+        const Range<Int> K( (l*sumDim)/numLayers, ((l+1)*sumDim)/numLayers );
+        DistMatrix<T> ASlice(*layerGrids[l]), BSlice(*layerGrids[l]);
+        if( orientA == NORMAL )
+            ASlice = A( ALL, K );
+        else
+            ASlice = A( K, ALL );
+        if( orientB == NORMAL )
+            BSlice = B( K, ALL );
+        else
+            BSlice = B( ALL, K );
+        if( l == layer )
+        {
+            ALayer.reset( new DistMatrix<T>( std::move(ASlice) ) );
+            BLayer.reset( new DistMatrix<T>( std::move(BSlice) ) );
+        }
+    }
+
+    // Compute each layer's contribution and sum them onto the first layer
+    DistMatrix<T> CFirst(*layerGrids[0]);
+    CFirst.Resize( m, n );
+    unique_ptr<DistMatrix<T>> CRest;
+    if( layer > 0 )
+        CRest.reset( new DistMatrix<T>(*layerGrids[layer]) );
+    DistMatrix<T>& CLayer = ( layer > 0 ? *CRest : CFirst );
+    CLayer.Resize( m, n );
+    Zero( CLayer );
+    SUMMA( orientA, orientB, alpha, *ALayer, *BLayer, CLayer, GEMM_DEFAULT );
+    {
+        const Int localHeight = CLayer.LocalHeight();
+        const Int localWidth = CLayer.LocalWidth();
+        vector<T> sumBuf( localHeight*localWidth );
+        copy::util::InterleaveMatrix
+        ( localHeight, localWidth,
+          CLayer.LockedBuffer(), 1, CLayer.LDim(),
+          sumBuf.data(),         1, localHeight );
+        mpi::Reduce
+        ( sumBuf.data(), localHeight*localWidth, 0,
+          g.LayerDepthComm(numLayers) );
+        if( layer == 0 )
+            copy::util::InterleaveMatrix
+            ( localHeight, localWidth,
+              sumBuf.data(),  1, localHeight,
+              CLayer.Buffer(), 1, CLayer.LDim() );
+    }
+    ALayer.reset();
+    BLayer.reset();
+    CRest.reset();
+
+    // C += (the sum of the contributions)
+    DistMatrix<T> CSum(gOwn);
+    CSum.AlignWith( C );
+    CSum = CFirst;
+    Axpy( T(1), CSum, C );
+}
+
+} // namespace gemm
+} // namespace El
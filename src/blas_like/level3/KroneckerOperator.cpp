@@ -0,0 +1,384 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace kron {
+
+// For X = [X_0, ..., X_{k-1}] and Y = [Y_0, ..., Y_{k-1}], form
+//
+//   Y_t := op(B) X_t op(A)^T,
+//
+// or, if sum=true, Y_t := op(B) X_t + X_t op(A)^T. The product op(B) X is
+// formed for all of the blocks at once. Since
+//
+//   conj(B^H X conj(A)) = B^T conj(X) A,
+//
+// the adjoint is applied as the transpose to conj(X), and so X is conjugated
+// in place (and then restored).
+template<typename F,class MatType>
+void ApplyMatricized
+( bool sum,
+  Orientation orientation,
+  Int numBlocks,
+  const MatType& A,
+  const MatType& B,
+        MatType& X,
+        MatType& Y,
+        MatType& Z )
+{
+    DEBUG_CSE
+    if( numBlocks == 0 )
+        return;
+    const Int nA = X.Width() / numBlocks;
+    const Int mA = Y.Width() / numBlocks;
+    const bool adjoint = ( orientation == ADJOINT );
+    const Orientation orientB = ( adjoint ? TRANSPOSE : orientation );
+    const Orientation orientAT = ( orientation == NORMAL ? TRANSPOSE : NORMAL );
+    if( adjoint )
+        Conjugate( X );
+
+    if( sum )
+    {
+        Gemm( orientB, NORMAL, F(1), B, X, F(0), Y );
+        for( Int t=0; t<numBlocks; ++t )
+        {
+            auto Xt = X( ALL, IR(t*nA,(t+1)*nA) );
+            auto Yt = Y( ALL, IR(t*mA,(t+1)*mA) );
+            Gemm( NORMAL, orientAT, F(1), Xt, A, F(1), Yt );
+        }
+    }
+    else
+    {
+        Gemm( orientB, NORMAL, F(1), B, X, Z );
+        for( Int t=0; t<numBlocks; ++t )
+        {
+            auto Zt = Z( ALL, IR(t*nA,(t+1)*nA) );
+            auto Yt = Y( ALL, IR(t*mA,(t+1)*mA) );
+            Gemm( NORMAL, orientAT, F(1), Zt, A, F(0), Yt );
+        }
+    }
+
+    if( adjoint )
+    {
+        Conjugate( X );
+        Conjugate( Y );
+    }
+}
+
+// The dimensions of op(A) and op(B)
+template<class MatType>
+void OpDims
+( Orientation orientation,
+  const MatType& A,
+  const MatType& B,
+  Int& mA, Int& nA, Int& mB, Int& nB )
+{
+    const bool normal = ( orientation == NORMAL );
+    mA = ( normal ? A.Height() : A.Width() );
+    nA = ( normal ? A.Width() : A.Height() );
+    mB = ( normal ? B.Height() : B.Width() );
+    nB = ( normal ? B.Width() : B.Height() );
+}
+
+template<typename F>
+void Apply
+( bool sum,
+  Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& X,
+        Matrix<F>& Y )
+{
+    DEBUG_CSE
+    Int mA, nA, mB, nB;
+    OpDims( orientation, A, B, mA, nA, mB, nB );
+    if( X.Height() != nA*nB )
+        LogicError
+        ("X was ",X.Height()," x ",X.Width()," but the operator was ",
+         mA*mB," x ",nA*nB);
+    const Int numRHS = X.Width();
+
+    // Copy each column of X into its matricized form
+    Matrix<F> XMat( nB, numRHS*nA ), YMat( mB, numRHS*mA ), Z, col;
+    for( Int t=0; t<numRHS; ++t )
+    {
+        col.LockedAttach( nB, nA, X.LockedBuffer(0,t), nB );
+        auto Xt = XMat( ALL, IR(t*nA,(t+1)*nA) );
+        Xt = col;
+    }
+
+    ApplyMatricized<F>( sum, orientation, numRHS, A, B, XMat, YMat, Z );
+
+    Y.Resize( mA*mB, numRHS );
+    for( Int t=0; t<numRHS; ++t )
+    {
+        col.Attach( mB, mA, Y.Buffer(0,t), mB );
+        col = YMat( ALL, IR(t*mA,(t+1)*mA) );
+    }
+}
+
+template<typename F>
+void Apply
+( bool sum,
+  Orientation orientation,
+  const DistMatrix<F>& A,
+  const DistMatrix<F>& B,
+  const DistMultiVec<F>& X,
+        DistMultiVec<F>& Y )
+{
+    DEBUG_CSE
+    const Grid& g = A.Grid();
+    if( mpi::Size(X.Comm()) != g.Size() || mpi::Size(Y.Comm()) != g.Size() )
+        LogicError("The vectors must be spread over the grid of the factors");
+    Int mA, nA, mB, nB;
+    OpDims( orientation, A, B, mA, nA, mB, nB );
+    if( X.Height() != nA*nB )
+        LogicError
+        ("X was ",X.Height()," x ",X.Width()," but the operator was ",
+         mA*mB," x ",nA*nB);
+    const Int numRHS = X.Width();
+
+    // Redistribute the columns of X into their matricized forms
+    DistMatrix<F> XMat(g), YMat(g), Z(g);
+    XMat.Resize( nB, numRHS*nA );
+    Zero( XMat );
+    const Int localHeight = X.LocalHeight();
+    XMat.Reserve( localHeight*numRHS );
+    for( Int t=0; t<numRHS; ++t )
+    {
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = X.GlobalRow(iLoc);
+            XMat.QueueUpdate( i % nB, t*nA + i/nB, X.GetLocal(iLoc,t) );
+        }
+    }
+    XMat.ProcessQueues();
+
+    YMat.Resize( mB, numRHS*mA );
+    ApplyMatricized<F>( sum, orientation, numRHS, A, B, XMat, YMat, Z );
+
+    // Redistribute the matricized forms back into the columns of Y
+    Y.Resize( mA*mB, numRHS );
+    Zero( Y );
+    const Int YMatLocalHeight = YMat.LocalHeight();
+    const Int YMatLocalWidth = YMat.LocalWidth();
+    Y.Reserve( YMatLocalHeight*YMatLocalWidth );
+    for( Int jLoc=0; jLoc<YMatLocalWidth; ++jLoc )
+    {
+        const Int j = YMat.GlobalCol(jLoc);
+        const Int t = j / mA;
+        const Int jA = j % mA;
+        for( Int iLoc=0; iLoc<YMatLocalHeight; ++iLoc )
+        {
+            const Int i = YMat.GlobalRow(iLoc);
+            Y.QueueUpdate( i+jA*mB, t, YMat.GetLocal(iLoc,jLoc) );
+        }
+    }
+    Y.ProcessQueues();
+}
+
+template<typename F>
+void ApplyMatricized
+( bool sum,
+  Orientation orientation,
+  const DistMatrix<F>& A,
+  const DistMatrix<F>& B,
+  const DistMatrix<F>& X,
+        DistMatrix<F>& Y )
+{
+    DEBUG_CSE
+    Int mA, nA, mB, nB;
+    OpDims( orientation, A, B, mA, nA, mB, nB );
+    if( X.Height() != nB || X.Width() != nA )
+        LogicError
+        ("X was ",X.Height()," x ",X.Width()," but should have been ",
+         nB," x ",nA);
+    DistMatrix<F> XCopy( X ), Z( A.Grid() );
+    Y.Resize( mB, mA );
+    ApplyMatricized<F>( sum, orientation, Int(1), A, B, XCopy, Y, Z );
+}
+
+template<class MatType>
+void CheckSquare( const MatType& A, const MatType& B )
+{
+    if( A.Height() != A.Width() || B.Height() != B.Width() )
+        LogicError("The factors of a Kronecker sum must be square");
+}
+
+} // namespace kron
+
+// KroneckerOperator
+// =================
+
+template<typename F>
+KroneckerOperator<F>::KroneckerOperator
+( const Matrix<F>& A, const Matrix<F>& B )
+: A_(A), B_(B)
+{ }
+
+template<typename F>
+Int KroneckerOperator<F>::Height() const EL_NO_EXCEPT
+{ return A_.Height()*B_.Height(); }
+
+template<typename F>
+Int KroneckerOperator<F>::Width() const EL_NO_EXCEPT
+{ return A_.Width()*B_.Width(); }
+
+template<typename F>
+void KroneckerOperator<F>::Apply
+( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const
+{
+    DEBUG_CSE
+    kron::Apply( false, orientation, A_, B_, X, Y );
+}
+
+template<typename F>
+void KroneckerOperator<F>::operator()
+( const Matrix<F>& X, Matrix<F>& Y ) const
+{ Apply( NORMAL, X, Y ); }
+
+// KroneckerSumOperator
+// ====================
+
+template<typename F>
+KroneckerSumOperator<F>::KroneckerSumOperator
+( const Matrix<F>& A, const Matrix<F>& B )
+: A_(A), B_(B)
+{ kron::CheckSquare( A, B ); }
+
+template<typename F>
+Int KroneckerSumOperator<F>::Height() const EL_NO_EXCEPT
+{ return A_.Height()*B_.Height(); }
+
+template<typename F>
+Int KroneckerSumOperator<F>::Width() const EL_NO_EXCEPT
+{ return Height(); }
+
+template<typename F>
+void KroneckerSumOperator<F>::Apply
+( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const
+{
+    DEBUG_CSE
+    kron::Apply( true, orientation, A_, B_, X, Y );
+}
+
+template<typename F>
+void KroneckerSumOperator<F>::operator()
+( const Matrix<F>& X, Matrix<F>& Y ) const
+{ Apply( NORMAL, X, Y ); }
+
+// DistKroneckerOperator
+// =====================
+
+template<typename F>
+DistKroneckerOperator<F>::DistKroneckerOperator
+( const DistMatrix<F>& A, const DistMatrix<F>& B )
+: A_(A), B_(B)
+{
+    if( A.Grid() != B.Grid() )
+        LogicError("The factors must be distributed over the same grid");
+}
+
+template<typename F>
+Int DistKroneckerOperator<F>::Height() const EL_NO_EXCEPT
+{ return A_.Height()*B_.Height(); }
+
+template<typename F>
+Int DistKroneckerOperator<F>::Width() const EL_NO_EXCEPT
+{ return A_.Width()*B_.Width(); }
+
+template<typename F>
+void DistKroneckerOperator<F>::Apply
+( Orientation orientation,
+  const DistMultiVec<F>& X,
+        DistMultiVec<F>& Y ) const
+{
+    DEBUG_CSE
+    kron::Apply( false, orientation, A_, B_, X, Y );
+}
+
+template<typename F>
+void DistKroneckerOperator<F>::operator()
+( const DistMultiVec<F>& X, DistMultiVec<F>& Y ) const
+{ Apply( NORMAL, X, Y ); }
+
+template<typename F>
+void DistKroneckerOperator<F>::ApplyMatricized
+( Orientation orientation,
+  const DistMatrix<F>& X,
+        DistMatrix<F>& Y ) const
+{
+    DEBUG_CSE
+    kron::ApplyMatricized( false, orientation, A_, B_, X, Y );
+}
+
+// DistKroneckerSumOperator
+// ========================
+
+template<typename F>
+DistKroneckerSumOperator<F>::DistKroneckerSumOperator
+( const DistMatrix<F>& A, const DistMatrix<F>& B )
+: A_(A), B_(B)
+{
+    kron::CheckSquare( A, B );
+    if( A.Grid() != B.Grid() )
+        LogicError("The factors must be distributed over the same grid");
+}
+
+template<typename F>
+Int DistKroneckerSumOperator<F>::Height() const EL_NO_EXCEPT
+{ return A_.Height()*B_.Height(); }
+
+template<typename F>
+Int DistKroneckerSumOperator<F>::Width() const EL_NO_EXCEPT
+{ return Height(); }
+
+template<typename F>
+void DistKroneckerSumOperator<F>::Apply
+( Orientation orientation,
+  const DistMultiVec<F>& X,
+        DistMultiVec<F>& Y ) const
+{
+    DEBUG_CSE
+    kron::Apply( true, orientation, A_, B_, X, Y );
+}
+
+template<typename F>
+void DistKroneckerSumOperator<F>::operator()
+( const DistMultiVec<F>& X, DistMultiVec<F>& Y ) const
+{ Apply( NORMAL, X, Y ); }
+
+template<typename F>
+void DistKroneckerSumOperator<F>::ApplyMatricized
+( Orientation orientation,
+  const DistMatrix<F>& X,
+        DistMatrix<F>& Y ) const
+{
+    DEBUG_CSE
+    kron::ApplyMatricized( true, orientation, A_, B_, X, Y );
+}
+
+#define PROTO(F) \
+  template class KroneckerOperator<F>; \
+  template class KroneckerSumOperator<F>; \
+  template class DistKroneckerOperator<F>; \
+  template class DistKroneckerSumOperator<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -10,6 +10,7 @@
 
 #include "./MultiShiftTrsm/LUN.hpp"
 #include "./MultiShiftTrsm/LUT.hpp"
+#include "./MultiShiftTrsm/Subgrid.hpp"
 
 namespace El {
 
@@ -44,13 +45,29 @@ void MultiShiftTrsm
   F alpha,
   const AbstractDistMatrix<F>& U,
   const AbstractDistMatrix<F>& shifts, 
-        AbstractDistMatrix<F>& X )
+        AbstractDistMatrix<F>& X,
+  int shiftGroupSize )
 {
     DEBUG_CSE
     X *= alpha;
     if( side == LEFT && uplo == UPPER )
     {
-        if( orientation == NORMAL )
+        if( mstrsm::UseSubgrids( U.Grid(), shiftGroupSize ) )
+        {
+            auto solve =
+              [&]( const AbstractDistMatrix<F>& USub,
+                   const AbstractDistMatrix<F>& shiftsSub,
+                         AbstractDistMatrix<F>& XSub,
+                         AbstractDistMatrix<F>& )
+              {
+                  MultiShiftTrsm
+                  ( side, uplo, orientation, F(1), USub, shiftsSub, XSub );
+              };
+            mstrsm::SubgridSolve
+            ( U, shifts, X, (AbstractDistMatrix<F>*)nullptr, shiftGroupSize,
+              solve );
+        }
+        else if( orientation == NORMAL )
             mstrsm::LUN( U, shifts, X );
         else
             mstrsm::LUT( orientation, U, shifts, X );
@@ -75,7 +92,8 @@ void MultiShiftTrsm
     F alpha, \
     const AbstractDistMatrix<F>& U, \
     const AbstractDistMatrix<F>& shifts, \
-          AbstractDistMatrix<F>& X );
+          AbstractDistMatrix<F>& X, \
+    int shiftGroupSize );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MSTRSM_SUBGRID_HPP
+#define EL_MSTRSM_SUBGRID_HPP
+
+namespace El {
+namespace mstrsm {
+
+inline bool UseSubgrids( const Grid& g, int shiftGroupSize )
+{ return shiftGroupSize > 0 && shiftGroupSize < g.Size(); }
+
+// For modest matrices, the per-shift solves over the full grid are
+// latency-bound, so the shifts (and the corresponding columns of X) are
+// instead split into one contiguous batch per sub-grid of 'groupSize'
+// processes. Each sub-grid receives its own copy of U and calls
+//
+//   solve( USub, shiftsSub, XSub, scalesSub )
+//
+// on its batch, after which the solutions (and, if 'scalesPre' is non-null,
+// the per-shift scalings) are redistributed back to the original grid.
+template<typename F,typename SolveFunc>
+void SubgridSolve
+( const AbstractDistMatrix<F>& UPre,
+  const AbstractDistMatrix<F>& shiftsPre,
+        AbstractDistMatrix<F>& XPre,
+        AbstractDistMatrix<F>* scalesPre,
+  int groupSize,
+  SolveFunc solve )
+{
+    DEBUG_CSE
+    const Grid& g = UPre.Grid();
+    const int numGroups = g.Size() / groupSize;
+    const Int numShifts = XPre.Width();
+    if( shiftsPre.Height() != numShifts )
+        LogicError("Incompatible number of shifts");
+
+    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
+    DistMatrixReadProxy<F,F,MC,MR> shiftsProx( shiftsPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& U = UProx.GetLocked();
+    auto& shifts = shiftsProx.GetLocked();
+    auto& X = XProx.Get();
+
+    const Int batchSize = (numShifts+numGroups-1) / numGroups;
+    auto batchInd =
+      [&]( Int k )
+      {
+          const Int off = Min( k*batchSize, numShifts );
+          return IR( off, Min(off+batchSize,numShifts) );
+      };
+
+    DistMatrixBatch<Int> layout( g, numGroups, groupSize );
+    DistMatrixBatch<F> UBatch( layout ), shiftsBatch( layout ),
+                       XBatch( layout ), scalesBatch( layout );
+    for( Int k=0; k<numGroups; ++k )
+    {
+        const auto ind = batchInd( k );
+        UBatch.Scatter( k, U );
+        shiftsBatch.Scatter( k, shifts(ind,ALL) );
+        XBatch.Scatter( k, X(ALL,ind) );
+    }
+
+    for( Int k : layout.LocalIndices() )
+        if( XBatch(k).Width() > 0 )
+            solve( UBatch(k), shiftsBatch(k), XBatch(k), scalesBatch(k) );
+
+    for( Int k=0; k<numGroups; ++k )
+    {
+        auto XSub = X( ALL, batchInd(k) );
+        XBatch.Gather( k, XSub );
+    }
+    if( scalesPre != nullptr )
+    {
+        DistMatrixWriteProxy<F,F,MC,MR> scalesProx( *scalesPre );
+        auto& scales = scalesProx.Get();
+        scales.Resize( numShifts, 1 );
+        for( Int k=0; k<numGroups; ++k )
+        {
+            auto scalesSub = scales( batchInd(k), ALL );
+            // Empty batches were never solved and so have no scalings
+            if( scalesSub.Height() > 0 )
+                scalesBatch.Gather( k, scalesSub );
+        }
+    }
+}
+
+} // namespace mstrsm
+} // namespace El
+
+#endif // ifndef EL_MSTRSM_SUBGRID_HPP
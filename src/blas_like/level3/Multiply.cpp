@@ -14,6 +14,155 @@
 namespace El {
 
 namespace {
+
+// Local sparse products with fewer nonzeros than this are not worth threading
+const Int SPARSE_PARALLEL_CUTOFF = 10000;
+
+// Split the rows of a CSR matrix into contiguous chunks, one per thread, which
+// each contain roughly the same number of nonzeros
+void PartitionRowsByNonzeros
+( Int m, const Int* rowOffsets, vector<Int>& rowBounds )
+{
+    DEBUG_CSE
+    const Int numNonzeros = ( m > 0 ? rowOffsets[m] : 0 );
+    Int numChunks = 1;
+#ifdef EL_HYBRID
+    if( numNonzeros >= SPARSE_PARALLEL_CUTOFF )
+        numChunks = Min( Int(omp_get_max_threads()), m );
+#endif
+    rowBounds.resize( numChunks+1 );
+    rowBounds[0] = 0;
+    for( Int chunk=1; chunk<numChunks; ++chunk )
+    {
+        const Int target = (chunk*numNonzeros) / numChunks;
+        const Int bound =
+          std::lower_bound( rowOffsets, rowOffsets+m, target ) - rowOffsets;
+        rowBounds[chunk] = Max( bound, rowBounds[chunk-1] );
+    }
+    rowBounds[numChunks] = m;
+}
+
+// Y(i,k) := alpha sum_e A(i,e) X(e,k) + beta Y(i,k) over rows [iBeg,iEnd),
+// where the entries of X and Y are addressed through row and column strides
+// so that both column-major and interleaved right-hand sides are supported.
+// A null 'values' pointer signifies that all of the nonzeros are one. If
+// 'rows' is non-null, the rows rows[iBeg:iEnd) are instead updated. The
+// column indices may be either global (Int) or compressed (LocalInt).
+template<typename T,typename ColInt>
+void MultiplyCSRRows
+( Int iBeg, Int iEnd, const Int* rows, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const ColInt* colIndices,
+  const T*   values,
+  const T*   X, Int XRowStride, Int XColStride,
+  T beta,
+        T*   Y, Int YRowStride, Int YColStride,
+        T*   sums )
+{
+    for( Int r=iBeg; r<iEnd; ++r )
+    {
+        const Int i = ( rows == nullptr ? r : rows[r] );
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        if( numRHS > 1 && XColStride == 1 )
+        {
+            // Each row of X is contiguous, so traverse the row of A only once
+            for( Int k=0; k<numRHS; ++k )
+                sums[k] = 0;
+            for( Int e=eStart; e<eStop; ++e )
+            {
+                const T* XRow = &X[colIndices[e]*XRowStride];
+                const T value = ( values == nullptr ? T(1) : values[e] );
+                for( Int k=0; k<numRHS; ++k )
+                    sums[k] += value*XRow[k];
+            }
+        }
+        else
+        {
+            for( Int k=0; k<numRHS; ++k )
+            {
+                const T* XCol = &X[k*XColStride];
+                T sum = 0;
+                if( values == nullptr )
+                {
+                    for( Int e=eStart; e<eStop; ++e )
+                        sum += XCol[colIndices[e]*XRowStride];
+                }
+                else
+                {
+                    for( Int e=eStart; e<eStop; ++e )
+                        sum += values[e]*XCol[colIndices[e]*XRowStride];
+                }
+                sums[k] = sum;
+            }
+        }
+        for( Int k=0; k<numRHS; ++k )
+        {
+            T& upsilon = Y[i*YRowStride+k*YColStride];
+            upsilon = alpha*sums[k] + beta*upsilon;
+        }
+    }
+}
+
+// Y := alpha A X + beta Y, where the rows of A are split between the threads
+// so that each is assigned roughly the same number of nonzeros
+template<typename T,typename ColInt>
+void MultiplyCSRNormal
+( Int m, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const ColInt* colIndices,
+  const T*   values,
+  const T*   X, Int XRowStride, Int XColStride,
+  T beta,
+        T*   Y, Int YRowStride, Int YColStride )
+{
+    DEBUG_CSE
+    vector<Int> rowBounds;
+    PartitionRowsByNonzeros( m, rowOffsets, rowBounds );
+    const Int numChunks = rowBounds.size()-1;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        vector<T> sums( numRHS );
+        MultiplyCSRRows
+        ( rowBounds[chunk], rowBounds[chunk+1], nullptr, numRHS,
+          alpha, rowOffsets, colIndices, values,
+          X, XRowStride, XColStride,
+          beta, Y, YRowStride, YColStride, sums.data() );
+    }
+}
+
+// The analogue of MultiplyCSRNormal over the rows rows[0:numRows), whose
+// numbers of nonzeros have the prefix sums 'rowEdgeOffs'
+template<typename T,typename ColInt>
+void MultiplyCSRNormalRows
+( Int numRows, const Int* rows, const Int* rowEdgeOffs, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const ColInt* colIndices,
+  const T*   values,
+  const T*   X, Int XRowStride, Int XColStride,
+  T beta,
+        T*   Y, Int YRowStride, Int YColStride )
+{
+    DEBUG_CSE
+    vector<Int> rowBounds;
+    PartitionRowsByNonzeros( numRows, rowEdgeOffs, rowBounds );
+    const Int numChunks = rowBounds.size()-1;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        vector<T> sums( numRHS );
+        MultiplyCSRRows
+        ( rowBounds[chunk], rowBounds[chunk+1], rows, numRHS,
+          alpha, rowOffsets, colIndices, values,
+          X, XRowStride, XColStride,
+          beta, Y, YRowStride, YColStride, sums.data() );
+    }
+}
+
 /**
  * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
  */
@@ -31,29 +180,22 @@ void MultiplyCSR
     DEBUG_CSE
     if( orientation == NORMAL )
     {
+        MultiplyCSRNormal
+        ( m, 1, alpha, rowOffsets, colIndices,
+          static_cast<const T*>(nullptr), x, 1, 1, beta, y, 1, 1 );
+    }
+    else
+    {
+        for( Int j=0; j<n; ++j )
+            y[j] *= beta;
         for( Int i=0; i<m; ++i )
         {
-            T sum = 0;
             const Int eStart = rowOffsets[i];
             const Int eStop = rowOffsets[i+1];
             for( Int e=eStart; e<eStop; ++e )
-                sum += x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
+                y[colIndices[e]] += alpha*x[i];
         }
     }
-    else
-    {
-        for( Int j=0; j<n; ++j ){
-            y[j] *= beta;
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];         
-            }
-	}
-    }
 }
 
 template<typename T,typename=DisableIf<IsBlasScalar<T>>>
@@ -71,15 +213,9 @@ void MultiplyCSR
     DEBUG_CSE
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
+        MultiplyCSRNormal
+        ( m, 1, alpha, rowOffsets, colIndices, values,
+          x, 1, 1, beta, y, 1, 1 );
     }
     else
     {
@@ -132,15 +268,9 @@ void MultiplyCSR
 #else
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
+        MultiplyCSRNormal
+        ( m, 1, alpha, rowOffsets, colIndices, values,
+          x, 1, 1, beta, y, 1, 1 );
     }
     else
     {
@@ -194,18 +324,9 @@ void MultiplyCSR
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
+        MultiplyCSRNormal
+        ( m, numRHS, alpha, rowOffsets, colIndices, values,
+          X, 1, ldX, beta, Y, 1, ldY );
     }
     else
     {
@@ -266,84 +387,91 @@ void MultiplyCSR
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
+        MultiplyCSRNormal
+        ( m, numRHS, alpha, rowOffsets, colIndices,
+          static_cast<const T*>(nullptr), X, 1, ldX, beta, Y, 1, ldY );
     }
     else
     {
         for( Int k=0; k<numRHS; ++k )
-	{
             for( Int j=0; j<n; ++j )
-	    {
                 Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	    {
-            	        for( Int k=0; k<numRHS; ++k ){
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX]; 
-			}	    
-            	    }
-            	}
-            }
+        for( Int i=0; i<m; ++i )
+        {
+            const Int eStart = rowOffsets[i];
+            const Int eStop = rowOffsets[i+1];
+            for( Int e=eStart; e<eStop; ++e )
+                for( Int k=0; k<numRHS; ++k )
+                    Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
         }
     }
 }
 
+// The single right-hand side case of MultiplyCSRInterY is forwarded to
+// MultiplyCSR (and its optional MKL backend, which requires Int indices) when
+// the compressed column indices are of type Int, which is always the case
+// without EL_USE_64BIT_INTS
 template<typename T>
-void MultiplyCSRInterX
+bool MultiplyCSRSingle
 ( Orientation orientation,
-  Int m, Int n, Int numRHS,
+  Int m, Int n,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X,
+  const T*   x,
   T beta,
-        T*   Y, Int ldY )
+        T*   y )
+{
+    MultiplyCSR
+    ( orientation, m, n, alpha, rowOffsets, colIndices, values, x, beta, y );
+    return true;
+}
+
+template<typename T,typename ColInt>
+bool MultiplyCSRSingle
+( Orientation orientation,
+  Int m, Int n,
+  T alpha,
+  const Int* rowOffsets,
+  const ColInt* colIndices,
+  const T*   values,
+  const T*   x,
+  T beta,
+        T*   y )
+{ return false; }
+
+template<typename T,typename ColInt>
+void MultiplyCSRInterY
+( Orientation orientation,
+  Int m, Int n, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const ColInt* colIndices,
+  const T*   values,
+  const T*   X, Int ldX,
+  T beta,
+        T*   Y )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
+    if( numRHS == 1 &&
+        MultiplyCSRSingle
+        ( orientation, m, n, alpha, rowOffsets, colIndices, values,
+          X, beta, Y ) )
         return;
-    }
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
+        MultiplyCSRNormal
+        ( m, numRHS, alpha, rowOffsets, colIndices, values,
+          X, 1, ldX, beta, Y, numRHS, 1 );
     }
     else
     {
         const bool conj = ( orientation == ADJOINT );
         for( Int k=0; k<numRHS; ++k )
             for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
+                Y[j*numRHS+k] *= beta;
         if( conj )
         {
             for( Int i=0; i<m; ++i )
@@ -354,7 +482,7 @@ void MultiplyCSRInterX
                 {
                     T prod = alpha*Conj(values[e]);
                     for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
+                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
                 }
             }
         }
@@ -368,7 +496,7 @@ void MultiplyCSRInterX
                 {
                     T prod = alpha*values[e];
                     for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
+                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
                 }
             }
         }
@@ -376,14 +504,14 @@ void MultiplyCSRInterX
 }
 
 template<typename T>
-void MultiplyCSRInterY
+void MultiplyCSRInter
 ( Orientation orientation,
   Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   X,
   T beta,
         T*   Y )
 {
@@ -398,24 +526,15 @@ void MultiplyCSRInterY
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
+        MultiplyCSRNormal
+        ( m, numRHS, alpha, rowOffsets, colIndices, values,
+          X, numRHS, 1, beta, Y, numRHS, 1 );
     }
     else
     {
         const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
+        for( Int j=0; j<n; ++j )
+            for( Int k=0; k<numRHS; ++k )
                 Y[j*numRHS+k] *= beta;
         if( conj )
         {
@@ -427,7 +546,7 @@ void MultiplyCSRInterY
                 {
                     T prod = alpha*Conj(values[e]);
                     for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
+                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
                 }
             }
         }
@@ -441,80 +560,159 @@ void MultiplyCSRInterY
                 {
                     T prod = alpha*values[e];
                     for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
+                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k]; 
                 }
             }
         }
     }
 }
 
+// y := alpha op(A) x + beta y, with A in SELL-C-sigma format
 template<typename T>
-void MultiplyCSRInter
+void MultiplySELL
 ( Orientation orientation,
-  Int m, Int n, Int numRHS,
+  Int m, Int n,
   T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X,
+  const SELLStorage<T>& A,
+  const T* x,
   T beta,
-        T*   Y )
+        T* y )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
+    const Int chunkHeight = A.chunkHeight;
+    const Int numChunks = A.chunkOffsets.size()-1;
+    const Int* colIndices = A.colIndices.data();
+    const T* values = A.values.data();
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        // Balance the chunks (which play the role of rows) by their storage
+        vector<Int> chunkBounds;
+        PartitionRowsByNonzeros
+        ( numChunks, A.chunkOffsets.data(), chunkBounds );
+        const Int numThreadChunks = chunkBounds.size()-1;
+        EL_PARALLEL_FOR
+        for( Int t=0; t<numThreadChunks; ++t )
         {
-            for( Int k=0; k<numRHS; ++k )
+            vector<T> sums( chunkHeight );
+            for( Int c=chunkBounds[t]; c<chunkBounds[t+1]; ++c )
             {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                const Int offset = A.chunkOffsets[c];
+                const Int chunkWidth =
+                  (A.chunkOffsets[c+1]-offset) / chunkHeight;
+                for( Int lane=0; lane<chunkHeight; ++lane )
+                    sums[lane] = 0;
+                // Each column of the chunk is contiguous, so the lanes can be
+                // processed as a single gather
+                for( Int k=0; k<chunkWidth; ++k )
+                {
+                    const Int* cols = &colIndices[offset+k*chunkHeight];
+                    const T* vals = &values[offset+k*chunkHeight];
+                    for( Int lane=0; lane<chunkHeight; ++lane )
+                        sums[lane] += vals[lane]*x[cols[lane]];
+                }
+                const Int numLanes = Min(chunkHeight,m-c*chunkHeight);
+                for( Int lane=0; lane<numLanes; ++lane )
+                {
+                    T& upsilon = y[A.rowPerm[c*chunkHeight+lane]];
+                    upsilon = alpha*sums[lane] + beta*upsilon;
+                }
             }
         }
     }
     else
     {
-        const bool conj = ( orientation == ADJOINT );
+        const bool conjugate = ( orientation == ADJOINT );
         for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
+            y[j] *= beta;
+        for( Int r=0; r<m; ++r )
         {
-            for( Int i=0; i<m; ++i )
+            const Int c = r / chunkHeight;
+            const Int lane = r % chunkHeight;
+            const T alphaChi = alpha*x[A.rowPerm[r]];
+            for( Int k=0; k<A.rowLengths[r]; ++k )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
+                const Int index = A.chunkOffsets[c] + k*chunkHeight + lane;
+                const T value = values[index];
+                y[colIndices[index]] +=
+                  ( conjugate ? Conj(value) : value )*alphaChi;
+            }
+        }
+    }
+}
+
+// y := alpha op(A) x + beta y, with A in BCSR format
+template<typename T>
+void MultiplyBCSR
+( Orientation orientation,
+  Int m, Int n,
+  T alpha,
+  const BCSRStorage<T>& A,
+  const T* x,
+  T beta,
+        T* y )
+{
+    DEBUG_CSE
+    const Int blockSize = A.blockSize;
+    const Int blockArea = blockSize*blockSize;
+    const Int numBlockRows = A.blockRowOffsets.size()-1;
+    if( orientation == NORMAL )
+    {
+        vector<Int> blockRowBounds;
+        PartitionRowsByNonzeros
+        ( numBlockRows, A.blockRowOffsets.data(), blockRowBounds );
+        const Int numThreadChunks = blockRowBounds.size()-1;
+        EL_PARALLEL_FOR
+        for( Int t=0; t<numThreadChunks; ++t )
+        {
+            vector<T> sums( blockSize );
+            for( Int I=blockRowBounds[t]; I<blockRowBounds[t+1]; ++I )
+            {
+                for( Int i=0; i<blockSize; ++i )
+                    sums[i] = 0;
+                const Int sBeg = A.blockRowOffsets[I];
+                const Int sEnd = A.blockRowOffsets[I+1];
+                for( Int s=sBeg; s<sEnd; ++s )
                 {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
+                    const Int jOff = A.blockColIndices[s]*blockSize;
+                    const Int blockWidth = Min(blockSize,n-jOff);
+                    const T* block = &A.values[s*blockArea];
+                    for( Int j=0; j<blockWidth; ++j )
+                    {
+                        const T chi = x[jOff+j];
+                        for( Int i=0; i<blockSize; ++i )
+                            sums[i] += block[i+j*blockSize]*chi;
+                    }
                 }
+                const Int iOff = I*blockSize;
+                const Int blockHeight = Min(blockSize,m-iOff);
+                for( Int i=0; i<blockHeight; ++i )
+                    y[iOff+i] = alpha*sums[i] + beta*y[iOff+i];
             }
         }
-        else
+    }
+    else
+    {
+        const bool conjugate = ( orientation == ADJOINT );
+        for( Int j=0; j<n; ++j )
+            y[j] *= beta;
+        for( Int I=0; I<numBlockRows; ++I )
         {
-            for( Int i=0; i<m; ++i )
+            const Int iOff = I*blockSize;
+            const Int blockHeight = Min(blockSize,m-iOff);
+            for( Int s=A.blockRowOffsets[I]; s<A.blockRowOffsets[I+1]; ++s )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
+                const Int jOff = A.blockColIndices[s]*blockSize;
+                const Int blockWidth = Min(blockSize,n-jOff);
+                const T* block = &A.values[s*blockArea];
+                for( Int j=0; j<blockWidth; ++j )
                 {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k]; 
+                    T sum = 0;
+                    for( Int i=0; i<blockHeight; ++i )
+                    {
+                        const T value = block[i+j*blockSize];
+                        sum += ( conjugate ? Conj(value) : value )*x[iOff+i];
+                    }
+                    y[jOff+j] += alpha*sum;
                 }
             }
         }
@@ -534,6 +732,24 @@ void Multiply
       if( X.Width() != Y.Width() )
           LogicError("X and Y must have the same width");
     )
+    if( A.Format() == SELL_FORMAT )
+    {
+        for( Int k=0; k<X.Width(); ++k )
+            MultiplySELL
+            ( orientation, A.Height(), A.Width(),
+              alpha, A.LockedSELL(), X.LockedBuffer(0,k),
+              beta, Y.Buffer(0,k) );
+        return;
+    }
+    if( A.Format() == BCSR_FORMAT )
+    {
+        for( Int k=0; k<X.Width(); ++k )
+            MultiplyBCSR
+            ( orientation, A.Height(), A.Width(),
+              alpha, A.LockedBCSR(), X.LockedBuffer(0,k),
+              beta, Y.Buffer(0,k) );
+        return;
+    }
     MultiplyCSR
     ( orientation, A.Height(), A.Width(), X.Width(),
       alpha, A.LockedOffsetBuffer(),
@@ -592,23 +808,25 @@ void Multiply
     if( time && commRank == 0 )
         totalTimer.Start();
 
-    // Y := beta Y
-    Y *= beta;
-
     A.InitializeMultMeta();
     const auto& meta = A.LockedDistGraph().multMeta;
     // Convert the sizes and offsets to be compatible with the current width
+    // (which is instead done per neighbor for the neighborhood exchanges)
     const Int b = X.Width();
-    vector<int> recvSizes=meta.recvSizes,
-                recvOffs=meta.recvOffs,
-                sendSizes=meta.sendSizes,
-                sendOffs=meta.sendOffs;
-    for( int q=0; q<commSize; ++q )
+    vector<int> recvSizes, recvOffs, sendSizes, sendOffs;
+    if( !meta.neighborComm )
     {
-        recvSizes[q] *= b;    
-        recvOffs[q] *= b;
-        sendSizes[q] *= b;
-        sendOffs[q] *= b;
+        recvSizes = meta.recvSizes;
+        recvOffs = meta.recvOffs;
+        sendSizes = meta.sendSizes;
+        sendOffs = meta.sendOffs;
+        for( int q=0; q<commSize; ++q )
+        {
+            recvSizes[q] *= b;    
+            recvOffs[q] *= b;
+            sendSizes[q] *= b;
+            sendOffs[q] *= b;
+        }
     }
 
     if( orientation == NORMAL )
@@ -633,24 +851,62 @@ void Multiply
                 sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
         }
 
-        // Now send them
+        // Start sending them
         vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
-     
-        // Perform the local multiply-accumulate, y := alpha A x + y
+        vector<int> sendCounts, sendDispls, recvCounts, recvDispls;
+        mpi::Request<T> request;
+        bool pending = true;
+        if( meta.neighborComm )
+        {
+            meta.NeighborCounts
+            ( false, b, sendCounts, sendDispls, recvCounts, recvDispls );
+            mpi::INeighborAllToAll
+            ( sendVals.data(), sendCounts.data(), sendDispls.data(),
+              recvVals.data(), recvCounts.data(), recvDispls.data(),
+              *meta.neighborComm, request );
+        }
+        else
+        {
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+            mpi::IAllToAll
+            ( sendVals.data(), sendSizes.data(), sendOffs.data(),
+              recvVals.data(), recvSizes.data(), recvOffs.data(), comm,
+              request );
+#else
+            mpi::AllToAll
+            ( sendVals.data(), sendSizes.data(), sendOffs.data(),
+              recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
+            pending = false;
+#endif
+        }
+
+        // While the exchange is in flight, perform the local multiplies for
+        // the rows of A whose columns are all within our block of X,
+        // y := alpha A x + beta y
         if( time && commRank == 0 )
             timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(), 
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 recvVals.data(), 
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+        const Int* offsetBuf = A.LockedOffsetBuffer();
+        const T* valueBuf = A.LockedValueBuffer();
+        T* YBuffer = Y.Matrix().Buffer();
+        const Int ldY = Y.Matrix().LDim();
+        MultiplyCSRNormalRows
+        ( meta.interiorSources.size(), meta.interiorSources.data(),
+          meta.interiorEdgeOffs.data(), b,
+          alpha, offsetBuf, meta.localColOffs.data(), valueBuf,
+                 XBuffer, 1, ldX,
+          beta,  YBuffer, 1, ldY );
+
+        // Finish with the remaining rows once the values have arrived
+        if( pending )
+            mpi::Wait( request );
+        MultiplyCSRNormalRows
+        ( meta.boundarySources.size(), meta.boundarySources.data(),
+          meta.boundaryEdgeOffs.data(), b,
+          alpha, offsetBuf, meta.colOffs.data(), valueBuf,
+                 recvVals.data(), b, 1,
+          beta,  YBuffer, 1, ldY );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+            Output("  Local multiply time: ",timer.Stop());
     }
     else
     {
@@ -659,6 +915,9 @@ void Multiply
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
 
+        // Y := beta Y
+        Y *= beta;
+
         // Form and pack the updates to Y
         if( time && commRank == 0 )
             timer.Start();
@@ -677,9 +936,20 @@ void Multiply
         const Int numRecvInds = meta.sendInds.size();
         vector<T> recvVals;
         FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), comm );
+        if( meta.neighborComm )
+        {
+            vector<int> sendCounts, sendDispls, recvCounts, recvDispls;
+            meta.NeighborCounts
+            ( true, b, sendCounts, sendDispls, recvCounts, recvDispls );
+            mpi::NeighborAllToAll
+            ( sendVals.data(), sendCounts.data(), sendDispls.data(),
+              recvVals.data(), recvCounts.data(), recvDispls.data(),
+              *meta.adjointNeighborComm );
+        }
+        else
+            mpi::AllToAll
+            ( sendVals.data(), recvSizes.data(), recvOffs.data(),
+              recvVals.data(), sendSizes.data(), sendOffs.data(), comm );
      
         // Accumulate the received indices onto Y
         const Int firstLocalRow = Y.FirstLocalRow();
@@ -697,6 +967,452 @@ void Multiply
         Output("Multiply total time: ",totalTimer.Stop());
 }
 
+// Sparse-times-sparse products
+// ============================
+// Gustavson's row-by-row algorithm: row i of C := alpha A B is the
+// combination of the rows of B selected by the columns of row i of A. The
+// rows of B are addressed through an offset array so that the distributed
+// product can use the rows it fetched from other processes, and the columns
+// of A have been mapped to the corresponding rows of that (local) B.
+
+namespace {
+
+// An open-addressing hash table from the columns of a row of C to their
+// accumulated values which is cleared in time proportional to its occupancy
+template<typename T>
+class HashAccumulator
+{
+public:
+    // Prepare the (empty) table to hold at most 'bound' keys
+    void Reset( Int bound )
+    {
+        for( const Int slot : occupied_ )
+            keys_[slot] = -1;
+        occupied_.clear();
+
+        Int capacity = 16;
+        while( capacity < 2*bound )
+            capacity *= 2;
+        if( capacity > Int(keys_.size()) )
+        {
+            keys_.assign( capacity, -1 );
+            values_.resize( capacity );
+        }
+        mask_ = capacity-1;
+    }
+
+    // Return the slot of the key after inserting it (with a zero value) if
+    // it was not already present
+    Int Insert( Int key )
+    {
+        Int slot = Hash( key );
+        while( keys_[slot] != key )
+        {
+            if( keys_[slot] < 0 )
+            {
+                keys_[slot] = key;
+                values_[slot] = 0;
+                occupied_.push_back( slot );
+                break;
+            }
+            slot = (slot+1) & mask_;
+        }
+        return slot;
+    }
+
+    // Return the slot of the key, or -1 if it is not present
+    Int Find( Int key ) const
+    {
+        Int slot = Hash( key );
+        while( keys_[slot] != key )
+        {
+            if( keys_[slot] < 0 )
+                return -1;
+            slot = (slot+1) & mask_;
+        }
+        return slot;
+    }
+
+    Int Size() const { return occupied_.size(); }
+    Int Key( Int slot ) const { return keys_[slot]; }
+    T& Value( Int slot ) { return values_[slot]; }
+
+    // The occupied slots in the order in which their keys were inserted
+    vector<Int>& Occupied() { return occupied_; }
+
+private:
+    Int Hash( Int key ) const
+    {
+        const std::uint64_t product =
+          std::uint64_t(key)*11400714819323198485ull;
+        return Int(product >> 32) & mask_;
+    }
+
+    Int mask_=0;
+    vector<Int> keys_;
+    vector<T> values_;
+    vector<Int> occupied_;
+};
+
+// Overwrite sizes[0:count) with their exclusive prefix sums and set
+// sizes[count] to their total, which is returned
+inline Int SizesToOffsets( Int count, Int* sizes )
+{
+    Int total = 0;
+    for( Int i=0; i<count; ++i )
+    {
+        const Int size = sizes[i];
+        sizes[i] = total;
+        total += size;
+    }
+    sizes[count] = total;
+    return total;
+}
+
+// An upper bound on the number of nonzeros in row i of A B
+inline Int ProductRowBound
+( Int i, Int width,
+  const Int* aOffsets, const Int* aRows, const Int* bOffsets )
+{
+    Int bound = 0;
+    for( Int e=aOffsets[i]; e<aOffsets[i+1]; ++e )
+        bound += bOffsets[aRows[e]+1] - bOffsets[aRows[e]];
+    return Min( bound, width );
+}
+
+// The symbolic phase: rowSizes[i] := the number of nonzeros in row i of A B
+void ProductRowSizes
+( Int m, Int n,
+  const Int* aOffsets, const Int* aRows,
+  const Int* bOffsets, const Int* bCols,
+  Int* rowSizes )
+{
+    DEBUG_CSE
+    vector<Int> rowBounds;
+    PartitionRowsByNonzeros( m, aOffsets, rowBounds );
+    const Int numChunks = rowBounds.size()-1;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        HashAccumulator<Int> table;
+        for( Int i=rowBounds[chunk]; i<rowBounds[chunk+1]; ++i )
+        {
+            table.Reset( ProductRowBound( i, n, aOffsets, aRows, bOffsets ) );
+            for( Int e=aOffsets[i]; e<aOffsets[i+1]; ++e )
+            {
+                const Int k = aRows[e];
+                for( Int f=bOffsets[k]; f<bOffsets[k+1]; ++f )
+                    table.Insert( bCols[f] );
+            }
+            rowSizes[i] = table.Size();
+        }
+    }
+}
+
+// The numeric phase: write the sorted rows of alpha A B into the buffers
+// sized by the symbolic phase
+template<typename T>
+void ProductRows
+( Int m, Int n, T alpha,
+  const Int* aOffsets, const Int* aRows, const T* aVals,
+  const Int* bOffsets, const Int* bCols, const T* bVals,
+  const Int* cOffsets, Int* cCols, T* cVals )
+{
+    DEBUG_CSE
+    vector<Int> rowBounds;
+    PartitionRowsByNonzeros( m, aOffsets, rowBounds );
+    const Int numChunks = rowBounds.size()-1;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        HashAccumulator<T> table;
+        for( Int i=rowBounds[chunk]; i<rowBounds[chunk+1]; ++i )
+        {
+            table.Reset( ProductRowBound( i, n, aOffsets, aRows, bOffsets ) );
+            for( Int e=aOffsets[i]; e<aOffsets[i+1]; ++e )
+            {
+                const Int k = aRows[e];
+                const T aVal = aVals[e];
+                for( Int f=bOffsets[k]; f<bOffsets[k+1]; ++f )
+                    table.Value( table.Insert( bCols[f] ) ) += aVal*bVals[f];
+            }
+            vector<Int>& occupied = table.Occupied();
+            std::sort
+            ( occupied.begin(), occupied.end(),
+              [&]( Int s, Int t ) { return table.Key(s) < table.Key(t); } );
+            Int g = cOffsets[i];
+            for( const Int slot : occupied )
+            {
+                cCols[g] = table.Key( slot );
+                cVals[g] = alpha*table.Value( slot );
+                ++g;
+            }
+        }
+    }
+}
+
+// The numeric phase for a fixed (frozen) pattern of C, which must contain
+// that of A B; returns false if it does not
+template<typename T>
+bool RefreshProductRows
+( Int m, T alpha,
+  const Int* aOffsets, const Int* aRows, const T* aVals,
+  const Int* bOffsets, const Int* bCols, const T* bVals,
+  const Int* cOffsets, const Int* cCols, T* cVals )
+{
+    DEBUG_CSE
+    vector<Int> rowBounds;
+    PartitionRowsByNonzeros( m, aOffsets, rowBounds );
+    const Int numChunks = rowBounds.size()-1;
+    vector<byte> contained( numChunks, true );
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        HashAccumulator<T> table;
+        for( Int i=rowBounds[chunk]; i<rowBounds[chunk+1]; ++i )
+        {
+            table.Reset( cOffsets[i+1]-cOffsets[i] );
+            for( Int g=cOffsets[i]; g<cOffsets[i+1]; ++g )
+                table.Insert( cCols[g] );
+            for( Int e=aOffsets[i]; e<aOffsets[i+1]; ++e )
+            {
+                const Int k = aRows[e];
+                const T aVal = aVals[e];
+                for( Int f=bOffsets[k]; f<bOffsets[k+1]; ++f )
+                {
+                    const Int slot = table.Find( bCols[f] );
+                    if( slot < 0 )
+                        contained[chunk] = false;
+                    else
+                        table.Value( slot ) += aVal*bVals[f];
+                }
+            }
+            const vector<Int>& occupied = table.Occupied();
+            for( Int g=cOffsets[i]; g<cOffsets[i+1]; ++g )
+                cVals[g] = alpha*table.Value( occupied[g-cOffsets[i]] );
+        }
+    }
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        if( !contained[chunk] )
+            return false;
+    return true;
+}
+
+// Form the (sorted, local) rows of alpha A B with the given global row
+// offset, either from scratch or, if the sparsity of C is frozen, by only
+// refreshing the values of C
+template<typename T,typename SparseType>
+void FormProduct
+( Int m, Int n, Int firstRow, T alpha,
+  const Int* aOffsets, const Int* aRows, const T* aVals,
+  const Int* bOffsets, const Int* bCols, const T* bVals,
+  vector<Int>& sources, vector<Int>& targets, vector<T>& values,
+  SparseType& C )
+{
+    DEBUG_CSE
+    if( C.FrozenSparsity() )
+    {
+        const bool contained =
+          RefreshProductRows
+          ( m, alpha,
+            aOffsets, aRows, aVals,
+            bOffsets, bCols, bVals,
+            C.LockedOffsetBuffer(), C.LockedTargetBuffer(), C.ValueBuffer() );
+        if( !contained )
+            LogicError("The frozen sparsity of C did not contain that of A B");
+        return;
+    }
+
+    vector<Int> cOffsets( m+1 );
+    ProductRowSizes( m, n, aOffsets, aRows, bOffsets, bCols, cOffsets.data() );
+    const Int numEntries = SizesToOffsets( m, cOffsets.data() );
+    FastResize( sources, numEntries );
+    FastResize( targets, numEntries );
+    FastResize( values, numEntries );
+    ProductRows
+    ( m, n, alpha,
+      aOffsets, aRows, aVals,
+      bOffsets, bCols, bVals,
+      cOffsets.data(), targets.data(), values.data() );
+    EL_PARALLEL_FOR
+    for( Int i=0; i<m; ++i )
+        for( Int g=cOffsets[i]; g<cOffsets[i+1]; ++g )
+            sources[g] = firstRow + i;
+}
+
+} // anonymous namespace
+
+template<typename T>
+void Multiply
+( T alpha, const SparseMatrix<T>& A, const SparseMatrix<T>& B,
+                 SparseMatrix<T>& C )
+{
+    DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError
+        ("Nonconformal SpGEMM: ",A.Height()," x ",A.Width()," times ",
+         B.Height()," x ",B.Width());
+    A.AssertConsistent();
+    B.AssertConsistent();
+    const Int m = A.Height();
+    const Int n = B.Width();
+    if( C.FrozenSparsity() )
+    {
+        if( C.Height() != m || C.Width() != n )
+            LogicError("C's frozen sparsity was of the wrong size");
+        if( &C == &A || &C == &B )
+            LogicError("C cannot alias A or B when refreshing its values");
+        C.AssertConsistent();
+    }
+
+    vector<Int> sources, targets;
+    vector<T> values;
+    FormProduct
+    ( m, n, Int(0), alpha,
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(), A.LockedValueBuffer(),
+      B.LockedOffsetBuffer(), B.LockedTargetBuffer(), B.LockedValueBuffer(),
+      sources, targets, values, C );
+    if( !C.FrozenSparsity() )
+    {
+        C.Resize( m, n );
+        C.AdoptEntries
+        ( std::move(sources), std::move(targets), std::move(values) );
+    }
+}
+
+// Each process forms its rows of C from its rows of A and the rows of B which
+// they reference, which are first fetched from their owners. Since the
+// distributed sparse matrices are only distributed by rows, this is the
+// sparsity-aware 1D algorithm: only the rows of B that are needed are sent.
+template<typename T>
+void Multiply
+( T alpha, const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B,
+                 DistSparseMatrix<T>& C )
+{
+    DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError
+        ("Nonconformal SpGEMM: ",A.Height()," x ",A.Width()," times ",
+         B.Height()," x ",B.Width());
+    if( !mpi::Congruent( A.Comm(), B.Comm() ) )
+        LogicError("A and B must have congruent communicators");
+    A.AssertLocallyConsistent();
+    B.AssertLocallyConsistent();
+    mpi::Comm comm = A.Comm();
+    const int commSize = mpi::Size( comm );
+    const Int m = A.Height();
+    const Int n = B.Width();
+    if( C.FrozenSparsity() )
+    {
+        if( C.Height() != m || C.Width() != n )
+            LogicError("C's frozen sparsity was of the wrong size");
+        if( !mpi::Congruent( C.Comm(), comm ) )
+            LogicError("C's frozen sparsity had the wrong communicator");
+        if( &C == &A || &C == &B )
+            LogicError("C cannot alias A or B when refreshing its values");
+        C.AssertLocallyConsistent();
+    }
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntriesA = A.NumLocalEntries();
+    const Int* aOffsets = A.LockedOffsetBuffer();
+    const Int* aCols = A.LockedTargetBuffer();
+
+    // Determine the (sorted) rows of B referenced by our entries of A and
+    // map each of our entries of A to its position in that list
+    vector<Int> neededRows( aCols, aCols+numLocalEntriesA );
+    std::sort( neededRows.begin(), neededRows.end() );
+    neededRows.erase
+    ( std::unique( neededRows.begin(), neededRows.end() ), neededRows.end() );
+    const Int numNeeded = neededRows.size();
+    vector<Int> aRows( numLocalEntriesA );
+    EL_PARALLEL_FOR
+    for( Int e=0; e<numLocalEntriesA; ++e )
+        aRows[e] =
+          std::lower_bound( neededRows.begin(), neededRows.end(), aCols[e] ) -
+          neededRows.begin();
+
+    // Request the rows from their owners (the requests are already ordered
+    // by owner since the rows are distributed in contiguous blocks)
+    vector<int> requestCounts( commSize, 0 );
+    for( const Int k : neededRows )
+        ++requestCounts[B.RowOwner(k)];
+    vector<int> requestOffs;
+    Scan( requestCounts, requestOffs );
+    vector<int> servedCounts( commSize );
+    mpi::AllToAll( requestCounts.data(), 1, servedCounts.data(), 1, comm );
+    vector<int> servedOffs;
+    const Int numServed = Scan( servedCounts, servedOffs );
+    vector<Int> servedRows( numServed );
+    mpi::AllToAll
+    ( neededRows.data(), requestCounts.data(), requestOffs.data(),
+      servedRows.data(), servedCounts.data(), servedOffs.data(), comm );
+
+    // Return the lengths of the requested rows followed by their entries
+    const Int firstLocalRowB = B.FirstLocalRow();
+    const Int* bLocalOffsets = B.LockedOffsetBuffer();
+    const Int* bLocalCols = B.LockedTargetBuffer();
+    const T* bLocalVals = B.LockedValueBuffer();
+    vector<Int> servedSizes( numServed );
+    for( Int s=0; s<numServed; ++s )
+    {
+        const Int kLoc = servedRows[s] - firstLocalRowB;
+        servedSizes[s] = bLocalOffsets[kLoc+1] - bLocalOffsets[kLoc];
+    }
+    vector<Int> bOffsets( numNeeded+1 );
+    mpi::AllToAll
+    ( servedSizes.data(), servedCounts.data(), servedOffs.data(),
+      bOffsets.data(), requestCounts.data(), requestOffs.data(), comm );
+    const Int numFetched = SizesToOffsets( numNeeded, bOffsets.data() );
+
+    vector<int> sendCounts( commSize, 0 ), recvCounts( commSize, 0 );
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Int s=servedOffs[q]; s<servedOffs[q]+servedCounts[q]; ++s )
+            sendCounts[q] += servedSizes[s];
+        recvCounts[q] =
+          bOffsets[requestOffs[q]+requestCounts[q]] - bOffsets[requestOffs[q]];
+    }
+    vector<int> sendOffs, recvOffs;
+    const Int numSend = Scan( sendCounts, sendOffs );
+    Scan( recvCounts, recvOffs );
+    vector<Int> sendCols( numSend );
+    vector<T> sendVals( numSend );
+    Int off = 0;
+    for( Int s=0; s<numServed; ++s )
+    {
+        const Int kLoc = servedRows[s] - firstLocalRowB;
+        for( Int f=bLocalOffsets[kLoc]; f<bLocalOffsets[kLoc+1]; ++f )
+        {
+            sendCols[off] = bLocalCols[f];
+            sendVals[off] = bLocalVals[f];
+            ++off;
+        }
+    }
+    vector<Int> bCols( numFetched );
+    vector<T> bVals( numFetched );
+    mpi::AllToAll
+    ( sendCols.data(), sendCounts.data(), sendOffs.data(),
+      bCols.data(), recvCounts.data(), recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendVals.data(), sendCounts.data(), sendOffs.data(),
+      bVals.data(), recvCounts.data(), recvOffs.data(), comm );
+
+    vector<Int> sources, targets;
+    vector<T> values;
+    FormProduct
+    ( localHeight, n, A.FirstLocalRow(), alpha,
+      aOffsets, aRows.data(), A.LockedValueBuffer(),
+      bOffsets.data(), bCols.data(), bVals.data(),
+      sources, targets, values, C );
+    if( !C.FrozenSparsity() )
+    {
+        C.SetComm( comm );
+        C.Resize( m, n );
+        C.AdoptLocalEntries
+        ( std::move(sources), std::move(targets), std::move(values) );
+    }
+}
+
 #define PROTO(T) \
     template void Multiply \
     ( Orientation orientation, \
@@ -718,7 +1434,13 @@ void Multiply
       const DistSparseMatrix<T>& A, \
       const DistMultiVec<T>& X, \
             T beta, \
-            DistMultiVec<T>& Y );
+            DistMultiVec<T>& Y ); \
+    template void Multiply \
+    ( T alpha, const SparseMatrix<T>& A, const SparseMatrix<T>& B, \
+                     SparseMatrix<T>& C ); \
+    template void Multiply \
+    ( T alpha, const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B, \
+                     DistSparseMatrix<T>& C );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -15,6 +15,7 @@
 
 #include "./SafeMultiShiftTrsm/Overflow.hpp"
 #include "./SafeMultiShiftTrsm/LUN.hpp"
+#include "./MultiShiftTrsm/Subgrid.hpp"
 
 namespace El {
 
@@ -40,13 +41,26 @@ template<typename F>
 void SafeMultiShiftTrsm
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
   F alpha, const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& shifts, 
-  AbstractDistMatrix<F>& B, AbstractDistMatrix<F>& scales )
+  AbstractDistMatrix<F>& B, AbstractDistMatrix<F>& scales,
+  int shiftGroupSize )
 {
     DEBUG_CSE
     B *= alpha;
     if( side == LEFT && uplo == UPPER && orientation == NORMAL)
     {
-        safemstrsm::LUN( A, shifts, B, scales );
+        if( mstrsm::UseSubgrids( A.Grid(), shiftGroupSize ) )
+        {
+            auto solve =
+              [&]( const AbstractDistMatrix<F>& ASub,
+                   const AbstractDistMatrix<F>& shiftsSub,
+                         AbstractDistMatrix<F>& BSub,
+                         AbstractDistMatrix<F>& scalesSub )
+              { safemstrsm::LUN( ASub, shiftsSub, BSub, scalesSub ); };
+            mstrsm::SubgridSolve
+            ( A, shifts, B, &scales, shiftGroupSize, solve );
+        }
+        else
+            safemstrsm::LUN( A, shifts, B, scales );
     }
     else
         LogicError("This option is not yet supported");
@@ -60,7 +74,8 @@ void SafeMultiShiftTrsm
   template void SafeMultiShiftTrsm \
   ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
     F alpha, const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& shifts, \
-    AbstractDistMatrix<F>& B, AbstractDistMatrix<F>& scales );
+    AbstractDistMatrix<F>& B, AbstractDistMatrix<F>& scales, \
+    int shiftGroupSize );
   
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace sparse_trsm {
+
+// The right-hand sides are interleaved so that the k entries associated with
+// each row of the solution are contiguous, and each nonzero of A is then read
+// once and applied to all of them (rather than once per right-hand side).
+template<typename F>
+void Interleave( F alpha, const Matrix<F>& B, vector<F>& W )
+{
+    DEBUG_CSE
+    const Int m = B.Height();
+    const Int numRHS = B.Width();
+    W.resize( m*numRHS );
+    for( Int k=0; k<numRHS; ++k )
+    {
+        const F* BCol = B.LockedBuffer(0,k);
+        for( Int i=0; i<m; ++i )
+            W[k+i*numRHS] = alpha*BCol[i];
+    }
+}
+
+template<typename F>
+void Deinterleave( const vector<F>& W, Matrix<F>& B )
+{
+    DEBUG_CSE
+    const Int m = B.Height();
+    const Int numRHS = B.Width();
+    for( Int k=0; k<numRHS; ++k )
+    {
+        F* BCol = B.Buffer(0,k);
+        for( Int i=0; i<m; ++i )
+            BCol[i] = W[k+i*numRHS];
+    }
+}
+
+// Row-oriented substitution for op(A) = A: the entries of row i in the
+// relevant triangle are gathered into row i of the solution
+template<typename F>
+void RowSolve
+( bool lower, bool unit, bool checkIfSingular,
+  const SparseMatrix<F>& A, vector<F>& W, Int numRHS )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const F* valBuf = A.LockedValueBuffer();
+    for( Int step=0; step<n; ++step )
+    {
+        const Int i = ( lower ? step : n-1-step );
+        F* wi = &W[i*numRHS];
+        F delta = 0;
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+        {
+            const Int j = colBuf[e];
+            if( j == i )
+            {
+                delta = valBuf[e];
+                continue;
+            }
+            if( (lower && j > i) || (!lower && j < i) )
+                continue;
+            const F value = valBuf[e];
+            const F* wj = &W[j*numRHS];
+            for( Int k=0; k<numRHS; ++k )
+                wi[k] -= value*wj[k];
+        }
+        if( !unit )
+        {
+            if( checkIfSingular && delta == F(0) )
+                throw SingularMatrixException();
+            for( Int k=0; k<numRHS; ++k )
+                wi[k] /= delta;
+        }
+    }
+}
+
+// Column-oriented substitution for op(A) = A^T or A^H: row i of A is a column
+// of op(A), and so, once row i of the solution is known, it is scattered into
+// the rows of the right-hand sides it contributes to
+template<typename F>
+void ColumnSolve
+( bool lower, bool conjugate, bool unit, bool checkIfSingular,
+  const SparseMatrix<F>& A, vector<F>& W, Int numRHS )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const F* valBuf = A.LockedValueBuffer();
+    // op(A) is upper triangular if A is lower triangular (and vice versa)
+    for( Int step=0; step<n; ++step )
+    {
+        const Int i = ( lower ? n-1-step : step );
+        F* wi = &W[i*numRHS];
+        if( !unit )
+        {
+            F delta = 0;
+            for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+                if( colBuf[e] == i )
+                    delta = valBuf[e];
+            if( conjugate )
+                delta = Conj(delta);
+            if( checkIfSingular && delta == F(0) )
+                throw SingularMatrixException();
+            for( Int k=0; k<numRHS; ++k )
+                wi[k] /= delta;
+        }
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+        {
+            const Int j = colBuf[e];
+            if( j == i || (lower && j > i) || (!lower && j < i) )
+                continue;
+            const F value = ( conjugate ? Conj(valBuf[e]) : valBuf[e] );
+            F* wj = &W[j*numRHS];
+            for( Int k=0; k<numRHS; ++k )
+                wj[k] -= value*wi[k];
+        }
+    }
+}
+
+} // namespace sparse_trsm
+
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const SparseMatrix<F>& A,
+        Matrix<F>& B,
+  bool checkIfSingular )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("SparseTrsm");
+    if( side != LEFT )
+        LogicError("Only left sparse triangular solves are supported");
+    if( A.Height() != A.Width() )
+        LogicError("Triangular matrix must be square");
+    if( A.Height() != B.Height() )
+        LogicError("Nonconformal sparse Trsm");
+    DEBUG_ONLY(
+      if( !A.Consistent() )
+          LogicError("Sparse matrix must be consistent");
+    )
+    const Int numRHS = B.Width();
+    if( B.Height() == 0 || numRHS == 0 )
+        return;
+
+    const bool lower = ( uplo == LOWER );
+    const bool unit = ( diag == UNIT );
+    vector<F> W;
+    sparse_trsm::Interleave( alpha, B, W );
+    if( orientation == NORMAL )
+        sparse_trsm::RowSolve( lower, unit, checkIfSingular, A, W, numRHS );
+    else
+        sparse_trsm::ColumnSolve
+        ( lower, orientation==ADJOINT, unit, checkIfSingular, A, W, numRHS );
+    sparse_trsm::Deinterleave( W, B );
+}
+
+#define PROTO(F) \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const SparseMatrix<F>& A, \
+          Matrix<F>& B, \
+    bool checkIfSingular );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
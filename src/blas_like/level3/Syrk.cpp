@@ -10,6 +10,7 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Syrk/Contract.hpp"
 #include "./Syrk/LN.hpp"
 #include "./Syrk/LT.hpp"
 #include "./Syrk/UN.hpp"
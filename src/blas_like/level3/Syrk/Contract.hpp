@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace syrk {
+
+// The number of entries of the 'uplo' triangle of an n x n [MC,MR] matrix
+// which are owned by the process with the given row and column shifts
+inline Int LocalTrapezoidSize
+( UpperOrLower uplo, Int n,
+  Int colShift, Int colStride,
+  Int rowShift, Int rowStride )
+{
+    const Int localHeight = Length( n, colShift, colStride );
+    Int size = 0;
+    for( Int j=rowShift; j<n; j+=rowStride )
+    {
+        if( uplo == LOWER )
+            size += localHeight - Length( j, colShift, colStride );
+        else
+            size += Length( j+1, colShift, colStride );
+    }
+    return size;
+}
+
+// B := B + alpha sum(A), where each process holds its own contribution to
+// the square diagonal block in A, and only the 'uplo' triangle of B is
+// referenced. Unlike AxpyContract, only the entries of the triangle are
+// packed into the ReduceScatter, which roughly halves its volume.
+template<typename T>
+void AxpyContractTrapezoid
+( UpperOrLower uplo,
+  T alpha,
+  const DistMatrix<T,STAR,STAR>& A,
+        DistMatrix<T,MC,MR>& B )
+{
+    DEBUG_CSE
+    AssertSameGrids( A, B );
+    const Int n = B.Height();
+    if( A.Height() != n || A.Width() != n || B.Width() != n )
+        LogicError("A and B must be square and of the same size");
+    if( !B.Participating() )
+        return;
+
+    const Int colStride = B.ColStride();
+    const Int rowStride = B.RowStride();
+    const Int colAlign = B.ColAlign();
+    const Int rowAlign = B.RowAlign();
+
+    Int recvSize = 0;
+    for( Int rowRank=0; rowRank<rowStride; ++rowRank )
+    {
+        const Int rowShift = Shift( rowRank, rowAlign, rowStride );
+        for( Int colRank=0; colRank<colStride; ++colRank )
+        {
+            const Int colShift = Shift( colRank, colAlign, colStride );
+            recvSize =
+              Max
+              ( recvSize,
+                LocalTrapezoidSize
+                ( uplo, n, colShift, colStride, rowShift, rowStride ) );
+        }
+    }
+    recvSize = mpi::Pad( recvSize );
+    const Int sendSize = colStride*rowStride*recvSize;
+
+    // As in axpy_contract::Scatter, the buffer is zero-initialized so that
+    // the padding cannot cause a floating-point exception
+    vector<T> buffer( sendSize, T(0) );
+
+    // Pack each process's portion of the triangle, column by column, in the
+    // rank order of B.DistComm()
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int q=0; q<colStride*rowStride; ++q )
+    {
+        const Int colShift = Shift( q % colStride, colAlign, colStride );
+        const Int rowShift = Shift( q / colStride, rowAlign, rowStride );
+        T* data = &buffer[q*recvSize];
+        Int offset = 0;
+        for( Int j=rowShift; j<n; j+=rowStride )
+        {
+            const Int iBeg =
+              ( uplo == LOWER ? colShift+Length(j,colShift,colStride)*colStride
+                              : colShift );
+            const Int iEnd = ( uplo == LOWER ? n : j+1 );
+            for( Int i=iBeg; i<iEnd; i+=colStride )
+                data[offset++] = ABuf[i+j*ALDim];
+        }
+    }
+
+    // Communicate
+    mpi::ReduceScatter( buffer.data(), recvSize, B.DistComm() );
+
+    // Unpack our received data
+    const Int colShift = B.ColShift();
+    const Int localHeight = B.LocalHeight();
+    const Int localWidth = B.LocalWidth();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    Int offset = 0;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = B.GlobalCol(jLoc);
+        const Int iLocBeg =
+          ( uplo == LOWER ? Length(j,colShift,colStride) : 0 );
+        const Int iLocEnd =
+          ( uplo == LOWER ? localHeight : Length(j+1,colShift,colStride) );
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            BBuf[iLoc+jLoc*BLDim] += alpha*buffer[offset++];
+    }
+}
+
+} // namespace syrk
+} // namespace El
@@ -116,7 +116,7 @@ void LN_Dot
 
         Z.Resize( nbOuter, nbOuter );
         Syrk( LOWER, NORMAL, alpha, A1.Matrix(), Z.Matrix(), conjugate );
-        AxpyContract( T(1), Z, C11 );
+        AxpyContractTrapezoid( LOWER, T(1), Z, C11 );
 
         for( Int kInner=kOuter+nbOuter; kInner<n; kInner+=blockSize )
         {
@@ -126,7 +126,7 @@ void LN_Dot
             auto A2 = A( indInner, ALL );
             auto C21 = C( indInner, indOuter );
 
-            LocalGemm( NORMAL, orient, alpha, A1, A2, Z );
+            LocalGemm( NORMAL, orient, alpha, A2, A1, Z );
             AxpyContract( T(1), Z, C21 ); 
         }
     }
@@ -151,7 +151,7 @@ void LN
 
     const double weightAwayFromDot = 10.;
 
-    const Int blockSizeDot = 2000;
+    const Int blockSizeDot = SyrkDotBlocksize<T>();
 
     if( r > weightAwayFromDot*n ) 
         LN_Dot( alpha, A, C, conjugate, blockSizeDot );
@@ -83,7 +83,7 @@ void LT_Dot
 
         Z.Resize( nbOuter, nbOuter );
         Syrk( LOWER, TRANSPOSE, alpha, A1.Matrix(), Z.Matrix(), conjugate );
-        AxpyContract( T(1), Z, C11 );
+        AxpyContractTrapezoid( LOWER, T(1), Z, C11 );
 
         for( Int kInner=kOuter+nbOuter; kInner<n; kInner+=blockSize )
         {
@@ -93,7 +93,7 @@ void LT_Dot
             auto A2 = A( ALL, indInner );
             auto C21 = C( indInner, indOuter );
 
-            LocalGemm( orient, NORMAL, alpha, A1, A2, Z );
+            LocalGemm( orient, NORMAL, alpha, A2, A1, Z );
             AxpyContract( T(1), Z, C21 );
         }
     }
@@ -118,7 +118,7 @@ void LT
 
     const double weightAwayFromDot = 10.;
 
-    const Int blockSizeDot = 2000;
+    const Int blockSizeDot = SyrkDotBlocksize<T>();
 
     if( r > weightAwayFromDot*n )
         LT_Dot( alpha, A, C, conjugate, blockSizeDot );
@@ -79,7 +79,7 @@ void UN_Dot
 
         Z.Resize( nbOuter, nbOuter );
         Syrk( UPPER, NORMAL, alpha, A1.Matrix(), Z.Matrix(), conjugate );
-        AxpyContract( T(1), Z, C11 );
+        AxpyContractTrapezoid( UPPER, T(1), Z, C11 );
 
         for( Int kInner=0; kInner<kOuter; kInner+=blockSize )
         {
@@ -89,7 +89,7 @@ void UN_Dot
             auto A2 = A( indInner, ALL );
             auto C21 = C( indInner, indOuter );
 
-            LocalGemm( NORMAL, orient, alpha, A1, A2, Z );
+            LocalGemm( NORMAL, orient, alpha, A2, A1, Z );
             AxpyContract( T(1), Z, C21 );
         }
     }
@@ -114,7 +114,7 @@ void UN
 
     const double weightAwayFromDot = 10.;
 
-    const Int blockSizeDot = 2000;
+    const Int blockSizeDot = SyrkDotBlocksize<T>();
 
     if( r > weightAwayFromDot*n )
         UN_Dot( alpha, A, C, conjugate, blockSizeDot );
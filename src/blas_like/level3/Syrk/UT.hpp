@@ -83,7 +83,7 @@ void UT_Dot
 
         Z.Resize( nbOuter, nbOuter );
         Syrk( UPPER, TRANSPOSE, alpha, A1.Matrix(), Z.Matrix(), conjugate );
-        AxpyContract( T(1), Z, C11 );
+        AxpyContractTrapezoid( UPPER, T(1), Z, C11 );
 
         for( Int kInner=0; kInner<kOuter; kInner+=blockSize )
         {
@@ -93,7 +93,7 @@ void UT_Dot
             auto A2 = A( ALL, indInner );
             auto C21 = C( indInner, indOuter );
 
-            LocalGemm( orient, NORMAL, alpha, A1, A2, Z );
+            LocalGemm( orient, NORMAL, alpha, A2, A1, Z );
             AxpyContract( T(1), Z, C21 );
         }
     }
@@ -118,7 +118,7 @@ void UT
 
     const double weightAwayFromDot = 10.;
 
-    const Int blockSizeDot = 2000;
+    const Int blockSizeDot = SyrkDotBlocksize<T>();
 
     if( r > weightAwayFromDot*n )
         UT_Dot( alpha, A, C, conjugate, blockSizeDot );
@@ -18,6 +18,7 @@
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Narrow.hpp"
 
 namespace El {
 
@@ -33,6 +34,7 @@ void Trsm
   bool checkIfSingular )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Trsm");
     DEBUG_ONLY(
       if( A.Height() != A.Width() )
           LogicError("Triangular matrix must be square");
@@ -76,6 +78,7 @@ void Trsm
   bool checkIfSingular, TrsmAlgorithm alg )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Trsm");
     DEBUG_ONLY(
       AssertSameGrids( A, B );
       if( A.Height() != A.Width() )
@@ -99,6 +102,19 @@ void Trsm
         Trsv( uplo, orientation, diag, A, B );
         return;
     }
+
+    // Consult the tuning table for the blocksize and, when the default
+    // algorithm was requested, for the choice between the large and medium
+    // right-hand side algorithms
+    const Grid& g = B.Grid();
+    TunedBlocksizeScope scope( TUNE_TRSM, A.Height(), g.Height(), g.Width() );
+    if( alg == TRSM_DEFAULT )
+    {
+        const Int variant =
+          TunedVariant( TUNE_TRSM, A.Height(), g.Height(), g.Width() );
+        if( variant == TRSM_LARGE || variant == TRSM_MEDIUM )
+            alg = static_cast<TrsmAlgorithm>(variant);
+    }
     // TODO: Compute appropriate transpose/conjugation options to convert
     //       to Trsv.
     /*
@@ -109,6 +125,28 @@ void Trsm
     }
     */
 
+    // Call the fan-in algorithms for a handful of right-hand sides
+    if( side == LEFT &&
+        (alg == TRSM_NARROW ||
+         (alg == TRSM_DEFAULT && B.Width() <= trsm::NARROW_TRSM_MAX_WIDTH)) )
+    {
+        if( uplo == LOWER )
+        {
+            if( orientation == NORMAL )
+                trsm::LLNNarrow( diag, A, B, checkIfSingular );
+            else
+                trsm::LLTNarrow( orientation, diag, A, B, checkIfSingular );
+        }
+        else
+        {
+            if( orientation == NORMAL )
+                trsm::LUNNarrow( diag, A, B, checkIfSingular );
+            else
+                trsm::LUTNarrow( orientation, diag, A, B, checkIfSingular );
+        }
+        return;
+    }
+
     const Int p = B.Grid().Size();
     if( side == LEFT && uplo == LOWER )
     {
@@ -397,6 +435,112 @@ void LocalTrsm
       alpha, A.LockedMatrix(), X.Matrix(), checkIfSingular );
 }
 
+namespace trsm {
+
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+void BlockHelper
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B )
+{
+#ifdef EL_HAVE_SCALAPACK
+    const int bHandle = blacs::Handle( B );
+    const int context = blacs::GridInit( bHandle, B );
+    auto descA = FillDesc( A, context );
+    auto descB = FillDesc( B, context );
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    pblas::Trsm
+    ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
+      alpha, A.LockedBuffer(), descA.data(), B.Buffer(), descB.data() );
+    blacs::FreeGrid( context );
+    blacs::FreeHandle( bHandle );
+#else
+    const AbstractDistMatrix<F>& AAbs = A;
+    AbstractDistMatrix<F>& BAbs = B;
+    Trsm( side, uplo, orientation, diag, alpha, AAbs, BAbs );
+#endif
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+void BlockHelper
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B )
+{
+    // Fall back to (proxies for) the element-cyclic implementation
+    const AbstractDistMatrix<F>& AAbs = A;
+    AbstractDistMatrix<F>& BAbs = B;
+    Trsm( side, uplo, orientation, diag, alpha, AAbs, BAbs );
+}
+
+} // namespace trsm
+
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("Trsm");
+    DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != (side==LEFT ? B.Height() : B.Width()) )
+          LogicError("Nonconformal Trsm");
+    )
+    trsm::BlockHelper( side, uplo, orientation, diag, alpha, A, B );
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  UnitOrNonUnit diag,
+  F alpha,
+  const TransposedView<Matrix<F>>& A,
+        Matrix<F>& B,
+  bool checkIfSingular )
+{
+    DEBUG_CSE
+    Trsm
+    ( side, uplo, A.Orientation(), diag,
+      alpha, A.Parent(), B, checkIfSingular );
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  UnitOrNonUnit diag,
+  F alpha,
+  const TransposedView<AbstractDistMatrix<F>>& A,
+        AbstractDistMatrix<F>& B,
+  bool checkIfSingular,
+  TrsmAlgorithm alg )
+{
+    DEBUG_CSE
+    Trsm
+    ( side, uplo, A.Orientation(), diag,
+      alpha, A.Parent(), B, checkIfSingular, alg );
+}
+
 #define PROTO(F) \
   template void Trsm \
   ( LeftOrRight side, \
@@ -417,6 +561,14 @@ void LocalTrsm
           AbstractDistMatrix<F>& B, \
     bool checkIfSingular, \
     TrsmAlgorithm alg ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const DistMatrix<F,MC,MR,BLOCK>& A, \
+          DistMatrix<F,MC,MR,BLOCK>& B ); \
   template void LocalTrsm \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
@@ -425,7 +577,24 @@ void LocalTrsm
     F alpha, \
     const DistMatrix<F,STAR,STAR>& A, \
           AbstractDistMatrix<F>& X, \
-    bool checkIfSingular );
+    bool checkIfSingular ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const TransposedView<Matrix<F>>& A, \
+          Matrix<F>& B, \
+    bool checkIfSingular ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const TransposedView<AbstractDistMatrix<F>>& A, \
+          AbstractDistMatrix<F>& B, \
+    bool checkIfSingular, \
+    TrsmAlgorithm alg );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,269 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsm {
+
+// TRSM_DEFAULT switches to the narrow algorithms for left solves with at most
+// this many right-hand sides
+const Int NARROW_TRSM_MAX_WIDTH = 8;
+
+// The narrow (fan-in) algorithms generalize the distributed Trsv: rather than
+// redistributing each panel of B and the corresponding panel of the triangle,
+// every process accumulates its local contributions to the unsolved rows of X
+// in a lazily-updated buffer, and only the nb x width portion needed for the
+// next diagonal block is summed (over a single process row or column) before
+// the block is redundantly solved. For a handful of right-hand sides this
+// replaces a sequence of panel broadcasts by small reductions.
+
+// Left Lower Normal
+template<typename F>
+void LLNNarrow
+( UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& LPre,
+        AbstractDistMatrix<F>& XPre,
+  bool checkIfSingular )
+{
+    DEBUG_CSE
+    const Int m = XPre.Height();
+    const Int n = XPre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = LPre.Grid();
+
+    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& L = LProx.GetLocked();
+    auto& X = XProx.Get();
+
+    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    DistMatrix<F,MR,  STAR> X1_MR_STAR(g);
+    DistMatrix<F,MC,  STAR> Z_MC_STAR(g);
+
+    // Z[MC,* ] accumulates the (sums of the) updates to X
+    Z_MC_STAR.AlignWith( L );
+    Z_MC_STAR.Resize( m, n );
+    Zero( Z_MC_STAR );
+
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, m );
+
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+
+        auto X1 = X( ind1, ALL );
+
+        auto Z1_MC_STAR = Z_MC_STAR( ind1, ALL );
+        auto Z2_MC_STAR = Z_MC_STAR( ind2, ALL );
+
+        if( k != 0 )
+            AxpyContract( F(1), Z1_MC_STAR, X1 );
+
+        L11_STAR_STAR = L11;
+        X1_STAR_STAR = X1;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, diag, F(1), L11_STAR_STAR, X1_STAR_STAR,
+          checkIfSingular );
+        X1 = X1_STAR_STAR;
+
+        X1_MR_STAR.AlignWith( L21 );
+        X1_MR_STAR = X1_STAR_STAR;
+        LocalGemm( NORMAL, NORMAL, F(-1), L21, X1_MR_STAR, F(1), Z2_MC_STAR );
+    }
+}
+
+// Left Lower (Conjugate)Transpose
+template<typename F>
+void LLTNarrow
+( Orientation orientation,
+  UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& LPre,
+        AbstractDistMatrix<F>& XPre,
+  bool checkIfSingular )
+{
+    DEBUG_CSE
+    const Int m = XPre.Height();
+    const Int n = XPre.Width();
+    const Int bsize = Blocksize();
+    const Int kLast = LastOffset( m, bsize );
+    const Grid& g = LPre.Grid();
+
+    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& L = LProx.GetLocked();
+    auto& X = XProx.Get();
+
+    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR> X1_MC_STAR(g);
+    DistMatrix<F,MR,  MC  > Z1_MR_MC(g);
+    DistMatrix<F,MR,  STAR> Z_MR_STAR(g);
+
+    Z_MR_STAR.AlignWith( L );
+    Z_MR_STAR.Resize( m, n );
+    Zero( Z_MR_STAR );
+
+    for( Int k=kLast; k>=0; k-=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+
+        const Range<Int> ind0( 0, k ), ind1( k, k+nb );
+
+        auto L10 = L( ind1, ind0 );
+        auto L11 = L( ind1, ind1 );
+
+        auto X1 = X( ind1, ALL );
+
+        auto Z0_MR_STAR = Z_MR_STAR( ind0, ALL );
+        auto Z1_MR_STAR = Z_MR_STAR( ind1, ALL );
+
+        if( k+nb != m )
+        {
+            Contract( Z1_MR_STAR, Z1_MR_MC );
+            X1 += Z1_MR_MC;
+        }
+
+        L11_STAR_STAR = L11;
+        X1_STAR_STAR = X1;
+        LocalTrsm
+        ( LEFT, LOWER, orientation, diag, F(1), L11_STAR_STAR, X1_STAR_STAR,
+          checkIfSingular );
+        X1 = X1_STAR_STAR;
+
+        X1_MC_STAR.AlignWith( L10 );
+        X1_MC_STAR = X1_STAR_STAR;
+        LocalGemm
+        ( orientation, NORMAL, F(-1), L10, X1_MC_STAR, F(1), Z0_MR_STAR );
+    }
+}
+
+// Left Upper Normal
+template<typename F>
+void LUNNarrow
+( UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& UPre,
+        AbstractDistMatrix<F>& XPre,
+  bool checkIfSingular )
+{
+    DEBUG_CSE
+    const Int m = XPre.Height();
+    const Int n = XPre.Width();
+    const Int bsize = Blocksize();
+    const Int kLast = LastOffset( m, bsize );
+    const Grid& g = UPre.Grid();
+
+    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& U = UProx.GetLocked();
+    auto& X = XProx.Get();
+
+    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
+    DistMatrix<F,MR,  STAR> X1_MR_STAR(g);
+    DistMatrix<F,MC,  STAR> Z_MC_STAR(g);
+
+    Z_MC_STAR.AlignWith( U );
+    Z_MC_STAR.Resize( m, n );
+    Zero( Z_MC_STAR );
+
+    for( Int k=kLast; k>=0; k-=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+
+        const Range<Int> ind0( 0, k ), ind1( k, k+nb );
+
+        auto U01 = U( ind0, ind1 );
+        auto U11 = U( ind1, ind1 );
+
+        auto X1 = X( ind1, ALL );
+
+        auto Z0_MC_STAR = Z_MC_STAR( ind0, ALL );
+        auto Z1_MC_STAR = Z_MC_STAR( ind1, ALL );
+
+        if( k+nb != m )
+            AxpyContract( F(1), Z1_MC_STAR, X1 );
+
+        U11_STAR_STAR = U11;
+        X1_STAR_STAR = X1;
+        LocalTrsm
+        ( LEFT, UPPER, NORMAL, diag, F(1), U11_STAR_STAR, X1_STAR_STAR,
+          checkIfSingular );
+        X1 = X1_STAR_STAR;
+
+        X1_MR_STAR.AlignWith( U01 );
+        X1_MR_STAR = X1_STAR_STAR;
+        LocalGemm( NORMAL, NORMAL, F(-1), U01, X1_MR_STAR, F(1), Z0_MC_STAR );
+    }
+}
+
+// Left Upper (Conjugate)Transpose
+template<typename F>
+void LUTNarrow
+( Orientation orientation,
+  UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& UPre,
+        AbstractDistMatrix<F>& XPre,
+  bool checkIfSingular )
+{
+    DEBUG_CSE
+    const Int m = XPre.Height();
+    const Int n = XPre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = UPre.Grid();
+
+    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& U = UProx.GetLocked();
+    auto& X = XProx.Get();
+
+    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR> X1_MC_STAR(g);
+    DistMatrix<F,MR,  MC  > Z1_MR_MC(g);
+    DistMatrix<F,MR,  STAR> Z_MR_STAR(g);
+
+    Z_MR_STAR.AlignWith( U );
+    Z_MR_STAR.Resize( m, n );
+    Zero( Z_MR_STAR );
+
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, m );
+
+        auto U11 = U( ind1, ind1 );
+        auto U12 = U( ind1, ind2 );
+
+        auto X1 = X( ind1, ALL );
+
+        auto Z1_MR_STAR = Z_MR_STAR( ind1, ALL );
+        auto Z2_MR_STAR = Z_MR_STAR( ind2, ALL );
+
+        if( k != 0 )
+        {
+            Contract( Z1_MR_STAR, Z1_MR_MC );
+            X1 += Z1_MR_MC;
+        }
+
+        U11_STAR_STAR = U11;
+        X1_STAR_STAR = X1;
+        LocalTrsm
+        ( LEFT, UPPER, orientation, diag, F(1), U11_STAR_STAR, X1_STAR_STAR,
+          checkIfSingular );
+        X1 = X1_STAR_STAR;
+
+        X1_MC_STAR.AlignWith( U12 );
+        X1_MC_STAR = X1_STAR_STAR;
+        LocalGemm
+        ( orientation, NORMAL, F(-1), U12, X1_MC_STAR, F(1), Z2_MR_STAR );
+    }
+}
+
+} // namespace trsm
+} // namespace El
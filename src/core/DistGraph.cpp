@@ -21,8 +21,24 @@
 */
 #include <El-lite.hpp>
 
+namespace {
+bool neighborCollectives = true;
+} // anonymous namespace
+
 namespace El {
 
+void EnableNeighborCollectives() { ::neighborCollectives = true; }
+void DisableNeighborCollectives() { ::neighborCollectives = false; }
+
+bool NeighborCollectives()
+{
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    return ::neighborCollectives;
+#else
+    return false;
+#endif
+}
+
 // Constructors and destructors
 // ============================
 // TODO: Always duplicate the communicator and do not treat mpi::COMM_WORLD
@@ -681,7 +697,7 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
     for( Int e=0; e<numLocalEntries; ++e )
         uniqueCols[e] = ValueInt<Int>{colBuffer[e],e};
     std::sort( uniqueCols.begin(), uniqueCols.end(), ValueInt<Int>::Lesser );
-    meta.colOffs.resize(numLocalEntries);
+    FastResize( meta.colOffs, numLocalEntries );
     {
         Int uniqueOff=-1, lastUnique=-1;
         for( Int e=0; e<numLocalEntries; ++e )
@@ -697,14 +713,19 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
         uniqueCols.resize( uniqueOff+1 );
     }
     const Int numRecvInds = uniqueCols.size();
+    Int vecBlocksize = NumTargets() / commSize;
+    if( vecBlocksize*commSize < NumTargets() || NumTargets() == 0 )
+        ++vecBlocksize;
+    if( numRecvInds > Int(std::numeric_limits<LocalInt>::max()) ||
+        vecBlocksize > Int(std::numeric_limits<LocalInt>::max()) )
+        LogicError
+        ("The local column space of size ",Max(numRecvInds,vecBlocksize),
+         " does not fit within a LocalInt");
     meta.numRecvInds = numRecvInds;
     vector<Int> recvInds( numRecvInds );
     meta.recvSizes.clear();
     meta.recvSizes.resize( commSize, 0 );
     meta.recvOffs.resize( commSize );
-    Int vecBlocksize = NumTargets() / commSize;
-    if( vecBlocksize*commSize < NumTargets() || NumTargets() == 0 )
-        ++vecBlocksize;
 
     {
         Int off=0, lastOff=0, qPrev=0;
@@ -733,8 +754,64 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
     }
 
     // Coordinate
-    meta.sendSizes.resize( commSize );
-    mpi::AllToAll( meta.recvSizes.data(), 1, meta.sendSizes.data(), 1, comm );
+    meta.sendSizes.clear();
+    meta.sendSizes.resize( commSize, 0 );
+    // Any communicators from a previous formation are released (once no
+    // copies of the metadata hold them)
+    meta.neighborComm.reset();
+    meta.adjointNeighborComm.reset();
+    SwapClear( meta.neighborSources );
+    SwapClear( meta.neighborDests );
+    if( NeighborCollectives() )
+    {
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+        // Form the distributed graph with an edge from each process we need
+        // indices from to ourself, so that MPI determines which processes
+        // need indices from us without an exchange over the entire
+        // communicator
+        const int commRank = mpi::Rank( comm );
+        vector<int> owners, ownerDegrees;
+        for( int q=0; q<commSize; ++q )
+            if( meta.recvSizes[q] > 0 )
+                owners.push_back( q );
+        ownerDegrees.resize( owners.size(), 1 );
+        vector<int> ownerTargets( owners.size(), commRank );
+        auto freeComm = []( mpi::Comm* graphComm )
+          {
+              if( !mpi::Finalized() )
+                  mpi::Free( *graphComm );
+              delete graphComm;
+          };
+        meta.neighborComm.reset( new mpi::Comm, freeComm );
+        mpi::DistGraphCreate
+        ( comm, owners.size(), owners.data(), ownerDegrees.data(),
+          ownerTargets.data(), *meta.neighborComm );
+        mpi::DistGraphNeighbors
+        ( *meta.neighborComm, meta.neighborSources, meta.neighborDests );
+        meta.adjointNeighborComm.reset( new mpi::Comm, freeComm );
+        mpi::DistGraphCreateAdjacent
+        ( comm,
+          meta.neighborDests.size(),   meta.neighborDests.data(),
+          meta.neighborSources.size(), meta.neighborSources.data(),
+          *meta.adjointNeighborComm );
+
+        // Exchange the number of indices needed from each of our neighbors
+        vector<int> neighborRecvSizes( meta.neighborSources.size() ),
+                    neighborSendSizes( meta.neighborDests.size() );
+        for( size_t k=0; k<meta.neighborSources.size(); ++k )
+            neighborRecvSizes[k] = meta.recvSizes[meta.neighborSources[k]];
+        mpi::NeighborAllToAll
+        ( neighborRecvSizes.data(), 1, neighborSendSizes.data(), 1,
+          *meta.adjointNeighborComm );
+        for( size_t k=0; k<meta.neighborDests.size(); ++k )
+            meta.sendSizes[meta.neighborDests[k]] = neighborSendSizes[k];
+#endif
+    }
+    else
+    {
+        mpi::AllToAll
+        ( meta.recvSizes.data(), 1, meta.sendSizes.data(), 1, comm );
+    }
     Int numSendInds=0;
     meta.sendOffs.resize( commSize );
     for( int q=0; q<commSize; ++q )
@@ -743,10 +820,66 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
         numSendInds += meta.sendSizes[q];
     }
     meta.sendInds.resize( numSendInds );
-    mpi::AllToAll
-    ( recvInds.data(),      meta.recvSizes.data(), meta.recvOffs.data(),
-      meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
-      comm );
+    if( meta.neighborComm )
+    {
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+        vector<int> sendCounts, sendDispls, recvCounts, recvDispls;
+        meta.NeighborCounts
+        ( true, 1, sendCounts, sendDispls, recvCounts, recvDispls );
+        mpi::NeighborAllToAll
+        ( recvInds.data(),      sendCounts.data(), sendDispls.data(),
+          meta.sendInds.data(), recvCounts.data(), recvDispls.data(),
+          *meta.adjointNeighborComm );
+#endif
+    }
+    else
+    {
+        mpi::AllToAll
+        ( recvInds.data(),      meta.recvSizes.data(), meta.recvOffs.data(),
+          meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+          comm );
+    }
+
+    // Split our sources by whether all of their targets are within our own
+    // block of the vector
+    const Int firstLocalTarget = Min( commRank_*vecBlocksize, NumTargets() );
+    const Int lastLocalTarget =
+      Min( firstLocalTarget+vecBlocksize, NumTargets() );
+    const Int* offsetBuffer = LockedOffsetBuffer();
+    meta.interiorSources.clear();
+    meta.boundarySources.clear();
+    meta.interiorEdgeOffs.assign( 1, 0 );
+    meta.boundaryEdgeOffs.assign( 1, 0 );
+    FastResize( meta.localColOffs, numLocalEntries );
+    for( Int sLoc=0; sLoc<numLocalSources_; ++sLoc )
+    {
+        const Int eBeg = offsetBuffer[sLoc];
+        const Int eEnd = offsetBuffer[sLoc+1];
+        bool interior = true;
+        for( Int e=eBeg; e<eEnd; ++e )
+        {
+            if( colBuffer[e] < firstLocalTarget ||
+                colBuffer[e] >= lastLocalTarget )
+            {
+                interior = false;
+                break;
+            }
+        }
+        if( interior )
+        {
+            for( Int e=eBeg; e<eEnd; ++e )
+                meta.localColOffs[e] = colBuffer[e] - firstLocalTarget;
+            meta.interiorSources.push_back( sLoc );
+            meta.interiorEdgeOffs.push_back
+            ( meta.interiorEdgeOffs.back() + (eEnd-eBeg) );
+        }
+        else
+        {
+            meta.boundarySources.push_back( sLoc );
+            meta.boundaryEdgeOffs.push_back
+            ( meta.boundaryEdgeOffs.back() + (eEnd-eBeg) );
+        }
+    }
 
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
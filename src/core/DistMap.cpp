@@ -44,68 +44,93 @@ DistMap::~DistMap()
 void DistMap::Translate( vector<Int>& localInds ) const
 {
     DEBUG_CSE
-    vector<int> origOwners;
-    if( origOwners.size() != localInds.size() )
-    {
-        const Int numLocalInds = localInds.size();
-        origOwners.resize( numLocalInds );
-        for( Int s=0; s<numLocalInds; ++s )
-        {
-            const Int i = localInds[s];
-            if( i < numSources_ )
-                origOwners[s] = i / blocksize_;
-            else
-                origOwners[s] = -1;
-        }
-    }
-    Translate( localInds, origOwners );
+    DistMapTranslationPlan plan;
+    FormTranslationPlan( localInds, plan );
+    Translate( localInds, plan );
 }
 
 void DistMap::Translate
 ( vector<Int>& localInds, const vector<int>& origOwners ) const
+{
+    DEBUG_CSE
+    DistMapTranslationPlan plan;
+    FormTranslationPlan( localInds, origOwners, plan );
+    Translate( localInds, plan );
+}
+
+void DistMap::FormTranslationPlan
+( const vector<Int>& localInds, DistMapTranslationPlan& plan ) const
 {
     DEBUG_CSE
     const Int numLocalInds = localInds.size();
+    vector<int> origOwners( numLocalInds );
+    for( Int s=0; s<numLocalInds; ++s )
+    {
+        const Int i = localInds[s];
+        if( i < numSources_ )
+            origOwners[s] = i / blocksize_;
+        else
+            origOwners[s] = -1;
+    }
+    FormTranslationPlan( localInds, origOwners, plan );
+}
+
+void DistMap::FormTranslationPlan
+( const vector<Int>& localInds,
+  const vector<int>& origOwners,
+        DistMapTranslationPlan& plan ) const
+{
+    DEBUG_CSE
+    const Int numLocalInds = localInds.size();
+    plan.numSources = numSources_;
 
     // Count how many indices we need each process to map
     // Avoid unncessary branching within the loop by avoiding RowToProcess
-    vector<int> requestSizes( commSize_, 0 );
+    plan.requestSizes.assign( commSize_, 0 );
     for( Int s=0; s<numLocalInds; ++s )
     {
         const Int i = localInds[s];
         if( i < numSources_ )
-            ++requestSizes[origOwners[s]];
+            ++plan.requestSizes[origOwners[s]];
     }
 
     // Send our requests and find out what we need to fulfill
-    vector<int> fulfillSizes( commSize_ );
-    mpi::AllToAll( requestSizes.data(), 1, fulfillSizes.data(), 1, comm_ );
+    plan.fulfillSizes.resize( commSize_ );
+    mpi::AllToAll
+    ( plan.requestSizes.data(), 1, plan.fulfillSizes.data(), 1, comm_ );
 
     // Prepare for the AllToAll to exchange request sizes
-    vector<int> requestOffs, fulfillOffs;
-    const int numRequests = Scan( requestSizes, requestOffs );
-    const int numFulfills = Scan( fulfillSizes, fulfillOffs );
+    const int numRequests = Scan( plan.requestSizes, plan.requestOffs );
+    const int numFulfills = Scan( plan.fulfillSizes, plan.fulfillOffs );
 
-    // Pack the requested information 
-    vector<int> requests( numRequests );
-    auto offs = requestOffs;
+    // Pack the requested information, remembering where each index went
+    vector<Int> requests( numRequests );
+    FastResize( plan.requestSlots, numLocalInds );
+    auto offs = plan.requestOffs;
     for( Int s=0; s<numLocalInds; ++s )
     {
         const Int i = localInds[s];
         if( i < numSources_ )
-            requests[offs[origOwners[s]]++] = i;
+        {
+            const Int slot = offs[origOwners[s]]++;
+            requests[slot] = i;
+            plan.requestSlots[s] = slot;
+        }
+        else
+            plan.requestSlots[s] = -1;
     }
 
-    // Perform the first index exchange
-    vector<int> fulfills( numFulfills );
+    // Perform the index exchange
+    FastResize( plan.fulfillLocalSources, numFulfills );
     mpi::AllToAll
-    ( requests.data(), requestSizes.data(), requestOffs.data(),
-      fulfills.data(), fulfillSizes.data(), fulfillOffs.data(), comm_ );
+    ( requests.data(), plan.requestSizes.data(), plan.requestOffs.data(),
+      plan.fulfillLocalSources.data(),
+      plan.fulfillSizes.data(), plan.fulfillOffs.data(), comm_ );
 
-    // Map all of the indices in 'fulfills'
+    // Convert the requested sources into local indices
     for( int s=0; s<numFulfills; ++s )
     {
-        const Int i = fulfills[s];
+        const Int i = plan.fulfillLocalSources[s];
         const Int iLocal = i - blocksize_*commRank_;
         DEBUG_ONLY(
           if( iLocal < 0 || iLocal >= (Int)map_.size() )
@@ -113,22 +138,46 @@ void DistMap::Translate
               ("invalid request: i=",i,", iLocal=",iLocal,
                ", commRank=",commRank_,", blocksize=",blocksize_);
         )
-        fulfills[s] = map_[iLocal];
+        plan.fulfillLocalSources[s] = iLocal;
     }
+}
+
+void DistMap::Translate
+( vector<Int>& localInds, const DistMapTranslationPlan& plan ) const
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( plan.numSources != numSources_ )
+          LogicError
+          ("Plan was formed for ",plan.numSources," sources but the map has ",
+           numSources_);
+      if( plan.requestSlots.size() != localInds.size() )
+          LogicError("Plan was formed for a different number of indices");
+    )
+    const Int numLocalInds = localInds.size();
+    const Int numFulfills = plan.fulfillLocalSources.size();
+    const Int numRequests = plan.requestSizes.back()+plan.requestOffs.back();
+
+    // Map all of the requested indices
+    vector<Int> fulfills( numFulfills );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numFulfills; ++s )
+        fulfills[s] = map_[plan.fulfillLocalSources[s]];
 
     // Send everything back
+    vector<Int> requests( numRequests );
     mpi::AllToAll
-    ( fulfills.data(), fulfillSizes.data(), fulfillOffs.data(),
-      requests.data(), requestSizes.data(), requestOffs.data(), comm_ );
+    ( fulfills.data(), plan.fulfillSizes.data(), plan.fulfillOffs.data(),
+      requests.data(), plan.requestSizes.data(), plan.requestOffs.data(),
+      comm_ );
 
     // Unpack in the same way we originally packed
-    // Avoid unncessary branching within the loop by avoiding RowToProcess
-    offs = requestOffs;
+    EL_PARALLEL_FOR
     for( Int s=0; s<numLocalInds; ++s )
     {
-        const Int i = localInds[s];
-        if( i < numSources_ )
-            localInds[s] = requests[offs[origOwners[s]]++];
+        const Int slot = plan.requestSlots[s];
+        if( slot >= 0 )
+            localInds[s] = requests[slot];
     }
 }
 
@@ -433,6 +433,17 @@ extern "C" {
   ElError ElDistMatrixQueueUpdate_ ## SIG \
   ( ElDistMatrix_ ## SIG A, ElInt i, ElInt j, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueUpdate(i,j,CReflect(value)) ) } \
+  /* void QueueUpdate( Int i, Int j, T value ) for a batch of entries */ \
+  ElError ElDistMatrixQueueUpdates_ ## SIG \
+  ( ElDistMatrix_ ## SIG A, ElInt numUpdates, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      auto ACpp = CReflect(A); \
+      auto valuesCpp = CReflect(values); \
+      ACpp->Reserve( numUpdates ); \
+      for( ElInt k=0; k<numUpdates; ++k ) \
+          ACpp->QueueUpdate( rows[k], cols[k], valuesCpp[k] ); \
+    ) } \
   /* void ProcessQueues() */ \
   ElError ElDistMatrixProcessQueues_ ## SIG( ElDistMatrix_ ## SIG A ) \
   { EL_TRY( CReflect(A)->ProcessQueues() ) } \
@@ -448,6 +459,50 @@ extern "C" {
   ElError ElDistMatrixProcessPullQueue_ ## SIG \
   ( ElConstDistMatrix_ ## SIG A, CREFLECT(T)* pullBuf ) \
   { EL_TRY( CReflect(A)->ProcessPullQueue( CReflect(pullBuf) ) ) } \
+  /* void QueuePull( Int i, Int j ) const for a batch of entries */ \
+  ElError ElDistMatrixQueuePulls_ ## SIG \
+  ( ElConstDistMatrix_ ## SIG A, ElInt numPulls, \
+    const ElInt* rows, const ElInt* cols ) \
+  { EL_TRY( \
+      auto ACpp = CReflect(A); \
+      ACpp->ReservePulls( numPulls ); \
+      for( ElInt k=0; k<numPulls; ++k ) \
+          ACpp->QueuePull( rows[k], cols[k] ); \
+    ) } \
+  /* Copy a height x width block of the local matrix into buf */ \
+  ElError ElDistMatrixGetLocalBlock_ ## SIG \
+  ( ElConstDistMatrix_ ## SIG A, ElInt iLoc, ElInt jLoc, \
+    ElInt height, ElInt width, CREFLECT(T)* buf, ElInt ldim ) \
+  { EL_TRY( \
+      auto ALoc = \
+        CReflect(A)->LockedMatrix()( IR(iLoc,iLoc+height), \
+                                     IR(jLoc,jLoc+width) ); \
+      Matrix<T> bufMat; \
+      bufMat.Attach( height, width, CReflect(buf), ldim ); \
+      Copy( ALoc, bufMat ); \
+    ) } \
+  /* Overwrite a height x width block of the local matrix with buf */ \
+  ElError ElDistMatrixSetLocalBlock_ ## SIG \
+  ( ElDistMatrix_ ## SIG A, ElInt iLoc, ElInt jLoc, \
+    ElInt height, ElInt width, const CREFLECT(T)* buf, ElInt ldim ) \
+  { EL_TRY( \
+      auto ALoc = \
+        CReflect(A)->Matrix()( IR(iLoc,iLoc+height), IR(jLoc,jLoc+width) ); \
+      Matrix<T> bufMat; \
+      bufMat.LockedAttach( height, width, CReflect(buf), ldim ); \
+      Copy( bufMat, ALoc ); \
+    ) } \
+  /* Add a height x width block in buf onto the local matrix */ \
+  ElError ElDistMatrixUpdateLocalBlock_ ## SIG \
+  ( ElDistMatrix_ ## SIG A, ElInt iLoc, ElInt jLoc, \
+    ElInt height, ElInt width, const CREFLECT(T)* buf, ElInt ldim ) \
+  { EL_TRY( \
+      auto ALoc = \
+        CReflect(A)->Matrix()( IR(iLoc,iLoc+height), IR(jLoc,jLoc+width) ); \
+      Matrix<T> bufMat; \
+      bufMat.LockedAttach( height, width, CReflect(buf), ldim ); \
+      Axpy( T(1), bufMat, ALoc ); \
+    ) } \
   /* T GetLocal( Int iLoc, Int jLoc ) const */ \
   ElError ElDistMatrixGetLocal_ ## SIG \
   ( ElConstDistMatrix_ ## SIG A, ElInt iLoc, ElInt jLoc, CREFLECT(T)* val ) \
@@ -587,60 +587,102 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
 
     // Compute the metadata
     // ====================
+    // Rather than sending the global (i,j) coordinates of each update, the
+    // sender computes the offset, iLoc + jLoc*localHeight, of the entry within
+    // the owner's local matrix, so that a single index accompanies each value
     mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
     if( includeViewers )
-    {
         comm = g.ViewingComm();
-        const int commSize = mpi::Size( comm );
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            const Entry<T>& entry = remoteUpdates[k];
-            const int distOwner = Owner(entry.i,entry.j);
-            const int vcOwner = g.CoordsToVC(colDist,rowDist,distOwner,root);
-            const int owner = g.VCToViewing(vcOwner);
-            owners[k] = owner;
-            ++sendCounts[owner];
-        }
-    }
     else
     {
         if( !Participating() )
             return;
         comm = g.VCComm();
-        const int commSize = mpi::Size( comm );
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            const Entry<T>& entry = remoteUpdates[k];
-            const int distOwner = Owner(entry.i,entry.j);
-            const int owner = g.CoordsToVC(colDist,rowDist,distOwner,root);
-            owners[k] = owner;
-            ++sendCounts[owner];
-        }
+    }
+    const int commSize = mpi::Size( comm );
+    vector<int> sendCounts(commSize,0), owners(totalSend);
+    vector<Int> offsets(totalSend);
+    for( Int k=0; k<totalSend; ++k )
+    {
+        const Entry<T>& entry = remoteUpdates[k];
+        const int rowOwner = RowOwner(entry.i);
+        const int colOwner = ColOwner(entry.j);
+        const int distOwner = Owner(entry.i,entry.j);
+        const int vcOwner = g.CoordsToVC(colDist,rowDist,distOwner,root);
+        const int owner = ( includeViewers ? g.VCToViewing(vcOwner) : vcOwner );
+        owners[k] = owner;
+        offsets[k] = LocalRowOffset(entry.i,rowOwner) +
+                     LocalColOffset(entry.j,colOwner)*
+                     LocalRowOffset(Height(),rowOwner);
+        ++sendCounts[owner];
     }
 
     // Pack the data
     // =============
+    // Assembly routines frequently update the same entry many times, so the
+    // updates destined for each process are sorted by offset and summed
     vector<int> sendOffs;
     Scan( sendCounts, sendOffs );
-    vector<Entry<T>> sendBuf(totalSend);
+    vector<pair<Int,T>> sendPairs(totalSend);
     auto offs = sendOffs;
     for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteUpdates[k];
+        sendPairs[offs[owners[k]]++] =
+          pair<Int,T>(offsets[k],remoteUpdates[k].value);
     SwapClear( remoteUpdates );
+    SwapClear( offsets );
+    SwapClear( owners );
+
+    vector<Int> sendIndices;
+    vector<T> sendValues;
+    sendIndices.reserve( totalSend );
+    sendValues.reserve( totalSend );
+    for( int q=0; q<commSize; ++q )
+    {
+        auto beg = sendPairs.begin() + sendOffs[q];
+        auto end = beg + sendCounts[q];
+        std::sort
+        ( beg, end,
+          []( const pair<Int,T>& a, const pair<Int,T>& b )
+          { return a.first < b.first; } );
+        const Int numBefore = sendIndices.size();
+        for( auto it=beg; it!=end; ++it )
+        {
+            if( Int(sendIndices.size()) > numBefore &&
+                sendIndices.back() == it->first )
+                sendValues.back() += it->second;
+            else
+            {
+                sendIndices.push_back( it->first );
+                sendValues.push_back( it->second );
+            }
+        }
+        sendCounts[q] = sendIndices.size() - numBefore;
+    }
+    SwapClear( sendPairs );
+    Scan( sendCounts, sendOffs );
 
     // Exchange and unpack the data
     // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    Int recvBufSize = recvBuf.size();
+    auto recvIndices = mpi::AllToAll( sendIndices, sendCounts, sendOffs, comm );
+    auto recvValues = mpi::AllToAll( sendValues, sendCounts, sendOffs, comm );
+    Int recvBufSize = recvValues.size();
     mpi::Broadcast( recvBufSize, 0, RedundantComm() );
-    recvBuf.resize( recvBufSize );
-    mpi::Broadcast( recvBuf.data(), recvBufSize, 0, RedundantComm() );
-    // TODO: Make this loop faster
-    for( const auto& entry : recvBuf )
-        UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+    recvIndices.resize( recvBufSize );
+    recvValues.resize( recvBufSize );
+    mpi::Broadcast( recvIndices.data(), recvBufSize, 0, RedundantComm() );
+    mpi::Broadcast( recvValues.data(), recvBufSize, 0, RedundantComm() );
+    if( recvBufSize == 0 )
+        return;
+
+    const Int localHeight = LocalHeight();
+    T* buffer = Buffer();
+    const Int ldim = LDim();
+    for( Int k=0; k<recvBufSize; ++k )
+    {
+        const Int iLoc = recvIndices[k] % localHeight;
+        const Int jLoc = recvIndices[k] / localHeight;
+        buffer[iLoc+jLoc*ldim] += recvValues[k];
+    }
 }
 
 template<typename T>
@@ -669,43 +711,35 @@ void AbstractDistMatrix<T>::ProcessPullQueue( T* pullBuf, bool includeViewers )
 
     // Compute the metadata
     // ====================
+    // As in ProcessQueues, each request is sent as the offset of the entry
+    // within the owner's local matrix rather than as its global coordinates
     mpi::Comm comm;
-    int commSize;
-    vector<int> recvCounts, owners(totalRecv);
     if( includeViewers )
-    {
         comm = g.ViewingComm();
-        commSize = mpi::Size( comm );
-        recvCounts.resize(commSize,0);
-        for( Int k=0; k<totalRecv; ++k )
-        {
-            const auto& valueInt = remotePulls_[k];
-            const Int i = valueInt.value;
-            const Int j = valueInt.index;
-            const int distOwner = Owner(i,j);
-            const int vcOwner = g.CoordsToVC(colDist,rowDist,distOwner,root);
-            const int owner = g.VCToViewing(vcOwner);
-            owners[k] = owner;
-            ++recvCounts[owner];
-        }
-    }
     else
     {
         if( !Participating() )
             return;
         comm = g.VCComm();
-        commSize = mpi::Size( comm );
-        recvCounts.resize(commSize,0);
-        for( Int k=0; k<totalRecv; ++k )
-        {
-            const auto& valueInt = remotePulls_[k];
-            const Int i = valueInt.value;
-            const Int j = valueInt.index;
-            const int distOwner = Owner(i,j);
-            const int owner = g.CoordsToVC(colDist,rowDist,distOwner,root);
-            owners[k] = owner;
-            ++recvCounts[owner];
-        }
+    }
+    const int commSize = mpi::Size( comm );
+    vector<int> recvCounts(commSize,0), owners(totalRecv);
+    vector<Int> offsets(totalRecv);
+    for( Int k=0; k<totalRecv; ++k )
+    {
+        const auto& valueInt = remotePulls_[k];
+        const Int i = valueInt.value;
+        const Int j = valueInt.index;
+        const int rowOwner = RowOwner(i);
+        const int colOwner = ColOwner(j);
+        const int distOwner = Owner(i,j);
+        const int vcOwner = g.CoordsToVC(colDist,rowDist,distOwner,root);
+        const int owner = ( includeViewers ? g.VCToViewing(vcOwner) : vcOwner );
+        owners[k] = owner;
+        offsets[k] = LocalRowOffset(i,rowOwner) +
+                     LocalColOffset(j,colOwner)*
+                     LocalRowOffset(Height(),rowOwner);
+        ++recvCounts[owner];
     }
     vector<int> recvOffs;
     Scan( recvCounts, recvOffs );
@@ -715,23 +749,30 @@ void AbstractDistMatrix<T>::ProcessPullQueue( T* pullBuf, bool includeViewers )
     const int totalSend = Scan( sendCounts, sendOffs );
 
     auto offs = recvOffs;
-    vector<ValueInt<Int>> recvCoords(totalRecv);
+    vector<Int> recvIndices(totalRecv);
     for( Int k=0; k<totalRecv; ++k )
-        recvCoords[offs[owners[k]]++] = remotePulls_[k];
-    vector<ValueInt<Int>> sendCoords(totalSend);
+        recvIndices[offs[owners[k]]++] = offsets[k];
+    SwapClear( offsets );
+    vector<Int> sendIndices(totalSend);
     mpi::AllToAll
-    ( recvCoords.data(), recvCounts.data(), recvOffs.data(),
-      sendCoords.data(), sendCounts.data(), sendOffs.data(), comm );
+    ( recvIndices.data(), recvCounts.data(), recvOffs.data(),
+      sendIndices.data(), sendCounts.data(), sendOffs.data(), comm );
 
     // Pack the data
     // =============
     vector<T> sendBuf;
     FastResize( sendBuf, totalSend );
-    for( Int k=0; k<totalSend; ++k )
+    if( totalSend > 0 )
     {
-        const Int i = sendCoords[k].value;
-        const Int j = sendCoords[k].index;
-        sendBuf[k] = GetLocal( LocalRow(i), LocalCol(j) );
+        const Int localHeight = LocalHeight();
+        const T* buffer = LockedBuffer();
+        const Int ldim = LDim();
+        for( Int k=0; k<totalSend; ++k )
+        {
+            const Int iLoc = sendIndices[k] % localHeight;
+            const Int jLoc = sendIndices[k] / localHeight;
+            sendBuf[k] = buffer[iLoc+jLoc*ldim];
+        }
     }
 
     // Exchange and unpack the data
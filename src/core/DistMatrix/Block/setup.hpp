@@ -157,6 +157,28 @@ BDM::DistMatrix( const DistMatrix<T,U,V>& A )
 template<typename T>
 BDM::DistMatrix( BDM&& A ) EL_NO_EXCEPT : BCM(std::move(A)) { } 
 
+template<typename T>
+BDM::DistMatrix( ADM&& A )
+: BCM(A.Grid())
+{
+    DEBUG_CSE
+    if( COLDIST == CIRC && ROWDIST == CIRC )
+        this->matrix_.SetViewType( OWNER );
+    this->SetShifts();
+    *this = std::move(A);
+}
+
+template<typename T>
+BDM::DistMatrix( BCM&& A )
+: BCM(A.Grid())
+{
+    DEBUG_CSE
+    if( COLDIST == CIRC && ROWDIST == CIRC )
+        this->matrix_.SetViewType( OWNER );
+    this->SetShifts();
+    *this = std::move(A);
+}
+
 template<typename T> BDM::~DistMatrix() { }
 
 template<typename T> 
@@ -274,10 +296,47 @@ BDM& BDM::operator=( const DistMatrix<T,U,V>& A )
 template<typename T>
 BDM& BDM::operator=( BDM&& A )
 {
-    if( this->Viewing() || A.Viewing() )
+    DEBUG_CSE
+    // Stealing the buffer of A would violate any alignment constraints on
+    // this matrix which A does not already satisfy
+    const bool misaligned =
+      ( this->ColConstrained() && this->ColAlign() != A.ColAlign() ) ||
+      ( this->RowConstrained() && this->RowAlign() != A.RowAlign() ) ||
+      ( this->RootConstrained() && this->Root() != A.Root() );
+    if( this->Viewing() || A.Viewing() || misaligned )
         this->operator=( (const BDM&)A );
     else
+    {
+        const bool colConstrained = this->colConstrained_;
+        const bool rowConstrained = this->rowConstrained_;
+        const bool rootConstrained = this->rootConstrained_;
         BCM::operator=( std::move(A) );
+        this->colConstrained_ = this->colConstrained_ || colConstrained;
+        this->rowConstrained_ = this->rowConstrained_ || rowConstrained;
+        this->rootConstrained_ = this->rootConstrained_ || rootConstrained;
+    }
+    return *this;
+}
+
+template<typename T>
+BDM& BDM::operator=( BCM&& A )
+{
+    DEBUG_CSE
+    if( A.ColDist() == COLDIST && A.RowDist() == ROWDIST )
+        *this = std::move(static_cast<BDM&>(A));
+    else
+        *this = static_cast<const BCM&>(A);
+    return *this;
+}
+
+template<typename T>
+BDM& BDM::operator=( ADM&& A )
+{
+    DEBUG_CSE
+    if( A.Wrap() == BLOCK )
+        *this = std::move(static_cast<BCM&>(A));
+    else
+        *this = static_cast<const ADM&>(A);
     return *this;
 }
 
@@ -141,6 +141,28 @@ DM::DistMatrix( const DistMatrix<T,U,V,BLOCK>& A )
 template<typename T>
 DM::DistMatrix( DM&& A ) EL_NO_EXCEPT : EM(std::move(A)) { }
 
+template<typename T>
+DM::DistMatrix( ADM&& A )
+: EM(A.Grid())
+{
+    DEBUG_CSE
+    if( COLDIST == CIRC && ROWDIST == CIRC )
+        this->matrix_.SetViewType( OWNER );
+    this->SetShifts();
+    *this = std::move(A);
+}
+
+template<typename T>
+DM::DistMatrix( EM&& A )
+: EM(A.Grid())
+{
+    DEBUG_CSE
+    if( COLDIST == CIRC && ROWDIST == CIRC )
+        this->matrix_.SetViewType( OWNER );
+    this->SetShifts();
+    *this = std::move(A);
+}
+
 template<typename T> DM::~DistMatrix() { }
 
 template<typename T> 
@@ -277,10 +299,46 @@ template<typename T>
 DM& DM::operator=( DM&& A )
 {
     DEBUG_CSE
-    if( this->Viewing() || A.Viewing() )
+    // Stealing the buffer of A would violate any alignment constraints on
+    // this matrix which A does not already satisfy
+    const bool misaligned =
+      ( this->ColConstrained() && this->ColAlign() != A.ColAlign() ) ||
+      ( this->RowConstrained() && this->RowAlign() != A.RowAlign() ) ||
+      ( this->RootConstrained() && this->Root() != A.Root() );
+    if( this->Viewing() || A.Viewing() || misaligned )
         this->operator=( (const DM&)A );
     else
+    {
+        const bool colConstrained = this->colConstrained_;
+        const bool rowConstrained = this->rowConstrained_;
+        const bool rootConstrained = this->rootConstrained_;
         EM::operator=( std::move(A) );
+        this->colConstrained_ = this->colConstrained_ || colConstrained;
+        this->rowConstrained_ = this->rowConstrained_ || rowConstrained;
+        this->rootConstrained_ = this->rootConstrained_ || rootConstrained;
+    }
+    return *this;
+}
+
+template<typename T>
+DM& DM::operator=( EM&& A )
+{
+    DEBUG_CSE
+    if( A.ColDist() == COLDIST && A.RowDist() == ROWDIST )
+        *this = std::move(static_cast<DM&>(A));
+    else
+        *this = static_cast<const EM&>(A);
+    return *this;
+}
+
+template<typename T>
+DM& DM::operator=( ADM&& A )
+{
+    DEBUG_CSE
+    if( A.Wrap() == ELEMENT )
+        *this = std::move(static_cast<EM&>(A));
+    else
+        *this = static_cast<const ADM&>(A);
     return *this;
 }
 
@@ -83,6 +83,17 @@ extern "C" {
   ElError ElDistMultiVecQueueUpdate_ ## SIG \
   ( ElDistMultiVec_ ## SIG A, ElInt i, ElInt j, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueUpdate(i,j,CReflect(value)) ) } \
+  /* void QueueUpdate( Int i, Int j, T value ) for a batch of entries */ \
+  ElError ElDistMultiVecQueueUpdates_ ## SIG \
+  ( ElDistMultiVec_ ## SIG A, ElInt numUpdates, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      auto ACpp = CReflect(A); \
+      auto valuesCpp = CReflect(values); \
+      ACpp->Reserve( numUpdates ); \
+      for( ElInt k=0; k<numUpdates; ++k ) \
+          ACpp->QueueUpdate( rows[k], cols[k], valuesCpp[k] ); \
+    ) } \
   /* void ProcessQueues() */ \
   ElError ElDistMultiVecProcessQueues_ ## SIG( ElDistMultiVec_ ## SIG A ) \
   { EL_TRY( CReflect(A)->ProcessQueues() ) }
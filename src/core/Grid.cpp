@@ -82,6 +82,78 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
     SetUpGrid();
 }
 
+Grid::Grid( mpi::Comm comm, GridLayout layout, GridOrder order )
+: haveViewers_(false), order_(order)
+{
+    DEBUG_CSE
+    size_ = mpi::Size( comm );
+    const int rank = mpi::Rank( comm );
+
+    // Identify each node by the lowest rank it contains
+    mpi::Comm nodeComm;
+    mpi::SplitShared( comm, rank, nodeComm );
+    const int nodeRank = mpi::Rank( nodeComm );
+    int nodeLeader = rank;
+    mpi::Broadcast( nodeLeader, 0, nodeComm );
+    mpi::Free( nodeComm );
+    vector<int> leaders( size_ );
+    mpi::AllGather( &nodeLeader, 1, leaders.data(), 1, comm );
+
+    // Order the processes by node
+    std::map<int,int> nodeSizes;
+    int position = nodeRank;
+    for( int q=0; q<size_; ++q )
+    {
+        ++nodeSizes[leaders[q]];
+        if( leaders[q] < nodeLeader )
+            ++position;
+    }
+
+    // The node-local grid dimension must divide the size of every node, and
+    // we choose the largest such divisor which does not exceed sqrt(p) in
+    // order to keep the grid as square as possible. If no nontrivial choice
+    // exists, fall back to the standard factorization.
+    int nodeGCD = 0;
+    for( const auto& entry : nodeSizes )
+        nodeGCD = El::GCD( nodeGCD, entry.second );
+    const int sqrtSize = Max( int(sqrt(double(size_))), 1 );
+    int localDim = 1;
+    for( int d=1; d<=Min(nodeGCD,sqrtSize); ++d )
+        if( nodeGCD % d == 0 )
+            localDim = d;
+    if( localDim == 1 )
+    {
+        height_ = FindFactor( size_ );
+        layout = NODE_LOCAL_COLS;
+    }
+    else
+        height_ = ( layout==NODE_LOCAL_COLS ? localDim : size_/localDim );
+    const int width = size_ / height_;
+
+    // Fill either the columns or the rows with consecutive processes
+    int mcRank, mrRank;
+    if( layout == NODE_LOCAL_COLS )
+    {
+        mcRank = position % height_;
+        mrRank = position / height_;
+    }
+    else
+    {
+        mcRank = position / width;
+        mrRank = position % width;
+    }
+    const int key =
+      ( order_==COLUMN_MAJOR ? mcRank + mrRank*height_
+                             : mrRank + mcRank*width );
+    mpi::Split( comm, 0, key, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+
+    // All processes own the grid, so we have to trivially split viewingGroup_
+    owningGroup_ = viewingGroup_;
+
+    SetUpGrid();
+}
+
 void Grid::SetUpGrid()
 {
     DEBUG_CSE
@@ -206,14 +278,72 @@ void Grid::SetUpGrid()
     int owningRoot = mpi::Translate( owningGroup_, 0, viewingGroup_ );
     mpi::Broadcast( vcToViewing_.data(), size_, owningRoot, viewingComm_ );
     mpi::Broadcast( diagsAndRanks_.data(), 2*size_, owningRoot, viewingComm_ );
+
+    SetUpTopology();
+}
+
+void Grid::SetUpTopology()
+{
+    DEBUG_CSE
+    int sizes[5] = { 0, 0, 0, 0, 0 };
+    if( InGrid() )
+    {
+        mpi::SplitShared( owningComm_, owningRank_, nodeComm_ );
+        nodeSize_ = mpi::Size( nodeComm_ );
+        int nodeLeader = owningRank_;
+        mpi::Broadcast( nodeLeader, 0, nodeComm_ );
+        const int isLeader = ( mpi::Rank(nodeComm_) == 0 );
+        sizes[0] = mpi::AllReduce( isLeader, owningComm_ );
+
+        // Measure how each of the column and row communicators is spread
+        // across the nodes
+        auto measure = [&]( mpi::Comm comm, int& intraSize, int& interSize )
+        {
+            mpi::Comm intraComm;
+            mpi::Split( comm, nodeLeader, mpi::Rank(comm), intraComm );
+            intraSize = mpi::Size( intraComm );
+            const int isIntraRoot = ( mpi::Rank(intraComm) == 0 );
+            interSize = mpi::AllReduce( isIntraRoot, comm );
+            mpi::Free( intraComm );
+        };
+        measure( mcComm_, sizes[1], sizes[2] );
+        measure( mrComm_, sizes[3], sizes[4] );
+        mpi::AllReduce( &sizes[1], 4, mpi::MAX, owningComm_ );
+    }
+    else
+    {
+        nodeComm_ = mpi::COMM_NULL;
+        nodeSize_ = 0;
+    }
+    int owningRoot = mpi::Translate( owningGroup_, 0, viewingGroup_ );
+    mpi::Broadcast( sizes, 5, owningRoot, viewingComm_ );
+    numNodes_ = sizes[0];
+    mcIntraNodeSize_ = sizes[1];
+    mcInterNodeSize_ = sizes[2];
+    mrIntraNodeSize_ = sizes[3];
+    mrInterNodeSize_ = sizes[4];
+    maxNodeSize_ = mpi::AllReduce( nodeSize_, mpi::MAX, viewingComm_ );
 }
 
 Grid::~Grid()
 {
     if( !mpi::Finalized() )
     {
+        // The cached grids view our owning processes, so free them first
+        for( auto& entry : layers_ )
+        {
+            entry.second.grids.clear();
+            if( InGrid() )
+                mpi::Free( entry.second.depthComm );
+        }
+        layers_.clear();
+        ownerGrid_.reset();
         if( InGrid() )
         {
+            mcWindow_.Free();
+            mrWindow_.Free();
+            vcWindow_.Free();
+            vrWindow_.Free();
             mpi::Free( mdComm_ );
             mpi::Free( mdPerpComm_ );
             mpi::Free( mcComm_ );
@@ -221,6 +351,7 @@ Grid::~Grid()
             mpi::Free( vcComm_ );
             mpi::Free( vrComm_ );
             mpi::Free( cartComm_ );
+            mpi::Free( nodeComm_ );
             mpi::Free( owningComm_ );
         }
         mpi::Free( viewingComm_ );
@@ -251,6 +382,125 @@ mpi::Comm Grid::MDPerpComm() const EL_NO_EXCEPT { return mdPerpComm_; }
 mpi::Comm Grid::VCComm()     const EL_NO_EXCEPT { return vcComm_;     }
 mpi::Comm Grid::VRComm()     const EL_NO_EXCEPT { return vrComm_;     }
 
+mpi::Comm Grid::NodeComm() const EL_NO_EXCEPT { return nodeComm_; }
+int Grid::NodeSize() const EL_NO_EXCEPT { return nodeSize_; }
+int Grid::NumNodes() const EL_NO_EXCEPT { return numNodes_; }
+
+int Grid::IntraNodeSize( Dist dist ) const EL_NO_EXCEPT
+{
+    switch( dist )
+    {
+    case MC:   return mcIntraNodeSize_;
+    case MR:   return mrIntraNodeSize_;
+    case STAR:
+    case CIRC: return 1;
+    default:   return Min( maxNodeSize_, size_ );
+    }
+}
+
+int Grid::InterNodeSize( Dist dist ) const EL_NO_EXCEPT
+{
+    switch( dist )
+    {
+    case MC:   return mcInterNodeSize_;
+    case MR:   return mrInterNodeSize_;
+    case STAR:
+    case CIRC: return 1;
+    default:   return numNodes_;
+    }
+}
+
+bool Grid::NodeLocal( Dist dist ) const EL_NO_EXCEPT
+{ return InterNodeSize( dist ) == 1; }
+
+mpi::SharedWindow* Grid::NodeWindow( mpi::Comm comm ) const EL_NO_EXCEPT
+{
+    if( !InGrid() )
+        return nullptr;
+    if( comm == mcComm_ && NodeLocal(MC) )
+        return &mcWindow_;
+    if( comm == mrComm_ && NodeLocal(MR) )
+        return &mrWindow_;
+    if( comm == vcComm_ && numNodes_ == 1 )
+        return &vcWindow_;
+    if( comm == vrComm_ && numNodes_ == 1 )
+        return &vrWindow_;
+    return nullptr;
+}
+
+std::uint64_t Grid::NextRandomStream() const EL_NO_EXCEPT
+{ return randomStream_++; }
+
+const Grid& Grid::OwnerGrid() const
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( !InGrid() )
+          LogicError("Only the owning processes may form the owner grid");
+    )
+    // Without viewers, the VC ordering of a column-major grid is that of its
+    // viewing communicator
+    if( !HaveViewers() && order_ == COLUMN_MAJOR )
+        return *this;
+    if( !ownerGrid_ )
+        ownerGrid_.reset( new Grid( vcComm_, height_, COLUMN_MAJOR ) );
+    return *ownerGrid_;
+}
+
+const Grid::Layers& Grid::FormLayers( int numLayers ) const
+{
+    DEBUG_CSE
+    auto it = layers_.find( numLayers );
+    if( it != layers_.end() )
+        return it->second;
+    if( numLayers < 1 || size_ % numLayers != 0 )
+        LogicError
+        ("The number of layers, ",numLayers,", must divide the number of "
+         "processes, ",size_);
+
+    const Grid& owner = OwnerGrid();
+    const int layerSize = size_ / numLayers;
+    const int layerHeight = FindFactor( layerSize );
+    Layers layers;
+    layers.grids.resize( numLayers );
+    vector<int> viewingRanks( layerSize );
+    for( int l=0; l<numLayers; ++l )
+    {
+        for( int q=0; q<layerSize; ++q )
+            viewingRanks[q] = owner.VCToViewing( l*layerSize+q );
+        mpi::Group layerOwners;
+        mpi::Incl
+        ( owner.viewingGroup_, layerSize, viewingRanks.data(), layerOwners );
+        layers.grids[l].reset
+        ( new Grid( owner.ViewingComm(), layerOwners, layerHeight ) );
+        mpi::Free( layerOwners );
+    }
+    const int vcRank = owner.VCRank();
+    mpi::Split
+    ( owner.VCComm(), vcRank % layerSize, vcRank / layerSize,
+      layers.depthComm );
+    return layers_[numLayers] = std::move(layers);
+}
+
+const vector<unique_ptr<Grid>>& Grid::LayerGrids( int numLayers ) const
+{ return FormLayers( numLayers ).grids; }
+
+mpi::Comm Grid::LayerDepthComm( int numLayers ) const
+{ return FormLayers( numLayers ).depthComm; }
+
+void Grid::PrintTopology( ostream& os ) const
+{
+    DEBUG_CSE
+    if( viewingRank_ != 0 )
+        return;
+    os << Height() << " x " << Width() << " grid over " << numNodes_
+       << " node(s) of at most " << maxNodeSize_ << " process(es)\n"
+       << "  [MC] communicators: " << mcIntraNodeSize_ << " process(es) per "
+       << "node over " << mcInterNodeSize_ << " node(s)\n"
+       << "  [MR] communicators: " << mrIntraNodeSize_ << " process(es) per "
+       << "node over " << mrInterNodeSize_ << " node(s)" << endl;
+}
+
 // Provided for simplicity, but redundant
 // ======================================
 int Grid::Height() const EL_NO_EXCEPT { return MCSize(); }
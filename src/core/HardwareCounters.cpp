@@ -0,0 +1,142 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#ifdef EL_HAVE_PERF_EVENT
+# include <linux/perf_event.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace {
+
+std::atomic<bool> countersEnabled(false);
+
+#ifdef EL_HAVE_PERF_EVENT
+// The counters of a single thread, which are opened upon first use and
+// closed when the thread exits
+struct ThreadCounters
+{
+    bool opened=false;
+    int fds[El::NUM_HW_COUNTERS];
+
+    ThreadCounters()
+    {
+        for( int j=0; j<El::NUM_HW_COUNTERS; ++j )
+            fds[j] = -1;
+    }
+
+    ~ThreadCounters()
+    {
+        for( int j=0; j<El::NUM_HW_COUNTERS; ++j )
+            if( fds[j] >= 0 )
+                close( fds[j] );
+    }
+
+    void Open()
+    {
+        const unsigned long long l1dReadMiss =
+          PERF_COUNT_HW_CACHE_L1D |
+          (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const struct { unsigned type; unsigned long long config; }
+          events[El::NUM_HW_COUNTERS] =
+          { { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            { PERF_TYPE_HW_CACHE, l1dReadMiss } };
+        for( int j=0; j<El::NUM_HW_COUNTERS; ++j )
+        {
+            struct perf_event_attr attr;
+            std::memset( &attr, 0, sizeof(attr) );
+            attr.type = events[j].type;
+            attr.size = sizeof(attr);
+            attr.config = events[j].config;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            // Count this thread on any processor
+            fds[j] = syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+        }
+        opened = true;
+    }
+
+    bool AnyOpen() const
+    {
+        for( int j=0; j<El::NUM_HW_COUNTERS; ++j )
+            if( fds[j] >= 0 )
+                return true;
+        return false;
+    }
+};
+
+ThreadCounters& LocalCounters()
+{
+    thread_local ThreadCounters counters;
+    if( !counters.opened )
+        counters.Open();
+    return counters;
+}
+#endif // ifdef EL_HAVE_PERF_EVENT
+
+} // anonymous namespace
+
+namespace El {
+
+bool EnableHardwareCounters()
+{
+#ifdef EL_HAVE_PERF_EVENT
+    if( !LocalCounters().AnyOpen() )
+        return false;
+    ::countersEnabled.store( true, std::memory_order_relaxed );
+    return true;
+#else
+    return false;
+#endif
+}
+
+void DisableHardwareCounters()
+{ ::countersEnabled.store( false, std::memory_order_relaxed ); }
+
+bool HardwareCountersEnabled()
+{ return ::countersEnabled.load( std::memory_order_relaxed ); }
+
+string HardwareCounterName( HardwareCounter counter )
+{
+    switch( counter )
+    {
+    case HW_CYCLES:           return "cycles";
+    case HW_INSTRUCTIONS:     return "instructions";
+    case HW_CACHE_REFERENCES: return "cache references";
+    case HW_CACHE_MISSES:     return "cache misses";
+    case HW_BRANCH_MISSES:    return "branch misses";
+    case HW_L1D_READ_MISSES:  return "L1D read misses";
+    default: LogicError("Invalid hardware counter"); return "";
+    }
+}
+
+void ReadHardwareCounters( HardwareCounts& counts )
+{
+    counts.fill( 0 );
+#ifdef EL_HAVE_PERF_EVENT
+    if( !HardwareCountersEnabled() )
+        return;
+    const ThreadCounters& counters = LocalCounters();
+    for( int j=0; j<NUM_HW_COUNTERS; ++j )
+    {
+        long long count;
+        if( counters.fds[j] >= 0 &&
+            read( counters.fds[j], &count, sizeof(count) ) == sizeof(count) )
+            counts[j] = count;
+    }
+#endif
+}
+
+} // namespace El
@@ -0,0 +1,669 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <iomanip>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(EL_HAVE_MADV_HUGEPAGE) || defined(EL_HAVE_MBIND_SYSCALL)
+# include <sys/mman.h>
+#endif
+#ifdef EL_HAVE_MBIND_SYSCALL
+# include <unistd.h>
+# include <sys/syscall.h>
+#endif
+
+namespace {
+using El::Int;
+
+El::MemoryPolicy memoryPolicy;
+
+// Buffers which were placed via mmap (rather than malloc) are tracked so that
+// RawFree can return them with munmap. The count of live mapped buffers lets
+// RawFree skip the locked lookup when (as by default) nothing was mapped.
+std::mutex mappedMutex;
+std::unordered_map<void*,size_t> mappedBuffers;
+std::atomic<size_t> numMappedBuffers(0);
+
+const size_t hugePageSize = size_t(1) << 21;
+
+#ifdef EL_HAVE_MBIND_SYSCALL
+// Values from linux/mempolicy.h
+const int MPOL_PREFERRED_ = 1;
+const int MPOL_INTERLEAVE_ = 3;
+
+// Read /sys/devices/system/node/online, e.g., "0-1,3", into a bitmask
+void OnlineNumaNodes( std::vector<unsigned long>& mask )
+{
+    const Int bitsPerWord = 8*sizeof(unsigned long);
+    mask.assign( 1, 0 );
+    std::ifstream file("/sys/devices/system/node/online");
+    std::string ranges;
+    if( !(file >> ranges) )
+    {
+        mask[0] = 1;
+        return;
+    }
+    std::istringstream stream( ranges );
+    std::string range;
+    while( std::getline( stream, range, ',' ) )
+    {
+        const auto dash = range.find('-');
+        const Int first = std::stoi( range.substr(0,dash) );
+        const Int last = ( dash == std::string::npos ? first :
+                           std::stoi(range.substr(dash+1)) );
+        for( Int node=first; node<=last; ++node )
+        {
+            const Int word = node / bitsPerWord;
+            if( word >= Int(mask.size()) )
+                mask.resize( word+1, 0 );
+            mask[word] |= 1UL << (node % bitsPerWord);
+        }
+    }
+}
+
+void BindPages( void* ptr, size_t bytes, El::NumaPolicy numa )
+{
+    if( numa == El::NUMA_INTERLEAVE )
+    {
+        std::vector<unsigned long> mask;
+        OnlineNumaNodes( mask );
+        const unsigned long maxNode = 8*sizeof(unsigned long)*mask.size()+1;
+        syscall
+        ( SYS_mbind, ptr, bytes, MPOL_INTERLEAVE_, mask.data(), maxNode, 0 );
+    }
+    else if( numa == El::NUMA_LOCAL )
+    {
+        // A preferred policy with an empty nodemask means 'local allocation'
+        syscall( SYS_mbind, ptr, bytes, MPOL_PREFERRED_, nullptr, 0, 0 );
+    }
+}
+#endif
+
+bool UseMappedAllocation( size_t bytes )
+{
+    if( bytes < memoryPolicy.threshold )
+        return false;
+    bool use = false;
+#ifdef EL_HAVE_MADV_HUGEPAGE
+    use = use || memoryPolicy.hugePages;
+#endif
+#ifdef EL_HAVE_MBIND_SYSCALL
+    use = use || memoryPolicy.numa != El::NUMA_DEFAULT;
+#endif
+    return use;
+}
+
+#if defined(EL_HAVE_MADV_HUGEPAGE) || defined(EL_HAVE_MBIND_SYSCALL)
+void* MappedAllocate( size_t bytes )
+{
+    // Round up to a multiple of the huge page size and overallocate by one
+    // huge page so that the start of the buffer can be aligned to it
+    const size_t alignedBytes =
+      ((bytes+hugePageSize-1)/hugePageSize)*hugePageSize;
+    const size_t mappedBytes = alignedBytes + hugePageSize;
+    void* mapped =
+      mmap
+      ( nullptr, mappedBytes, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS,
+        -1, 0 );
+    if( mapped == MAP_FAILED )
+        throw std::bad_alloc();
+    char* start = static_cast<char*>(mapped);
+    char* aligned = reinterpret_cast<char*>
+      (((reinterpret_cast<size_t>(start)+hugePageSize-1)/hugePageSize)*
+       hugePageSize);
+    if( aligned != start )
+        munmap( start, aligned-start );
+    const size_t tailBytes = (start+mappedBytes) - (aligned+alignedBytes);
+    if( tailBytes > 0 )
+        munmap( aligned+alignedBytes, tailBytes );
+
+#ifdef EL_HAVE_MADV_HUGEPAGE
+    if( memoryPolicy.hugePages )
+        madvise( aligned, alignedBytes, MADV_HUGEPAGE );
+#endif
+#ifdef EL_HAVE_MBIND_SYSCALL
+    BindPages( aligned, alignedBytes, memoryPolicy.numa );
+#endif
+
+    std::lock_guard<std::mutex> guard( mappedMutex );
+    mappedBuffers[aligned] = alignedBytes;
+    ++numMappedBuffers;
+    return aligned;
+}
+#endif
+
+// The size classes are geometrically spaced, with four classes per power of
+// two, so that no more than 25% of any pooled buffer is wasted. The smallest
+// class is a single (64-byte) cache line.
+const Int minClassLog2 = 6;
+const Int numSubclasses = 4;
+
+Int ClassIndex( size_t bytes )
+{
+    if( bytes <= (size_t(1)<<minClassLog2) )
+        return 0;
+    // Find e such that 2^e < bytes <= 2^(e+1)
+    Int e = 0;
+    for( size_t b=bytes-1; b>1; b>>=1 )
+        ++e;
+    const size_t base = size_t(1) << e;
+    const size_t quarter = base / numSubclasses;
+    Int q = Int((bytes-base+quarter-1)/quarter);
+    if( q == numSubclasses )
+    {
+        ++e;
+        q = 0;
+    }
+    return (e-minClassLog2)*numSubclasses + q;
+}
+
+size_t ClassSize( Int index )
+{
+    const Int e = minClassLog2 + index/numSubclasses;
+    const Int q = index % numSubclasses;
+    const size_t base = size_t(1) << e;
+    return base + q*(base/numSubclasses);
+}
+
+std::atomic<bool> poolEnabled(false);
+bool padLDims = false;
+std::atomic<size_t> residentBytes(0), peakBytes(0);
+
+void RaisePeak( std::atomic<size_t>& peak, size_t value )
+{
+    size_t oldPeak = peak.load();
+    while( value > oldPeak && !peak.compare_exchange_weak( oldPeak, value ) ) { }
+}
+
+void UpdateResident( size_t bytes, bool increase )
+{
+    if( increase )
+        RaisePeak( peakBytes, residentBytes += bytes );
+    else
+        residentBytes -= bytes;
+}
+
+struct MemoryPool
+{
+    // freeLists[k] holds the cached buffers of size ClassSize(k)
+    std::vector<std::vector<void*>> freeLists;
+
+    void* Allocate( Int index )
+    {
+        if( index < Int(freeLists.size()) && !freeLists[index].empty() )
+        {
+            void* ptr = freeLists[index].back();
+            freeLists[index].pop_back();
+            return ptr;
+        }
+        const size_t bytes = ClassSize( index );
+        void* ptr = El::RawAllocate( bytes );
+        UpdateResident( bytes, true );
+        return ptr;
+    }
+
+    void Free( void* ptr, Int index )
+    {
+        if( index >= Int(freeLists.size()) )
+            freeLists.resize( index+1 );
+        freeLists[index].push_back( ptr );
+    }
+
+    void Release()
+    {
+        const Int numClasses = freeLists.size();
+        for( Int index=0; index<numClasses; ++index )
+        {
+            const size_t bytes = ClassSize( index );
+            for( void* ptr : freeLists[index] )
+            {
+                El::RawFree( ptr );
+                UpdateResident( bytes, false );
+            }
+            El::SwapClear( freeLists[index] );
+        }
+    }
+
+    ~MemoryPool() { Release(); }
+};
+
+MemoryPool& Pool()
+{
+#ifdef EL_HYBRID
+    static thread_local MemoryPool pool;
+#else
+    static MemoryPool pool;
+#endif
+    return pool;
+}
+
+// A grow-only stack of cache-line-aligned blocks. Loans are carved off of
+// the top block and are popped once they (and all later loans) are returned.
+// Once no loans are outstanding, multiple blocks are coalesced into a
+// single block of their combined capacity so that the arena quickly settles
+// into a single allocation. A user-registered region, if any, is always the
+// bottom block and is never freed by the arena.
+struct ScratchArena
+{
+    struct Block
+    {
+        void* raw;
+        El::byte* buffer;
+        size_t capacity, offset;
+        bool external;
+    };
+    struct Loan
+    {
+        void* ptr;
+        size_t bytes;
+        bool returned;
+    };
+    std::vector<Block> blocks;
+    std::vector<Loan> loans;
+
+    size_t Capacity( bool includeExternal=true ) const
+    {
+        size_t capacity = 0;
+        for( const auto& block : blocks )
+            if( includeExternal || !block.external )
+                capacity += block.capacity;
+        return capacity;
+    }
+
+    bool HasExternal() const
+    { return !blocks.empty() && blocks.front().external; }
+
+    void PushBlock( size_t capacity )
+    {
+        Block block;
+        block.raw = El::RawAllocate( capacity+El::CACHE_LINE_SIZE );
+        const size_t address = reinterpret_cast<size_t>(block.raw);
+        const size_t offset =
+          (El::CACHE_LINE_SIZE-address%El::CACHE_LINE_SIZE) %
+          El::CACHE_LINE_SIZE;
+        block.buffer = static_cast<El::byte*>(block.raw) + offset;
+        block.capacity = capacity;
+        block.offset = 0;
+        block.external = false;
+        blocks.push_back( block );
+    }
+
+    void Register( void* buffer, size_t bytes )
+    {
+        if( !loans.empty() )
+            El::LogicError("Cannot register a region with outstanding loans");
+        Unregister();
+
+        const size_t address = reinterpret_cast<size_t>(buffer);
+        const size_t offset =
+          (El::CACHE_LINE_SIZE-address%El::CACHE_LINE_SIZE) %
+          El::CACHE_LINE_SIZE;
+        if( bytes <= offset )
+            return;
+        Block block;
+        block.raw = buffer;
+        block.buffer = static_cast<El::byte*>(buffer) + offset;
+        block.capacity = bytes - offset;
+        block.offset = 0;
+        block.external = true;
+        blocks.push_back( block );
+    }
+
+    void Unregister()
+    {
+        if( !loans.empty() )
+            El::LogicError("Cannot unregister a region with outstanding loans");
+        Release();
+        blocks.clear();
+    }
+
+    void* Borrow( size_t bytes )
+    {
+        // Keep each loan aligned to a cache line
+        bytes = ((bytes+El::CACHE_LINE_SIZE-1)/El::CACHE_LINE_SIZE)*
+                El::CACHE_LINE_SIZE;
+        // Carve from the lowest block with enough room which lies at or above
+        // the highest nonempty block
+        const Int numBlocks = blocks.size();
+        Int index = std::max( numBlocks-1, Int(0) );
+        while( index > 0 && blocks[index].offset == 0 )
+            --index;
+        while( index < numBlocks &&
+               blocks[index].offset+bytes > blocks[index].capacity )
+            ++index;
+        if( index == numBlocks )
+        {
+            const size_t lastCapacity =
+              ( blocks.empty() ? 0 : blocks.back().capacity );
+            PushBlock( std::max(bytes,2*lastCapacity) );
+        }
+        Block& block = blocks[index];
+        void* ptr = block.buffer + block.offset;
+        block.offset += bytes;
+
+        Loan loan;
+        loan.ptr = ptr;
+        loan.bytes = bytes;
+        loan.returned = false;
+        loans.push_back( loan );
+        return ptr;
+    }
+
+    void Return( void* ptr )
+    {
+        for( auto it=loans.rbegin(); it!=loans.rend(); ++it )
+        {
+            if( it->ptr == ptr )
+            {
+                it->returned = true;
+                break;
+            }
+        }
+        while( !loans.empty() && loans.back().returned )
+        {
+            const size_t bytes = loans.back().bytes;
+            loans.pop_back();
+            if( bytes == 0 )
+                continue;
+            // The loan was carved from the highest nonempty block
+            Int index = Int(blocks.size())-1;
+            while( blocks[index].offset == 0 )
+                --index;
+            blocks[index].offset -= bytes;
+        }
+        const Int numInternal = blocks.size() - ( HasExternal() ? 1 : 0 );
+        if( loans.empty() && numInternal > 1 )
+        {
+            const size_t capacity = Capacity( false );
+            Release();
+            PushBlock( capacity );
+        }
+    }
+
+    void Release()
+    {
+        // Only blocks above the highest outstanding loan are freed
+        while( !blocks.empty() && !blocks.back().external &&
+               (blocks.back().offset == 0 || loans.empty()) )
+        {
+            El::RawFree( blocks.back().raw );
+            blocks.pop_back();
+        }
+    }
+
+    ~ScratchArena()
+    {
+        loans.clear();
+        Release();
+    }
+};
+
+ScratchArena& Arena()
+{
+#ifdef EL_HYBRID
+    static thread_local ScratchArena arena;
+#else
+    static ScratchArena arena;
+#endif
+    return arena;
+}
+
+// The footprint of the buffers underlying Memory<G>
+std::atomic<size_t> liveBytes(0), livePeakBytes(0);
+
+// The optional attribution of said footprint to call sites
+struct CallSiteUsage
+{
+    size_t liveBytes=0, peakBytes=0, numAllocations=0;
+};
+std::atomic<bool> trackCallSites(false);
+std::mutex callSiteMutex;
+std::unordered_map<std::string,CallSiteUsage> callSiteUsage;
+// The site (and size) that each tracked, live buffer was attributed to.
+// The node-based map guarantees that pointers to its values remain valid.
+std::unordered_map<const void*,std::pair<CallSiteUsage*,size_t>>
+  trackedBuffers;
+std::atomic<size_t> numTrackedBuffers(0);
+
+std::string memoryReportBasename;
+
+std::string CurrentCallSite()
+{
+    std::string site;
+    DEBUG_ONLY(site = El::CallSite())
+    return site.empty() ? std::string("(unknown)") : site;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void SetMemoryPolicy( const MemoryPolicy& policy )
+{ ::memoryPolicy = policy; }
+
+const MemoryPolicy& GetMemoryPolicy()
+{ return ::memoryPolicy; }
+
+void* RawAllocate( size_t bytes )
+{
+    DEBUG_CSE
+#if defined(EL_HAVE_MADV_HUGEPAGE) || defined(EL_HAVE_MBIND_SYSCALL)
+    if( ::UseMappedAllocation( bytes ) )
+        return ::MappedAllocate( bytes );
+#endif
+    void* ptr = std::malloc( bytes );
+    if( ptr == nullptr && bytes != 0 )
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void RawFree( void* ptr )
+{
+    DEBUG_CSE
+    if( ptr == nullptr )
+        return;
+#if defined(EL_HAVE_MADV_HUGEPAGE) || defined(EL_HAVE_MBIND_SYSCALL)
+    if( ::numMappedBuffers > 0 )
+    {
+        std::lock_guard<std::mutex> guard( ::mappedMutex );
+        auto it = ::mappedBuffers.find( ptr );
+        if( it != ::mappedBuffers.end() )
+        {
+            munmap( ptr, it->second );
+            ::mappedBuffers.erase( it );
+            --::numMappedBuffers;
+            return;
+        }
+    }
+#endif
+    std::free( ptr );
+}
+
+void EnableLDimPadding() { ::padLDims = true; }
+void DisableLDimPadding() { ::padLDims = false; }
+bool LDimPadding() { return ::padLDims; }
+
+void* BorrowScratch( size_t bytes )
+{
+    DEBUG_CSE
+    return ::Arena().Borrow( bytes );
+}
+
+void ReturnScratch( void* ptr )
+{
+    DEBUG_CSE
+    ::Arena().Return( ptr );
+}
+
+void ReleaseScratch() { ::Arena().Release(); }
+
+void RegisterScratchRegion( void* buffer, size_t bytes )
+{
+    DEBUG_CSE
+    ::Arena().Register( buffer, bytes );
+}
+
+void UnregisterScratchRegion()
+{
+    DEBUG_CSE
+    ::Arena().Unregister();
+}
+
+size_t ScratchCapacity() { return ::Arena().Capacity(); }
+
+void EnableMemoryPool() { ::poolEnabled = true; }
+void DisableMemoryPool() { ::poolEnabled = false; }
+bool MemoryPoolEnabled() { return ::poolEnabled; }
+
+void ReleaseMemoryPool() { ::Pool().Release(); }
+
+size_t MemoryPoolResidentBytes() { return ::residentBytes; }
+size_t MemoryPoolPeakBytes() { return ::peakBytes; }
+
+void TrackAllocation( const void* ptr, size_t bytes )
+{
+    ::RaisePeak( ::livePeakBytes, ::liveBytes += bytes );
+    if( ::trackCallSites )
+    {
+        const std::string site = ::CurrentCallSite();
+        std::lock_guard<std::mutex> guard( ::callSiteMutex );
+        CallSiteUsage& usage = ::callSiteUsage[site];
+        usage.liveBytes += bytes;
+        usage.peakBytes = Max( usage.peakBytes, usage.liveBytes );
+        ++usage.numAllocations;
+        ::trackedBuffers[ptr] = std::make_pair( &usage, bytes );
+        ::numTrackedBuffers = ::trackedBuffers.size();
+    }
+}
+
+void TrackDeallocation( const void* ptr, size_t bytes )
+{
+    ::liveBytes -= bytes;
+    // Buffers may outlive the disabling of call-site tracking
+    if( ::numTrackedBuffers > 0 )
+    {
+        std::lock_guard<std::mutex> guard( ::callSiteMutex );
+        auto it = ::trackedBuffers.find( ptr );
+        if( it != ::trackedBuffers.end() )
+        {
+            it->second.first->liveBytes -= it->second.second;
+            ::trackedBuffers.erase( it );
+            ::numTrackedBuffers = ::trackedBuffers.size();
+        }
+    }
+}
+
+size_t MemoryLiveBytes() { return ::liveBytes; }
+size_t MemoryPeakBytes() { return ::livePeakBytes; }
+
+void ResetMemoryPeak()
+{
+    ::livePeakBytes = ::liveBytes.load();
+    std::lock_guard<std::mutex> guard( ::callSiteMutex );
+    for( auto& entry : ::callSiteUsage )
+        entry.second.peakBytes = entry.second.liveBytes;
+}
+
+size_t NodeAvailableMemory()
+{
+    std::ifstream file("/proc/meminfo");
+    std::string line, key;
+    size_t kiloBytes;
+    while( std::getline( file, line ) )
+    {
+        std::istringstream stream( line );
+        if( stream >> key >> kiloBytes && key == "MemAvailable:" )
+            return kiloBytes*1024;
+    }
+    return 0;
+}
+
+void EnableMemoryTracking() { ::trackCallSites = true; }
+void DisableMemoryTracking() { ::trackCallSites = false; }
+bool MemoryTracking() { return ::trackCallSites; }
+
+void PrintMemoryReport( ostream& os, Int maxSites )
+{
+    DEBUG_CSE
+    ostringstream msg;
+    msg << "Process " << mpi::Rank() << ": " << MemoryLiveBytes()
+        << " bytes live, " << MemoryPeakBytes() << " bytes peak\n";
+    vector<std::pair<std::string,CallSiteUsage>> sites;
+    {
+        std::lock_guard<std::mutex> guard( ::callSiteMutex );
+        sites.assign( ::callSiteUsage.begin(), ::callSiteUsage.end() );
+    }
+    std::sort
+    ( sites.begin(), sites.end(),
+      []( const std::pair<std::string,CallSiteUsage>& a,
+          const std::pair<std::string,CallSiteUsage>& b )
+      { return a.second.peakBytes > b.second.peakBytes; } );
+    const Int numSites = Min( Int(sites.size()), maxSites );
+    for( Int k=0; k<numSites; ++k )
+    {
+        const CallSiteUsage& usage = sites[k].second;
+        msg << "  " << usage.peakBytes << " bytes peak, "
+            << usage.liveBytes << " bytes live, "
+            << usage.numAllocations << " allocations: "
+            << sites[k].first << "\n";
+    }
+    os << msg.str();
+    os.flush();
+}
+
+void EnableMemoryReport( const string& basename )
+{
+    ::memoryReportBasename = basename;
+    EnableMemoryTracking();
+}
+
+void DisableMemoryReport() { ::memoryReportBasename.clear(); }
+
+void WriteMemoryReport()
+{
+    DEBUG_CSE
+    if( ::memoryReportBasename.empty() )
+        return;
+    ostringstream fileOS;
+    fileOS << ::memoryReportBasename << "-Proc" << std::setfill('0')
+           << std::setw(3) << mpi::Rank() << ".txt";
+    std::ofstream file( fileOS.str().c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",fileOS.str());
+    PrintMemoryReport( file );
+}
+
+void* PoolAllocate( size_t bytes )
+{
+    DEBUG_CSE
+    return ::Pool().Allocate( ::ClassIndex(bytes) );
+}
+
+void PoolFree( void* ptr, size_t bytes )
+{
+    DEBUG_CSE
+    if( ptr == nullptr )
+        return;
+    const Int index = ::ClassIndex( bytes );
+    if( MemoryPoolEnabled() )
+    {
+        ::Pool().Free( ptr, index );
+    }
+    else
+    {
+        // The pool was disabled after this buffer was drawn from it
+        RawFree( ptr );
+        ::UpdateResident( ::ClassSize(index), false );
+    }
+}
+
+} // namespace El
@@ -0,0 +1,456 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+using El::Int;
+using El::string;
+using El::vector;
+
+typedef long long Nanoseconds;
+
+struct RegionStats
+{
+    Int count=0;
+    Nanoseconds inclusive=0, exclusive=0;
+    double flops=0, bytes=0;
+    El::HardwareCounts counts{};
+};
+
+struct Frame
+{
+    const char* name;
+    Nanoseconds start, children;
+    double flops, bytes;
+    bool counting;
+    El::HardwareCounts startCounts;
+};
+
+struct Event
+{
+    const char* name;
+    Nanoseconds start, duration;
+};
+
+// The state of a single thread. These are never destroyed so that their
+// contents outlive the threads which produced them.
+struct ThreadProfile
+{
+    int id;
+    vector<Frame> stack;
+    std::unordered_map<const char*,RegionStats> stats;
+    vector<Event> events;
+    size_t numEvents=0; // the total number of calls recorded
+};
+
+std::mutex profileMutex;
+vector<std::unique_ptr<ThreadProfile>> threadProfiles;
+Int bufferSize = 1<<16;
+El::Clock::time_point epoch = El::Clock::now();
+
+Nanoseconds Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+      (El::Clock::now()-epoch).count();
+}
+
+ThreadProfile& LocalProfile()
+{
+    thread_local ThreadProfile* profile = nullptr;
+    if( profile == nullptr )
+    {
+        std::lock_guard<std::mutex> guard( profileMutex );
+        threadProfiles.emplace_back( new ThreadProfile );
+        profile = threadProfiles.back().get();
+        profile->id = int(threadProfiles.size()-1);
+        profile->events.resize( bufferSize );
+    }
+    return *profile;
+}
+
+// Merge the statistics of all of the threads by region name
+std::map<string,RegionStats> LocalStats()
+{
+    std::map<string,RegionStats> merged;
+    std::lock_guard<std::mutex> guard( profileMutex );
+    for( const auto& profile : threadProfiles )
+    {
+        for( const auto& entry : profile->stats )
+        {
+            RegionStats& stats = merged[entry.first];
+            stats.count += entry.second.count;
+            stats.inclusive += entry.second.inclusive;
+            stats.exclusive += entry.second.exclusive;
+            stats.flops += entry.second.flops;
+            stats.bytes += entry.second.bytes;
+            for( Int j=0; j<El::NUM_HW_COUNTERS; ++j )
+                stats.counts[j] += entry.second.counts[j];
+        }
+    }
+    return merged;
+}
+
+void Append( const void* data, size_t numBytes, vector<El::byte>& buf )
+{
+    const El::byte* dataBytes = static_cast<const El::byte*>(data);
+    buf.insert( buf.end(), dataBytes, dataBytes+numBytes );
+}
+
+template<typename T>
+T Extract( const El::byte*& buf )
+{
+    T value;
+    std::memcpy( &value, buf, sizeof(T) );
+    buf += sizeof(T);
+    return value;
+}
+
+// Gather the (variable-length) buffers of every process onto the root
+vector<El::byte> GatherBytes
+( const vector<El::byte>& buf, vector<int>& sizes, El::mpi::Comm comm )
+{
+    const int commSize = El::mpi::Size( comm );
+    const int commRank = El::mpi::Rank( comm );
+    const int localSize = int(buf.size());
+    sizes.resize( commSize );
+    El::mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+
+    vector<int> offsets;
+    vector<El::byte> gathered;
+    if( commRank == 0 )
+    {
+        const int totalSize = El::Scan( sizes, offsets );
+        gathered.resize( totalSize );
+    }
+    El::mpi::Gather
+    ( buf.data(), localSize,
+      gathered.data(), sizes.data(), offsets.data(), 0, comm );
+    return gathered;
+}
+
+string EscapeJSON( const char* name )
+{
+    string escaped;
+    for( const char* c=name; *c!='\0'; ++c )
+    {
+        if( *c == '"' || *c == '\\' )
+            escaped += '\\';
+        escaped += *c;
+    }
+    return escaped;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+namespace profile {
+
+std::atomic<bool> enabled(false);
+
+void Push( const char* name )
+{
+    ThreadProfile& profile = LocalProfile();
+    Frame frame;
+    frame.name = name;
+    frame.children = 0;
+    frame.flops = frame.bytes = 0;
+    frame.counting = HardwareCountersEnabled();
+    if( frame.counting )
+        ReadHardwareCounters( frame.startCounts );
+    frame.start = Now();
+    profile.stack.push_back( frame );
+}
+
+void AddWork( const KernelWork& work )
+{
+    ThreadProfile& profile = LocalProfile();
+    if( profile.stack.empty() )
+        return;
+    profile.stack.back().flops += work.flops;
+    profile.stack.back().bytes += work.bytes;
+}
+
+void Pop()
+{
+    const Nanoseconds end = Now();
+    ThreadProfile& profile = LocalProfile();
+    // Profiling may have been cleared while this region was open
+    if( profile.stack.empty() )
+        return;
+    const Frame frame = profile.stack.back();
+    profile.stack.pop_back();
+    if( frame.counting )
+    {
+        HardwareCounts counts;
+        ReadHardwareCounters( counts );
+        RegionStats& stats = profile.stats[frame.name];
+        for( Int j=0; j<NUM_HW_COUNTERS; ++j )
+            stats.counts[j] += counts[j] - frame.startCounts[j];
+    }
+
+    const Nanoseconds inclusive = end - frame.start;
+    RegionStats& stats = profile.stats[frame.name];
+    ++stats.count;
+    stats.inclusive += inclusive;
+    stats.exclusive += inclusive - frame.children;
+    stats.flops += frame.flops;
+    stats.bytes += frame.bytes;
+    if( !profile.stack.empty() )
+    {
+        Frame& parent = profile.stack.back();
+        parent.children += inclusive;
+        parent.flops += frame.flops;
+        parent.bytes += frame.bytes;
+    }
+
+    if( !profile.events.empty() )
+    {
+        const size_t index = profile.numEvents % profile.events.size();
+        Event& event = profile.events[index];
+        event.name = frame.name;
+        event.start = frame.start;
+        event.duration = inclusive;
+    }
+    ++profile.numEvents;
+}
+
+} // namespace profile
+
+void EnableProfiling()
+{ profile::enabled.store( true, std::memory_order_relaxed ); }
+
+void DisableProfiling()
+{ profile::enabled.store( false, std::memory_order_relaxed ); }
+
+bool Profiling()
+{ return profile::enabled.load( std::memory_order_relaxed ); }
+
+void ClearProfile()
+{
+    DEBUG_CSE
+    std::lock_guard<std::mutex> guard( ::profileMutex );
+    for( auto& profile : ::threadProfiles )
+    {
+        profile->stack.clear();
+        profile->stats.clear();
+        profile->numEvents = 0;
+    }
+}
+
+void SetProfileBufferSize( Int numEvents )
+{
+    DEBUG_CSE
+    if( numEvents < 0 )
+        LogicError("The profile buffer size must be non-negative");
+    std::lock_guard<std::mutex> guard( ::profileMutex );
+    ::bufferSize = numEvents;
+    for( auto& profile : ::threadProfiles )
+    {
+        profile->events.resize( numEvents );
+        profile->numEvents = 0;
+    }
+}
+
+Int ProfileBufferSize() { return ::bufferSize; }
+
+vector<ProfileStats> ProfileSummary()
+{
+    DEBUG_CSE
+    vector<ProfileStats> summary;
+    for( const auto& entry : LocalStats() )
+    {
+        ProfileStats stats;
+        stats.name = entry.first;
+        stats.count = entry.second.count;
+        stats.inclusive = 1e-9*entry.second.inclusive;
+        stats.exclusive = 1e-9*entry.second.exclusive;
+        stats.flops = entry.second.flops;
+        stats.bytes = entry.second.bytes;
+        stats.counts = entry.second.counts;
+        summary.push_back( stats );
+    }
+    return summary;
+}
+
+void ReportProfile( ostream& os, mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Pack the (name,count,inclusive,exclusive) tuples of this process
+    vector<byte> buf;
+    for( const auto& entry : LocalStats() )
+    {
+        const Int nameSize = entry.first.size();
+        Append( &nameSize, sizeof(Int), buf );
+        Append( entry.first.data(), nameSize, buf );
+        Append( &entry.second, sizeof(RegionStats), buf );
+    }
+    vector<int> sizes;
+    const vector<byte> gathered = GatherBytes( buf, sizes, comm );
+    if( commRank != 0 )
+        return;
+
+    struct Summary
+    {
+        Int count=0, numProcs=0;
+        double minIncl=0, maxIncl=0, sumIncl=0;
+        double minExcl=0, maxExcl=0, sumExcl=0;
+        double flops=0, bytes=0;
+        HardwareCounts minCounts{}, maxCounts{}, sumCounts{};
+    };
+    std::map<string,Summary> summaries;
+    const byte* it = gathered.data();
+    const byte* end = it + gathered.size();
+    while( it != end )
+    {
+        const Int nameSize = Extract<Int>( it );
+        const string name( (const char*)it, nameSize );
+        it += nameSize;
+        const RegionStats stats = Extract<RegionStats>( it );
+        const double incl = 1e-9*stats.inclusive;
+        const double excl = 1e-9*stats.exclusive;
+
+        Summary& summary = summaries[name];
+        if( summary.numProcs == 0 )
+        {
+            summary.minIncl = summary.maxIncl = incl;
+            summary.minExcl = summary.maxExcl = excl;
+            summary.minCounts = summary.maxCounts = stats.counts;
+        }
+        summary.count += stats.count;
+        ++summary.numProcs;
+        summary.minIncl = Min( summary.minIncl, incl );
+        summary.maxIncl = Max( summary.maxIncl, incl );
+        summary.sumIncl += incl;
+        summary.minExcl = Min( summary.minExcl, excl );
+        summary.maxExcl = Max( summary.maxExcl, excl );
+        summary.sumExcl += excl;
+        summary.flops += stats.flops;
+        summary.bytes += stats.bytes;
+        for( Int j=0; j<NUM_HW_COUNTERS; ++j )
+        {
+            summary.minCounts[j] = Min( summary.minCounts[j], stats.counts[j] );
+            summary.maxCounts[j] = Max( summary.maxCounts[j], stats.counts[j] );
+            summary.sumCounts[j] += stats.counts[j];
+        }
+    }
+
+    vector<std::pair<string,Summary>> sorted
+    ( summaries.begin(), summaries.end() );
+    std::sort
+    ( sorted.begin(), sorted.end(),
+      []( const std::pair<string,Summary>& a,
+          const std::pair<string,Summary>& b )
+      { return a.second.maxIncl > b.second.maxIncl; } );
+
+    // Processes which never entered a region contribute zero times
+    ostringstream msg;
+    msg << "Profile over " << commSize << " processes (seconds): "
+        << "calls, inclusive min/avg/max, exclusive min/avg/max"
+        << " [, GFLOP/s, GB/s]\n";
+    for( const auto& entry : sorted )
+    {
+        const Summary& s = entry.second;
+        const double minIncl = ( s.numProcs < commSize ? 0. : s.minIncl );
+        const double minExcl = ( s.numProcs < commSize ? 0. : s.minExcl );
+        msg << entry.first << ": " << s.count << ", "
+            << minIncl << "/" << s.sumIncl/commSize << "/" << s.maxIncl << ", "
+            << minExcl << "/" << s.sumExcl/commSize << "/" << s.maxExcl;
+        if( s.flops > 0 && s.maxIncl > 0 )
+            msg << ", " << 1e-9*s.flops/s.maxIncl
+                << ", " << 1e-9*s.bytes/s.maxIncl;
+        msg << "\n";
+
+        // The hardware counts (if any) and the resulting instructions per
+        // cycle and cache miss rate
+        if( s.sumCounts[HW_CYCLES] == 0 && s.sumCounts[HW_INSTRUCTIONS] == 0 )
+            continue;
+        msg << "  ";
+        for( Int j=0; j<NUM_HW_COUNTERS; ++j )
+        {
+            const long long minCount =
+              ( s.numProcs < commSize ? 0LL : s.minCounts[j] );
+            msg << HardwareCounterName(HardwareCounter(j)) << " "
+                << minCount << "/" << double(s.sumCounts[j])/commSize << "/"
+                << s.maxCounts[j] << ", ";
+        }
+        if( s.sumCounts[HW_CYCLES] > 0 )
+            msg << "IPC " << double(s.sumCounts[HW_INSTRUCTIONS])/
+                             s.sumCounts[HW_CYCLES];
+        if( s.sumCounts[HW_CACHE_REFERENCES] > 0 )
+            msg << ", cache miss rate "
+                << double(s.sumCounts[HW_CACHE_MISSES])/
+                   s.sumCounts[HW_CACHE_REFERENCES];
+        msg << "\n";
+    }
+    os << msg.str();
+    os.flush();
+}
+
+void WriteProfileTrace( const string& filename, mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+
+    // Form the events of this process in the Chrome trace format, with
+    // (fractional) microsecond timestamps
+    ostringstream events;
+    events.precision( 15 );
+    {
+        std::lock_guard<std::mutex> guard( ::profileMutex );
+        for( const auto& profile : ::threadProfiles )
+        {
+            const size_t capacity = profile->events.size();
+            const size_t numKept = std::min( profile->numEvents, capacity );
+            for( size_t k=profile->numEvents-numKept; k<profile->numEvents;
+                 ++k )
+            {
+                const Event& event = profile->events[k % capacity];
+                events << "{\"name\":\"" << EscapeJSON(event.name)
+                       << "\",\"ph\":\"X\",\"ts\":" << 1e-3*event.start
+                       << ",\"dur\":" << 1e-3*event.duration
+                       << ",\"pid\":" << commRank
+                       << ",\"tid\":" << profile->id << "},\n";
+            }
+        }
+    }
+    const string localEvents = events.str();
+    vector<byte> buf
+    ( (const byte*)localEvents.data(),
+      (const byte*)localEvents.data()+localEvents.size() );
+    vector<int> sizes;
+    const vector<byte> gathered = GatherBytes( buf, sizes, comm );
+    if( commRank != 0 )
+        return;
+
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "{\"traceEvents\":[\n";
+    file.write( (const char*)gathered.data(), gathered.size() );
+    // Terminate the list with process names rather than a dangling comma
+    const int commSize = mpi::Size( comm );
+    for( int q=0; q<commSize; ++q )
+    {
+        file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << q
+             << ",\"args\":{\"name\":\"Rank " << q << "\"}}"
+             << ( q < commSize-1 ? ",\n" : "\n" );
+    }
+    file << "],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+} // namespace El
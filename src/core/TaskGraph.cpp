@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+
+namespace El {
+
+void TaskGraph::AddDependency( Int predecessor, Int successor )
+{
+    DEBUG_CSE
+    if( predecessor == successor )
+        return;
+    // Since the successor is always the most recently inserted task, any
+    // duplicate edge must be the last one out of the predecessor
+    auto& successors = tasks_[predecessor].successors;
+    if( !successors.empty() && successors.back() == successor )
+        return;
+    successors.push_back( successor );
+    ++tasks_[successor].numPredecessors;
+    tasks_[successor].depth =
+      Max( tasks_[successor].depth, tasks_[predecessor].depth+1 );
+    ++numDependencies_;
+}
+
+void TaskGraph::Insert
+( function<void()> task,
+  const vector<Int>& reads,
+  const vector<Int>& writes,
+  Int priority )
+{
+    DEBUG_CSE
+    const Int t = tasks_.size();
+    tasks_.emplace_back();
+    tasks_[t].func = task;
+    tasks_[t].priority = priority;
+
+    // Read-after-write
+    for( const Int handle : reads )
+    {
+        auto it = lastWriter_.find( handle );
+        if( it != lastWriter_.end() )
+            AddDependency( it->second, t );
+        readersSinceWrite_[handle].push_back( t );
+    }
+    // Write-after-write and write-after-read
+    for( const Int handle : writes )
+    {
+        auto it = lastWriter_.find( handle );
+        if( it != lastWriter_.end() )
+            AddDependency( it->second, t );
+        auto& readers = readersSinceWrite_[handle];
+        for( const Int reader : readers )
+            AddDependency( reader, t );
+        readers.clear();
+        lastWriter_[handle] = t;
+    }
+}
+
+void TaskGraph::Execute( Int numThreads )
+{
+    DEBUG_CSE
+    const Int numTasks = tasks_.size();
+    if( numTasks == 0 )
+        return;
+#ifdef EL_HYBRID
+    if( numThreads <= 0 )
+        numThreads = omp_get_max_threads();
+#endif
+    numThreads = Max( Min(numThreads,numTasks), Int(1) );
+
+    // Order the ready tasks by priority and then by insertion order
+    typedef std::pair<Int,Int> Entry;
+    std::priority_queue<Entry> ready;
+    vector<Int> numPending( numTasks );
+    for( Int t=0; t<numTasks; ++t )
+    {
+        numPending[t] = tasks_[t].numPredecessors;
+        if( numPending[t] == 0 )
+            ready.push( Entry(tasks_[t].priority,-t) );
+    }
+
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    Int numCompleted = 0;
+    std::exception_ptr error;
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        while( true )
+        {
+            wakeup.wait
+            ( lock,
+              [&]() { return !ready.empty() || error ||
+                             numCompleted == numTasks; } );
+            if( error || numCompleted == numTasks )
+                break;
+            const Int t = -ready.top().second;
+            ready.pop();
+
+            lock.unlock();
+            std::exception_ptr taskError;
+            try { tasks_[t].func(); }
+            catch( ... ) { taskError = std::current_exception(); }
+            lock.lock();
+
+            ++numCompleted;
+            if( taskError && !error )
+                error = taskError;
+            for( const Int s : tasks_[t].successors )
+                if( --numPending[s] == 0 )
+                    ready.push( Entry(tasks_[s].priority,-s) );
+            wakeup.notify_all();
+        }
+    };
+
+#ifdef EL_HYBRID
+    if( numThreads > 1 )
+    {
+        #pragma omp parallel num_threads(numThreads)
+        worker();
+    }
+    else
+        worker();
+#else
+    worker();
+#endif
+
+    if( error )
+        std::rethrow_exception( error );
+}
+
+void TaskGraph::Clear()
+{
+    DEBUG_CSE
+    SwapClear( tasks_ );
+    lastWriter_.clear();
+    readersSinceWrite_.clear();
+    numDependencies_ = 0;
+}
+
+Int TaskGraph::NumTasks() const EL_NO_EXCEPT
+{ return tasks_.size(); }
+
+Int TaskGraph::NumDependencies() const EL_NO_EXCEPT
+{ return numDependencies_; }
+
+Int TaskGraph::CriticalPathLength() const EL_NO_EXCEPT
+{
+    Int length = 0;
+    for( const auto& task : tasks_ )
+        length = Max( length, task.depth );
+    return length;
+}
+
+} // namespace El
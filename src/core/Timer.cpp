@@ -20,6 +20,9 @@ void Timer::Start()
       if( running_ )
           LogicError("Forgot to stop timer before restarting.");
     )
+    countingHardware_ = HardwareCountersEnabled();
+    if( countingHardware_ )
+        ReadHardwareCounters( lastCounts_ );
     lastTime_ = Clock::now();
     running_ = true;
 }
@@ -33,6 +36,13 @@ double Timer::Stop()
     lastPartialTime_ = Partial();
     running_ = false;
     totalTime_ += lastPartialTime_;
+    if( countingHardware_ )
+    {
+        HardwareCounts counts;
+        ReadHardwareCounters( counts );
+        for( Int j=0; j<NUM_HW_COUNTERS; ++j )
+            counts_[j] += counts[j] - lastCounts_[j];
+    }
     return lastPartialTime_;
 }
 
@@ -42,10 +52,13 @@ void Timer::Reset( const string& name )
     running_ = false;
     totalTime_ = 0; 
     lastPartialTime_ = 0;
+    counts_.fill( 0 );
 }
 
 const string& Timer::Name() const { return name_; }
 
+const HardwareCounts& Timer::Counts() const { return counts_; }
+
 double Timer::Partial() const
 { 
     if( running_ )
@@ -0,0 +1,202 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace {
+using namespace El;
+
+// Problem sizes are bucketed by the floor of their base-two logarithm
+Int SizeBucket( Int n )
+{
+    Int bucket = 0;
+    while( n > 1 )
+    {
+        n /= 2;
+        ++bucket;
+    }
+    return bucket;
+}
+
+struct TuningKey
+{
+    int kernel;
+    int gridHeight;
+    int gridWidth;
+    Int bucket;
+
+    bool operator<( const TuningKey& other ) const
+    {
+        if( kernel != other.kernel )
+            return kernel < other.kernel;
+        if( gridHeight != other.gridHeight )
+            return gridHeight < other.gridHeight;
+        if( gridWidth != other.gridWidth )
+            return gridWidth < other.gridWidth;
+        return bucket < other.bucket;
+    }
+};
+
+std::map<TuningKey,TuningEntry> tuningTable;
+
+const char* tunedKernelNames[NUM_TUNED_KERNELS] =
+{ "Cholesky", "LU", "QR", "HermitianTridiag", "Trsm", "Gemm" };
+
+} // anonymous namespace
+
+namespace El {
+
+string TunedKernelName( TunedKernel kernel )
+{
+    if( kernel < 0 || kernel >= NUM_TUNED_KERNELS )
+        LogicError("Invalid tuned kernel ",Int(kernel));
+    return ::tunedKernelNames[kernel];
+}
+
+TunedKernel TunedKernelFromName( const string& name )
+{
+    for( Int kernel=0; kernel<NUM_TUNED_KERNELS; ++kernel )
+        if( name == ::tunedKernelNames[kernel] )
+            return static_cast<TunedKernel>(kernel);
+    LogicError("Unknown tuned kernel ",name);
+    return NUM_TUNED_KERNELS;
+}
+
+void SetTuning
+( TunedKernel kernel, int gridHeight, int gridWidth, Int n,
+  const TuningEntry& entry )
+{
+    DEBUG_CSE
+    if( entry.blocksize < 0 )
+        LogicError("Tuned blocksizes must be non-negative");
+    ::TuningKey key{ int(kernel), gridHeight, gridWidth, ::SizeBucket(n) };
+    ::tuningTable[key] = entry;
+}
+
+bool LookupTuning
+( TunedKernel kernel, int gridHeight, int gridWidth, Int n,
+  TuningEntry& entry )
+{
+    DEBUG_CSE
+    if( ::tuningTable.empty() )
+        return false;
+
+    // Search the entries for this kernel and grid shape for the nearest
+    // problem size (the table is ordered by bucket within each shape)
+    const Int bucket = ::SizeBucket( n );
+    ::TuningKey key{ int(kernel), gridHeight, gridWidth, bucket };
+    auto upper = ::tuningTable.lower_bound( key );
+    auto sameShape =
+      [&]( const std::map<::TuningKey,TuningEntry>::iterator& it )
+      {
+        return it != ::tuningTable.end() &&
+               it->first.kernel == key.kernel &&
+               it->first.gridHeight == gridHeight &&
+               it->first.gridWidth == gridWidth;
+      };
+    auto best = ::tuningTable.end();
+    if( sameShape(upper) )
+        best = upper;
+    if( upper != ::tuningTable.begin() )
+    {
+        auto lower = std::prev( upper );
+        if( sameShape(lower) &&
+            (best == ::tuningTable.end() ||
+             bucket-lower->first.bucket < best->first.bucket-bucket) )
+            best = lower;
+    }
+    if( best == ::tuningTable.end() )
+        return false;
+    entry = best->second;
+    return true;
+}
+
+void ClearTuning()
+{
+    DEBUG_CSE
+    ::tuningTable.clear();
+}
+
+Int Blocksize( TunedKernel kernel, Int n, int gridHeight, int gridWidth )
+{
+    DEBUG_CSE
+    TuningEntry entry;
+    if( LookupTuning( kernel, gridHeight, gridWidth, n, entry ) &&
+        entry.blocksize > 0 )
+        return entry.blocksize;
+    return Blocksize();
+}
+
+Int TunedVariant( TunedKernel kernel, Int n, int gridHeight, int gridWidth )
+{
+    DEBUG_CSE
+    TuningEntry entry;
+    if( LookupTuning( kernel, gridHeight, gridWidth, n, entry ) )
+        return entry.variant;
+    return -1;
+}
+
+void LoadTuning( const string& filename )
+{
+    DEBUG_CSE
+    ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open tuning file ",filename);
+
+    string line;
+    Int lineNumber = 0;
+    while( std::getline( file, line ) )
+    {
+        ++lineNumber;
+        if( line.empty() || line[0] == '#' )
+            continue;
+        std::istringstream lineStream( line );
+        string kernelName;
+        int gridHeight, gridWidth;
+        Int n;
+        TuningEntry entry;
+        if( !(lineStream >> kernelName >> gridHeight >> gridWidth >> n
+                         >> entry.blocksize >> entry.variant >> entry.seconds) )
+            RuntimeError
+            ("Malformed line ",lineNumber," of tuning file ",filename);
+        SetTuning
+        ( TunedKernelFromName(kernelName), gridHeight, gridWidth, n, entry );
+    }
+}
+
+void SaveTuning( const string& filename, mpi::Comm comm )
+{
+    DEBUG_CSE
+    if( mpi::Rank(comm) != 0 )
+        return;
+    ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open tuning file ",filename);
+    file << "# kernel gridHeight gridWidth n blocksize variant seconds\n";
+    for( const auto& pair : ::tuningTable )
+    {
+        const auto& key = pair.first;
+        const auto& entry = pair.second;
+        file << ::tunedKernelNames[key.kernel] << " "
+             << key.gridHeight << " " << key.gridWidth << " "
+             << (Int(1) << key.bucket) << " "
+             << entry.blocksize << " " << entry.variant << " "
+             << entry.seconds << "\n";
+    }
+    if( !file )
+        RuntimeError("Could not write tuning file ",filename);
+}
+
+TunedBlocksizeScope::TunedBlocksizeScope
+( TunedKernel kernel, Int n, int gridHeight, int gridWidth )
+{ PushBlocksizeStack( Blocksize( kernel, n, gridHeight, gridWidth ) ); }
+
+TunedBlocksizeScope::~TunedBlocksizeScope()
+{ PopBlocksizeStack(); }
+
+} // namespace El
@@ -7,13 +7,14 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
-#include <stack>
 
 namespace {
 
 // Debugging
+// Each thread keeps its own call stack so that functions marked with
+// DEBUG_CSE may be run by OpenMP tasks and threaded loops
 DEBUG_ONLY(
-  std::stack<std::string> callStack;
+  thread_local std::vector<std::string> callStack;
   bool tracingEnabled = false;
 )
 
@@ -38,17 +39,13 @@ DEBUG_ONLY(
       // verified.
       if( !Initialized() )
           return;
-#ifdef EL_HYBRID
-      if( omp_get_thread_num() != 0 )
-          return;
-#endif
       const size_t maxStackSize = 300;
       if( ::callStack.size() > maxStackSize )
       {
           DumpCallStack();
           return;
       }
-      ::callStack.push(s); 
+      ::callStack.push_back(s); 
       if( ::tracingEnabled )
       {
           const int stackSize = ::callStack.size();
@@ -65,13 +62,9 @@ DEBUG_ONLY(
       // See note [1] above.
       if( !Initialized() )
           return;
-#ifdef EL_HYBRID
-      if( omp_get_thread_num() != 0 )
-          return;
-#endif
       if( ::callStack.empty() )
           LogicError("Attempted to pop an empty call stack");
-      ::callStack.pop(); 
+      ::callStack.pop_back(); 
   }
 
   void DumpCallStack( ostream& os )
@@ -79,14 +72,32 @@ DEBUG_ONLY(
       ostringstream msg;
       while( ! ::callStack.empty() )
       {
-          msg << "[" << ::callStack.size() << "]: " << ::callStack.top() 
+          msg << "[" << ::callStack.size() << "]: " << ::callStack.back() 
               << "\n";
-          ::callStack.pop();
+          ::callStack.pop_back();
       }
       os << msg.str();
       os.flush();
   }
 
+  string CallSite()
+  {
+      // Skip past the members of Memory<G>, Matrix<T>, DistMatrix<T,U,V>,
+      // etc., whose (pretty) names qualify the function with a template-id,
+      // as well as the mpi:: wrappers
+      for( auto it=::callStack.rbegin(); it!=::callStack.rend(); ++it )
+      {
+          const string name = it->substr( 0, it->find('(') );
+          const bool member = name.find(">::") != string::npos &&
+            ( name.find("Matrix<") != string::npos ||
+              name.find("Memory<") != string::npos );
+          const bool wrapper = name.find("El::mpi::") != string::npos;
+          if( !member && !wrapper )
+              return *it;
+      }
+      return string();
+  }
+
 ) // DEBUG_ONLY
 
 } // namespace El
@@ -182,6 +182,11 @@ void Initialize( int& argc, char**& argv )
     EmptyBlocksizeStack();
     PushBlocksizeStack( 128 );
 
+    // Load the per-machine autotuning table, if one was specified
+    ClearTuning();
+    if( const char* tuningFile = std::getenv("EL_TUNING_FILE") )
+        LoadTuning( tuningFile );
+
     // Build the default grid
     Grid::InitializeDefault();
 
@@ -210,6 +215,9 @@ void Finalize()
         cerr << "Warning: MPI was finalized before Elemental." << endl;
     if( ::numElemInits == 0 )
     {
+        WriteMemoryReport();
+        mpi::WriteTrafficReport();
+
         delete ::args;
         ::args = 0;
 
@@ -220,6 +228,9 @@ void Finalize()
 
 #ifdef EL_HAVE_QT5
         FinalizeQt5();
+#endif
+#ifdef EL_HAVE_CUBLAS
+        FinalizeCuBLAS();
 #endif
         if( ::elemInitializedMpi )
             mpi::Finalize();
@@ -232,6 +243,8 @@ void Finalize()
 #endif
 
         FinalizeRandom();
+
+        ReleaseMemoryPool();
     }
 
     DEBUG_ONLY( CloseLog() )
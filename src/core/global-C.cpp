@@ -211,4 +211,19 @@ ElError ElPushBlocksizeStack( ElInt blocksize )
 ElError ElPopBlocksizeStack()
 { EL_TRY( El::PopBlocksizeStack() ) }
 
+ElError ElEnableMemoryPool()
+{ EL_TRY( El::EnableMemoryPool() ) }
+
+ElError ElDisableMemoryPool()
+{ EL_TRY( El::DisableMemoryPool() ) }
+
+ElError ElReleaseMemoryPool()
+{ EL_TRY( El::ReleaseMemoryPool() ) }
+
+ElError ElMemoryPoolResidentBytes( size_t* bytes )
+{ EL_TRY( *bytes = El::MemoryPoolResidentBytes() ) }
+
+ElError ElMemoryPoolPeakBytes( size_t* bytes )
+{ EL_TRY( *bytes = El::MemoryPoolPeakBytes() ) }
+
 } // extern "C"
@@ -12,6 +12,9 @@ using El::BlasInt;
 using El::scomplex;
 using El::dcomplex;
 
+// Models of the work of the vendor kernels (for profiling)
+#include "./blas/Work.hpp"
+
 // Level 1
 #include "./blas/Axpy.hpp"
 #include "./blas/Copy.hpp"
@@ -22,6 +25,13 @@ using El::dcomplex;
 #include "./blas/Scal.hpp"
 #include "./blas/Swap.hpp"
 
+// Blocked kernels for DoubleDouble, Quad, and QuadDouble (and fused kernels
+// for BigInt and BigFloat)
+#include "./blas/DoubleDouble.hpp"
+#include "./blas/Blocked.hpp"
+#include "./blas/BigInt.hpp"
+#include "./blas/BigFloat.hpp"
+
 // Level 2
 #include "./blas/Gemv.hpp"
 #include "./blas/Ger.hpp"
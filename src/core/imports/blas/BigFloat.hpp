@@ -0,0 +1,218 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Fused kernels for (real) BigFloat: every update of the form y := y + a b
+// is a single call to mpfr_fma on the destination, so that, unlike the
+// generic kernels, no product is copied into a temporary and each update is
+// only rounded once. The only scalar temporaries are formed once per kernel.
+
+#ifdef EL_HAVE_MPC
+
+namespace El {
+namespace blas {
+namespace bigfloat {
+
+inline void Axpy
+( BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* x, BlasInt incx,
+        BigFloat* y, BlasInt incy )
+{
+    if( mpfr_zero_p(alpha.LockedPointer()) )
+        return;
+    for( BlasInt i=0; i<n; ++i )
+        MultiplyAdd( alpha, x[i*incx], y[i*incy] );
+}
+
+inline BigFloat Dot
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy )
+{
+    BigFloat alpha;
+    alpha.Zero();
+    for( BlasInt i=0; i<n; ++i )
+        MultiplyAdd( x[i*incx], y[i*incy], alpha );
+    return alpha;
+}
+
+// y := y + alpha op(A) x, where op(A) is either A or A^T
+inline void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* x, BlasInt incx,
+        BigFloat* y, BlasInt incy )
+{
+    if( m == 0 || n == 0 || mpfr_zero_p(alpha.LockedPointer()) )
+        return;
+
+    BigFloat gamma;
+    if( std::toupper(trans) == 'N' )
+    {
+        for( BlasInt j=0; j<n; ++j )
+        {
+            mpfr_mul
+            ( gamma.Pointer(), alpha.LockedPointer(),
+              x[j*incx].LockedPointer(), mpfr::RoundingMode() );
+            Axpy( m, gamma, &A[j*ALDim], 1, y, incy );
+        }
+    }
+    else
+    {
+        for( BlasInt i=0; i<n; ++i )
+        {
+            gamma.Zero();
+            const BigFloat* aCol = &A[i*ALDim];
+            for( BlasInt j=0; j<m; ++j )
+                MultiplyAdd( aCol[j], x[j*incx], gamma );
+            MultiplyAdd( alpha, gamma, y[i*incy] );
+        }
+    }
+}
+
+// C := C + alpha op(A) op(B), where op(X) is either X or X^T
+inline void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* B, BlasInt BLDim,
+        BigFloat* C, BlasInt CLDim )
+{
+    if( m == 0 || n == 0 || k == 0 || mpfr_zero_p(alpha.LockedPointer()) )
+        return;
+
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    const BlasInt BRowStride = ( normalB ? 1 : BLDim );
+    const BlasInt BColStride = ( normalB ? BLDim : 1 );
+
+    BigFloat gamma;
+    if( std::toupper(transA) == 'N' )
+    {
+        // Column j of C is updated by columns of A scaled by alpha op(B)
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt l=0; l<k; ++l )
+            {
+                mpfr_mul
+                ( gamma.Pointer(), alpha.LockedPointer(),
+                  B[l*BRowStride+j*BColStride].LockedPointer(),
+                  mpfr::RoundingMode() );
+                Axpy( m, gamma, &A[l*ALDim], 1, &C[j*CLDim], 1 );
+            }
+        }
+    }
+    else
+    {
+        // Each entry of C is updated by alpha times an inner product
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt i=0; i<m; ++i )
+            {
+                gamma.Zero();
+                const BigFloat* aCol = &A[i*ALDim];
+                for( BlasInt l=0; l<k; ++l )
+                    MultiplyAdd
+                    ( aCol[l], B[l*BRowStride+j*BColStride], gamma );
+                MultiplyAdd( alpha, gamma, C[i+j*CLDim] );
+            }
+        }
+    }
+}
+
+} // namespace bigfloat
+
+void Axpy
+( BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* x, BlasInt incx,
+        BigFloat* y, BlasInt incy )
+{
+    DEBUG_CSE
+    bigfloat::Axpy( n, alpha, x, incx, y, incy );
+}
+
+BigFloat Dot
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy )
+{
+    DEBUG_CSE
+    return bigfloat::Dot( n, x, incx, y, incy );
+}
+
+BigFloat Dotc
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy )
+{
+    DEBUG_CSE
+    return bigfloat::Dot( n, x, incx, y, incy );
+}
+
+BigFloat Dotu
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy )
+{
+    DEBUG_CSE
+    return bigfloat::Dot( n, x, incx, y, incy );
+}
+
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat& beta,
+        BigFloat* y, BlasInt incy )
+{
+    DEBUG_CSE
+    const BlasInt yLength = ( std::toupper(trans) == 'N' ? m : n );
+    if( mpfr_zero_p(beta.LockedPointer()) )
+    {
+        for( BlasInt i=0; i<yLength; ++i )
+            y[i*incy].Zero();
+    }
+    else if( beta != BigFloat(1) )
+    {
+        Scal( yLength, beta, y, incy );
+    }
+    bigfloat::Gemv( trans, m, n, alpha, A, ALDim, x, incx, y, incy );
+}
+
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* B, BlasInt BLDim,
+  const BigFloat& beta,
+        BigFloat* C, BlasInt CLDim )
+{
+    DEBUG_CSE
+    if( mpfr_zero_p(beta.LockedPointer()) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim].Zero();
+    }
+    else if( beta != BigFloat(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            Scal( m, beta, &C[j*CLDim], 1 );
+    }
+    bigfloat::Gemm
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
+
+} // namespace blas
+} // namespace El
+
+#endif // ifdef EL_HAVE_MPC
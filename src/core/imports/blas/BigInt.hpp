@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Fused kernels for BigInt which avoid the overhead of the generic
+// (reference) implementations: each update y := y + alpha x is a single
+// call to mpz_addmul (or, when alpha fits in a machine word, mpz_addmul_ui),
+// so that no intermediate product is formed and no memory is allocated
+// unless the entries of y grow. The zero entries of x, which are typical of
+// the size-reduction coefficients within LLL, are skipped.
+
+#ifdef EL_HAVE_MPC
+
+namespace El {
+namespace blas {
+namespace bigint {
+
+inline void Axpy
+( BlasInt n,
+  const BigInt& alpha,
+  const BigInt* x, BlasInt incx,
+        BigInt* y, BlasInt incy )
+{
+    mpz_srcptr alphaPtr = alpha.LockedPointer();
+    if( mpz_sgn(alphaPtr) == 0 )
+        return;
+    if( mpz_fits_slong_p(alphaPtr) )
+    {
+        const long alphaLong = mpz_get_si( alphaPtr );
+        const unsigned long alphaAbs =
+          ( alphaLong > 0 ?
+            static_cast<unsigned long>(alphaLong) :
+            0UL - static_cast<unsigned long>(alphaLong) );
+        if( alphaLong > 0 )
+        {
+            for( BlasInt i=0; i<n; ++i )
+                mpz_addmul_ui
+                ( y[i*incy].Pointer(), x[i*incx].LockedPointer(), alphaAbs );
+        }
+        else
+        {
+            for( BlasInt i=0; i<n; ++i )
+                mpz_submul_ui
+                ( y[i*incy].Pointer(), x[i*incx].LockedPointer(), alphaAbs );
+        }
+    }
+    else
+    {
+        for( BlasInt i=0; i<n; ++i )
+            mpz_addmul
+            ( y[i*incy].Pointer(), x[i*incx].LockedPointer(), alphaPtr );
+    }
+}
+
+// y := y + alpha op(A) x, where op(A) is either A or A^T
+inline void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+  const BigInt* x, BlasInt incx,
+        BigInt* y, BlasInt incy )
+{
+    if( m == 0 || n == 0 || mpz_sgn(alpha.LockedPointer()) == 0 )
+        return;
+
+    BigInt gamma;
+    if( std::toupper(trans) == 'N' )
+    {
+        // Accumulate the columns of A with nonzero coefficients
+        for( BlasInt j=0; j<n; ++j )
+        {
+            mpz_srcptr chi = x[j*incx].LockedPointer();
+            if( mpz_sgn(chi) == 0 )
+                continue;
+            mpz_mul( gamma.Pointer(), chi, alpha.LockedPointer() );
+            Axpy( m, gamma, &A[j*ALDim], 1, y, incy );
+        }
+    }
+    else
+    {
+        // Form each inner product before scaling by alpha
+        for( BlasInt i=0; i<n; ++i )
+        {
+            mpz_set_ui( gamma.Pointer(), 0 );
+            const BigInt* aCol = &A[i*ALDim];
+            for( BlasInt j=0; j<m; ++j )
+            {
+                mpz_srcptr chi = x[j*incx].LockedPointer();
+                if( mpz_sgn(chi) != 0 )
+                    mpz_addmul( gamma.Pointer(), aCol[j].LockedPointer(), chi );
+            }
+            mpz_addmul
+            ( y[i*incy].Pointer(), gamma.LockedPointer(),
+              alpha.LockedPointer() );
+        }
+    }
+}
+
+} // namespace bigint
+
+void Axpy
+( BlasInt n,
+  const BigInt& alpha,
+  const BigInt* x, BlasInt incx,
+        BigInt* y, BlasInt incy )
+{
+    DEBUG_CSE
+    bigint::Axpy( n, alpha, x, incx, y, incy );
+}
+
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+  const BigInt* x, BlasInt incx,
+  const BigInt& beta,
+        BigInt* y, BlasInt incy )
+{
+    DEBUG_CSE
+    const BlasInt yLength = ( std::toupper(trans) == 'N' ? m : n );
+    if( beta == BigInt(0) )
+    {
+        for( BlasInt i=0; i<yLength; ++i )
+            y[i*incy] = 0;
+    }
+    else if( beta != BigInt(1) )
+    {
+        Scal( yLength, beta, y, incy );
+    }
+    bigint::Gemv( trans, m, n, alpha, A, ALDim, x, incx, y, incy );
+}
+
+} // namespace blas
+} // namespace El
+
+#endif // ifdef EL_HAVE_MPC
@@ -0,0 +1,236 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Cache-blocked kernels for the software quad-precision types (Quad,
+// Complex<Quad>, and QuadDouble) in the style of BLIS: op(A) and op(B) are
+// packed into contiguous micro-panels which are streamed through a
+// register-tiled microkernel. Since each quad-precision operation is a
+// (software) function call, the primary benefits are the reuse of each
+// loaded entry across the register tile, the contiguous memory accesses, and
+// the threading. Unlike the DoubleDouble kernels, the arithmetic is left to
+// the type itself: the renormalization of a quad-double sum branches on its
+// data, so splitting the words into separate arrays would not vectorize.
+
+#if defined(EL_HAVE_QUAD) || defined(EL_HAVE_QD)
+
+namespace El {
+namespace blas {
+namespace blocked {
+
+// The register tile is MR x NR, and the cache blocks are MC x KC for op(A)
+// and KC x NC for op(B)
+const BlasInt MR = 4;
+const BlasInt NR = 4;
+const BlasInt MC = 64;
+const BlasInt KC = 128;
+const BlasInt NC = 512;
+
+// Pack the mc x kc block of op(A) starting at (i0,l0) into row panels of
+// height MR (padded with zeros)
+template<typename T>
+void PackA
+( char transA, BlasInt i0, BlasInt l0, BlasInt mc, BlasInt kc,
+  const T* A, BlasInt ALDim, T* APack )
+{
+    const bool normal = ( std::toupper(transA) == 'N' );
+    const bool conjugate = ( std::toupper(transA) == 'C' );
+    const BlasInt numPanels = (mc+MR-1) / MR;
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        T* panel = &APack[p*MR*kc];
+        const BlasInt panelHeight = Min(MR,mc-p*MR);
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            const BlasInt lA = l0 + l;
+            for( BlasInt i=0; i<panelHeight; ++i )
+            {
+                const BlasInt iA = i0 + p*MR + i;
+                if( normal )
+                    panel[i+l*MR] = A[iA+lA*ALDim];
+                else if( conjugate )
+                    panel[i+l*MR] = Conj(A[lA+iA*ALDim]);
+                else
+                    panel[i+l*MR] = A[lA+iA*ALDim];
+            }
+            for( BlasInt i=panelHeight; i<MR; ++i )
+                panel[i+l*MR] = 0;
+        }
+    }
+}
+
+// Pack alpha times the kc x nc block of op(B) starting at (l0,j0) into
+// column panels of width NR (padded with zeros)
+template<typename T>
+void PackB
+( char transB, BlasInt l0, BlasInt j0, BlasInt kc, BlasInt nc,
+  const T& alpha, const T* B, BlasInt BLDim, T* BPack )
+{
+    const bool normal = ( std::toupper(transB) == 'N' );
+    const bool conjugate = ( std::toupper(transB) == 'C' );
+    const BlasInt numPanels = (nc+NR-1) / NR;
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        T* panel = &BPack[p*NR*kc];
+        const BlasInt panelWidth = Min(NR,nc-p*NR);
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            const BlasInt lB = l0 + l;
+            for( BlasInt j=0; j<panelWidth; ++j )
+            {
+                const BlasInt jB = j0 + p*NR + j;
+                if( normal )
+                    panel[j+l*NR] = alpha*B[lB+jB*BLDim];
+                else if( conjugate )
+                    panel[j+l*NR] = alpha*Conj(B[jB+lB*BLDim]);
+                else
+                    panel[j+l*NR] = alpha*B[jB+lB*BLDim];
+            }
+            for( BlasInt j=panelWidth; j<NR; ++j )
+                panel[j+l*NR] = 0;
+        }
+    }
+}
+
+// C := A B, where A is a packed MR x kc panel, B is a packed kc x NR panel,
+// and C is an MR x NR column-major tile
+template<typename T>
+void MicroKernel( BlasInt kc, const T* APanel, const T* BPanel, T* CTile )
+{
+    for( BlasInt i=0; i<MR*NR; ++i )
+        CTile[i] = 0;
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const T* a = &APanel[l*MR];
+        const T* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+            for( BlasInt i=0; i<MR; ++i )
+                CTile[i+j*MR] += a[i]*b[j];
+    }
+}
+
+// C := alpha op(A) op(B) + C
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    if( m == 0 || n == 0 || k == 0 || alpha == T(0) )
+        return;
+
+    const BlasInt kcMax = Min(KC,k);
+    const BlasInt mcPad = ((Min(MC,m)+MR-1)/MR)*MR;
+    const BlasInt ncPad = ((Min(NC,n)+NR-1)/NR)*NR;
+    vector<T> APack(mcPad*kcMax), BPack(kcMax*ncPad);
+    for( BlasInt j0=0; j0<n; j0+=NC )
+    {
+        const BlasInt nc = Min(NC,n-j0);
+        const BlasInt numColPanels = (nc+NR-1) / NR;
+        for( BlasInt l0=0; l0<k; l0+=KC )
+        {
+            const BlasInt kc = Min(KC,k-l0);
+            PackB( transB, l0, j0, kc, nc, alpha, B, BLDim, BPack.data() );
+            for( BlasInt i0=0; i0<m; i0+=MC )
+            {
+                const BlasInt mc = Min(MC,m-i0);
+                const BlasInt numRowPanels = (mc+MR-1) / MR;
+                PackA( transA, i0, l0, mc, kc, A, ALDim, APack.data() );
+
+                EL_PARALLEL_FOR_COLLAPSE2
+                for( BlasInt jp=0; jp<numColPanels; ++jp )
+                {
+                    for( BlasInt ip=0; ip<numRowPanels; ++ip )
+                    {
+                        T CTile[MR*NR];
+                        MicroKernel
+                        ( kc, &APack[ip*MR*kc], &BPack[jp*NR*kc], CTile );
+
+                        const BlasInt iOff = i0 + ip*MR;
+                        const BlasInt jOff = j0 + jp*NR;
+                        const BlasInt tileHeight = Min(MR,m-iOff);
+                        const BlasInt tileWidth = Min(NR,n-jOff);
+                        for( BlasInt j=0; j<tileWidth; ++j )
+                            for( BlasInt i=0; i<tileHeight; ++i )
+                                C[(iOff+i)+(jOff+j)*CLDim] += CTile[i+j*MR];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// y := alpha op(A) x + y
+template<typename T>
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* x, BlasInt incx,
+        T* y, BlasInt incy )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool conjugate = ( std::toupper(trans) == 'C' );
+    const BlasInt xLength = ( normal ? n : m );
+    if( m == 0 || n == 0 || alpha == T(0) )
+        return;
+
+    // Prescale x
+    vector<T> xScaled(xLength);
+    for( BlasInt j=0; j<xLength; ++j )
+        xScaled[j] = alpha*x[j*incx];
+
+    if( normal )
+    {
+        // Each thread accumulates a block of MC entries of y
+        const BlasInt numBlocks = (m+MC-1) / MC;
+        EL_PARALLEL_FOR
+        for( BlasInt b=0; b<numBlocks; ++b )
+        {
+            const BlasInt i0 = b*MC;
+            const BlasInt blockHeight = Min(MC,m-i0);
+            T w[MC];
+            for( BlasInt i=0; i<blockHeight; ++i )
+                w[i] = 0;
+            for( BlasInt j=0; j<n; ++j )
+            {
+                const T* aCol = &A[i0+j*ALDim];
+                const T& chi = xScaled[j];
+                for( BlasInt i=0; i<blockHeight; ++i )
+                    w[i] += aCol[i]*chi;
+            }
+            for( BlasInt i=0; i<blockHeight; ++i )
+                y[(i0+i)*incy] += w[i];
+        }
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( BlasInt j=0; j<n; ++j )
+        {
+            const T* aCol = &A[j*ALDim];
+            T sum = 0;
+            if( conjugate )
+                for( BlasInt i=0; i<m; ++i )
+                    sum += Conj(aCol[i])*xScaled[i];
+            else
+                for( BlasInt i=0; i<m; ++i )
+                    sum += aCol[i]*xScaled[i];
+            y[j*incy] += sum;
+        }
+    }
+}
+
+} // namespace blocked
+} // namespace blas
+} // namespace El
+
+#endif // if defined(EL_HAVE_QUAD) || defined(EL_HAVE_QD)
@@ -0,0 +1,328 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Blocked kernels for DoubleDouble which avoid the overhead of the generic
+// (reference) implementations. The operands are repacked into separate arrays
+// of the high and low words so that the double-double arithmetic, which is
+// expressed directly in terms of the error-free transformations of Dekker
+// and Knuth (as in the QD library), can be vectorized by the compiler.
+//
+// NOTE: These kernels are only correct if the compiler respects IEEE
+//       semantics for the double-precision operations (e.g., no -ffast-math).
+
+#ifdef EL_HAVE_QD
+
+namespace El {
+namespace blas {
+namespace dd {
+
+// The register tile is MR x NR, and the cache blocks are MC x KC for op(A)
+// and KC x NC for op(B)
+const BlasInt MR = 8;
+const BlasInt NR = 4;
+const BlasInt MC = 64;
+const BlasInt KC = 256;
+const BlasInt NC = 512;
+
+inline void QuickTwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    e = b - (s - a);
+}
+
+inline void TwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    const double bb = s - a;
+    e = (a - (s - bb)) + (b - bb);
+}
+
+inline void TwoProd( double a, double b, double& p, double& e )
+{
+    p = a*b;
+#ifdef FP_FAST_FMA
+    e = std::fma( a, b, -p );
+#else
+    // Dekker's splitting into 26-bit halves
+    const double split = 134217729.; // 2^27 + 1
+    double t = split*a;
+    const double aHi = t - (t - a);
+    const double aLo = a - aHi;
+    t = split*b;
+    const double bHi = t - (t - b);
+    const double bLo = b - bHi;
+    e = ((aHi*bHi - p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+#endif
+}
+
+// (cHi,cLo) += (aHi,aLo) (bHi,bLo) using the accurate (IEEE-style)
+// double-double addition
+inline void MultiplyAdd
+( double aHi, double aLo, double bHi, double bLo, double& cHi, double& cLo )
+{
+    double p, e;
+    TwoProd( aHi, bHi, p, e );
+    e += aHi*bLo + aLo*bHi;
+    QuickTwoSum( p, e, p, e );
+
+    double s1, s2, t1, t2;
+    TwoSum( cHi, p, s1, s2 );
+    TwoSum( cLo, e, t1, t2 );
+    s2 += t1;
+    QuickTwoSum( s1, s2, s1, s2 );
+    s2 += t2;
+    QuickTwoSum( s1, s2, cHi, cLo );
+}
+
+// Pack the mc x kc block of op(A) starting at (i0,l0) into row panels of
+// height MR (padded with zeros)
+inline void PackA
+( char transA, BlasInt i0, BlasInt l0, BlasInt mc, BlasInt kc,
+  const DoubleDouble* A, BlasInt ALDim, double* aHi, double* aLo )
+{
+    const bool normal = ( std::toupper(transA) == 'N' );
+    const BlasInt numPanels = (mc+MR-1) / MR;
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        double* panelHi = &aHi[p*MR*kc];
+        double* panelLo = &aLo[p*MR*kc];
+        const BlasInt panelHeight = Min(MR,mc-p*MR);
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<panelHeight; ++i )
+            {
+                const BlasInt iA = i0 + p*MR + i;
+                const BlasInt lA = l0 + l;
+                const dd_real& alpha =
+                  ( normal ? A[iA+lA*ALDim] : A[lA+iA*ALDim] );
+                panelHi[i+l*MR] = alpha.x[0];
+                panelLo[i+l*MR] = alpha.x[1];
+            }
+            for( BlasInt i=panelHeight; i<MR; ++i )
+            {
+                panelHi[i+l*MR] = 0;
+                panelLo[i+l*MR] = 0;
+            }
+        }
+    }
+}
+
+// Pack alpha times the kc x nc block of op(B) starting at (l0,j0) into
+// column panels of width NR (padded with zeros)
+inline void PackB
+( char transB, BlasInt l0, BlasInt j0, BlasInt kc, BlasInt nc,
+  const DoubleDouble& alpha,
+  const DoubleDouble* B, BlasInt BLDim, double* bHi, double* bLo )
+{
+    const bool normal = ( std::toupper(transB) == 'N' );
+    const BlasInt numPanels = (nc+NR-1) / NR;
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        double* panelHi = &bHi[p*NR*kc];
+        double* panelLo = &bLo[p*NR*kc];
+        const BlasInt panelWidth = Min(NR,nc-p*NR);
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<panelWidth; ++j )
+            {
+                const BlasInt lB = l0 + l;
+                const BlasInt jB = j0 + p*NR + j;
+                const dd_real beta = alpha*
+                  ( normal ? B[lB+jB*BLDim] : B[jB+lB*BLDim] );
+                panelHi[j+l*NR] = beta.x[0];
+                panelLo[j+l*NR] = beta.x[1];
+            }
+            for( BlasInt j=panelWidth; j<NR; ++j )
+            {
+                panelHi[j+l*NR] = 0;
+                panelLo[j+l*NR] = 0;
+            }
+        }
+    }
+}
+
+// C := A B, where A is a packed MR x kc panel, B is a packed kc x NR panel,
+// and C is an MR x NR column-major tile
+inline void MicroKernel
+( BlasInt kc,
+  const double* aHi, const double* aLo,
+  const double* bHi, const double* bLo,
+        double* cHi,       double* cLo )
+{
+    for( BlasInt i=0; i<MR*NR; ++i )
+    {
+        cHi[i] = 0;
+        cLo[i] = 0;
+    }
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const double* aHiCol = &aHi[l*MR];
+        const double* aLoCol = &aLo[l*MR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            const double betaHi = bHi[j+l*NR];
+            const double betaLo = bLo[j+l*NR];
+            for( BlasInt i=0; i<MR; ++i )
+                MultiplyAdd
+                ( aHiCol[i], aLoCol[i], betaHi, betaLo,
+                  cHi[i+j*MR], cLo[i+j*MR] );
+        }
+    }
+}
+
+// C := alpha op(A) op(B) + C
+inline void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    if( m == 0 || n == 0 || k == 0 || alpha == DoubleDouble(0) )
+        return;
+
+    const BlasInt kcMax = Min(KC,k);
+    const BlasInt mcMax = Min(MC,m);
+    const BlasInt ncMax = Min(NC,n);
+    const BlasInt mcPad = ((mcMax+MR-1)/MR)*MR;
+    const BlasInt ncPad = ((ncMax+NR-1)/NR)*NR;
+    vector<double> aHi(mcPad*kcMax), aLo(mcPad*kcMax),
+                   bHi(kcMax*ncPad), bLo(kcMax*ncPad);
+    for( BlasInt j0=0; j0<n; j0+=NC )
+    {
+        const BlasInt nc = Min(NC,n-j0);
+        const BlasInt numColPanels = (nc+NR-1) / NR;
+        for( BlasInt l0=0; l0<k; l0+=KC )
+        {
+            const BlasInt kc = Min(KC,k-l0);
+            PackB
+            ( transB, l0, j0, kc, nc, alpha, B, BLDim,
+              bHi.data(), bLo.data() );
+            for( BlasInt i0=0; i0<m; i0+=MC )
+            {
+                const BlasInt mc = Min(MC,m-i0);
+                const BlasInt numRowPanels = (mc+MR-1) / MR;
+                PackA
+                ( transA, i0, l0, mc, kc, A, ALDim,
+                  aHi.data(), aLo.data() );
+
+                EL_PARALLEL_FOR_COLLAPSE2
+                for( BlasInt jp=0; jp<numColPanels; ++jp )
+                {
+                    for( BlasInt ip=0; ip<numRowPanels; ++ip )
+                    {
+                        double cHi[MR*NR], cLo[MR*NR];
+                        MicroKernel
+                        ( kc,
+                          &aHi[ip*MR*kc], &aLo[ip*MR*kc],
+                          &bHi[jp*NR*kc], &bLo[jp*NR*kc],
+                          cHi, cLo );
+
+                        const BlasInt iOff = i0 + ip*MR;
+                        const BlasInt jOff = j0 + jp*NR;
+                        const BlasInt tileHeight = Min(MR,m-iOff);
+                        const BlasInt tileWidth = Min(NR,n-jOff);
+                        for( BlasInt j=0; j<tileWidth; ++j )
+                            for( BlasInt i=0; i<tileHeight; ++i )
+                                C[(iOff+i)+(jOff+j)*CLDim] +=
+                                  dd_real(cHi[i+j*MR],cLo[i+j*MR]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// y := alpha op(A) x + y
+inline void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+        DoubleDouble* y, BlasInt incy )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt xLength = ( normal ? n : m );
+    if( m == 0 || n == 0 || alpha == DoubleDouble(0) )
+        return;
+
+    // Prescale and unpack x
+    vector<double> xHi(xLength), xLo(xLength);
+    for( BlasInt j=0; j<xLength; ++j )
+    {
+        const dd_real chi = alpha*x[j*incx];
+        xHi[j] = chi.x[0];
+        xLo[j] = chi.x[1];
+    }
+
+    if( normal )
+    {
+        // Each thread accumulates a block of MC entries of y
+        const BlasInt numBlocks = (m+MC-1) / MC;
+        EL_PARALLEL_FOR
+        for( BlasInt b=0; b<numBlocks; ++b )
+        {
+            const BlasInt i0 = b*MC;
+            const BlasInt blockHeight = Min(MC,m-i0);
+            double wHi[MC], wLo[MC];
+            for( BlasInt i=0; i<blockHeight; ++i )
+            {
+                wHi[i] = 0;
+                wLo[i] = 0;
+            }
+            for( BlasInt j=0; j<n; ++j )
+            {
+                const DoubleDouble* aCol = &A[i0+j*ALDim];
+                for( BlasInt i=0; i<blockHeight; ++i )
+                    MultiplyAdd
+                    ( aCol[i].x[0], aCol[i].x[1], xHi[j], xLo[j],
+                      wHi[i], wLo[i] );
+            }
+            for( BlasInt i=0; i<blockHeight; ++i )
+                y[(i0+i)*incy] += dd_real(wHi[i],wLo[i]);
+        }
+    }
+    else
+    {
+        // Each dot product is accumulated in MR independent lanes
+        EL_PARALLEL_FOR
+        for( BlasInt j=0; j<n; ++j )
+        {
+            const DoubleDouble* aCol = &A[j*ALDim];
+            double accHi[MR], accLo[MR];
+            for( BlasInt i=0; i<MR; ++i )
+            {
+                accHi[i] = 0;
+                accLo[i] = 0;
+            }
+            BlasInt i0=0;
+            for( ; i0+MR<=m; i0+=MR )
+                for( BlasInt i=0; i<MR; ++i )
+                    MultiplyAdd
+                    ( aCol[i0+i].x[0], aCol[i0+i].x[1],
+                      xHi[i0+i], xLo[i0+i], accHi[i], accLo[i] );
+            for( BlasInt i=i0; i<m; ++i )
+                MultiplyAdd
+                ( aCol[i].x[0], aCol[i].x[1], xHi[i], xLo[i],
+                  accHi[0], accLo[0] );
+
+            dd_real sum(accHi[0],accLo[0]);
+            for( BlasInt i=1; i<MR; ++i )
+                sum += dd_real(accHi[i],accLo[i]);
+            y[j*incy] += sum;
+        }
+    }
+}
+
+} // namespace dd
+} // namespace blas
+} // namespace El
+
+#endif // ifdef EL_HAVE_QD
@@ -347,6 +347,106 @@ template void Gemm
         Complex<BigFloat>* C, BlasInt CLDim );
 #endif
 
+#ifdef EL_HAVE_QD
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    DEBUG_CSE
+    if( beta == DoubleDouble(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != DoubleDouble(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+    dd::Gemm( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
+#endif
+
+#if defined(EL_HAVE_QUAD) || defined(EL_HAVE_QD)
+template<typename T>
+void BlockedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    DEBUG_CSE
+    if( beta == T(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+    blocked::Gemm
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
+#endif
+
+#ifdef EL_HAVE_QD
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble* B, BlasInt BLDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim )
+{
+    BlockedGemm
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+#endif
+
+#ifdef EL_HAVE_QUAD
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad* B, BlasInt BLDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim )
+{
+    BlockedGemm
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* A, BlasInt ALDim,
+  const Complex<Quad>* B, BlasInt BLDim,
+  const Complex<Quad>& beta,
+        Complex<Quad>* C, BlasInt CLDim )
+{
+    BlockedGemm
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+#endif
+
 void Gemm
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k, 
@@ -385,6 +485,16 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    ProfileRegion region( "blas::Gemm", work::Gemm<float>( m, n, k ) );
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::ShouldOffload( m, n, k ) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(sgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -428,6 +538,16 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    ProfileRegion region( "blas::Gemm", work::Gemm<double>( m, n, k ) );
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::ShouldOffload( m, n, k ) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(dgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -468,6 +588,16 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    ProfileRegion region( "blas::Gemm", work::Gemm<scomplex>( m, n, k ) );
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::ShouldOffload( m, n, k ) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(cgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -508,6 +638,16 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    ProfileRegion region( "blas::Gemm", work::Gemm<dcomplex>( m, n, k ) );
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::ShouldOffload( m, n, k ) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(zgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -211,6 +211,52 @@ template void Gemv
         Complex<BigFloat>* y, BlasInt incy );
 #endif
 
+#ifdef EL_HAVE_QD
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy )
+{
+    DEBUG_CSE
+    const BlasInt yLength = ( std::toupper(trans) == 'N' ? m : n );
+    if( beta == DoubleDouble(0) )
+    {
+        for( BlasInt i=0; i<yLength; ++i )
+            y[i*incy] = 0;
+    }
+    else if( beta != DoubleDouble(1) )
+    {
+        Scal( yLength, beta, y, incy );
+    }
+    dd::Gemv( trans, m, n, alpha, A, ALDim, x, incx, y, incy );
+}
+
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble* x, BlasInt incx,
+  const QuadDouble& beta,
+        QuadDouble* y, BlasInt incy )
+{
+    DEBUG_CSE
+    const BlasInt yLength = ( std::toupper(trans) == 'N' ? m : n );
+    if( beta == QuadDouble(0) )
+    {
+        for( BlasInt i=0; i<yLength; ++i )
+            y[i*incy] = 0;
+    }
+    else if( beta != QuadDouble(1) )
+    {
+        Scal( yLength, beta, y, incy );
+    }
+    blocked::Gemv( trans, m, n, alpha, A, ALDim, x, incx, y, incy );
+}
+#endif
+
 void Gemv
 ( char trans, BlasInt m, BlasInt n,
   const float& alpha,
@@ -220,6 +266,7 @@ void Gemv
         float* y, BlasInt incy )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    ProfileRegion region( "blas::Gemv", work::Gemv<float>( m, n ) );
     EL_BLAS(sgemv)
     ( &fixedTrans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
 }
@@ -233,6 +280,7 @@ void Gemv
         double* y, BlasInt incy )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    ProfileRegion region( "blas::Gemv", work::Gemv<double>( m, n ) );
     EL_BLAS(dgemv)
     ( &fixedTrans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
 }
@@ -244,8 +292,11 @@ void Gemv
   const scomplex* x, BlasInt incx,
   const scomplex& beta,
         scomplex* y, BlasInt incy )
-{ EL_BLAS(cgemv)
-  ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    ProfileRegion region( "blas::Gemv", work::Gemv<scomplex>( m, n ) );
+    EL_BLAS(cgemv)
+    ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 void Gemv
 ( char trans, BlasInt m, BlasInt n,
@@ -254,8 +305,11 @@ void Gemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy )
-{ EL_BLAS(zgemv)
-  ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    ProfileRegion region( "blas::Gemv", work::Gemv<dcomplex>( m, n ) );
+    EL_BLAS(zgemv)
+    ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 } // namespace blas
 } // namespace El
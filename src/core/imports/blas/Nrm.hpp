@@ -43,8 +43,7 @@ Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx )
     typedef Base<F> Real;
     Real scale = 0; 
     Real scaledSquare = 1;
-    for( BlasInt i=0; i<n; ++i )
-        UpdateScaledSquare( x[i*incx], scale, scaledSquare );
+    UpdateScaledSquares( n, x, incx, scale, scaledSquare );
     return scale*Sqrt(scaledSquare);
 }
 template float Nrm2( BlasInt n, const float* x, BlasInt incx );
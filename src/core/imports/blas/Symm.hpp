@@ -324,6 +324,7 @@ void Hemm
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Hemm", work::Hemm<float>( side, m, n ) );
     EL_BLAS(ssymm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -337,6 +338,7 @@ void Hemm
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Hemm", work::Hemm<double>( side, m, n ) );
     EL_BLAS(dsymm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -350,6 +352,7 @@ void Hemm
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Hemm", work::Hemm<scomplex>( side, m, n ) );
     EL_BLAS(chemm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -363,6 +366,7 @@ void Hemm
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Hemm", work::Hemm<dcomplex>( side, m, n ) );
     EL_BLAS(zhemm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -632,6 +636,7 @@ void Symm
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Symm", work::Hemm<float>( side, m, n ) );
     EL_BLAS(ssymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -644,6 +649,7 @@ void Symm
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Symm", work::Hemm<double>( side, m, n ) );
     EL_BLAS(dsymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -656,6 +662,7 @@ void Symm
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Symm", work::Hemm<scomplex>( side, m, n ) );
     EL_BLAS(csymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -668,6 +675,7 @@ void Symm
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Symm", work::Hemm<dcomplex>( side, m, n ) );
     EL_BLAS(zsymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -296,6 +296,7 @@ void Her2k
         float* C, BlasInt CLDim )
 {
     const char transFixed = ( trans == 'C' ? 'T' : trans );
+    ProfileRegion region( "blas::Her2k", work::Her2k<float>( n, k ) );
     EL_BLAS(ssyr2k)
     ( &uplo, &transFixed, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -311,6 +312,7 @@ void Her2k
         double* C, BlasInt CLDim )
 {
     const char transFixed = ( trans == 'C' ? 'T' : trans );
+    ProfileRegion region( "blas::Her2k", work::Her2k<double>( n, k ) );
     EL_BLAS(dsyr2k)
     ( &uplo, &transFixed, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -325,6 +327,7 @@ void Her2k
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Her2k", work::Her2k<scomplex>( n, k ) );
     EL_BLAS(cher2k)
     ( &uplo, &trans, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -339,6 +342,7 @@ void Her2k
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Her2k", work::Her2k<dcomplex>( n, k ) );
     EL_BLAS(zher2k)
     ( &uplo, &trans, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -566,6 +570,7 @@ void Syr2k
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Syr2k", work::Her2k<float>( n, k ) );
     EL_BLAS(ssyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -579,6 +584,7 @@ void Syr2k
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Syr2k", work::Her2k<double>( n, k ) );
     EL_BLAS(dsyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -592,6 +598,7 @@ void Syr2k
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Syr2k", work::Her2k<scomplex>( n, k ) );
     EL_BLAS(csyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -605,6 +612,7 @@ void Syr2k
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Syr2k", work::Her2k<dcomplex>( n, k ) );
     EL_BLAS(zsyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
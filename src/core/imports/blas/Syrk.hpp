@@ -249,6 +249,7 @@ void Herk
         float* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    ProfileRegion region( "blas::Herk", work::Herk<float>( n, k ) );
     EL_BLAS(ssyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -262,6 +263,7 @@ void Herk
         double* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    ProfileRegion region( "blas::Herk", work::Herk<double>( n, k ) );
     EL_BLAS(dsyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -274,6 +276,7 @@ void Herk
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Herk", work::Herk<scomplex>( n, k ) );
     EL_BLAS(cherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -286,6 +289,7 @@ void Herk
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Herk", work::Herk<dcomplex>( n, k ) );
     EL_BLAS(zherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -483,6 +487,7 @@ void Syrk
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Syrk", work::Herk<float>( n, k ) );
     EL_BLAS(ssyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -494,6 +499,7 @@ void Syrk
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Syrk", work::Herk<double>( n, k ) );
     EL_BLAS(dsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -505,6 +511,7 @@ void Syrk
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Syrk", work::Herk<scomplex>( n, k ) );
     EL_BLAS(csyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -516,6 +523,7 @@ void Syrk
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    ProfileRegion region( "blas::Syrk", work::Herk<dcomplex>( n, k ) );
     EL_BLAS(zsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
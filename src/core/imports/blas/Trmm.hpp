@@ -152,6 +152,7 @@ void Trmm
         float* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
+    ProfileRegion region( "blas::Trmm", work::Trmm<float>( side, m, n ) );
     EL_BLAS(strmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -163,6 +164,7 @@ void Trmm
         double* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
+    ProfileRegion region( "blas::Trmm", work::Trmm<double>( side, m, n ) );
     EL_BLAS(dtrmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -173,6 +175,7 @@ void Trmm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    ProfileRegion region( "blas::Trmm", work::Trmm<scomplex>( side, m, n ) );
     EL_BLAS(ctrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -183,6 +186,7 @@ void Trmm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    ProfileRegion region( "blas::Trmm", work::Trmm<dcomplex>( side, m, n ) );
     EL_BLAS(ztrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
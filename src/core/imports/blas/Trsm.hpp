@@ -348,6 +348,125 @@ template void Trsm
         Complex<BigFloat>* B, BlasInt BLDim );
 #endif
 
+#ifdef EL_HAVE_QD
+namespace blocked {
+
+// Blocks of at most this size are solved with the reference implementation
+const BlasInt TRSM_LEAF_SIZE = 64;
+
+// Recursively split the triangular matrix in half so that nearly all of the
+// work is cast in terms of the blocked DoubleDouble or QuadDouble Gemm
+template<typename T>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+        T* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt triSize = ( onLeft ? m : n );
+    if( triSize <= TRSM_LEAF_SIZE )
+    {
+        blas::Trsm<T>
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+    const T one(1), negOne(-1);
+    const BlasInt s1 = triSize/2;
+    const BlasInt s2 = triSize-s1;
+    const T* A11 = A;
+    const T* A12 = &A[s1*ALDim];
+    const T* A21 = &A[s1];
+    const T* A22 = &A[s1+s1*ALDim];
+
+    if( onLeft )
+    {
+        T* B1 = B;
+        T* B2 = &B[s1];
+        if( lower == normal )
+        {
+            // Solve against op(A)11, then B2 := alpha B2 - op(A)21 X1
+            blocked::Trsm
+            ( side, uplo, trans, unit, s1, n, alpha, A11, ALDim, B1, BLDim );
+            blas::Gemm
+            ( normal ? 'N' : 'T', 'N', s2, n, s1,
+              negOne, normal ? A21 : A12, ALDim, B1, BLDim,
+              alpha, B2, BLDim );
+            blocked::Trsm
+            ( side, uplo, trans, unit, s2, n, one, A22, ALDim, B2, BLDim );
+        }
+        else
+        {
+            // Solve against op(A)22, then B1 := alpha B1 - op(A)12 X2
+            blocked::Trsm
+            ( side, uplo, trans, unit, s2, n, alpha, A22, ALDim, B2, BLDim );
+            blas::Gemm
+            ( normal ? 'N' : 'T', 'N', s1, n, s2,
+              negOne, normal ? A12 : A21, ALDim, B2, BLDim,
+              alpha, B1, BLDim );
+            blocked::Trsm
+            ( side, uplo, trans, unit, s1, n, one, A11, ALDim, B1, BLDim );
+        }
+    }
+    else
+    {
+        T* B1 = B;
+        T* B2 = &B[s1*BLDim];
+        if( lower != normal )
+        {
+            // Solve against op(A)11, then B2 := alpha B2 - X1 op(A)12
+            blocked::Trsm
+            ( side, uplo, trans, unit, m, s1, alpha, A11, ALDim, B1, BLDim );
+            blas::Gemm
+            ( 'N', normal ? 'N' : 'T', m, s2, s1,
+              negOne, B1, BLDim, normal ? A12 : A21, ALDim,
+              alpha, B2, BLDim );
+            blocked::Trsm
+            ( side, uplo, trans, unit, m, s2, one, A22, ALDim, B2, BLDim );
+        }
+        else
+        {
+            // Solve against op(A)22, then B1 := alpha B1 - X2 op(A)21
+            blocked::Trsm
+            ( side, uplo, trans, unit, m, s2, alpha, A22, ALDim, B2, BLDim );
+            blas::Gemm
+            ( 'N', normal ? 'N' : 'T', m, s1, s2,
+              negOne, B2, BLDim, normal ? A21 : A12, ALDim,
+              alpha, B1, BLDim );
+            blocked::Trsm
+            ( side, uplo, trans, unit, m, s1, one, A11, ALDim, B1, BLDim );
+        }
+    }
+}
+
+} // namespace blocked
+
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* B, BlasInt BLDim )
+{
+    DEBUG_CSE
+    blocked::Trsm( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+}
+
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+        QuadDouble* B, BlasInt BLDim )
+{
+    DEBUG_CSE
+    blocked::Trsm( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+}
+#endif
+
 void Trsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
@@ -356,6 +475,7 @@ void Trsm
         float* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    ProfileRegion region( "blas::Trsm", work::Trsm<float>( side, m, n ) );
     EL_BLAS(strsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -368,6 +488,7 @@ void Trsm
         double* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    ProfileRegion region( "blas::Trsm", work::Trsm<double>( side, m, n ) );
     EL_BLAS(dtrsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -379,6 +500,7 @@ void Trsm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    ProfileRegion region( "blas::Trsm", work::Trsm<scomplex>( side, m, n ) );
     EL_BLAS(ctrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -390,6 +512,7 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    ProfileRegion region( "blas::Trsm", work::Trsm<dcomplex>( side, m, n ) );
     EL_BLAS(ztrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Models of the work performed by the (vendor) BLAS kernels, which are
+// attributed to the profiling regions surrounding them. The memory traffic
+// assumes that each operand is read once and each output is also written
+// once.
+
+namespace El {
+namespace blas {
+namespace work {
+
+template<typename T>
+inline KernelWork Model( double realFlops, double numEntries )
+{
+    KernelWork work;
+    work.flops = ( IsComplex<T>::value ? 4 : 1 )*realFlops;
+    work.bytes = sizeof(T)*numEntries;
+    return work;
+}
+
+template<typename T>
+inline KernelWork Gemv( BlasInt m, BlasInt n )
+{ return Model<T>( 2.*m*n, double(m)*n+m+n+Min(m,n) ); }
+
+template<typename T>
+inline KernelWork Gemm( BlasInt m, BlasInt n, BlasInt k )
+{ return Model<T>( 2.*m*n*k, double(m)*k+double(k)*n+2.*m*n ); }
+
+// C := alpha A B + beta C or alpha B A + beta C, with A symmetric/Hermitian
+template<typename T>
+inline KernelWork Hemm( char side, BlasInt m, BlasInt n )
+{
+    const double a = ( std::toupper(side) == 'L' ? m : n );
+    return Model<T>( 2.*a*m*n, a*a/2+3.*m*n );
+}
+
+// The triangle of the n x n matrix C := alpha A A^H + beta C, with A n x k
+template<typename T>
+inline KernelWork Herk( BlasInt n, BlasInt k )
+{ return Model<T>( double(n)*n*k, double(n)*k+double(n)*n ); }
+
+template<typename T>
+inline KernelWork Her2k( BlasInt n, BlasInt k )
+{ return Model<T>( 2.*n*n*k, 2.*n*k+double(n)*n ); }
+
+// Applying (the inverse of) a triangular matrix to the m x n matrix B
+template<typename T>
+inline KernelWork Trmm( char side, BlasInt m, BlasInt n )
+{
+    const double a = ( std::toupper(side) == 'L' ? m : n );
+    return Model<T>( a*m*n, a*a/2+2.*m*n );
+}
+
+template<typename T>
+inline KernelWork Trsm( char side, BlasInt m, BlasInt n )
+{ return Trmm<T>( side, m, n ); }
+
+} // namespace work
+} // namespace blas
+} // namespace El
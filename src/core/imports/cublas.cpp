@@ -0,0 +1,273 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#ifdef EL_HAVE_CUBLAS
+#include <cuda_runtime.h>
+#include <cublas_v2.h>
+
+namespace {
+using namespace El;
+
+bool initializedCuBLAS = false;
+cublasHandle_t handle;
+cudaStream_t stream;
+void* workspace = nullptr;
+size_t workspaceSize = 0;
+
+// 256^3 multiply-adds is roughly where the transfers stop dominating
+double offloadThreshold = 256.*256.*256.;
+
+void CheckCuda( cudaError_t error )
+{
+    if( error != cudaSuccess )
+        RuntimeError("CUDA error: ",cudaGetErrorString(error));
+}
+
+void CheckCuBLAS( cublasStatus_t status )
+{
+    if( status != CUBLAS_STATUS_SUCCESS )
+        RuntimeError("cuBLAS error: ",int(status));
+}
+
+void EnsureInitialized()
+{
+    if( ::initializedCuBLAS )
+        return;
+    CheckCuBLAS( cublasCreate( &::handle ) );
+    CheckCuda( cudaStreamCreate( &::stream ) );
+    CheckCuBLAS( cublasSetStream( ::handle, ::stream ) );
+    ::initializedCuBLAS = true;
+}
+
+void* Workspace( size_t numBytes )
+{
+    if( numBytes > ::workspaceSize )
+    {
+        // The previous contents are never needed, so the stream only needs
+        // to be drained before the old buffer is released
+        CheckCuda( cudaStreamSynchronize( ::stream ) );
+        if( ::workspace != nullptr )
+            CheckCuda( cudaFree( ::workspace ) );
+        ::workspace = nullptr;
+        ::workspaceSize = 0;
+        CheckCuda( cudaMalloc( &::workspace, numBytes ) );
+        ::workspaceSize = numBytes;
+    }
+    return ::workspace;
+}
+
+cublasOperation_t CharToOperation( char trans )
+{
+    switch( std::toupper(trans) )
+    {
+    case 'N': return CUBLAS_OP_N;
+    case 'T': return CUBLAS_OP_T;
+    default:  return CUBLAS_OP_C;
+    }
+}
+
+cublasStatus_t DeviceGemm
+( cublasOperation_t opA, cublasOperation_t opB,
+  int m, int n, int k,
+  const float* alpha, const float* A, int ALDim,
+                      const float* B, int BLDim,
+  const float* beta,        float* C, int CLDim )
+{
+    return cublasSgemm
+    ( ::handle, opA, opB, m, n, k,
+      alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+
+cublasStatus_t DeviceGemm
+( cublasOperation_t opA, cublasOperation_t opB,
+  int m, int n, int k,
+  const double* alpha, const double* A, int ALDim,
+                       const double* B, int BLDim,
+  const double* beta,        double* C, int CLDim )
+{
+    return cublasDgemm
+    ( ::handle, opA, opB, m, n, k,
+      alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+
+cublasStatus_t DeviceGemm
+( cublasOperation_t opA, cublasOperation_t opB,
+  int m, int n, int k,
+  const scomplex* alpha, const scomplex* A, int ALDim,
+                         const scomplex* B, int BLDim,
+  const scomplex* beta,        scomplex* C, int CLDim )
+{
+    return cublasCgemm
+    ( ::handle, opA, opB, m, n, k,
+      reinterpret_cast<const cuComplex*>(alpha),
+      reinterpret_cast<const cuComplex*>(A), ALDim,
+      reinterpret_cast<const cuComplex*>(B), BLDim,
+      reinterpret_cast<const cuComplex*>(beta),
+      reinterpret_cast<cuComplex*>(C), CLDim );
+}
+
+cublasStatus_t DeviceGemm
+( cublasOperation_t opA, cublasOperation_t opB,
+  int m, int n, int k,
+  const dcomplex* alpha, const dcomplex* A, int ALDim,
+                         const dcomplex* B, int BLDim,
+  const dcomplex* beta,        dcomplex* C, int CLDim )
+{
+    return cublasZgemm
+    ( ::handle, opA, opB, m, n, k,
+      reinterpret_cast<const cuDoubleComplex*>(alpha),
+      reinterpret_cast<const cuDoubleComplex*>(A), ALDim,
+      reinterpret_cast<const cuDoubleComplex*>(B), BLDim,
+      reinterpret_cast<const cuDoubleComplex*>(beta),
+      reinterpret_cast<cuDoubleComplex*>(C), CLDim );
+}
+
+template<typename T>
+void GemmHelper
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    DEBUG_CSE
+    if( m == 0 || n == 0 )
+        return;
+    EnsureInitialized();
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    const BlasInt AHeight = ( normalA ? m : k );
+    const BlasInt AWidth = ( normalA ? k : m );
+    const BlasInt BHeight = ( normalB ? k : n );
+    const BlasInt BWidth = ( normalB ? n : k );
+
+    // The device copies of the operands are packed contiguously
+    const size_t ASize = size_t(AHeight)*AWidth;
+    const size_t BSize = size_t(BHeight)*BWidth;
+    const size_t CSize = size_t(m)*n;
+    T* ADev = static_cast<T*>( Workspace( (ASize+BSize+CSize)*sizeof(T) ) );
+    T* BDev = ADev + ASize;
+    T* CDev = BDev + BSize;
+    const BlasInt ADevLDim = Max(AHeight,1);
+    const BlasInt BDevLDim = Max(BHeight,1);
+    const BlasInt CDevLDim = m;
+
+    // All transfers and the product are queued on a single stream so that
+    // the host only waits once, after C has been copied back
+    if( k > 0 )
+    {
+        CheckCuBLAS
+        ( cublasSetMatrixAsync
+          ( AHeight, AWidth, sizeof(T), A, ALDim, ADev, ADevLDim,
+            ::stream ) );
+        CheckCuBLAS
+        ( cublasSetMatrixAsync
+          ( BHeight, BWidth, sizeof(T), B, BLDim, BDev, BDevLDim,
+            ::stream ) );
+    }
+    if( beta != T(0) )
+        CheckCuBLAS
+        ( cublasSetMatrixAsync
+          ( m, n, sizeof(T), C, CLDim, CDev, CDevLDim, ::stream ) );
+    CheckCuBLAS
+    ( DeviceGemm
+      ( CharToOperation(transA), CharToOperation(transB), m, n, k,
+        &alpha, ADev, ADevLDim, BDev, BDevLDim, &beta, CDev, CDevLDim ) );
+    CheckCuBLAS
+    ( cublasGetMatrixAsync
+      ( m, n, sizeof(T), CDev, CDevLDim, C, CLDim, ::stream ) );
+    CheckCuda( cudaStreamSynchronize( ::stream ) );
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void FinalizeCuBLAS()
+{
+    if( !::initializedCuBLAS )
+        return;
+    if( ::workspace != nullptr )
+        cudaFree( ::workspace );
+    ::workspace = nullptr;
+    ::workspaceSize = 0;
+    cublasDestroy( ::handle );
+    cudaStreamDestroy( ::stream );
+    ::initializedCuBLAS = false;
+}
+
+namespace cublas {
+
+bool ShouldOffload( BlasInt m, BlasInt n, BlasInt k )
+{ return double(m)*double(n)*double(k) >= ::offloadThreshold; }
+
+void SetOffloadThreshold( double numMultiplyAdds )
+{ ::offloadThreshold = numMultiplyAdds; }
+
+double OffloadThreshold()
+{ return ::offloadThreshold; }
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* A, BlasInt ALDim,
+  const float* B, BlasInt BLDim,
+  const float& beta,
+        float* C, BlasInt CLDim )
+{
+    GemmHelper
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* A, BlasInt ALDim,
+  const double* B, BlasInt BLDim,
+  const double& beta,
+        double* C, BlasInt CLDim )
+{
+    GemmHelper
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim,
+  const scomplex* B, BlasInt BLDim,
+  const scomplex& beta,
+        scomplex* C, BlasInt CLDim )
+{
+    GemmHelper
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim,
+  const dcomplex* B, BlasInt BLDim,
+  const dcomplex& beta,
+        dcomplex* C, BlasInt CLDim )
+{
+    GemmHelper
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+
+} // namespace cublas
+} // namespace El
+
+#endif // ifdef EL_HAVE_CUBLAS
@@ -304,6 +304,40 @@ void EL_LAPACK(zlahqr)
 namespace El {
 namespace lapack {
 
+// Models of the work of the dense eigensolvers and SVDs (for profiling),
+// which follow the standard leading-order operation counts and assume that
+// the input and any computed vectors are each read and written once
+namespace work {
+
+template<typename T>
+KernelWork Model( double realFlops, double numEntries )
+{
+    KernelWork work;
+    work.flops = ( IsComplex<T>::value ? 4 : 1 )*realFlops;
+    work.bytes = 2*sizeof(T)*numEntries;
+    return work;
+}
+
+template<typename T>
+KernelWork HermitianEig( BlasInt n, bool vectors )
+{
+    const double nCubed = double(n)*n*n;
+    return Model<T>
+    ( 4*nCubed/3 + ( vectors ? 2*nCubed : 0 ),
+      ( vectors ? 2. : 1. )*n*n );
+}
+
+template<typename T>
+KernelWork SVD( BlasInt m, BlasInt n, bool vectors )
+{
+    const double k = Min(m,n), l = Max(m,n);
+    return Model<T>
+    ( 4*l*k*k - 4*k*k*k/3 + ( vectors ? 4*l*k*k + 8*k*k*k : 0 ),
+      double(m)*n + ( vectors ? l*k + k*k : 0 ) );
+}
+
+} // namespace work
+
 // Copy a matrix
 // =============
 template<typename T>
@@ -917,6 +951,8 @@ BlasInt HermitianEigWrapper
     iWorkSize = iWorkDummy;
     vector<float> work(workSize);
     vector<BlasInt> iWork(iWorkSize);
+    ProfileRegion region
+    ( "lapack::HermitianEig", work::HermitianEig<float>( n, job=='V' ) );
     EL_LAPACK(ssyevr)
     ( &job, &range, &uplo, &n, A, &ldA, &vl, &vu, &il, &iu, &absTol, &m,
       w, Z, &ldZ, isuppZ.data(), work.data(), &workSize, 
@@ -951,6 +987,8 @@ BlasInt HermitianEigWrapper
     iWorkSize = iWorkDummy;
     vector<double> work(workSize);
     vector<BlasInt> iWork(iWorkSize);
+    ProfileRegion region
+    ( "lapack::HermitianEig", work::HermitianEig<double>( n, job=='V' ) );
     EL_LAPACK(dsyevr)
     ( &job, &range, &uplo, &n, A, &ldA, &vl, &vu, &il, &iu, &absTol, &m,
       w, Z, &ldZ, isuppZ.data(), work.data(), &workSize, 
@@ -988,6 +1026,8 @@ BlasInt HermitianEigWrapper
     vector<scomplex> work(workSize);
     vector<float> rWork(rWorkSize);
     vector<BlasInt> iWork(iWorkSize);
+    ProfileRegion region
+    ( "lapack::HermitianEig", work::HermitianEig<scomplex>( n, job=='V' ) );
     EL_LAPACK(cheevr)
     ( &job, &range, &uplo, &n, A, &ldA, &vl, &vu, &il, &iu, &absTol, &m,
       w, Z, &ldZ, isuppZ.data(), work.data(), &workSize, 
@@ -1025,6 +1065,8 @@ BlasInt HermitianEigWrapper
     vector<dcomplex> work(workSize);
     vector<double> rWork(rWorkSize);
     vector<BlasInt> iWork(iWorkSize);
+    ProfileRegion region
+    ( "lapack::HermitianEig", work::HermitianEig<dcomplex>( n, job=='V' ) );
     EL_LAPACK(zheevr)
     ( &job, &range, &uplo, &n, A, &ldA, &vl, &vu, &il, &iu, &absTol, &m,
       w, Z, &ldZ, isuppZ.data(), work.data(), &workSize, 
@@ -1452,6 +1494,8 @@ void DivideAndConquerSVD
 
     workSize = workDummy;
     vector<float> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<float>( m, n, true ) );
     EL_LAPACK(sgesdd)
     ( &jobz, &m, &n,
       A, &ldA,
@@ -1497,6 +1541,8 @@ void DivideAndConquerSVD
 
     workSize = workDummy;
     vector<double> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<double>( m, n, true ) );
     EL_LAPACK(dgesdd)
     ( &jobz, &m, &n,
       A, &ldA,
@@ -1546,6 +1592,8 @@ void DivideAndConquerSVD
 
     workSize = workDummy.real();
     vector<scomplex> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<scomplex>( m, n, true ) );
     EL_LAPACK(cgesdd)
     ( &jobz, &m, &n,
       A, &ldA,
@@ -1596,6 +1644,8 @@ void DivideAndConquerSVD
 
     workSize = workDummy.real();
     vector<dcomplex> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<dcomplex>( m, n, true ) );
     EL_LAPACK(zgesdd)
     ( &jobz, &m, &n,
       A, &ldA,
@@ -1643,6 +1693,8 @@ void QRSVD
 
     workSize = workDummy;
     vector<float> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<float>( m, n, !avoidU || !avoidV ) );
     EL_LAPACK(sgesvd)
     ( &jobU, &jobVT, &m, &n,
       A, &ldA,
@@ -1685,6 +1737,8 @@ void QRSVD
 
     workSize = workDummy;
     vector<double> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<double>( m, n, !avoidU || !avoidV ) );
     EL_LAPACK(dgesvd)
     ( &jobU, &jobVT, &m, &n,
       A, &ldA,
@@ -1730,6 +1784,8 @@ void QRSVD
 
     workSize = workDummy.real();
     vector<scomplex> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<scomplex>( m, n, !avoidU || !avoidV ) );
     EL_LAPACK(cgesvd)
     ( &jobU, &jobVH, &m, &n,
       A, &ldA,
@@ -1776,6 +1832,8 @@ void QRSVD
 
     workSize = workDummy.real();
     vector<dcomplex> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<dcomplex>( m, n, !avoidU || !avoidV ) );
     EL_LAPACK(zgesvd)
     ( &jobU, &jobVH, &m, &n,
       A, &ldA,
@@ -1810,6 +1868,8 @@ void SVD( BlasInt m, BlasInt n, float* A, BlasInt ldA, float* s )
 
     workSize = workDummy;
     vector<float> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<float>( m, n, false ) );
     EL_LAPACK(sgesvd)
     ( &jobU, &jobVT, &m, &n, A, &ldA, s, 0, &fakeLDim, 0, &fakeLDim, 
       work.data(), &workSize, &info );
@@ -1835,6 +1895,8 @@ void SVD( BlasInt m, BlasInt n, double* A, BlasInt ldA, double* s )
 
     workSize = workDummy;
     vector<double> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<double>( m, n, false ) );
     EL_LAPACK(dgesvd)
     ( &jobU, &jobVT, &m, &n, A, &ldA, s, 0, &fakeLDim, 0, &fakeLDim, 
       work.data(), &workSize, &info );
@@ -1862,6 +1924,8 @@ void SVD( BlasInt m, BlasInt n, scomplex* A, BlasInt ldA, float* s )
 
     workSize = workDummy.real();
     vector<scomplex> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<scomplex>( m, n, false ) );
     EL_LAPACK(cgesvd)
     ( &jobU, &jobVH, &m, &n, A, &ldA, s, 0, &fakeLDim, 0, &fakeLDim, 
       work.data(), &workSize, rWork.data(), &info );
@@ -1889,6 +1953,8 @@ void SVD( BlasInt m, BlasInt n, dcomplex* A, BlasInt ldA, double* s )
 
     workSize = workDummy.real();
     vector<dcomplex> work(workSize);
+    ProfileRegion region
+    ( "lapack::SVD", work::SVD<dcomplex>( m, n, false ) );
     EL_LAPACK(zgesvd)
     ( &jobU, &jobVH, &m, &n, A, &ldA, s, 0, &fakeLDim, 0, &fakeLDim, 
       work.data(), &workSize, rWork.data(), &info );
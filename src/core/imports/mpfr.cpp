@@ -47,6 +47,9 @@ void SetPrecision( mpfr_prec_t prec )
     previouslySet = true;
 }
 
+void SetThreadPrecision( mpfr_prec_t prec )
+{ mpfr_set_default_prec( prec ); }
+
 void SetMinIntBits( int numBits )
 { 
     static bool previouslySet = false;
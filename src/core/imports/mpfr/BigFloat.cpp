@@ -9,8 +9,104 @@
 #include <El-lite.hpp>
 #ifdef EL_HAVE_MPC
 
+namespace {
+
+// Each temporary BigFloat would otherwise pay for an mpfr_init2/mpfr_clear
+// pair (i.e., a malloc/free of its limbs). Since an initialized mpfr_t owns
+// its limbs through a plain pointer, destroyed values are instead kept on a
+// free list for their precision and handed to the next BigFloat of the same
+// precision.
+const size_t maxPooledPerPrecision = 4096;
+
+struct BigFloatPool
+{
+    // The (rarely more than one or two) precisions with cached values
+    std::vector<mpfr_prec_t> precisions;
+    std::vector<std::vector<__mpfr_struct>> freeLists;
+
+    std::vector<__mpfr_struct>* FreeList( mpfr_prec_t prec, bool create )
+    {
+        const size_t numPrecisions = precisions.size();
+        for( size_t k=0; k<numPrecisions; ++k )
+            if( precisions[k] == prec )
+                return &freeLists[k];
+        if( !create )
+            return nullptr;
+        precisions.push_back( prec );
+        freeLists.emplace_back();
+        return &freeLists.back();
+    }
+
+    bool Acquire( mpfr_ptr x, mpfr_prec_t prec )
+    {
+        auto freeList = FreeList( prec, false );
+        if( freeList == nullptr || freeList->empty() )
+            return false;
+        *x = freeList->back();
+        freeList->pop_back();
+        return true;
+    }
+
+    bool Retire( mpfr_ptr x )
+    {
+        auto freeList = FreeList( mpfr_get_prec(x), true );
+        if( freeList->size() >= maxPooledPerPrecision )
+            return false;
+        freeList->push_back( *x );
+        return true;
+    }
+
+    void Release()
+    {
+        for( auto& freeList : freeLists )
+            for( auto& entry : freeList )
+                mpfr_clear( &entry );
+        El::SwapClear( precisions );
+        El::SwapClear( freeLists );
+    }
+
+    ~BigFloatPool();
+};
+
+// BigFloat's with static storage duration can outlive the pool, in which
+// case their limbs are simply freed
+#ifdef EL_HYBRID
+thread_local bool poolAlive = false;
+#else
+bool poolAlive = false;
+#endif
+
+BigFloatPool::~BigFloatPool()
+{
+    Release();
+    poolAlive = false;
+}
+
+BigFloatPool& Pool()
+{
+#ifdef EL_HYBRID
+    static thread_local BigFloatPool pool;
+#else
+    static BigFloatPool pool;
+#endif
+    poolAlive = true;
+    return pool;
+}
+
+} // anonymous namespace
+
 namespace El {
 
+namespace mpfr {
+
+void ReleaseBigFloatPool()
+{
+    if( ::poolAlive )
+        ::Pool().Release();
+}
+
+} // namespace mpfr
+
 void BigFloat::SetNumLimbs( mpfr_prec_t prec )
 {
     numLimbs_ = (prec-1) / GMP_NUMB_BITS + 1;
@@ -18,7 +114,11 @@ void BigFloat::SetNumLimbs( mpfr_prec_t prec )
 
 void BigFloat::Init( mpfr_prec_t prec )
 {
-    mpfr_init2( mpfrFloat_, prec );
+    // A recycled value is reset to the NaN of a freshly initialized value
+    if( ::Pool().Acquire( mpfrFloat_, prec ) )
+        mpfr_set_nan( mpfrFloat_ );
+    else
+        mpfr_init2( mpfrFloat_, prec );
     SetNumLimbs( prec );
 }
 
@@ -231,7 +331,9 @@ BigFloat::BigFloat( BigFloat&& a )
 BigFloat::~BigFloat()
 {
     DEBUG_CSE
-    if( Pointer()->_mpfr_d != 0 )
+    if( Pointer()->_mpfr_d == 0 )
+        return;
+    if( !::poolAlive || !::Pool().Retire( Pointer() ) )
         mpfr_clear( Pointer() );
 }
 
@@ -1118,6 +1220,28 @@ const byte* BigFloat::Deserialize( const byte* buf )
 byte* BigFloat::Deserialize( byte* buf )
 { return const_cast<byte*>(Deserialize(static_cast<const byte*>(buf))); }
 
+void MultiplyAdd( const BigFloat& a, const BigFloat& b, BigFloat& c )
+{
+    mpfr_fma
+    ( c.Pointer(), a.LockedPointer(), b.LockedPointer(), c.LockedPointer(),
+      mpfr::RoundingMode() );
+}
+
+void MultiplySubtract( const BigFloat& a, const BigFloat& b, BigFloat& c )
+{
+    // c - a b = -(a b - c), where the negation is exact but reverses the
+    // direction of a directed rounding
+    mpfr_rnd_t round = mpfr::RoundingMode();
+    if( round == MPFR_RNDU )
+        round = MPFR_RNDD;
+    else if( round == MPFR_RNDD )
+        round = MPFR_RNDU;
+    mpfr_fms
+    ( c.Pointer(), a.LockedPointer(), b.LockedPointer(), c.LockedPointer(),
+      round );
+    mpfr_neg( c.Pointer(), c.LockedPointer(), mpfr::RoundingMode() );
+}
+
 BigFloat operator+( const BigFloat& a, const BigFloat& b )
 { return BigFloat(a) += b; }
 BigFloat operator-( const BigFloat& a, const BigFloat& b )
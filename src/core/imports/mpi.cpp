@@ -10,6 +10,12 @@
 */
 #include <El-lite.hpp>
 
+#include <atomic>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <tuple>
+
 // TODO: Introduce macros to shorten the explicit instantiation code
 
 typedef unsigned char* UCP;
@@ -47,6 +53,120 @@ MPI_Op NativeOp( const El::mpi::Op& op )
     return opC;
 }
 
+// The optional profile of the traffic through the wrappers below, keyed by
+// the call site, the operation, and the communicator
+struct TrafficStats
+{
+    size_t numCalls=0, bytes=0;
+    double seconds=0;
+};
+struct TrafficComm
+{
+    int id, size;
+    std::string name;
+};
+std::atomic<bool> profileTraffic(false);
+std::mutex trafficMutex;
+std::map<std::tuple<std::string,std::string,MPI_Comm>,TrafficStats>
+  trafficStats;
+// NOTE: A freed communicator's handle may be reused for a later one, in which
+//       case their traffic is merged
+std::map<MPI_Comm,TrafficComm> trafficComms;
+std::string trafficReportBasename;
+// Only the outermost of nested wrappers (e.g., a non-blocking call which
+// falls back to the blocking one) is recorded
+thread_local int trafficDepth = 0;
+
+class TrafficRecorder
+{
+public:
+    TrafficRecorder( const char* op, MPI_Comm comm, size_t bytes )
+    : op_(op), comm_(comm), bytes_(bytes),
+      active_(profileTraffic && trafficDepth == 0)
+    {
+        ++trafficDepth;
+        if( active_ )
+            startTime_ = MPI_Wtime();
+    }
+
+    ~TrafficRecorder()
+    {
+        --trafficDepth;
+        if( !active_ )
+            return;
+        const double seconds = MPI_Wtime() - startTime_;
+        std::string site;
+        DEBUG_ONLY(site = El::CallSite())
+        if( site.empty() )
+            site = "(unknown)";
+
+        std::lock_guard<std::mutex> guard( trafficMutex );
+        if( trafficComms.find(comm_) == trafficComms.end() )
+        {
+            TrafficComm info;
+            info.id = trafficComms.size();
+            MPI_Comm_size( comm_, &info.size );
+            char name[MPI_MAX_OBJECT_NAME];
+            int nameLength;
+            MPI_Comm_get_name( comm_, name, &nameLength );
+            info.name = std::string( name, nameLength );
+            trafficComms[comm_] = info;
+        }
+        TrafficStats& stats =
+          trafficStats[std::make_tuple(site,std::string(op_),comm_)];
+        ++stats.numCalls;
+        stats.bytes += bytes_;
+        stats.seconds += seconds;
+    }
+
+private:
+    const char* op_;
+    MPI_Comm comm_;
+    size_t bytes_;
+    bool active_;
+    double startTime_;
+};
+
+// The byte count is only evaluated when the traffic is being profiled
+#define EL_PROFILE_TRAFFIC(op,wrappedComm,bytes) \
+  TrafficRecorder trafficRecorder \
+  ( op, (wrappedComm).comm, ( ::profileTraffic ? size_t(bytes) : size_t(0) ) )
+
+size_t TotalCount( const int* counts, int numCounts )
+{
+    size_t total = 0;
+    for( int q=0; q<numCounts; ++q )
+        total += counts[q];
+    return total;
+}
+
+// The number of out neighbors of a distributed graph communicator
+int NumDests( const El::mpi::Comm& graphComm )
+{
+    int numDests = 0;
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    int numSources, weighted;
+    MPI_Dist_graph_neighbors_count
+    ( graphComm.comm, &numSources, &numDests, &weighted );
+#endif
+    return numDests;
+}
+
+void WriteJSONString( std::ostream& os, const std::string& str )
+{
+    os << '"';
+    for( const char c : str )
+    {
+        if( c == '"' || c == '\\' )
+            os << '\\' << c;
+        else if( c == '\n' )
+            os << "\\n";
+        else
+            os << c;
+    }
+    os << '"';
+}
+
 } // anonymous namespace
 
 namespace El {
@@ -109,6 +229,74 @@ void Abort( Comm comm, int errCode ) EL_NO_EXCEPT
 
 double Time() EL_NO_EXCEPT { return MPI_Wtime(); }
 
+void EnableTrafficProfiling() { ::profileTraffic = true; }
+void DisableTrafficProfiling() { ::profileTraffic = false; }
+bool TrafficProfiling() { return ::profileTraffic; }
+
+void ResetTrafficProfile()
+{
+    std::lock_guard<std::mutex> guard( ::trafficMutex );
+    ::trafficStats.clear();
+    ::trafficComms.clear();
+}
+
+void PrintTrafficProfile( std::ostream& os )
+{
+    DEBUG_CSE
+    std::lock_guard<std::mutex> guard( ::trafficMutex );
+    std::ostringstream msg;
+    msg << "{\n  \"rank\": " << Rank() << ",\n  \"communicators\": [";
+    bool first = true;
+    for( const auto& entry : ::trafficComms )
+    {
+        msg << ( first ? "\n" : ",\n" ) << "    { \"id\": " << entry.second.id
+            << ", \"size\": " << entry.second.size << ", \"name\": ";
+        ::WriteJSONString( msg, entry.second.name );
+        msg << " }";
+        first = false;
+    }
+    msg << "\n  ],\n  \"records\": [";
+    first = true;
+    for( const auto& entry : ::trafficStats )
+    {
+        const auto& stats = entry.second;
+        msg << ( first ? "\n" : ",\n" ) << "    { \"site\": ";
+        ::WriteJSONString( msg, std::get<0>(entry.first) );
+        msg << ", \"op\": \"" << std::get<1>(entry.first) << "\", \"comm\": "
+            << ::trafficComms[std::get<2>(entry.first)].id
+            << ", \"calls\": " << stats.numCalls
+            << ", \"bytes\": " << stats.bytes
+            << ", \"seconds\": " << std::setprecision(9) << stats.seconds
+            << " }";
+        first = false;
+    }
+    msg << "\n  ]\n}\n";
+    os << msg.str();
+    os.flush();
+}
+
+void EnableTrafficReport( const std::string& basename )
+{
+    ::trafficReportBasename = basename;
+    EnableTrafficProfiling();
+}
+
+void DisableTrafficReport() { ::trafficReportBasename.clear(); }
+
+void WriteTrafficReport()
+{
+    DEBUG_CSE
+    if( ::trafficReportBasename.empty() )
+        return;
+    std::ostringstream fileOS;
+    fileOS << ::trafficReportBasename << "-Proc" << std::setfill('0')
+           << std::setw(3) << Rank() << ".json";
+    std::ofstream file( fileOS.str().c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",fileOS.str());
+    PrintTrafficProfile( file );
+}
+
 void Create( UserFunction* func, bool commutes, Op& op ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
@@ -174,6 +362,279 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &nodeComm.comm ) );
+#else
+    SafeMpi( MPI_Comm_split( comm.comm, Rank(comm), key, &nodeComm.comm ) );
+#endif
+}
+
+SharedWindow::SharedWindow() EL_NO_EXCEPT
+: base_(nullptr), portionBytes_(0), allocated_(false)
+{ }
+
+bool SharedWindow::Reserve( Comm comm, size_t portionBytes )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_MPI_SHARED_WINDOWS
+    if( allocated_ && portionBytes <= portionBytes_ )
+        return Active();
+    Free();
+
+    // Keep each portion cache-line aligned (which also aligns any scalar)
+    const size_t lineBytes = 64;
+    portionBytes = Max(portionBytes,size_t(1));
+    portionBytes = lineBytes*((portionBytes+lineBytes-1)/lineBytes);
+
+    void* localBase;
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( MPI_Aint(portionBytes), 1, MPI_INFO_NULL, comm.comm,
+        &localBase, &win_ ) );
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, win_ ) );
+    allocated_ = true;
+    portionBytes_ = portionBytes;
+
+    // Portions should be contiguous by default, but check before relying on it
+    MPI_Aint size;
+    int dispUnit;
+    void* rootBase;
+    SafeMpi( MPI_Win_shared_query( win_, 0, &size, &dispUnit, &rootBase ) );
+    bool contiguous = true;
+    const int commSize = Size( comm );
+    for( int q=1; q<commSize; ++q )
+    {
+        void* qBase;
+        SafeMpi( MPI_Win_shared_query( win_, q, &size, &dispUnit, &qBase ) );
+        if( static_cast<byte*>(qBase) !=
+            static_cast<byte*>(rootBase)+q*portionBytes )
+            contiguous = false;
+    }
+    base_ = ( contiguous ? static_cast<byte*>(rootBase) : nullptr );
+    return Active();
+#else
+    return false;
+#endif
+}
+
+void SharedWindow::Sync( Comm comm ) const EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_MPI_SHARED_WINDOWS
+    SafeMpi( MPI_Win_sync( win_ ) );
+    Barrier( comm );
+    SafeMpi( MPI_Win_sync( win_ ) );
+#endif
+}
+
+void SharedWindow::Free() EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_MPI_SHARED_WINDOWS
+    if( allocated_ )
+    {
+        SafeMpi( MPI_Win_unlock_all( win_ ) );
+        SafeMpi( MPI_Win_free( &win_ ) );
+    }
+#endif
+    allocated_ = false;
+    base_ = nullptr;
+    portionBytes_ = 0;
+}
+
+File::File() EL_NO_EXCEPT
+: open_(false)
+{ }
+
+File::~File()
+{
+    if( open_ && !Finalized() )
+        MPI_File_close( &file_ );
+}
+
+void File::Open( Comm comm, const std::string& filename, bool write )
+{
+    DEBUG_CSE
+    Close();
+    const int mode =
+      ( write ? MPI_MODE_CREATE | MPI_MODE_WRONLY : MPI_MODE_RDONLY );
+    // File errors are returned rather than fatal by default
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), mode,
+        MPI_INFO_NULL, &file_ );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    open_ = true;
+}
+
+void File::Close() EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    if( open_ )
+        SafeMpi( MPI_File_close( &file_ ) );
+    open_ = false;
+}
+
+long long File::Size() const EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    MPI_Offset numBytes;
+    SafeMpi( MPI_File_get_size( file_, &numBytes ) );
+    return numBytes;
+}
+
+void File::SetSize( long long numBytes ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    SafeMpi( MPI_File_set_size( file_, MPI_Offset(numBytes) ) );
+}
+
+void File::ReadAt
+( long long offset, byte* buf, int numBytes ) const EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    MPI_Status status;
+    SafeMpi
+    ( MPI_File_read_at
+      ( file_, MPI_Offset(offset), buf, numBytes, MPI_BYTE, &status ) );
+}
+
+void File::WriteAt
+( long long offset, const byte* buf, int numBytes ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    MPI_Status status;
+    SafeMpi
+    ( MPI_File_write_at
+      ( file_, MPI_Offset(offset), const_cast<byte*>(buf), numBytes,
+        MPI_BYTE, &status ) );
+}
+
+void File::SetView
+( long long offset, int entrySize, Int height,
+  const vector<Int>& rows, const vector<Int>& cols, Int ldim,
+  Datatype& entryType, Datatype& memType ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    const int numRows = rows.size();
+    const int numCols = cols.size();
+    SafeMpi( MPI_Type_contiguous( entrySize, MPI_BYTE, &entryType ) );
+    SafeMpi( MPI_Type_commit( &entryType ) );
+    if( numRows == 0 || numCols == 0 )
+    {
+        memType = MPI_DATATYPE_NULL;
+        SafeMpi
+        ( MPI_File_set_view
+          ( file_, MPI_Offset(offset), entryType, entryType,
+            const_cast<char*>("native"), MPI_INFO_NULL ) );
+        return;
+    }
+
+    // Each column of the view is an indexed type over the runs of
+    // consecutive rows (a single entry for element-wise distributions and
+    // whole blocks for block distributions). The offsets are in bytes so
+    // that global row indices beyond the range of an int are not truncated.
+    vector<int> runLengths;
+    vector<MPI_Aint> runOffsets;
+    for( int k=0; k<numRows; ++k )
+    {
+        if( k > 0 && rows[k] == rows[k-1]+1 )
+            ++runLengths.back();
+        else
+        {
+            runLengths.push_back( 1 );
+            runOffsets.push_back( MPI_Aint(rows[k])*entrySize );
+        }
+    }
+    Datatype colType, fileType;
+    SafeMpi
+    ( MPI_Type_create_hindexed
+      ( runLengths.size(), runLengths.data(), runOffsets.data(), entryType,
+        &colType ) );
+    vector<int> colLengths( numCols, 1 );
+    vector<MPI_Aint> colOffsets( numCols );
+    for( int k=0; k<numCols; ++k )
+        colOffsets[k] = MPI_Aint(cols[k])*height*entrySize;
+    SafeMpi
+    ( MPI_Type_create_hindexed
+      ( numCols, colLengths.data(), colOffsets.data(), colType, &fileType ) );
+    SafeMpi( MPI_Type_commit( &fileType ) );
+    SafeMpi
+    ( MPI_File_set_view
+      ( file_, MPI_Offset(offset), entryType, fileType,
+        const_cast<char*>("native"), MPI_INFO_NULL ) );
+    Free( colType );
+    Free( fileType );
+
+    SafeMpi
+    ( MPI_Type_create_hvector
+      ( numCols, numRows, MPI_Aint(ldim)*entrySize, entryType, &memType ) );
+    SafeMpi( MPI_Type_commit( &memType ) );
+}
+
+void File::ResetView() EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    SafeMpi
+    ( MPI_File_set_view
+      ( file_, 0, MPI_BYTE, MPI_BYTE, const_cast<char*>("native"),
+        MPI_INFO_NULL ) );
+}
+
+void File::ReadAll
+( long long offset, int entrySize, Int height,
+  const vector<Int>& rows, const vector<Int>& cols,
+  byte* buf, Int ldim ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    Datatype entryType, memType;
+    SetView( offset, entrySize, height, rows, cols, ldim, entryType, memType );
+    MPI_Status status;
+    if( memType == MPI_DATATYPE_NULL )
+    {
+        SafeMpi( MPI_File_read_all( file_, buf, 0, entryType, &status ) );
+    }
+    else
+    {
+        SafeMpi( MPI_File_read_all( file_, buf, 1, memType, &status ) );
+        Free( memType );
+    }
+    Free( entryType );
+    ResetView();
+}
+
+void File::WriteAll
+( long long offset, int entrySize, Int height,
+  const vector<Int>& rows, const vector<Int>& cols,
+  const byte* buf, Int ldim ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    Datatype entryType, memType;
+    SetView( offset, entrySize, height, rows, cols, ldim, entryType, memType );
+    MPI_Status status;
+    byte* sendBuf = const_cast<byte*>(buf);
+    if( memType == MPI_DATATYPE_NULL )
+    {
+        SafeMpi
+        ( MPI_File_write_all( file_, sendBuf, 0, entryType, &status ) );
+    }
+    else
+    {
+        SafeMpi
+        ( MPI_File_write_all( file_, sendBuf, 1, memType, &status ) );
+        Free( memType );
+    }
+    Free( entryType );
+    ResetView();
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
@@ -223,6 +684,61 @@ EL_NO_RELEASE_EXCEPT
     );
 }
 
+void DistGraphCreate
+( Comm comm, int numSources, const int* sources, const int* degrees,
+  const int* dests, Comm& graphComm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    SafeMpi
+    ( MPI_Dist_graph_create
+      ( comm.comm, numSources, sources, degrees, dests, MPI_UNWEIGHTED,
+        MPI_INFO_NULL, 0, &graphComm.comm ) );
+#else
+    LogicError("Distributed graph communicators require MPI-3");
+#endif
+}
+
+void DistGraphCreateAdjacent
+( Comm comm, int numSources, const int* sources,
+             int numDests,   const int* dests, Comm& graphComm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    SafeMpi
+    ( MPI_Dist_graph_create_adjacent
+      ( comm.comm,
+        numSources, sources, MPI_UNWEIGHTED,
+        numDests,   dests,   MPI_UNWEIGHTED,
+        MPI_INFO_NULL, 0, &graphComm.comm ) );
+#else
+    LogicError("Distributed graph communicators require MPI-3");
+#endif
+}
+
+void DistGraphNeighbors
+( Comm graphComm, vector<int>& sources, vector<int>& dests )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    int numSources, numDests, weighted;
+    SafeMpi
+    ( MPI_Dist_graph_neighbors_count
+      ( graphComm.comm, &numSources, &numDests, &weighted ) );
+    sources.resize( numSources );
+    dests.resize( numDests );
+    SafeMpi
+    ( MPI_Dist_graph_neighbors
+      ( graphComm.comm,
+        numSources, sources.data(), MPI_UNWEIGHTED,
+        numDests,   dests.data(),   MPI_UNWEIGHTED ) );
+#else
+    LogicError("Distributed graph communicators require MPI-3");
+#endif
+}
+
 // Group manipulation 
 // ==================
 
@@ -543,6 +1059,7 @@ void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Send", comm, count*sizeof(*buf) );
     SafeMpi
     ( MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
@@ -554,6 +1071,7 @@ void TaggedSend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Send", comm, count*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -571,6 +1089,7 @@ template<typename T,typename,typename>
 void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Send", comm, count*sizeof(*buf) );
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
@@ -596,6 +1115,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ISend", comm, count*sizeof(*buf) );
     SafeMpi
     ( MPI_Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
@@ -608,6 +1128,7 @@ void TaggedISend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ISend", comm, count*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Isend
@@ -627,6 +1148,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ISend", comm, count*sizeof(*buf) );
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Isend
@@ -718,6 +1240,7 @@ void TaggedISSend
   Request<Real>& request ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ISSend", comm, count*sizeof(*buf) );
     SafeMpi
     ( MPI_Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
@@ -730,6 +1253,7 @@ void TaggedISSend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ISSend", comm, count*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Issend
@@ -749,6 +1273,7 @@ void TaggedISSend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ISSend", comm, count*sizeof(*buf) );
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Issend
@@ -771,6 +1296,7 @@ void TaggedRecv( Real* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Recv", comm, count*sizeof(*buf) );
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
@@ -781,6 +1307,7 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Recv", comm, count*sizeof(*buf) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -796,6 +1323,7 @@ template<typename T,typename,typename>
 void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Recv", comm, count*sizeof(*buf) );
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Status status;
@@ -827,6 +1355,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IRecv", comm, count*sizeof(*buf) );
     SafeMpi
     ( MPI_Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
@@ -839,6 +1368,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IRecv", comm, count*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irecv
@@ -858,6 +1388,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IRecv", comm, count*sizeof(*buf) );
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
@@ -890,6 +1421,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "SendRecv", comm, sc*sizeof(*sbuf) );
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -905,6 +1437,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "SendRecv", comm, sc*sizeof(*sbuf) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -928,6 +1461,7 @@ void TaggedSendRecv
         T* rbuf, int rc, int from, int rtag, Comm comm )
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "SendRecv", comm, sc*sizeof(*sbuf) );
     Status status;
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
@@ -967,6 +1501,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "SendRecv", comm, count*sizeof(*buf) );
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -981,6 +1516,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "SendRecv", comm, count*sizeof(*buf) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1001,6 +1537,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "SendRecv", comm, count*sizeof(*buf) );
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
@@ -1022,6 +1559,7 @@ void Broadcast( Real* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Broadcast", comm, count*sizeof(*buf) );
     if( Size(comm) == 1 || count == 0 )
         return;
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
@@ -1032,6 +1570,7 @@ void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Broadcast", comm, count*sizeof(*buf) );
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -1046,6 +1585,7 @@ void Broadcast( T* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Broadcast", comm, count*sizeof(*buf) );
     if( Size(comm) == 1 || count == 0 )
         return;
     std::vector<byte> packedBuf;
@@ -1065,9 +1605,10 @@ void IBroadcast
 ( Real* buf, int count, int root, Comm comm, Request<Real>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IBroadcast", comm, count*sizeof(*buf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Ibcast
+    ( EL_NONBLOCKING_COLL(Ibcast)
       ( buf, count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1080,14 +1621,15 @@ void IBroadcast
   Request<Complex<Real>>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IBroadcast", comm, count*sizeof(*buf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Ibcast
+    ( EL_NONBLOCKING_COLL(Ibcast)
       ( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Ibcast
+    ( EL_NONBLOCKING_COLL(Ibcast)
       ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm,
         &request.backend ) );
 #endif
@@ -1101,18 +1643,10 @@ void IBroadcast
 ( T* buf, int count, int root, Comm comm, Request<T>& request )
 {
     DEBUG_CSE
-#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    request.receivingPacked = true;
-    request.recvCount = count;
-    request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
-    SafeMpi
-    ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
-        &request.backend ) );
-#else
-    LogicError("Elemental was not configured with non-blocking support");
-#endif
+    EL_PROFILE_TRAFFIC( "IBroadcast", comm, count*sizeof(*buf) );
+    // Non-packed datatypes are broadcast in a blocking manner
+    Broadcast( buf, count, root, comm );
+    request.backend = MPI_REQUEST_NULL;
 }
 
 template<typename T>
@@ -1126,6 +1660,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Gather", comm, sc*sizeof(*sbuf) );
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1139,6 +1674,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Gather", comm, sc*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1161,6 +1697,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Gather", comm, sc*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalRecv = rc*commSize;
@@ -1186,9 +1723,10 @@ void IGather
   Request<Real>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IGather", comm, sc*sizeof(*sbuf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm,
         &request.backend ) );
@@ -1205,16 +1743,17 @@ void IGather
   Request<Complex<Real>>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IGather", comm, sc*sizeof(*sbuf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), 
         root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm, &request.backend ) );
@@ -1232,23 +1771,10 @@ void IGather
   Request<T>& request )
 {
     DEBUG_CSE
-#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    if( mpi::Rank(comm) == root )
-    {
-        const int commSize = mpi::Size(comm);
-        request.receivingPacked = true;
-        request.recvCount = rc*commSize;
-        request.unpackedRecvBuf = rbuf;
-        ReserveSerialized( rc*commSize, rbuf, request.buffer );
-    }
-    SafeMpi
-    ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
-        &request.backend ) );
-#else
-    LogicError("Elemental was not configured with non-blocking support");
-#endif
+    EL_PROFILE_TRAFFIC( "IGather", comm, sc*sizeof(*sbuf) );
+    // Non-packed datatypes are gathered in a blocking manner
+    Gather( sbuf, sc, rbuf, rc, root, comm );
+    request.backend = MPI_REQUEST_NULL;
 }
 
 template<typename Real,typename>
@@ -1259,6 +1785,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Gather", comm, sc*sizeof(*sbuf) );
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf), 
@@ -1280,6 +1807,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Gather", comm, sc*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1322,6 +1850,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Gather", comm, sc*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     int totalRecv=0;
@@ -1348,34 +1877,254 @@ EL_NO_RELEASE_EXCEPT
         Deserialize( totalRecv, packedRecv, rbuf );
 }
 
-template<typename Real,typename>
-void AllGather
-( const Real* sbuf, int sc,
-        Real* rbuf, int rc, Comm comm )
-EL_NO_RELEASE_EXCEPT
+// Reduced-precision communication
+// ===============================
+namespace {
+
+CommPrecision commPrecision = FULL_COMM_PRECISION;
+
+template<typename Real>
+bool CompressedComm()
+{
+    return ( IsSame<Real,double>::value &&
+             commPrecision != FULL_COMM_PRECISION ) ||
+           ( IsSame<Real,float>::value &&
+             commPrecision == BFLOAT16_COMM_PRECISION );
+}
+
+size_t WireSize()
+{ return commPrecision == BFLOAT16_COMM_PRECISION ? 2 : sizeof(float); }
+
+MPI_Datatype WireType()
+{ return commPrecision == BFLOAT16_COMM_PRECISION ? MPI_UINT16_T : MPI_FLOAT; }
+
+// The conversions are only formed for float and double (CompressedComm is
+// false for every other packed type)
+template<typename Real>
+using IsCompressible =
+  std::integral_constant<bool,IsSame<Real,float>::value ||
+                              IsSame<Real,double>::value>;
+
+template<typename Real,typename=DisableIf<IsCompressible<Real>>>
+void Compress( const Real* buf, size_t n, byte* wire )
+{ LogicError("Invalid compressed datatype"); }
+
+template<typename Real,typename=DisableIf<IsCompressible<Real>>>
+void Decompress( const byte* wire, size_t n, Real* buf )
+{ LogicError("Invalid compressed datatype"); }
+
+template<typename Real,typename=EnableIf<IsCompressible<Real>>,typename=void>
+void Compress( const Real* buf, size_t n, byte* wire )
+{
+    if( commPrecision == BFLOAT16_COMM_PRECISION )
+    {
+        for( size_t k=0; k<n; ++k )
+        {
+            // Round the single-precision representation to nearest-even
+            const float value = float(buf[k]);
+            uint32_t bits;
+            std::memcpy( &bits, &value, sizeof(float) );
+            if( value != value )
+                bits |= 0x00400000u;
+            else
+                bits += 0x7FFFu + ((bits >> 16) & 1u);
+            const uint16_t truncated = uint16_t(bits >> 16);
+            std::memcpy( &wire[2*k], &truncated, 2 );
+        }
+    }
+    else
+    {
+        for( size_t k=0; k<n; ++k )
+        {
+            const float value = float(buf[k]);
+            std::memcpy( &wire[k*sizeof(float)], &value, sizeof(float) );
+        }
+    }
+}
+
+template<typename Real,typename=EnableIf<IsCompressible<Real>>,typename=void>
+void Decompress( const byte* wire, size_t n, Real* buf )
+{
+    if( commPrecision == BFLOAT16_COMM_PRECISION )
+    {
+        for( size_t k=0; k<n; ++k )
+        {
+            uint16_t truncated;
+            std::memcpy( &truncated, &wire[2*k], 2 );
+            const uint32_t bits = uint32_t(truncated) << 16;
+            float value;
+            std::memcpy( &value, &bits, sizeof(float) );
+            buf[k] = value;
+        }
+    }
+    else
+    {
+        for( size_t k=0; k<n; ++k )
+        {
+            float value;
+            std::memcpy( &value, &wire[k*sizeof(float)], sizeof(float) );
+            buf[k] = value;
+        }
+    }
+}
+
+// Only the received segments [rds[q],rds[q]+rcs[q]) of rbuf are written so
+// that the entries in any gaps between them are left untouched
+template<typename Real>
+void DecompressSegments
+( const byte* wire, const int* rcs, const int* rds, int commSize, Real* rbuf )
+{
+    for( int q=0; q<commSize; ++q )
+        Decompress( &wire[rds[q]*WireSize()], rcs[q], &rbuf[rds[q]] );
+}
+
+template<typename Real>
+void CompressedAllGather
+( const Real* sbuf, int sc, Real* rbuf, int rc, Comm comm )
 {
     DEBUG_CSE
-#ifdef EL_USE_BYTE_ALLGATHERS
-    SafeMpi
-    ( MPI_Allgather
-      ( (UCP)const_cast<Real*>(sbuf), sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
-        (UCP)rbuf,                    sizeof(Real)*rc, MPI_UNSIGNED_CHAR, 
-        comm.comm ) );
-#else
+    const size_t totalRecv = size_t(rc)*Size(comm);
+    vector<byte> sendWire( sc*WireSize() ), recvWire( totalRecv*WireSize() );
+    Compress( sbuf, sc, sendWire.data() );
     SafeMpi
     ( MPI_Allgather
-      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), 
-        rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
-#endif
+      ( sendWire.data(), sc, WireType(),
+        recvWire.data(), rc, WireType(), comm.comm ) );
+    Decompress( recvWire.data(), totalRecv, rbuf );
 }
 
-template<typename Real,typename>
-void AllGather
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc, Comm comm )
-EL_NO_RELEASE_EXCEPT
+// The counts and displacements are scaled by 'factor' (which is two for
+// complex data)
+template<typename Real>
+void CompressedAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, const int* rcs, const int* rds, int factor, Comm comm )
 {
     DEBUG_CSE
+    const int commSize = Size( comm );
+    vector<int> rcsScaled(commSize), rdsScaled(commSize);
+    size_t totalRecv = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        rcsScaled[q] = factor*rcs[q];
+        rdsScaled[q] = factor*rds[q];
+        totalRecv = Max( totalRecv, size_t(rdsScaled[q]+rcsScaled[q]) );
+    }
+    const int scScaled = factor*sc;
+    vector<byte> sendWire( scScaled*WireSize() ),
+                 recvWire( totalRecv*WireSize() );
+    Compress( sbuf, scScaled, sendWire.data() );
+    SafeMpi
+    ( MPI_Allgatherv
+      ( sendWire.data(), scScaled, WireType(),
+        recvWire.data(), rcsScaled.data(), rdsScaled.data(), WireType(),
+        comm.comm ) );
+    DecompressSegments
+    ( recvWire.data(), rcsScaled.data(), rdsScaled.data(), commSize, rbuf );
+}
+
+template<typename Real>
+void CompressedAllToAll
+( const Real* sbuf, int sc, Real* rbuf, int rc, Comm comm )
+{
+    DEBUG_CSE
+    const int commSize = Size( comm );
+    const size_t totalSend = size_t(sc)*commSize;
+    const size_t totalRecv = size_t(rc)*commSize;
+    vector<byte> sendWire( totalSend*WireSize() ),
+                 recvWire( totalRecv*WireSize() );
+    Compress( sbuf, totalSend, sendWire.data() );
+    SafeMpi
+    ( MPI_Alltoall
+      ( sendWire.data(), sc, WireType(),
+        recvWire.data(), rc, WireType(), comm.comm ) );
+    Decompress( recvWire.data(), totalRecv, rbuf );
+}
+
+template<typename Real>
+void CompressedAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, int factor, Comm comm )
+{
+    DEBUG_CSE
+    const int commSize = Size( comm );
+    vector<int> scsScaled(commSize), sdsScaled(commSize),
+                rcsScaled(commSize), rdsScaled(commSize);
+    size_t totalSend=0, totalRecv=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        scsScaled[q] = factor*scs[q];
+        sdsScaled[q] = factor*sds[q];
+        rcsScaled[q] = factor*rcs[q];
+        rdsScaled[q] = factor*rds[q];
+        totalSend = Max( totalSend, size_t(sdsScaled[q]+scsScaled[q]) );
+        totalRecv = Max( totalRecv, size_t(rdsScaled[q]+rcsScaled[q]) );
+    }
+    vector<byte> sendWire( totalSend*WireSize() ),
+                 recvWire( totalRecv*WireSize() );
+    for( int q=0; q<commSize; ++q )
+        Compress
+        ( &sbuf[sdsScaled[q]], scsScaled[q],
+          &sendWire[sdsScaled[q]*WireSize()] );
+    SafeMpi
+    ( MPI_Alltoallv
+      ( sendWire.data(), scsScaled.data(), sdsScaled.data(), WireType(),
+        recvWire.data(), rcsScaled.data(), rdsScaled.data(), WireType(),
+        comm.comm ) );
+    DecompressSegments
+    ( recvWire.data(), rcsScaled.data(), rdsScaled.data(), commSize, rbuf );
+}
+
+} // anonymous namespace
+
+void SetCommPrecision( CommPrecision precision )
+{ commPrecision = precision; }
+
+CommPrecision GetCommPrecision()
+{ return commPrecision; }
+
+template<typename Real,typename>
+void AllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllGather", comm, sc*sizeof(*sbuf) );
+    if( CompressedComm<Real>() )
+    {
+        CompressedAllGather( sbuf, sc, rbuf, rc, comm );
+        return;
+    }
+#ifdef EL_USE_BYTE_ALLGATHERS
+    SafeMpi
+    ( MPI_Allgather
+      ( (UCP)const_cast<Real*>(sbuf), sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
+        (UCP)rbuf,                    sizeof(Real)*rc, MPI_UNSIGNED_CHAR, 
+        comm.comm ) );
+#else
+    SafeMpi
+    ( MPI_Allgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), 
+        rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
+#endif
+}
+
+template<typename Real,typename>
+void AllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllGather", comm, sc*sizeof(*sbuf) );
+    if( CompressedComm<Real>() )
+    {
+        CompressedAllGather
+        ( reinterpret_cast<const Real*>(sbuf), 2*sc,
+          reinterpret_cast<Real*>(rbuf),       2*rc, comm );
+        return;
+    }
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1408,6 +2157,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllGather", comm, sc*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -1422,6 +2172,64 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,typename>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllGather", comm, sc*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllGather", comm, sc*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllGather", comm, sc*sizeof(*sbuf) );
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template<typename Real,typename>
 void AllGather
 ( const Real* sbuf, int sc,
@@ -1429,6 +2237,12 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllGather", comm, sc*sizeof(*sbuf) );
+    if( CompressedComm<Real>() )
+    {
+        CompressedAllGather( sbuf, sc, rbuf, rcs, rds, 1, comm );
+        return;
+    }
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1463,6 +2277,14 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllGather", comm, sc*sizeof(*sbuf) );
+    if( CompressedComm<Real>() )
+    {
+        CompressedAllGather
+        ( reinterpret_cast<const Real*>(sbuf), sc,
+          reinterpret_cast<Real*>(rbuf), rcs, rds, 2, comm );
+        return;
+    }
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1513,6 +2335,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllGather", comm, sc*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
 
@@ -1540,6 +2363,9 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "Scatter", comm,
+      ( Rank(comm) == root ? sc*Size(comm) : 0 )*sizeof(*sbuf) );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1553,6 +2379,9 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "Scatter", comm,
+      ( Rank(comm) == root ? sc*Size(comm) : 0 )*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1575,6 +2404,9 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "Scatter", comm,
+      ( Rank(comm) == root ? sc*Size(comm) : 0 )*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1596,6 +2428,9 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "Scatter", comm,
+      ( Rank(comm) == root ? sc*Size(comm) : 0 )*sizeof(*buf) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1618,6 +2453,9 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "Scatter", comm,
+      ( Rank(comm) == root ? sc*Size(comm) : 0 )*sizeof(*buf) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1654,6 +2492,9 @@ void Scatter( T* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "Scatter", comm,
+      ( Rank(comm) == root ? sc*Size(comm) : 0 )*sizeof(*buf) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1679,6 +2520,12 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllToAll", comm, sc*Size(comm)*sizeof(*sbuf) );
+    if( CompressedComm<Real>() )
+    {
+        CompressedAllToAll( sbuf, sc, rbuf, rc, comm );
+        return;
+    }
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1692,6 +2539,14 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllToAll", comm, sc*Size(comm)*sizeof(*sbuf) );
+    if( CompressedComm<Real>() )
+    {
+        CompressedAllToAll
+        ( reinterpret_cast<const Real*>(sbuf), 2*sc,
+          reinterpret_cast<Real*>(rbuf),       2*rc, comm );
+        return;
+    }
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1716,6 +2571,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllToAll", comm, sc*Size(comm)*sizeof(*sbuf) );
     const int commSize = mpi::Size( comm );
     const int totalSend = sc*commSize;
     const int totalRecv = rc*commSize;
@@ -1737,6 +2593,13 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "AllToAll", comm, TotalCount(scs,Size(comm))*sizeof(*sbuf) );
+    if( CompressedComm<Real>() )
+    {
+        CompressedAllToAll( sbuf, scs, sds, rbuf, rcs, rds, 1, comm );
+        return;
+    }
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf), 
@@ -1747,21 +2610,458 @@ EL_NO_RELEASE_EXCEPT
         const_cast<int*>(rcs), 
         const_cast<int*>(rds), 
         TypeMap<Real>(),
-        comm.comm ) );
+        comm.comm ) );
+}
+
+template<typename Real,typename>
+void AllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "AllToAll", comm, TotalCount(scs,Size(comm))*sizeof(*sbuf) );
+    if( CompressedComm<Real>() )
+    {
+        CompressedAllToAll
+        ( reinterpret_cast<const Real*>(sbuf), scs, sds,
+          reinterpret_cast<Real*>(rbuf),       rcs, rds, 2, comm );
+        return;
+    }
+#ifdef EL_AVOID_COMPLEX_MPI
+    int p;
+    MPI_Comm_size( comm.comm, &p );
+    vector<int> scsDoubled(p), sdsDoubled(p),
+                rcsDoubled(p), rdsDoubled(p);
+    for( int i=0; i<p; ++i )
+    {
+        scsDoubled[i] = 2*scs[i];
+        sdsDoubled[i] = 2*sds[i];
+        rcsDoubled[i] = 2*rcs[i];
+        rdsDoubled[i] = 2*rds[i];
+    }
+    SafeMpi
+    ( MPI_Alltoallv
+      ( const_cast<Complex<Real>*>(sbuf),
+              scsDoubled.data(), sdsDoubled.data(), TypeMap<Real>(),
+        rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<Real>(), comm.comm ) );
+#else
+    SafeMpi
+    ( MPI_Alltoallv
+      ( const_cast<Complex<Real>*>(sbuf), 
+        const_cast<int*>(scs), 
+        const_cast<int*>(sds), 
+        TypeMap<Complex<Real>>(),
+        rbuf, 
+        const_cast<int*>(rcs), 
+        const_cast<int*>(rds), 
+        TypeMap<Complex<Real>>(),
+        comm.comm ) );
+#endif
+}
+
+template<typename T,typename,typename>
+void AllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "AllToAll", comm, TotalCount(scs,Size(comm))*sizeof(*sbuf) );
+    const int commSize = mpi::Size( comm );
+    const int totalSend = scs[commSize-1]+sds[commSize-1];
+    const int totalRecv = rcs[commSize-1]+rds[commSize-1];
+
+    std::vector<byte> packedSend, packedRecv;
+    Serialize( totalSend, sbuf, packedSend );
+    ReserveSerialized( totalRecv, rbuf, packedRecv );
+    SafeMpi
+    ( MPI_Alltoallv
+      ( packedSend.data(),
+        const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<T>(),
+        packedRecv.data(),
+        const_cast<int*>(rcs), const_cast<int*>(rds), TypeMap<T>(),
+        comm.comm ) );
+    Deserialize( totalRecv, packedRecv, rbuf );
+}
+
+template<typename T>
+vector<T> AllToAll
+( const vector<T>& sendBuf,
+  const vector<int>& sendCounts, 
+  const vector<int>& sendOffs,
+  Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    const int commSize = Size( comm ); 
+    vector<int> recvCounts(commSize);
+    AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm ); 
+    vector<int> recvOffs;
+    const int totalRecv = El::Scan( recvCounts, recvOffs );
+    vector<T> recvBuf(totalRecv);
+    AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+    return recvBuf;
+}
+
+template<typename Real,typename>
+void NeighborAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm graphComm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "NeighborAllToAll", graphComm, sc*NumDests(graphComm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    SafeMpi
+    ( MPI_Neighbor_alltoall
+      ( sbuf, sc, TypeMap<Real>(),
+        rbuf, rc, TypeMap<Real>(), graphComm.comm ) );
+#else
+    LogicError("Neighborhood collectives require MPI-3");
+#endif
+}
+
+template<typename Real,typename>
+void NeighborAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm graphComm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "NeighborAllToAll", graphComm, sc*NumDests(graphComm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Neighbor_alltoall
+      ( sbuf, 2*sc, TypeMap<Real>(),
+        rbuf, 2*rc, TypeMap<Real>(), graphComm.comm ) );
+#else
+    SafeMpi
+    ( MPI_Neighbor_alltoall
+      ( sbuf, sc, TypeMap<Complex<Real>>(),
+        rbuf, rc, TypeMap<Complex<Real>>(), graphComm.comm ) );
+#endif
+#else
+    LogicError("Neighborhood collectives require MPI-3");
+#endif
+}
+
+template<typename T,typename,typename>
+void NeighborAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm graphComm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "NeighborAllToAll", graphComm, sc*NumDests(graphComm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    vector<int> sources, dests;
+    DistGraphNeighbors( graphComm, sources, dests );
+    const int totalSend = sc*dests.size();
+    const int totalRecv = rc*sources.size();
+
+    std::vector<byte> packedSend, packedRecv;
+    Serialize( totalSend, sbuf, packedSend );
+    ReserveSerialized( totalRecv, rbuf, packedRecv );
+    SafeMpi
+    ( MPI_Neighbor_alltoall
+      ( packedSend.data(), sc, TypeMap<T>(),
+        packedRecv.data(), rc, TypeMap<T>(), graphComm.comm ) );
+    Deserialize( totalRecv, packedRecv, rbuf );
+#else
+    LogicError("Neighborhood collectives require MPI-3");
+#endif
+}
+
+template<typename Real,typename>
+void NeighborAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm graphComm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "NeighborAllToAll", graphComm,
+      TotalCount(scs,NumDests(graphComm))*sizeof(*sbuf) );
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    SafeMpi
+    ( MPI_Neighbor_alltoallv
+      ( sbuf, scs, sds, TypeMap<Real>(),
+        rbuf, rcs, rds, TypeMap<Real>(), graphComm.comm ) );
+#else
+    LogicError("Neighborhood collectives require MPI-3");
+#endif
+}
+
+template<typename Real,typename>
+void NeighborAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds, Comm graphComm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "NeighborAllToAll", graphComm,
+      TotalCount(scs,NumDests(graphComm))*sizeof(*sbuf) );
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    vector<int> sources, dests;
+    DistGraphNeighbors( graphComm, sources, dests );
+    const int numSources = sources.size();
+    const int numDests = dests.size();
+    vector<int> scsDoubled(numDests), sdsDoubled(numDests),
+                rcsDoubled(numSources), rdsDoubled(numSources);
+    for( int i=0; i<numDests; ++i )
+    {
+        scsDoubled[i] = 2*scs[i];
+        sdsDoubled[i] = 2*sds[i];
+    }
+    for( int i=0; i<numSources; ++i )
+    {
+        rcsDoubled[i] = 2*rcs[i];
+        rdsDoubled[i] = 2*rds[i];
+    }
+    SafeMpi
+    ( MPI_Neighbor_alltoallv
+      ( sbuf, scsDoubled.data(), sdsDoubled.data(), TypeMap<Real>(),
+        rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<Real>(),
+        graphComm.comm ) );
+#else
+    SafeMpi
+    ( MPI_Neighbor_alltoallv
+      ( sbuf, scs, sds, TypeMap<Complex<Real>>(),
+        rbuf, rcs, rds, TypeMap<Complex<Real>>(), graphComm.comm ) );
+#endif
+#else
+    LogicError("Neighborhood collectives require MPI-3");
+#endif
+}
+
+template<typename T,typename,typename>
+void NeighborAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm graphComm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "NeighborAllToAll", graphComm,
+      TotalCount(scs,NumDests(graphComm))*sizeof(*sbuf) );
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    vector<int> sources, dests;
+    DistGraphNeighbors( graphComm, sources, dests );
+    int totalSend=0, totalRecv=0;
+    for( size_t i=0; i<dests.size(); ++i )
+        totalSend = Max( totalSend, sds[i]+scs[i] );
+    for( size_t i=0; i<sources.size(); ++i )
+        totalRecv = Max( totalRecv, rds[i]+rcs[i] );
+
+    std::vector<byte> packedSend, packedRecv;
+    Serialize( totalSend, sbuf, packedSend );
+    ReserveSerialized( totalRecv, rbuf, packedRecv );
+    SafeMpi
+    ( MPI_Neighbor_alltoallv
+      ( packedSend.data(), scs, sds, TypeMap<T>(),
+        packedRecv.data(), rcs, rds, TypeMap<T>(), graphComm.comm ) );
+    Deserialize( totalRecv, packedRecv, rbuf );
+#else
+    LogicError("Neighborhood collectives require MPI-3");
+#endif
+}
+
+template<typename Real,typename>
+void INeighborAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm graphComm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "INeighborAllToAll", graphComm,
+      TotalCount(scs,NumDests(graphComm))*sizeof(*sbuf) );
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+    SafeMpi
+    ( MPI_Ineighbor_alltoallv
+      ( sbuf, scs, sds, TypeMap<Real>(),
+        rbuf, rcs, rds, TypeMap<Real>(), graphComm.comm,
+        &request.backend ) );
+#else
+    LogicError("Neighborhood collectives require MPI-3");
+#endif
+}
+
+template<typename Real,typename>
+void INeighborAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds,
+  Comm graphComm, Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "INeighborAllToAll", graphComm,
+      TotalCount(scs,NumDests(graphComm))*sizeof(*sbuf) );
+#ifdef EL_HAVE_MPI_NEIGHBOR_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    // The doubled counts and displacements must persist until the exchange
+    // completes, so they are stored within the request
+    vector<int> sources, dests;
+    DistGraphNeighbors( graphComm, sources, dests );
+    const int numSources = sources.size();
+    const int numDests = dests.size();
+    request.buffer.resize( 2*(numDests+numSources)*sizeof(int) );
+    int* scsDoubled = reinterpret_cast<int*>(request.buffer.data());
+    int* sdsDoubled = &scsDoubled[numDests];
+    int* rcsDoubled = &scsDoubled[2*numDests];
+    int* rdsDoubled = &scsDoubled[2*numDests+numSources];
+    for( int i=0; i<numDests; ++i )
+    {
+        scsDoubled[i] = 2*scs[i];
+        sdsDoubled[i] = 2*sds[i];
+    }
+    for( int i=0; i<numSources; ++i )
+    {
+        rcsDoubled[i] = 2*rcs[i];
+        rdsDoubled[i] = 2*rds[i];
+    }
+    SafeMpi
+    ( MPI_Ineighbor_alltoallv
+      ( sbuf, scsDoubled, sdsDoubled, TypeMap<Real>(),
+        rbuf, rcsDoubled, rdsDoubled, TypeMap<Real>(),
+        graphComm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( MPI_Ineighbor_alltoallv
+      ( sbuf, scs, sds, TypeMap<Complex<Real>>(),
+        rbuf, rcs, rds, TypeMap<Complex<Real>>(), graphComm.comm,
+        &request.backend ) );
+#endif
+#else
+    LogicError("Neighborhood collectives require MPI-3");
+#endif
+}
+
+template<typename T,typename,typename>
+void INeighborAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm graphComm,
+  Request<T>& request )
+{
+    DEBUG_CSE
+    NeighborAllToAll( sbuf, scs, sds, rbuf, rcs, rds, graphComm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
+template<typename Real,typename>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllToAll", comm, sc*Size(comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllToAll", comm, sc*Size(comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllToAll", comm, sc*Size(comm)*sizeof(*sbuf) );
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
+template<typename Real,typename>
+void IAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "IAllToAll", comm, TotalCount(scs,Size(comm))*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoallv)
+      ( const_cast<Real*>(sbuf),
+        const_cast<int*>(scs),
+        const_cast<int*>(sds),
+        TypeMap<Real>(),
+        rbuf,
+        const_cast<int*>(rcs),
+        const_cast<int*>(rds),
+        TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
 }
 
 template<typename Real,typename>
-void AllToAll
+void IAllToAll
 ( const Complex<Real>* sbuf, const int* scs, const int* sds,
-        Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm )
-EL_NO_RELEASE_EXCEPT
+        Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Complex<Real>>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "IAllToAll", comm, TotalCount(scs,Size(comm))*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
+    // The doubled counts and displacements must persist until the exchange
+    // completes, so they are stored within the request
     int p;
     MPI_Comm_size( comm.comm, &p );
-    vector<int> scsDoubled(p), sdsDoubled(p),
-                rcsDoubled(p), rdsDoubled(p);
+    request.buffer.resize( 4*p*sizeof(int) );
+    int* scsDoubled = reinterpret_cast<int*>(request.buffer.data());
+    int* sdsDoubled = &scsDoubled[p];
+    int* rcsDoubled = &scsDoubled[2*p];
+    int* rdsDoubled = &scsDoubled[3*p];
     for( int i=0; i<p; ++i )
     {
         scsDoubled[i] = 2*scs[i];
@@ -1770,67 +3070,82 @@ EL_NO_RELEASE_EXCEPT
         rdsDoubled[i] = 2*rds[i];
     }
     SafeMpi
-    ( MPI_Alltoallv
+    ( EL_NONBLOCKING_COLL(Ialltoallv)
       ( const_cast<Complex<Real>*>(sbuf),
-              scsDoubled.data(), sdsDoubled.data(), TypeMap<Real>(),
-        rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<Real>(), comm.comm ) );
+              scsDoubled, sdsDoubled, TypeMap<Real>(),
+        rbuf, rcsDoubled, rdsDoubled, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Alltoallv
-      ( const_cast<Complex<Real>*>(sbuf), 
-        const_cast<int*>(scs), 
-        const_cast<int*>(sds), 
+    ( EL_NONBLOCKING_COLL(Ialltoallv)
+      ( const_cast<Complex<Real>*>(sbuf),
+        const_cast<int*>(scs),
+        const_cast<int*>(sds),
         TypeMap<Complex<Real>>(),
-        rbuf, 
-        const_cast<int*>(rcs), 
-        const_cast<int*>(rds), 
+        rbuf,
+        const_cast<int*>(rcs),
+        const_cast<int*>(rds),
         TypeMap<Complex<Real>>(),
-        comm.comm ) );
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
 #endif
 }
 
 template<typename T,typename,typename>
-void AllToAll
+void IAllToAll
 ( const T* sbuf, const int* scs, const int* sds,
-        T* rbuf, const int* rcs, const int* rds, Comm comm )
-EL_NO_RELEASE_EXCEPT
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request )
 {
     DEBUG_CSE
-    const int commSize = mpi::Size( comm );
-    const int totalSend = scs[commSize-1]+sds[commSize-1];
-    const int totalRecv = rcs[commSize-1]+rds[commSize-1];
+    EL_PROFILE_TRAFFIC
+    ( "IAllToAll", comm, TotalCount(scs,Size(comm))*sizeof(*sbuf) );
+    AllToAll( sbuf, scs, sds, rbuf, rcs, rds, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
 
-    std::vector<byte> packedSend, packedRecv;
-    Serialize( totalSend, sbuf, packedSend );
-    ReserveSerialized( totalRecv, rbuf, packedRecv );
+template<typename T,typename>
+void AllToAllInit
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds,
+  Comm comm, Request<T>& request ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_MPI_PERSISTENT_COLLECTIVES
     SafeMpi
-    ( MPI_Alltoallv
-      ( packedSend.data(),
-        const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<T>(),
-        packedRecv.data(),
-        const_cast<int*>(rcs), const_cast<int*>(rds), TypeMap<T>(),
-        comm.comm ) );
-    Deserialize( totalRecv, packedRecv, rbuf );
+    ( MPI_Alltoallv_init
+      ( sbuf, scs, sds, TypeMap<T>(),
+        rbuf, rcs, rds, TypeMap<T>(),
+        comm.comm, MPI_INFO_NULL, &request.backend ) );
+#else
+    LogicError("Persistent collectives require MPI-4");
+#endif
+}
+
+template<typename T,typename,typename>
+void AllToAllInit
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds,
+  Comm comm, Request<T>& request ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    LogicError("Persistent collectives require packed datatypes");
 }
 
 template<typename T>
-vector<T> AllToAll
-( const vector<T>& sendBuf,
-  const vector<int>& sendCounts, 
-  const vector<int>& sendOffs,
-  Comm comm )
-EL_NO_RELEASE_EXCEPT
+void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT
 {
-    const int commSize = Size( comm ); 
-    vector<int> recvCounts(commSize);
-    AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm ); 
-    vector<int> recvOffs;
-    const int totalRecv = El::Scan( recvCounts, recvOffs );
-    vector<T> recvBuf(totalRecv);
-    AllToAll
-    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
-      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
-    return recvBuf;
+    DEBUG_CSE
+    SafeMpi( MPI_Start( &request.backend ) );
+}
+
+template<typename T>
+void Free( Request<T>& request ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    SafeMpi( MPI_Request_free( &request.backend ) );
 }
 
 template<typename Real,typename>
@@ -1839,6 +3154,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Reduce", comm, count*sizeof(*sbuf) );
     if( count == 0 )
         return;
 
@@ -1856,6 +3172,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Reduce", comm, count*sizeof(*sbuf) );
     if( count == 0 )
         return;
 
@@ -1892,6 +3209,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Reduce", comm, count*sizeof(*sbuf) );
     if( count == 0 )
         return;
 
@@ -1939,6 +3257,7 @@ void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Reduce", comm, count*sizeof(*buf) );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -1963,6 +3282,7 @@ void Reduce( Complex<Real>* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Reduce", comm, count*sizeof(*buf) );
     if( Size(comm) == 1 )
         return;
     if( count != 0 )
@@ -2023,6 +3343,7 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Reduce", comm, count*sizeof(*buf) );
     if( count == 0 )
         return;
 
@@ -2054,6 +3375,7 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllReduce", comm, count*sizeof(*sbuf) );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2070,6 +3392,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllReduce", comm, count*sizeof(*sbuf) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2105,6 +3428,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllReduce", comm, count*sizeof(*sbuf) );
     if( count == 0 )
         return;
 
@@ -2140,6 +3464,7 @@ void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllReduce", comm, count*sizeof(*buf) );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2154,6 +3479,7 @@ void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllReduce", comm, count*sizeof(*buf) );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2187,6 +3513,7 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "AllReduce", comm, count*sizeof(*buf) );
     if( count == 0 )
         return;
 
@@ -2207,11 +3534,174 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,typename>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllReduce", comm, count*sizeof(*sbuf) );
+    if( count == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllReduce", comm, count*sizeof(*sbuf) );
+    if( count == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+            &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( const_cast<Complex<Real>*>(sbuf),
+        rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+        &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllReduce", comm, count*sizeof(*sbuf) );
+    AllReduce( sbuf, rbuf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( sbuf, rbuf, count, SUM, comm, request ); }
+
+template<typename Real,typename>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllReduce", comm, count*sizeof(*buf) );
+    if( count == 0 || Size(comm) == 1 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllReduce", comm, count*sizeof(*buf) );
+    if( count == 0 || Size(comm) == 1 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(),
+            opC, comm.comm, &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IAllReduce", comm, count*sizeof(*buf) );
+    AllReduce( buf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( buf, count, SUM, comm, request ); }
+
 template<typename Real,typename>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ReduceScatter", comm, rc*Size(comm)*sizeof(*sbuf) );
     if( rc == 0 )
         return;
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
@@ -2237,6 +3727,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ReduceScatter", comm, rc*Size(comm)*sizeof(*sbuf) );
     if( rc == 0 )
         return;
 
@@ -2269,6 +3760,7 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ReduceScatter", comm, rc*Size(comm)*sizeof(*sbuf) );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2299,6 +3791,87 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { ReduceScatter( sbuf, rbuf, rc, SUM, comm ); }
 
+template<typename Real,typename>
+void IReduceScatter
+( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IReduceScatter", comm, rc*Size(comm)*sizeof(*sbuf) );
+    if( rc == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( sbuf, rbuf, rc, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IReduceScatter
+( Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IReduceScatter", comm, rc*Size(comm)*sizeof(*sbuf) );
+    if( rc == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+          ( sbuf, rbuf, 2*rc, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+          ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), opC, comm.comm,
+            &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), opC, comm.comm,
+        &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IReduceScatter
+( T* sbuf, T* rbuf, int rc, Op op, Comm comm,
+  Request<T>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "IReduceScatter", comm, rc*Size(comm)*sizeof(*sbuf) );
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
+template<typename T>
+void IReduceScatter
+( T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request )
+{ IReduceScatter( sbuf, rbuf, rc, SUM, comm, request ); }
+
 template<typename T>
 T ReduceScatter( T sb, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
@@ -2314,6 +3887,7 @@ void ReduceScatter( Real* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ReduceScatter", comm, rc*Size(comm)*sizeof(*buf) );
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2341,6 +3915,7 @@ void ReduceScatter( Complex<Real>* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ReduceScatter", comm, rc*Size(comm)*sizeof(*buf) );
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2374,6 +3949,7 @@ void ReduceScatter( T* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "ReduceScatter", comm, rc*Size(comm)*sizeof(*buf) );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2410,6 +3986,8 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "ReduceScatter", comm, TotalCount(rcs,Size(comm))*sizeof(*sbuf) );
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
     ( MPI_Reduce_scatter
@@ -2424,6 +4002,8 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "ReduceScatter", comm, TotalCount(rcs,Size(comm))*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -2463,6 +4043,8 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC
+    ( "ReduceScatter", comm, TotalCount(rcs,Size(comm))*sizeof(*sbuf) );
     const int commRank = mpi::Rank(comm);
     const int commSize = mpi::Size(comm);
     int totalSend=0;
@@ -2508,6 +4090,7 @@ void Scan( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Scan", comm, count*sizeof(*sbuf) );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2525,6 +4108,7 @@ void Scan
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Scan", comm, count*sizeof(*sbuf) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2559,6 +4143,7 @@ void Scan( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Scan", comm, count*sizeof(*sbuf) );
     if( count == 0 )
         return;
 
@@ -2601,6 +4186,7 @@ void Scan( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Scan", comm, count*sizeof(*buf) );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2615,6 +4201,7 @@ void Scan( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Scan", comm, count*sizeof(*buf) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2648,6 +4235,7 @@ void Scan( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_TRAFFIC( "Scan", comm, count*sizeof(*buf) );
     if( count == 0 )
         return;
 
@@ -2815,6 +4403,8 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -2839,6 +4429,31 @@ EL_NO_RELEASE_EXCEPT
     const vector<int>& sendOffs, \
     Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void NeighborAllToAll \
+  ( const T* sbuf, int sc, \
+          T* rbuf, int rc, Comm graphComm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void NeighborAllToAll \
+  ( const T* sbuf, const int* scs, const int* sds, \
+          T* rbuf, const int* rcs, const int* rds, Comm graphComm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void INeighborAllToAll \
+  ( const T* sbuf, const int* scs, const int* sds, \
+          T* rbuf, const int* rcs, const int* rds, \
+    Comm graphComm, Request<T>& request ); \
+  template void IAllToAll \
+  ( const T* sbuf, int sc, \
+          T* rbuf, int rc, Comm comm, Request<T>& request ); \
+  template void IAllToAll \
+  ( const T* sbuf, const int* scs, const int* sds, \
+          T* rbuf, const int* rcs, const int* rds, \
+    Comm comm, Request<T>& request ); \
+  template void AllToAllInit \
+  ( const T* sbuf, const int* scs, const int* sds, \
+          T* rbuf, const int* rcs, const int* rds, \
+    Comm comm, Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
+  template void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
+  template void Free( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
   template void Reduce \
   ( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
@@ -2866,10 +4481,23 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, int count, Comm comm, Request<T>& request ); \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IReduceScatter \
+  ( T* sbuf, T* rbuf, int rc, Op op, Comm comm, Request<T>& request ); \
+  template void IReduceScatter \
+  ( T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template T ReduceScatter( T sb, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template T ReduceScatter( T sb, Comm comm ) \
@@ -42,6 +42,25 @@ void EL_SCALAPACK(pzpotrf)
   dcomplex* A, const int* iA, const int* jA, const int* descA,
   int* info );
 
+// LU with partial pivoting
+// ------------------------
+void EL_SCALAPACK(psgetrf)
+( const int* m, const int* n,
+  float* A, const int* iA, const int* jA, const int* descA,
+  int* ipiv, int* info );
+void EL_SCALAPACK(pdgetrf)
+( const int* m, const int* n,
+  double* A, const int* iA, const int* jA, const int* descA,
+  int* ipiv, int* info );
+void EL_SCALAPACK(pcgetrf)
+( const int* m, const int* n,
+  scomplex* A, const int* iA, const int* jA, const int* descA,
+  int* ipiv, int* info );
+void EL_SCALAPACK(pzgetrf)
+( const int* m, const int* n,
+  dcomplex* A, const int* iA, const int* jA, const int* descA,
+  int* ipiv, int* info );
+
 // QR
 // --
 void EL_SCALAPACK(psgeqrf)
@@ -432,6 +451,52 @@ void Cholesky( char uplo, int n, dcomplex* A, const int* descA )
         RuntimeError("pzpotrf returned with info=",info);
 }
 
+// LU with partial pivoting
+// ------------------------
+void LU( int m, int n, float* A, const int* descA, int* ipiv )
+{
+    DEBUG_CSE
+    int iA=1,jA=1,info;
+    EL_SCALAPACK(psgetrf)( &m, &n, A, &iA, &jA, descA, ipiv, &info );
+    if( info < 0 )
+        RuntimeError("psgetrf returned with info=",info);
+    else if( info > 0 )
+        throw SingularMatrixException();
+}
+
+void LU( int m, int n, double* A, const int* descA, int* ipiv )
+{
+    DEBUG_CSE
+    int iA=1,jA=1,info;
+    EL_SCALAPACK(pdgetrf)( &m, &n, A, &iA, &jA, descA, ipiv, &info );
+    if( info < 0 )
+        RuntimeError("pdgetrf returned with info=",info);
+    else if( info > 0 )
+        throw SingularMatrixException();
+}
+
+void LU( int m, int n, scomplex* A, const int* descA, int* ipiv )
+{
+    DEBUG_CSE
+    int iA=1,jA=1,info;
+    EL_SCALAPACK(pcgetrf)( &m, &n, A, &iA, &jA, descA, ipiv, &info );
+    if( info < 0 )
+        RuntimeError("pcgetrf returned with info=",info);
+    else if( info > 0 )
+        throw SingularMatrixException();
+}
+
+void LU( int m, int n, dcomplex* A, const int* descA, int* ipiv )
+{
+    DEBUG_CSE
+    int iA=1,jA=1,info;
+    EL_SCALAPACK(pzgetrf)( &m, &n, A, &iA, &jA, descA, ipiv, &info );
+    if( info < 0 )
+        RuntimeError("pzgetrf returned with info=",info);
+    else if( info > 0 )
+        throw SingularMatrixException();
+}
+
 // QR
 // --
 void QR( int m, int n, float* A, const int* descA, float* tau )
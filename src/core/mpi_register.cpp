@@ -771,24 +771,109 @@ void CreateMinLocPairOp()
     Create( (UserFunction*)MinLocPairFunc<T>, true, MinLocPairOp<T>() );
 }
 
-void CreateCustom() EL_NO_RELEASE_EXCEPT
-{
-    // Create the necessary types
-    // ==========================
 #ifdef EL_HAVE_QD
+bool createdQDFamily = false;
+
+void CreateQDFamily() EL_NO_RELEASE_EXCEPT
+{
+    // Mark the family as created first, since the TypeMap and op accessors
+    // used below would otherwise recurse into this routine
+    createdQDFamily = true;
+
     CreateContiguous( 2, MPI_DOUBLE, TypeMap<DoubleDouble>() );
     CreateContiguous( 4, MPI_DOUBLE, TypeMap<QuadDouble>() );
     CreateContiguous
     ( 2, TypeMap<DoubleDouble>(), TypeMap<Complex<DoubleDouble>>() );
     CreateContiguous
     ( 2, TypeMap<QuadDouble>(), TypeMap<Complex<QuadDouble>>() );
+
+    CreateValueIntType<DoubleDouble>();
+    CreateValueIntType<QuadDouble>();
+    CreateValueIntType<Complex<DoubleDouble>>();
+    CreateValueIntType<Complex<QuadDouble>>();
+
+    CreateEntryType<DoubleDouble>();
+    CreateEntryType<QuadDouble>();
+    CreateEntryType<Complex<DoubleDouble>>();
+    CreateEntryType<Complex<QuadDouble>>();
+
+    CreateUserOps<DoubleDouble>();
+    CreateUserOps<QuadDouble>();
+    CreateUserOps<Complex<DoubleDouble>>();
+    CreateUserOps<Complex<QuadDouble>>();
+
+    CreateMaxOp<DoubleDouble>();
+    CreateMinOp<DoubleDouble>();
+    CreateSumOp<DoubleDouble>();
+    CreateProdOp<DoubleDouble>();
+
+    CreateMaxOp<QuadDouble>();
+    CreateMinOp<QuadDouble>();
+    CreateSumOp<QuadDouble>();
+    CreateProdOp<QuadDouble>();
+
+    CreateSumOp<Complex<DoubleDouble>>();
+    CreateSumOp<Complex<QuadDouble>>();
+    CreateProdOp<Complex<DoubleDouble>>();
+    CreateProdOp<Complex<QuadDouble>>();
+
+    CreateMaxLocOp<DoubleDouble>();
+    CreateMinLocOp<DoubleDouble>();
+
+    CreateMaxLocOp<QuadDouble>();
+    CreateMinLocOp<QuadDouble>();
+
+    CreateMaxLocPairOp<DoubleDouble>();
+    CreateMinLocPairOp<DoubleDouble>();
+
+    CreateMaxLocPairOp<QuadDouble>();
+    CreateMinLocPairOp<QuadDouble>();
+}
 #endif
+
 #ifdef EL_HAVE_QUAD
+bool createdQuadFamily = false;
+
+void CreateQuadFamily() EL_NO_RELEASE_EXCEPT
+{
+    // See CreateQDFamily for why the flag is set first
+    createdQuadFamily = true;
+
     CreateContiguous( 2, MPI_DOUBLE, TypeMap<Quad>() );
     CreateContiguous( 4, MPI_DOUBLE, TypeMap<Complex<Quad>>() );
+
+    CreateValueIntType<Quad>();
+    CreateValueIntType<Complex<Quad>>();
+
+    CreateEntryType<Quad>();
+    CreateEntryType<Complex<Quad>>();
+
+    CreateUserOps<Quad>();
+    CreateUserOps<Complex<Quad>>();
+
+    CreateMaxOp<Quad>();
+    CreateMinOp<Quad>();
+    CreateSumOp<Quad>();
+    CreateProdOp<Quad>();
+
+    CreateSumOp<Complex<Quad>>();
+    CreateProdOp<Complex<Quad>>();
+
+    CreateMaxLocOp<Quad>();
+    CreateMinLocOp<Quad>();
+
+    CreateMaxLocPairOp<Quad>();
+    CreateMinLocPairOp<Quad>();
+}
 #endif
+
+void CreateCustom() EL_NO_RELEASE_EXCEPT
+{
+    // Create the necessary types
+    // ==========================
     // NOTE: The BigFloat types are created by mpfr::SetPrecision previously
-    //       within El::Initialize
+    //       within El::Initialize, and the DoubleDouble, QuadDouble, and Quad
+    //       families are only created upon their first use (see LazyFamily)
 
     // A value and an integer
     // ----------------------
@@ -802,16 +887,6 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 #endif
     CreateValueIntType<Complex<float>>();
     CreateValueIntType<Complex<double>>();
-#ifdef EL_HAVE_QD
-    CreateValueIntType<DoubleDouble>();
-    CreateValueIntType<QuadDouble>();
-    CreateValueIntType<Complex<DoubleDouble>>();
-    CreateValueIntType<Complex<QuadDouble>>();
-#endif
-#ifdef EL_HAVE_QUAD
-    CreateValueIntType<Quad>();
-    CreateValueIntType<Complex<Quad>>();
-#endif
 
     // A triplet of a value and a pair of integers
     // -------------------------------------------
@@ -820,16 +895,6 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateEntryType<double>();
     CreateEntryType<Complex<float>>();
     CreateEntryType<Complex<double>>();
-#ifdef EL_HAVE_QD
-    CreateEntryType<DoubleDouble>();
-    CreateEntryType<QuadDouble>();
-    CreateEntryType<Complex<DoubleDouble>>();
-    CreateEntryType<Complex<QuadDouble>>();
-#endif
-#ifdef EL_HAVE_QUAD
-    CreateEntryType<Quad>();
-    CreateEntryType<Complex<Quad>>();
-#endif
 
     // Create the necessary MPI operations
     // ===================================
@@ -840,16 +905,6 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateUserOps<double>();
     CreateUserOps<Complex<float>>();
     CreateUserOps<Complex<double>>();
-#ifdef EL_HAVE_QD
-    CreateUserOps<DoubleDouble>();
-    CreateUserOps<QuadDouble>();
-    CreateUserOps<Complex<DoubleDouble>>();
-    CreateUserOps<Complex<QuadDouble>>();
-#endif
-#ifdef EL_HAVE_QUAD
-    CreateUserOps<Quad>();
-    CreateUserOps<Complex<Quad>>();
-#endif
 #ifdef EL_HAVE_MPC
     CreateUserOps<BigInt>();
     CreateUserOps<BigFloat>();
@@ -858,31 +913,6 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
    
     // Functions for scalar types
     // --------------------------
-#ifdef EL_HAVE_QD
-    CreateMaxOp<DoubleDouble>();
-    CreateMinOp<DoubleDouble>();
-    CreateSumOp<DoubleDouble>();
-    CreateProdOp<DoubleDouble>();
-
-    CreateMaxOp<QuadDouble>();
-    CreateMinOp<QuadDouble>();
-    CreateSumOp<QuadDouble>();
-    CreateProdOp<QuadDouble>();
-
-    CreateSumOp<Complex<DoubleDouble>>();
-    CreateSumOp<Complex<QuadDouble>>();
-    CreateProdOp<Complex<DoubleDouble>>();
-    CreateProdOp<Complex<QuadDouble>>();
-#endif
-#ifdef EL_HAVE_QUAD
-    CreateMaxOp<Quad>();
-    CreateMinOp<Quad>();
-    CreateSumOp<Quad>();
-    CreateProdOp<Quad>();
-
-    CreateSumOp<Complex<Quad>>();
-    CreateProdOp<Complex<Quad>>();
-#endif
 #ifdef EL_HAVE_MPC
     CreateMaxOp<BigInt>();
     CreateMinOp<BigInt>();
@@ -914,17 +944,6 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     MaxLocOp<double>() = MAXLOC;
     MinLocOp<double>() = MINLOC;
 #endif
-#ifdef EL_HAVE_QD
-    CreateMaxLocOp<DoubleDouble>();
-    CreateMinLocOp<DoubleDouble>();
-
-    CreateMaxLocOp<QuadDouble>();
-    CreateMinLocOp<QuadDouble>();
-#endif
-#ifdef EL_HAVE_QUAD
-    CreateMaxLocOp<Quad>();
-    CreateMinLocOp<Quad>();
-#endif
 #ifdef EL_HAVE_MPC
     CreateMaxLocOp<BigInt>();
     CreateMinLocOp<BigInt>();
@@ -943,17 +962,6 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 
     CreateMaxLocPairOp<double>();
     CreateMinLocPairOp<double>();
-#ifdef EL_HAVE_QD
-    CreateMaxLocPairOp<DoubleDouble>();
-    CreateMinLocPairOp<DoubleDouble>();
-
-    CreateMaxLocPairOp<QuadDouble>();
-    CreateMinLocPairOp<QuadDouble>();
-#endif
-#ifdef EL_HAVE_QUAD
-    CreateMaxLocPairOp<Quad>();
-    CreateMinLocPairOp<Quad>();
-#endif
 #ifdef EL_HAVE_MPC
     CreateMaxLocPairOp<BigInt>();
     CreateMinLocPairOp<BigInt>();
@@ -990,6 +998,60 @@ void FreeScalarOps()
     Free( Types<T>::prodOp );
 }
 
+#ifdef EL_HAVE_QD
+void DestroyQDFamily() EL_NO_RELEASE_EXCEPT
+{
+    FreeUserOps<DoubleDouble>();
+    FreeUserOps<QuadDouble>();
+    FreeUserOps<Complex<DoubleDouble>>();
+    FreeUserOps<Complex<QuadDouble>>();
+
+    FreeScalarOps<DoubleDouble>();
+    FreeScalarOps<QuadDouble>();
+    FreeScalarOps<Complex<DoubleDouble>>();
+    FreeScalarOps<Complex<QuadDouble>>();
+
+    Free( Types<Entry<DoubleDouble>>::type );
+    Free( Types<Entry<QuadDouble>>::type );
+    Free( Types<Entry<Complex<DoubleDouble>>>::type );
+    Free( Types<Entry<Complex<QuadDouble>>>::type );
+
+    Free( Types<ValueInt<DoubleDouble>>::type );
+    Free( Types<ValueInt<QuadDouble>>::type );
+    Free( Types<ValueInt<Complex<DoubleDouble>>>::type );
+    Free( Types<ValueInt<Complex<QuadDouble>>>::type );
+
+    Free( Types<Complex<DoubleDouble>>::type );
+    Free( Types<Complex<QuadDouble>>::type );
+    Free( Types<DoubleDouble>::type );
+    Free( Types<QuadDouble>::type );
+
+    createdQDFamily = false;
+}
+#endif
+
+#ifdef EL_HAVE_QUAD
+void DestroyQuadFamily() EL_NO_RELEASE_EXCEPT
+{
+    FreeUserOps<Quad>();
+    FreeUserOps<Complex<Quad>>();
+
+    FreeScalarOps<Quad>();
+    FreeScalarOps<Complex<Quad>>();
+
+    Free( Types<Entry<Quad>>::type );
+    Free( Types<Entry<Complex<Quad>>>::type );
+
+    Free( Types<ValueInt<Quad>>::type );
+    Free( Types<ValueInt<Complex<Quad>>>::type );
+
+    Free( Types<Complex<Quad>>::type );
+    Free( Types<Quad>::type );
+
+    createdQuadFamily = false;
+}
+#endif
+
 void DestroyCustom() EL_NO_RELEASE_EXCEPT
 {
     // Destroy the created operations
@@ -1002,32 +1064,12 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     FreeUserOps<double>();
     FreeUserOps<Complex<float>>();
     FreeUserOps<Complex<double>>();
-#ifdef EL_HAVE_QD
-    FreeUserOps<DoubleDouble>();
-    FreeUserOps<QuadDouble>();
-    FreeUserOps<Complex<DoubleDouble>>();
-    FreeUserOps<Complex<QuadDouble>>();
-#endif
-#ifdef EL_HAVE_QUAD
-    FreeUserOps<Quad>();
-    FreeUserOps<Complex<Quad>>();
-#endif
 #ifdef EL_HAVE_MPC
     FreeUserOps<BigInt>();
     FreeUserOps<BigFloat>();
     FreeUserOps<Complex<BigFloat>>();
 #endif
 
-#ifdef EL_HAVE_QD
-    FreeScalarOps<DoubleDouble>();
-    FreeScalarOps<QuadDouble>();
-    FreeScalarOps<Complex<DoubleDouble>>();
-    FreeScalarOps<Complex<QuadDouble>>();
-#endif
-#ifdef EL_HAVE_QUAD
-    FreeScalarOps<Quad>();
-    FreeScalarOps<Complex<Quad>>();
-#endif
 #ifdef EL_HAVE_MPC
     FreeScalarOps<BigInt>();
     FreeScalarOps<BigFloat>();
@@ -1050,16 +1092,6 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( Types<Entry<double>>::type );
     Free( Types<Entry<Complex<float>>>::type );
     Free( Types<Entry<Complex<double>>>::type );
-#ifdef EL_HAVE_QD
-    Free( Types<Entry<DoubleDouble>>::type );
-    Free( Types<Entry<QuadDouble>>::type );
-    Free( Types<Entry<Complex<DoubleDouble>>>::type );
-    Free( Types<Entry<Complex<QuadDouble>>>::type );
-#endif
-#ifdef EL_HAVE_QUAD
-    Free( Types<Entry<Quad>>::type );
-    Free( Types<Entry<Complex<Quad>>>::type );
-#endif
 
     Free( Types<ValueInt<Int>>::type );
 #ifdef EL_USE_64BIT_INTS
@@ -1068,26 +1100,14 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
 #endif
     Free( Types<ValueInt<Complex<float>>>::type );
     Free( Types<ValueInt<Complex<double>>>::type );
-#ifdef EL_HAVE_QD
-    Free( Types<ValueInt<DoubleDouble>>::type );
-    Free( Types<ValueInt<QuadDouble>>::type );
-    Free( Types<ValueInt<Complex<DoubleDouble>>>::type );
-    Free( Types<ValueInt<Complex<QuadDouble>>>::type );
-#endif
-#ifdef EL_HAVE_QUAD
-    Free( Types<ValueInt<Quad>>::type );
-    Free( Types<ValueInt<Complex<Quad>>>::type );
-#endif
 
 #ifdef EL_HAVE_QD
-    Free( Types<Complex<DoubleDouble>>::type );
-    Free( Types<Complex<QuadDouble>>::type );
-    Free( Types<DoubleDouble>::type );
-    Free( Types<QuadDouble>::type );
+    if( createdQDFamily )
+        DestroyQDFamily();
 #endif
 #ifdef EL_HAVE_QUAD
-    Free( Types<Complex<Quad>>::type );
-    Free( Types<Quad>::type );
+    if( createdQuadFamily )
+        DestroyQuadFamily();
 #endif
 #ifdef EL_HAVE_MPC
     DestroyBigIntFamily();
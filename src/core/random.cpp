@@ -13,6 +13,11 @@ namespace {
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
+// The (rank-independent) state of the counter-based generator
+std::uint64_t counterSeed = 21;
+bool counterBased = true;
+std::atomic<std::uint64_t> localStream(0);
+
 #ifdef EL_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
@@ -28,6 +33,12 @@ void InitializeRandom( bool deterministic )
     const long seed = (secs<<16) | (rank & 0xFFFF);
 
     ::generator.seed( seed );
+    // The counter-based seed must agree over all processes
+    Int counterSecs = secs;
+    if( !deterministic )
+        mpi::Broadcast( counterSecs, 0, mpi::COMM_WORLD );
+    ::counterSeed = counterSecs;
+    ::localStream = 0;
 
     srand( seed );
 
@@ -49,6 +60,27 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+std::uint64_t CounterSeed()
+{ return ::counterSeed; }
+
+void SetCounterSeed( std::uint64_t seed )
+{ ::counterSeed = seed; }
+
+bool CounterBasedRandom()
+{ return ::counterBased; }
+
+void SetCounterBasedRandom( bool counterBased )
+{ ::counterBased = counterBased; }
+
+std::uint64_t NextLocalRandomStream()
+{
+    // Set the top bit to distinguish these streams from those of the grids
+    // and include the rank so that each process draws different matrices
+    const std::uint64_t rank = mpi::Rank( mpi::COMM_WORLD );
+    return (std::uint64_t(1)<<63) | ((rank & 0x7FFFFF)<<40) |
+           (::localStream++ & ((std::uint64_t(1)<<40)-1));
+}
+
 #ifdef EL_HAVE_MPC
 namespace mpfr {
 
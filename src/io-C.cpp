@@ -38,6 +38,14 @@ ElError ElSetNumDiscreteColors( ElInt numColors )
 ElError ElNumDiscreteColors( ElInt* numColors )
 { EL_TRY( *numColors = NumDiscreteColors() ) }
 
+/* Downsampling
+   ============ */
+ElError ElSetMaxRenderSize( ElInt maxSize )
+{ EL_TRY( SetMaxRenderSize(maxSize) ) }
+
+ElError ElMaxRenderSize( ElInt* maxSize )
+{ EL_TRY( *maxSize = MaxRenderSize() ) }
+
 /* Display
    ======= */
 ElError ElProcessEvents( int numMsecs )
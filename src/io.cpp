@@ -13,6 +13,7 @@ using namespace El;
 
 ColorMap colorMap=RED_BLACK_GREEN;
 Int numDiscreteColors = 15;
+Int maxRenderSize = 1024;
 
 }
 
@@ -30,4 +31,14 @@ void SetNumDiscreteColors( Int numChunks )
 Int NumDiscreteColors()
 { return ::numDiscreteColors; }
 
+void SetMaxRenderSize( Int maxSize )
+{
+    if( maxSize <= 0 )
+        LogicError("The maximum render size must be positive");
+    ::maxRenderSize = maxSize;
+}
+
+Int MaxRenderSize()
+{ return ::maxRenderSize; }
+
 } // namespace El
@@ -0,0 +1,377 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <cstdio>
+
+namespace El {
+
+namespace {
+
+// The layout of each file is the magic string, the step, the number of
+// processes, and the number of records, followed by each record as the
+// length of its name, its name, the length of its data, and its data
+const char checkpointMagic[8] = { 'E', 'l', 'C', 'k', 'p', 't', '0', '1' };
+typedef long long Index;
+
+void AppendIndex( Index value, vector<byte>& buf )
+{
+    const byte* valueBytes = reinterpret_cast<const byte*>(&value);
+    buf.insert( buf.end(), valueBytes, valueBytes+sizeof(Index) );
+}
+
+Index ExtractIndex( const byte*& buf )
+{
+    Index value;
+    MemCopy( reinterpret_cast<byte*>(&value), buf, sizeof(Index) );
+    buf += sizeof(Index);
+    return value;
+}
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void AppendEntries( Int n, const T* x, vector<byte>& buf )
+{
+    const byte* xBytes = reinterpret_cast<const byte*>(x);
+    buf.insert( buf.end(), xBytes, xBytes+n*sizeof(T) );
+}
+
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void AppendEntries( Int n, const T* x, vector<byte>& buf )
+{
+    vector<byte> packed;
+    Serialize( n, x, packed );
+    buf.insert( buf.end(), packed.begin(), packed.end() );
+}
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void ExtractEntries( Int n, const byte*& buf, T* x )
+{
+    MemCopy( reinterpret_cast<byte*>(x), buf, n*sizeof(T) );
+    buf += n*sizeof(T);
+}
+
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void ExtractEntries( Int n, const byte*& buf, T* x )
+{ buf = Deserialize( n, buf, x ); }
+
+template<typename T>
+void AppendLocal( const Matrix<T>& ALoc, vector<byte>& buf )
+{
+    const Int localHeight = ALoc.Height();
+    const Int localWidth = ALoc.Width();
+    AppendIndex( localHeight, buf );
+    AppendIndex( localWidth, buf );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        AppendEntries( localHeight, ALoc.LockedBuffer(0,jLoc), buf );
+}
+
+template<typename T>
+void ExtractLocal( const byte*& buf, Matrix<T>& ALoc )
+{
+    const Int localHeight = ExtractIndex( buf );
+    const Int localWidth = ExtractIndex( buf );
+    if( ALoc.Height() != localHeight || ALoc.Width() != localWidth )
+        RuntimeError
+        ("Checkpointed local matrix was ",localHeight," x ",localWidth,
+         " but the local matrix is ",ALoc.Height()," x ",ALoc.Width());
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        ExtractEntries( localHeight, buf, ALoc.Buffer(0,jLoc) );
+}
+
+} // anonymous namespace
+
+Checkpoint::Checkpoint( const string& basename, mpi::Comm comm )
+: basename_(basename), comm_(comm), step_(-1), nextGeneration_(0)
+{ }
+
+Checkpoint::~Checkpoint()
+{
+    // Errors cannot be propagated from a destructor
+    if( writer_ )
+        writer_->join();
+}
+
+string Checkpoint::Filename( int generation ) const
+{
+    return BuildString
+      (basename_,"-",generation,"-",mpi::Rank(comm_),".ckpt");
+}
+
+template<typename T>
+void Checkpoint::RecordValue( const string& name, const T& value )
+{
+    DEBUG_CSE
+    vector<byte>& buf = pending_[name];
+    buf.clear();
+    AppendEntries( 1, &value, buf );
+}
+
+template<typename T>
+void Checkpoint::Record( const string& name, const Matrix<T>& A )
+{
+    DEBUG_CSE
+    vector<byte>& buf = pending_[name];
+    buf.clear();
+    AppendLocal( A, buf );
+}
+
+template<typename T>
+void Checkpoint::Record( const string& name, const AbstractDistMatrix<T>& A )
+{
+    DEBUG_CSE
+    vector<byte>& buf = pending_[name];
+    buf.clear();
+    AppendIndex( A.Height(), buf );
+    AppendIndex( A.Width(), buf );
+    AppendIndex( A.ColAlign(), buf );
+    AppendIndex( A.RowAlign(), buf );
+    AppendIndex( A.Root(), buf );
+    AppendLocal( A.LockedMatrix(), buf );
+}
+
+template<typename T>
+void Checkpoint::Record( const string& name, const DistMultiVec<T>& A )
+{
+    DEBUG_CSE
+    vector<byte>& buf = pending_[name];
+    buf.clear();
+    AppendIndex( A.Height(), buf );
+    AppendIndex( A.Width(), buf );
+    AppendLocal( A.LockedMatrix(), buf );
+}
+
+void Checkpoint::Save( Int step, bool async )
+{
+    DEBUG_CSE
+    Wait();
+
+    // Serialize the snapshot so that the pending records may be reused
+    vector<byte> contents
+    ( checkpointMagic, checkpointMagic+sizeof(checkpointMagic) );
+    AppendIndex( step, contents );
+    AppendIndex( mpi::Size(comm_), contents );
+    AppendIndex( pending_.size(), contents );
+    for( const auto& record : pending_ )
+    {
+        AppendIndex( record.first.size(), contents );
+        contents.insert
+        ( contents.end(), record.first.begin(), record.first.end() );
+        AppendIndex( record.second.size(), contents );
+        contents.insert
+        ( contents.end(), record.second.begin(), record.second.end() );
+    }
+
+    const string filename = Filename( nextGeneration_ );
+    nextGeneration_ = 1 - nextGeneration_;
+    auto write =
+      [this]( const string& filename, const vector<byte>& contents )
+      {
+        const string tmpFilename = filename + ".tmp";
+        {
+            std::ofstream file( tmpFilename.c_str(), std::ios::binary );
+            if( !file.is_open() )
+            {
+                writerError_ = "Could not open " + tmpFilename;
+                return;
+            }
+            file.write( (const char*)contents.data(), contents.size() );
+            file.flush();
+            if( !file )
+            {
+                writerError_ = "Could not write " + tmpFilename;
+                return;
+            }
+        }
+        if( std::rename( tmpFilename.c_str(), filename.c_str() ) != 0 )
+            writerError_ = "Could not rename " + tmpFilename;
+      };
+    if( async )
+        writer_.reset
+        ( new std::thread( write, filename, std::move(contents) ) );
+    else
+    {
+        write( filename, contents );
+        Wait();
+    }
+}
+
+void Checkpoint::Wait()
+{
+    DEBUG_CSE
+    if( writer_ )
+    {
+        writer_->join();
+        writer_.reset();
+    }
+    if( !writerError_.empty() )
+    {
+        const string error = writerError_;
+        writerError_.clear();
+        RuntimeError(error);
+    }
+}
+
+bool Checkpoint::Load()
+{
+    DEBUG_CSE
+    Wait();
+
+    // Find the step of each generation on this process (or -1)
+    const Index commSize = mpi::Size( comm_ );
+    vector<vector<byte>> contents( 2 );
+    Index steps[2];
+    for( int generation=0; generation<2; ++generation )
+    {
+        steps[generation] = -1;
+        std::ifstream file( Filename(generation).c_str(), std::ios::binary );
+        if( !file.is_open() )
+            continue;
+        file.seekg( 0, std::ios::end );
+        const std::streamoff numBytes = file.tellg();
+        file.seekg( 0, std::ios::beg );
+        const std::streamoff headerBytes =
+          sizeof(checkpointMagic) + 3*sizeof(Index);
+        if( numBytes < headerBytes )
+            continue;
+        contents[generation].resize( numBytes );
+        file.read( (char*)contents[generation].data(), numBytes );
+        const byte* buf = contents[generation].data();
+        if( std::memcmp( buf, checkpointMagic, sizeof(checkpointMagic) ) != 0 )
+            continue;
+        buf += sizeof(checkpointMagic);
+        const Index step = ExtractIndex( buf );
+        if( ExtractIndex( buf ) != commSize )
+            continue;
+        steps[generation] = step;
+    }
+
+    // Choose the latest generation which every process completed
+    int generation = -1;
+    Index step = -1;
+    for( int gen=0; gen<2; ++gen )
+    {
+        const Index minStep = mpi::AllReduce( steps[gen], mpi::MIN, comm_ );
+        const Index maxStep = mpi::AllReduce( steps[gen], mpi::MAX, comm_ );
+        if( minStep >= 0 && minStep == maxStep && minStep > step )
+        {
+            generation = gen;
+            step = minStep;
+        }
+    }
+    if( generation < 0 )
+        return false;
+
+    loaded_.clear();
+    const byte* buf =
+      contents[generation].data() + sizeof(checkpointMagic) + 2*sizeof(Index);
+    const Index numRecords = ExtractIndex( buf );
+    for( Index r=0; r<numRecords; ++r )
+    {
+        const Index nameSize = ExtractIndex( buf );
+        const string name( (const char*)buf, nameSize );
+        buf += nameSize;
+        const Index dataSize = ExtractIndex( buf );
+        loaded_[name].assign( buf, buf+dataSize );
+        buf += dataSize;
+    }
+    step_ = step;
+    // Preserve the loaded generation until the next save has completed
+    nextGeneration_ = 1 - generation;
+    return true;
+}
+
+bool Checkpoint::Has( const string& name ) const
+{ return loaded_.find(name) != loaded_.end(); }
+
+const vector<byte>& Checkpoint::Loaded( const string& name ) const
+{
+    auto it = loaded_.find( name );
+    if( it == loaded_.end() )
+        LogicError("No checkpointed record named ",name);
+    return it->second;
+}
+
+template<typename T>
+void Checkpoint::RestoreValue( const string& name, T& value ) const
+{
+    DEBUG_CSE
+    const byte* buf = Loaded(name).data();
+    ExtractEntries( 1, buf, &value );
+}
+
+template<typename T>
+void Checkpoint::Restore( const string& name, Matrix<T>& A ) const
+{
+    DEBUG_CSE
+    const byte* buf = Loaded(name).data();
+    const byte* sizeBuf = buf;
+    const Int height = ExtractIndex( sizeBuf );
+    const Int width = ExtractIndex( sizeBuf );
+    A.Resize( height, width );
+    ExtractLocal( buf, A );
+}
+
+template<typename T>
+void Checkpoint::Restore( const string& name, AbstractDistMatrix<T>& A ) const
+{
+    DEBUG_CSE
+    const byte* buf = Loaded(name).data();
+    const Int height = ExtractIndex( buf );
+    const Int width = ExtractIndex( buf );
+    const Int colAlign = ExtractIndex( buf );
+    const Int rowAlign = ExtractIndex( buf );
+    const Int root = ExtractIndex( buf );
+    A.Empty();
+    A.SetRoot( root );
+    DistData data( A );
+    data.root = root;
+    data.colAlign = colAlign;
+    data.rowAlign = rowAlign;
+    A.AlignWith( data );
+    A.Resize( height, width );
+    ExtractLocal( buf, A.Matrix() );
+}
+
+template<typename T>
+void Checkpoint::Restore( const string& name, DistMultiVec<T>& A ) const
+{
+    DEBUG_CSE
+    const byte* buf = Loaded(name).data();
+    const Int height = ExtractIndex( buf );
+    const Int width = ExtractIndex( buf );
+    A.Resize( height, width );
+    ExtractLocal( buf, A.Matrix() );
+}
+
+#define PROTO(T) \
+  template void Checkpoint::RecordValue \
+  ( const string& name, const T& value ); \
+  template void Checkpoint::Record \
+  ( const string& name, const Matrix<T>& A ); \
+  template void Checkpoint::Record \
+  ( const string& name, const AbstractDistMatrix<T>& A ); \
+  template void Checkpoint::Record \
+  ( const string& name, const DistMultiVec<T>& A ); \
+  template void Checkpoint::RestoreValue \
+  ( const string& name, T& value ) const; \
+  template void Checkpoint::Restore \
+  ( const string& name, Matrix<T>& A ) const; \
+  template void Checkpoint::Restore \
+  ( const string& name, AbstractDistMatrix<T>& A ) const; \
+  template void Checkpoint::Restore \
+  ( const string& name, DistMultiVec<T>& A ) const;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
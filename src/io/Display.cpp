@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./Downsample.hpp"
+
 #ifdef EL_HAVE_QT5
 # include "El/io/DisplayWindow-premoc.hpp"
 # include "El/io/ComplexDisplayWindow-premoc.hpp"
@@ -24,6 +26,64 @@ void ProcessEvents( int numMsecs )
 #endif
 }
 
+namespace {
+
+bool Downsampled( Int m, Int n )
+{
+#ifdef EL_HAVE_QT5
+    return !GuiDisabled() && ( m > MaxRenderSize() || n > MaxRenderSize() );
+#else
+    return false;
+#endif
+}
+
+#ifdef EL_HAVE_QT5
+void DisplayMaxAbs( const Matrix<double>& tile, string title )
+{
+    DEBUG_CSE
+    QString qTitle = QString::fromStdString( title );
+    DisplayWindow* displayWindow = new DisplayWindow;
+    displayWindow->Display( new Matrix<double>(tile), qTitle );
+    displayWindow->show();
+
+    // Spend at most 200 milliseconds rendering
+    ProcessEvents( 200 );
+}
+
+// Reduce the max-abs tile one slab of pixel columns at a time and redraw
+// after each slab arrives
+template<typename DistType>
+void DisplayProgressive( const DistType& A, string title )
+{
+    DEBUG_CSE
+    DisplayWindow* displayWindow = nullptr;
+    QString qTitle = QString::fromStdString( title );
+    if( downsample::OwnsTile(A) )
+    {
+        displayWindow = new DisplayWindow;
+        displayWindow->setWindowTitle( qTitle );
+        displayWindow->show();
+    }
+    auto update = [&]( const Matrix<double>& tile, Int numReduced )
+    {
+        displayWindow->Display
+        ( downsample::ReducedPrefix(tile,numReduced), qTitle );
+        // Spend at most 200 milliseconds rendering each slab
+        ProcessEvents( 200 );
+    };
+    Matrix<double> tile;
+    downsample::Progressive
+    ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_MAX_ABS,
+      0, downsample::numRenderSlabs, update );
+}
+#else
+template<typename DistType>
+void DisplayProgressive( const DistType& A, string title )
+{ }
+#endif // ifdef EL_HAVE_QT5
+
+} // anonymous namespace
+
 template<typename Real>
 void Display( const Matrix<Real>& A, string title )
 {
@@ -35,9 +95,18 @@ void Display( const Matrix<Real>& A, string title )
         return;
     }
 
-    // Convert A to double-precision since Qt's MOC does not support templates
     const Int m = A.Height();
     const Int n = A.Width();
+    if( Downsampled( m, n ) )
+    {
+        Matrix<double> tile;
+        Downsample
+        ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_MAX_ABS );
+        DisplayMaxAbs( tile, title );
+        return;
+    }
+
+    // Convert A to double-precision since Qt's MOC does not support templates
     Matrix<double>* ADouble = new Matrix<double>( m, n );
     for( Int j=0; j<n; ++j )
         for( Int i=0; i<m; ++i )
@@ -66,9 +135,18 @@ void Display( const Matrix<Complex<Real>>& A, string title )
         return;
     }
 
-    // Convert A to double-precision since Qt's MOC does not support templates
     const Int m = A.Height();
     const Int n = A.Width();
+    if( Downsampled( m, n ) )
+    {
+        Matrix<double> tile;
+        Downsample
+        ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_MAX_ABS );
+        DisplayMaxAbs( tile, title );
+        return;
+    }
+
+    // Convert A to double-precision since Qt's MOC does not support templates
     Matrix<Complex<double>>* ADouble = new Matrix<Complex<double>>( m, n );
     for( Int j=0; j<n; ++j )
     {
@@ -102,6 +180,10 @@ void Display( const AbstractDistMatrix<T>& A, string title )
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Display( A.LockedMatrix(), title );
     }
+    else if( Downsampled( A.Height(), A.Width() ) )
+    {
+        DisplayProgressive( A, title );
+    }
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
@@ -114,6 +196,11 @@ template<typename T>
 void Display( const DistMultiVec<T>& X, string title )
 {
     DEBUG_CSE
+    if( Downsampled( X.Height(), X.Width() ) )
+    {
+        DisplayProgressive( X, title );
+        return;
+    }
     const int commRank = mpi::Rank( X.Comm() );
     if( commRank == 0 )
     {
@@ -173,65 +260,30 @@ void Display( const DistGraph& graph, string title )
     }
 }
 
-template<typename Real>
-void Display( const SparseMatrix<Real>& A, string title )
-{
-    DEBUG_CSE
-#ifdef HAVE_QT5
-    A.AssertConsistent();
-    auto AFull = new Matrix<double>;
-    const int m = A.Height();
-    const int n = A.Width();
-    Zeros( *AFull, m, n );
-
-    const int numEntries = A.NumEntries();
-    const int* srcBuf = A.LockedSourceBuffer();
-    const int* tgtBuf = A.LockedTargetBuffer();
-    const Real* valBuf = A.LockedValueBuffer();
-    for( int s=0; s<numEntries; ++s )
-        AFull->Set( tgtBuf[s], srcBuf[s], double(valBuf[s]) );
-
-    QString qTitle = QString::fromStdString( title );
-    auto displayWindow = new DisplayWindow;
-    displayWindow->Display( AFull, qTitle );
-    displayWindow->show();
-
-    // Spend at most 200 milliseconds rendering
-    ProcessEvents( 200 );
-#else
-    Print( A, title );
-#endif
-}
-
-template<typename Real>
-void Display( const SparseMatrix<Complex<Real>>& A, string title )
+template<typename T>
+void Display( const SparseMatrix<T>& A, string title )
 {
     DEBUG_CSE
-#ifdef HAVE_QT5
+#ifdef EL_HAVE_QT5
+    if( GuiDisabled() )
+    {
+        Print( A, title );
+        return;
+    }
     A.AssertConsistent();
-    auto AFull = new Matrix<Complex<double>>;
-    const int m = A.Height();
-    const int n = A.Width();
-    Zeros( *AFull, m, n );
-
-    const int numEntries = A.NumEntries();
-    const int* srcBuf = A.LockedSourceBuffer();
-    const int* tgtBuf = A.LockedTargetBuffer();
-    const Complex<Real>* valBuf = A.LockedValueBuffer();
-    for( int s=0; s<numEntries; ++s )
+    if( Downsampled( A.Height(), A.Width() ) )
     {
-        const Complex<double> alpha =
-            Complex<double>(valBuf[s].real,valBuf[s].imag);
-        AFull->Set( tgtBuf[s], srcBuf[s], alpha );
+        Matrix<double> tile;
+        Downsample
+        ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_MAX_ABS );
+        DisplayMaxAbs( tile, title );
+    }
+    else
+    {
+        Matrix<T> AFull;
+        Copy( A, AFull );
+        Display( AFull, title );
     }
-
-    QString qTitle = QString::fromStdString( title );
-    auto displayWindow = new ComplexDisplayWindow;
-    displayWindow->Display( AFull, qTitle );
-    displayWindow->show();
-
-    // Spend at most 200 milliseconds rendering
-    ProcessEvents( 200 );
 #else
     Print( A, title );
 #endif
@@ -242,6 +294,11 @@ void Display( const DistSparseMatrix<T>& A, string title )
 {
     DEBUG_CSE
     A.AssertLocallyConsistent();
+    if( Downsampled( A.Height(), A.Width() ) )
+    {
+        DisplayProgressive( A, title );
+        return;
+    }
     const mpi::Comm comm = A.Comm();
     const int commRank = mpi::Rank( comm );
     
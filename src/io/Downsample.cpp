@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./Downsample.hpp"
+
+namespace El {
+
+template<typename T>
+void Downsample
+( const Matrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    downsample::LocalTile( A, tile, mPix, nPix, mode, tol );
+    if( mode == DOWNSAMPLE_DENSITY )
+        downsample::Normalize
+        ( tile, A.Height(), A.Width(), 0, tile.Width() );
+}
+
+template<typename T>
+void Downsample
+( const AbstractDistMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    downsample::Progressive
+    ( A, tile, mPix, nPix, mode, tol, 1,
+      downsample::UpdateFunc() );
+}
+
+template<typename T>
+void Downsample
+( const DistMultiVec<T>& X, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    downsample::Progressive
+    ( X, tile, mPix, nPix, mode, tol, 1,
+      downsample::UpdateFunc() );
+}
+
+template<typename T>
+void Downsample
+( const SparseMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    downsample::LocalTile( A, tile, mPix, nPix, mode, tol );
+    if( mode == DOWNSAMPLE_DENSITY )
+        downsample::Normalize
+        ( tile, A.Height(), A.Width(), 0, tile.Width() );
+}
+
+template<typename T>
+void Downsample
+( const DistSparseMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    downsample::Progressive
+    ( A, tile, mPix, nPix, mode, tol, 1,
+      downsample::UpdateFunc() );
+}
+
+#define PROTO(T) \
+  template void Downsample \
+  ( const Matrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix, \
+    DownsampleMode mode, Base<T> tol ); \
+  template void Downsample \
+  ( const AbstractDistMatrix<T>& A, Matrix<double>& tile, \
+    Int mPix, Int nPix, DownsampleMode mode, Base<T> tol ); \
+  template void Downsample \
+  ( const DistMultiVec<T>& X, Matrix<double>& tile, Int mPix, Int nPix, \
+    DownsampleMode mode, Base<T> tol ); \
+  template void Downsample \
+  ( const SparseMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix, \
+    DownsampleMode mode, Base<T> tol ); \
+  template void Downsample \
+  ( const DistSparseMatrix<T>& A, Matrix<double>& tile, \
+    Int mPix, Int nPix, DownsampleMode mode, Base<T> tol );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,267 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_DOWNSAMPLE_HPP
+#define EL_IO_DOWNSAMPLE_HPP
+
+namespace El {
+namespace downsample {
+
+// Row i of an m x n matrix maps to pixel row floor(i*mPix/m), so that each
+// pixel covers a contiguous block of either floor(m/mPix) or ceil(m/mPix) rows
+inline Int Pixel( Int i, Int m, Int mPix ) EL_NO_EXCEPT
+{ return Int( ((long long)(i)*mPix) / m ); }
+
+// The first index which maps to pixel 'iPix'
+inline Int PixelBegin( Int iPix, Int m, Int mPix ) EL_NO_EXCEPT
+{ return Int( ((long long)(iPix)*m + mPix-1) / mPix ); }
+
+inline Int TileSize( Int m, Int mPixMax )
+{
+    if( mPixMax <= 0 )
+        LogicError("Tile dimensions must be positive");
+    return Min( m, mPixMax );
+}
+
+template<typename T>
+inline void Accumulate
+( Matrix<double>& tile, Int m, Int n, Int i, Int j, const T& alpha,
+  DownsampleMode mode, const Base<T>& tol )
+{
+    const Base<T> alphaAbs = Abs(alpha);
+    const Int iPix = Pixel( i, m, tile.Height() );
+    const Int jPix = Pixel( j, n, tile.Width() );
+    double& entry = tile.Ref( iPix, jPix );
+    if( mode == DOWNSAMPLE_DENSITY )
+    {
+        if( alphaAbs > tol )
+            entry += 1;
+    }
+    else
+        entry = Max( entry, double(alphaAbs) );
+}
+
+// Form the contributions of the locally-owned entries
+// ---------------------------------------------------
+
+template<typename T>
+void LocalTile
+( const Matrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( tile, TileSize(m,mPix), TileSize(n,nPix) );
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            Accumulate( tile, m, n, i, j, ABuf[i+j*ALDim], mode, tol );
+}
+
+template<typename T>
+void LocalTile
+( const AbstractDistMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( tile, TileSize(m,mPix), TileSize(n,nPix) );
+    // Only one member of each redundant team contributes
+    if( !A.Participating() || A.RedundantRank() != 0 )
+        return;
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            Accumulate
+            ( tile, m, n, A.GlobalRow(iLoc), j, ABuf[iLoc+jLoc*ALDim],
+              mode, tol );
+    }
+}
+
+template<typename T>
+void LocalTile
+( const DistMultiVec<T>& X, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    const Int m = X.Height();
+    const Int n = X.Width();
+    Zeros( tile, TileSize(m,mPix), TileSize(n,nPix) );
+    const Int localHeight = X.LocalHeight();
+    const Int firstLocalRow = X.FirstLocalRow();
+    const Matrix<T>& XLoc = X.LockedMatrix();
+    for( Int j=0; j<n; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            Accumulate
+            ( tile, m, n, iLoc+firstLocalRow, j, XLoc.Get(iLoc,j),
+              mode, tol );
+}
+
+template<typename T>
+void LocalTile
+( const SparseMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( tile, TileSize(m,mPix), TileSize(n,nPix) );
+    const Int numEntries = A.NumEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const T* valueBuf = A.LockedValueBuffer();
+    for( Int e=0; e<numEntries; ++e )
+        Accumulate
+        ( tile, m, n, sourceBuf[e], targetBuf[e], valueBuf[e], mode, tol );
+}
+
+template<typename T>
+void LocalTile
+( const DistSparseMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Base<T> tol )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( tile, TileSize(m,mPix), TileSize(n,nPix) );
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const T* valueBuf = A.LockedValueBuffer();
+    for( Int e=0; e<numLocalEntries; ++e )
+        Accumulate
+        ( tile, m, n, sourceBuf[e], targetBuf[e], valueBuf[e], mode, tol );
+}
+
+// The team which the local tiles are reduced over, and the member of that
+// team which receives the result
+// -----------------------------------------------------------------------
+
+template<typename T>
+bool Contributes( const AbstractDistMatrix<T>& A )
+{ return A.Participating() && A.RedundantRank() == 0; }
+template<typename T>
+bool Contributes( const DistMultiVec<T>& X )
+{ return true; }
+template<typename T>
+bool Contributes( const DistSparseMatrix<T>& A )
+{ return true; }
+
+template<typename T>
+mpi::Comm ReductionComm( const AbstractDistMatrix<T>& A )
+{ return A.DistComm(); }
+template<typename T>
+mpi::Comm ReductionComm( const DistMultiVec<T>& X )
+{ return X.Comm(); }
+template<typename T>
+mpi::Comm ReductionComm( const DistSparseMatrix<T>& A )
+{ return A.Comm(); }
+
+template<typename DistType>
+bool OwnsTile( const DistType& A )
+{ return Contributes(A) && mpi::Rank(ReductionComm(A)) == 0; }
+
+// Convert the counts in the pixel columns [jPixBeg,jPixEnd) into the fraction
+// of the covered entries which were counted
+inline void Normalize
+( Matrix<double>& tile, Int m, Int n, Int jPixBeg, Int jPixEnd )
+{
+    DEBUG_CSE
+    const Int mPix = tile.Height();
+    const Int nPix = tile.Width();
+    for( Int jPix=jPixBeg; jPix<jPixEnd; ++jPix )
+    {
+        const Int cellWidth =
+          PixelBegin(jPix+1,n,nPix) - PixelBegin(jPix,n,nPix);
+        for( Int iPix=0; iPix<mPix; ++iPix )
+        {
+            const Int cellHeight =
+              PixelBegin(iPix+1,m,mPix) - PixelBegin(iPix,m,mPix);
+            tile.Ref(iPix,jPix) /= double(cellHeight)*double(cellWidth);
+        }
+    }
+}
+
+// The number of slabs of pixel columns used for progressive rendering
+const Int numRenderSlabs = 8;
+
+// 'update' is passed the tile along with the number of leading pixel columns
+// which have been fully reduced
+typedef function<void(const Matrix<double>&,Int)> UpdateFunc;
+
+// A copy of the fully-reduced leading columns of the tile, padded with zeros
+inline Matrix<double>*
+ReducedPrefix( const Matrix<double>& tile, Int numReduced )
+{
+    DEBUG_CSE
+    auto prefix = new Matrix<double>;
+    Zeros( *prefix, tile.Height(), tile.Width() );
+    for( Int jPix=0; jPix<numReduced; ++jPix )
+        for( Int iPix=0; iPix<tile.Height(); ++iPix )
+            prefix->Set( iPix, jPix, tile.Get(iPix,jPix) );
+    return prefix;
+}
+
+// Sum (or take the maximum of) the local tiles onto the owner of the tile,
+// one slab of pixel columns at a time, so that the owner can render each slab
+// as soon as it arrives rather than waiting on the entire tile. Since the
+// tile is stored contiguously, each slab requires a single reduction.
+inline void Reduce
+( Matrix<double>& tile, Int m, Int n, DownsampleMode mode, mpi::Comm comm,
+  Int numSlabs=1, UpdateFunc update=UpdateFunc() )
+{
+    DEBUG_CSE
+    const Int mPix = tile.Height();
+    const Int nPix = tile.Width();
+    const bool owner = ( mpi::Rank(comm) == 0 );
+    const mpi::Op op = ( mode == DOWNSAMPLE_DENSITY ? mpi::SUM : mpi::MAX );
+    numSlabs = Max( Min( numSlabs, nPix ), Int(1) );
+    for( Int slab=0; slab<numSlabs; ++slab )
+    {
+        const Int jPixBeg = (slab*nPix) / numSlabs;
+        const Int jPixEnd = ((slab+1)*nPix) / numSlabs;
+        const Int slabSize = mPix*(jPixEnd-jPixBeg);
+        if( slabSize > 0 )
+            mpi::Reduce( tile.Buffer(0,jPixBeg), slabSize, op, 0, comm );
+        if( owner )
+        {
+            if( mode == DOWNSAMPLE_DENSITY )
+                Normalize( tile, m, n, jPixBeg, jPixEnd );
+            if( update )
+                update( tile, jPixEnd );
+        }
+    }
+}
+
+// Downsample a distributed object, calling 'update' on the owner of the tile
+// after each slab of pixel columns has been reduced
+template<typename DistType,typename Real>
+void Progressive
+( const DistType& A, Matrix<double>& tile, Int mPix, Int nPix,
+  DownsampleMode mode, Real tol, Int numSlabs, UpdateFunc update )
+{
+    DEBUG_CSE
+    LocalTile( A, tile, mPix, nPix, mode, tol );
+    if( Contributes(A) )
+        Reduce
+        ( tile, A.Height(), A.Width(), mode, ReductionComm(A), numSlabs,
+          update );
+}
+
+} // namespace downsample
+} // namespace El
+
+#endif // ifndef EL_IO_DOWNSAMPLE_HPP
@@ -0,0 +1,176 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#ifdef EL_HAVE_MMAP_FILES
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+
+template<typename T>
+MappedMatrix<T>::MappedMatrix()
+: base_(nullptr), numBytes_(0)
+{ }
+
+template<typename T>
+MappedMatrix<T>::MappedMatrix( const string filename, MapAdvice advice )
+: base_(nullptr), numBytes_(0)
+{ Map( filename, advice ); }
+
+template<typename T>
+MappedMatrix<T>::MappedMatrix
+( const string filename, Int height, Int width, MapAdvice advice )
+: base_(nullptr), numBytes_(0)
+{ Map( filename, height, width, advice ); }
+
+template<typename T>
+MappedMatrix<T>::~MappedMatrix()
+{ Unmap(); }
+
+template<typename T>
+void MappedMatrix<T>::Map( const string filename, MapAdvice advice )
+{
+    DEBUG_CSE
+    MapFile( filename, 2*sizeof(Int), 0, 0, true, advice );
+}
+
+template<typename T>
+void MappedMatrix<T>::Map
+( const string filename, Int height, Int width, MapAdvice advice )
+{
+    DEBUG_CSE
+    if( height < 0 || width < 0 )
+        LogicError("Invalid dimensions: ",height," x ",width);
+    MapFile( filename, 0, height, width, false, advice );
+}
+
+template<typename T>
+void MappedMatrix<T>::Unmap()
+{
+    DEBUG_CSE
+    A_.Empty();
+    copy_.Empty();
+#ifdef EL_HAVE_MMAP_FILES
+    if( base_ != nullptr )
+        munmap( base_, numBytes_ );
+#endif
+    base_ = nullptr;
+    numBytes_ = 0;
+}
+
+template<typename T>
+void MappedMatrix<T>::MapFile
+( const string filename, size_t metaBytes, Int height, Int width,
+  bool header, MapAdvice advice )
+{
+    DEBUG_CSE
+    Unmap();
+#ifdef EL_HAVE_MMAP_FILES
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd < 0 )
+        RuntimeError("Could not open ",filename);
+    struct stat info;
+    if( fstat( fd, &info ) != 0 )
+    {
+        close( fd );
+        RuntimeError("Could not determine the size of ",filename);
+    }
+    const size_t fileBytes = info.st_size;
+    if( fileBytes < metaBytes )
+    {
+        close( fd );
+        RuntimeError
+        ("Expected at least ",metaBytes," bytes but found ",fileBytes);
+    }
+
+    // Only map files whose entries are properly aligned and nonempty
+    // (the mapping itself is page-aligned)
+    const bool aligned = ( metaBytes % alignof(T) == 0 );
+    void* base = nullptr;
+    if( aligned && fileBytes > metaBytes )
+    {
+        base = mmap( nullptr, fileBytes, PROT_READ, MAP_SHARED, fd, 0 );
+        if( base == MAP_FAILED )
+        {
+            close( fd );
+            RuntimeError("Could not map ",filename);
+        }
+    }
+    close( fd );
+
+    if( header )
+    {
+        Int dims[2];
+        if( base != nullptr )
+        {
+            MemCopy( dims, static_cast<Int*>(base), 2 );
+        }
+        else
+        {
+            std::ifstream file( filename.c_str(), std::ios::binary );
+            file.read( (char*)dims, 2*sizeof(Int) );
+        }
+        height = dims[0];
+        width = dims[1];
+    }
+    const size_t numBytesExp = metaBytes + size_t(height)*width*sizeof(T);
+    if( height < 0 || width < 0 || fileBytes != numBytesExp )
+    {
+        if( base != nullptr )
+            munmap( base, fileBytes );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",fileBytes);
+    }
+
+    if( base != nullptr )
+    {
+        int adviceFlag;
+        switch( advice )
+        {
+        case ADVISE_SEQUENTIAL: adviceFlag = MADV_SEQUENTIAL; break;
+        case ADVISE_RANDOM:     adviceFlag = MADV_RANDOM;     break;
+        case ADVISE_WILLNEED:   adviceFlag = MADV_WILLNEED;   break;
+        default:                adviceFlag = MADV_NORMAL;     break;
+        }
+        // The advice is only a hint, so failures are ignored
+        madvise( base, fileBytes, adviceFlag );
+
+        base_ = base;
+        numBytes_ = fileBytes;
+        const T* buffer =
+          reinterpret_cast<const T*>( static_cast<byte*>(base)+metaBytes );
+        A_.LockedAttach( height, width, buffer, Max(height,Int(1)) );
+        return;
+    }
+#endif
+    if( header )
+    {
+        Read( copy_, filename, BINARY );
+    }
+    else
+    {
+        copy_.Resize( height, width );
+        Read( copy_, filename, BINARY_FLAT );
+    }
+    A_.LockedAttach
+    ( copy_.Height(), copy_.Width(), copy_.LockedBuffer(), copy_.LDim() );
+}
+
+#define PROTO(T) template class MappedMatrix<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -13,6 +13,7 @@
 #include "./Read/Binary.hpp"
 #include "./Read/BinaryFlat.hpp"
 #include "./Read/MatrixMarket.hpp"
+#include "./Read/SparseBinary.hpp"
 
 namespace El {
 
@@ -111,6 +112,9 @@ void Read( SparseMatrix<T>& A, const string filename, FileFormat format )
 
     switch( format )
     {
+    case BINARY:
+        read::SparseBinary( A, filename );
+        break;
     case MATRIX_MARKET:
         read::MatrixMarket( A, filename );
         break;
@@ -128,6 +132,9 @@ void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
 
     switch( format )
     {
+    case BINARY:
+        read::SparseBinary( A, filename );
+        break;
     case MATRIX_MARKET:
         read::MatrixMarket( A, filename );
         break;
@@ -136,9 +143,25 @@ void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
     }
 }
 
+void ReadBinaryDimensions( const string filename, Int& height, Int& width )
+{
+    DEBUG_CSE
+    read::BinaryDimensions( filename, height, width );
+}
+
+template<typename T>
+void ReadBinaryRows
+( Matrix<T>& A, const string filename, Int rowBeg, Int rowEnd )
+{
+    DEBUG_CSE
+    read::BinaryRows( A, filename, rowBeg, rowEnd );
+}
+
 #define PROTO(T) \
   template void Read \
   ( Matrix<T>& A, const string filename, FileFormat format ); \
+  template void ReadBinaryRows \
+  ( Matrix<T>& A, const string filename, Int rowBeg, Int rowEnd ); \
   template void Read \
   ( AbstractDistMatrix<T>& A, const string filename, \
     FileFormat format, bool sequential ); \
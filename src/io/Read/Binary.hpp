@@ -40,9 +40,71 @@ Binary( Matrix<T>& A, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Collectively read the local entries of A, which are stored in
+// column-major order beginning at byte 'offset' of the file, via a view of
+// the file which matches the (element or block) distribution of A
+template<typename T>
+inline void
+DistEntries
+( mpi::File& file, long long offset, AbstractDistMatrix<T>& A )
+{
+    DEBUG_CSE
+    vector<Int> rows, cols;
+    if( A.Participating() )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        rows.resize( localHeight );
+        cols.resize( localWidth );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            rows[iLoc] = A.GlobalRow(iLoc);
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            cols[jLoc] = A.GlobalCol(jLoc);
+    }
+    file.ReadAll
+    ( offset, sizeof(T), A.Height(), rows, cols,
+      (byte*)A.Buffer(), A.LDim() );
+}
+
 template<typename T>
 inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
+{
+    DEBUG_CSE
+    mpi::File file;
+    file.Open( A.Grid().ViewingComm(), filename, false );
+
+    Int dims[2];
+    file.ReadAt( 0, (byte*)dims, 2*sizeof(Int) );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    const long long numBytes = file.Size();
+    const long long metaBytes = 2*sizeof(Int);
+    const long long dataBytes = (long long)(height)*width*sizeof(T);
+    const long long numBytesExp = metaBytes + dataBytes;
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+
+    A.Resize( height, width );
+    DistEntries( file, metaBytes, A );
+    file.Close();
+}
+
+inline void
+BinaryDimensions( const string filename, Int& height, Int& width )
+{
+    DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.read( (char*)&height, sizeof(Int) );
+    file.read( (char*)&width,  sizeof(Int) );
+}
+
+template<typename T>
+inline void
+BinaryRows( Matrix<T>& A, const string filename, Int rowBeg, Int rowEnd )
 {
     DEBUG_CSE
     std::ifstream file( filename.c_str(), std::ios::binary );
@@ -52,53 +114,25 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
     Int height, width;
     file.read( (char*)&height, sizeof(Int) );
     file.read( (char*)&width,  sizeof(Int) );
+    if( rowBeg < 0 || rowEnd > height || rowBeg > rowEnd )
+        LogicError
+        ("Invalid row range [",rowBeg,",",rowEnd,") of a matrix of height ",
+         height);
     const Int numBytes = FileSize( file );
     const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
+    const Int numBytesExp = metaBytes + height*width*sizeof(T);
     if( numBytes != numBytesExp )
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
 
-    A.Resize( height, width );
-    if( A.CrossRank() != A.Root() )
-        return;
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-        else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-    }
-    else if( A.ColStride() == 1 )
+    // Each column of the (column-major) file contributes a contiguous chunk
+    const Int blockHeight = rowEnd - rowBeg;
+    A.Resize( blockHeight, width );
+    for( Int j=0; j<width; ++j )
     {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
+        const std::streamoff pos = metaBytes + (rowBeg+j*height)*sizeof(T);
+        file.seekg( pos );
+        file.read( (char*)A.Buffer(0,j), blockHeight*sizeof(T) );
     }
 }
 
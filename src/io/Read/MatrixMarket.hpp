@@ -232,12 +232,29 @@ void MatrixMarket( AbstractDistMatrix<T>& A, const string filename )
     Copy( A_CIRC_CIRC, A );
 }
 
-template<typename T>
-void MatrixMarket( SparseMatrix<T>& A, const string filename )
+// Parsing of the coordinate format for sparse matrices
+// ====================================================
+// Rather than extracting each entry through an std::stringstream, the lines
+// are parsed in place, and the file is split into byte ranges which are
+// parsed independently (each range owns the lines which begin within it) so
+// that the ranks, and the threads within each rank, can each parse a
+// portion of the file.
+
+struct MarketHeader
+{
+    bool isMatrix, isComplex, isPattern;
+    bool isSymmetric, isSkewSymmetric, isHermitian;
+    Int height, width, numNonzero;
+    // The offset of the first entry of the file
+    std::streamoff dataBeg;
+    // The total size of the file
+    std::streamoff fileEnd;
+};
+
+inline MarketHeader ReadSparseMarketHeader( const string& filename )
 {
     DEBUG_CSE
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
+    std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
@@ -264,34 +281,36 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
     }
     // Ensure that the header components are individually valid
     // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
+    MarketHeader header;
+    header.isMatrix = ( object == string("matrix") );
+    header.isComplex = ( field == string("complex") );
+    header.isPattern = ( field == string("pattern") );
+    header.isSymmetric = ( symmetry == string("symmetric") );
+    header.isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+    header.isHermitian = ( symmetry == string("hermitian") );
     const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
     const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
+    if( !header.isMatrix && object != string("vector") )
         RuntimeError("Invalid Matrix Market object: ",object);
     if( !isArray && format != string("coordinate") )
         RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern && 
+    if( !header.isComplex && !header.isPattern && 
         field != string("real") && 
         field != string("double") &&
         field != string("integer") )
         RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
+    if( !isGeneral && !header.isSymmetric && !header.isSkewSymmetric &&
+        !header.isHermitian )
         RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
     // Ensure that the components are consistent
     // -----------------------------------------
-    if( isArray && isPattern )
+    if( isArray && header.isPattern )
         RuntimeError("Pattern field requires coordinate format");
     // NOTE: This constraint is only enforced because of the note located at
     //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
+    if( header.isSkewSymmetric && header.isPattern )
         RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
+    if( header.isHermitian && !header.isComplex )
         RuntimeError("Hermitian symmetry requires complex data");
 
     if( isArray )
@@ -305,98 +324,240 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
     while( file.peek() == '%' ) 
         std::getline( file, line );
   
-    int m, n;
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract the size line");
 
     // Read in the matrix dimensions and number of nonzeros
     // ====================================================
-    int numNonzero;
-    if( isMatrix )
+    std::stringstream lineStream( line );
+    if( !(lineStream >> header.height) )
+        RuntimeError("Missing matrix height: ",line);
+    if( header.isMatrix )
     {
-        std::stringstream lineStream( line );
-        if( !(lineStream >> m) )
-            RuntimeError("Missing matrix height: ",line);
-        if( !(lineStream >> n) )
+        if( !(lineStream >> header.width) )
             RuntimeError("Missing matrix width: ",line);
-        if( !(lineStream >> numNonzero) )
-            RuntimeError("Missing nonzeros entry: ",line);
     }
     else
+        header.width = 1;
+    if( !(lineStream >> header.numNonzero) )
+        RuntimeError("Missing nonzeros entry: ",line);
+
+    header.dataBeg = file.tellg();
+    file.seekg( 0, std::ios::end );
+    header.fileEnd = file.tellg();
+    return header;
+}
+
+inline void SkipMarketSpace( const char*& p )
+{
+    while( *p == ' ' || *p == '\t' )
+        ++p;
+}
+
+inline bool ParseMarketIndex( const char*& p, Int& index )
+{
+    SkipMarketSpace( p );
+    if( *p < '0' || *p > '9' )
+        return false;
+    index = 0;
+    for( ; *p >= '0' && *p <= '9'; ++p )
+        index = 10*index + (*p-'0');
+    return true;
+}
+
+template<typename Real>
+inline bool ParseMarketReal( const char*& p, Real& value )
+{
+    // Fall back to the stream extraction operator so that no precision is
+    // lost for the extended-precision types
+    SkipMarketSpace( p );
+    const char* tokenEnd = p;
+    while( *tokenEnd != '\0' && *tokenEnd != ' ' && *tokenEnd != '\t' &&
+           *tokenEnd != '\r' && *tokenEnd != '\n' )
+        ++tokenEnd;
+    std::stringstream tokenStream( string(p,tokenEnd) );
+    if( !(tokenStream >> value) )
+        return false;
+    p = tokenEnd;
+    return true;
+}
+
+inline bool ParseMarketReal( const char*& p, float& value )
+{
+    char* end;
+    value = std::strtof( p, &end );
+    if( end == p )
+        return false;
+    p = end;
+    return true;
+}
+
+inline bool ParseMarketReal( const char*& p, double& value )
+{
+    char* end;
+    value = std::strtod( p, &end );
+    if( end == p )
+        return false;
+    p = end;
+    return true;
+}
+
+// Returns whether the line held an entry, which is stored in 'entry'.
+// Blank and comment lines are skipped and malformed lines raise an
+// exception.
+template<typename T>
+inline bool ParseMarketLine
+( const string& line, const MarketHeader& header, Entry<T>& entry )
+{
+    typedef Base<T> Real;
+    const char* p = line.c_str();
+    SkipMarketSpace( p );
+    if( *p == '\0' || *p == '\r' || *p == '%' )
+        return false;
+
+    if( !ParseMarketIndex( p, entry.i ) )
+        RuntimeError("Could not extract row coordinate from: ",line);
+    --entry.i; // convert from Fortran to C indexing
+    if( header.isMatrix )
     {
-        std::stringstream lineStream( line );
-        if( !(lineStream >> m) )
-            RuntimeError("Missing vector height: ",line);
-        n = 1;
-        if( !(lineStream >> numNonzero) )
-            RuntimeError("Missing nonzeros entry: ",line);
+        if( !ParseMarketIndex( p, entry.j ) )
+            RuntimeError("Could not extract col coordinate from: ",line);
+        --entry.j;
     }
+    else
+        entry.j = 0;
 
-    // Create a matrix of zeros
-    // ========================
-    Zeros( A, m, n );
+    if( header.isPattern )
+    {
+        entry.value = T(1);
+    }
+    else if( header.isComplex )
+    {
+        Real realPart, imagPart;
+        if( !ParseMarketReal( p, realPart ) )
+            RuntimeError("Could not extract real part from: ",line);
+        if( !ParseMarketReal( p, imagPart ) )
+            RuntimeError("Could not extract imag part from: ",line);
+        SetRealPart( entry.value, realPart );
+        SetImagPart( entry.value, imagPart );
+    }
+    else
+    {
+        Real realPart;
+        if( !ParseMarketReal( p, realPart ) )
+            RuntimeError("Could not extract real entry from: ",line);
+        entry.value = T(realPart);
+    }
+    return true;
+}
 
-    // Fill in the nonzero entries
-    // ===========================
-    int i, j;
-    Real realPart, imagPart;
-    T value;
-    A.Reserve( numNonzero );
-    for( Int k=0; k<numNonzero; ++k )
+// Parse the entries on the lines which begin within [beg,end)
+template<typename T>
+inline void ParseMarketRange
+( const string& filename, const MarketHeader& header,
+  std::streamoff beg, std::streamoff end, vector<Entry<T>>& entries )
+{
+    DEBUG_CSE
+    if( beg >= end )
+        return;
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    // Skip the remainder of the line which began in the previous range
+    string line;
+    std::streamoff pos = beg;
+    file.seekg( beg );
+    if( beg > header.dataBeg )
     {
-        if( !std::getline( file, line ) )
-            RuntimeError("Could not get nonzero ",k);
-        std::stringstream lineStream( line );
-        if( !(lineStream >> i) )
-            RuntimeError("Could not extract row coordinate of nonzero ",k);
-        --i; // convert from Fortran to C indexing
-        if( isMatrix )
-        {
-            if( !(lineStream >> j) )
-                RuntimeError
-                ("Could not extract col coordinate of nonzero ",k);
-            --j;
-        }
-        else
-            j = 0;
+        file.seekg( beg-1 );
+        std::getline( file, line );
+        pos = beg-1 + line.size() + 1;
+    }
 
-        if( isPattern )
+    Entry<T> entry;
+    while( pos < end && std::getline( file, line ) )
+    {
+        pos += line.size() + 1;
+        if( ParseMarketLine( line, header, entry ) )
+            entries.push_back( entry );
+    }
+}
+
+// Parse the entries on the lines which begin within [beg,end) using each of
+// the threads on a contiguous subrange
+template<typename T>
+inline vector<vector<Entry<T>>> ParseMarketRangeThreaded
+( const string& filename, const MarketHeader& header,
+  std::streamoff beg, std::streamoff end )
+{
+    DEBUG_CSE
+    Int numThreads = 1;
+#ifdef EL_HYBRID
+    // Ranges which are too small to be worth splitting are parsed serially
+    const std::streamoff minThreadBytes = 1 << 20;
+    numThreads =
+      Max( Min( Int(omp_get_max_threads()),
+                Int((end-beg)/minThreadBytes) ), Int(1) );
+#endif
+    vector<vector<Entry<T>>> entries( numThreads );
+    // Exceptions cannot escape the parallel region
+    vector<string> errors( numThreads );
+    EL_PARALLEL_FOR
+    for( Int t=0; t<numThreads; ++t )
+    {
+        const std::streamoff threadBeg = beg + ((end-beg)*t)/numThreads;
+        const std::streamoff threadEnd = beg + ((end-beg)*(t+1))/numThreads;
+        try
         {
-            A.QueueUpdate( i, j, T(1) );
+            ParseMarketRange
+            ( filename, header, threadBeg, threadEnd, entries[t] );
         }
-        else
+        catch( const std::exception& e )
         {
-            if( isComplex )
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                if( !(lineStream >> imagPart) )
-                    RuntimeError
-                    ("Could not extract imag part of entry (",i,",",j,")");
-                SetRealPart( value, realPart );
-                SetImagPart( value, imagPart );
-                A.QueueUpdate( i, j, value );
-            }
-            else
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real entry (",i,",",j,")");
-                A.QueueUpdate( i, j, T(realPart) );
-            }
+            errors[t] = e.what();
         }
     }
-    A.ProcessQueues();
+    for( Int t=0; t<numThreads; ++t )
+        if( !errors[t].empty() )
+            RuntimeError(errors[t]);
+    return entries;
+}
 
-    if( isSymmetric )
+template<typename T>
+void MatrixMarket( SparseMatrix<T>& A, const string filename )
+{
+    DEBUG_CSE
+    const MarketHeader header = ReadSparseMarketHeader( filename );
+
+    // Create a matrix of zeros
+    // ========================
+    Zeros( A, header.height, header.width );
+
+    // Fill in the nonzero entries
+    // ===========================
+    auto entries =
+      ParseMarketRangeThreaded<T>
+      ( filename, header, header.dataBeg, header.fileEnd );
+    Int numEntries = 0;
+    for( const auto& threadEntries : entries )
+        numEntries += threadEntries.size();
+    if( numEntries != header.numNonzero )
+        RuntimeError
+        ("Expected ",header.numNonzero," nonzeros but found ",numEntries);
+    SparseBuilder<T> builder( entries.size() );
+    for( Int t=0; t<builder.NumBuffers(); ++t )
+        builder.QueueUpdates( t, std::move(entries[t]) );
+    builder.Finish( A );
+
+    if( header.isSymmetric )
         MakeSymmetric( LOWER, A );
-    if( isHermitian )
+    if( header.isHermitian )
         MakeHermitian( LOWER, A );
     // I'm not certain of what the MM standard is for complex skew-symmetry,
     // so I'll default to assuming no conjugation
     const bool conjugateSkew = false;
-    if( isSkewSymmetric )
+    if( header.isSkewSymmetric )
     {
         MakeSymmetric( LOWER, A, conjugateSkew );
         ScaleTrapezoid( T(-1), UPPER, A, 1 );
@@ -407,174 +568,55 @@ template<typename T>
 void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
 {
     DEBUG_CSE
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    // Read the header
-    // ===============
-    // Attempt to pull in the various header components
-    // ------------------------------------------------
-    string line, stamp, object, format, field, symmetry;
-    if( !std::getline( file, line ) )
-        RuntimeError("Could not extract header line");
-    {
-        std::stringstream lineStream( line );
-        lineStream >> stamp; 
-        if( stamp != string("%%MatrixMarket") )
-            RuntimeError("Invalid Matrix Market stamp: ",stamp);
-        if( !(lineStream >> object) ) 
-            RuntimeError("Missing Matrix Market object");
-        if( !(lineStream >> format) )
-            RuntimeError("Missing Matrix Market format");
-        if( !(lineStream >> field) )
-            RuntimeError("Missing Matrix Market field");
-        if( !(lineStream >> symmetry) )
-            RuntimeError("Missing Matrix Market symmetry");
-    }
-    // Ensure that the header components are individually valid
-    // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
-    const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
-        RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
-        RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern && 
-        field != string("real") && 
-        field != string("double") &&
-        field != string("integer") )
-        RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
-        RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
-    // Ensure that the components are consistent
-    // -----------------------------------------
-    if( isArray && isPattern )
-        RuntimeError("Pattern field requires coordinate format");
-    // NOTE: This constraint is only enforced because of the note located at
-    //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
-        RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
-        RuntimeError("Hermitian symmetry requires complex data");
-
-    if( isArray )
-    {
-        LogicError
-        ("Attempted to load dense MatrixMarket format into SparseMatrix");
-    }
-
-    // Skip the comment lines
-    // ======================
-    while( file.peek() == '%' ) 
-        std::getline( file, line );
-  
-    int m, n;
-    if( !std::getline( file, line ) )
-        RuntimeError("Could not extract the size line");
-
-    // Read in the matrix dimensions and number of nonzeros
-    // ====================================================
-    int numNonzero;
-    if( isMatrix )
-    {
-        std::stringstream lineStream( line );
-        if( !(lineStream >> m) )
-            RuntimeError("Missing matrix height: ",line);
-        if( !(lineStream >> n) )
-            RuntimeError("Missing matrix width: ",line);
-        if( !(lineStream >> numNonzero) )
-            RuntimeError("Missing nonzeros entry: ",line);
-    }
-    else
-    {
-        std::stringstream lineStream( line );
-        if( !(lineStream >> m) )
-            RuntimeError("Missing vector height: ",line);
-        n = 1;
-        if( !(lineStream >> numNonzero) )
-            RuntimeError("Missing nonzeros entry: ",line);
-    }
+    const MarketHeader header = ReadSparseMarketHeader( filename );
 
     // Create a matrix of zeros
     // ========================
-    Zeros( A, m, n );
-
-    // Fill in the local nonzero entries by passively calling QueueUpdate
-    // ==================================================================
-    int i, j;
-    Real realPart, imagPart;
-    T value;
-    const int commSize = mpi::Size(A.Comm());
-    A.Reserve( numNonzero/commSize ); // Assume an even nonzero distribution
-    bool passive = true;
-    for( Int k=0; k<numNonzero; ++k )
-    {
-        if( !std::getline( file, line ) )
-            RuntimeError("Could not get nonzero ",k);
-        std::stringstream lineStream( line );
-        if( !(lineStream >> i) )
-            RuntimeError("Could not extract row coordinate of nonzero ",k);
-        --i; // convert from Fortran to C indexing
-        if( isMatrix )
+    Zeros( A, header.height, header.width );
+
+    // Parse an equal portion of the file on each process
+    // ==================================================
+    const int commSize = mpi::Size( A.Comm() );
+    const int commRank = mpi::Rank( A.Comm() );
+    const std::streamoff dataBytes = header.fileEnd - header.dataBeg;
+    const std::streamoff beg =
+      header.dataBeg + (dataBytes*commRank)/commSize;
+    const std::streamoff end =
+      header.dataBeg + (dataBytes*(commRank+1))/commSize;
+    auto entries = ParseMarketRangeThreaded<T>( filename, header, beg, end );
+    Int numLocalEntries=0, numRemoteEntries=0;
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    for( const auto& threadEntries : entries )
+        for( const auto& entry : threadEntries )
         {
-            if( !(lineStream >> j) )
-                RuntimeError
-                ("Could not extract col coordinate of nonzero ",k);
-            --j;
-        }
-        else
-            j = 0;
-
-        if( isPattern )
-        {
-            A.QueueUpdate( i, j, T(1), passive );
-        }
-        else
-        {
-            if( isComplex )
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                if( !(lineStream >> imagPart) )
-                    RuntimeError
-                    ("Could not extract imag part of entry (",i,",",j,")");
-                SetRealPart( value, realPart );
-                SetImagPart( value, imagPart );
-                A.QueueUpdate( i, j, value, passive );
-            }
+            if( entry.i >= firstLocalRow &&
+                entry.i < firstLocalRow+localHeight )
+                ++numLocalEntries;
             else
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real entry (",i,",",j,")");
-                A.QueueUpdate( i, j, T(realPart), passive );
-            }
+                ++numRemoteEntries;
         }
-    }
-    A.ProcessLocalQueues();
-
-    if( isSymmetric )
-    {
+    const Int numEntries =
+      mpi::AllReduce( numLocalEntries+numRemoteEntries, A.Comm() );
+    if( numEntries != header.numNonzero )
+        RuntimeError
+        ("Expected ",header.numNonzero," nonzeros but found ",numEntries);
+
+    // Send each entry directly to its owner
+    // =====================================
+    SparseBuilder<T> builder( entries.size() );
+    for( Int t=0; t<builder.NumBuffers(); ++t )
+        builder.QueueUpdates( t, std::move(entries[t]) );
+    builder.Finish( A );
+
+    if( header.isSymmetric )
         MakeSymmetric( LOWER, A );
-    }
-    if( isHermitian )
-    {
+    if( header.isHermitian )
         MakeHermitian( LOWER, A );
-    }
-
     // I'm not certain of what the MM standard is for complex skew-symmetry,
     // so I'll default to assuming no conjugation
     const bool conjugateSkew = false;
-    if( isSkewSymmetric )
+    if( header.isSkewSymmetric )
     {
         MakeSymmetric( LOWER, A, conjugateSkew );
         ScaleTrapezoid( T(-1), UPPER, A, 1 );
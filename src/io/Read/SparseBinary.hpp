@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_SPARSE_BINARY_HPP
+#define EL_READ_SPARSE_BINARY_HPP
+
+#include "../SparseBinary.hpp"
+
+namespace El {
+namespace read {
+
+template<typename SparseType>
+inline void
+SymmetrizeSparseBinary( const sparse_binary::Header& header, SparseType& A )
+{
+    DEBUG_CSE
+    if( header.flags & sparse_binary::SYMMETRIC )
+    {
+        const bool conjugate = ( header.flags & sparse_binary::CONJUGATE );
+        MakeSymmetric( LOWER, A, conjugate );
+    }
+}
+
+template<typename T>
+inline void
+SparseBinary( SparseMatrix<T>& A, const string filename )
+{
+    DEBUG_CSE
+    typedef sparse_binary::Index Index;
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    byte headerBuf[sparse_binary::headerBytes];
+    file.read( (char*)headerBuf, sparse_binary::headerBytes );
+    const long long fileBytes = FileSize( file );
+    const auto header =
+      sparse_binary::Unpack( headerBuf, fileBytes, sizeof(T) );
+    const Int height = header.height;
+    const Int numEntries = header.numEntries;
+
+    Zeros( A, height, header.width );
+    A.ForceNumEntries( numEntries );
+    Int* sourceBuf = A.SourceBuffer();
+    Int* targetBuf = A.TargetBuffer();
+    Int* offsetBuf = A.OffsetBuffer();
+
+    // The offsets, column indices, and values are stored contiguously, and
+    // the indices are converted in chunks
+    vector<Index> chunk;
+    file.seekg( sparse_binary::OffsetsPos(0) );
+    for( Int iBeg=0; iBeg<=height; iBeg+=sparse_binary::chunkSize )
+    {
+        const Int num = Min( Int(sparse_binary::chunkSize), height+1-iBeg );
+        chunk.resize( num );
+        file.read( (char*)chunk.data(), num*sizeof(Index) );
+        for( Int k=0; k<num; ++k )
+            offsetBuf[iBeg+k] = chunk[k];
+    }
+    for( Int eBeg=0; eBeg<numEntries; eBeg+=sparse_binary::chunkSize )
+    {
+        const Int num = Min( Int(sparse_binary::chunkSize), numEntries-eBeg );
+        chunk.resize( num );
+        file.read( (char*)chunk.data(), num*sizeof(Index) );
+        for( Int k=0; k<num; ++k )
+            targetBuf[eBeg+k] = chunk[k];
+    }
+    file.read( (char*)A.ValueBuffer(), numEntries*sizeof(T) );
+    if( offsetBuf[0] != 0 || offsetBuf[height] != numEntries )
+        RuntimeError("Inconsistent row offsets in ",filename);
+    for( Int i=0; i<height; ++i )
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+            sourceBuf[e] = i;
+    A.ForceConsistency();
+
+    SymmetrizeSparseBinary( header, A );
+}
+
+// Each process reads the rows which it owns directly from the file using
+// MPI-IO, so that no entries are communicated
+template<typename T>
+inline void
+SparseBinary( DistSparseMatrix<T>& A, const string filename )
+{
+    DEBUG_CSE
+    typedef sparse_binary::Index Index;
+    mpi::File file;
+    file.Open( A.Comm(), filename, false );
+
+    byte headerBuf[sparse_binary::headerBytes];
+    file.ReadAt( 0, headerBuf, sparse_binary::headerBytes );
+    const auto header =
+      sparse_binary::Unpack( headerBuf, file.Size(), sizeof(T) );
+
+    Zeros( A, header.height, header.width );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+
+    // Read the offsets of the local rows (and of the following row)
+    vector<Index> offsets( localHeight+1 );
+    file.ReadAt
+    ( sparse_binary::OffsetsPos(firstLocalRow), (byte*)offsets.data(),
+      (localHeight+1)*sizeof(Index) );
+    const Index entryBeg = offsets[0];
+    const Int numLocalEntries = offsets[localHeight] - entryBeg;
+    if( entryBeg < 0 || numLocalEntries < 0 ||
+        entryBeg+numLocalEntries > header.numEntries )
+        RuntimeError("Inconsistent row offsets in ",filename);
+
+    A.ForceNumLocalEntries( numLocalEntries );
+    Int* sourceBuf = A.SourceBuffer();
+    Int* targetBuf = A.TargetBuffer();
+    T* valueBuf = A.ValueBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( Index e=offsets[iLoc]; e<offsets[iLoc+1]; ++e )
+            sourceBuf[e-entryBeg] = firstLocalRow + iLoc;
+
+    // Read the column indices and values of the local rows in chunks
+    vector<Index> chunk;
+    for( Int eBeg=0; eBeg<numLocalEntries; eBeg+=sparse_binary::chunkSize )
+    {
+        const Int num =
+          Min( Int(sparse_binary::chunkSize), numLocalEntries-eBeg );
+        chunk.resize( num );
+        file.ReadAt
+        ( sparse_binary::IndicesPos(header,entryBeg+eBeg),
+          (byte*)chunk.data(), num*sizeof(Index) );
+        for( Int k=0; k<num; ++k )
+            targetBuf[eBeg+k] = chunk[k];
+        file.ReadAt
+        ( sparse_binary::ValuesPos(header,entryBeg+eBeg),
+          (byte*)&valueBuf[eBeg], num*sizeof(T) );
+    }
+    file.Close();
+    A.ProcessLocalQueues();
+
+    SymmetrizeSparseBinary( header, A );
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_SPARSE_BINARY_HPP
@@ -0,0 +1,99 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_SPARSE_BINARY_HPP
+#define EL_IO_SPARSE_BINARY_HPP
+
+namespace El {
+namespace sparse_binary {
+
+// The layout of the binary (CSR) format for sparse matrices, where every
+// integer is stored as a 64-bit signed integer:
+//
+//   magic ("ElSparse"), version, height, width, numEntries, flags, entrySize
+//   rowOffsets[height+1]
+//   colIndices[numEntries]
+//   values[numEntries]
+//
+// The row offsets are absolute (rowOffsets[0]=0), and the column indices
+// within each row are sorted. If the SYMMETRIC flag is set, only the lower
+// triangle is stored, and the upper triangle is its transpose (or, if the
+// CONJUGATE flag is also set, its adjoint).
+
+typedef long long Index;
+
+const char magic[8] = { 'E', 'l', 'S', 'p', 'a', 'r', 's', 'e' };
+const Index version = 1;
+const Index SYMMETRIC = 1;
+const Index CONJUGATE = 2;
+
+const Index numHeaderIndices = 6;
+const long long headerBytes = sizeof(magic) + numHeaderIndices*sizeof(Index);
+
+// The number of entries which are converted at once
+const Index chunkSize = Index(1) << 20;
+
+struct Header
+{
+    Index height, width, numEntries, flags, entrySize;
+};
+
+inline long long OffsetsPos( Index row )
+{ return headerBytes + row*sizeof(Index); }
+
+inline long long IndicesPos( const Header& header, Index entry )
+{ return OffsetsPos(header.height+1) + entry*sizeof(Index); }
+
+inline long long ValuesPos( const Header& header, Index entry )
+{ return IndicesPos(header,header.numEntries) + entry*header.entrySize; }
+
+inline long long FileBytes( const Header& header )
+{ return ValuesPos(header,header.numEntries); }
+
+inline void Pack( const Header& header, byte* buf )
+{
+    MemCopy( buf, (const byte*)magic, sizeof(magic) );
+    const Index indices[numHeaderIndices] =
+      { version, header.height, header.width, header.numEntries,
+        header.flags, header.entrySize };
+    MemCopy
+    ( buf+sizeof(magic), (const byte*)indices,
+      numHeaderIndices*sizeof(Index) );
+}
+
+inline Header Unpack( const byte* buf, long long fileBytes, Int entrySize )
+{
+    if( std::memcmp( buf, magic, sizeof(magic) ) != 0 )
+        RuntimeError("Not a binary sparse matrix file");
+    Index indices[numHeaderIndices];
+    MemCopy
+    ( (byte*)indices, buf+sizeof(magic), numHeaderIndices*sizeof(Index) );
+    if( indices[0] != version )
+        RuntimeError
+        ("Unsupported binary sparse format version: ",indices[0]);
+    Header header;
+    header.height = indices[1];
+    header.width = indices[2];
+    header.numEntries = indices[3];
+    header.flags = indices[4];
+    header.entrySize = indices[5];
+    if( header.entrySize != entrySize )
+        RuntimeError
+        ("Expected entries of ",entrySize," bytes but found ",
+         header.entrySize);
+    if( FileBytes(header) != fileBytes )
+        RuntimeError
+        ("Expected file to be ",FileBytes(header)," bytes but found ",
+         fileBytes);
+    return header;
+}
+
+} // namespace sparse_binary
+} // namespace El
+
+#endif // ifndef EL_IO_SPARSE_BINARY_HPP
@@ -2,12 +2,13 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
 #include "El/io/SpyWindow.hpp"
+#include "./Downsample.hpp"
 
 #ifdef EL_HAVE_QT5
 # include <QApplication>
@@ -15,6 +16,55 @@
 
 namespace El {
 
+#ifdef EL_HAVE_QT5
+namespace {
+
+bool Downsampled( Int m, Int n )
+{ return m > MaxRenderSize() || n > MaxRenderSize(); }
+
+// Show each pixel of a density tile on the fixed scale [0,1]
+void SpyDensity( const Matrix<double>& tile, string title )
+{
+    DEBUG_CSE
+    QString qTitle = QString::fromStdString( title );
+    DisplayWindow* displayWindow = new DisplayWindow;
+    displayWindow->Display( new Matrix<double>(tile), 0., 1., qTitle );
+    displayWindow->show();
+
+    // Spend at most 200 milliseconds rendering
+    ProcessEvents( 200 );
+}
+
+// Reduce the density tile one slab of pixel columns at a time and redraw
+// after each slab arrives
+template<typename DistType,typename Real>
+void SpyProgressive( const DistType& A, string title, Real tol )
+{
+    DEBUG_CSE
+    DisplayWindow* displayWindow = nullptr;
+    QString qTitle = QString::fromStdString( title );
+    if( downsample::OwnsTile(A) )
+    {
+        displayWindow = new DisplayWindow;
+        displayWindow->setWindowTitle( qTitle );
+        displayWindow->show();
+    }
+    auto update = [&]( const Matrix<double>& tile, Int numReduced )
+    {
+        displayWindow->Display
+        ( downsample::ReducedPrefix(tile,numReduced), 0., 1., qTitle );
+        // Spend at most 200 milliseconds rendering each slab
+        ProcessEvents( 200 );
+    };
+    Matrix<double> tile;
+    downsample::Progressive
+    ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_DENSITY, tol,
+      downsample::numRenderSlabs, update );
+}
+
+} // anonymous namespace
+#endif // ifdef EL_HAVE_QT5
+
 template<typename T>
 void Spy( const Matrix<T>& A, string title, Base<T> tol )
 {
@@ -25,6 +75,15 @@ void Spy( const Matrix<T>& A, string title, Base<T> tol )
 
     const Int m = A.Height();
     const Int n = A.Width();
+    if( Downsampled( m, n ) )
+    {
+        Matrix<double> tile;
+        Downsample
+        ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_DENSITY, tol );
+        SpyDensity( tile, title );
+        return;
+    }
+
     Matrix<Int>* ASpy = new Matrix<Int>( m, n );
     for( Int j=0; j<n; ++j )
         for( Int i=0; i<m; ++i )
@@ -54,6 +113,10 @@ void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Spy( A.LockedMatrix(), title, tol );
     }
+    else if( Downsampled( A.Height(), A.Width() ) )
+    {
+        SpyProgressive( A, title, tol );
+    }
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
@@ -65,10 +128,44 @@ void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
 #endif // ifdef EL_HAVE_QT5
 }
 
+template<typename T>
+void Spy( const SparseMatrix<T>& A, string title, Base<T> tol )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_QT5
+    if( GuiDisabled() )
+        LogicError("GUI was disabled");
+
+    Matrix<double> tile;
+    Downsample
+    ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_DENSITY, tol );
+    SpyDensity( tile, title );
+#else
+    LogicError("Qt5 not available");
+#endif // ifdef EL_HAVE_QT5
+}
+
+template<typename T>
+void Spy( const DistSparseMatrix<T>& A, string title, Base<T> tol )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_QT5
+    if( GuiDisabled() )
+        LogicError("GUI was disabled");
+    SpyProgressive( A, title, tol );
+#else
+    LogicError("Qt5 not available");
+#endif // ifdef EL_HAVE_QT5
+}
+
 #define PROTO(T) \
   template void Spy ( const Matrix<T>& A, string title, Base<T> tol ); \
   template void Spy \
-  ( const AbstractDistMatrix<T>& A, string title, Base<T> tol );
+  ( const AbstractDistMatrix<T>& A, string title, Base<T> tol ); \
+  template void Spy \
+  ( const SparseMatrix<T>& A, string title, Base<T> tol ); \
+  template void Spy \
+  ( const DistSparseMatrix<T>& A, string title, Base<T> tol );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -14,9 +14,24 @@
 #include "./Write/BinaryFlat.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
+#include "./Write/SparseBinary.hpp"
+#include "./Downsample.hpp"
 
 namespace El {
 
+namespace {
+
+bool IsImageFormat( FileFormat format )
+{
+    return format == BMP || format == JPG || format == JPEG ||
+           format == PNG || format == PPM || format == XBM || format == XPM;
+}
+
+bool Downsampled( Int m, Int n )
+{ return m > MaxRenderSize() || n > MaxRenderSize(); }
+
+} // anonymous namespace
+
 template<typename T>
 void Write
 ( const Matrix<T>& A, 
@@ -37,7 +52,16 @@ void Write
     case PPM:
     case XBM:
     case XPM:
-        write::Image( A, basename, format ); break;
+        if( Downsampled( A.Height(), A.Width() ) )
+        {
+            Matrix<double> tile;
+            Downsample
+            ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_MAX_ABS );
+            write::Image( tile, basename, format );
+        }
+        else
+            write::Image( A, basename, format );
+        break;
     default:
         LogicError("Invalid file format");
     }
@@ -54,6 +78,22 @@ void Write
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
     }
+    else if( format == BINARY )
+    {
+        write::Binary( A, basename );
+    }
+    else if( format == BINARY_FLAT )
+    {
+        write::BinaryFlat( A, basename );
+    }
+    else if( IsImageFormat(format) && Downsampled(A.Height(),A.Width()) )
+    {
+        Matrix<double> tile;
+        Downsample
+        ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_MAX_ABS );
+        if( downsample::OwnsTile(A) )
+            write::Image( tile, basename, format );
+    }
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
@@ -62,13 +102,70 @@ void Write
     }
 }
 
+template<typename T>
+void Write
+( const SparseMatrix<T>& A, string basename, FileFormat format, string title )
+{
+    DEBUG_CSE
+    if( !IsImageFormat(format) )
+        LogicError("Sparse matrices may only be written as images");
+    Matrix<double> tile;
+    Downsample
+    ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_MAX_ABS );
+    write::Image( tile, basename, format );
+}
+
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A,
+  string basename, FileFormat format, string title )
+{
+    DEBUG_CSE
+    if( !IsImageFormat(format) )
+        LogicError("Sparse matrices may only be written as images");
+    Matrix<double> tile;
+    Downsample
+    ( A, tile, MaxRenderSize(), MaxRenderSize(), DOWNSAMPLE_MAX_ABS );
+    if( downsample::OwnsTile(A) )
+        write::Image( tile, basename, format );
+}
+
+template<typename T>
+void WriteSparseBinary
+( const SparseMatrix<T>& A, string basename, bool symmetric, bool conjugate )
+{
+    DEBUG_CSE
+    write::SparseBinary( A, basename, symmetric, conjugate );
+}
+
+template<typename T>
+void WriteSparseBinary
+( const DistSparseMatrix<T>& A, string basename,
+  bool symmetric, bool conjugate )
+{
+    DEBUG_CSE
+    write::SparseBinary( A, basename, symmetric, conjugate );
+}
+
 #define PROTO(T) \
   template void Write \
   ( const Matrix<T>& A, \
     string basename, FileFormat format, string title ); \
   template void Write \
   ( const AbstractDistMatrix<T>& A, \
-    string basename, FileFormat format, string title );
+    string basename, FileFormat format, string title ); \
+  template void Write \
+  ( const SparseMatrix<T>& A, \
+    string basename, FileFormat format, string title ); \
+  template void Write \
+  ( const DistSparseMatrix<T>& A, \
+    string basename, FileFormat format, string title ); \
+  template void WriteSparseBinary \
+  ( const SparseMatrix<T>& A, string basename, \
+    bool symmetric, bool conjugate ); \
+  template void WriteSparseBinary \
+  ( const DistSparseMatrix<T>& A, string basename, \
+    bool symmetric, bool conjugate );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -35,6 +35,55 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Collectively write the entries of A in column-major order, beginning at
+// byte 'offset' of the file, with each process writing its own local
+// entries through a view of the file which matches the distribution of A
+// (only one member of each team of redundant owners writes)
+template<typename T>
+inline void
+DistEntries
+( mpi::File& file, long long offset, const AbstractDistMatrix<T>& A )
+{
+    DEBUG_CSE
+    vector<Int> rows, cols;
+    if( A.Participating() && A.RedundantRank() == 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        rows.resize( localHeight );
+        cols.resize( localWidth );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            rows[iLoc] = A.GlobalRow(iLoc);
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            cols[jLoc] = A.GlobalCol(jLoc);
+    }
+    file.WriteAll
+    ( offset, sizeof(T), A.Height(), rows, cols,
+      (const byte*)A.LockedBuffer(), A.LDim() );
+}
+
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    file.Open( comm, filename, true );
+
+    const long long metaBytes = 2*sizeof(Int);
+    const long long dataBytes = (long long)(A.Height())*A.Width()*sizeof(T);
+    file.SetSize( metaBytes + dataBytes );
+    if( mpi::Rank(comm) == 0 )
+    {
+        Int dims[2] = { A.Height(), A.Width() };
+        file.WriteAt( 0, (const byte*)dims, 2*sizeof(Int) );
+    }
+    DistEntries( file, metaBytes, A );
+    file.Close();
+}
+
 } // namespace write
 } // namespace El
 
@@ -30,6 +30,19 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::File file;
+    file.Open( A.Grid().ViewingComm(), filename, true );
+    file.SetSize( (long long)(A.Height())*A.Width()*sizeof(T) );
+    DistEntries( file, 0, A );
+    file.Close();
+}
+
 } // namespace write
 } // namespace El
 
@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_SPARSE_BINARY_HPP
+#define EL_WRITE_SPARSE_BINARY_HPP
+
+#include "../SparseBinary.hpp"
+
+namespace El {
+namespace write {
+
+// Pack the column indices and values of the given (stored) entries of the
+// consecutive rows [0,numRows), along with the number of stored entries in
+// each row, where only the lower triangle is kept if 'symmetric' is true
+template<typename T>
+inline void
+PackSparseBinaryRows
+( Int numRows, Int firstRow,
+  const Int* offsetBuf, const Int* targetBuf, const T* valueBuf,
+  bool symmetric,
+  vector<sparse_binary::Index>& rowCounts,
+  vector<sparse_binary::Index>& colIndices,
+  vector<T>& values )
+{
+    DEBUG_CSE
+    rowCounts.resize( numRows );
+    colIndices.clear();
+    values.clear();
+    colIndices.reserve( offsetBuf[numRows]-offsetBuf[0] );
+    values.reserve( offsetBuf[numRows]-offsetBuf[0] );
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        const Int i = firstRow + iLoc;
+        Int count = 0;
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+        {
+            if( symmetric && targetBuf[e] > i )
+                continue;
+            colIndices.push_back( targetBuf[e] );
+            values.push_back( valueBuf[e] );
+            ++count;
+        }
+        rowCounts[iLoc] = count;
+    }
+}
+
+template<typename T>
+inline void
+SparseBinary
+( const SparseMatrix<T>& A, string basename, bool symmetric, bool conjugate )
+{
+    DEBUG_CSE
+    typedef sparse_binary::Index Index;
+    string filename = basename + "." + FileExtension(BINARY);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    A.AssertConsistent();
+
+    const Int height = A.Height();
+    vector<Index> rowCounts, colIndices;
+    vector<T> values;
+    PackSparseBinaryRows
+    ( height, 0, A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      A.LockedValueBuffer(), symmetric, rowCounts, colIndices, values );
+
+    sparse_binary::Header header;
+    header.height = height;
+    header.width = A.Width();
+    header.numEntries = colIndices.size();
+    header.flags = 0;
+    if( symmetric )
+        header.flags |= sparse_binary::SYMMETRIC;
+    if( symmetric && conjugate )
+        header.flags |= sparse_binary::CONJUGATE;
+    header.entrySize = sizeof(T);
+    byte headerBuf[sparse_binary::headerBytes];
+    sparse_binary::Pack( header, headerBuf );
+    file.write( (char*)headerBuf, sparse_binary::headerBytes );
+
+    // Convert the counts into offsets in place
+    Index offset = 0;
+    file.write( (char*)&offset, sizeof(Index) );
+    for( Int i=0; i<height; ++i )
+    {
+        offset += rowCounts[i];
+        rowCounts[i] = offset;
+    }
+    file.write( (char*)rowCounts.data(), height*sizeof(Index) );
+    file.write
+    ( (char*)colIndices.data(), header.numEntries*sizeof(Index) );
+    file.write( (char*)values.data(), header.numEntries*sizeof(T) );
+}
+
+// Each process writes the rows which it owns directly to the file using
+// MPI-IO after an exclusive scan over the numbers of local entries
+template<typename T>
+inline void
+SparseBinary
+( const DistSparseMatrix<T>& A, string basename,
+  bool symmetric, bool conjugate )
+{
+    DEBUG_CSE
+    typedef sparse_binary::Index Index;
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Comm();
+    A.AssertLocallyConsistent();
+
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    vector<Index> rowCounts, colIndices;
+    vector<T> values;
+    PackSparseBinaryRows
+    ( localHeight, firstLocalRow, A.LockedOffsetBuffer(),
+      A.LockedTargetBuffer(), A.LockedValueBuffer(), symmetric,
+      rowCounts, colIndices, values );
+    const Index numLocalEntries = colIndices.size();
+    const Index entryBeg =
+      mpi::Scan( numLocalEntries, comm ) - numLocalEntries;
+
+    sparse_binary::Header header;
+    header.height = A.Height();
+    header.width = A.Width();
+    header.numEntries = mpi::AllReduce( numLocalEntries, comm );
+    header.flags = 0;
+    if( symmetric )
+        header.flags |= sparse_binary::SYMMETRIC;
+    if( symmetric && conjugate )
+        header.flags |= sparse_binary::CONJUGATE;
+    header.entrySize = sizeof(T);
+
+    mpi::File file;
+    file.Open( comm, filename, true );
+    file.SetSize( sparse_binary::FileBytes(header) );
+    if( mpi::Rank(comm) == 0 )
+    {
+        byte headerBuf[sparse_binary::headerBytes];
+        sparse_binary::Pack( header, headerBuf );
+        file.WriteAt( 0, headerBuf, sparse_binary::headerBytes );
+        const Index offset = 0;
+        file.WriteAt
+        ( sparse_binary::OffsetsPos(0), (const byte*)&offset, sizeof(Index) );
+    }
+
+    // Each process writes the offsets which end its rows
+    Index offset = entryBeg;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        offset += rowCounts[iLoc];
+        rowCounts[iLoc] = offset;
+    }
+    for( Int iBeg=0; iBeg<localHeight; iBeg+=sparse_binary::chunkSize )
+    {
+        const Int num = Min( Int(sparse_binary::chunkSize), localHeight-iBeg );
+        file.WriteAt
+        ( sparse_binary::OffsetsPos(firstLocalRow+iBeg+1),
+          (const byte*)&rowCounts[iBeg], num*sizeof(Index) );
+    }
+    for( Index eBeg=0; eBeg<numLocalEntries; eBeg+=sparse_binary::chunkSize )
+    {
+        const Int num = Min( sparse_binary::chunkSize, numLocalEntries-eBeg );
+        file.WriteAt
+        ( sparse_binary::IndicesPos(header,entryBeg+eBeg),
+          (const byte*)&colIndices[eBeg], num*sizeof(Index) );
+        file.WriteAt
+        ( sparse_binary::ValuesPos(header,entryBeg+eBeg),
+          (const byte*)&values[eBeg], num*sizeof(T) );
+    }
+    file.Close();
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_SPARSE_BINARY_HPP
@@ -8,9 +8,11 @@
 */
 #include <El.hpp>
 
-#include "./Bidiag/Apply.hpp"
 #include "./Bidiag/L.hpp"
 #include "./Bidiag/U.hpp"
+#include "./Bidiag/TwoStage.hpp"
+
+#include "./Bidiag/Apply.hpp"
 
 namespace El {
 
@@ -40,6 +42,37 @@ void Bidiag
         bidiag::L( A, householderScalarsP, householderScalarsQ );
 }
 
+template<typename F> 
+void Bidiag
+( AbstractDistMatrix<F>& APre, 
+  AbstractDistMatrix<F>& householderScalarsPPre,
+  AbstractDistMatrix<F>& householderScalarsQPre,
+  bidiag::BulgeReflectors<F>& bulgeReflectors,
+  const BidiagCtrl& ctrl )
+{
+    DEBUG_CSE
+    // TODO: Support wide matrices in the two-stage reduction rather
+    // than falling back to the one-stage approach
+    if( ctrl.twoStage && APre.Height() >= APre.Width() )
+    {
+        DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+        DistMatrixWriteProxy<F,F,STAR,STAR>
+          householderScalarsPProx( householderScalarsPPre ),
+          householderScalarsQProx( householderScalarsQPre );
+        auto& A = AProx.Get();
+        auto& householderScalarsP = householderScalarsPProx.Get();
+        auto& householderScalarsQ = householderScalarsQProx.Get();
+        bidiag::UTwoStage
+        ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+          ctrl.bandwidth );
+    }
+    else
+    {
+        bulgeReflectors = bidiag::BulgeReflectors<F>();
+        Bidiag( APre, householderScalarsPPre, householderScalarsQPre );
+    }
+}
+
 namespace bidiag {
 
 template<typename F>
@@ -176,6 +209,12 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalarsP, \
     AbstractDistMatrix<F>& householderScalarsQ ); \
+  template void Bidiag \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalarsP, \
+    AbstractDistMatrix<F>& householderScalarsQ, \
+    bidiag::BulgeReflectors<F>& bulgeReflectors, \
+    const BidiagCtrl& ctrl ); \
   template void bidiag::Explicit \
   ( Matrix<F>& A, \
     Matrix<F>& P, \
@@ -205,6 +244,18 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
   ( LeftOrRight side, Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::ApplyQ \
+  ( LeftOrRight side, Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const bidiag::BulgeReflectors<F>& bulgeReflectors, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::ApplyP \
+  ( LeftOrRight side, Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const bidiag::BulgeReflectors<F>& bulgeReflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
@@ -84,6 +84,92 @@ void ApplyP
       A, householderScalars, B );
 }
 
+// Apply Q = Q1 Q2, where Q1 is the product of the packed reflectors from the
+// reduction to band form and Q2 is the product of the bulge reflectors
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    DEBUG_CSE
+    const Int bandwidth = bulgeReflectors.bandwidth;
+    if( bandwidth == 1 )
+    {
+        ApplyQ( side, orientation, A, householderScalars, B );
+        return;
+    }
+    DEBUG_ONLY(
+      if( A.Height() < A.Width() )
+          LogicError("The two-stage reduction requires a tall matrix");
+    )
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+
+    // Q B = Q1 (Q2 B) and B Q^H = (B Q2^H) Q1^H, whereas
+    // Q^H B = Q2^H (Q1^H B) and B Q = (B Q1) Q2
+    const bool bulgesFirst = (normal==onLeft);
+    if( bulgesFirst )
+        ApplyBulgeReflectors
+        ( side, orientation, conjugation,
+          bulgeReflectors.reflectorsQ, bulgeReflectors.householderScalarsQ,
+          bulgeReflectors.offsetsQ, bulgeReflectors.lengthsQ, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, 0,
+      A, householderScalars, B );
+    if( !bulgesFirst )
+        ApplyBulgeReflectors
+        ( side, orientation, conjugation,
+          bulgeReflectors.reflectorsQ, bulgeReflectors.householderScalarsQ,
+          bulgeReflectors.offsetsQ, bulgeReflectors.lengthsQ, B );
+}
+
+// Apply P = P1 P2, where P1 is the product of the packed reflectors from the
+// reduction to band form and P2 is the product of the bulge reflectors
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    DEBUG_CSE
+    const Int bandwidth = bulgeReflectors.bandwidth;
+    if( bandwidth == 1 )
+    {
+        ApplyP( side, orientation, A, householderScalars, B );
+        return;
+    }
+    DEBUG_ONLY(
+      if( A.Height() < A.Width() )
+          LogicError("The two-stage reduction requires a tall matrix");
+    )
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? UNCONJUGATED : CONJUGATED );
+
+    const bool bulgesFirst = (normal==onLeft);
+    if( bulgesFirst )
+        ApplyBulgeReflectors
+        ( side, orientation, conjugation,
+          bulgeReflectors.reflectorsP, bulgeReflectors.householderScalarsP,
+          bulgeReflectors.offsetsP, bulgeReflectors.lengthsP, B );
+    ApplyPackedReflectors
+    ( side, UPPER, HORIZONTAL, direction, conjugation, bandwidth,
+      A, householderScalars, B );
+    if( !bulgesFirst )
+        ApplyBulgeReflectors
+        ( side, orientation, conjugation,
+          bulgeReflectors.reflectorsP, bulgeReflectors.householderScalarsP,
+          bulgeReflectors.offsetsP, bulgeReflectors.lengthsP, B );
+}
+
 } // namespace bidiag
 } // namespace El
 
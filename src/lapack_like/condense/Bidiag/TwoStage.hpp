@@ -0,0 +1,496 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_TWOSTAGE_HPP
+#define EL_BIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace bidiag {
+
+// The two-stage reduction of a matrix which is at least as tall as it is wide
+// to real upper bidiagonal form. The first stage reduces A to an upper band
+// matrix by alternating between the Householder QR factorization of a column
+// panel and the Householder LQ factorization of the corresponding row panel,
+// so that, unlike the one-stage approach, the trailing updates are entirely
+// composed of matrix-matrix products. The second stage redundantly chases
+// the bulges of the (small) band matrix down to bidiagonal form.
+
+// Reduce A to an upper band matrix, storing the Householder vectors for Q
+// below the main diagonal and those for P above the bandwidth'th superdiagonal
+template<typename F>
+void UBand
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalarsP,
+  DistMatrix<F,STAR,STAR>& householderScalarsQ,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    DEBUG_ONLY(
+      if( m < n )
+          LogicError("A must be at least as tall as it is wide");
+    )
+    const Int b = bandwidth;
+    const Grid& g = A.Grid();
+    householderScalarsP.Resize( Max(n-b,0), 1 );
+    householderScalarsQ.Resize( n, 1 );
+
+    DistMatrix<F> V(g), Z(g);
+    DistMatrix<F,MC,  STAR> aB1_MC_STAR(g), w21_MC_STAR(g),
+                            V_MC_STAR(g), W_MC_STAR(g);
+    DistMatrix<F,MR,  STAR> z21_MR_STAR(g);
+    DistMatrix<F,STAR,MR  > a12_STAR_MR(g), X_STAR_MR(g), Z_STAR_MR(g);
+    DistMatrix<F,STAR,STAR> SInv_STAR_STAR(g);
+
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int nb = Min(b,n-k);
+        const Range<Int> indPan( k, k+nb ), indTrail( k+nb, n ),
+                         indBot( k, m ), indBelow( k+nb, m );
+
+        auto AB1 = A( indBot,   indPan   );
+        auto AB2 = A( indBot,   indTrail );
+        auto A12 = A( indPan,   indTrail );
+        auto A22 = A( indBelow, indTrail );
+
+        // Compute the (unnormalized) Householder QR factorization of the
+        // column panel
+        for( Int j=0; j<nb; ++j )
+        {
+            const Range<Int> ind1( j ), indB( j, END ), indR( j+1, END );
+
+            auto alpha11 = AB1( ind1, ind1 );
+            auto a21     = AB1( indR, ind1 );
+            auto aB1     = AB1( indB, ind1 );
+            auto AB2Pan  = AB1( indB, indR );
+
+            const F tau = LeftReflector( alpha11, a21 );
+            householderScalarsQ.Set( k+j, 0, tau );
+
+            F alpha = 0;
+            if( alpha11.IsLocal(0,0) )
+            {
+                alpha = alpha11.GetLocal(0,0);
+                alpha11.SetLocal(0,0,F(1));
+            }
+
+            // AB2Pan := (I - tau aB1 aB1^H) AB2Pan
+            aB1_MC_STAR.AlignWith( AB2Pan );
+            aB1_MC_STAR = aB1;
+            z21_MR_STAR.AlignWith( AB2Pan );
+            Zeros( z21_MR_STAR, AB2Pan.Width(), 1 );
+            LocalGemv
+            ( ADJOINT, F(1), AB2Pan, aB1_MC_STAR, F(0), z21_MR_STAR );
+            El::AllReduce( z21_MR_STAR, AB2Pan.ColComm() );
+            Ger
+            ( -tau, aB1_MC_STAR.LockedMatrix(), z21_MR_STAR.LockedMatrix(),
+              AB2Pan.Matrix() );
+
+            if( alpha11.IsLocal(0,0) )
+                alpha11.SetLocal(0,0,alpha);
+        }
+        if( k+nb == n )
+            break;
+
+        // Form the explicit matrix of Householder vectors, V, as well as
+        // SInv such that the product of the reflectors is
+        // H = I - V inv(SInv) V^H
+        V = AB1;
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        V_MC_STAR.AlignWith( AB2 );
+        V_MC_STAR = V;
+        Zeros( SInv_STAR_STAR, nb, nb );
+        Herk
+        ( LOWER, ADJOINT,
+          Base<F>(1), V_MC_STAR.LockedMatrix(),
+          Base<F>(0), SInv_STAR_STAR.Matrix() );
+        El::AllReduce( SInv_STAR_STAR, V_MC_STAR.ColComm() );
+        for( Int j=0; j<nb; ++j )
+            SInv_STAR_STAR.SetLocal
+            ( j, j, F(1)/householderScalarsQ.GetLocal(k+j,0) );
+
+        // AB2 := H AB2 = AB2 - V inv(SInv) (V^H AB2)
+        X_STAR_MR.AlignWith( AB2 );
+        Zeros( X_STAR_MR, nb, AB2.Width() );
+        LocalGemm( ADJOINT, NORMAL, F(1), V_MC_STAR, AB2, F(0), X_STAR_MR );
+        El::AllReduce( X_STAR_MR, AB2.ColComm() );
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, X_STAR_MR );
+        LocalGemm( NORMAL, NORMAL, F(-1), V_MC_STAR, X_STAR_MR, F(1), AB2 );
+
+        // Compute the (unnormalized) Householder LQ factorization of the
+        // row panel
+        const Int numRowReflectors = Min(nb,n-(k+nb));
+        for( Int j=0; j<numRowReflectors; ++j )
+        {
+            const Range<Int> ind1( j ), indR( j+1, END ), indB( j+1, END ),
+                             indRow( j, END );
+
+            auto alpha11 = A12( ind1, ind1   );
+            auto a12R    = A12( ind1, indR   );
+            auto a12     = A12( ind1, indRow );
+            auto A22Pan  = A12( indB, indRow );
+
+            const F tau = RightReflector( alpha11, a12R );
+            householderScalarsP.Set( k+j, 0, tau );
+
+            F alpha = 0;
+            if( alpha11.IsLocal(0,0) )
+            {
+                alpha = alpha11.GetLocal(0,0);
+                alpha11.SetLocal(0,0,F(1));
+            }
+
+            // A22Pan := A22Pan (I - tau a12^T conj(a12))
+            a12_STAR_MR.AlignWith( A22Pan );
+            a12_STAR_MR = a12;
+            w21_MC_STAR.AlignWith( A22Pan );
+            Zeros( w21_MC_STAR, A22Pan.Height(), 1 );
+            LocalGemv( NORMAL, F(1), A22Pan, a12_STAR_MR, F(0), w21_MC_STAR );
+            El::AllReduce( w21_MC_STAR, A22Pan.RowComm() );
+            LocalGer( -tau, w21_MC_STAR, a12_STAR_MR, A22Pan );
+
+            if( alpha11.IsLocal(0,0) )
+                alpha11.SetLocal(0,0,alpha);
+        }
+
+        // Form the conjugate of the explicit (row) Householder vectors, Z,
+        // as well as SInv such that the product of the reflectors is
+        // G = I - Z^H inv(SInv) Z
+        Z = A12( IR(0,numRowReflectors), ALL );
+        MakeTrapezoidal( UPPER, Z );
+        FillDiagonal( Z, F(1) );
+        Conjugate( Z );
+        Z_STAR_MR.AlignWith( A22 );
+        Z_STAR_MR = Z;
+        Zeros( SInv_STAR_STAR, numRowReflectors, numRowReflectors );
+        Herk
+        ( UPPER, NORMAL,
+          Base<F>(1), Z_STAR_MR.LockedMatrix(),
+          Base<F>(0), SInv_STAR_STAR.Matrix() );
+        El::AllReduce( SInv_STAR_STAR, Z_STAR_MR.RowComm() );
+        for( Int j=0; j<numRowReflectors; ++j )
+            SInv_STAR_STAR.SetLocal
+            ( j, j, F(1)/householderScalarsP.GetLocal(k+j,0) );
+
+        // A22 := A22 G = A22 - (A22 Z^H) inv(SInv) Z
+        W_MC_STAR.AlignWith( A22 );
+        Zeros( W_MC_STAR, A22.Height(), numRowReflectors );
+        LocalGemm( NORMAL, ADJOINT, F(1), A22, Z_STAR_MR, F(0), W_MC_STAR );
+        El::AllReduce( W_MC_STAR, A22.RowComm() );
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, W_MC_STAR );
+        LocalGemm( NORMAL, NORMAL, F(-1), W_MC_STAR, Z_STAR_MR, F(1), A22 );
+    }
+}
+
+// Each sweep eliminates a row with a reflector which, when applied from the
+// right, introduces a bulge below the diagonal; the first column of the bulge
+// is then eliminated by a reflector which, when applied from the left,
+// introduces a bulge above the band. Only the first row of each such bulge
+// is eliminated (introducing the next bulge below the diagonal), as the
+// remainder is annihilated by subsequent sweeps. Each sweep thus generates
+// the same number of reflectors from the left as from the right.
+inline Int NumBulgeReflectors( Int n, Int bandwidth )
+{
+    Int numReflectors = 0;
+    for( Int j=0; j<n-1; ++j )
+    {
+        ++numReflectors;
+        Int s0 = Min(j+bandwidth,n-1) + 1;
+        while( s0 < n-1 )
+        {
+            ++numReflectors;
+            s0 = Min(s0+bandwidth-1,n-1) + 1;
+        }
+    }
+    return numReflectors;
+}
+
+// Chase the bulges of an upper band matrix down to bidiagonal form. Since
+// the bulges extend the band to at most 2b-1 superdiagonals and b-1
+// subdiagonals, entry (i,j), for j-(2b-1) <= i <= j+(b-1), is stored in
+// band[i+j*ldim], where ldim=3b-2, so that each portion of the band may be
+// treated as a column-major matrix with leading dimension ldim.
+template<typename F>
+void ChaseBulges
+( Int n, Int bandwidth, F* band,
+  Matrix<Base<F>>& d,
+  Matrix<Base<F>>& e,
+  BulgeReflectors<F>& bulgeReflectors )
+{
+    DEBUG_CSE
+    const Int b = bandwidth;
+    const Int ldim = 3*b-2;
+    const Int numReflectors = NumBulgeReflectors( n, b );
+    bulgeReflectors.bandwidth = b;
+    Zeros( bulgeReflectors.reflectorsQ, b, numReflectors );
+    bulgeReflectors.householderScalarsQ.Resize( numReflectors, 1 );
+    bulgeReflectors.offsetsQ.Resize( numReflectors, 1 );
+    bulgeReflectors.lengthsQ.Resize( numReflectors, 1 );
+    Zeros( bulgeReflectors.reflectorsP, b, numReflectors );
+    bulgeReflectors.householderScalarsP.Resize( numReflectors, 1 );
+    bulgeReflectors.offsetsP.Resize( numReflectors, 1 );
+    bulgeReflectors.lengthsP.Resize( numReflectors, 1 );
+
+    vector<F> z(2*b);
+    Int numLeft=0, numRight=0;
+
+    // Eliminate entries c0+1:c1 of the given row and apply the reflector
+    // from the right to the rows below it (introducing a bulge below the
+    // diagonal)
+    auto reflectRight = [&]( Int row, Int c0, Int c1 )
+    {
+        const Int length = c1-c0+1;
+        F* x = &band[row+c0*ldim];
+        F* v = bulgeReflectors.reflectorsP.Buffer(0,numRight);
+
+        // Find tau and v such that
+        //  |chi x| (I - tau v v^H) = |beta 0|
+        F chi = x[0];
+        const F tau = lapack::Reflector( length, chi, &x[ldim], ldim );
+        v[0] = F(1);
+        for( Int i=1; i<length; ++i )
+        {
+            v[i] = Conj(x[i*ldim]);
+            x[i*ldim] = 0;
+        }
+        x[0] = chi;
+        bulgeReflectors.householderScalarsP(numRight) = tau;
+        bulgeReflectors.offsetsP(numRight) = c0;
+        bulgeReflectors.lengthsP(numRight) = length;
+        ++numRight;
+
+        const Int numBelow = c1-row;
+        if( numBelow > 0 )
+        {
+            F* ABelow = &band[(row+1)+c0*ldim];
+            blas::Gemv
+            ( 'N', numBelow, length,
+              F(1), ABelow, ldim, v, 1, F(0), z.data(), 1 );
+            blas::Ger
+            ( numBelow, length, -tau, z.data(), 1, v, 1, ABelow, ldim );
+        }
+    };
+
+    // Eliminate entries r0+1:r1 of the given column and apply the reflector
+    // from the left to the columns to its right (introducing a bulge above
+    // the band)
+    auto reflectLeft = [&]( Int col, Int r0, Int r1 )
+    {
+        const Int length = r1-r0+1;
+        F* x = &band[r0+col*ldim];
+        F* v = bulgeReflectors.reflectorsQ.Buffer(0,numLeft);
+
+        // Find tau and v such that
+        //  (I - tau v v^H) |chi| = |beta|
+        //                  |x  |   |0   |
+        F chi = x[0];
+        const F tau = lapack::Reflector( length, chi, &x[1], 1 );
+        v[0] = F(1);
+        for( Int i=1; i<length; ++i )
+        {
+            v[i] = x[i];
+            x[i] = 0;
+        }
+        x[0] = chi;
+        bulgeReflectors.householderScalarsQ(numLeft) = tau;
+        bulgeReflectors.offsetsQ(numLeft) = r0;
+        bulgeReflectors.lengthsQ(numLeft) = length;
+        ++numLeft;
+
+        const Int numCols = Min(r1+b,n-1)-col;
+        if( numCols > 0 )
+        {
+            F* ARight = &band[r0+(col+1)*ldim];
+            blas::Gemv
+            ( 'C', length, numCols,
+              F(1), ARight, ldim, v, 1, F(0), z.data(), 1 );
+            blas::Ger
+            ( length, numCols, -tau, v, 1, z.data(), 1, ARight, ldim );
+        }
+    };
+
+    for( Int j=0; j<n-1; ++j )
+    {
+        // The first pair of reflectors are applied even if they are trivial
+        // so that the resulting bidiagonal entries are real
+        const Int c1 = Min(j+b,n-1);
+        reflectRight( j, j+1, c1 );
+        reflectLeft( j+1, j+1, c1 );
+
+        Int row = j+1;
+        Int s0 = c1+1;
+        while( s0 < n-1 )
+        {
+            const Int s1 = Min(s0+b-1,n-1);
+            reflectRight( row, s0, s1 );
+            reflectLeft( s0, s0, s1 );
+            row = s0;
+            s0 = s1+1;
+        }
+    }
+    DEBUG_ONLY(
+      if( numLeft != numReflectors || numRight != numReflectors )
+          LogicError("Miscounted the number of bulge reflectors");
+    )
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,0), 1 );
+    for( Int j=0; j<n; ++j )
+        d(j) = RealPart(band[j+j*ldim]);
+    for( Int j=0; j<n-1; ++j )
+        e(j) = RealPart(band[j+(j+1)*ldim]);
+}
+
+template<typename F>
+void UTwoStage
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalarsP,
+  DistMatrix<F,STAR,STAR>& householderScalarsQ,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    const Int b = Max(Min(bandwidth,n-1),1);
+
+    UBand( A, householderScalarsP, householderScalarsQ, b );
+    if( b == 1 )
+    {
+        // The band reduction was a (one-stage) bidiagonalization
+        bulgeReflectors = BulgeReflectors<F>();
+        return;
+    }
+
+    // Redundantly gather the band (with b superdiagonals) into storage with
+    // room for the bulges
+    const Int ldim = 3*b-2;
+    vector<F> band(n*(ldim+1),F(0));
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(Max(j-b,0));
+        const Int iLocEnd = A.LocalRowOffset(j+1);
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            band[A.GlobalRow(iLoc)+j*ldim] = A.GetLocal(iLoc,jLoc);
+    }
+    mpi::AllReduce( band.data(), band.size(), A.DistComm() );
+
+    Matrix<Real> d, e;
+    ChaseBulges( n, b, band.data(), d, e, bulgeReflectors );
+
+    // Overwrite the band with the bidiagonal matrix
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(Max(j-b,0));
+        const Int iLocEnd = A.LocalRowOffset(j+1);
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j )
+                A.SetLocal( iLoc, jLoc, d(j) );
+            else if( i == j-1 )
+                A.SetLocal( iLoc, jLoc, e(i) );
+            else
+                A.SetLocal( iLoc, jLoc, F(0) );
+        }
+    }
+}
+
+// Apply I - gamma v v^H to the full rows (or columns) offset,...,
+// offset+length-1 of the local matrix B
+template<typename F>
+void ApplyBulgeReflector
+( LeftOrRight side,
+  F gamma,
+  const F* v,
+  Int offset,
+  Int length,
+  Matrix<F>& B,
+  vector<F>& z )
+{
+    DEBUG_CSE
+    if( side == LEFT )
+    {
+        const Int width = B.Width();
+        F* BRows = B.Buffer(offset,0);
+        blas::Gemv
+        ( 'C', length, width, F(1), BRows, B.LDim(), v, 1, F(0), z.data(), 1 );
+        blas::Ger( length, width, -gamma, v, 1, z.data(), 1, BRows, B.LDim() );
+    }
+    else
+    {
+        const Int height = B.Height();
+        F* BCols = B.Buffer(0,offset);
+        blas::Gemv
+        ( 'N', height, length,
+          F(1), BCols, B.LDim(), v, 1, F(0), z.data(), 1 );
+        blas::Ger
+        ( height, length, -gamma, z.data(), 1, v, 1, BCols, B.LDim() );
+    }
+}
+
+// Apply either Q2 = H_0^H H_1^H ... H_{k-1}^H or P2 = G_0 G_1 ... G_{k-1}
+// (or their adjoints), where the reflectors are conjugated (relative to
+// their definitions) iff conjugation is CONJUGATED. Since each process holds
+// full columns (rows) of B when applying from the left (right), no
+// communication is required beyond the redistributions.
+template<typename F>
+void ApplyBulgeReflectors
+( LeftOrRight side,
+  Orientation orientation,
+  Conjugation conjugation,
+  const Matrix<F>& reflectors,
+  const Matrix<F>& householderScalars,
+  const Matrix<Int>& offsets,
+  const Matrix<Int>& lengths,
+        AbstractDistMatrix<F>& BPre )
+{
+    DEBUG_CSE
+    const Int numReflectors = householderScalars.Height();
+    if( numReflectors == 0 )
+        return;
+    const bool backward = ( (orientation==NORMAL) == (side==LEFT) );
+
+    auto applyReflectors = [&]( Matrix<F>& B )
+    {
+        vector<F> z( side==LEFT ? B.Width() : B.Height() );
+        if( z.size() == 0 )
+            return;
+        for( Int step=0; step<numReflectors; ++step )
+        {
+            const Int j = ( backward ? numReflectors-1-step : step );
+            const F tau = householderScalars(j);
+            const F gamma = ( conjugation==CONJUGATED ? Conj(tau) : tau );
+            ApplyBulgeReflector
+            ( side, gamma, reflectors.LockedBuffer(0,j), offsets(j), lengths(j),
+              B, z );
+        }
+    };
+    if( side == LEFT )
+    {
+        DistMatrixReadWriteProxy<F,F,STAR,VR> BProx( BPre );
+        applyReflectors( BProx.Get().Matrix() );
+    }
+    else
+    {
+        DistMatrixReadWriteProxy<F,F,VC,STAR> BProx( BPre );
+        applyReflectors( BProx.Get().Matrix() );
+    }
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGE_HPP
@@ -45,6 +45,8 @@ void Ger2Sub
 #include "./HermitianTridiag/LSquare.hpp"
 #include "./HermitianTridiag/U.hpp"
 #include "./HermitianTridiag/USquare.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
+#include "./HermitianTridiag/Tiled.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
 
@@ -69,6 +71,13 @@ void HermitianTridiag
   const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.twoStage && uplo == LOWER )
+    {
+        herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+        HermitianTridiag
+        ( uplo, APre, householderScalarsPre, bulgeReflectors, ctrl );
+        return;
+    }
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     DistMatrixWriteProxy<F,F,STAR,STAR>
@@ -77,7 +86,19 @@ void HermitianTridiag
     auto& householderScalars = householderScalarsProx.Get();
 
     const Grid& g = A.Grid();
-    if( ctrl.approach == HERMITIAN_TRIDIAG_NORMAL )
+    const Int n = A.Height();
+    TunedBlocksizeScope scope
+    ( TUNE_HERMITIAN_TRIDIAG, n, g.Height(), g.Width() );
+    HermitianTridiagApproach approach = ctrl.approach;
+    if( approach == HERMITIAN_TRIDIAG_DEFAULT )
+    {
+        const Int variant =
+          TunedVariant( TUNE_HERMITIAN_TRIDIAG, n, g.Height(), g.Width() );
+        if( variant == HERMITIAN_TRIDIAG_NORMAL ||
+            variant == HERMITIAN_TRIDIAG_SQUARE )
+            approach = static_cast<HermitianTridiagApproach>(variant);
+    }
+    if( approach == HERMITIAN_TRIDIAG_NORMAL )
     {
         // Use the pipelined algorithm for nonsquare meshes
         if( uplo == LOWER )
@@ -85,7 +106,7 @@ void HermitianTridiag
         else
             herm_tridiag::U( A, householderScalars, ctrl.symvCtrl );
     }
-    else if( ctrl.approach == HERMITIAN_TRIDIAG_SQUARE )
+    else if( approach == HERMITIAN_TRIDIAG_SQUARE )
     {
         // Drop down to a square mesh 
         const Int p = g.Size();
@@ -154,6 +175,34 @@ void HermitianTridiag
     }
 }
 
+template<typename F>
+void HermitianTridiag
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  herm_tridiag::BulgeReflectors<F>& bulgeReflectors,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    // TODO: Support upper-triangular storage in the two-stage
+    // reduction rather than falling back to the one-stage approach
+    if( ctrl.twoStage && uplo == LOWER )
+    {
+        DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+        DistMatrixWriteProxy<F,F,STAR,STAR>
+          householderScalarsProx( householderScalarsPre );
+        auto& A = AProx.Get();
+        auto& householderScalars = householderScalarsProx.Get();
+        herm_tridiag::LTwoStage
+        ( A, householderScalars, bulgeReflectors, ctrl.bandwidth );
+    }
+    else
+    {
+        bulgeReflectors = herm_tridiag::BulgeReflectors<F>();
+        HermitianTridiag( uplo, APre, householderScalarsPre, ctrl );
+    }
+}
+
 namespace herm_tridiag {
 
 template<typename F>
@@ -190,11 +239,22 @@ void ExplicitCondensed
   ( UpperOrLower uplo, \
     Matrix<F>& A, \
     Matrix<F>& householderScalars ); \
+  template void herm_tridiag::Tiled \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    BulgeReflectors<F>& bulgeReflectors, \
+    const TileCtrl& ctrl ); \
   template void HermitianTridiag \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalars, \
     const HermitianTridiagCtrl<F>& ctrl ); \
+  template void HermitianTridiag \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
   ( UpperOrLower uplo, Matrix<F>& A ); \
   template void herm_tridiag::ExplicitCondensed \
@@ -214,6 +274,14 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
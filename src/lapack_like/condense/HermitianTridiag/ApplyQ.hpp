@@ -55,6 +55,46 @@ void ApplyQ
       A, householderScalars, B );
 }
 
+// Apply Q = Q1 Q2, where Q1 is the product of the packed reflectors from the
+// reduction to band form and Q2 is the product of the bulge reflectors
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    DEBUG_CSE
+    const Int bandwidth = bulgeReflectors.bandwidth;
+    if( bandwidth == 1 )
+    {
+        ApplyQ( side, uplo, orientation, A, householderScalars, B );
+        return;
+    }
+    DEBUG_ONLY(
+      if( uplo != LOWER )
+          LogicError("The two-stage reduction requires lower storage");
+    )
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+
+    // Q B = Q1 (Q2 B) and B Q^H = (B Q2^H) Q1^H, whereas
+    // Q^H B = Q2^H (Q1^H B) and B Q = (B Q1) Q2
+    const bool bulgesFirst = (normal==onLeft);
+    if( bulgesFirst )
+        ApplyBulgeReflectors( side, orientation, bulgeReflectors, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -bandwidth,
+      A, householderScalars, B );
+    if( !bulgesFirst )
+        ApplyBulgeReflectors( side, orientation, bulgeReflectors, B );
+}
+
 } // namespace herm_tridiag
 } // namespace El
 
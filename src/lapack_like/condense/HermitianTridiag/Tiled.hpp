@@ -0,0 +1,232 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TILED_HPP
+#define EL_HERMITIANTRIDIAG_TILED_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// The two-stage reduction of LTwoStage with the band reduction expressed as a
+// graph of tile tasks, with the bandwidth equal to the tile size. Each step
+// consists of
+//
+//  1. the QR factorization of the tile column below the diagonal,
+//  2. a task for each tile row i of the trailing matrix forming
+//     Y_i := (A22 V inv(SInv)^H)_i,
+//  3. a task forming Z := Y - (1/2) V inv(SInv) V^H Y (in place), and
+//  4. a task for each trailing tile forming A_ij -= V_i Z_j^H + Z_i V_j^H.
+//
+// The one-sided structure of the one-stage reduction, where each column
+// requires a matrix-vector product with the entire trailing matrix, precludes
+// such a decomposition. While step 2 requires the entire trailing matrix to
+// have been updated, the next panel only depends upon the updates of its own
+// tile column, and so it overlaps with the remaining updates.
+template<typename F>
+void Tiled
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  BulgeReflectors<F>& bulgeReflectors,
+  const TileCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( ctrl.tileSize <= 0 )
+        LogicError("The tile size must be positive");
+    const Int n = A.Height();
+    const Int b = Max(Min(ctrl.tileSize,n-1),Int(1));
+    const Int numTiles = (n+b-1) / b;
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+
+    auto tile = [&]( Int i, Int j )
+    {
+        return A( IR(i*b,Min((i+1)*b,n)), IR(j*b,Min((j+1)*b,n)) );
+    };
+
+    // Consecutive steps alternate between two sets of workspaces so that the
+    // panel of one step may proceed while the updates of the previous step
+    // are still reading its predecessor's workspace
+    Matrix<F> V[2], SInv[2], Y[2];
+    Int numReflectors[2] = { 0, 0 };
+    for( Int p=0; p<2; ++p )
+        Y[p].Resize( n, b );
+
+    auto tileHandle = [=]( Int i, Int j ) { return i + j*numTiles; };
+    auto VHandle = [=]( Int p ) { return numTiles*numTiles + p; };
+    auto YHandle =
+      [=]( Int p, Int i ) { return numTiles*numTiles + 2 + p*numTiles + i; };
+
+    // The rows of tile row i within the trailing matrix of step t
+    auto trailingRows = [=]( Int t, Int i )
+    { return IR( i*b-(t+1)*b, Min((i+1)*b,n)-(t+1)*b ); };
+
+    auto factorPanel = [&]( Int t )
+    {
+        const Int p = t % 2;
+        const Int k = t*b;
+        const Int nb = Min(b,(n-b)-k);
+        auto APan = A( IR(k+b,n), IR(k,k+b) );
+        for( Int j=0; j<nb; ++j )
+        {
+            const IR ind1( j ), indB( j, END ), indR( j+1, END );
+            auto alpha11 = APan( ind1, ind1 );
+            auto a21     = APan( indR, ind1 );
+            auto aB1     = APan( indB, ind1 );
+            auto AB2     = APan( indB, indR );
+
+            const F tau = LeftReflector( alpha11, a21 );
+            householderScalars(k+j) = tau;
+            const F alpha = alpha11(0);
+            alpha11(0) = 1;
+            // AB2 := (I - tau aB1 aB1^H) AB2
+            Matrix<F> z21;
+            Gemv( ADJOINT, F(1), AB2, aB1, z21 );
+            Ger( -tau, aB1, z21, AB2 );
+            alpha11(0) = alpha;
+        }
+
+        V[p] = APan( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, V[p] );
+        FillDiagonal( V[p], F(1) );
+        Herk( LOWER, ADJOINT, Real(1), V[p], SInv[p] );
+        for( Int j=0; j<nb; ++j )
+            SInv[p](j,j) = F(1) / householderScalars(k+j);
+        numReflectors[p] = nb;
+    };
+
+    // Y_i := (A22 V inv(SInv)^H)_i, using only the lower triangle of A22
+    auto formY = [&]( Int t, Int i )
+    {
+        const Int p = t % 2;
+        const Int nb = numReflectors[p];
+        auto Yi = Y[p]( trailingRows(t,i), IR(0,nb) );
+        Zero( Yi );
+        for( Int j=t+1; j<numTiles; ++j )
+        {
+            auto Vj = V[p]( trailingRows(t,j), ALL );
+            if( j < i )
+            {
+                auto Aij = tile(i,j);
+                Gemm( NORMAL, NORMAL, F(1), Aij, Vj, F(1), Yi );
+            }
+            else if( j == i )
+            {
+                auto Aii = tile(i,i);
+                Hemm( LEFT, LOWER, F(1), Aii, Vj, F(1), Yi );
+            }
+            else
+            {
+                auto Aji = tile(j,i);
+                Gemm( ADJOINT, NORMAL, F(1), Aji, Vj, F(1), Yi );
+            }
+        }
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv[p], Yi );
+    };
+
+    // Z := Y - (1/2) V inv(SInv) V^H Y (stored in Y)
+    auto formZ = [&]( Int t )
+    {
+        const Int p = t % 2;
+        const Int nb = numReflectors[p];
+        auto Yp = Y[p]( IR(0,n-(t+1)*b), IR(0,nb) );
+        Matrix<F> X;
+        Gemm( ADJOINT, NORMAL, F(1), V[p], Yp, X );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv[p], X );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V[p], X, F(1), Yp );
+    };
+
+    // A_ij -= V_i Z_j^H + Z_i V_j^H
+    auto update = [&]( Int t, Int i, Int j )
+    {
+        const Int p = t % 2;
+        const Int nb = numReflectors[p];
+        auto Vi = V[p]( trailingRows(t,i), ALL );
+        auto Vj = V[p]( trailingRows(t,j), ALL );
+        auto Zi = Y[p]( trailingRows(t,i), IR(0,nb) );
+        auto Zj = Y[p]( trailingRows(t,j), IR(0,nb) );
+        auto Aij = tile(i,j);
+        if( i == j )
+        {
+            Her2k( LOWER, NORMAL, F(-1), Vi, Zi, Real(1), Aij );
+        }
+        else
+        {
+            Gemm( NORMAL, ADJOINT, F(-1), Vi, Zj, F(1), Aij );
+            Gemm( NORMAL, ADJOINT, F(-1), Zi, Vj, F(1), Aij );
+        }
+    };
+
+    TaskGraph graph;
+    for( Int t=0; (t+1)*b<n; ++t )
+    {
+        const Int p = t % 2;
+        vector<Int> panelTiles, YHandles;
+        for( Int i=t+1; i<numTiles; ++i )
+        {
+            panelTiles.push_back( tileHandle(i,t) );
+            YHandles.push_back( YHandle(p,i) );
+        }
+        panelTiles.push_back( VHandle(p) );
+        graph.Insert
+        ( [=]() { factorPanel(t); }, {}, panelTiles, 3*numTiles );
+
+        for( Int i=t+1; i<numTiles; ++i )
+        {
+            vector<Int> reads( 1, VHandle(p) );
+            for( Int j=t+1; j<=i; ++j )
+                reads.push_back( tileHandle(i,j) );
+            for( Int j=i+1; j<numTiles; ++j )
+                reads.push_back( tileHandle(j,i) );
+            graph.Insert
+            ( [=]() { formY(t,i); }, reads, {YHandle(p,i)}, 2*numTiles );
+        }
+
+        graph.Insert
+        ( [=]() { formZ(t); }, {VHandle(p)}, YHandles, 2*numTiles );
+
+        for( Int j=t+1; j<numTiles; ++j )
+            for( Int i=j; i<numTiles; ++i )
+                graph.Insert
+                ( [=]() { update(t,i,j); },
+                  {VHandle(p),YHandle(p,i),YHandle(p,j)}, {tileHandle(i,j)},
+                  ( j == t+1 ? 2*numTiles-i : numTiles-j ) );
+    }
+    graph.Execute( ctrl.numThreads );
+
+    if( b == 1 )
+    {
+        // The band reduction was a (one-stage) tridiagonalization
+        bulgeReflectors = BulgeReflectors<F>();
+        return;
+    }
+
+    // Copy the band (of width b+1) into storage with room for the bulges
+    const Int ldim = 2*b-1;
+    vector<F> band(n*(ldim+1),F(0));
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+b+1,n); ++i )
+            band[i+j*ldim] = A(i,j);
+
+    Matrix<Real> d, e;
+    ChaseBulges( n, b, band.data(), d, e, bulgeReflectors );
+
+    // Overwrite the band with the tridiagonal matrix
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = d(j);
+        for( Int i=j+1; i<Min(j+b+1,n); ++i )
+            A(i,j) = ( i == j+1 ? F(e(j)) : F(0) );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TILED_HPP
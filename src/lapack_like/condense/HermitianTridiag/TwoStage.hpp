@@ -0,0 +1,410 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// The two-stage reduction of a Hermitian matrix, stored in its lower triangle,
+// to real symmetric tridiagonal form. The first stage reduces A to a band
+// matrix by applying the Householder QR factorization of each (tall) panel
+// from both sides, so that, unlike the one-stage approach, the trailing
+// updates are entirely composed of a Hemm and a rank-2k update. The second
+// stage redundantly chases the bulges of the (small) band matrix down to
+// tridiagonal form.
+
+// Reduce A to a band matrix, storing the Householder vectors below the
+// -bandwidth'th diagonal
+template<typename F>
+void LBand
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    const Grid& g = A.Grid();
+    householderScalars.Resize( n-b, 1 );
+
+    DistMatrix<F> V(g), W(g);
+    DistMatrix<F,MC,  STAR> aB1_MC_STAR(g), V_MC_STAR(g), Z_MC_STAR(g);
+    DistMatrix<F,MR,  STAR> z21_MR_STAR(g), V_MR_STAR(g), Z_MR_STAR(g);
+    DistMatrix<F,VC,  STAR> V_VC_STAR(g), Y_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> SInv_STAR_STAR(g), X_STAR_STAR(g);
+
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,(n-b)-k);
+        const Range<Int> indPan( k, k+b ), ind2( k+b, n );
+
+        auto APan = A( ind2, indPan );
+        auto A22  = A( ind2, ind2   );
+
+        // Compute the (unnormalized) Householder QR factorization of the panel
+        for( Int j=0; j<nb; ++j )
+        {
+            const Range<Int> ind1( j ), indB( j, END ), indR( j+1, END );
+
+            auto alpha11 = APan( ind1, ind1 );
+            auto a21     = APan( indR, ind1 );
+            auto aB1     = APan( indB, ind1 );
+            auto AB2     = APan( indB, indR );
+
+            const F tau = LeftReflector( alpha11, a21 );
+            householderScalars.Set( k+j, 0, tau );
+
+            F alpha = 0;
+            if( alpha11.IsLocal(0,0) )
+            {
+                alpha = alpha11.GetLocal(0,0);
+                alpha11.SetLocal(0,0,F(1));
+            }
+
+            // AB2 := (I - tau aB1 aB1^H) AB2
+            aB1_MC_STAR.AlignWith( AB2 );
+            aB1_MC_STAR = aB1;
+            z21_MR_STAR.AlignWith( AB2 );
+            Zeros( z21_MR_STAR, AB2.Width(), 1 );
+            LocalGemv( ADJOINT, F(1), AB2, aB1_MC_STAR, F(0), z21_MR_STAR );
+            El::AllReduce( z21_MR_STAR, AB2.ColComm() );
+            Ger
+            ( -tau, aB1_MC_STAR.LockedMatrix(), z21_MR_STAR.LockedMatrix(),
+              AB2.Matrix() );
+
+            if( alpha11.IsLocal(0,0) )
+                alpha11.SetLocal(0,0,alpha);
+        }
+
+        // Form the explicit matrix of Householder vectors, V
+        auto APan1 = APan( ALL, IR(0,nb) );
+        V = APan1;
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+
+        // Form SInv such that the product of the reflectors is
+        // P = I - V inv(SInv) V^H
+        V_VC_STAR.AlignWith( A22 );
+        V_VC_STAR = V;
+        Zeros( SInv_STAR_STAR, nb, nb );
+        Herk
+        ( LOWER, ADJOINT,
+          Base<F>(1), V_VC_STAR.LockedMatrix(),
+          Base<F>(0), SInv_STAR_STAR.Matrix() );
+        El::AllReduce( SInv_STAR_STAR, V_VC_STAR.ColComm() );
+        for( Int j=0; j<nb; ++j )
+            SInv_STAR_STAR.SetLocal
+            ( j, j, F(1)/householderScalars.GetLocal(k+j,0) );
+
+        // Y := A22 V inv(SInv)^H
+        W.AlignWith( A22 );
+        Zeros( W, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), W );
+        Y_VC_STAR.AlignWith( A22 );
+        Y_VC_STAR = W;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv_STAR_STAR, Y_VC_STAR );
+
+        // Z := Y - (1/2) V inv(SInv) V^H Y (stored in Y)
+        Zeros( X_STAR_STAR, nb, nb );
+        LocalGemm
+        ( ADJOINT, NORMAL, F(1), V_VC_STAR, Y_VC_STAR, F(0), X_STAR_STAR );
+        El::AllReduce( X_STAR_STAR, V_VC_STAR.ColComm() );
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, X_STAR_STAR );
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1)/F(2), V_VC_STAR, X_STAR_STAR,
+          F(1), Y_VC_STAR );
+
+        // A22 := P A22 P^H = A22 - V Z^H - Z V^H
+        V_MC_STAR.AlignWith( A22 );
+        V_MC_STAR = V_VC_STAR;
+        V_MR_STAR.AlignWith( A22 );
+        V_MR_STAR = V_VC_STAR;
+        Z_MC_STAR.AlignWith( A22 );
+        Z_MC_STAR = Y_VC_STAR;
+        Z_MR_STAR.AlignWith( A22 );
+        Z_MR_STAR = Y_VC_STAR;
+        LocalTrr2k
+        ( LOWER, NORMAL, ADJOINT, NORMAL, ADJOINT,
+          F(-1), V_MC_STAR, Z_MR_STAR,
+          F(-1), Z_MC_STAR, V_MR_STAR,
+          F(1),  A22 );
+    }
+}
+
+// Each sweep eliminates a column with a reflector which, when applied from
+// the right, introduces a bulge below the band. Only the first column of each
+// bulge is eliminated (by a reflector which introduces the next bulge), as
+// the remainder is annihilated by subsequent sweeps.
+inline Int NumBulgeReflectors( Int n, Int bandwidth )
+{
+    Int numReflectors = 0;
+    for( Int j=0; j<n-1; ++j )
+    {
+        ++numReflectors;
+        Int s0 = Min(j+bandwidth,n-1) + 1;
+        while( s0 < n-1 )
+        {
+            ++numReflectors;
+            s0 = Min(s0+bandwidth-1,n-1) + 1;
+        }
+    }
+    return numReflectors;
+}
+
+// Chase the bulges of a Hermitian band matrix down to tridiagonal form. Since
+// the bulges extend the bandwidth to at most 2b-1, entry (i,j) of the lower
+// triangle, for j <= i <= j+2b-1, is stored in band[i+j*ldim], where
+// ldim=2b-1, so that each portion of the band may be treated as a
+// column-major matrix with leading dimension ldim.
+template<typename F>
+void ChaseBulges
+( Int n, Int bandwidth, F* band,
+  Matrix<Base<F>>& d,
+  Matrix<Base<F>>& e,
+  BulgeReflectors<F>& bulgeReflectors )
+{
+    DEBUG_CSE
+    const Int b = bandwidth;
+    const Int ldim = 2*b-1;
+    const Int numReflectors = NumBulgeReflectors( n, b );
+    bulgeReflectors.bandwidth = b;
+    Zeros( bulgeReflectors.reflectors, b, numReflectors );
+    bulgeReflectors.householderScalars.Resize( numReflectors, 1 );
+    bulgeReflectors.offsets.Resize( numReflectors, 1 );
+    bulgeReflectors.lengths.Resize( numReflectors, 1 );
+
+    vector<F> z(b);
+    Int numApplied = 0;
+
+    // Eliminate entries r0+1:r1 of column 'col' and apply the reflector to
+    // the bulge to the left of the diagonal block, the diagonal block, and
+    // the rows below the diagonal block (introducing the next bulge)
+    auto reflect = [&]( Int col, Int r0, Int r1 )
+    {
+        const Int length = r1-r0+1;
+        F* x = &band[r0+col*ldim];
+        F* v = bulgeReflectors.reflectors.Buffer(0,numApplied);
+
+        F chi = x[0];
+        const F tau = lapack::Reflector( length, chi, &x[1], 1 );
+        v[0] = F(1);
+        for( Int i=1; i<length; ++i )
+        {
+            v[i] = x[i];
+            x[i] = 0;
+        }
+        x[0] = chi;
+        bulgeReflectors.householderScalars(numApplied) = tau;
+        bulgeReflectors.offsets(numApplied) = r0;
+        bulgeReflectors.lengths(numApplied) = length;
+        ++numApplied;
+
+        // Apply from the left to the remainder of the bulge
+        const Int numLeft = r0-(col+1);
+        if( numLeft > 0 )
+        {
+            F* ABulge = &band[r0+(col+1)*ldim];
+            blas::Gemv
+            ( 'C', length, numLeft,
+              F(1), ABulge, ldim, v, 1, F(0), z.data(), 1 );
+            blas::Ger
+            ( length, numLeft, -tau, v, 1, z.data(), 1, ABulge, ldim );
+        }
+
+        // Apply from both sides to the diagonal block
+        F* ADiag = &band[r0+r0*ldim];
+        blas::Hemv
+        ( 'L', length, Conj(tau), ADiag, ldim, v, 1, F(0), z.data(), 1 );
+        const F alpha = -Conj(tau)*blas::Dot(length,z.data(),1,v,1)/F(2);
+        blas::Axpy( length, alpha, v, 1, z.data(), 1 );
+        blas::Her2( 'L', length, F(-1), v, 1, z.data(), 1, ADiag, ldim );
+
+        // Apply from the right to the rows below the diagonal block
+        const Int numBelow = Min(r1+b,n-1)-r1;
+        if( numBelow > 0 )
+        {
+            F* ABelow = &band[(r1+1)+r0*ldim];
+            blas::Gemv
+            ( 'N', numBelow, length,
+              F(1), ABelow, ldim, v, 1, F(0), z.data(), 1 );
+            blas::Ger
+            ( numBelow, length, -Conj(tau), z.data(), 1, v, 1, ABelow, ldim );
+        }
+    };
+
+    for( Int j=0; j<n-1; ++j )
+    {
+        const Int r1 = Min(j+b,n-1);
+        reflect( j, j+1, r1 );
+
+        Int c0 = j+1;
+        Int s0 = r1+1;
+        while( s0 < n-1 )
+        {
+            const Int s1 = Min(s0+b-1,n-1);
+            reflect( c0, s0, s1 );
+            c0 = s0;
+            s0 = s1+1;
+        }
+    }
+    DEBUG_ONLY(
+      if( numApplied != numReflectors )
+          LogicError("Miscounted the number of bulge reflectors");
+    )
+
+    d.Resize( n, 1 );
+    e.Resize( n-1, 1 );
+    for( Int j=0; j<n; ++j )
+        d(j) = RealPart(band[j+j*ldim]);
+    for( Int j=0; j<n-1; ++j )
+        e(j) = RealPart(band[(j+1)+j*ldim]);
+}
+
+template<typename F>
+void LTwoStage
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = Max(Min(bandwidth,n-1),1);
+
+    LBand( A, householderScalars, b );
+    if( b == 1 )
+    {
+        // The band reduction was a (one-stage) tridiagonalization
+        bulgeReflectors = BulgeReflectors<F>();
+        return;
+    }
+
+    // Redundantly gather the band (of width b+1) into storage with room for
+    // the bulges
+    const Int ldim = 2*b-1;
+    vector<F> band(n*(ldim+1),F(0));
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+b+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            band[A.GlobalRow(iLoc)+j*ldim] = A.GetLocal(iLoc,jLoc);
+    }
+    mpi::AllReduce( band.data(), band.size(), A.DistComm() );
+
+    Matrix<Real> d, e;
+    ChaseBulges( n, b, band.data(), d, e, bulgeReflectors );
+
+    // Overwrite the band with the tridiagonal matrix
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+b+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j )
+                A.SetLocal( iLoc, jLoc, d(j) );
+            else if( i == j+1 )
+                A.SetLocal( iLoc, jLoc, e(j) );
+            else
+                A.SetLocal( iLoc, jLoc, F(0) );
+        }
+    }
+}
+
+// Apply the j'th bulge reflector (or its adjoint) to the full rows (or
+// columns) of the local matrix B
+template<typename F>
+void ApplyBulgeReflector
+( LeftOrRight side,
+  Orientation orientation,
+  const BulgeReflectors<F>& bulgeReflectors,
+  Int j,
+  Matrix<F>& B,
+  vector<F>& z )
+{
+    DEBUG_CSE
+    const Int offset = bulgeReflectors.offsets(j);
+    const Int length = bulgeReflectors.lengths(j);
+    const F tau = bulgeReflectors.householderScalars(j);
+    const F gamma = ( orientation==NORMAL ? Conj(tau) : tau );
+    const F* v = bulgeReflectors.reflectors.LockedBuffer(0,j);
+    if( side == LEFT )
+    {
+        // B := (I - gamma v v^H) B
+        const Int width = B.Width();
+        F* BRows = B.Buffer(offset,0);
+        blas::Gemv
+        ( 'C', length, width, F(1), BRows, B.LDim(), v, 1, F(0), z.data(), 1 );
+        blas::Ger( length, width, -gamma, v, 1, z.data(), 1, BRows, B.LDim() );
+    }
+    else
+    {
+        // B := B (I - gamma v v^H)
+        const Int height = B.Height();
+        F* BCols = B.Buffer(0,offset);
+        blas::Gemv
+        ( 'N', height, length,
+          F(1), BCols, B.LDim(), v, 1, F(0), z.data(), 1 );
+        blas::Ger
+        ( height, length, -gamma, z.data(), 1, v, 1, BCols, B.LDim() );
+    }
+}
+
+// Apply Q2 = G_0^H G_1^H ... G_{k-1}^H, where G_j is the j'th bulge reflector.
+// Since each process holds full columns (rows) of B when applying from the
+// left (right), no communication is required beyond the redistributions.
+template<typename F>
+void ApplyBulgeReflectors
+( LeftOrRight side,
+  Orientation orientation,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& BPre )
+{
+    DEBUG_CSE
+    const Int numReflectors = bulgeReflectors.householderScalars.Height();
+    if( numReflectors == 0 )
+        return;
+    const bool backward = ( (orientation==NORMAL) == (side==LEFT) );
+
+    auto applyReflectors = [&]( Matrix<F>& B )
+    {
+        vector<F> z( side==LEFT ? B.Width() : B.Height() );
+        if( z.size() == 0 )
+            return;
+        for( Int step=0; step<numReflectors; ++step )
+        {
+            const Int j = ( backward ? numReflectors-1-step : step );
+            ApplyBulgeReflector( side, orientation, bulgeReflectors, j, B, z );
+        }
+    };
+    if( side == LEFT )
+    {
+        DistMatrixReadWriteProxy<F,F,STAR,VR> BProx( BPre );
+        applyReflectors( BProx.Get().Matrix() );
+    }
+    else
+    {
+        DistMatrixReadWriteProxy<F,F,VC,STAR> BProx( BPre );
+        applyReflectors( BProx.Get().Matrix() );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -41,6 +41,18 @@ void Hessenberg
         hessenberg::L( A, householderScalars );
 }
 
+template<typename F>
+void Hessenberg
+( UpperOrLower uplo,
+  DistMatrix<F,MC,MR,BLOCK>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars )
+{
+    DEBUG_CSE
+    if( uplo == LOWER )
+        LogicError("Block-cyclic lower Hessenberg is not yet supported");
+    hessenberg::U( A, householderScalars );
+}
+
 namespace hessenberg {
 
 template<typename F>
@@ -67,6 +79,15 @@ void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
         MakeTrapezoidal( UPPER, A, -1 );
 }
 
+template<typename F>
+void ExplicitCondensed( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    DEBUG_CSE
+    DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
+    Hessenberg( uplo, A, householderScalars );
+    MakeTrapezoidal( UPPER, A, -1 );
+}
+
 } // namespace hessenberg
 
 #define PROTO(F) \
@@ -78,10 +99,16 @@ void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalars ); \
+  template void Hessenberg \
+  ( UpperOrLower uplo, \
+    DistMatrix<F,MC,MR,BLOCK>& A, \
+    DistMatrix<F,STAR,STAR>& householderScalars ); \
   template void hessenberg::ExplicitCondensed \
   ( UpperOrLower uplo, Matrix<F>& A ); \
   template void hessenberg::ExplicitCondensed \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
+  template void hessenberg::ExplicitCondensed \
+  ( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A ); \
   template void hessenberg::ApplyQ \
   ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
     const Matrix<F>& A, \
@@ -101,7 +128,12 @@ void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
   ( UpperOrLower uplo, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
-          AbstractDistMatrix<F>& Q );
+          AbstractDistMatrix<F>& Q ); \
+  template void hessenberg::FormQ \
+  ( UpperOrLower uplo, \
+    const DistMatrix<F,MC,MR,BLOCK>& A, \
+    const DistMatrix<F,STAR,STAR>& householderScalars, \
+          DistMatrix<F,MC,MR,BLOCK>& Q );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -40,6 +40,75 @@ void FormQ
     ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
 }
 
+// Rather than applying the packed reflectors to the identity, accumulate each
+// panel of reflectors in the compact WY form used by the reduction,
+//
+//   Q_k = I - U_k inv(G_k)^H U_k^H,   G_k = tril(U_k^H U_k,-1) + diag(1/tau),
+//
+// and form Q = Q_0 Q_1 ... from the back so that each panel only effects
+// the trailing (nonidentity) submatrix of Q.
+template<typename F>
+void FormQ
+( UpperOrLower uplo,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+  const DistMatrix<F,STAR,STAR>& householderScalars,
+        DistMatrix<F,MC,MR,BLOCK>& Q )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( A, householderScalars, Q ))
+    if( uplo == LOWER )
+        LogicError("Block-cyclic lower Hessenberg is not yet supported");
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    Q.AlignWith( A );
+    Identity( Q, n, n );
+    if( n <= 1 )
+        return;
+
+    DistMatrix<F,MC,STAR,BLOCK> UB1_MC_STAR(g);
+    DistMatrix<F,MR,STAR,BLOCK> VB1_MR_STAR(g);
+    DistMatrix<F,STAR,STAR> G11_STAR_STAR(g);
+
+    const Int bsize = A.BlockHeight();
+    const Int kLast = LastOffset( n-1, bsize );
+    for( Int k=kLast; k>=0; k-=bsize )
+    {
+        const Int nb = Min(bsize,n-1-k);
+        const Range<Int> ind1( k, k+nb ), indB( k+1, n );
+
+        auto AB1 = A( indB, ind1 );
+        auto QBB = Q( indB, indB );
+
+        // Unpack the unit-lower trapezoidal UB1
+        UB1_MC_STAR.AlignWith( QBB );
+        UB1_MC_STAR = AB1;
+        MakeTrapezoidal( LOWER, UB1_MC_STAR );
+        FillDiagonal( UB1_MC_STAR, F(1) );
+
+        // G11 := tril(UB1^H UB1,-1) + diag(1/tau)
+        Zeros( G11_STAR_STAR, nb, nb );
+        LocalGemm
+        ( ADJOINT, NORMAL, F(1), UB1_MC_STAR, UB1_MC_STAR,
+          F(0), G11_STAR_STAR );
+        El::AllReduce( G11_STAR_STAR, UB1_MC_STAR.ColComm() );
+        MakeTrapezoidal( LOWER, G11_STAR_STAR, -1 );
+        for( Int j=0; j<nb; ++j )
+            G11_STAR_STAR.Set
+            ( j, j, F(1)/householderScalars.GetLocal(k+j,0) );
+
+        // QBB := QBB - UB1 ((QBB^H UB1) inv(G11))^H
+        VB1_MR_STAR.AlignWith( QBB );
+        Zeros( VB1_MR_STAR, QBB.Width(), nb );
+        LocalGemm
+        ( ADJOINT, NORMAL, F(1), QBB, UB1_MC_STAR, F(0), VB1_MR_STAR );
+        El::AllReduce( VB1_MR_STAR, QBB.ColComm() );
+        LocalTrsm
+        ( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), G11_STAR_STAR, VB1_MR_STAR );
+        LocalGemm
+        ( NORMAL, ADJOINT, F(-1), UB1_MC_STAR, VB1_MR_STAR, F(1), QBB );
+    }
+}
+
 } // namespace hessenberg
 } // namespace El
 
@@ -153,6 +153,79 @@ void U
     }
 }
 
+// A native block-cyclic analogue of the above, with the panels aligned with
+// the distribution blocks
+template<typename F>
+void U
+( DistMatrix<F,MC,MR,BLOCK>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( A, householderScalars ))
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    householderScalars.Resize( Max(n-1,0), 1 );
+
+    DistMatrix<F,MC,STAR,BLOCK> V01_MC_STAR(g), UB1_MC_STAR(g),
+                                VB1_MC_STAR(g);
+    DistMatrix<F,MR,STAR,BLOCK> UB1_MR_STAR(g), V21_MR_STAR(g);
+    DistMatrix<F,STAR,STAR> G11_STAR_STAR(g);
+
+    const Int bsize = A.BlockHeight();
+    for( Int k=0; k<n-1; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-1-k);
+
+        const Range<Int> ind0( 0,    k    ),
+                         ind1( k,    k+nb ),
+                         indB( k,    n    ), indR( k, n ),
+                         ind2( k+nb, n    );
+
+        auto ABR = A( indB, indR );
+
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        UB1_MC_STAR.AlignWith( ABR );
+        UB1_MR_STAR.AlignWith( ABR );
+        VB1_MC_STAR.AlignWith( ABR );
+        UB1_MC_STAR.Resize( n-k, nb );
+        UB1_MR_STAR.Resize( n-k, nb );
+        VB1_MC_STAR.Resize( n-k, nb );
+        G11_STAR_STAR.Resize( nb, nb );
+        hessenberg::UPan
+        ( ABR, householderScalars1, UB1_MC_STAR, UB1_MR_STAR, VB1_MC_STAR,
+          G11_STAR_STAR );
+
+        auto A0R = A( ind0, indR );
+        auto AB2 = A( indB, ind2 );
+
+        auto U21_MR_STAR = UB1_MR_STAR( IR(nb,END), ALL );
+
+        // A0R := A0R - ((A0R UB1) inv(G11)^H) UB1^H
+        V01_MC_STAR.AlignWith( A0R );
+        Zeros( V01_MC_STAR, k, nb );
+        LocalGemm( NORMAL, NORMAL, F(1), A0R, UB1_MR_STAR, F(0), V01_MC_STAR );
+        El::AllReduce( V01_MC_STAR, A0R.RowComm() );
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), G11_STAR_STAR, V01_MC_STAR );
+        LocalGemm
+        ( NORMAL, ADJOINT, F(-1), V01_MC_STAR, UB1_MR_STAR, F(1), A0R );
+
+        // AB2 := (I - UB1 inv(G11) UB1^H)(AB2 - VB1 inv(G11)^H U21^H)
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), G11_STAR_STAR, VB1_MC_STAR );
+        LocalGemm
+        ( NORMAL, ADJOINT, F(-1), VB1_MC_STAR, U21_MR_STAR, F(1), AB2 );
+        V21_MR_STAR.AlignWith( AB2 );
+        Zeros( V21_MR_STAR, AB2.Width(), nb );
+        LocalGemm( ADJOINT, NORMAL, F(1), AB2, UB1_MC_STAR, F(0), V21_MR_STAR );
+        El::AllReduce( V21_MR_STAR, AB2.ColComm() );
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), G11_STAR_STAR, V21_MR_STAR );
+        LocalGemm
+        ( NORMAL, ADJOINT, F(-1), UB1_MC_STAR, V21_MR_STAR, F(1), AB2 );
+    }
+}
+
 } // namespace hessenberg
 } // namespace El
 
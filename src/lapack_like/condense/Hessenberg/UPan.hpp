@@ -226,6 +226,116 @@ void UPan
     }
 }
 
+template<typename F>
+void UPan
+( DistMatrix<F,MC,MR,BLOCK>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  DistMatrix<F,MC,STAR,BLOCK>& U_MC_STAR,
+  DistMatrix<F,MR,STAR,BLOCK>& U_MR_STAR,
+  DistMatrix<F,MC,STAR,BLOCK>& V_MC_STAR,
+  DistMatrix<F,STAR,STAR>& G_STAR_STAR )
+{
+    DEBUG_CSE
+    const Int nU = U_MC_STAR.Width();
+    const Int n = A.Height();
+    DEBUG_ONLY(
+      AssertSameGrids
+      ( A, householderScalars, U_MC_STAR, U_MR_STAR, V_MC_STAR, G_STAR_STAR );
+      if( A.ColAlign() != U_MC_STAR.ColAlign() ||
+          A.ColCut() != U_MC_STAR.ColCut() )
+          LogicError("A and U[MC,* ] must be aligned");
+      if( A.RowAlign() != U_MR_STAR.ColAlign() ||
+          A.RowCut() != U_MR_STAR.ColCut() )
+          LogicError("A and U[MR,* ] must be aligned");
+      if( A.ColAlign() != V_MC_STAR.ColAlign() ||
+          A.ColCut() != V_MC_STAR.ColCut() )
+          LogicError("A and V[MC,* ] must be aligned");
+      if( nU >= n )
+          LogicError("V is too wide for the panel factorization");
+    )
+    const Grid& g = A.Grid();
+
+    Zeros( U_MC_STAR,   n,  nU );
+    Zeros( U_MR_STAR,   n,  nU );
+    Zeros( V_MC_STAR,   n,  nU );
+    Zeros( G_STAR_STAR, nU, nU );
+
+    DistMatrix<F,MC,  STAR,BLOCK> a1_MC(g);
+    DistMatrix<F,STAR,STAR,BLOCK> y10_STAR(g);
+
+    for( Int k=0; k<nU; ++k )
+    {
+        const Range<Int> ind0( 0,   k   ),
+                         ind1( k,   k+1 ),
+                         ind2( k+1, n   );
+
+        auto a21 = A( ind2,    ind1 );
+        auto a1  = A( IR(0,n), ind1 );
+        auto A2  = A( IR(0,n), ind2 );
+
+        auto alpha21T = A( IR(k+1,k+2), ind1 );
+        auto a21B     = A( IR(k+2,n),   ind1 );
+
+        auto U0_MC_STAR  = U_MC_STAR( IR(0,n), ind0 );
+        auto u10_MC      = U_MC_STAR( ind1,    ind0 );
+        auto u21_MC      = U_MC_STAR( ind2,    ind1 );
+        auto u21_MR      = U_MR_STAR( ind2,    ind1 );
+        auto U20_MR_STAR = U_MR_STAR( ind2,    ind0 );
+
+        auto V0_MC_STAR = V_MC_STAR( IR(0,n), ind0 );
+        auto v1_MC      = V_MC_STAR( IR(0,n), ind1 );
+
+        auto G00_STAR_STAR = G_STAR_STAR( ind0, ind0 );
+        auto g10_STAR      = G_STAR_STAR( ind1, ind0 );
+        auto gamma11       = G_STAR_STAR( ind1, ind1 );
+
+        // a1 := (I - U0 inv(G00) U0^H) (a1 - V0 inv(G00)^H u10^H)
+        // -------------------------------------------------------
+        // a1 := a1 - V0 inv(G00)^H u10^H
+        a1_MC.AlignWith( a1 );
+        a1_MC = a1;
+        Conjugate( u10_MC, y10_STAR );
+        Trsv
+        ( LOWER, ADJOINT, NON_UNIT,
+          G00_STAR_STAR.LockedMatrix(), y10_STAR.Matrix() );
+        LocalGemv( NORMAL, F(-1), V0_MC_STAR, y10_STAR, F(1), a1_MC );
+        // a1 := a1 - U0 (inv(G00) (U0^H a1))
+        LocalGemv( ADJOINT, F(1), U0_MC_STAR, a1_MC, F(0), y10_STAR );
+        El::AllReduce( y10_STAR, U0_MC_STAR.ColComm() );
+        Trsv
+        ( LOWER, NORMAL, NON_UNIT,
+          G00_STAR_STAR.LockedMatrix(), y10_STAR.Matrix() );
+        LocalGemv( NORMAL, F(-1), U0_MC_STAR, y10_STAR, F(1), a1_MC );
+        a1 = a1_MC;
+
+        // Find tau and v such that
+        //  / I - tau | 1 | | 1, v^H | \ | alpha21T | = | beta |
+        //  \         | v |            / |     a21B |   |    0 |
+        const F tau = LeftReflector( alpha21T, a21B );
+        householderScalars.Set(k,0,tau);
+
+        // Store u21 := | 1 |
+        //              | v |
+        u21_MC = a21;
+        u21_MR = a21;
+        u21_MC.Set(0,0,F(1));
+        u21_MR.Set(0,0,F(1));
+
+        // v1 := A2 u21
+        LocalGemv( NORMAL, F(1), A2, u21_MR, F(0), v1_MC );
+        El::AllReduce( v1_MC, A2.RowComm() );
+
+        // g10 := u21^H U20 = (U20^H u21)^H
+        LocalGemv
+        ( ADJOINT, F(1), U20_MR_STAR, u21_MR, F(0), g10_STAR );
+        El::AllReduce( g10_STAR, U20_MR_STAR.ColComm() );
+        Conjugate( g10_STAR );
+
+        // gamma11 := 1/tau
+        gamma11.Set(0,0,F(1)/tau);
+    }
+}
+
 } // namespace hessenberg
 } // namespace El
 
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./Util.hpp"
+#include "./ScaledExtrema.hpp"
 
 // The following routines are adaptations of the approach uses by 
 // Saunders et al. (originally recommended by Joseph Fourer) for iteratively 
@@ -23,96 +24,99 @@ namespace El {
 
 // TODO: Make this consistent with ConeGeomEquil
 
-template<typename F>
-void GeomEquil
-( Matrix<F>& A,
-  Matrix<Base<F>>& dRow,
-  Matrix<Base<F>>& dCol,
+// TODO: Expose these as control parameters
+static const Int geomMinIter = 3;
+static const Int geomMaxIter = 12;
+
+// The unstacked routines simultaneously rescale each row and column by the
+// square-root of its (damped) geometric scaling so that the extrema needed
+// by each iteration can be computed with a single pass over (and reduction
+// for) the implicitly-scaled matrix. The scalings are only applied to A once
+// the iteration has finished. The extrema of the final implicitly-scaled
+// matrix are left in 'extrema', and false is returned if A is zero.
+template<typename Real>
+bool GeomIteration
+( function<void(equil::Extrema<Real>&,Real&,Real&)> scaledExtrema,
+  function<void(equil::Extrema<Real>&,Real)> update,
+  equil::Extrema<Real>& extrema,
   bool progress )
 {
     DEBUG_CSE
-    typedef Base<F> Real;
-    const Int m = A.Height();
-    const Int n = A.Width();
-    Ones( dRow, m, 1 );
-    Ones( dCol, n, 1 );
-
-    // TODO: Expose these as control parameters
-    const Int minIter = 3;
-    const Int maxIter = 6; 
     const Real damp = Real(1)/Real(1000);
     const Real relTol = Real(9)/Real(10);
+    const Real sqrtDamp = Sqrt(damp);
 
     // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
-    if( maxAbsVal == Real(0) )
-        return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
-    Real ratio = maxAbsVal / minAbsVal;
+    Real maxAbs, invMinAbs;
+    scaledExtrema( extrema, maxAbs, invMinAbs );
+    if( maxAbs == Real(0) )
+        return false;
+    Real ratio = maxAbs*invMinAbs;
     if( progress )
-        Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
+        Output("Original ratio is ",maxAbs,"/",1/invMinAbs,"=",ratio);
 
-    const Real sqrtDamp = Sqrt(damp);
     const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
+    for( Int iter=0; iter<geomMaxIter; ++iter )
     {
-        // Geometrically equilibrate the columns
-        for( Int j=0; j<n; ++j )
-        {
-            auto aCol = A( ALL, IR(j) );
-            auto maxColAbs = VectorMaxAbsLoc( aCol );
-            const Real maxColAbsVal = maxColAbs.value;
-            if( maxColAbsVal > Real(0) )
-            {
-                const Real minColAbsVal = MinAbsNonzero( aCol, maxColAbsVal );
-                const Real propScale = Sqrt(minColAbsVal*maxColAbsVal);
-                const Real scale = Max(propScale,sqrtDamp*maxColAbsVal);
-                aCol *= 1/scale;
-                dCol(j) *= scale;
-            }
-        }
-
-        // Geometrically equilibrate the rows
-        for( Int i=0; i<m; ++i )
-        {
-            auto aRow = A( IR(i), ALL );
-            auto maxRowAbs = VectorMaxAbsLoc( aRow );
-            const Real maxRowAbsVal = maxRowAbs.value;
-            if( maxRowAbsVal > Real(0) )
-            {
-                const Real minRowAbsVal = MinAbsNonzero( aRow, maxRowAbsVal );
-                const Real propScale = Sqrt(minRowAbsVal*maxRowAbsVal);
-                const Real scale = Max(propScale,sqrtDamp*maxRowAbsVal);
-                aRow *= 1/scale;
-                dRow(i) *= scale;
-            }
-        }
-
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newRatio = newMaxAbsVal / newMinAbsVal;
+        update( extrema, sqrtDamp );
+        scaledExtrema( extrema, maxAbs, invMinAbs );
+        const Real newRatio = maxAbs*invMinAbs;
         if( progress )
-            Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
-        if( iter >= minIter && newRatio >= ratio*relTol )
+            Output("New ratio is ",maxAbs,"/",1/invMinAbs,"=",newRatio);
+        if( iter >= geomMinIter && newRatio >= ratio*relTol )
             break;
         ratio = newRatio;
     }
     SetIndent( indent );
+    return true;
+}
+
+template<typename Real>
+void GeomUpdate
+( equil::Extrema<Real>& extrema, Real sqrtDamp, Real* dRow, Real* dCol )
+{
+    for( Int i=0; i<extrema.numRows; ++i )
+        dRow[i] *= Sqrt(equil::GeometricScale
+          (extrema.RowMax(i),extrema.RowInvMin(i),sqrtDamp));
+    for( Int j=0; j<extrema.numCols; ++j )
+        dCol[j] *= Sqrt(equil::GeometricScale
+          (extrema.ColMax(j),extrema.ColInvMin(j),sqrtDamp));
+}
+
+template<typename F>
+void GeomEquil
+( Matrix<F>& A,
+  Matrix<Base<F>>& dRow,
+  Matrix<Base<F>>& dCol,
+  bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Ones( dRow, m, 1 );
+    Ones( dCol, n, 1 );
+
+    equil::Extrema<Real> extrema;
+    auto scaledExtrema =
+      [&]( equil::Extrema<Real>& ext, Real& maxAbs, Real& invMinAbs )
+      {
+          equil::ScaledExtrema( A, dRow, dCol, ext, true );
+          ext.RowExtremes( maxAbs, invMinAbs );
+      };
+    auto update =
+      [&]( equil::Extrema<Real>& ext, Real sqrtDamp )
+      { GeomUpdate( ext, sqrtDamp, dRow.Buffer(), dCol.Buffer() ); };
+    if( !GeomIteration<Real>( scaledExtrema, update, extrema, progress ) )
+        return;
 
     // Scale each column so that its maximum entry is 1 or 0
     for( Int j=0; j<n; ++j )
-    {
-        auto aCol = A( ALL, IR(j) );
-        auto maxColAbs = VectorMaxAbsLoc( aCol );
-        const Real maxColAbsVal = maxColAbs.value;
-        if( maxColAbsVal > Real(0) )
-        {
-            aCol *= 1/maxColAbsVal;
-            dCol(j) *= maxColAbsVal;
-        }
-    }
+        if( extrema.ColMax(j) > Real(0) )
+            dCol(j) *= extrema.ColMax(j);
+
+    DiagonalSolve( LEFT, NORMAL, dRow, A );
+    DiagonalSolve( RIGHT, NORMAL, dCol, A );
 }
 
 template<typename F>
@@ -262,78 +266,45 @@ void GeomEquil
     auto& dRow = dRowProx.Get();
     auto& dCol = dColProx.Get();
 
+    // The scalings are redundantly computed over the entire grid
     const Int m = A.Height();
     const Int n = A.Width();
-    const Int mLocal = A.LocalHeight();
-    const Int nLocal = A.LocalWidth();
-    Ones( dRow, m, 1 );
-    Ones( dCol, n, 1 );
-
-    // TODO: Expose these as control parameters
-    const Int minIter = 3;
-    const Int maxIter = 6; 
-    const Real relTol = Real(9)/Real(10);
-
-    // TODO: Incorporate damping
-    //const Real damp = Real(1)/Real(1000);
-    //const Real sqrtDamp = Sqrt(damp);
-
-    // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
-    if( maxAbsVal == Real(0) )
-        return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
-    Real ratio = maxAbsVal / minAbsVal;
-    if( progress && A.Grid().Rank() == 0 )
-        Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
-
-    DistMatrix<Real,MC,STAR> rowScale(A.Grid());
-    DistMatrix<Real,MR,STAR> colScale(A.Grid());
-    auto& colScaleLoc = colScale.Matrix();
-    auto& rowScaleLoc = rowScale.Matrix();
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
+    Matrix<Real> dRowFull, dColFull;
+    Ones( dRowFull, m, 1 );
+    Ones( dColFull, n, 1 );
+
+    equil::Extrema<Real> extrema;
+    auto scaledExtrema =
+      [&]( equil::Extrema<Real>& ext, Real& maxAbs, Real& invMinAbs )
+      {
+          equil::ScaledExtrema( A, dRowFull, dColFull, ext, true );
+          ext.RowExtremes( maxAbs, invMinAbs );
+      };
+    auto update =
+      [&]( equil::Extrema<Real>& ext, Real sqrtDamp )
+      {
+          GeomUpdate
+          ( ext, sqrtDamp, dRowFull.Buffer(), dColFull.Buffer() );
+      };
+    const bool print = progress && A.Grid().Rank() == 0;
+    if( GeomIteration<Real>( scaledExtrema, update, extrema, print ) )
     {
-        // Geometrically equilibrate the columns
-        // -------------------------------------
-        // TODO: Remove GeometricColumnScaling
-        GeometricColumnScaling( A, colScale ); 
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            if( colScaleLoc(jLoc) == Real(0) )
-                colScaleLoc(jLoc) = Real(1);
-        DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
-
-        // Geometrically equilibrate the rows
-        // ----------------------------------
-        // TODO: Remove GeometricRowScaling
-        GeometricRowScaling( A, rowScale );
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            if( rowScaleLoc(iLoc) == Real(0) )
-                rowScaleLoc(iLoc) = Real(1);
-        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
-
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newRatio = newMaxAbsVal / newMinAbsVal;
-        if( progress && A.Grid().Rank() == 0 )
-            Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
-        if( iter >= minIter && newRatio >= ratio*relTol )
-            break;
-        ratio = newRatio;
+        // Scale each column so that its maximum entry is 1 or 0
+        for( Int j=0; j<n; ++j )
+            if( extrema.ColMax(j) > Real(0) )
+                dColFull(j) *= extrema.ColMax(j);
     }
-    SetIndent( indent );
 
-    // Scale each column so that its maximum entry is 1 or 0
-    ColumnMaxNorms( A, colScale );
-    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-        if( colScaleLoc(jLoc) == Real(0) ) 
-            colScaleLoc(jLoc) = Real(1);
-    DiagonalScale( LEFT, NORMAL, colScale, dCol );
-    DiagonalSolve( RIGHT, NORMAL, colScale, A );
+    dRow.Resize( m, 1 );
+    dCol.Resize( n, 1 );
+    auto& dRowLoc = dRow.Matrix();
+    auto& dColLoc = dCol.Matrix();
+    for( Int iLoc=0; iLoc<dRow.LocalHeight(); ++iLoc )
+        dRowLoc(iLoc) = dRowFull(dRow.GlobalRow(iLoc));
+    for( Int jLoc=0; jLoc<dCol.LocalHeight(); ++jLoc )
+        dColLoc(jLoc) = dColFull(dCol.GlobalRow(jLoc));
+    DiagonalSolve( LEFT, NORMAL, dRow, A );
+    DiagonalSolve( RIGHT, NORMAL, dCol, A );
 }
 
 template<typename F>
@@ -482,102 +453,28 @@ void GeomEquil
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
 
-    // TODO: Expose these as control parameters
-    const Int minIter = 3;
-    const Int maxIter = 6; 
-    const Real damp = Real(1)/Real(1000);
-    const Real relTol = Real(9)/Real(10);
-
-    // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
-    if( maxAbsVal == Real(0) )
+    equil::Extrema<Real> extrema;
+    auto scaledExtrema =
+      [&]( equil::Extrema<Real>& ext, Real& maxAbs, Real& invMinAbs )
+      {
+          equil::ScaledExtrema( A, dRow, dCol, ext, true );
+          ext.RowExtremes( maxAbs, invMinAbs );
+      };
+    auto update =
+      [&]( equil::Extrema<Real>& ext, Real sqrtDamp )
+      { GeomUpdate( ext, sqrtDamp, dRow.Buffer(), dCol.Buffer() ); };
+    if( !GeomIteration<Real>( scaledExtrema, update, extrema, progress ) )
         return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
-    Real ratio = maxAbsVal / minAbsVal;
-    if( progress )
-        Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
-
-    const Real sqrtDamp = Sqrt(damp);
-    Matrix<Real> rowScale(m,1), colScale(n,1), maxAbsVals, minAbsVals;
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Geometrically rescale the columns
-        // ---------------------------------
-        ColumnMaxNorms( A, maxAbsVals );
-        ColumnMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        for( Int j=0; j<n; ++j )
-        {
-            const Real maxAbs = maxAbsVals(j);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsVals(j);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                colScale(j) = scale;
-            }
-            else
-            {
-                colScale(j) = 1;
-            }
-        }
-        DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
-
-        // Geometrically rescale the rows
-        // ------------------------------ 
-        RowMaxNorms( A, maxAbsVals );
-        RowMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        for( Int i=0; i<m; ++i )
-        {
-            const Real maxAbs = maxAbsVals(i);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsVals(i);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                rowScale(i) = scale;
-            } 
-            else
-                rowScale(i) = Real(1);
-        }
-        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
-
-        // Determine whether we are done or not
-        // ------------------------------------
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newRatio = newMaxAbsVal / newMinAbsVal;
-        if( progress )
-            Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
-        if( iter >= minIter && newRatio >= ratio*relTol )
-            break;
-        ratio = newRatio;
-    }
-    SetIndent( indent );
 
     // Scale each row so that its maximum entry is 1 or 0
-    F* valBuf = A.ValueBuffer();
     for( Int i=0; i<m; ++i )
-    {
-        const Int offset = A.RowOffset(i);
-        const Int numConnect = A.NumConnections(i);
+        if( extrema.RowMax(i) > Real(0) )
+            dRow(i) *= extrema.RowMax(i);
 
-        // Compute the maximum value in this row
-        Real maxRowAbs = 0;
-        for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(A.Value(e)));
-
-        if( maxRowAbs > Real(0) )
-        {
-            dRow(i) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
-                valBuf[e] /= maxRowAbs;
-        }
-    }
+    const Int numEntries = A.NumEntries();
+    F* valBuf = A.ValueBuffer();
+    for( Int e=0; e<numEntries; ++e )
+        valBuf[e] /= dRow(A.Row(e))*dCol(A.Col(e));
 }
 
 template<typename F>
@@ -762,108 +659,51 @@ void GeomEquil
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
 
-    // TODO: Expose these as control parameters
-    const Int minIter = 3;
-    const Int maxIter = 6; 
-    const Real damp = Real(1)/Real(1000);
-    const Real relTol = Real(9)/Real(10);
-
-    // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
-    if( maxAbsVal == Real(0) )
+    // The column scalings are owned with the distribution of dCol but are
+    // also cached for each of the column slots of the local nonzeros
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    vector<Real> dColSlots( meta.numRecvInds, Real(1) );
+    auto& dRowLoc = dRow.Matrix();
+    auto& dColLoc = dCol.Matrix();
+    const Int firstLocalCol = dCol.FirstLocalRow();
+    const Int localWidth = dCol.LocalHeight();
+
+    equil::Extrema<Real> extrema;
+    auto scaledExtrema =
+      [&]( equil::Extrema<Real>& ext, Real& maxAbs, Real& invMinAbs )
+      {
+          equil::ScaledExtrema
+          ( A, dRowLoc, dColSlots, firstLocalCol, localWidth, ext, true );
+          Real extremes[2];
+          ext.RowExtremes( extremes[0], extremes[1] );
+          mpi::AllReduce( extremes, 2, mpi::MAX, comm );
+          maxAbs = extremes[0];
+          invMinAbs = extremes[1];
+      };
+    auto update =
+      [&]( equil::Extrema<Real>& ext, Real sqrtDamp )
+      {
+          GeomUpdate( ext, sqrtDamp, dRowLoc.Buffer(), dColLoc.Buffer() );
+          equil::PullColumnScalings( A, dColLoc, firstLocalCol, dColSlots );
+      };
+    const bool print = progress && commRank == 0;
+    if( !GeomIteration<Real>( scaledExtrema, update, extrema, print ) )
         return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
-    Real ratio = maxAbsVal / minAbsVal;
-    if( progress && commRank == 0 )
-        Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
-
-    const Real sqrtDamp = Sqrt(damp);
-    DistMultiVec<Real> maxAbsVals(comm), minAbsVals(comm), scales(comm);
-    auto& scalesLoc = scales.Matrix();
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Geometrically rescale the columns
-        // ---------------------------------
-        ColumnMaxNorms( A, maxAbsVals );
-        ColumnMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        auto& maxAbsValsLoc = maxAbsVals.Matrix();
-        auto& minAbsValsLoc = minAbsVals.Matrix();
-        scales.Resize( n, 1 );
-        const Int localWidth = maxAbsVals.LocalHeight(); 
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Real maxAbs = maxAbsValsLoc(jLoc);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsLoc(jLoc);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                scalesLoc(jLoc) = scale;
-            }
-            else
-                scalesLoc(jLoc) = 1;
-        }
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-
-        // Geometrically rescale the rows
-        // ------------------------------ 
-        RowMaxNorms( A, maxAbsVals );
-        RowMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        scales.Resize( m, 1 ); 
-        const Int localHeight = maxAbsVals.LocalHeight();
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Real maxAbs = maxAbsValsLoc(iLoc);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsLoc(iLoc);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                scalesLoc(iLoc) = scale;
-            }
-            else
-                scalesLoc(iLoc) = 1;
-        }
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
-
-        // Determine whether we are done or not
-        // ------------------------------------
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newRatio = newMaxAbsVal / newMinAbsVal;
-        if( progress && commRank == 0 )
-            Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
-        if( iter >= minIter && newRatio >= ratio*relTol )
-            break;
-        ratio = newRatio;
-    }
-    SetIndent( indent );
 
     // Scale each row so that its maximum entry is 1 or 0
-    F* valBuf = A.ValueBuffer();
     const Int localHeight = A.LocalHeight();
-    auto& dRowLoc = dRow.Matrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( extrema.RowMax(iLoc) > Real(0) )
+            dRowLoc(iLoc) *= extrema.RowMax(iLoc);
+
+    F* valBuf = A.ValueBuffer();
     for( Int iLoc=0; iLoc<localHeight; ++iLoc )
     {
         const Int offset = A.RowOffset(iLoc);
         const Int numConnect = A.NumConnections(iLoc);
-
-        // Compute the maximum value in this row
-        Real maxRowAbs = 0;
         for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(A.Value(e)));
-
-        if( maxRowAbs > Real(0) )
-        {
-            dRowLoc(iLoc) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
-                valBuf[e] /= maxRowAbs;
-        }
+            valBuf[e] /= dRowLoc(iLoc)*dColSlots[meta.colOffs[e]];
     }
 }
 
@@ -7,6 +7,14 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./ScaledExtrema.hpp"
+
+// The unstacked routines simultaneously rescale each row and column by the
+// square-root of its maximum magnitude, as in Daniel Ruiz's "A scaling
+// algorithm to equilibrate both rows and columns norms in matrices", so that
+// the row and column norms of each iteration can be computed with a single
+// pass over (and reduction for) the implicitly-scaled matrix. The scalings
+// are only applied to A once the iteration has finished.
 
 namespace El {
 
@@ -20,6 +28,19 @@ Real DampScaling( Real alpha )
         return Max(alpha,tol);
 }
 
+// TODO: Expose these as control parameters
+// For now, simply hard-code the number of iterations
+static const Int ruizMaxIter = 8;
+
+template<typename Real>
+void RuizUpdate( equil::Extrema<Real>& extrema, Real* dRow, Real* dCol )
+{
+    for( Int i=0; i<extrema.numRows; ++i )
+        dRow[i] *= Sqrt(DampScaling(extrema.RowMax(i)));
+    for( Int j=0; j<extrema.numCols; ++j )
+        dCol[j] *= Sqrt(DampScaling(extrema.ColMax(j)));
+}
+
 template<typename F>
 void RuizEquil
 ( Matrix<F>& A, 
@@ -28,7 +49,21 @@ void RuizEquil
   bool progress )
 {
     DEBUG_CSE
-    LogicError("This routine is not yet written");
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Ones( dRow, m, 1 );
+    Ones( dCol, n, 1 );
+
+    equil::Extrema<Real> extrema;
+    for( Int iter=0; iter<ruizMaxIter; ++iter )
+    {
+        equil::ScaledExtrema( A, dRow, dCol, extrema, false );
+        RuizUpdate( extrema, dRow.Buffer(), dCol.Buffer() );
+    }
+
+    DiagonalSolve( LEFT, NORMAL, dRow, A );
+    DiagonalSolve( RIGHT, NORMAL, dCol, A );
 }
 
 template<typename F>
@@ -54,35 +89,30 @@ void RuizEquil
     auto& dRow = dRowProx.Get();
     auto& dCol = dColProx.Get();
 
+    // The scalings are redundantly computed over the entire grid
     const Int m = A.Height();
     const Int n = A.Width();
-    Ones( dRow, m, 1 );
-    Ones( dCol, n, 1 );
-
-    // TODO: Expose these as control parameters
-    // For now, simply hard-code the number of iterations
-    const Int maxIter = 4; 
+    Matrix<Real> dRowFull, dColFull;
+    Ones( dRowFull, m, 1 );
+    Ones( dColFull, n, 1 );
 
-    DistMatrix<Real,MC,STAR> rowScale(A.Grid());
-    DistMatrix<Real,MR,STAR> colScale(A.Grid());
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
+    equil::Extrema<Real> extrema;
+    for( Int iter=0; iter<ruizMaxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, colScale );
-        EntrywiseMap( colScale, function<Real(Real)>(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, function<Real(Real)>(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
+        equil::ScaledExtrema( A, dRowFull, dColFull, extrema, false );
+        RuizUpdate( extrema, dRowFull.Buffer(), dColFull.Buffer() );
     }
-    SetIndent( indent );
+
+    dRow.Resize( m, 1 );
+    dCol.Resize( n, 1 );
+    auto& dRowLoc = dRow.Matrix();
+    auto& dColLoc = dCol.Matrix();
+    for( Int iLoc=0; iLoc<dRow.LocalHeight(); ++iLoc )
+        dRowLoc(iLoc) = dRowFull(dRow.GlobalRow(iLoc));
+    for( Int jLoc=0; jLoc<dCol.LocalHeight(); ++jLoc )
+        dColLoc(jLoc) = dColFull(dCol.GlobalRow(jLoc));
+    DiagonalSolve( LEFT, NORMAL, dRow, A );
+    DiagonalSolve( RIGHT, NORMAL, dCol, A );
 }
 
 template<typename F>
@@ -99,29 +129,17 @@ void RuizEquil
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
 
-    // TODO: Expose these as control parameters
-    // For now, simply hard-code the number of iterations
-    const Int maxIter = 4; 
-
-    Matrix<Real> scales;
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
+    equil::Extrema<Real> extrema;
+    for( Int iter=0; iter<ruizMaxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        EntrywiseMap( scales, function<Real(Real)>(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, function<Real(Real)>(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
+        equil::ScaledExtrema( A, dRow, dCol, extrema, false );
+        RuizUpdate( extrema, dRow.Buffer(), dCol.Buffer() );
     }
-    SetIndent( indent );
+
+    const Int numEntries = A.NumEntries();
+    F* valBuf = A.ValueBuffer();
+    for( Int e=0; e<numEntries; ++e )
+        valBuf[e] /= dRow(A.Row(e))*dCol(A.Col(e));
 }
 
 template<typename F>
@@ -141,29 +159,34 @@ void RuizEquil
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
 
-    // TODO: Expose to control structure
-    // For, simply hard-code a small number of iterations
-    const Int maxIter = 4;
-
-    DistMultiVec<Real> scales(comm);
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
+    // The column scalings are owned with the distribution of dCol but are
+    // also cached for each of the column slots of the local nonzeros
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    vector<Real> dColSlots( meta.numRecvInds, Real(1) );
+    auto& dRowLoc = dRow.Matrix();
+    auto& dColLoc = dCol.Matrix();
+    const Int firstLocalCol = dCol.FirstLocalRow();
+    const Int localWidth = dCol.LocalHeight();
+
+    equil::Extrema<Real> extrema;
+    for( Int iter=0; iter<ruizMaxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        EntrywiseMap( scales, function<Real(Real)>(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
+        equil::ScaledExtrema
+        ( A, dRowLoc, dColSlots, firstLocalCol, localWidth, extrema, false );
+        RuizUpdate( extrema, dRowLoc.Buffer(), dColLoc.Buffer() );
+        equil::PullColumnScalings( A, dColLoc, firstLocalCol, dColSlots );
+    }
 
-        // Rescale the rows 
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, function<Real(Real)>(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
+    const Int localHeight = A.LocalHeight();
+    F* valBuf = A.ValueBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int offset = A.RowOffset(iLoc);
+        const Int numConnect = A.NumConnections(iLoc);
+        for( Int e=offset; e<offset+numConnect; ++e )
+            valBuf[e] /= dRowLoc(iLoc)*dColSlots[meta.colOffs[e]];
     }
-    SetIndent( indent );
 }
 
 template<typename F>
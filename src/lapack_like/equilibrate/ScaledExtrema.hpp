@@ -0,0 +1,279 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_EQUILIBRATE_SCALEDEXTREMA_HPP
+#define EL_EQUILIBRATE_SCALEDEXTREMA_HPP
+
+// The following routines compute, in a single pass over the nonzeros of A,
+// the maximum (and, optionally, the minimum nonzero) magnitude of each row
+// and column of the implicitly-scaled matrix diag(dRow)^{-1} A diag(dCol)^{-1}
+// so that iterative equilibration schemes need neither separate row and
+// column sweeps nor to explicitly rescale A until they have converged.
+//
+// In order for a single MAX reduction to combine all of the (partial) row and
+// column extrema, each minimum is stored as the reciprocal of its magnitude,
+// with a value of zero marking a row or column without any nonzeros.
+
+namespace El {
+namespace equil {
+
+template<typename Real>
+struct Extrema
+{
+    Int numRows=0, numCols=0;
+    bool mins=false;
+
+    // [rowMax; colMax; rowInvMin; colInvMin], where the last two blocks are
+    // only present when mins is true
+    vector<Real> buffer;
+
+    void Reset( Int numRowsNew, Int numColsNew, bool minsNew )
+    {
+        numRows = numRowsNew;
+        numCols = numColsNew;
+        mins = minsNew;
+        buffer.assign( (mins?2:1)*(numRows+numCols), Real(0) );
+    }
+
+    Real& RowMax( Int i ) { return buffer[i]; }
+    Real& ColMax( Int j ) { return buffer[numRows+j]; }
+    Real& RowInvMin( Int i ) { return buffer[numRows+numCols+i]; }
+    Real& ColInvMin( Int j ) { return buffer[2*numRows+numCols+j]; }
+
+    void Update( Int i, Int j, Real absVal )
+    {
+        if( absVal == Real(0) )
+            return;
+        RowMax(i) = Max(RowMax(i),absVal);
+        ColMax(j) = Max(ColMax(j),absVal);
+        if( mins )
+        {
+            const Real invAbs = 1/absVal;
+            RowInvMin(i) = Max(RowInvMin(i),invAbs);
+            ColInvMin(j) = Max(ColInvMin(j),invAbs);
+        }
+    }
+
+    // Return the maximum over all rows of the maximum magnitude and, if
+    // requested, of the reciprocal of the minimum nonzero magnitude
+    void RowExtremes( Real& maxAbs, Real& invMinAbs )
+    {
+        maxAbs = invMinAbs = 0;
+        for( Int i=0; i<numRows; ++i )
+        {
+            maxAbs = Max(maxAbs,RowMax(i));
+            if( mins )
+                invMinAbs = Max(invMinAbs,RowInvMin(i));
+        }
+    }
+};
+
+// Return the geometric scaling sqrt(min*max), which is damped so that it is
+// at least sqrtDamp*max, of a row or column (or one if it is zero)
+template<typename Real>
+Real GeometricScale( Real maxAbs, Real invMinAbs, Real sqrtDamp )
+{
+    if( maxAbs == Real(0) )
+        return Real(1);
+    return Max( Sqrt(maxAbs/invMinAbs), sqrtDamp*maxAbs );
+}
+
+template<typename F>
+void ScaledExtrema
+( const Matrix<F>& A,
+  const Matrix<Base<F>>& dRow,
+  const Matrix<Base<F>>& dCol,
+  Extrema<Base<F>>& extrema, bool mins )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    extrema.Reset( m, n, mins );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            extrema.Update( i, j, Abs(A(i,j))/(dRow(i)*dCol(j)) );
+}
+
+// The scalings are replicated over the entire grid so that the partial
+// extrema of all rows and columns can be combined with a single reduction
+template<typename F>
+void ScaledExtrema
+( const DistMatrix<F>& A,
+  const Matrix<Base<F>>& dRow,
+  const Matrix<Base<F>>& dCol,
+  Extrema<Base<F>>& extrema, bool mins )
+{
+    DEBUG_CSE
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    auto& ALoc = A.LockedMatrix();
+    extrema.Reset( A.Height(), A.Width(), mins );
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            extrema.Update( i, j, Abs(ALoc(iLoc,jLoc))/(dRow(i)*dCol(j)) );
+        }
+    }
+    mpi::AllReduce
+    ( extrema.buffer.data(), extrema.buffer.size(), mpi::MAX,
+      A.DistComm() );
+}
+
+template<typename F>
+void ScaledExtrema
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& dRow,
+  const Matrix<Base<F>>& dCol,
+  Extrema<Base<F>>& extrema, bool mins )
+{
+    DEBUG_CSE
+    const Int numEntries = A.NumEntries();
+    extrema.Reset( A.Height(), A.Width(), mins );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        const Int j = A.Col(e);
+        extrema.Update( i, j, Abs(A.Value(e))/(dRow(i)*dCol(j)) );
+    }
+}
+
+// Exchange 'width' values per column index between the processes which own
+// the columns of A (in the distribution of a DistMultiVec of height A.Width())
+// and the processes with nonzeros in them, using the communication pattern of
+// sparse matrix-vector multiplication. If 'adjoint' is true, the values are
+// sent from the (compressed) column slots of the nonzeros to the owners.
+template<typename F,typename Real>
+void ExchangeColumnValues
+( const DistSparseMatrix<F>& A, bool adjoint, Int width,
+  const vector<Real>& sendVals, vector<Real>& recvVals )
+{
+    DEBUG_CSE
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const Int numRecvInds =
+      ( adjoint ? Int(meta.sendInds.size()) : meta.numRecvInds );
+    recvVals.resize( numRecvInds*width );
+    if( meta.neighborComm )
+    {
+        vector<int> sendCounts, sendDispls, recvCounts, recvDispls;
+        meta.NeighborCounts
+        ( adjoint, width, sendCounts, sendDispls, recvCounts, recvDispls );
+        mpi::NeighborAllToAll
+        ( sendVals.data(), sendCounts.data(), sendDispls.data(),
+          recvVals.data(), recvCounts.data(), recvDispls.data(),
+          adjoint ? *meta.adjointNeighborComm : *meta.neighborComm );
+    }
+    else
+    {
+        const int commSize = mpi::Size( A.Comm() );
+        vector<int> sendSizes( adjoint ? meta.recvSizes : meta.sendSizes ),
+                    sendOffs( adjoint ? meta.recvOffs : meta.sendOffs ),
+                    recvSizes( adjoint ? meta.sendSizes : meta.recvSizes ),
+                    recvOffs( adjoint ? meta.sendOffs : meta.recvOffs );
+        for( int q=0; q<commSize; ++q )
+        {
+            sendSizes[q] *= width;
+            sendOffs[q] *= width;
+            recvSizes[q] *= width;
+            recvOffs[q] *= width;
+        }
+        mpi::AllToAll
+        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
+          recvVals.data(), recvSizes.data(), recvOffs.data(), A.Comm() );
+    }
+}
+
+// Each process holds the scalings of its local rows in dRowLoc and the
+// column scaling of each of the column slots of its nonzeros in dColSlots.
+// The row extrema are for the local rows and the column extrema are for the
+// columns owned by this process (beginning with firstLocalCol), which are
+// combined from their partial values with a single exchange.
+template<typename F>
+void ScaledExtrema
+( const DistSparseMatrix<F>& A,
+  const Matrix<Base<F>>& dRowLoc,
+  const vector<Base<F>>& dColSlots,
+        Int firstLocalCol,
+        Int localWidth,
+  Extrema<Base<F>>& extrema, bool mins )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const Int localHeight = A.LocalHeight();
+    const Int numSlots = meta.numRecvInds;
+    const F* valBuf = A.LockedValueBuffer();
+
+    Extrema<Real> slotExtrema;
+    slotExtrema.Reset( localHeight, numSlots, mins );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int offset = A.RowOffset(iLoc);
+        const Int numConnect = A.NumConnections(iLoc);
+        for( Int e=offset; e<offset+numConnect; ++e )
+        {
+            const Int s = meta.colOffs[e];
+            slotExtrema.Update
+            ( iLoc, s, Abs(valBuf[e])/(dRowLoc(iLoc)*dColSlots[s]) );
+        }
+    }
+
+    // Send the (interleaved) partial column extrema to their owners
+    const Int width = ( mins ? 2 : 1 );
+    vector<Real> sendVals( numSlots*width ), recvVals;
+    for( Int s=0; s<numSlots; ++s )
+    {
+        sendVals[s*width] = slotExtrema.ColMax(s);
+        if( mins )
+            sendVals[s*width+1] = slotExtrema.ColInvMin(s);
+    }
+    ExchangeColumnValues( A, true, width, sendVals, recvVals );
+
+    extrema.Reset( localHeight, localWidth, mins );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        extrema.RowMax(iLoc) = slotExtrema.RowMax(iLoc);
+        if( mins )
+            extrema.RowInvMin(iLoc) = slotExtrema.RowInvMin(iLoc);
+    }
+    const Int numOwnedSlots = meta.sendInds.size();
+    for( Int s=0; s<numOwnedSlots; ++s )
+    {
+        const Int jLoc = meta.sendInds[s] - firstLocalCol;
+        extrema.ColMax(jLoc) = Max(extrema.ColMax(jLoc),recvVals[s*width]);
+        if( mins )
+            extrema.ColInvMin(jLoc) =
+              Max(extrema.ColInvMin(jLoc),recvVals[s*width+1]);
+    }
+}
+
+// Send the scalings of the owned columns to each of the column slots which
+// reference them
+template<typename F>
+void PullColumnScalings
+( const DistSparseMatrix<F>& A,
+  const Matrix<Base<F>>& dColLoc,
+        Int firstLocalCol,
+  vector<Base<F>>& dColSlots )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const Int numOwnedSlots = meta.sendInds.size();
+    vector<Real> sendVals( numOwnedSlots );
+    for( Int s=0; s<numOwnedSlots; ++s )
+        sendVals[s] = dColLoc( meta.sendInds[s]-firstLocalCol );
+    ExchangeColumnValues( A, false, 1, sendVals, dColSlots );
+}
+
+} // namespace equil
+} // namespace El
+
+#endif // ifndef EL_EQUILIBRATE_SCALEDEXTREMA_HPP
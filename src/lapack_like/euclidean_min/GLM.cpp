@@ -8,8 +8,6 @@
 */
 #include <El.hpp>
 
-#include "El/core/FlamePart.hpp"
-
 // This file implements both dense and sparse-direct solutions of 
 // General (Gauss-Markov) Linear Model (GLM):
 //
@@ -53,45 +51,73 @@ namespace El {
 
 namespace glm {
 
-// For the following two routines, on exit, A and B are overwritten with their 
-// implicit Generalized QR factorization and D is overwritten with X
-template<typename F> 
-void Overwrite( Matrix<F>& A, Matrix<F>& B, Matrix<F>& D, Matrix<F>& Y )
+// Given the implicit Generalized QR factorization of (A,B) and G = Q^H D,
+// overwrite G with X and set Y
+template<typename F>
+void SolveAfterQ
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& householderScalarsB,
+  const Matrix<Base<F>>& signatureB,
+        Matrix<F>& G,
+        Matrix<F>& Y )
 {
     DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
     const Int p = B.Width();
-    const Int numRhs = D.Width();
-    if( m != B.Height() || m != D.Height() )
-        LogicError("A, B, and D must be the same height");
-    if( m < n )
-        LogicError("GLM requires height(A) >= width(A)");
-    if( n+p < m )
-        LogicError("GLM requires width(A)+width(B) >= height(A)");
+    const Int numRhs = G.Width();
     const bool checkIfSingular = true;
 
-    // Compute the implicit Generalized QR decomposition of (A,B)
-    Matrix<F> tA, tB;
-    Matrix<Base<F>> dA, dB;
-    GQR( A, tA, dA, B, tB, dB );
+    // Partition the relevant matrices
+    auto G1 = G( IR(0,n), ALL );
+    auto G2 = G( IR(n,m), ALL );
+    auto R11 = A( IR(0,n), IR(0,n) );
+    auto T12 = B( IR(0,n), IR(n+p-m,p) );
+    auto T22 = B( IR(n,m), IR(n+p-m,p) );
+    Zeros( Y, p, numRhs );
+    auto C2 = Y( IR(n+p-m,p), ALL );
 
-    // G := Q^H D
-    qr::ApplyQ( LEFT, ADJOINT, A, tA, dA, D );
+    // Solve T22 C2 = G2
+    C2 = G2;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T22, C2, checkIfSingular );
+
+    // G1 := G1 - T12 C2
+    Gemm( NORMAL, NORMAL, F(-1), T12, C2, F(1), G1 );
+    
+    // Solve R11 X = G1 
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, G1, checkIfSingular );
+    G.Resize( n, numRhs );
+
+    // Y := Z^H C
+    rq::ApplyQ( LEFT, ADJOINT, B, householderScalarsB, signatureB, Y );
+}
+
+template<typename F>
+void SolveAfterQ
+( const DistMatrix<F>& A,
+  const DistMatrix<F>& B,
+  const DistMatrix<F,MD,STAR>& householderScalarsB,
+  const DistMatrix<Base<F>,MD,STAR>& signatureB,
+        DistMatrix<F>& G,
+        DistMatrix<F>& Y )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int p = B.Width();
+    const Int numRhs = G.Width();
+    const bool checkIfSingular = true;
 
     // Partition the relevant matrices
-    Matrix<F> G1, G2;
-    PartitionDown( D, G1, G2, n );
-    Matrix<F> R11, R21;
-    PartitionDown( A, R11, R21, n );
-    Matrix<F> T11, T12, T21, T22;
-    PartitionUpOffsetDiagonal
-    ( p-m,
-      B, T11, T12,
-         T21, T22, m-n );
+    auto G1 = G( IR(0,n), ALL );
+    auto G2 = G( IR(n,m), ALL );
+    auto R11 = A( IR(0,n), IR(0,n) );
+    auto T12 = B( IR(0,n), IR(n+p-m,p) );
+    auto T22 = B( IR(n,m), IR(n+p-m,p) );
+    Y.SetGrid( A.Grid() );
     Zeros( Y, p, numRhs );
-    Matrix<F> C1, C2;
-    PartitionDown( Y, C1, C2, n+p-m );
+    auto C2 = Y( IR(n+p-m,p), ALL );
 
     // Solve T22 C2 = G2
     C2 = G2;
@@ -100,12 +126,45 @@ void Overwrite( Matrix<F>& A, Matrix<F>& B, Matrix<F>& D, Matrix<F>& Y )
     // G1 := G1 - T12 C2
     Gemm( NORMAL, NORMAL, F(-1), T12, C2, F(1), G1 );
     
-    // Solve R11 X = G1 
+    // Solve R11 X = G1
     Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, G1, checkIfSingular );
-    D.Resize( n, numRhs );
+    G.Resize( n, numRhs );
 
     // Y := Z^H C
-    rq::ApplyQ( LEFT, ADJOINT, B, tB, dB, Y );
+    rq::ApplyQ( LEFT, ADJOINT, B, householderScalarsB, signatureB, Y );
+}
+
+template<typename F>
+void CheckDimensions( Int m, Int n, Int p )
+{
+    if( m < n )
+        LogicError("GLM requires height(A) >= width(A)");
+    if( n+p < m )
+        LogicError("GLM requires width(A)+width(B) >= height(A)");
+}
+
+// For the following two routines, on exit, A and B are overwritten with their 
+// implicit Generalized QR factorization and D is overwritten with X
+template<typename F> 
+void Overwrite( Matrix<F>& A, Matrix<F>& B, Matrix<F>& D, Matrix<F>& Y )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int p = B.Width();
+    if( m != B.Height() || m != D.Height() )
+        LogicError("A, B, and D must be the same height");
+    CheckDimensions<F>( m, n, p );
+
+    // Compute the implicit Generalized QR decomposition of (A,B)
+    Matrix<F> tA, tB;
+    Matrix<Base<F>> dA, dB;
+    GQR( A, tA, dA, B, tB, dB );
+
+    // G := Q^H D
+    qr::ApplyQ( LEFT, ADJOINT, A, tA, dA, D );
+
+    SolveAfterQ( A, B, tB, dB, D, Y );
 }
 
 template<typename F> 
@@ -131,18 +190,12 @@ void Overwrite
     const Int m = A.Height();
     const Int n = A.Width();
     const Int p = B.Width();
-    const Int numRhs = D.Width();
     if( m != B.Height() || m != D.Height() )
         LogicError("A, B, and D must be the same height");
-    if( m < n )
-        LogicError("GLM requires height(A) >= width(A)");
-    if( n+p < m )
-        LogicError("GLM requires width(A)+width(B) >= height(A)");
+    CheckDimensions<F>( m, n, p );
     const Grid& g = A.Grid();
     if( g != B.Grid() || g != D.Grid() )
         LogicError("All matrices must have the same grid");
-    Y.SetGrid( g );
-    const bool checkIfSingular = true;
 
     // Compute the implicit Generalized QR decomposition of (A,B)
     DistMatrix<F,MD,STAR> tA(g), tB(g);
@@ -152,36 +205,124 @@ void Overwrite
     // G := Q^H D
     qr::ApplyQ( LEFT, ADJOINT, A, tA, dA, D );
 
-    // Partition the relevant matrices
-    DistMatrix<F> G1(g), G2(g);
-    PartitionDown( D, G1, G2, n );
-    DistMatrix<F> R11(g), R21(g);
-    PartitionDown( A, R11, R21, n );
-    DistMatrix<F> T11(g), T12(g), T21(g), T22(g);
-    PartitionUpOffsetDiagonal
-    ( p-m,
-      B, T11, T12,
-         T21, T22, m-n );
-    Zeros( Y, p, numRhs );
-    DistMatrix<F> C1(g), C2(g);
-    PartitionDown( Y, C1, C2, n+p-m );
+    SolveAfterQ( A, B, tB, dB, D, Y );
+}
 
-    // Solve T22 C2 = G2
-    C2 = G2;
-    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T22, C2, checkIfSingular );
+} // namespace glm
 
-    // G1 := G1 - T12 C2
-    Gemm( NORMAL, NORMAL, F(-1), T12, C2, F(1), G1 );
-    
-    // Solve R11 X = G1
-    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, G1, checkIfSingular );
-    D.Resize( n, numRhs );
+template<typename F>
+GLMSolver<F>::GLMSolver()
+: initialized_(false)
+{ }
 
-    // Y := Z^H C
-    rq::ApplyQ( LEFT, ADJOINT, B, tB, dB, Y );
+template<typename F>
+GLMSolver<F>::GLMSolver( const Matrix<F>& A, const Matrix<F>& B )
+: initialized_(false)
+{ Initialize( A, B ); }
+
+template<typename F>
+void GLMSolver<F>::Initialize( const Matrix<F>& A, const Matrix<F>& B )
+{
+    DEBUG_CSE
+    if( A.Height() != B.Height() )
+        LogicError("A and B must be the same height");
+    glm::CheckDimensions<F>( A.Height(), A.Width(), B.Width() );
+    A_ = A;
+    B_ = B;
+    GQR
+    ( A_, householderScalarsA_, signatureA_,
+      B_, householderScalarsB_, signatureB_ );
+    initialized_ = true;
 }
 
-} // namespace glm
+template<typename F>
+void GLMSolver<F>::Solve
+( const Matrix<F>& D, Matrix<F>& X, Matrix<F>& Y ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( D.Height() != A_.Height() )
+        LogicError("D must be the same height as A");
+    X = D;
+    qr::ApplyQ
+    ( LEFT, ADJOINT, A_, householderScalarsA_, signatureA_, X );
+    glm::SolveAfterQ( A_, B_, householderScalarsB_, signatureB_, X, Y );
+}
+
+template<typename F>
+bool GLMSolver<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+DistGLMSolver<F>::DistGLMSolver( const Grid& g )
+: initialized_(false),
+  A_(g), B_(g),
+  householderScalarsA_(g), householderScalarsB_(g),
+  signatureA_(g), signatureB_(g)
+{ }
+
+template<typename F>
+DistGLMSolver<F>::DistGLMSolver
+( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B )
+: initialized_(false),
+  A_(A.Grid()), B_(A.Grid()),
+  householderScalarsA_(A.Grid()), householderScalarsB_(A.Grid()),
+  signatureA_(A.Grid()), signatureB_(A.Grid())
+{ Initialize( A, B ); }
+
+template<typename F>
+void DistGLMSolver<F>::Initialize
+( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B )
+{
+    DEBUG_CSE
+    if( A.Height() != B.Height() )
+        LogicError("A and B must be the same height");
+    if( A.Grid() != B.Grid() )
+        LogicError("A and B must have the same grid");
+    glm::CheckDimensions<F>( A.Height(), A.Width(), B.Width() );
+    const Grid& g = A.Grid();
+    A_.SetGrid( g );
+    B_.SetGrid( g );
+    householderScalarsA_.SetGrid( g );
+    householderScalarsB_.SetGrid( g );
+    signatureA_.SetGrid( g );
+    signatureB_.SetGrid( g );
+    A_ = A;
+    B_ = B;
+    GQR
+    ( A_, householderScalarsA_, signatureA_,
+      B_, householderScalarsB_, signatureB_ );
+    wyA_ = CompactWY<F>( 0, A_, householderScalarsA_ );
+    initialized_ = true;
+}
+
+template<typename F>
+void DistGLMSolver<F>::Solve
+( const ElementalMatrix<F>& D,
+        ElementalMatrix<F>& XPre,
+        ElementalMatrix<F>& YPre ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( D.Height() != A_.Height() )
+        LogicError("D must be the same height as A");
+    DistMatrixWriteProxy<F,F,MC,MR>
+      XProx( XPre ),
+      YProx( YPre );
+    auto& X = XProx.Get();
+    auto& Y = YProx.Get();
+
+    X.SetGrid( A_.Grid() );
+    X = D;
+    qr::ApplyQ( LEFT, ADJOINT, wyA_, signatureA_, X );
+    glm::SolveAfterQ( A_, B_, householderScalarsB_, signatureB_, X, Y );
+}
+
+template<typename F>
+bool DistGLMSolver<F>::Initialized() const
+{ return initialized_; }
 
 template<typename F> 
 void GLM
@@ -494,6 +635,8 @@ void GLM
 }
 
 #define PROTO(F) \
+  template class GLMSolver<F>; \
+  template class DistGLMSolver<F>; \
   template void glm::Overwrite \
   ( Matrix<F>& A, Matrix<F>& B, Matrix<F>& D, Matrix<F>& Y ); \
   template void glm::Overwrite \
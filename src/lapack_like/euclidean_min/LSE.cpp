@@ -8,8 +8,6 @@
 */
 #include <El.hpp>
 
-#include "El/core/FlamePart.hpp"
-
 // This file implements both dense and sparse-direct solutions of 
 // Equality-constrained Least Squares (LSE):
 //
@@ -68,50 +66,45 @@ namespace El {
 
 namespace lse {
 
-template<typename F> 
-void Overwrite
-( Matrix<F>& A,
-  Matrix<F>& B, 
-  Matrix<F>& C,
-  Matrix<F>& D, 
-  Matrix<F>& X, bool computeResidual )
+template<typename F>
+void CheckDimensions( Int m, Int n, Int p )
+{
+    if( n < p )
+        LogicError("LSE requires width(A) >= height(B)");
+    if( m+p < n )
+        LogicError("LSE requires height(A)+height(B) >= width(A)");
+}
+
+// Given the implicit Generalized RQ factorization of (B,A) and G = Z^H C,
+// solve for X and, optionally, overwrite G with the rotated residual.
+// D is overwritten with arbitrary values.
+template<typename F>
+void SolveAfterZ
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& householderScalarsB,
+  const Matrix<Base<F>>& signatureB,
+        Matrix<F>& C,
+        Matrix<F>& D,
+        Matrix<F>& X,
+        bool computeResidual )
 {
     DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
     const Int p = B.Height();
     const Int numRhs = D.Width();
-    if( m != C.Height() )
-        LogicError("A and C must be the same height");
-    if( p != D.Height() )
-        LogicError("B and D must be the same height");
-    if( numRhs != C.Width() )
-        LogicError("C and D must be the same width");
-    if( n < p )
-        LogicError("LSE requires width(A) >= height(B)");
-    if( m+p < n )
-        LogicError("LSE requires height(A)+height(B) >= width(A)");
     const bool checkIfSingular = true;
 
-    // Compute the implicit Generalized RQ decomposition of (B,A)
-    Matrix<F> tA, tB;
-    Matrix<Base<F>> dA, dB;
-    GRQ( B, tB, dB, A, tA, dA );
-
-    // G := Z^H C
-    qr::ApplyQ( LEFT, ADJOINT, A, tA, dA, C );
-
     // Partition the relevant matrices
     Zeros( X, n, numRhs );
     auto ind1 = IR(0,n-p);
     auto ind2 = IR(n-p,END);
     auto Y1 = X( ind1, ALL );
     auto Y2 = X( ind2, ALL );
-    auto T11 = B( ALL, ind1 );
     auto T12 = B( ALL, ind2 );
     auto R11 = A( ind1, ind1 );
     auto R12 = A( ind1, ind2 );
-    auto R21 = A( ind2, ind1 );
     auto R22 = A( ind2, ind2 );
     auto G1 = C( ind1, ALL );
     auto G2 = C( ind2, ALL );
@@ -137,28 +130,128 @@ void Overwrite
         // p - k = n-m.columns are nonzero.
         if( m < n )
         {
-            Matrix<F> R22L, R22R;
-            PartitionLeft( R22, R22L, R22R, n-m );
-            Matrix<F> DT, DB;
-            PartitionUp( D, DT, DB, n-m );
+            auto R22L = R22( ALL, IR(0,p-(n-m)) );
+            auto R22R = R22( ALL, IR(p-(n-m),p) );
+            auto DT = D( IR(0,p-(n-m)), ALL );
+            auto DB = D( IR(p-(n-m),p), ALL );
+            Gemm( NORMAL, NORMAL, F(-1), R22R, DB, F(1), G2 );
+            Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R22L, DT );
+            G2 -= DT;
+        }
+        else
+        {
+            auto R22T = R22( IR(0,p), ALL );
+            Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R22T, D );
+            auto G2T = G2( IR(0,p), ALL );
+            G2T -= D;
+        }
+        Zero( G1 );
+    }
+
+    // X := Q^H Y
+    rq::ApplyQ( LEFT, ADJOINT, B, householderScalarsB, signatureB, X );
+}
+
+template<typename F>
+void SolveAfterZ
+( const DistMatrix<F>& A,
+  const DistMatrix<F>& B,
+  const DistMatrix<F,MD,STAR>& householderScalarsB,
+  const DistMatrix<Base<F>,MD,STAR>& signatureB,
+        DistMatrix<F>& C,
+        DistMatrix<F>& D,
+        DistMatrix<F>& X,
+        bool computeResidual )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int p = B.Height();
+    const Int numRhs = D.Width();
+    const bool checkIfSingular = true;
+
+    // Partition the relevant matrices
+    X.SetGrid( A.Grid() );
+    Zeros( X, n, numRhs );
+    auto ind1 = IR(0,n-p);
+    auto ind2 = IR(n-p,END);
+    auto Y1 = X( ind1, ALL );
+    auto Y2 = X( ind2, ALL );
+    auto T12 = B( ALL, ind2 );
+    auto R11 = A( ind1, ind1 );
+    auto R12 = A( ind1, ind2 );
+    auto R22 = A( ind2, ind2 );
+    auto G1 = C( ind1, ALL );
+    auto G2 = C( ind2, ALL );
+
+    // Solve T12 Y2 = D
+    Y2 = D; 
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T12, Y2, checkIfSingular );
+
+    // G1 := G1 - R12 Y2
+    Gemm( NORMAL, NORMAL, F(-1), R12, Y2, F(1), G1 );
+
+    // Solve R11 Y1 = G1
+    Y1 = G1;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, Y1, checkIfSingular );
+
+    if( computeResidual )
+    {
+        // See the sequential implementation for the partitioning of R22
+        if( m < n )
+        {
+            auto R22L = R22( ALL, IR(0,p-(n-m)) );
+            auto R22R = R22( ALL, IR(p-(n-m),p) );
+            auto DT = D( IR(0,p-(n-m)), ALL );
+            auto DB = D( IR(p-(n-m),p), ALL );
             Gemm( NORMAL, NORMAL, F(-1), R22R, DB, F(1), G2 );
             Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R22L, DT );
             G2 -= DT;
         }
         else
         {
-            Matrix<F> R22T, R22B;
-            PartitionUp( R22, R22T, R22B, m-n );
+            auto R22T = R22( IR(0,p), ALL );
             Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R22T, D );
-            Matrix<F> G2T, G2B;
-            PartitionUp( G2, G2T, G2B, m-n );
+            auto G2T = G2( IR(0,p), ALL );
             G2T -= D;
         }
         Zero( G1 );
     }
 
     // X := Q^H Y
-    rq::ApplyQ( LEFT, ADJOINT, B, tB, dB, X );
+    rq::ApplyQ( LEFT, ADJOINT, B, householderScalarsB, signatureB, X );
+}
+
+template<typename F> 
+void Overwrite
+( Matrix<F>& A,
+  Matrix<F>& B, 
+  Matrix<F>& C,
+  Matrix<F>& D, 
+  Matrix<F>& X, bool computeResidual )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int p = B.Height();
+    const Int numRhs = D.Width();
+    if( m != C.Height() )
+        LogicError("A and C must be the same height");
+    if( p != D.Height() )
+        LogicError("B and D must be the same height");
+    if( numRhs != C.Width() )
+        LogicError("C and D must be the same width");
+    CheckDimensions<F>( m, n, p );
+
+    // Compute the implicit Generalized RQ decomposition of (B,A)
+    Matrix<F> tA, tB;
+    Matrix<Base<F>> dA, dB;
+    GRQ( B, tB, dB, A, tA, dA );
+
+    // G := Z^H C
+    qr::ApplyQ( LEFT, ADJOINT, A, tA, dA, C );
+
+    SolveAfterZ( A, B, tB, dB, C, D, X, computeResidual );
 }
 
 template<typename F> 
@@ -195,15 +288,10 @@ void Overwrite
         LogicError("B and D must be the same height");
     if( numRhs != C.Width() )
         LogicError("C and D must be the same width");
-    if( n < p )
-        LogicError("LSE requires width(A) >= height(B)");
-    if( m+p < n )
-        LogicError("LSE requires height(A)+height(B) >= width(A)");
+    CheckDimensions<F>( m, n, p );
     const Grid& g = A.Grid();
     if( g != B.Grid() || g != C.Grid() || g != D.Grid() )
         LogicError("All matrices must be distributed over the same grid");
-    X.SetGrid( g );
-    const bool checkIfSingular = true;
 
     // Compute the implicit Generalized RQ decomposition of (B,A)
     DistMatrix<F,MD,STAR> tA(g), tB(g);
@@ -213,63 +301,133 @@ void Overwrite
     // G := Z^H C
     qr::ApplyQ( LEFT, ADJOINT, A, tA, dA, C );
 
-    // Partition the relevant matrices
-    Zeros( X, n, numRhs );
-    DistMatrix<F> Y1(g), Y2(g);
-    PartitionUp( X, Y1, Y2, p );
-    DistMatrix<F> T11(g), T12(g);
-    PartitionLeft( B, T11, T12, p );
-    DistMatrix<F> R11(g), R12(g), R21(g), R22(g);
-    PartitionDownDiagonal( A, R11, R12, R21, R22, n-p );
-    DistMatrix<F> G1(g), G2(g);
-    PartitionDown( C, G1, G2, n-p );
+    SolveAfterZ( A, B, tB, dB, C, D, X, computeResidual );
+}
 
-    // Solve T12 Y2 = D
-    Y2 = D; 
-    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T12, Y2, checkIfSingular );
+} // namespace lse
 
-    // G1 := G1 - R12 Y2
-    Gemm( NORMAL, NORMAL, F(-1), R12, Y2, F(1), G1 );
+template<typename F>
+LSESolver<F>::LSESolver()
+: initialized_(false)
+{ }
 
-    // Solve R11 Y1 = G1
-    Y1 = G1;
-    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, Y1, checkIfSingular );
+template<typename F>
+LSESolver<F>::LSESolver( const Matrix<F>& A, const Matrix<F>& B )
+: initialized_(false)
+{ Initialize( A, B ); }
 
-    if( computeResidual )
-    {
-        // R22 is upper-trapezoidal, and so it is best to decompose it in terms
-        // of its upper-left triangular block and either its bottom zero 
-        // block or right non-zero block. Putting k=Min(p,m-(n-p)), then
-        // the k x k upper-left block is upper-triangular. If m >= n, the
-        // bottom m-(n-p) - k = m-n rows are zero, otherwise the right 
-        // p - k = n-m.columns are nonzero.
-        if( m < n )
-        {
-            DistMatrix<F> R22L(g), R22R(g);
-            PartitionLeft( R22, R22L, R22R, n-m );
-            DistMatrix<F> DT(g), DB(g);
-            PartitionUp( D, DT, DB, n-m );
-            Gemm( NORMAL, NORMAL, F(-1), R22R, DB, F(1), G2 );
-            Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R22L, DT );
-            G2 -= DT;
-        }
-        else
-        {
-            DistMatrix<F> R22T(g), R22B(g);
-            PartitionUp( R22, R22T, R22B, m-n );
-            Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R22T, D );
-            DistMatrix<F> G2T(g), G2B(g);
-            PartitionUp( G2, G2T, G2B, m-n );
-            G2T -= D;
-        }
-        Zero( G1 );
-    }
+template<typename F>
+void LSESolver<F>::Initialize( const Matrix<F>& A, const Matrix<F>& B )
+{
+    DEBUG_CSE
+    if( A.Width() != B.Width() )
+        LogicError("A and B must be the same width");
+    lse::CheckDimensions<F>( A.Height(), A.Width(), B.Height() );
+    A_ = A;
+    B_ = B;
+    GRQ
+    ( B_, householderScalarsB_, signatureB_,
+      A_, householderScalarsA_, signatureA_ );
+    initialized_ = true;
+}
 
-    // X := Q^H Y
-    rq::ApplyQ( LEFT, ADJOINT, B, tB, dB, X );
+template<typename F>
+void LSESolver<F>::Solve
+( const Matrix<F>& C, const Matrix<F>& D, Matrix<F>& X ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( C.Height() != A_.Height() )
+        LogicError("A and C must be the same height");
+    if( D.Height() != B_.Height() )
+        LogicError("B and D must be the same height");
+    if( C.Width() != D.Width() )
+        LogicError("C and D must be the same width");
+    Matrix<F> G( C ), DCopy( D );
+    qr::ApplyQ
+    ( LEFT, ADJOINT, A_, householderScalarsA_, signatureA_, G );
+    lse::SolveAfterZ
+    ( A_, B_, householderScalarsB_, signatureB_, G, DCopy, X, false );
 }
 
-} // namespace lse
+template<typename F>
+bool LSESolver<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+DistLSESolver<F>::DistLSESolver( const Grid& g )
+: initialized_(false),
+  A_(g), B_(g),
+  householderScalarsA_(g), householderScalarsB_(g),
+  signatureA_(g), signatureB_(g)
+{ }
+
+template<typename F>
+DistLSESolver<F>::DistLSESolver
+( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B )
+: initialized_(false),
+  A_(A.Grid()), B_(A.Grid()),
+  householderScalarsA_(A.Grid()), householderScalarsB_(A.Grid()),
+  signatureA_(A.Grid()), signatureB_(A.Grid())
+{ Initialize( A, B ); }
+
+template<typename F>
+void DistLSESolver<F>::Initialize
+( const ElementalMatrix<F>& A, const ElementalMatrix<F>& B )
+{
+    DEBUG_CSE
+    if( A.Width() != B.Width() )
+        LogicError("A and B must be the same width");
+    if( A.Grid() != B.Grid() )
+        LogicError("A and B must have the same grid");
+    lse::CheckDimensions<F>( A.Height(), A.Width(), B.Height() );
+    const Grid& g = A.Grid();
+    A_.SetGrid( g );
+    B_.SetGrid( g );
+    householderScalarsA_.SetGrid( g );
+    householderScalarsB_.SetGrid( g );
+    signatureA_.SetGrid( g );
+    signatureB_.SetGrid( g );
+    A_ = A;
+    B_ = B;
+    GRQ
+    ( B_, householderScalarsB_, signatureB_,
+      A_, householderScalarsA_, signatureA_ );
+    wyA_ = CompactWY<F>( 0, A_, householderScalarsA_ );
+    initialized_ = true;
+}
+
+template<typename F>
+void DistLSESolver<F>::Solve
+( const ElementalMatrix<F>& C,
+  const ElementalMatrix<F>& D,
+        ElementalMatrix<F>& XPre ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( C.Height() != A_.Height() )
+        LogicError("A and C must be the same height");
+    if( D.Height() != B_.Height() )
+        LogicError("B and D must be the same height");
+    if( C.Width() != D.Width() )
+        LogicError("C and D must be the same width");
+    DistMatrixWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& X = XProx.Get();
+
+    const Grid& g = A_.Grid();
+    DistMatrix<F> G(g), DCopy(g);
+    G = C;
+    DCopy = D;
+    qr::ApplyQ( LEFT, ADJOINT, wyA_, signatureA_, G );
+    lse::SolveAfterZ
+    ( A_, B_, householderScalarsB_, signatureB_, G, DCopy, X, false );
+}
+
+template<typename F>
+bool DistLSESolver<F>::Initialized() const
+{ return initialized_; }
 
 template<typename F> 
 void LSE
@@ -577,6 +735,8 @@ void LSE
 }
 
 #define PROTO(F) \
+  template class LSESolver<F>; \
+  template class DistLSESolver<F>; \
   template void lse::Overwrite \
   ( Matrix<F>& A, \
     Matrix<F>& B, \
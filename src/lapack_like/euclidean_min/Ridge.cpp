@@ -242,6 +242,74 @@ void Ridge
     Tikhonov( orientation, A, B, G, X, ctrl );
 }
 
+template<typename F>
+void Ridge
+( Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<Matrix<F>>& X )
+{
+    DEBUG_CSE
+    RidgeSolver<F> solver( orientation, A );
+    solver.Solve( B, gammas, X );
+}
+
+template<typename F>
+void Ridge
+( Orientation orientation,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<DistMatrix<F>>& X )
+{
+    DEBUG_CSE
+    DistRidgeSolver<F> solver( orientation, A );
+    solver.Solve( B, gammas, X );
+}
+
+template<typename F>
+void Ridge
+( Orientation orientation,
+  const SparseMatrix<F>& A,
+  const Matrix<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<Matrix<F>>& X,
+  const RidgeSweepCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( gammas.empty() )
+    {
+        X.clear();
+        return;
+    }
+    const Base<F> gammaRef = *std::min_element( gammas.begin(), gammas.end() );
+    SparseRidgeSolver<F> solver;
+    solver.Initialize( orientation, A, gammaRef );
+    solver.Solve( B, gammas, X, ctrl );
+}
+
+template<typename F>
+void Ridge
+( Orientation orientation,
+  const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<DistMultiVec<F>>& X,
+  const RidgeSweepCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( gammas.empty() )
+    {
+        X.clear();
+        return;
+    }
+    const Base<F> gammaRef = *std::min_element( gammas.begin(), gammas.end() );
+    DistSparseRidgeSolver<F> solver;
+    solver.Initialize( orientation, A, gammaRef );
+    solver.Solve( B, gammas, X, ctrl );
+}
+
 #define PROTO(F) \
   template void Ridge \
   ( Orientation orientation, \
@@ -270,7 +338,33 @@ void Ridge
     const DistMultiVec<F>& B, \
           Base<F> gamma, \
           DistMultiVec<F>& X, \
-    const LeastSquaresCtrl<Base<F>>& ctrl );
+    const LeastSquaresCtrl<Base<F>>& ctrl ); \
+  template void Ridge \
+  ( Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& B, \
+    const vector<Base<F>>& gammas, \
+          vector<Matrix<F>>& X ); \
+  template void Ridge \
+  ( Orientation orientation, \
+    const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+    const vector<Base<F>>& gammas, \
+          vector<DistMatrix<F>>& X ); \
+  template void Ridge \
+  ( Orientation orientation, \
+    const SparseMatrix<F>& A, \
+    const Matrix<F>& B, \
+    const vector<Base<F>>& gammas, \
+          vector<Matrix<F>>& X, \
+    const RidgeSweepCtrl<Base<F>>& ctrl ); \
+  template void Ridge \
+  ( Orientation orientation, \
+    const DistSparseMatrix<F>& A, \
+    const DistMultiVec<F>& B, \
+    const vector<Base<F>>& gammas, \
+          vector<DistMultiVec<F>>& X, \
+    const RidgeSweepCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,565 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace ridge {
+
+template<typename Real>
+Real FilterFactor( Real sigma, Real gamma )
+{
+    if( sigma == Real(0) )
+        return Real(0);
+    return sigma / (sigma*sigma + gamma*gamma);
+}
+
+template<typename Real>
+void CheckGammas( const vector<Real>& gammas, Real gammaRef )
+{
+    for( const Real& gamma : gammas )
+        if( gamma < gammaRef )
+            LogicError
+            ("Each gamma must be at least the reference gamma, ",gammaRef);
+}
+
+} // namespace ridge
+
+// Dense SVD-based solvers
+// =======================
+
+template<typename F>
+RidgeSolver<F>::RidgeSolver()
+: initialized_(false)
+{ }
+
+template<typename F>
+RidgeSolver<F>::RidgeSolver( Orientation orientation, const Matrix<F>& A )
+: initialized_(false)
+{ Initialize( orientation, A ); }
+
+template<typename F>
+void RidgeSolver<F>::Initialize( Orientation orientation, const Matrix<F>& A )
+{
+    DEBUG_CSE
+    SVDCtrl<Base<F>> ctrl;
+    if( orientation == NORMAL )
+    {
+        ctrl.overwrite = false;
+        SVD( A, U_, s_, V_, ctrl );
+    }
+    else
+    {
+        Matrix<F> AOp;
+        if( orientation == TRANSPOSE )
+            Transpose( A, AOp );
+        else
+            Adjoint( A, AOp );
+        ctrl.overwrite = true;
+        SVD( AOp, U_, s_, V_, ctrl );
+    }
+    initialized_ = true;
+}
+
+template<typename F>
+void RidgeSolver<F>::Filter
+( const Matrix<F>& UAdjB, Base<F> gamma, Matrix<F>& X ) const
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<Real> filter( s_ );
+    const Int k = filter.Height();
+    for( Int i=0; i<k; ++i )
+        filter(i) = ridge::FilterFactor( filter(i), gamma );
+    Matrix<F> Y( UAdjB );
+    DiagonalScale( LEFT, NORMAL, filter, Y );
+    Gemm( NORMAL, NORMAL, F(1), V_, Y, X );
+}
+
+template<typename F>
+void RidgeSolver<F>::Solve
+( const Matrix<F>& B, Base<F> gamma, Matrix<F>& X ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( B.Height() != U_.Height() )
+        LogicError("B did not conform with op(A)");
+    Matrix<F> UAdjB;
+    Gemm( ADJOINT, NORMAL, F(1), U_, B, UAdjB );
+    Filter( UAdjB, gamma, X );
+}
+
+template<typename F>
+void RidgeSolver<F>::Solve
+( const Matrix<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<Matrix<F>>& X ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( B.Height() != U_.Height() )
+        LogicError("B did not conform with op(A)");
+    const Int numGammas = gammas.size();
+    X.resize( numGammas );
+    Matrix<F> UAdjB;
+    Gemm( ADJOINT, NORMAL, F(1), U_, B, UAdjB );
+    for( Int k=0; k<numGammas; ++k )
+        Filter( UAdjB, gammas[k], X[k] );
+}
+
+template<typename F>
+bool RidgeSolver<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+const Matrix<F>& RidgeSolver<F>::U() const
+{ return U_; }
+
+template<typename F>
+const Matrix<Base<F>>& RidgeSolver<F>::SingularValues() const
+{ return s_; }
+
+template<typename F>
+const Matrix<F>& RidgeSolver<F>::V() const
+{ return V_; }
+
+template<typename F>
+DistRidgeSolver<F>::DistRidgeSolver( const Grid& g )
+: initialized_(false), U_(g), V_(g), s_(g)
+{ }
+
+template<typename F>
+DistRidgeSolver<F>::DistRidgeSolver
+( Orientation orientation, const ElementalMatrix<F>& A )
+: initialized_(false), U_(A.Grid()), V_(A.Grid()), s_(A.Grid())
+{ Initialize( orientation, A ); }
+
+template<typename F>
+void DistRidgeSolver<F>::Initialize
+( Orientation orientation, const ElementalMatrix<F>& A )
+{
+    DEBUG_CSE
+    const Grid& g = A.Grid();
+    U_.SetGrid( g );
+    V_.SetGrid( g );
+    s_.SetGrid( g );
+    SVDCtrl<Base<F>> ctrl;
+    if( orientation == NORMAL )
+    {
+        ctrl.overwrite = false;
+        SVD( A, U_, s_, V_, ctrl );
+    }
+    else
+    {
+        DistMatrix<F> AOp(g);
+        if( orientation == TRANSPOSE )
+            Transpose( A, AOp );
+        else
+            Adjoint( A, AOp );
+        ctrl.overwrite = true;
+        SVD( AOp, U_, s_, V_, ctrl );
+    }
+    initialized_ = true;
+}
+
+template<typename F>
+void DistRidgeSolver<F>::Filter
+( const DistMatrix<F>& UAdjB, Base<F> gamma, ElementalMatrix<F>& X ) const
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrix<Real,VR,STAR> filter( s_ );
+    auto& filterLoc = filter.Matrix();
+    const Int kLoc = filterLoc.Height();
+    for( Int iLoc=0; iLoc<kLoc; ++iLoc )
+        filterLoc(iLoc) = ridge::FilterFactor( filterLoc(iLoc), gamma );
+    DistMatrix<F> Y( UAdjB );
+    DiagonalScale( LEFT, NORMAL, filter, Y );
+    Gemm( NORMAL, NORMAL, F(1), V_, Y, X );
+}
+
+template<typename F>
+void DistRidgeSolver<F>::Solve
+( const ElementalMatrix<F>& B, Base<F> gamma, ElementalMatrix<F>& X ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( B.Height() != U_.Height() )
+        LogicError("B did not conform with op(A)");
+    DistMatrix<F> UAdjB(U_.Grid());
+    Gemm( ADJOINT, NORMAL, F(1), U_, B, UAdjB );
+    Filter( UAdjB, gamma, X );
+}
+
+template<typename F>
+void DistRidgeSolver<F>::Solve
+( const ElementalMatrix<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<DistMatrix<F>>& X ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( B.Height() != U_.Height() )
+        LogicError("B did not conform with op(A)");
+    const Grid& g = U_.Grid();
+    const Int numGammas = gammas.size();
+    X.resize( numGammas );
+    DistMatrix<F> UAdjB(g);
+    Gemm( ADJOINT, NORMAL, F(1), U_, B, UAdjB );
+    for( Int k=0; k<numGammas; ++k )
+    {
+        X[k].SetGrid( g );
+        Filter( UAdjB, gammas[k], X[k] );
+    }
+}
+
+template<typename F>
+bool DistRidgeSolver<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+const DistMatrix<F>& DistRidgeSolver<F>::U() const
+{ return U_; }
+
+template<typename F>
+const DistMatrix<Base<F>,VR,STAR>& DistRidgeSolver<F>::SingularValues() const
+{ return s_; }
+
+template<typename F>
+const DistMatrix<F>& DistRidgeSolver<F>::V() const
+{ return V_; }
+
+// Sparse solvers built on a single quasi-definite factorization
+// =============================================================
+
+template<typename F>
+SparseRidgeSolver<F>::SparseRidgeSolver()
+: initialized_(false), gammaRef_(0)
+{ }
+
+template<typename F>
+void SparseRidgeSolver<F>::Initialize
+( Orientation orientation,
+  const SparseMatrix<F>& A,
+  Base<F> gammaRef )
+{
+    DEBUG_CSE
+    if( gammaRef <= Base<F>(0) )
+        LogicError("The reference gamma must be positive");
+    if( orientation == NORMAL )
+        W_ = A;
+    else if( orientation == TRANSPOSE )
+        Transpose( A, W_ );
+    else
+        Adjoint( A, W_ );
+    gammaRef_ = gammaRef;
+    const Int m = W_.Height();
+    const Int n = W_.Width();
+
+    // J := [-gammaRef^2 I, W^H; W, I]
+    // ===============================
+    Zeros( J_, n+m, n+m );
+    const Int numEntriesW = W_.NumEntries();
+    J_.Reserve( 2*numEntriesW + n+m );
+    for( Int e=0; e<numEntriesW; ++e )
+    {
+        const Int i = W_.Row(e);
+        const Int j = W_.Col(e);
+        const F value = W_.Value(e);
+        J_.QueueUpdate( n+i, j,        value  );
+        J_.QueueUpdate( j,   n+i, Conj(value) );
+    }
+    for( Int i=0; i<n; ++i )
+        J_.QueueUpdate( i, i, -gammaRef*gammaRef );
+    for( Int i=n; i<n+m; ++i )
+        J_.QueueUpdate( i, i, F(1) );
+    J_.ProcessQueues();
+
+    factorization_.Initialize( J_ );
+    initialized_ = true;
+}
+
+template<typename F>
+void SparseRidgeSolver<F>::ApplyInverse( Matrix<F>& X, Int maxRefineIts ) const
+{
+    DEBUG_CSE
+    const Int m = W_.Height();
+    const Int n = W_.Width();
+    const Int width = X.Width();
+
+    // Solve J [Y; R] = [-X; 0]
+    Matrix<F> D;
+    Zeros( D, n+m, width );
+    auto DT = D( IR(0,n), ALL );
+    DT = X;
+    DT *= F(-1);
+    factorization_.SolveWithIterativeRefinement
+    ( J_, D, Base<F>(2), maxRefineIts );
+    X = D( IR(0,n), ALL );
+}
+
+template<typename F>
+void SparseRidgeSolver<F>::Solve
+( const Matrix<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<Matrix<F>>& X,
+  const RidgeSweepCtrl<Base<F>>& ctrl ) const
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( B.Height() != W_.Height() )
+        LogicError("B did not conform with op(A)");
+    ridge::CheckGammas( gammas, gammaRef_ );
+    const Int n = W_.Width();
+    const Int numGammas = gammas.size();
+    X.resize( numGammas );
+
+    // C := inv(W^H W + gammaRef^2 I) W^H B
+    Matrix<F> C;
+    Zeros( C, n, B.Width() );
+    Multiply( ADJOINT, F(1), W_, B, F(0), C );
+    ApplyInverse( C, ctrl.maxRefineIts );
+
+    // The remaining gammas correspond to the shifts 1/delta of inv(M)
+    vector<Real> shifts;
+    vector<Int> shiftIndices;
+    for( Int k=0; k<numGammas; ++k )
+    {
+        const Real delta = gammas[k]*gammas[k] - gammaRef_*gammaRef_;
+        if( delta == Real(0) )
+            X[k] = C;
+        else
+        {
+            shifts.push_back( Real(1)/delta );
+            shiftIndices.push_back( k );
+        }
+    }
+    if( shifts.empty() )
+        return;
+
+    auto applyInv =
+      [&]( const Matrix<F>& Y, Matrix<F>& Z )
+      {
+          Z = Y;
+          ApplyInverse( Z, ctrl.maxRefineIts );
+      };
+    KrylovSolveCtrl<Real> krylovCtrl;
+    krylovCtrl.relTol = ctrl.relTol;
+    krylovCtrl.maxIts = ctrl.maxIts;
+    krylovCtrl.progress = ctrl.progress;
+    vector<Matrix<F>> Y;
+    krylov_solve::MultiShiftCG
+    ( mpi::COMM_SELF, applyInv, C, shifts, Y, krylovCtrl );
+
+    // X(gamma) := Y / delta
+    const Int numShifts = shifts.size();
+    for( Int s=0; s<numShifts; ++s )
+    {
+        auto& XShift = X[shiftIndices[s]];
+        XShift = Y[s];
+        XShift *= F(shifts[s]);
+    }
+}
+
+template<typename F>
+bool SparseRidgeSolver<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+Base<F> SparseRidgeSolver<F>::ReferenceGamma() const
+{ return gammaRef_; }
+
+template<typename F>
+const SparseLDLFactorization<F>& SparseRidgeSolver<F>::Factorization() const
+{ return factorization_; }
+
+template<typename F>
+DistSparseRidgeSolver<F>::DistSparseRidgeSolver()
+: initialized_(false), gammaRef_(0)
+{ }
+
+template<typename F>
+void DistSparseRidgeSolver<F>::Initialize
+( Orientation orientation,
+  const DistSparseMatrix<F>& A,
+  Base<F> gammaRef )
+{
+    DEBUG_CSE
+    if( gammaRef <= Base<F>(0) )
+        LogicError("The reference gamma must be positive");
+    mpi::Comm comm = A.Comm();
+    W_.SetComm( comm );
+    J_.SetComm( comm );
+    if( orientation == NORMAL )
+        W_ = A;
+    else if( orientation == TRANSPOSE )
+        Transpose( A, W_ );
+    else
+        Adjoint( A, W_ );
+    gammaRef_ = gammaRef;
+    const Int m = W_.Height();
+    const Int n = W_.Width();
+
+    // J := [-gammaRef^2 I, W^H; W, I]
+    // ===============================
+    Zeros( J_, n+m, n+m );
+    {
+        const Int JLocalHeight = J_.LocalHeight();
+        const Int numLocalEntriesW = W_.NumLocalEntries();
+        const Int numSend = 2*numLocalEntriesW;
+        J_.Reserve( numSend+JLocalHeight, numSend );
+        for( Int e=0; e<numLocalEntriesW; ++e )
+        {
+            const Int i = W_.Row(e);
+            const Int j = W_.Col(e);
+            const F value = W_.Value(e);
+            J_.QueueUpdate( n+i, j,        value  );
+            J_.QueueUpdate( j,   n+i, Conj(value) );
+        }
+        for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
+        {
+            const Int i = J_.GlobalRow(iLoc);
+            if( i < n )
+                J_.QueueLocalUpdate( iLoc, i, -gammaRef*gammaRef );
+            else
+                J_.QueueLocalUpdate( iLoc, i, F(1) );
+        }
+        J_.ProcessQueues();
+    }
+
+    factorization_.Initialize( J_ );
+    initialized_ = true;
+}
+
+template<typename F>
+void DistSparseRidgeSolver<F>::ApplyInverse
+( DistMultiVec<F>& X, Int maxRefineIts ) const
+{
+    DEBUG_CSE
+    mpi::Comm comm = W_.Comm();
+    const Int m = W_.Height();
+    const Int n = W_.Width();
+    const Int width = X.Width();
+
+    // Solve J [Y; R] = [-X; 0]
+    DistMultiVec<F> Z(comm), D(comm);
+    Zeros( Z, m, width );
+    X *= F(-1);
+    VCat( X, Z, D );
+    factorization_.SolveWithIterativeRefinement
+    ( J_, D, Base<F>(2), maxRefineIts );
+    GetSubmatrix( D, IR(0,n), IR(0,width), X );
+}
+
+template<typename F>
+void DistSparseRidgeSolver<F>::Solve
+( const DistMultiVec<F>& B,
+  const vector<Base<F>>& gammas,
+        vector<DistMultiVec<F>>& X,
+  const RidgeSweepCtrl<Base<F>>& ctrl ) const
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( B.Height() != W_.Height() )
+        LogicError("B did not conform with op(A)");
+    ridge::CheckGammas( gammas, gammaRef_ );
+    mpi::Comm comm = W_.Comm();
+    const Int n = W_.Width();
+    const Int width = B.Width();
+    const Int numGammas = gammas.size();
+    X.resize( numGammas );
+    for( auto& XGamma : X )
+        XGamma.SetComm( comm );
+
+    // C := inv(W^H W + gammaRef^2 I) W^H B
+    DistMultiVec<F> C(comm);
+    Zeros( C, n, width );
+    Multiply( ADJOINT, F(1), W_, B, F(0), C );
+    ApplyInverse( C, ctrl.maxRefineIts );
+
+    // The remaining gammas correspond to the shifts 1/delta of inv(M)
+    vector<Real> shifts;
+    vector<Int> shiftIndices;
+    for( Int k=0; k<numGammas; ++k )
+    {
+        const Real delta = gammas[k]*gammas[k] - gammaRef_*gammaRef_;
+        if( delta == Real(0) )
+            X[k] = C;
+        else
+        {
+            shifts.push_back( Real(1)/delta );
+            shiftIndices.push_back( k );
+        }
+    }
+    if( shifts.empty() )
+        return;
+
+    auto applyInv =
+      [&]( const DistMultiVec<F>& Y, DistMultiVec<F>& Z )
+      {
+          Z = Y;
+          ApplyInverse( Z, ctrl.maxRefineIts );
+      };
+    DistMultiVec<F> XBlock(comm), YBlock(comm);
+    auto applyLocal =
+      krylov_solve::LocalApplication( n, applyInv, XBlock, YBlock );
+    KrylovSolveCtrl<Real> krylovCtrl;
+    krylovCtrl.relTol = ctrl.relTol;
+    krylovCtrl.maxIts = ctrl.maxIts;
+    krylovCtrl.progress = ctrl.progress;
+    vector<Matrix<F>> YLoc;
+    krylov_solve::MultiShiftCG
+    ( comm, applyLocal, C.LockedMatrix(), shifts, YLoc, krylovCtrl );
+
+    // X(gamma) := Y / delta
+    const Int numShifts = shifts.size();
+    for( Int s=0; s<numShifts; ++s )
+    {
+        auto& XShift = X[shiftIndices[s]];
+        XShift.Resize( n, width );
+        XShift.Matrix() = YLoc[s];
+        XShift.Matrix() *= F(shifts[s]);
+    }
+}
+
+template<typename F>
+bool DistSparseRidgeSolver<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+Base<F> DistSparseRidgeSolver<F>::ReferenceGamma() const
+{ return gammaRef_; }
+
+template<typename F>
+const DistSparseLDLFactorization<F>&
+DistSparseRidgeSolver<F>::Factorization() const
+{ return factorization_; }
+
+#define PROTO(F) \
+  template class RidgeSolver<F>; \
+  template class DistRidgeSolver<F>; \
+  template class SparseRidgeSolver<F>; \
+  template class DistSparseRidgeSolver<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -13,6 +13,7 @@
 #include "./Cholesky/UVar3.hpp"
 #include "./Cholesky/UVar3Pivoted.hpp"
 #include "./Cholesky/SolveAfter.hpp"
+#include "./Cholesky/Tiled.hpp"
 
 #include "./Cholesky/LMod.hpp"
 #include "./Cholesky/UMod.hpp"
@@ -25,6 +26,7 @@ template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Cholesky");
     DEBUG_ONLY(
       if( A.Height() != A.Width() )
           LogicError("A must be square");
@@ -93,25 +95,69 @@ void ScaLAPACKHelper( UpperOrLower uplo, AbstractDistMatrix<F>& A )
     RuntimeError("There is no ScaLAPACK support for this datatype");
 }
 
-} // anonymous namespace
+// Block-cyclic matrices are only redistributed to an element-cyclic
+// distribution if ScaLAPACK cannot factor them in place
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+void BlockHelper( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A )
+{
+#ifdef EL_HAVE_SCALAPACK
+    ScaLAPACKHelper( uplo, A );
+#else
+    DistMatrix<F> AElem( A );
+    Cholesky( uplo, AElem );
+    A = AElem;
+#endif
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+void BlockHelper( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    DistMatrix<F> AElem( A );
+    Cholesky( uplo, AElem );
+    A = AElem;
+}
+
+} // namespace cholesky
 
 template<typename F> 
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
 {
     DEBUG_CSE
-    if( scalapack )
+    CholeskyCtrl ctrl;
+    ctrl.scalapack = scalapack;
+    Cholesky( uplo, A, ctrl );
+}
+
+template<typename F> 
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("Cholesky");
+    if( ctrl.scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
     }
     else
     {
+        const Grid& g = A.Grid();
+        TunedBlocksizeScope scope
+        ( TUNE_CHOLESKY, A.Height(), g.Height(), g.Width() );
         if( uplo == LOWER )
-            cholesky::LVar3( A );
+            cholesky::LVar3( A, ctrl );
         else
-            cholesky::UVar3( A );
+            cholesky::UVar3( A, ctrl );
     }
 }
 
+template<typename F>
+void Cholesky( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("Cholesky");
+    cholesky::BlockHelper( uplo, A );
+}
+
 template<typename F> 
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p )
@@ -128,6 +174,15 @@ void Cholesky
 ( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A )
 { Cholesky( uplo, A.Matrix() ); }
 
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, DistMatrixBatch<F>& A, const CholeskyCtrl& ctrl )
+{
+    DEBUG_CSE
+    for( const Int k : A.LocalIndices() )
+        Cholesky( uplo, A(k), ctrl );
+}
+
 template<typename F> 
 void ReverseCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A )
 {
@@ -208,9 +263,17 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
 
 #define PROTO_BASE(F) \
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
+  template void cholesky::Tiled \
+  ( UpperOrLower uplo, Matrix<F>& A, const TileCtrl& ctrl ); \
   template void Cholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, DistMatrixBatch<F>& A, const CholeskyCtrl& ctrl ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
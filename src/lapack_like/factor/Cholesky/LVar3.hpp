@@ -69,6 +69,38 @@ void ReverseLVar3Unb( Matrix<F>& A )
     }
 }
 
+// A recursive (cache-oblivious) formulation which halves the matrix, so that
+// all but O(cutoff) of the flops take place within Trsm and Herk regardless
+// of the algorithmic blocksize
+const Int RECURSIVE_CHOLESKY_CUTOFF = 16;
+
+template<typename F>
+void LRecursive( Matrix<F>& A )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    if( n <= RECURSIVE_CHOLESKY_CUTOFF )
+    {
+        cholesky::LVar3Unb( A );
+        return;
+    }
+    const Int n1 = n/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, n );
+
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    LRecursive( A11 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+    Herk( LOWER, NORMAL, Base<F>(-1), A21, Base<F>(1), A22 );
+    LRecursive( A22 );
+}
+
 template<typename F>
 void LVar3( Matrix<F>& A )
 {
@@ -90,7 +122,7 @@ void LVar3( Matrix<F>& A )
         auto A21 = A( ind2, ind1 );
         auto A22 = A( ind2, ind2 );
 
-        cholesky::LVar3Unb( A11 );
+        cholesky::LRecursive( A11 );
         Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
         Herk( LOWER, NORMAL, Base<F>(-1), A21, Base<F>(1), A22 );
     }
@@ -125,7 +157,8 @@ void ReverseLVar3( Matrix<F>& A )
 } 
 
 template<typename F>
-void LVar3( AbstractDistMatrix<F>& APre )
+void LVar3
+( AbstractDistMatrix<F>& APre, const CholeskyCtrl& ctrl=CholeskyCtrl() )
 {
     DEBUG_CSE
     DEBUG_ONLY(
@@ -143,6 +176,11 @@ void LVar3( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(g);
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(g);
 
+    // The next panel, [A11; A21], gathered during the trailing update
+    DistMatrix<F,MC,  STAR> ANext_MC_STAR(g);
+    CopyRequest<F> nextRequest;
+    bool gatheredNext = false;
+
     const Int n = A.Height();
     const Int bsize = Blocksize();
     for( Int k=0; k<n; k+=bsize )
@@ -156,12 +194,21 @@ void LVar3( AbstractDistMatrix<F>& APre )
         auto A21 = A( ind2, ind1 );
         auto A22 = A( ind2, ind2 );
 
-        A11_STAR_STAR = A11;
+        A21_VC_STAR.AlignWith( A22 );
+        if( gatheredNext )
+        {
+            nextRequest.Wait();
+            A11_STAR_STAR = ANext_MC_STAR( IR(0,nb), ALL );
+            A21_VC_STAR = ANext_MC_STAR( IR(nb,END), ALL );
+        }
+        else
+        {
+            A11_STAR_STAR = A11;
+            A21_VC_STAR = A21;
+        }
         Cholesky( LOWER, A11_STAR_STAR );
         A11 = A11_STAR_STAR;
 
-        A21_VC_STAR.AlignWith( A22 );
-        A21_VC_STAR = A21;
         LocalTrsm
         ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
 
@@ -174,9 +221,35 @@ void LVar3( AbstractDistMatrix<F>& APre )
 
         // (A21^T[* ,MC])^T A21^H[* ,MR] = A21[MC,* ] A21^H[* ,MR]
         //                               = (A21 A21^H)[MC,MR]
-        LocalTrrk
-        ( LOWER, TRANSPOSE, 
-          F(-1), A21Trans_STAR_MC, A21Adj_STAR_MR, F(1), A22 );
+        const Int nbNext = Min(bsize,n-(k+nb));
+        gatheredNext = ( ctrl.lookAhead > 0 && nbNext > 0 );
+        if( gatheredNext )
+        {
+            // Update the next panel first so that its gather can proceed
+            // during the remainder of the trailing update
+            const Range<Int> indL( 0, nbNext ), indR( nbNext, END );
+            auto A22L = A22( ALL, indL );
+            auto A22TL = A22( indL, indL );
+            auto A22BL = A22( indR, indL );
+            auto A22BR = A22( indR, indR );
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21Trans_STAR_MC( ALL, indL ), A21Adj_STAR_MR( ALL, indL ),
+              F(1), A22TL );
+            LocalGemm
+            ( TRANSPOSE, NORMAL,
+              F(-1), A21Trans_STAR_MC( ALL, indR ), A21Adj_STAR_MR( ALL, indL ),
+              F(1), A22BL );
+            nextRequest = ICopy( A22L, ANext_MC_STAR );
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21Trans_STAR_MC( ALL, indR ), A21Adj_STAR_MR( ALL, indR ),
+              F(1), A22BR );
+        }
+        else
+            LocalTrrk
+            ( LOWER, TRANSPOSE, 
+              F(-1), A21Trans_STAR_MC, A21Adj_STAR_MR, F(1), A22 );
 
         Transpose( A21Trans_STAR_MC, A21 );
     }
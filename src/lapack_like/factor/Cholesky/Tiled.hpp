@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_TILED_HPP
+#define EL_CHOLESKY_TILED_HPP
+
+namespace El {
+namespace cholesky {
+
+// Express the right-looking Cholesky factorization as a graph of tile
+// tasks (factorization of a diagonal tile, triangular solves against it, and
+// Herk/Gemm updates of the trailing tiles) so that, e.g., the factorization
+// of the next diagonal tile may begin as soon as its own updates are
+// complete rather than after the entire trailing matrix has been updated.
+template<typename F>
+void Tiled( UpperOrLower uplo, Matrix<F>& A, const TileCtrl& ctrl )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("Cholesky");
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( ctrl.tileSize <= 0 )
+        LogicError("The tile size must be positive");
+    const Int n = A.Height();
+    const Int nb = ctrl.tileSize;
+    const Int numTiles = (n+nb-1) / nb;
+
+    auto tile = [&]( Int i, Int j )
+    {
+        return A( IR(i*nb,Min((i+1)*nb,n)), IR(j*nb,Min((j+1)*nb,n)) );
+    };
+    auto handle = [&]( Int i, Int j ) { return i + j*numTiles; };
+
+    // Prioritize the tasks along the critical path of diagonal factorizations
+    TaskGraph graph;
+    for( Int k=0; k<numTiles; ++k )
+    {
+        graph.Insert
+        ( [=]() { auto Akk = tile(k,k); Cholesky( uplo, Akk ); },
+          {}, {handle(k,k)}, 3*numTiles );
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+            if( uplo == LOWER )
+                graph.Insert
+                ( [=]()
+                  {
+                      auto Akk = tile(k,k);
+                      auto Aik = tile(i,k);
+                      Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), Akk, Aik );
+                  },
+                  {handle(k,k)}, {handle(i,k)}, 2*numTiles-i );
+            else
+                graph.Insert
+                ( [=]()
+                  {
+                      auto Akk = tile(k,k);
+                      auto Aki = tile(k,i);
+                      Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), Akk, Aki );
+                  },
+                  {handle(k,k)}, {handle(k,i)}, 2*numTiles-i );
+        }
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+            if( uplo == LOWER )
+            {
+                graph.Insert
+                ( [=]()
+                  {
+                      auto Ajk = tile(j,k);
+                      auto Ajj = tile(j,j);
+                      Herk( LOWER, NORMAL, Base<F>(-1), Ajk, Base<F>(1), Ajj );
+                  },
+                  {handle(j,k)}, {handle(j,j)}, 2*numTiles-j );
+                for( Int i=j+1; i<numTiles; ++i )
+                    graph.Insert
+                    ( [=]()
+                      {
+                          auto Aik = tile(i,k);
+                          auto Ajk = tile(j,k);
+                          auto Aij = tile(i,j);
+                          Gemm( NORMAL, ADJOINT, F(-1), Aik, Ajk, F(1), Aij );
+                      },
+                      {handle(i,k),handle(j,k)}, {handle(i,j)}, numTiles-j );
+            }
+            else
+            {
+                graph.Insert
+                ( [=]()
+                  {
+                      auto Akj = tile(k,j);
+                      auto Ajj = tile(j,j);
+                      Herk( UPPER, ADJOINT, Base<F>(-1), Akj, Base<F>(1), Ajj );
+                  },
+                  {handle(k,j)}, {handle(j,j)}, 2*numTiles-j );
+                for( Int i=j+1; i<numTiles; ++i )
+                    graph.Insert
+                    ( [=]()
+                      {
+                          auto Akj = tile(k,j);
+                          auto Aki = tile(k,i);
+                          auto Aji = tile(j,i);
+                          Gemm( ADJOINT, NORMAL, F(-1), Akj, Aki, F(1), Aji );
+                      },
+                      {handle(k,j),handle(k,i)}, {handle(j,i)}, numTiles-j );
+            }
+        }
+    }
+    graph.Execute( ctrl.numThreads );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_TILED_HPP
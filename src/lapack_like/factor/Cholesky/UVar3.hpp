@@ -9,6 +9,8 @@
 #ifndef EL_CHOLESKY_UVAR3_HPP
 #define EL_CHOLESKY_UVAR3_HPP
 
+#include "./LVar3.hpp"
+
 namespace El {
 namespace cholesky {
 
@@ -74,6 +76,34 @@ void ReverseUVar3Unb( Matrix<F>& A )
     }
 }
 
+// The upper analogue of LRecursive
+template<typename F>
+void URecursive( Matrix<F>& A )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    if( n <= RECURSIVE_CHOLESKY_CUTOFF )
+    {
+        cholesky::UVar3Unb( A );
+        return;
+    }
+    const Int n1 = n/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, n );
+
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A22 = A( ind2, ind2 );
+
+    URecursive( A11 );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
+    Herk( UPPER, ADJOINT, Base<F>(-1), A12, Base<F>(1), A22 );
+    URecursive( A22 );
+}
+
 template<typename F> 
 void UVar3( Matrix<F>& A )
 {
@@ -95,7 +125,7 @@ void UVar3( Matrix<F>& A )
         auto A12 = A( ind1, ind2 );
         auto A22 = A( ind2, ind2 );
 
-        cholesky::UVar3Unb( A11 );
+        cholesky::URecursive( A11 );
         Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
         Herk( UPPER, ADJOINT, Base<F>(-1), A12, Base<F>(1), A22 );
     }
@@ -130,7 +160,8 @@ void ReverseUVar3( Matrix<F>& A )
 }
 
 template<typename F> 
-void UVar3( AbstractDistMatrix<F>& APre )
+void UVar3
+( AbstractDistMatrix<F>& APre, const CholeskyCtrl& ctrl=CholeskyCtrl() )
 {
     DEBUG_CSE
     DEBUG_ONLY(
@@ -147,6 +178,11 @@ void UVar3( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MC  > A12_STAR_MC(g);
     DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
 
+    // The next panel, [A11, A12], gathered during the trailing update
+    DistMatrix<F,STAR,MR  > ANext_STAR_MR(g);
+    CopyRequest<F> nextRequest;
+    bool gatheredNext = false;
+
     const Int n = A.Height();
     const Int bsize = Blocksize();
     for( Int k=0; k<n; k+=bsize )
@@ -160,12 +196,21 @@ void UVar3( AbstractDistMatrix<F>& APre )
         auto A12 = A( ind1, ind2 );
         auto A22 = A( ind2, ind2 );
 
-        A11_STAR_STAR = A11;
+        A12_STAR_VR.AlignWith( A22 );
+        if( gatheredNext )
+        {
+            nextRequest.Wait();
+            A11_STAR_STAR = ANext_STAR_MR( ALL, IR(0,nb) );
+            A12_STAR_VR = ANext_STAR_MR( ALL, IR(nb,END) );
+        }
+        else
+        {
+            A11_STAR_STAR = A11;
+            A12_STAR_VR = A12;
+        }
         Cholesky( UPPER, A11_STAR_STAR );
         A11 = A11_STAR_STAR;
 
-        A12_STAR_VR.AlignWith( A22 );
-        A12_STAR_VR = A12;
         LocalTrsm
         ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
 
@@ -173,8 +218,35 @@ void UVar3( AbstractDistMatrix<F>& APre )
         A12_STAR_MC = A12_STAR_VR;
         A12_STAR_MR.AlignWith( A22 );
         A12_STAR_MR = A12_STAR_VR;
-        LocalTrrk
-        ( UPPER, ADJOINT, F(-1), A12_STAR_MC, A12_STAR_MR, F(1), A22 );
+
+        const Int nbNext = Min(bsize,n-(k+nb));
+        gatheredNext = ( ctrl.lookAhead > 0 && nbNext > 0 );
+        if( gatheredNext )
+        {
+            // Update the next panel first so that its gather can proceed
+            // during the remainder of the trailing update
+            const Range<Int> indT( 0, nbNext ), indB( nbNext, END );
+            auto A22T = A22( indT, ALL );
+            auto A22TL = A22( indT, indT );
+            auto A22TR = A22( indT, indB );
+            auto A22BR = A22( indB, indB );
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12_STAR_MC( ALL, indT ), A12_STAR_MR( ALL, indT ),
+              F(1), A22TL );
+            LocalGemm
+            ( ADJOINT, NORMAL,
+              F(-1), A12_STAR_MC( ALL, indT ), A12_STAR_MR( ALL, indB ),
+              F(1), A22TR );
+            nextRequest = ICopy( A22T, ANext_STAR_MR );
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12_STAR_MC( ALL, indB ), A12_STAR_MR( ALL, indB ),
+              F(1), A22BR );
+        }
+        else
+            LocalTrrk
+            ( UPPER, ADJOINT, F(-1), A12_STAR_MC, A12_STAR_MR, F(1), A22 );
         A12 = A12_STAR_MR;
     }
 }
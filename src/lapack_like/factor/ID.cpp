@@ -166,6 +166,88 @@ void ID
     }
 }
 
+// Rather than pivoting on A itself, choose the skeleton columns via a pivoted
+// QR decomposition of the row sketch Y = S A, where S is a random embedding
+// with slightly more rows than the requested rank. So long as S A preserves
+// the geometry of the dominant row space of A, the column pivots and
+// interpolation matrix of Y yield a near-optimal ID of A, with the expensive
+// column pivoting confined to a matrix with only rank+oversample rows.
+// Power iterations replace Y with (an orthonormal basis for the row space of)
+// Y (A^H A)^q, which does not change the ID of Y.
+
+template<typename F>
+void RandomizedID
+( const Matrix<F>& A,
+        Permutation& Omega,
+        Matrix<F>& Z,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int sketchSize = Min( rank+ctrl.oversample, Min(m,n) );
+
+    // Form Y^H = A^H S^H
+    Matrix<F> AAdj, YAdj, W;
+    Adjoint( A, AAdj );
+    Sketch( AAdj, YAdj, sketchSize, ctrl );
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        if( ctrl.progress )
+            Output("Power iteration ",it);
+        qr::ExplicitUnitary( YAdj );
+        Gemm( NORMAL, NORMAL, F(1), A, YAdj, W );
+        qr::ExplicitUnitary( W );
+        Gemm( ADJOINT, NORMAL, F(1), A, W, YAdj );
+    }
+    Matrix<F> Y;
+    Adjoint( YAdj, Y );
+
+    QRCtrl<Base<F>> qrCtrl;
+    qrCtrl.boundRank = true;
+    qrCtrl.maxRank = Min( rank, sketchSize );
+    id::BusingerGolub( Y, Omega, Z, qrCtrl );
+}
+
+template<typename F>
+void RandomizedID
+( const ElementalMatrix<F>& APre,
+        DistPermutation& Omega,
+        ElementalMatrix<F>& Z,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int sketchSize = Min( rank+ctrl.oversample, Min(m,n) );
+
+    // Form Y^H = A^H S^H
+    DistMatrix<F> AAdj(g), YAdj(g), W(g);
+    Adjoint( A, AAdj );
+    Sketch( AAdj, YAdj, sketchSize, ctrl );
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("Power iteration ",it);
+        qr::ExplicitUnitary( YAdj );
+        Gemm( NORMAL, NORMAL, F(1), A, YAdj, W );
+        qr::ExplicitUnitary( W );
+        Gemm( ADJOINT, NORMAL, F(1), A, W, YAdj );
+    }
+    DistMatrix<F> Y(g);
+    Adjoint( YAdj, Y );
+
+    QRCtrl<Base<F>> qrCtrl;
+    qrCtrl.boundRank = true;
+    qrCtrl.maxRank = Min( rank, sketchSize );
+    id::BusingerGolub( Y, Omega, Z, qrCtrl );
+}
+
 #define PROTO(F) \
   template void ID \
   ( const Matrix<F>& A, \
@@ -188,7 +270,19 @@ void ID
     DistPermutation& Omega, \
     ElementalMatrix<F>& Z, \
     const QRCtrl<Base<F>>& ctrl, \
-    bool canOverwrite ); 
+    bool canOverwrite ); \
+  template void RandomizedID \
+  ( const Matrix<F>& A, \
+          Permutation& Omega, \
+          Matrix<F>& Z, \
+          Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RandomizedID \
+  ( const ElementalMatrix<F>& A, \
+          DistPermutation& Omega, \
+          ElementalMatrix<F>& Z, \
+          Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
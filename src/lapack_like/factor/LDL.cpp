@@ -23,6 +23,8 @@
 
 #include "./LDL/dense/Pivoted.hpp"
 
+#include "./LDL/dense/Butterfly.hpp"
+
 #include "./LDL/dense/MultiplyAfter.hpp"
 #include "./LDL/dense/SolveAfter.hpp"
 
@@ -81,13 +83,38 @@ void LDL
     ldl::Pivoted( A, dSub, p, conjugate, ctrl );
 }
 
+// Randomized butterfly
+// --------------------
+template<typename F>
+void LDL
+( Matrix<F>& A,
+  ButterflyTransform<Base<F>>& U,
+  bool conjugate,
+  Int depth )
+{
+    DEBUG_CSE
+    ldl::Butterfly( A, U, conjugate, depth );
+}
+
+template<typename F>
+void LDL
+( ElementalMatrix<F>& A,
+  ButterflyTransform<Base<F>>& U,
+  bool conjugate,
+  Int depth )
+{
+    DEBUG_CSE
+    ldl::Butterfly( A, U, conjugate, depth );
+}
+
 // Sparse
 // ======
 template<typename F>
 void LDL
 ( const ldl::NodeInfo& info,
         ldl::Front<F>& front,
-  LDLFrontType newType )
+  LDLFrontType newType,
+  const ldl::BLRCtrl<Base<F>>& blrCtrl )
 {
     DEBUG_CSE
     if( !Unfactored(front.type) )
@@ -97,7 +124,7 @@ void LDL
     ChangeFrontType( front, SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( info, front, InitialFactorType(newType) );
+    ldl::Process( info, front, InitialFactorType(newType), blrCtrl );
 
     // Convert the fronts from the initial factorization to the requested form
     ChangeFrontType( front, newType );
@@ -107,7 +134,8 @@ template<typename F>
 void LDL
 ( const ldl::DistNodeInfo& info,
         ldl::DistFront<F>& front, 
-  LDLFrontType newType )
+  LDLFrontType newType,
+  const ldl::BLRCtrl<Base<F>>& blrCtrl )
 {
     DEBUG_CSE
     if( !Unfactored(front.type) )
@@ -117,7 +145,7 @@ void LDL
     ChangeFrontType( front, SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( info, front, InitialFactorType(newType) );
+    ldl::Process( info, front, InitialFactorType(newType), blrCtrl );
 
     // Convert the fronts from the initial factorization to the requested form
     ChangeFrontType( front, newType );
@@ -139,6 +167,38 @@ void LDL
     DistPermutation& p, \
     bool conjugate, \
     const LDLPivotCtrl<Base<F>>& ctrl ); \
+  template void LDL \
+  ( Matrix<F>& A, \
+    ButterflyTransform<Base<F>>& U, \
+    bool conjugate, \
+    Int depth ); \
+  template void LDL \
+  ( ElementalMatrix<F>& A, \
+    ButterflyTransform<Base<F>>& U, \
+    bool conjugate, \
+    Int depth ); \
+  template void ldl::ApplyButterfly \
+  ( Orientation orientation, \
+    const ButterflyTransform<Base<F>>& U, \
+          Matrix<F>& B ); \
+  template void ldl::ApplyButterfly \
+  ( Orientation orientation, \
+    const ButterflyTransform<Base<F>>& U, \
+          ElementalMatrix<F>& B ); \
+  template Int ldl::SolveAfter \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& AFact, \
+    const ButterflyTransform<Base<F>>& U, \
+          Matrix<F>& B, \
+    bool conjugated, \
+    Int maxRefineIts ); \
+  template Int ldl::SolveAfter \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& AFact, \
+    const ButterflyTransform<Base<F>>& U, \
+          ElementalMatrix<F>& B, \
+    bool conjugated, \
+    Int maxRefineIts ); \
   template InertiaType ldl::Inertia \
   ( const Matrix<Base<F>>& d, \
     const Matrix<F>& dSub ); \
@@ -191,11 +251,13 @@ void LDL
   template void LDL \
   ( const ldl::NodeInfo& info, \
           ldl::Front<F>& front, \
-    LDLFrontType newType ); \
+    LDLFrontType newType, \
+    const ldl::BLRCtrl<Base<F>>& blrCtrl ); \
   template void LDL \
   ( const ldl::DistNodeInfo& info, \
           ldl::DistFront<F>& front, \
-    LDLFrontType newType );
+    LDLFrontType newType, \
+    const ldl::BLRCtrl<Base<F>>& blrCtrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
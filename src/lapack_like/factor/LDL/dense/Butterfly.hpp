@@ -0,0 +1,284 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_BUTTERFLY_HPP
+#define EL_LDL_BUTTERFLY_HPP
+
+namespace El {
+namespace ldl {
+
+namespace butterfly {
+
+// Each level of the butterfly recursively halves the index blocks of the
+// previous level (with the second half receiving any odd index). Within a
+// block [beg,end) of the given level, with h = floor((end-beg)/2), index
+// i in [beg,beg+h) is paired with j=i+h via the butterfly
+//
+//   | x_i |    1    | a  b | | x_i |
+//   |     | := --- |      | |     |,   a = d(i), b = d(j),
+//   | x_j |   √2   | a -b | | x_j |
+//
+// and any trailing unpaired index is simply scaled by its diagonal entry.
+template<typename F>
+void ApplyLevel
+( const Base<F>* d,
+  Int beg, Int end, Int level,
+  bool transpose,
+  Base<F> scale,
+  F* x, Int incx )
+{
+    const Int h = (end-beg)/2;
+    if( level > 0 )
+    {
+        ApplyLevel( d, beg, beg+h, level-1, transpose, scale, x, incx );
+        ApplyLevel( d, beg+h, end, level-1, transpose, scale, x, incx );
+        return;
+    }
+    for( Int i=beg; i<beg+h; ++i )
+    {
+        const Int j = i + h;
+        const F chi = x[i*incx];
+        const F eta = x[j*incx];
+        if( transpose )
+        {
+            x[i*incx] = (scale*d[i])*(chi+eta);
+            x[j*incx] = (scale*d[j])*(chi-eta);
+        }
+        else
+        {
+            x[i*incx] = scale*(d[i]*chi+d[j]*eta);
+            x[j*incx] = scale*(d[i]*chi-d[j]*eta);
+        }
+    }
+    if( end-beg > 2*h )
+        x[(end-1)*incx] *= d[end-1];
+}
+
+// Apply U (or U^T) to each of the 'numVecs' vectors stored in 'buf', where
+// vector k begins at buf[k*vecStride] and has entries separated by 'inc'
+template<typename F>
+void ApplyToVectors
+( Orientation orientation,
+  const ButterflyTransform<Base<F>>& U,
+  Int numVecs, F* buf, Int vecStride, Int inc )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = U.Height();
+    const Int depth = U.Depth();
+    const Real* dBuf = U.diags.LockedBuffer();
+    const Int dLDim = U.diags.LDim();
+    const Real scale = 1/Sqrt(Real(2));
+    const bool transpose = ( orientation != NORMAL );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numVecs; ++k )
+    {
+        F* x = &buf[k*vecStride];
+        // U = U_0 U_1 ... U_{d-1}, so U^T applies the coarsest level first
+        for( Int step=0; step<depth; ++step )
+        {
+            const Int level = ( transpose ? step : depth-1-step );
+            ApplyLevel
+            ( &dBuf[level*dLDim], Int(0), n, level, transpose, scale,
+              x, inc );
+        }
+    }
+}
+
+// The random diagonals follow Baboulin et al.: exp(r/10) with r uniformly
+// drawn from [-1/2,1/2]
+template<typename Real>
+void Random( Int n, Int depth, ButterflyTransform<Real>& U )
+{
+    DEBUG_CSE
+    U.diags.Resize( n, depth );
+    for( Int l=0; l<depth; ++l )
+        for( Int i=0; i<n; ++i )
+            U.diags(i,l) = Exp( SampleUniform(Real(-1)/2,Real(1)/2)/10 );
+}
+
+// A := U^T A U for the random butterfly U
+template<typename F>
+void Transform( Matrix<F>& A, const ButterflyTransform<Base<F>>& U )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    // A := U^T A
+    ApplyToVectors( TRANSPOSE, U, n, ABuf, ALDim, Int(1) );
+    // A := A U, i.e., each row r of A is replaced by (U^T r^T)^T
+    ApplyToVectors( TRANSPOSE, U, n, ABuf, Int(1), ALDim );
+}
+
+} // namespace butterfly
+
+template<typename F>
+void Butterfly
+( Matrix<F>& A,
+  ButterflyTransform<Base<F>>& U,
+  bool conjugate,
+  Int depth )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( depth < 0 )
+        LogicError("The butterfly depth must be non-negative");
+    butterfly::Random( A.Height(), depth, U );
+    MakeSymmetric( LOWER, A, conjugate );
+    butterfly::Transform( A, U );
+    Var3( A, conjugate );
+}
+
+template<typename F>
+void Butterfly
+( ElementalMatrix<F>& A,
+  ButterflyTransform<Base<F>>& U,
+  bool conjugate,
+  Int depth )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( depth < 0 )
+        LogicError("The butterfly depth must be non-negative");
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+
+    // Every process must apply the same butterfly
+    butterfly::Random( n, depth, U );
+    Broadcast( U.diags, g.Comm(), 0 );
+
+    // Since the butterflies couple rows (columns) that are far apart, each
+    // half of the transformation is applied after a redistribution which
+    // makes the columns (rows) local
+    MakeSymmetric( LOWER, A, conjugate );
+    DistMatrix<F,STAR,VR> A_STAR_VR( A );
+    butterfly::ApplyToVectors
+    ( TRANSPOSE, U, A_STAR_VR.LocalWidth(),
+      A_STAR_VR.Buffer(), A_STAR_VR.LDim(), Int(1) );
+    DistMatrix<F,VC,STAR> A_VC_STAR( A_STAR_VR );
+    A_STAR_VR.Empty();
+    butterfly::ApplyToVectors
+    ( TRANSPOSE, U, A_VC_STAR.LocalHeight(),
+      A_VC_STAR.Buffer(), Int(1), A_VC_STAR.LDim() );
+    Copy( A_VC_STAR, A );
+    A_VC_STAR.Empty();
+
+    Var3( A, conjugate );
+}
+
+template<typename F>
+void ApplyButterfly
+( Orientation orientation,
+  const ButterflyTransform<Base<F>>& U,
+        Matrix<F>& B )
+{
+    DEBUG_CSE
+    if( U.Height() != B.Height() )
+        LogicError("The butterfly and B must have the same height");
+    butterfly::ApplyToVectors
+    ( orientation, U, B.Width(), B.Buffer(), B.LDim(), Int(1) );
+}
+
+template<typename F>
+void ApplyButterfly
+( Orientation orientation,
+  const ButterflyTransform<Base<F>>& U,
+        ElementalMatrix<F>& B )
+{
+    DEBUG_CSE
+    if( U.Height() != B.Height() )
+        LogicError("The butterfly and B must have the same height");
+    DistMatrix<F,STAR,VR> B_STAR_VR( B );
+    butterfly::ApplyToVectors
+    ( orientation, U, B_STAR_VR.LocalWidth(),
+      B_STAR_VR.Buffer(), B_STAR_VR.LDim(), Int(1) );
+    Copy( B_STAR_VR, B );
+}
+
+template<typename F>
+Int SolveAfter
+( const Matrix<F>& A,
+  const Matrix<F>& AFact,
+  const ButterflyTransform<Base<F>>& U,
+        Matrix<F>& B,
+  bool conjugated,
+  Int maxRefineIts )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    // X := inv(A) B = U inv(U^T A U) U^T B
+    auto solve = [&]( Matrix<F>& X )
+      {
+        ApplyButterfly( TRANSPOSE, U, X );
+        SolveAfter( AFact, X, conjugated );
+        ApplyButterfly( NORMAL, U, X );
+      };
+
+    Matrix<F> X( B );
+    solve( X );
+
+    const Real tol = A.Height()*limits::Epsilon<Real>()*FrobeniusNorm(B);
+    Matrix<F> R;
+    Int refineIt=0;
+    for( ; refineIt<maxRefineIts; ++refineIt )
+    {
+        R = B;
+        Symm( LEFT, LOWER, F(-1), A, X, F(1), R, conjugated );
+        if( FrobeniusNorm(R) <= tol )
+            break;
+        solve( R );
+        X += R;
+    }
+    B = X;
+    return refineIt;
+}
+
+template<typename F>
+Int SolveAfter
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& AFact,
+  const ButterflyTransform<Base<F>>& U,
+        ElementalMatrix<F>& B,
+  bool conjugated,
+  Int maxRefineIts )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    auto solve = [&]( ElementalMatrix<F>& X )
+      {
+        ApplyButterfly( TRANSPOSE, U, X );
+        SolveAfter( AFact, X, conjugated );
+        ApplyButterfly( NORMAL, U, X );
+      };
+
+    DistMatrix<F> X( B );
+    solve( X );
+
+    const Real tol = A.Height()*limits::Epsilon<Real>()*FrobeniusNorm(B);
+    DistMatrix<F> R( B.Grid() );
+    Int refineIt=0;
+    for( ; refineIt<maxRefineIts; ++refineIt )
+    {
+        Copy( B, R );
+        Symm( LEFT, LOWER, F(-1), A, X, F(1), R, conjugated );
+        if( FrobeniusNorm(R) <= tol )
+            break;
+        solve( R );
+        X += R;
+    }
+    Copy( X, B );
+    return refineIt;
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_BUTTERFLY_HPP
@@ -171,7 +171,7 @@ Panel
             else
                 Y21 = A21;
             
-            auto D11Inv = D11;
+            FixedMatrix<F,2,2> D11Inv( D11 );
             Symmetric2x2Inv( LOWER, D11Inv, conjugate );
             MakeSymmetric( LOWER, D11Inv, conjugate );
             Transform2x2Cols( D11Inv, A21, 0, 1 );
@@ -219,8 +219,7 @@ Panel
           LogicError("dSub is the wrong size" );
     )
 
-    DistMatrix<F,STAR,STAR> D11_STAR_STAR( A.Grid() ),
-                            D11Inv_STAR_STAR( A.Grid() );
+    DistMatrix<F,STAR,STAR> D11_STAR_STAR( A.Grid() );
 
     Int k=0;
     while( k < bsize )
@@ -313,10 +312,10 @@ Panel
                 Y21 = A21;
             D11_STAR_STAR = D11;
 
-            D11Inv_STAR_STAR = D11_STAR_STAR;
-            Symmetric2x2Inv( LOWER, D11Inv_STAR_STAR.Matrix(), conjugate );
-            MakeSymmetric( LOWER, D11Inv_STAR_STAR.Matrix(), conjugate );
-            Transform2x2Cols( D11Inv_STAR_STAR, A21, 0, 1 );
+            FixedMatrix<F,2,2> D11Inv( D11_STAR_STAR.LockedMatrix() );
+            Symmetric2x2Inv( LOWER, D11Inv, conjugate );
+            MakeSymmetric( LOWER, D11Inv, conjugate );
+            Transform2x2Cols( D11Inv, A21, 0, 1 );
 
             X21 = A21;
 
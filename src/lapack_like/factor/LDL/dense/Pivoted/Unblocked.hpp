@@ -119,7 +119,7 @@ Unblocked
             auto A22 = A( ind2, ind2 );
             Y21 = A21;
 
-            auto D11Inv = D11;
+            FixedMatrix<F,2,2> D11Inv( D11 );
             Symmetric2x2Inv( LOWER, D11Inv, conjugate );
             MakeSymmetric( LOWER, D11Inv, conjugate );
             Transform2x2Cols( D11Inv, A21, 0, 1 );
@@ -162,7 +162,7 @@ Unblocked
     auto& A = AProx.Get();
 
     DistMatrix<F> Y21(g);
-    DistMatrix<F,STAR,STAR> D11_STAR_STAR(g), D11Inv_STAR_STAR(g);
+    DistMatrix<F,STAR,STAR> D11_STAR_STAR(g);
 
     Int k=0;
     while( k < n )
@@ -208,10 +208,10 @@ Unblocked
             Y21 = A21;
             D11_STAR_STAR = D11;
 
-            D11Inv_STAR_STAR = D11_STAR_STAR;
-            Symmetric2x2Inv( LOWER, D11Inv_STAR_STAR.Matrix(), conjugate );
-            MakeSymmetric( LOWER, D11Inv_STAR_STAR.Matrix(), conjugate );
-            Transform2x2Cols( D11Inv_STAR_STAR, A21, 0, 1 );
+            FixedMatrix<F,2,2> D11Inv( D11_STAR_STAR.LockedMatrix() );
+            Symmetric2x2Inv( LOWER, D11Inv, conjugate );
+            MakeSymmetric( LOWER, D11Inv, conjugate );
+            Transform2x2Cols( D11Inv, A21, 0, 1 );
 
             Trr2( LOWER, F(-1), A21, Y21, A22, conjugate );
 
@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename F>
+BlockJacobiPreconditioner<F>::BlockJacobiPreconditioner()
+: initialized_(false), incomplete_(false), subdomainComm_(mpi::COMM_NULL),
+  firstSubdomainRow_(0), subdomainHeight_(0)
+{ }
+
+template<typename F>
+BlockJacobiPreconditioner<F>::~BlockJacobiPreconditioner()
+{
+    // The factorization must be destroyed before its communicator is freed
+    factorization_.reset();
+    if( !mpi::Finalized() && subdomainComm_ != mpi::COMM_NULL )
+        mpi::Free( subdomainComm_ );
+}
+
+template<typename F>
+void BlockJacobiPreconditioner<F>::Initialize
+( const DistSparseMatrix<F>& A,
+  const BlockJacobiCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square matrix");
+    mpi::Comm comm = A.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int procsPerSubdomain =
+      Max( Min( ctrl.procsPerSubdomain, Int(commSize) ), Int(1) );
+    if( ctrl.incomplete && procsPerSubdomain != 1 )
+        LogicError
+        ("Incomplete subdomain factorizations require one process per "
+         "subdomain");
+
+    // Since the rows of a DistSparseMatrix are distributed in contiguous
+    // blocks, the rows of consecutive processes form a contiguous subdomain
+    factorization_.reset();
+    if( subdomainComm_ != mpi::COMM_NULL )
+        mpi::Free( subdomainComm_ );
+    mpi::Split
+    ( comm, commRank/procsPerSubdomain, commRank, subdomainComm_ );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    firstSubdomainRow_ =
+      mpi::AllReduce( firstLocalRow, mpi::MIN, subdomainComm_ );
+    subdomainHeight_ = mpi::AllReduce( localHeight, subdomainComm_ );
+    const Int lastSubdomainRow = firstSubdomainRow_ + subdomainHeight_;
+    incomplete_ = ctrl.incomplete;
+
+    // Extract the diagonal block of the subdomain
+    const Int numLocalEntries = A.NumLocalEntries();
+    if( incomplete_ )
+    {
+        SparseMatrix<F> ABlock;
+        Zeros( ABlock, subdomainHeight_, subdomainHeight_ );
+        ABlock.Reserve( numLocalEntries );
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            const Int j = A.Col(e);
+            if( j >= firstSubdomainRow_ && j < lastSubdomainRow )
+                ABlock.QueueUpdate
+                ( A.Row(e)-firstSubdomainRow_, j-firstSubdomainRow_,
+                  A.Value(e) );
+        }
+        ABlock.ProcessQueues();
+
+        auto incompleteCtrl = ctrl.incompleteCtrl;
+        incompleteCtrl.hermitian = ctrl.hermitian;
+        incompleteFactorization_.Initialize( ABlock, incompleteCtrl );
+    }
+    else
+    {
+        DistSparseMatrix<F> ABlock(subdomainComm_);
+        Zeros( ABlock, subdomainHeight_, subdomainHeight_ );
+        ABlock.Reserve( numLocalEntries, numLocalEntries );
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            const Int j = A.Col(e);
+            if( j >= firstSubdomainRow_ && j < lastSubdomainRow )
+                ABlock.QueueUpdate
+                ( A.Row(e)-firstSubdomainRow_, j-firstSubdomainRow_,
+                  A.Value(e) );
+        }
+        ABlock.ProcessQueues();
+
+        factorization_.reset( new DistSparseLDLFactorization<F> );
+        factorization_->Initialize
+        ( ABlock, ctrl.hermitian, LDL_2D, ctrl.bisectCtrl );
+    }
+    initialized_ = true;
+}
+
+template<typename F>
+void BlockJacobiPreconditioner<F>::Solve( DistMultiVec<F>& B ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The preconditioner has not been initialized");
+    if( incomplete_ )
+    {
+        // Each process owns its entire subdomain
+        incompleteFactorization_.Solve( B.Matrix() );
+        return;
+    }
+
+    // Redistribute the rows of the subdomain over its communicator
+    const Int width = B.Width();
+    const Int localHeight = B.LocalHeight();
+    const Int firstLocalRow = B.FirstLocalRow();
+    DistMultiVec<F> BSub(subdomainComm_);
+    Zeros( BSub, subdomainHeight_, width );
+    BSub.Reserve( localHeight*width );
+    for( Int j=0; j<width; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            BSub.QueueUpdate
+            ( firstLocalRow+iLoc-firstSubdomainRow_, j, B.GetLocal(iLoc,j) );
+    BSub.ProcessQueues();
+
+    factorization_->Solve( BSub );
+
+    // Return the solution to the original distribution
+    const Int subLocalHeight = BSub.LocalHeight();
+    Zero( B );
+    B.Reserve( subLocalHeight*width );
+    for( Int j=0; j<width; ++j )
+        for( Int iLoc=0; iLoc<subLocalHeight; ++iLoc )
+            B.QueueUpdate
+            ( firstSubdomainRow_+BSub.GlobalRow(iLoc), j,
+              BSub.GetLocal(iLoc,j) );
+    B.ProcessQueues();
+}
+
+template<typename F>
+bool BlockJacobiPreconditioner<F>::Initialized() const
+{ return initialized_; }
+
+#define PROTO(F) \
+  template class BlockJacobiPreconditioner<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
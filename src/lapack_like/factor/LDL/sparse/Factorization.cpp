@@ -0,0 +1,292 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename F>
+SparseLDLFactorization<F>::SparseLDLFactorization()
+: initialized_(false), hermitian_(true), frontType_(LDL_2D)
+{ }
+
+template<typename F>
+void SparseLDLFactorization<F>::Initialize
+( const SparseMatrix<F>& A,
+  bool hermitian,
+  LDLFrontType frontType,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square matrix");
+    ldl::NestedDissection( A.LockedGraph(), map_, sep_, info_, ctrl );
+    InvertMap( map_, invMap_ );
+    hermitian_ = hermitian;
+    frontType_ = frontType;
+    initialized_ = true;
+    Refactor( A );
+}
+
+template<typename F>
+void SparseLDLFactorization<F>::Refactor( const SparseMatrix<F>& A )
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The factorization has not been initialized");
+    if( A.Height() != Int(map_.size()) )
+        LogicError("A does not match the analyzed sparsity pattern");
+    front_.Pull( A, map_, info_, hermitian_ );
+    LDL( info_, front_, frontType_ );
+}
+
+template<typename F>
+void SparseLDLFactorization<F>::Solve( Matrix<F>& B ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The factorization has not been initialized");
+    ldl::SolveAfter( invMap_, info_, front_, B );
+}
+
+template<typename F>
+Int SparseLDLFactorization<F>::SolveWithIterativeRefinement
+( const SparseMatrix<F>& A,
+        Matrix<F>& B,
+  Base<F> minReductionFactor,
+  Int maxRefineIts ) const
+{
+    DEBUG_CSE
+    auto BOrig = B;
+
+    // Compute the initial guess
+    // =========================
+    Matrix<F> X( B );
+    Solve( X );
+
+    Int refineIt = 0;
+    if( maxRefineIts > 0 )
+    {
+        Matrix<F> dX, XCand;
+        Multiply( NORMAL, F(-1), A, X, F(1), B );
+        Base<F> errorNorm = FrobeniusNorm( B );
+        for( ; refineIt<maxRefineIts; ++refineIt )
+        {
+            // Compute the proposed update to the solution
+            // -------------------------------------------
+            dX = B;
+            Solve( dX );
+            XCand = X;
+            XCand += dX;
+
+            // If the proposed update lowers the residual, accept it
+            // -----------------------------------------------------
+            B = BOrig;
+            Multiply( NORMAL, F(-1), A, XCand, F(1), B );
+            const Base<F> newErrorNorm = FrobeniusNorm( B );
+            if( minReductionFactor*newErrorNorm < errorNorm )
+            {
+                X = XCand;
+                errorNorm = newErrorNorm;
+            }
+            else if( newErrorNorm < errorNorm )
+            {
+                X = XCand;
+                errorNorm = newErrorNorm;
+                break;
+            }
+            else
+                break;
+        }
+    }
+    // Store the final result
+    // ======================
+    B = X;
+    return refineIt;
+}
+
+template<typename F>
+bool SparseLDLFactorization<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+const ldl::NodeInfo& SparseLDLFactorization<F>::Info() const
+{ return info_; }
+
+template<typename F>
+const ldl::Front<F>& SparseLDLFactorization<F>::Front() const
+{ return front_; }
+
+template<typename F>
+const vector<Int>& SparseLDLFactorization<F>::Map() const
+{ return map_; }
+
+template<typename F>
+const vector<Int>& SparseLDLFactorization<F>::InverseMap() const
+{ return invMap_; }
+
+template<typename F>
+DistSparseLDLFactorization<F>::DistSparseLDLFactorization()
+: initialized_(false), hermitian_(true), frontType_(LDL_2D)
+{ }
+
+template<typename F>
+void DistSparseLDLFactorization<F>::Initialize
+( const DistSparseMatrix<F>& A,
+  bool hermitian,
+  LDLFrontType frontType,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square matrix");
+    ldl::NestedDissection( A.LockedDistGraph(), map_, sep_, info_, ctrl );
+    InvertMap( map_, invMap_ );
+
+    // Throw away any metadata from a previous sparsity pattern
+    SwapClear( mappedSources_ );
+    SwapClear( mappedTargets_ );
+    SwapClear( colOffs_ );
+    multiVecMeta_ = ldl::DistMultiVecNodeMeta();
+    XNodal_.reset();
+
+    hermitian_ = hermitian;
+    frontType_ = frontType;
+    initialized_ = true;
+    Refactor( A );
+}
+
+template<typename F>
+void DistSparseLDLFactorization<F>::Refactor( const DistSparseMatrix<F>& A )
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The factorization has not been initialized");
+    if( A.LocalHeight() != map_.NumLocalSources() )
+        LogicError("A does not match the analyzed sparsity pattern");
+    // Since the reordered indices are reused, the fronts keep the metadata for
+    // exchanging their child updates from the previous factorization
+    front_.Pull
+    ( A, map_, sep_, info_, mappedSources_, mappedTargets_, colOffs_,
+      hermitian_ );
+    LDL( info_, front_, frontType_ );
+}
+
+template<typename F>
+void DistSparseLDLFactorization<F>::Solve( DistMultiVec<F>& B ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The factorization has not been initialized");
+    if( XNodal_ == nullptr )
+        XNodal_.reset( new ldl::DistMultiVecNode<F> );
+    XNodal_->Pull( invMap_, info_, B, multiVecMeta_ );
+    if( FrontIs1D(front_.type) )
+    {
+        ldl::SolveAfter( info_, front_, *XNodal_ );
+    }
+    else
+    {
+        ldl::DistMatrixNode<F> XMat( *XNodal_ );
+        ldl::SolveAfter( info_, front_, XMat );
+        *XNodal_ = XMat;
+    }
+    XNodal_->Push( invMap_, info_, B, multiVecMeta_ );
+}
+
+template<typename F>
+Int DistSparseLDLFactorization<F>::SolveWithIterativeRefinement
+( const DistSparseMatrix<F>& A,
+        DistMultiVec<F>& B,
+  Base<F> minReductionFactor,
+  Int maxRefineIts ) const
+{
+    DEBUG_CSE
+    mpi::Comm comm = B.Comm();
+    DistMultiVec<F> BOrig(comm);
+    BOrig = B;
+
+    // Compute the initial guess
+    // =========================
+    DistMultiVec<F> X(comm);
+    X = B;
+    Solve( X );
+
+    Int refineIt = 0;
+    if( maxRefineIts > 0 )
+    {
+        DistMultiVec<F> dX(comm), XCand(comm);
+        Multiply( NORMAL, F(-1), A, X, F(1), B );
+        Base<F> errorNorm = FrobeniusNorm( B );
+        for( ; refineIt<maxRefineIts; ++refineIt )
+        {
+            // Compute the proposed update to the solution
+            // -------------------------------------------
+            dX = B;
+            Solve( dX );
+            XCand = X;
+            XCand += dX;
+
+            // If the proposed update lowers the residual, accept it
+            // -----------------------------------------------------
+            B = BOrig;
+            Multiply( NORMAL, F(-1), A, XCand, F(1), B );
+            const Base<F> newErrorNorm = FrobeniusNorm( B );
+            if( minReductionFactor*newErrorNorm < errorNorm )
+            {
+                X = XCand;
+                errorNorm = newErrorNorm;
+            }
+            else if( newErrorNorm < errorNorm )
+            {
+                X = XCand;
+                errorNorm = newErrorNorm;
+                break;
+            }
+            else
+                break;
+        }
+    }
+    // Store the final result
+    // ======================
+    B = X;
+    return refineIt;
+}
+
+template<typename F>
+bool DistSparseLDLFactorization<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+const ldl::DistNodeInfo& DistSparseLDLFactorization<F>::Info() const
+{ return info_; }
+
+template<typename F>
+const ldl::DistFront<F>& DistSparseLDLFactorization<F>::Front() const
+{ return front_; }
+
+template<typename F>
+const DistMap& DistSparseLDLFactorization<F>::Map() const
+{ return map_; }
+
+template<typename F>
+const DistMap& DistSparseLDLFactorization<F>::InverseMap() const
+{ return invMap_; }
+
+#define PROTO(F) \
+  template class SparseLDLFactorization<F>; \
+  template class DistSparseLDLFactorization<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,217 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename F>
+IncompleteLDLFactorization<F>::IncompleteLDLFactorization()
+: initialized_(false), hermitian_(true)
+{ }
+
+template<typename F>
+void IncompleteLDLFactorization<F>::Initialize
+( const SparseMatrix<F>& A,
+  const IncompleteLDLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("Expected a square matrix");
+    ldl::Separator sep;
+    ldl::NodeInfo info;
+    ldl::NestedDissection( A.LockedGraph(), map_, sep, info, ctrl.bisectCtrl );
+    InvertMap( map_, invMap_ );
+    hermitian_ = ctrl.hermitian;
+
+    colOffs_.resize( n+1 );
+    colOffs_[0] = 0;
+    rowInds_.clear();
+    values_.clear();
+    diag_.resize( n );
+
+    // rowCols[i] lists the columns j < i for which L(i,j) is nonzero
+    vector<vector<Int>> rowCols( n );
+
+    // A dense accumulator (and the pattern) of the current column
+    vector<F> work( n, F(0) );
+    vector<bool> marked( n, false );
+    vector<Int> pattern;
+    auto accumulate =
+      [&]( Int i, F value )
+      {
+          if( marked[i] )
+          {
+              work[i] += value;
+          }
+          else
+          {
+              marked[i] = true;
+              work[i] = value;
+              pattern.push_back( i );
+          }
+      };
+
+    vector<ValueInt<Real>> candidates;
+    for( Int k=0; k<n; ++k )
+    {
+        // Load the reordered A(k:n-1,k), which is the adjoint (or transpose)
+        // of the upper portion of row invMap[k] of the original matrix
+        pattern.clear();
+        accumulate( k, F(0) );
+        const Int iOrig = invMap_[k];
+        const Int offset = A.RowOffset( iOrig );
+        const Int numConnect = A.NumConnections( iOrig );
+        Real colNormSq = 0;
+        Int numOrigEntries = 1;
+        for( Int e=offset; e<offset+numConnect; ++e )
+        {
+            const Int i = map_[A.Col(e)];
+            if( i < k )
+                continue;
+            const F value = ( hermitian_ ? Conj(A.Value(e)) : A.Value(e) );
+            const Real absValue = Abs(value);
+            colNormSq += absValue*absValue;
+            if( i > k )
+                ++numOrigEntries;
+            accumulate( i, value );
+        }
+
+        // Subtract L(k:n-1,j) d(j) L(k,j)^H for each nonzero L(k,j)
+        for( const Int j : rowCols[k] )
+        {
+            auto colBeg = rowInds_.begin() + colOffs_[j];
+            auto colEnd = rowInds_.begin() + colOffs_[j+1];
+            const Int kOff = std::lower_bound( colBeg, colEnd, k ) -
+                             rowInds_.begin();
+            const F lambda = values_[kOff];
+            const F scale = diag_[j]*( hermitian_ ? Conj(lambda) : lambda );
+            for( Int e=kOff; e<colOffs_[j+1]; ++e )
+                accumulate( rowInds_[e], -values_[e]*scale );
+        }
+        SwapClear( rowCols[k] );
+
+        // Guard against tiny pivots
+        const Real colNorm =
+          ( colNormSq > Real(0) ? Sqrt(colNormSq) : Real(1) );
+        const Real minPivot = ctrl.pivotTol*colNorm;
+        F delta = work[k];
+        if( Abs(delta) < minPivot )
+            delta = ( RealPart(delta) < Real(0) ? -minPivot : minPivot );
+        diag_[k] = delta;
+
+        // Keep the largest of the entries which survive the drop tolerance
+        candidates.clear();
+        const Real dropThresh = ctrl.dropTol*colNorm;
+        for( const Int i : pattern )
+        {
+            if( i == k )
+                continue;
+            const Real absValue = Abs(work[i]);
+            if( absValue > dropThresh )
+                candidates.push_back( ValueInt<Real>{absValue,i} );
+        }
+        const Int maxFill =
+          Max( Int(ctrl.fillFactor*Real(numOrigEntries)), Int(1) );
+        if( Int(candidates.size()) > maxFill )
+        {
+            std::nth_element
+            ( candidates.begin(), candidates.begin()+maxFill, candidates.end(),
+              []( const ValueInt<Real>& a, const ValueInt<Real>& b )
+              { return a.value > b.value; } );
+            candidates.resize( maxFill );
+        }
+        std::sort
+        ( candidates.begin(), candidates.end(),
+          []( const ValueInt<Real>& a, const ValueInt<Real>& b )
+          { return a.index < b.index; } );
+        for( const auto& candidate : candidates )
+        {
+            const Int i = candidate.index;
+            rowInds_.push_back( i );
+            values_.push_back( work[i]/delta );
+            rowCols[i].push_back( k );
+        }
+        colOffs_[k+1] = rowInds_.size();
+
+        for( const Int i : pattern )
+        {
+            work[i] = 0;
+            marked[i] = false;
+        }
+    }
+    initialized_ = true;
+}
+
+template<typename F>
+void IncompleteLDLFactorization<F>::Solve( Matrix<F>& B ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The factorization has not been initialized");
+    const Int n = diag_.size();
+    if( B.Height() != n )
+        LogicError("B was not the correct height");
+    vector<F> x( n );
+    for( Int j=0; j<B.Width(); ++j )
+    {
+        for( Int k=0; k<n; ++k )
+            x[k] = B(invMap_[k],j);
+
+        // x := inv(L) x
+        for( Int k=0; k<n; ++k )
+        {
+            const F xk = x[k];
+            if( xk == F(0) )
+                continue;
+            for( Int e=colOffs_[k]; e<colOffs_[k+1]; ++e )
+                x[rowInds_[e]] -= values_[e]*xk;
+        }
+
+        // x := inv(D) x
+        for( Int k=0; k<n; ++k )
+            x[k] /= diag_[k];
+
+        // x := inv(L^H) x (or inv(L^T) x)
+        for( Int k=n-1; k>=0; --k )
+        {
+            F xk = x[k];
+            for( Int e=colOffs_[k]; e<colOffs_[k+1]; ++e )
+            {
+                const F lambda = ( hermitian_ ? Conj(values_[e]) : values_[e] );
+                xk -= lambda*x[rowInds_[e]];
+            }
+            x[k] = xk;
+        }
+
+        for( Int k=0; k<n; ++k )
+            B(invMap_[k],j) = x[k];
+    }
+}
+
+template<typename F>
+bool IncompleteLDLFactorization<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+Int IncompleteLDLFactorization<F>::NumEntries() const
+{ return values_.size(); }
+
+#define PROTO(F) \
+  template class IncompleteLDLFactorization<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -207,9 +207,12 @@ void UnpackEntries
 {
     DEBUG_CSE
     const Grid& grid = *node.grid;
+    front.L1D.Empty();
 
     if( sep.child == nullptr )
     {
+        delete front.child;
+        front.child = nullptr;
         delete front.duplicate;
         front.duplicate = new Front<F>(&front);
         UnpackEntriesLocal
@@ -220,8 +223,18 @@ void UnpackEntries
 
         return;
     }
-    delete front.child;
-    front.child = new DistFront<F>(&front);
+    delete front.duplicate;
+    front.duplicate = nullptr;
+
+    // Reuse the existing child front so that the metadata for exchanging its
+    // updates can be kept across refactorizations
+    if( front.child == nullptr )
+        front.child = new DistFront<F>(&front);
+    else
+    {
+        front.child->type = front.type;
+        front.child->isHermitian = front.isHermitian;
+    }
     UnpackEntries
     ( *sep.child, *node.child, *front.child, 
       A, rRowLengths, rEntries, rTargets, offs, entryOffs );
@@ -308,6 +321,10 @@ void DistFront<F>::Pull
     const int commRank = mpi::Rank( comm ); 
     Timer timer;
 
+    // Reused mappings imply that the structure of the tree has not changed
+    const bool sameStructure =
+      Int(mappedSources.size()) == A.LocalHeight() &&
+      mappedTargets.size() != 0 && colOffs.size() != 0;
     A.MappedSources( reordering, mappedSources );
     A.MappedTargets( reordering, mappedTargets, colOffs );
 
@@ -499,6 +516,9 @@ void DistFront<F>::Pull
     UnpackEntries
     ( rootSep, rootInfo, *this, 
       A, rRowLengths, rEntries, rTargets, rRowOffs, rEntriesOffs );
+    if( !sameStructure )
+        for( DistFront<F>* front=this; front!=nullptr; front=front->child )
+            front->commMeta.Empty();
     if( time && commRank == 0 )
         Output("Unpack: ",timer.Stop()," secs");
 }
@@ -1052,6 +1072,7 @@ DistFront<F>::operator=( const DistFront<F>& front )
     DEBUG_CSE
     isHermitian = front.isHermitian;
     type = front.type;
+    commMeta.Empty();
     if( front.child == nullptr )
     {
         child = nullptr;
@@ -1330,7 +1351,8 @@ void DistFront<F>::ComputeCommMeta
 ( const DistNodeInfo& info, bool computeRecvInds ) const
 {
     DEBUG_CSE
-    commMeta.Empty();
+    // Any receive indices which were already computed are kept
+    SwapClear( commMeta.numChildSendInds );
     if( child == nullptr )
         return;
 
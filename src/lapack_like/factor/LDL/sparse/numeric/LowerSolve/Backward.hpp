@@ -62,13 +62,15 @@ inline void LowerBackwardSolve
         auto childWB = childW( IR(childSize,END), ALL );
         childWT = X.children[c]->matrix;
 
-        // Update the child's workspace
+        // Update the child's workspace (one column at a time)
         const Int childUSize = childWB.Height();
-        for( Int iChild=0; iChild<childUSize; ++iChild )
+        const Int* relInds = info.childRelInds[c].data();
+        for( Int j=0; j<numRHS; ++j )
         {
-            const Int i = info.childRelInds[c][iChild];
-            for( Int j=0; j<numRHS; ++j )
-                childWB(iChild,j) = W(i,j);
+            const F* WCol = W.LockedBuffer(0,j);
+            F* childWBCol = childWB.Buffer(0,j);
+            for( Int iChild=0; iChild<childUSize; ++iChild )
+                childWBCol[iChild] = WCol[relInds[iChild]];
         }
     }
     if( haveParent )
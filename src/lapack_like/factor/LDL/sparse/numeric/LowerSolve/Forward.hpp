@@ -57,12 +57,16 @@ void LowerForwardSolve
         const Int childHeight = childW.Height();
         const Int childUSize = childHeight-childSize;
 
+        // Traverse the update one column at a time so that many right-hand
+        // sides stream through memory rather than striding across rows
         auto childU = childW( IR(childSize,childHeight), IR(0,numRHS) );
-        for( Int iChild=0; iChild<childUSize; ++iChild )
+        const Int* relInds = info.childRelInds[c].data();
+        for( Int j=0; j<numRHS; ++j )
         {
-            const Int iFront = info.childRelInds[c][iChild]; 
-            for( Int j=0; j<numRHS; ++j )
-                W(iFront,j) += childU(iChild,j);
+            const F* childUCol = childU.LockedBuffer(0,j);
+            F* WCol = W.Buffer(0,j);
+            for( Int iChild=0; iChild<childUSize; ++iChild )
+                WCol[relInds[iChild]] += childUCol[iChild];
         }
         childW.Empty();
     }
@@ -98,9 +102,8 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
-
-    // Set up a workspace
+    // Set up a workspace before descending into our child so that the
+    // receives for the child updates can be posted early
     // TODO: Only set up a workspace if there is a parent
     const Int numRHS = X.matrix.Width();
     const Int frontHeight =
@@ -117,8 +120,6 @@ void LowerForwardSolve
 
     // Compute the metadata for transmitting child updates
     X.ComputeCommMeta( info );
-    auto& childW = X.child->work;
-    auto childU = childW( IR(childInfo.size,childW.Height()), IR(0,numRHS) );
     vector<int> sendSizes(commSize), recvSizes(commSize);
     for( int q=0; q<commSize; ++q )
     {
@@ -130,7 +131,29 @@ void LowerForwardSolve
     const int sendBufSize = Scan( sendSizes, sendOffs );
     const int recvBufSize = Scan( recvSizes, recvOffs );
 
+    // Post the receives for the child updates. The processes solving the
+    // sibling subtree can then deliver their updates as soon as they finish
+    // rather than waiting for every process in this team to reach the
+    // exchange. Since the subtrees communicate over the child teams, no
+    // other point-to-point messages are sent over this team's communicator
+    // in the meantime.
+    vector<F> recvBuf( recvBufSize );
+    vector<mpi::Request<F>> requests;
+    requests.reserve( 2*commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( recvSizes[q] == 0 )
+            continue;
+        requests.emplace_back();
+        mpi::IRecv
+        ( &recvBuf[recvOffs[q]], recvSizes[q], q, comm, requests.back() );
+    }
+
+    LowerForwardSolve( childInfo, childFront, *X.child );
+
     // Pack our child's update
+    auto& childW = X.child->work;
+    auto childU = childW( IR(childInfo.size,childW.Height()), IR(0,numRHS) );
     vector<F> sendBuf( sendBufSize );
     const Int myChild = ( childInfo.onLeft ? 0 : 1 );
     auto packOffs = sendOffs;
@@ -148,11 +171,17 @@ void LowerForwardSolve
     if( X.child->duplicate != nullptr )
         X.child->duplicate->work.Empty();
 
-    // AllToAll to send and receive the child updates
-    vector<F> recvBuf( recvBufSize );
-    SparseAllToAll
-    ( sendBuf, sendSizes, sendOffs,
-      recvBuf, recvSizes, recvOffs, comm );
+    // Send the child updates
+    for( int q=0; q<commSize; ++q )
+    {
+        if( sendSizes[q] == 0 )
+            continue;
+        requests.emplace_back();
+        mpi::ISend
+        ( &sendBuf[sendOffs[q]], sendSizes[q], q, comm, requests.back() );
+    }
+    mpi::WaitAll( requests.size(), requests.data() );
+    SwapClear( requests );
     SwapClear( sendBuf );
     SwapClear( sendSizes );
     SwapClear( sendOffs );
@@ -710,7 +710,7 @@ void FrontLowerBackwardSolve
     )
     const bool blocked = BlockFactorization(type);
 
-    if( type == LDL_2D )
+    if( type == LDL_2D || type == BLR_LDL_2D )
         FrontVanillaLowerBackwardSolve( front.L2D, W, conjugate );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerBackwardSolve( front.L2D, W, conjugate );
@@ -740,9 +740,9 @@ void FrontLowerBackwardSolve
     )
     const bool blocked = BlockFactorization(type);
 
-    if( type == LDL_1D )
+    if( type == LDL_1D || type == BLR_LDL_1D )
         FrontVanillaLowerBackwardSolve( front.L1D, W, conjugate );
-    else if( type == LDL_2D )
+    else if( type == LDL_2D || type == BLR_LDL_2D )
         FrontVanillaLowerBackwardSolve( front.L2D, W, conjugate );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerBackwardSolve( front.L1D, W, conjugate );
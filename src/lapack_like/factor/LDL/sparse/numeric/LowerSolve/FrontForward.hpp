@@ -666,9 +666,9 @@ FrontLowerForwardSolve
     const LDLFrontType type = front.type;
 
     // TODO: Add support for LDL_2D
-    if( type == LDL_1D )
+    if( type == LDL_1D || type == BLR_LDL_1D )
         FrontVanillaLowerForwardSolve( front.L1D, W );
-    else if( type == LDL_2D )
+    else if( type == LDL_2D || type == BLR_LDL_2D )
         FrontVanillaLowerForwardSolve( front.L2D, W );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerForwardSolve( front.L1D, W );
@@ -693,7 +693,7 @@ FrontLowerForwardSolve( const DistFront<F>& front, DistMatrix<F>& W )
     DEBUG_CSE
     const LDLFrontType type = front.type;
 
-    if( type == LDL_2D )
+    if( type == LDL_2D || type == BLR_LDL_2D )
         FrontVanillaLowerForwardSolve( front.L2D, W );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerForwardSolve( front.L2D, W );
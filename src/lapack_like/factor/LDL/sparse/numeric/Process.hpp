@@ -25,128 +25,322 @@
 namespace El {
 namespace ldl {
 
-template<typename F> 
-inline void 
-Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+namespace process {
+
+// Subtrees requiring fewer than this many flops are not worth a separate task
+const double TASK_FLOP_CUTOFF = 1.e6;
+
+#ifdef EL_HYBRID
+// Exceptions (e.g., a ZeroPivotException) may not escape an OpenMP task or
+// parallel region, so the first one thrown by a task is captured here and
+// rethrown by its parent once the tasks have completed
+inline void CaptureException( std::exception_ptr& error )
+{
+    #pragma omp critical(ldlProcessException)
+    {
+        if( !error )
+            error = std::current_exception();
+    }
+}
+#endif
+
+inline double SubtreeFlops( const NodeInfo& info )
+{
+    const double size = info.size;
+    const double updateSize = info.lowerStruct.size();
+    double flops = size*size*size/3 + size*size*updateSize +
+                   size*updateSize*updateSize;
+    for( const NodeInfo* child : info.children )
+        flops += SubtreeFlops( *child );
+    return flops;
+}
+
+template<typename F>
+inline void
+SparseLeaf( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+{
+    DEBUG_CSE
+    front.type = factorType;
+    const Int m = front.LDense.Height();
+    const Int n = front.LDense.Width();
+    const Int numEntries = info.LOffsets.back();
+    const Int numSources = info.LOffsets.size()-1;
+
+    // TODO: Add support for pivoting here
+    if( PivotedFactorization(factorType) )
+        Zeros( front.subdiag, n-1, 1 );
+
+    Zeros( front.LSparse, numSources, numSources );
+    front.LSparse.ForceNumEntries( numEntries );
+    F* LValBuf = front.LSparse.ValueBuffer();
+    Int* LRowBuf = front.LSparse.SourceBuffer();
+    Int* LColBuf = front.LSparse.TargetBuffer();
+    Int* LOffsetBuf = front.LSparse.OffsetBuffer();
+
+    for( Int i=0; i<numSources; ++i )
+    {
+        const Int iStart = info.LOffsets[i];
+        const Int iEnd = info.LOffsets[i+1];
+        LOffsetBuf[i] = iStart;
+        for( Int e=iStart; e<iEnd; ++e )
+            LRowBuf[e] = i;
+    }
+    LOffsetBuf[numSources] = info.LOffsets[numSources];
+    front.diag.Resize( numSources, 1 );
+
+    // Factor the transpose of L
+    // TODO: Reuse these workspaces
+    vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
+    vector<F> y(numSources);
+    suite_sparse::ldl::Numeric
+    ( numSources,
+      front.workSparse.LockedOffsetBuffer(),
+      front.workSparse.LockedTargetBuffer(),
+      front.workSparse.LockedValueBuffer(),
+      LOffsetBuf,
+      info.LParents.data(),
+      LNnz.data(),
+      LColBuf,
+      LValBuf,
+      front.diag.Buffer(),
+      y.data(),
+      pattern.data(),
+      flag.data(),
+      (const Int*)nullptr,
+      (const Int*)nullptr,
+      front.isHermitian );
+    front.LSparse.ForceConsistency();
+
+    // Solve against L_{TL}^T from the right
+    bool onLeft = false;
+    suite_sparse::ldl::LTSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
+
+    // Save a copy of ABL
+    auto ABLCopy = front.LDense;
+
+    // Solve against the diagonal
+    suite_sparse::ldl::DSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      front.diag.Buffer() );
+
+    // Form the Schur complement
+    Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
+    Trrk
+    ( LOWER, NORMAL, orientation,
+      F(-1), front.LDense, ABLCopy, F(0), front.workDense );
+}
+
+// Add the update matrix of child c into the front (and then free it)
+template<typename F>
+inline void ExtendAdd( const NodeInfo& info, Front<F>& front, Int c )
+{
+    DEBUG_CSE
+    auto& FL = front.LDense;
+    auto& FBR = front.workDense;
+    auto& childU = front.children[c]->workDense;
+    const int childUSize = childU.Height();
+    for( int jChild=0; jChild<childUSize; ++jChild )
+    {
+        const int j = info.childRelInds[c][jChild];
+        for( int iChild=jChild; iChild<childUSize; ++iChild )
+        {
+            const int i = info.childRelInds[c][iChild];
+            const F value = childU(iChild,jChild);
+            if( j < info.size )
+                FL(i,j) += value;
+            else
+                FBR(i-info.size,j-info.size) += value;
+        }
+    }
+    childU.Empty();
+}
+
+template<typename F>
+inline void InitializeUpdate( const NodeInfo& info, Front<F>& front )
 {
     DEBUG_CSE
     const int updateSize = info.lowerStruct.size();
     auto& FBR = front.workDense;
     FBR.Empty();
     Zeros( FBR, updateSize, updateSize );
+    DEBUG_ONLY(
+      if( !front.sparseLeaf &&
+          (front.LDense.Height() != info.size+updateSize ||
+           front.LDense.Width() != info.size) )
+          LogicError("Front was not the proper size");
+    )
+}
 
+// Factor a front whose children have already been processed
+template<typename F>
+inline void
+Node
+( const NodeInfo& info,
+  Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl )
+{
+    DEBUG_CSE
+    InitializeUpdate( info, front );
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        ExtendAdd( info, front, c );
+    ProcessFront( front, factorType, blrCtrl );
+}
+
+template<typename F>
+inline void
+Subtree
+( const NodeInfo& info,
+  Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl )
+{
+    DEBUG_CSE
     if( front.sparseLeaf )
     {
-        front.type = factorType;
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
-        const Int numEntries = info.LOffsets.back();
-        const Int numSources = info.LOffsets.size()-1;
-
-        // TODO: Add support for pivoting here
-        if( PivotedFactorization(factorType) )
-            Zeros( front.subdiag, n-1, 1 );
-
-        Zeros( front.LSparse, numSources, numSources );
-        front.LSparse.ForceNumEntries( numEntries );
-        F* LValBuf = front.LSparse.ValueBuffer();
-        Int* LRowBuf = front.LSparse.SourceBuffer();
-        Int* LColBuf = front.LSparse.TargetBuffer();
-        Int* LOffsetBuf = front.LSparse.OffsetBuffer();
-
-        for( Int i=0; i<numSources; ++i )
+        InitializeUpdate( info, front );
+        SparseLeaf( info, front, factorType );
+        return;
+    }
+
+#ifdef EL_HYBRID
+    const Int numChildren = info.children.size();
+    if( omp_in_parallel() && numChildren > 1 )
+    {
+        // Process the (large enough) child subtrees as independent tasks
+        std::exception_ptr error;
+        for( Int c=0; c<numChildren; ++c )
+        {
+            const NodeInfo& childInfo = *info.children[c];
+            Front<F>& childFront = *front.children[c];
+            if( SubtreeFlops(childInfo) >= TASK_FLOP_CUTOFF )
+            {
+                #pragma omp task default(shared) firstprivate(c)
+                {
+                    try
+                    {
+                        Subtree
+                        ( *info.children[c], *front.children[c], factorType,
+                          blrCtrl );
+                    }
+                    catch( ... ) { CaptureException( error ); }
+                }
+            }
+            else
+            {
+                try { Subtree( childInfo, childFront, factorType, blrCtrl ); }
+                catch( ... ) { CaptureException( error ); }
+            }
+        }
+        #pragma omp taskwait
+        if( error )
+            std::rethrow_exception( error );
+        Node( info, front, factorType, blrCtrl );
+        return;
+    }
+#endif
+    // Follow the memory-minimizing schedule from the symbolic analysis: either
+    // form our update matrix first and assemble each child update as soon as
+    // it is formed, or hold the child updates until all have been formed
+    if( info.assembleEagerly )
+    {
+        InitializeUpdate( info, front );
+        for( const Int c : info.childOrder )
         {
-            const Int iStart = info.LOffsets[i];
-            const Int iEnd = info.LOffsets[i+1];
-            LOffsetBuf[i] = iStart;
-            for( Int e=iStart; e<iEnd; ++e )
-                LRowBuf[e] = i;
+            Subtree
+            ( *info.children[c], *front.children[c], factorType, blrCtrl );
+            ExtendAdd( info, front, c );
         }
-        LOffsetBuf[numSources] = info.LOffsets[numSources];
-        front.diag.Resize( numSources, 1 );
-
-        // Factor the transpose of L
-        // TODO: Reuse these workspaces
-        vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
-        vector<F> y(numSources);
-        suite_sparse::ldl::Numeric
-        ( numSources,
-          front.workSparse.LockedOffsetBuffer(),
-          front.workSparse.LockedTargetBuffer(),
-          front.workSparse.LockedValueBuffer(),
-          LOffsetBuf,
-          info.LParents.data(),
-          LNnz.data(),
-          LColBuf,
-          LValBuf,
-          front.diag.Buffer(),
-          y.data(),
-          pattern.data(),
-          flag.data(),
-          (const Int*)nullptr,
-          (const Int*)nullptr,
-          front.isHermitian );
-        front.LSparse.ForceConsistency();
-
-        // Solve against L_{TL}^T from the right
-        bool onLeft = false;
-        suite_sparse::ldl::LTSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
-
-        // Save a copy of ABL
-        auto ABLCopy = front.LDense;
-
-        // Solve against the diagonal
-        suite_sparse::ldl::DSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          front.diag.Buffer() );
-
-        // Form the Schur complement
-        Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
-        Trrk
-        ( LOWER, NORMAL, orientation,
-          F(-1), front.LDense, ABLCopy, F(0), front.workDense );
+        ProcessFront( front, factorType, blrCtrl );
     }
     else
     {
-        auto& FL = front.LDense;
-        DEBUG_ONLY(
-          if( FL.Height() != info.size+updateSize || FL.Width() != info.size )
-              LogicError("Front was not the proper size");
-        )
-
-        // Process children and add in their updates
-        const int numChildren = info.children.size();
-        for( Int c=0; c<numChildren; ++c )
-        {
-            Process( *info.children[c], *front.children[c], factorType );
+        for( const Int c : info.childOrder )
+            Subtree
+            ( *info.children[c], *front.children[c], factorType, blrCtrl );
+        Node( info, front, factorType, blrCtrl );
+    }
+}
+
+} // namespace process
 
-            auto& childU = front.children[c]->workDense;
-            const int childUSize = childU.Height();
-            for( int jChild=0; jChild<childUSize; ++jChild )
+template<typename F> 
+inline void 
+Process
+( const NodeInfo& info,
+  Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl )
+{
+    DEBUG_CSE
+#ifdef EL_HYBRID
+    const int numThreads = omp_get_max_threads();
+    if( !omp_in_parallel() && numThreads > 1 )
+    {
+        // Split the tree into (at least) numThreads subtrees, which are
+        // processed by a team of tasks, and the few large fronts above them,
+        // which are processed afterwards (in post-order) outside of the
+        // parallel region so that the dense kernels may themselves be threaded
+        vector<pair<const NodeInfo*,Front<F>*>> subtrees, upper;
+        function<void(const NodeInfo&,Front<F>&,Int)> split =
+          [&]( const NodeInfo& node, Front<F>& nodeFront, Int width )
+          {
+              const Int numChildren = node.children.size();
+              if( numChildren == 0 || width >= numThreads )
+              {
+                  subtrees.emplace_back( &node, &nodeFront );
+                  return;
+              }
+              for( Int c=0; c<numChildren; ++c )
+                  split
+                  ( *node.children[c], *nodeFront.children[c],
+                    width*numChildren );
+              upper.emplace_back( &node, &nodeFront );
+          };
+        split( info, front, 1 );
+
+        const Int numSubtrees = subtrees.size();
+        std::exception_ptr error;
+        #pragma omp parallel
+        {
+            #pragma omp single
             {
-                const int j = info.childRelInds[c][jChild];
-                for( int iChild=jChild; iChild<childUSize; ++iChild )
+                for( Int t=0; t<numSubtrees; ++t )
                 {
-                    const int i = info.childRelInds[c][iChild];
-                    const F value = childU(iChild,jChild);
-                    if( j < info.size )
-                        FL(i,j) += value;
-                    else
-                        FBR(i-info.size,j-info.size) += value;
+                    #pragma omp task firstprivate(t)
+                    {
+                        try
+                        {
+                            process::Subtree
+                            ( *subtrees[t].first, *subtrees[t].second,
+                              factorType, blrCtrl );
+                        }
+                        catch( ... ) { process::CaptureException( error ); }
+                    }
                 }
             }
-            childU.Empty();
         }
-        ProcessFront( front, factorType );
+        if( error )
+            std::rethrow_exception( error );
+        for( auto& node : upper )
+            process::Node
+            ( *node.first, *node.second, factorType, blrCtrl );
+        return;
     }
+#endif
+    process::Subtree( info, front, factorType, blrCtrl );
 }
 
 template<typename F>
 inline void
 Process
-( const DistNodeInfo& info, DistFront<F>& front, LDLFrontType factorType )
+( const DistNodeInfo& info,
+  DistFront<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl )
 {
     DEBUG_CSE
 
@@ -156,7 +350,7 @@ Process
         const Grid& grid = *info.grid;
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        Process( *info.duplicate, frontDup, factorType, blrCtrl );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
@@ -177,7 +371,32 @@ Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+
+    // Post the receives for the child updates before descending so that the
+    // team factoring the sibling subtree can deliver its update as soon as it
+    // is formed. Since the subtrees only communicate over the child teams, no
+    // other point-to-point messages use this team's communicator meanwhile.
+    if( front.commMeta.childRecvInds.empty() )
+        front.ComputeRecvInds( info );
+    mpi::Comm comm = front.L2D.DistComm();
+    const int commSize = mpi::Size( comm );
+    vector<int> recvSizes(commSize), recvOffs;
+    for( int q=0; q<commSize; ++q )
+        recvSizes[q] = front.commMeta.childRecvInds[q].size()/2;
+    const int recvBufSize = Scan( recvSizes, recvOffs );
+    vector<F> recvBuf( recvBufSize );
+    vector<mpi::Request<F>> requests;
+    requests.reserve( 2*commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( recvSizes[q] == 0 )
+            continue;
+        requests.emplace_back();
+        mpi::IRecv
+        ( &recvBuf[recvOffs[q]], recvSizes[q], q, comm, requests.back() );
+    }
+
+    Process( childInfo, childFront, factorType, blrCtrl );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
@@ -187,20 +406,18 @@ Process
           LogicError("Front was not the proper size");
     )
 
-    // Compute the metadata for sharing child updates
-    front.ComputeCommMeta( info, true );
-    mpi::Comm comm = front.L2D.DistComm();
-    const int commSize = mpi::Size( comm );
+    // Compute the number of entries of our child's update to send to each
+    // process unless they were kept from a previous factorization with the
+    // same structure
+    if( front.commMeta.numChildSendInds.empty() )
+        front.ComputeCommMeta( info, false );
     const auto& childU = childFront.work;
-    vector<int> sendSizes(commSize), recvSizes(commSize);
+    vector<int> sendSizes(commSize);
     for( int q=0; q<commSize; ++q )
-    {
         sendSizes[q] = front.commMeta.numChildSendInds[q];
-        recvSizes[q] = front.commMeta.childRecvInds[q].size()/2;
-    }
-    vector<int> sendOffs, recvOffs;
+    vector<int> sendOffs;
     const int sendBufSize = Scan( sendSizes, sendOffs );
-    const int recvBufSize = Scan( recvSizes, recvOffs );
+    DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
 
     // Pack the updates
     vector<F> sendBuf( sendBufSize );
@@ -233,17 +450,16 @@ Process
     if( childFront.duplicate != nullptr )
         childFront.duplicate->workDense.Empty();
 
-    // AllToAll to send and receive the child updates
-    vector<F> recvBuf( recvBufSize );
-    DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
-    SparseAllToAll
-    ( sendBuf, sendSizes, sendOffs,
-      recvBuf, recvSizes, recvOffs, comm );
-    SwapClear( sendBuf );
-    SwapClear( sendSizes );
-    SwapClear( sendOffs );
-
-    // Unpack the child udpates (with an Axpy)
+    // Send the child updates and form our own (zero) update matrix while
+    // they are in flight
+    for( int q=0; q<commSize; ++q )
+    {
+        if( sendSizes[q] == 0 )
+            continue;
+        requests.emplace_back();
+        mpi::ISend
+        ( &sendBuf[sendOffs[q]], sendSizes[q], q, comm, requests.back() );
+    }
     auto& FL = front.L2D;
     auto FTL = FL( IR(0,info.size), IR(0,info.size) );
     auto& FBR = front.work;
@@ -252,6 +468,13 @@ Process
     FBR.SetGrid( FTL.Grid() );
     FBR.Align( FTL.RowOwner(info.size), FTL.ColOwner(info.size) );
     Zeros( FBR, updateSize, updateSize );
+    mpi::WaitAll( requests.size(), requests.data() );
+    SwapClear( requests );
+    SwapClear( sendBuf );
+    SwapClear( sendSizes );
+    SwapClear( sendOffs );
+
+    // Unpack the child udpates (with an Axpy)
     for( int q=0; q<commSize; ++q )
     {
         const Int numRecvIndPairs = front.commMeta.childRecvInds[q].size()/2;
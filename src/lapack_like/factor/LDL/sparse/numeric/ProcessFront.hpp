@@ -69,6 +69,159 @@ void ProcessFrontVanilla( Matrix<F>& AL, Matrix<F>& ABR, bool conjugate )
     }
 }
 
+// A block low-rank (BLR) variant of ProcessFrontVanilla in the spirit of the
+// FSCU (Factor, Solve, Compress, Update) algorithm of
+//
+//   Patrick Amestoy, Cleve Ashcraft, Olivier Boiteau, Alfredo Buttari,
+//   Jean-Yves L'Excellent, and Clement Weisbecker,
+//   "Improving multifrontal methods by means of block low-rank
+//    representations",
+//   SIAM J. Sci. Comput., Vol. 37, No. 3, pp. A1451--A1474, 2015.
+//
+// The front is partitioned into tiles (with a tile boundary between the pivots
+// and the update indices) and, after each panel of L is computed, each of its
+// tiles is compressed with a truncated column-pivoted QR factorization if
+// doing so reduces its storage. The tiles of L are overwritten with their
+// low-rank approximations, so that the result is the exact factorization of a
+// nearby matrix, and the trailing updates are formed from the low-rank
+// representations. The factorization should therefore be paired with
+// iterative refinement, e.g., via ldl::SolveWithIterativeRefinement.
+template<typename F>
+void ProcessFrontBLR
+( Matrix<F>& AL,
+  Matrix<F>& ABR,
+  bool conjugate,
+  const BLRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( ABR.Height() != ABR.Width() )
+          LogicError("ABR must be square");
+      if( AL.Height() != AL.Width() + ABR.Width() )
+          LogicError("AL and ABR don't have conformal dimensions");
+      if( ctrl.tileSize <= 0 )
+          LogicError("The tile size must be positive");
+    )
+    const Int m = AL.Height();
+    const Int n = AL.Width();
+    if( m < ctrl.minFrontSize )
+    {
+        ProcessFrontVanilla( AL, ABR, conjugate );
+        return;
+    }
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    vector<Int> tileOffs;
+    for( Int i=0; i<n; i+=ctrl.tileSize )
+        tileOffs.push_back( i );
+    for( Int i=n; i<m; i+=ctrl.tileSize )
+        tileOffs.push_back( i );
+    tileOffs.push_back( m );
+    const Int numTiles = tileOffs.size()-1;
+    auto tileRange =
+      [&]( Int s, Int shift )
+      { return IR(tileOffs[s]-shift,tileOffs[s+1]-shift); };
+
+    QRCtrl<Base<F>> qrCtrl;
+    qrCtrl.colPiv = true;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = ctrl.tol;
+
+    // Compressed tiles of the current panel of L are represented as U W, where
+    // U has orthonormal columns, and each tile's contribution to the updates
+    // requires S = W D (or L D if it was not compressed)
+    vector<bool> compressed(numTiles);
+    vector<Matrix<F>> U(numTiles), W(numTiles), S(numTiles);
+    Matrix<F> d1, Z, householderScalars, C, T;
+    Matrix<Base<F>> signature;
+    Permutation Omega;
+    for( Int t=0; tileOffs[t]<n; ++t )
+    {
+        const Range<Int> ind1 = tileRange( t, 0 ),
+                         ind2( tileOffs[t+1], END );
+        auto AL11 = AL( ind1, ind1 );
+        auto AL21 = AL( ind2, ind1 );
+
+        LDL( AL11, conjugate );
+        GetDiagonal( AL11, d1 );
+        Trsm( RIGHT, LOWER, orientation, UNIT, F(1), AL11, AL21 );
+        DiagonalSolve( RIGHT, NORMAL, d1, AL21 );
+
+        for( Int s=t+1; s<numTiles; ++s )
+        {
+            auto Ls = AL( tileRange(s,0), ind1 );
+            const Int tileHeight = Ls.Height();
+            const Int tileWidth = Ls.Width();
+
+            Z = Ls;
+            QR( Z, householderScalars, signature, Omega, qrCtrl );
+            const Int rank = householderScalars.Height();
+            compressed[s] = rank*(tileHeight+tileWidth) < tileHeight*tileWidth;
+            if( compressed[s] )
+            {
+                // U := Q(:,0:rank) and W := U^H L_s, so that L_s ~= U W
+                auto ZL = Z( ALL, IR(0,rank) );
+                Identity( U[s], tileHeight, rank );
+                qr::ApplyQ
+                ( LEFT, NORMAL, ZL, householderScalars, signature, U[s] );
+                Zeros( W[s], rank, tileWidth );
+                if( rank > 0 )
+                {
+                    Gemm( ADJOINT, NORMAL, F(1), U[s], Ls, F(0), W[s] );
+                    Gemm( NORMAL, NORMAL, F(1), U[s], W[s], F(0), Ls );
+                }
+                else
+                    Zero( Ls );
+                S[s] = W[s];
+            }
+            else
+                S[s] = Ls;
+            DiagonalScale( RIGHT, NORMAL, d1, S[s] );
+        }
+
+        // Update the tiles (s,r), with s >= r, to the right of the panel
+        for( Int r=t+1; r<numTiles; ++r )
+        {
+            const bool inABR = ( tileOffs[r] >= n );
+            const Int shift = ( inABR ? n : 0 );
+            auto Lr = AL( tileRange(r,0), ind1 );
+            for( Int s=r; s<numTiles; ++s )
+            {
+                auto ATile =
+                  ( inABR ? ABR( tileRange(s,shift), tileRange(r,shift) )
+                          : AL( tileRange(s,0), tileRange(r,0) ) );
+                if( (compressed[s] && U[s].Width() == 0) ||
+                    (compressed[r] && U[r].Width() == 0) )
+                    continue;
+
+                if( compressed[r] )
+                {
+                    // C := S_s W_r^T (i.e., W_s D W_r^T or L_s D W_r^T)
+                    Gemm( NORMAL, orientation, F(1), S[s], W[r], C );
+                    if( compressed[s] )
+                    {
+                        Gemm( NORMAL, NORMAL, F(1), U[s], C, T );
+                        Gemm
+                        ( NORMAL, orientation, F(-1), T, U[r], F(1), ATile );
+                    }
+                    else
+                        Gemm
+                        ( NORMAL, orientation, F(-1), C, U[r], F(1), ATile );
+                }
+                else if( compressed[s] )
+                {
+                    Gemm( NORMAL, orientation, F(1), S[s], Lr, C );
+                    Gemm( NORMAL, NORMAL, F(-1), U[s], C, F(1), ATile );
+                }
+                else
+                    Gemm( NORMAL, orientation, F(-1), S[s], Lr, F(1), ATile );
+                if( s == r )
+                    MakeTrapezoidal( LOWER, ATile );
+            }
+        }
+    }
+}
+
 template<typename F>
 void ProcessFrontIntraPiv
 ( Matrix<F>& AL,
@@ -151,7 +304,10 @@ void ProcessFrontBlock
 }
 
 template<typename F>
-void ProcessFront( Front<F>& front, LDLFrontType factorType )
+void ProcessFront
+( Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl )
 {
     DEBUG_CSE
     front.type = factorType;
@@ -168,6 +324,15 @@ void ProcessFront( Front<F>& front, LDLFrontType factorType )
           front.isHermitian,
           pivoted );
     }
+    else if( BLRFactorization(factorType) )
+    {
+        ProcessFrontBLR
+        ( front.LDense,
+          front.workDense,
+          front.isHermitian,
+          blrCtrl );
+        GetDiagonal( front.LDense, front.diag );
+    }
     else if( pivoted )
     {
         ProcessFrontIntraPiv
@@ -354,6 +519,8 @@ void ProcessFrontBlock
     MakeSymmetric( LOWER, ATL, conjugate );
 }
 
+// NOTE: Distributed fronts are not yet compressed, and so BLR factorizations
+//       only compress the fronts within the sequential subtrees
 template<typename F>
 void ProcessFront( DistFront<F>& front, LDLFrontType factorType )
 {
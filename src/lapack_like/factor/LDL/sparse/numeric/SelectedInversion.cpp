@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Selected inversion of a sparse matrix from its multifrontal LDL^{T/H}
+// factorization, in the spirit of
+//
+//   Lin Lin, Chao Yang, Juan C. Meza, Jianfeng Lu, Lexing Ying, and Weinan E,
+//   "SelInv -- An algorithm for selected inversion of a sparse symmetric
+//    matrix",
+//   ACM Trans. Math. Softw., Vol. 37, No. 4, Article 40, 2011.
+//
+// If J denotes the indices of a front and S its lower structure, then,
+// with W = inv(A_{J,J}) = L_{J,J}^{-T} D_J^{-1} L_{J,J}^{-1} and
+// U = L_{S,J} inv(L_{J,J}), the entries of Z = inv(A) within the front are
+//
+//   Z_{S,J} = -Z_{S,S} U,
+//   Z_{J,J} = W - U^T Z_{S,J},
+//
+// where Z_{S,S} only involves entries within the front of the parent. The
+// tree is therefore traversed from the root down and each front of Z only
+// needs to be kept until its children have gathered their Z_{S,S}.
+
+namespace El {
+namespace ldl {
+
+namespace selinv {
+
+// Form W = inv(A_{J,J}) and U = L_{S,J} inv(L_{J,J}) from the factored front
+template<typename F>
+void FormFactors
+( const NodeInfo& info,
+  const Front<F>& front,
+        Matrix<F>& W,
+        Matrix<F>& U )
+{
+    DEBUG_CSE
+    const Int n = info.size;
+    if( front.sparseLeaf )
+    {
+        // Expand the unit lower-triangular L_{J,J}, whose transpose is stored
+        // in the sparse format of SuiteSparse's LDL, and place D on the
+        // diagonal so that W matches the layout of a dense front
+        Zeros( W, n, n );
+        const Int numEntries = front.LSparse.NumEntries();
+        const Int* sourceBuf = front.LSparse.LockedSourceBuffer();
+        const Int* targetBuf = front.LSparse.LockedTargetBuffer();
+        const F* valueBuf = front.LSparse.LockedValueBuffer();
+        for( Int e=0; e<numEntries; ++e )
+            W(targetBuf[e],sourceBuf[e]) = valueBuf[e];
+        for( Int j=0; j<n; ++j )
+            W(j,j) = front.diag(j);
+        U = front.LDense;
+    }
+    else if( PivotedFactorization(front.type) )
+    {
+        LogicError("Selected inversion of pivoted fronts is not supported");
+    }
+    else if( BlockFactorization(front.type) )
+    {
+        // The diagonal block has already been inverted and the bottom-left
+        // block is A_{S,J}, so that U = A_{S,J} W
+        W = front.LDense( IR(0,n), ALL );
+        auto ABL = front.LDense( IR(n,END), ALL );
+        Gemm( NORMAL, NORMAL, F(1), ABL, W, U );
+        return;
+    }
+    else
+    {
+        W = front.LDense( IR(0,n), ALL );
+        U = front.LDense( IR(n,END), ALL );
+    }
+
+    Trsm( RIGHT, LOWER, NORMAL, UNIT, F(1), W, U );
+    TriangularInverse( LOWER, UNIT, W );
+    Trdtrmm( LOWER, W, front.isHermitian );
+    MakeSymmetric( LOWER, W, front.isHermitian );
+}
+
+// On entry, the bottom-right block of Z must contain Z_{S,S}. On exit, Z
+// contains all of the entries of inv(A) within the front.
+template<typename F>
+void Recursion
+( const NodeInfo& info,
+  const Front<F>& front,
+        Matrix<F>& Z,
+  const function<void(const NodeInfo&,const Matrix<F>&)>& record )
+{
+    DEBUG_CSE
+    const Int n = info.size;
+    const Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
+
+    Matrix<F> W, U;
+    FormFactors( info, front, W, U );
+
+    auto ZTL = Z( IR(0,n), IR(0,n) );
+    auto ZTR = Z( IR(0,n), IR(n,END) );
+    auto ZBL = Z( IR(n,END), IR(0,n) );
+    auto ZBR = Z( IR(n,END), IR(n,END) );
+    Gemm( NORMAL, NORMAL, F(-1), ZBR, U, F(0), ZBL );
+    ZTL = W;
+    Gemm( orientation, NORMAL, F(-1), U, ZBL, F(1), ZTL );
+    Transpose( ZBL, ZTR, front.isHermitian );
+    W.Empty();
+    U.Empty();
+
+    record( info, Z );
+
+    const Int numChildren = info.children.size();
+    Matrix<F> ZChild;
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const NodeInfo& childInfo = *info.children[c];
+        const auto& relInds = info.childRelInds[c];
+        const Int childSize = childInfo.size;
+        const Int childUpdateSize = relInds.size();
+        Zeros( ZChild, childSize+childUpdateSize, childSize+childUpdateSize );
+        for( Int j=0; j<childUpdateSize; ++j )
+            for( Int i=0; i<childUpdateSize; ++i )
+                ZChild(childSize+i,childSize+j) = Z(relInds[i],relInds[j]);
+        Recursion( childInfo, *front.children[c], ZChild, record );
+    }
+}
+
+template<typename F>
+void Traverse
+( const NodeInfo& info,
+  const Front<F>& front,
+  const function<void(const NodeInfo&,const Matrix<F>&)>& record )
+{
+    DEBUG_CSE
+    if( Unfactored(front.type) )
+        LogicError("The fronts must be factored before selected inversion");
+    if( !info.lowerStruct.empty() )
+        LogicError("Expected the root of the elimination tree");
+    Matrix<F> Z;
+    Zeros( Z, info.size, info.size );
+    Recursion( info, front, Z, record );
+}
+
+} // namespace selinv
+
+template<typename F>
+void SelectedInversion
+( const vector<Int>& invMap,
+  const NodeInfo& info,
+  const Front<F>& front,
+        Matrix<F>& diagInv )
+{
+    DEBUG_CSE
+    const Int n = info.off + info.size;
+    Zeros( diagInv, n, 1 );
+    auto record =
+      [&]( const NodeInfo& node, const Matrix<F>& Z )
+      {
+          for( Int t=0; t<node.size; ++t )
+              diagInv(invMap[node.off+t]) = Z(t,t);
+      };
+    selinv::Traverse<F>( info, front, record );
+}
+
+template<typename F>
+void SelectedInversion
+( const SparseMatrix<F>& A,
+  const vector<Int>& invMap,
+  const NodeInfo& info,
+  const Front<F>& front,
+        SparseMatrix<F>& AInv )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    if( n != info.off+info.size )
+        LogicError("A and the elimination tree have different sizes");
+    vector<Int> map( n );
+    for( Int i=0; i<n; ++i )
+        map[invMap[i]] = i;
+
+    // NOTE: The sparsity pattern of A is assumed to be symmetric
+    AInv = A;
+    F* AInvValBuf = AInv.ValueBuffer();
+    const Int* AColBuf = A.LockedTargetBuffer();
+    const Int* AOffsetBuf = A.LockedOffsetBuffer();
+    auto record =
+      [&]( const NodeInfo& node, const Matrix<F>& Z )
+      {
+          for( Int t=0; t<node.size; ++t )
+          {
+              const Int jOrig = invMap[node.off+t];
+              const Int rowOff = AOffsetBuf[jOrig];
+              const Int numConn = AOffsetBuf[jOrig+1] - rowOff;
+              for( Int k=0; k<numConn; ++k )
+              {
+                  const Int iOrig = AColBuf[rowOff+k];
+                  const Int i = map[iOrig];
+                  if( i < node.off+t )
+                      continue;
+
+                  Int row;
+                  if( i < node.off+node.size )
+                      row = i - node.off;
+                  else
+                      row = node.origLowerRelInds[Find(node.origLowerStruct,i)];
+                  const F value = Z(row,t);
+                  AInvValBuf[rowOff+k] =
+                    ( front.isHermitian ? Conj(value) : value );
+                  AInvValBuf[AInv.Offset(iOrig,jOrig)] = value;
+              }
+          }
+      };
+    selinv::Traverse<F>( info, front, record );
+}
+
+#define PROTO(F) \
+  template void SelectedInversion \
+  ( const vector<Int>& invMap, \
+    const NodeInfo& info, \
+    const Front<F>& front, \
+          Matrix<F>& diagInv ); \
+  template void SelectedInversion \
+  ( const SparseMatrix<F>& A, \
+    const vector<Int>& invMap, \
+    const NodeInfo& info, \
+    const Front<F>& front, \
+          SparseMatrix<F>& AInv );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
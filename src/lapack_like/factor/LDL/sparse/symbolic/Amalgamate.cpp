@@ -0,0 +1,151 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <map>
+
+// Relaxed supernode amalgamation in the spirit of
+//
+//   Cleve Ashcraft and Roger Grimes,
+//   "The influence of relaxed supernode partitions on the multifrontal
+//    method",
+//   ACM Trans. Math. Softw., Vol. 15, No. 4, pp. 291--309, 1989.
+//
+// Since the nested-dissection ordering numbers each subtree contiguously
+// and immediately before its parent, only the last child of a node is
+// adjacent to it in the ordering, and it can be merged into the parent by
+// prepending its indices. The lower structure of the merged supernode is
+// simply that of the parent, so the number of explicit zeros introduced by
+// each merge can be computed from the (already analyzed) structure sizes.
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// The number of entries in the lower trapezoid of a front with 'size'
+// pivots and 'lowerSize' update indices
+inline double FrontEntries( Int size, Int lowerSize )
+{ return 0.5*double(size)*double(size+1) + double(size)*double(lowerSize); }
+
+// Records the number of explicit zeros within the front of each node
+void AmalgamateRecursion
+( Separator& sep,
+  NodeInfo& node,
+  std::map<const NodeInfo*,double>& zerosMap,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    const Int numChildren = node.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        AmalgamateRecursion
+        ( *sep.children[c], *node.children[c], zerosMap, ctrl );
+
+    double zeros = 0;
+    const Int lowerSize = node.lowerStruct.size();
+    while( !node.children.empty() )
+    {
+        NodeInfo* child = node.children.back();
+        Separator* childSep = sep.children.back();
+        DEBUG_ONLY(
+          if( child->off+child->size != node.off )
+              LogicError("Last child was not adjacent to its parent");
+        )
+
+        // Sparse leaves are handled separately, so do not allow the merged
+        // node to be left without any children
+        const Int numNewChildren =
+          node.children.size()-1 + child->children.size();
+        if( numNewChildren == 0 )
+            break;
+
+        const Int mergedSize = child->size + node.size;
+        const double mergedEntries = FrontEntries( mergedSize, lowerSize );
+        const double mergedZeros =
+          zeros + zerosMap[child] + mergedEntries -
+          FrontEntries( child->size, child->lowerStruct.size() ) -
+          FrontEntries( node.size, lowerSize );
+        if( mergedSize > ctrl.amalgamateSize &&
+            mergedZeros > ctrl.amalgamateFillTol*mergedEntries )
+            break;
+
+        // The child's original connections to our indices are now within
+        // the diagonal block of the merged front
+        vector<Int> childOrigStruct;
+        for( const Int i : child->origLowerStruct )
+            if( i >= node.off+node.size )
+                childOrigStruct.push_back( i );
+        node.origLowerStruct = Union( childOrigStruct, node.origLowerStruct );
+
+        // Prepend the child's indices
+        node.off = child->off;
+        node.size = mergedSize;
+        sep.off = childSep->off;
+        sep.inds.insert
+        ( sep.inds.begin(), childSep->inds.begin(), childSep->inds.end() );
+        zeros = mergedZeros;
+
+        // Adopt the grandchildren (in order) and delete the child
+        node.children.pop_back();
+        sep.children.pop_back();
+        zerosMap.erase( child );
+        const Int numGrandchildren = child->children.size();
+        for( Int c=0; c<numGrandchildren; ++c )
+        {
+            child->children[c]->parent = &node;
+            childSep->children[c]->parent = &sep;
+            node.children.push_back( child->children[c] );
+            sep.children.push_back( childSep->children[c] );
+        }
+        SwapClear( child->children );
+        SwapClear( childSep->children );
+        delete child;
+        delete childSep;
+    }
+    zerosMap[&node] = zeros;
+}
+
+} // anonymous namespace
+
+void Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    // The sizes of the lower structures determine the fill from each merge
+    Analysis( rootInfo );
+    std::map<const NodeInfo*,double> zerosMap;
+    AmalgamateRecursion( rootSep, rootInfo, zerosMap, ctrl );
+}
+
+void Amalgamate
+( DistSeparator& rootSep, DistNodeInfo& rootInfo, const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    // Only the sequential subtree at the bottom of the distributed tree is
+    // amalgamated, as the distributed levels are kept binary
+    DistSeparator* sep = &rootSep;
+    DistNodeInfo* node = &rootInfo;
+    while( node->duplicate == nullptr )
+    {
+        sep = sep->child;
+        node = node->child;
+    }
+    Amalgamate( *sep->duplicate, *node->duplicate, ctrl );
+
+    // Pull information up from the duplicates
+    sep->off = sep->duplicate->off;
+    sep->inds = sep->duplicate->inds;
+    node->size = node->duplicate->size;
+    node->off = node->duplicate->off;
+    node->origLowerStruct = node->duplicate->origLowerStruct;
+}
+
+} // namespace ldl
+} // namespace El
@@ -201,6 +201,72 @@ inline void ComputeStructAndRelInds
     )
 }
 
+// Choose the order in which the children of a node are processed, and when
+// its update matrix is allocated, so as to minimize the peak number of
+// update-matrix entries held at once (each child's schedule is assumed to
+// have already been computed). If the update matrix U of the node is
+// allocated first, each child update can be assembled as soon as it is
+// formed, and the peak is
+//
+//   |U| + max_c peak(c),
+//
+// independent of the ordering. Otherwise, all of the child updates are held
+// until U is formed, and the peak is minimized by the ordering of
+//
+//   Joseph W. H. Liu,
+//   "On the storage requirement in the out-of-core multifrontal method for
+//    sparse factorization",
+//   ACM Trans. Math. Softw., Vol. 12, No. 3, pp. 249--264, 1986,
+//
+// which processes the children in decreasing order of peak(c) - |U_c|.
+inline void ScheduleChildren( NodeInfo& node )
+{
+    DEBUG_CSE
+    const Int numChildren = node.children.size();
+    const double updateSize = node.lowerStruct.size();
+    const double updateEntries = updateSize*updateSize;
+
+    node.childOrder.resize( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+        node.childOrder[c] = c;
+    if( numChildren == 0 )
+    {
+        node.assembleEagerly = true;
+        node.peakUpdateEntries = updateEntries;
+        return;
+    }
+
+    auto childUpdateEntries = [&]( Int c )
+      {
+        const double childUpdateSize = node.children[c]->lowerStruct.size();
+        return childUpdateSize*childUpdateSize;
+      };
+
+    double eagerPeak = 0;
+    for( Int c=0; c<numChildren; ++c )
+        eagerPeak = Max( eagerPeak, node.children[c]->peakUpdateEntries );
+    eagerPeak += updateEntries;
+
+    std::sort
+    ( node.childOrder.begin(), node.childOrder.end(),
+      [&]( Int a, Int b )
+      {
+        return node.children[a]->peakUpdateEntries - childUpdateEntries(a) >
+               node.children[b]->peakUpdateEntries - childUpdateEntries(b);
+      } );
+    double lazyPeak = 0, stackEntries = 0;
+    for( const Int c : node.childOrder )
+    {
+        lazyPeak =
+          Max( lazyPeak, stackEntries+node.children[c]->peakUpdateEntries );
+        stackEntries += childUpdateEntries(c);
+    }
+    lazyPeak = Max( lazyPeak, stackEntries+updateEntries );
+
+    node.assembleEagerly = ( eagerPeak <= lazyPeak );
+    node.peakUpdateEntries = Min( eagerPeak, lazyPeak );
+}
+
 Int Analysis( NodeInfo& node, Int myOff )
 {
     DEBUG_CSE
@@ -278,6 +344,7 @@ Int Analysis( NodeInfo& node, Int myOff )
         for( Int i=0; i<numOrigLowerInds; ++i )
             node.origLowerRelInds[i] = i + node.size;
     }
+    ScheduleChildren( node );
 
     return myOff + node.size;
 }
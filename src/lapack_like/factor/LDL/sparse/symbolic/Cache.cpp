@@ -0,0 +1,344 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The output of NestedDissection (after any amalgamation) is determined by the
+// separator tree and the 'known before analysis' portion of the elimination
+// tree, so only these are stored; the map and the rest of the elimination tree
+// are rebuilt upon loading with BuildMap and Analysis. The team communicators
+// of the distributed trees are rebuilt with the same splits as those of
+// BuildChildFromPerm.
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+const char CACHE_MAGIC[4] = { 'E', 'L', 'N', 'D' };
+
+template<typename T>
+void WriteValue( ofstream& file, const T& value )
+{ file.write( (const char*)&value, sizeof(T) ); }
+
+void WriteVector( ofstream& file, const vector<Int>& vec )
+{
+    const Int size = vec.size();
+    WriteValue( file, size );
+    file.write( (const char*)vec.data(), size*sizeof(Int) );
+}
+
+template<typename T>
+void ReadValue( ifstream& file, T& value )
+{
+    file.read( (char*)&value, sizeof(T) );
+    if( !file )
+        RuntimeError("Unexpected end of nested dissection cache");
+}
+
+void ReadVector( ifstream& file, vector<Int>& vec )
+{
+    Int size;
+    ReadValue( file, size );
+    vec.resize( size );
+    file.read( (char*)vec.data(), size*sizeof(Int) );
+    if( !file )
+        RuntimeError("Unexpected end of nested dissection cache");
+}
+
+void WriteHeader( ofstream& file, int commSize, int commRank )
+{
+    file.write( CACHE_MAGIC, 4 );
+    WriteValue( file, int(sizeof(Int)) );
+    WriteValue( file, commSize );
+    WriteValue( file, commRank );
+}
+
+void ReadHeader
+( ifstream& file, const string& filename, int commSize, int commRank )
+{
+    char magic[4];
+    file.read( magic, 4 );
+    if( !file || !std::equal( magic, magic+4, CACHE_MAGIC ) )
+        RuntimeError(filename," is not a nested dissection cache");
+    int intSize, fileCommSize, fileCommRank;
+    ReadValue( file, intSize );
+    ReadValue( file, fileCommSize );
+    ReadValue( file, fileCommRank );
+    if( intSize != int(sizeof(Int)) )
+        RuntimeError
+        (filename," was written with ",8*intSize,"-bit integers rather than ",
+         8*sizeof(Int));
+    if( fileCommSize != commSize || fileCommRank != commRank )
+        RuntimeError
+        (filename," was written by process ",fileCommRank," of ",fileCommSize,
+         " rather than ",commRank," of ",commSize);
+}
+
+void WriteTree( ofstream& file, const Separator& sep, const NodeInfo& node )
+{
+    DEBUG_CSE
+    WriteValue( file, sep.off );
+    WriteVector( file, sep.inds );
+    WriteValue( file, node.size );
+    WriteValue( file, node.off );
+    WriteVector( file, node.origLowerStruct );
+    WriteVector( file, node.LOffsets );
+    WriteVector( file, node.LParents );
+
+    const Int numChildren = node.children.size();
+    DEBUG_ONLY(
+      if( Int(sep.children.size()) != numChildren )
+          LogicError("Separator and elimination trees did not match");
+    )
+    WriteValue( file, numChildren );
+    for( Int c=0; c<numChildren; ++c )
+        WriteTree( file, *sep.children[c], *node.children[c] );
+}
+
+void ReadTree( ifstream& file, Separator& sep, NodeInfo& node )
+{
+    DEBUG_CSE
+    ReadValue( file, sep.off );
+    ReadVector( file, sep.inds );
+    ReadValue( file, node.size );
+    ReadValue( file, node.off );
+    ReadVector( file, node.origLowerStruct );
+    ReadVector( file, node.LOffsets );
+    ReadVector( file, node.LParents );
+
+    Int numChildren;
+    ReadValue( file, numChildren );
+    sep.children.resize( numChildren );
+    node.children.resize( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        sep.children[c] = new Separator(&sep);
+        node.children[c] = new NodeInfo(&node);
+        ReadTree( file, *sep.children[c], *node.children[c] );
+    }
+}
+
+string CacheFilename( const string& basename, mpi::Comm comm )
+{ return BuildString(basename,".",mpi::Rank(comm),".nd"); }
+
+} // anonymous namespace
+
+void SaveNestedDissection
+( const string& filename,
+  const Separator& rootSep,
+  const NodeInfo& rootInfo )
+{
+    DEBUG_CSE
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    WriteHeader( file, 1, 0 );
+    WriteTree( file, rootSep, rootInfo );
+}
+
+void LoadNestedDissection
+( const string& filename,
+        vector<Int>& map,
+        Separator& rootSep,
+        NodeInfo& rootInfo )
+{
+    DEBUG_CSE
+    // NOTE: There is a potential memory leak here if sep or info is reused
+    ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    ReadHeader( file, filename, 1, 0 );
+    ReadTree( file, rootSep, rootInfo );
+
+    BuildMap( rootSep, map );
+    DEBUG_ONLY(EnsurePermutation(map))
+    Analysis( rootInfo );
+}
+
+void SaveNestedDissection
+( const string& basename,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo )
+{
+    DEBUG_CSE
+    const string filename = CacheFilename( basename, rootInfo.comm );
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    WriteHeader( file, mpi::Size(rootInfo.comm), mpi::Rank(rootInfo.comm) );
+
+    const DistSeparator* sep = &rootSep;
+    const DistNodeInfo* node = &rootInfo;
+    while( true )
+    {
+        WriteValue( file, sep->off );
+        WriteVector( file, sep->inds );
+        WriteValue( file, node->size );
+        WriteValue( file, node->off );
+        WriteVector( file, node->origLowerStruct );
+
+        const bool haveChild = ( node->child != nullptr );
+        WriteValue( file, haveChild );
+        if( !haveChild )
+            break;
+        WriteValue( file, node->child->onLeft );
+        WriteValue( file, mpi::Rank(node->child->comm) );
+        sep = sep->child;
+        node = node->child;
+    }
+    WriteTree( file, *sep->duplicate, *node->duplicate );
+}
+
+void LoadNestedDissection
+( const string& basename,
+        mpi::Comm comm,
+        DistMap& map,
+        DistSeparator& rootSep,
+        DistNodeInfo& rootInfo,
+        bool storeFactRecvInds )
+{
+    DEBUG_CSE
+    // NOTE: There is a potential memory leak here if sep or info is reused
+    const string filename = CacheFilename( basename, comm );
+    ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    ReadHeader( file, filename, mpi::Size(comm), mpi::Rank(comm) );
+
+    DistSeparator* sep = &rootSep;
+    DistNodeInfo* node = &rootInfo;
+    mpi::Dup( comm, sep->comm );
+    mpi::Dup( comm, node->comm );
+    while( true )
+    {
+        ReadValue( file, sep->off );
+        ReadVector( file, sep->inds );
+        ReadValue( file, node->size );
+        ReadValue( file, node->off );
+        ReadVector( file, node->origLowerStruct );
+
+        bool haveChild;
+        ReadValue( file, haveChild );
+        if( !haveChild )
+            break;
+        if( mpi::Size(node->comm) == 1 )
+            RuntimeError(filename," split a single-process team");
+        bool childOnLeft;
+        int childTeamRank;
+        ReadValue( file, childOnLeft );
+        ReadValue( file, childTeamRank );
+
+        mpi::Comm childComm;
+        mpi::Split( node->comm, childOnLeft, childTeamRank, childComm );
+        sep->child = new DistSeparator(sep);
+        node->child = new DistNodeInfo(node);
+        node->child->onLeft = childOnLeft;
+        mpi::Dup( childComm, sep->child->comm );
+        mpi::Dup( childComm, node->child->comm );
+        mpi::Free( childComm );
+        sep = sep->child;
+        node = node->child;
+    }
+    if( mpi::Size(node->comm) != 1 )
+        RuntimeError(filename," did not split down to single-process teams");
+
+    sep->duplicate = new Separator(sep);
+    node->duplicate = new NodeInfo(node);
+    ReadTree( file, *sep->duplicate, *node->duplicate );
+
+    BuildMap( rootSep, map );
+    DEBUG_ONLY(EnsurePermutation(map))
+    Analysis( rootInfo, storeFactRecvInds );
+}
+
+namespace {
+
+// Predictions for a single dense supernode with s pivots and an update
+// matrix of order u
+void AccumulateDense( double s, double u, SymbolicSummary& summary )
+{
+    ++summary.numNodes;
+    summary.numNonzeros += s*(s+1)/2 + u*s;
+    summary.factorFlops += s*s*s/3 + u*s*s + u*u*s;
+    summary.maxFrontEntries = Max( summary.maxFrontEntries, (s+u)*s + u*u );
+}
+
+// Leaves which are factored with the sparse LDL from SuiteSparse use its
+// symbolic column counts for their top-left block rather than treating it as
+// dense
+void Accumulate( const NodeInfo& node, SymbolicSummary& summary )
+{
+    const double s = node.size;
+    const double u = node.lowerStruct.size();
+    const bool sparseLeaf =
+      node.children.empty() && Int(node.LOffsets.size()) == node.size+1;
+    if( !sparseLeaf )
+    {
+        AccumulateDense( s, u, summary );
+        return;
+    }
+
+    double topLeftNonzeros = s, topLeftFlops = 0;
+    for( Int j=0; j<node.size; ++j )
+    {
+        const double colCount = node.LOffsets[j+1] - node.LOffsets[j];
+        topLeftNonzeros += colCount;
+        topLeftFlops += colCount*colCount;
+    }
+    ++summary.numNodes;
+    summary.numNonzeros += topLeftNonzeros + u*s;
+    summary.factorFlops += topLeftFlops + 2*u*topLeftNonzeros + u*u*s;
+    summary.maxFrontEntries = Max( summary.maxFrontEntries, (s+u)*s + u*u );
+}
+
+} // anonymous namespace
+
+SymbolicSummary Summarize( const NodeInfo& rootInfo )
+{
+    DEBUG_CSE
+    SymbolicSummary summary;
+    function<void(const NodeInfo&)> accumulate =
+      [&]( const NodeInfo& node )
+      {
+          for( const NodeInfo* child : node.children )
+              accumulate( *child );
+          Accumulate( node, summary );
+      };
+    accumulate( rootInfo );
+    summary.peakUpdateEntries = rootInfo.peakUpdateEntries;
+    return summary;
+}
+
+SymbolicSummary Summarize( const DistNodeInfo& rootInfo )
+{
+    DEBUG_CSE
+    // Each process summarizes its sequential subtree (whose root duplicates
+    // the single-process node at the bottom of the distributed tree), and
+    // each distributed node above it is counted by the root of its team
+    const DistNodeInfo* node = &rootInfo;
+    while( node->child != nullptr )
+        node = node->child;
+    SymbolicSummary summary = Summarize( *node->duplicate );
+    for( node=node->parent; node!=nullptr; node=node->parent )
+        if( mpi::Rank(node->comm) == 0 )
+            AccumulateDense( node->size, node->lowerStruct.size(), summary );
+
+    mpi::Comm comm = rootInfo.comm;
+    summary.numNodes = mpi::AllReduce( summary.numNodes, comm );
+    summary.numNonzeros = mpi::AllReduce( summary.numNonzeros, comm );
+    summary.factorFlops = mpi::AllReduce( summary.factorFlops, comm );
+    summary.maxFrontEntries =
+      mpi::AllReduce( summary.maxFrontEntries, mpi::MAX, comm );
+    summary.peakUpdateEntries =
+      mpi::AllReduce( summary.peakUpdateEntries, mpi::MAX, comm );
+    return summary;
+}
+
+} // namespace ldl
+} // namespace El
@@ -402,6 +402,10 @@ void NestedDissection
     BuildMap( sep, map );
     DEBUG_ONLY(EnsurePermutation(map))
 
+    // Optionally merge small supernodes before the symbolic analysis
+    if( ctrl.amalgamate )
+        Amalgamate( sep, node, ctrl );
+
     // Run the symbolic analysis
     Analysis( node );
 }
@@ -428,6 +432,10 @@ void NestedDissection
     BuildMap( sep, map );
     DEBUG_ONLY(EnsurePermutation(map))
 
+    // Optionally merge small supernodes before the symbolic analysis
+    if( ctrl.amalgamate )
+        Amalgamate( sep, node, ctrl );
+
     // Run the symbolic analysis
     Analysis( node, ctrl.storeFactRecvInds );
 }
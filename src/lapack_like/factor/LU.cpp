@@ -10,8 +10,10 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
+#include "./LU/Tiled.hpp"
 #include "./LU/SolveAfter.hpp"
 
 namespace El {
@@ -22,6 +24,7 @@ template<typename F>
 void LU( Matrix<F>& A )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LU");
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
@@ -36,7 +39,7 @@ void LU( Matrix<F>& A )
         auto A21 = A( ind2, ind1 );
         auto A22 = A( ind2, ind2 );
 
-        lu::Unb( A11 );
+        lu::Recursive( A11 );
         Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11, A21 );
         Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
         Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
@@ -47,6 +50,7 @@ template<typename F>
 void LU( ElementalMatrix<F>& APre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LU");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -60,7 +64,7 @@ void LU( ElementalMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize( TUNE_LU, minDim, g.Height(), g.Width() );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -105,6 +109,7 @@ template<typename F>
 void LU( Matrix<F>& A, Permutation& P )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LU");
 
     const Int m = A.Height();
     const Int n = A.Width();
@@ -132,7 +137,7 @@ void LU( Matrix<F>& A, Permutation& P )
         auto AB1 = A( indB, ind1 );
         auto AB2 = A( indB, ind2 );
 
-        lu::Panel( AB1, P, PB, k );
+        lu::RecursivePanel( AB1, P, PB, k );
         PB.PermuteRows( AB0 );
         PB.PermuteRows( AB2 );
 
@@ -152,9 +157,13 @@ void LU
 }
 
 template<typename F> 
-void LU( ElementalMatrix<F>& APre, DistPermutation& P )
+void LU
+( ElementalMatrix<F>& APre, DistPermutation& P, const LUCtrl& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LU");
+    if( ctrl.pivot != LU_PARTIAL && ctrl.pivot != LU_TOURNAMENT )
+        LogicError("LUCtrl only supports partial and tournament pivoting");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -165,6 +174,11 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
     DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
     DistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
 
+    // The next panel, [A11; A21], gathered during the trailing update
+    DistMatrix<F,  MC,  STAR> ANext_MC_STAR(g);
+    CopyRequest<F> nextRequest;
+    bool gatheredNext = false;
+
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
@@ -176,7 +190,7 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize( TUNE_LU, minDim, g.Height(), g.Width() );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -197,9 +211,21 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
         ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
         A21_MC_STAR.Attach
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
-        A11_STAR_STAR = A11;
-        A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        if( gatheredNext )
+        {
+            nextRequest.Wait();
+            A11_STAR_STAR = ANext_MC_STAR( IR(0,nb), ALL );
+            A21_MC_STAR = ANext_MC_STAR( IR(nb,END), ALL );
+        }
+        else
+        {
+            A11_STAR_STAR = A11;
+            A21_MC_STAR = A21;
+        }
+        if( ctrl.pivot == LU_TOURNAMENT )
+            lu::TournamentPanel( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
 
         PB.PermuteRows( AB );
 
@@ -212,7 +238,27 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
 
         A12_STAR_MR.AlignWith( A22 );
         A12_STAR_MR = A12_STAR_VR;
-        LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+
+        const Int nbNext = Min(bsize,minDim-(k+nb));
+        gatheredNext = ( ctrl.lookAhead > 0 && nbNext > 0 );
+        if( gatheredNext )
+        {
+            // Update the next panel first so that its gather can proceed
+            // during the remainder of the trailing update
+            const IR indL( 0, nbNext ), indR( nbNext, END );
+            auto A22L = A22( ALL, indL );
+            auto A22R = A22( ALL, indR );
+            LocalGemm
+            ( NORMAL, NORMAL,
+              F(-1), A21_MC_STAR, A12_STAR_MR( ALL, indL ), F(1), A22L );
+            nextRequest = ICopy( A22L, ANext_MC_STAR );
+            LocalGemm
+            ( NORMAL, NORMAL,
+              F(-1), A21_MC_STAR, A12_STAR_MR( ALL, indR ), F(1), A22R );
+        }
+        else
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
 
         A11 = A11_STAR_STAR;
         A12 = A12_STAR_MR;
@@ -220,6 +266,80 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
     }
 }
 
+template<typename F>
+void LU( DistMatrixBatch<F>& A, DistMatrixBatch<Int>& p, const LUCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( !A.SharesLayout(p) )
+        LogicError("The pivot batch must share the layout of A");
+    for( const Int k : A.LocalIndices() )
+    {
+        DistPermutation P( A(k).Grid() );
+        LU( A(k), P, ctrl );
+        P.ExplicitVector( p(k) );
+    }
+}
+
+namespace lu {
+
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+void BlockHelper( DistMatrix<F,MC,MR,BLOCK>& A, DistPermutation& P )
+{
+#ifdef EL_HAVE_SCALAPACK
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int mLocal = A.LocalHeight();
+    vector<int> ipiv( mLocal+A.BlockHeight() );
+
+    const int bHandle = blacs::Handle( A );
+    const int context = blacs::GridInit( bHandle, A );
+    auto descA = FillDesc( A, context );
+    scalapack::LU( m, n, A.Buffer(), descA.data(), ipiv.data() );
+    blacs::FreeGrid( context );
+    blacs::FreeHandle( bHandle );
+
+    // The (one-based) pivots are distributed like the rows of A and are
+    // redundant over each process row
+    vector<Int> pivots( minDim, 0 );
+    for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( i < minDim )
+            pivots[i] = ipiv[iLoc]-1;
+    }
+    mpi::AllReduce( pivots.data(), minDim, A.ColComm() );
+
+    P.SetGrid( A.Grid() );
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+    for( Int i=0; i<minDim; ++i )
+        P.Swap( i, pivots[i] );
+#else
+    DistMatrix<F> AElem( A );
+    LU( AElem, P );
+    A = AElem;
+#endif
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+void BlockHelper( DistMatrix<F,MC,MR,BLOCK>& A, DistPermutation& P )
+{
+    DistMatrix<F> AElem( A );
+    LU( AElem, P );
+    A = AElem;
+}
+
+} // namespace lu
+
+template<typename F>
+void LU( DistMatrix<F,MC,MR,BLOCK>& A, DistPermutation& P )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("LU");
+    lu::BlockHelper( A, P );
+}
+
 template<typename F> 
 void LU
 ( ElementalMatrix<F>& A, 
@@ -232,6 +352,9 @@ void LU
 
 #define PROTO(F) \
   template void LU( Matrix<F>& A ); \
+  template void lu::Tiled \
+  ( Matrix<F>& A, Permutation& P, const TileCtrl& ctrl ); \
+  template void LU( DistMatrix<F,MC,MR,BLOCK>& A, DistPermutation& P ); \
   template void LU( ElementalMatrix<F>& A ); \
   template void LU( DistMatrix<F,STAR,STAR>& A ); \
   template void LU \
@@ -239,7 +362,12 @@ void LU
     Permutation& P ); \
   template void LU \
   ( ElementalMatrix<F>& A, \
-    DistPermutation& P ); \
+    DistPermutation& P, \
+    const LUCtrl& ctrl ); \
+  template void LU \
+  ( DistMatrixBatch<F>& A, \
+    DistMatrixBatch<Int>& p, \
+    const LUCtrl& ctrl ); \
   template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
@@ -274,6 +402,12 @@ void LU
     DistPermutation& PB, \
     Int offset, \
     vector<F>& pivotBuf ); \
+  template void lu::TournamentPanel \
+  ( DistMatrix<F,  STAR,STAR>& A11, \
+    DistMatrix<F,  MC,  STAR>& A21, \
+    DistPermutation& P, \
+    DistPermutation& PB, \
+    Int offset ); \
   template void lu::SolveAfter \
   ( Orientation orientation, \
     const Matrix<F>& A, \
@@ -60,6 +60,38 @@ Unb( Matrix<F>& A )
     }
 }
 
+// The recursive variants split the columns in half, so that all but
+// O(cutoff) of the flops take place within Trsm and Gemm, independent of the
+// algorithmic blocksize
+const Int RECURSIVE_LU_CUTOFF = 16;
+
+template<typename F>
+void Recursive( Matrix<F>& A )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim <= RECURSIVE_LU_CUTOFF )
+    {
+        Unb( A );
+        return;
+    }
+    const Int n1 = minDim/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, END );
+
+    auto AL  = A( ALL,  ind1 );
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    Recursive( AL );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
+    Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
+    Recursive( A22 );
+}
+
 } // namespace lu
 } // namespace El
 
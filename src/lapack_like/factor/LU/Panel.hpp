@@ -59,6 +59,92 @@ void Panel( Matrix<F>& A, Permutation& P, Permutation& PB, Int offset )
     }
 }
 
+// Recursively factor the column panel A using partial pivoting, storing the
+// (relative) pivot row of column k in pivots[k]. Each sequence of row swaps is
+// applied to all of A.
+template<typename F>
+void RecursivePanelHelper( Matrix<F>& A, Int* pivots )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    if( n <= RECURSIVE_LU_CUTOFF )
+    {
+        for( Int k=0; k<n; ++k )
+        {
+            const Int iPiv = k + blas::MaxInd( m-k, &ABuf[k+k*ALDim], 1 );
+            pivots[k] = iPiv;
+            if( iPiv != k )
+                blas::Swap( n, &ABuf[k], ALDim, &ABuf[iPiv], ALDim );
+
+            const F alpha = ABuf[k+k*ALDim];
+            if( alpha == F(0) )
+                throw SingularMatrixException();
+            blas::Scal( m-(k+1), F(1)/alpha, &ABuf[(k+1)+k*ALDim], 1 );
+            blas::Geru
+            ( m-(k+1), n-(k+1),
+              F(-1), &ABuf[(k+1)+k*ALDim], 1, &ABuf[k+(k+1)*ALDim], ALDim,
+                     &ABuf[(k+1)+(k+1)*ALDim], ALDim );
+        }
+        return;
+    }
+    const Int n1 = n/2;
+    const Int n2 = n - n1;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, END ), indR( n1, n );
+
+    auto AL  = A( ALL,  ind1 );
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, indR );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, indR );
+
+    // Factor the left half and apply its pivots to the right half
+    RecursivePanelHelper( AL, pivots );
+    for( Int k=0; k<n1; ++k )
+        if( pivots[k] != k )
+            blas::Swap
+            ( n2, &ABuf[k+n1*ALDim], ALDim, &ABuf[pivots[k]+n1*ALDim], ALDim );
+
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
+    Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
+
+    // Factor the bottom-right and apply its pivots to the left half
+    RecursivePanelHelper( A22, &pivots[n1] );
+    for( Int k=n1; k<n; ++k )
+    {
+        pivots[k] += n1;
+        if( pivots[k] != k )
+            blas::Swap( n1, &ABuf[k], ALDim, &ABuf[pivots[k]], ALDim );
+    }
+}
+
+// A drop-in replacement for the above sequential Panel which performs nearly
+// all of its work in level-3 operations
+template<typename F>
+void RecursivePanel
+( Matrix<F>& A, Permutation& P, Permutation& PB, Int offset )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    DEBUG_ONLY(
+      if( m < n )
+          LogicError("Must be a column panel");
+    )
+    vector<Int> pivots(n);
+    RecursivePanelHelper( A, pivots.data() );
+
+    PB.MakeIdentity( m );
+    PB.ReserveSwaps( n );
+    for( Int k=0; k<n; ++k )
+    {
+        P.Swap( k+offset, pivots[k]+offset );
+        PB.Swap( k, pivots[k] );
+    }
+}
+
 // NOTE: It is assumed that the local buffers of A[*,*] and B[MC,*] can be
 //       verticially stacked, so that the top-left local entry of B is 
 //       the n'th local entry of A[*,*]'s local buffer.
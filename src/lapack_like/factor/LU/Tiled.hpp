@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TILED_HPP
+#define EL_LU_TILED_HPP
+
+namespace El {
+namespace lu {
+
+// Since partial pivoting couples all of the rows of each panel, the tasks act
+// upon tile columns: the factorization of a panel, and, for each other tile
+// column, the application of the panel's row swaps followed (for the tile
+// columns to its right) by a triangular solve and a Gemm update. The next
+// panel can then be factored as soon as its own tile column has been updated
+// (an arbitrarily deep lookahead) rather than after the entire trailing
+// matrix has been updated.
+template<typename F>
+void Tiled( Matrix<F>& A, Permutation& P, const TileCtrl& ctrl )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("LU");
+    if( ctrl.tileSize <= 0 )
+        LogicError("The tile size must be positive");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int nb = ctrl.tileSize;
+    const Int numTileCols = (n+nb-1) / nb;
+    const Int numPanels = (minDim+nb-1) / nb;
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+    vector<Permutation> panelPerms( numPanels );
+
+    // Apply the row swaps of panel k to tile column j and, if j > k, the
+    // updates from the panel's triangular factors
+    auto update = [&]( Int k, Int j )
+    {
+        const Int k0 = k*nb;
+        const Int k1 = Min(k0+nb,minDim);
+        const IR ind1( k0, k1 ), ind2( k1, m ), indB( k0, m ),
+                 indJ( j*nb, Min((j+1)*nb,n) );
+        auto ABJ = A( indB, indJ );
+        panelPerms[k].PermuteRows( ABJ );
+        if( j > k )
+        {
+            auto A11 = A( ind1, ind1 );
+            auto A21 = A( ind2, ind1 );
+            auto A1J = A( ind1, indJ );
+            auto A2J = A( ind2, indJ );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A1J );
+            Gemm( NORMAL, NORMAL, F(-1), A21, A1J, F(1), A2J );
+        }
+    };
+
+    // The remainder of the last panel's tile column (if any) is updated
+    // within the panel task
+    auto factorPanel = [&]( Int k )
+    {
+        const Int k0 = k*nb;
+        const Int k1 = Min(k0+nb,minDim);
+        const Int kEnd = Min(k0+nb,n);
+        const IR ind1( k0, k1 ), ind2( k1, m ), indB( k0, m ),
+                 indR( k1, kEnd );
+        auto AB1 = A( indB, ind1 );
+        RecursivePanel( AB1, P, panelPerms[k], k0 );
+        if( kEnd > k1 )
+        {
+            auto ABR = A( indB, indR );
+            panelPerms[k].PermuteRows( ABR );
+            auto A11 = A( ind1, ind1 );
+            auto A21 = A( ind2, ind1 );
+            auto A1R = A( ind1, indR );
+            auto A2R = A( ind2, indR );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A1R );
+            Gemm( NORMAL, NORMAL, F(-1), A21, A1R, F(1), A2R );
+        }
+    };
+
+    // Each tile column is a handle, and the panel tasks, which also extend
+    // the global permutation, are prioritized above the updates of the tile
+    // columns which will be factored soonest
+    TaskGraph graph;
+    for( Int k=0; k<numPanels; ++k )
+    {
+        graph.Insert
+        ( [=]() { factorPanel(k); }, {}, {k}, 2*numTileCols );
+        for( Int j=0; j<numTileCols; ++j )
+            if( j != k )
+                graph.Insert
+                ( [=]() { update(k,j); },
+                  {k}, {j}, ( j > k ? numTileCols-j : 0 ) );
+    }
+    graph.Execute( ctrl.numThreads );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TILED_HPP
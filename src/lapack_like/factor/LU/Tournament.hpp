@@ -0,0 +1,226 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+// Overwrite the candidate rows C (and their panel indices) with the (at most)
+// n rows that partial pivoting selects from them. Unlike lu::Panel, exactly
+// zero columns are skipped rather than treated as singular, since a subset
+// of the panel may be (locally) rank-deficient.
+template<typename F>
+void TournamentRound( Matrix<F>& C, vector<Int>& indices )
+{
+    DEBUG_CSE
+    const Int numCand = C.Height();
+    const Int n = C.Width();
+    const Int numWinners = Min(numCand,n);
+
+    Matrix<F> CFact( C );
+    vector<Int> order( numCand );
+    for( Int i=0; i<numCand; ++i )
+        order[i] = i;
+    F* CBuf = CFact.Buffer();
+    const Int CLDim = CFact.LDim();
+    for( Int k=0; k<numWinners; ++k )
+    {
+        const Int iPiv =
+          k + blas::MaxInd( numCand-k, &CBuf[k+k*CLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &CBuf[k], CLDim, &CBuf[iPiv], CLDim );
+            std::swap( order[k], order[iPiv] );
+        }
+        const F alpha = CBuf[k+k*CLDim];
+        if( alpha == F(0) )
+            continue;
+        const Int ind2Vert = numCand-(k+1);
+        const Int ind2Horz = n-(k+1);
+        blas::Scal( ind2Vert, F(1)/alpha, &CBuf[(k+1)+k*CLDim], 1 );
+        blas::Geru
+        ( ind2Vert, ind2Horz, F(-1),
+          &CBuf[(k+1)+k*CLDim], 1, &CBuf[k+(k+1)*CLDim], CLDim,
+          &CBuf[(k+1)+(k+1)*CLDim], CLDim );
+    }
+
+    // Keep the original (unfactored) winning rows
+    Matrix<F> winners( numWinners, n );
+    vector<Int> winnerIndices( numWinners );
+    for( Int i=0; i<numWinners; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+            winners(i,j) = C(order[i],j);
+        winnerIndices[i] = indices[order[i]];
+    }
+    C = winners;
+    indices = winnerIndices;
+}
+
+// Communication-avoiding LU factorization of the panel [A; B] via tournament
+// pivoting (CALU): each process selects n candidate pivot rows from its
+// portion of the panel, the candidates are merged up a binary tree over the
+// column communicator (in the manner of the TSQR reduction in qr::ts), and
+// the n winners are broadcast from the root. The panel is then permuted so
+// that the winners lie in A and factored without further pivoting, which
+// requires O(log p) messages rather than the O(n log p) of lu::Panel.
+//
+// As with lu::Panel, A[*,*] should hold the same data on every process and
+// P and PB are updated with the row swaps.
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Height() != n )
+          LogicError("A must be square");
+    )
+    F* ABuf = A.Buffer();
+    F* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    mpi::Comm colComm = B.ColComm();
+    const int commSize = mpi::Size( colComm );
+    const int commRank = mpi::Rank( colComm );
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // Gather the local candidates, with the rows of A (which every process
+    // holds) assigned to the root
+    const Int numLocalA = ( commRank == 0 ? n : 0 );
+    Matrix<F> C( numLocalA+BLocHeight, n );
+    vector<Int> indices( numLocalA+BLocHeight );
+    for( Int i=0; i<numLocalA; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+            C(i,j) = ABuf[i+j*ALDim];
+        indices[i] = i;
+    }
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+    {
+        for( Int j=0; j<n; ++j )
+            C(numLocalA+iLoc,j) = BBuf[iLoc+j*BLDim];
+        indices[numLocalA+iLoc] = n + B.GlobalRow(iLoc);
+    }
+    TournamentRound( C, indices );
+
+    // Merge the candidates up a binary tree rooted at process zero
+    vector<F> values;
+    for( int stride=1; stride<commSize; stride*=2 )
+    {
+        if( commRank % (2*stride) == 0 )
+        {
+            const int partner = commRank + stride;
+            if( partner >= commSize )
+                continue;
+            const Int numMine = C.Height();
+            const Int numTheirs = mpi::Recv<Int>( partner, colComm );
+            vector<Int> theirIndices( numTheirs );
+            FastResize( values, numTheirs*n );
+            mpi::Recv( theirIndices.data(), numTheirs, partner, colComm );
+            mpi::Recv( values.data(), numTheirs*n, partner, colComm );
+
+            Matrix<F> merged( numMine+numTheirs, n );
+            auto mergedTop = merged( IR(0,numMine), ALL );
+            mergedTop = C;
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<numTheirs; ++i )
+                    merged(numMine+i,j) = values[i+j*numTheirs];
+            indices.insert
+            ( indices.end(), theirIndices.begin(), theirIndices.end() );
+            C = merged;
+            TournamentRound( C, indices );
+        }
+        else
+        {
+            const int partner = commRank - stride;
+            const Int numMine = C.Height();
+            FastResize( values, numMine*n );
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<numMine; ++i )
+                    values[i+j*numMine] = C(i,j);
+            mpi::Send( numMine, partner, colComm );
+            mpi::Send( indices.data(), numMine, partner, colComm );
+            mpi::Send( values.data(), numMine*n, partner, colComm );
+            break;
+        }
+    }
+
+    // Broadcast the winners from the root
+    indices.resize( n );
+    FastResize( values, n*n );
+    if( commRank == 0 )
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                values[i+j*n] = C(i,j);
+    mpi::Broadcast( indices.data(), n, 0, colComm );
+    mpi::Broadcast( values.data(), n*n, 0, colComm );
+
+    // Swap the winners into A. Since the current contents of each position
+    // are tracked, the rows swapped out of A need not be communicated.
+    std::map<Int,Int> positionOf, contentsOf;
+    auto position = [&]( Int origin )
+      { auto it = positionOf.find(origin);
+        return it == positionOf.end() ? origin : it->second; };
+    auto contents = [&]( Int pos )
+      { auto it = contentsOf.find(pos);
+        return it == contentsOf.end() ? pos : it->second; };
+    for( Int k=0; k<n; ++k )
+    {
+        const Int iPiv = position( indices[k] );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+        if( iPiv == k )
+            continue;
+
+        if( iPiv < n )
+        {
+            blas::Swap( n, &ABuf[iPiv], ALDim, &ABuf[k], ALDim );
+        }
+        else
+        {
+            const Int relIndex = iPiv - n;
+            if( B.IsLocalRow(relIndex) )
+            {
+                const Int iLoc = B.LocalRow(relIndex);
+                for( Int j=0; j<n; ++j )
+                    BBuf[iLoc+j*BLDim] = ABuf[k+j*ALDim];
+            }
+            for( Int j=0; j<n; ++j )
+                ABuf[k+j*ALDim] = values[k+j*n];
+        }
+
+        const Int displaced = contents( k );
+        positionOf[displaced] = iPiv;
+        contentsOf[iPiv] = displaced;
+        positionOf[indices[k]] = k;
+        contentsOf[k] = indices[k];
+    }
+
+    // Factor the permuted panel without pivoting
+    lu::Unb( A.Matrix() );
+    LocalTrsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A, B );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
@@ -12,10 +12,13 @@
 #include "./QR/BusingerGolub.hpp"
 #include "./QR/Cholesky.hpp"
 #include "./QR/Householder.hpp"
+#include "./QR/HQRRP.hpp"
+#include "./QR/Tiled.hpp"
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
 
 #include "./QR/ColSwap.hpp"
+#include "./QR/Update.hpp"
 
 #include "./QR/TS.hpp"
 
@@ -38,6 +41,9 @@ void QR
   ElementalMatrix<Base<F>>& signature )
 {
     DEBUG_CSE
+    const Grid& g = A.Grid();
+    TunedBlocksizeScope scope
+    ( TUNE_QR, Min(A.Height(),A.Width()), g.Height(), g.Width() );
     qr::Householder( A, householderScalars, signature );
 }
 
@@ -67,8 +73,8 @@ void QR
 #endif
 }
 
-// Variants which perform (Businger-Golub) column-pivoting
-// =======================================================
+// Variants which perform (Businger-Golub or HQRRP) column-pivoting
+// ================================================================
 
 template<typename F> 
 void QR
@@ -79,7 +85,10 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+    if( ctrl.randomizedPivoting )
+        qr::HQRRP( A, householderScalars, signature, Omega, ctrl );
+    else
+        qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
 }
 
 template<typename F> 
@@ -91,7 +100,10 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+    if( ctrl.randomizedPivoting )
+        qr::HQRRP( A, householderScalars, signature, Omega, ctrl );
+    else
+        qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
 }
 
 #define PROTO_BASE(F) \
@@ -99,6 +111,11 @@ void QR
   ( Matrix<F>& A, \
     Matrix<F>& householderScalars, \
     Matrix<Base<F>>& signature ); \
+  template void qr::Tiled \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<Base<F>>& signature, \
+    const TileCtrl& ctrl ); \
   template void QR \
   ( ElementalMatrix<F>& A, \
     ElementalMatrix<F>& householderScalars, \
@@ -153,6 +170,46 @@ void QR
   (       Matrix<F>& Q, \
           Matrix<F>& R, \
     const Matrix<Int>& colSwaps ); \
+  template void qr::InsertRows \
+  (       Matrix<F>& Q, \
+          Matrix<F>& R, \
+          Int i, \
+    const Matrix<F>& B ); \
+  template void qr::InsertRows \
+  (       ElementalMatrix<F>& Q, \
+          ElementalMatrix<F>& R, \
+          Int i, \
+    const ElementalMatrix<F>& B ); \
+  template void qr::DeleteRows \
+  ( Matrix<F>& Q, \
+    Matrix<F>& R, \
+    Int i, \
+    Int numRows ); \
+  template void qr::DeleteRows \
+  ( ElementalMatrix<F>& Q, \
+    ElementalMatrix<F>& R, \
+    Int i, \
+    Int numRows ); \
+  template void qr::InsertCols \
+  (       Matrix<F>& Q, \
+          Matrix<F>& R, \
+          Int j, \
+    const Matrix<F>& C ); \
+  template void qr::InsertCols \
+  (       ElementalMatrix<F>& Q, \
+          ElementalMatrix<F>& R, \
+          Int j, \
+    const ElementalMatrix<F>& C ); \
+  template void qr::DeleteCols \
+  ( Matrix<F>& Q, \
+    Matrix<F>& R, \
+    Int j, \
+    Int numCols ); \
+  template void qr::DeleteCols \
+  ( ElementalMatrix<F>& Q, \
+    ElementalMatrix<F>& R, \
+    Int j, \
+    Int numCols ); \
   template void qr::ApplyQ \
   ( LeftOrRight side, \
     Orientation orientation, \
@@ -167,6 +224,12 @@ void QR
     const ElementalMatrix<F>& householderScalars, \
     const ElementalMatrix<Base<F>>& signature, \
           ElementalMatrix<F>& B ); \
+  template void qr::ApplyQ \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    const CompactWY<F>& wy, \
+    const ElementalMatrix<Base<F>>& signature, \
+          ElementalMatrix<F>& B ); \
   template void qr::SolveAfter \
   ( Orientation orientation, \
     const Matrix<F>& A, \
@@ -183,11 +246,15 @@ void QR
           ElementalMatrix<F>& X ); \
   template void qr::Cholesky \
   ( Matrix<F>& A, \
-    Matrix<F>& R ); \
+    Matrix<F>& R, \
+    const CholeskyQRCtrl<Base<F>>& ctrl ); \
   template void qr::Cholesky \
   ( ElementalMatrix<F>& A, \
-    ElementalMatrix<F>& R ); \
+    ElementalMatrix<F>& R, \
+    const CholeskyQRCtrl<Base<F>>& ctrl ); \
   template qr::TreeData<F> qr::TS( const ElementalMatrix<F>& A ); \
+  template void qr::TS \
+  ( const ElementalMatrix<F>& A, TreeData<F>& treeData ); \
   template void qr::ExplicitTS \
   ( ElementalMatrix<F>& A, \
     ElementalMatrix<F>& R ); \
@@ -197,6 +264,8 @@ void QR
   ( const ElementalMatrix<F>& A, const TreeData<F>& treeData ); \
   template void qr::ts::Reduce \
   ( const ElementalMatrix<F>& A, TreeData<F>& treeData ); \
+  template void qr::ts::Refactor \
+  ( const ElementalMatrix<F>& A, TreeData<F>& treeData ); \
   template void qr::ts::Scatter \
   ( ElementalMatrix<F>& A, const TreeData<F>& treeData ); 
 
@@ -125,6 +125,60 @@ void ApplyQ
     }
 }
 
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const CompactWY<F>& wy,
+  const ElementalMatrix<Base<F>>& signature,
+        ElementalMatrix<F>& BPre )
+{
+    DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const bool applyDFirst = normal==onLeft;
+    const Int minDim = wy.NumReflectors();
+
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    const Int m = B.Height();
+    const Int n = B.Width();
+
+    if( applyDFirst )
+    {
+        if( onLeft )
+        {
+            auto BTop = B( IR(0,minDim), IR(0,n) );
+            DiagonalScale( side, orientation, signature, BTop );
+        }
+        else
+        {
+            auto BLeft = B( IR(0,m), IR(0,minDim) );
+            DiagonalScale( side, orientation, signature, BLeft );
+        }
+    }
+
+    wy.Apply( side, direction, conjugation, B );
+
+    if( !applyDFirst )
+    {
+        if( onLeft )
+        {
+            auto BTop = B( IR(0,minDim), IR(0,n) );
+            DiagonalScale( side, orientation, signature, BTop );
+        }
+        else
+        {
+            auto BLeft = B( IR(0,m), IR(0,minDim) );
+            DiagonalScale( side, orientation, signature, BLeft );
+        }
+    }
+}
+
 } // namespace qr
 } // namespace El
 
@@ -218,9 +218,9 @@ Base<F> ColNorms( const DistMatrix<F>& A, vector<Base<F>>& norms )
     vector<Real> localScales(localWidth,0), 
                  localScaledSquares(localWidth,1);
     for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScales[jLoc], localScaledSquares[jLoc] );
+        UpdateScaledSquares
+        ( localHeight, ALoc.LockedBuffer(0,jLoc), 1,
+          localScales[jLoc], localScaledSquares[jLoc] );
 
     // Find the maximum relative scales 
     vector<Real> scales(localWidth);
@@ -274,10 +274,9 @@ void ReplaceColNorms
     vector<Real> localScales(numInaccurate,0), 
                  localScaledSquares(numInaccurate,1);
     for( Int s=0; s<numInaccurate; ++s )
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,inaccurateNorms[s]), 
-              localScales[s], localScaledSquares[s] );
+        UpdateScaledSquares
+        ( localHeight, ALoc.LockedBuffer(0,inaccurateNorms[s]), 1,
+          localScales[s], localScaledSquares[s] );
 
     // Find the maximum relative scales 
     vector<Real> scales(numInaccurate);
@@ -2,8 +2,8 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #ifndef EL_CHOLESKY_QR_HPP
@@ -12,26 +12,144 @@
 namespace El {
 namespace qr {
 
-// NOTE: This version is designed for tall-skinny matrices and is much less
-//       numerically stable than Householder-based QR factorizations
+// NOTE: A single pass is designed for tall-skinny matrices and is much less
+//       numerically stable than Householder-based QR factorizations. The
+//       CholeskyQR2 variant repeats the pass once on the computed Q, which
+//       yields Householder-level orthogonality for condition numbers up to
+//       roughly 1/sqrt(eps), as shown in
 //
-// Computes the QR factorization of full-rank tall-skinny matrix A and 
+//         Takeshi Fukaya, Yuji Nakatsukasa, Yuka Yanagisawa, and
+//         Yusaku Yamamoto,
+//         "CholeskyQR2: A simple and communication-avoiding algorithm for
+//          computing a tall-skinny QR factorization",
+//         Proc. ScalA '14, pp. 31--38, 2014,
+//
+//       while the shifted CholeskyQR3 variant first performs a pass on the
+//       shifted Gram matrix A^H A + s I, which is numerically positive-definite
+//       for condition numbers up to roughly 1/eps, as in
+//
+//         Takeshi Fukaya, Ramaseshan Kannan, Yuji Nakatsukasa, Yusaku Yamamoto,
+//         and Yuka Yanagisawa,
+//         "Shifted Cholesky QR for computing the QR factorization of
+//          ill-conditioned matrices",
+//         SIAM J. Sci. Comput., Vol. 42, No. 1, pp. A477--A503, 2020.
+//
+// Computes the QR factorization of full-rank tall-skinny matrix A and
 // overwrites A with Q
 //
 
-template<typename F> 
-void Cholesky( Matrix<F>& A, Matrix<F>& R )
+namespace cholesky {
+
+// The shift suggested by Fukaya et al., with || A ||_2 bounded above by
+// || A ||_F, which is the square-root of the trace of the Gram matrix
+template<typename F>
+Base<F> DefaultShift( const Matrix<F>& G, Int m )
 {
     DEBUG_CSE
-    if( A.Height() < A.Width() )
-        LogicError("A^H A will be singular");
-    Herk( UPPER, ADJOINT, Base<F>(1), A, R );
+    typedef Base<F> Real;
+    const Int n = G.Height();
+    Real frobASquared = 0;
+    for( Int j=0; j<n; ++j )
+        frobASquared += RealPart(G(j,j));
+    const Real eps = limits::Epsilon<Real>();
+    return Real(11)*(m*n + n*(n+1))*eps*frobASquared;
+}
+
+// Overwrite A with A inv(R), where R is the (possibly shifted) Cholesky factor
+// of A^H A, and then update RTotal := R RTotal
+template<typename F>
+void Pass
+( Matrix<F>& A,
+  Matrix<F>& R,
+  Matrix<F>& RTotal,
+  bool shifted,
+  Base<F> shift,
+  bool first )
+{
+    DEBUG_CSE
+    Zeros( R, A.Width(), A.Width() );
+    Herk( UPPER, ADJOINT, Base<F>(1), A, Base<F>(0), R );
+    if( shifted )
+    {
+        if( shift == Base<F>(0) )
+            shift = DefaultShift( R, A.Height() );
+        ShiftDiagonal( R, F(shift) );
+    }
     El::Cholesky( UPPER, R );
+    MakeTrapezoidal( UPPER, R );
     Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A );
+    if( first )
+        RTotal = R;
+    else
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R, RTotal );
 }
 
-template<typename F> 
-void Cholesky( ElementalMatrix<F>& APre, ElementalMatrix<F>& RPre )
+template<typename F>
+void Pass
+( DistMatrix<F,VC,STAR>& A,
+  DistMatrix<F,STAR,STAR>& R,
+  DistMatrix<F,STAR,STAR>& RTotal,
+  bool shifted,
+  Base<F> shift,
+  bool first )
+{
+    DEBUG_CSE
+    // Only a single reduction of the n x n Gram matrix is required per pass
+    Zeros( R, A.Width(), A.Width() );
+    Herk( UPPER, ADJOINT, Base<F>(1), A.Matrix(), Base<F>(0), R.Matrix() );
+    El::AllReduce( R, A.ColComm() );
+    if( shifted )
+    {
+        if( shift == Base<F>(0) )
+            shift = DefaultShift( R.Matrix(), A.Height() );
+        ShiftDiagonal( R.Matrix(), F(shift) );
+    }
+    El::Cholesky( UPPER, R.Matrix() );
+    MakeTrapezoidal( UPPER, R.Matrix() );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
+    if( first )
+        RTotal = R;
+    else
+        Trmm
+        ( LEFT, UPPER, NORMAL, NON_UNIT,
+          F(1), R.Matrix(), RTotal.Matrix() );
+}
+
+} // namespace cholesky
+
+template<typename F>
+void Cholesky
+( Matrix<F>& A,
+  Matrix<F>& R,
+  const CholeskyQRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( A.Height() < A.Width() )
+        LogicError("A^H A will be singular");
+    if( ctrl.variant == CHOLESKY_QR )
+    {
+        Herk( UPPER, ADJOINT, Base<F>(1), A, R );
+        El::Cholesky( UPPER, R );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A );
+        return;
+    }
+
+    Matrix<F> RPass;
+    bool first = true;
+    if( ctrl.variant == SHIFTED_CHOLESKY_QR3 )
+    {
+        cholesky::Pass( A, RPass, R, true, ctrl.shift, first );
+        first = false;
+    }
+    cholesky::Pass( A, RPass, R, false, Base<F>(0), first );
+    cholesky::Pass( A, RPass, R, false, Base<F>(0), false );
+}
+
+template<typename F>
+void Cholesky
+( ElementalMatrix<F>& APre,
+  ElementalMatrix<F>& RPre,
+  const CholeskyQRCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
     const Int m = APre.Height();
@@ -44,11 +162,25 @@ void Cholesky( ElementalMatrix<F>& APre, ElementalMatrix<F>& RPre )
     auto& A = AProx.Get();
     auto& R = RProx.Get();
 
-    Zeros( R, n, n );
-    Herk( UPPER, ADJOINT, Base<F>(1), A.Matrix(), Base<F>(0), R.Matrix() );
-    El::AllReduce( R, A.ColComm() );
-    El::Cholesky( UPPER, R.Matrix() );
-    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
+    if( ctrl.variant == CHOLESKY_QR )
+    {
+        Zeros( R, n, n );
+        Herk( UPPER, ADJOINT, Base<F>(1), A.Matrix(), Base<F>(0), R.Matrix() );
+        El::AllReduce( R, A.ColComm() );
+        El::Cholesky( UPPER, R.Matrix() );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
+        return;
+    }
+
+    DistMatrix<F,STAR,STAR> RPass( A.Grid() );
+    bool first = true;
+    if( ctrl.variant == SHIFTED_CHOLESKY_QR3 )
+    {
+        cholesky::Pass( A, RPass, R, true, ctrl.shift, first );
+        first = false;
+    }
+    cholesky::Pass( A, RPass, R, false, Base<F>(0), first );
+    cholesky::Pass( A, RPass, R, false, Base<F>(0), false );
 }
 
 } // namespace qr
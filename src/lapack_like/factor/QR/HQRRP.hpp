@@ -0,0 +1,279 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_HQRRP_HPP
+#define EL_QR_HQRRP_HPP
+
+#include "./BusingerGolub.hpp"
+#include "./Householder.hpp"
+
+// Column-pivoted QR with randomized, blocked pivot selection, as in
+//
+//   Per-Gunnar Martinsson, Gregorio Quintana-Orti, Nathan Heavner, and
+//   Robert van de Geijn,
+//   "Householder QR factorization with randomization for column pivoting
+//    (HQRRP)",
+//   SIAM J. Sci. Comput., Vol. 39, No. 2, pp. C96--C115, 2017,
+//
+// and
+//
+//   Jed A. Duersch and Ming Gu,
+//   "Randomized QR with column pivoting",
+//   SIAM J. Sci. Comput., Vol. 39, No. 4, pp. C263--C291, 2017.
+//
+// A Gaussian sketch, Y = G A, with only (bsize+oversample) rows is formed
+// once. Each panel of pivots is then chosen by a (cheap) Businger-Golub
+// factorization of the trailing columns of Y, after which the panel is
+// factored without pivoting and applied to the trailing matrix with the
+// usual level-3 compact-WY update. If A = Q [R11, R12; 0, A22], then
+// G Q = [G1, G2] is again Gaussian and
+//
+//   G2 A22 = Y2 - (Y1 inv(R11)) R12,
+//
+// so that the sketch of the trailing matrix is available from a downdate
+// of Y rather than from a new product with A22.
+
+namespace El {
+namespace qr {
+
+// Select (at most) maxPivots pivots from the columns of the sketch Y and
+// return the permutation in pivots. Zero is returned if the remaining
+// sketch is (relatively) negligible.
+template<typename F>
+Int SketchPivots
+( const Matrix<F>& Y,
+        Permutation& pivots,
+        Int maxPivots,
+        Base<F> maxOrigSketchNorm,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    auto YCopy( Y );
+    vector<Real> norms;
+    const Real maxSketchNorm = ColNorms( YCopy, norms );
+    if( maxSketchNorm == Real(0) )
+        return 0;
+
+    QRCtrl<Real> sketchCtrl;
+    sketchCtrl.boundRank = true;
+    sketchCtrl.maxRank = maxPivots;
+    if( ctrl.adaptive )
+    {
+        // Rescale the tolerance relative to the original sketch
+        sketchCtrl.adaptive = true;
+        sketchCtrl.tol = ctrl.tol*maxOrigSketchNorm/maxSketchNorm;
+    }
+    Matrix<F> householderScalars;
+    Matrix<Real> signature;
+    BusingerGolub( YCopy, householderScalars, signature, pivots, sketchCtrl );
+    return householderScalars.Height();
+}
+
+template<typename F>
+void HQRRP
+(       Matrix<F>& A,
+        Matrix<F>& householderScalars,
+        Matrix<Base<F>>& signature,
+        Permutation& Omega,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.smallestFirst )
+        LogicError("HQRRP does not support smallestFirst");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int maxSteps = ( ctrl.boundRank ? Min(ctrl.maxRank,minDim) : minDim );
+    householderScalars.Resize( maxSteps, 1 );
+    signature.Resize( maxSteps, 1 );
+
+    Omega.MakeIdentity( n );
+    Omega.ReserveSwaps( n );
+
+    const Int bsize = Blocksize();
+    const Int sketchHeight = bsize + ctrl.sketchOversample;
+    Matrix<F> G, Y;
+    Gaussian( G, sketchHeight, m );
+    Gemm( NORMAL, NORMAL, F(1), G, A, Y );
+    vector<Real> sketchNorms;
+    const Real maxOrigSketchNorm = ColNorms( Y, sketchNorms );
+
+    Matrix<F> W;
+    Permutation panelPerm;
+    Int k=0;
+    while( k < maxSteps )
+    {
+        // Select the pivots for the next panel from the trailing sketch
+        auto YTrail = Y( ALL, IR(k,END) );
+        const Int nb =
+          SketchPivots
+          ( YTrail, panelPerm, Min(bsize,maxSteps-k), maxOrigSketchNorm, ctrl );
+        if( nb == 0 )
+            break;
+        auto ATrail = A( ALL, IR(k,END) );
+        panelPerm.PermuteCols( ATrail );
+        panelPerm.PermuteCols( YTrail );
+        Omega.SwapSequence( panelPerm, k );
+
+        const Range<Int> ind1( k,    k+nb ),
+                         indB( k,    END  ),
+                         ind2( k+nb, END  );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+        RecursivePanelHouseholder( AB1, householderScalars1, sig1 );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+
+        // Downdate the sketch: Y2 := Y2 - (Y1 inv(R11)) R12
+        auto R11 = A( ind1, ind1 );
+        auto R12 = A( ind1, ind2 );
+        auto Y2 = Y( ALL, ind2 );
+        W = Y( ALL, ind1 );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R11, W );
+        Gemm( NORMAL, NORMAL, F(-1), W, R12, F(1), Y2 );
+
+        k += nb;
+    }
+    householderScalars.Resize( k, 1 );
+    signature.Resize( k, 1 );
+}
+
+template<typename F>
+void HQRRP
+( ElementalMatrix<F>& APre,
+  ElementalMatrix<F>& householderScalarsPre,
+  ElementalMatrix<Base<F>>& signaturePre,
+  DistPermutation& Omega,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    typedef Base<F> Real;
+    if( ctrl.smallestFirst )
+        LogicError("HQRRP does not support smallestFirst");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Real,Real,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int maxSteps = ( ctrl.boundRank ? Min(ctrl.maxRank,minDim) : minDim );
+    householderScalars.Resize( maxSteps, 1 );
+    signature.Resize( maxSteps, 1 );
+
+    Omega.MakeIdentity( n );
+    Omega.ReserveSwaps( n );
+
+    // The sketch is stored in a [STAR,MR] distribution so that its downdate
+    // only involves the process rows, and it is only gathered once per panel
+    const Int bsize = Blocksize();
+    const Int sketchHeight = bsize + ctrl.sketchOversample;
+    DistMatrix<F,STAR,MR> Y(g);
+    {
+        DistMatrix<F> G(g), YFull(g);
+        Gaussian( G, sketchHeight, m );
+        Gemm( NORMAL, NORMAL, F(1), G, A, YFull );
+        Y.AlignWith( A );
+        Y = YFull;
+    }
+    Real maxOrigSketchNorm;
+    {
+        DistMatrix<F,STAR,STAR> Y_STAR_STAR( Y );
+        vector<Real> sketchNorms;
+        maxOrigSketchNorm = ColNorms( Y_STAR_STAR.LockedMatrix(), sketchNorms );
+    }
+
+    DistMatrix<F,STAR,STAR> YTrail_STAR_STAR(g), R11_STAR_STAR(g),
+                            W_STAR_STAR(g);
+    DistMatrix<F,STAR,MR> R12_STAR_MR(g);
+    Permutation panelPerm;
+    Matrix<Int> p;
+    vector<Int> perm, invPerm;
+    Int k=0;
+    while( k < maxSteps )
+    {
+        // Redundantly select the pivots for the next panel from the trailing
+        // sketch
+        auto YTrail = Y( ALL, IR(k,END) );
+        YTrail_STAR_STAR = YTrail;
+        const Int nb =
+          SketchPivots
+          ( YTrail_STAR_STAR.LockedMatrix(), panelPerm,
+            Min(bsize,maxSteps-k), maxOrigSketchNorm, ctrl );
+        if( nb == 0 )
+            break;
+
+        // Convert the leading nb pivots into a sequence of distributed swaps
+        const Int nTrail = n - k;
+        panelPerm.ExplicitVector( p );
+        perm.resize( nTrail );
+        invPerm.resize( nTrail );
+        for( Int j=0; j<nTrail; ++j )
+        {
+            perm[j] = j;
+            invPerm[j] = j;
+        }
+        DistPermutation panelDistPerm(g);
+        panelDistPerm.MakeIdentity( nTrail );
+        panelDistPerm.ReserveSwaps( nb );
+        for( Int j=0; j<nb; ++j )
+        {
+            const Int jPiv = invPerm[p(j)];
+            panelDistPerm.Swap( j, jPiv );
+            std::swap( perm[j], perm[jPiv] );
+            invPerm[perm[j]] = j;
+            invPerm[perm[jPiv]] = jPiv;
+        }
+        auto ATrail = A( ALL, IR(k,END) );
+        panelDistPerm.PermuteCols( ATrail );
+        panelDistPerm.PermuteCols( YTrail );
+        Omega.SwapSequence( panelDistPerm, k );
+
+        const Range<Int> ind1( k,    k+nb ),
+                         indB( k,    END  ),
+                         ind2( k+nb, END  );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+        PanelHouseholder( AB1, householderScalars1, sig1 );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+
+        // Downdate the sketch: Y2 := Y2 - (Y1 inv(R11)) R12
+        auto Y2 = Y( ALL, ind2 );
+        R11_STAR_STAR = A( ind1, ind1 );
+        W_STAR_STAR = Y( ALL, ind1 );
+        Trsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT,
+          F(1), R11_STAR_STAR.LockedMatrix(), W_STAR_STAR.Matrix() );
+        R12_STAR_MR.AlignWith( Y2 );
+        R12_STAR_MR = A( ind1, ind2 );
+        LocalGemm( NORMAL, NORMAL, F(-1), W_STAR_STAR, R12_STAR_MR, F(1), Y2 );
+
+        k += nb;
+    }
+    householderScalars.Resize( k, 1 );
+    signature.Resize( k, 1 );
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_HQRRP_HPP
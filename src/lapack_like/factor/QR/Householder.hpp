@@ -43,7 +43,7 @@ Householder
         auto householderScalars1 = householderScalars( ind1, ALL );
         auto sig1 = signature( ind1, ALL );
 
-        PanelHouseholder( AB1, householderScalars1, sig1 );
+        RecursivePanelHouseholder( AB1, householderScalars1, sig1 );
         ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
     }
 }
@@ -67,6 +67,52 @@ void PanelHouseholder
     DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
 }
 
+// A recursive formulation in the spirit of
+//
+//   Erik Elmroth and Fred G. Gustavson,
+//   "Applying recursion to serial and parallel QR factorization leads to
+//    better performance",
+//   IBM J. Res. Develop., Vol. 44, No. 4, pp. 605--624, 2000,
+//
+// which splits the columns in half so that, independent of the algorithmic
+// blocksize, all but O(cutoff) of the flops are performed by the (level-3)
+// application of the left half's reflectors to the right half
+const Int RECURSIVE_QR_CUTOFF = 16;
+
+template<typename F>
+void RecursivePanelHouseholder
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim <= RECURSIVE_QR_CUTOFF )
+    {
+        PanelHouseholder( A, householderScalars, signature );
+        return;
+    }
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    const Int n1 = minDim/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, END ), indT( n1, minDim );
+
+    auto AL = A( ALL, ind1 );
+    auto AR = A( ALL, ind2 );
+    auto A22 = A( ind2, ind2 );
+    auto householderScalars1 = householderScalars( ind1, ALL );
+    auto householderScalars2 = householderScalars( indT, ALL );
+    auto sig1 = signature( ind1, ALL );
+    auto sig2 = signature( indT, ALL );
+
+    RecursivePanelHouseholder( AL, householderScalars1, sig1 );
+    ApplyQ( LEFT, ADJOINT, AL, householderScalars1, sig1, AR );
+    RecursivePanelHouseholder( A22, householderScalars2, sig2 );
+}
+
 template<typename F> 
 void PanelHouseholder
 ( DistMatrix<F>& A,
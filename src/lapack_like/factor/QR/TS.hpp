@@ -45,20 +45,20 @@ void Reduce( const ElementalMatrix<F>& A, TreeData<F>& treeData )
     Matrix<F> ZTop(n,n,n), ZBot(n,n,n);
     for( Int stage=0; stage<logp; ++stage )
     {
-        // Pack, then send and receive n x n matrices
+        // Send and receive n x n matrices (packing them if they are padded)
         const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
         const bool top = rank < partner;
         if( top )
         {
             ZTop = lastZ;
             MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
+            Recv( ZBot, colComm, partner );
         }
         else
         {
             ZBot = lastZ;
             MakeTrapezoidal( UPPER, ZBot );
-            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
+            Send( ZBot, colComm, partner );
             break;
         }
 
@@ -85,6 +85,19 @@ void Reduce( const ElementalMatrix<F>& A, TreeData<F>& treeData )
     }
 }
 
+template<typename F>
+void Refactor( const ElementalMatrix<F>& A, TreeData<F>& treeData )
+{
+    DEBUG_CSE
+    if( A.RowDist() != STAR )
+        LogicError("Invalid row distribution for TSQR");
+    // Since QR0 is only resized (and then overwritten), its buffer is
+    // reused whenever the local height has not grown
+    treeData.QR0 = A.LockedMatrix();
+    QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
+    Reduce( A, treeData );
+}
+
 template<typename F>
 Matrix<F>&
 RootQR( const ElementalMatrix<F>& A, TreeData<F>& treeData )
@@ -238,13 +251,13 @@ void Scatter( ElementalMatrix<F>& A, const TreeData<F>& treeData )
             }
             // Send bottom-half to partner and keep top half
             ZHalf = ZBot;
-            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm );
+            Send( ZHalf, colComm, partner );
             ZHalf = ZTop; 
         }
         else
         {
             // Recv top half from partner
-            mpi::Recv( ZHalf.Buffer(), n*n, partner, colComm );
+            Recv( ZHalf, colComm, partner );
         }
     }
 
@@ -315,25 +328,24 @@ FormQ( ElementalMatrix<F>& A, TreeData<F>& treeData )
 
 } // namespace ts
 
+template<typename F>
+void TS( const ElementalMatrix<F>& A, TreeData<F>& treeData )
+{
+    DEBUG_CSE
+    ts::Refactor( A, treeData );
+    const Int p = mpi::Size( A.ColComm() );
+    if( p != 1 && A.ColRank() == 0 )
+        QR
+        ( ts::RootQR(A,treeData),
+          ts::RootHouseholderScalars(A,treeData), 
+          ts::RootSignature(A,treeData) );
+}
+
 template<typename F>
 TreeData<F> TS( const ElementalMatrix<F>& A )
 {
-    if( A.RowDist() != STAR )
-        LogicError("Invalid row distribution for TSQR");
     TreeData<F> treeData;
-    treeData.QR0 = A.LockedMatrix();
-    QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
-
-    const Int p = mpi::Size( A.ColComm() );
-    if( p != 1 )
-    {
-        ts::Reduce( A, treeData );
-        if( A.ColRank() == 0 )
-            QR
-            ( ts::RootQR(A,treeData),
-              ts::RootHouseholderScalars(A,treeData), 
-              ts::RootSignature(A,treeData) );
-    }
+    TS( A, treeData );
     return treeData;
 }
 
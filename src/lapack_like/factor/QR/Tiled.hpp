@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_TILED_HPP
+#define EL_QR_TILED_HPP
+
+namespace El {
+namespace qr {
+
+// As in lu::Tiled, the tasks act upon tile columns so that the result is
+// identical in form to that of qr::Householder: each panel task factors a
+// tile column and forms the compact-WY representation of its reflectors,
+// which each update task then applies to a tile column to its right. The
+// next panel can therefore be factored as soon as its own tile column has
+// been updated.
+template<typename F>
+void Tiled
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  const TileCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.tileSize <= 0 )
+        LogicError("The tile size must be positive");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int nb = ctrl.tileSize;
+    const Int numTileCols = (n+nb-1) / nb;
+    const Int numPanels = (minDim+nb-1) / nb;
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    // The explicit (unit lower-trapezoidal) Householder vectors of each panel
+    // and the triangular matrices SInv such that the adjoint of the panel's
+    // unitary factor is I - V inv(SInv) V^H
+    vector<Matrix<F>> V( numPanels ), SInv( numPanels );
+
+    // B := D (I - V inv(SInv) V^H) B, where D is the panel's signature
+    auto applyPanel = [&]( Int k, Matrix<F>& B )
+    {
+        const Int nbPan = V[k].Width();
+        Matrix<F> Z;
+        Gemm( ADJOINT, NORMAL, F(1), V[k], B, Z );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv[k], Z );
+        Gemm( NORMAL, NORMAL, F(-1), V[k], Z, F(1), B );
+        auto BTop = B( IR(0,nbPan), ALL );
+        auto sig1 = signature( IR(k*nb,k*nb+nbPan), ALL );
+        DiagonalScale( LEFT, ADJOINT, sig1, BTop );
+    };
+
+    // The remainder of the last panel's tile column (if any) is updated
+    // within the panel task
+    auto factorPanel = [&]( Int k )
+    {
+        const Int k0 = k*nb;
+        const Int k1 = Min(k0+nb,minDim);
+        const Int kEnd = Min(k0+nb,n);
+        const IR ind1( k0, k1 ), indB( k0, m ), indR( k1, kEnd );
+        auto AB1 = A( indB, ind1 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+        RecursivePanelHouseholder( AB1, householderScalars1, sig1 );
+
+        V[k] = AB1;
+        MakeTrapezoidal( LOWER, V[k] );
+        FillDiagonal( V[k], F(1) );
+        Herk( LOWER, ADJOINT, Base<F>(1), V[k], SInv[k] );
+        for( Int j=0; j<k1-k0; ++j )
+            SInv[k](j,j) = F(1) / householderScalars1(j);
+
+        if( kEnd > k1 )
+        {
+            auto ABR = A( indB, indR );
+            applyPanel( k, ABR );
+        }
+    };
+
+    TaskGraph graph;
+    for( Int k=0; k<numPanels; ++k )
+    {
+        graph.Insert
+        ( [=]() { factorPanel(k); }, {}, {k}, 2*numTileCols );
+        for( Int j=k+1; j<numTileCols; ++j )
+            graph.Insert
+            ( [=,&A]()
+              {
+                  auto ABJ = A( IR(k*nb,m), IR(j*nb,Min((j+1)*nb,n)) );
+                  applyPanel( k, ABJ );
+              },
+              {k}, {j}, numTileCols-j );
+    }
+    graph.Execute( ctrl.numThreads );
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_TILED_HPP
@@ -0,0 +1,636 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_UPDATE_HPP
+#define EL_QR_UPDATE_HPP
+
+// Update a full, explicit QR factorization, A = Q R, with Q m x m unitary and
+// R m x n upper-trapezoidal, after inserting or deleting rows or columns of A.
+// Each routine requires O(m^2 + m n) work per row or column rather than the
+// O(m n^2) of a refactorization. Please see Section 6.5 of
+//
+//   Gene H. Golub and Charles F. Van Loan,
+//   "Matrix Computations", 4th edition, 2013,
+//
+// and
+//
+//   Sven Hammarling and Craig Lucas,
+//   "Updating the QR factorization and the least squares problem",
+//   MIMS EPrint 2008.111, 2008.
+//
+// The distributed variants redistribute Q into a [VC,STAR] distribution and
+// R into a [STAR,VR] distribution, so that the Givens rotations and
+// Householder reflectors, which act on the columns of Q and the rows of R,
+// are applied without communication.
+
+namespace El {
+namespace qr {
+
+namespace update {
+
+// As in NeighborColSwap, the rotation
+//
+//   G = |  c,       s |
+//       | -conj(s), c |
+//
+// is applied to rows (i-1,i) of R, so that Q(:,(i-1,i)) must be multiplied
+// from the right by G^H.
+template<typename F>
+void ApplyRotations
+( const vector<Int>& rows,
+  const vector<Base<F>>& cs,
+  const vector<F>& ss,
+        Matrix<F>& QLoc,
+        Matrix<F>& RLoc )
+{
+    DEBUG_CSE
+    const Int numRotations = rows.size();
+    for( Int rot=0; rot<numRotations; ++rot )
+    {
+        const Int i = rows[rot];
+        RotateRows( cs[rot], ss[rot], RLoc, i-1, i );
+        RotateCols( cs[rot], -ss[rot], QLoc, i-1, i );
+    }
+}
+
+// Compute the rotations which reduce the row vector q^T = Q(i,:) to a
+// multiple of e_0^T, from the bottom up, and overwrite q with the result
+template<typename F>
+void DeleteRowRotations
+( Matrix<F>& q,
+  vector<Int>& rows,
+  vector<Base<F>>& cs,
+  vector<F>& ss )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = q.Width();
+    rows.resize( 0 );
+    cs.resize( 0 );
+    ss.resize( 0 );
+    for( Int i=m-1; i>=1; --i )
+    {
+        // Since Q(:,(i-1,i)) is multiplied by G^H = | c,       -s |,
+        //                                           | conj(s),  c |
+        // we choose G to annihilate conj(q(i)) in G [conj(q(i-1));conj(q(i))]
+        Real c; F s;
+        const F rho = Givens( Conj(q(0,i-1)), Conj(q(0,i)), c, s );
+        q(0,i-1) = Conj(rho);
+        q(0,i) = 0;
+        rows.push_back( i );
+        cs.push_back( c );
+        ss.push_back( s );
+    }
+}
+
+// Compute the rotations which zero W(j+t+1:end,t) for t=0,...,k-1 (where W is
+// m x k), applying them to the trailing columns of W along the way
+template<typename F>
+void InsertColRotations
+( Matrix<F>& W,
+  Int j,
+  vector<Int>& rows,
+  vector<Base<F>>& cs,
+  vector<F>& ss )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = W.Height();
+    const Int k = W.Width();
+    rows.resize( 0 );
+    cs.resize( 0 );
+    ss.resize( 0 );
+    for( Int t=0; t<k; ++t )
+    {
+        auto WR = W( ALL, IR(t+1,k) );
+        for( Int i=m-1; i>j+t; --i )
+        {
+            Real c; F s;
+            W(i-1,t) = Givens( W(i-1,t), W(i,t), c, s );
+            W(i,t) = 0;
+            RotateRows( c, s, WR, i-1, i );
+            rows.push_back( i );
+            cs.push_back( c );
+            ss.push_back( s );
+        }
+    }
+}
+
+// Compute the rotations which zero r(c+1:c+k) (bottom-up) for a single
+// column, r, of R after k columns have been removed to its left
+template<typename F>
+void DeleteColRotations
+( Matrix<F>& r,
+  Int c,
+  Int k,
+  vector<Int>& rows,
+  vector<Base<F>>& cs,
+  vector<F>& ss )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = r.Height();
+    rows.resize( 0 );
+    cs.resize( 0 );
+    ss.resize( 0 );
+    for( Int i=Min(c+k,m-1); i>c; --i )
+    {
+        Real cos; F sin;
+        r(i-1) = Givens( r(i-1), r(i), cos, sin );
+        r(i) = 0;
+        rows.push_back( i );
+        cs.push_back( cos );
+        ss.push_back( sin );
+    }
+}
+
+// Apply H = I - tau [1; u] [1; u]^H to rows c and [s0,s0+height(u)) of T
+template<typename F>
+void ApplyReflectorToRows
+( F tau, const Matrix<F>& u, Int c, Int s0, Matrix<F>& T )
+{
+    DEBUG_CSE
+    auto tRow = T( IR(c), ALL );
+    auto TB = T( IR(s0,s0+u.Height()), ALL );
+    auto z( tRow );
+    Gemm( ADJOINT, NORMAL, F(1), u, TB, F(1), z );
+    Axpy( -tau, z, tRow );
+    Gemm( NORMAL, NORMAL, -tau, u, z, F(1), TB );
+}
+
+// Q := Q H^H, where H = I - tau [1; u] [1; u]^H acts on columns c and
+// [s0,s0+height(u)) of Q
+template<typename F>
+void ApplyReflectorToCols
+( F tau, const Matrix<F>& u, Int c, Int s0, Matrix<F>& Q )
+{
+    DEBUG_CSE
+    auto qCol = Q( ALL, IR(c) );
+    auto QB = Q( ALL, IR(s0,s0+u.Height()) );
+    auto y( qCol );
+    Gemv( NORMAL, F(1), QB, u, F(1), y );
+    Axpy( -Conj(tau), y, qCol );
+    Ger( -Conj(tau), y, u, QB );
+}
+
+} // namespace update
+
+// Delete rows [i,i+numRows) of A = Q R
+// ------------------------------------
+// For each deleted row, a sequence of rotations reduces Q(i,:) to a multiple
+// of e_0^T, which forces Q(:,0) to be a multiple of e_i and R to be upper
+// Hessenberg; deleting the i'th row and the first column of Q and the first
+// row of R then yields the updated factorization.
+template<typename F>
+void DeleteRows
+( Matrix<F>& Q,
+  Matrix<F>& R,
+  Int i,
+  Int numRows )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( Q.Height() != Q.Width() || Q.Height() != R.Height() )
+          LogicError("Expected a full QR factorization");
+      if( i < 0 || i+numRows > Q.Height() )
+          LogicError("Invalid row range");
+    )
+    vector<Int> rows;
+    vector<Base<F>> cs;
+    vector<F> ss;
+    Matrix<F> QNew, RNew;
+    for( Int t=0; t<numRows; ++t )
+    {
+        const Int m = Q.Height();
+        auto q = Q( IR(i), ALL );
+        auto qCopy( q );
+        update::DeleteRowRotations( qCopy, rows, cs, ss );
+        update::ApplyRotations( rows, cs, ss, Q, R );
+
+        QNew.Resize( m-1, m-1 );
+        auto QNewT = QNew( IR(0,i), ALL );
+        auto QNewB = QNew( IR(i,m-1), ALL );
+        QNewT = Q( IR(0,i), IR(1,m) );
+        QNewB = Q( IR(i+1,m), IR(1,m) );
+        Q = QNew;
+
+        RNew = R( IR(1,m), ALL );
+        R = RNew;
+    }
+}
+
+template<typename F>
+void DeleteRows
+( ElementalMatrix<F>& QPre,
+  ElementalMatrix<F>& RPre,
+  Int i,
+  Int numRows )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      AssertSameGrids( QPre, RPre );
+      if( QPre.Height() != QPre.Width() || QPre.Height() != RPre.Height() )
+          LogicError("Expected a full QR factorization");
+      if( i < 0 || i+numRows > QPre.Height() )
+          LogicError("Invalid row range");
+    )
+    DistMatrixReadWriteProxy<F,F,VC,STAR> QProx( QPre );
+    DistMatrixReadWriteProxy<F,F,STAR,VR> RProx( RPre );
+    auto& Q = QProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = Q.Grid();
+
+    vector<Int> rows;
+    vector<Base<F>> cs;
+    vector<F> ss;
+    DistMatrix<F,STAR,STAR> q(g);
+    DistMatrix<F,VC,STAR> QNew(g);
+    DistMatrix<F,STAR,VR> RNew(g);
+    for( Int t=0; t<numRows; ++t )
+    {
+        const Int m = Q.Height();
+        q = Q( IR(i), ALL );
+        update::DeleteRowRotations( q.Matrix(), rows, cs, ss );
+        update::ApplyRotations( rows, cs, ss, Q.Matrix(), R.Matrix() );
+
+        QNew.Resize( m-1, m-1 );
+        auto QNewT = QNew( IR(0,i), ALL );
+        auto QNewB = QNew( IR(i,m-1), ALL );
+        QNewT = Q( IR(0,i), IR(1,m) );
+        QNewB = Q( IR(i+1,m), IR(1,m) );
+        Q = QNew;
+
+        RNew = R( IR(1,m), ALL );
+        R = RNew;
+    }
+}
+
+// Insert the rows of B before row i of A = Q R
+// --------------------------------------------
+// With the rows of B appended to the bottom of A,
+//
+//   | A | = | Q 0 | | R |,
+//   | B |   | 0 I | | B |
+//
+// and each column c of B is annihilated with a Householder reflector acting
+// on row c of R and the rows of B. The rows of the augmented Q are then
+// permuted to place those corresponding to B before row i.
+template<typename F>
+void InsertRows
+(       Matrix<F>& Q,
+        Matrix<F>& R,
+        Int i,
+  const Matrix<F>& B )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( Q.Height() != Q.Width() || Q.Height() != R.Height() )
+          LogicError("Expected a full QR factorization");
+      if( B.Width() != R.Width() )
+          LogicError("B must have the same width as A");
+      if( i < 0 || i > Q.Height() )
+          LogicError("Invalid row index");
+    )
+    const Int m = R.Height();
+    const Int n = R.Width();
+    const Int k = B.Height();
+    const Int mNew = m + k;
+
+    Matrix<F> T, QAug;
+    Zeros( T, mNew, n );
+    auto TT = T( IR(0,m), ALL );
+    auto TB = T( IR(m,mNew), ALL );
+    TT = R;
+    TB = B;
+    Identity( QAug, mNew, mNew );
+    auto QAugTL = QAug( IR(0,m), IR(0,m) );
+    QAugTL = Q;
+
+    const Int numSteps = Min(n,mNew);
+    for( Int c=0; c<numSteps; ++c )
+    {
+        // Rows (c+1):(m-1) of column c of T are already zero
+        const Int s0 = Max(c+1,m);
+        if( s0 >= mNew )
+            continue;
+        auto x = T( IR(s0,mNew), IR(c) );
+        const F tau = LeftReflector( T(c,c), x );
+        const Matrix<F> u( x );
+        Zero( x );
+
+        auto TR = T( ALL, IR(c+1,n) );
+        update::ApplyReflectorToRows( tau, u, c, s0, TR );
+        update::ApplyReflectorToCols( tau, u, c, s0, QAug );
+    }
+
+    Q.Resize( mNew, mNew );
+    auto QT = Q( IR(0,i),      ALL );
+    auto QM = Q( IR(i,i+k),    ALL );
+    auto QB = Q( IR(i+k,mNew), ALL );
+    QT = QAug( IR(0,i),  ALL );
+    QM = QAug( IR(m,mNew), ALL );
+    QB = QAug( IR(i,m),  ALL );
+    R = T;
+}
+
+template<typename F>
+void InsertRows
+(       ElementalMatrix<F>& QPre,
+        ElementalMatrix<F>& RPre,
+        Int i,
+  const ElementalMatrix<F>& B )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      AssertSameGrids( QPre, RPre, B );
+      if( QPre.Height() != QPre.Width() || QPre.Height() != RPre.Height() )
+          LogicError("Expected a full QR factorization");
+      if( B.Width() != RPre.Width() )
+          LogicError("B must have the same width as A");
+      if( i < 0 || i > QPre.Height() )
+          LogicError("Invalid row index");
+    )
+    DistMatrixReadWriteProxy<F,F,VC,STAR> QProx( QPre );
+    DistMatrixReadWriteProxy<F,F,STAR,VR> RProx( RPre );
+    auto& Q = QProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = Q.Grid();
+    const Int m = R.Height();
+    const Int n = R.Width();
+    const Int k = B.Height();
+    const Int mNew = m + k;
+
+    DistMatrix<F,STAR,VR> T(g);
+    DistMatrix<F,VC,STAR> QAug(g);
+    Zeros( T, mNew, n );
+    auto TT = T( IR(0,m), ALL );
+    auto TB = T( IR(m,mNew), ALL );
+    TT = R;
+    TB = B;
+    Identity( QAug, mNew, mNew );
+    auto QAugTL = QAug( IR(0,m), IR(0,m) );
+    QAugTL = Q;
+
+    // Each reflector is computed by the owner of column c of T and broadcast
+    // within the [STAR,VR] communicator
+    auto& TLoc = T.Matrix();
+    vector<F> buf;
+    Matrix<F> u;
+    const Int numSteps = Min(n,mNew);
+    for( Int c=0; c<numSteps; ++c )
+    {
+        const Int s0 = Max(c+1,m);
+        if( s0 >= mNew )
+            continue;
+        const Int numRefl = mNew - s0;
+        FastResize( buf, numRefl+1 );
+        const int owner = T.ColOwner(c);
+        if( T.IsLocalCol(c) )
+        {
+            const Int cLoc = T.LocalCol(c);
+            auto x = TLoc( IR(s0,mNew), IR(cLoc) );
+            buf[0] = LeftReflector( TLoc(c,cLoc), x );
+            for( Int s=0; s<numRefl; ++s )
+                buf[s+1] = x(s);
+            Zero( x );
+        }
+        mpi::Broadcast( buf.data(), numRefl+1, owner, T.RowComm() );
+        const F tau = buf[0];
+        u.Resize( numRefl, 1 );
+        for( Int s=0; s<numRefl; ++s )
+            u(s) = buf[s+1];
+
+        auto TR = TLoc( ALL, IR(T.LocalColOffset(c+1),END) );
+        update::ApplyReflectorToRows( tau, u, c, s0, TR );
+        update::ApplyReflectorToCols( tau, u, c, s0, QAug.Matrix() );
+    }
+
+    Q.Resize( mNew, mNew );
+    auto QT = Q( IR(0,i),      ALL );
+    auto QM = Q( IR(i,i+k),    ALL );
+    auto QB = Q( IR(i+k,mNew), ALL );
+    QT = QAug( IR(0,i),  ALL );
+    QM = QAug( IR(m,mNew), ALL );
+    QB = QAug( IR(i,m),  ALL );
+    R = T;
+}
+
+// Insert the columns of C before column j of A = Q R
+// --------------------------------------------------
+// The new columns of R are Q^H C, which are reduced to upper-trapezoidal
+// form with rotations applied from the bottom up. Since the trailing columns
+// of R are shifted k places to the right, the rotations preserve their
+// upper-trapezoidal structure.
+template<typename F>
+void InsertCols
+(       Matrix<F>& Q,
+        Matrix<F>& R,
+        Int j,
+  const Matrix<F>& C )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( Q.Height() != Q.Width() || Q.Height() != R.Height() )
+          LogicError("Expected a full QR factorization");
+      if( C.Height() != R.Height() )
+          LogicError("C must have the same height as A");
+      if( j < 0 || j > R.Width() )
+          LogicError("Invalid column index");
+    )
+    const Int m = R.Height();
+    const Int n = R.Width();
+    const Int k = C.Width();
+
+    Matrix<F> W;
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, W );
+    vector<Int> rows;
+    vector<Base<F>> cs;
+    vector<F> ss;
+    update::InsertColRotations( W, j, rows, cs, ss );
+    auto RR = R( ALL, IR(j,n) );
+    update::ApplyRotations( rows, cs, ss, Q, RR );
+
+    Matrix<F> RNew;
+    RNew.Resize( m, n+k );
+    auto RNewL = RNew( ALL, IR(0,j) );
+    auto RNewM = RNew( ALL, IR(j,j+k) );
+    auto RNewR = RNew( ALL, IR(j+k,n+k) );
+    RNewL = R( ALL, IR(0,j) );
+    RNewM = W;
+    RNewR = RR;
+    R = RNew;
+}
+
+template<typename F>
+void InsertCols
+(       ElementalMatrix<F>& QPre,
+        ElementalMatrix<F>& RPre,
+        Int j,
+  const ElementalMatrix<F>& C )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      AssertSameGrids( QPre, RPre, C );
+      if( QPre.Height() != QPre.Width() || QPre.Height() != RPre.Height() )
+          LogicError("Expected a full QR factorization");
+      if( C.Height() != RPre.Height() )
+          LogicError("C must have the same height as A");
+      if( j < 0 || j > RPre.Width() )
+          LogicError("Invalid column index");
+    )
+    DistMatrixReadWriteProxy<F,F,VC,STAR> QProx( QPre );
+    DistMatrixReadWriteProxy<F,F,STAR,VR> RProx( RPre );
+    auto& Q = QProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = Q.Grid();
+    const Int m = R.Height();
+    const Int n = R.Width();
+    const Int k = C.Width();
+
+    // The (small) new columns are reduced redundantly
+    DistMatrix<F,STAR,STAR> W(g);
+    {
+        DistMatrix<F> WFull(g);
+        Gemm( ADJOINT, NORMAL, F(1), Q, C, WFull );
+        W = WFull;
+    }
+    vector<Int> rows;
+    vector<Base<F>> cs;
+    vector<F> ss;
+    update::InsertColRotations( W.Matrix(), j, rows, cs, ss );
+    auto RR = R( ALL, IR(j,n) );
+    update::ApplyRotations( rows, cs, ss, Q.Matrix(), RR.Matrix() );
+
+    DistMatrix<F,STAR,VR> RNew(g);
+    RNew.Resize( m, n+k );
+    auto RNewL = RNew( ALL, IR(0,j) );
+    auto RNewM = RNew( ALL, IR(j,j+k) );
+    auto RNewR = RNew( ALL, IR(j+k,n+k) );
+    RNewL = R( ALL, IR(0,j) );
+    RNewM = W;
+    RNewR = RR;
+    R = RNew;
+}
+
+// Delete columns [j,j+numCols) of A = Q R
+// ---------------------------------------
+// Removing the columns leaves R with numCols subdiagonals to the right of
+// column j, which are annihilated, column by column, with rotations.
+template<typename F>
+void DeleteCols
+( Matrix<F>& Q,
+  Matrix<F>& R,
+  Int j,
+  Int numCols )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( Q.Height() != Q.Width() || Q.Height() != R.Height() )
+          LogicError("Expected a full QR factorization");
+      if( j < 0 || j+numCols > R.Width() )
+          LogicError("Invalid column range");
+    )
+    const Int m = R.Height();
+    const Int n = R.Width();
+    const Int nNew = n - numCols;
+
+    Matrix<F> RNew;
+    RNew.Resize( m, nNew );
+    auto RNewL = RNew( ALL, IR(0,j) );
+    auto RNewR = RNew( ALL, IR(j,nNew) );
+    RNewL = R( ALL, IR(0,j) );
+    RNewR = R( ALL, IR(j+numCols,n) );
+    R = RNew;
+
+    vector<Int> rows;
+    vector<Base<F>> cs;
+    vector<F> ss;
+    const Int lastCol = Min(nNew,m-1);
+    for( Int c=j; c<lastCol; ++c )
+    {
+        auto r = R( ALL, IR(c) );
+        update::DeleteColRotations( r, c, numCols, rows, cs, ss );
+        auto RR = R( ALL, IR(c+1,nNew) );
+        update::ApplyRotations( rows, cs, ss, Q, RR );
+    }
+}
+
+template<typename F>
+void DeleteCols
+( ElementalMatrix<F>& QPre,
+  ElementalMatrix<F>& RPre,
+  Int j,
+  Int numCols )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      AssertSameGrids( QPre, RPre );
+      if( QPre.Height() != QPre.Width() || QPre.Height() != RPre.Height() )
+          LogicError("Expected a full QR factorization");
+      if( j < 0 || j+numCols > RPre.Width() )
+          LogicError("Invalid column range");
+    )
+    typedef Base<F> Real;
+    DistMatrixReadWriteProxy<F,F,VC,STAR> QProx( QPre );
+    DistMatrixReadWriteProxy<F,F,STAR,VR> RProx( RPre );
+    auto& Q = QProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = Q.Grid();
+    const Int m = R.Height();
+    const Int n = R.Width();
+    const Int nNew = n - numCols;
+
+    DistMatrix<F,STAR,VR> RNew(g);
+    RNew.Resize( m, nNew );
+    auto RNewL = RNew( ALL, IR(0,j) );
+    auto RNewR = RNew( ALL, IR(j,nNew) );
+    RNewL = R( ALL, IR(0,j) );
+    RNewR = R( ALL, IR(j+numCols,n) );
+    R = RNew;
+
+    // The rotations for each column are computed by its owner and broadcast
+    // within the [STAR,VR] communicator
+    auto& RLoc = R.Matrix();
+    vector<Int> rows;
+    vector<Real> cs;
+    vector<F> ss, buf;
+    const Int lastCol = Min(nNew,m-1);
+    for( Int c=j; c<lastCol; ++c )
+    {
+        const Int numRot = Min(c+numCols,m-1) - c;
+        FastResize( buf, 2*numRot );
+        const int owner = R.ColOwner(c);
+        if( R.IsLocalCol(c) )
+        {
+            auto r = RLoc( ALL, IR(R.LocalCol(c)) );
+            update::DeleteColRotations( r, c, numCols, rows, cs, ss );
+            for( Int rot=0; rot<numRot; ++rot )
+            {
+                buf[2*rot] = cs[rot];
+                buf[2*rot+1] = ss[rot];
+            }
+        }
+        mpi::Broadcast( buf.data(), 2*numRot, owner, R.RowComm() );
+        rows.resize( numRot );
+        cs.resize( numRot );
+        ss.resize( numRot );
+        for( Int rot=0; rot<numRot; ++rot )
+        {
+            rows[rot] = c+numRot-rot;
+            cs[rot] = RealPart(buf[2*rot]);
+            ss[rot] = buf[2*rot+1];
+        }
+        auto RR = RLoc( ALL, IR(R.LocalColOffset(c+1),END) );
+        update::ApplyRotations( rows, cs, ss, Q.Matrix(), RR );
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_UPDATE_HPP
@@ -0,0 +1,447 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// See Halko, Martinsson, and Tropp's "Finding structure with randomness:
+// Probabilistic algorithms for constructing approximate matrix
+// decompositions", SIAM Review, Vol. 53, No. 2, pp. 217--288, 2011, and
+// Section 9 of Martinsson and Tropp's "Randomized numerical linear algebra:
+// Foundations & algorithms", Acta Numerica, Vol. 29, pp. 403--572, 2020.
+
+namespace El {
+
+namespace randomized {
+
+// The parameters of the random embeddings are drawn on a single process
+// and broadcast so that each process applies the same embedding
+
+// Returns the n random signs, D, followed by the sketchSize sampled columns
+// of the Walsh-Hadamard matrix of order N >= n
+inline void SRFTParameters
+( Int n, Int N, Int sketchSize, Matrix<Int>& params )
+{
+    DEBUG_CSE
+    params.Resize( n+sketchSize, 1 );
+    for( Int j=0; j<n; ++j )
+        params(j) = ( SampleUniform<Int>(0,2)==0 ? 1 : -1 );
+
+    // Sample without replacement via a partial Fisher-Yates shuffle
+    vector<Int> perm(N);
+    for( Int j=0; j<N; ++j )
+        perm[j] = j;
+    for( Int k=0; k<sketchSize; ++k )
+    {
+        const Int r = SampleUniform<Int>(k,N);
+        std::swap( perm[k], perm[r] );
+        params(n+k) = perm[k];
+    }
+}
+
+// Column j of 'params' contains the sketch columns of the nonzeros of row j
+// of the embedding followed by their signs
+inline void SparseSignParameters
+( Int n, Int sketchSize, Int sparsity, Matrix<Int>& params )
+{
+    DEBUG_CSE
+    params.Resize( 2*sparsity, n );
+    vector<Int> perm(sketchSize);
+    for( Int k=0; k<sketchSize; ++k )
+        perm[k] = k;
+    for( Int j=0; j<n; ++j )
+    {
+        // A partial Fisher-Yates shuffle of a persistent permutation yields
+        // a uniformly-sampled set of distinct columns in O(sparsity) work
+        for( Int t=0; t<sparsity; ++t )
+        {
+            const Int r = SampleUniform<Int>(t,sketchSize);
+            std::swap( perm[t], perm[r] );
+            params(t,j) = perm[t];
+            params(sparsity+t,j) = ( SampleUniform<Int>(0,2)==0 ? 1 : -1 );
+        }
+    }
+}
+
+inline Int HadamardOrder( Int n )
+{
+    Int N = 1;
+    while( N < n )
+        N *= 2;
+    return N;
+}
+
+// Apply an (unnormalized) fast Walsh-Hadamard transform to each row of T,
+// whose width must be a power of two
+template<typename F>
+void WalshHadamardRows( Matrix<F>& T )
+{
+    DEBUG_CSE
+    const Int m = T.Height();
+    const Int N = T.Width();
+    for( Int h=1; h<N; h*=2 )
+    {
+        for( Int jBeg=0; jBeg<N; jBeg+=2*h )
+        {
+            for( Int j=jBeg; j<jBeg+h; ++j )
+            {
+                F* a = T.Buffer(0,j);
+                F* b = T.Buffer(0,j+h);
+                for( Int i=0; i<m; ++i )
+                {
+                    const F alpha = a[i];
+                    const F beta = b[i];
+                    a[i] = alpha + beta;
+                    b[i] = alpha - beta;
+                }
+            }
+        }
+    }
+}
+
+// Y := A D H S / sqrt(sketchSize), where Y must already be sized
+template<typename F>
+void LocalSRFT
+( const Matrix<F>& A, const Matrix<Int>& params, Matrix<F>& Y )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int sketchSize = Y.Width();
+    const Int N = HadamardOrder( n );
+
+    Matrix<F> T;
+    Zeros( T, m, N );
+    for( Int j=0; j<n; ++j )
+    {
+        const F delta = F(params(j));
+        const F* a = A.LockedBuffer(0,j);
+        F* t = T.Buffer(0,j);
+        for( Int i=0; i<m; ++i )
+            t[i] = delta*a[i];
+    }
+    WalshHadamardRows( T );
+
+    const F scale = F(1) / Sqrt(Real(sketchSize));
+    for( Int k=0; k<sketchSize; ++k )
+    {
+        const F* t = T.LockedBuffer(0,params(n+k));
+        F* y = Y.Buffer(0,k);
+        for( Int i=0; i<m; ++i )
+            y[i] = scale*t[i];
+    }
+}
+
+// Y := Y + A(:,localCols) Omega(globalCols,:), where Omega is the sparse sign
+// embedding described by 'params'
+template<typename F,class ColMap>
+void LocalSparseSign
+( const Matrix<F>& A,
+  const ColMap& globalCol,
+  const Matrix<Int>& params,
+        Matrix<F>& Y )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int nLoc = A.Width();
+    const Int sparsity = params.Height() / 2;
+    const Real scale = Real(1) / Sqrt(Real(sparsity));
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+    {
+        const Int j = globalCol( jLoc );
+        for( Int t=0; t<sparsity; ++t )
+        {
+            const F alpha = F(scale*params(sparsity+t,j));
+            blas::Axpy
+            ( m, alpha, A.LockedBuffer(0,jLoc), 1,
+                        Y.Buffer(0,params(t,j)), 1 );
+        }
+    }
+}
+
+} // namespace randomized
+
+template<typename F>
+void Sketch
+( const Matrix<F>& A,
+        Matrix<F>& Y,
+        Int sketchSize,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( ctrl.sketch == GAUSSIAN_SKETCH )
+    {
+        Matrix<F> Omega;
+        Gaussian( Omega, n, sketchSize );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Y );
+    }
+    else if( ctrl.sketch == SRFT_SKETCH )
+    {
+        Matrix<Int> params;
+        randomized::SRFTParameters
+        ( n, randomized::HadamardOrder(n), sketchSize, params );
+        Y.Resize( m, sketchSize );
+        randomized::LocalSRFT( A, params, Y );
+    }
+    else if( ctrl.sketch == FOURIER_SKETCH || ctrl.sketch == COUNT_SKETCH )
+    {
+        // Y := A Omega = (S A^T)^T, where S := Omega^T is applied as a
+        // structured sketching operator
+        const SketchOperator S =
+          MakeSketch( ctrl.sketch, sketchSize, n, ctrl.sparsity );
+        Matrix<F> AT, YT;
+        Transpose( A, AT );
+        sketch::Apply( AT, S, YT );
+        Transpose( YT, Y );
+    }
+    else
+    {
+        const Int sparsity = Min( ctrl.sparsity, sketchSize );
+        Matrix<Int> params;
+        randomized::SparseSignParameters( n, sketchSize, sparsity, params );
+        Zeros( Y, m, sketchSize );
+        randomized::LocalSparseSign
+        ( A, []( Int jLoc ) { return jLoc; }, params, Y );
+    }
+}
+
+template<typename F>
+void Sketch
+( const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& Y,
+        Int sketchSize,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Grid& g = APre.Grid();
+    if( ctrl.sketch == GAUSSIAN_SKETCH )
+    {
+        DistMatrix<F> Omega(g);
+        Gaussian( Omega, n, sketchSize );
+        Gemm( NORMAL, NORMAL, F(1), APre, Omega, Y );
+    }
+    else if( ctrl.sketch == SRFT_SKETCH )
+    {
+        // Each process owns entire rows of A in a [VC,STAR] distribution, so
+        // the transform is applied without further communication
+        Matrix<Int> params;
+        if( g.Rank() == 0 )
+            randomized::SRFTParameters
+            ( n, randomized::HadamardOrder(n), sketchSize, params );
+        else
+            params.Resize( n+sketchSize, 1 );
+        Broadcast( params, g.Comm(), 0 );
+
+        DistMatrix<F,VC,STAR> A_VC_STAR( APre );
+        DistMatrix<F,VC,STAR> Y_VC_STAR(g);
+        Y_VC_STAR.AlignWith( A_VC_STAR );
+        Y_VC_STAR.Resize( m, sketchSize );
+        randomized::LocalSRFT
+        ( A_VC_STAR.LockedMatrix(), params, Y_VC_STAR.Matrix() );
+        Copy( Y_VC_STAR, Y );
+    }
+    else if( ctrl.sketch == FOURIER_SKETCH || ctrl.sketch == COUNT_SKETCH )
+    {
+        const SketchOperator S =
+          MakeSketch( ctrl.sketch, sketchSize, n, g, ctrl.sparsity );
+        DistMatrix<F> AT(g), YT(g);
+        Transpose( APre, AT );
+        sketch::Apply( AT, S, YT );
+        Transpose( YT, Y );
+    }
+    else
+    {
+        // Each process scatters its local columns of A into a partial sketch
+        // which is then summed within each process row
+        const Int sparsity = Min( ctrl.sparsity, sketchSize );
+        Matrix<Int> params;
+        if( g.Rank() == 0 )
+            randomized::SparseSignParameters( n, sketchSize, sparsity, params );
+        else
+            params.Resize( 2*sparsity, n );
+        Broadcast( params, g.Comm(), 0 );
+
+        DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+        auto& A = AProx.GetLocked();
+        DistMatrix<F,MC,STAR> Y_MC_STAR(g);
+        Y_MC_STAR.AlignWith( A );
+        Zeros( Y_MC_STAR, m, sketchSize );
+        randomized::LocalSparseSign
+        ( A.LockedMatrix(),
+          [&]( Int jLoc ) { return A.GlobalCol(jLoc); },
+          params, Y_MC_STAR.Matrix() );
+        AllReduce( Y_MC_STAR.Matrix(), A.RowComm() );
+        Copy( Y_MC_STAR, Y );
+    }
+}
+
+template<typename F>
+void RangeFinder
+( const Matrix<F>& A,
+        Matrix<F>& Q,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int sketchSize = Min( rank+ctrl.oversample, Min(m,n) );
+
+    Sketch( A, Q, sketchSize, ctrl );
+    qr::ExplicitUnitary( Q );
+
+    Matrix<F> W;
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        if( ctrl.progress )
+            Output("Power iteration ",it);
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, W );
+        qr::ExplicitUnitary( W );
+        Gemm( NORMAL, NORMAL, F(1), A, W, Q );
+        qr::ExplicitUnitary( Q );
+    }
+}
+
+template<typename F>
+void RangeFinder
+( const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& QPre,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& A = AProx.GetLocked();
+    auto& Q = QProx.Get();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int sketchSize = Min( rank+ctrl.oversample, Min(m,n) );
+
+    Sketch( A, Q, sketchSize, ctrl );
+    qr::ExplicitUnitary( Q );
+
+    DistMatrix<F> W(g);
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("Power iteration ",it);
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, W );
+        qr::ExplicitUnitary( W );
+        Gemm( NORMAL, NORMAL, F(1), A, W, Q );
+        qr::ExplicitUnitary( Q );
+    }
+}
+
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+
+    Matrix<F> Q;
+    RangeFinder( A, Q, rank, ctrl );
+
+    // Compute the SVD of the small matrix B := Q^H A
+    Matrix<F> B, UB, VB;
+    Matrix<Real> sB;
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+    SVD( B, UB, sB, VB );
+
+    const Int r = Min( rank, sB.Height() );
+    Gemm( NORMAL, NORMAL, F(1), Q, UB(ALL,IR(0,r)), U );
+    s = sB( IR(0,r), ALL );
+    V = VB( ALL, IR(0,r) );
+}
+
+template<typename F>
+void RandomizedSVD
+( const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& U,
+        ElementalMatrix<Base<F>>& s,
+        ElementalMatrix<F>& V,
+        Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<F> Q(g);
+    RangeFinder( A, Q, rank, ctrl );
+
+    // Compute the SVD of the small matrix B := Q^H A
+    DistMatrix<F> B(g), UB(g), VB(g);
+    DistMatrix<Real,VR,STAR> sB(g);
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+    SVD( B, UB, sB, VB );
+
+    const Int r = Min( rank, sB.Height() );
+    Gemm( NORMAL, NORMAL, F(1), Q, UB(ALL,IR(0,r)), U );
+    Copy( sB( IR(0,r), ALL ), s );
+    Copy( VB( ALL, IR(0,r) ), V );
+}
+
+#define PROTO(F) \
+  template void Sketch \
+  ( const Matrix<F>& A, \
+          Matrix<F>& Y, \
+          Int sketchSize, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void Sketch \
+  ( const ElementalMatrix<F>& A, \
+          ElementalMatrix<F>& Y, \
+          Int sketchSize, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RangeFinder \
+  ( const Matrix<F>& A, \
+          Matrix<F>& Q, \
+          Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RangeFinder \
+  ( const ElementalMatrix<F>& A, \
+          ElementalMatrix<F>& Q, \
+          Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSVD \
+  ( const Matrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+          Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSVD \
+  ( const ElementalMatrix<F>& A, \
+          ElementalMatrix<F>& U, \
+          ElementalMatrix<Base<F>>& s, \
+          ElementalMatrix<F>& V, \
+          Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
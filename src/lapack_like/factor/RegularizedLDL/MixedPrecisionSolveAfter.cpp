@@ -0,0 +1,322 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace reg_ldl {
+
+namespace mixed_precision {
+
+// Precondition FGMRES (or LGMRES) on A with iterative refinement of the
+// regularized matrix, A + diag(reg), where each refinement step applies the
+// demoted-precision factorization through 'applyAInv'
+template<typename Real,class ApplyAType,class ApplyRegAType,
+         class ApplyAInvType,class MatrixType>
+Int Solve
+( const ApplyAType& applyA,
+  const ApplyRegAType& applyRegA,
+  const ApplyAInvType& applyAInv,
+        MatrixType& B,
+  const RegSolveCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    auto precond =
+      [&]( MatrixType& W )
+      {
+        RefinedSolve
+        ( applyRegA, applyAInv, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+} // namespace mixed_precision
+
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto applyRegA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    Matrix<FLow> YLow;
+    auto applyAInv =
+      [&]( Matrix<F>& Y )
+      {
+        Copy( Y, YLow );
+        ldl::MatrixNode<FLow> YNodal( invMap, info, YLow );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, YLow );
+        Copy( YLow, Y );
+      };
+
+    return mixed_precision::Solve( applyA, applyRegA, applyAInv, B, ctrl );
+}
+
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto applyRegA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    // The diagonal scalings are applied in the original precision so that
+    // only the triangular solves are performed in the demoted precision
+    Matrix<FLow> YLow;
+    auto applyAInv =
+      [&]( Matrix<F>& Y )
+      {
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+        Copy( Y, YLow );
+        ldl::MatrixNode<FLow> YNodal( invMap, info, YLow );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, YLow );
+        Copy( YLow, Y );
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+      };
+
+    return mixed_precision::Solve( applyA, applyRegA, applyAInv, B, ctrl );
+}
+
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto applyRegA =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    DistMultiVec<FLow> YLow(B.Comm());
+    auto applyAInv =
+      [&]( DistMultiVec<F>& Y )
+      {
+        // TODO: Switch to DistMatrixNode with large numbers of RHS
+        Copy( Y, YLow );
+        ldl::DistMultiVecNode<FLow> YNodal;
+        YNodal.Pull( invMap, info, YLow, meta );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, YLow, meta );
+        Copy( YLow, Y );
+      };
+
+    return mixed_precision::Solve( applyA, applyRegA, applyAInv, B, ctrl );
+}
+
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    ldl::DistMultiVecNodeMeta meta;
+    return MixedPrecisionSolveAfter
+           ( A, reg, invMap, info, front, B, meta, ctrl );
+}
+
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto applyRegA =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    DistMultiVec<FLow> YLow(B.Comm());
+    auto applyAInv =
+      [&]( DistMultiVec<F>& Y )
+      {
+        // TODO: Switch to DistMatrixNode with large numbers of RHS
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+        Copy( Y, YLow );
+        ldl::DistMultiVecNode<FLow> YNodal;
+        YNodal.Pull( invMap, info, YLow, meta );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, YLow, meta );
+        Copy( YLow, Y );
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+      };
+
+    return mixed_precision::Solve( applyA, applyRegA, applyAInv, B, ctrl );
+}
+
+template<typename F>
+Int MixedPrecisionSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    ldl::DistMultiVecNodeMeta meta;
+    return MixedPrecisionSolveAfter
+           ( A, reg, d, invMap, info, front, B, meta, ctrl );
+}
+
+#define PROTO(F) \
+  template Int MixedPrecisionSolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<Demote<F>>& front, \
+          Matrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedPrecisionSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedPrecisionSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+          ldl::DistMultiVecNodeMeta& meta, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedPrecisionSolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const Matrix<Base<F>>& d, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<Demote<F>>& front, \
+          Matrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedPrecisionSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMultiVec<Base<F>>& d, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedPrecisionSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMultiVec<Base<F>>& d, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+          ldl::DistMultiVecNodeMeta& meta, \
+    const RegSolveCtrl<Base<F>>& ctrl );
+
+// Only instantiate the precisions with a distinct demotion
+#define EL_NO_INT_PROTO
+#define EL_NO_FLOAT_PROTO
+#define EL_NO_COMPLEX_FLOAT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace reg_ldl
+} // namespace El
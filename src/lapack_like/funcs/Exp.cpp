@@ -0,0 +1,465 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// See Nicholas J. Higham's "The scaling and squaring method for the matrix
+// exponential revisited", SIAM J. Matrix Anal. Appl., Vol. 26, No. 4, 2005,
+// and, for the action of the exponential, Roger B. Sidje's "Expokit: A software
+// package for computing matrix exponentials", ACM TOMS, Vol. 24, No. 1, 1998.
+
+namespace El {
+
+namespace matrix_exp {
+
+// The coefficients of the numerators of the degree 3, 5, 7, 9, and 13 Pade
+// approximants of exp (each of which is exactly representable in double)
+inline const vector<double>& PadeCoefficients( Int degree )
+{
+    static const vector<double> b3 = { 120., 60., 12., 1. };
+    static const vector<double> b5 =
+      { 30240., 15120., 3360., 420., 30., 1. };
+    static const vector<double> b7 =
+      { 17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1. };
+    static const vector<double> b9 =
+      { 17643225600., 8821612800., 2075673600., 302702400., 30270240.,
+        2162160., 110880., 3960., 90., 1. };
+    static const vector<double> b13 =
+      { 64764752532480000., 32382376266240000., 7771770303897600.,
+        1187353796428800., 129060195264000., 10559470521600.,
+        670442572800., 33522128640., 1323241920., 40840800., 960960.,
+        16380., 182., 1. };
+    switch( degree )
+    {
+    case 3: return b3;
+    case 5: return b5;
+    case 7: return b7;
+    case 9: return b9;
+    default: return b13;
+    }
+}
+
+// The largest one norms for which the degree 3, 5, 7, 9, and 13 approximants
+// are accurate to double precision. For more precise datatypes, the degree 13
+// threshold is shrunk so that its truncation error, which is proportional to
+// the 27th power of the norm, remains at the level of the unit roundoff.
+template<typename Real>
+Real PadeThreshold( Int degree )
+{
+    switch( degree )
+    {
+    case 3: return Real(1.495585217958292e-2);
+    case 5: return Real(2.539398330063230e-1);
+    case 7: return Real(9.504178996162932e-1);
+    case 9: return Real(2.097847961257068e0);
+    default:
+    {
+        const Real theta13 = Real(5.371920351148152e0);
+        const Real eps = limits::Epsilon<Real>();
+        const Real epsDouble = limits::Epsilon<double>();
+        if( eps >= epsDouble )
+            return theta13;
+        return theta13*Pow(eps/epsDouble,Real(1)/Real(27));
+    }
+    }
+}
+
+// Overwrite A with the diagonal Pade approximant of exp(A) of the given degree
+template<typename F,class MatrixType>
+void Pade( Int degree, MatrixType& A )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const auto& b = PadeCoefficients( degree );
+    auto coef = [&]( Int j ) { return F(Real(b[j])); };
+
+    MatrixType A2(A), U(A), V(A), T(A);
+    Gemm( NORMAL, NORMAL, F(1), A, A, A2 );
+    if( degree == 13 )
+    {
+        MatrixType A4(A), A6(A);
+        Gemm( NORMAL, NORMAL, F(1), A2, A2, A4 );
+        Gemm( NORMAL, NORMAL, F(1), A4, A2, A6 );
+
+        // U := A (A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I)
+        T = A6;
+        T *= coef(13);
+        Axpy( coef(11), A4, T );
+        Axpy( coef(9), A2, T );
+        V = A6;
+        V *= coef(7);
+        Axpy( coef(5), A4, V );
+        Axpy( coef(3), A2, V );
+        ShiftDiagonal( V, coef(1) );
+        Gemm( NORMAL, NORMAL, F(1), A6, T, F(1), V );
+        Gemm( NORMAL, NORMAL, F(1), A, V, U );
+
+        // V := A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I
+        T = A6;
+        T *= coef(12);
+        Axpy( coef(10), A4, T );
+        Axpy( coef(8), A2, T );
+        V = A6;
+        V *= coef(6);
+        Axpy( coef(4), A4, V );
+        Axpy( coef(2), A2, V );
+        ShiftDiagonal( V, coef(0) );
+        Gemm( NORMAL, NORMAL, F(1), A6, T, F(1), V );
+    }
+    else
+    {
+        // Accumulate the odd (into T) and even (into V) terms using the
+        // even powers A^2, A^4, ..., A^(degree-1)
+        MatrixType P(A2), PNew(A2);
+        T = A2;
+        T *= coef(3);
+        ShiftDiagonal( T, coef(1) );
+        V = A2;
+        V *= coef(2);
+        ShiftDiagonal( V, coef(0) );
+        for( Int j=4; j<degree; j+=2 )
+        {
+            Gemm( NORMAL, NORMAL, F(1), P, A2, PNew );
+            P = PNew;
+            Axpy( coef(j+1), P, T );
+            Axpy( coef(j), P, V );
+        }
+        Gemm( NORMAL, NORMAL, F(1), A, T, U );
+    }
+
+    // Solve (V - U) X = (V + U)
+    T = V;
+    T -= U;
+    V += U;
+    LinearSolve( T, V );
+    A = V;
+}
+
+template<typename F,class MatrixType>
+void ScalingAndSquaring( MatrixType& A )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real oneNorm = OneNorm( A );
+    if( limits::Epsilon<Real>() >= limits::Epsilon<double>() )
+    {
+        for( Int degree : { 3, 5, 7, 9 } )
+        {
+            if( oneNorm <= PadeThreshold<Real>(degree) )
+            {
+                Pade<F>( degree, A );
+                return;
+            }
+        }
+    }
+
+    const Real theta = PadeThreshold<Real>( 13 );
+    Int numSquarings = 0;
+    if( oneNorm > theta )
+    {
+        numSquarings = Int(Ceil(Log2(oneNorm/theta)));
+        A *= F(Real(1)/Pow(Real(2),Real(numSquarings)));
+    }
+    Pade<F>( 13, A );
+    MatrixType T(A);
+    for( Int squaring=0; squaring<numSquarings; ++squaring )
+    {
+        Gemm( NORMAL, NORMAL, F(1), A, A, T );
+        A = T;
+    }
+}
+
+// Given the (m+1)s x ms block upper Hessenberg matrix H from a block Arnoldi
+// process with numBlocks=m blocks of width s, form Y := exp(tau H_m) E_1 R0,
+// where H_m is the leading ms x ms submatrix, and return the estimate
+// || H(m,m-1) Y_{m-1} ||_F / || R0 ||_F of the relative error of V_m Y
+template<typename F>
+Base<F> ProjectedExp
+( const F& tau,
+  const Matrix<F>& H,
+  const Matrix<F>& R0,
+  Int numBlocks,
+  bool breakdown,
+  Matrix<F>& Y )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int s = R0.Width();
+    const Int k = numBlocks*s;
+    Matrix<F> E( H(IR(0,k),IR(0,k)) );
+    E *= tau;
+    ScalingAndSquaring<F>( E );
+    Gemm( NORMAL, NORMAL, F(1), E(ALL,IR(0,s)), R0, Y );
+    if( breakdown )
+        return Real(0);
+
+    Matrix<F> Z;
+    Gemm
+    ( NORMAL, NORMAL, F(1),
+      H(IR(k,k+s),IR(k-s,k)), Y(IR(k-s,k),ALL), Z );
+    const Real R0Frob = FrobeniusNorm( R0 );
+    return ( R0Frob == Real(0) ? Real(0) : FrobeniusNorm(Z)/R0Frob );
+}
+
+template<typename Real>
+Real Tolerance( const ExpMultiplyCtrl<Real>& ctrl )
+{
+    if( ctrl.tol == Real(0) )
+        return Sqrt(limits::Epsilon<Real>());
+    return ctrl.tol;
+}
+
+} // namespace matrix_exp
+
+template<typename F>
+void Exp( Matrix<F>& A )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    matrix_exp::ScalingAndSquaring<F>( A );
+}
+
+template<typename F>
+void Exp( ElementalMatrix<F>& APre )
+{
+    DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    matrix_exp::ScalingAndSquaring<F>( A );
+}
+
+template<typename F>
+ExpMultiplyInfo<Base<F>>
+ExpMultiply
+( F t,
+  const Matrix<F>& A,
+        Matrix<F>& B,
+  const ExpMultiplyCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int s = B.Width();
+    if( A.Width() != n || B.Height() != n )
+        LogicError("A must be square and B must have its height");
+    ExpMultiplyInfo<Real> info;
+    const Real tNormA = Abs(t)*OneNorm(A);
+    if( n == 0 || s == 0 || tNormA == Real(0) )
+        return info;
+    const Real tol = matrix_exp::Tolerance( ctrl );
+    const Real breakdownTol = limits::Epsilon<Real>()*OneNorm(A);
+    const Int maxBlocks = Max( Min( ctrl.basisSize, n/s ), Int(1) );
+
+    Matrix<F> V, H, W, C, R0, R, Y;
+    Real timeLeft = 1;
+    Real step = Min( Real(1), Real(maxBlocks)/tNormA );
+    while( timeLeft > Real(0) )
+    {
+        if( info.numSteps+info.numRejections >= ctrl.maxSteps )
+            RuntimeError("ExpMultiply exceeded ",ctrl.maxSteps," steps");
+
+        // Build a block Krylov basis starting from the current B
+        Zeros( V, n, (maxBlocks+1)*s );
+        Zeros( H, (maxBlocks+1)*s, maxBlocks*s );
+        W = B;
+        qr::Explicit( W, R0 );
+        auto V0 = V( ALL, IR(0,s) );
+        V0 = W;
+        Int numBlocks = maxBlocks;
+        bool breakdown = false;
+        for( Int j=0; j<maxBlocks; ++j )
+        {
+            const Int orthogBeg = ( ctrl.hermitian ? Max(j-1,Int(0))*s : 0 );
+            auto VOrthog = V( ALL, IR(orthogBeg,(j+1)*s) );
+            Gemm( NORMAL, NORMAL, F(1), A, V(ALL,IR(j*s,(j+1)*s)), W );
+
+            // Two passes of block classical Gram-Schmidt
+            auto HProj = H( IR(orthogBeg,(j+1)*s), IR(j*s,(j+1)*s) );
+            for( Int pass=0; pass<2; ++pass )
+            {
+                Gemm( ADJOINT, NORMAL, F(1), VOrthog, W, C );
+                Gemm( NORMAL, NORMAL, F(-1), VOrthog, C, F(1), W );
+                HProj += C;
+            }
+            qr::Explicit( W, R );
+            auto HSub = H( IR((j+1)*s,(j+2)*s), IR(j*s,(j+1)*s) );
+            HSub = R;
+            auto VNext = V( ALL, IR((j+1)*s,(j+2)*s) );
+            VNext = W;
+            if( FrobeniusNorm(R) <= breakdownTol )
+            {
+                numBlocks = j+1;
+                breakdown = true;
+                break;
+            }
+        }
+
+        // Shrink the step until the error estimate is acceptable
+        step = Min( step, timeLeft );
+        while( true )
+        {
+            info.errorEst =
+              matrix_exp::ProjectedExp
+              ( F(step)*t, H, R0, numBlocks, breakdown, Y );
+            if( info.errorEst <= tol*step )
+                break;
+            step /= 2;
+            ++info.numRejections;
+            if( info.numSteps+info.numRejections >= ctrl.maxSteps )
+                RuntimeError("ExpMultiply exceeded ",ctrl.maxSteps," steps");
+        }
+        Gemm( NORMAL, NORMAL, F(1), V(ALL,IR(0,numBlocks*s)), Y, B );
+        timeLeft -= step;
+        ++info.numSteps;
+        if( ctrl.progress )
+            Output
+            ("Step ",info.numSteps," of length ",step,": error estimate ",
+             info.errorEst,", ",timeLeft," remaining");
+        if( info.errorEst < tol*step/4 )
+            step *= 2;
+    }
+    return info;
+}
+
+template<typename F>
+ExpMultiplyInfo<Base<F>>
+ExpMultiply
+( F t,
+  const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& BPre,
+  const ExpMultiplyCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, BPre ))
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+    const Int s = BPre.Width();
+    if( APre.Width() != n || BPre.Height() != n )
+        LogicError("A must be square and B must have its height");
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    // The Krylov bases are kept in a [VC,STAR] distribution so that their
+    // projections only require local Gemms and an AllReduce
+    DistMatrixReadWriteProxy<F,F,VC,STAR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    ExpMultiplyInfo<Real> info;
+    const Real tNormA = Abs(t)*OneNorm(A);
+    if( n == 0 || s == 0 || tNormA == Real(0) )
+        return info;
+    const Real tol = matrix_exp::Tolerance( ctrl );
+    const Real breakdownTol = limits::Epsilon<Real>()*OneNorm(A);
+    const Int maxBlocks = Max( Min( ctrl.basisSize, n/s ), Int(1) );
+
+    DistMatrix<F,VC,STAR> V(g), W(g);
+    DistMatrix<F> AV(g);
+    DistMatrix<F,STAR,STAR> R0(g), R(g), C(g), Y(g);
+    Matrix<F> H;
+    Real timeLeft = 1;
+    Real step = Min( Real(1), Real(maxBlocks)/tNormA );
+    while( timeLeft > Real(0) )
+    {
+        if( info.numSteps+info.numRejections >= ctrl.maxSteps )
+            RuntimeError("ExpMultiply exceeded ",ctrl.maxSteps," steps");
+
+        // Build a block Krylov basis starting from the current B
+        Zeros( V, n, (maxBlocks+1)*s );
+        Zeros( H, (maxBlocks+1)*s, maxBlocks*s );
+        W = B;
+        qr::Explicit( W, R0 );
+        auto V0 = V( ALL, IR(0,s) );
+        V0 = W;
+        Int numBlocks = maxBlocks;
+        bool breakdown = false;
+        for( Int j=0; j<maxBlocks; ++j )
+        {
+            const Int orthogBeg = ( ctrl.hermitian ? Max(j-1,Int(0))*s : 0 );
+            auto VOrthog = V( ALL, IR(orthogBeg,(j+1)*s) );
+            Gemm( NORMAL, NORMAL, F(1), A, V(ALL,IR(j*s,(j+1)*s)), AV );
+            W = AV;
+
+            // Two passes of block classical Gram-Schmidt
+            auto HProj = H( IR(orthogBeg,(j+1)*s), IR(j*s,(j+1)*s) );
+            for( Int pass=0; pass<2; ++pass )
+            {
+                LocalGemm( ADJOINT, NORMAL, F(1), VOrthog, W, C );
+                El::AllReduce( C, g.VCComm() );
+                LocalGemm( NORMAL, NORMAL, F(-1), VOrthog, C, F(1), W );
+                HProj += C.Matrix();
+            }
+            qr::Explicit( W, R );
+            auto HSub = H( IR((j+1)*s,(j+2)*s), IR(j*s,(j+1)*s) );
+            HSub = R.Matrix();
+            auto VNext = V( ALL, IR((j+1)*s,(j+2)*s) );
+            VNext = W;
+            if( FrobeniusNorm(R.Matrix()) <= breakdownTol )
+            {
+                numBlocks = j+1;
+                breakdown = true;
+                break;
+            }
+        }
+
+        // Shrink the step until the error estimate is acceptable (every
+        // process redundantly holds the same projected matrix)
+        step = Min( step, timeLeft );
+        Y.Resize( numBlocks*s, s );
+        while( true )
+        {
+            info.errorEst =
+              matrix_exp::ProjectedExp
+              ( F(step)*t, H, R0.Matrix(), numBlocks, breakdown, Y.Matrix() );
+            if( info.errorEst <= tol*step )
+                break;
+            step /= 2;
+            ++info.numRejections;
+            if( info.numSteps+info.numRejections >= ctrl.maxSteps )
+                RuntimeError("ExpMultiply exceeded ",ctrl.maxSteps," steps");
+        }
+        LocalGemm
+        ( NORMAL, NORMAL, F(1), V(ALL,IR(0,numBlocks*s)), Y, F(0), B );
+        timeLeft -= step;
+        ++info.numSteps;
+        if( ctrl.progress && g.Rank() == 0 )
+            Output
+            ("Step ",info.numSteps," of length ",step,": error estimate ",
+             info.errorEst,", ",timeLeft," remaining");
+        if( info.errorEst < tol*step/4 )
+            step *= 2;
+    }
+    return info;
+}
+
+#define PROTO(F) \
+  template void Exp( Matrix<F>& A ); \
+  template void Exp( ElementalMatrix<F>& A ); \
+  template ExpMultiplyInfo<Base<F>> ExpMultiply \
+  ( F t, \
+    const Matrix<F>& A, \
+          Matrix<F>& B, \
+    const ExpMultiplyCtrl<Base<F>>& ctrl ); \
+  template ExpMultiplyInfo<Base<F>> ExpMultiply \
+  ( F t, \
+    const ElementalMatrix<F>& A, \
+          ElementalMatrix<F>& B, \
+    const ExpMultiplyCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
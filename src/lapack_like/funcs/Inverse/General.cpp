@@ -9,6 +9,7 @@
 #include <El.hpp>
 
 #include "./General/LUPartialPiv.hpp"
+#include "./General/GaussJordan.hpp"
 
 namespace El {
 
@@ -40,7 +41,9 @@ void LocalInverse( DistMatrix<F,STAR,STAR>& A )
   template void inverse::AfterLUPartialPiv \
   ( Matrix<F>& A, const Permutation& P ); \
   template void inverse::AfterLUPartialPiv \
-  ( ElementalMatrix<F>& A, const DistPermutation& P ); 
+  ( ElementalMatrix<F>& A, const DistPermutation& P ); \
+  template void inverse::GaussJordan( Matrix<F>& A ); \
+  template void inverse::GaussJordan( ElementalMatrix<F>& A );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
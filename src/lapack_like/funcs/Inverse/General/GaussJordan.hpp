@@ -0,0 +1,258 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_INVERSE_GAUSSJORDAN_HPP
+#define EL_INVERSE_GAUSSJORDAN_HPP
+
+namespace El {
+namespace inverse {
+
+// Blocked, in-place Gauss-Jordan elimination with partial pivoting.
+//
+// After the rows of A have been permuted by the pivots of the current panel
+// of columns, say 1, the block elimination step is
+//
+//   | A00 A01 A02 |    | A00 + A01' A10  A01'  A02 + A01' A12 |
+//   | A10 A11 A12 | := | inv(A11) A10    A11'  inv(A11) A12   |,
+//   | A20 A21 A22 |    | A20 + A21' A10  A21'  A22 + A21' A12 |
+//
+// where A11' = inv(A11) and A01' = -A01 inv(A11) (and similarly for A21')
+// are produced by an unblocked sweep over the panel alone. With X1 equal to
+// the updated panel, except with A11' - I in its middle block, the columns
+// outside of the panel are all updated via
+//
+//   A(:,j) := A(:,j) + X1 A1(:,j),
+//
+// so that only a copy of the panel and of its row block is required. Since
+// the rows were permuted, the result is inv(P A) = inv(A) inv(P).
+
+// Sweep over the n x nb column panel A whose leading diagonal entry lies in
+// row 'offset', storing the absolute pivot row of each column in 'pivots'
+template<typename F>
+void GaussJordanPanel( Matrix<F>& A, Int offset, vector<Int>& pivots )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Int nb = A.Width();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+
+    pivots.resize( nb );
+    vector<F> column( n );
+    for( Int j=0; j<nb; ++j )
+    {
+        const Int k = offset + j;
+        const Int iPiv = k + blas::MaxInd( n-k, &ABuf[k+j*ALDim], 1 );
+        pivots[j] = iPiv;
+        if( iPiv != k )
+            blas::Swap( nb, &ABuf[k], ALDim, &ABuf[iPiv], ALDim );
+
+        const F alpha = ABuf[k+j*ALDim];
+        if( alpha == F(0) )
+            throw SingularMatrixException();
+
+        // Pull out column j so that the rank-one update overwrites it with
+        // -A(i,j)/alpha, and scale the pivot row (with its j'th entry
+        // becoming 1/alpha)
+        for( Int i=0; i<n; ++i )
+        {
+            column[i] = ABuf[i+j*ALDim];
+            ABuf[i+j*ALDim] = 0;
+        }
+        column[k] = 0;
+        ABuf[k+j*ALDim] = 1;
+        blas::Scal( nb, F(1)/alpha, &ABuf[k], ALDim );
+        blas::Geru
+        ( n, nb, F(-1), column.data(), 1, &ABuf[k], ALDim, ABuf, ALDim );
+    }
+}
+
+template<typename F>
+void GaussJordanPanel
+( DistMatrix<F,VC,STAR>& A, Int offset, vector<Int>& pivots )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int nb = A.Width();
+    const Int localHeight = A.LocalHeight();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    mpi::Comm colComm = A.ColComm();
+    mpi::Op maxLocOp = mpi::MaxLocOp<Real>();
+
+    pivots.resize( nb );
+    vector<F> rowBuf( 2*nb ), column( localHeight );
+    for( Int j=0; j<nb; ++j )
+    {
+        const Int k = offset + j;
+
+        // Find the pivot amongst the rows at or below the diagonal
+        const Int iLocBeg = A.LocalRowOffset(k);
+        ValueInt<Real> localPivot;
+        localPivot.value = -1;
+        localPivot.index = -1;
+        for( Int iLoc=iLocBeg; iLoc<localHeight; ++iLoc )
+        {
+            const Real absVal = Abs(ABuf[iLoc+j*ALDim]);
+            if( absVal > localPivot.value )
+            {
+                localPivot.value = absVal;
+                localPivot.index = A.GlobalRow(iLoc);
+            }
+        }
+        const auto pivot = mpi::AllReduce( localPivot, maxLocOp, colComm );
+        const Int iPiv = pivot.index;
+        pivots[j] = iPiv;
+
+        // Share the current and pivot rows and then swap them
+        rowBuf.assign( 2*nb, F(0) );
+        F* curRow = &rowBuf[0];
+        F* pivRow = &rowBuf[nb];
+        if( A.IsLocalRow(k) )
+            blas::Copy( nb, &ABuf[A.LocalRow(k)], ALDim, curRow, 1 );
+        if( A.IsLocalRow(iPiv) )
+            blas::Copy( nb, &ABuf[A.LocalRow(iPiv)], ALDim, pivRow, 1 );
+        mpi::AllReduce( rowBuf.data(), 2*nb, colComm );
+        if( A.IsLocalRow(iPiv) )
+            blas::Copy( nb, curRow, 1, &ABuf[A.LocalRow(iPiv)], ALDim );
+
+        const F alpha = pivRow[j];
+        if( alpha == F(0) )
+            throw SingularMatrixException();
+        pivRow[j] = 1;
+        blas::Scal( nb, F(1)/alpha, pivRow, 1 );
+
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            column[iLoc] = ABuf[iLoc+j*ALDim];
+            ABuf[iLoc+j*ALDim] = 0;
+        }
+        blas::Geru
+        ( localHeight, nb,
+          F(-1), column.data(), 1, pivRow, 1, ABuf, ALDim );
+        if( A.IsLocalRow(k) )
+            blas::Copy( nb, pivRow, 1, &ABuf[A.LocalRow(k)], ALDim );
+    }
+}
+
+template<typename F>
+void GaussJordan( Matrix<F>& A )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Cannot invert non-square matrices");
+    const Int n = A.Height();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+
+    Permutation P;
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+
+    Matrix<F> X1, W;
+    vector<Int> pivots;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind0( 0, k ), ind1( k, k+nb ), ind2( k+nb, n );
+
+        auto A1 = A( ALL, ind1 );
+        GaussJordanPanel( A1, k, pivots );
+        for( Int j=0; j<nb; ++j )
+        {
+            const Int iPiv = pivots[j];
+            P.Swap( k+j, iPiv );
+            if( iPiv != k+j )
+            {
+                blas::Swap( k, &ABuf[k+j], ALDim, &ABuf[iPiv], ALDim );
+                blas::Swap
+                ( n-(k+nb),
+                  &ABuf[(k+j)+(k+nb)*ALDim], ALDim,
+                  &ABuf[iPiv +(k+nb)*ALDim], ALDim );
+            }
+        }
+
+        X1 = A1;
+        auto X11 = X1( ind1, ALL );
+        ShiftDiagonal( X11, F(-1) );
+        for( const Range<Int>& indOut : { ind0, ind2 } )
+        {
+            auto AOut = A( ALL, indOut );
+            W = A( ind1, indOut );
+            Gemm( NORMAL, NORMAL, F(1), X1, W, F(1), AOut );
+        }
+    }
+
+    // inv(A) := inv(P A) P
+    P.InversePermuteCols( A );
+}
+
+template<typename F>
+void GaussJordan( ElementalMatrix<F>& APre )
+{
+    DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    if( A.Height() != A.Width() )
+        LogicError("Cannot invert non-square matrices");
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+
+    DistPermutation P(g), PB(g);
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+
+    DistMatrix<F,VC,  STAR> A1_VC_STAR(g);
+    DistMatrix<F,MC,  STAR> X1_MC_STAR(g);
+    DistMatrix<F,STAR,MR  > W_STAR_MR(g);
+    vector<Int> pivots;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind0( 0, k ), ind1( k, k+nb ), ind2( k+nb, n );
+
+        auto A0 = A( ALL, ind0 );
+        auto A1 = A( ALL, ind1 );
+        auto A2 = A( ALL, ind2 );
+
+        A1_VC_STAR = A1;
+        GaussJordanPanel( A1_VC_STAR, k, pivots );
+        PB.MakeIdentity( n );
+        PB.ReserveSwaps( nb );
+        for( Int j=0; j<nb; ++j )
+        {
+            P.Swap( k+j, pivots[j] );
+            PB.Swap( k+j, pivots[j] );
+        }
+        PB.PermuteRows( A0 );
+        PB.PermuteRows( A2 );
+
+        X1_MC_STAR.AlignWith( A );
+        X1_MC_STAR = A1_VC_STAR;
+        A1 = X1_MC_STAR;
+        auto X11 = X1_MC_STAR( ind1, ALL );
+        ShiftDiagonal( X11, F(-1) );
+        for( auto* AOut : { &A0, &A2 } )
+        {
+            W_STAR_MR.AlignWith( *AOut );
+            W_STAR_MR = (*AOut)( ind1, ALL );
+            LocalGemm
+            ( NORMAL, NORMAL, F(1), X1_MC_STAR, W_STAR_MR, F(1), *AOut );
+        }
+    }
+
+    // inv(A) := inv(P A) P
+    P.InversePermuteCols( A );
+}
+
+} // namespace inverse
+} // namespace El
+
+#endif // ifndef EL_INVERSE_GAUSSJORDAN_HPP
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./Sign/Zolotarev.hpp"
+
 // See Chapter 5 of Nicholas J. Higham's "Functions of Matrices: Theory and
 // Computation", which is currently available at:
 // http://www.siam.org/books/ot104/OT104HighamChapter5.pdf
@@ -91,10 +93,10 @@ NewtonSchulzStep
  
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, F(Real(1)/Real(2)), X, XTmp, XNew );
 }
 
 template<typename F>
@@ -110,10 +112,10 @@ NewtonSchulzStep
 
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, F(Real(1)/Real(2)), X, XTmp, XNew );
 }
 
 // Please see Chapter 5 of Higham's 
@@ -197,7 +199,228 @@ Newton( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
+// Run Newton-Schulz iterations, which converge quadratically when
+// || I - X^2 || < 1. Returns false, with X holding the last iterate which
+// satisfied this condition, if the iterates left the region of convergence.
+template<typename F,class MatrixType>
+bool NewtonSchulz
+( MatrixType& A,
+  Int& numIts,
+  const SignCtrl<Base<F>>& ctrl,
+  bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*limits::Epsilon<Real>();
+
+    MatrixType B(A), XTmp(A);
+    MatrixType *X=&A, *XNew=&B;
+    bool converged = false;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate and XTmp with I - X^2
+        NewtonSchulzStep( *X, XTmp, *XNew );
+        ShiftDiagonal( XTmp, F(-2) );
+        const Real oneRes = OneNorm( XTmp );
+        if( oneRes >= Real(1) )
+            break;
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( progress )
+            cout << "after " << numIts << " Newton-Schulz iter's: "
+                 << "oneRes=" << oneRes << ", oneDiff=" << oneDiff
+                 << ", oneNew=" << oneNew << ", oneDiff/oneNew="
+                 << oneDiff/oneNew << ", tol=" << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        {
+            converged = true;
+            break;
+        }
+    }
+    if( X != &A )
+        A = *X;
+    return converged;
+}
+
+// Run Newton iterations until the relative change in the iterates, which is
+// roughly half of || I - X^2 ||_1, suggests that Newton-Schulz will converge
+template<typename F,class MatrixType>
+Int NewtonSchulzHybrid
+( MatrixType& A, const SignCtrl<Base<F>>& ctrl, bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*limits::Epsilon<Real>();
+
+    Int numIts=0;
+    MatrixType B(A);
+    MatrixType *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        NewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( progress )
+            cout << "after " << numIts << " Newton iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( 2*oneDiff/oneNew <= ctrl.newtonSchulzThreshold &&
+            NewtonSchulz<F>( *X, numIts, ctrl, progress ) )
+            break;
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+// Overwrite XNew with Z(X), where Z is the (normalized) Zolotarev function
+// with the given coefficients. Each of the r shifted solves is independent.
+template<typename F,class MatrixType>
+void ZolotarevStep
+( const MatrixType& X,
+        MatrixType& XNew,
+  const vector<Base<F>>& c,
+  const vector<Base<F>>& a )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int r = a.size();
+
+    // XNew := X (I + sum_j a_j inv(X^2 + c_{2j-1} I))
+    MatrixType XSquared(X), T(X), Y(X);
+    Gemm( NORMAL, NORMAL, F(1), X, X, XSquared );
+    XNew = X;
+    for( Int j=0; j<r; ++j )
+    {
+        T = XSquared;
+        ShiftDiagonal( T, F(c[2*j]) );
+        Y = X;
+        LinearSolve( T, Y );
+        Axpy( F(a[j]), Y, XNew );
+    }
+    XNew *= F(Real(1)/ZolotarevMap(Real(1),c));
+}
+
+// Run Zolotarev iterations until the predicted bound on || I - X^2 ||_2
+// falls below the square-root of the unit roundoff and then polish with
+// Newton-Schulz (falling back to Newton if the estimates were misleading)
+template<typename F,class MatrixType>
+Int Zolotarev
+( MatrixType& A,
+  const SignCtrl<Base<F>>& ctrl,
+  Base<F> twoNorm,
+  Base<F> twoNormInv,
+  bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*eps;
+
+    // Scale A so that its spectrum should lie in [-1,-ell] U [ell,1]
+    A *= F(Real(1)/twoNorm);
+    Real ell = Max( Min( Real(1)/(twoNorm*twoNormInv), Real(1) ), eps );
+    const Int r =
+      ( ctrl.zolotarevDegree > 0 ? ctrl.zolotarevDegree
+                                 : ZolotarevDegree(ell) );
+
+    Int numIts=0;
+    MatrixType B(A);
+    MatrixType *X=&A, *XNew=&B;
+    vector<Real> c, a;
+    bool converged = false;
+    while( numIts < ctrl.maxIts && 1-ell*ell > Sqrt(eps) )
+    {
+        ZolotarevCoefficients( ell, r, c, a );
+        ZolotarevStep<F>( *X, *XNew, c, a );
+        ell = ZolotarevUpdate( ell, c );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( progress )
+            cout << "after " << numIts << " Zolotarev iter's (r=" << r
+                 << "): ell=" << ell << ", oneDiff=" << oneDiff
+                 << ", oneNew=" << oneNew << ", oneDiff/oneNew="
+                 << oneDiff/oneNew << ", tol=" << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        {
+            converged = true;
+            break;
+        }
+    }
+    if( X != &A )
+        A = *X;
+    if( !converged && !NewtonSchulz<F>( A, numIts, ctrl, progress ) )
+    {
+        auto ctrlMod( ctrl );
+        ctrlMod.maxIts = ctrl.maxIts - numIts;
+        numIts += NewtonSchulzHybrid<F>( A, ctrlMod, progress );
+    }
+    return numIts;
+}
+
+template<typename F,class MatrixType>
+Int Iterate( MatrixType& A, const SignCtrl<Base<F>>& ctrl, bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    switch( ctrl.method )
+    {
+    case SIGN_NEWTON:
+        return Newton( A, ctrl );
+    case SIGN_NEWTON_SCHULZ:
+        return NewtonSchulzHybrid<F>( A, ctrl, progress );
+    case SIGN_ZOLOTAREV:
+    case SIGN_AUTO:
+    {
+        if( ctrl.method == SIGN_AUTO && !ctrl.realSpectrum )
+            return NewtonSchulzHybrid<F>( A, ctrl, progress );
+        Real twoNorm, twoNormInv;
+        TwoNormEstimates<F>( A, twoNorm, twoNormInv );
+        if( progress )
+            cout << "||A||_2 ~= " << twoNorm << ", ||inv(A)||_2 ~= "
+                 << twoNormInv << endl;
+        if( ctrl.method == SIGN_AUTO &&
+            twoNorm*twoNormInv < ctrl.zolotarevCondition )
+            return NewtonSchulzHybrid<F>( A, ctrl, progress );
+        return Zolotarev<F>( A, ctrl, twoNorm, twoNormInv, progress );
+    }
+    default:
+        LogicError("Invalid SignMethod");
+        return 0;
+    }
+}
 
 } // namespace sign
 
@@ -205,7 +428,7 @@ template<typename F>
 void Sign( Matrix<F>& A, const SignCtrl<Base<F>> ctrl )
 {
     DEBUG_CSE
-    sign::Newton( A, ctrl );
+    sign::Iterate<F>( A, ctrl, ctrl.progress );
 }
 
 template<typename F>
@@ -213,7 +436,7 @@ void Sign( Matrix<F>& A, Matrix<F>& N, const SignCtrl<Base<F>> ctrl )
 {
     DEBUG_CSE
     Matrix<F> ACopy( A );
-    sign::Newton( A, ctrl );
+    sign::Iterate<F>( A, ctrl, ctrl.progress );
     Gemm( NORMAL, NORMAL, F(1), A, ACopy, N );
 }
 
@@ -225,7 +448,8 @@ void Sign( ElementalMatrix<F>& APre, const SignCtrl<Base<F>> ctrl )
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    sign::Newton( A, ctrl );
+    const bool progress = ctrl.progress && A.Grid().Rank() == 0;
+    sign::Iterate<F>( A, ctrl, progress );
 }
 
 template<typename F>
@@ -242,7 +466,8 @@ void Sign
     auto& N = NProx.Get();
 
     DistMatrix<F> ACopy( A );
-    sign::Newton( A, ctrl );
+    const bool progress = ctrl.progress && A.Grid().Rank() == 0;
+    sign::Iterate<F>( A, ctrl, progress );
     Gemm( NORMAL, NORMAL, F(1), A, ACopy, N );
 }
 
@@ -0,0 +1,194 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SIGN_ZOLOTAREV_HPP
+#define EL_SIGN_ZOLOTAREV_HPP
+
+// See Yuji Nakatsukasa and Roland W. Freund's "Computing fundamental matrix
+// decompositions accurately via the matrix sign function in two iterations:
+// The power of Zolotarev's functions", SIAM Review, 58(3), 2016.
+//
+// Zolotarev's best rational approximant of type (2r+1,2r) to sign(x) on
+// [-1,-ell] U [ell,1] is
+//
+//     Z(x) = M x prod_{j=1}^r (x^2 + c_{2j}) / (x^2 + c_{2j-1})
+//          = M x (1 + sum_{j=1}^r a_j / (x^2 + c_{2j-1})),
+//
+// with c_i = ell^2 sc^2(i K' / (2r+1); ell'), where sc=sn/cn is a Jacobi
+// elliptic function of modulus ell' = sqrt(1-ell^2) and K' = K(ell') is the
+// complete elliptic integral of the first kind. We choose M so that Z maps
+// [ell,1] onto [Z(ell),1].
+
+namespace El {
+namespace sign {
+
+// Return the arithmetic-geometric mean of alpha and beta
+template<typename Real>
+Real AGM( Real alpha, Real beta )
+{
+    DEBUG_CSE
+    const Real eps = limits::Epsilon<Real>();
+    for( Int it=0; it<100; ++it )
+    {
+        const Real alphaNew = (alpha+beta)/2;
+        beta = Sqrt(alpha*beta);
+        alpha = alphaNew;
+        if( Abs(alpha-beta) <= eps*alpha )
+            break;
+    }
+    return alpha;
+}
+
+// Return ell^2 sc^2(t K'; ell') for t in [0,1).
+//
+// Since ell' is typically extremely close to one, we avoid evaluating cn
+// near its zero by way of Jacobi's imaginary transformation,
+//     sc(u; ell') = -i sn(i u; ell),
+// and evaluate sn(i u; ell) with the descending Landen transformation of
+// Abramowitz and Stegun 16.4. With phi_n = i psi_n, the recurrence
+//     sin(2 phi_{n-1} - phi_n) = (c_n/a_n) sin(phi_n)
+// becomes the real recurrence
+//     psi_{n-1} = (psi_n + asinh((c_n/a_n) sinh(psi_n))) / 2,
+// so that sc(u; ell') = sinh(psi_0). The AGM is continued until the
+// neglected term (c_N/a_N) sinh(psi_N) is negligible, which, unlike for real
+// arguments, requires more than c_N/a_N being below the unit roundoff.
+template<typename Real>
+Real ZolotarevPole( Real t, Real ell )
+{
+    DEBUG_CSE
+    const Real eps = limits::Epsilon<Real>();
+    const Real logEps = Log(eps);
+    const Real ellPrime = Sqrt((1-ell)*(1+ell));
+    const Real KPrime = Pi<Real>()/(2*AGM(Real(1),ell));
+
+    // Run the AGM of 1 and ell', computing c_n = c_{n-1}^2 / (4 a_n) rather
+    // than (a_{n-1}-b_{n-1})/2 in order to avoid cancellation
+    vector<Real> ratios;
+    Real a=1, b=ellPrime, c=ell;
+    Real psiScaled = t*KPrime;
+    for( Int it=0; it<100; ++it )
+    {
+        const Real aNew = (a+b)/2;
+        c = c*c/(4*aNew);
+        b = Sqrt(a*b);
+        a = aNew;
+        psiScaled *= 2;
+        ratios.push_back( c/a );
+        if( c == Real(0) || Log(c/a) + psiScaled*a <= logEps )
+            break;
+    }
+
+    Real psi = psiScaled*a;
+    for( Int n=Int(ratios.size())-1; n>=0; --n )
+    {
+        // For large arguments, asinh(rho sinh(psi)) = psi + log(rho) to
+        // within the unit roundoff, and sinh(psi) might overflow
+        const Real rho = ratios[n];
+        Real shift = 0;
+        if( rho != Real(0) )
+        {
+            const Real logRho = Log(rho);
+            shift =
+              ( psi+logRho > -logEps ? psi+logRho : Asinh(rho*Sinh(psi)) );
+        }
+        psi = (psi+shift)/2;
+    }
+    const Real sc = Sinh(psi);
+    return ell*ell*sc*sc;
+}
+
+// Form the 2r poles {c_i} and the r partial fraction coefficients {a_j}
+template<typename Real>
+void ZolotarevCoefficients
+( Real ell, Int r, vector<Real>& c, vector<Real>& a )
+{
+    DEBUG_CSE
+    c.resize( 2*r );
+    for( Int i=1; i<=2*r; ++i )
+        c[i-1] = ZolotarevPole( Real(i)/Real(2*r+1), ell );
+
+    // a_j = prod_k (c_{2k} - c_{2j-1}) / prod_{k != j} (c_{2k-1} - c_{2j-1})
+    a.resize( r );
+    for( Int j=0; j<r; ++j )
+    {
+        Real num=1, den=1;
+        for( Int k=0; k<r; ++k )
+        {
+            num *= c[2*k+1] - c[2*j];
+            if( k != j )
+                den *= c[2*k] - c[2*j];
+        }
+        a[j] = num/den;
+    }
+}
+
+// Evaluate x prod_j (x^2 + c_{2j}) / (x^2 + c_{2j-1}), i.e., Z(x)/M
+template<typename Real>
+Real ZolotarevMap( Real x, const vector<Real>& c )
+{
+    DEBUG_CSE
+    const Int r = c.size() / 2;
+    Real value = x;
+    for( Int j=0; j<r; ++j )
+        value *= (x*x+c[2*j+1])/(x*x+c[2*j]);
+    return value;
+}
+
+// Map the lower bound ell of [ell,1] to that of the image of Z
+template<typename Real>
+Real ZolotarevUpdate( Real ell, const vector<Real>& c )
+{
+    DEBUG_CSE
+    return Min( ZolotarevMap(ell,c)/ZolotarevMap(Real(1),c), Real(1) );
+}
+
+// The largest number of partial fractions we will use in an iteration
+const Int maxZolotarevDegree = 8;
+
+// Return the smallest degree r (up to maxZolotarevDegree) such that two
+// iterations drive 1-ell^2, which bounds || I - X^2 ||_2 for normal X, below
+// the square-root of the unit roundoff, so that a single Newton-Schulz
+// iteration completes the convergence
+template<typename Real>
+Int ZolotarevDegree( Real ell )
+{
+    DEBUG_CSE
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+    vector<Real> c, a;
+    for( Int r=1; r<maxZolotarevDegree; ++r )
+    {
+        Real ellIt = ell;
+        for( Int it=0; it<2; ++it )
+        {
+            if( 1-ellIt*ellIt <= tol )
+                break;
+            ZolotarevCoefficients( ellIt, r, c, a );
+            ellIt = ZolotarevUpdate( ellIt, c );
+        }
+        if( 1-ellIt*ellIt <= tol )
+            return r;
+    }
+    return maxZolotarevDegree;
+}
+
+// Estimate || A ||_2 and || inv(A) ||_2 using power iterations
+template<typename F,class MatrixType>
+void TwoNormEstimates
+( const MatrixType& A, Base<F>& twoNorm, Base<F>& twoNormInv )
+{
+    DEBUG_CSE
+    twoNorm = TwoNormEstimate( A );
+    MatrixType AInv( A );
+    Inverse( AInv );
+    twoNormInv = TwoNormEstimate( AInv );
+}
+
+} // namespace sign
+} // namespace El
+
+#endif // ifndef EL_SIGN_ZOLOTAREV_HPP
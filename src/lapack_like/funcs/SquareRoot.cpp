@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./Sign/Zolotarev.hpp"
+
 // See Eq. 6.3 of Nicholas J. Higham and Awad H. Al-Mohy's "Computing Matrix
 // Functions", which is currently available at:
 // http://eprints.ma.man.ac.uk/1451/01/covered/MIMS_ep2010_18.pdf
@@ -146,20 +148,267 @@ Newton( ElementalMatrix<F>& APre, const SquareRootCtrl<Base<F>>& ctrl )
     return numIts;
 }
 
+// The remaining iterations compute the sign of [0, Y; Z, 0] starting from
+// Y=A and Z=I, so that Y converges to sqrt(A) and Z to inv(sqrt(A)). Since
+// each Y and Z is a function of A, they commute, and the square of the
+// iterate is block-diagonal with both blocks equal to Z Y.
+
+// Run the coupled Newton-Schulz iteration
+//     T := (3I - Z Y)/2,  Y := Y T,  Z := T Z,
+// which converges quadratically when || I - Z Y || < 1. Returns false, with
+// (Y,Z) holding the last iterates which satisfied this condition, if the
+// iterates left the region of convergence.
+template<typename F,class MatrixType>
+bool NewtonSchulz
+( MatrixType& Y,
+  MatrixType& Z,
+  Int& numIts,
+  const SquareRootCtrl<Base<F>>& ctrl,
+  bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = Y.Height();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = n*limits::Epsilon<Real>();
+
+    MatrixType T(Y), YNew(Y), ZNew(Z);
+    bool converged = false;
+    while( numIts < ctrl.maxIts )
+    {
+        // T := I - Z Y
+        Identity( T, n, n );
+        Gemm( NORMAL, NORMAL, F(-1), Z, Y, F(1), T );
+        const Real oneRes = OneNorm( T );
+        if( oneRes >= Real(1) )
+            break;
+
+        // T := (3I - Z Y)/2 = I + T/2
+        T *= F(Real(1)/Real(2));
+        ShiftDiagonal( T, F(1) );
+        Gemm( NORMAL, NORMAL, F(1), Y, T, YNew );
+        Gemm( NORMAL, NORMAL, F(1), T, Z, ZNew );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), YNew, Y );
+        const Real oneDiff = OneNorm( Y );
+        const Real oneNew = OneNorm( YNew );
+
+        ++numIts;
+        Y = YNew;
+        Z = ZNew;
+        if( progress )
+            cout << "after " << numIts << " Newton-Schulz iter's: "
+                 << "oneRes=" << oneRes << ", oneDiff=" << oneDiff
+                 << ", oneNew=" << oneNew << ", oneDiff/oneNew="
+                 << oneDiff/oneNew << ", tol=" << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        {
+            converged = true;
+            break;
+        }
+    }
+    return converged;
+}
+
+// Run Denman-Beavers (coupled Newton) iterations,
+//     Y := (Y + inv(Z))/2,  Z := (Z + inv(Y))/2,
+// until the relative change in Y, which is roughly half of || I - Z Y ||_1,
+// suggests that Newton-Schulz will converge
+template<typename F,class MatrixType>
+Int NewtonSchulzHybrid
+( MatrixType& Y,
+  MatrixType& Z,
+  Int numIts,
+  const SquareRootCtrl<Base<F>>& ctrl,
+  bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = Y.Height()*limits::Epsilon<Real>();
+
+    MatrixType YInv(Y), ZInv(Z), YOld(Y);
+    while( numIts < ctrl.maxIts )
+    {
+        YOld = Y;
+        YInv = Y;
+        Inverse( YInv );
+        ZInv = Z;
+        Inverse( ZInv );
+        Y += ZInv;
+        Y *= F(Real(1)/Real(2));
+        Z += YInv;
+        Z *= F(Real(1)/Real(2));
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), Y, YOld );
+        const Real oneDiff = OneNorm( YOld );
+        const Real oneNew = OneNorm( Y );
+
+        ++numIts;
+        if( progress )
+            cout << "after " << numIts << " Denman-Beavers iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( 2*oneDiff/oneNew <= ctrl.newtonSchulzThreshold &&
+            NewtonSchulz<F>( Y, Z, numIts, ctrl, progress ) )
+            break;
+    }
+    return numIts;
+}
+
+// Run Zolotarev iterations on the sign of [0, A/||A||_2; I, 0], whose
+// eigenvalues, +-sqrt(lambda/||A||_2), lie in [-1,-ell] U [ell,1] with
+// ell = 1/sqrt(cond(A)), until the predicted bound on || I - Z Y ||_2 falls
+// below the square-root of the unit roundoff, and then polish with
+// Newton-Schulz (falling back to Denman-Beavers if the estimates were
+// misleading). Each of the shifted solves is against [Y, Z].
+template<typename F,class MatrixType>
+Int Zolotarev
+( MatrixType& A,
+  const SquareRootCtrl<Base<F>>& ctrl,
+  Base<F> twoNorm,
+  Base<F> twoNormInv,
+  bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = n*eps;
+
+    MatrixType Y(A), Z(A), ZY(A), T(A), W(A), YNew(A), ZNew(A);
+    Y *= F(Real(1)/twoNorm);
+    Identity( Z, n, n );
+    W.Resize( n, 2*n );
+    auto WY = W( ALL, IR(0,n) );
+    auto WZ = W( ALL, IR(n,2*n) );
+
+    Real ell =
+      Max( Min( Real(1)/Sqrt(twoNorm*twoNormInv), Real(1) ), eps );
+    const Int r =
+      ( ctrl.zolotarevDegree > 0 ? ctrl.zolotarevDegree
+                                 : sign::ZolotarevDegree(ell) );
+
+    Int numIts=0;
+    vector<Real> c, a;
+    bool converged = false;
+    while( numIts < ctrl.maxIts && 1-ell*ell > Sqrt(eps) )
+    {
+        sign::ZolotarevCoefficients( ell, r, c, a );
+
+        // [YNew, ZNew] := [Y, Z] + sum_j a_j inv(Z Y + c_{2j-1} I) [Y, Z]
+        Gemm( NORMAL, NORMAL, F(1), Z, Y, ZY );
+        YNew = Y;
+        ZNew = Z;
+        for( Int j=0; j<r; ++j )
+        {
+            T = ZY;
+            ShiftDiagonal( T, F(c[2*j]) );
+            WY = Y;
+            WZ = Z;
+            LinearSolve( T, W );
+            Axpy( F(a[j]), WY, YNew );
+            Axpy( F(a[j]), WZ, ZNew );
+        }
+        const Real scale = Real(1)/sign::ZolotarevMap(Real(1),c);
+        YNew *= F(scale);
+        ZNew *= F(scale);
+        ell = sign::ZolotarevUpdate( ell, c );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), YNew, Y );
+        const Real oneDiff = OneNorm( Y );
+        const Real oneNew = OneNorm( YNew );
+
+        ++numIts;
+        Y = YNew;
+        Z = ZNew;
+        if( progress )
+            cout << "after " << numIts << " Zolotarev iter's (r=" << r
+                 << "): ell=" << ell << ", oneDiff=" << oneDiff
+                 << ", oneNew=" << oneNew << ", oneDiff/oneNew="
+                 << oneDiff/oneNew << ", tol=" << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        {
+            converged = true;
+            break;
+        }
+    }
+    if( !converged && !NewtonSchulz<F>( Y, Z, numIts, ctrl, progress ) )
+        numIts = NewtonSchulzHybrid<F>( Y, Z, numIts, ctrl, progress );
+
+    // Undo the initial scaling
+    Y *= F(Sqrt(twoNorm));
+    A = Y;
+    return numIts;
+}
+
+template<typename F,class MatrixType>
+Int Iterate
+( MatrixType& A, const SquareRootCtrl<Base<F>>& ctrl, bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.method == SIGN_NEWTON )
+        return Newton( A, ctrl );
+
+    Real twoNorm=0, twoNormInv=0;
+    bool zolotarev = false;
+    if( ctrl.method == SIGN_ZOLOTAREV ||
+        (ctrl.method == SIGN_AUTO && ctrl.realSpectrum) )
+    {
+        sign::TwoNormEstimates<F>( A, twoNorm, twoNormInv );
+        if( progress )
+            cout << "||A||_2 ~= " << twoNorm << ", ||inv(A)||_2 ~= "
+                 << twoNormInv << endl;
+        zolotarev = ( ctrl.method == SIGN_ZOLOTAREV ||
+                      twoNorm*twoNormInv >= ctrl.zolotarevCondition );
+    }
+    if( zolotarev )
+        return Zolotarev<F>( A, ctrl, twoNorm, twoNormInv, progress );
+
+    const Int n = A.Height();
+    MatrixType Y(A), Z(A);
+    Identity( Z, n, n );
+    const Int numIts = NewtonSchulzHybrid<F>( Y, Z, 0, ctrl, progress );
+    A = Y;
+    return numIts;
+}
+
 } // namespace square_root
 
 template<typename F>
 void SquareRoot( Matrix<F>& A, const SquareRootCtrl<Base<F>> ctrl )
 {
     DEBUG_CSE
-    square_root::Newton( A, ctrl );
+    square_root::Iterate<F>( A, ctrl, ctrl.progress );
 }
 
 template<typename F>
-void SquareRoot( ElementalMatrix<F>& A, const SquareRootCtrl<Base<F>> ctrl )
+void SquareRoot( ElementalMatrix<F>& APre, const SquareRootCtrl<Base<F>> ctrl )
 {
     DEBUG_CSE
-    square_root::Newton( A, ctrl );
+    if( ctrl.method == SIGN_NEWTON )
+    {
+        square_root::Newton( APre, ctrl );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    const bool progress = ctrl.progress && A.Grid().Rank() == 0;
+    square_root::Iterate<F>( A, ctrl, progress );
 }
 
 // Square-root the eigenvalues of A
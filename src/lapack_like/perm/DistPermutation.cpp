@@ -12,204 +12,154 @@ namespace El {
 
 namespace {
 
+// The packed exchange of the rows (or columns) of a permutation; the inverse
+// permutation swaps the roles of the sends and recvs
+struct PermutationExchange
+{
+    const vector<int> *packIdx, *packOffs, *unpackIdx, *unpackOffs;
+    vector<int> sendCounts, sendDispls, recvCounts, recvDispls;
+
+    PermutationExchange
+    ( const PermutationMeta& meta, Int length, bool inverse )
+    {
+        packIdx = ( inverse ? &meta.recvIdx : &meta.sendIdx );
+        packOffs = ( inverse ? &meta.recvOffs : &meta.sendOffs );
+        unpackIdx = ( inverse ? &meta.sendIdx : &meta.recvIdx );
+        unpackOffs = ( inverse ? &meta.sendOffs : &meta.recvOffs );
+        sendCounts = ( inverse ? meta.recvCounts : meta.sendCounts );
+        sendDispls = ( inverse ? meta.recvDispls : meta.sendDispls );
+        recvCounts = ( inverse ? meta.sendCounts : meta.recvCounts );
+        recvDispls = ( inverse ? meta.sendDispls : meta.recvDispls );
+        const int p = sendCounts.size();
+        for( int q=0; q<p; ++q )
+        {
+            sendCounts[q] *= length;
+            sendDispls[q] *= length;
+            recvCounts[q] *= length;
+            recvDispls[q] *= length;
+        }
+    }
+
+    int TotalSend() const { return sendCounts.back()+sendDispls.back(); }
+    int TotalRecv() const { return recvCounts.back()+recvDispls.back(); }
+};
+
 template<typename T>
 void PermuteCols
 (       AbstractDistMatrix<T>& A,
-  const PermutationMeta& oldMeta,
+  const PermutationMeta& meta,
   bool inverse=false )
 {
     DEBUG_CSE
     DEBUG_ONLY(
-      if( A.RowComm() != oldMeta.comm )
+      if( A.RowComm() != meta.comm )
           LogicError("Invalid communicator in metadata");
-      if( A.RowAlign() != oldMeta.align )
+      if( A.RowAlign() != meta.align )
           LogicError("Invalid alignment in metadata");
     )
     if( A.Height() == 0 || A.Width() == 0 || !A.Participating() )
         return;
+    if( mpi::Size(meta.comm) == 1 )
+    {
+        ApplyCyclesToCols( meta.cycles, A.Matrix(), inverse );
+        return;
+    }
 
     T* ABuf = A.Buffer();
     const Int ALDim = A.LDim();
-
     const Int localHeight = A.LocalHeight();
-    PermutationMeta meta = oldMeta;
-    meta.ScaleUp( localHeight );
-
-    if( inverse )
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.recvDispls;
-        const int totalSend = meta.TotalRecv();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.recvIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int jLoc = meta.recvIdx[send];
-            const int rank = meta.recvRanks[send];
-            MemCopy( &sendData[offsets[rank]], &ABuf[jLoc*ALDim], localHeight );
-            offsets[rank] += localHeight;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalSend();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.sendDispls;
-        const int numRecvs = meta.sendIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int jLoc = meta.sendIdx[recv];
-            const int rank = meta.sendRanks[recv];
-            MemCopy( &ABuf[jLoc*ALDim], &recvData[offsets[rank]], localHeight );
-            offsets[rank] += localHeight;
-        }
-    }
-    else
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.sendDispls;
-        const int totalSend = meta.TotalSend();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.sendIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int jLoc = meta.sendIdx[send];
-            const int rank = meta.sendRanks[send];
-            MemCopy( &sendData[offsets[rank]], &ABuf[jLoc*ALDim], localHeight );
-            offsets[rank] += localHeight;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalRecv();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.recvDispls;
-        const int numRecvs = meta.recvIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int jLoc = meta.recvIdx[recv];
-            const int rank = meta.recvRanks[recv];
-            MemCopy( &ABuf[jLoc*ALDim], &recvData[offsets[rank]], localHeight );
-            offsets[rank] += localHeight;
-        }
-    }
+    PermutationExchange exchange( meta, localHeight, inverse );
+    const int* packIdx = exchange.packIdx->data();
+    const int* packOffs = exchange.packOffs->data();
+    const int* unpackIdx = exchange.unpackIdx->data();
+    const int* unpackOffs = exchange.unpackOffs->data();
+
+    // Fill vectors with the send data
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(exchange.TotalSend()) );
+    const int numSends = exchange.packIdx->size();
+    EL_PARALLEL_FOR
+    for( int send=0; send<numSends; ++send )
+        MemCopy
+        ( &sendData[Int(packOffs[send])*localHeight],
+          &ABuf[packIdx[send]*ALDim], localHeight );
+
+    // Communicate all pivot columns
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(exchange.TotalRecv()) );
+    mpi::AllToAll
+    ( sendData.data(),
+      exchange.sendCounts.data(), exchange.sendDispls.data(),
+      recvData.data(),
+      exchange.recvCounts.data(), exchange.recvDispls.data(),
+      meta.comm );
+
+    // Unpack the recv data
+    const int numRecvs = exchange.unpackIdx->size();
+    EL_PARALLEL_FOR
+    for( int recv=0; recv<numRecvs; ++recv )
+        MemCopy
+        ( &ABuf[unpackIdx[recv]*ALDim],
+          &recvData[Int(unpackOffs[recv])*localHeight], localHeight );
 }
 
 template<typename T>
 void PermuteRows
 (       AbstractDistMatrix<T>& A,
-  const PermutationMeta& oldMeta,
+  const PermutationMeta& meta,
   bool inverse=false )
 {
     DEBUG_CSE
     DEBUG_ONLY(
-      if( A.ColComm() != oldMeta.comm )
+      if( A.ColComm() != meta.comm )
           LogicError("Invalid communicator in metadata");
-      if( A.ColAlign() != oldMeta.align )
+      if( A.ColAlign() != meta.align )
           LogicError("Invalid alignment in metadata");
     )
     if( A.Height() == 0 || A.Width() == 0 || !A.Participating() )
         return;
+    if( mpi::Size(meta.comm) == 1 )
+    {
+        ApplyCyclesToRows( meta.cycles, A.Matrix(), inverse );
+        return;
+    }
 
     T* ABuf = A.Buffer();
     const Int ALDim = A.LDim();
-
     const Int localWidth = A.LocalWidth();
-    PermutationMeta meta = oldMeta;
-    meta.ScaleUp( localWidth );
-
-    if( inverse )
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.recvDispls;
-        const int totalSend = meta.TotalRecv();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.recvIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int iLoc = meta.recvIdx[send];
-            const int rank = meta.recvRanks[send];
-
-            StridedMemCopy
-            ( &sendData[offsets[rank]], 1, &ABuf[iLoc], ALDim, localWidth );
-            offsets[rank] += localWidth;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalSend();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.sendDispls;
-        const int numRecvs = meta.sendIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int iLoc = meta.sendIdx[recv];
-            const int rank = meta.sendRanks[recv];
-            StridedMemCopy
-            ( &ABuf[iLoc], ALDim, &recvData[offsets[rank]], 1,localWidth );
-            offsets[rank] += localWidth;
-        }
-    }
-    else
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.sendDispls;
-        const int totalSend = meta.TotalSend();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.sendIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int iLoc = meta.sendIdx[send];
-            const int rank = meta.sendRanks[send];
-
-            StridedMemCopy
-            ( &sendData[offsets[rank]], 1, &ABuf[iLoc], ALDim, localWidth );
-            offsets[rank] += localWidth;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalRecv();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.recvDispls;
-        const int numRecvs = meta.recvIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int iLoc = meta.recvIdx[recv];
-            const int rank = meta.recvRanks[recv];
-            StridedMemCopy
-            ( &ABuf[iLoc], ALDim, &recvData[offsets[rank]], 1,localWidth );
-            offsets[rank] += localWidth;
-        }
-    }
+    PermutationExchange exchange( meta, localWidth, inverse );
+    const int* packIdx = exchange.packIdx->data();
+    const int* packOffs = exchange.packOffs->data();
+    const int* unpackIdx = exchange.unpackIdx->data();
+    const int* unpackOffs = exchange.unpackOffs->data();
+
+    // Fill vectors with the send data
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(exchange.TotalSend()) );
+    const int numSends = exchange.packIdx->size();
+    EL_PARALLEL_FOR
+    for( int send=0; send<numSends; ++send )
+        StridedMemCopy
+        ( &sendData[Int(packOffs[send])*localWidth], 1,
+          &ABuf[packIdx[send]], ALDim, localWidth );
+
+    // Communicate all pivot rows
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(exchange.TotalRecv()) );
+    mpi::AllToAll
+    ( sendData.data(),
+      exchange.sendCounts.data(), exchange.sendDispls.data(),
+      recvData.data(),
+      exchange.recvCounts.data(), exchange.recvDispls.data(),
+      meta.comm );
+
+    // Unpack the recv data
+    const int numRecvs = exchange.unpackIdx->size();
+    EL_PARALLEL_FOR
+    for( int recv=0; recv<numRecvs; ++recv )
+        StridedMemCopy
+        ( &ABuf[unpackIdx[recv]], ALDim,
+          &recvData[Int(unpackOffs[recv])*localWidth], 1, localWidth );
 }
 
 void InvertPermutation
@@ -12,104 +12,6 @@ namespace El {
 
 namespace {
 
-template<typename T>
-void PermuteCols
-(       Matrix<T>& A,
-  const Matrix<Int>& perm,
-  const Matrix<Int>& invPerm )
-{
-    DEBUG_CSE
-    const Int b = perm.Height();
-    DEBUG_ONLY(
-      if( A.Width() < b || b != invPerm.Height() )
-          LogicError
-          ("perm and invPerm must be vectors of equal length that are not "
-           "wider than A.");
-    )
-    const Int m = A.Height();
-    const Int n = A.Width();
-    if( m == 0 || n == 0 )
-        return;
-
-    // Make a copy of the first b columns
-    auto AColPanView = A( IR(0,m), IR(0,b) );
-    auto AColPanCopy( AColPanView );
-
-    // Make a copy of the preimage columns
-    Matrix<T> APreimageCopy( m, b );
-
-    for( Int j=0; j<b; ++j )
-    {
-        const Int jPre = perm(j);
-        if( jPre >= b )
-            MemCopy( &APreimageCopy(0,j), &A(0,jPre), m );
-    }
-
-    // Apply the permutations
-    for( Int j=0; j<b; ++j )
-    {
-        const Int jPre = perm(j);
-        const Int jPost = invPerm(j);
-        // Move row[j] into row[jPost]
-        MemCopy( &A(0,jPost), &AColPanCopy(0,j), m );
-        // Move row[jPre] into row[j]
-        if( jPre >= b )
-            MemCopy( &A(0,j), &APreimageCopy(0,j), m );
-    }
-}
-
-template<typename T>
-void PermuteRows
-(       Matrix<T>& A,
-  const Matrix<Int>& perm,
-  const Matrix<Int>& invPerm )
-{
-    DEBUG_CSE
-    const Int b = perm.Height();
-    DEBUG_ONLY(
-      if( A.Height() < b || b != invPerm.Height() )
-          LogicError
-          ("perm and invPerm must be vectors of equal length that are not "
-           "taller than A.");
-    )
-    const Int m = A.Height();
-    const Int n = A.Width();
-    if( m == 0 || n == 0 )
-        return;
-
-    // Make a copy of the first b rows
-    auto ARowPanView = A( IR(0,b), IR(0,n) );
-    Matrix<T> ARowPanTrans;
-    Transpose( ARowPanView, ARowPanTrans );
-
-    // Make a copy of the preimage rows
-    Matrix<T> APreimageTrans( n, b );
-
-    for( Int i=0; i<b; ++i )
-    {
-        const Int iPre = perm(i);
-        if( iPre >= b )
-            for( Int j=0; j<n; ++j )
-                APreimageTrans(j,i) = A(iPre,j);
-    }
-
-    // Apply the permutations
-    for( Int i=0; i<b; ++i )
-    {
-        const Int iPre = perm(i);
-        const Int iPost = invPerm(i);
-        // Move row[i] into row[image[i]]
-        for( Int j=0; j<n; ++j )
-            A(iPost,j) = ARowPanTrans(j,i);
-        if( iPre >= b )
-        {
-            // Move row[preimage[i]] into row[i]
-            for( Int j=0; j<n; ++j )
-                A(i,j) = APreimageTrans(j,i);
-        }
-    }
-}
-
 void InvertPermutation
 ( const Matrix<Int>& p, Matrix<Int>& pInv )
 {
@@ -161,6 +63,8 @@ void Permutation::Empty()
     perm_.Empty();
     invPerm_.Empty();
     staleInverse_ = false;
+    cycles_ = PermutationCycles();
+    staleCycles_ = true;
 }
 
 void Permutation::MakeIdentity( Int size )
@@ -218,6 +122,7 @@ void Permutation::Swap( Int origin, Int dest )
     {
         El::RowSwap( perm_, origin, dest );
         staleInverse_ = true;
+        staleCycles_ = true;
         return;
     }
 
@@ -274,6 +179,7 @@ void Permutation::SwapSequence( const Permutation& P, Int offset )
 
         staleParity_ = true;
         staleInverse_ = true;
+        staleCycles_ = true;
     }
 }
 
@@ -328,6 +234,7 @@ void Permutation::SetImage( Int origin, Int dest )
     perm_(dest) = origin;
     invPerm_(origin) = dest;
     staleParity_ = true;
+    staleCycles_ = true;
 }
 
 void Permutation::MakeArbitrary() const
@@ -345,6 +252,7 @@ void Permutation::MakeArbitrary() const
 
     invPerm_.Resize( size_, 1 );
     staleInverse_ = true;
+    staleCycles_ = true;
 
     // Clear the swap information
     // --------------------------
@@ -373,6 +281,8 @@ const Permutation& Permutation::operator=( const Permutation& P )
     parity_ = P.parity_;
     staleParity_ = P.staleParity_;
     staleInverse_ = P.staleInverse_;
+    cycles_ = P.cycles_;
+    staleCycles_ = P.staleCycles_;
 
     return *this;
 }
@@ -484,14 +394,7 @@ void Permutation::PermuteCols( Matrix<T>& A, Int offset ) const
         if( offset != 0 )
             LogicError
             ("General permutations are not supported with nonzero offsets");
-        // TODO: Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            El::InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
-        // TODO: Move El::PermuteCols into this class
-        El::PermuteCols( A, perm_, invPerm_ );
+        ApplyCyclesToCols( Cycles(), A );
     }
 }
 
@@ -530,14 +433,7 @@ void Permutation::InversePermuteCols( Matrix<T>& A, Int offset ) const
         if( offset != 0 )
             LogicError
             ("General permutations are not supported with nonzero offsets");
-        // TODO: Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            El::InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
-        // TODO: Move El::PermuteCols into this class
-        El::PermuteCols( A, invPerm_, perm_ );
+        ApplyCyclesToCols( Cycles(), A, true );
     }
 }
 
@@ -573,14 +469,7 @@ void Permutation::PermuteRows( Matrix<T>& A, Int offset ) const
     }
     else
     {
-        // TODO: Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            El::InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
-        // TODO: Move El::PermuteRows into this class
-        El::PermuteRows( A, perm_, invPerm_ );
+        ApplyCyclesToRows( Cycles(), A );
     }
 }
 
@@ -619,14 +508,7 @@ void Permutation::InversePermuteRows( Matrix<T>& A, Int offset ) const
         if( offset != 0 )
             LogicError
             ("General permutations are not supported with nonzero offsets");
-        // TODO: Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            El::InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
-        // TODO: Move El::PermuteRows into this class
-        El::PermuteRows( A, invPerm_, perm_ );
+        ApplyCyclesToRows( Cycles(), A, true );
     }
 }
 
@@ -728,6 +610,21 @@ void Permutation::InversePermuteSymmetrically
     }
 }
 
+const PermutationCycles& Permutation::Cycles() const
+{
+    DEBUG_CSE
+    if( staleCycles_ )
+    {
+        // Row i of the permuted matrix is row perm_(i) of the original
+        vector<Int> dests( size_ );
+        for( Int i=0; i<size_; ++i )
+            dests[i] = i;
+        cycles_.Form( size_, perm_.LockedBuffer(), dests.data() );
+        staleCycles_ = false;
+    }
+    return cycles_;
+}
+
 void Permutation::ExplicitVector( Matrix<Int>& p ) const
 {
     DEBUG_CSE
@@ -91,14 +91,47 @@ PermutationMeta::PermutationMeta
     }
 
     // Construct the send and recv displacements from the counts
-    const Int totalSend = Scan( sendCounts, sendDispls );
-    const Int totalRecv = Scan( recvCounts, recvDispls );
+    Scan( sendCounts, sendDispls );
+    Scan( recvCounts, recvDispls );
     DEBUG_ONLY(
+      const Int totalSend = sendIdx.size();
+      const Int totalRecv = recvIdx.size();
       if( totalSend != totalRecv )
           LogicError
           ("Send and recv counts do not match: send=",totalSend,", recv=",
            totalRecv);
     )
+
+    FormPlan();
+}
+
+void PermutationMeta::FormPlan()
+{
+    DEBUG_CSE
+    const int numSends = sendIdx.size();
+    const int numRecvs = recvIdx.size();
+    auto offsets = sendDispls;
+    FastResize( sendOffs, numSends );
+    for( int send=0; send<numSends; ++send )
+        sendOffs[send] = offsets[sendRanks[send]]++;
+    offsets = recvDispls;
+    FastResize( recvOffs, numRecvs );
+    for( int recv=0; recv<numRecvs; ++recv )
+        recvOffs[recv] = offsets[recvRanks[recv]]++;
+
+    if( mpi::Size(comm) == 1 )
+    {
+        // The k'th packed send would simply be the k'th packed recv
+        DEBUG_ONLY(
+          if( numSends != numRecvs )
+              LogicError("Send and recv counts do not match");
+        )
+        vector<Int> sources( sendIdx.begin(), sendIdx.end() ),
+                    dests( recvIdx.begin(), recvIdx.end() );
+        cycles.Form( numSends, sources.data(), dests.data() );
+    }
+    else
+        cycles = PermutationCycles();
 }
 
 } // namespace El
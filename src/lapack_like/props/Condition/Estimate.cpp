@@ -0,0 +1,533 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// See Nicholas J. Higham and Francoise Tisseur's "A block algorithm for
+// matrix 1-norm estimation, with an application to 1-norm pseudospectra",
+// SIAM J. Matrix Anal. Appl., 21(4), pp. 1185--1201, 2000. The single-vector
+// version (Hager's method) is used for pseudospectra in
+// src/lapack_like/spectral/Pseudospectra/HagerHigham.hpp.
+
+namespace El {
+
+namespace cond_est {
+
+// Fill the first column of X with ones and the rest with pseudo-random signs,
+// all scaled by 1/n. The signs are generated deterministically so that every
+// process of a distributed estimate forms the same starting block.
+template<typename F>
+void StartingBlock( Int n, Int numVecs, Matrix<F>& X )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real scale = Real(1)/Real(n);
+    X.Resize( n, numVecs );
+    for( Int j=0; j<numVecs; ++j )
+    {
+        unsigned long long state = j;
+        for( Int i=0; i<n; ++i )
+        {
+            state = 6364136223846793005ULL*state + 1442695040888963407ULL;
+            const bool negate = ( j > 0 && ((state >> 33) & 1ULL) );
+            X(i,j) = ( negate ? -scale : scale );
+        }
+    }
+}
+
+// Estimate || B ||_1, where apply(orientation,X) overwrites X with
+// op(B) X, by ascending the convex function || B X ||_1 over the vertices of
+// the unit 1-norm ball (Algorithm 2.4 of Higham and Tisseur)
+template<typename F>
+Base<F> HighamTisseur
+( Int n,
+  const function<void(Orientation,Matrix<F>&)>& apply,
+  Int numVecs,
+  Int maxIts )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( n == 0 )
+        return 0;
+    Int t = Max( Min(numVecs,n), Int(1) );
+
+    Matrix<F> X, Y, Z;
+    StartingBlock( n, t, X );
+    // The unit vectors in each column of X (only valid after the first step)
+    vector<Int> columnIndices(t,-1);
+    vector<bool> used(n,false);
+    vector<ValueInt<Real>> rowNorms(n);
+
+    Real est=0;
+    Int bestIndex=-1;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        Y = X;
+        apply( NORMAL, Y );
+
+        Real estNew=0;
+        Int jBest=0;
+        for( Int j=0; j<t; ++j )
+        {
+            Real colNorm=0;
+            for( Int i=0; i<n; ++i )
+                colNorm += Abs(Y(i,j));
+            if( colNorm > estNew )
+            {
+                estNew = colNorm;
+                jBest = j;
+            }
+        }
+        if( it > 0 && estNew <= est )
+            break;
+        est = estNew;
+        bestIndex = columnIndices[jBest];
+        if( it == maxIts-1 )
+            break;
+
+        // Z := op(B)^H sign(Y)
+        Z = Y;
+        for( Int j=0; j<t; ++j )
+        {
+            for( Int i=0; i<n; ++i )
+            {
+                const Real absVal = Abs(Z(i,j));
+                Z(i,j) = ( absVal == Real(0) ? F(1) : Z(i,j)/absVal );
+            }
+        }
+        apply( ADJOINT, Z );
+
+        // The gradient is largest in the directions with large || Z(i,:) ||_oo
+        Real maxRowNorm=0;
+        for( Int i=0; i<n; ++i )
+        {
+            Real rowNorm=0;
+            for( Int j=0; j<t; ++j )
+                rowNorm = Max( rowNorm, Abs(Z(i,j)) );
+            rowNorms[i].value = rowNorm;
+            rowNorms[i].index = i;
+            maxRowNorm = Max( maxRowNorm, rowNorm );
+        }
+        if( bestIndex >= 0 && rowNorms[bestIndex].value >= maxRowNorm )
+            break;
+        std::sort
+        ( rowNorms.begin(), rowNorms.end(),
+          []( const ValueInt<Real>& a, const ValueInt<Real>& b )
+          { return a.value > b.value; } );
+
+        // Move to the unit vectors of the largest unvisited directions
+        columnIndices.clear();
+        for( Int k=0; k<n && Int(columnIndices.size())<t; ++k )
+        {
+            const Int i = rowNorms[k].index;
+            if( !used[i] )
+            {
+                columnIndices.push_back( i );
+                used[i] = true;
+            }
+        }
+        if( columnIndices.empty() )
+            break;
+        t = columnIndices.size();
+        Zeros( X, n, t );
+        for( Int j=0; j<t; ++j )
+            X(columnIndices[j],j) = 1;
+    }
+    return est;
+}
+
+// Convert the application of a distributed operator into the application to
+// a replicated block (which is cheap relative to the solves for small blocks)
+template<typename F>
+function<void(Orientation,Matrix<F>&)>
+Replicate
+( const Grid& g,
+  const function<void(Orientation,DistMatrix<F>&)>& apply )
+{
+    return [&g,apply]( Orientation orientation, Matrix<F>& X )
+    {
+        DistMatrix<F,STAR,STAR> X_STAR_STAR(g);
+        X_STAR_STAR.Resize( X.Height(), X.Width() );
+        X_STAR_STAR.Matrix() = X;
+        DistMatrix<F> XDist( X_STAR_STAR );
+        apply( orientation, XDist );
+        X_STAR_STAR = XDist;
+        X = X_STAR_STAR.Matrix();
+    };
+}
+
+// Estimate the largest eigenvalue of the Hermitian positive semi-definite
+// operator applied by 'apply' using at most basisSize steps of Lanczos
+// starting from v. The extreme Ritz values converge quickly enough that no
+// reorthogonalization is performed.
+template<typename F,class MatrixType>
+Base<F> LanczosMaxEig
+( MatrixType& v,
+  const function<void(MatrixType&)>& apply,
+  Int basisSize )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = v.Height();
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+
+    MatrixType vOld(v), w(v);
+    Zeros( vOld, n, 1 );
+    const Real vNorm = FrobeniusNorm( v );
+    if( vNorm == Real(0) )
+        return 0;
+    v *= F(Real(1)/vNorm);
+
+    vector<Real> alpha, beta;
+    Matrix<Real> d, e, ritzValues;
+    Real theta=0, betaLast=0;
+    for( Int j=0; j<Min(basisSize,n); ++j )
+    {
+        // w := apply(v) - alpha_j v - beta_{j-1} v_{j-1}
+        w = v;
+        apply( w );
+        const Real alphaj = RealPart(Dot(v,w));
+        Axpy( F(-alphaj), v, w );
+        Axpy( F(-betaLast), vOld, w );
+        alpha.push_back( alphaj );
+
+        // Compute the largest Ritz value of the current tridiagonal matrix
+        const Int k = alpha.size();
+        d.Resize( k, 1 );
+        e.Resize( k-1, 1 );
+        for( Int i=0; i<k; ++i )
+            d(i) = alpha[i];
+        for( Int i=0; i<k-1; ++i )
+            e(i) = beta[i];
+        HermitianTridiagEig( d, e, ritzValues );
+        const Real thetaOld = theta;
+        theta = 0;
+        for( Int i=0; i<k; ++i )
+            theta = Max( theta, ritzValues(i) );
+        if( j > 0 && Abs(theta-thetaOld) <= tol*theta )
+            break;
+
+        const Real betaj = FrobeniusNorm( w );
+        if( betaj <= limits::Epsilon<Real>()*theta )
+            break;
+        beta.push_back( betaj );
+        vOld = v;
+        v = w;
+        v *= F(Real(1)/betaj);
+        betaLast = betaj;
+    }
+    return theta;
+}
+
+} // namespace cond_est
+
+namespace lu {
+
+template<typename F>
+Base<F> InverseOneNormEstimate
+( const Matrix<F>& A,
+  const Permutation& P,
+  Int numVecs,
+  Int maxIts )
+{
+    DEBUG_CSE
+    auto apply = [&]( Orientation orientation, Matrix<F>& X )
+      { SolveAfter( orientation, A, P, X ); };
+    return cond_est::HighamTisseur<F>( A.Height(), apply, numVecs, maxIts );
+}
+
+template<typename F>
+Base<F> InverseOneNormEstimate
+( const ElementalMatrix<F>& A,
+  const DistPermutation& P,
+  Int numVecs,
+  Int maxIts )
+{
+    DEBUG_CSE
+    auto apply = [&]( Orientation orientation, DistMatrix<F>& X )
+      { SolveAfter( orientation, A, P, X ); };
+    return cond_est::HighamTisseur<F>
+      ( A.Height(), cond_est::Replicate<F>( A.Grid(), apply ),
+        numVecs, maxIts );
+}
+
+// || inv(A) ||_oo = || inv(A)^H ||_1
+template<typename F>
+Base<F> InverseInfinityNormEstimate
+( const Matrix<F>& A,
+  const Permutation& P,
+  Int numVecs,
+  Int maxIts )
+{
+    DEBUG_CSE
+    auto apply = [&]( Orientation orientation, Matrix<F>& X )
+      { SolveAfter( orientation==NORMAL ? ADJOINT : NORMAL, A, P, X ); };
+    return cond_est::HighamTisseur<F>( A.Height(), apply, numVecs, maxIts );
+}
+
+template<typename F>
+Base<F> InverseInfinityNormEstimate
+( const ElementalMatrix<F>& A,
+  const DistPermutation& P,
+  Int numVecs,
+  Int maxIts )
+{
+    DEBUG_CSE
+    auto apply = [&]( Orientation orientation, DistMatrix<F>& X )
+      { SolveAfter( orientation==NORMAL ? ADJOINT : NORMAL, A, P, X ); };
+    return cond_est::HighamTisseur<F>
+      ( A.Height(), cond_est::Replicate<F>( A.Grid(), apply ),
+        numVecs, maxIts );
+}
+
+template<typename F>
+Base<F> InverseTwoNormEstimate
+( const Matrix<F>& A,
+  const Permutation& P,
+  Int basisSize )
+{
+    DEBUG_CSE
+    Matrix<F> v;
+    Gaussian( v, A.Height(), 1 );
+    function<void(Matrix<F>&)> apply = [&]( Matrix<F>& w )
+      {
+          SolveAfter( NORMAL, A, P, w );
+          SolveAfter( ADJOINT, A, P, w );
+      };
+    return Sqrt(cond_est::LanczosMaxEig<F>( v, apply, basisSize ));
+}
+
+template<typename F>
+Base<F> InverseTwoNormEstimate
+( const ElementalMatrix<F>& A,
+  const DistPermutation& P,
+  Int basisSize )
+{
+    DEBUG_CSE
+    DistMatrix<F> v(A.Grid());
+    Gaussian( v, A.Height(), 1 );
+    function<void(DistMatrix<F>&)> apply = [&]( DistMatrix<F>& w )
+      {
+          SolveAfter( NORMAL, A, P, w );
+          SolveAfter( ADJOINT, A, P, w );
+      };
+    return Sqrt(cond_est::LanczosMaxEig<F>( v, apply, basisSize ));
+}
+
+} // namespace lu
+
+namespace cholesky {
+
+template<typename F>
+Base<F> InverseOneNormEstimate
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  Int numVecs,
+  Int maxIts )
+{
+    DEBUG_CSE
+    auto apply = [&]( Orientation orientation, Matrix<F>& X )
+      { SolveAfter( uplo, NORMAL, A, X ); };
+    return cond_est::HighamTisseur<F>( A.Height(), apply, numVecs, maxIts );
+}
+
+template<typename F>
+Base<F> InverseOneNormEstimate
+( UpperOrLower uplo,
+  const ElementalMatrix<F>& A,
+  Int numVecs,
+  Int maxIts )
+{
+    DEBUG_CSE
+    auto apply = [&]( Orientation orientation, DistMatrix<F>& X )
+      { SolveAfter( uplo, NORMAL, A, X ); };
+    return cond_est::HighamTisseur<F>
+      ( A.Height(), cond_est::Replicate<F>( A.Grid(), apply ),
+        numVecs, maxIts );
+}
+
+template<typename F>
+Base<F> InverseTwoNormEstimate
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  Int basisSize )
+{
+    DEBUG_CSE
+    Matrix<F> v;
+    Gaussian( v, A.Height(), 1 );
+    function<void(Matrix<F>&)> apply =
+      [&]( Matrix<F>& w ) { SolveAfter( uplo, NORMAL, A, w ); };
+    return cond_est::LanczosMaxEig<F>( v, apply, basisSize );
+}
+
+template<typename F>
+Base<F> InverseTwoNormEstimate
+( UpperOrLower uplo,
+  const ElementalMatrix<F>& A,
+  Int basisSize )
+{
+    DEBUG_CSE
+    DistMatrix<F> v(A.Grid());
+    Gaussian( v, A.Height(), 1 );
+    function<void(DistMatrix<F>&)> apply =
+      [&]( DistMatrix<F>& w ) { SolveAfter( uplo, NORMAL, A, w ); };
+    return cond_est::LanczosMaxEig<F>( v, apply, basisSize );
+}
+
+} // namespace cholesky
+
+template<typename F>
+Base<F> OneConditionEstimate( const Matrix<F>& A )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> B( A );
+    Permutation P;
+    LU( B, P );
+    if( MinAbs(GetDiagonal(B)) == Real(0) )
+        return limits::Infinity<Real>();
+    return OneNorm(A)*lu::InverseOneNormEstimate( B, P );
+}
+
+template<typename F>
+Base<F> OneConditionEstimate( const ElementalMatrix<F>& A )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrix<F> B( A );
+    DistPermutation P( B.Grid() );
+    LU( B, P );
+    DistMatrix<F,MD,STAR> d( B.Grid() );
+    GetDiagonal( B, d );
+    if( MinAbs(d) == Real(0) )
+        return limits::Infinity<Real>();
+    return OneNorm(A)*lu::InverseOneNormEstimate( B, P );
+}
+
+template<typename F>
+Base<F> InfinityConditionEstimate( const Matrix<F>& A )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> B( A );
+    Permutation P;
+    LU( B, P );
+    if( MinAbs(GetDiagonal(B)) == Real(0) )
+        return limits::Infinity<Real>();
+    return InfinityNorm(A)*lu::InverseInfinityNormEstimate( B, P );
+}
+
+template<typename F>
+Base<F> InfinityConditionEstimate( const ElementalMatrix<F>& A )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrix<F> B( A );
+    DistPermutation P( B.Grid() );
+    LU( B, P );
+    DistMatrix<F,MD,STAR> d( B.Grid() );
+    GetDiagonal( B, d );
+    if( MinAbs(d) == Real(0) )
+        return limits::Infinity<Real>();
+    return InfinityNorm(A)*lu::InverseInfinityNormEstimate( B, P );
+}
+
+template<typename F>
+Base<F> TwoConditionEstimate( const Matrix<F>& A, Int basisSize )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> v, t;
+    Gaussian( v, A.Width(), 1 );
+    function<void(Matrix<F>&)> applyGram = [&]( Matrix<F>& w )
+      {
+          Gemv( NORMAL, F(1), A, w, t );
+          Gemv( ADJOINT, F(1), A, t, w );
+      };
+    const Real twoNorm =
+      Sqrt(cond_est::LanczosMaxEig<F>( v, applyGram, basisSize ));
+
+    Matrix<F> B( A );
+    Permutation P;
+    LU( B, P );
+    if( MinAbs(GetDiagonal(B)) == Real(0) )
+        return limits::Infinity<Real>();
+    return twoNorm*lu::InverseTwoNormEstimate( B, P, basisSize );
+}
+
+template<typename F>
+Base<F> TwoConditionEstimate( const ElementalMatrix<F>& APre, Int basisSize )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<F> v(g), t(g);
+    Gaussian( v, A.Width(), 1 );
+    function<void(DistMatrix<F>&)> applyGram = [&]( DistMatrix<F>& w )
+      {
+          Gemv( NORMAL, F(1), A, w, t );
+          Gemv( ADJOINT, F(1), A, t, w );
+      };
+    const Real twoNorm =
+      Sqrt(cond_est::LanczosMaxEig<F>( v, applyGram, basisSize ));
+
+    DistMatrix<F> B( A );
+    DistPermutation P( g );
+    LU( B, P );
+    DistMatrix<F,MD,STAR> d( g );
+    GetDiagonal( B, d );
+    if( MinAbs(d) == Real(0) )
+        return limits::Infinity<Real>();
+    return twoNorm*lu::InverseTwoNormEstimate( B, P, basisSize );
+}
+
+#define PROTO(F) \
+  template Base<F> lu::InverseOneNormEstimate \
+  ( const Matrix<F>& A, const Permutation& P, Int numVecs, Int maxIts ); \
+  template Base<F> lu::InverseOneNormEstimate \
+  ( const ElementalMatrix<F>& A, const DistPermutation& P, \
+    Int numVecs, Int maxIts ); \
+  template Base<F> lu::InverseInfinityNormEstimate \
+  ( const Matrix<F>& A, const Permutation& P, Int numVecs, Int maxIts ); \
+  template Base<F> lu::InverseInfinityNormEstimate \
+  ( const ElementalMatrix<F>& A, const DistPermutation& P, \
+    Int numVecs, Int maxIts ); \
+  template Base<F> lu::InverseTwoNormEstimate \
+  ( const Matrix<F>& A, const Permutation& P, Int basisSize ); \
+  template Base<F> lu::InverseTwoNormEstimate \
+  ( const ElementalMatrix<F>& A, const DistPermutation& P, Int basisSize ); \
+  template Base<F> cholesky::InverseOneNormEstimate \
+  ( UpperOrLower uplo, const Matrix<F>& A, Int numVecs, Int maxIts ); \
+  template Base<F> cholesky::InverseOneNormEstimate \
+  ( UpperOrLower uplo, const ElementalMatrix<F>& A, \
+    Int numVecs, Int maxIts ); \
+  template Base<F> cholesky::InverseTwoNormEstimate \
+  ( UpperOrLower uplo, const Matrix<F>& A, Int basisSize ); \
+  template Base<F> cholesky::InverseTwoNormEstimate \
+  ( UpperOrLower uplo, const ElementalMatrix<F>& A, Int basisSize ); \
+  template Base<F> OneConditionEstimate( const Matrix<F>& A ); \
+  template Base<F> OneConditionEstimate( const ElementalMatrix<F>& A ); \
+  template Base<F> InfinityConditionEstimate( const Matrix<F>& A ); \
+  template Base<F> InfinityConditionEstimate( const ElementalMatrix<F>& A ); \
+  template Base<F> TwoConditionEstimate \
+  ( const Matrix<F>& A, Int basisSize ); \
+  template Base<F> TwoConditionEstimate \
+  ( const ElementalMatrix<F>& A, Int basisSize );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -10,6 +10,8 @@
 
 #include "./Determinant/Cholesky.hpp"
 #include "./Determinant/LUPartialPiv.hpp"
+#include "./Determinant/LDL.hpp"
+#include "./Determinant/LanczosQuadrature.hpp"
 
 namespace El {
 
@@ -176,6 +178,104 @@ Base<F> HPDDeterminant
     return Exp(safeDet.kappa*safeDet.n);
 }
 
+template<typename F>
+SafeProduct<Base<F>> SafeHPDDeterminant
+( const SparseMatrix<F>& A, const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    SparseLDLFactorization<F> factorization;
+    factorization.Initialize( A, true, LDL_2D, ctrl );
+    auto det = det::AfterLDL( factorization.Info(), factorization.Front() );
+
+    SafeProduct<Real> hpdDet( det.n );
+    if( RealPart(det.rho) > Real(0) )
+    {
+        hpdDet.rho = 1;
+        hpdDet.kappa = det.kappa;
+    }
+    else
+    {
+        hpdDet.rho = 0;
+        hpdDet.kappa = 0;
+    }
+    return hpdDet;
+}
+
+template<typename F>
+SafeProduct<Base<F>> SafeHPDDeterminant
+( const DistSparseMatrix<F>& A, const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    DistSparseLDLFactorization<F> factorization;
+    factorization.Initialize( A, true, LDL_2D, ctrl );
+    auto det = det::AfterLDL( factorization.Info(), factorization.Front() );
+
+    SafeProduct<Real> hpdDet( det.n );
+    if( RealPart(det.rho) > Real(0) )
+    {
+        hpdDet.rho = 1;
+        hpdDet.kappa = det.kappa;
+    }
+    else
+    {
+        hpdDet.rho = 0;
+        hpdDet.kappa = 0;
+    }
+    return hpdDet;
+}
+
+template<typename F>
+Base<F> HPDLogDeterminantEstimate
+( const SparseMatrix<F>& A, const LanczosQuadratureCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( n == 0 )
+        return 0;
+
+    Matrix<F> v;
+    Real sum=0, sumSquares=0, estimate=0;
+    for( Int probe=0; probe<ctrl.numProbes; ++probe )
+    {
+        Rademacher( v, n, 1 );
+        v *= F(Real(1)/Sqrt(Real(n)));
+        const Real quadrature =
+          hpd_det::LanczosQuadrature<F>( A, v, ctrl.numSteps );
+        estimate = hpd_det::LogDetAccumulate<F>
+          ( quadrature, probe, n, sum, sumSquares, ctrl.progress );
+    }
+    return estimate;
+}
+
+template<typename F>
+Base<F> HPDLogDeterminantEstimate
+( const DistSparseMatrix<F>& A, const LanczosQuadratureCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( n == 0 )
+        return 0;
+    const bool progress = ctrl.progress && mpi::Rank(A.Comm()) == 0;
+
+    DistMultiVec<F> v(A.Comm());
+    Real sum=0, sumSquares=0, estimate=0;
+    for( Int probe=0; probe<ctrl.numProbes; ++probe )
+    {
+        Zeros( v, n, 1 );
+        Rademacher( v.Matrix(), v.LocalHeight(), 1 );
+        v *= F(Real(1)/Sqrt(Real(n)));
+        const Real quadrature =
+          hpd_det::LanczosQuadrature<F>( A, v, ctrl.numSteps );
+        estimate = hpd_det::LogDetAccumulate<F>
+          ( quadrature, probe, n, sum, sumSquares, progress );
+    }
+    return estimate;
+}
+
 #define PROTO(F) \
   template SafeProduct<F> SafeDeterminant( const Matrix<F>& A ); \
   template SafeProduct<F> SafeDeterminant( const ElementalMatrix<F>& A ); \
@@ -214,7 +314,20 @@ Base<F> HPDDeterminant
   template SafeProduct<F> det::AfterLUPartialPiv \
   ( const Matrix<F>& A, const Permutation& P ); \
   template SafeProduct<F> det::AfterLUPartialPiv \
-  ( const ElementalMatrix<F>& A, const DistPermutation& P );
+  ( const ElementalMatrix<F>& A, const DistPermutation& P ); \
+  template SafeProduct<F> det::AfterLDL \
+  ( const ldl::NodeInfo& info, const ldl::Front<F>& front ); \
+  template SafeProduct<F> det::AfterLDL \
+  ( const ldl::DistNodeInfo& info, const ldl::DistFront<F>& front ); \
+  \
+  template SafeProduct<Base<F>> SafeHPDDeterminant \
+  ( const SparseMatrix<F>& A, const BisectCtrl& ctrl ); \
+  template SafeProduct<Base<F>> SafeHPDDeterminant \
+  ( const DistSparseMatrix<F>& A, const BisectCtrl& ctrl ); \
+  template Base<F> HPDLogDeterminantEstimate \
+  ( const SparseMatrix<F>& A, const LanczosQuadratureCtrl& ctrl ); \
+  template Base<F> HPDLogDeterminantEstimate \
+  ( const DistSparseMatrix<F>& A, const LanczosQuadratureCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_DETERMINANT_LDL_HPP
+#define EL_DETERMINANT_LDL_HPP
+
+namespace El {
+namespace det {
+
+// Accumulate the phase and the logarithm of the magnitude of the determinant
+// of the quasi-diagonal matrix defined by d and dSub (the latter is only used
+// for pivoted factorizations, where a nonzero dSub(i) marks a 2x2 pivot)
+template<typename F>
+void AccumulateLDLDiagonal
+( const Matrix<F>& d,
+  const Matrix<F>& dSub,
+  bool pivoted,
+  bool conjugate,
+  F& rho,
+  Base<F>& logAbs,
+  bool& singular )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = d.Height();
+    for( Int i=0; i<n; )
+    {
+        F delta;
+        if( pivoted && i < n-1 && dSub(i) != F(0) )
+        {
+            const F beta = dSub(i);
+            delta = d(i)*d(i+1) - ( conjugate ? beta*Conj(beta) : beta*beta );
+            i += 2;
+        }
+        else
+        {
+            delta = d(i);
+            i += 1;
+        }
+        const Real alpha = Abs(delta);
+        if( alpha == Real(0) )
+        {
+            singular = true;
+            continue;
+        }
+        rho *= delta/alpha;
+        logAbs += Log(alpha);
+    }
+}
+
+inline void CheckLDLFrontType( LDLFrontType type )
+{
+    DEBUG_CSE
+    if( Unfactored(type) )
+        LogicError("The fronts have not been factored");
+    if( BlockFactorization(type) )
+        LogicError("Block LDL factorizations do not store the diagonal");
+}
+
+template<typename F>
+void AfterLDLRecursion
+( const ldl::Front<F>& front, F& rho, Base<F>& logAbs, bool& singular )
+{
+    DEBUG_CSE
+    for( const auto* child : front.children )
+        AfterLDLRecursion( *child, rho, logAbs, singular );
+    AccumulateLDLDiagonal
+    ( front.diag, front.subdiag, PivotedFactorization(front.type),
+      front.isHermitian, rho, logAbs, singular );
+}
+
+template<typename F>
+void AfterLDLRecursion
+( const ldl::DistFront<F>& front, F& rho, Base<F>& logAbs, bool& singular )
+{
+    DEBUG_CSE
+    if( front.child == nullptr )
+    {
+        AfterLDLRecursion( *front.duplicate, rho, logAbs, singular );
+        return;
+    }
+    AfterLDLRecursion( *front.child, rho, logAbs, singular );
+
+    // Gather the (typically small) diagonal of the separator so that 2x2
+    // pivots are never split between processes, and then only accumulate
+    // its contribution on the root of the front's team
+    const bool pivoted = PivotedFactorization(front.type);
+    const Grid& g = front.diag.Grid();
+    DistMatrix<F,STAR,STAR> d_STAR_STAR( front.diag ), dSub_STAR_STAR(g);
+    if( pivoted )
+        dSub_STAR_STAR = front.subdiag;
+    if( g.VCRank() == 0 )
+        AccumulateLDLDiagonal
+        ( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), pivoted,
+          front.isHermitian, rho, logAbs, singular );
+}
+
+template<typename F>
+SafeProduct<F> AfterLDL( const ldl::NodeInfo& info, const ldl::Front<F>& front )
+{
+    DEBUG_CSE
+    CheckLDLFrontType( front.type );
+    typedef Base<F> Real;
+    const Int n = info.off + info.size;
+
+    F rho = 1;
+    Real logAbs = 0;
+    bool singular = false;
+    AfterLDLRecursion( front, rho, logAbs, singular );
+
+    SafeProduct<F> det( n );
+    if( singular )
+    {
+        det.rho = 0;
+        det.kappa = 0;
+    }
+    else
+    {
+        det.rho = rho;
+        det.kappa = ( n == 0 ? Real(0) : logAbs/Real(n) );
+    }
+    return det;
+}
+
+template<typename F>
+SafeProduct<F> AfterLDL
+( const ldl::DistNodeInfo& info, const ldl::DistFront<F>& front )
+{
+    DEBUG_CSE
+    CheckLDLFrontType( front.type );
+    typedef Base<F> Real;
+    const Int n = info.off + info.size;
+
+    F localRho = 1;
+    Real localLogAbs = 0;
+    bool singular = false;
+    AfterLDLRecursion( front, localRho, localLogAbs, singular );
+
+    SafeProduct<F> det( n );
+    const Int numSingular = mpi::AllReduce( Int(singular), info.comm );
+    if( numSingular > 0 )
+    {
+        det.rho = 0;
+        det.kappa = 0;
+    }
+    else
+    {
+        det.rho = mpi::AllReduce( localRho, mpi::PROD, info.comm );
+        const Real logAbs = mpi::AllReduce( localLogAbs, info.comm );
+        det.kappa = ( n == 0 ? Real(0) : logAbs/Real(n) );
+    }
+    return det;
+}
+
+} // namespace det
+} // namespace El
+
+#endif // ifndef EL_DETERMINANT_LDL_HPP
@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_DETERMINANT_LANCZOSQUADRATURE_HPP
+#define EL_DETERMINANT_LANCZOSQUADRATURE_HPP
+
+namespace El {
+namespace hpd_det {
+
+// Return the Gauss quadrature approximation of v^H log(A) v, for a unit vector
+// v, generated by (at most) numSteps steps of Lanczos. If A = Q T Q^H is the
+// partial tridiagonalization, then the approximation is e_0^T log(T) e_0,
+// which is the sum of the logarithms of the Ritz values weighted by the
+// squares of the first components of the Ritz vectors. Since the quadrature
+// is only sensitive to the extreme Ritz values, no reorthogonalization is
+// performed.
+template<typename F,class SparseMatrixType,class VectorType>
+Base<F> LanczosQuadrature
+( const SparseMatrixType& A, VectorType& v, Int numSteps )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int k = Min(numSteps,n);
+    const Real eps = limits::Epsilon<Real>();
+
+    VectorType vOld(v), w(v);
+    vector<Real> alpha, beta;
+    for( Int j=0; j<k; ++j )
+    {
+        Multiply( NORMAL, F(1), A, v, F(0), w );
+        const Real alphaj = RealPart(Dot(v,w));
+        alpha.push_back( alphaj );
+        if( j == k-1 )
+            break;
+
+        Axpy( F(-alphaj), v, w );
+        if( j > 0 )
+            Axpy( F(-beta.back()), vOld, w );
+        const Real betaj = FrobeniusNorm( w );
+        if( betaj <= eps*Abs(alphaj) )
+            break;
+        beta.push_back( betaj );
+        vOld = v;
+        v = w;
+        v *= F(Real(1)/betaj);
+    }
+
+    const Int numNodes = alpha.size();
+    Matrix<Real> d(numNodes,1), e(numNodes-1,1), nodes, Z;
+    for( Int i=0; i<numNodes; ++i )
+        d(i) = alpha[i];
+    for( Int i=0; i<numNodes-1; ++i )
+        e(i) = beta[i];
+    HermitianTridiagEig( d, e, nodes, Z );
+
+    Real quadrature = 0;
+    for( Int i=0; i<numNodes; ++i )
+    {
+        if( nodes(i) <= Real(0) )
+            RuntimeError("Nonpositive Ritz value: A was not HPD");
+        quadrature += Z(0,i)*Z(0,i)*Log(nodes(i));
+    }
+    return quadrature;
+}
+
+template<typename F>
+Base<F> LogDetAccumulate
+( Base<F> quadrature, Int probe, Int n,
+  Base<F>& sum, Base<F>& sumSquares, bool progress )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    sum += quadrature;
+    sumSquares += quadrature*quadrature;
+    const Real numProbes = probe+1;
+    const Real mean = sum/numProbes;
+    if( progress )
+    {
+        Real stdErr = 0;
+        if( probe > 0 )
+        {
+            const Real variance =
+              Max( sumSquares/numProbes-mean*mean, Real(0) )*
+              numProbes/(numProbes-1);
+            stdErr = Sqrt(variance/numProbes);
+        }
+        Output
+        ("probe ",probe,": log(det(A)) ~= ",n*mean," +- ",n*stdErr);
+    }
+    return n*mean;
+}
+
+} // namespace hpd_det
+} // namespace El
+
+#endif // ifndef EL_DETERMINANT_LANCZOSQUADRATURE_HPP
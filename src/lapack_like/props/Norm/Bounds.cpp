@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace norm_bounds {
+
+// Given the (non-increasing) singular values s of B := Q^H A and
+// tail = || A - Q B ||_F, bound the sum of the p'th powers of the k largest
+// singular values of A.
+//
+// Since Q B has rank at most r := s.Height(), sigma_{r+j}(A) is bounded by
+// sigma_j(A - Q B), and so the squares of the uncaptured singular values
+// sum to at most tail^2. The sum of the p'th powers of c such values is then
+// at most c^{1-p/2} tail^p when p <= 2 and tail^p otherwise.
+template<typename Real>
+NormBounds<Real>
+Finish( const Matrix<Real>& s, Int k, Int minDim, Real tail, Real p )
+{
+    DEBUG_CSE
+    const Int numCaptured = Min( k, s.Height() );
+    const Int numUncaptured = Min( k, minDim ) - numCaptured;
+
+    Real lowerSum=0, upperSum=0;
+    for( Int j=numCaptured-1; j>=0; --j )
+    {
+        lowerSum += Pow( s(j), p );
+        upperSum += Pow( s(j)+tail, p );
+    }
+    if( numUncaptured > 0 && tail > Real(0) )
+    {
+        if( p <= Real(2) )
+            upperSum += Pow( Real(numUncaptured), 1-p/2 )*Pow( tail, p );
+        else
+            upperSum += Pow( tail, p );
+    }
+
+    NormBounds<Real> bounds;
+    bounds.lower = Pow( lowerSum, 1/p );
+    bounds.upper = Pow( upperSum, 1/p );
+    return bounds;
+}
+
+template<typename F>
+NormBounds<Base<F>> KyFanSchatten
+( const Matrix<F>& A, Int k, Base<F> p, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int minDim = Min(A.Height(),A.Width());
+    if( minDim == 0 )
+        return NormBounds<Real>();
+
+    Matrix<F> Q, B;
+    Matrix<Real> s;
+    RangeFinder( A, Q, rank, ctrl );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+
+    // The residual is formed explicitly so that the bounds remain rigorous
+    // regardless of how well the sketch captured the dominant subspace
+    Matrix<F> E( A );
+    Gemm( NORMAL, NORMAL, F(-1), Q, B, F(1), E );
+    const Real tail = FrobeniusNorm( E );
+
+    SVD( B, s );
+    return Finish( s, k, minDim, tail, p );
+}
+
+template<typename F>
+NormBounds<Base<F>> KyFanSchatten
+( const ElementalMatrix<F>& APre, Int k, Base<F> p, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int minDim = Min(A.Height(),A.Width());
+    if( minDim == 0 )
+        return NormBounds<Real>();
+
+    DistMatrix<F> Q(g), B(g);
+    RangeFinder( A, Q, rank, ctrl );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+
+    DistMatrix<F> E( A );
+    Gemm( NORMAL, NORMAL, F(-1), Q, B, F(1), E );
+    const Real tail = FrobeniusNorm( E );
+
+    DistMatrix<Real,VR,STAR> s(g);
+    SVDCtrl<Real> svdCtrl;
+    svdCtrl.overwrite = true;
+    SVD( B, s, svdCtrl );
+
+    // B only has rank+oversample rows, so its singular values are cheaply
+    // replicated
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( s );
+    return Finish( s_STAR_STAR.Matrix(), k, minDim, tail, p );
+}
+
+} // namespace norm_bounds
+
+template<typename F>
+NormBounds<Base<F>> KyFanSchattenNormBounds
+( const Matrix<F>& A, Int k, Base<F> p, const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( k < 1 || k > Min(A.Height(),A.Width()) )
+        LogicError("Invalid index of KyFanSchatten norm");
+    return norm_bounds::KyFanSchatten( A, k, p, k, ctrl );
+}
+
+template<typename F>
+NormBounds<Base<F>> KyFanSchattenNormBounds
+( const ElementalMatrix<F>& A, Int k, Base<F> p,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( k < 1 || k > Min(A.Height(),A.Width()) )
+        LogicError("Invalid index of KyFanSchatten norm");
+    return norm_bounds::KyFanSchatten( A, k, p, k, ctrl );
+}
+
+template<typename F>
+NormBounds<Base<F>> KyFanNormBounds
+( const Matrix<F>& A, Int k, const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return KyFanSchattenNormBounds( A, k, Base<F>(1), ctrl );
+}
+
+template<typename F>
+NormBounds<Base<F>> KyFanNormBounds
+( const ElementalMatrix<F>& A, Int k, const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return KyFanSchattenNormBounds( A, k, Base<F>(1), ctrl );
+}
+
+template<typename F>
+NormBounds<Base<F>> SchattenNormBounds
+( const Matrix<F>& A, Base<F> p, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( rank < 1 )
+        LogicError("The sketch rank must be positive");
+    const Int minDim = Min(A.Height(),A.Width());
+    return norm_bounds::KyFanSchatten( A, minDim, p, rank, ctrl );
+}
+
+template<typename F>
+NormBounds<Base<F>> SchattenNormBounds
+( const ElementalMatrix<F>& A, Base<F> p, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( rank < 1 )
+        LogicError("The sketch rank must be positive");
+    const Int minDim = Min(A.Height(),A.Width());
+    return norm_bounds::KyFanSchatten( A, minDim, p, rank, ctrl );
+}
+
+template<typename F>
+NormBounds<Base<F>> NuclearNormBounds
+( const Matrix<F>& A, Int rank, const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return SchattenNormBounds( A, Base<F>(1), rank, ctrl );
+}
+
+template<typename F>
+NormBounds<Base<F>> NuclearNormBounds
+( const ElementalMatrix<F>& A, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return SchattenNormBounds( A, Base<F>(1), rank, ctrl );
+}
+
+template<typename F>
+NormBounds<Base<F>> TwoNormBounds
+( const Matrix<F>& A, Int rank, const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( rank < 1 )
+        LogicError("The sketch rank must be positive");
+    return norm_bounds::KyFanSchatten( A, 1, Base<F>(1), rank, ctrl );
+}
+
+template<typename F>
+NormBounds<Base<F>> TwoNormBounds
+( const ElementalMatrix<F>& A, Int rank,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( rank < 1 )
+        LogicError("The sketch rank must be positive");
+    return norm_bounds::KyFanSchatten( A, 1, Base<F>(1), rank, ctrl );
+}
+
+#define PROTO(F) \
+  template NormBounds<Base<F>> KyFanSchattenNormBounds \
+  ( const Matrix<F>& A, Int k, Base<F> p, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template NormBounds<Base<F>> KyFanSchattenNormBounds \
+  ( const ElementalMatrix<F>& A, Int k, Base<F> p, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template NormBounds<Base<F>> KyFanNormBounds \
+  ( const Matrix<F>& A, Int k, const RandomizedCtrl<Base<F>>& ctrl ); \
+  template NormBounds<Base<F>> KyFanNormBounds \
+  ( const ElementalMatrix<F>& A, Int k, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template NormBounds<Base<F>> SchattenNormBounds \
+  ( const Matrix<F>& A, Base<F> p, Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template NormBounds<Base<F>> SchattenNormBounds \
+  ( const ElementalMatrix<F>& A, Base<F> p, Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template NormBounds<Base<F>> NuclearNormBounds \
+  ( const Matrix<F>& A, Int rank, const RandomizedCtrl<Base<F>>& ctrl ); \
+  template NormBounds<Base<F>> NuclearNormBounds \
+  ( const ElementalMatrix<F>& A, Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template NormBounds<Base<F>> TwoNormBounds \
+  ( const Matrix<F>& A, Int rank, const RandomizedCtrl<Base<F>>& ctrl ); \
+  template NormBounds<Base<F>> TwoNormBounds \
+  ( const ElementalMatrix<F>& A, Int rank, \
+    const RandomizedCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,202 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./ApplyPacked/Util.hpp"
+
+namespace El {
+
+template<typename F>
+CompactWY<F>::CompactWY
+( Int offset,
+  const AbstractDistMatrix<F>& H,
+  const AbstractDistMatrix<F>& householderScalarsPre,
+  Int aggregation )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( H, householderScalarsPre ))
+    if( aggregation < 1 )
+        LogicError("The aggregation factor must be positive");
+    const Grid& g = H.Grid();
+    const Int m = H.Height();
+    const Int diagLength = H.DiagonalLength(offset);
+
+    // Gather the entire set of Householder scalars once
+    DistMatrix<F,STAR,STAR> householderScalars( householderScalarsPre );
+    if( householderScalars.Height() != diagLength )
+        LogicError
+        ("householderScalars must be the same length as H's offset diag");
+    householderScalars_ = householderScalars.LockedMatrix();
+
+    height_ = m;
+    blocksize_ = aggregation*El::Blocksize();
+    iOff_ = ( offset>=0 ? 0 : -offset );
+    const Int jOff = ( offset>=0 ? offset : 0 );
+
+    const Int numPanels = (diagLength+blocksize_-1) / blocksize_;
+    panels_.assign( numPanels, DistMatrix<F,VC,STAR>(g) );
+    grams_.resize( numPanels );
+    panels_MC_STAR_.clear();
+    panels_MR_STAR_.clear();
+
+    auto HPan = unique_ptr<AbstractDistMatrix<F>>( H.Construct(g,H.Root()) );
+    DistMatrix<F> HPanCopy(g);
+    for( Int p=0; p<numPanels; ++p )
+    {
+        const Int k = p*blocksize_;
+        const Int nb = Min(blocksize_,diagLength-k);
+        const Int ki = k+iOff_;
+        const Int kj = k+jOff;
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        LockedView( *HPan, H, IR(ki,m), IR(kj,kj+nb) );
+        Copy( *HPan, HPanCopy );
+        MakeTrapezoidal( LOWER, HPanCopy );
+        FillDiagonal( HPanCopy, F(1) );
+        panels_[p] = HPanCopy;
+
+        // Both triangles of the Gram matrix are kept since forward and
+        // backward applications respectively use its lower and upper halves
+        auto& gram = grams_[p];
+        Zeros( gram, nb, nb );
+        Herk
+        ( LOWER, ADJOINT,
+          Base<F>(1), panels_[p].LockedMatrix(), Base<F>(0), gram );
+        El::AllReduce( gram, panels_[p].ColComm() );
+        MakeHermitian( LOWER, gram );
+    }
+}
+
+template<typename F>
+void CompactWY<F>::Apply
+( LeftOrRight side,
+  ForwardOrBackward order,
+  Conjugation conjugation,
+  AbstractDistMatrix<F>& APre ) const
+{
+    DEBUG_CSE
+    const bool onLeft = ( side == LEFT );
+    if( onLeft && APre.Height() != height_ )
+        LogicError("A's height must match that of the reflectors");
+    if( !onLeft && APre.Width() != height_ )
+        LogicError("A's width must match the height of the reflectors");
+    const Int numPanels = panels_.size();
+    if( numPanels == 0 )
+        return;
+    const Grid& g = panels_[0].Grid();
+    DEBUG_ONLY(
+      if( APre.Grid() != g )
+          LogicError("A and the reflectors must have the same grid");
+    )
+
+    // The cached redistributions assume zero alignments
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.rowConstrain = true;
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre, ctrl );
+    auto& A = AProx.Get();
+    const Int m = height_;
+
+    if( onLeft && Int(panels_MC_STAR_.size()) != numPanels )
+    {
+        panels_MC_STAR_.assign( numPanels, DistMatrix<F,MC,STAR>(g) );
+        for( Int p=0; p<numPanels; ++p )
+        {
+            const Int ki = p*blocksize_+iOff_;
+            panels_MC_STAR_[p].AlignCols( Mod(ki,g.Height()) );
+            panels_MC_STAR_[p] = panels_[p];
+        }
+    }
+    if( !onLeft && Int(panels_MR_STAR_.size()) != numPanels )
+    {
+        panels_MR_STAR_.assign( numPanels, DistMatrix<F,MR,STAR>(g) );
+        for( Int p=0; p<numPanels; ++p )
+        {
+            const Int ki = p*blocksize_+iOff_;
+            panels_MR_STAR_[p].AlignCols( Mod(ki,g.Width()) );
+            panels_MR_STAR_[p] = panels_[p];
+        }
+    }
+
+    // Forward applications from the left (and backward applications from
+    // the right) involve lower-triangular UT transforms
+    const UpperOrLower uplo = ( onLeft == (order==FORWARD) ? LOWER : UPPER );
+
+    DistMatrix<F,STAR,STAR> SInv_STAR_STAR(g);
+    DistMatrix<F,STAR,MR  > Z_STAR_MR(g);
+    DistMatrix<F,STAR,VR  > Z_STAR_VR(g);
+    DistMatrix<F,STAR,MC  > ZAdj_STAR_MC(g);
+    DistMatrix<F,STAR,VC  > ZAdj_STAR_VC(g);
+    for( Int step=0; step<numPanels; ++step )
+    {
+        const Int p = ( order==FORWARD ? step : numPanels-1-step );
+        const Int k = p*blocksize_;
+        const Int nb = grams_[p].Height();
+        const Int ki = k+iOff_;
+
+        // Form the small triangular matrix needed for the UT transform
+        SInv_STAR_STAR.Resize( nb, nb );
+        SInv_STAR_STAR.Matrix() = grams_[p];
+        MakeTrapezoidal( uplo, SInv_STAR_STAR.Matrix() );
+        auto householderScalars1 = householderScalars_( IR(k,k+nb), ALL );
+        FixDiagonal
+        ( conjugation, householderScalars1, SInv_STAR_STAR.Matrix() );
+
+        if( onLeft )
+        {
+            auto ABot = A( IR(ki,m), ALL );
+            const auto& HPan_MC_STAR = panels_MC_STAR_[p];
+
+            // Z := inv(SInv) HPan' ABot
+            Z_STAR_MR.AlignWith( ABot );
+            LocalGemm( ADJOINT, NORMAL, F(1), HPan_MC_STAR, ABot, Z_STAR_MR );
+            Z_STAR_VR.AlignWith( ABot );
+            Contract( Z_STAR_MR, Z_STAR_VR );
+            LocalTrsm
+            ( LEFT, uplo, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, Z_STAR_VR );
+
+            // ABot := (I - HPan inv(SInv) HPan') ABot = ABot - HPan Z
+            Z_STAR_MR = Z_STAR_VR;
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), HPan_MC_STAR, Z_STAR_MR, F(1), ABot );
+        }
+        else
+        {
+            auto ARight = A( ALL, IR(ki,m) );
+            const auto& HPan_MR_STAR = panels_MR_STAR_[p];
+
+            // Z := ARight HPan inv(SInv), which is stored as its adjoint
+            ZAdj_STAR_MC.AlignWith( ARight );
+            LocalGemm
+            ( ADJOINT, ADJOINT, F(1), HPan_MR_STAR, ARight, ZAdj_STAR_MC );
+            ZAdj_STAR_VC.AlignWith( ARight );
+            Contract( ZAdj_STAR_MC, ZAdj_STAR_VC );
+            LocalTrsm
+            ( LEFT, uplo, ADJOINT, NON_UNIT,
+              F(1), SInv_STAR_STAR, ZAdj_STAR_VC );
+
+            // ARight := ARight (I - HPan inv(SInv) HPan')
+            ZAdj_STAR_MC = ZAdj_STAR_VC;
+            LocalGemm
+            ( ADJOINT, ADJOINT,
+              F(-1), ZAdj_STAR_MC, HPan_MR_STAR, F(1), ARight );
+        }
+    }
+}
+
+#define PROTO(F) template class CompactWY<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -27,6 +27,22 @@ extern "C" {
   ElError ElLinearSolveDistSparse_ ## SIG \
   ( ElConstDistSparseMatrix_ ## SIG A, ElDistMultiVec_ ## SIG B ) \
   { EL_TRY( LinearSolve( *CReflect(A), *CReflect(B) ) ) } \
+  /* Solve the numProblems systems A_k X_k = B_k, where A_k and B_k
+     begin at A+k*AStride and B+k*BStride, within a single call */ \
+  ElError ElLinearSolveBatch_ ## SIG \
+  ( ElInt numProblems, ElInt n, ElInt numRHS, \
+    const CREFLECT(F)* A, ElInt ALDim, ElInt AStride, \
+          CREFLECT(F)* B, ElInt BLDim, ElInt BStride ) \
+  { EL_TRY( \
+      Matrix<F> AMat; \
+      Matrix<F> BMat; \
+      for( ElInt k=0; k<numProblems; ++k ) \
+      { \
+          AMat.LockedAttach( n, n, CReflect(A+k*AStride), ALDim ); \
+          BMat.Attach( n, numRHS, CReflect(B+k*BStride), BLDim ); \
+          LinearSolve( AMat, BMat ); \
+      } \
+    ) } \
   /* Expert versions
      ^^^^^^^^^^^^^^^ */ \
   ElError ElLinearSolveXSparse_ ## SIG \
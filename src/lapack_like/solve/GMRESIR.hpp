@@ -0,0 +1,216 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_GMRESIR_HPP
+#define EL_SOLVE_GMRESIR_HPP
+
+// GMRES-based iterative refinement (GMRES-IR), as in
+//
+//   Erin Carson and Nicholas J. Higham,
+//   "Accelerating the solution of linear systems by iterative refinement
+//    in three precisions",
+//   SIAM J. Sci. Comput., Vol. 40, No. 2, pp. A817--A847, 2018.
+//
+// The residuals are formed in the working precision and each correction
+// equation, A d = r, is solved with FGMRES preconditioned by a factorization
+// computed in a lower precision. Unlike classical iterative refinement, this
+// converges for condition numbers up to roughly the inverse of the working
+// (rather than the factorization) precision.
+
+namespace El {
+namespace gmres_ir {
+
+template<typename F,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<F>& b,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<F> Real;
+    const Real bNorm = MaxNorm( b );
+    if( bNorm == Real(0) )
+        return 0;
+
+    // Compute the initial guess from the low-precision factorization
+    // ==============================================================
+    auto x = b;
+    precond( x );
+
+    // r := b - A x
+    // ============
+    auto r = b;
+    applyA( F(-1), x, F(1), r );
+    Real errorNorm = MaxNorm( r );
+    if( ctrl.progress )
+        Output("original rel error: ",errorNorm/bNorm);
+
+    Matrix<F> xCand, rCand;
+    Int refineIt = 0;
+    while( refineIt < ctrl.maxRefineIts )
+    {
+        if( errorNorm/bNorm <= ctrl.relTolRefine )
+        {
+            if( ctrl.progress )
+                Output(errorNorm/bNorm," <= ",ctrl.relTolRefine);
+            break;
+        }
+
+        // Solve A d = r with preconditioned FGMRES (r is overwritten by d)
+        // ----------------------------------------------------------------
+        xCand = r;
+        FGMRES
+        ( applyA, precond, xCand, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+        xCand += x;
+
+        // Check the new residual
+        // ----------------------
+        rCand = b;
+        applyA( F(-1), xCand, F(1), rCand );
+        const Real newErrorNorm = MaxNorm( rCand );
+        if( ctrl.progress )
+            Output("refined rel error: ",newErrorNorm/bNorm);
+        ++refineIt;
+        if( newErrorNorm >= errorNorm )
+            break;
+
+        x = xCand;
+        r = rCand;
+        errorNorm = newErrorNorm;
+    }
+    b = x;
+    return refineIt;
+}
+
+template<typename F,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<F>& b,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<F> Real;
+    const int commRank = mpi::Rank( b.Comm() );
+    const Real bNorm = MaxNorm( b );
+    if( bNorm == Real(0) )
+        return 0;
+
+    // Compute the initial guess from the low-precision factorization
+    // ==============================================================
+    DistMultiVec<F> x(b.Comm());
+    x = b;
+    precond( x );
+
+    // r := b - A x
+    // ============
+    DistMultiVec<F> r(b.Comm());
+    r = b;
+    applyA( F(-1), x, F(1), r );
+    Real errorNorm = MaxNorm( r );
+    if( ctrl.progress && commRank == 0 )
+        Output("original rel error: ",errorNorm/bNorm);
+
+    DistMultiVec<F> xCand(b.Comm()), rCand(b.Comm());
+    Int refineIt = 0;
+    while( refineIt < ctrl.maxRefineIts )
+    {
+        if( errorNorm/bNorm <= ctrl.relTolRefine )
+        {
+            if( ctrl.progress && commRank == 0 )
+                Output(errorNorm/bNorm," <= ",ctrl.relTolRefine);
+            break;
+        }
+
+        // Solve A d = r with preconditioned FGMRES (r is overwritten by d)
+        // ----------------------------------------------------------------
+        xCand = r;
+        FGMRES
+        ( applyA, precond, xCand, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+        xCand += x;
+
+        // Check the new residual
+        // ----------------------
+        rCand = b;
+        applyA( F(-1), xCand, F(1), rCand );
+        const Real newErrorNorm = MaxNorm( rCand );
+        if( ctrl.progress && commRank == 0 )
+            Output("refined rel error: ",newErrorNorm/bNorm);
+        ++refineIt;
+        if( newErrorNorm >= errorNorm )
+            break;
+
+        x = xCand;
+        r = rCand;
+        errorNorm = newErrorNorm;
+    }
+    b = x;
+    return refineIt;
+}
+
+template<typename F,class ApplyAType,class PrecondType>
+Int Solve
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    Int mostRefineIts = 0;
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        const Int refineIts = Single( applyA, precond, b, ctrl );
+        mostRefineIts = Max(mostRefineIts,refineIts);
+    }
+    return mostRefineIts;
+}
+
+template<typename F,class ApplyAType,class PrecondType>
+Int Solve
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostRefineIts = 0;
+    DistMultiVec<F> u(B.Comm());
+    Zeros( u, height, 1 );
+    auto& BLoc = B.Matrix();
+    auto& uLoc = u.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        auto bLoc = BLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        const Int refineIts = Single( applyA, precond, u, ctrl );
+        bLoc = uLoc;
+        mostRefineIts = Max(mostRefineIts,refineIts);
+    }
+    return mostRefineIts;
+}
+
+} // namespace gmres_ir
+} // namespace El
+
+#endif // ifndef EL_SOLVE_GMRESIR_HPP
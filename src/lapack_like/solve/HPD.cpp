@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./GMRESIR.hpp"
+
 namespace El {
 
 namespace hpd_solve {
@@ -68,6 +70,176 @@ void HPDSolve
     hpd_solve::Overwrite( uplo, orientation, ACopy, B );
 }
 
+namespace hpd_solve {
+
+// Since A^T X = B is equivalent to A conj(X) = conj(B) for Hermitian A, the
+// transposed case is handled by conjugating the right-hand sides
+
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,Int>
+MixedPrecisionHelper
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<F>& A,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    Timer timer;
+
+    Matrix<FLow> ALow;
+    Copy( A, ALow );
+    if( ctrl.time )
+        timer.Start();
+    Cholesky( uplo, ALow );
+    if( ctrl.time )
+        Output("Low-precision Cholesky: ",timer.Stop()," secs");
+
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+        Hemv( uplo, alpha, A, X, beta, Y );
+      };
+    Matrix<FLow> WLow;
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        Copy( W, WLow );
+        cholesky::SolveAfter( uplo, NORMAL, ALow, WLow );
+        Copy( WLow, W );
+      };
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    if( ctrl.time )
+        timer.Start();
+    const Int refineIts = gmres_ir::Solve( applyA, precond, B, ctrl );
+    if( ctrl.time )
+        Output("GMRES-IR: ",timer.Stop()," secs");
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    return refineIts;
+}
+
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,Int>
+MixedPrecisionHelper
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<F>& A,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    HPDSolve( uplo, orientation, A, B );
+    return 0;
+}
+
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,Int>
+MixedPrecisionHelper
+( UpperOrLower uplo,
+  Orientation orientation,
+  const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& BPre,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    Timer timer;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const int commRank = g.Rank();
+
+    DistMatrix<FLow> ALow(g);
+    Copy( A, ALow );
+    if( ctrl.time && commRank == 0 )
+        timer.Start();
+    Cholesky( uplo, ALow );
+    if( ctrl.time && commRank == 0 )
+        Output("Low-precision Cholesky: ",timer.Stop()," secs");
+
+    // FGMRES is only implemented for DistMultiVec, so the vectors are
+    // temporarily redistributed into [VC,* ] for the products and solves
+    DistMatrix<F,VC,STAR> X_VC_STAR(g), Y_VC_STAR(g);
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+        Copy( X, X_VC_STAR );
+        Copy( Y, Y_VC_STAR );
+        Hemv( uplo, alpha, A, X_VC_STAR, beta, Y_VC_STAR );
+        Copy( Y_VC_STAR, Y );
+      };
+    DistMatrix<F,VC,STAR> W_VC_STAR(g);
+    DistMatrix<FLow> WLow(g);
+    auto precond =
+      [&]( DistMultiVec<F>& W )
+      {
+        Copy( W, W_VC_STAR );
+        Copy( W_VC_STAR, WLow );
+        cholesky::SolveAfter( uplo, NORMAL, ALow, WLow );
+        Copy( WLow, W_VC_STAR );
+        Copy( W_VC_STAR, W );
+      };
+
+    DistMultiVec<F> B(g.Comm());
+    Copy( BPre, B );
+    if( orientation == TRANSPOSE )
+        Conjugate( B.Matrix() );
+    if( ctrl.time && commRank == 0 )
+        timer.Start();
+    const Int refineIts = gmres_ir::Solve( applyA, precond, B, ctrl );
+    if( ctrl.time && commRank == 0 )
+        Output("GMRES-IR: ",timer.Stop()," secs");
+    if( orientation == TRANSPOSE )
+        Conjugate( B.Matrix() );
+    Copy( B, BPre );
+    return refineIts;
+}
+
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,Int>
+MixedPrecisionHelper
+( UpperOrLower uplo,
+  Orientation orientation,
+  const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    HPDSolve( uplo, orientation, A, B );
+    return 0;
+}
+
+template<typename F>
+Int MixedPrecision
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<F>& A,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return MixedPrecisionHelper( uplo, orientation, A, B, ctrl );
+}
+
+template<typename F>
+Int MixedPrecision
+( UpperOrLower uplo,
+  Orientation orientation,
+  const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return MixedPrecisionHelper( uplo, orientation, A, B, ctrl );
+}
+
+} // namespace hpd_solve
+
 // TODO: Add iterative refinement parameter
 template<typename F>
 void HPDSolve
@@ -127,6 +299,14 @@ void HPDSolve
   template void hpd_solve::Overwrite \
   ( UpperOrLower uplo, Orientation orientation, \
     ElementalMatrix<F>& A, ElementalMatrix<F>& B ); \
+  template Int hpd_solve::MixedPrecision \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Matrix<F>& A, Matrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int hpd_solve::MixedPrecision \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const ElementalMatrix<F>& A, ElementalMatrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
   template void HPDSolve \
   ( UpperOrLower uplo, Orientation orientation, \
     const Matrix<F>& A, Matrix<F>& B ); \
@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace kron {
+
+// Throw if w_B(i) + w_A(j) = 0 for some (i,j). Since the eigenvalues are
+// available to every process, the test is performed redundantly (so that all
+// processes throw together) in O((nA+nB) log nA) work.
+template<typename Real>
+void CheckNonsingular( const Matrix<Real>& wA, const Matrix<Real>& wB )
+{
+    DEBUG_CSE
+    const Int nA = wA.Height();
+    const Int nB = wB.Height();
+    vector<Real> negA( nA );
+    for( Int j=0; j<nA; ++j )
+        negA[j] = -wA(j);
+    std::sort( negA.begin(), negA.end() );
+    for( Int i=0; i<nB; ++i )
+        if( std::binary_search( negA.begin(), negA.end(), wB(i) ) )
+            throw SingularMatrixException();
+}
+
+} // namespace kron
+
+template<typename F>
+void KroneckerSumSolve
+( const Matrix<Base<F>>& wA,
+  const Matrix<F>& ZA,
+  const Matrix<Base<F>>& wB,
+  const Matrix<F>& ZB,
+        Matrix<F>& X )
+{
+    DEBUG_CSE
+    const Int nA = ZA.Height();
+    const Int nB = ZB.Height();
+    if( X.Height() != nB || X.Width() != nA )
+        LogicError
+        ("X was ",X.Height()," x ",X.Width()," but should have been ",
+         nB," x ",nA);
+    kron::CheckNonsingular( wA, wB );
+
+    // X := conj(Z_B^H X conj(Z_A)) = conj(Z_B^H X) Z_A
+    Matrix<F> T;
+    Gemm( ADJOINT, NORMAL, F(1), ZB, X, T );
+    Conjugate( T );
+    Gemm( NORMAL, NORMAL, F(1), T, ZA, X );
+
+    // Solve the diagonal system (the denominators are real, and so they
+    // commute with the conjugation)
+    for( Int j=0; j<nA; ++j )
+        for( Int i=0; i<nB; ++i )
+            X(i,j) /= wB(i) + wA(j);
+    Conjugate( X );
+
+    // X := Z_B X Z_A^T
+    Gemm( NORMAL, NORMAL, F(1), ZB, X, T );
+    Gemm( NORMAL, TRANSPOSE, F(1), T, ZA, X );
+}
+
+template<typename F>
+void KroneckerSumSolve
+( const ElementalMatrix<Base<F>>& wA,
+  const ElementalMatrix<F>& ZAPre,
+  const ElementalMatrix<Base<F>>& wB,
+  const ElementalMatrix<F>& ZBPre,
+        ElementalMatrix<F>& XPre )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+
+    DistMatrixReadProxy<F,F,MC,MR> ZAProx( ZAPre ), ZBProx( ZBPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& ZA = ZAProx.GetLocked();
+    auto& ZB = ZBProx.GetLocked();
+    auto& X = XProx.Get();
+
+    const Grid& g = X.Grid();
+    const Int nA = ZA.Height();
+    const Int nB = ZB.Height();
+    if( X.Height() != nB || X.Width() != nA )
+        LogicError
+        ("X was ",X.Height()," x ",X.Width()," but should have been ",
+         nB," x ",nA);
+    DistMatrix<Real,STAR,STAR> wA_STAR_STAR( wA ), wB_STAR_STAR( wB );
+    auto& wALoc = wA_STAR_STAR.LockedMatrix();
+    auto& wBLoc = wB_STAR_STAR.LockedMatrix();
+    kron::CheckNonsingular( wALoc, wBLoc );
+
+    // X := conj(Z_B^H X) Z_A
+    DistMatrix<F> T(g);
+    Gemm( ADJOINT, NORMAL, F(1), ZB, X, T );
+    Conjugate( T );
+    Gemm( NORMAL, NORMAL, F(1), T, ZA, X );
+
+    // Solve the diagonal system
+    const Int localHeight = X.LocalHeight();
+    const Int localWidth = X.LocalWidth();
+    auto& XLoc = X.Matrix();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Real omegaA = wALoc(X.GlobalCol(jLoc));
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            XLoc(iLoc,jLoc) /= wBLoc(X.GlobalRow(iLoc)) + omegaA;
+    }
+    Conjugate( X );
+
+    // X := Z_B X Z_A^T
+    Gemm( NORMAL, NORMAL, F(1), ZB, X, T );
+    Gemm( NORMAL, TRANSPOSE, F(1), T, ZA, X );
+}
+
+template<typename F>
+void KroneckerSumSolve
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> ACopy( A ), BCopy( B ), ZA, ZB;
+    Matrix<Real> wA, wB;
+    HermitianEig( uplo, ACopy, wA, ZA );
+    HermitianEig( uplo, BCopy, wB, ZB );
+    KroneckerSumSolve( wA, ZA, wB, ZB, X );
+}
+
+template<typename F>
+void KroneckerSumSolve
+( UpperOrLower uplo,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+        ElementalMatrix<F>& X )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    DistMatrix<F> ACopy( A ), BCopy( B ), ZA(g), ZB(g);
+    DistMatrix<Real,VR,STAR> wA(g), wB(g);
+    HermitianEig( uplo, ACopy, wA, ZA );
+    HermitianEig( uplo, BCopy, wB, ZB );
+    KroneckerSumSolve( wA, ZA, wB, ZB, X );
+}
+
+#define PROTO(F) \
+  template void KroneckerSumSolve \
+  ( UpperOrLower uplo, \
+    const Matrix<F>& A, \
+    const Matrix<F>& B, \
+          Matrix<F>& X ); \
+  template void KroneckerSumSolve \
+  ( UpperOrLower uplo, \
+    const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+          ElementalMatrix<F>& X ); \
+  template void KroneckerSumSolve \
+  ( const Matrix<Base<F>>& wA, \
+    const Matrix<F>& ZA, \
+    const Matrix<Base<F>>& wB, \
+    const Matrix<F>& ZB, \
+          Matrix<F>& X ); \
+  template void KroneckerSumSolve \
+  ( const ElementalMatrix<Base<F>>& wA, \
+    const ElementalMatrix<F>& ZA, \
+    const ElementalMatrix<Base<F>>& wB, \
+    const ElementalMatrix<F>& ZB, \
+          ElementalMatrix<F>& X );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename F>
+KrylovSolveInfo KrylovSolve
+( const SparseMatrix<F>& A,
+        Matrix<F>& B,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( B.Height() != n )
+        LogicError("A and B did not conform");
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, F(1), A, X, F(0), Y );
+      };
+    auto precond = []( Matrix<F>& ) { };
+    Matrix<F> X;
+    Zeros( X, n, B.Width() );
+    auto info = KrylovSolve( applyA, precond, B, X, ctrl );
+    B = X;
+    return info;
+}
+
+template<typename F>
+KrylovSolveInfo KrylovSolve
+( const DistSparseMatrix<F>& A,
+        DistMultiVec<F>& B,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( B.Height() != n )
+        LogicError("A and B did not conform");
+    auto applyA =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, F(1), A, X, F(0), Y );
+      };
+    auto precond = []( DistMultiVec<F>& ) { };
+    DistMultiVec<F> X(B.Comm());
+    Zeros( X, n, B.Width() );
+    auto info = KrylovSolve( applyA, precond, B, X, ctrl );
+    B = X;
+    return info;
+}
+
+template<typename F>
+KrylovSolveInfo KrylovSolve
+( const SparseMatrix<F>& A,
+  const SparseLDLFactorization<F>& factorization,
+        Matrix<F>& B,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( B.Height() != n )
+        LogicError("A and B did not conform");
+    if( !factorization.Initialized() )
+        LogicError("The factorization has not been initialized");
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, F(1), A, X, F(0), Y );
+      };
+    auto precond = [&]( Matrix<F>& X ) { factorization.Solve( X ); };
+    Matrix<F> X;
+    Zeros( X, n, B.Width() );
+    auto info = KrylovSolve( applyA, precond, B, X, ctrl );
+    B = X;
+    return info;
+}
+
+template<typename F>
+KrylovSolveInfo KrylovSolve
+( const DistSparseMatrix<F>& A,
+  const DistSparseLDLFactorization<F>& factorization,
+        DistMultiVec<F>& B,
+  const KrylovSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( B.Height() != n )
+        LogicError("A and B did not conform");
+    if( !factorization.Initialized() )
+        LogicError("The factorization has not been initialized");
+    auto applyA =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, F(1), A, X, F(0), Y );
+      };
+    auto precond = [&]( DistMultiVec<F>& X ) { factorization.Solve( X ); };
+    DistMultiVec<F> X(B.Comm());
+    Zeros( X, n, B.Width() );
+    auto info = KrylovSolve( applyA, precond, B, X, ctrl );
+    B = X;
+    return info;
+}
+
+#define PROTO(F) \
+  template KrylovSolveInfo KrylovSolve \
+  ( const SparseMatrix<F>& A, \
+          Matrix<F>& B, \
+    const KrylovSolveCtrl<Base<F>>& ctrl ); \
+  template KrylovSolveInfo KrylovSolve \
+  ( const DistSparseMatrix<F>& A, \
+          DistMultiVec<F>& B, \
+    const KrylovSolveCtrl<Base<F>>& ctrl ); \
+  template KrylovSolveInfo KrylovSolve \
+  ( const SparseMatrix<F>& A, \
+    const SparseLDLFactorization<F>& factorization, \
+          Matrix<F>& B, \
+    const KrylovSolveCtrl<Base<F>>& ctrl ); \
+  template KrylovSolveInfo KrylovSolve \
+  ( const DistSparseMatrix<F>& A, \
+    const DistSparseLDLFactorization<F>& factorization, \
+          DistMultiVec<F>& B, \
+    const KrylovSolveCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
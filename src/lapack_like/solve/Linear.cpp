@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./GMRESIR.hpp"
+
 namespace El {
 
 namespace lu {
@@ -275,6 +277,155 @@ void LinearSolve
     lin_solve::ScaLAPACKHelper( A, B );
 }
 
+namespace lin_solve {
+
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,Int>
+MixedPrecisionHelper
+( const Matrix<F>& A,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    Timer timer;
+
+    Matrix<FLow> ALow;
+    Copy( A, ALow );
+    Permutation P;
+    if( ctrl.time )
+        timer.Start();
+    LU( ALow, P );
+    if( ctrl.time )
+        Output("Low-precision LU: ",timer.Stop()," secs");
+
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+        Gemv( NORMAL, alpha, A, X, beta, Y );
+      };
+    Matrix<FLow> WLow;
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        Copy( W, WLow );
+        lu::SolveAfter( NORMAL, ALow, P, WLow );
+        Copy( WLow, W );
+      };
+
+    if( ctrl.time )
+        timer.Start();
+    const Int refineIts = gmres_ir::Solve( applyA, precond, B, ctrl );
+    if( ctrl.time )
+        Output("GMRES-IR: ",timer.Stop()," secs");
+    return refineIts;
+}
+
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,Int>
+MixedPrecisionHelper
+( const Matrix<F>& A,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    LinearSolve( A, B );
+    return 0;
+}
+
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,Int>
+MixedPrecisionHelper
+( const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& BPre,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    Timer timer;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const int commRank = g.Rank();
+
+    DistMatrix<FLow> ALow(g);
+    Copy( A, ALow );
+    DistPermutation P(g);
+    if( ctrl.time && commRank == 0 )
+        timer.Start();
+    LU( ALow, P );
+    if( ctrl.time && commRank == 0 )
+        Output("Low-precision LU: ",timer.Stop()," secs");
+
+    // FGMRES is only implemented for DistMultiVec, so the vectors are
+    // temporarily redistributed into [VC,* ] for the products and solves
+    DistMatrix<F,VC,STAR> X_VC_STAR(g), Y_VC_STAR(g);
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+        Copy( X, X_VC_STAR );
+        Copy( Y, Y_VC_STAR );
+        Gemv( NORMAL, alpha, A, X_VC_STAR, beta, Y_VC_STAR );
+        Copy( Y_VC_STAR, Y );
+      };
+    DistMatrix<F,VC,STAR> W_VC_STAR(g);
+    DistMatrix<FLow> WLow(g);
+    auto precond =
+      [&]( DistMultiVec<F>& W )
+      {
+        Copy( W, W_VC_STAR );
+        Copy( W_VC_STAR, WLow );
+        lu::SolveAfter( NORMAL, ALow, P, WLow );
+        Copy( WLow, W_VC_STAR );
+        Copy( W_VC_STAR, W );
+      };
+
+    DistMultiVec<F> B(g.Comm());
+    Copy( BPre, B );
+    if( ctrl.time && commRank == 0 )
+        timer.Start();
+    const Int refineIts = gmres_ir::Solve( applyA, precond, B, ctrl );
+    if( ctrl.time && commRank == 0 )
+        Output("GMRES-IR: ",timer.Stop()," secs");
+    Copy( B, BPre );
+    return refineIts;
+}
+
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,Int>
+MixedPrecisionHelper
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    LinearSolve( A, B );
+    return 0;
+}
+
+template<typename F>
+Int MixedPrecision
+( const Matrix<F>& A,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return MixedPrecisionHelper( A, B, ctrl );
+}
+
+template<typename F>
+Int MixedPrecision
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return MixedPrecisionHelper( A, B, ctrl );
+}
+
+} // namespace lin_solve
+
 template<typename F>
 void LinearSolve
 ( const SparseMatrix<F>& A, Matrix<F>& B, 
@@ -302,6 +453,12 @@ void LinearSolve
   template void lin_solve::Overwrite( Matrix<F>& A, Matrix<F>& B ); \
   template void lin_solve::Overwrite \
   ( ElementalMatrix<F>& A, ElementalMatrix<F>& B ); \
+  template Int lin_solve::MixedPrecision \
+  ( const Matrix<F>& A, Matrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int lin_solve::MixedPrecision \
+  ( const ElementalMatrix<F>& A, ElementalMatrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
   template void LinearSolve( const Matrix<F>& A, Matrix<F>& B ); \
   template void LinearSolve \
   ( const ElementalMatrix<F>& A, \
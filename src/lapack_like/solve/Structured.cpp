@@ -0,0 +1,228 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+template<typename Real>
+void CopyFromComplex( const Matrix<Complex<Real>>& Z, Matrix<Real>& B )
+{
+    const Int m = Z.Height();
+    const Int n = Z.Width();
+    B.Resize( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            B(i,j) = RealPart(Z(i,j));
+}
+
+template<typename Real>
+void CopyFromComplex
+( const Matrix<Complex<Real>>& Z, Matrix<Complex<Real>>& B )
+{ B = Z; }
+
+} // anonymous namespace
+
+template<typename F>
+void CauchyLikeLU
+( const Matrix<F>& GPre, const Matrix<F>& HPre,
+  const vector<F>& xPre, const vector<F>& y,
+  Matrix<F>& A, Permutation& P )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = GPre.Height();
+    const Int r = GPre.Width();
+    if( HPre.Height() != n || HPre.Width() != r )
+        LogicError
+        ("G was ",n," x ",r," but H was ",HPre.Height()," x ",HPre.Width());
+    if( Int(xPre.size()) != n || Int(y.size()) != n )
+        LogicError("x and y must be of length ",n);
+
+    // The generators of each Schur complement overwrite those of its parent,
+    // and the row interchanges are applied to G and x
+    Matrix<F> G( GPre ), H( HPre );
+    vector<F> x( xPre );
+    F* GBuf = G.Buffer();
+    F* HBuf = H.Buffer();
+    const Int GLDim = G.LDim();
+    const Int HLDim = H.LDim();
+
+    A.Resize( n, n );
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+
+    for( Int k=0; k<n; ++k )
+    {
+        // Form the first column of the Schur complement and find its pivot
+        EL_PARALLEL_FOR
+        for( Int i=k; i<n; ++i )
+        {
+            F gamma = 0;
+            for( Int q=0; q<r; ++q )
+                gamma += GBuf[i+q*GLDim]*HBuf[k+q*HLDim];
+            ABuf[i+k*ALDim] = gamma / (x[i]-y[k]);
+        }
+        Int iPiv = k;
+        Real pivAbs = Abs(ABuf[k+k*ALDim]);
+        for( Int i=k+1; i<n; ++i )
+        {
+            const Real alphaAbs = Abs(ABuf[i+k*ALDim]);
+            if( alphaAbs > pivAbs )
+            {
+                iPiv = i;
+                pivAbs = alphaAbs;
+            }
+        }
+        if( pivAbs == Real(0) )
+            throw SingularMatrixException();
+        if( iPiv != k )
+        {
+            for( Int j=0; j<=k; ++j )
+                std::swap( ABuf[k+j*ALDim], ABuf[iPiv+j*ALDim] );
+            for( Int q=0; q<r; ++q )
+                std::swap( GBuf[k+q*GLDim], GBuf[iPiv+q*GLDim] );
+            std::swap( x[k], x[iPiv] );
+            P.Swap( k, iPiv );
+        }
+        const F pivot = ABuf[k+k*ALDim];
+
+        // Form the remainder of the k'th row of U and column of L
+        EL_PARALLEL_FOR
+        for( Int j=k+1; j<n; ++j )
+        {
+            F gamma = 0;
+            for( Int q=0; q<r; ++q )
+                gamma += GBuf[k+q*GLDim]*HBuf[j+q*HLDim];
+            ABuf[k+j*ALDim] = gamma / (x[k]-y[j]);
+        }
+        for( Int i=k+1; i<n; ++i )
+            ABuf[i+k*ALDim] /= pivot;
+
+        // The generators of the next Schur complement are
+        //   G(i,:) := G(i,:) - L(i,k) G(k,:) and
+        //   H(j,:) := H(j,:) - (U(k,j)/U(k,k)) H(k,:)
+        for( Int q=0; q<r; ++q )
+        {
+            const F gamma = GBuf[k+q*GLDim];
+            const F eta = HBuf[k+q*HLDim] / pivot;
+            F* g = &GBuf[q*GLDim];
+            F* h = &HBuf[q*HLDim];
+            EL_PARALLEL_FOR
+            for( Int i=k+1; i<n; ++i )
+            {
+                g[i] -= ABuf[i+k*ALDim]*gamma;
+                h[i] -= ABuf[k+i*ALDim]*eta;
+            }
+        }
+    }
+}
+
+template<typename F>
+void CauchyLikeSolve
+( const Matrix<F>& G, const Matrix<F>& H,
+  const vector<F>& x, const vector<F>& y,
+  Matrix<F>& B )
+{
+    DEBUG_CSE
+    if( B.Height() != G.Height() )
+        LogicError("B must be the same height as the generators");
+    Matrix<F> A;
+    Permutation P;
+    CauchyLikeLU( G, H, x, y, A, P );
+    lu::SolveAfter( NORMAL, A, P, B );
+}
+
+template<typename F>
+void ToeplitzSolve( const vector<F>& a, Matrix<F>& B )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Int n = B.Height();
+    const Int numRHS = B.Width();
+    if( n == 0 )
+        return;
+    if( Int(a.size()) != 2*n-1 )
+        LogicError("a was of length ",a.size()," but should be ",2*n-1);
+    const Real pi = Pi<Real>();
+    auto t = [&]( Int k ) { return C(a[k+(n-1)]); };
+
+    // Z_1 T - T Z_{-1} = e_0 u^T + v e_{n-1}^T, with
+    //   u = [t_{n-1}-t_{-1}, ..., t_1-t_{-(n-1)}, 2 t_0] and
+    //   v = [0, t_{1-n}+t_1, ..., t_{-1}+t_{n-1}]
+    Matrix<C> GT, HT;
+    Zeros( GT, n, 2 );
+    Zeros( HT, n, 2 );
+    GT(0,0) = C(1);
+    for( Int i=1; i<n; ++i )
+        GT(i,1) = t(i-n) + t(i);
+    for( Int j=0; j<n-1; ++j )
+        HT(j,0) = t(n-1-j) - t(-j-1);
+    HT(n-1,0) = Real(2)*t(0);
+    HT(n-1,1) = C(1);
+
+    // With F the unitary DFT (as in Fourier) and D = diag(exp(pi i j/n)),
+    // Z_1 = F^H diag(x) F and Z_{-1} = D F^H diag(y) F D^H for
+    // x_k = exp(-2 pi i k/n) and y_k = exp(-pi i (2k+1)/n), so that
+    //
+    //   diag(x) (F T D F^H) - (F T D F^H) diag(y) = (F G_T) (F^H D H_T)^T
+    //
+    vector<C> diagScale( n ), x( n ), y( n );
+    for( Int j=0; j<n; ++j )
+    {
+        const Real theta = pi*j/n;
+        diagScale[j] = C(Cos(theta),Sin(theta));
+        x[j] = C(Cos(2*theta),-Sin(2*theta));
+        y[j] = C(Cos(pi*(2*j+1)/n),-Sin(pi*(2*j+1)/n));
+    }
+    for( Int q=0; q<2; ++q )
+        for( Int j=0; j<n; ++j )
+            HT(j,q) *= diagScale[j];
+    FourierOperator<Real> fourier( n );
+    Matrix<C> G, H;
+    fourier.Apply( NORMAL, GT, G );
+    fourier.Apply( ADJOINT, HT, H );
+
+    // T X = B is equivalent to (F T D F^H) (F D^H X) = F B
+    Matrix<C> BC( n, numRHS ), Y;
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<n; ++i )
+            BC(i,j) = C(B(i,j));
+    fourier.Apply( NORMAL, BC, Y );
+    CauchyLikeSolve( G, H, x, y, Y );
+    fourier.Apply( ADJOINT, Y, BC );
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<n; ++i )
+            BC(i,j) *= diagScale[i];
+    CopyFromComplex( BC, B );
+}
+
+#define PROTO(F) \
+  template void CauchyLikeLU \
+  ( const Matrix<F>& G, const Matrix<F>& H, \
+    const vector<F>& x, const vector<F>& y, \
+    Matrix<F>& A, Permutation& P ); \
+  template void CauchyLikeSolve \
+  ( const Matrix<F>& G, const Matrix<F>& H, \
+    const vector<F>& x, const vector<F>& y, \
+    Matrix<F>& B ); \
+  template void ToeplitzSolve( const vector<F>& a, Matrix<F>& B );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
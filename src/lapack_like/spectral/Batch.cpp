@@ -0,0 +1,709 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace batch {
+
+// A chunk of NUM_LANES members is stored so that the lanes are contiguous:
+// entry (i,j) of the member in lane l of an m x n chunk is at
+// (i+j*m)*NUM_LANES + l. Every loop over the lanes has a fixed trip count and
+// no dependencies between iterations so that it can be vectorized.
+
+template<typename F>
+void PackChunk
+( Int m,
+  Int n,
+  Int numUsed,
+  const F* A, Int ALDim, Int AStride,
+  bool adjoint,
+  vector<F>& X )
+{
+    DEBUG_CSE
+    const Int L = NUM_LANES;
+    X.assign( m*n*L, F(0) );
+    for( Int l=0; l<numUsed; ++l )
+    {
+        const F* Al = &A[l*AStride];
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                X[(i+j*m)*L+l] =
+                  ( adjoint ? Conj(Al[j+i*ALDim]) : Al[i+j*ALDim] );
+    }
+}
+
+template<typename F>
+void PackHermitianChunk
+( UpperOrLower uplo,
+  Int n,
+  Int numUsed,
+  const F* A, Int ALDim, Int AStride,
+  vector<F>& X )
+{
+    DEBUG_CSE
+    const Int L = NUM_LANES;
+    X.assign( n*n*L, F(0) );
+    for( Int l=0; l<numUsed; ++l )
+    {
+        const F* Al = &A[l*AStride];
+        for( Int j=0; j<n; ++j )
+        {
+            X[(j+j*n)*L+l] = RealPart(Al[j+j*ALDim]);
+            for( Int i=j+1; i<n; ++i )
+            {
+                const F alpha =
+                  ( uplo == LOWER ? Al[i+j*ALDim] : Conj(Al[j+i*ALDim]) );
+                X[(i+j*n)*L+l] = alpha;
+                X[(j+i*n)*L+l] = Conj(alpha);
+            }
+        }
+    }
+}
+
+template<typename F>
+void IdentityChunk( Int n, vector<F>& Z )
+{
+    const Int L = NUM_LANES;
+    Z.assign( n*n*L, F(0) );
+    for( Int j=0; j<n; ++j )
+        for( Int l=0; l<L; ++l )
+            Z[(j+j*n)*L+l] = F(1);
+}
+
+// Cyclic two-sided Jacobi for Hermitian matrices: each rotation
+// G = diag(1,conj(phase)) [c, s; -s, c] (acting on rows/columns p and q)
+// annihilates entry (p,q), and the rotations are optionally accumulated into Z
+template<typename F>
+void HermitianJacobi
+( Int n,
+  vector<F>& X,
+  vector<F>* Z,
+  Int maxSweeps,
+  Base<F> tol )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int L = NUM_LANES;
+
+    Real thresh[L];
+    for( Int l=0; l<L; ++l )
+        thresh[l] = 0;
+    for( Int k=0; k<n*n; ++k )
+        for( Int l=0; l<L; ++l )
+        {
+            const Real alphaAbs = Abs(X[k*L+l]);
+            thresh[l] += alphaAbs*alphaAbs;
+        }
+    for( Int l=0; l<L; ++l )
+        thresh[l] = tol*Sqrt(thresh[l]);
+
+    Real c[L], s[L];
+    F phase[L];
+    for( Int sweep=0; sweep<maxSweeps; ++sweep )
+    {
+        bool rotated = false;
+        for( Int q=1; q<n; ++q )
+        {
+            for( Int p=0; p<q; ++p )
+            {
+                const F* alphaPQ = &X[(p+q*n)*L];
+                const F* alphaPP = &X[(p+p*n)*L];
+                const F* alphaQQ = &X[(q+q*n)*L];
+                bool active = false;
+                for( Int l=0; l<L; ++l )
+                {
+                    const Real alphaAbs = Abs(alphaPQ[l]);
+                    if( alphaAbs > thresh[l] )
+                    {
+                        active = true;
+                        const Real tau =
+                          (RealPart(alphaQQ[l])-RealPart(alphaPP[l])) /
+                          (2*alphaAbs);
+                        const Real t = ( tau >= Real(0) ? Real(1) : Real(-1) ) /
+                          (Abs(tau)+Sqrt(1+tau*tau));
+                        c[l] = 1 / Sqrt(1+t*t);
+                        s[l] = t*c[l];
+                        phase[l] = alphaPQ[l] / alphaAbs;
+                    }
+                    else
+                    {
+                        c[l] = 1;
+                        s[l] = 0;
+                        phase[l] = 1;
+                    }
+                }
+                if( !active )
+                    continue;
+                rotated = true;
+
+                // X := X G
+                for( Int i=0; i<n; ++i )
+                {
+                    F* xP = &X[(i+p*n)*L];
+                    F* xQ = &X[(i+q*n)*L];
+                    for( Int l=0; l<L; ++l )
+                    {
+                        const F alpha = xP[l];
+                        const F beta = Conj(phase[l])*xQ[l];
+                        xP[l] = c[l]*alpha - s[l]*beta;
+                        xQ[l] = s[l]*alpha + c[l]*beta;
+                    }
+                }
+                // X := G^H X
+                for( Int j=0; j<n; ++j )
+                {
+                    F* xP = &X[(p+j*n)*L];
+                    F* xQ = &X[(q+j*n)*L];
+                    for( Int l=0; l<L; ++l )
+                    {
+                        const F alpha = xP[l];
+                        const F beta = phase[l]*xQ[l];
+                        xP[l] = c[l]*alpha - s[l]*beta;
+                        xQ[l] = s[l]*alpha + c[l]*beta;
+                    }
+                }
+                for( Int l=0; l<L; ++l )
+                {
+                    if( s[l] != Real(0) )
+                    {
+                        X[(p+q*n)*L+l] = X[(q+p*n)*L+l] = F(0);
+                        X[(p+p*n)*L+l] = RealPart(X[(p+p*n)*L+l]);
+                        X[(q+q*n)*L+l] = RealPart(X[(q+q*n)*L+l]);
+                    }
+                }
+                if( Z != nullptr )
+                {
+                    auto& ZRef = *Z;
+                    for( Int i=0; i<n; ++i )
+                    {
+                        F* zP = &ZRef[(i+p*n)*L];
+                        F* zQ = &ZRef[(i+q*n)*L];
+                        for( Int l=0; l<L; ++l )
+                        {
+                            const F alpha = zP[l];
+                            const F beta = Conj(phase[l])*zQ[l];
+                            zP[l] = c[l]*alpha - s[l]*beta;
+                            zQ[l] = s[l]*alpha + c[l]*beta;
+                        }
+                    }
+                }
+            }
+        }
+        if( !rotated )
+            break;
+    }
+}
+
+// Cyclic one-sided Jacobi on the columns of the m x n (m >= n) chunk W, with
+// the rotations optionally accumulated into Z
+template<typename F>
+void OneSidedJacobi
+( Int m,
+  Int n,
+  vector<F>& W,
+  vector<F>* Z,
+  Int maxSweeps,
+  Base<F> tol )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int L = NUM_LANES;
+
+    Real alpha[L], beta[L], c[L], s[L];
+    F gamma[L], phaseConj[L];
+    for( Int sweep=0; sweep<maxSweeps; ++sweep )
+    {
+        bool rotated = false;
+        for( Int j=1; j<n; ++j )
+        {
+            for( Int i=0; i<j; ++i )
+            {
+                for( Int l=0; l<L; ++l )
+                {
+                    alpha[l] = beta[l] = 0;
+                    gamma[l] = 0;
+                }
+                for( Int k=0; k<m; ++k )
+                {
+                    const F* wI = &W[(k+i*m)*L];
+                    const F* wJ = &W[(k+j*m)*L];
+                    for( Int l=0; l<L; ++l )
+                    {
+                        alpha[l] += RealPart(Conj(wI[l])*wI[l]);
+                        beta[l] += RealPart(Conj(wJ[l])*wJ[l]);
+                        gamma[l] += Conj(wI[l])*wJ[l];
+                    }
+                }
+                bool active = false;
+                for( Int l=0; l<L; ++l )
+                {
+                    const Real gammaAbs = Abs(gamma[l]);
+                    if( alpha[l] > Real(0) && beta[l] > Real(0) &&
+                        gammaAbs > tol*Sqrt(alpha[l])*Sqrt(beta[l]) )
+                    {
+                        active = true;
+                        const Real zeta = (beta[l]-alpha[l]) / (2*gammaAbs);
+                        const Real t =
+                          ( zeta >= Real(0) ? Real(1) : Real(-1) ) /
+                          (Abs(zeta)+Sqrt(1+zeta*zeta));
+                        c[l] = 1 / Sqrt(1+t*t);
+                        s[l] = t*c[l];
+                        phaseConj[l] = Conj(gamma[l]) / gammaAbs;
+                    }
+                    else
+                    {
+                        c[l] = 1;
+                        s[l] = 0;
+                        phaseConj[l] = 1;
+                    }
+                }
+                if( !active )
+                    continue;
+                rotated = true;
+
+                for( Int k=0; k<m; ++k )
+                {
+                    F* wI = &W[(k+i*m)*L];
+                    F* wJ = &W[(k+j*m)*L];
+                    for( Int l=0; l<L; ++l )
+                    {
+                        const F rhoI = wI[l];
+                        const F rhoJ = phaseConj[l]*wJ[l];
+                        wI[l] = c[l]*rhoI - s[l]*rhoJ;
+                        wJ[l] = s[l]*rhoI + c[l]*rhoJ;
+                    }
+                }
+                if( Z != nullptr )
+                {
+                    auto& ZRef = *Z;
+                    for( Int k=0; k<n; ++k )
+                    {
+                        F* zI = &ZRef[(k+i*n)*L];
+                        F* zJ = &ZRef[(k+j*n)*L];
+                        for( Int l=0; l<L; ++l )
+                        {
+                            const F rhoI = zI[l];
+                            const F rhoJ = phaseConj[l]*zJ[l];
+                            zI[l] = c[l]*rhoI - s[l]*rhoJ;
+                            zJ[l] = s[l]*rhoI + c[l]*rhoJ;
+                        }
+                    }
+                }
+            }
+        }
+        if( !rotated )
+            break;
+    }
+}
+
+template<typename Real>
+Real Tolerance( const Real& tol )
+{ return ( tol == Real(0) ? limits::Epsilon<Real>() : tol ); }
+
+inline Int NumChunks( Int numMatrices )
+{ return (numMatrices+NUM_LANES-1) / NUM_LANES; }
+
+// Only the Jacobi sweeps over the chunks are threaded: the dense fallbacks
+// are run one member at a time, as they are not reentrant and rely upon a
+// (possibly threaded) BLAS. Exceptions may not escape a threaded loop, so
+// each chunk captures its own and the first is rethrown after the loop.
+inline void RethrowFirst( const vector<std::exception_ptr>& errors )
+{
+    for( const auto& error : errors )
+        if( error )
+            std::rethrow_exception( error );
+}
+
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo,
+  Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Base<F>* w, Int wStride,
+  F* Q, Int QLDim, Int QStride,
+  const BatchSpectralCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const bool wantQ = ( Q != nullptr );
+    if( n > ctrl.jacobiCutoff )
+    {
+        for( Int k=0; k<numMatrices; ++k )
+        {
+            Matrix<F> AMem, QMem;
+            Matrix<Real> wMem;
+            AMem.Attach( n, n, &A[k*AStride], ALDim );
+            wMem.Attach( n, 1, &w[k*wStride], Max(n,Int(1)) );
+            if( wantQ )
+            {
+                QMem.Attach( n, n, &Q[k*QStride], QLDim );
+                El::HermitianEig( uplo, AMem, wMem, QMem, ctrl.hermEigCtrl );
+            }
+            else
+                El::HermitianEig( uplo, AMem, wMem, ctrl.hermEigCtrl );
+        }
+        return;
+    }
+
+    const Real tol = Tolerance( ctrl.tol );
+    const Int L = NUM_LANES;
+    const Int numChunks = NumChunks( numMatrices );
+    vector<std::exception_ptr> errors( numChunks );
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        try
+        {
+            const Int offset = chunk*L;
+            const Int numUsed = Min( L, numMatrices-offset );
+            vector<F> X, Z;
+            PackHermitianChunk
+            ( uplo, n, numUsed, &A[offset*AStride], ALDim, AStride, X );
+            if( wantQ )
+                IdentityChunk( n, Z );
+            HermitianJacobi
+            ( n, X, ( wantQ ? &Z : nullptr ), ctrl.maxSweeps, tol );
+
+            vector<Int> order(n);
+            for( Int l=0; l<numUsed; ++l )
+            {
+                const Int k = offset + l;
+                for( Int j=0; j<n; ++j )
+                    order[j] = j;
+                std::sort
+                ( order.begin(), order.end(),
+                  [&]( const Int& a, const Int& b )
+                  { return RealPart(X[(a+a*n)*L+l]) <
+                           RealPart(X[(b+b*n)*L+l]); } );
+                for( Int j=0; j<n; ++j )
+                {
+                    const Int jOld = order[j];
+                    w[k*wStride+j] = RealPart(X[(jOld+jOld*n)*L+l]);
+                    if( wantQ )
+                        for( Int i=0; i<n; ++i )
+                            Q[k*QStride+i+j*QLDim] = Z[(i+jOld*n)*L+l];
+                }
+            }
+        }
+        catch( ... ) { errors[chunk] = std::current_exception(); }
+    }
+    RethrowFirst( errors );
+}
+
+template<typename F>
+void SVD
+( Int m,
+  Int n,
+  Int numMatrices,
+  const F* A, Int ALDim, Int AStride,
+  F* U, Int ULDim, Int UStride,
+  Base<F>* s, Int sStride,
+  F* V, Int VLDim, Int VStride,
+  const BatchSpectralCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const bool wantVecs = ( U != nullptr );
+    const Int minDim = Min(m,n);
+
+    auto svdCtrl = ctrl.svdCtrl;
+    svdCtrl.bidiagSVDCtrl.approach = THIN_SVD;
+    svdCtrl.bidiagSVDCtrl.wantU = wantVecs;
+    svdCtrl.bidiagSVDCtrl.wantV = wantVecs;
+    auto denseSVD =
+      [&]( Int k )
+      {
+          Matrix<F> AMem, UMem, VMem;
+          Matrix<Real> sMem;
+          AMem.LockedAttach( m, n, &A[k*AStride], ALDim );
+          sMem.Attach( minDim, 1, &s[k*sStride], Max(minDim,Int(1)) );
+          const Matrix<F>& AConst = AMem;
+          if( wantVecs )
+          {
+              UMem.Attach( m, minDim, &U[k*UStride], ULDim );
+              VMem.Attach( n, minDim, &V[k*VStride], VLDim );
+              El::SVD( AConst, UMem, sMem, VMem, svdCtrl );
+          }
+          else
+              El::SVD( AConst, sMem, svdCtrl );
+      };
+    if( Max(m,n) > ctrl.jacobiCutoff )
+    {
+        for( Int k=0; k<numMatrices; ++k )
+            denseSVD( k );
+        return;
+    }
+
+    // Orthogonalize the columns of A, or of A^H if A is wide, so that the
+    // roles of U and V are swapped in the latter case
+    const bool adjoint = ( m < n );
+    const Int height = Max(m,n);
+    const Real tol = Sqrt(Real(height))*Tolerance( ctrl.tol );
+    const Real eps = limits::Epsilon<Real>();
+    const Int L = NUM_LANES;
+    const Int numChunks = NumChunks( numMatrices );
+    vector<std::exception_ptr> errors( numChunks );
+    vector<char> deferred( numMatrices, false );
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        try
+        {
+            const Int offset = chunk*L;
+            const Int numUsed = Min( L, numMatrices-offset );
+            vector<F> W, Z;
+            PackChunk
+            ( height, minDim, numUsed, &A[offset*AStride], ALDim, AStride,
+              adjoint, W );
+            if( wantVecs )
+                IdentityChunk( minDim, Z );
+            OneSidedJacobi
+            ( height, minDim, W, ( wantVecs ? &Z : nullptr ), ctrl.maxSweeps,
+              tol );
+
+            vector<Real> sigma(minDim);
+            vector<Int> order(minDim);
+            for( Int l=0; l<numUsed; ++l )
+            {
+                const Int k = offset + l;
+                for( Int j=0; j<minDim; ++j )
+                {
+                    Real normSq = 0;
+                    for( Int i=0; i<height; ++i )
+                    {
+                        const Real alphaAbs = Abs(W[(i+j*height)*L+l]);
+                        normSq += alphaAbs*alphaAbs;
+                    }
+                    sigma[j] = Sqrt(normSq);
+                    order[j] = j;
+                }
+                std::sort
+                ( order.begin(), order.end(),
+                  [&]( const Int& a, const Int& b )
+                  { return sigma[a] > sigma[b]; } );
+
+                // Numerically rank-deficient members do not have
+                // well-defined normalized columns, so they are handed to the
+                // dense SVD after the threaded loop
+                if( wantVecs && minDim > 0 &&
+                    sigma[order[minDim-1]] <= minDim*eps*sigma[order[0]] )
+                {
+                    deferred[k] = true;
+                    continue;
+                }
+
+                F* UBuf = ( adjoint ? &V[k*VStride] : &U[k*UStride] );
+                F* VBuf = ( adjoint ? &U[k*UStride] : &V[k*VStride] );
+                const Int UBufLDim = ( adjoint ? VLDim : ULDim );
+                const Int VBufLDim = ( adjoint ? ULDim : VLDim );
+                for( Int j=0; j<minDim; ++j )
+                {
+                    const Int jOld = order[j];
+                    s[k*sStride+j] = sigma[jOld];
+                    if( !wantVecs )
+                        continue;
+                    for( Int i=0; i<height; ++i )
+                        UBuf[i+j*UBufLDim] =
+                          W[(i+jOld*height)*L+l] / sigma[jOld];
+                    for( Int i=0; i<minDim; ++i )
+                        VBuf[i+j*VBufLDim] = Z[(i+jOld*minDim)*L+l];
+                }
+            }
+        }
+        catch( ... ) { errors[chunk] = std::current_exception(); }
+    }
+    RethrowFirst( errors );
+    for( Int k=0; k<numMatrices; ++k )
+        if( deferred[k] )
+            denseSVD( k );
+}
+
+template<typename F>
+void Schur
+( Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Complex<Base<F>>* w, Int wStride,
+  F* Q, Int QLDim, Int QStride,
+  const BatchSpectralCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    typedef Complex<Base<F>> C;
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        Matrix<F> AMem, QMem;
+        Matrix<C> wMem;
+        AMem.Attach( n, n, &A[k*AStride], ALDim );
+        wMem.Attach( n, 1, &w[k*wStride], Max(n,Int(1)) );
+        if( Q != nullptr )
+        {
+            QMem.Attach( n, n, &Q[k*QStride], QLDim );
+            El::Schur( AMem, wMem, QMem, ctrl.schurCtrl );
+        }
+        else
+            El::Schur( AMem, wMem, ctrl.schurCtrl );
+    }
+}
+
+} // namespace batch
+
+template<typename F>
+void HermitianEigBatch
+( UpperOrLower uplo,
+  Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Base<F>* w, Int wStride,
+  const BatchSpectralCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    batch::HermitianEig
+    ( uplo, n, numMatrices, A, ALDim, AStride, w, wStride,
+      (F*)nullptr, 1, 0, ctrl );
+}
+
+template<typename F>
+void HermitianEigBatch
+( UpperOrLower uplo,
+  Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Base<F>* w, Int wStride,
+  F* Q, Int QLDim, Int QStride,
+  const BatchSpectralCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    if( Q == nullptr )
+        LogicError("Q must be provided");
+    batch::HermitianEig
+    ( uplo, n, numMatrices, A, ALDim, AStride, w, wStride,
+      Q, QLDim, QStride, ctrl );
+}
+
+template<typename F>
+void SVDBatch
+( Int m,
+  Int n,
+  Int numMatrices,
+  const F* A, Int ALDim, Int AStride,
+  Base<F>* s, Int sStride,
+  const BatchSpectralCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    batch::SVD
+    ( m, n, numMatrices, A, ALDim, AStride, (F*)nullptr, 1, 0, s, sStride,
+      (F*)nullptr, 1, 0, ctrl );
+}
+
+template<typename F>
+void SVDBatch
+( Int m,
+  Int n,
+  Int numMatrices,
+  const F* A, Int ALDim, Int AStride,
+  F* U, Int ULDim, Int UStride,
+  Base<F>* s, Int sStride,
+  F* V, Int VLDim, Int VStride,
+  const BatchSpectralCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    if( U == nullptr || V == nullptr )
+        LogicError("U and V must be provided");
+    batch::SVD
+    ( m, n, numMatrices, A, ALDim, AStride, U, ULDim, UStride, s, sStride,
+      V, VLDim, VStride, ctrl );
+}
+
+template<typename F>
+void SchurBatch
+( Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Complex<Base<F>>* w, Int wStride,
+  const BatchSpectralCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    batch::Schur
+    ( n, numMatrices, A, ALDim, AStride, w, wStride, (F*)nullptr, 1, 0,
+      ctrl );
+}
+
+template<typename F>
+void SchurBatch
+( Int n,
+  Int numMatrices,
+  F* A, Int ALDim, Int AStride,
+  Complex<Base<F>>* w, Int wStride,
+  F* Q, Int QLDim, Int QStride,
+  const BatchSpectralCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    if( Q == nullptr )
+        LogicError("Q must be provided");
+    batch::Schur
+    ( n, numMatrices, A, ALDim, AStride, w, wStride, Q, QLDim, QStride,
+      ctrl );
+}
+
+#define PROTO(F) \
+  template void HermitianEigBatch \
+  ( UpperOrLower uplo, \
+    Int n, \
+    Int numMatrices, \
+    F* A, Int ALDim, Int AStride, \
+    Base<F>* w, Int wStride, \
+    const BatchSpectralCtrl<F>& ctrl ); \
+  template void HermitianEigBatch \
+  ( UpperOrLower uplo, \
+    Int n, \
+    Int numMatrices, \
+    F* A, Int ALDim, Int AStride, \
+    Base<F>* w, Int wStride, \
+    F* Q, Int QLDim, Int QStride, \
+    const BatchSpectralCtrl<F>& ctrl ); \
+  template void SVDBatch \
+  ( Int m, \
+    Int n, \
+    Int numMatrices, \
+    const F* A, Int ALDim, Int AStride, \
+    Base<F>* s, Int sStride, \
+    const BatchSpectralCtrl<F>& ctrl ); \
+  template void SVDBatch \
+  ( Int m, \
+    Int n, \
+    Int numMatrices, \
+    const F* A, Int ALDim, Int AStride, \
+    F* U, Int ULDim, Int UStride, \
+    Base<F>* s, Int sStride, \
+    F* V, Int VLDim, Int VStride, \
+    const BatchSpectralCtrl<F>& ctrl ); \
+  template void SchurBatch \
+  ( Int n, \
+    Int numMatrices, \
+    F* A, Int ALDim, Int AStride, \
+    Complex<Base<F>>* w, Int wStride, \
+    const BatchSpectralCtrl<F>& ctrl ); \
+  template void SchurBatch \
+  ( Int n, \
+    Int numMatrices, \
+    F* A, Int ALDim, Int AStride, \
+    Complex<Base<F>>* w, Int wStride, \
+    F* Q, Int QLDim, Int QStride, \
+    const BatchSpectralCtrl<F>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -126,8 +126,9 @@ template<typename F>
 void Sweep
 (       Matrix<Base<F>>& mainDiag,
         Matrix<Base<F>>& superDiag,
-        Matrix<F>& U,
-        Matrix<F>& V,
+        GivensSequenceAccumulator<F>& UAccum,
+        GivensSequenceAccumulator<F>& VAccum,
+        Int offset,
   const Base<F>& shift,
         ForwardOrBackward direction,  
         Matrix<Base<F>>& cUList,
@@ -256,13 +257,11 @@ void Sweep
         }
         if( ctrl.wantU )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cUList, sUList, U );
+            UAccum.Push( FORWARD, offset, cUList, sUList );
         }
         if( ctrl.wantV )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cVList, sVList, V );
+            VAccum.Push( FORWARD, offset, cVList, sVList );
         }
     }
     else
@@ -362,13 +361,11 @@ void Sweep
         }
         if( ctrl.wantU )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cUList, sUList, U );
+            UAccum.Push( BACKWARD, offset, cUList, sUList );
         }
         if( ctrl.wantV )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cVList, sVList, V );
+            VAccum.Push( BACKWARD, offset, cVList, sVList );
         }
     }
 }
@@ -396,7 +393,6 @@ Helper
     DEBUG_CSE
     typedef Base<F> Real;
     const Int n = mainDiag.Height();
-    const Int mU = U.Height();
     const Int mV = V.Height();
     const Real eps = limits::Epsilon<Real>();
     const Real safeMin = limits::SafeMin<Real>();
@@ -461,7 +457,9 @@ Helper
     ForwardOrBackward direction = FORWARD;
     Matrix<Real> cUList(n,1), sUList(n,1), cVList(n,1), sVList(n,1);
     Matrix<Real> mainDiagSub, superDiagSub;
-    Matrix<F> USub, VSub;
+    // Consecutive sweeps are accumulated so that their rotations can be
+    // applied to U and V with level-3 operations
+    GivensSequenceAccumulator<F> UAccum( U ), VAccum( V );
     while( winEnd > 0 )
     {
         if( info.numInnerLoops > maxInnerLoops )
@@ -532,15 +530,11 @@ Helper
                 sigmaMin *= sgnMin; // The signs will be fixed at the end
                 if( ctrl.wantU ) 
                 {
-                    blas::Rot
-                    ( mU, U.Buffer(0,winBeg  ), 1,
-                          U.Buffer(0,winBeg+1), 1, cU, sU );
+                    UAccum.PushRotation( winBeg, cU, sU );
                 }
                 if( ctrl.wantV )
                 {
-                    blas::Rot
-                    ( mV, V.Buffer(0,winBeg  ), 1,
-                          V.Buffer(0,winBeg+1), 1, cV, sV );
+                    VAccum.PushRotation( winBeg, cV, sV );
                 }
             }
             else
@@ -728,16 +722,8 @@ Helper
         // views
         View( mainDiagSub, mainDiag, IR(winBeg,winEnd), ALL );
         View( superDiagSub, superDiag, IR(winBeg,winEnd-1), ALL );
-        if( ctrl.wantU )
-        {
-            View( USub, U, ALL, IR(winBeg,winEnd) );
-        }
-        if( ctrl.wantV )
-        {
-            View( VSub, V, ALL, IR(winBeg,winEnd) );
-        }
         Sweep
-        ( mainDiagSub, superDiagSub, USub, VSub, shift, direction,
+        ( mainDiagSub, superDiagSub, UAccum, VAccum, winBeg, shift, direction,
           cUList, sUList, cVList, sVList, ctrl );
 
         // Test for convergence of the last off-diagonal of the sweep
@@ -753,6 +739,9 @@ Helper
         }
     }
 
+    UAccum.Flush();
+    VAccum.Flush();
+
     // Force the singular values to be positive (absorbing signs into V)
     for( Int j=0; j<n; ++j )
     {
@@ -0,0 +1,350 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace krylov {
+
+// Y := A X for complex X, applying a real A to the real and imaginary parts
+// separately
+
+template<typename Real>
+void ComplexMultiply
+( const SparseMatrix<Complex<Real>>& A,
+  const Matrix<Complex<Real>>& X,
+        Matrix<Complex<Real>>& Y )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    Zeros( Y, A.Height(), X.Width() );
+    Multiply( NORMAL, C(1), A, X, C(0), Y );
+}
+
+template<typename Real>
+void ComplexMultiply
+( const SparseMatrix<Real>& A,
+  const Matrix<Complex<Real>>& X,
+        Matrix<Complex<Real>>& Y )
+{
+    DEBUG_CSE
+    Matrix<Real> XPart, YReal, YImag;
+    RealPart( X, XPart );
+    Zeros( YReal, A.Height(), X.Width() );
+    Multiply( NORMAL, Real(1), A, XPart, Real(0), YReal );
+    ImagPart( X, XPart );
+    Zeros( YImag, A.Height(), X.Width() );
+    Multiply( NORMAL, Real(1), A, XPart, Real(0), YImag );
+
+    Y.Resize( A.Height(), X.Width() );
+    for( Int j=0; j<X.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            Y(i,j) = Complex<Real>(YReal(i,j),YImag(i,j));
+}
+
+template<typename Real>
+void ComplexMultiply
+( const DistSparseMatrix<Complex<Real>>& A,
+  const DistMultiVec<Complex<Real>>& X,
+        DistMultiVec<Complex<Real>>& Y )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    Zeros( Y, A.Height(), X.Width() );
+    Multiply( NORMAL, C(1), A, X, C(0), Y );
+}
+
+template<typename Real>
+void ComplexMultiply
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Complex<Real>>& X,
+        DistMultiVec<Complex<Real>>& Y )
+{
+    DEBUG_CSE
+    mpi::Comm comm = X.Comm();
+    DistMultiVec<Real> XPart(comm), YReal(comm), YImag(comm);
+    XPart.Resize( X.Height(), X.Width() );
+    RealPart( X.LockedMatrix(), XPart.Matrix() );
+    Zeros( YReal, A.Height(), X.Width() );
+    Multiply( NORMAL, Real(1), A, XPart, Real(0), YReal );
+    ImagPart( X.LockedMatrix(), XPart.Matrix() );
+    Zeros( YImag, A.Height(), X.Width() );
+    Multiply( NORMAL, Real(1), A, XPart, Real(0), YImag );
+
+    Y.SetComm( comm );
+    Y.Resize( A.Height(), X.Width() );
+    auto& YLoc = Y.Matrix();
+    const auto& YRealLoc = YReal.LockedMatrix();
+    const auto& YImagLoc = YImag.LockedMatrix();
+    for( Int j=0; j<X.Width(); ++j )
+        for( Int iLoc=0; iLoc<YLoc.Height(); ++iLoc )
+            YLoc(iLoc,j) = Complex<Real>(YRealLoc(iLoc,j),YImagLoc(iLoc,j));
+}
+
+} // namespace krylov
+
+template<typename F>
+BlockKrylovInfo BlockLanczos
+( const SparseMatrix<F>& A,
+        Matrix<Base<F>>& w,
+        Matrix<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( ctrl.shiftInvert )
+    {
+        SparseMatrix<F> AShift( A );
+        ShiftDiagonal( AShift, -ctrl.shift );
+        SparseLDLFactorization<F> factorization;
+        factorization.Initialize( AShift, true );
+        return BlockLanczos( factorization, w, X, ctrl );
+    }
+
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, F(1), A, X, F(0), Y );
+      };
+    return BlockLanczos<F>( n, applyA, w, X, ctrl );
+}
+
+template<typename F>
+BlockKrylovInfo BlockLanczos
+( const DistSparseMatrix<F>& A,
+        Matrix<Base<F>>& w,
+        DistMultiVec<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    X.SetComm( A.Comm() );
+    if( ctrl.shiftInvert )
+    {
+        DistSparseMatrix<F> AShift( A );
+        ShiftDiagonal( AShift, -ctrl.shift );
+        DistSparseLDLFactorization<F> factorization;
+        factorization.Initialize( AShift, true );
+        return BlockLanczos( factorization, w, X, ctrl );
+    }
+
+    auto applyA =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, F(1), A, X, F(0), Y );
+      };
+    return BlockLanczos<F>( n, applyA, w, X, ctrl );
+}
+
+template<typename F>
+BlockKrylovInfo BlockLanczos
+( const SparseLDLFactorization<F>& factorization,
+        Matrix<Base<F>>& w,
+        Matrix<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( !factorization.Initialized() )
+        LogicError("The factorization has not been initialized");
+    const Int n = factorization.Map().size();
+    auto applyInv =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+          Y = X;
+          factorization.Solve( Y );
+      };
+    auto shiftInvertCtrl = ctrl;
+    shiftInvertCtrl.shiftInvert = true;
+    return BlockLanczos<F>( n, applyInv, w, X, shiftInvertCtrl );
+}
+
+template<typename F>
+BlockKrylovInfo BlockLanczos
+( const DistSparseLDLFactorization<F>& factorization,
+        Matrix<Base<F>>& w,
+        DistMultiVec<F>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( !factorization.Initialized() )
+        LogicError("The factorization has not been initialized");
+    const Int n = factorization.Map().NumSources();
+    X.SetComm( factorization.Map().Comm() );
+    auto applyInv =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+          Y = X;
+          factorization.Solve( Y );
+      };
+    auto shiftInvertCtrl = ctrl;
+    shiftInvertCtrl.shiftInvert = true;
+    return BlockLanczos<F>( n, applyInv, w, X, shiftInvertCtrl );
+}
+
+template<typename F>
+BlockKrylovInfo KrylovSchur
+( const SparseMatrix<F>& A,
+        Matrix<Complex<Base<F>>>& w,
+        Matrix<Complex<Base<F>>>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( ctrl.shiftInvert )
+    {
+        SparseMatrix<C> AShift;
+        Copy( A, AShift );
+        ShiftDiagonal( AShift, -ctrl.shift );
+        SparseLDLFactorization<C> factorization;
+        factorization.Initialize( AShift, false );
+        return KrylovSchur( factorization, w, X, ctrl );
+    }
+
+    auto applyA =
+      [&]( const Matrix<C>& X, Matrix<C>& Y )
+      { krylov::ComplexMultiply( A, X, Y ); };
+    return KrylovSchur<Real>( n, applyA, w, X, ctrl );
+}
+
+template<typename F>
+BlockKrylovInfo KrylovSchur
+( const DistSparseMatrix<F>& A,
+        Matrix<Complex<Base<F>>>& w,
+        DistMultiVec<Complex<Base<F>>>& X,
+  const BlockKrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    X.SetComm( A.Comm() );
+    if( ctrl.shiftInvert )
+    {
+        DistSparseMatrix<C> AShift( A.Comm() );
+        Copy( A, AShift );
+        ShiftDiagonal( AShift, -ctrl.shift );
+        DistSparseLDLFactorization<C> factorization;
+        factorization.Initialize( AShift, false );
+        return KrylovSchur( factorization, w, X, ctrl );
+    }
+
+    auto applyA =
+      [&]( const DistMultiVec<C>& X, DistMultiVec<C>& Y )
+      { krylov::ComplexMultiply( A, X, Y ); };
+    return KrylovSchur<Real>( n, applyA, w, X, ctrl );
+}
+
+template<typename Real>
+BlockKrylovInfo KrylovSchur
+( const SparseLDLFactorization<Complex<Real>>& factorization,
+        Matrix<Complex<Real>>& w,
+        Matrix<Complex<Real>>& X,
+  const BlockKrylovCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    if( !factorization.Initialized() )
+        LogicError("The factorization has not been initialized");
+    const Int n = factorization.Map().size();
+    auto applyInv =
+      [&]( const Matrix<C>& X, Matrix<C>& Y )
+      {
+          Y = X;
+          factorization.Solve( Y );
+      };
+    auto shiftInvertCtrl = ctrl;
+    shiftInvertCtrl.shiftInvert = true;
+    return KrylovSchur<Real>( n, applyInv, w, X, shiftInvertCtrl );
+}
+
+template<typename Real>
+BlockKrylovInfo KrylovSchur
+( const DistSparseLDLFactorization<Complex<Real>>& factorization,
+        Matrix<Complex<Real>>& w,
+        DistMultiVec<Complex<Real>>& X,
+  const BlockKrylovCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    if( !factorization.Initialized() )
+        LogicError("The factorization has not been initialized");
+    const Int n = factorization.Map().NumSources();
+    X.SetComm( factorization.Map().Comm() );
+    auto applyInv =
+      [&]( const DistMultiVec<C>& X, DistMultiVec<C>& Y )
+      {
+          Y = X;
+          factorization.Solve( Y );
+      };
+    auto shiftInvertCtrl = ctrl;
+    shiftInvertCtrl.shiftInvert = true;
+    return KrylovSchur<Real>( n, applyInv, w, X, shiftInvertCtrl );
+}
+
+#define PROTO(F) \
+  template BlockKrylovInfo BlockLanczos \
+  ( const SparseMatrix<F>& A, \
+          Matrix<Base<F>>& w, \
+          Matrix<F>& X, \
+    const BlockKrylovCtrl<Base<F>>& ctrl ); \
+  template BlockKrylovInfo BlockLanczos \
+  ( const DistSparseMatrix<F>& A, \
+          Matrix<Base<F>>& w, \
+          DistMultiVec<F>& X, \
+    const BlockKrylovCtrl<Base<F>>& ctrl ); \
+  template BlockKrylovInfo BlockLanczos \
+  ( const SparseLDLFactorization<F>& factorization, \
+          Matrix<Base<F>>& w, \
+          Matrix<F>& X, \
+    const BlockKrylovCtrl<Base<F>>& ctrl ); \
+  template BlockKrylovInfo BlockLanczos \
+  ( const DistSparseLDLFactorization<F>& factorization, \
+          Matrix<Base<F>>& w, \
+          DistMultiVec<F>& X, \
+    const BlockKrylovCtrl<Base<F>>& ctrl ); \
+  template BlockKrylovInfo KrylovSchur \
+  ( const SparseMatrix<F>& A, \
+          Matrix<Complex<Base<F>>>& w, \
+          Matrix<Complex<Base<F>>>& X, \
+    const BlockKrylovCtrl<Base<F>>& ctrl ); \
+  template BlockKrylovInfo KrylovSchur \
+  ( const DistSparseMatrix<F>& A, \
+          Matrix<Complex<Base<F>>>& w, \
+          DistMultiVec<Complex<Base<F>>>& X, \
+    const BlockKrylovCtrl<Base<F>>& ctrl );
+
+#define PROTO_REAL(Real) \
+  PROTO(Real) \
+  template BlockKrylovInfo KrylovSchur \
+  ( const SparseLDLFactorization<Complex<Real>>& factorization, \
+          Matrix<Complex<Real>>& w, \
+          Matrix<Complex<Real>>& X, \
+    const BlockKrylovCtrl<Real>& ctrl ); \
+  template BlockKrylovInfo KrylovSchur \
+  ( const DistSparseLDLFactorization<Complex<Real>>& factorization, \
+          Matrix<Complex<Real>>& w, \
+          DistMultiVec<Complex<Real>>& X, \
+    const BlockKrylovCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
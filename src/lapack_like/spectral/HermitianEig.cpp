@@ -9,6 +9,8 @@
 #include <El.hpp>
 
 #include "./HermitianEig/SDC.hpp"
+#include "./HermitianEig/Slice.hpp"
+#include "./HermitianEig/Refine.hpp"
 
 // The targeted number of pieces to break the eigenvectors into during the
 // redistribution from the [* ,VR] distribution after PMRRR to the [MC,MR]
@@ -261,15 +263,23 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("HermitianEig");
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
-    if( ctrl.useSDC )
+    if( ctrl.useSDC || ctrl.useQDWHEig )
     {
         HermitianEigInfo info;
-        herm_eig::SDC( uplo, A, w, ctrl.sdcCtrl );
+        herm_eig::SDC( uplo, A, w, herm_eig::SDCCtrl(ctrl) );
         herm_eig::SortAndFilter( w, ctrl.tridiagEigCtrl );
         return info;
     }
+    if( ctrl.useSpectrumSlicing )
+    {
+        HermitianEigInfo info;
+        Matrix<F> Q;
+        herm_eig::SpectrumSlice( uplo, A, w, Q, false, ctrl );
+        return info;
+    }
     return herm_eig::BlackBox( uplo, A, w, ctrl );
 }
 
@@ -504,6 +514,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("HermitianEig");
     typedef Base<F> Real;
     if( APre.Height() != APre.Width() )
         LogicError("Hermitian matrices must be square");
@@ -520,13 +531,20 @@ HermitianEig
         return herm_eig::SequentialHelper( uplo, APre, w, ctrl );
     }
 
-    if( ctrl.useSDC )
+    if( ctrl.useSDC || ctrl.useQDWHEig )
     {
         HermitianEigInfo info;
-        herm_eig::SDC( uplo, APre, w, ctrl.sdcCtrl );
+        herm_eig::SDC( uplo, APre, w, herm_eig::SDCCtrl(ctrl) );
         herm_eig::SortAndFilter( w, ctrl.tridiagEigCtrl );
         return info;
     }
+    if( ctrl.useSpectrumSlicing )
+    {
+        HermitianEigInfo info;
+        DistMatrix<F> Q( APre.Grid() );
+        herm_eig::SpectrumSlice( uplo, APre, w, Q, false, ctrl );
+        return info;
+    }
 
     return herm_eig::BlackBox( uplo, APre, w, ctrl );
 }
@@ -619,6 +637,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("HermitianEig");
     typedef Base<F> Real;
     const Int n = A.Height();
     auto subset = ctrl.tridiagEigCtrl.subset;
@@ -674,11 +693,15 @@ HermitianEig
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    if( ctrl.useSDC )
+    if( ctrl.useSDC || ctrl.useQDWHEig )
     {
-        herm_eig::SDC( uplo, A, w, Q, ctrl.sdcCtrl );
+        herm_eig::SDC( uplo, A, w, Q, herm_eig::SDCCtrl(ctrl) );
         herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
     }
+    else if( ctrl.useSpectrumSlicing )
+    {
+        herm_eig::SpectrumSlice( uplo, A, w, Q, true, ctrl );
+    }
     else
     {
         info = herm_eig::BlackBox( uplo, A, w, Q, ctrl );
@@ -863,7 +886,9 @@ MRRR
             timer.Start();
     }
     DistMatrix<F,STAR,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
+    herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+    HermitianTridiag
+    ( uplo, A, householderScalars, bulgeReflectors, ctrl.tridiagCtrl );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -983,7 +1008,8 @@ MRRR
             timer.Start();
         }
     }
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL, A, householderScalars, bulgeReflectors, Q );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -1006,6 +1032,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("HermitianEig");
     typedef Base<F> Real;
     const Int n = A.Height();
     auto subset = ctrl.tridiagEigCtrl.subset;
@@ -1076,11 +1103,15 @@ HermitianEig
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    if( ctrl.useSDC )
+    if( ctrl.useSDC || ctrl.useQDWHEig )
     {
-        herm_eig::SDC( uplo, A, w, Q, ctrl.sdcCtrl );
+        herm_eig::SDC( uplo, A, w, Q, herm_eig::SDCCtrl(ctrl) );
         herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
     }
+    else if( ctrl.useSpectrumSlicing )
+    {
+        herm_eig::SpectrumSlice( uplo, A, w, Q, true, ctrl );
+    }
     else if( ctrl.tridiagEigCtrl.alg == HERM_TRIDIAG_EIG_MRRR )
     {
         info = herm_eig::MRRR( uplo, A, w, Q, ctrl );
@@ -1107,7 +1138,7 @@ HermitianEig
     }
 
     auto sortPairs = TaggedSort( w, ctrl.tridiagEigCtrl.sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<w.Height(); ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, Q );
 
@@ -1121,6 +1152,35 @@ HermitianEig
     return info;
 }
 
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo,
+  DistMatrixBatch<F>& A,
+  DistMatrixBatch<Base<F>>& w,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    if( !A.SharesLayout(w) )
+        LogicError("The eigenvalue batch must share the layout of A");
+    for( const Int k : A.LocalIndices() )
+        HermitianEig( uplo, A(k), w(k), ctrl );
+}
+
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo,
+  DistMatrixBatch<F>& A,
+  DistMatrixBatch<Base<F>>& w,
+  DistMatrixBatch<F>& Q,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    if( !A.SharesLayout(w) || !A.SharesLayout(Q) )
+        LogicError("The eigenpair batches must share the layout of A");
+    for( const Int k : A.LocalIndices() )
+        HermitianEig( uplo, A(k), w(k), Q(k), ctrl );
+}
+
 #define EIGVAL_PROTO(F) \
   template HermitianEigInfo HermitianEig\
   ( UpperOrLower uplo, \
@@ -1131,6 +1191,11 @@ HermitianEig
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<Base<F>>& w, \
+    const HermitianEigCtrl<F>& ctrl ); \
+  template void HermitianEig\
+  ( UpperOrLower uplo, \
+    DistMatrixBatch<F>& A, \
+    DistMatrixBatch<Base<F>>& w, \
     const HermitianEigCtrl<F>& ctrl );
 
 #define EIGPAIR_PROTO(F) \
@@ -1145,11 +1210,34 @@ HermitianEig
     AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<Base<F>>& w, \
     AbstractDistMatrix<F>& Q, \
+    const HermitianEigCtrl<F>& ctrl ); \
+  template void HermitianEig\
+  ( UpperOrLower uplo, \
+    DistMatrixBatch<F>& A, \
+    DistMatrixBatch<Base<F>>& w, \
+    DistMatrixBatch<F>& Q, \
+    const HermitianEigCtrl<F>& ctrl );
+
+#define REFINE_PROTO(F) \
+  template HermitianEigRefineInfo<Base<F>> HermitianEigRefine \
+  ( UpperOrLower uplo, \
+    const Matrix<F>& A, \
+          Matrix<Base<F>>& w, \
+          Matrix<F>& Q, \
+    const HermitianEigRefineCtrl<Base<F>>& refineCtrl, \
+    const HermitianEigCtrl<F>& ctrl ); \
+  template HermitianEigRefineInfo<Base<F>> HermitianEigRefine \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<Base<F>>& w, \
+          AbstractDistMatrix<F>& Q, \
+    const HermitianEigRefineCtrl<Base<F>>& refineCtrl, \
     const HermitianEigCtrl<F>& ctrl );
 
 #define PROTO(F) \
   EIGVAL_PROTO(F) \
-  EIGPAIR_PROTO(F)
+  EIGPAIR_PROTO(F) \
+  REFINE_PROTO(F)
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
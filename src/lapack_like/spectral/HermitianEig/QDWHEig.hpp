@@ -0,0 +1,263 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANEIG_QDWHEIG_HPP
+#define EL_HERMITIANEIG_QDWHEIG_HPP
+
+// Based upon Nakatsukasa and Higham's QDWH-eig: the unitary polar factor U of
+// A - sigma I (computed via the QR-based dynamically weighted Halley
+// iteration) yields the orthogonal projector P = (U + I) / 2 onto the
+// invariant subspace of the eigenvalues larger than sigma, whose rank is
+// trace(P). A few steps of subspace iteration on P and I - P then provide
+// orthonormal bases V1 and V2 for the two invariant subspaces, and A is
+// replaced with [V1, V2]^H A [V1, V2], which is block-diagonal up to the
+// backward error of the split. Nearly all of the work is in Gemm and QR.
+
+namespace El {
+namespace herm_eig {
+
+// Orthonormalize the columns of X
+template<typename F>
+void Orthonormalize( Matrix<F>& X )
+{
+    DEBUG_CSE
+    qr::ExplicitUnitary( X );
+}
+
+// Orthonormalize the columns of X, using a tall-skinny QR when the shape of X
+// and the number of processes allow for it
+template<typename F>
+void Orthonormalize( DistMatrix<F>& X )
+{
+    DEBUG_CSE
+    const Grid& g = X.Grid();
+    const Int p = g.Size();
+    const bool powerOfTwo = ( (p & (p-1)) == 0 );
+    if( p > 1 && powerOfTwo && X.Width() > 0 && X.Height() >= p*X.Width() )
+    {
+        DistMatrix<F,VC,STAR> X_VC_STAR( X );
+        DistMatrix<F,STAR,STAR> R(g);
+        qr::ExplicitTS( X_VC_STAR, R );
+        X = X_VC_STAR;
+    }
+    else
+        qr::ExplicitUnitary( X );
+}
+
+// Form an orthonormal basis for the range of the rank-k orthogonal projector P
+// via subspace iteration from a random starting basis
+template<typename F>
+void ProjectorRange( const Matrix<F>& P, Int k, Matrix<F>& V, Int numIts )
+{
+    DEBUG_CSE
+    Matrix<F> X;
+    Gaussian( V, P.Height(), k );
+    for( Int it=0; it<Max(numIts,Int(1)); ++it )
+    {
+        Gemm( NORMAL, NORMAL, F(1), P, V, X );
+        Orthonormalize( X );
+        V = X;
+    }
+}
+
+template<typename F>
+void ProjectorRange
+( const DistMatrix<F>& P, Int k, DistMatrix<F>& V, Int numIts )
+{
+    DEBUG_CSE
+    DistMatrix<F> X(P.Grid());
+    Gaussian( V, P.Height(), k );
+    for( Int it=0; it<Max(numIts,Int(1)); ++it )
+    {
+        Gemm( NORMAL, NORMAL, F(1), P, V, X );
+        Orthonormalize( X );
+        V = X;
+    }
+}
+
+// Overwrite A with [V1, V2]^H A [V1, V2] and, if returnQ=true, Q with
+// [V1, V2], where V1 spans the eigenvalues above the split point
+template<typename F>
+ValueInt<Base<F>>
+QDWHEigDivide
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& Q,
+  bool returnQ,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real oneA = OneNorm( A );
+    const auto median = Median(GetRealPartOfDiagonal(A));
+    const Real spread = ctrl.spreadFactor*InfinityNorm(A);
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = 500*n*limits::Epsilon<Real>();
+
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+
+    ValueInt<Real> part;
+    part.value = limits::Infinity<Real>();
+    part.index = 0;
+    Matrix<F> P, V1, V2, V, B, T, ABest;
+    for( Int it=0; it<ctrl.maxOuterIts; ++it )
+    {
+        // The median of the diagonal is a cheap estimate of the median
+        // eigenvalue; it is only perturbed if the split fails
+        const Real shift =
+          ( it == 0 ? median.value : SampleBall<Real>(median.value,spread) );
+
+        // P := (sgn(A - shift I) + I) / 2
+        P = A;
+        ShiftDiagonal( P, F(-shift) );
+        HermitianPolar( uplo, P, polarCtrl );
+        ShiftDiagonal( P, F(1) );
+        P *= F(1)/F(2);
+        const Int k = Int(Round(RealPart(Trace(P))));
+        if( ctrl.progress )
+            Output("QDWH-eig shift ",shift," splits off ",k," of ",n);
+        if( k <= 0 || k >= n )
+            continue;
+
+        ProjectorRange( P, k, V1, ctrl.numSubspaceIts );
+        P *= F(-1);
+        ShiftDiagonal( P, F(1) );
+        ProjectorRange( P, n-k, V2, ctrl.numSubspaceIts );
+        Zeros( V, n, n );
+        auto VL = V( ALL, IR(0,k) );
+        auto VR = V( ALL, IR(k,n) );
+        VL = V1;
+        VR = V2;
+
+        // T := V^H A V
+        Gemm( ADJOINT, NORMAL, F(1), V, A, B );
+        Gemm( NORMAL, NORMAL, F(1), B, V, T );
+        const Real errorNorm = OneNorm( T(IR(k,n),IR(0,k)) ) / oneA;
+        if( errorNorm < part.value )
+        {
+            part.value = errorNorm;
+            part.index = k;
+            ABest = T;
+            if( returnQ )
+                Q = V;
+        }
+        if( part.value <= tol )
+            break;
+    }
+    if( part.value > tol )
+        RuntimeError
+        ( "Unable to split spectrum to specified accuracy: part.value=",
+          part.value, ", tol=", tol );
+    A = ABest;
+
+    return part;
+}
+
+template<typename F>
+ValueInt<Base<F>>
+QDWHEigDivide
+( UpperOrLower uplo,
+  DistMatrix<F>& A,
+  DistMatrix<F>& Q,
+  bool returnQ,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real oneA = OneNorm( A );
+    const auto median = Median(GetRealPartOfDiagonal(A));
+    const Real spread = ctrl.spreadFactor*InfinityNorm(A);
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = 500*n*limits::Epsilon<Real>();
+
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+
+    ValueInt<Real> part;
+    part.value = limits::Infinity<Real>();
+    part.index = 0;
+    DistMatrix<F> P(g), V1(g), V2(g), V(g), B(g), T(g), ABest(g);
+    for( Int it=0; it<ctrl.maxOuterIts; ++it )
+    {
+        // The median of the diagonal is a cheap estimate of the median
+        // eigenvalue; it is only perturbed if the split fails
+        Real shift = median.value;
+        if( it > 0 )
+        {
+            shift = SampleBall<Real>(median.value,spread);
+            mpi::Broadcast( shift, 0, g.VCComm() );
+        }
+
+        // P := (sgn(A - shift I) + I) / 2
+        P = A;
+        ShiftDiagonal( P, F(-shift) );
+        HermitianPolar( uplo, P, polarCtrl );
+        ShiftDiagonal( P, F(1) );
+        P *= F(1)/F(2);
+        const Int k = Int(Round(RealPart(Trace(P))));
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("QDWH-eig shift ",shift," splits off ",k," of ",n);
+        if( k <= 0 || k >= n )
+            continue;
+
+        ProjectorRange( P, k, V1, ctrl.numSubspaceIts );
+        P *= F(-1);
+        ShiftDiagonal( P, F(1) );
+        ProjectorRange( P, n-k, V2, ctrl.numSubspaceIts );
+        Zeros( V, n, n );
+        auto VL = V( ALL, IR(0,k) );
+        auto VR = V( ALL, IR(k,n) );
+        VL = V1;
+        VR = V2;
+
+        // T := V^H A V
+        Gemm( ADJOINT, NORMAL, F(1), V, A, B );
+        Gemm( NORMAL, NORMAL, F(1), B, V, T );
+        const Real errorNorm = OneNorm( T(IR(k,n),IR(0,k)) ) / oneA;
+        if( errorNorm < part.value )
+        {
+            part.value = errorNorm;
+            part.index = k;
+            ABest = T;
+            if( returnQ )
+                Q = V;
+        }
+        if( part.value <= tol )
+            break;
+    }
+    if( part.value > tol )
+        RuntimeError
+        ( "Unable to split spectrum to specified accuracy: part.value=",
+          part.value, ", tol=", tol );
+    A = ABest;
+
+    return part;
+}
+
+// The spectral divide and conquer controls, with QDWH-eig splits if requested
+template<typename F>
+HermitianSDCCtrl<Base<F>> SDCCtrl( const HermitianEigCtrl<F>& ctrl )
+{
+    auto sdcCtrl = ctrl.sdcCtrl;
+    if( ctrl.useQDWHEig )
+        sdcCtrl.qdwhEig = true;
+    return sdcCtrl;
+}
+
+} // namespace herm_eig
+} // namespace El
+
+#endif // ifndef EL_HERMITIANEIG_QDWHEIG_HPP
@@ -0,0 +1,292 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANEIG_REFINE_HPP
+#define EL_HERMITIANEIG_REFINE_HPP
+
+// Warm-started refinement of the eigenpairs at one end of the spectrum: each
+// iteration applies a Chebyshev polynomial in A which is bounded on the
+// unwanted part of the spectrum (see Zhou and Saad's "Chebyshev-filtered
+// subspace iteration"), orthonormalizes the result, and then performs a
+// Rayleigh-Ritz projection with a small dense HermitianEig. The unwanted
+// interval is bounded from the wanted side by the extremal Ritz value and
+// from the other by the one norm of A.
+
+namespace El {
+namespace herm_eig {
+
+template<typename Real>
+Real RefineTolerance( const HermitianEigRefineCtrl<Real>& refineCtrl )
+{
+    if( refineCtrl.tol == Real(0) )
+        return Sqrt(limits::Epsilon<Real>());
+    return refineCtrl.tol;
+}
+
+// The controls for recomputing the same eigenpairs from scratch
+template<typename F>
+HermitianEigCtrl<F> RefineFallbackCtrl
+( Int n, Int k, bool largest, const HermitianEigCtrl<F>& ctrl )
+{
+    auto fallbackCtrl = ctrl;
+    auto& subset = fallbackCtrl.tridiagEigCtrl.subset;
+    subset.rangeSubset = false;
+    subset.indexSubset = ( k < n );
+    subset.lowerIndex = ( largest ? n-k : 0 );
+    subset.upperIndex = ( largest ? n-1 : k-1 );
+    fallbackCtrl.tridiagEigCtrl.sort = ASCENDING;
+    return fallbackCtrl;
+}
+
+// Overwrite the orthonormal Q with the Ritz vectors of A over its range, w with
+// the (ascending) Ritz values, and AQ with A times the Ritz vectors. The
+// relative residual is returned.
+template<typename F>
+Base<F> RayleighRitz
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  const Base<F>& oneNormA,
+  Matrix<F>& Q,
+  Matrix<F>& AQ,
+  Matrix<Base<F>>& w )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = Q.Height();
+    const Int k = Q.Width();
+    Matrix<F> H, Z, X;
+    Zeros( AQ, n, k );
+    Hemm( LEFT, uplo, F(1), A, Q, F(0), AQ );
+    Gemm( ADJOINT, NORMAL, F(1), Q, AQ, H );
+    HermitianEig( LOWER, H, w, Z );
+    Gemm( NORMAL, NORMAL, F(1), Q, Z, X );
+    Q = X;
+    Gemm( NORMAL, NORMAL, F(1), AQ, Z, X );
+    AQ = X;
+
+    // X := A Q - Q W
+    Matrix<F> QW( Q );
+    DiagonalScale( RIGHT, NORMAL, w, QW );
+    X -= QW;
+    Matrix<Real> norms;
+    ColumnTwoNorms( X, norms );
+    return ( oneNormA == Real(0) ? Real(0) : MaxNorm(norms)/oneNormA );
+}
+
+template<typename F>
+Base<F> RayleighRitz
+( UpperOrLower uplo,
+  const DistMatrix<F>& A,
+  const Base<F>& oneNormA,
+  DistMatrix<F>& Q,
+  DistMatrix<F>& AQ,
+  DistMatrix<Base<F>,STAR,STAR>& w )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = Q.Height();
+    const Int k = Q.Width();
+    DistMatrix<F> H(g), X(g);
+    Zeros( AQ, n, k );
+    Hemm( LEFT, uplo, F(1), A, Q, F(0), AQ );
+    Gemm( ADJOINT, NORMAL, F(1), Q, AQ, H );
+
+    // The projected problem is small, so it is redundantly solved
+    DistMatrix<F,STAR,STAR> H_STAR_STAR( H ), Z_STAR_STAR(g);
+    w.SetGrid( g );
+    w.Resize( k, 1 );
+    HermitianEig
+    ( LOWER, H_STAR_STAR.Matrix(), w.Matrix(), Z_STAR_STAR.Matrix() );
+    Z_STAR_STAR.Resize( k, k );
+    DistMatrix<F> Z( Z_STAR_STAR );
+    Gemm( NORMAL, NORMAL, F(1), Q, Z, X );
+    Q = X;
+    Gemm( NORMAL, NORMAL, F(1), AQ, Z, X );
+    AQ = X;
+
+    // X := A Q - Q W
+    DistMatrix<F> QW( Q );
+    DiagonalScale( RIGHT, NORMAL, w, QW );
+    X -= QW;
+    DistMatrix<Real,MR,STAR> norms(g);
+    ColumnTwoNorms( X, norms );
+    return ( oneNormA == Real(0) ? Real(0) : MaxNorm(norms)/oneNormA );
+}
+
+// Overwrite X with p(sign A) X, where p is the Chebyshev polynomial of the
+// given degree which is bounded on [cut,upperBound] and scaled to be one at
+// lowerBound, an estimate of the smallest eigenvalue of sign A
+template<typename F,class MatrixType>
+void ChebyshevFilter
+( UpperOrLower uplo,
+  const MatrixType& A,
+  const Base<F>& sign,
+  Int degree,
+  const Base<F>& lowerBound,
+  const Base<F>& cut,
+  const Base<F>& upperBound,
+  MatrixType& X )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real e = (upperBound-cut) / 2;
+    const Real c = (upperBound+cut) / 2;
+    Real sigma = e / (lowerBound-c);
+    const Real tau = 2 / sigma;
+
+    // Y := (sign A - c I) X (sigma/e)
+    MatrixType Y( X ), YNew( X );
+    Hemm( LEFT, uplo, F(sign*sigma/e), A, X, F(-c*sigma/e), Y );
+    for( Int i=1; i<degree; ++i )
+    {
+        // YNew := (sign A - c I) Y (2 sigmaNew/e) - (sigma sigmaNew) X
+        const Real sigmaNew = 1 / (tau-sigma);
+        YNew = Y;
+        Hemm
+        ( LEFT, uplo, F(2*sign*sigmaNew/e), A, Y, F(-2*c*sigmaNew/e), YNew );
+        Axpy( F(-sigma*sigmaNew), X, YNew );
+        X = Y;
+        Y = YNew;
+        sigma = sigmaNew;
+    }
+    X = Y;
+}
+
+} // namespace herm_eig
+
+template<typename F>
+HermitianEigRefineInfo<Base<F>>
+HermitianEigRefine
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+        Matrix<Base<F>>& w,
+        Matrix<F>& Q,
+  const HermitianEigRefineCtrl<Base<F>>& refineCtrl,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int k = Q.Width();
+    if( A.Width() != n || Q.Height() != n )
+        LogicError("A must be square and Q must have its height");
+    if( k == 0 || k > n )
+        LogicError("Q must have between one and n columns");
+    const Real tol = herm_eig::RefineTolerance( refineCtrl );
+    const Real sign = ( refineCtrl.largest ? Real(-1) : Real(1) );
+    const Real oneNormA = HermitianOneNorm( uplo, A );
+
+    HermitianEigRefineInfo<Real> info;
+    Matrix<F> AQ;
+    herm_eig::Orthonormalize( Q );
+    info.residual = herm_eig::RayleighRitz( uplo, A, oneNormA, Q, AQ, w );
+    if( refineCtrl.progress )
+        Output("Initial relative residual: ",info.residual);
+    while( info.residual > tol && info.numIts < refineCtrl.maxIts && k < n )
+    {
+        // The Ritz values of sign A lie in [lowerBound,cut]
+        const Real lowerBound = ( sign > Real(0) ? w(0) : -w(k-1) );
+        const Real cut = ( sign > Real(0) ? w(k-1) : -w(0) );
+        if( cut >= oneNormA )
+            break;
+        herm_eig::ChebyshevFilter<F>
+        ( uplo, A, sign, Max(refineCtrl.chebyshevDegree,Int(1)),
+          lowerBound, cut, oneNormA, Q );
+        herm_eig::Orthonormalize( Q );
+        info.residual = herm_eig::RayleighRitz( uplo, A, oneNormA, Q, AQ, w );
+        ++info.numIts;
+        if( refineCtrl.progress )
+            Output("Iteration ",info.numIts,": ",info.residual);
+    }
+    if( info.residual > tol && refineCtrl.fallback )
+    {
+        if( refineCtrl.progress )
+            Output("Falling back to a full eigensolve");
+        auto fallbackCtrl =
+          herm_eig::RefineFallbackCtrl( n, k, refineCtrl.largest, ctrl );
+        Matrix<F> ACopy( A );
+        info.eigInfo = HermitianEig( uplo, ACopy, w, Q, fallbackCtrl );
+        info.fellBack = true;
+    }
+    return info;
+}
+
+template<typename F>
+HermitianEigRefineInfo<Base<F>>
+HermitianEigRefine
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<Base<F>>& w,
+        AbstractDistMatrix<F>& QPre,
+  const HermitianEigRefineCtrl<Base<F>>& refineCtrl,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, w, QPre ))
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+    const Int k = QPre.Width();
+    if( APre.Width() != n || QPre.Height() != n )
+        LogicError("A must be square and Q must have its height");
+    if( k == 0 || k > n )
+        LogicError("Q must have between one and n columns");
+    const Grid& g = APre.Grid();
+    const Real tol = herm_eig::RefineTolerance( refineCtrl );
+    const Real sign = ( refineCtrl.largest ? Real(-1) : Real(1) );
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& A = AProx.GetLocked();
+    auto& Q = QProx.Get();
+    const Real oneNormA = HermitianOneNorm( uplo, A );
+
+    HermitianEigRefineInfo<Real> info;
+    DistMatrix<F> AQ(g);
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR(g);
+    herm_eig::Orthonormalize( Q );
+    info.residual =
+      herm_eig::RayleighRitz( uplo, A, oneNormA, Q, AQ, w_STAR_STAR );
+    if( refineCtrl.progress && g.Rank() == 0 )
+        Output("Initial relative residual: ",info.residual);
+    while( info.residual > tol && info.numIts < refineCtrl.maxIts && k < n )
+    {
+        // The Ritz values of sign A lie in [lowerBound,cut]
+        const auto& wLoc = w_STAR_STAR.Matrix();
+        const Real lowerBound = ( sign > Real(0) ? wLoc(0) : -wLoc(k-1) );
+        const Real cut = ( sign > Real(0) ? wLoc(k-1) : -wLoc(0) );
+        if( cut >= oneNormA )
+            break;
+        herm_eig::ChebyshevFilter<F>
+        ( uplo, A, sign, Max(refineCtrl.chebyshevDegree,Int(1)),
+          lowerBound, cut, oneNormA, Q );
+        herm_eig::Orthonormalize( Q );
+        info.residual =
+          herm_eig::RayleighRitz( uplo, A, oneNormA, Q, AQ, w_STAR_STAR );
+        ++info.numIts;
+        if( refineCtrl.progress && g.Rank() == 0 )
+            Output("Iteration ",info.numIts,": ",info.residual);
+    }
+    if( info.residual > tol && refineCtrl.fallback )
+    {
+        if( refineCtrl.progress && g.Rank() == 0 )
+            Output("Falling back to a full eigensolve");
+        auto fallbackCtrl =
+          herm_eig::RefineFallbackCtrl( n, k, refineCtrl.largest, ctrl );
+        DistMatrix<F> ACopy( A );
+        info.eigInfo = HermitianEig( uplo, ACopy, w, Q, fallbackCtrl );
+        info.fellBack = true;
+    }
+    else
+        Copy( w_STAR_STAR, w );
+    return info;
+}
+
+} // namespace El
+
+#endif // ifndef EL_HERMITIANEIG_REFINE_HPP
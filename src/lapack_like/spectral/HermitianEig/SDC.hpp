@@ -10,6 +10,7 @@
 #define EL_HERMITIANEIG_SDC_HPP
 
 #include "../Schur/SDC.hpp"
+#include "./QDWHEig.hpp"
 
 // TODO(poulson): Reference to Yuji's work
 
@@ -265,6 +266,11 @@ SpectralDivide
   const HermitianSDCCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.qdwhEig )
+    {
+        Matrix<F> Q;
+        return QDWHEigDivide( uplo, A, Q, false, ctrl );
+    }
 
     typedef Base<F> Real;
     const Int n = A.Height();
@@ -314,6 +320,8 @@ SpectralDivide
   const HermitianSDCCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.qdwhEig )
+        return QDWHEigDivide( uplo, A, Q, true, ctrl );
 
     typedef Base<F> Real;
     const Int n = A.Height();
@@ -362,6 +370,11 @@ SpectralDivide
   const HermitianSDCCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.qdwhEig )
+    {
+        DistMatrix<F> Q(A.Grid());
+        return QDWHEigDivide( uplo, A, Q, false, ctrl );
+    }
 
     typedef Base<F> Real;
     const Int n = A.Height();
@@ -412,6 +425,8 @@ SpectralDivide
   const HermitianSDCCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.qdwhEig )
+        return QDWHEigDivide( uplo, A, Q, true, ctrl );
 
     typedef Base<F> Real;
     const Int n = A.Height();
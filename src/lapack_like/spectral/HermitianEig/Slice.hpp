@@ -0,0 +1,573 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANEIG_SLICE_HPP
+#define EL_HERMITIANEIG_SLICE_HPP
+
+// Spectrum slicing for a subset of the spectrum of a Hermitian matrix.
+//
+// The number of eigenvalues of A which are at most sigma is read off of the
+// inertia of a pivoted LDL^H factorization of A - sigma I (Sylvester's law of
+// inertia), which is used to bracket the requested subset with an interval
+// (lower,upper] and to split the interval into slices holding roughly equal
+// numbers of eigenvalues. Each slice is then solved independently with
+// shift-invert Lanczos (with full reorthogonalization) about its midpoint,
+// where the inertia count of the slice determines how many Ritz pairs must
+// converge. Distributed slices are dealt out to the sub-grids of a
+// DistMatrixBatch so that each sub-grid proceeds independently.
+
+namespace El {
+
+namespace herm_eig {
+
+namespace slice {
+
+// A pivoted LDL^H factorization of A - shift I, where only the lower triangle
+// of A is accessed
+template<typename F>
+class ShiftedLDL
+{
+public:
+    ShiftedLDL( const Matrix<F>& A, Base<F> shift )
+    : factor_(A)
+    {
+        DEBUG_CSE
+        ShiftDiagonal( factor_, F(-shift) );
+        LDL( factor_, dSub_, p_, true );
+        inertia_ = ldl::Inertia( GetRealPartOfDiagonal(factor_), dSub_ );
+    }
+
+    // The number of eigenvalues of A which are less than or equal to the shift
+    Int NumBelow() const { return inertia_.numNegative+inertia_.numZero; }
+    bool Singular() const { return inertia_.numZero != 0; }
+
+    // X := inv(A - shift I) X
+    void Solve( Matrix<F>& X ) const
+    { ldl::SolveAfter( factor_, dSub_, p_, X, true ); }
+
+private:
+    Matrix<F> factor_, dSub_;
+    Permutation p_;
+    InertiaType inertia_;
+};
+
+template<typename F>
+class DistShiftedLDL
+{
+public:
+    DistShiftedLDL( const DistMatrix<F>& A, Base<F> shift )
+    : factor_(A), dSub_(A.Grid()), p_(A.Grid())
+    {
+        DEBUG_CSE
+        ShiftDiagonal( factor_, F(-shift) );
+        LDL( factor_, dSub_, p_, true );
+        inertia_ = ldl::Inertia( GetRealPartOfDiagonal(factor_), dSub_ );
+    }
+
+    Int NumBelow() const { return inertia_.numNegative+inertia_.numZero; }
+    bool Singular() const { return inertia_.numZero != 0; }
+
+    void Solve( DistMatrix<F>& X ) const
+    { ldl::SolveAfter( factor_, dSub_, p_, X, true ); }
+
+private:
+    DistMatrix<F> factor_;
+    DistMatrix<F,MD,STAR> dSub_;
+    DistPermutation p_;
+    InertiaType inertia_;
+};
+
+// X := V Z, where Z is replicated over the grid of V
+template<typename F>
+void RitzVectors( const Matrix<F>& V, const Matrix<F>& Z, Matrix<F>& X )
+{
+    DEBUG_CSE
+    Gemm( NORMAL, NORMAL, F(1), V, Z, X );
+}
+
+template<typename F>
+void RitzVectors
+( const DistMatrix<F>& V, const Matrix<F>& Z, DistMatrix<F>& X )
+{
+    DEBUG_CSE
+    DistMatrix<F,STAR,STAR> Z_STAR_STAR( V.Grid() );
+    Z_STAR_STAR.LockedAttach( V.Grid(), Z );
+    Gemm( NORMAL, NORMAL, F(1), V, Z_STAR_STAR, X );
+}
+
+// Search (lower,upper) for a shift whose count lies within
+// [minCount,maxCount]. If none is found within the iteration limit, the
+// (count-bracketing) lower or upper endpoint is returned instead.
+template<class ShiftedType,class MatType,typename Real>
+pair<Real,Int> BisectCount
+( const MatType& A,
+  pair<Real,Int> lower,
+  pair<Real,Int> upper,
+  Int minCount,
+  Int maxCount,
+  bool preferLower,
+  Int maxIts )
+{
+    DEBUG_CSE
+    if( lower.second >= minCount && lower.second <= maxCount )
+        return lower;
+    if( upper.second >= minCount && upper.second <= maxCount )
+        return upper;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        const Real mid = (lower.first+upper.first)/Real(2);
+        const Int count = ShiftedType( A, mid ).NumBelow();
+        if( count < minCount )
+            lower = pair<Real,Int>(mid,count);
+        else if( count > maxCount )
+            upper = pair<Real,Int>(mid,count);
+        else
+            return pair<Real,Int>(mid,count);
+    }
+    return preferLower ? lower : upper;
+}
+
+// Bracket the requested subset of the spectrum of the (full) Hermitian matrix
+// A with (bounds.front(),bounds.back()], and split it into the slices
+// (bounds[s],bounds[s+1]], where counts[s] is the number of eigenvalues of A
+// which are at most bounds[s]. Empty slices are dropped.
+template<class ShiftedType,class MatType,typename Real>
+void Bounds
+( const MatType& A,
+        Real normA,
+  const HermitianEigSubset<Real>& subset,
+        Int numSlices,
+  const HermitianSliceCtrl<Real>& ctrl,
+        vector<Real>& bounds,
+        vector<Int>& counts )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    // Every eigenvalue lies within [-|| A ||_1,|| A ||_1]
+    const Real spectralBound = (1+Real(2*n)*eps)*normA;
+    pair<Real,Int> lower(-spectralBound,0), upper(spectralBound,n);
+    if( subset.rangeSubset )
+    {
+        if( subset.lowerBound > lower.first )
+            lower = pair<Real,Int>
+              (subset.lowerBound,
+               ShiftedType(A,subset.lowerBound).NumBelow());
+        if( subset.upperBound < upper.first )
+            upper = pair<Real,Int>
+              (subset.upperBound,
+               ShiftedType(A,subset.upperBound).NumBelow());
+    }
+    else if( subset.indexSubset )
+    {
+        // Allow the bracket to hold a few more eigenvalues than requested
+        // rather than spending further factorizations on tightening it
+        const Int numWanted = subset.upperIndex-subset.lowerIndex+1;
+        const Int slack = Max( numWanted/8, Int(1) );
+        lower =
+          BisectCount<ShiftedType>
+          ( A, lower, upper,
+            Max(subset.lowerIndex-slack,Int(0)), subset.lowerIndex,
+            true, ctrl.maxBisectIts );
+        upper =
+          BisectCount<ShiftedType>
+          ( A, lower, upper,
+            subset.upperIndex+1, Min(subset.upperIndex+1+slack,n),
+            false, ctrl.maxBisectIts );
+    }
+
+    bounds.assign( 1, lower.first );
+    counts.assign( 1, lower.second );
+    const Int numEigs = upper.second - lower.second;
+    numSlices = Max( Min(numSlices,numEigs), Int(1) );
+    const Int slack = numEigs / (4*numSlices);
+    for( Int s=1; s<numSlices; ++s )
+    {
+        const Int target = lower.second + (s*numEigs)/numSlices;
+        auto split =
+          BisectCount<ShiftedType>
+          ( A, pair<Real,Int>(bounds.back(),counts.back()), upper,
+            target-slack, target+slack, true, ctrl.maxBisectIts );
+        if( split.second > counts.back() && split.second < upper.second )
+        {
+            bounds.push_back( split.first );
+            counts.push_back( split.second );
+        }
+    }
+    bounds.push_back( upper.first );
+    counts.push_back( upper.second );
+}
+
+// Compute the numEigs eigenpairs of the (full) Hermitian matrix A within
+// (lower,upper] using shift-invert Lanczos. V and h are workspace. The
+// eigenvalues are replicated over the grid of A.
+template<typename F,class ShiftedType,class MatType>
+void Solve
+( const MatType& A,
+        Base<F> lower,
+        Base<F> upper,
+        Int numEigs,
+        Base<F> normA,
+        MatType& V,
+        MatType& h,
+        Matrix<Base<F>>& w,
+        MatType& X,
+        bool wantVecs,
+  const HermitianSliceCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    w.Resize( 0, 1 );
+    X.Resize( n, 0 );
+    if( numEigs == 0 )
+        return;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol == Real(0) ? Pow(eps,Real(0.75)) : ctrl.tol );
+
+    // Factor about the midpoint of the slice, nudging the shift towards the
+    // upper bound if it happens to be an eigenvalue
+    Real shift = (lower+upper)/Real(2);
+    unique_ptr<ShiftedType> shifted( new ShiftedType(A,shift) );
+    for( Int nudge=0; nudge<10 && shifted->Singular(); ++nudge )
+    {
+        shift += (upper-shift)/Real(2);
+        shifted.reset( new ShiftedType(A,shift) );
+    }
+    const Real normShifted = normA + Abs(shift);
+
+    Matrix<Real> d, e, theta, Z;
+    Int basisSize = Min( n, 2*numEigs+ctrl.extraBasis );
+    while( true )
+    {
+        Zeros( d, basisSize, 1 );
+        Zeros( e, basisSize, 1 );
+        Zeros( V, n, basisSize+1 );
+        auto v0 = V( ALL, IR(0) );
+        MakeGaussian( v0 );
+        Scale( F(1)/FrobeniusNorm(v0), v0 );
+
+        // Build inv(A - shift I) V_m = V_m T + beta_m v_{m+1} e_m^T, with T
+        // tridiagonal, using two passes of classical Gram-Schmidt against the
+        // entire basis
+        Real scale = 0;
+        for( Int j=0; j<basisSize; ++j )
+        {
+            auto VPrev = V( ALL, IR(0,j+1) );
+            auto v = V( ALL, IR(j) );
+            auto vNext = V( ALL, IR(j+1) );
+            vNext = v;
+            shifted->Solve( vNext );
+            Real alpha = 0;
+            for( Int pass=0; pass<2; ++pass )
+            {
+                Gemv( ADJOINT, F(1), VPrev, vNext, h );
+                alpha += RealPart( h.Get(j,0) );
+                Gemv( NORMAL, F(-1), VPrev, h, F(1), vNext );
+            }
+            const Real beta = FrobeniusNorm( vNext );
+            d(j) = alpha;
+            e(j) = beta;
+            scale = Max( scale, Abs(alpha)+beta );
+            if( j+1 == basisSize )
+                break;
+
+            if( beta > eps*scale )
+            {
+                Scale( F(1)/beta, vNext );
+            }
+            else
+            {
+                // The basis spans an invariant subspace, so continue with a
+                // fresh direction (which also exposes repeated eigenvalues)
+                e(j) = 0;
+                MakeGaussian( vNext );
+                for( Int pass=0; pass<2; ++pass )
+                {
+                    Gemv( ADJOINT, F(1), VPrev, vNext, h );
+                    Gemv( NORMAL, F(-1), VPrev, h, F(1), vNext );
+                }
+                Scale( F(1)/FrobeniusNorm(vNext), vNext );
+            }
+        }
+
+        auto eSub = e( IR(0,basisSize-1), ALL );
+        HermitianTridiagEig( d, eSub, theta, Z );
+
+        // A Ritz pair (theta,y) of inv(A - shift I) has
+        //   A y - (shift + 1/theta) y = -(beta_m z_m / theta) (A - shift I) v,
+        // so its residual is bounded by | beta_m z_m / theta | || A - shift I ||
+        const Real betaLast = e(basisSize-1);
+        vector<pair<Real,Int>> accepted;
+        for( Int i=0; i<basisSize; ++i )
+        {
+            if( theta(i) == Real(0) )
+                continue;
+            const Real lambda = shift + Real(1)/theta(i);
+            if( lambda <= lower || lambda > upper )
+                continue;
+            const Real residual =
+              Abs(betaLast*Z(basisSize-1,i))*normShifted/Abs(theta(i));
+            if( residual <= tol*normA || basisSize == n )
+                accepted.push_back( pair<Real,Int>(Abs(lambda-shift),i) );
+        }
+        if( ctrl.progress )
+            Output
+            ("  slice (",lower,",",upper,"]: ",accepted.size()," of ",numEigs,
+             " converged with a basis of size ",basisSize);
+
+        const Int numAccepted = accepted.size();
+        if( numAccepted >= numEigs || basisSize == n )
+        {
+            if( numAccepted < numEigs )
+                RuntimeError
+                ("Only found ",numAccepted," of the ",numEigs,
+                 " eigenvalues in (",lower,",",upper,"]");
+
+            // Any surplus must lie on the slice boundaries, where the inertia
+            // counts are authoritative, so keep the Ritz values nearest the
+            // shift
+            std::sort( accepted.begin(), accepted.end() );
+            w.Resize( numEigs, 1 );
+            Matrix<Real> ZSel( basisSize, numEigs );
+            for( Int k=0; k<numEigs; ++k )
+            {
+                const Int i = accepted[k].second;
+                w(k) = shift + Real(1)/theta(i);
+                auto zSel = ZSel( ALL, IR(k) );
+                zSel = Z( ALL, IR(i) );
+            }
+            if( wantVecs )
+            {
+                Matrix<F> ZSelF;
+                Copy( ZSel, ZSelF );
+                RitzVectors( V(ALL,IR(0,basisSize)), ZSelF, X );
+            }
+            return;
+        }
+        basisSize = Min( n, 2*basisSize );
+    }
+}
+
+// Sort the eigenvalues of (bounds.front(),bounds.back()] (and their
+// eigenvectors) into ascending order, keep those requested by an index subset
+// (given that the bracket's lower bound has 'countBelow' eigenvalues at or
+// beneath it), and then apply the requested sort
+template<typename Real,class RealMatType,class MatType>
+void Finalize
+( RealMatType& w,
+  MatType& Q,
+  bool wantVecs,
+  Int countBelow,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    auto sortPairs = TaggedSort( w, ASCENDING );
+    const Int numEigs = sortPairs.size();
+    for( Int j=0; j<numEigs; ++j )
+        w.Set( j, 0, sortPairs[j].value );
+    if( wantVecs )
+        ApplyTaggedSortToEachRow( sortPairs, Q );
+
+    if( ctrl.subset.indexSubset )
+    {
+        const Range<Int> keep
+          ( ctrl.subset.lowerIndex-countBelow,
+            ctrl.subset.upperIndex-countBelow+1 );
+        auto wCopy( w );
+        w = wCopy( keep, ALL );
+        if( wantVecs )
+        {
+            auto QCopy( Q );
+            Q = QCopy( ALL, keep );
+        }
+    }
+
+    if( ctrl.sort == DESCENDING )
+    {
+        sortPairs = TaggedSort( w, DESCENDING );
+        for( Int j=0; j<w.Height(); ++j )
+            w.Set( j, 0, sortPairs[j].value );
+        if( wantVecs )
+            ApplyTaggedSortToEachRow( sortPairs, Q );
+    }
+}
+
+} // namespace slice
+
+template<typename F>
+void SpectrumSlice
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  bool wantVecs,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef slice::ShiftedLDL<F> ShiftedType;
+    const Int n = A.Height();
+    const auto& subset = ctrl.tridiagEigCtrl.subset;
+    if( !subset.indexSubset && !subset.rangeSubset )
+        LogicError("Spectrum slicing requires an index or range subset");
+
+    Real normA = HermitianOneNorm( uplo, A );
+    if( normA == Real(0) )
+        normA = 1;
+    MakeHermitian( uplo, A );
+
+    const Int numSlices = Max( ctrl.sliceCtrl.numSlices, Int(1) );
+    vector<Real> bounds;
+    vector<Int> counts;
+    slice::Bounds<ShiftedType>
+    ( A, normA, subset, numSlices, ctrl.sliceCtrl, bounds, counts );
+    const Int numEigs = counts.back() - counts.front();
+
+    Zeros( w, numEigs, 1 );
+    if( wantVecs )
+        Zeros( Q, n, numEigs );
+    Matrix<F> V, h, X;
+    Matrix<Real> wSlice;
+    for( Int s=0; s<Int(bounds.size())-1; ++s )
+    {
+        const Range<Int> ind( counts[s]-counts[0], counts[s+1]-counts[0] );
+        slice::Solve<F,ShiftedType>
+        ( A, bounds[s], bounds[s+1], counts[s+1]-counts[s], normA,
+          V, h, wSlice, X, wantVecs, ctrl.sliceCtrl );
+        auto wDest = w( ind, ALL );
+        wDest = wSlice;
+        if( wantVecs )
+        {
+            auto QDest = Q( ALL, ind );
+            QDest = X;
+        }
+    }
+
+    slice::Finalize( w, Q, wantVecs, counts.front(), ctrl.tridiagEigCtrl );
+}
+
+template<typename F>
+void SpectrumSlice
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& w,
+  AbstractDistMatrix<F>& Q,
+  bool wantVecs,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+    const Grid& g = APre.Grid();
+    const auto& subset = ctrl.tridiagEigCtrl.subset;
+    if( !subset.indexSubset && !subset.rangeSubset )
+        LogicError("Spectrum slicing requires an index or range subset");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    Real normA = HermitianOneNorm( uplo, A );
+    if( normA == Real(0) )
+        normA = 1;
+    MakeHermitian( uplo, A );
+
+    // Give each sub-grid its own copy of A
+    DistMatrixBatch<F> ABatch( g, g.Size()/ctrl.sliceCtrl.groupSize,
+                               ctrl.sliceCtrl.groupSize );
+    const Int numGroups = ABatch.NumGroups();
+    for( Int k=0; k<numGroups; ++k )
+        ABatch.Scatter( k, A );
+
+    // Bracket and split the subset using the entire grid
+    const Int numSlices =
+      ( ctrl.sliceCtrl.numSlices > 0 ? ctrl.sliceCtrl.numSlices : numGroups );
+    vector<Real> bounds;
+    vector<Int> counts;
+    slice::Bounds<slice::DistShiftedLDL<F>>
+    ( A, normA, subset, numSlices, ctrl.sliceCtrl, bounds, counts );
+    const Int numEigs = counts.back() - counts.front();
+    A.Empty();
+
+    // Slice s is solved by sub-grid s % numGroups, which concatenates the
+    // results of all of its slices. Every process resizes every member so
+    // that the results may be gathered.
+    // (the layouts are copied through an Int batch so that the copy
+    // constructor is never selected)
+    const Int numSlicesKept = bounds.size()-1;
+    DistMatrixBatch<Int> layout( ABatch );
+    DistMatrixBatch<Real> wBatch( layout );
+    DistMatrixBatch<F> XBatch( layout );
+    vector<Int> groupOffsets(numSlicesKept), groupSizes(numGroups,0);
+    for( Int s=0; s<numSlicesKept; ++s )
+    {
+        groupOffsets[s] = groupSizes[s % numGroups];
+        groupSizes[s % numGroups] += counts[s+1] - counts[s];
+    }
+    for( Int k=0; k<numGroups; ++k )
+    {
+        wBatch.Resize( k, groupSizes[k], 1 );
+        XBatch.Resize( k, n, wantVecs ? groupSizes[k] : 0 );
+    }
+    for( const Int k : ABatch.LocalIndices() )
+    {
+        const Grid& subGrid = ABatch(k).Grid();
+        DistMatrix<F> V(subGrid), h(subGrid), X(subGrid);
+        Matrix<Real> wSlice;
+        for( Int s=k; s<numSlicesKept; s+=numGroups )
+        {
+            slice::Solve<F,slice::DistShiftedLDL<F>>
+            ( ABatch(k), bounds[s], bounds[s+1], counts[s+1]-counts[s], normA,
+              V, h, wSlice, X, wantVecs, ctrl.sliceCtrl );
+            for( Int j=0; j<wSlice.Height(); ++j )
+                wBatch(k).Set( groupOffsets[s]+j, 0, wSlice(j) );
+            if( wantVecs )
+            {
+                auto XDest =
+                  XBatch(k)
+                  ( ALL, IR(groupOffsets[s],groupOffsets[s]+wSlice.Height()) );
+                XDest = X;
+            }
+        }
+    }
+
+    // Gather the results of each sub-grid
+    DistMatrix<Real,STAR,STAR> wAll( g );
+    DistMatrix<F> QAll( g ), XPart( g );
+    DistMatrix<Real> wPart( g );
+    Zeros( wAll, numEigs, 1 );
+    if( wantVecs )
+        Zeros( QAll, n, numEigs );
+    Int offset = 0;
+    for( Int k=0; k<numGroups; ++k )
+    {
+        const Range<Int> ind( offset, offset+groupSizes[k] );
+        wBatch.Gather( k, wPart );
+        auto wDest = wAll( ind, ALL );
+        wDest = wPart;
+        if( wantVecs )
+        {
+            XBatch.Gather( k, XPart );
+            auto QDest = QAll( ALL, ind );
+            QDest = XPart;
+        }
+        offset += groupSizes[k];
+    }
+
+    slice::Finalize
+    ( wAll, QAll, wantVecs, counts.front(), ctrl.tridiagEigCtrl );
+    Copy( wAll, w );
+    if( wantVecs )
+        Copy( QAll, Q );
+}
+
+} // namespace herm_eig
+
+} // namespace El
+
+#endif // ifndef EL_HERMITIANEIG_SLICE_HPP
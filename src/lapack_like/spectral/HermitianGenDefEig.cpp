@@ -10,6 +10,52 @@
 
 namespace El {
 
+namespace herm_gen_def_eig {
+
+// Overwrite A with the standard Hermitian eigenvalue problem equivalent to
+// the pencil, given the Cholesky factor of B
+template<typename F>
+void Reduce
+( Pencil pencil, UpperOrLower uplo, Matrix<F>& A, const Matrix<F>& B )
+{
+    DEBUG_CSE
+    if( pencil == AXBX )
+        TwoSidedTrsm( uplo, NON_UNIT, A, B );
+    else
+        TwoSidedTrmm( uplo, NON_UNIT, A, B );
+}
+
+template<typename F>
+void Reduce
+( Pencil pencil, UpperOrLower uplo, DistMatrix<F>& A, const DistMatrix<F>& B )
+{
+    DEBUG_CSE
+    if( pencil == AXBX )
+        TwoSidedTrsm( uplo, NON_UNIT, A, B );
+    else
+        TwoSidedTrmm( uplo, NON_UNIT, A, B );
+}
+
+// Map the eigenvectors of the reduced problem back to those of the pencil
+template<typename F,class MatrixType>
+void BackTransform
+( Pencil pencil, UpperOrLower uplo, const MatrixType& B, MatrixType& X )
+{
+    DEBUG_CSE
+    if( pencil == AXBX || pencil == ABX )
+    {
+        const Orientation orientation = ( uplo==LOWER ? ADJOINT : NORMAL );
+        Trsm( LEFT, uplo, orientation, NON_UNIT, F(1), B, X );
+    }
+    else /* pencil == BAX */
+    {
+        const Orientation orientation = ( uplo==LOWER ? NORMAL : ADJOINT );
+        Trmm( LEFT, uplo, orientation, NON_UNIT, F(1), B, X );
+    }
+}
+
+} // namespace herm_gen_def_eig
+
 // Compute eigenvalues
 // ===================
 
@@ -30,10 +76,7 @@ HermitianGenDefEig
     )
 
     Cholesky( uplo, B );
-    if( pencil == AXBX )
-        TwoSidedTrsm( uplo, NON_UNIT, A, B );
-    else
-        TwoSidedTrmm( uplo, NON_UNIT, A, B );
+    herm_gen_def_eig::Reduce( pencil, uplo, A, B );
     return HermitianEig( uplo, A, w, ctrl );
 }
 
@@ -59,10 +102,7 @@ HermitianGenDefEig
     auto& B = BProx.Get();
 
     Cholesky( uplo, B );
-    if( pencil == AXBX )
-        TwoSidedTrsm( uplo, NON_UNIT, A, B );
-    else
-        TwoSidedTrmm( uplo, NON_UNIT, A, B );
+    herm_gen_def_eig::Reduce( pencil, uplo, A, B );
     return HermitianEig( uplo, A, w, ctrl );
 }
 
@@ -87,21 +127,9 @@ HermitianGenDefEig
     )
 
     Cholesky( uplo, B );
-    if( pencil == AXBX )
-        TwoSidedTrsm( uplo, NON_UNIT, A, B );
-    else
-        TwoSidedTrmm( uplo, NON_UNIT, A, B );
+    herm_gen_def_eig::Reduce( pencil, uplo, A, B );
     auto info = HermitianEig( uplo, A, w, X, ctrl );
-    if( pencil == AXBX || pencil == ABX )
-    {
-        const Orientation orientation = ( uplo==LOWER ? ADJOINT : NORMAL );
-        Trsm( LEFT, uplo, orientation, NON_UNIT, F(1), B, X );
-    }
-    else /* pencil == BAX */
-    {
-        const Orientation orientation = ( uplo==LOWER ? NORMAL : ADJOINT );
-        Trmm( LEFT, uplo, orientation, NON_UNIT, F(1), B, X );
-    }
+    herm_gen_def_eig::BackTransform<F>( pencil, uplo, B, X );
     return info;
 }
 
@@ -130,25 +158,185 @@ HermitianGenDefEig
     auto& X = XProx.Get();
 
     Cholesky( uplo, B );
-    if( pencil == AXBX )
-        TwoSidedTrsm( uplo, NON_UNIT, A, B );
-    else
-        TwoSidedTrmm( uplo, NON_UNIT, A, B );
+    herm_gen_def_eig::Reduce( pencil, uplo, A, B );
     auto info = HermitianEig( uplo, A, w, X, ctrl );
-    if( pencil == AXBX || pencil == ABX )
-    {
-        const Orientation orientation = ( uplo==LOWER ? ADJOINT : NORMAL );
-        Trsm( LEFT, uplo, orientation, NON_UNIT, F(1), B, X );
-    }
-    else /* pencil == BAX */
-    {
-        const Orientation orientation = ( uplo==LOWER ? NORMAL : ADJOINT );
-        Trmm( LEFT, uplo, orientation, NON_UNIT, F(1), B, X );
-    }
+    herm_gen_def_eig::BackTransform<F>( pencil, uplo, B, X );
     return info;
 }
 
+// Solvers which retain the Cholesky factor of B
+// =============================================
+
+template<typename F>
+HermitianGenDefEigSolver<F>::HermitianGenDefEigSolver()
+: initialized_(false), pencil_(AXBX), uplo_(LOWER)
+{ }
+
+template<typename F>
+HermitianGenDefEigSolver<F>::HermitianGenDefEigSolver
+( Pencil pencil, UpperOrLower uplo, const Matrix<F>& B )
+: initialized_(false), pencil_(pencil), uplo_(uplo)
+{
+    DEBUG_CSE
+    Initialize( pencil, uplo, B );
+}
+
+template<typename F>
+void HermitianGenDefEigSolver<F>::Initialize
+( Pencil pencil, UpperOrLower uplo, const Matrix<F>& B )
+{
+    DEBUG_CSE
+    if( B.Height() != B.Width() )
+        LogicError("Hermitian matrices must be square.");
+    pencil_ = pencil;
+    uplo_ = uplo;
+    factor_ = B;
+    Cholesky( uplo, factor_ );
+    initialized_ = true;
+}
+
+template<typename F>
+HermitianEigInfo HermitianGenDefEigSolver<F>::Eig
+( Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  const HermitianEigCtrl<F>& ctrl ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( A.Height() != factor_.Height() || A.Width() != factor_.Width() )
+        LogicError("A and B must be the same size");
+    herm_gen_def_eig::Reduce( pencil_, uplo_, A, factor_ );
+    return HermitianEig( uplo_, A, w, ctrl );
+}
+
+template<typename F>
+HermitianEigInfo HermitianGenDefEigSolver<F>::Eig
+( Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& X,
+  const HermitianEigCtrl<F>& ctrl ) const
+{
+    DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( A.Height() != factor_.Height() || A.Width() != factor_.Width() )
+        LogicError("A and B must be the same size");
+    herm_gen_def_eig::Reduce( pencil_, uplo_, A, factor_ );
+    auto info = HermitianEig( uplo_, A, w, X, ctrl );
+    herm_gen_def_eig::BackTransform<F>( pencil_, uplo_, factor_, X );
+    return info;
+}
+
+template<typename F>
+bool HermitianGenDefEigSolver<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+Pencil HermitianGenDefEigSolver<F>::GetPencil() const
+{ return pencil_; }
+
+template<typename F>
+UpperOrLower HermitianGenDefEigSolver<F>::GetUpperOrLower() const
+{ return uplo_; }
+
+template<typename F>
+const Matrix<F>& HermitianGenDefEigSolver<F>::Factor() const
+{ return factor_; }
+
+template<typename F>
+DistHermitianGenDefEigSolver<F>::DistHermitianGenDefEigSolver( const Grid& g )
+: initialized_(false), pencil_(AXBX), uplo_(LOWER), factor_(g)
+{ }
+
+template<typename F>
+DistHermitianGenDefEigSolver<F>::DistHermitianGenDefEigSolver
+( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<F>& B )
+: initialized_(false), pencil_(pencil), uplo_(uplo), factor_(B.Grid())
+{
+    DEBUG_CSE
+    Initialize( pencil, uplo, B );
+}
+
+template<typename F>
+void DistHermitianGenDefEigSolver<F>::Initialize
+( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<F>& B )
+{
+    DEBUG_CSE
+    if( B.Height() != B.Width() )
+        LogicError("Hermitian matrices must be square.");
+    pencil_ = pencil;
+    uplo_ = uplo;
+    factor_.SetGrid( B.Grid() );
+    Copy( B, factor_ );
+    Cholesky( uplo, factor_ );
+    initialized_ = true;
+}
+
+template<typename F>
+HermitianEigInfo DistHermitianGenDefEigSolver<F>::Eig
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& w,
+  const HermitianEigCtrl<F>& ctrl ) const
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, factor_, w ))
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( APre.Height() != factor_.Height() || APre.Width() != factor_.Width() )
+        LogicError("A and B must be the same size");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    herm_gen_def_eig::Reduce( pencil_, uplo_, A, factor_ );
+    return HermitianEig( uplo_, A, w, ctrl );
+}
+
+template<typename F>
+HermitianEigInfo DistHermitianGenDefEigSolver<F>::Eig
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& w,
+  AbstractDistMatrix<F>& XPre,
+  const HermitianEigCtrl<F>& ctrl ) const
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, factor_, w, XPre ))
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( APre.Height() != factor_.Height() || APre.Width() != factor_.Width() )
+        LogicError("A and B must be the same size");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& A = AProx.Get();
+    auto& X = XProx.Get();
+
+    herm_gen_def_eig::Reduce( pencil_, uplo_, A, factor_ );
+    auto info = HermitianEig( uplo_, A, w, X, ctrl );
+    herm_gen_def_eig::BackTransform<F>( pencil_, uplo_, factor_, X );
+    return info;
+}
+
+template<typename F>
+bool DistHermitianGenDefEigSolver<F>::Initialized() const
+{ return initialized_; }
+
+template<typename F>
+Pencil DistHermitianGenDefEigSolver<F>::GetPencil() const
+{ return pencil_; }
+
+template<typename F>
+UpperOrLower DistHermitianGenDefEigSolver<F>::GetUpperOrLower() const
+{ return uplo_; }
+
+template<typename F>
+const DistMatrix<F>& DistHermitianGenDefEigSolver<F>::Factor() const
+{ return factor_; }
+
 #define PROTO(F) \
+  template class HermitianGenDefEigSolver<F>; \
+  template class DistHermitianGenDefEigSolver<F>; \
   template HermitianEigInfo HermitianGenDefEig \
   ( Pencil pencil, \
     UpperOrLower uplo, \
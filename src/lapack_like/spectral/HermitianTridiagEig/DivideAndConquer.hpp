@@ -16,6 +16,27 @@ using El::schur::SplitGrid;
 namespace El {
 namespace herm_tridiag_eig {
 
+// The secular roots are solved within a threaded loop, where progress output
+// from the individual solves would interleave
+template<typename Real>
+SecularEVDCtrl<Real> ThreadedSecularCtrl( const SecularEVDCtrl<Real>& ctrl )
+{
+    SecularEVDCtrl<Real> threadedCtrl( ctrl );
+#ifdef EL_HYBRID
+    threadedCtrl.progress = false;
+#endif
+    return threadedCtrl;
+}
+
+// Exceptions may not escape a threaded loop, so each iteration captures its
+// own and the first is rethrown once the loop has completed
+inline void RethrowFirst( const vector<std::exception_ptr>& errors )
+{
+    for( const auto& error : errors )
+        if( error )
+            std::rethrow_exception( error );
+}
+
 // The following is analogous to LAPACK's {s,d}laed{1,2,3} [CITATION] but does
 // not accept initial sorting permutations for w0 and w1, nor does it enforce 
 // any ordering on the resulting eigenvalues.
@@ -431,36 +452,52 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
+    // The roots of the secular equation are independent, so they are solved
+    // concurrently and the update vector is corrected afterwards
+    vector<SecularEVDInfo> valueInfos( numUndeflated );
+    vector<std::exception_ptr> errors( numUndeflated );
+    const auto secularCtrl = ThreadedSecularCtrl( dcCtrl.secularCtrl );
+    EL_PARALLEL_FOR
+    for( Int j=0; j<numUndeflated; ++j )
+    {
+        try
+        {
+            auto minusShift = QSecular( ALL, IR(j) );
+            valueInfos[j] =
+              SecularEigenvalue
+              ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
+                secularCtrl );
+        }
+        catch( ... ) { errors[j] = std::current_exception(); }
+    }
+    RethrowFirst( errors );
     for( Int j=0; j<numUndeflated; ++j )
     {
-        auto minusShift = QSecular( ALL, IR(j) );
-
-        auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
-            dcCtrl.secularCtrl );
         if( ctrl.progress )
             Output("Secular eigenvalue ",j," is ",d(j));
-
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
+        secularInfo.numIterations += valueInfos[j].numIterations;
+        secularInfo.numAlternations += valueInfos[j].numAlternations;
+        secularInfo.numCubicIterations += valueInfos[j].numCubicIterations;
+        secularInfo.numCubicFailures += valueInfos[j].numCubicFailures;
+    }
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        for( Int j=0; j<numUndeflated; ++j )
         {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+            if( j == k )
+                rCorrected(k) *= QSecular(k,j);
+            else
+                rCorrected(k) *=
+                  QSecular(k,j) / (dUndeflated(j)-dUndeflated(k));
         }
+        rCorrected(k) = Sgn(zUndeflated(k),false) * Sqrt(Abs(rCorrected(k)));
     }
-    for( Int j=0; j<numUndeflated; ++j )
-        rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
     // Compute the unnormalized eigenvectors.
     if( ctrl.progress )
         Output("Computing unnormalized eigenvectors");
+    EL_PARALLEL_FOR
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto q = QSecular(ALL,IR(j));
@@ -476,6 +513,7 @@ Merge
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     U.Resize( numUndeflated, numUndeflated );
+    EL_PARALLEL_FOR
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto q = QSecular(ALL,IR(j));
@@ -973,31 +1011,51 @@ Merge
     auto& dSecularLoc = dSecular.Matrix();
     auto& QSecularLoc = QSecular.Matrix();
 
+    // Each process solves for the roots of its local columns of QSecular,
+    // and the local roots are solved concurrently
     const Int numUndeflatedLoc = QSecularLoc.Width();
+    vector<SecularEVDInfo> valueInfos( numUndeflatedLoc );
+    vector<std::exception_ptr> errors( numUndeflatedLoc );
+    const auto secularCtrl = ThreadedSecularCtrl( dcCtrl.secularCtrl );
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+    {
+        try
+        {
+            const Int j = QSecular.GlobalCol(jLoc);
+            auto minusShift = QSecularLoc( ALL, IR(jLoc) );
+            valueInfos[jLoc] =
+              SecularEigenvalue
+              ( j, dUndeflated, rho, zUndeflated, dSecularLoc(jLoc),
+                minusShift, secularCtrl );
+        }
+        catch( ... ) { errors[jLoc] = std::current_exception(); }
+    }
+    RethrowFirst( errors );
     for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
     {
-        const Int j = QSecular.GlobalCol(jLoc);
-        auto minusShift = QSecularLoc( ALL, IR(jLoc) );
-
-        auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, dSecularLoc(jLoc),
-            minusShift, dcCtrl.secularCtrl );
         if( ctrl.progress && amRoot )
-            Output("Secular eigenvalue ",j," is ",dSecularLoc(jLoc));
+            Output
+            ("Secular eigenvalue ",QSecular.GlobalCol(jLoc)," is ",
+             dSecularLoc(jLoc));
 
         // We will sum these across all of the processors at the top-level
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
+        secularInfo.numIterations += valueInfos[jLoc].numIterations;
+        secularInfo.numAlternations += valueInfos[jLoc].numAlternations;
+        secularInfo.numCubicIterations += valueInfos[jLoc].numCubicIterations;
+        secularInfo.numCubicFailures += valueInfos[jLoc].numCubicFailures;
+    }
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
         {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+            const Int j = QSecular.GlobalCol(jLoc);
+            if( j == k )
+                rCorrected(k) *= QSecularLoc(k,jLoc);
+            else
+                rCorrected(k) *=
+                  QSecularLoc(k,jLoc) / (dUndeflated(j)-dUndeflated(k));
         }
     }
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
@@ -1012,6 +1070,7 @@ Merge
     // Compute the unnormalized eigenvectors.
     if( ctrl.progress && amRoot )
         Output("Computing unnormalized eigenvectors");
+    EL_PARALLEL_FOR
     for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
     {
         auto q = QSecularLoc(ALL,IR(jLoc));
@@ -1029,6 +1088,7 @@ Merge
     DistMatrix<Real,STAR,VR> U(g);
     U.Resize( numUndeflated, numUndeflated );
     auto& ULoc = U.Matrix();
+    EL_PARALLEL_FOR
     for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
     {
         auto q = QSecularLoc(ALL,IR(jLoc));
@@ -93,7 +93,8 @@ void QLSweep
   Matrix<Base<F>>& e,
   Matrix<Base<F>>& cList,
   Matrix<Base<F>>& sList,
-  Matrix<F>& Q,
+  GivensSequenceAccumulator<F>& QAccum,
+  Int offset,
   const Base<F>& shift,
   bool wantEigVecs )
 {
@@ -135,8 +136,7 @@ void QLSweep
     e(0) = g;
     if( wantEigVecs )
     {
-        ApplyGivensSequence
-        ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cList, sList, Q );
+        QAccum.Push( BACKWARD, offset, cList, sList );
     }
 }
 
@@ -146,7 +146,8 @@ void QRSweep
   Matrix<Base<F>>& e,
   Matrix<Base<F>>& cList,
   Matrix<Base<F>>& sList,
-  Matrix<F>& Q,
+  GivensSequenceAccumulator<F>& QAccum,
+  Int offset,
   const Base<F>& shift,
   bool wantEigVecs )
 {
@@ -185,8 +186,7 @@ void QRSweep
     e(n-2) = g;
     if( wantEigVecs )
     {
-        ApplyGivensSequence
-        ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cList, sList, Q );
+        QAccum.Push( FORWARD, offset, cList, sList );
     }
 }
 
@@ -207,7 +207,6 @@ Helper
     DEBUG_CSE
     typedef Base<F> Real;
     const Int n = d.Height();
-    const Int mQ = Q.Height();
     herm_tridiag_eig::QRInfo info;
 
     if( n <= 1 )
@@ -225,7 +224,9 @@ Helper
 
     Matrix<Real> cList(n-1,1), sList(n-1,1);
     Matrix<Real> dSub, eSub;
-    Matrix<F> QSub;
+    // Consecutive sweeps are accumulated so that their rotations can be
+    // applied to Q with level-3 operations
+    GivensSequenceAccumulator<F> QAccum( Q );
 
     const Int maxIter = n*ctrl.qrCtrl.maxIterPerEig; 
     Int winBeg = 0;
@@ -342,8 +343,7 @@ Helper
                           lambda0, lambda1, c, s,
                           ctrl.qrCtrl.fullAccuracyTwoByTwo );
                         // Apply the Givens rotation from the right to Q
-                        blas::Rot
-                        ( mQ, &Q(0,subWinBeg), 1, &Q(0,subWinBeg+1), 1, c, s );
+                        QAccum.PushRotation( subWinBeg, c, s );
                     }
                     else
                     {
@@ -371,14 +371,11 @@ Helper
                 // of these views
                 View( dSub, d, IR(subWinBeg,iterEnd), ALL );
                 View( eSub, e, IR(subWinBeg,Min(iterEnd,n-1)), ALL );
-                if( ctrl.wantEigVecs )
-                {
-                    View( QSub, Q, ALL, IR(subWinBeg,iterEnd) );
-                }
 
                 Real shift = WilkinsonShift( dSub(0), eSub(0), dSub(1) );
                 QLSweep
-                ( dSub, eSub, cList, sList, QSub, shift, ctrl.wantEigVecs );
+                ( dSub, eSub, cList, sList, QAccum, subWinBeg, shift,
+                  ctrl.wantEigVecs );
             }
         }
         else
@@ -436,9 +433,7 @@ Helper
                           lambda0, lambda1, c, s,
                           ctrl.qrCtrl.fullAccuracyTwoByTwo ); 
                         // Apply the Givens rotation from the right to Q
-                        blas::Rot
-                        ( mQ, &Q(0,subWinEnd-2), 1, &Q(0,subWinEnd-1), 1,
-                          c, s );
+                        QAccum.PushRotation( subWinEnd-2, c, s );
                     }
                     else
                     {
@@ -466,16 +461,13 @@ Helper
                 // of these views
                 View( dSub, d, IR(iterBeg,subWinEnd), ALL );
                 View( eSub, e, IR(iterBeg,Min(subWinEnd,n-1)), ALL );
-                if( ctrl.wantEigVecs )
-                {
-                    View( QSub, Q, ALL, IR(iterBeg,subWinEnd) );
-                }
 
                 Real shift =
                   WilkinsonShift
                   ( d(subWinEnd-1), e(subWinEnd-2), d(subWinEnd-2) );
                 QRSweep
-                ( dSub, eSub, cList, sList, QSub, shift, ctrl.wantEigVecs );
+                ( dSub, eSub, cList, sList, QAccum, iterBeg, shift,
+                  ctrl.wantEigVecs );
             }
         }
 
@@ -489,6 +481,7 @@ Helper
         }
         if( info.numIterations >= maxIter )
         {
+            QAccum.Flush();
             for( Int i=0; i<n-1; ++i )
                 if( e(i) != zero )
                     ++info.numUnconverged; 
@@ -498,6 +491,7 @@ Helper
             return info;
         }
     }
+    QAccum.Flush();
 
     return info;
 }
@@ -242,8 +242,12 @@ HessenbergSchur
 #endif
     }
 
-    // For now, only the MultiBulge algorithm is supported
-    return hess_schur::MultiBulge( H, w, Z, ctrlMod );
+    // The Simple algorithm does not yet have a distributed implementation,
+    // so it falls back to MultiBulge
+    if( ctrlMod.alg == HESSENBERG_SCHUR_AED )
+        return hess_schur::AED( H, w, Z, ctrlMod );
+    else
+        return hess_schur::MultiBulge( H, w, Z, ctrlMod );
 }
 
 template<typename F>
@@ -312,8 +316,12 @@ HessenbergSchur
 #endif
     }
 
-    // For now, only the MultiBulge algorithm is supported
-    return hess_schur::MultiBulge( H, w, Z, ctrlMod );
+    // The Simple algorithm does not yet have a distributed implementation,
+    // so it falls back to MultiBulge
+    if( ctrlMod.alg == HESSENBERG_SCHUR_AED )
+        return hess_schur::AED( H, w, Z, ctrlMod );
+    else
+        return hess_schur::MultiBulge( H, w, Z, ctrlMod );
 }
 
 namespace hess_schur {
@@ -11,6 +11,8 @@
 
 #include "./Simple.hpp"
 #include "./MultiBulge/Sweep.hpp"
+#include "./Util/Gather.hpp"
+#include "./MultiBulge/RedundantlyHandleWindow.hpp"
 #include "./AED/UpdateDeflationSize.hpp"
 #include "./AED/ModifyShifts.hpp"
 #include "./AED/SpikeDeflation.hpp"
@@ -156,6 +158,145 @@ AED
     return info;
 }
 
+// The distributed AED follows the same strategy as the sequential version,
+// but each deflation window is gathered and solved on a process subgrid
+// (see aed::SubgridHessenbergSchur) and the QR sweeps pipeline several chains
+// of bulges (see multibulge::PipelinedSweepHelper). Cf.
+//
+//   Robert Granat, Bo Kagstrom, and Daniel Kressner,
+//   "A novel parallel QR algorithm for hybrid distributed memory HPC systems",
+//   LAPACK Working Note 216, 2009.
+//
+template<typename F>
+HessenbergSchurInfo
+AED
+( DistMatrix<F,MC,MR,BLOCK>& H,
+  DistMatrix<Complex<Base<F>>,STAR,STAR>& w,
+  DistMatrix<F,MC,MR,BLOCK>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE 
+    typedef Base<F> Real;
+    const Real zero(0);
+
+    const Int n = H.Height();
+    Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    const Int winSize = winEnd - winBeg;
+    const Int blockSize = H.BlockHeight();
+    // As in the distributed MultiBulge, windows spanning less than two
+    // distribution blocks are handled redundantly
+    const Int minMultiBulgeSize = Max( ctrl.minMultiBulgeSize, 2*blockSize );
+    HessenbergSchurInfo info;
+
+    w.Resize( n, 1 );
+    if( winSize < minMultiBulgeSize )
+    {
+        return multibulge::RedundantlyHandleWindow( H, w, Z, ctrl );
+    }
+
+    const Int numShiftsRec = ctrl.numShifts( n, winSize );
+    const Int deflationSizeRec = ctrl.deflationSize( n, winSize, numShiftsRec );
+    if( ctrl.progress )
+    {
+        Output
+        ("Recommending ",numShiftsRec," shifts and a deflation window of size ",
+         deflationSizeRec);
+    }
+    Int deflationSize = deflationSizeRec;
+
+    auto ctrlSub( ctrl );
+
+    Int numIterSinceDeflation = 0;
+    const Int numStaleIterBeforeExceptional = 5;
+    // Cf. LAPACK's DLAQR0 for this choice
+    const Int maxIter =
+      Max(30,2*numStaleIterBeforeExceptional) * Max(10,winSize);
+
+    Int decreaseLevel = -1;
+    Matrix<Real> hSubAbsWin;
+    while( winBeg < winEnd )
+    {
+        if( info.numIterations >= maxIter )
+        {
+            if( ctrl.demandConverged )
+                RuntimeError("AED QR iteration did not converge");
+            else
+                break;
+        }
+
+        // Detect an irreducible Hessenberg window, [iterBeg,winEnd)
+        // ---------------------------------------------------------
+        util::GatherSubdiagonalMagnitudes( H, IR(winBeg,winEnd), hSubAbsWin );
+        Int iterBeg=winEnd-1;
+        for( ; iterBeg>winBeg; --iterBeg )
+            if( hSubAbsWin(iterBeg-winBeg-1) == zero ) 
+                break;
+        if( ctrl.progress )
+        {
+            Output("Iter. ",info.numIterations,": ");
+            Output("  window is [",iterBeg,",",winEnd,")");
+        }
+        const Int iterWinSize = winEnd-iterBeg;
+        if( iterWinSize < minMultiBulgeSize )
+        {
+            // The window is small enough to switch to the sequential scheme
+            if( ctrl.progress )
+                Output("Redundantly handling window [",iterBeg,",",winEnd,"]");
+            auto ctrlIter( ctrl );
+            ctrlIter.winBeg = iterBeg;
+            ctrlIter.winEnd = winEnd;
+            auto iterInfo =
+              multibulge::RedundantlyHandleWindow( H, w, Z, ctrlIter );
+            info.numIterations += iterInfo.numIterations;
+
+            winEnd = iterBeg;
+            numIterSinceDeflation = 0;
+            continue;
+        }
+        aed::UpdateDeflationSize
+        ( deflationSize, decreaseLevel, deflationSizeRec, numIterSinceDeflation,
+          numStaleIterBeforeExceptional, iterWinSize, winEnd, H );
+
+        // Run AED on the bottom-right window of size deflationSize
+        ctrlSub.winBeg = iterBeg;
+        ctrlSub.winEnd = winEnd;
+        auto deflateInfo = aed::Nibble( H, deflationSize, w, Z, ctrlSub );
+        const Int numDeflated = deflateInfo.numDeflated;
+        winEnd -= numDeflated;
+        Int shiftBeg = winEnd - deflateInfo.numShiftCandidates;
+
+        const Int newIterWinSize = winEnd-iterBeg;
+        const Int sufficientDeflation = ctrl.sufficientDeflation(deflationSize);
+        if( numDeflated == 0 ||
+          (numDeflated <= sufficientDeflation && 
+           newIterWinSize >= minMultiBulgeSize) )
+        {
+            shiftBeg =
+              aed::ModifyShifts
+              ( numShiftsRec, newIterWinSize, numIterSinceDeflation, 
+                numStaleIterBeforeExceptional, winBeg, winEnd, shiftBeg,
+                H, w, ctrl );
+
+            // Perform a small-bulge sweep
+            auto wSub = w(IR(shiftBeg,winEnd),ALL); 
+            ctrlSub.winBeg = iterBeg;
+            ctrlSub.winEnd = winEnd;
+            multibulge::Sweep( H, wSub, Z, ctrlSub );
+        }
+        else if( ctrl.progress )
+            Output("  Skipping QR sweep");
+
+        ++info.numIterations;
+        if( numDeflated > 0 )
+            numIterSinceDeflation = 0;
+        else
+            ++numIterSinceDeflation;
+    }
+    info.numUnconverged = winEnd-winBeg;
+    return info;
+}
+
 } // namespace hess_schur
 } // namespace El
 
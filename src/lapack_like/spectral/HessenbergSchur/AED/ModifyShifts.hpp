@@ -263,6 +263,42 @@ Int ModifyShifts
     return shiftBeg;
 }
 
+// The distributed variant gathers the (small) trailing submatrix that the
+// shift modifications depend upon and redundantly runs the sequential
+// algorithm on it.
+template<typename F>
+Int ModifyShifts
+( Int numShiftsRec,
+  Int newIterWinSize,
+  Int numIterSinceDeflation,
+  Int numStaleIterBeforeExceptional, 
+  Int winBeg,
+  Int winEnd,
+  Int shiftBeg,
+  const DistMatrix<F,MC,MR,BLOCK>& H,
+        DistMatrix<Complex<Base<F>>,STAR,STAR>& w,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    Int numShiftsIdeal = Min( numShiftsRec, Max(2,newIterWinSize-1) );
+    numShiftsIdeal = numShiftsIdeal - Mod(numShiftsIdeal,2); 
+
+    // Only the entries of H from one index before the (possibly modified)
+    // beginning of the shifts are accessed
+    const Int trailBeg =
+      Max( winBeg, Min(shiftBeg,winEnd-numShiftsIdeal)-1 );
+    auto trailInd = IR(trailBeg,winEnd);
+    DistMatrix<F,STAR,STAR> HTrail( H(trailInd,trailInd) );
+    auto wTrail = w.Matrix()(trailInd,ALL);
+
+    const Int shiftBegTrail =
+      ModifyShifts
+      ( numShiftsRec, newIterWinSize, numIterSinceDeflation,
+        numStaleIterBeforeExceptional, winBeg-trailBeg, winEnd-trailBeg,
+        shiftBeg-trailBeg, HTrail.LockedMatrix(), wTrail, ctrl );
+    return shiftBegTrail + trailBeg;
+}
+
 } // namespace aed
 } // namespace hess_schur
 } // namespace El
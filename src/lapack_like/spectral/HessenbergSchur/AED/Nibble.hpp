@@ -10,11 +10,59 @@
 #define EL_HESS_SCHUR_AED_NIBBLE_HPP
 
 #include "./SpikeDeflation.hpp"
+#include "../MultiBulge/Transform.hpp"
 
 namespace El {
 namespace hess_schur {
 namespace aed {
 
+// Reform the eigenvalues and shift candidates by looping over the converged
+// eigenvalues from last to first
+template<typename Real>
+void ReformEigenvalues
+( const Matrix<Real>& T,
+        Int numUnconverged,
+        Matrix<Complex<Real>>& w )
+{
+    DEBUG_CSE
+    const Real zero(0);
+    const Int blockSize = T.Height();
+    for( Int i=blockSize-1; i>=numUnconverged; )
+    {
+        if( i == numUnconverged || T(i,i-1) == zero )
+        {
+            // 1x1 block
+            w(i) = T(i,i);
+            i -= 1;
+        }
+        else
+        {
+            // 2x2 block
+            Real alpha00 = T(i-1,i-1);
+            Real alpha10 = T(i,  i-1);
+            Real alpha01 = T(i-1,i  );
+            Real alpha11 = T(i,  i  );
+            schur::TwoByTwo
+            ( alpha00, alpha01,
+              alpha10, alpha11,
+              w(i-1), w(i) );
+            i -= 2;
+        }
+    }
+}
+
+template<typename Real>
+void ReformEigenvalues
+( const Matrix<Complex<Real>>& T,
+        Int numUnconverged,
+        Matrix<Complex<Real>>& w )
+{
+    DEBUG_CSE
+    const Int blockSize = T.Height();
+    for( Int i=blockSize-1; i>=numUnconverged; --i )
+        w(i) = T(i,i);
+}
+
 template<typename Real>
 AEDInfo Nibble
 ( Matrix<Real>& H,
@@ -118,30 +166,7 @@ AEDInfo Nibble
         // which can take the values {ASCENDING, DESCENDING, UNSORTED}.
     }
 
-    // Reform the eigenvalues and shift candidates by looping over the converged
-    // eigenvalues from last to first
-    for( Int i=blockSize-1; i>=info.numUnconverged; )
-    {
-        if( i == info.numUnconverged || T(i,i-1) == zero )
-        {
-            // 1x1 block
-            w1(i) = T(i,i);
-            i -= 1;
-        }
-        else
-        {
-            // 2x2 block
-            Real alpha00 = T(i-1,i-1);
-            Real alpha10 = T(i,  i-1);
-            Real alpha01 = T(i-1,i  );
-            Real alpha11 = T(i,  i  );
-            schur::TwoByTwo
-            ( alpha00, alpha01,
-              alpha10, alpha11,
-              w1(i-1), w1(i) );
-            i -= 2;
-        }
-    }
+    ReformEigenvalues( T, info.numUnconverged, w1 );
 
     const Int spikeSize = info.numUnconverged + info.numShiftCandidates;
     if( spikeSize < blockSize || spikeValue == zero )
@@ -334,10 +359,7 @@ AEDInfo Nibble
         // which can take the values {ASCENDING, DESCENDING, UNSORTED}.
     }
 
-    // Reform the eigenvalues and shift candidates by looping over the converged
-    // eigenvalues from last to first
-    for( Int i=blockSize-1; i>=info.numUnconverged; --i )
-        w(deflateBeg+i) = T(i,i);
+    ReformEigenvalues( T, info.numUnconverged, w1 );
 
     const Int spikeSize = info.numUnconverged + info.numShiftCandidates;
     if( spikeSize < blockSize || spikeValue == zero )
@@ -428,6 +450,285 @@ AEDInfo Nibble
     return info;
 }
 
+// Compute the Schur decomposition T := V' T V of a redundantly-stored
+// deflation window on a square subgrid formed from the top-left processes of
+// the given grid and then broadcast the results over the entire grid. This
+// avoids the redundant solution of large deflation windows, which would
+// otherwise become the bottleneck of the distributed AED (cf. Granat,
+// Kagstrom, and Kressner, "A novel parallel QR algorithm for hybrid
+// distributed memory HPC systems", LAWN 216).
+template<typename F>
+HessenbergSchurInfo
+SubgridHessenbergSchur
+( Matrix<F>& T,
+  Matrix<Complex<Base<F>>>& w,
+  Matrix<F>& V,
+  const Grid& grid,
+  Int blockHeight,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = T.Height();
+    const int subgridDim =
+      int(Min( ctrl.aedSubgridDimension(n,blockHeight),
+               Int(Min(grid.Height(),grid.Width())) ));
+    Identity( V, n, n );
+    if( subgridDim <= 1 )
+        return HessenbergSchur( T, w, V, ctrl );
+
+    // Form the subgrid from the top-left subgridDim x subgridDim processes
+    const int subgridSize = subgridDim*subgridDim;
+    mpi::Group viewingGroup;
+    mpi::CommGroup( grid.ViewingComm(), viewingGroup );
+    vector<int> viewingRanks( subgridSize );
+    for( int j=0; j<subgridDim; ++j )
+        for( int i=0; i<subgridDim; ++i )
+            viewingRanks[i+j*subgridDim] =
+              grid.VCToViewing( i+j*grid.Height() );
+    mpi::Group owners;
+    mpi::Incl( viewingGroup, subgridSize, viewingRanks.data(), owners );
+    Grid subgrid( grid.ViewingComm(), owners, subgridDim, COLUMN_MAJOR );
+    mpi::Free( owners );
+    mpi::Free( viewingGroup );
+
+    HessenbergSchurInfo info;
+    if( subgrid.InGrid() )
+    {
+        DistMatrix<F,STAR,STAR> T_STAR_STAR(subgrid), V_STAR_STAR(subgrid);
+        T_STAR_STAR.Resize( n, n );
+        T_STAR_STAR.Matrix() = T;
+
+        DistMatrix<F,MC,MR,BLOCK>
+          TSub(subgrid,blockHeight,blockHeight),
+          VSub(subgrid,blockHeight,blockHeight);
+        DistMatrix<Complex<Real>,STAR,STAR> wSub(subgrid);
+        TSub = T_STAR_STAR;
+        Identity( VSub, n, n );
+        info = HessenbergSchur( TSub, wSub, VSub, ctrl );
+
+        T_STAR_STAR = TSub;
+        V_STAR_STAR = VSub;
+        T = T_STAR_STAR.Matrix();
+        V = V_STAR_STAR.Matrix();
+        w = wSub.Matrix();
+    }
+
+    // The root of the VC communicator is the top-left process of the subgrid
+    El::Broadcast( T, grid.VCComm(), 0 );
+    El::Broadcast( V, grid.VCComm(), 0 );
+    El::Broadcast( w, grid.VCComm(), 0 );
+    mpi::Broadcast( info.numUnconverged, 0, grid.VCComm() );
+    mpi::Broadcast( info.numIterations, 0, grid.VCComm() );
+    return info;
+}
+
+// The distributed analogue of the sequential Nibble: the deflation window is
+// redundantly gathered, its Schur decomposition is computed on a subgrid,
+// and the converged spike is deflated redundantly before the (level-3)
+// far-from-window updates are applied to the distributed H and Z.
+template<typename F>
+AEDInfo Nibble
+( DistMatrix<F,MC,MR,BLOCK>& H,
+  Int deflationSize,
+  DistMatrix<Complex<Base<F>>,STAR,STAR>& w,
+  DistMatrix<F,MC,MR,BLOCK>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+
+    const Int n = H.Height();
+    Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    auto& wLoc = w.Matrix();
+    AEDInfo info;
+
+    const Real zero(0);
+    const Real ulp = limits::Precision<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    if( winBeg > winEnd )
+        return info;
+    if( deflationSize < 1 )
+        return info;
+
+    Int blockSize = Min( deflationSize, winEnd-winBeg );
+    const Int deflateBeg = winEnd-blockSize;
+
+    // If the deflation window touches the beginning of the full window,
+    // then there is no spike
+    F spikeValue =
+      ( deflateBeg==winBeg ? F(0) : H.Get(deflateBeg,deflateBeg-1) );
+
+    if( blockSize == 1 )
+    {
+        wLoc(deflateBeg) = H.Get(deflateBeg,deflateBeg);
+        if( OneAbs(spikeValue) <=
+            Max( smallNum, ulp*OneAbs(wLoc(deflateBeg)) ) )
+        {
+            // The offdiagonal entry was small enough to deflate
+            info.numDeflated = 1;
+            if( deflateBeg > winBeg )
+            {
+                // Explicitly deflate by zeroing the offdiagonal entry
+                H.Set( deflateBeg, deflateBeg-1, zero );
+            }
+        }
+        else
+        {
+            // The offdiagonal entry was too large to deflate
+            info.numShiftCandidates = 1;
+        }
+        return info;
+    }
+
+    auto deflateInd = IR(deflateBeg,winEnd);
+    auto H11 = H( deflateInd, deflateInd );
+    DistMatrix<F,STAR,STAR> T_STAR_STAR( H11 );
+    auto& T = T_STAR_STAR.Matrix();
+    auto w1 = wLoc( deflateInd, ALL );
+    Matrix<F> V;
+    auto ctrlSub( ctrl );
+    ctrlSub.winBeg = 0;
+    ctrlSub.winEnd = blockSize;
+    ctrlSub.fullTriangle = true;
+    ctrlSub.wantSchurVecs = true;
+    ctrlSub.demandConverged = false;
+    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                      : HESSENBERG_SCHUR_MULTIBULGE );
+    auto infoSub =
+      SubgridHessenbergSchur
+      ( T, w1, V, H.Grid(), H.BlockHeight(), ctrlSub );
+    DEBUG_ONLY(
+      if( infoSub.numUnconverged != 0 )
+          Output(infoSub.numUnconverged," eigenvalues did not converge");
+    )
+
+    vector<F> work(2*blockSize);
+    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    if( ctrl.progress )
+    {
+        if( info.numUnconverged > 0 )
+            Output
+            ("  ",info.numUnconverged," AED eigenvalues did not converge");
+        Output
+        ("  ",info.numDeflated," of ",blockSize," AED eigenvalues deflated");
+    }
+    if( info.numUnconverged+info.numShiftCandidates == 0 )
+    {
+        // The entire spike has deflated
+        spikeValue = zero;
+    }
+
+    ReformEigenvalues( T, info.numUnconverged, w1 );
+
+    const Int spikeSize = info.numUnconverged + info.numShiftCandidates;
+    if( spikeSize < blockSize || spikeValue == F(0) )
+    {
+        // Either we deflated at least one eigenvalue or we can simply
+        // rotate the deflation window into Schur form
+        auto spikeInd = IR(0,spikeSize);
+        auto TTL = T(spikeInd,spikeInd);
+        auto TTR = T(spikeInd,IR(spikeSize,END));
+        auto VL = V(ALL,spikeInd);
+        Matrix<F> householderScalarsT;
+
+        // Force T to be upper Hessenberg
+        MakeTrapezoidal( UPPER, T, -1 );
+
+        if( spikeSize > 1 && spikeValue != F(0) )
+        {
+            // The spike needs to be reduced to length one while maintaining
+            // the Hessenberg form of the deflation window
+            for( Int i=0; i<spikeSize; ++i )
+                work[i] = Conj(V(0,i));
+
+            // Compute a Householder reflector for condensing the spike
+            F beta = work[0];
+            F tau = lapack::Reflector( spikeSize, beta, &work[1], 1 );
+            work[0] = Real(1);
+
+            lapack::ApplyReflector
+            ( true, spikeSize, blockSize,
+              &work[0], 1, tau,
+              T.Buffer(), T.LDim(),
+              &work[blockSize] );
+
+            lapack::ApplyReflector
+            ( false, spikeSize, spikeSize,
+              &work[0], 1, Conj(tau),
+              TTL.Buffer(), TTL.LDim(),
+              &work[blockSize] );
+
+            lapack::ApplyReflector
+            ( false, blockSize, spikeSize,
+              &work[0], 1, Conj(tau),
+              VL.Buffer(), VL.LDim(),
+              &work[blockSize] );
+
+            Hessenberg( UPPER, TTL, householderScalarsT );
+            hessenberg::ApplyQ
+            ( LEFT, UPPER, ADJOINT, TTL, householderScalarsT, TTR );
+            hessenberg::ApplyQ
+            ( RIGHT, UPPER, NORMAL, TTL, householderScalarsT, VL );
+            MakeTrapezoidal( UPPER, T, -1 );
+        }
+
+        F newSpikeValue = spikeValue*Conj(V(0,0));
+        if( IsComplex<F>::value )
+        {
+            // The distributed sweeps assume a real subdiagonal, so we fold a
+            // unitary diagonal similarity, D, into V (and T := D' T D) which
+            // makes both the spike and the subdiagonal of T real
+            vector<F> phases(blockSize);
+            F phase = F(1);
+            for( Int i=0; i<blockSize; ++i )
+            {
+                const F eta = ( i == 0 ? newSpikeValue : T(i,i-1)*phase );
+                phase = ( eta == F(0) ? F(1) : eta / Abs(eta) );
+                phases[i] = phase;
+            }
+            for( Int j=0; j<blockSize; ++j )
+            {
+                for( Int i=0; i<=Min(j+1,blockSize-1); ++i )
+                    T(i,j) = Conj(phases[i])*T(i,j)*phases[j];
+                for( Int i=0; i<blockSize; ++i )
+                    V(i,j) *= phases[j];
+            }
+            for( Int i=1; i<blockSize; ++i )
+                T(i,i-1) = Abs(T(i,i-1));
+            newSpikeValue = Abs(newSpikeValue);
+        }
+
+        if( deflateBeg >= 1 )
+            H.Set( deflateBeg, deflateBeg-1, newSpikeValue );
+        H11 = T_STAR_STAR;
+
+        // TODO(poulson): Consider forming chunk-by-chunk to save memory
+        Int applyBeg = ( ctrl.fullTriangle ? 0 : winBeg );
+        if( deflateBeg > applyBeg )
+        {
+            auto H01 = H( IR(applyBeg,deflateBeg), deflateInd );
+            multibulge::TransformColumns( V, H01 );
+        }
+
+        if( ctrl.fullTriangle && winEnd < n ) 
+        {
+            auto H12 = H( deflateInd, IR(winEnd,END) );
+            multibulge::TransformRows( V, H12 );
+        }
+
+        if( ctrl.wantSchurVecs )
+        {
+            auto Z1 = Z(ALL,deflateInd);
+            multibulge::TransformColumns( V, Z1 );
+        }
+    }
+    return info;
+}
+
 } // namespace aed
 } // namespace hess_schur
 } // namespace El
@@ -16,7 +16,11 @@ namespace aed {
 // Intelligently choose a deflation window size
 // --------------------------------------------
 // Cf. LAPACK's DLAQR0 for the high-level approach
-template<typename F>
+//
+// The matrix type is a template parameter so that both Matrix<F> and
+// DistMatrix<F,MC,MR,BLOCK> are supported (in the latter case, the two
+// subdiagonal queries are collective).
+template<class HMatrix>
 void UpdateDeflationSize
 ( Int& deflationSize,
   Int& decreaseLevel,
@@ -25,7 +29,7 @@ void UpdateDeflationSize
   Int numStaleIterBeforeExceptional, 
   Int iterWinSize,
   Int winEnd, 
-  const Matrix<F>& H )
+  const HMatrix& H )
 {
     if( numIterSinceDeflation < numStaleIterBeforeExceptional )
     {
@@ -45,8 +49,8 @@ void UpdateDeflationSize
     else
     {
         const Int deflationBeg = winEnd - deflationSize;
-        if( Abs(H(deflationBeg,  deflationBeg-1)) >
-            Abs(H(deflationBeg-1,deflationBeg-2)) )
+        if( Abs(H.Get(deflationBeg,  deflationBeg-1)) >
+            Abs(H.Get(deflationBeg-1,deflationBeg-2)) )
         {
             ++deflationSize;
         }
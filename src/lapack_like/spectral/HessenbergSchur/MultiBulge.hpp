@@ -197,11 +197,6 @@ MultiBulge
         // collect the main and sub diagonal of H along the diagonal workers 
         // and then broadcast across the "cross" communicator.
         util::GatherTridiagonal( H, winInd, hMainWin, hSubWin, hSuperWin );
-        Output("winBeg=",winBeg,", winEnd=",winEnd);
-        Print( H, "H" );
-        Print( hMainWin, "hMainWin" );
-        Print( hSubWin, "hSubWin" );
-        Print( hSuperWin, "hSuperWin" );
 
         const Int iterOffset =
           DetectSmallSubdiagonal
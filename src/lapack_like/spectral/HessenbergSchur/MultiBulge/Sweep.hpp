@@ -12,6 +12,7 @@
 #include "./PairShifts.hpp"
 #include "./Sweep/ComputeReflectors.hpp"
 #include "./Sweep/ApplyReflectors.hpp"
+#include "./Sweep/Pipelined.hpp"
 
 // This is not yet functional but is included for testing reasons
 #include "./Sweep/Dist.hpp"
@@ -262,7 +263,7 @@ void Sweep
           Min( maxShiftsPerSweep, numShifts-shiftStart );
         auto sweepInd = IR(shiftStart,shiftStart+numSweepShifts);
         auto sweepShifts = validShifts(sweepInd,ALL);
-        SweepHelper( H, sweepShifts, Z, ctrl );
+        PipelinedSweepHelper( H, sweepShifts, Z, ctrl );
     }
 }
 
@@ -0,0 +1,220 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SCHUR_HESS_MULTIBULGE_SWEEP_PIPELINED_HPP
+#define EL_SCHUR_HESS_MULTIBULGE_SWEEP_PIPELINED_HPP
+
+#include "./ComputeReflectors.hpp"
+#include "./ApplyReflectors.hpp"
+#include "../Transform.hpp"
+
+namespace El {
+namespace hess_schur {
+namespace multibulge {
+
+// The distributed sweep splits the bulges into several chains of (at most)
+// ctrl.numBulgesPerBlock(blockHeight) tightly-packed bulges, so that the
+// slab effected by a single chase of a chain is roughly the size of a
+// distribution block. Each chase of a chain is computed redundantly on a
+// gathered copy of its slab (with the reflections accumulated into a small
+// unitary matrix, U), and the far-from-diagonal portions of the similarity
+// are applied with TransformRows and TransformColumns, which only involve
+// the one or two process rows (columns) owning the slab.
+//
+// As in
+//
+//   Robert Granat, Bo Kagstrom, and Daniel Kressner,
+//   "A novel parallel QR algorithm for hybrid distributed memory HPC systems",
+//   LAPACK Working Note 216, 2009,
+//
+// the chains are pipelined so that many bulges are in flight at once: a
+// trailing chain is chased as soon as its slab lies strictly above the
+// leading edge of the chain in front of it. Since the slabs of the active
+// chains are then disjoint, their far-from-diagonal updates involve
+// different process rows and columns.
+
+struct BulgeChain
+{
+    // The index of the first bulge (pair of shifts) of the chain
+    Int bulgeBeg;
+    Int numBulges;
+
+    Int chaseStride;
+    Int maxSlabSize;
+    Int chaseBeg;
+};
+
+template<typename F>
+void ChaseChain
+(       DistMatrix<F,MC,MR,BLOCK>& H,
+  const Matrix<Complex<Base<F>>>& shifts,
+        DistMatrix<F,MC,MR,BLOCK>& Z,
+        BulgeChain& chain,
+        Matrix<F>& U,
+        Matrix<F>& W,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    const Int n = H.Height();
+    const Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    const Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    const Int sweepEnd = winEnd-2;
+    const Int numBulges = chain.numBulges;
+    const Int chaseBeg = chain.chaseBeg;
+    auto chainShifts =
+      shifts( IR(2*chain.bulgeBeg,2*(chain.bulgeBeg+numBulges)), ALL );
+
+    const Int slabBeg = Max( chaseBeg, winBeg-1 );
+    const Int slabEnd = Min( chaseBeg+chain.maxSlabSize, winEnd );
+    const Int slabSize = slabEnd - slabBeg;
+    // The Householder transformations do not effect the first index
+    Identity( U, slabSize-1, slabSize-1 );
+
+    // Redundantly gather the slab, along with the three previous columns
+    // (for vigilant deflation) and the following row
+    const Int copyBeg = Max( winBeg, chaseBeg-3 );
+    const Int copyEnd = Min( slabEnd+1, winEnd );
+    auto copyInd = IR(copyBeg,copyEnd);
+    auto HCopy = H( copyInd, copyInd );
+    DistMatrix<F,STAR,STAR> HSlab_STAR_STAR( HCopy );
+    auto& HSlab = HSlab_STAR_STAR.Matrix();
+
+    // Chase the packet through the slab using indices relative to copyBeg
+    const Int winBegRel = winBeg - copyBeg;
+    const Int winEndRel = winEnd - copyBeg;
+    const Int chaseBegRel = chaseBeg - copyBeg;
+    const Int transformBegRel = Max( winBeg, chaseBeg ) - copyBeg;
+    const Int transformEndRel = slabEnd - copyBeg;
+    Matrix<F> ZDummy;
+    const Int packetEnd = Min(chaseBeg+chain.chaseStride,sweepEnd);
+    for( Int packetBeg=chaseBeg; packetBeg<packetEnd; ++packetBeg )
+    {
+        const Int firstBulge = Max( 0, ((winBeg-1)-packetBeg+2)/3 );
+        const Int numStepBulges =
+          Min( numBulges, (winEnd-packetBeg)/3 ) - firstBulge;
+        const Int packetBegRel = packetBeg - copyBeg;
+
+        ComputeReflectors
+        ( HSlab, winBegRel, winEndRel, chainShifts, W, packetBegRel,
+          firstBulge, numStepBulges, ctrl.progress );
+        ApplyReflectorsOpt
+        ( HSlab, winBegRel, winEndRel,
+          chaseBegRel, packetBegRel, transformBegRel, transformEndRel,
+          ZDummy, false, U, W,
+          firstBulge, numStepBulges, true, ctrl.progress );
+    }
+    HCopy = HSlab_STAR_STAR;
+
+    const Int transformBeg = ( ctrl.fullTriangle ? 0 : winBeg );
+    const Int transformEnd = ( ctrl.fullTriangle ? n : winEnd );
+    const auto horzInd = IR( Max(chaseBeg+1,winBeg), slabEnd );
+
+    // Horizontal far-from-diagonal application
+    if( transformEnd > slabEnd )
+    {
+        auto HHorzFar = H( horzInd, IR(slabEnd,transformEnd) );
+        TransformRows( U, HHorzFar );
+    }
+
+    // Vertical far-from-diagonal application
+    const Int vertEnd = Max(winBeg,chaseBeg);
+    if( vertEnd > transformBeg )
+    {
+        auto HVertFar = H( IR(transformBeg,vertEnd), horzInd );
+        TransformColumns( U, HVertFar );
+    }
+
+    if( ctrl.wantSchurVecs )
+    {
+        auto ZSub = Z( ALL, horzInd );
+        TransformColumns( U, ZSub );
+    }
+
+    chain.chaseBeg += chain.chaseStride;
+}
+
+template<typename F>
+void PipelinedSweepHelper
+(       DistMatrix<F,MC,MR,BLOCK>& H,
+  const DistMatrix<Complex<Base<F>>,STAR,STAR>& shifts,
+        DistMatrix<F,MC,MR,BLOCK>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    const Int n = H.Height();
+    const Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    const Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    DEBUG_ONLY(
+      if( winEnd-winBeg < 4 )
+          LogicError
+          ("multibulge::Sweep shouldn't be called for window sizes < 4");
+    )
+    const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+      if( numShifts < 2 )
+          LogicError("Expected at least one pair of shifts...");
+      if( numShifts % 2 != 0 )
+          LogicError("Expected an even number of shifts");
+    )
+    const Int numBulges = numShifts / 2;
+    const Int sweepEnd = winEnd-2;
+
+    // Since the last bulges lead the sweep (see the sequential SweepHelper),
+    // the leading chain is assigned the last shifts, and any remainder is
+    // placed in the trailing chain
+    const Int maxChainBulges =
+      Max( ctrl.numBulgesPerBlock(H.BlockHeight()), Int(1) );
+    const Int numChains = (numBulges+maxChainBulges-1) / maxChainBulges;
+    vector<BulgeChain> chains(numChains);
+    for( Int c=0; c<numChains; ++c )
+    {
+        const Int bulgeEnd = numBulges - c*maxChainBulges;
+        auto& chain = chains[c];
+        chain.bulgeBeg = Max( bulgeEnd-maxChainBulges, Int(0) );
+        chain.numBulges = bulgeEnd - chain.bulgeBeg;
+        chain.chaseStride = 3*(chain.numBulges-1) + 1;
+        chain.maxSlabSize = 3*chain.numBulges + chain.chaseStride;
+        chain.chaseBeg = (winBeg-1) - 3*(chain.numBulges-1);
+    }
+
+    // A trailing chain may only be chased if its slab (and the row following
+    // it) lies above the current position of the chain in front of it
+    auto canChase = [&]( Int c )
+    {
+        const Int slabEnd =
+          Min( chains[c].chaseBeg+chains[c].maxSlabSize, winEnd );
+        return slabEnd+1 <= chains[c-1].chaseBeg;
+    };
+
+    const auto& shiftsLoc = shifts.LockedMatrix();
+    Matrix<F> U, W;
+    Int chainBeg=0, chainEnd=0;
+    while( chainBeg < numChains )
+    {
+        // Introduce the next chain if the previous one is sufficiently far
+        // along (or has been retired)
+        if( chainEnd < numChains &&
+            (chainEnd == chainBeg || canChase(chainEnd)) )
+            ++chainEnd;
+
+        // Advance each of the active chains, starting from the leading one
+        for( Int c=chainBeg; c<chainEnd; ++c )
+            if( c == chainBeg || canChase(c) )
+                ChaseChain( H, shiftsLoc, Z, chains[c], U, W, ctrl );
+
+        // Retire the leading chains which have exited the window
+        while( chainBeg < chainEnd && chains[chainBeg].chaseBeg >= sweepEnd )
+            ++chainBeg;
+    }
+}
+
+} // namespace multibulge
+} // namespace hess_schur
+} // namespace El
+
+#endif // ifndef EL_SCHUR_HESS_MULTIBULGE_SWEEP_PIPELINED_HPP
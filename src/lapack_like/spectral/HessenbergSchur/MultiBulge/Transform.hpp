@@ -36,8 +36,8 @@ void TransformRows
     }
     else if( height <= firstBlockHeight + blockHeight )
     {
-        const bool firstRow = H.RowOwner( 0 );
-        const bool secondRow = H.RowOwner( firstBlockHeight );
+        const int firstRow = H.RowOwner( 0 );
+        const int secondRow = H.RowOwner( firstBlockHeight );
         if( grid.Row() == firstRow )
         {
             // 
@@ -126,8 +126,8 @@ void TransformColumns
     }
     else if( width <= firstBlockWidth + blockWidth )
     {
-        const bool firstCol = H.ColOwner( 0 );
-        const bool secondCol = H.ColOwner( firstBlockWidth );
+        const int firstCol = H.ColOwner( 0 );
+        const int secondCol = H.ColOwner( firstBlockWidth );
         if( grid.Col() == firstCol )
         {
             // 
@@ -88,8 +88,8 @@ void TwoByTwo
             // Overwrite H((offset,offset+1),offset+2:end) *= ZSub'
             // (applied from the left)
             auto HRight = H( ALL, IR(offset+2,END) );
-            Matrix<Complex<Real>> ZSubAdj;
-            Adjoint( ZSub, ZSubAdj );
+            FixedMatrix<Complex<Real>,2,2> ZSubAdj;
+            Adjoint( FixedMatrix<Complex<Real>,2,2>(ZSub), ZSubAdj );
             Transform2x2Rows( ZSubAdj, HRight, offset, offset+1 );
         }
         // Overwrite H(0:offset,(offset,offset+1)) *= ZSub
@@ -129,11 +129,12 @@ void TwoByTwo
     // complex unitary matrix of Schur vectors, the fact that the columns can
     // have arbitrary phase implies that the top-left and bottom-right entries
     // can be rescaled to be real (and both equal to 'c').
-    Matrix<F> HSub(2,2);
-    HSub(0,0) = eta00;
-    HSub(0,1) = eta01;
-    HSub(1,0) = eta10;
-    HSub(1,1) = eta11;
+    FixedMatrix<F,2,2> HSubFixed;
+    HSubFixed(0,0) = eta00;
+    HSubFixed(0,1) = eta01;
+    HSubFixed(1,0) = eta10;
+    HSubFixed(1,1) = eta11;
+    auto HSub = HSubFixed.View();
     auto wSub = wLoc( IR(offset,offset+2), ALL );
     Matrix<F> ZSub;
     HessenbergSchur( HSub, wSub, ZSub );
@@ -150,8 +151,8 @@ void TwoByTwo
             // Overwrite H((offset,offset+1),offset+2:end) *= ZSub'
             // (applied from the left)
             auto HRight = H( ALL, IR(offset+2,END) );
-            Matrix<F> ZSubAdj;
-            Adjoint( ZSub, ZSubAdj );
+            FixedMatrix<F,2,2> ZSubAdj;
+            Adjoint( FixedMatrix<F,2,2>(ZSub), ZSubAdj );
             Transform2x2Rows( ZSubAdj, HRight, offset, offset+1 );
         }
         // Overwrite H(0:offset,(offset,offset+1)) *= ZSub
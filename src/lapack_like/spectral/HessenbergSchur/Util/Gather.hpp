@@ -269,6 +269,32 @@ void GatherTridiagonal
     hSuperWin.ProcessQueues();
 }
 
+// Unlike GatherSubdiagonal, which assumes that the subdiagonal is real, this
+// routine redundantly gathers the magnitudes of the (possibly complex)
+// subdiagonal of H(winInd,winInd) so that exact deflations can be detected
+template<typename F>
+void GatherSubdiagonalMagnitudes
+( const DistMatrix<F,MC,MR,BLOCK>& H,
+  const IR& winInd,
+        Matrix<Base<F>>& hSubAbsWin )
+{
+    DEBUG_CSE
+    const Int winSize = winInd.end - winInd.beg;
+    Zeros( hSubAbsWin, Max(winSize-1,0), 1 );
+    if( winSize <= 1 )
+        return;
+    for( Int i=0; i<winSize-1; ++i )
+    {
+        const Int row = winInd.beg+i+1;
+        const Int col = winInd.beg+i;
+        if( H.IsLocal(row,col) )
+            hSubAbsWin(i) =
+              OneAbs(H.GetLocal(H.LocalRow(row),H.LocalCol(col)));
+    }
+    // Each entry has a unique owner, so a summation suffices
+    mpi::AllReduce( hSubAbsWin.Buffer(), winSize-1, H.Grid().VCComm() );
+}
+
 } // namespace util
 } // namespace hess_schur
 } // namespace El
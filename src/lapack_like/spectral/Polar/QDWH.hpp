@@ -115,10 +115,51 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
     return info;
 }
 
+// Run the iteration in a lower precision (e.g., float for double, or double
+// for DoubleDouble and Quad) until it converges to that precision, and then
+// warm-start the working-precision iteration from the result, which then
+// usually converges within one or two Cholesky-based iterations. The result
+// is unitary to working precision, but it is only guaranteed to be the polar
+// factor of a matrix within a relative distance of O(eps_low) of A.
+template<typename F>
+QDWHInfo QDWH( Matrix<F>& A, const QDWHCtrl& ctrl );
+
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,QDWHInfo>
+MixedPrecisionQDWH( Matrix<F>& A, const QDWHCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    auto ctrlMod( ctrl );
+    ctrlMod.mixedPrecision = false;
+
+    Matrix<FLow> ALow;
+    Copy( A, ALow );
+    const auto lowInfo = QDWH( ALow, ctrlMod );
+    Copy( ALow, A );
+
+    auto info = QDWH( A, ctrlMod );
+    info.numLowIts = lowInfo.numIts;
+    return info;
+}
+
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,QDWHInfo>
+MixedPrecisionQDWH( Matrix<F>& A, const QDWHCtrl& ctrl )
+{
+    DEBUG_CSE
+    auto ctrlMod( ctrl );
+    ctrlMod.mixedPrecision = false;
+    return QDWH( A, ctrlMod );
+}
+
 template<typename F>
 QDWHInfo QDWH( Matrix<F>& A, const QDWHCtrl& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.mixedPrecision )
+        return MixedPrecisionQDWH( A, ctrl );
+
     typedef Base<F> Real;
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
@@ -261,11 +302,46 @@ QDWHInner
     return info;
 }
 
+template<typename F>
+QDWHInfo QDWH( ElementalMatrix<F>& A, const QDWHCtrl& ctrl );
+
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,QDWHInfo>
+MixedPrecisionQDWH( ElementalMatrix<F>& A, const QDWHCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    auto ctrlMod( ctrl );
+    ctrlMod.mixedPrecision = false;
+
+    DistMatrix<FLow> ALow( A.Grid() );
+    Copy( A, ALow );
+    const auto lowInfo = QDWH( ALow, ctrlMod );
+    Copy( ALow, A );
+
+    auto info = QDWH( A, ctrlMod );
+    info.numLowIts = lowInfo.numIts;
+    return info;
+}
+
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,QDWHInfo>
+MixedPrecisionQDWH( ElementalMatrix<F>& A, const QDWHCtrl& ctrl )
+{
+    DEBUG_CSE
+    auto ctrlMod( ctrl );
+    ctrlMod.mixedPrecision = false;
+    return QDWH( A, ctrlMod );
+}
+
 template<typename F>
 QDWHInfo
 QDWH( ElementalMatrix<F>& APre, const QDWHCtrl& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.mixedPrecision )
+        return MixedPrecisionQDWH( APre, ctrl );
+
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -432,11 +508,47 @@ QDWHInner
     return info;
 }
 
+// See polar::MixedPrecisionQDWH
+template<typename F>
+QDWHInfo QDWH( UpperOrLower uplo, Matrix<F>& A, const QDWHCtrl& ctrl );
+
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,QDWHInfo>
+MixedPrecisionQDWH( UpperOrLower uplo, Matrix<F>& A, const QDWHCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    auto ctrlMod( ctrl );
+    ctrlMod.mixedPrecision = false;
+
+    Matrix<FLow> ALow;
+    Copy( A, ALow );
+    const auto lowInfo = QDWH( uplo, ALow, ctrlMod );
+    Copy( ALow, A );
+
+    auto info = QDWH( uplo, A, ctrlMod );
+    info.numLowIts = lowInfo.numIts;
+    return info;
+}
+
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,QDWHInfo>
+MixedPrecisionQDWH( UpperOrLower uplo, Matrix<F>& A, const QDWHCtrl& ctrl )
+{
+    DEBUG_CSE
+    auto ctrlMod( ctrl );
+    ctrlMod.mixedPrecision = false;
+    return QDWH( uplo, A, ctrlMod );
+}
+
 template<typename F>
 QDWHInfo
 QDWH( UpperOrLower uplo, Matrix<F>& A, const QDWHCtrl& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.mixedPrecision )
+        return MixedPrecisionQDWH( uplo, A, ctrl );
+
     typedef Base<F> Real;
     MakeHermitian( uplo, A );
     const Real twoEst = TwoNormEstimate( A );
@@ -582,11 +694,49 @@ QDWHInner
     return info;
 }
 
+template<typename F>
+QDWHInfo
+QDWH( UpperOrLower uplo, ElementalMatrix<F>& A, const QDWHCtrl& ctrl );
+
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,QDWHInfo>
+MixedPrecisionQDWH
+( UpperOrLower uplo, ElementalMatrix<F>& A, const QDWHCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    auto ctrlMod( ctrl );
+    ctrlMod.mixedPrecision = false;
+
+    DistMatrix<FLow> ALow( A.Grid() );
+    Copy( A, ALow );
+    const auto lowInfo = QDWH( uplo, ALow, ctrlMod );
+    Copy( ALow, A );
+
+    auto info = QDWH( uplo, A, ctrlMod );
+    info.numLowIts = lowInfo.numIts;
+    return info;
+}
+
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,QDWHInfo>
+MixedPrecisionQDWH
+( UpperOrLower uplo, ElementalMatrix<F>& A, const QDWHCtrl& ctrl )
+{
+    DEBUG_CSE
+    auto ctrlMod( ctrl );
+    ctrlMod.mixedPrecision = false;
+    return QDWH( uplo, A, ctrlMod );
+}
+
 template<typename F>
 QDWHInfo
 QDWH( UpperOrLower uplo, ElementalMatrix<F>& APre, const QDWHCtrl& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.mixedPrecision )
+        return MixedPrecisionQDWH( uplo, APre, ctrl );
+
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -14,6 +14,8 @@
 #include "./Pseudospectra/IRA.hpp"
 #include "./Pseudospectra/IRL.hpp"
 #include "./Pseudospectra/Analytic.hpp"
+#include "./Pseudospectra/Adaptive.hpp"
+#include "./Pseudospectra/Subgrid.hpp"
 
 // For one-norm pseudospectra. An adaptation of the more robust algorithm of
 // Higham and Tisseur will hopefully be implemented soon.
@@ -282,6 +284,17 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
         PseudospecCtrl<Base<F>> psCtrl )
 {
     DEBUG_CSE
+    if( pspec::UseSubgrids( UPre.Grid(), psCtrl ) )
+    {
+        auto cloud =
+          []( const DistMatrix<F>& U, const DistMatrix<F>&,
+              const DistMatrix<Complex<Base<F>>,VR,STAR>& shifts,
+                    DistMatrix<Base<F>,VR,STAR>& invNorms,
+              const PseudospecCtrl<Base<F>>& ctrl )
+          { return TriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+        return pspec::SubgridCloud<F>
+               ( UPre, nullptr, shiftsPre, invNorms, psCtrl, cloud );
+    }
     typedef Base<F> Real;
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
@@ -340,6 +353,17 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
         PseudospecCtrl<Base<F>> psCtrl )
 {
     DEBUG_CSE
+    if( pspec::UseSubgrids( UPre.Grid(), psCtrl ) )
+    {
+        auto cloud =
+          []( const DistMatrix<F>& U, const DistMatrix<F>& Q,
+              const DistMatrix<Complex<Base<F>>,VR,STAR>& shifts,
+                    DistMatrix<Base<F>,VR,STAR>& invNorms,
+              const PseudospecCtrl<Base<F>>& ctrl )
+          { return TriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+        return pspec::SubgridCloud<F>
+               ( UPre, &QPre, shiftsPre, invNorms, psCtrl, cloud );
+    }
     typedef Base<F> Real;
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
@@ -403,6 +427,18 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
         PseudospecCtrl<Real> psCtrl )
 {
     DEBUG_CSE
+    if( pspec::UseSubgrids( UPre.Grid(), psCtrl ) )
+    {
+        auto cloud =
+          []( const DistMatrix<Real>& U, const DistMatrix<Real>&,
+              const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+                    DistMatrix<Real,VR,STAR>& invNorms,
+              const PseudospecCtrl<Real>& ctrl )
+          { return QuasiTriangularSpectralCloud
+                   ( U, shifts, invNorms, ctrl ); };
+        return pspec::SubgridCloud<Real>
+               ( UPre, nullptr, shiftsPre, invNorms, psCtrl, cloud );
+    }
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
 
@@ -449,6 +485,18 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
         PseudospecCtrl<Real> psCtrl )
 {
     DEBUG_CSE
+    if( pspec::UseSubgrids( UPre.Grid(), psCtrl ) )
+    {
+        auto cloud =
+          []( const DistMatrix<Real>& U, const DistMatrix<Real>& Q,
+              const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+                    DistMatrix<Real,VR,STAR>& invNorms,
+              const PseudospecCtrl<Real>& ctrl )
+          { return QuasiTriangularSpectralCloud
+                   ( U, Q, shifts, invNorms, ctrl ); };
+        return pspec::SubgridCloud<Real>
+               ( UPre, &QPre, shiftsPre, invNorms, psCtrl, cloud );
+    }
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
 
@@ -494,6 +542,17 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
         PseudospecCtrl<Base<F>> psCtrl )
 {
     DEBUG_CSE
+    if( pspec::UseSubgrids( HPre.Grid(), psCtrl ) )
+    {
+        auto cloud =
+          []( const DistMatrix<F>& H, const DistMatrix<F>&,
+              const DistMatrix<Complex<Base<F>>,VR,STAR>& shifts,
+                    DistMatrix<Base<F>,VR,STAR>& invNorms,
+              const PseudospecCtrl<Base<F>>& ctrl )
+          { return HessenbergSpectralCloud( H, shifts, invNorms, ctrl ); };
+        return pspec::SubgridCloud<F>
+               ( HPre, nullptr, shiftsPre, invNorms, psCtrl, cloud );
+    }
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
@@ -533,6 +592,17 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
         PseudospecCtrl<Base<F>> psCtrl )
 {
     DEBUG_CSE
+    if( pspec::UseSubgrids( HPre.Grid(), psCtrl ) )
+    {
+        auto cloud =
+          []( const DistMatrix<F>& H, const DistMatrix<F>& Q,
+              const DistMatrix<Complex<Base<F>>,VR,STAR>& shifts,
+                    DistMatrix<Base<F>,VR,STAR>& invNorms,
+              const PseudospecCtrl<Base<F>>& ctrl )
+          { return HessenbergSpectralCloud( H, Q, shifts, invNorms, ctrl ); };
+        return pspec::SubgridCloud<F>
+               ( HPre, &QPre, shiftsPre, invNorms, psCtrl, cloud );
+    }
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
@@ -811,33 +881,17 @@ Matrix<Int> TriangularSpectralWindow
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return TriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename F>
@@ -856,33 +910,17 @@ Matrix<Int> TriangularSpectralWindow
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = TriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return TriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename Real>
@@ -899,33 +937,17 @@ Matrix<Int> QuasiTriangularSpectralWindow
     DEBUG_CSE
     typedef Complex<Real> C;
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = QuasiTriangularSpectralCloud( U, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return QuasiTriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename Real>
@@ -943,34 +965,17 @@ Matrix<Int> QuasiTriangularSpectralWindow
     DEBUG_CSE
     typedef Complex<Real> C;
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = 
-        QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename F>
@@ -988,33 +993,17 @@ Matrix<Int> HessenbergSpectralWindow
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = HessenbergSpectralCloud( H, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return HessenbergSpectralCloud( H, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename F>
@@ -1033,33 +1022,17 @@ Matrix<Int> HessenbergSpectralWindow
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = HessenbergSpectralCloud( H, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return HessenbergSpectralCloud( H, Q, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename F>
@@ -1078,36 +1051,17 @@ DistMatrix<Int> TriangularSpectralWindow
     typedef Complex<Real> C;
     const Grid& g = U.Grid();
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return TriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( g, realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename F>
@@ -1127,36 +1081,17 @@ DistMatrix<Int> TriangularSpectralWindow
     typedef Complex<Real> C;
     const Grid& g = U.Grid();
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = TriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return TriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( g, realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename Real>
@@ -1174,36 +1109,17 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
     typedef Complex<Real> C;
     const Grid& g = U.Grid();
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = QuasiTriangularSpectralCloud( U, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return QuasiTriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( g, realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename Real>
@@ -1222,37 +1138,17 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
     typedef Complex<Real> C;
     const Grid& g = U.Grid();
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = 
-        QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( g, realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename F>
@@ -1271,36 +1167,17 @@ DistMatrix<Int> HessenbergSpectralWindow
     typedef Complex<Real> C;
     const Grid& g = H.Grid();
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = HessenbergSpectralCloud( H, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return HessenbergSpectralCloud( H, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( g, realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
 template<typename F>
@@ -1320,80 +1197,288 @@ DistMatrix<Int> HessenbergSpectralWindow
     typedef Complex<Real> C;
     const Grid& g = H.Grid();
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
     psCtrl.center = center;
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = HessenbergSpectralCloud( H, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return HessenbergSpectralCloud( H, Q, shifts, invNorms, ctrl ); };
+    return pspec::Window<Real>
+           ( g, realSize, imagSize, cloud, invNormMap, psCtrl );
 }
 
-template<typename F>
-Matrix<Int> SpectralWindow
-( const Matrix<F>& A,
-        Matrix<Base<F>>& invNormMap, 
-  Complex<Base<F>> center,
-  Base<F> realWidth,
-  Base<F> imagWidth,
+namespace pspec {
+
+// Reduce to (quasi-)triangular or Hessenberg form once, before any of the
+// (possibly adaptively refined) clouds of the window are evaluated
+
+template<typename Real>
+Matrix<Int> Helper
+( const Matrix<Complex<Real>>& A,
+        Matrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
   Int realSize,
   Int imagSize,
-  PseudospecCtrl<Base<F>> psCtrl )
+  PseudospecCtrl<Real> psCtrl )
 {
     DEBUG_CSE
-    typedef Base<F> Real;
     typedef Complex<Real> C;
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
+    Matrix<C> U( A );
+    if( psCtrl.norm == PS_TWO_NORM )
+    {
+        if( psCtrl.schur )
+        {
+            Matrix<C> w;
+            auto schurCtrl( psCtrl.schurCtrl );
+            schurCtrl.hessSchurCtrl.fullTriangle = true;
+            Schur( U, w, schurCtrl );
+            return TriangularSpectralWindow
+                   ( U, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+        else
+        {
+            hessenberg::ExplicitCondensed( UPPER, U );
+            return HessenbergSpectralWindow
+                   ( U, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+    }
+    else
+    {
+        Matrix<C> Q;
+        if( psCtrl.schur )
+        {
+            Matrix<C> w;
+            auto schurCtrl( psCtrl.schurCtrl );
+            schurCtrl.hessSchurCtrl.fullTriangle = true;
+            Schur( U, w, Q, schurCtrl );
+            return TriangularSpectralWindow
+                   ( U, Q, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+        else
+        {
+            Matrix<C> t;
+            Hessenberg( UPPER, U, t );
+            Identity( Q, A.Height(), A.Height() );
+            hessenberg::ApplyQ( LEFT, UPPER, NORMAL, U, t, Q );
+            return HessenbergSpectralWindow
+                   ( U, Q, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+    }
+}
 
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
+template<typename Real>
+DistMatrix<Int> Helper
+( const ElementalMatrix<Complex<Real>>& A,
+        ElementalMatrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Real> psCtrl )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = A.Grid();
+    DistMatrix<C> U( A );
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
+    if( psCtrl.norm == PS_TWO_NORM )
     {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
+        if( psCtrl.schur )
+        {
+            DistMatrix<C,VR,STAR> w(g);
+            auto schurCtrl( psCtrl.schurCtrl );
+            schurCtrl.hessSchurCtrl.fullTriangle = true;
+            Schur( U, w, schurCtrl );
+            return TriangularSpectralWindow
+                   ( U, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+        else
+        {
+            hessenberg::ExplicitCondensed( UPPER, U );
+            return HessenbergSpectralWindow
+                   ( U, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
     }
+    else
+    {
+        DistMatrix<C> Q(g);
+        if( psCtrl.schur )
+        {
+            DistMatrix<C,VR,STAR> w(g);
+            auto schurCtrl( psCtrl.schurCtrl );
+            schurCtrl.hessSchurCtrl.fullTriangle = true;
+            Schur( U, w, Q, schurCtrl );
+            return TriangularSpectralWindow
+                   ( U, Q, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+        else
+        {
+            DistMatrix<C,STAR,STAR> t(g);
+            Hessenberg( UPPER, U, t );
+            Identity( Q, U.Height(), U.Height() );
+            hessenberg::ApplyQ( LEFT, UPPER, NORMAL, U, t, Q );
+            return HessenbergSpectralWindow
+                   ( U, Q, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+    }
+}
+
+template<typename Real>
+Matrix<Int> Helper
+( const Matrix<Real>& A,
+        Matrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Real> psCtrl )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+
+    if( psCtrl.forceComplexSchur )
+    {
+        Matrix<C> ACpx;
+        Copy( A, ACpx );
+        return Helper
+        ( ACpx, invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+          psCtrl );
+    }
+
+    if( !psCtrl.schur )
+        LogicError("Real Hessenberg algorithm not yet supported");
+    Matrix<Real> U( A );
+    Matrix<C> w;
+    auto schurCtrl( psCtrl.schurCtrl );
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+    if( psCtrl.norm == PS_TWO_NORM )
+    {
+        Schur( U, w, schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            Matrix<C> UCpx;
+            schur::RealToComplex( U, UCpx );
+            return TriangularSpectralWindow
+                   ( UCpx, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+        return QuasiTriangularSpectralWindow
+               ( U, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+    else
+    {
+        Matrix<Real> Q;
+        Schur( U, w, Q, schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            Matrix<C> UCpx, QCpx;
+            schur::RealToComplex( U, Q, UCpx, QCpx );
+            return TriangularSpectralWindow
+                   ( UCpx, QCpx, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+        return QuasiTriangularSpectralWindow
+               ( U, Q, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+}
+
+template<typename Real>
+DistMatrix<Int> Helper
+( const ElementalMatrix<Real>& A,
+        ElementalMatrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Real> psCtrl )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = A.Grid();
+
+    if( psCtrl.forceComplexSchur )
+    {
+        DistMatrix<C> ACpx(g);
+        Copy( A, ACpx );
+        return Helper
+        ( ACpx, invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+          psCtrl );
+    }
+
+    if( !psCtrl.schur )
+        LogicError("Real Hessenberg algorithm not yet supported");
+    DistMatrix<Real> U( A );
+    DistMatrix<C,VR,STAR> w(g);
+    auto schurCtrl( psCtrl.schurCtrl );
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+    if( psCtrl.norm == PS_TWO_NORM )
+    {
+        Schur( U, w, schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            DistMatrix<C> UCpx(g);
+            schur::RealToComplex( U, UCpx );
+            return TriangularSpectralWindow
+                   ( UCpx, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+        return QuasiTriangularSpectralWindow
+               ( U, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+    else
+    {
+        DistMatrix<Real> Q(g);
+        Schur( U, w, Q, schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            DistMatrix<C> UCpx(g), QCpx(g);
+            schur::RealToComplex( U, Q, UCpx, QCpx );
+            return TriangularSpectralWindow
+                   ( UCpx, QCpx, invNormMap, center, realWidth, imagWidth,
+                     realSize, imagSize, psCtrl );
+        }
+        return QuasiTriangularSpectralWindow
+               ( U, Q, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+}
 
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = SpectralCloud( A, shifts, invNorms, psCtrl );
+} // namespace pspec
 
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+template<typename F>
+Matrix<Int> SpectralWindow
+( const Matrix<F>& A,
+        Matrix<Base<F>>& invNormMap, 
+  Complex<Base<F>> center,
+  Base<F> realWidth,
+  Base<F> imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_CSE
+    return pspec::Helper
+    ( A, invNormMap, center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename F>
@@ -1408,40 +1493,8 @@ DistMatrix<Int> SpectralWindow
   PseudospecCtrl<Base<F>> psCtrl )
 {
     DEBUG_CSE
-    typedef Base<F> Real;
-    typedef Complex<Real> C;
-    const Grid& g = A.Grid();
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = SpectralCloud( A, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    return pspec::Helper
+    ( A, invNormMap, center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename F>
@@ -0,0 +1,374 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+#define EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+
+// Spectral windows treat each pixel as being located at a cell center of a
+// tesselation of the box (psCtrl.center,psCtrl.realWidth,psCtrl.imagWidth),
+// with the pixels ordered so that the imaginary coordinate varies fastest.
+//
+// When contour levels are requested, the pixels are sampled with a quadtree:
+// the corners of the cells of a coarse lattice (with a stride of
+// 2^refineLevels pixels) are evaluated first, and each cell whose corners
+// do not bracket any of the levels (in log scale, and up to a margin) is
+// filled in by bilinear interpolation rather than subdivided. All of the
+// shifts requested by a level of the quadtree are evaluated as one cloud so
+// that the triangular solves remain batched.
+
+namespace El {
+namespace pspec {
+
+template<typename Real>
+Complex<Real> PixelShift
+( Int x, Int y, Int realSize, Int imagSize, const PseudospecCtrl<Real>& psCtrl )
+{
+    typedef Complex<Real> C;
+    const Real realStep = psCtrl.realWidth/realSize;
+    const Real imagStep = psCtrl.imagWidth/imagSize;
+    const C corner =
+      psCtrl.center + C(-psCtrl.realWidth/2,psCtrl.imagWidth/2);
+    return corner+C((x+0.5)*realStep,-(y+0.5)*imagStep);
+}
+
+// Evaluate the (redundantly known) list of pixels, returning the inverse
+// norms and iteration counts redundantly
+template<typename Real>
+using PixelEvaluator =
+  function<void(const vector<Int>&,vector<Real>&,vector<Int>&)>;
+
+template<typename Real>
+void Refine
+( Int realSize,
+  Int imagSize,
+  const PseudospecCtrl<Real>& psCtrl,
+  const PixelEvaluator<Real>& evaluate,
+        vector<Real>& invNorms,
+        vector<Int>& itCounts,
+  bool progress=false )
+{
+    DEBUG_CSE
+    const Int numPixels = realSize*imagSize;
+    invNorms.assign( numPixels, Real(0) );
+    itCounts.assign( numPixels, 0 );
+    vector<bool> sampled( numPixels, false );
+
+    // Work with natural logarithms of the inverse norms
+    vector<Real> levels;
+    for( const Real& eps : psCtrl.contours )
+    {
+        if( eps <= Real(0) )
+            LogicError("Contour levels must be positive");
+        levels.push_back( -Log(eps) );
+    }
+    const Real margin = psCtrl.refineMargin*Log(Real(10));
+    const Int stride = Int(1) << Min(Max(psCtrl.refineLevels,Int(0)),Int(20));
+
+    struct Cell { Int x0, x1, y0, y1; };
+    auto lattice =
+      [&]( Int size )
+      {
+          vector<Int> coords;
+          for( Int c=0; c<size; c+=stride )
+              coords.push_back( c );
+          if( coords.back() != size-1 )
+              coords.push_back( size-1 );
+          if( coords.size() == 1 )
+              coords.push_back( 0 );
+          return coords;
+      };
+
+    vector<Int> requests;
+    auto request =
+      [&]( Int x, Int y )
+      {
+          const Int j = x*imagSize + y;
+          if( !sampled[j] )
+          {
+              sampled[j] = true;
+              requests.push_back( j );
+          }
+      };
+    Int numSampled = 0;
+    auto flush =
+      [&]()
+      {
+          if( requests.empty() )
+              return;
+          vector<Real> newInvNorms;
+          vector<Int> newItCounts;
+          evaluate( requests, newInvNorms, newItCounts );
+          for( size_t k=0; k<requests.size(); ++k )
+          {
+              invNorms[requests[k]] = newInvNorms[k];
+              itCounts[requests[k]] = newItCounts[k];
+          }
+          numSampled += requests.size();
+          if( progress )
+              Output
+              ("Sampled ",requests.size()," more pixels (",numSampled," of ",
+               numPixels,")");
+          requests.clear();
+      };
+
+    vector<Cell> cells;
+    const auto xs = lattice( realSize );
+    const auto ys = lattice( imagSize );
+    for( size_t s=0; s+1<xs.size(); ++s )
+        for( size_t t=0; t+1<ys.size(); ++t )
+        {
+            cells.push_back( Cell{xs[s],xs[s+1],ys[t],ys[t+1]} );
+            request( xs[s], ys[t] );
+            request( xs[s], ys[t+1] );
+            request( xs[s+1], ys[t] );
+            request( xs[s+1], ys[t+1] );
+        }
+    flush();
+
+    auto logAt = [&]( Int x, Int y ) { return Log(invNorms[x*imagSize+y]); };
+    vector<Cell> finalCells;
+    while( !cells.empty() )
+    {
+        vector<Cell> children;
+        for( const auto& cell : cells )
+        {
+            const bool xSplit = ( cell.x1-cell.x0 > 1 );
+            const bool ySplit = ( cell.y1-cell.y0 > 1 );
+            if( !xSplit && !ySplit )
+                continue;
+
+            const Real corners[4] =
+              { logAt(cell.x0,cell.y0), logAt(cell.x0,cell.y1),
+                logAt(cell.x1,cell.y0), logAt(cell.x1,cell.y1) };
+            const Real minLog = *std::min_element( corners, corners+4 );
+            const Real maxLog = *std::max_element( corners, corners+4 );
+            bool crosses = false;
+            for( const Real& level : levels )
+                if( level >= minLog-margin && level <= maxLog+margin )
+                    crosses = true;
+            if( !crosses )
+            {
+                finalCells.push_back( cell );
+                continue;
+            }
+
+            vector<Int> xCuts{cell.x0}, yCuts{cell.y0};
+            if( xSplit )
+                xCuts.push_back( (cell.x0+cell.x1)/2 );
+            if( ySplit )
+                yCuts.push_back( (cell.y0+cell.y1)/2 );
+            xCuts.push_back( cell.x1 );
+            yCuts.push_back( cell.y1 );
+            for( size_t s=0; s+1<xCuts.size(); ++s )
+                for( size_t t=0; t+1<yCuts.size(); ++t )
+                {
+                    children.push_back
+                    ( Cell{xCuts[s],xCuts[s+1],yCuts[t],yCuts[t+1]} );
+                    request( xCuts[s], yCuts[t] );
+                    request( xCuts[s], yCuts[t+1] );
+                    request( xCuts[s+1], yCuts[t] );
+                    request( xCuts[s+1], yCuts[t+1] );
+                }
+        }
+        flush();
+        cells.swap( children );
+    }
+
+    // Bilinearly interpolate the logarithms of the inverse norms over the
+    // cells which were not subdivided
+    for( const auto& cell : finalCells )
+    {
+        const Real l00 = logAt(cell.x0,cell.y0), l01 = logAt(cell.x0,cell.y1),
+                   l10 = logAt(cell.x1,cell.y0), l11 = logAt(cell.x1,cell.y1);
+        for( Int x=cell.x0; x<=cell.x1; ++x )
+        {
+            const Real s =
+              ( cell.x1 > cell.x0 ?
+                Real(x-cell.x0) / Real(cell.x1-cell.x0) : Real(0) );
+            for( Int y=cell.y0; y<=cell.y1; ++y )
+            {
+                const Int j = x*imagSize + y;
+                if( sampled[j] )
+                    continue;
+                const Real t =
+                  ( cell.y1 > cell.y0 ?
+                    Real(y-cell.y0) / Real(cell.y1-cell.y0) : Real(0) );
+                const Real logInvNorm =
+                  (1-s)*((1-t)*l00 + t*l01) + s*((1-t)*l10 + t*l11);
+                invNorms[j] = Exp( logInvNorm );
+                sampled[j] = true;
+            }
+        }
+    }
+}
+
+template<typename Real>
+Matrix<Int> Window
+( Int realSize,
+  Int imagSize,
+  const function<Matrix<Int>
+    (const Matrix<Complex<Real>>&,Matrix<Real>&,
+     const PseudospecCtrl<Real>&)>& cloud,
+        Matrix<Real>& invNormMap,
+        PseudospecCtrl<Real> psCtrl )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int numPixels = realSize*imagSize;
+    Matrix<Real> invNorms;
+    Matrix<Int> itCounts;
+    if( psCtrl.contours.empty() )
+    {
+        psCtrl.snapCtrl.realSize = realSize;
+        psCtrl.snapCtrl.imagSize = imagSize;
+        Matrix<C> shifts( numPixels, 1 );
+        for( Int j=0; j<numPixels; ++j )
+            shifts(j) = PixelShift( j/imagSize, j%imagSize, realSize, imagSize,
+                                    psCtrl );
+        itCounts = cloud( shifts, invNorms, psCtrl );
+    }
+    else
+    {
+        // The snapshots assume that every pixel is part of the cloud
+        psCtrl.snapCtrl.realSize = 0;
+        psCtrl.snapCtrl.imagSize = 0;
+        auto evaluate =
+          [&]( const vector<Int>& pixels,
+                     vector<Real>& pixelInvNorms,
+                     vector<Int>& pixelItCounts )
+          {
+              const Int numShifts = pixels.size();
+              Matrix<C> shifts( numShifts, 1 );
+              for( Int k=0; k<numShifts; ++k )
+                  shifts(k) =
+                    PixelShift
+                    ( pixels[k]/imagSize, pixels[k]%imagSize,
+                      realSize, imagSize, psCtrl );
+              Matrix<Real> shiftInvNorms;
+              auto shiftItCounts = cloud( shifts, shiftInvNorms, psCtrl );
+              pixelInvNorms.resize( numShifts );
+              pixelItCounts.resize( numShifts );
+              for( Int k=0; k<numShifts; ++k )
+              {
+                  pixelInvNorms[k] = shiftInvNorms(k);
+                  pixelItCounts[k] = shiftItCounts(k);
+              }
+          };
+        vector<Real> invNormVec;
+        vector<Int> itCountVec;
+        Refine<Real>
+        ( realSize, imagSize, psCtrl, evaluate, invNormVec, itCountVec,
+          psCtrl.progress );
+        invNorms.Resize( numPixels, 1 );
+        itCounts.Resize( numPixels, 1 );
+        for( Int j=0; j<numPixels; ++j )
+        {
+            invNorms(j) = invNormVec[j];
+            itCounts(j) = itCountVec[j];
+        }
+    }
+
+    // Rearrange the vectors into grids
+    Matrix<Int> itCountMap;
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
+    return itCountMap;
+}
+
+template<typename Real>
+DistMatrix<Int> Window
+( const Grid& g,
+  Int realSize,
+  Int imagSize,
+  const function<DistMatrix<Int,VR,STAR>
+    (const DistMatrix<Complex<Real>,VR,STAR>&,DistMatrix<Real,VR,STAR>&,
+     const PseudospecCtrl<Real>&)>& cloud,
+        ElementalMatrix<Real>& invNormMap,
+        PseudospecCtrl<Real> psCtrl )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int numPixels = realSize*imagSize;
+    DistMatrix<Real,VR,STAR> invNorms(g);
+    DistMatrix<Int,VR,STAR> itCounts(g);
+    if( psCtrl.contours.empty() )
+    {
+        psCtrl.snapCtrl.realSize = realSize;
+        psCtrl.snapCtrl.imagSize = imagSize;
+        DistMatrix<C,VR,STAR> shifts( numPixels, 1, g );
+        const Int numLocShifts = shifts.LocalHeight();
+        for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+        {
+            const Int i = shifts.GlobalRow(iLoc);
+            shifts.SetLocal
+            ( iLoc, 0,
+              PixelShift( i/imagSize, i%imagSize, realSize, imagSize,
+                          psCtrl ) );
+        }
+        itCounts = cloud( shifts, invNorms, psCtrl );
+    }
+    else
+    {
+        // The snapshots assume that every pixel is part of the cloud
+        psCtrl.snapCtrl.realSize = 0;
+        psCtrl.snapCtrl.imagSize = 0;
+        auto evaluate =
+          [&]( const vector<Int>& pixels,
+                     vector<Real>& pixelInvNorms,
+                     vector<Int>& pixelItCounts )
+          {
+              const Int numShifts = pixels.size();
+              DistMatrix<C,VR,STAR> shifts( numShifts, 1, g );
+              const Int numLocShifts = shifts.LocalHeight();
+              for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+              {
+                  const Int i = pixels[shifts.GlobalRow(iLoc)];
+                  shifts.SetLocal
+                  ( iLoc, 0,
+                    PixelShift( i/imagSize, i%imagSize, realSize, imagSize,
+                                psCtrl ) );
+              }
+              DistMatrix<Real,VR,STAR> shiftInvNorms(g);
+              auto shiftItCounts = cloud( shifts, shiftInvNorms, psCtrl );
+              DistMatrix<Real,STAR,STAR> shiftInvNorms_STAR_STAR(shiftInvNorms);
+              DistMatrix<Int,STAR,STAR> shiftItCounts_STAR_STAR(shiftItCounts);
+              pixelInvNorms.resize( numShifts );
+              pixelItCounts.resize( numShifts );
+              for( Int k=0; k<numShifts; ++k )
+              {
+                  pixelInvNorms[k] = shiftInvNorms_STAR_STAR.GetLocal(k,0);
+                  pixelItCounts[k] = shiftItCounts_STAR_STAR.GetLocal(k,0);
+              }
+          };
+        vector<Real> invNormVec;
+        vector<Int> itCountVec;
+        Refine<Real>
+        ( realSize, imagSize, psCtrl, evaluate, invNormVec, itCountVec,
+          psCtrl.progress && g.Rank() == 0 );
+        invNorms.Resize( numPixels, 1 );
+        itCounts.Resize( numPixels, 1 );
+        const Int numLocPixels = invNorms.LocalHeight();
+        for( Int iLoc=0; iLoc<numLocPixels; ++iLoc )
+        {
+            const Int i = invNorms.GlobalRow(iLoc);
+            invNorms.SetLocal( iLoc, 0, invNormVec[i] );
+            itCounts.SetLocal( iLoc, 0, itCountVec[i] );
+        }
+    }
+
+    // Rearrange the vectors into grids
+    DistMatrix<Int> itCountMap(g);
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
+    return itCountMap;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_SUBGRID_HPP
+#define EL_PSEUDOSPECTRA_SUBGRID_HPP
+
+namespace El {
+namespace pspec {
+
+// The multi-shift triangular solves of a distributed cloud are latency-bound
+// for the modest matrix sizes typical of pseudospectra, so, if requested,
+// the shifts are split into contiguous batches which are each handled by a
+// sub-grid of psCtrl.shiftGroupSize processes holding its own copy of U
+// (and, for one-norm pseudospectra, Q).
+template<typename F>
+using SubgridCloudFunc =
+  function<DistMatrix<Int,VR,STAR>
+  (const DistMatrix<F>&,const DistMatrix<F>&,
+   const DistMatrix<Complex<Base<F>>,VR,STAR>&,DistMatrix<Base<F>,VR,STAR>&,
+   const PseudospecCtrl<Base<F>>&)>;
+
+template<typename Real>
+bool UseSubgrids( const Grid& g, const PseudospecCtrl<Real>& psCtrl )
+{ return psCtrl.shiftGroupSize > 0 && psCtrl.shiftGroupSize < g.Size(); }
+
+template<typename F>
+DistMatrix<Int,VR,STAR> SubgridCloud
+( const ElementalMatrix<F>& U,
+  const ElementalMatrix<F>* Q,
+  const ElementalMatrix<Complex<Base<F>>>& shifts,
+        ElementalMatrix<Base<F>>& invNorms,
+        PseudospecCtrl<Base<F>> psCtrl,
+  const SubgridCloudFunc<F>& cloud )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Grid& g = U.Grid();
+    const int groupSize = psCtrl.shiftGroupSize;
+    const int numGroups = g.Size() / groupSize;
+
+    DistMatrixBatch<Int> layout( g, numGroups, groupSize );
+    DistMatrixBatch<F> UBatch( layout ), QBatch( layout );
+    for( Int k=0; k<numGroups; ++k )
+    {
+        UBatch.Scatter( k, U );
+        if( Q != nullptr )
+            QBatch.Scatter( k, *Q );
+    }
+
+    const Int numShifts = shifts.Height();
+    const Int batchSize = (numShifts+numGroups-1) / numGroups;
+    DistMatrix<C,STAR,STAR> shifts_STAR_STAR( shifts );
+    vector<Real> invNormBuf( numShifts, Real(0) );
+    vector<Int> itCountBuf( numShifts, 0 );
+
+    // The snapshots assume that every shift is part of the cloud
+    psCtrl.shiftGroupSize = 0;
+    psCtrl.snapCtrl.realSize = 0;
+    psCtrl.snapCtrl.imagSize = 0;
+    for( Int k : layout.LocalIndices() )
+    {
+        const Grid& subGrid = layout.SubGrid( layout.Group(k) );
+        const Int off = Min( k*batchSize, numShifts );
+        const Int num = Min( batchSize, numShifts-off );
+        if( num == 0 )
+            continue;
+        if( psCtrl.progress && subGrid.Rank() == 0 )
+            Output("Sub-grid ",k," handling shifts [",off,",",off+num,")");
+
+        DistMatrix<C,VR,STAR> subShifts( num, 1, subGrid );
+        const Int numLocShifts = subShifts.LocalHeight();
+        for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+        {
+            const Int i = subShifts.GlobalRow(iLoc);
+            subShifts.SetLocal( iLoc, 0, shifts_STAR_STAR.GetLocal(off+i,0) );
+        }
+        DistMatrix<Real,VR,STAR> subInvNorms(subGrid);
+        auto subItCounts =
+          cloud( UBatch(k), QBatch(k), subShifts, subInvNorms, psCtrl );
+
+        DistMatrix<Real,STAR,STAR> subInvNorms_STAR_STAR( subInvNorms );
+        DistMatrix<Int,STAR,STAR> subItCounts_STAR_STAR( subItCounts );
+        if( subGrid.Rank() == 0 )
+        {
+            for( Int i=0; i<num; ++i )
+            {
+                invNormBuf[off+i] = subInvNorms_STAR_STAR.GetLocal(i,0);
+                itCountBuf[off+i] = subItCounts_STAR_STAR.GetLocal(i,0);
+            }
+        }
+    }
+    mpi::AllReduce( invNormBuf.data(), numShifts, g.Comm() );
+    mpi::AllReduce( itCountBuf.data(), numShifts, g.Comm() );
+
+    DistMatrix<Real,VR,STAR> invNorms_VR_STAR( numShifts, 1, g );
+    DistMatrix<Int,VR,STAR> itCounts( numShifts, 1, g );
+    const Int numLocShifts = itCounts.LocalHeight();
+    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+    {
+        const Int i = itCounts.GlobalRow(iLoc);
+        invNorms_VR_STAR.SetLocal( iLoc, 0, invNormBuf[i] );
+        itCounts.SetLocal( iLoc, 0, itCountBuf[i] );
+    }
+    Copy( invNorms_VR_STAR, invNorms );
+    return itCounts;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_SUBGRID_HPP
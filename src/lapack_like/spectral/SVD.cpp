@@ -10,6 +10,7 @@
 
 #include "./SVD/Chan.hpp"
 #include "./SVD/Product.hpp"
+#include "./SVD/Jacobi.hpp"
 
 namespace El {
 
@@ -250,6 +251,10 @@ SVDInfo SVD
 
     SVDInfo info;
     auto approach = ctrl.bidiagSVDCtrl.approach;
+    if( ctrl.useJacobi && approach != PRODUCT_SVD )
+    {
+        return svd::Jacobi( A, U, s, V, ctrl );
+    }
     if( approach == PRODUCT_SVD )
     {
         auto tolType = ctrl.bidiagSVDCtrl.tolType;
@@ -318,6 +323,10 @@ SVDInfo SVD
     {
         return SVD( A, s, ctrl );
     }
+    if( ctrl.useJacobi && approach != PRODUCT_SVD )
+    {
+        return svd::Jacobi( A, U, s, V, ctrl );
+    }
 
     SVDInfo info;
     if( approach == PRODUCT_SVD )
@@ -531,6 +540,8 @@ SVDInfo SVD
         ctrl.bidiagSVDCtrl.approach == COMPACT_SVD ||
         ctrl.bidiagSVDCtrl.approach == FULL_SVD )
     {
+        if( ctrl.useJacobi )
+            return svd::Jacobi( A, s, ctrl );
         return svd::Chan( A, s, ctrl );
     }
     else
@@ -560,6 +571,8 @@ SVDInfo SVD
         ctrl.bidiagSVDCtrl.approach == COMPACT_SVD ||
         ctrl.bidiagSVDCtrl.approach == FULL_SVD )
     {
+        if( ctrl.useJacobi )
+            return svd::Jacobi( A, s, ctrl );
         DistMatrix<F> ACopy( A );
         return svd::Chan( ACopy, s, ctrl );
     }
@@ -594,6 +607,11 @@ SVDInfo SVD
         return svd::Product( A, s, ctrl.bidiagSVDCtrl.tol, relative );
     }
 
+    if( ctrl.useJacobi )
+    {
+        return svd::Jacobi( A, s, ctrl );
+    }
+
     if( !ctrl.overwrite )
     {
         auto ctrlMod( ctrl );
@@ -604,34 +622,46 @@ SVDInfo SVD
     return svd::Chan( A, s, ctrl );
 }
 
-namespace svd {
+template<typename F>
+void SVD
+( DistMatrixBatch<F>& A,
+  DistMatrixBatch<Base<F>>& s,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( !A.SharesLayout(s) )
+        LogicError("The singular value batch must share the layout of A");
+    for( const Int k : A.LocalIndices() )
+        SVD( A(k), s(k), ctrl );
+}
 
 template<typename F>
-SVDInfo TSQR
-( const AbstractDistMatrix<F>& A,
-        AbstractDistMatrix<Base<F>>& s )
+void SVD
+( DistMatrixBatch<F>& A,
+  DistMatrixBatch<F>& U,
+  DistMatrixBatch<Base<F>>& s,
+  DistMatrixBatch<F>& V,
+  const SVDCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    DistMatrix<F,VC,STAR> ACopy( A );
-    return TSQR( ACopy, s, true );
+    if( !A.SharesLayout(U) || !A.SharesLayout(s) || !A.SharesLayout(V) )
+        LogicError("The SVD batches must share the layout of A");
+    for( const Int k : A.LocalIndices() )
+        SVD( A(k), U(k), s(k), V(k), ctrl );
 }
 
+namespace svd {
+
 template<typename F>
 SVDInfo TSQR
-( AbstractDistMatrix<F>& APre,
-  AbstractDistMatrix<Base<F>>& sPre,
-  bool overwrite )
+( const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<Base<F>>& sPre,
+        qr::TreeData<F>& treeData )
 {
     DEBUG_CSE
-    if( !overwrite )  
-    {
-        DistMatrix<F,VC,STAR> A( APre );
-        return TSQR( A, sPre, true );
-    }
-
     DistMatrixReadProxy<F,F,VC,STAR> AProx( APre );
     DistMatrixWriteProxy<Base<F>,Base<F>,CIRC,CIRC> sProx( sPre );
-    auto& A = AProx.Get();
+    auto& A = AProx.GetLocked();
     auto& s = sProx.Get();
     const Int m = A.Height();
     const Int n = A.Width();
@@ -646,24 +676,45 @@ SVDInfo TSQR
         return SVD( A, s );
     }
 
+    // Since only the singular values are requested, the implicit Q is never
+    // applied, and so nothing needs to be sent back down the tree
     SVDInfo info;
-    qr::TreeData<F> treeData;
-    treeData.QR0 = A.LockedMatrix();
-    QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
-    qr::ts::Reduce( A, treeData );
+    qr::ts::Refactor( A, treeData );
     if( A.ColRank() == 0 )
         info = SVD( qr::ts::RootQR(A,treeData), s.Matrix() );
     // TODO(poulson): Broadcast info from root?
-    qr::ts::Scatter( A, treeData );
     return info;
 }
 
+template<typename F>
+SVDInfo TSQR
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<Base<F>>& s )
+{
+    DEBUG_CSE
+    qr::TreeData<F> treeData;
+    return TSQR( A, s, treeData );
+}
+
+template<typename F>
+SVDInfo TSQR
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<Base<F>>& s,
+  bool overwrite )
+{
+    DEBUG_CSE
+    // A is only read, so there is no longer any need to overwrite it
+    const AbstractDistMatrix<F>& ALocked = A;
+    return TSQR( ALocked, s );
+}
+
 template<typename F>
 SVDInfo TSQR
 ( const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& UPre,
         AbstractDistMatrix<Base<F>>& sPre,
-        AbstractDistMatrix<F>& VPre )
+        AbstractDistMatrix<F>& VPre,
+        qr::TreeData<F>& treeData )
 {
     DEBUG_CSE
 
@@ -688,12 +739,12 @@ SVDInfo TSQR
         return SVD( A, U, s, V );
     }
 
+    // The SVD of the root's stacked triangles is applied to its data in place
+    // of a final QR, and then the left singular vectors are formed by a
+    // single pass back down the tree
     SVDInfo info;
     Copy( A, U );
-    qr::TreeData<F> treeData;
-    treeData.QR0 = U.LockedMatrix();
-    QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
-    qr::ts::Reduce( U, treeData );
+    qr::ts::Refactor( U, treeData );
     if( U.ColRank() == 0 )
     {
         Matrix<F>& rootQR = qr::ts::RootQR(U,treeData);
@@ -713,6 +764,18 @@ SVDInfo TSQR
     return info;
 }
 
+template<typename F>
+SVDInfo TSQR
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& s,
+        AbstractDistMatrix<F>& V )
+{
+    DEBUG_CSE
+    qr::TreeData<F> treeData;
+    return TSQR( A, U, s, V, treeData );
+}
+
 } // namespace svd
 
 #define PROTO(F) \
@@ -756,6 +819,16 @@ SVDInfo TSQR
           AbstractDistMatrix<Base<F>>& s, \
           AbstractDistMatrix<F>& V, \
     const SVDCtrl<Base<F>>& ctrl ); \
+  template void SVD \
+  ( DistMatrixBatch<F>& A, \
+    DistMatrixBatch<Base<F>>& s, \
+    const SVDCtrl<Base<F>>& ctrl ); \
+  template void SVD \
+  ( DistMatrixBatch<F>& A, \
+    DistMatrixBatch<F>& U, \
+    DistMatrixBatch<Base<F>>& s, \
+    DistMatrixBatch<F>& V, \
+    const SVDCtrl<Base<F>>& ctrl ); \
   template SVDInfo svd::TSQR \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<Base<F>>& s, \
@@ -764,10 +837,20 @@ SVDInfo TSQR
   ( const AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<Base<F>>& s ); \
   template SVDInfo svd::TSQR \
+  ( const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<Base<F>>& s, \
+          qr::TreeData<F>& treeData ); \
+  template SVDInfo svd::TSQR \
   ( const AbstractDistMatrix<F>& A, \
           AbstractDistMatrix<F>& U, \
           AbstractDistMatrix<Base<F>>& s, \
-          AbstractDistMatrix<F>& V );
+          AbstractDistMatrix<F>& V ); \
+  template SVDInfo svd::TSQR \
+  ( const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& U, \
+          AbstractDistMatrix<Base<F>>& s, \
+          AbstractDistMatrix<F>& V, \
+          qr::TreeData<F>& treeData );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
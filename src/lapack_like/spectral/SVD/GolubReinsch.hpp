@@ -117,9 +117,12 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     DistMatrix<F,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
+    bidiag::BulgeReflectors<F> bulgeReflectors;
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    Bidiag
+    ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+      ctrl.bidiagCtrl );
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -173,8 +176,12 @@ SVDInfo GolubReinsch
     // Backtransform U and V
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    if( !avoidU )
+        bidiag::ApplyQ
+        ( LEFT, NORMAL, A, householderScalarsQ, bulgeReflectors, U );
+    if( !avoidV )
+        bidiag::ApplyP
+        ( LEFT, NORMAL, A, householderScalarsP, bulgeReflectors, V );
     if( ctrl.time && g.Rank() == 0 )
         Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
 
@@ -249,9 +256,12 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     DistMatrix<F,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
+    bidiag::BulgeReflectors<F> bulgeReflectors;
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    Bidiag
+    ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+      ctrl.bidiagCtrl );
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -0,0 +1,746 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_JACOBI_HPP
+#define EL_SVD_JACOBI_HPP
+
+namespace El {
+namespace svd {
+
+// One-sided block Jacobi
+// ======================
+// The columns of a matrix with at least as many rows as columns are split
+// into 2 S blocks which are paired up within S 'slots'. Each step
+// orthogonalizes every pair of columns within each slot, and the pairs are
+// then advanced with the "caterpillar" ordering of Brent and Luk, which meets
+// every pair of blocks once within 2 S - 1 steps. When distributed, each
+// process owns a contiguous set of slots, and only the blocks which cross a
+// process boundary need to be communicated after each step.
+//
+// Each pair of blocks, say X = [W_I, W_J], is orthogonalized by reducing it
+// to a small upper-triangular matrix R (via a QR factorization when X is
+// tall), running scalar one-sided Jacobi over the columns of R while
+// accumulating the rotations into a unitary Z, and then forming X Z (and, if
+// requested, [V_I, V_J] Z) with matrix-matrix products.
+
+template<typename F>
+struct JacobiBlock
+{
+    // The global column indices of the block
+    vector<Int> columns;
+
+    // Whether the block is currently stored by this process
+    bool local=false;
+    Matrix<F> W, V;
+};
+
+template<typename F>
+Base<F> OrthogonalizePair
+( JacobiBlock<F>& blockI,
+  JacobiBlock<F>& blockJ,
+  Base<F> tol,
+  Int maxSweeps )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = blockI.W.Height();
+    const Int nI = blockI.W.Width();
+    const Int nJ = blockJ.W.Width();
+    const Int width = nI + nJ;
+    const bool wantV = ( blockI.V.Height() > 0 );
+    if( width <= 1 )
+        return Real(0);
+
+    Matrix<F> X;
+    Zeros( X, m, width );
+    auto XI = X( ALL, IR(0,nI) );
+    auto XJ = X( ALL, IR(nI,width) );
+    XI = blockI.W;
+    XJ = blockJ.W;
+
+    // Measure the largest cosine between the columns
+    Matrix<F> G;
+    Gemm( ADJOINT, NORMAL, F(1), X, X, G );
+    Real offMax = 0;
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<j; ++i )
+        {
+            const Real scale = Sqrt(RealPart(G(i,i)))*Sqrt(RealPart(G(j,j)));
+            if( scale > Real(0) )
+                offMax = Max( offMax, Abs(G(i,j))/scale );
+        }
+    if( offMax <= tol )
+        return offMax;
+
+    Matrix<F> R;
+    if( m > width )
+    {
+        Matrix<F> QRFact( X ), householderScalars;
+        Matrix<Real> signature;
+        QR( QRFact, householderScalars, signature );
+        R = QRFact( IR(0,width), ALL );
+        MakeTrapezoidal( UPPER, R );
+    }
+    else
+        R = X;
+    const Int mR = R.Height();
+
+    Matrix<F> Z;
+    Identity( Z, width, width );
+    for( Int sweep=0; sweep<maxSweeps; ++sweep )
+    {
+        bool rotated = false;
+        for( Int j=1; j<width; ++j )
+        {
+            for( Int i=0; i<j; ++i )
+            {
+                F* rI = R.Buffer(0,i);
+                F* rJ = R.Buffer(0,j);
+                const Real alpha = RealPart(blas::Dot(mR,rI,1,rI,1));
+                const Real beta = RealPart(blas::Dot(mR,rJ,1,rJ,1));
+                const F gamma = blas::Dot(mR,rI,1,rJ,1);
+                const Real gammaAbs = Abs(gamma);
+                if( alpha == Real(0) || beta == Real(0) ||
+                    gammaAbs <= tol*Sqrt(alpha)*Sqrt(beta) )
+                    continue;
+                rotated = true;
+
+                // Rotate [r_i, conj(phase) r_j] so that the new columns are
+                // orthogonal
+                const F phaseConj = Conj(gamma) / gammaAbs;
+                const Real zeta = (beta-alpha) / (2*gammaAbs);
+                const Real t = ( zeta >= Real(0) ? Real(1) : Real(-1) ) /
+                  (Abs(zeta)+Sqrt(1+zeta*zeta));
+                const Real c = 1 / Sqrt(1+t*t);
+                const Real s = c*t;
+                for( Int k=0; k<mR; ++k )
+                {
+                    const F rhoI = rI[k];
+                    const F rhoJ = phaseConj*rJ[k];
+                    rI[k] = c*rhoI - s*rhoJ;
+                    rJ[k] = s*rhoI + c*rhoJ;
+                }
+                F* zI = Z.Buffer(0,i);
+                F* zJ = Z.Buffer(0,j);
+                for( Int k=0; k<width; ++k )
+                {
+                    const F zetaI = zI[k];
+                    const F zetaJ = phaseConj*zJ[k];
+                    zI[k] = c*zetaI - s*zetaJ;
+                    zJ[k] = s*zetaI + c*zetaJ;
+                }
+            }
+        }
+        if( !rotated )
+            break;
+    }
+
+    Matrix<F> XZ;
+    Gemm( NORMAL, NORMAL, F(1), X, Z, XZ );
+    blockI.W = XZ( ALL, IR(0,nI) );
+    blockJ.W = XZ( ALL, IR(nI,width) );
+    if( wantV )
+    {
+        const Int n = blockI.V.Height();
+        Matrix<F> Y, YZ;
+        Zeros( Y, n, width );
+        auto YI = Y( ALL, IR(0,nI) );
+        auto YJ = Y( ALL, IR(nI,width) );
+        YI = blockI.V;
+        YJ = blockJ.V;
+        Gemm( NORMAL, NORMAL, F(1), Y, Z, YZ );
+        blockI.V = YZ( ALL, IR(0,nI) );
+        blockJ.V = YZ( ALL, IR(nI,width) );
+    }
+    return offMax;
+}
+
+// Rotate every block but the first of the top row one position around the
+// two rows
+inline void AdvanceOrdering( vector<Int>& top, vector<Int>& bottom )
+{
+    const Int numSlots = top.size();
+    if( numSlots == 1 )
+        return;
+    vector<Int> newTop(numSlots), newBottom(numSlots);
+    newTop[0] = top[0];
+    newTop[1] = bottom[0];
+    for( Int s=2; s<numSlots; ++s )
+        newTop[s] = top[s-1];
+    for( Int s=0; s<numSlots-1; ++s )
+        newBottom[s] = bottom[s+1];
+    newBottom[numSlots-1] = top[numSlots-1];
+    top = newTop;
+    bottom = newBottom;
+}
+
+// Send the blocks which changed owners to their new owners
+template<typename F>
+void ExchangeBlocks
+( vector<JacobiBlock<F>>& blocks,
+  const vector<Int>& oldSlots,
+  const vector<Int>& newSlots,
+  Int slotsPerProc,
+  Int m,
+  Int vHeight,
+  mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int rank = mpi::Rank( comm );
+    const Int numBlocks = blocks.size();
+
+    vector<Int> sending, receiving;
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const int oldOwner = oldSlots[b] / slotsPerProc;
+        const int newOwner = newSlots[b] / slotsPerProc;
+        if( oldOwner == newOwner )
+            continue;
+        if( oldOwner == rank )
+            sending.push_back( b );
+        else if( newOwner == rank )
+            receiving.push_back( b );
+    }
+    if( sending.empty() && receiving.empty() )
+        return;
+
+    const Int blockHeight = m + vHeight;
+    const Int numSends = sending.size();
+    const Int numRecvs = receiving.size();
+    vector<vector<F>> sendBufs(numSends), recvBufs(numRecvs);
+    vector<mpi::Request<F>> requests(numSends+numRecvs);
+    for( Int r=0; r<numRecvs; ++r )
+    {
+        const Int b = receiving[r];
+        const Int width = blocks[b].columns.size();
+        recvBufs[r].resize( blockHeight*width );
+        mpi::TaggedIRecv
+        ( recvBufs[r].data(), blockHeight*width,
+          oldSlots[b]/slotsPerProc, b, comm, requests[r] );
+    }
+    for( Int r=0; r<numSends; ++r )
+    {
+        const Int b = sending[r];
+        auto& block = blocks[b];
+        const Int width = block.columns.size();
+        auto& buf = sendBufs[r];
+        buf.resize( blockHeight*width );
+        for( Int j=0; j<width; ++j )
+        {
+            MemCopy( &buf[j*blockHeight], block.W.LockedBuffer(0,j), m );
+            MemCopy
+            ( &buf[j*blockHeight+m], block.V.LockedBuffer(0,j), vHeight );
+        }
+        mpi::TaggedISend
+        ( buf.data(), blockHeight*width,
+          newSlots[b]/slotsPerProc, b, comm, requests[numRecvs+r] );
+    }
+    mpi::WaitAll( numSends+numRecvs, requests.data() );
+
+    for( Int r=0; r<numSends; ++r )
+    {
+        auto& block = blocks[sending[r]];
+        block.local = false;
+        block.W.Empty();
+        block.V.Empty();
+    }
+    for( Int r=0; r<numRecvs; ++r )
+    {
+        auto& block = blocks[receiving[r]];
+        const Int width = block.columns.size();
+        const auto& buf = recvBufs[r];
+        block.local = true;
+        block.W.Resize( m, width );
+        block.V.Resize( vHeight, width );
+        for( Int j=0; j<width; ++j )
+        {
+            MemCopy( block.W.Buffer(0,j), &buf[j*blockHeight], m );
+            MemCopy( block.V.Buffer(0,j), &buf[j*blockHeight+m], vHeight );
+        }
+    }
+}
+
+// Sweep until every pair of columns is numerically orthogonal. Block
+// 2 s and 2 s + 1 must initially be owned by the owner of slot s, and the
+// owner of slot s is s / slotsPerProc.
+template<typename F>
+Int JacobiSweeps
+( vector<JacobiBlock<F>>& blocks,
+  Int slotsPerProc,
+  Int m,
+  Int vHeight,
+  Base<F> tol,
+  const JacobiSVDCtrl<Base<F>>& ctrl,
+  mpi::Comm comm )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const int rank = mpi::Rank( comm );
+    const Int numBlocks = blocks.size();
+    const Int numSlots = numBlocks / 2;
+    const Int numSteps = 2*numSlots - 1;
+
+    vector<Int> top(numSlots), bottom(numSlots), slots(numBlocks);
+    for( Int s=0; s<numSlots; ++s )
+    {
+        top[s] = 2*s;
+        bottom[s] = 2*s+1;
+        slots[2*s] = slots[2*s+1] = s;
+    }
+
+    Int sweep=0;
+    bool converged = false;
+    while( !converged && sweep < ctrl.maxSweeps )
+    {
+        ++sweep;
+        Real offMax = 0;
+        for( Int step=0; step<numSteps; ++step )
+        {
+            for( Int s=rank*slotsPerProc; s<(rank+1)*slotsPerProc; ++s )
+            {
+                const Real pairMax =
+                  OrthogonalizePair
+                  ( blocks[top[s]], blocks[bottom[s]], tol, ctrl.maxSweeps );
+                offMax = Max( offMax, pairMax );
+            }
+
+            AdvanceOrdering( top, bottom );
+            vector<Int> newSlots(numBlocks);
+            for( Int s=0; s<numSlots; ++s )
+                newSlots[top[s]] = newSlots[bottom[s]] = s;
+            ExchangeBlocks
+            ( blocks, slots, newSlots, slotsPerProc, m, vHeight, comm );
+            slots = newSlots;
+        }
+        offMax = mpi::AllReduce( offMax, mpi::MAX, comm );
+        if( ctrl.progress && rank == 0 )
+            Output("Jacobi sweep ",sweep,": max cosine of ",offMax);
+        converged = ( offMax <= tol );
+    }
+    if( !converged )
+        RuntimeError("Jacobi SVD did not converge in ",sweep," sweeps");
+    return sweep;
+}
+
+template<typename Real>
+Real JacobiTolerance( Int m, const JacobiSVDCtrl<Real>& ctrl )
+{
+    if( ctrl.tol > Real(0) )
+        return ctrl.tol;
+    return Sqrt(Real(Max(m,Int(1))))*limits::Epsilon<Real>();
+}
+
+// The number of blocks assigned to each process; every process must agree
+inline Int JacobiSlotsPerProc( Int maxLocalWidth, Int blockSize )
+{
+    const Int blockSizeSafe = Max( blockSize, Int(1) );
+    return Max( (maxLocalWidth+2*blockSizeSafe-1) / (2*blockSizeSafe), Int(1) );
+}
+
+// Sort the singular values in descending order and return the position of
+// each column within the sorted order as well as the number of columns to
+// keep
+template<typename Real>
+void JacobiSort
+( Int m,
+  const vector<Real>& sigma,
+  vector<Int>& positions,
+  vector<Real>& sigmaSorted,
+  Int& numKept,
+  const BidiagSVDCtrl<Real>& bidiagSVDCtrl )
+{
+    DEBUG_CSE
+    const Int n = sigma.size();
+    vector<Int> order(n);
+    for( Int j=0; j<n; ++j )
+        order[j] = j;
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( const Int& a, const Int& b ) { return sigma[a] > sigma[b]; } );
+    positions.resize( n );
+    sigmaSorted.resize( n );
+    for( Int j=0; j<n; ++j )
+    {
+        positions[order[j]] = j;
+        sigmaSorted[j] = sigma[order[j]];
+    }
+
+    numKept = n;
+    if( bidiagSVDCtrl.approach == COMPACT_SVD )
+    {
+        const Real twoNorm = ( n==0 ? Real(0) : sigmaSorted[0] );
+        const Real thresh =
+          bidiag_svd::APosterioriThreshold( m, n, twoNorm, bidiagSVDCtrl );
+        for( Int j=0; j<n; ++j )
+        {
+            if( sigmaSorted[j] <= thresh )
+            {
+                numKept = j;
+                break;
+            }
+        }
+    }
+}
+
+// Overwrite the trailing columns of U, starting with column 'rank', with an
+// orthonormal basis for part of the orthogonal complement of the leading ones
+template<typename F>
+void CompleteBasis( Matrix<F>& U, Int rank )
+{
+    DEBUG_CSE
+    const Int width = U.Width();
+    if( rank >= width )
+        return;
+    auto U1 = U( ALL, IR(0,rank) );
+    auto U2 = U( ALL, IR(rank,width) );
+    Matrix<F> Q, Z;
+    Gaussian( Q, U.Height(), width-rank );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), U1, Q, Z );
+        Gemm( NORMAL, NORMAL, F(-1), U1, Z, F(1), Q );
+    }
+    qr::ExplicitUnitary( Q );
+    U2 = Q;
+}
+
+template<typename F>
+void CompleteBasis( DistMatrix<F>& U, Int rank )
+{
+    DEBUG_CSE
+    const Int width = U.Width();
+    if( rank >= width )
+        return;
+    const Grid& g = U.Grid();
+    auto U1 = U( ALL, IR(0,rank) );
+    auto U2 = U( ALL, IR(rank,width) );
+    DistMatrix<F> Q(g), Z(g);
+    Gaussian( Q, U.Height(), width-rank );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), U1, Q, Z );
+        Gemm( NORMAL, NORMAL, F(-1), U1, Z, F(1), Q );
+    }
+    qr::ExplicitUnitary( Q );
+    U2 = Q;
+}
+
+// Assumes that A is at least as tall as it is wide
+template<typename F>
+SVDInfo JacobiTall
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  bool wantU,
+  bool wantV,
+  bool full,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const auto& jacobiCtrl = ctrl.jacobiCtrl;
+    const Int vHeight = ( wantV ? n : 0 );
+
+    const Int numSlots = JacobiSlotsPerProc( n, jacobiCtrl.blockSize );
+    const Int numBlocks = 2*numSlots;
+    vector<JacobiBlock<F>> blocks(numBlocks);
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int start = (b*n) / numBlocks;
+        const Int end = ((b+1)*n) / numBlocks;
+        auto& block = blocks[b];
+        block.local = true;
+        block.W = A( ALL, IR(start,end) );
+        Zeros( block.V, vHeight, end-start );
+        for( Int j=start; j<end; ++j )
+        {
+            block.columns.push_back( j );
+            if( wantV )
+                block.V(j,j-start) = F(1);
+        }
+    }
+
+    SVDInfo info;
+    const Real tol = JacobiTolerance( m, jacobiCtrl );
+    info.numJacobiSweeps =
+      JacobiSweeps
+      ( blocks, numSlots, m, vHeight, tol, jacobiCtrl, mpi::COMM_SELF );
+
+    vector<Real> sigma(n);
+    for( auto& block : blocks )
+        for( Int t=0; t<Int(block.columns.size()); ++t )
+            sigma[block.columns[t]] = FrobeniusNorm( block.W(ALL,IR(t)) );
+    vector<Int> positions;
+    vector<Real> sigmaSorted;
+    Int numKept;
+    JacobiSort( m, sigma, positions, sigmaSorted, numKept, ctrl.bidiagSVDCtrl );
+
+    const Real safeMin = limits::SafeMin<Real>();
+    s.Resize( numKept, 1 );
+    Int rank = 0;
+    for( Int j=0; j<numKept; ++j )
+    {
+        s(j) = sigmaSorted[j];
+        if( sigmaSorted[j] > safeMin )
+            ++rank;
+    }
+    if( wantU )
+    {
+        Zeros( U, m, full ? m : numKept );
+        for( auto& block : blocks )
+        {
+            for( Int t=0; t<Int(block.columns.size()); ++t )
+            {
+                const Int j = positions[block.columns[t]];
+                if( j >= rank )
+                    continue;
+                auto u = U( ALL, IR(j) );
+                u = block.W( ALL, IR(t) );
+                Scale( Real(1)/sigmaSorted[j], u );
+            }
+        }
+        CompleteBasis( U, rank );
+    }
+    if( wantV )
+    {
+        Zeros( V, n, numKept );
+        for( auto& block : blocks )
+        {
+            for( Int t=0; t<Int(block.columns.size()); ++t )
+            {
+                const Int j = positions[block.columns[t]];
+                if( j < numKept )
+                {
+                    auto v = V( ALL, IR(j) );
+                    v = block.V( ALL, IR(t) );
+                }
+            }
+        }
+    }
+    return info;
+}
+
+template<typename F>
+SVDInfo Jacobi
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const bool wantU = ctrl.bidiagSVDCtrl.wantU;
+    const bool wantV = ctrl.bidiagSVDCtrl.wantV;
+    const bool full = ( ctrl.bidiagSVDCtrl.approach == FULL_SVD );
+    if( A.Height() >= A.Width() )
+    {
+        return JacobiTall( A, U, s, V, wantU, wantV, full, ctrl );
+    }
+    else
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        return JacobiTall( AAdj, V, s, U, wantV, wantU, full, ctrl );
+    }
+}
+
+template<typename F>
+SVDInfo Jacobi
+( const Matrix<F>& A,
+        Matrix<Base<F>>& s,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    Matrix<F> U, V;
+    auto ctrlMod( ctrl );
+    ctrlMod.bidiagSVDCtrl.wantU = false;
+    ctrlMod.bidiagSVDCtrl.wantV = false;
+    return Jacobi( A, U, s, V, ctrlMod );
+}
+
+// Assumes that A is at least as tall as it is wide
+template<typename F>
+SVDInfo JacobiTall
+( const DistMatrix<F,STAR,VR>& A,
+        AbstractDistMatrix<F>& UPre,
+        AbstractDistMatrix<Base<F>>& sPre,
+        AbstractDistMatrix<F>& VPre,
+  bool wantU,
+  bool wantV,
+  bool full,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const auto& jacobiCtrl = ctrl.jacobiCtrl;
+    const Int vHeight = ( wantV ? n : 0 );
+    mpi::Comm comm = A.RowComm();
+    const int commSize = A.RowStride();
+    const int commRank = A.RowRank();
+
+    // Split the local columns of each process into the same number of blocks
+    const Int slotsPerProc =
+      JacobiSlotsPerProc( MaxLength(n,commSize), jacobiCtrl.blockSize );
+    const Int blocksPerProc = 2*slotsPerProc;
+    vector<JacobiBlock<F>> blocks(blocksPerProc*commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        const Int shift = Shift( q, A.RowAlign(), commSize );
+        const Int localWidth = Length( n, shift, commSize );
+        for( Int c=0; c<blocksPerProc; ++c )
+        {
+            const Int start = (c*localWidth) / blocksPerProc;
+            const Int end = ((c+1)*localWidth) / blocksPerProc;
+            auto& block = blocks[q*blocksPerProc+c];
+            for( Int jLoc=start; jLoc<end; ++jLoc )
+                block.columns.push_back( shift+jLoc*commSize );
+            if( q == commRank )
+            {
+                block.local = true;
+                block.W = A.LockedMatrix()( ALL, IR(start,end) );
+                Zeros( block.V, vHeight, end-start );
+                for( Int t=0; t<end-start; ++t )
+                    if( wantV )
+                        block.V(block.columns[t],t) = F(1);
+            }
+        }
+    }
+
+    SVDInfo info;
+    const Real tol = JacobiTolerance( m, jacobiCtrl );
+    info.numJacobiSweeps =
+      JacobiSweeps( blocks, slotsPerProc, m, vHeight, tol, jacobiCtrl, comm );
+
+    vector<Real> sigma(n,Real(0));
+    for( auto& block : blocks )
+        if( block.local )
+            for( Int t=0; t<Int(block.columns.size()); ++t )
+                sigma[block.columns[t]] = FrobeniusNorm( block.W(ALL,IR(t)) );
+    mpi::AllReduce( sigma.data(), n, comm );
+    vector<Int> positions;
+    vector<Real> sigmaSorted;
+    Int numKept;
+    JacobiSort( m, sigma, positions, sigmaSorted, numKept, ctrl.bidiagSVDCtrl );
+
+    const Real safeMin = limits::SafeMin<Real>();
+    Int rank = 0;
+    for( Int j=0; j<numKept; ++j )
+        if( sigmaSorted[j] > safeMin )
+            ++rank;
+    {
+        DistMatrix<Real,STAR,STAR> s( numKept, 1, g );
+        for( Int j=0; j<numKept; ++j )
+            s.SetLocal( j, 0, sigmaSorted[j] );
+        Copy( s, sPre );
+    }
+    if( wantU )
+    {
+        DistMatrix<F> U(g);
+        Zeros( U, m, full ? m : numKept );
+        Int numQueued = 0;
+        for( auto& block : blocks )
+            if( block.local )
+                numQueued += m*block.W.Width();
+        U.Reserve( numQueued );
+        for( auto& block : blocks )
+        {
+            if( !block.local )
+                continue;
+            for( Int t=0; t<block.W.Width(); ++t )
+            {
+                const Int j = positions[block.columns[t]];
+                if( j >= rank )
+                    continue;
+                const Real scale = Real(1) / sigmaSorted[j];
+                for( Int i=0; i<m; ++i )
+                    U.QueueUpdate( i, j, scale*block.W(i,t) );
+            }
+        }
+        U.ProcessQueues();
+        CompleteBasis( U, rank );
+        Copy( U, UPre );
+    }
+    if( wantV )
+    {
+        DistMatrix<F> V(g);
+        Zeros( V, n, numKept );
+        Int numQueued = 0;
+        for( auto& block : blocks )
+            if( block.local )
+                numQueued += n*block.V.Width();
+        V.Reserve( numQueued );
+        for( auto& block : blocks )
+        {
+            if( !block.local )
+                continue;
+            for( Int t=0; t<block.V.Width(); ++t )
+            {
+                const Int j = positions[block.columns[t]];
+                if( j >= numKept )
+                    continue;
+                for( Int i=0; i<n; ++i )
+                    V.QueueUpdate( i, j, block.V(i,t) );
+            }
+        }
+        V.ProcessQueues();
+        Copy( V, VPre );
+    }
+    return info;
+}
+
+template<typename F>
+SVDInfo Jacobi
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& s,
+        AbstractDistMatrix<F>& V,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const bool wantU = ctrl.bidiagSVDCtrl.wantU;
+    const bool wantV = ctrl.bidiagSVDCtrl.wantV;
+    const bool full = ( ctrl.bidiagSVDCtrl.approach == FULL_SVD );
+    DistMatrix<F,STAR,VR> W( A.Grid() );
+    if( A.Height() >= A.Width() )
+    {
+        Copy( A, W );
+        return JacobiTall( W, U, s, V, wantU, wantV, full, ctrl );
+    }
+    else
+    {
+        DistMatrix<F> AAdj( A.Grid() );
+        Adjoint( A, AAdj );
+        Copy( AAdj, W );
+        return JacobiTall( W, V, s, U, wantV, wantU, full, ctrl );
+    }
+}
+
+template<typename F>
+SVDInfo Jacobi
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<Base<F>>& s,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DistMatrix<F> U( A.Grid() ), V( A.Grid() );
+    auto ctrlMod( ctrl );
+    ctrlMod.bidiagSVDCtrl.wantU = false;
+    ctrlMod.bidiagSVDCtrl.wantV = false;
+    return Jacobi( A, U, s, V, ctrlMod );
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_JACOBI_HPP
@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SCHUR_COMPUTEPARTITION_HPP
+#define EL_SCHUR_COMPUTEPARTITION_HPP
+
+namespace El {
+namespace schur {
+
+template<typename F>
+ValueInt<Base<F>> ComputePartition( Matrix<F>& A )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( n == 0 ) 
+    {
+        ValueInt<Real> part;
+        part.value = -1;
+        part.index = -1;
+        return part;
+    }
+
+    // Compute the sets of row and column sums
+    vector<Real> colSums(n-1,0), rowSums(n-1,0);
+    for( Int j=0; j<n-1; ++j )
+        for( Int i=j+1; i<n; ++i )
+            colSums[j] += Abs( A(i,j) ); 
+    for( Int i=1; i<n-1; ++i )
+        for( Int j=0; j<i; ++j )
+            rowSums[i-1] += Abs( A(i,j) );
+
+    // Compute the list of norms and its minimum value/index
+    ValueInt<Real> part;
+    vector<Real> norms(n-1);
+    norms[0] = colSums[0];
+    part.value = norms[0];
+    part.index = 1;
+    for( Int j=1; j<n-1; ++j )
+    {
+        norms[j] = norms[j-1] + colSums[j] - rowSums[j-1];
+        if( norms[j] < part.value )
+        {
+            part.value = norms[j];
+            part.index = j+1;
+        }
+    }
+
+    return part;
+}
+
+// The current implementation requires O(n^2/p + n lg p) work. Since the
+// matrix-matrix multiplication alone requires O(n^3/p) work, and n <= p for
+// most practical computations, it is at least O(n^2) work, which should dwarf
+// the O(n lg p) unparallelized component of this algorithm.
+template<typename F>
+ValueInt<Base<F>> ComputePartition( DistMatrix<F>& A )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    if( n == 0 ) 
+    {
+        ValueInt<Real> part;
+        part.value = -1;
+        part.index = -1;
+        return part;
+    }
+
+    // Compute the sets of row and column sums
+    vector<Real> colSums(n-1,0), rowSums(n-1,0);
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    auto& ALoc = A.LockedMatrix();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        if( j < n-1 )
+        {
+            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                if( i > j )
+                {
+                    colSums[j] += Abs( ALoc(iLoc,jLoc) ); 
+                    rowSums[i-1] += Abs( ALoc(iLoc,jLoc) );
+                }
+            }
+        }
+    }
+    mpi::AllReduce( colSums.data(), n-1, g.VCComm() );
+    mpi::AllReduce( rowSums.data(), n-1, g.VCComm() );
+
+    // Compute the list of norms and its minimum value/index
+    // TODO: Think of the proper way to parallelize this if necessary
+    ValueInt<Real> part;
+    vector<Real> norms(n-1);
+    norms[0] = colSums[0];
+    part.value = norms[0];
+    part.index = 1;
+    for( Int j=1; j<n-1; ++j )
+    {
+        norms[j] = norms[j-1] + colSums[j] - rowSums[j-1];
+        if( norms[j] < part.value )
+        {
+            part.value = norms[j];
+            part.index = j+1;
+        }
+    }
+
+    return part;
+}
+
+} // namespace schur
+} // namespace El
+
+#endif // ifndef EL_SCHUR_COMPUTEPARTITION_HPP
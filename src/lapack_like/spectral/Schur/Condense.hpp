@@ -80,17 +80,38 @@ void Condense
     }
 }
 
+// Both the reduction to Hessenberg form and the HessenbergSchur decomposition
+// are performed on the same block-cyclic distribution so that the Hessenberg
+// matrix (and Q) need not be redistributed between the two stages
+inline ProxyCtrl HessenbergProxyCtrl( const HessenbergSchurCtrl& ctrl )
+{
+    ProxyCtrl proxyCtrl;
+    proxyCtrl.colConstrain = true;
+    proxyCtrl.rowConstrain = true;
+    proxyCtrl.blockHeight = ctrl.blockHeight;
+    proxyCtrl.blockWidth = ctrl.blockHeight;
+    proxyCtrl.colAlign = 0;
+    proxyCtrl.rowAlign = 0;
+    proxyCtrl.colCut = 0;
+    proxyCtrl.rowCut = 0;
+    return proxyCtrl;
+}
+
 template<typename F>
 void Condense
-( AbstractDistMatrix<F>& A,
+( AbstractDistMatrix<F>& APre,
   AbstractDistMatrix<Complex<Base<F>>>& w,
   const SchurCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    const Grid& grid = A.Grid();
+    const Grid& grid = APre.Grid();
     Timer timer;
 
-    // Reduce the matrix to upper-Hessenberg form in an elemental form
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK>
+      AProx( APre, HessenbergProxyCtrl(ctrl.hessSchurCtrl) );
+    auto& A = AProx.Get();
+
+    // Reduce the matrix to upper-Hessenberg form in a block-cyclic form
     if( ctrl.time && grid.Rank() == 0 )
         timer.Start();
     hessenberg::ExplicitCondensed( UPPER, A );
@@ -116,15 +137,21 @@ void Condense
 
 template<typename F>
 void Condense
-( AbstractDistMatrix<F>& A,
+( AbstractDistMatrix<F>& APre,
   AbstractDistMatrix<Complex<Base<F>>>& w,
-  AbstractDistMatrix<F>& Q,
+  AbstractDistMatrix<F>& QPre,
   const SchurCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    const Grid& grid = A.Grid();
+    const Grid& grid = APre.Grid();
     Timer timer;
 
+    const ProxyCtrl proxyCtrl = HessenbergProxyCtrl( ctrl.hessSchurCtrl );
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> AProx( APre, proxyCtrl );
+    DistMatrixWriteProxy<F,F,MC,MR,BLOCK> QProx( QPre, proxyCtrl );
+    auto& A = AProx.Get();
+    auto& Q = QProx.Get();
+
     // Reduce A to upper-Hessenberg form
     DistMatrix<F,STAR,STAR> householderScalars( A.Grid() );
     if( ctrl.time && grid.Rank() == 0 )
@@ -13,6 +13,15 @@
 // "The spectral decomposition of nonsymmetric matrices on distributed memory
 // parallel computers". Currently available at:
 // www.netlib.org/lapack/lawnspdf/lawn91.pdf
+//
+// The randomized divides instead compute the rank-revealing decomposition of
+// inv(A + B) A with only (unpivoted) QR and RQ decompositions, following the
+// high-level algorithm of G. Ballard, J. Demmel, and I. Dumitriu's
+// "Communication-avoiding nonsymmetric eigensolver using spectral
+// divide & conquer". Currently available at:
+// http://parlab.eecs.berkeley.edu/sites/all/parlab/files/Communication%20Avoiding%20Nonsymmetric.pdf
+
+#include "./ComputePartition.hpp"
 
 namespace El {
 namespace schur {
@@ -166,7 +175,7 @@ int InverseFreeSign
 }
 
 template<typename F>
-Base<F> InverseFreeSignDivide( Matrix<F>& X )
+ValueInt<Base<F>> InverseFreeSignDivide( Matrix<F>& X )
 {
     DEBUG_CSE
     typedef Base<F> Real;
@@ -187,18 +196,20 @@ Base<F> InverseFreeSignDivide( Matrix<F>& X )
     // 2) [Q,R,Pi] := QRP(A)
     // 3) B := Q^H B
     // 4) [R,Q] := RQ(B)
+    // so that inv(A + B) A = Q^H (inv(R_B) R_A) Pi^T, whose range is spanned
+    // by the leading columns of Q^H
     B += A;
     Matrix<F> householderScalars;
     Matrix<Base<F>> signature;
     Permutation perm;
-    QR( A, householderScalars, signature, perm );
+    El::QR( A, householderScalars, signature, perm );
     qr::ApplyQ( LEFT, ADJOINT, A, householderScalars, signature, B );
-    RQ( B, householderScalars, signature );
+    El::RQ( B, householderScalars, signature );
 
-    // A := Q^H A Q
+    // A := Q A Q^H
     A = ACopy;
-    rq::ApplyQ( LEFT, ADJOINT, B, householderScalars, signature, A );
-    rq::ApplyQ( RIGHT, NORMAL, B, householderScalars, signature, A );
+    rq::ApplyQ( LEFT, NORMAL, B, householderScalars, signature, A );
+    rq::ApplyQ( RIGHT, ADJOINT, B, householderScalars, signature, A );
 
     // Return || E21 ||1 / || A ||1
     ValueInt<Real> part = ComputePartition( A );
@@ -237,24 +248,188 @@ ValueInt<Base<F>> InverseFreeSignDivide( AbstractDistMatrix<F>& XPre )
     DistMatrix<F,MD,STAR> householderScalars(g);
     DistMatrix<Base<F>,MD,STAR> signature(g);
     DistPermutation perm(g);
-    QR( A, householderScalars, signature, perm );
+    El::QR( A, householderScalars, signature, perm );
     qr::ApplyQ( LEFT, ADJOINT, A, householderScalars, signature, B );
-    RQ( B, householderScalars, signature );
+    El::RQ( B, householderScalars, signature );
 
-    // A := Q^H A Q
+    // A := Q A Q^H
     A = ACopy;
-    rq::ApplyQ( LEFT, ADJOINT, B, householderScalars, signature, A );
-    rq::ApplyQ( RIGHT, NORMAL, B, householderScalars, signature, A );
+    rq::ApplyQ( LEFT, NORMAL, B, householderScalars, signature, A );
+    rq::ApplyQ( RIGHT, ADJOINT, B, householderScalars, signature, A );
 
-    // Return || E21 ||1 / || A ||1
     // Return || E21 ||1 / || A ||1
     ValueInt<Real> part = ComputePartition( A );
     part.value /= OneNorm(ACopy);
     return part;
 }
 
-// TODO: RandomizedInverseFreeSignDivide which uses high-level algorithm
-//       of http://parlab.eecs.berkeley.edu/sites/all/parlab/files/Communication%20Avoiding%20Nonsymmetric.pdf
+// The Cayley transform z -> (z + s) / (z - s) maps the right and left
+// half-planes to the exterior and interior of the unit disc, and so the
+// pencil (G + s I, G - s I) splits the spectrum of G along the imaginary axis,
+// as does sgn(G). The magnitude s is chosen to be the root-mean-square
+// estimate || G ||_F / sqrt(n) of the magnitude of the eigenvalues of G so
+// that the bulk of the spectrum is not mapped close to the unit circle.
+//
+// G should be a shift (and rotation) of A. If returnQ=true, G will be set to
+// the computed unitary matrix upon exit.
+template<typename F>
+ValueInt<Base<F>> RandomizedInverseFreeSignDivide
+( Matrix<F>& A,
+  Matrix<F>& G,
+  bool returnQ,
+  const SDCCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real oneA = OneNorm( A );
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = 500*n*limits::Epsilon<Real>();
+
+    Real s = FrobeniusNorm( G ) / Sqrt(Real(Max(n,Int(1))));
+    if( s == Real(0) )
+        s = 1;
+
+    // X := [G - s I; G + s I]
+    Matrix<F> X( 2*n, n );
+    auto XB = X( IR(0,n  ), ALL );
+    auto XA = X( IR(n,2*n), ALL );
+    XB = G;
+    ShiftDiagonal( XB, F(-s) );
+    XA = G;
+    ShiftDiagonal( XA, F(s) );
+
+    // Run the inverse-free alternative to Sign and form A_p + B_p
+    const Int numIts =
+      InverseFreeSign( X, ctrl.signCtrl.maxIts, ctrl.signCtrl.tol );
+    if( ctrl.progress )
+        Output("Inverse-free iteration ran for ",numIts," iterations");
+    XB += XA;
+
+    ValueInt<Real> part;
+    Matrix<F> ACopy( A ), AP, BP, V, B, householderScalars;
+    Matrix<Base<F>> signature;
+    Int it=0;
+    while( it < ctrl.maxInnerIts )
+    {
+        // Compute the randomized URV of inv(A_p + B_p) A_p without inversion:
+        // 1) [U_1,R_1] := QR(A_p V), with V Haar-distributed
+        // 2) [R_2,U_2] := RQ(U_1^H (A_p + B_p))
+        // so that inv(A_p + B_p) A_p = U_2^H (inv(R_2) R_1) V^H.
+        AP = XA;
+        BP = XB;
+        ImplicitHaar( V, householderScalars, signature, n );
+        qr::ApplyQ( RIGHT, NORMAL, V, householderScalars, signature, AP );
+        El::QR( AP, householderScalars, signature );
+        qr::ApplyQ( LEFT, ADJOINT, AP, householderScalars, signature, BP );
+        El::RQ( BP, householderScalars, signature );
+
+        // A := U_2 A U_2^H
+        if( returnQ )
+        {
+            Identity( G, n, n );
+            rq::ApplyQ( LEFT, ADJOINT, BP, householderScalars, signature, G );
+            Gemm( ADJOINT, NORMAL, F(1), G, A, B );
+            Gemm( NORMAL, NORMAL, F(1), B, G, A );
+        }
+        else
+        {
+            rq::ApplyQ( LEFT, NORMAL, BP, householderScalars, signature, A );
+            rq::ApplyQ( RIGHT, ADJOINT, BP, householderScalars, signature, A );
+        }
+
+        // || E21 ||1 / || A ||1 and the chosen rank
+        part = ComputePartition( A );
+        part.value /= oneA;
+
+        ++it;
+        if( part.value <= tol || it == ctrl.maxInnerIts )
+            break;
+        else
+            A = ACopy;
+    }
+    return part;
+}
+
+template<typename F>
+ValueInt<Base<F>> RandomizedInverseFreeSignDivide
+( DistMatrix<F>& A,
+  DistMatrix<F>& G,
+  bool returnQ,
+  const SDCCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Real oneA = OneNorm( A );
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = 500*n*limits::Epsilon<Real>();
+
+    Real s = FrobeniusNorm( G ) / Sqrt(Real(Max(n,Int(1))));
+    if( s == Real(0) )
+        s = 1;
+
+    // X := [G - s I; G + s I]
+    DistMatrix<F> X( 2*n, n, g );
+    auto XB = X( IR(0,n  ), ALL );
+    auto XA = X( IR(n,2*n), ALL );
+    XB = G;
+    ShiftDiagonal( XB, F(-s) );
+    XA = G;
+    ShiftDiagonal( XA, F(s) );
+
+    // Run the inverse-free alternative to Sign and form A_p + B_p
+    const Int numIts =
+      InverseFreeSign( X, ctrl.signCtrl.maxIts, ctrl.signCtrl.tol );
+    if( ctrl.progress && g.Rank() == 0 )
+        Output("Inverse-free iteration ran for ",numIts," iterations");
+    XB += XA;
+
+    ValueInt<Real> part;
+    DistMatrix<F> ACopy( A ), AP(g), BP(g), V(g), B(g);
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    Int it=0;
+    while( it < ctrl.maxInnerIts )
+    {
+        // Compute the randomized URV of inv(A_p + B_p) A_p without inversion
+        AP = XA;
+        BP = XB;
+        ImplicitHaar( V, householderScalars, signature, n );
+        qr::ApplyQ( RIGHT, NORMAL, V, householderScalars, signature, AP );
+        El::QR( AP, householderScalars, signature );
+        qr::ApplyQ( LEFT, ADJOINT, AP, householderScalars, signature, BP );
+        El::RQ( BP, householderScalars, signature );
+
+        // A := U_2 A U_2^H
+        if( returnQ )
+        {
+            Identity( G, n, n );
+            rq::ApplyQ( LEFT, ADJOINT, BP, householderScalars, signature, G );
+            Gemm( ADJOINT, NORMAL, F(1), G, A, B );
+            Gemm( NORMAL, NORMAL, F(1), B, G, A );
+        }
+        else
+        {
+            rq::ApplyQ( LEFT, NORMAL, BP, householderScalars, signature, A );
+            rq::ApplyQ( RIGHT, ADJOINT, BP, householderScalars, signature, A );
+        }
+
+        // || E21 ||1 / || A ||1 and the chosen rank
+        part = ComputePartition( A );
+        part.value /= oneA;
+
+        ++it;
+        if( part.value <= tol || it == ctrl.maxInnerIts )
+            break;
+        else
+            A = ACopy;
+    }
+    return part;
+}
 
 } // namespace schur
 } // namespace El
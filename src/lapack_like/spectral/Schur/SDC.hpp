@@ -18,115 +18,12 @@
 // I. Dumitriu, and O. Holtz, "Fast linear algebra is stable", 2007.
 // www.netlib.org/lapack/lawnspdf/lawn186.pdf
 
+#include "./InverseFreeSDC.hpp"
+
 namespace El {
 
 namespace schur {
 
-template<typename F>
-ValueInt<Base<F>> ComputePartition( Matrix<F>& A )
-{
-    DEBUG_CSE
-    typedef Base<F> Real;
-    const Int n = A.Height();
-    if( n == 0 ) 
-    {
-        ValueInt<Real> part;
-        part.value = -1;
-        part.index = -1;
-        return part;
-    }
-
-    // Compute the sets of row and column sums
-    vector<Real> colSums(n-1,0), rowSums(n-1,0);
-    for( Int j=0; j<n-1; ++j )
-        for( Int i=j+1; i<n; ++i )
-            colSums[j] += Abs( A(i,j) ); 
-    for( Int i=1; i<n-1; ++i )
-        for( Int j=0; j<i; ++j )
-            rowSums[i-1] += Abs( A(i,j) );
-
-    // Compute the list of norms and its minimum value/index
-    ValueInt<Real> part;
-    vector<Real> norms(n-1);
-    norms[0] = colSums[0];
-    part.value = norms[0];
-    part.index = 1;
-    for( Int j=1; j<n-1; ++j )
-    {
-        norms[j] = norms[j-1] + colSums[j] - rowSums[j-1];
-        if( norms[j] < part.value )
-        {
-            part.value = norms[j];
-            part.index = j+1;
-        }
-    }
-
-    return part;
-}
-
-// The current implementation requires O(n^2/p + n lg p) work. Since the
-// matrix-matrix multiplication alone requires O(n^3/p) work, and n <= p for
-// most practical computations, it is at least O(n^2) work, which should dwarf
-// the O(n lg p) unparallelized component of this algorithm.
-template<typename F>
-ValueInt<Base<F>> ComputePartition( DistMatrix<F>& A )
-{
-    DEBUG_CSE
-    typedef Base<F> Real;
-    const Grid& g = A.Grid();
-    const Int n = A.Height();
-    if( n == 0 ) 
-    {
-        ValueInt<Real> part;
-        part.value = -1;
-        part.index = -1;
-        return part;
-    }
-
-    // Compute the sets of row and column sums
-    vector<Real> colSums(n-1,0), rowSums(n-1,0);
-    const Int mLocal = A.LocalHeight();
-    const Int nLocal = A.LocalWidth();
-    auto& ALoc = A.LockedMatrix();
-    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-    {
-        const Int j = A.GlobalCol(jLoc);
-        if( j < n-1 )
-        {
-            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                if( i > j )
-                {
-                    colSums[j] += Abs( ALoc(iLoc,jLoc) ); 
-                    rowSums[i-1] += Abs( ALoc(iLoc,jLoc) );
-                }
-            }
-        }
-    }
-    mpi::AllReduce( colSums.data(), n-1, g.VCComm() );
-    mpi::AllReduce( rowSums.data(), n-1, g.VCComm() );
-
-    // Compute the list of norms and its minimum value/index
-    // TODO: Think of the proper way to parallelize this if necessary
-    ValueInt<Real> part;
-    vector<Real> norms(n-1);
-    norms[0] = colSums[0];
-    part.value = norms[0];
-    part.index = 1;
-    for( Int j=1; j<n-1; ++j )
-    {
-        norms[j] = norms[j-1] + colSums[j] - rowSums[j-1];
-        if( norms[j] < part.value )
-        {
-            part.value = norms[j];
-            part.index = j+1;
-        }
-    }
-
-    return part;
-}
-
 // G should be a rational function of A. If returnQ=true, G will be set to
 // the computed unitary matrix upon exit.
 template<typename F>
@@ -382,7 +279,10 @@ SpectralDivide( Matrix<Real>& A, const SDCCtrl<Real>& ctrl )
 
         try
         {
-            if( ctrl.random )
+            if( ctrl.inverseFree )
+                part = RandomizedInverseFreeSignDivide
+                ( A, G, false, ctrl );
+            else if( ctrl.random )
                 part = RandomizedSignDivide( A, G, false, ctrl );
             else
                 part = SignDivide( A, G, false, ctrl );
@@ -452,7 +352,10 @@ SpectralDivide( Matrix<Complex<Real>>& A, const SDCCtrl<Real>& ctrl )
 
         try
         {
-            if( ctrl.random )
+            if( ctrl.inverseFree )
+                part = RandomizedInverseFreeSignDivide
+                ( A, G, false, ctrl );
+            else if( ctrl.random )
                 part = RandomizedSignDivide( A, G, false, ctrl );
             else
                 part = SignDivide( A, G, false, ctrl );
@@ -520,7 +423,10 @@ SpectralDivide
 
         try
         {
-            if( ctrl.random )
+            if( ctrl.inverseFree )
+                part = RandomizedInverseFreeSignDivide
+                ( A, Q, true, ctrl );
+            else if( ctrl.random )
                 part = RandomizedSignDivide( A, Q, true, ctrl );
             else
                 part = SignDivide( A, Q, true, ctrl );
@@ -593,7 +499,10 @@ SpectralDivide
 
         try
         {
-            if( ctrl.random )
+            if( ctrl.inverseFree )
+                part = RandomizedInverseFreeSignDivide
+                ( A, Q, true, ctrl );
+            else if( ctrl.random )
                 part = RandomizedSignDivide( A, Q, true, ctrl );
             else
                 part = SignDivide( A, Q, true, ctrl );
@@ -660,7 +569,10 @@ SpectralDivide( DistMatrix<Real>& A, const SDCCtrl<Real>& ctrl )
 
         try
         {
-            if( ctrl.random )
+            if( ctrl.inverseFree )
+                part = RandomizedInverseFreeSignDivide
+                ( A, G, false, ctrl );
+            else if( ctrl.random )
                 part = RandomizedSignDivide( A, G, false, ctrl );
             else
                 part = SignDivide( A, G, false, ctrl );
@@ -733,7 +645,10 @@ SpectralDivide( DistMatrix<Complex<Real>>& A, const SDCCtrl<Real>& ctrl )
 
         try
         {
-            if( ctrl.random )
+            if( ctrl.inverseFree )
+                part = RandomizedInverseFreeSignDivide
+                ( A, G, false, ctrl );
+            else if( ctrl.random )
                 part = RandomizedSignDivide( A, G, false, ctrl );
             else
                 part = SignDivide( A, G, false, ctrl );
@@ -803,7 +718,10 @@ SpectralDivide
 
         try
         {
-            if( ctrl.random )
+            if( ctrl.inverseFree )
+                part = RandomizedInverseFreeSignDivide
+                ( A, Q, true, ctrl );
+            else if( ctrl.random )
                 part = RandomizedSignDivide( A, Q, true, ctrl );
             else
                 part = SignDivide( A, Q, true, ctrl );
@@ -879,7 +797,10 @@ SpectralDivide
 
         try
         {
-            if( ctrl.random )
+            if( ctrl.inverseFree )
+                part = RandomizedInverseFreeSignDivide
+                ( A, Q, true, ctrl );
+            else if( ctrl.random )
                 part = RandomizedSignDivide( A, Q, true, ctrl );
             else
                 part = SignDivide( A, Q, true, ctrl );
@@ -1024,14 +945,17 @@ SDC
     Gemm( NORMAL, NORMAL, F(1), G, Z, QR );
 }
 
-// This routine no longer attempts to evenly assign work/process between two
+// This routine does not attempt to exactly balance the work between the two
 // teams since it was found to lead to horrendously non-square process grids
 // in practice, even when the original number of processes was a large power
-// of two. Instead, the grid is either split in half, or not split at all.
-// The choice is made based upon whether or not one subproblem requires twice
-// as much work as the other. There is a complicated calculus here that would
-// require a much more sophisticated (machine- and problem-specific) model to
-// make the 'best' splitting, but this approach should be a good compromise.
+// of two. Instead, the smaller subproblem is assigned p/2^k of the processes,
+// where 2^k is the (geometrically) closest power of two to the ratio of the
+// total work to the smaller subproblem's work, so that powers of two remain
+// so for the smaller team. Unless there is only a single process, both
+// subproblems are thus always solved concurrently on disjoint grids (rather
+// than one after the other on the full grid when the work is unbalanced),
+// and the recursion on a lopsided split only holds back the few processes
+// assigned to its smaller half.
 inline void SplitGrid
 ( int nLeft,
   int nRight,
@@ -1043,20 +967,24 @@ inline void SplitGrid
     typedef double Real;
     const Real leftWork = Pow(Real(nLeft),Real(3));
     const Real rightWork = Pow(Real(nRight),Real(3));
-    if( Max(leftWork,rightWork) > 2*Min(leftWork,rightWork) )
+    const Int p = grid.Size();
+    if( p == 1 || nLeft == 0 || nRight == 0 )
     {
         // Don't split the grid
         leftGrid = &grid;
         rightGrid = &grid;
         if( progress && grid.Rank() == 0 )
-            cout << "leftWork/rightWork=" << leftWork/rightWork 
+            cout << "p=" << p << ", nLeft=" << nLeft << ", nRight=" << nRight
                  << ", so the grid was not split" << endl;
     }
     else
     {
-        // Split the grid in half (powers-of-two remain so)
-        const Int p = grid.Size();
-        const Int pLeft = p/2;
+        const Real smallFrac =
+          Min(leftWork,rightWork) / (leftWork+rightWork);
+        Int pSmall = p/2;
+        while( pSmall > 1 && pSmall > Sqrt(Real(2))*smallFrac*p )
+            pSmall /= 2;
+        const Int pLeft = ( leftWork <= rightWork ? pSmall : p-pSmall );
         const Int pRight = p-pLeft;
         vector<int> leftRanks(pLeft), rightRanks(pRight);
         for( int j=0; j<pLeft; ++j )
@@ -22,14 +22,16 @@ namespace triang_eig {
 /*   Note: See "Robust Triangular Solves for Use in Condition
  *   Estimation" by Edward Anderson for notation and bounds.
  *   Entries in U are assumed to be less (in magnitude) than 
- *   bigNum.
+ *   bigNum. Column j of X is the eigenvector of index j+offset
+ *   relative to the beginning of the diagonal block U.
  */
 template<typename F>
 void MultiShiftDiagonalBlockSolve
 (       Matrix<F>& U,
   const Matrix<F>& shifts,
         Matrix<F>& X,
-        Matrix<F>& scales )
+        Matrix<F>& scales,
+        Int offset=0 )
 {
     DEBUG_CSE
     typedef Base<F> Real;
@@ -69,9 +71,11 @@ void MultiShiftDiagonalBlockSolve
     }
 
     // Iterate through RHS's
-    for( Int j=1; j<numShifts; ++j )
+    for( Int j=0; j<numShifts; ++j )
     {
-        const Int xHeight = Min(n,j);
+        const Int xHeight = Min(n,j+offset);
+        if( xHeight <= 0 )
+            continue;
 
         // Initialize triangular system
         // TODO: Only modify the first xHeight entries of the diagonal
@@ -426,53 +430,35 @@ void MultiShiftDiagonalBlockSolve
     SetDiagonal( ULoc, diag );
 }
 
-/*   Note: See "Robust Triangular Solves for Use in Condition
- *   Estimation" by Edward Anderson for notation and bounds.
- *   Entries in U are assumed to be less (in magnitude) than 
- *   bigNum.
- */
+// Solve for the eigenvectors [jBeg,jEnd), which are supported on the first
+// jEnd rows, given the estimates cNorms of the (averaged) infinity norms of
+// the columns of U above each diagonal block. Since only the columns
+// [jBeg,jEnd) of X, scales, and XMax are modified, and the diagonal blocks of
+// U are shifted within private copies, separate shift blocks can be solved
+// for concurrently.
 template<typename F>
-void MultiShiftSolve
-(       Matrix<F>& U,
+void ShiftBlockSolve
+( const Matrix<F>& U,
   const Matrix<F>& shifts,
         Matrix<F>& X,
-        Matrix<F>& scales ) 
+        Matrix<F>& scales,
+  const Matrix<Base<F>>& cNorms,
+        Int jBeg,
+        Int jEnd,
+        Int bsize )
 {
     DEBUG_CSE
     typedef Base<F> Real;
-
-    DEBUG_ONLY(
-      if( U.Height() != U.Width() )
-          LogicError("Triangular matrix must be square");
-      if( U.Width() != X.Height() )
-          LogicError("Matrix dimensions do not match");
-      if( shifts.Height() != X.Width() )
-          LogicError("Incompatible number of shifts");
-    )
-    const Int m = X.Height();
-    const Int n = X.Width();
-    const Int bsize = Blocksize();
-    const Int kLast = LastOffset( m, bsize );
-
     const Real oneHalf = Real(1)/Real(2);
-
     const Real underflow = limits::SafeMin<Real>();
     const Real overflow = limits::Max<Real>();
     const Real ulp = limits::Precision<Real>();
     const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
     const Real bigNum = Real(1)/smallNum;
 
-    DEBUG_ONLY(
-      if( MaxNorm(U) >= bigNum )
-          LogicError("Entries in matrix are too large");
-    )
-    
-    Ones( scales, n, 1 );
-    Matrix<F> scalesUpdate( n, 1 );
-
     // Determine largest entry of each RHS
-    Matrix<Real> XMax( n, 1 );
-    for( Int j=0; j<n; ++j )
+    Matrix<Real> XMax( jEnd-jBeg, 1 );
+    for( Int j=jBeg; j<jEnd; ++j )
     {
         auto xj = X( IR(0,j), IR(j) );
         Real xjMax = MaxNorm( xj );
@@ -484,36 +470,37 @@ void MultiShiftSolve
             scales(j) *= s;
         }
         xjMax = Max( xjMax, 2*smallNum );
-        XMax(j) = xjMax;
+        XMax(j-jBeg) = xjMax;
     }
-        
+
     // Perform block triangular solve
-    for( Int k=kLast; k>=0; k-=bsize )
+    Matrix<F> U11, scalesUpdate;
+    for( Int k=LastOffset(jEnd,bsize); k>=0; k-=bsize )
     {
-        const Int nb = Min(bsize,m-k);
+        const Int nb = Min(bsize,jEnd-k);
+        const Int jActiveBeg = Max(jBeg,k);
 
-        const Range<Int> ind0( 0,    k    ),
-                         ind1( k,    k+nb ),
-                         ind2( k+nb, END  );
+        const Range<Int> ind0( 0, k ),
+                         ind1( k, k+nb ),
+                         indActive( jActiveBeg, jEnd );
 
         auto U01 = U( ind0, ind1 );
-        auto U11 = U( ind1, ind1 );
+        auto X0 = X( ind0, indActive );
+        auto X1 = X( ind1, indActive );
+        const Int nActive = X1.Width();
 
-        // TODO: More descriptive names given exploiting upper-triangular struct
-        auto X0 = X( ind0, IR(k,END) );
-        auto X1 = X( ind1, IR(k,END) );
-        auto X2 = X( ind2, IR(k,END) );
-        const Int nActive = X0.Width();
-
-        auto shiftsActive = shifts( IR(k,END), ALL );
+        auto shiftsActive = shifts( indActive, ALL );
 
-        // Perform triangular solve on diagonal block
-        MultiShiftDiagonalBlockSolve( U11, shiftsActive, X1, scalesUpdate );
+        // Perform triangular solve on (a copy of) the diagonal block
+        U11 = U( ind1, ind1 );
+        scalesUpdate.Resize( nActive, 1 );
+        MultiShiftDiagonalBlockSolve
+        ( U11, shiftsActive, X1, scalesUpdate, jActiveBeg-k );
 
         // Apply scalings on RHS
         for( Int jActive=0; jActive<nActive; ++jActive )
         {
-            const Int j = jActive + k;
+            const Int j = jActive + jActiveBeg;
             const Real sigma = RealPart( scalesUpdate(jActive) );
             if( sigma < Real(1) )
             {
@@ -522,29 +509,20 @@ void MultiShiftSolve
                 auto x2j = X( IR(k+nb,j), IR(j) );
                 x0j *= sigma;
                 x2j *= sigma;
-                XMax(j) *= sigma;
+                XMax(j-jBeg) *= sigma;
             }
         }
 
         if( k > 0 )
         {
-
-            // Compute infinity norms of columns in U01
-            // Note: nb*cNorm is the sum of infinity norms
-            Real cNorm = 0;
-            for( Int j=0; j<nb; ++j )
-            {
-                cNorm += MaxNorm( U01(ALL,IR(j)) ) / nb;
-            }
-
             // Check for possible overflows in GEMM
             // Note: G(i+1) <= G(i) + nb*cNorm*|| X1[:,j] ||_infty
+            const Real cNorm = cNorms(k/bsize);
             for( Int jActive=0; jActive<nActive; ++jActive )
             {
-                const Int j = jActive + k;
-                // TODO: Skip first column?
+                const Int j = jActive + jActiveBeg;
                 auto xj = X( IR(0,j), IR(j) );
-                Real xjMax = XMax(j);
+                Real xjMax = XMax(j-jBeg);
                 Real X1Max = MaxNorm( X1(ALL,IR(jActive)) );
                 if( X1Max >= 1 &&
                     cNorm >= (bigNum-xjMax)/X1Max/nb )
@@ -565,7 +543,7 @@ void MultiShiftSolve
                     X1Max *= s;
                 }
                 xjMax += nb*cNorm*X1Max;
-                XMax(j) = xjMax;
+                XMax(j-jBeg) = xjMax;
             }
 
             // Update RHS with GEMM
@@ -574,6 +552,74 @@ void MultiShiftSolve
     }
 }
 
+/*   Note: See "Robust Triangular Solves for Use in Condition
+ *   Estimation" by Edward Anderson for notation and bounds.
+ *   Entries in U are assumed to be less (in magnitude) than 
+ *   bigNum.
+ */
+template<typename F>
+void MultiShiftSolve
+(       Matrix<F>& U,
+  const Matrix<F>& shifts,
+        Matrix<F>& X,
+        Matrix<F>& scales ) 
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+
+    DEBUG_ONLY(
+      if( U.Height() != U.Width() )
+          LogicError("Triangular matrix must be square");
+      if( U.Width() != X.Height() )
+          LogicError("Matrix dimensions do not match");
+      if( shifts.Height() != X.Width() )
+          LogicError("Incompatible number of shifts");
+    )
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int bsize = Blocksize();
+
+    DEBUG_ONLY(
+      const Real underflow = limits::SafeMin<Real>();
+      const Real overflow = limits::Max<Real>();
+      const Real ulp = limits::Precision<Real>();
+      const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
+      const Real bigNum = Real(1)/smallNum;
+      if( MaxNorm(U) >= bigNum )
+          LogicError("Entries in matrix are too large");
+    )
+    
+    Ones( scales, n, 1 );
+
+    // Compute infinity norms of columns in each U01
+    // Note: nb*cNorm is the sum of infinity norms
+    const Int numBlocks = (m+bsize-1) / bsize;
+    Matrix<Real> cNorms( numBlocks, 1 );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int k = b*bsize;
+        const Int nb = Min(bsize,m-k);
+        cNorms(b) = 0;
+        for( Int j=k; j<k+nb; ++j )
+            cNorms(b) += MaxNorm( U(IR(0,k),IR(j)) ) / nb;
+    }
+
+    // Since the eigenvectors are independent, each block of shifts can be
+    // solved for separately, and the most expensive (right-most) blocks are
+    // started first
+    const Int numShiftBlocks = (n+bsize-1) / bsize;
+#ifdef EL_HYBRID
+    #pragma omp parallel for schedule(dynamic)
+#endif
+    for( Int t=0; t<numShiftBlocks; ++t )
+    {
+        const Int b = numShiftBlocks-1-t;
+        const Int jBeg = b*bsize;
+        const Int jEnd = Min(jBeg+bsize,n);
+        ShiftBlockSolve( U, shifts, X, scales, cNorms, jBeg, jEnd, bsize );
+    }
+}
+
 template<typename F>
 void MultiShiftSolve
 ( const ElementalMatrix<F>& UPre, 
@@ -615,11 +661,68 @@ void MultiShiftSolve
     DistMatrix<F,VR,  STAR> scalesUpdate_VR_STAR(g);
     DistMatrix<F,MR,  STAR> scalesUpdate_MR_STAR(g);
 
+    const Real oneHalf = Real(1)/Real(2);
+    const Real underflow = limits::SafeMin<Real>();
+    const Real overflow = limits::Max<Real>();
+    const Real ulp = limits::Precision<Real>();
+    const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
+    const Real bigNum = Real(1)/smallNum;
+
     Ones( scales, n, 1 );
     scalesUpdate_VR_STAR.Resize( n, 1 );
 
-    // TODO: Intitialize XMax with the largest entry of each RHS
-    // TODO: Rescale X if any of the columns are too large
+    // Compute infinity norms of the columns of U above their diagonal blocks
+    // Note: nb*cNorms(k/bsize) is the sum of infinity norms of U01
+    DistMatrix<Real,MR,STAR> UColMax(g);
+    UColMax.AlignWith( U );
+    Zeros( UColMax, m, 1 );
+    auto& UColMaxLoc = UColMax.Matrix();
+    const Int ULocalHeight = U.LocalHeight();
+    const Int ULocalWidth = U.LocalWidth();
+    for( Int jLoc=0; jLoc<ULocalWidth; ++jLoc )
+    {
+        const Int k = (U.GlobalCol(jLoc)/bsize)*bsize;
+        for( Int iLoc=0; iLoc<ULocalHeight; ++iLoc )
+            if( U.GlobalRow(iLoc) < k )
+                UColMaxLoc(jLoc) =
+                  Max( UColMaxLoc(jLoc), Abs(U.GetLocal(iLoc,jLoc)) );
+    }
+    mpi::AllReduce
+    ( UColMaxLoc.Buffer(), UColMax.LocalHeight(), mpi::MAX, U.ColComm() );
+    DistMatrix<Real,STAR,STAR> UColMax_STAR_STAR( UColMax );
+    const Int numBlocks = (m+bsize-1) / bsize;
+    Matrix<Real> cNorms( numBlocks, 1 );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int k = b*bsize;
+        const Int nb = Min(bsize,m-k);
+        cNorms(b) = 0;
+        for( Int j=k; j<k+nb; ++j )
+            cNorms(b) += UColMax_STAR_STAR.GetLocal(j,0) / nb;
+    }
+
+    // Determine largest entry of each RHS, rescaling any which are too large
+    DistMatrix<Real,MR,STAR> XMax(g);
+    XMax.AlignWith( X );
+    ColumnMaxNorms( X, XMax );
+    DistMatrix<F,MR,STAR> XScales(g);
+    XScales.AlignWith( X );
+    Ones( XScales, n, 1 );
+    auto& XMaxLoc = XMax.Matrix();
+    auto& XScalesLoc = XScales.Matrix();
+    const Int XLocalWidth = X.LocalWidth();
+    for( Int jLoc=0; jLoc<XLocalWidth; ++jLoc )
+    {
+        if( XMaxLoc(jLoc) >= bigNum )
+        {
+            const Real s = oneHalf*bigNum/XMaxLoc(jLoc);
+            XScalesLoc(jLoc) = s;
+            XMaxLoc(jLoc) *= s;
+            blas::Scal( X.LocalHeight(), s, X.Buffer(0,jLoc), 1 );
+        }
+        XMaxLoc(jLoc) = Max( XMaxLoc(jLoc), 2*smallNum );
+    }
+    DiagonalScale( LEFT, NORMAL, XScales, scales );
 
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -653,6 +756,8 @@ void MultiShiftSolve
         X1 = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
 
         // Apply scalings on RHS
+        auto XMaxActive = XMax( IR(k,END), ALL );
+        auto& XMaxActiveLoc = XMaxActive.Matrix();
         scalesUpdate_MR_STAR.AlignWith( X1 );
         scalesUpdate_MR_STAR = scalesUpdate_VR_STAR;
         auto& scalesUpdateLoc = scalesUpdate_MR_STAR.Matrix();
@@ -667,8 +772,7 @@ void MultiShiftSolve
                 ( X0.LocalHeight(), sigma, X0.Buffer(0,jActiveLoc), 1 );
                 blas::Scal
                 ( X2.LocalHeight(), sigma, X2.Buffer(0,jActiveLoc), 1 );
-
-                // TODO: Update XMax
+                XMaxActiveLoc(jActiveLoc) *= sigma;
             }
             else
             {
@@ -682,8 +786,43 @@ void MultiShiftSolve
 
         if( k > 0 )
         {
-            // TODO: Compute infinity norms of columns in U01
-            // TODO: Check for possible overflows in GEMM
+            // Check for possible overflows in GEMM
+            // Note: G(i+1) <= G(i) + nb*cNorm*|| X1[:,j] ||_infty
+            // Since X1[* ,MR] holds entire columns, each process can
+            // compute the same scalings for its local columns.
+            const Real cNorm = cNorms(k/bsize);
+            Ones( scalesUpdate_MR_STAR, scalesUpdate_MR_STAR.Height(), 1 );
+            for( Int jActiveLoc=0; jActiveLoc<X1LocalWidth; ++jActiveLoc )
+            {
+                Real xjMax = XMaxActiveLoc(jActiveLoc);
+                Real X1Max = 0;
+                for( Int i=0; i<nb; ++i )
+                    X1Max =
+                      Max( X1Max, Abs(X1_STAR_MR.GetLocal(i,jActiveLoc)) );
+                Real s = 1;
+                if( X1Max >= 1 &&
+                    cNorm >= (bigNum-xjMax)/X1Max/nb )
+                    s = oneHalf/(X1Max*nb);
+                else if( X1Max < 1 &&
+                         cNorm*X1Max >= (bigNum-xjMax)/nb )
+                    s = oneHalf/nb;
+                if( s < Real(1) )
+                {
+                    scalesUpdateLoc(jActiveLoc) = s;
+                    blas::Scal
+                    ( X0.LocalHeight(), s, X0.Buffer(0,jActiveLoc), 1 );
+                    blas::Scal
+                    ( X1.LocalHeight(), s, X1.Buffer(0,jActiveLoc), 1 );
+                    blas::Scal
+                    ( X2.LocalHeight(), s, X2.Buffer(0,jActiveLoc), 1 );
+                    blas::Scal
+                    ( nb, s, X1_STAR_MR.Buffer(0,jActiveLoc), 1 );
+                    xjMax *= s;
+                    X1Max *= s;
+                }
+                XMaxActiveLoc(jActiveLoc) = xjMax + nb*cNorm*X1Max;
+            }
+            DiagonalScale( LEFT, NORMAL, scalesUpdate_MR_STAR, scalesActive );
 
             // Update RHS with GEMM
             // X0[MC,MR] -= U01[MC,* ] X1[* ,MR]
@@ -0,0 +1,162 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace autotune {
+
+// The algorithm variants worth benchmarking for each kernel, where -1
+// denotes the kernel's default heuristic
+vector<Int> Variants( TunedKernel kernel, const Grid& g, bool tuneVariants )
+{
+    if( !tuneVariants )
+        return vector<Int>{ -1 };
+    switch( kernel )
+    {
+    case TUNE_GEMM:
+        return vector<Int>{ -1, GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_C };
+    case TUNE_TRSM:
+        return vector<Int>{ -1, TRSM_LARGE, TRSM_MEDIUM };
+    case TUNE_HERMITIAN_TRIDIAG:
+        // The default already uses the square algorithm on square grids
+        if( g.Height() == g.Width() )
+            return vector<Int>{ -1, HERMITIAN_TRIDIAG_NORMAL };
+        else
+            return vector<Int>
+              { HERMITIAN_TRIDIAG_NORMAL, HERMITIAN_TRIDIAG_SQUARE };
+    default:
+        return vector<Int>{ -1 };
+    }
+}
+
+// Generates a fresh problem, then returns the time (on the slowest process)
+// of running the kernel on it
+double Run( TunedKernel kernel, Int n, const Grid& g )
+{
+    DEBUG_CSE
+    DistMatrix<double> A(g), B(g), C(g);
+    if( kernel == TUNE_CHOLESKY )
+    {
+        // Make A Hermitian and strictly diagonally dominant
+        Uniform( A, n, n );
+        MakeSymmetric( LOWER, A );
+        ShiftDiagonal( A, 2.*n );
+    }
+    else if( kernel == TUNE_HERMITIAN_TRIDIAG )
+    {
+        Uniform( A, n, n );
+        MakeSymmetric( LOWER, A );
+    }
+    else if( kernel == TUNE_TRSM )
+    {
+        // Keep the triangle of A well-conditioned
+        Uniform( A, n, n );
+        ShiftDiagonal( A, 2.*n );
+        Uniform( B, n, n );
+    }
+    else
+    {
+        Uniform( A, n, n );
+        if( kernel == TUNE_GEMM )
+        {
+            Uniform( B, n, n );
+            Zeros( C, n, n );
+        }
+    }
+
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    switch( kernel )
+    {
+    case TUNE_CHOLESKY:
+        Cholesky( LOWER, A );
+        break;
+    case TUNE_LU:
+    {
+        DistPermutation P(g);
+        LU( A, P );
+        break;
+    }
+    case TUNE_QR:
+    {
+        DistMatrix<double,MD,STAR> householderScalars(g), signature(g);
+        QR( A, householderScalars, signature );
+        break;
+    }
+    case TUNE_HERMITIAN_TRIDIAG:
+    {
+        DistMatrix<double,STAR,STAR> householderScalars(g);
+        HermitianTridiagCtrl<double> ctrl;
+        ctrl.approach = HERMITIAN_TRIDIAG_DEFAULT;
+        HermitianTridiag( LOWER, A, householderScalars, ctrl );
+        break;
+    }
+    case TUNE_TRSM:
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, 1., A, B );
+        break;
+    case TUNE_GEMM:
+        Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+        break;
+    default:
+        LogicError("Invalid tuned kernel");
+    }
+    mpi::Barrier( g.Comm() );
+    return mpi::AllReduce( timer.Stop(), mpi::MAX, g.Comm() );
+}
+
+} // namespace autotune
+
+TuningEntry Autotune
+( TunedKernel kernel, Int n, const Grid& g, const AutotuneCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.blocksizes.empty() )
+        LogicError("No candidate blocksizes were provided");
+    if( ctrl.numReps < 1 )
+        LogicError("At least one repetition is required");
+    const bool amRoot = ( g.Rank() == 0 );
+    const int gridHeight = g.Height();
+    const int gridWidth = g.Width();
+
+    // Each candidate is timed by inserting it into the tuning table so that
+    // the kernel's own lookups select it
+    TuningEntry best;
+    best.seconds = -1;
+    const auto variants =
+      autotune::Variants( kernel, g, ctrl.tuneVariants );
+    for( const Int variant : variants )
+    {
+        for( const Int blocksize : ctrl.blocksizes )
+        {
+            TuningEntry candidate;
+            candidate.blocksize = blocksize;
+            candidate.variant = variant;
+            SetTuning( kernel, gridHeight, gridWidth, n, candidate );
+
+            double seconds = std::numeric_limits<double>::max();
+            for( Int rep=0; rep<ctrl.numReps; ++rep )
+                seconds = Min( seconds, autotune::Run( kernel, n, g ) );
+            candidate.seconds = seconds;
+            if( ctrl.progress && amRoot )
+                Output
+                (TunedKernelName(kernel)," (n=",n,", grid=",gridHeight,"x",
+                 gridWidth,"): blocksize=",blocksize,", variant=",variant,
+                 ": ",seconds," seconds");
+            if( best.seconds < 0 || seconds < best.seconds )
+                best = candidate;
+        }
+    }
+
+    SetTuning( kernel, gridHeight, gridWidth, n, best );
+    return best;
+}
+
+} // namespace El
@@ -103,6 +103,12 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     DEBUG_CSE
+#ifndef EL_HAVE_PARMETIS
+    // Rather than gathering the graph onto a single process, fall back to
+    // the native multilevel bisection for non-sequential partitions
+    if( !ctrl.sequential )
+        return MultilevelBisect( graph, child, perm, onLeft, ctrl );
+#endif
 #ifdef EL_HAVE_METIS
     mpi::Comm comm = graph.Comm();
     const int commSize = mpi::Size( comm );
@@ -360,74 +366,69 @@ void BuildChildrenFromPerm
   Int rightChildSize, Graph& rightChild )
 {
     DEBUG_CSE
-    DEBUG_ONLY(
-      const Int sepSize = graph.NumSources() - leftChildSize - rightChildSize;
-    )
     const Int numSources = graph.NumSources();
     const Int numTargets = graph.NumTargets();
+    DEBUG_ONLY(
+      const Int sepSize = numSources - leftChildSize - rightChildSize;
+    )
 
     // Build the inverse permutation
     vector<Int> invPerm( numSources );
     for( Int i=0; i<numSources; ++i )
         invPerm[perm[i]] = i;
 
-    // Get an upper bound on the number of edges in the child graphs
-    Int leftChildUpperBound=0, rightChildUpperBound=0;
-    for( Int s=0; s<leftChildSize; ++s )
-        leftChildUpperBound += graph.NumConnections( invPerm[s] );
-    for( Int s=0; s<rightChildSize; ++s )
-        rightChildUpperBound += 
-            graph.NumConnections( invPerm[s+leftChildSize] );
-
-    // Build the left child's graph
-    leftChild.Resize( leftChildSize, numTargets );
-    leftChild.Reserve( leftChildUpperBound );
-    for( Int s=0; s<leftChildSize; ++s )
-    {
-        const Int source = s;
-        const Int invSource = invPerm[s];
-        const Int off = graph.SourceOffset( invSource );
-        const Int numConnections = graph.NumConnections( invSource );
-        for( Int t=0; t<numConnections; ++t )
-        {
-            const Int invTarget = graph.Target( off+t );
-            const Int target = ( invTarget < numSources ? 
-                                 perm[invTarget] :
-                                 invTarget );
-            DEBUG_ONLY(
-              if( target >= leftChildSize && target < (numSources-sepSize) )
-                  LogicError("Invalid bisection, left set touches right set at (",source,",",target,") since leftChildSize=",leftChildSize);
-            )
-            leftChild.QueueConnection( source, target );
-        }
-    }
-    leftChild.ProcessQueues();
-
-    // Build the right child's graph
-    rightChild.Resize( rightChildSize, numTargets-leftChildSize );
-    rightChild.Reserve( rightChildUpperBound );
-    for( Int s=0; s<rightChildSize; ++s )
-    {
-        const Int source = s+leftChildSize;
-        const Int invSource = invPerm[source];
-        const Int off = graph.SourceOffset( invSource );
-        const Int numConnections = graph.NumConnections( invSource );
-        for( Int t=0; t<numConnections; ++t )
+    // Each row of a child is the permutation of a row of the parent, and so
+    // the rows are written directly into the children's buffers (in order),
+    // with only the targets within each row requiring sorting
+    auto buildChild =
+      [&]( Int firstSource, Int childSize, Graph& child )
+      {
+        Int numChildEdges=0;
+        for( Int s=0; s<childSize; ++s )
+            numChildEdges += graph.NumConnections( invPerm[s+firstSource] );
+        child.Resize( childSize, numTargets-firstSource );
+        child.ForceNumEdges( numChildEdges );
+        Int* sourceBuf = child.SourceBuffer();
+        Int* targetBuf = child.TargetBuffer();
+        Int childOff=0;
+        for( Int s=0; s<childSize; ++s )
         {
-            const Int invTarget = graph.Target( off+t );
-            const Int target = ( invTarget < numSources ?
-                                 perm[invTarget] :
-                                 invTarget );
-            DEBUG_ONLY(
-              if( target < leftChildSize )
-                  LogicError("Invalid bisection, right set touches left set at (",source,",",target,") since leftChildSize=",leftChildSize);
-            )
-            // The targets that are in parent separators do not need to be
-            rightChild.QueueConnection
-            ( source-leftChildSize, target-leftChildSize );
+            const Int source = s+firstSource;
+            const Int invSource = invPerm[source];
+            const Int off = graph.SourceOffset( invSource );
+            const Int numConnections = graph.NumConnections( invSource );
+            for( Int t=0; t<numConnections; ++t )
+            {
+                const Int invTarget = graph.Target( off+t );
+                const Int target = ( invTarget < numSources ? 
+                                     perm[invTarget] :
+                                     invTarget );
+                DEBUG_ONLY(
+                  if( firstSource == 0 && target >= leftChildSize &&
+                      target < (numSources-sepSize) )
+                      LogicError
+                      ("Invalid bisection, left set touches right set at (",
+                       source,",",target,") since leftChildSize=",
+                       leftChildSize);
+                  if( firstSource != 0 && target < leftChildSize )
+                      LogicError
+                      ("Invalid bisection, right set touches left set at (",
+                       source,",",target,") since leftChildSize=",
+                       leftChildSize);
+                )
+                // The targets that are in parent separators are kept
+                sourceBuf[childOff+t] = s;
+                targetBuf[childOff+t] = target-firstSource;
+            }
+            std::sort
+            ( targetBuf+childOff, targetBuf+childOff+numConnections );
+            childOff += numConnections;
         }
-    }
-    rightChild.ProcessQueues();
+        child.ComputeSourceOffsets();
+        child.ForceConsistency();
+      };
+    buildChild( 0, leftChildSize, leftChild );
+    buildChild( leftChildSize, rightChildSize, rightChild );
 }
 
 void BuildChildFromPerm
@@ -470,134 +471,57 @@ void BuildChildFromPerm
     if( rightTeamBlocksize*rightTeamSize < rightChildSize )
         ++rightTeamBlocksize;
 
-    // Count how many rows we must send to each process 
-    vector<int> rowSendSizes( commSize, 0 );
-    for( Int s=0; s<numLocalSources; ++s )
-    {
-        const Int i = perm.GetLocal(s);
+    // Each row is packed as its (permuted) source index, its number of
+    // connections, and then its (unpermuted) targets, so that a single
+    // exchange suffices
+    auto rowOwner = [&]( Int i ) -> int
+      {
         if( i < leftChildSize )
-        {
-            const int q = leftTeamOff + i / leftTeamBlocksize;
-            ++rowSendSizes[q];
-        }
+            return leftTeamOff + i / leftTeamBlocksize;
         else if( i < leftChildSize+rightChildSize )
-        {
-            const int q = rightTeamOff + (i-leftChildSize) / rightTeamBlocksize;
-            ++rowSendSizes[q];
-        }
-    }
-
-    // Exchange the number of rows
-    vector<int> rowRecvSizes( commSize );
-    mpi::AllToAll( rowSendSizes.data(), 1, rowRecvSizes.data(), 1, comm );
-
-    // Prepare for the AllToAll to exchange the row indices and 
-    // the number of column indices per row
-    vector<int> rowSendOffs, rowRecvOffs;
-    const int numSendRows = Scan( rowSendSizes, rowSendOffs );
-    const int numRecvRows = Scan( rowRecvSizes, rowRecvOffs );
-
-    // Pack the row indices and how many column entries there will be per row
-    vector<Int> rowSendLengths( numSendRows );
-    vector<Int> rowSendInds( numSendRows );
-    auto offs = rowSendOffs;
+            return rightTeamOff + (i-leftChildSize) / rightTeamBlocksize;
+        else
+            return -1;
+      };
+    vector<int> sendSizes( commSize, 0 );
     for( Int s=0; s<numLocalSources; ++s )
     {
-        const Int i = perm.GetLocal(s);
-        if( i < leftChildSize )
-        {
-            const int q = leftTeamOff + i / leftTeamBlocksize;
-            rowSendInds[offs[q]] = i;
-            rowSendLengths[offs[q]] = graph.NumConnections( s );
-            ++offs[q];
-        }
-        else if( i < leftChildSize+rightChildSize )
-        {
-            const int q = rightTeamOff + (i-leftChildSize) / rightTeamBlocksize;
-            rowSendInds[offs[q]] = i;
-            rowSendLengths[offs[q]] = graph.NumConnections( s );
-            ++offs[q];
-        }
+        const int q = rowOwner( perm.GetLocal(s) );
+        if( q >= 0 )
+            sendSizes[q] += 2 + graph.NumConnections( s );
     }
-
-    // Perform the row lengths exchange
-    vector<Int> rowRecvLengths( numRecvRows );
-    mpi::AllToAll
-    ( rowSendLengths.data(), rowSendSizes.data(), rowSendOffs.data(),
-      rowRecvLengths.data(), rowRecvSizes.data(), rowRecvOffs.data(), comm );
-
-    // Perform the row indices exchange
-    vector<Int> rowRecvInds( numRecvRows );
-    mpi::AllToAll
-    ( rowSendInds.data(), rowSendSizes.data(), rowSendOffs.data(),
-      rowRecvInds.data(), rowRecvSizes.data(), rowRecvOffs.data(), comm );
-    SwapClear( rowSendInds );
-
-    // Set up for sending the column indices
-    int numSendInds=0;
-    vector<int> indSendSizes( commSize, 0 ), indSendOffs(commSize);
-    for( int q=0; q<commSize; ++q )
-    {
-        const int numRows = rowSendSizes[q];
-        const int off = rowSendOffs[q];
-        for( int s=0; s<numRows; ++s )
-            indSendSizes[q] += rowSendLengths[off+s];
-
-        indSendOffs[q] = numSendInds;
-        numSendInds += indSendSizes[q];
-    }
-    SwapClear( rowSendLengths );
-    int numRecvInds=0;
-    vector<int> indRecvSizes( commSize, 0 ), indRecvOffs(commSize);
-    for( int q=0; q<commSize; ++q )
-    {
-        const int numRows = rowRecvSizes[q];
-        const int off = rowRecvOffs[q];
-        for( int s=0; s<numRows; ++s )
-            indRecvSizes[q] += rowRecvLengths[off+s];
-
-        indRecvOffs[q] = numRecvInds;
-        numRecvInds += indRecvSizes[q];
-    }
-    SwapClear( rowSendSizes );
-    SwapClear( rowSendOffs );
-
-    // Pack the indices
-    vector<Int> sendInds( numSendInds );
-    offs = indSendOffs;
+    vector<int> sendOffs;
+    const int numSend = Scan( sendSizes, sendOffs );
+    vector<Int> sendBuf( numSend );
+    auto offs = sendOffs;
     for( Int s=0; s<numLocalSources; ++s )
     {
         const Int i = perm.GetLocal(s);
-        if( i < leftChildSize )
-        {
-            const int q = leftTeamOff + i / leftTeamBlocksize;
-
-            const Int numConnections = graph.NumConnections( s );
-            const Int localEdgeOff = graph.SourceOffset( s );
-            for( Int j=0; j<numConnections; ++j )
-                sendInds[offs[q]++] = graph.Target( localEdgeOff+j );
-        }
-        else if( i < leftChildSize+rightChildSize )
-        {
-            const int q = rightTeamOff + (i-leftChildSize) / rightTeamBlocksize;
-               
-            const Int numConnections = graph.NumConnections( s );
-            const Int localEdgeOff = graph.SourceOffset( s );
-            for( Int j=0; j<numConnections; ++j )
-                sendInds[offs[q]++] = graph.Target( localEdgeOff+j );
-        }
+        const int q = rowOwner( i );
+        if( q < 0 )
+            continue;
+        const Int numConnections = graph.NumConnections( s );
+        const Int localEdgeOff = graph.SourceOffset( s );
+        sendBuf[offs[q]++] = i;
+        sendBuf[offs[q]++] = numConnections;
+        for( Int t=0; t<numConnections; ++t )
+            sendBuf[offs[q]++] = graph.Target( localEdgeOff+t );
     }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendSizes, sendOffs, comm );
+    SwapClear( sendBuf );
 
-    // Send/recv the column indices
-    vector<Int> recvInds( numRecvInds );
-    mpi::AllToAll
-    ( sendInds.data(), indSendSizes.data(), indSendOffs.data(),
-      recvInds.data(), indRecvSizes.data(), indRecvOffs.data(), comm );
-    SwapClear( sendInds );
-    SwapClear( indSendSizes );
-    SwapClear( indSendOffs );
-
-    // Get the indices after reordering
+    // Unpack the rows and get the indices after reordering
+    vector<Int> rowRecvInds, rowRecvLengths, recvInds;
+    const Int recvSize = recvBuf.size();
+    for( Int k=0; k<recvSize; )
+    {
+        rowRecvInds.push_back( recvBuf[k++] );
+        const Int numConnections = recvBuf[k++];
+        rowRecvLengths.push_back( numConnections );
+        for( Int t=0; t<numConnections; ++t )
+            recvInds.push_back( recvBuf[k++] );
+    }
+    SwapClear( recvBuf );
     perm.Translate( recvInds );
 
     // Put the connections into our new graph
@@ -612,43 +536,53 @@ void BuildChildFromPerm
     else
         child.Resize( rightChildSize, numTargets-leftChildSize );
 
-    child.Reserve( recvInds.size() );
+    // The rows arrive in an arbitrary order, so they are bucketed by their
+    // local source via a prefix sum of their lengths, and the targets of each
+    // row are then sorted in place
+    const Int shift = ( onLeft ? 0 : leftChildSize );
+    const Int childFirstLocalSource = child.FirstLocalSource();
+    const Int childNumLocalSources = child.NumLocalSources();
+    const Int numRecvRows = rowRecvInds.size();
+    vector<Int> childOffs( childNumLocalSources+1, 0 );
+    for( Int s=0; s<numRecvRows; ++s )
+    {
+        const Int sLoc = rowRecvInds[s]-shift-childFirstLocalSource;
+        childOffs[sLoc+1] = rowRecvLengths[s];
+    }
+    for( Int sLoc=0; sLoc<childNumLocalSources; ++sLoc )
+        childOffs[sLoc+1] += childOffs[sLoc];
+
+    const Int numChildEdges = recvInds.size();
+    child.ForceNumLocalEdges( numChildEdges );
+    Int* sourceBuf = child.SourceBuffer();
+    Int* targetBuf = child.TargetBuffer();
     Int off=0;
     for( Int s=0; s<numRecvRows; ++s )
     {
         const Int source = rowRecvInds[s];
         const Int numConnections = rowRecvLengths[s];
-        const Int childFirstLocalSource = child.FirstLocalSource();
+        const Int childOff = childOffs[source-shift-childFirstLocalSource];
         for( Int t=0; t<numConnections; ++t )
         {
             const Int target = recvInds[off++];
-            if( onLeft )
-            {
-                DEBUG_ONLY(
-                  if( target >= leftChildSize && 
-                      target < (numSources-sepSize) )
-                      LogicError
-                      ("Invalid bisection, left set touches right:\n",
-                       "  ",source," touches ",target," and leftChildSize=",
-                       leftChildSize);
-                )
-                child.QueueLocalConnection
-                ( source-childFirstLocalSource, target );
-            }
-            else
-            {
-                DEBUG_ONLY(
-                  if( target < leftChildSize )
-                      LogicError
-                      ("Invalid bisection, right set touches left set");
-                )
-                child.QueueLocalConnection
-                ( source-leftChildSize-childFirstLocalSource, 
-                  target-leftChildSize );
-            }
+            DEBUG_ONLY(
+              if( onLeft && target >= leftChildSize && 
+                  target < (numSources-sepSize) )
+                  LogicError
+                  ("Invalid bisection, left set touches right:\n",
+                   "  ",source," touches ",target," and leftChildSize=",
+                   leftChildSize);
+              if( !onLeft && target < leftChildSize )
+                  LogicError("Invalid bisection, right set touches left set");
+            )
+            sourceBuf[childOff+t] = source-shift;
+            targetBuf[childOff+t] = target-shift;
         }
+        std::sort
+        ( targetBuf+childOff, targetBuf+childOff+numConnections );
     }
-    child.ProcessLocalQueues();
+    child.ComputeSourceOffsets();
+    child.ForceConsistency();
 }
 
 } // namespace El
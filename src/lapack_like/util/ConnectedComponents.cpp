@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace components {
+
+inline Int FindRoot( vector<Int>& parents, Int i )
+{
+    while( parents[i] != i )
+    {
+        // Path halving
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+    return i;
+}
+
+} // namespace components
+
+Int ConnectedComponents( const Graph& graph, vector<Int>& components )
+{
+    DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    // Breadth-first searches from the (unlabeled) vertices in increasing
+    // order, so that the components are numbered by their smallest vertex
+    components.assign( numSources, -1 );
+    vector<Int> queue( numSources );
+    Int numComponents = 0;
+    for( Int root=0; root<numSources; ++root )
+    {
+        if( components[root] >= 0 )
+            continue;
+        Int head=0, tail=0;
+        queue[tail++] = root;
+        components[root] = numComponents;
+        while( head < tail )
+        {
+            const Int s = queue[head++];
+            for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+            {
+                const Int t = targetBuf[e];
+                if( t < numSources && components[t] < 0 )
+                {
+                    components[t] = numComponents;
+                    queue[tail++] = t;
+                }
+            }
+        }
+        ++numComponents;
+    }
+    return numComponents;
+}
+
+Int ConnectedComponents( const DistGraph& graph, DistMap& components )
+{
+    DEBUG_CSE
+    mpi::Comm comm = graph.Comm();
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalEdges = graph.NumLocalEdges();
+    const Int* sourceBuf = graph.LockedSourceBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    auto isLocal = [&]( Int t )
+      { return t >= firstLocalSource && t < firstLocalSource+numLocalSources; };
+
+    // Collapse the edges between local vertices with a union-find so that
+    // each local component only needs to be relabeled once per round
+    vector<Int> parents( numLocalSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        parents[s] = s;
+    vector<Int> ghosts;
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        const Int t = targetBuf[e];
+        if( t >= numSources )
+            continue;
+        if( isLocal(t) )
+        {
+            const Int sRoot =
+              components::FindRoot( parents, sourceBuf[e]-firstLocalSource );
+            const Int tRoot =
+              components::FindRoot( parents, t-firstLocalSource );
+            if( sRoot != tRoot )
+                parents[Max(sRoot,tRoot)] = Min(sRoot,tRoot);
+        }
+        else
+            ghosts.push_back( t );
+    }
+    vector<Int> roots( numLocalSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        roots[s] = components::FindRoot( parents, s );
+    SwapClear( parents );
+
+    // The labels of the non-local neighbors are exchanged in each round using
+    // a plan which is formed once
+    std::sort( ghosts.begin(), ghosts.end() );
+    ghosts.erase( std::unique( ghosts.begin(), ghosts.end() ), ghosts.end() );
+    vector<Int> ghostEdges, ghostSlots;
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        const Int t = targetBuf[e];
+        if( t < numSources && !isLocal(t) )
+        {
+            ghostEdges.push_back( sourceBuf[e]-firstLocalSource );
+            ghostSlots.push_back
+            ( std::lower_bound( ghosts.begin(), ghosts.end(), t ) -
+              ghosts.begin() );
+        }
+    }
+    const Int numGhostEdges = ghostEdges.size();
+
+    // Iteratively replace each label with the minimum over its neighbors
+    // until a global fixed point is reached, at which point each vertex is
+    // labeled by the smallest vertex of its component
+    components.SetComm( comm );
+    components.Resize( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        components.SetLocal( s, firstLocalSource+s );
+    DistMapTranslationPlan plan;
+    components.FormTranslationPlan( ghosts, plan );
+    vector<Int> ghostLabels, rootLabels( numLocalSources );
+    while( true )
+    {
+        ghostLabels = ghosts;
+        components.Translate( ghostLabels, plan );
+
+        for( Int s=0; s<numLocalSources; ++s )
+            rootLabels[s] = components.GetLocal(s);
+        for( Int s=0; s<numLocalSources; ++s )
+            rootLabels[roots[s]] =
+              Min( rootLabels[roots[s]], components.GetLocal(s) );
+        for( Int k=0; k<numGhostEdges; ++k )
+        {
+            const Int root = roots[ghostEdges[k]];
+            rootLabels[root] =
+              Min( rootLabels[root], ghostLabels[ghostSlots[k]] );
+        }
+
+        Int changed = 0;
+        for( Int s=0; s<numLocalSources; ++s )
+        {
+            const Int label = rootLabels[roots[s]];
+            if( label < components.GetLocal(s) )
+            {
+                components.SetLocal( s, label );
+                changed = 1;
+            }
+        }
+        if( !mpi::AllReduce( changed, mpi::MAX, comm ) )
+            break;
+    }
+    SwapClear( ghostLabels );
+    SwapClear( rootLabels );
+
+    // Number the components by their smallest vertex
+    Int numLocalRoots = 0;
+    for( Int s=0; s<numLocalSources; ++s )
+        if( components.GetLocal(s) == firstLocalSource+s )
+            ++numLocalRoots;
+    const Int numComponents = mpi::AllReduce( numLocalRoots, comm );
+    Int component = mpi::Scan( numLocalRoots, comm ) - numLocalRoots;
+    DistMap rootComponents( numSources, comm );
+    for( Int s=0; s<numLocalSources; ++s )
+    {
+        if( components.GetLocal(s) == firstLocalSource+s )
+            rootComponents.SetLocal( s, component++ );
+        else
+            rootComponents.SetLocal( s, -1 );
+    }
+    rootComponents.Extend( components );
+    return numComponents;
+}
+
+} // namespace El
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include <algorithm>
+
 namespace El {
 
 template<typename Real,typename>
@@ -29,7 +31,8 @@ ValueInt<Real> Median( const Matrix<Real>& x )
         pairs[i].value = xBuffer[i*stride];
         pairs[i].index = i;
     }
-    std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
+    std::nth_element
+    ( pairs.begin(), pairs.begin()+k/2, pairs.end(), ValueInt<Real>::Lesser );
 
     return pairs[k/2];
 }
@@ -42,10 +45,94 @@ ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
     {
         return Median( x.LockedMatrix() );
     }
+
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("Median is meant for a single vector");
+    const Int k = ( n==1 ? m : n );
+    if( k == 0 )
+        LogicError("Median of an empty vector is undefined");
+
+    // Assign each entry of the vector to exactly one process
+    const Grid& g = x.Grid();
+    mpi::Comm comm = g.VCComm();
+    vector<ValueInt<Real>> pairs;
+    if( n == 1 )
+    {
+        DistMatrix<Real,VC,STAR> x_VC_STAR( x );
+        const Int mLocal = x_VC_STAR.LocalHeight();
+        pairs.resize( mLocal );
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        {
+            pairs[iLoc].value = x_VC_STAR.GetLocal(iLoc,0);
+            pairs[iLoc].index = x_VC_STAR.GlobalRow(iLoc);
+        }
+    }
     else
     {
-        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
-        return Median( x_STAR_STAR.LockedMatrix() );
+        DistMatrix<Real,STAR,VR> x_STAR_VR( x );
+        const Int nLocal = x_STAR_VR.LocalWidth();
+        pairs.resize( nLocal );
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        {
+            pairs[jLoc].value = x_STAR_VR.GetLocal(0,jLoc);
+            pairs[jLoc].index = x_STAR_VR.GlobalCol(jLoc);
+        }
+    }
+
+    // Run a distributed quickselect for the entry of rank k/2, breaking ties
+    // in value by the index so that each pivot splits the remaining entries
+    Int numActive = k;
+    Int target = k/2;
+    while( true )
+    {
+        // Draw a uniformly random pivot from the remaining entries
+        const Int numLocal = pairs.size();
+        const Int localOff = mpi::Scan( numLocal, mpi::SUM, comm ) - numLocal;
+        Int pivotRank = 0;
+        if( mpi::Rank(comm) == 0 )
+            pivotRank = SampleUniform<Int>( 0, numActive );
+        mpi::Broadcast( pivotRank, 0, comm );
+        ValueInt<Real> pivot;
+        pivot.value = 0;
+        pivot.index = 0;
+        if( pivotRank >= localOff && pivotRank < localOff+numLocal )
+            pivot = pairs[pivotRank-localOff];
+        pivot.value = mpi::AllReduce( pivot.value, mpi::SUM, comm );
+        pivot.index = mpi::AllReduce( pivot.index, mpi::SUM, comm );
+
+        auto lesser = [&]( const ValueInt<Real>& alpha )
+          {
+              return alpha.value < pivot.value ||
+                     (alpha.value == pivot.value && alpha.index < pivot.index);
+          };
+        auto mid = std::partition( pairs.begin(), pairs.end(), lesser );
+        const Int numLocalLesser = mid - pairs.begin();
+        const Int numLesser = mpi::AllReduce( numLocalLesser, mpi::SUM, comm );
+        if( target < numLesser )
+        {
+            pairs.erase( mid, pairs.end() );
+            numActive = numLesser;
+        }
+        else if( target == numLesser )
+        {
+            return pivot;
+        }
+        else
+        {
+            // Keep the entries after the pivot
+            pairs.erase( pairs.begin(), mid );
+            auto pivotIt =
+              std::find_if
+              ( pairs.begin(), pairs.end(),
+                [&]( const ValueInt<Real>& alpha )
+                { return alpha.index == pivot.index; } );
+            if( pivotIt != pairs.end() )
+                pairs.erase( pivotIt );
+            target -= numLesser+1;
+            numActive -= numLesser+1;
+        }
     }
 }
 
@@ -0,0 +1,774 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <random>
+#include <set>
+
+// A native multilevel vertex bisection of a distributed graph in the spirit of
+//
+//   George Karypis and Vipin Kumar,
+//   "A parallel algorithm for multilevel graph partitioning and sparse matrix
+//    ordering",
+//   J. Parallel Distrib. Comput., Vol. 48, No. 1, pp. 71--95, 1998.
+//
+// The graph is coarsened with heavy-edge matchings which are restricted to
+// pairs of vertices owned by the same process, so that each coarse vertex
+// lives on the process owning its constituents and projecting a partition
+// to a finer level does not require any communication. The coarsest graph
+// is gathered and every process computes a separator from graph growing
+// followed by vertex-separator Fiduccia-Mattheyses refinement (with its own
+// seed), and the best is projected back through the levels. Each finer level
+// is refined with rounds of parallel greedy moves of separator vertices into
+// a single side at a time, which keeps the separator valid even though the
+// moves on different processes are concurrent.
+
+namespace El {
+
+namespace {
+
+const int LEFT_PART = 0;
+const int RIGHT_PART = 1;
+const int SEP_PART = 2;
+
+// Each process owns the contiguous range [vtxDist[rank],vtxDist[rank+1]) of
+// vertices, whose edges are stored in compressed rows with global targets.
+// The targets are also translated into 'slots', which index into arrays
+// holding the values of the local vertices followed by those of the ghosts.
+struct MultilevelGraph
+{
+    vector<Int> vtxDist;
+    Int firstLocal, numLocal;
+
+    vector<Int> offsets, targets, slots, edgeWeights;
+    // NOTE: This is extended with the weights of the ghost vertices
+    vector<Int> vertWeights;
+
+    // The sorted ghost vertices and the metadata for pulling their values
+    vector<Int> ghosts;
+    vector<int> ghostSizes, ghostOffs;
+    vector<int> sendSizes, sendOffs;
+    vector<Int> sendInds;
+};
+
+inline int Owner( const vector<Int>& vtxDist, Int i )
+{ return int(std::upper_bound(vtxDist.begin(),vtxDist.end(),i)-
+             vtxDist.begin()) - 1; }
+
+// Fill the ghost values of 'vals' from those owned by the other processes
+void PullGhosts
+( const MultilevelGraph& G, vector<Int>& vals, mpi::Comm comm )
+{
+    DEBUG_CSE
+    vector<Int> sendVals( G.sendInds.size() );
+    for( size_t k=0; k<G.sendInds.size(); ++k )
+        sendVals[k] = vals[G.sendInds[k]];
+    mpi::AllToAll
+    ( sendVals.data(), G.sendSizes.data(), G.sendOffs.data(),
+      vals.data()+G.numLocal, G.ghostSizes.data(), G.ghostOffs.data(),
+      comm );
+}
+
+void SetupGhosts( MultilevelGraph& G, mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const Int lastLocal = G.firstLocal + G.numLocal;
+
+    G.ghosts.clear();
+    for( const Int target : G.targets )
+        if( target < G.firstLocal || target >= lastLocal )
+            G.ghosts.push_back( target );
+    std::sort( G.ghosts.begin(), G.ghosts.end() );
+    G.ghosts.erase
+    ( std::unique(G.ghosts.begin(),G.ghosts.end()), G.ghosts.end() );
+
+    const Int numEdges = G.targets.size();
+    G.slots.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int target = G.targets[e];
+        if( target >= G.firstLocal && target < lastLocal )
+            G.slots[e] = target - G.firstLocal;
+        else
+            G.slots[e] = G.numLocal +
+              (std::lower_bound(G.ghosts.begin(),G.ghosts.end(),target)-
+               G.ghosts.begin());
+    }
+
+    // Since the ghosts are sorted, they are grouped by their owners
+    G.ghostSizes.assign( commSize, 0 );
+    for( const Int i : G.ghosts )
+        ++G.ghostSizes[Owner(G.vtxDist,i)];
+    Scan( G.ghostSizes, G.ghostOffs );
+    G.sendSizes.resize( commSize );
+    mpi::AllToAll( G.ghostSizes.data(), 1, G.sendSizes.data(), 1, comm );
+    const int numSends = Scan( G.sendSizes, G.sendOffs );
+    G.sendInds.resize( numSends );
+    mpi::AllToAll
+    ( G.ghosts.data(), G.ghostSizes.data(), G.ghostOffs.data(),
+      G.sendInds.data(), G.sendSizes.data(), G.sendOffs.data(), comm );
+    for( Int& i : G.sendInds )
+        i -= G.firstLocal;
+
+    G.vertWeights.resize( G.numLocal+G.ghosts.size() );
+    PullGhosts( G, G.vertWeights, comm );
+}
+
+void FinestGraph( const DistGraph& graph, MultilevelGraph& G )
+{
+    DEBUG_CSE
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::Size( comm );
+    const Int numSources = graph.NumSources();
+
+    G.firstLocal = graph.FirstLocalSource();
+    G.numLocal = graph.NumLocalSources();
+    vector<Int> localSizes( commSize );
+    mpi::AllGather( &G.numLocal, 1, localSizes.data(), 1, comm );
+    G.vtxDist.resize( commSize+1 );
+    G.vtxDist[0] = 0;
+    for( int q=0; q<commSize; ++q )
+        G.vtxDist[q+1] = G.vtxDist[q] + localSizes[q];
+
+    // Ignore self-connections and connections outside of the sources
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    G.offsets.resize( G.numLocal+1 );
+    G.offsets[0] = 0;
+    for( Int s=0; s<G.numLocal; ++s )
+    {
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+        {
+            const Int target = targetBuf[e];
+            if( target != G.firstLocal+s && target < numSources )
+                G.targets.push_back( target );
+        }
+        G.offsets[s+1] = G.targets.size();
+    }
+    G.edgeWeights.assign( G.targets.size(), 1 );
+    G.vertWeights.assign( G.numLocal, 1 );
+    SetupGhosts( G, comm );
+}
+
+// Returns false if a heavy-edge matching did not sufficiently shrink G
+bool Coarsen
+( const MultilevelGraph& G,
+        MultilevelGraph& GC,
+        vector<Int>& cmap,
+        Int maxVertWeight,
+        std::mt19937& gen,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numLocal = G.numLocal;
+
+    // Visit the vertices in a random order and match each with the unmatched
+    // local neighbor which it shares the heaviest edge with
+    vector<Int> order( numLocal );
+    for( Int u=0; u<numLocal; ++u )
+        order[u] = u;
+    std::shuffle( order.begin(), order.end(), gen );
+    vector<Int> match( numLocal, -1 );
+    for( const Int u : order )
+    {
+        if( match[u] != -1 )
+            continue;
+        Int best = u, bestWeight = -1;
+        for( Int e=G.offsets[u]; e<G.offsets[u+1]; ++e )
+        {
+            const Int v = G.slots[e];
+            if( v < numLocal && v != u && match[v] == -1 &&
+                G.edgeWeights[e] > bestWeight &&
+                G.vertWeights[u]+G.vertWeights[v] <= maxVertWeight )
+            {
+                best = v;
+                bestWeight = G.edgeWeights[e];
+            }
+        }
+        match[u] = best;
+        match[best] = u;
+    }
+
+    // Number the coarse vertices by the smaller index of each pair
+    cmap.resize( numLocal );
+    Int numCoarseLocal = 0;
+    for( Int u=0; u<numLocal; ++u )
+    {
+        if( match[u] < u )
+            continue;
+        cmap[u] = cmap[match[u]] = numCoarseLocal++;
+    }
+    vector<Int> coarseSizes( commSize );
+    mpi::AllGather( &numCoarseLocal, 1, coarseSizes.data(), 1, comm );
+    GC.vtxDist.resize( commSize+1 );
+    GC.vtxDist[0] = 0;
+    for( int q=0; q<commSize; ++q )
+        GC.vtxDist[q+1] = GC.vtxDist[q] + coarseSizes[q];
+    if( GC.vtxDist[commSize] > 0.95*G.vtxDist[commSize] )
+        return false;
+    GC.firstLocal = GC.vtxDist[commRank];
+    GC.numLocal = numCoarseLocal;
+
+    // Translate the targets of the neighbors (including the ghosts)
+    vector<Int> cmapExt( numLocal+G.ghosts.size() );
+    for( Int u=0; u<numLocal; ++u )
+        cmapExt[u] = cmap[u] + GC.firstLocal;
+    PullGhosts( G, cmapExt, comm );
+
+    // Merge the connections of each pair
+    GC.offsets.resize( numCoarseLocal+1 );
+    GC.offsets[0] = 0;
+    GC.vertWeights.resize( numCoarseLocal );
+    GC.targets.clear();
+    GC.edgeWeights.clear();
+    vector<pair<Int,Int>> conn;
+    Int c = 0;
+    for( Int u=0; u<numLocal; ++u )
+    {
+        if( match[u] < u )
+            continue;
+        conn.clear();
+        const Int cGlobal = GC.firstLocal + c;
+        const Int members[2] = { u, match[u] };
+        const int numMembers = ( match[u] == u ? 1 : 2 );
+        GC.vertWeights[c] = 0;
+        for( int k=0; k<numMembers; ++k )
+        {
+            const Int m = members[k];
+            GC.vertWeights[c] += G.vertWeights[m];
+            for( Int e=G.offsets[m]; e<G.offsets[m+1]; ++e )
+            {
+                const Int target = cmapExt[G.slots[e]];
+                if( target != cGlobal )
+                    conn.emplace_back( target, G.edgeWeights[e] );
+            }
+        }
+        std::sort( conn.begin(), conn.end() );
+        for( const auto& entry : conn )
+        {
+            if( Int(GC.targets.size()) > GC.offsets[c] &&
+                GC.targets.back() == entry.first )
+                GC.edgeWeights.back() += entry.second;
+            else
+            {
+                GC.targets.push_back( entry.first );
+                GC.edgeWeights.push_back( entry.second );
+            }
+        }
+        GC.offsets[++c] = GC.targets.size();
+    }
+    SetupGhosts( GC, comm );
+    return true;
+}
+
+// Sequential separators of the gathered coarsest graph
+// ====================================================
+
+// Grow the left side in breadth-first order from a random vertex until it
+// holds half of the weight and then move the boundary of the right side into
+// the separator
+void GrowSeparator
+( const vector<Int>& offsets,
+  const vector<Int>& targets,
+  const vector<Int>& vertWeights,
+        vector<int>& labels,
+        std::mt19937& gen )
+{
+    DEBUG_CSE
+    const Int n = vertWeights.size();
+    Int totalWeight = 0;
+    for( Int u=0; u<n; ++u )
+        totalWeight += vertWeights[u];
+
+    labels.assign( n, RIGHT_PART );
+    if( n == 0 )
+        return;
+    vector<char> seen( n, 0 );
+    vector<Int> queue;
+    queue.reserve( n );
+    Int head=0, nextUnseen=0, leftWeight=0;
+    Int start = std::uniform_int_distribution<Int>(0,n-1)( gen );
+    while( 2*leftWeight < totalWeight )
+    {
+        if( head == Int(queue.size()) )
+        {
+            // Start on a new connected component
+            if( seen[start] )
+            {
+                while( nextUnseen < n && seen[nextUnseen] )
+                    ++nextUnseen;
+                if( nextUnseen == n )
+                    break;
+                start = nextUnseen;
+            }
+            seen[start] = 1;
+            queue.push_back( start );
+        }
+        const Int u = queue[head++];
+        labels[u] = LEFT_PART;
+        leftWeight += vertWeights[u];
+        for( Int e=offsets[u]; e<offsets[u+1]; ++e )
+        {
+            const Int v = targets[e];
+            if( !seen[v] )
+            {
+                seen[v] = 1;
+                queue.push_back( v );
+            }
+        }
+    }
+    for( Int u=0; u<n; ++u )
+    {
+        if( labels[u] != RIGHT_PART )
+            continue;
+        for( Int e=offsets[u]; e<offsets[u+1]; ++e )
+        {
+            if( labels[targets[e]] == LEFT_PART )
+            {
+                labels[u] = SEP_PART;
+                break;
+            }
+        }
+    }
+}
+
+// Vertex-separator Fiduccia-Mattheyses refinement: each pass greedily moves
+// the separator vertex of largest gain into the lighter side (pulling its
+// neighbors from the other side into the separator), locks it, and finally
+// rolls back to the smallest separator encountered during the pass
+void RefineSeparator
+( const vector<Int>& offsets,
+  const vector<Int>& targets,
+  const vector<Int>& vertWeights,
+        vector<int>& labels,
+        Int maxPartWeight,
+        Int maxPasses=10 )
+{
+    DEBUG_CSE
+    const Int n = vertWeights.size();
+    Int partWeights[3] = { 0, 0, 0 };
+    for( Int u=0; u<n; ++u )
+        partWeights[labels[u]] += vertWeights[u];
+
+    // The reduction of the separator weight from moving v into side 'to'
+    auto gain = [&]( Int v, int to )
+      {
+          Int g = vertWeights[v];
+          for( Int e=offsets[v]; e<offsets[v+1]; ++e )
+              if( labels[targets[e]] == 1-to )
+                  g -= vertWeights[targets[e]];
+          return g;
+      };
+
+    const Int maxStagnantMoves = Max( Int(50), n/100 );
+    vector<Int> keys[2];
+    keys[LEFT_PART].resize( n );
+    keys[RIGHT_PART].resize( n );
+    vector<char> queued( n ), locked( n );
+    vector<Int> touchedStamp( n, -1 ), touched, pulled;
+    vector<pair<Int,int>> moveLog;
+    Int stamp = 0;
+    for( Int pass=0; pass<maxPasses; ++pass )
+    {
+        std::set<pair<Int,Int>> queues[2];
+        auto enqueue = [&]( Int v )
+          {
+              for( int to=0; to<2; ++to )
+              {
+                  keys[to][v] = gain( v, to );
+                  queues[to].emplace( -keys[to][v], v );
+              }
+              queued[v] = 1;
+          };
+        auto dequeue = [&]( Int v )
+          {
+              if( !queued[v] )
+                  return;
+              for( int to=0; to<2; ++to )
+                  queues[to].erase( pair<Int,Int>(-keys[to][v],v) );
+              queued[v] = 0;
+          };
+        std::fill( queued.begin(), queued.end(), 0 );
+        std::fill( locked.begin(), locked.end(), 0 );
+        for( Int u=0; u<n; ++u )
+            if( labels[u] == SEP_PART )
+                enqueue( u );
+
+        moveLog.clear();
+        Int bestSepWeight = partWeights[SEP_PART];
+        Int bestImbalance = Abs(partWeights[LEFT_PART]-partWeights[RIGHT_PART]);
+        size_t bestLogSize = 0;
+        Int numStagnant = 0;
+        while( numStagnant < maxStagnantMoves )
+        {
+            // Move into the lighter side if the balance allows it
+            int to =
+              ( partWeights[LEFT_PART] < partWeights[RIGHT_PART] ?
+                LEFT_PART : RIGHT_PART );
+            Int v = -1;
+            for( int attempt=0; attempt<2; ++attempt, to=1-to )
+            {
+                if( queues[to].empty() )
+                    continue;
+                const Int cand = queues[to].begin()->second;
+                if( partWeights[to]+vertWeights[cand] <= maxPartWeight )
+                {
+                    v = cand;
+                    break;
+                }
+            }
+            if( v == -1 )
+                break;
+            const int other = 1-to;
+
+            dequeue( v );
+            locked[v] = 1;
+            moveLog.emplace_back( v, SEP_PART );
+            labels[v] = to;
+            partWeights[SEP_PART] -= vertWeights[v];
+            partWeights[to] += vertWeights[v];
+            pulled.clear();
+            for( Int e=offsets[v]; e<offsets[v+1]; ++e )
+            {
+                const Int w = targets[e];
+                if( labels[w] == other )
+                {
+                    moveLog.emplace_back( w, other );
+                    labels[w] = SEP_PART;
+                    partWeights[other] -= vertWeights[w];
+                    partWeights[SEP_PART] += vertWeights[w];
+                    pulled.push_back( w );
+                }
+            }
+
+            // Update the gains of the unlocked separator vertices which
+            // neighbor a modified vertex
+            touched.clear();
+            ++stamp;
+            auto touch = [&]( Int w )
+              {
+                  if( labels[w] == SEP_PART && !locked[w] &&
+                      touchedStamp[w] != stamp )
+                  {
+                      touchedStamp[w] = stamp;
+                      touched.push_back( w );
+                  }
+              };
+            for( Int e=offsets[v]; e<offsets[v+1]; ++e )
+                touch( targets[e] );
+            for( const Int w : pulled )
+                for( Int e=offsets[w]; e<offsets[w+1]; ++e )
+                    touch( targets[e] );
+            for( const Int w : touched )
+            {
+                dequeue( w );
+                enqueue( w );
+            }
+
+            const Int imbalance =
+              Abs(partWeights[LEFT_PART]-partWeights[RIGHT_PART]);
+            if( partWeights[SEP_PART] < bestSepWeight ||
+                (partWeights[SEP_PART] == bestSepWeight &&
+                 imbalance < bestImbalance) )
+            {
+                bestSepWeight = partWeights[SEP_PART];
+                bestImbalance = imbalance;
+                bestLogSize = moveLog.size();
+                numStagnant = 0;
+            }
+            else
+                ++numStagnant;
+        }
+
+        // Roll back to the best separator of this pass
+        while( moveLog.size() > bestLogSize )
+        {
+            const Int v = moveLog.back().first;
+            const int oldLabel = moveLog.back().second;
+            partWeights[labels[v]] -= vertWeights[v];
+            partWeights[oldLabel] += vertWeights[v];
+            labels[v] = oldLabel;
+            moveLog.pop_back();
+        }
+        if( bestLogSize == 0 )
+            break;
+    }
+}
+
+// Gather the coarsest graph on every process, compute a separator with a
+// different seed on each, and keep the best
+void CoarsestSeparator
+( const MultilevelGraph& G,
+        vector<Int>& labels,
+        Int maxPartWeight,
+        Int numTrials,
+        std::mt19937& gen,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int n = G.vtxDist[commSize];
+
+    vector<int> vertSizes( commSize ), vertOffs;
+    for( int q=0; q<commSize; ++q )
+        vertSizes[q] = G.vtxDist[q+1] - G.vtxDist[q];
+    Scan( vertSizes, vertOffs );
+    vector<Int> localDegrees( G.numLocal );
+    for( Int u=0; u<G.numLocal; ++u )
+        localDegrees[u] = G.offsets[u+1] - G.offsets[u];
+    vector<Int> vertWeights( n ), degrees( n );
+    mpi::AllGather
+    ( G.vertWeights.data(), G.numLocal,
+      vertWeights.data(), vertSizes.data(), vertOffs.data(), comm );
+    mpi::AllGather
+    ( localDegrees.data(), G.numLocal,
+      degrees.data(), vertSizes.data(), vertOffs.data(), comm );
+
+    const int numLocalEdges = G.targets.size();
+    vector<int> edgeSizes( commSize ), edgeOffs;
+    mpi::AllGather( &numLocalEdges, 1, edgeSizes.data(), 1, comm );
+    const int numEdges = Scan( edgeSizes, edgeOffs );
+    vector<Int> targets( numEdges ), offsets( n+1 );
+    mpi::AllGather
+    ( G.targets.data(), numLocalEdges,
+      targets.data(), edgeSizes.data(), edgeOffs.data(), comm );
+    offsets[0] = 0;
+    for( Int u=0; u<n; ++u )
+        offsets[u+1] = offsets[u] + degrees[u];
+
+    vector<int> trialLabels, bestLabels;
+    Int bestSepWeight = n+1;
+    for( Int trial=0; trial<numTrials; ++trial )
+    {
+        GrowSeparator( offsets, targets, vertWeights, trialLabels, gen );
+        RefineSeparator
+        ( offsets, targets, vertWeights, trialLabels, maxPartWeight );
+        Int sepWeight = 0;
+        for( Int u=0; u<n; ++u )
+            if( trialLabels[u] == SEP_PART )
+                sepWeight += vertWeights[u];
+        if( sepWeight < bestSepWeight )
+        {
+            bestSepWeight = sepWeight;
+            bestLabels = trialLabels;
+        }
+    }
+
+    // Broadcast the smallest separator (favoring the lowest rank)
+    const Int minSepWeight = mpi::AllReduce( bestSepWeight, mpi::MIN, comm );
+    const int root =
+      mpi::AllReduce
+      ( bestSepWeight==minSepWeight ? commRank : commSize, mpi::MIN, comm );
+    bestLabels.resize( n );
+    mpi::Broadcast( bestLabels.data(), n, root, comm );
+
+    labels.resize( G.numLocal+G.ghosts.size() );
+    for( Int u=0; u<G.numLocal; ++u )
+        labels[u] = bestLabels[G.firstLocal+u];
+}
+
+// Rounds of parallel greedy moves of separator vertices into one side. Since
+// only moves into side 'to' are allowed within a round, and every neighbor
+// of a moved vertex which was in the other side is pulled into the
+// separator (with a request to its owner if it is a ghost), no edge can
+// connect the two sides after the round.
+void RefineDistSeparator
+( const MultilevelGraph& G,
+        vector<Int>& labels,
+        Int maxPartWeight,
+        Int maxRounds,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const Int numLocal = G.numLocal;
+
+    vector<pair<Int,Int>> candidates;
+    vector<Int> pulledGhosts, sendInds, recvInds;
+    vector<int> sendSizes( commSize ), sendOffs;
+    vector<int> recvSizes( commSize ), recvOffs;
+    int firstTo = LEFT_PART;
+    Int numStagnantRounds = 0;
+    for( Int round=0; round<maxRounds && numStagnantRounds<2; ++round )
+    {
+        PullGhosts( G, labels, comm );
+        Int localPartWeights[3] = { 0, 0, 0 }, partWeights[3];
+        for( Int u=0; u<numLocal; ++u )
+            localPartWeights[labels[u]] += G.vertWeights[u];
+        mpi::AllReduce( localPartWeights, partWeights, 3, comm );
+        if( round == 0 )
+            firstTo =
+              ( partWeights[LEFT_PART] <= partWeights[RIGHT_PART] ?
+                LEFT_PART : RIGHT_PART );
+        const int to = ( round % 2 == 0 ? firstTo : 1-firstTo );
+        const int other = 1-to;
+        auto gain = [&]( Int v )
+          {
+              Int g = G.vertWeights[v];
+              for( Int e=G.offsets[v]; e<G.offsets[v+1]; ++e )
+                  if( labels[G.slots[e]] == other )
+                      g -= G.vertWeights[G.slots[e]];
+              return g;
+          };
+
+        // Each process may use its share of the remaining balance
+        Int budget = (maxPartWeight-partWeights[to]) / commSize;
+        candidates.clear();
+        for( Int v=0; v<numLocal; ++v )
+        {
+            if( labels[v] != SEP_PART )
+                continue;
+            const Int g = gain( v );
+            if( g > 0 )
+                candidates.emplace_back( -g, v );
+        }
+        std::sort( candidates.begin(), candidates.end() );
+
+        Int numLocalMoves = 0;
+        pulledGhosts.clear();
+        for( const auto& candidate : candidates )
+        {
+            const Int v = candidate.second;
+            if( G.vertWeights[v] > budget || gain( v ) <= 0 )
+                continue;
+            labels[v] = to;
+            budget -= G.vertWeights[v];
+            ++numLocalMoves;
+            for( Int e=G.offsets[v]; e<G.offsets[v+1]; ++e )
+            {
+                const Int w = G.slots[e];
+                if( labels[w] == other )
+                {
+                    labels[w] = SEP_PART;
+                    if( w >= numLocal )
+                        pulledGhosts.push_back( w-numLocal );
+                }
+            }
+        }
+
+        // Ask the owners of the pulled ghosts to move them into the separator
+        std::sort( pulledGhosts.begin(), pulledGhosts.end() );
+        std::fill( sendSizes.begin(), sendSizes.end(), 0 );
+        sendInds.resize( pulledGhosts.size() );
+        for( size_t k=0; k<pulledGhosts.size(); ++k )
+        {
+            sendInds[k] = G.ghosts[pulledGhosts[k]];
+            ++sendSizes[Owner(G.vtxDist,sendInds[k])];
+        }
+        Scan( sendSizes, sendOffs );
+        mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
+        const int numRecvs = Scan( recvSizes, recvOffs );
+        recvInds.resize( numRecvs );
+        mpi::AllToAll
+        ( sendInds.data(), sendSizes.data(), sendOffs.data(),
+          recvInds.data(), recvSizes.data(), recvOffs.data(), comm );
+        for( const Int i : recvInds )
+        {
+            DEBUG_ONLY(
+              if( labels[i-G.firstLocal] == to )
+                  LogicError("Pulled a vertex from the wrong side");
+            )
+            labels[i-G.firstLocal] = SEP_PART;
+        }
+
+        const Int numMoves = mpi::AllReduce( numLocalMoves, comm );
+        if( numMoves == 0 )
+            ++numStagnantRounds;
+        else
+            numStagnantRounds = 0;
+    }
+}
+
+} // anonymous namespace
+
+Int MultilevelBisect
+( const DistGraph& graph,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    if( commSize == 1 )
+        LogicError
+        ("This routine assumes at least two processes are used, "
+         "otherwise one child will be lost");
+    const Int numSources = graph.NumSources();
+
+    // Allow each side to hold up to 55% of the vertices, as with the
+    // imbalance of 1.1 passed to ParMETIS
+    const double imbalance = 1.1;
+    const Int maxPartWeight = Int(std::ceil(imbalance*numSources/2));
+    const Int coarsenTo = Max( Int(200), Int(20)*commSize );
+    const Int maxVertWeight = Max( Int(1), Int(1.5*numSources/coarsenTo) );
+    const Int maxRefineRounds = 8;
+    std::mt19937 gen( 1 + commRank );
+
+    // Coarsen
+    vector<MultilevelGraph> graphs( 1 );
+    vector<vector<Int>> cmaps;
+    FinestGraph( graph, graphs[0] );
+    while( graphs.back().vtxDist[commSize] > coarsenTo )
+    {
+        MultilevelGraph coarse;
+        vector<Int> cmap;
+        if( !Coarsen( graphs.back(), coarse, cmap, maxVertWeight, gen, comm ) )
+            break;
+        graphs.push_back( std::move(coarse) );
+        cmaps.push_back( std::move(cmap) );
+    }
+
+    // Partition the coarsest graph
+    const Int numLevels = graphs.size();
+    vector<Int> labels;
+    CoarsestSeparator
+    ( graphs.back(), labels, maxPartWeight, Max(ctrl.numDistSeps,Int(1)),
+      gen, comm );
+
+    // Project the separator back to the original graph, refining along the way
+    for( Int level=numLevels-2; level>=0; --level )
+    {
+        const MultilevelGraph& G = graphs[level];
+        const vector<Int>& cmap = cmaps[level];
+        vector<Int> fineLabels( G.numLocal+G.ghosts.size() );
+        for( Int u=0; u<G.numLocal; ++u )
+            fineLabels[u] = labels[cmap[u]];
+        labels.swap( fineLabels );
+        RefineDistSeparator( G, labels, maxPartWeight, maxRefineRounds, comm );
+    }
+
+    // Order the left side, then the right side, and then the separator
+    const Int numLocalSources = graph.NumLocalSources();
+    Int localSizes[3] = { 0, 0, 0 }, sizes[3], offsets[3];
+    for( Int s=0; s<numLocalSources; ++s )
+        ++localSizes[labels[s]];
+    mpi::AllReduce( localSizes, sizes, 3, comm );
+    mpi::Scan( localSizes, offsets, 3, comm );
+    offsets[LEFT_PART] -= localSizes[LEFT_PART];
+    offsets[RIGHT_PART] += sizes[LEFT_PART] - localSizes[RIGHT_PART];
+    offsets[SEP_PART] +=
+      sizes[LEFT_PART] + sizes[RIGHT_PART] - localSizes[SEP_PART];
+    perm.SetComm( comm );
+    perm.Resize( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, offsets[labels[s]]++ );
+
+    DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildFromPerm
+    ( graph, perm, sizes[LEFT_PART], sizes[RIGHT_PART], onLeft, child );
+    return sizes[SEP_PART];
+}
+
+} // namespace El
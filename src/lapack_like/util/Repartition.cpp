@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// The number of off-diagonal nonzeros of A whose column is owned by a
+// different process than its row
+template<typename T>
+Int EdgeCut( const DistSparseMatrix<T>& A )
+{
+    DEBUG_CSE
+    const int commRank = mpi::Rank( A.Comm() );
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    Int localCut = 0;
+    for( Int e=0; e<numLocalEntries; ++e )
+        if( sourceBuf[e] != targetBuf[e] &&
+            A.RowOwner(targetBuf[e]) != commRank )
+            ++localCut;
+    return mpi::AllReduce( localCut, A.Comm() );
+}
+
+// Y(mappedRows[iLoc],:) := X(iLoc,:) for each local row of X, where the maps
+// share the (block) distribution of X, so that mappedRows is simply the local
+// portion of the map
+template<typename T>
+void PermuteRows
+( const DistMap& map, const DistMultiVec<T>& X, DistMultiVec<T>& Y )
+{
+    DEBUG_CSE
+    if( map.NumSources() != X.Height() )
+        LogicError("The map was of size ",map.NumSources()," but X had ",
+                   X.Height()," rows");
+    if( !mpi::Congruent( map.Comm(), X.Comm() ) )
+        LogicError("The map and X must have congruent communicators");
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    const vector<Int>& mappedRows = map.Map();
+
+    Y.SetComm( X.Comm() );
+    Zeros( Y, X.Height(), width );
+    Y.Reserve( localHeight*width );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( Int j=0; j<width; ++j )
+            Y.QueueUpdate( mappedRows[iLoc], j, X.GetLocal(iLoc,j) );
+    Y.ProcessQueues();
+}
+
+} // anonymous namespace
+
+template<typename T>
+void Repartition
+( const DistSparseMatrix<T>& A,
+        DistSparseMatrix<T>& ANew,
+        RepartitionInfo& info,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Only square matrices can be repartitioned");
+    A.AssertLocallyConsistent();
+    mpi::Comm comm = A.Comm();
+    const Int n = A.Height();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const T* valueBuf = A.LockedValueBuffer();
+
+    info.edgeCutBefore = EdgeCut( A );
+    info.imbalanceBefore = A.Imbalance();
+
+    info.map.SetComm( comm );
+    info.map.Resize( n );
+    if( mpi::Size(comm) == 1 )
+    {
+        // A single process owns every row, so there is nothing to improve
+        for( Int i=0; i<n; ++i )
+            info.map.SetLocal( i, i );
+    }
+    else
+    {
+        // Dissect the graph of A + A^T: each process's subtree is ordered
+        // contiguously (followed by the comparatively small separators), so
+        // that the row blocks approximately line up with the subdomains
+        DistGraph graph( n, comm );
+        graph.Reserve( numLocalEntries, numLocalEntries );
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            graph.QueueConnection( sourceBuf[e], targetBuf[e] );
+            if( sourceBuf[e] != targetBuf[e] )
+                graph.QueueConnection( targetBuf[e], sourceBuf[e] );
+        }
+        graph.ProcessQueues();
+
+        ldl::DistSeparator rootSep;
+        ldl::DistNodeInfo rootInfo;
+        ldl::NestedDissection( graph, info.map, rootSep, rootInfo, ctrl );
+    }
+    InvertMap( info.map, info.invMap );
+
+    // ANew(map(i),map(j)) := A(i,j)
+    vector<Int> mappedSources, mappedTargets, colOffs;
+    A.MappedSources( info.map, mappedSources );
+    A.MappedTargets( info.map, mappedTargets, colOffs );
+    ANew.SetComm( comm );
+    Zeros( ANew, n, n );
+    ANew.Reserve( numLocalEntries, numLocalEntries );
+    const Int firstLocalRow = A.FirstLocalRow();
+    for( Int e=0; e<numLocalEntries; ++e )
+        ANew.QueueUpdate
+        ( mappedSources[sourceBuf[e]-firstLocalRow],
+          mappedTargets[colOffs[e]], valueBuf[e] );
+    ANew.ProcessQueues();
+
+    info.edgeCutAfter = EdgeCut( ANew );
+    info.imbalanceAfter = ANew.Imbalance();
+}
+
+template<typename T>
+void ApplyRepartition
+( const RepartitionInfo& info,
+  const DistMultiVec<T>& X,
+        DistMultiVec<T>& XNew )
+{
+    DEBUG_CSE
+    PermuteRows( info.map, X, XNew );
+}
+
+template<typename T>
+void RevertRepartition
+( const RepartitionInfo& info,
+  const DistMultiVec<T>& XNew,
+        DistMultiVec<T>& X )
+{
+    DEBUG_CSE
+    PermuteRows( info.invMap, XNew, X );
+}
+
+#define PROTO(T) \
+  template void Repartition \
+  ( const DistSparseMatrix<T>& A, \
+          DistSparseMatrix<T>& ANew, \
+          RepartitionInfo& info, \
+    const BisectCtrl& ctrl ); \
+  template void ApplyRepartition \
+  ( const RepartitionInfo& info, \
+    const DistMultiVec<T>& X, \
+          DistMultiVec<T>& XNew ); \
+  template void RevertRepartition \
+  ( const RepartitionInfo& info, \
+    const DistMultiVec<T>& XNew, \
+          DistMultiVec<T>& X );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace rcm {
+
+// A breadth-first search from 'root' within the unnumbered vertices which
+// returns the vertices in the order they were reached (with the neighbors of
+// each vertex visited in order of increasing degree), the position of the
+// first vertex of the last level, and the number of levels. The search is
+// marked by 'stamp' so that the markers need not be reset between searches.
+inline void LevelSearch
+( Int n, const Int* offsetBuf, const Int* targetBuf,
+  const vector<Int>& degrees, const vector<bool>& numbered,
+  vector<Int>& marks, Int stamp, Int root,
+  vector<Int>& order, Int& lastLevelBeg, Int& numLevels )
+{
+    order.resize( 0 );
+    order.push_back( root );
+    marks[root] = stamp;
+    Int levelBeg = 0;
+    lastLevelBeg = 0;
+    numLevels = 0;
+    vector<Int> neighbors;
+    while( levelBeg < Int(order.size()) )
+    {
+        lastLevelBeg = levelBeg;
+        ++numLevels;
+        const Int levelEnd = order.size();
+        for( Int k=levelBeg; k<levelEnd; ++k )
+        {
+            const Int s = order[k];
+            neighbors.resize( 0 );
+            for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+            {
+                const Int t = targetBuf[e];
+                if( t < n && !numbered[t] && marks[t] != stamp )
+                {
+                    marks[t] = stamp;
+                    neighbors.push_back( t );
+                }
+            }
+            std::sort
+            ( neighbors.begin(), neighbors.end(),
+              [&]( Int a, Int b )
+              { return degrees[a] < degrees[b] ||
+                       (degrees[a] == degrees[b] && a < b); } );
+            order.insert( order.end(), neighbors.begin(), neighbors.end() );
+        }
+        levelBeg = levelEnd;
+    }
+}
+
+// perm[i] is the new index of vertex i
+inline void Order
+( Int n, const Int* offsetBuf, const Int* targetBuf, vector<Int>& perm )
+{
+    vector<Int> degrees( n, 0 );
+    for( Int s=0; s<n; ++s )
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+            if( targetBuf[e] < n && targetBuf[e] != s )
+                ++degrees[s];
+
+    // Candidate starting vertices in order of increasing degree
+    vector<Int> candidates( n );
+    for( Int s=0; s<n; ++s )
+        candidates[s] = s;
+    std::stable_sort
+    ( candidates.begin(), candidates.end(),
+      [&]( Int a, Int b ) { return degrees[a] < degrees[b]; } );
+
+    perm.resize( n );
+    vector<bool> numbered( n, false );
+    vector<Int> marks( n, -1 ), order, trialOrder;
+    Int numNumbered=0, stamp=0;
+    for( const Int candidate : candidates )
+    {
+        if( numbered[candidate] )
+            continue;
+
+        // Search for a pseudo-peripheral vertex of the component by
+        // repeatedly restarting from a minimum-degree vertex of the last
+        // level while the number of levels increases
+        Int lastLevelBeg, numLevels;
+        LevelSearch
+        ( n, offsetBuf, targetBuf, degrees, numbered, marks, stamp++,
+          candidate, order, lastLevelBeg, numLevels );
+        while( true )
+        {
+            Int newRoot = order[lastLevelBeg];
+            for( Int k=lastLevelBeg; k<Int(order.size()); ++k )
+                if( degrees[order[k]] < degrees[newRoot] )
+                    newRoot = order[k];
+            Int trialLastLevelBeg, trialNumLevels;
+            LevelSearch
+            ( n, offsetBuf, targetBuf, degrees, numbered, marks, stamp++,
+              newRoot, trialOrder, trialLastLevelBeg, trialNumLevels );
+            if( trialNumLevels <= numLevels )
+                break;
+            order.swap( trialOrder );
+            lastLevelBeg = trialLastLevelBeg;
+            numLevels = trialNumLevels;
+        }
+
+        // 'order' now holds the Cuthill-McKee ordering of the component,
+        // which is numbered in reverse
+        for( const Int s : order )
+        {
+            numbered[s] = true;
+            perm[s] = n-1-numNumbered;
+            ++numNumbered;
+        }
+    }
+}
+
+} // namespace rcm
+
+void ReverseCuthillMcKee( const Graph& graph, vector<Int>& perm )
+{
+    DEBUG_CSE
+    rcm::Order
+    ( graph.NumSources(), graph.LockedOffsetBuffer(),
+      graph.LockedTargetBuffer(), perm );
+}
+
+void ReverseCuthillMcKee( const DistGraph& graph, DistMap& perm )
+{
+    DEBUG_CSE
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::Size( comm );
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int* localOffsetBuf = graph.LockedOffsetBuffer();
+
+    // The ordering is inherently sequential, and so the graph is gathered
+    // onto every process (as for the coarsest graph of MultilevelBisect)
+    vector<int> sourceSizes( commSize ), sourceOffs;
+    const int numLocalSourcesInt = numLocalSources;
+    mpi::AllGather( &numLocalSourcesInt, 1, sourceSizes.data(), 1, comm );
+    Scan( sourceSizes, sourceOffs );
+    vector<Int> localDegrees( numLocalSources ), degrees( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        localDegrees[s] = localOffsetBuf[s+1] - localOffsetBuf[s];
+    mpi::AllGather
+    ( localDegrees.data(), numLocalSources,
+      degrees.data(), sourceSizes.data(), sourceOffs.data(), comm );
+
+    const int numLocalEdges = graph.NumLocalEdges();
+    vector<int> edgeSizes( commSize ), edgeOffs;
+    mpi::AllGather( &numLocalEdges, 1, edgeSizes.data(), 1, comm );
+    const int numEdges = Scan( edgeSizes, edgeOffs );
+    vector<Int> targets( numEdges ), offsets( numSources+1 );
+    mpi::AllGather
+    ( graph.LockedTargetBuffer(), numLocalEdges,
+      targets.data(), edgeSizes.data(), edgeOffs.data(), comm );
+    offsets[0] = 0;
+    for( Int s=0; s<numSources; ++s )
+        offsets[s+1] = offsets[s] + degrees[s];
+
+    // Every process computes the same ordering and keeps its portion
+    vector<Int> seqPerm;
+    rcm::Order( numSources, offsets.data(), targets.data(), seqPerm );
+    perm.SetComm( comm );
+    perm.Resize( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, seqPerm[firstLocalSource+s] );
+}
+
+} // namespace El
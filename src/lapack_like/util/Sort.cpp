@@ -10,6 +10,8 @@
 
 #include <algorithm>
 
+#include "./Sort/SampleSort.hpp"
+
 namespace El {
 
 // Sort each column of the real matrix X
@@ -49,17 +51,25 @@ void Sort( AbstractDistMatrix<Real>& X, SortType sort, bool stable )
     if( sort == UNSORTED )
         return;
 
+    const int commSize = X.Grid().Size();
     if( (X.ColDist()==STAR && X.RowDist()==STAR) || 
         (X.ColDist()==CIRC && X.RowDist()==CIRC) )
     {
         if( X.Participating() )
             Sort( X.Matrix(), sort, stable );
     }
+    else if( commSize > 1 && X.Height() >= commSize*commSize )
+    {
+        // Sample sort each column within a [VC,* ] distribution
+        DistMatrix<Real,VC,STAR> X_VC_STAR( X );
+        for( Int j=0; j<X.Width(); ++j )
+            sort::SampleSort( X_VC_STAR, j, sort );
+        Copy( X_VC_STAR, X );
+    }
     else
     {
-        // TODO(poulson): Distributed sort
-
-        // Get a copy on a single process, sort, and then redistribute
+        // There are too few entries per process for regular sampling, so
+        // get a copy on a single process, sort, and then redistribute
         DistMatrix<Real,CIRC,CIRC> X_CIRC_CIRC( X );
         if( X_CIRC_CIRC.Participating() )
             Sort( X_CIRC_CIRC.Matrix(), sort, stable );
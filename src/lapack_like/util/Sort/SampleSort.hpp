@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SORT_SAMPLESORT_HPP
+#define EL_SORT_SAMPLESORT_HPP
+
+namespace El {
+namespace sort {
+
+// Sort column j of X in place using parallel sorting by regular sampling:
+// each process sorts its entries, p-1 splitters are chosen from p regular
+// samples of each process, each process receives (and merges) one bucket, and
+// the sorted column is then returned to the element-wise cyclic distribution.
+// Ties are broken by the original row index, so the sort is always stable.
+//
+// Each process is assumed to own at least p entries of the column.
+template<typename Real>
+void SampleSort( DistMatrix<Real,VC,STAR>& X, Int j, SortType sort )
+{
+    DEBUG_CSE
+    if( !X.Participating() )
+        return;
+    const Int mLocal = X.LocalHeight();
+    mpi::Comm comm = X.ColComm();
+    const int commSize = mpi::Size( comm );
+    const bool ascending = ( sort == ASCENDING );
+    auto before =
+      [ascending]( const ValueInt<Real>& a, const ValueInt<Real>& b )
+      {
+          if( a.value != b.value )
+              return ascending ? a.value < b.value : a.value > b.value;
+          return a.index < b.index;
+      };
+
+    // Sort the local entries
+    // ======================
+    vector<ValueInt<Real>> pairs( mLocal );
+    for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+    {
+        pairs[iLoc].value = X.GetLocal(iLoc,j);
+        pairs[iLoc].index = X.GlobalRow(iLoc);
+    }
+    std::sort( pairs.begin(), pairs.end(), before );
+
+    // Choose the splitters from regular samples of each process
+    // =========================================================
+    vector<Real> sampleValues( commSize );
+    vector<Int> sampleIndices( commSize );
+    for( Int k=0; k<commSize; ++k )
+    {
+        const auto& pair = pairs[(k*mLocal)/commSize];
+        sampleValues[k] = pair.value;
+        sampleIndices[k] = pair.index;
+    }
+    const Int numSamples = commSize*commSize;
+    vector<Real> allSampleValues( numSamples );
+    vector<Int> allSampleIndices( numSamples );
+    mpi::AllGather
+    ( sampleValues.data(), commSize,
+      allSampleValues.data(), commSize, comm );
+    mpi::AllGather
+    ( sampleIndices.data(), commSize,
+      allSampleIndices.data(), commSize, comm );
+    vector<ValueInt<Real>> samples( numSamples );
+    for( Int k=0; k<numSamples; ++k )
+    {
+        samples[k].value = allSampleValues[k];
+        samples[k].index = allSampleIndices[k];
+    }
+    std::sort( samples.begin(), samples.end(), before );
+    vector<ValueInt<Real>> splitters( commSize-1 );
+    for( Int k=1; k<commSize; ++k )
+        splitters[k-1] = samples[k*commSize+commSize/2-1];
+
+    // Send each (contiguous) bucket of sorted entries to its process
+    // ==============================================================
+    vector<int> sendCounts(commSize,0), sendOffs(commSize);
+    vector<Real> sendValues( mLocal );
+    vector<Int> sendIndices( mLocal );
+    Int bucket = 0;
+    for( Int k=0; k<mLocal; ++k )
+    {
+        while( bucket < commSize-1 && !before(pairs[k],splitters[bucket]) )
+            ++bucket;
+        ++sendCounts[bucket];
+        sendValues[k] = pairs[k].value;
+        sendIndices[k] = pairs[k].index;
+    }
+    vector<int> recvCounts(commSize), recvOffs(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    Scan( sendCounts, sendOffs );
+    const Int numRecv = Scan( recvCounts, recvOffs );
+    vector<Real> recvValues( numRecv );
+    vector<Int> recvIndices( numRecv );
+    mpi::AllToAll
+    ( sendValues.data(), sendCounts.data(), sendOffs.data(),
+      recvValues.data(), recvCounts.data(), recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendIndices.data(), sendCounts.data(), sendOffs.data(),
+      recvIndices.data(), recvCounts.data(), recvOffs.data(), comm );
+    SwapClear( sendValues );
+    SwapClear( sendIndices );
+
+    // Merge the sorted runs from each process
+    // =======================================
+    pairs.resize( numRecv );
+    for( Int k=0; k<numRecv; ++k )
+    {
+        pairs[k].value = recvValues[k];
+        pairs[k].index = recvIndices[k];
+    }
+    SwapClear( recvIndices );
+    for( int q=1; q<commSize; ++q )
+        std::inplace_merge
+        ( pairs.begin(),
+          pairs.begin()+recvOffs[q],
+          pairs.begin()+recvOffs[q]+recvCounts[q], before );
+
+    // Return the i'th entry of the sorted column to the owner of row i
+    // ================================================================
+    const Int firstRow = mpi::Scan( numRecv, mpi::SUM, comm ) - numRecv;
+    for( int q=0; q<commSize; ++q )
+        sendCounts[q] = 0;
+    for( Int k=0; k<numRecv; ++k )
+        ++sendCounts[X.RowOwner(firstRow+k)];
+    Scan( sendCounts, sendOffs );
+    sendValues.resize( numRecv );
+    sendIndices.resize( numRecv );
+    auto offs = sendOffs;
+    for( Int k=0; k<numRecv; ++k )
+    {
+        const Int i = firstRow + k;
+        const int owner = X.RowOwner(i);
+        sendValues[offs[owner]] = pairs[k].value;
+        sendIndices[offs[owner]] = i;
+        ++offs[owner];
+    }
+    SwapClear( pairs );
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    const Int numFinal = Scan( recvCounts, recvOffs );
+    recvValues.resize( numFinal );
+    recvIndices.resize( numFinal );
+    mpi::AllToAll
+    ( sendValues.data(), sendCounts.data(), sendOffs.data(),
+      recvValues.data(), recvCounts.data(), recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendIndices.data(), sendCounts.data(), sendOffs.data(),
+      recvIndices.data(), recvCounts.data(), recvOffs.data(), comm );
+    for( Int k=0; k<numFinal; ++k )
+        X.SetLocal( X.LocalRow(recvIndices[k]), j, recvValues[k] );
+}
+
+} // namespace sort
+} // namespace El
+
+#endif // ifndef EL_SORT_SAMPLESORT_HPP
@@ -37,7 +37,7 @@ void CauchyLike
               ( "x[", i, "] = y[", j, "] (", x[i],
                 ") is not allowed for Cauchy matrices" );
         )
-        return F1(r[i]*s[j]/x[i]-y[j]);
+        return F1(r[i]*s[j]/(x[i]-y[j]));
       };
     IndexDependentFill( A, function<F1(Int,Int)>(cauchyFill) );
 }
@@ -67,7 +67,7 @@ void CauchyLike
               ( "x[", i, "] = y[", j, "] (", x[i],
                 ") is not allowed for Cauchy matrices" );
         )
-        return F1(r[i]*s[j]/x[i]-y[j]);
+        return F1(r[i]*s[j]/(x[i]-y[j]));
       };
     IndexDependentFill( A, function<F1(Int,Int)>(cauchyFill) );
 }
@@ -0,0 +1,442 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+// Fast transforms
+// ===============
+
+template<typename Real>
+void FFT( Matrix<Complex<Real>>& X, bool inverse )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int N = X.Height();
+    const Int width = X.Width();
+    if( N & (N-1) )
+        LogicError("FFT requires a power-of-two height, not ",N);
+    if( N <= 1 )
+        return;
+
+    Int logN = 0;
+    while( (Int(1)<<logN) < N )
+        ++logN;
+    vector<Int> reversal(N,0);
+    for( Int i=1; i<N; ++i )
+        reversal[i] = (reversal[i/2]/2) | ((i&1)<<(logN-1));
+
+    const Real pi = Pi<Real>();
+    const Real sign = ( inverse ? Real(1) : Real(-1) );
+    vector<C> twiddles(N/2);
+    for( Int k=0; k<N/2; ++k )
+    {
+        const Real theta = sign*2*pi*k/N;
+        twiddles[k] = C(Cos(theta),Sin(theta));
+    }
+
+    C* XBuf = X.Buffer();
+    const Int XLDim = X.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+    {
+        C* x = &XBuf[j*XLDim];
+        for( Int i=0; i<N; ++i )
+            if( i < reversal[i] )
+                std::swap( x[i], x[reversal[i]] );
+        for( Int len=2; len<=N; len*=2 )
+        {
+            const Int half = len/2;
+            const Int step = N/len;
+            for( Int iBeg=0; iBeg<N; iBeg+=len )
+            {
+                for( Int k=0; k<half; ++k )
+                {
+                    const C alpha = x[iBeg+k];
+                    const C beta = twiddles[k*step]*x[iBeg+k+half];
+                    x[iBeg+k] = alpha + beta;
+                    x[iBeg+k+half] = alpha - beta;
+                }
+            }
+        }
+    }
+}
+
+template<typename F>
+void WalshHadamard( Matrix<F>& X )
+{
+    DEBUG_CSE
+    const Int N = X.Height();
+    const Int width = X.Width();
+    if( N & (N-1) )
+        LogicError("WalshHadamard requires a power-of-two height, not ",N);
+    F* XBuf = X.Buffer();
+    const Int XLDim = X.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+    {
+        F* x = &XBuf[j*XLDim];
+        for( Int h=1; h<N; h*=2 )
+        {
+            for( Int iBeg=0; iBeg<N; iBeg+=2*h )
+            {
+                for( Int i=iBeg; i<iBeg+h; ++i )
+                {
+                    const F alpha = x[i];
+                    const F beta = x[i+h];
+                    x[i] = alpha + beta;
+                    x[i+h] = alpha - beta;
+                }
+            }
+        }
+    }
+}
+
+// Fast structured operators
+// =========================
+
+namespace {
+
+template<typename Real>
+void CastFromComplex( const Complex<Real>& alpha, Real& beta )
+{ beta = RealPart(alpha); }
+
+template<typename Real>
+void CastFromComplex( const Complex<Real>& alpha, Complex<Real>& beta )
+{ beta = alpha; }
+
+Int TransformOrder( Int n )
+{
+    Int N = 1;
+    while( N < n )
+        N *= 2;
+    return N;
+}
+
+// The FFT of the generator 'a' zero-padded to length N
+template<typename F>
+void FormSymbol
+( Int N, const vector<F>& a, bool reverse, Matrix<Complex<Base<F>>>& symbol )
+{
+    DEBUG_CSE
+    const Int length = a.size();
+    Zeros( symbol, N, 1 );
+    for( Int k=0; k<length; ++k )
+        symbol(k) = ( reverse ? a[length-1-k] : a[k] );
+    FFT( symbol );
+}
+
+template<typename F>
+void ReverseRows( Matrix<F>& X )
+{
+    DEBUG_CSE
+    const Int m = X.Height();
+    const Int width = X.Width();
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<m/2; ++i )
+            std::swap( X(i,j), X(m-1-i,j) );
+}
+
+// Y := op(A) X, where X is redistributed so that each process owns entire
+// columns, to which the sequential operator is then applied
+template<typename F,class OperatorType>
+void ApplyToColumns
+( const OperatorType& A,
+  Orientation orientation,
+  const ElementalMatrix<F>& X,
+        ElementalMatrix<F>& Y )
+{
+    DEBUG_CSE
+    const Int height = ( orientation == NORMAL ? A.Height() : A.Width() );
+    DistMatrix<F,STAR,VR> X_STAR_VR( X );
+    DistMatrix<F,STAR,VR> Y_STAR_VR( X.Grid() );
+    Y_STAR_VR.AlignWith( X_STAR_VR );
+    Y_STAR_VR.Resize( height, X.Width() );
+    A.Apply( orientation, X_STAR_VR.LockedMatrix(), Y_STAR_VR.Matrix() );
+    Copy( Y_STAR_VR, Y );
+}
+
+} // anonymous namespace
+
+// Toeplitz
+// --------
+// A x is the slice [n-1,n-1+m) of the linear convolution of a and x, which is
+// formed as a cyclic convolution of length N >= m+n-1 (so that the
+// wrapped-around terms only pollute the unused entries). Similarly, A^T is
+// the n x m Toeplitz matrix generated by the reversal of a.
+
+template<typename F>
+ToeplitzOperator<F>::ToeplitzOperator( Int m, Int n, const vector<F>& a )
+: m_(m), n_(n)
+{
+    DEBUG_CSE
+    if( m == 0 || n == 0 )
+        return;
+    if( a.size() != Unsigned(m+n-1) )
+        LogicError("a was the wrong size");
+    const Int N = TransformOrder( m+n-1 );
+    FormSymbol( N, a, false, symbol_ );
+    FormSymbol( N, a, true, transSymbol_ );
+}
+
+template<typename F>
+void ToeplitzOperator<F>::Apply
+( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const bool normal = ( orientation == NORMAL );
+    const bool conjugate = ( orientation == ADJOINT );
+    const Int height = ( normal ? m_ : n_ );
+    const Int inputHeight = ( normal ? n_ : m_ );
+    const Int numRHS = X.Width();
+    if( X.Height() != inputHeight )
+        LogicError("X was ",X.Height()," x ",numRHS," but op(A) is ",
+                   height," x ",inputHeight);
+    if( height == 0 || inputHeight == 0 )
+    {
+        Zeros( Y, height, numRHS );
+        return;
+    }
+    const auto& symbol = ( normal ? symbol_ : transSymbol_ );
+    const Int N = symbol.Height();
+
+    // A^H x = conj(A^T conj(x))
+    Matrix<C> T;
+    Zeros( T, N, numRHS );
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<inputHeight; ++i )
+            T(i,j) = C( conjugate ? Conj(X(i,j)) : X(i,j) );
+    FFT( T );
+    for( Int j=0; j<numRHS; ++j )
+        for( Int k=0; k<N; ++k )
+            T(k,j) *= symbol(k);
+    FFT( T, true );
+
+    Y.Resize( height, numRHS );
+    const Real scale = Real(1)/N;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=0; i<height; ++i )
+        {
+            const C upsilon = scale*T(i+inputHeight-1,j);
+            CastFromComplex( conjugate ? Conj(upsilon) : upsilon, Y(i,j) );
+        }
+    }
+}
+
+template<typename F>
+void ToeplitzOperator<F>::Apply
+( Orientation orientation,
+  const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const
+{
+    DEBUG_CSE
+    ApplyToColumns( *this, orientation, X, Y );
+}
+
+// Hankel
+// ------
+
+template<typename F>
+HankelOperator<F>::HankelOperator( Int m, Int n, const vector<F>& a )
+: toeplitz_(m,n,a)
+{ }
+
+template<typename F>
+void HankelOperator<F>::Apply
+( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const
+{
+    DEBUG_CSE
+    if( orientation == NORMAL )
+    {
+        // A X = T (J X)
+        Matrix<F> XRev( X );
+        ReverseRows( XRev );
+        toeplitz_.Apply( NORMAL, XRev, Y );
+    }
+    else
+    {
+        // op(A) X = J (op(T) X)
+        toeplitz_.Apply( orientation, X, Y );
+        ReverseRows( Y );
+    }
+}
+
+template<typename F>
+void HankelOperator<F>::Apply
+( Orientation orientation,
+  const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const
+{
+    DEBUG_CSE
+    ApplyToColumns( *this, orientation, X, Y );
+}
+
+// Circulant
+// ---------
+
+template<typename F>
+CirculantOperator<F>::CirculantOperator( const vector<F>& a )
+{
+    DEBUG_CSE
+    // A(i,j) = g[i-j+(n-1)] with g[k+(n-1)] = a[k mod n] for |k| < n
+    const Int n = a.size();
+    vector<F> g( Max(2*n-1,Int(0)) );
+    for( Int k=-(n-1); k<n; ++k )
+        g[k+(n-1)] = a[Mod(k,n)];
+    toeplitz_ = ToeplitzOperator<F>( n, n, g );
+}
+
+// Fourier
+// -------
+// For orders which are not powers of two, Bluestein's identity,
+// ij = (i^2 + j^2 - (i-j)^2)/2, rewrites the DFT as a Toeplitz product
+// between diagonal scalings by the chirp exp(-pi i j^2/n).
+
+template<typename Real>
+FourierOperator<Real>::FourierOperator( Int n )
+: n_(n)
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    if( n <= 0 || !(n & (n-1)) )
+        return;
+    const Real pi = Pi<Real>();
+    // Reduce the squares modulo 2n so that the phases are computed exactly
+    auto phase = [&]( Int k )
+      {
+        const long long kSq = static_cast<long long>(k)*k;
+        const Real theta = pi*Real(Int(kSq % (2*n)))/n;
+        return C(Cos(theta),Sin(theta));
+      };
+    chirp_.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        chirp_(j) = Conj(phase(j));
+    vector<C> g( 2*n-1 );
+    for( Int k=-(n-1); k<n; ++k )
+        g[k+(n-1)] = phase(k);
+    chirpConv_ = ToeplitzOperator<C>( n, n, g );
+}
+
+template<typename Real>
+void FourierOperator<Real>::Apply
+( Orientation orientation,
+  const Matrix<Complex<Real>>& X, Matrix<Complex<Real>>& Y ) const
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    if( X.Height() != n_ )
+        LogicError("X was ",X.Height()," x ",X.Width()," but A is ",
+                   n_," x ",n_);
+    // The DFT is symmetric, and its adjoint is conj(F conj(X))
+    const bool conjugate = ( orientation == ADJOINT );
+    const Int numRHS = X.Width();
+    Matrix<C> Z( X );
+    if( conjugate )
+        Conjugate( Z );
+    if( chirp_.Height() == 0 )
+    {
+        FFT( Z );
+    }
+    else
+    {
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=0; i<n_; ++i )
+                Z(i,j) *= chirp_(i);
+        Matrix<C> W;
+        chirpConv_.Apply( NORMAL, Z, W );
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=0; i<n_; ++i )
+                Z(i,j) = chirp_(i)*W(i,j);
+    }
+    if( n_ > 0 )
+        Z *= Real(1)/Sqrt(Real(n_));
+    if( conjugate )
+        Conjugate( Z );
+    Y = Z;
+}
+
+template<typename Real>
+void FourierOperator<Real>::Apply
+( Orientation orientation,
+  const ElementalMatrix<Complex<Real>>& X,
+        ElementalMatrix<Complex<Real>>& Y ) const
+{
+    DEBUG_CSE
+    ApplyToColumns( *this, orientation, X, Y );
+}
+
+// Walsh
+// -----
+// The binary Walsh matrix replaces the -1's with 0's, i.e., it is (H + 1 1^T)/2
+
+template<typename F>
+WalshOperator<F>::WalshOperator( Int k, bool binary )
+: binary_(binary)
+{
+    DEBUG_CSE
+    if( k < 1 )
+        LogicError("Walsh matrices are only defined for k>=1");
+    n_ = Int(1) << k;
+}
+
+template<typename F>
+void WalshOperator<F>::Apply
+( Orientation orientation, const Matrix<F>& X, Matrix<F>& Y ) const
+{
+    DEBUG_CSE
+    // Walsh matrices are real and symmetric
+    if( X.Height() != n_ )
+        LogicError("X was ",X.Height()," x ",X.Width()," but A is ",
+                   n_," x ",n_);
+    Y = X;
+    WalshHadamard( Y );
+    if( binary_ )
+    {
+        const Int numRHS = X.Width();
+        for( Int j=0; j<numRHS; ++j )
+        {
+            F colSum = 0;
+            for( Int i=0; i<n_; ++i )
+                colSum += X(i,j);
+            for( Int i=0; i<n_; ++i )
+                Y(i,j) = (Y(i,j)+colSum)/F(2);
+        }
+    }
+}
+
+template<typename F>
+void WalshOperator<F>::Apply
+( Orientation orientation,
+  const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ) const
+{
+    DEBUG_CSE
+    ApplyToColumns( *this, orientation, X, Y );
+}
+
+#define PROTO(F) \
+  template void WalshHadamard( Matrix<F>& X ); \
+  template class ToeplitzOperator<F>; \
+  template class HankelOperator<F>; \
+  template class CirculantOperator<F>; \
+  template class WalshOperator<F>;
+
+#define PROTO_REAL(Real) \
+  PROTO(Real) \
+  template void FFT( Matrix<Complex<Real>>& X, bool inverse ); \
+  template class FourierOperator<Real>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
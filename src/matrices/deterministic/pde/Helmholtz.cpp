@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./Stencil.hpp"
+
 namespace El {
 
 // 1D Helmholtz
@@ -64,22 +66,19 @@ void Helmholtz( SparseMatrix<F>& H, Int n, F shift )
 {
     DEBUG_CSE
     typedef Base<F> Real;
-    Zeros( H, n, n );
 
     const Real hInv = n+1; 
     const Real hInvSquared = hInv*hInv;
     const F mainTerm = 2*hInvSquared - shift;
 
-    H.Reserve( 3*n );
-    for( Int i=0; i<n; ++i )
-    {
-        H.QueueUpdate( i, i, mainTerm );
-        if( i != 0 )
-            H.QueueUpdate( i, i-1, -hInvSquared );
-        if( i != n-1 )
-            H.QueueUpdate( i, i+1, -hInvSquared );
-    }
-    H.ProcessQueues();
+    auto coefficients =
+      [=]( Int x, Int y, Int z, F* values )
+      {
+        values[3] = mainTerm;
+        values[2] = -hInvSquared;
+        values[4] = -hInvSquared;
+      };
+    stencil::Fill( H, n, 1, 1, coefficients );
 }
 
 template<typename F>
@@ -87,24 +86,19 @@ void Helmholtz( DistSparseMatrix<F>& H, Int n, F shift )
 {
     DEBUG_CSE
     typedef Base<F> Real;
-    Zeros( H, n, n );
 
     const Real hInv = n+1; 
     const Real hInvSquared = hInv*hInv;
     const F mainTerm = 2*hInvSquared - shift;
 
-    const Int localHeight = H.LocalHeight(); 
-    H.Reserve( 3*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = H.GlobalRow(iLoc);
-        H.QueueUpdate( i, i, mainTerm );
-        if( i != 0 )
-            H.QueueUpdate( i, i-1, -hInvSquared );
-        if( i != n-1 )
-            H.QueueUpdate( i, i+1, -hInvSquared );
-    }
-    H.ProcessQueues();
+    auto coefficients =
+      [=]( Int x, Int y, Int z, F* values )
+      {
+        values[3] = mainTerm;
+        values[2] = -hInvSquared;
+        values[4] = -hInvSquared;
+      };
+    stencil::Fill( H, n, 1, 1, coefficients );
 }
 
 // 2D Helmholtz
@@ -178,8 +172,6 @@ void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, F shift )
 {
     DEBUG_CSE
     typedef Base<F> Real;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
 
     const Real hxInv = nx+1;
     const Real hyInv = ny+1;
@@ -187,23 +179,16 @@ void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, F shift )
     const Real hyInvSquared = hyInv*hyInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared) - shift;
 
-    H.Reserve( 5*n );
-    for( Int i=0; i<n; ++i )
-    {
-        const Int x = i % nx;
-        const Int y = i/nx;
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-    }
-    H.ProcessQueues();
+    auto coefficients =
+      [=]( Int x, Int y, Int z, F* values )
+      {
+        values[3] = mainTerm;
+        values[2] = -hxInvSquared;
+        values[4] = -hxInvSquared;
+        values[1] = -hyInvSquared;
+        values[5] = -hyInvSquared;
+      };
+    stencil::Fill( H, nx, ny, 1, coefficients );
 }
 
 template<typename F>
@@ -211,8 +196,6 @@ void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, F shift )
 {
     DEBUG_CSE
     typedef Base<F> Real;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
 
     const Real hxInv = nx+1;
     const Real hyInv = ny+1;
@@ -220,25 +203,16 @@ void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, F shift )
     const Real hyInvSquared = hyInv*hyInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared) - shift;
 
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 5*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = i/nx;
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-    }
-    H.ProcessQueues();
+    auto coefficients =
+      [=]( Int x, Int y, Int z, F* values )
+      {
+        values[3] = mainTerm;
+        values[2] = -hxInvSquared;
+        values[4] = -hxInvSquared;
+        values[1] = -hyInvSquared;
+        values[5] = -hyInvSquared;
+      };
+    stencil::Fill( H, nx, ny, 1, coefficients );
 }
 
 // 3D Helmholtz
@@ -326,8 +300,6 @@ void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
 {
     DEBUG_CSE
     typedef Base<F> Real;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
 
     const Real hxInv = nx+1; 
     const Real hyInv = ny+1;
@@ -337,28 +309,18 @@ void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
     const Real hzInvSquared = hzInv*hzInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared+hzInvSquared) - shift;
 
-    H.Reserve( 7*n );
-    for( Int i=0; i<n; ++i )
-    {
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -hzInvSquared );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -hzInvSquared );
-    }
-    H.ProcessQueues();
+    auto coefficients =
+      [=]( Int x, Int y, Int z, F* values )
+      {
+        values[3] = mainTerm;
+        values[2] = -hxInvSquared;
+        values[4] = -hxInvSquared;
+        values[1] = -hyInvSquared;
+        values[5] = -hyInvSquared;
+        values[0] = -hzInvSquared;
+        values[6] = -hzInvSquared;
+      };
+    stencil::Fill( H, nx, ny, nz, coefficients );
 }
 
 template<typename F> 
@@ -366,8 +328,6 @@ void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
 {
     DEBUG_CSE
     typedef Base<F> Real;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
 
     const Real hxInv = nx+1; 
     const Real hyInv = ny+1;
@@ -377,30 +337,18 @@ void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
     const Real hzInvSquared = hzInv*hzInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared+hzInvSquared) - shift;
 
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 7*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -hzInvSquared );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -hzInvSquared );
-    }
-    H.ProcessQueues();
+    auto coefficients =
+      [=]( Int x, Int y, Int z, F* values )
+      {
+        values[3] = mainTerm;
+        values[2] = -hxInvSquared;
+        values[4] = -hxInvSquared;
+        values[1] = -hyInvSquared;
+        values[5] = -hyInvSquared;
+        values[0] = -hzInvSquared;
+        values[6] = -hzInvSquared;
+      };
+    stencil::Fill( H, nx, ny, nz, coefficients );
 }
 
 #define PROTO(F) \
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_PDE_STENCIL_HPP
+#define EL_MATRICES_PDE_STENCIL_HPP
+
+namespace El {
+namespace stencil {
+
+// Sparse matrices for (at most) seven-point stencils over an nx x ny x nz
+// grid, with x varying fastest, are written directly into their sorted
+// coordinate buffers: the number of entries of each row is known
+// analytically, so the buffers are sized exactly and the rows are filled
+// independently without queueing updates or sorting.
+//
+// The coefficients of row i are ordered by increasing column index:
+//
+//   0: (x,y,z-1), 1: (x,y-1,z), 2: (x-1,y,z), 3: (x,y,z),
+//   4: (x+1,y,z), 5: (x,y+1,z), 6: (x,y,z+1),
+//
+// and those of neighbors outside of the grid are ignored.
+const Int numCoefficients = 7;
+
+inline Int NumRowEntries( Int x, Int y, Int z, Int nx, Int ny, Int nz )
+{
+    return 1 + (x != 0) + (x != nx-1) +
+               (y != 0) + (y != ny-1) +
+               (z != 0) + (z != nz-1);
+}
+
+// The offsets of rows [firstRow,firstRow+numRows) within the local buffers
+inline vector<Int> RowOffsets
+( Int nx, Int ny, Int nz, Int firstRow, Int numRows )
+{
+    vector<Int> rowOffsets( numRows+1 );
+    rowOffsets[0] = 0;
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        const Int i = firstRow + iLoc;
+        rowOffsets[iLoc+1] = rowOffsets[iLoc] +
+          NumRowEntries( i % nx, (i/nx) % ny, i/(nx*ny), nx, ny, nz );
+    }
+    return rowOffsets;
+}
+
+// Fills rows [firstRow,firstRow+numRows) into buffers which have been sized
+// for them, where coefficients(x,y,z,values) must set the (relevant) entries
+// of values[0:numCoefficients)
+template<typename T,typename Coefficients>
+void FillRows
+( Int nx, Int ny, Int nz, Int firstRow, const vector<Int>& rowOffsets,
+  Int* sourceBuf, Int* targetBuf, T* valueBuf,
+  const Coefficients& coefficients )
+{
+    DEBUG_CSE
+    const Int numRows = rowOffsets.size()-1;
+    const Int columnOffsets[numCoefficients] =
+      { -nx*ny, -nx, -1, 0, 1, nx, nx*ny };
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        const Int i = firstRow + iLoc;
+        const Int x = i % nx;
+        const Int y = (i/nx) % ny;
+        const Int z = i/(nx*ny);
+        const bool present[numCoefficients] =
+          { z != 0, y != 0, x != 0, true, x != nx-1, y != ny-1, z != nz-1 };
+
+        T values[numCoefficients];
+        coefficients( x, y, z, values );
+
+        Int e = rowOffsets[iLoc];
+        for( Int k=0; k<numCoefficients; ++k )
+        {
+            if( present[k] )
+            {
+                sourceBuf[e] = i;
+                targetBuf[e] = i + columnOffsets[k];
+                valueBuf[e] = values[k];
+                ++e;
+            }
+        }
+    }
+}
+
+template<typename T,typename Coefficients>
+void Fill
+( SparseMatrix<T>& H, Int nx, Int ny, Int nz,
+  const Coefficients& coefficients )
+{
+    DEBUG_CSE
+    const Int n = nx*ny*nz;
+    Zeros( H, n, n );
+    const vector<Int> rowOffsets = RowOffsets( nx, ny, nz, 0, n );
+    H.ForceNumEntries( rowOffsets.back() );
+    FillRows
+    ( nx, ny, nz, 0, rowOffsets,
+      H.SourceBuffer(), H.TargetBuffer(), H.ValueBuffer(), coefficients );
+    H.ProcessQueues();
+}
+
+template<typename T,typename Coefficients>
+void Fill
+( DistSparseMatrix<T>& H, Int nx, Int ny, Int nz,
+  const Coefficients& coefficients )
+{
+    DEBUG_CSE
+    const Int n = nx*ny*nz;
+    Zeros( H, n, n );
+    const Int firstLocalRow = H.FirstLocalRow();
+    const Int localHeight = H.LocalHeight();
+    const vector<Int> rowOffsets =
+      RowOffsets( nx, ny, nz, firstLocalRow, localHeight );
+    H.ForceNumLocalEntries( rowOffsets.back() );
+    FillRows
+    ( nx, ny, nz, firstLocalRow, rowOffsets,
+      H.SourceBuffer(), H.TargetBuffer(), H.ValueBuffer(), coefficients );
+    H.ProcessLocalQueues();
+}
+
+} // namespace stencil
+} // namespace El
+
+#endif // ifndef EL_MATRICES_PDE_STENCIL_HPP
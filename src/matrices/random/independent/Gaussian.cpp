@@ -12,11 +12,42 @@
 
 namespace El {
 
+namespace gaussian {
+
+template<typename F,typename=EnableIf<IsCounterSamplable<F>>>
+void CounterFill
+( Matrix<F>& ALoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  std::uint64_t stream, F mean, Base<F> stddev )
+{
+    CounterGaussian
+    ( ALoc, colShift, colStride, rowShift, rowStride, stream, mean, stddev );
+}
+
+template<typename F,typename=DisableIf<IsCounterSamplable<F>>,typename=void>
+void CounterFill
+( Matrix<F>& ALoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  std::uint64_t stream, F mean, Base<F> stddev )
+{ LogicError("Counter-based sampling is not supported for this datatype"); }
+
+template<typename F>
+bool UseCounter()
+{ return IsCounterSamplable<F>::value && CounterBasedRandom(); }
+
+} // namespace gaussian
+
 // Draw each entry from a normal PDF
 template<typename F>
 void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_CSE
+    if( gaussian::UseCounter<F>() )
+    {
+        gaussian::CounterFill
+        ( A, 0, 1, 0, 1, NextLocalRandomStream(), mean, stddev );
+        return;
+    }
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
@@ -25,6 +56,14 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_CSE
+    if( gaussian::UseCounter<F>() && A.Wrap() == ELEMENT )
+    {
+        // Every process (including redundant ones) draws its own entries
+        gaussian::CounterFill
+        ( A.Matrix(), A.ColShift(), A.ColStride(), A.RowShift(),
+          A.RowStride(), A.Grid().NextRandomStream(), mean, stddev );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
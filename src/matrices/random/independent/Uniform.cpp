@@ -14,10 +14,42 @@ namespace El {
 
 // Draw each entry from a uniform PDF over a closed ball.
 
+namespace uniform {
+
+template<typename T,typename=EnableIf<IsCounterSamplable<T>>>
+void CounterFill
+( Matrix<T>& ALoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  std::uint64_t stream, T center, Base<T> radius )
+{
+    CounterUniform
+    ( ALoc, colShift, colStride, rowShift, rowStride, stream,
+      center, radius );
+}
+
+template<typename T,typename=DisableIf<IsCounterSamplable<T>>,typename=void>
+void CounterFill
+( Matrix<T>& ALoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  std::uint64_t stream, T center, Base<T> radius )
+{ LogicError("Counter-based sampling is not supported for this datatype"); }
+
+template<typename T>
+bool UseCounter()
+{ return IsCounterSamplable<T>::value && CounterBasedRandom(); }
+
+} // namespace uniform
+
 template<typename T>
 void MakeUniform( Matrix<T>& A, T center, Base<T> radius )
 {
     DEBUG_CSE
+    if( uniform::UseCounter<T>() )
+    {
+        uniform::CounterFill
+        ( A, 0, 1, 0, 1, NextLocalRandomStream(), center, radius );
+        return;
+    }
     auto sampleBall = [=]() { return SampleBall(center,radius); };
     EntrywiseFill( A, function<T()>(sampleBall) );
 }
@@ -34,6 +66,14 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     DEBUG_CSE
+    if( uniform::UseCounter<T>() && A.Wrap() == ELEMENT )
+    {
+        // Every process (including redundant ones) draws its own entries
+        uniform::CounterFill
+        ( A.Matrix(), A.ColShift(), A.ColStride(), A.RowShift(),
+          A.RowStride(), A.Grid().NextRandomStream(), center, radius );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
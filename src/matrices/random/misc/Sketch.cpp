@@ -0,0 +1,424 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// See Section 9 of Martinsson and Tropp's "Randomized numerical linear
+// algebra: Foundations & algorithms", Acta Numerica, Vol. 29, pp. 403--572,
+// 2020, and Clarkson and Woodruff's "Low rank approximation and regression
+// in input sparsity time", STOC, 2013.
+
+namespace El {
+
+namespace sketch {
+
+// Every parameter of an embedding is a function of the counter-based block
+// indexed by (row of A, purpose) within the sketch's stream, so that each
+// process can independently generate the parameters of its rows:
+//
+//   purpose 0:   the random sign (bit 0 of word 0) and the Fisher-Yates draw
+//                (words 2 and 3) of the subsampled transforms
+//   purpose 1+t: the t'th draw of the row and sign of a nonzero of a sparse
+//                embedding
+
+inline std::uint64_t Join( std::uint32_t hi, std::uint32_t lo )
+{ return (std::uint64_t(hi)<<32) | lo; }
+
+inline Int TransformOrder( Int n )
+{
+    Int N = 1;
+    while( N < n )
+        N *= 2;
+    return N;
+}
+
+inline Int TransformSign( const SketchOperator& S, Int i )
+{ return ( counter_random::Block(i,0,S.stream)[0] & 1 ) ? -1 : 1; }
+
+// The sketch.height rows of the order-N transform which are sampled without
+// replacement via a partial Fisher-Yates shuffle
+inline vector<Int> SampledRows( const SketchOperator& S, Int N )
+{
+    DEBUG_CSE
+    vector<Int> perm(N);
+    for( Int i=0; i<N; ++i )
+        perm[i] = i;
+    for( Int k=0; k<S.height; ++k )
+    {
+        const auto block = counter_random::Block( k, 0, S.stream );
+        const Int r = k + Int(Join(block[2],block[3]) % std::uint64_t(N-k));
+        std::swap( perm[k], perm[r] );
+    }
+    perm.resize( S.height );
+    return perm;
+}
+
+inline Int NonzerosPerColumn( const SketchOperator& S )
+{ return S.type == COUNT_SKETCH ? 1 : Min( S.sparsity, S.height ); }
+
+// The sketch rows and signs of the nonzeros of column i of a sparse
+// embedding, where the distinct rows are drawn by rejection
+inline void SparseColumn
+( const SketchOperator& S, Int i, Int numNonzeros, Int* rows, Int* signs )
+{
+    Int draw = 0;
+    for( Int t=0; t<numNonzeros; ++t )
+    {
+        while( true )
+        {
+            const auto block = counter_random::Block( i, 1+draw, S.stream );
+            ++draw;
+            const Int row =
+              Int(Join(block[0],block[1]) % std::uint64_t(S.height));
+            bool repeated = false;
+            for( Int s=0; s<t; ++s )
+                repeated = repeated || ( rows[s] == row );
+            if( !repeated )
+            {
+                rows[t] = row;
+                signs[t] = ( block[2] & 1 ) ? -1 : 1;
+                break;
+            }
+        }
+    }
+}
+
+template<typename RowMap>
+void SparseParameters
+( const SketchOperator& S, Int localHeight, const RowMap& globalRow,
+  Matrix<Int>& rows, Matrix<Int>& signs )
+{
+    DEBUG_CSE
+    const Int numNonzeros = NonzerosPerColumn( S );
+    rows.Resize( numNonzeros, localHeight );
+    signs.Resize( numNonzeros, localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        SparseColumn
+        ( S, globalRow(iLoc), numNonzeros,
+          rows.Buffer(0,iLoc), signs.Buffer(0,iLoc) );
+}
+
+inline void CheckApply( const SketchOperator& S, Int height )
+{
+    if( height != S.width )
+        LogicError
+        ("Cannot apply a ",S.height," x ",S.width," sketch to a matrix of "
+         "height ",height);
+}
+
+// Gaussian sketches are only supported for types with counter-based samplers
+// so that repeated applications agree
+template<typename F>
+EnableIf<IsCounterSamplable<F>>
+FillGaussian
+( Matrix<F>& GLoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  const SketchOperator& S )
+{
+    typedef Base<F> Real;
+    const Real stddev = Real(1) / Sqrt(Real(S.height));
+    CounterGaussian
+    ( GLoc, colShift, colStride, rowShift, rowStride, S.stream, F(0),
+      stddev );
+}
+
+template<typename F>
+DisableIf<IsCounterSamplable<F>>
+FillGaussian
+( Matrix<F>& GLoc,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  const SketchOperator& S )
+{ LogicError("Gaussian sketches require single or double precision"); }
+
+template<typename Real>
+void FourierColumns( Matrix<Real>& T )
+{ LogicError("Fourier sketches require complex arithmetic"); }
+
+template<typename Real>
+void FourierColumns( Matrix<Complex<Real>>& T )
+{ FFT( T ); }
+
+// Y := sqrt(N/height) R H D A, where Y must already be sized
+template<typename F>
+void LocalTransform
+( const Matrix<F>& A, const SketchOperator& S, Matrix<F>& Y )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int width = A.Width();
+    const Int N = TransformOrder( n );
+
+    vector<F> signs(n);
+    for( Int i=0; i<n; ++i )
+        signs[i] = F(TransformSign(S,i));
+    Matrix<F> T;
+    Zeros( T, N, width );
+    for( Int j=0; j<width; ++j )
+    {
+        const F* a = A.LockedBuffer(0,j);
+        F* t = T.Buffer(0,j);
+        for( Int i=0; i<n; ++i )
+            t[i] = signs[i]*a[i];
+    }
+    if( S.type == FOURIER_SKETCH )
+        FourierColumns( T );
+    else
+        WalshHadamard( T );
+
+    // The unitary transform is the unnormalized one divided by sqrt(N)
+    const vector<Int> sampled = SampledRows( S, N );
+    const F scale = F(1) / Sqrt(Real(S.height));
+    for( Int j=0; j<width; ++j )
+    {
+        const F* t = T.LockedBuffer(0,j);
+        F* y = Y.Buffer(0,j);
+        for( Int k=0; k<S.height; ++k )
+            y[k] = scale*t[sampled[k]];
+    }
+}
+
+// Y := Y + S(:,globalRows) A, where S is a sparse embedding
+template<typename F,typename RowMap>
+void LocalScatter
+( const Matrix<F>& A, const RowMap& globalRow, const SketchOperator& S,
+  Matrix<F>& Y )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int localHeight = A.Height();
+    const Int width = A.Width();
+    Matrix<Int> rows, signs;
+    SparseParameters( S, localHeight, globalRow, rows, signs );
+    const Int numNonzeros = rows.Height();
+    const Real scale = Real(1) / Sqrt(Real(numNonzeros));
+
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+    {
+        const F* a = A.LockedBuffer(0,j);
+        F* y = Y.Buffer(0,j);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const F alpha = scale*a[iLoc];
+            for( Int t=0; t<numNonzeros; ++t )
+                y[rows(t,iLoc)] += Real(signs(t,iLoc))*alpha;
+        }
+    }
+}
+
+} // namespace sketch
+
+SketchOperator MakeSketch
+( SketchType type, Int sketchSize, Int n, Int sparsity )
+{
+    DEBUG_CSE
+    if( sketchSize < 1 || n < 0 )
+        LogicError("Invalid sketch dimensions ",sketchSize," x ",n);
+    if( (type == SRFT_SKETCH || type == FOURIER_SKETCH) &&
+        sketchSize > sketch::TransformOrder(n) )
+        LogicError
+        ("Cannot sample ",sketchSize," rows of a transform of order ",
+         sketch::TransformOrder(n));
+    if( type == SPARSE_SIGN_SKETCH && sparsity < 1 )
+        LogicError("Sparse sign sketches need at least one nonzero per column");
+    SketchOperator S;
+    S.type = type;
+    S.height = sketchSize;
+    S.width = n;
+    S.sparsity = sparsity;
+    S.stream = NextLocalRandomStream();
+    return S;
+}
+
+SketchOperator MakeSketch
+( SketchType type, Int sketchSize, Int n, const Grid& grid, Int sparsity )
+{
+    DEBUG_CSE
+    SketchOperator S = MakeSketch( type, sketchSize, n, sparsity );
+    S.stream = grid.NextRandomStream();
+    return S;
+}
+
+namespace sketch {
+
+template<typename F>
+void Apply( const Matrix<F>& A, const SketchOperator& S, Matrix<F>& Y )
+{
+    DEBUG_CSE
+    CheckApply( S, A.Height() );
+    const Int width = A.Width();
+    switch( S.type )
+    {
+    case GAUSSIAN_SKETCH:
+    {
+        Matrix<F> G;
+        G.Resize( S.height, S.width );
+        FillGaussian( G, 0, 1, 0, 1, S );
+        Gemm( NORMAL, NORMAL, F(1), G, A, Y );
+        break;
+    }
+    case SRFT_SKETCH:
+    case FOURIER_SKETCH:
+        Y.Resize( S.height, width );
+        LocalTransform( A, S, Y );
+        break;
+    default:
+        Zeros( Y, S.height, width );
+        LocalScatter( A, []( Int iLoc ) { return iLoc; }, S, Y );
+    }
+}
+
+template<typename F>
+void Apply
+( const ElementalMatrix<F>& APre, const SketchOperator& S,
+  ElementalMatrix<F>& Y )
+{
+    DEBUG_CSE
+    CheckApply( S, APre.Height() );
+    const Int width = APre.Width();
+    const Grid& g = APre.Grid();
+    switch( S.type )
+    {
+    case GAUSSIAN_SKETCH:
+    {
+        DistMatrix<F> G(g);
+        G.Resize( S.height, S.width );
+        FillGaussian
+        ( G.Matrix(), G.ColShift(), G.ColStride(), G.RowShift(),
+          G.RowStride(), S );
+        Gemm( NORMAL, NORMAL, F(1), G, APre, Y );
+        break;
+    }
+    case SRFT_SKETCH:
+    case FOURIER_SKETCH:
+    {
+        // Each process owns entire columns of A in a [STAR,VR] distribution,
+        // so the transform is applied without further communication
+        DistMatrix<F,STAR,VR> A_STAR_VR( APre );
+        DistMatrix<F,STAR,VR> Y_STAR_VR(g);
+        Y_STAR_VR.AlignWith( A_STAR_VR );
+        Y_STAR_VR.Resize( S.height, width );
+        LocalTransform( A_STAR_VR.LockedMatrix(), S, Y_STAR_VR.Matrix() );
+        Copy( Y_STAR_VR, Y );
+        break;
+    }
+    default:
+    {
+        // Each process scatters its local rows of A into a partial sketch
+        // which is then summed within each process column
+        DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+        auto& A = AProx.GetLocked();
+        DistMatrix<F,STAR,MR> Y_STAR_MR(g);
+        Y_STAR_MR.AlignWith( A );
+        Zeros( Y_STAR_MR, S.height, width );
+        LocalScatter
+        ( A.LockedMatrix(),
+          [&]( Int iLoc ) { return A.GlobalRow(iLoc); },
+          S, Y_STAR_MR.Matrix() );
+        AllReduce( Y_STAR_MR.Matrix(), A.ColComm() );
+        Copy( Y_STAR_MR, Y );
+    }
+    }
+}
+
+template<typename F>
+void Apply
+( const SparseMatrix<F>& A, const SketchOperator& S, Matrix<F>& Y )
+{
+    DEBUG_CSE
+    CheckApply( S, A.Height() );
+    if( S.type != SPARSE_SIGN_SKETCH && S.type != COUNT_SKETCH )
+    {
+        Matrix<F> ADense;
+        Copy( A, ADense );
+        Apply( ADense, S, Y );
+        return;
+    }
+    typedef Base<F> Real;
+    Matrix<Int> rows, signs;
+    SparseParameters
+    ( S, A.Height(), []( Int i ) { return i; }, rows, signs );
+    const Int numNonzeros = rows.Height();
+    const Real scale = Real(1) / Sqrt(Real(numNonzeros));
+
+    Zeros( Y, S.height, A.Width() );
+    const Int numEntries = A.NumEntries();
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        const Int j = A.Col(e);
+        const F alpha = scale*A.Value(e);
+        for( Int t=0; t<numNonzeros; ++t )
+            Y(rows(t,i),j) += Real(signs(t,i))*alpha;
+    }
+}
+
+template<typename F>
+void Apply
+( const DistSparseMatrix<F>& A, const SketchOperator& S,
+  ElementalMatrix<F>& Y )
+{
+    DEBUG_CSE
+    CheckApply( S, A.Height() );
+    if( S.type != SPARSE_SIGN_SKETCH && S.type != COUNT_SKETCH )
+    {
+        DistMatrix<F> ADense(Y.Grid());
+        Copy( A, ADense );
+        Apply( ADense, S, Y );
+        return;
+    }
+
+    // Each process scatters its local rows into a partial sketch which is
+    // then summed over the communicator of A (which must be that of Y's grid)
+    typedef Base<F> Real;
+    const Int firstLocalRow = A.FirstLocalRow();
+    Matrix<Int> rows, signs;
+    SparseParameters
+    ( S, A.LocalHeight(),
+      [=]( Int iLoc ) { return firstLocalRow+iLoc; }, rows, signs );
+    const Int numNonzeros = rows.Height();
+    const Real scale = Real(1) / Sqrt(Real(numNonzeros));
+
+    DistMatrix<F,STAR,STAR> Y_STAR_STAR(Y.Grid());
+    Zeros( Y_STAR_STAR, S.height, A.Width() );
+    auto& YLoc = Y_STAR_STAR.Matrix();
+    const Int numLocalEntries = A.NumLocalEntries();
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int iLoc = A.Row(e) - firstLocalRow;
+        const Int j = A.Col(e);
+        const F alpha = scale*A.Value(e);
+        for( Int t=0; t<numNonzeros; ++t )
+            YLoc(rows(t,iLoc),j) += Real(signs(t,iLoc))*alpha;
+    }
+    AllReduce( YLoc, A.Comm() );
+    Copy( Y_STAR_STAR, Y );
+}
+
+#define PROTO(F) \
+  template void Apply \
+  ( const Matrix<F>& A, const SketchOperator& S, Matrix<F>& Y ); \
+  template void Apply \
+  ( const ElementalMatrix<F>& A, const SketchOperator& S, \
+    ElementalMatrix<F>& Y ); \
+  template void Apply \
+  ( const SparseMatrix<F>& A, const SketchOperator& S, Matrix<F>& Y ); \
+  template void Apply \
+  ( const DistSparseMatrix<F>& A, const SketchOperator& S, \
+    ElementalMatrix<F>& Y );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace sketch
+} // namespace El
@@ -38,6 +38,54 @@ Int AlgebraicRelationSearch
     return info.nullity;
 }
 
+template<typename F>
+Int AlgebraicRelationSearch
+( F alpha,
+  Int n,
+  Base<F> NSqrt,
+  Matrix<F>& B,
+  Matrix<F>& U,
+  Int numStages,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> z( n, 1 );
+    for( Int j=0; j<n; ++j )
+        z(j) = Pow(alpha,Real(j));
+    return ZDependenceSearch( z, NSqrt, B, U, numStages, ctrl );
+}
+
+template<typename F>
+vector<Int> AlgebraicRelationSearch
+( F alpha,
+  const vector<Int>& nList,
+  Base<F> NSqrt,
+  vector<Matrix<F>>& BList,
+  vector<Matrix<F>>& UList,
+  Int numStages,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int numSearches = nList.size();
+    BList.resize( numSearches );
+    UList.resize( numSearches );
+    vector<Int> nullities( numSearches );
+
+    // The LLL timers are shared and the output would be interleaved
+    auto searchCtrl( ctrl );
+    searchCtrl.progress = false;
+    searchCtrl.time = false;
+
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int k=0; k<numSearches; ++k )
+        nullities[k] =
+          AlgebraicRelationSearch
+          ( alpha, nList[k], NSqrt, BList[k], UList[k], numStages,
+            searchCtrl );
+    return nullities;
+}
+
 #define PROTO(F) \
   template Int AlgebraicRelationSearch \
   ( F alpha, \
@@ -45,6 +93,22 @@ Int AlgebraicRelationSearch
     Base<F> NSqrt, \
     Matrix<F>& B, \
     Matrix<F>& U, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template Int AlgebraicRelationSearch \
+  ( F alpha, \
+    Int n, \
+    Base<F> NSqrt, \
+    Matrix<F>& B, \
+    Matrix<F>& U, \
+    Int numStages, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template vector<Int> AlgebraicRelationSearch \
+  ( F alpha, \
+    const vector<Int>& nList, \
+    Base<F> NSqrt, \
+    vector<Matrix<F>>& BList, \
+    vector<Matrix<F>>& UList, \
+    Int numStages, \
     const LLLCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
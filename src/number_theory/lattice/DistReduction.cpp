@@ -0,0 +1,473 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace lll {
+
+// Gather each segment B(:,starts[k]:starts[k+1]-1) onto the process with
+// (VC) rank k mod p, reduce the owned segments with the given sequential
+// routine, and scatter the results back into B. The return value is the
+// total number of swaps over all of the processes, and 'firstSwap' is
+// lowered to the first column involved in a swap.
+//
+// The reducer is of the form 'Int reduce( Matrix<F>& BSeg, Int& firstSwap )'.
+template<typename F,class Reducer>
+Int ReduceDistSegments
+( DistMatrix<F>& B,
+  const vector<Int>& starts,
+  Reducer reduce,
+  Int& firstSwap,
+  bool parallelSegments )
+{
+    DEBUG_CSE
+    const Grid& g = B.Grid();
+    const int commSize = g.Size();
+    const Int numSegments = starts.size()-1;
+
+    vector<DistMatrix<F,CIRC,CIRC>> segments;
+    segments.reserve( numSegments );
+    for( Int k=0; k<numSegments; ++k )
+    {
+        auto BSeg = B( ALL, IR(starts[k],starts[k+1]) );
+        segments.emplace_back( g, int(k % commSize) );
+        segments.back() = BSeg;
+    }
+
+    vector<Int> owned;
+    for( Int k=0; k<numSegments; ++k )
+        if( segments[k].CrossRank() == segments[k].Root() &&
+            starts[k+1]-starts[k] >= 2 )
+            owned.push_back( k );
+    const Int numOwned = owned.size();
+    vector<Int> numSwaps(numOwned,0), firstSwaps(numOwned,B.Width());
+    auto reduceOwned =
+      [&]( Int l )
+      {
+        const Int k = owned[l];
+        Int segFirstSwap = B.Width();
+        numSwaps[l] = reduce( segments[k].Matrix(), segFirstSwap );
+        if( numSwaps[l] > 0 )
+            firstSwaps[l] = starts[k] + segFirstSwap;
+      };
+    if( parallelSegments )
+    {
+        EL_PARALLEL_FOR
+        for( Int l=0; l<numOwned; ++l )
+            reduceOwned( l );
+    }
+    else
+    {
+        for( Int l=0; l<numOwned; ++l )
+            reduceOwned( l );
+    }
+
+    for( Int k=0; k<numSegments; ++k )
+    {
+        auto BSeg = B( ALL, IR(starts[k],starts[k+1]) );
+        BSeg = segments[k];
+    }
+
+    Int localSwaps=0, localFirstSwap=firstSwap;
+    for( Int l=0; l<numOwned; ++l )
+    {
+        localSwaps += numSwaps[l];
+        localFirstSwap = Min( localFirstSwap, firstSwaps[l] );
+    }
+    firstSwap = mpi::AllReduce( localFirstSwap, mpi::MIN, g.VCComm() );
+    return mpi::AllReduce( localSwaps, g.VCComm() );
+}
+
+// Alternate between the segments aligned with multiples of 'segmentSize'
+// and the segments which straddle their boundaries
+template<typename F,class Reducer>
+Int SweepDistSegments
+( DistMatrix<F>& B,
+  Int segmentSize,
+  Int numSweeps,
+  Reducer reduce,
+  Int& firstSwap,
+  bool parallelSegments,
+  bool progress )
+{
+    DEBUG_CSE
+    const Int n = B.Width();
+    vector<Int> alignedStarts, shiftedStarts;
+    for( Int j=0; j<n; j+=segmentSize )
+        alignedStarts.push_back( j );
+    alignedStarts.push_back( n );
+    shiftedStarts.push_back( 0 );
+    for( Int j=segmentSize/2; j<n; j+=segmentSize )
+        shiftedStarts.push_back( j );
+    shiftedStarts.push_back( n );
+
+    Int numSwaps = 0;
+    for( Int sweep=0; sweep<numSweeps; ++sweep )
+    {
+        const Int alignedSwaps =
+          ReduceDistSegments
+          ( B, alignedStarts, reduce, firstSwap, parallelSegments );
+        numSwaps += alignedSwaps;
+        if( progress )
+            Output("Sweep ",sweep,": aligned swaps=",alignedSwaps);
+        if( sweep > 0 && alignedSwaps == 0 )
+            break;
+
+        const Int shiftedSwaps =
+          ReduceDistSegments
+          ( B, shiftedStarts, reduce, firstSwap, parallelSegments );
+        numSwaps += shiftedSwaps;
+        if( progress )
+            Output("Sweep ",sweep,": shifted swaps=",shiftedSwaps);
+        if( shiftedSwaps == 0 )
+            break;
+    }
+    return numSwaps;
+}
+
+// Form the R factor of a distributed Householder QR factorization of B
+// (with a non-negative diagonal) redundantly on every process, size-reduce
+// it while accumulating the unimodular transformation U, and, if 'allowSwaps'
+// is true, swap each (non-overlapping) adjacent pair of columns which
+// violates the Lovasz condition (or which has a zero column preceding a
+// nonzero one) before applying B := B U with a distributed Gemm.
+//
+// The return value is the number of swaps, and, if it is zero, R is the
+// upper-trapezoidal factor of the updated B.
+template<typename F>
+Int GlobalStep
+( DistMatrix<F>& B,
+  Matrix<F>& R,
+  bool allowSwaps,
+  Int& firstSwap,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = B.Grid();
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int minDim = Min(m,n);
+
+    {
+        DistMatrix<F> QR( B );
+        DistMatrix<F,MD,STAR> t(g);
+        DistMatrix<Real,MD,STAR> d(g);
+        El::QR( QR, t, d );
+        DistMatrix<F,STAR,STAR> R_STAR_STAR( QR( IR(0,minDim), ALL ) );
+        R = R_STAR_STAR.Matrix();
+    }
+    MakeTrapezoidal( UPPER, R );
+    for( Int i=0; i<minDim; ++i )
+    {
+        const Real rho = Abs(R(i,i));
+        if( rho > Real(0) )
+        {
+            const F phase = Conj(R(i,i)) / rho;
+            for( Int j=i; j<n; ++j )
+                R(i,j) *= phase;
+        }
+    }
+
+    Matrix<F> U;
+    Identity( U, n, n );
+    for( Int j=1; j<n; ++j )
+    {
+        for( Int i=Min(j,minDim)-1; i>=0; --i )
+        {
+            if( RealPart(R(i,i)) <= ctrl.zeroTol )
+                continue;
+            F chi = R(i,j) / R(i,i);
+            if( Abs(RealPart(chi)) > ctrl.eta ||
+                Abs(ImagPart(chi)) > ctrl.eta )
+            {
+                chi = Round(chi);
+                blas::Axpy( i+1, -chi, R.Buffer(0,i), 1, R.Buffer(0,j), 1 );
+                blas::Axpy( n, -chi, U.Buffer(0,i), 1, U.Buffer(0,j), 1 );
+            }
+        }
+    }
+
+    Int numSwaps = 0;
+    if( allowSwaps )
+    {
+        for( Int i=0; i<minDim-1; ++i )
+        {
+            const Real rho_i_i = RealPart(R(i,i));
+            const Real rho_i_ip1 = Abs(R(i,i+1));
+            const Real rho_ip1_ip1 = RealPart(R(i+1,i+1));
+            bool violated;
+            if( rho_i_i <= ctrl.zeroTol )
+                violated = ( rho_ip1_ip1 > ctrl.zeroTol );
+            else
+                violated =
+                  ( ctrl.delta*rho_i_i*rho_i_i >
+                    rho_ip1_ip1*rho_ip1_ip1 + rho_i_ip1*rho_i_ip1 );
+            if( violated )
+            {
+                ColSwap( U, i, i+1 );
+                firstSwap = Min( firstSwap, i );
+                ++numSwaps;
+                // Keep the swaps disjoint
+                ++i;
+            }
+        }
+    }
+
+    DistMatrix<F> BOld( B );
+    DistMatrix<F,STAR,STAR> U_STAR_STAR( g );
+    U_STAR_STAR.Resize( n, n );
+    U_STAR_STAR.Matrix() = U;
+    Gemm( NORMAL, NORMAL, F(1), BOld, U_STAR_STAR, F(0), B );
+    return numSwaps;
+}
+
+template<typename F>
+void FillInfo
+( const Matrix<F>& R,
+        LLLInfo<Base<F>>& info,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int minDim = Min(R.Height(),R.Width());
+    auto achieved = lll::Achieved( R, ctrl );
+    info.delta = achieved.first;
+    info.eta = achieved.second;
+    info.rank = 0;
+    for( Int i=0; i<minDim; ++i )
+        if( RealPart(R(i,i)) > ctrl.zeroTol )
+            ++info.rank;
+    info.nullity = R.Width() - info.rank;
+    info.logVol = lll::LogVolume( R );
+}
+
+template<typename F>
+LLLInfo<Base<F>> DistHelper
+( DistMatrix<F>& B,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = B.Grid();
+    const Int n = B.Width();
+    const Int segmentSize = Max( ctrl.segmentSize, Int(2) );
+    const Int numRounds = Max( ctrl.segmentSweeps, Int(1) );
+    const bool root = ( g.VCRank() == 0 );
+    const bool progress = ctrl.progress && root;
+    Timer timer;
+
+    // The local reductions should not print (or time)
+    auto ctrlSeg( ctrl );
+    ctrlSeg.segmented = false;
+    ctrlSeg.recursive = false;
+    ctrlSeg.jumpstart = false;
+    ctrlSeg.startCol = 0;
+    ctrlSeg.progress = false;
+    ctrlSeg.time = false;
+    auto reduce =
+      [&]( Matrix<F>& BSeg, Int& segFirstSwap )
+      {
+        auto segInfo = LLL( BSeg, ctrlSeg );
+        segFirstSwap = segInfo.firstSwap;
+        return segInfo.numSwaps;
+      };
+
+    LLLInfo<Real> info;
+    Int numSwaps=0, firstSwap=n;
+    bool reduced = false;
+    for( Int round=0; round<numRounds; ++round )
+    {
+        if( ctrl.time )
+            timer.Start();
+        numSwaps +=
+          SweepDistSegments
+          ( B, segmentSize, 1, reduce, firstSwap, true, progress );
+        const Int globalSwaps = GlobalStep( B, R, true, firstSwap, ctrl );
+        numSwaps += globalSwaps;
+        if( ctrl.time && root )
+            Output("Round ",round,": ",timer.Stop()," seconds");
+        if( progress )
+            Output("Round ",round,": global swaps=",globalSwaps);
+        if( globalSwaps == 0 )
+        {
+            reduced = true;
+            break;
+        }
+    }
+
+    if( !reduced )
+    {
+        // Finish the (now nearly reduced) basis on a single process
+        if( progress )
+            Output("Finishing the reduction sequentially");
+        DistMatrix<F,CIRC,CIRC> B_CIRC_CIRC( B );
+        if( B_CIRC_CIRC.CrossRank() == B_CIRC_CIRC.Root() )
+        {
+            auto finalInfo = LLL( B_CIRC_CIRC.Matrix(), ctrlSeg );
+            numSwaps += finalInfo.numSwaps;
+            firstSwap = Min( firstSwap, finalInfo.firstSwap );
+        }
+        mpi::Broadcast( numSwaps, 0, g.VCComm() );
+        mpi::Broadcast( firstSwap, 0, g.VCComm() );
+        B = B_CIRC_CIRC;
+        GlobalStep( B, R, false, firstSwap, ctrl );
+    }
+
+    FillInfo( R, info, ctrl );
+    info.numSwaps = numSwaps;
+    info.firstSwap = firstSwap;
+    return info;
+}
+
+} // namespace lll
+
+template<typename F>
+LLLInfo<Base<F>> LLL
+( AbstractDistMatrix<F>& BPre,
+  AbstractDistMatrix<F>& RPre,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.delta < Real(1)/Real(2) )
+        LogicError("delta is assumed to be at least 1/2");
+    if( ctrl.eta <= Real(1)/Real(2) || ctrl.eta >= Sqrt(ctrl.delta) )
+        LogicError
+        ("eta=",ctrl.eta," should be in (1/2,sqrt(delta)=",
+         Sqrt(ctrl.delta),")");
+    if( ctrl.jumpstart )
+        LogicError("Distributed LLL does not support jumpstarts");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    Matrix<F> R;
+    auto info = lll::DistHelper( B, R, ctrl );
+
+    DistMatrix<F,STAR,STAR> R_STAR_STAR( B.Grid() );
+    R_STAR_STAR.Resize( R.Height(), R.Width() );
+    R_STAR_STAR.Matrix() = R;
+    Copy( R_STAR_STAR, RPre );
+    return info;
+}
+
+template<typename F>
+LLLInfo<Base<F>> LLL
+( AbstractDistMatrix<F>& BPre,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DistMatrix<F> R( BPre.Grid() );
+    return LLL( BPre, R, ctrl );
+}
+
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( AbstractDistMatrix<F>& BPre,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    const Grid& g = B.Grid();
+    const Int n = B.Width();
+    const bool root = ( g.VCRank() == 0 );
+    const bool progress = ctrl.progress && root;
+
+    auto lllCtrl( ctrl.lllCtrl );
+    lllCtrl.jumpstart = false;
+    lllCtrl.startCol = 0;
+
+    Matrix<F> R;
+    Int numSwaps = 0;
+    if( !ctrl.skipInitialLLL )
+    {
+        auto lllInfo = lll::DistHelper( B, R, lllCtrl );
+        numSwaps += lllInfo.numSwaps;
+    }
+
+    // Each segment must hold at least two blocks
+    const Int segmentSize =
+      Max( ctrl.lllCtrl.segmentSize, 2*Max(ctrl.blocksize,Int(2)) );
+    auto ctrlSeg( ctrl );
+    ctrlSeg.jumpstart = false;
+    ctrlSeg.startCol = 0;
+    ctrlSeg.progress = false;
+    ctrlSeg.time = false;
+    ctrlSeg.checkpoint = false;
+    ctrlSeg.lllCtrl.segmented = false;
+    ctrlSeg.lllCtrl.progress = false;
+    ctrlSeg.lllCtrl.time = false;
+    Int localEnums=0, localEnumFailures=0;
+    auto reduce =
+      [&]( Matrix<F>& BSeg, Int& segFirstSwap )
+      {
+        auto segInfo = BKZ( BSeg, ctrlSeg );
+        localEnums += segInfo.numEnums;
+        localEnumFailures += segInfo.numEnumFailures;
+        segFirstSwap = 0;
+        return segInfo.numSwaps;
+      };
+
+    const Int numRounds = Max( ctrl.lllCtrl.segmentSweeps, Int(1) );
+    LLLInfo<Real> lllInfo;
+    Int firstSwap = n;
+    for( Int round=0; round<numRounds; ++round )
+    {
+        // The enumerations are not thread-safe, so the segments owned by a
+        // process are reduced one at a time
+        const Int bkzSwaps =
+          lll::SweepDistSegments
+          ( B, segmentSize, 1, reduce, firstSwap, false, progress );
+        numSwaps += bkzSwaps;
+        if( progress )
+            Output("BKZ round ",round,": swaps=",bkzSwaps);
+
+        // Restore the LLL reduction across the segment boundaries
+        lllInfo = lll::DistHelper( B, R, lllCtrl );
+        numSwaps += lllInfo.numSwaps;
+        if( bkzSwaps == 0 )
+            break;
+    }
+
+    BKZInfo<Real> info;
+    info.delta = lllInfo.delta;
+    info.eta = lllInfo.eta;
+    info.rank = lllInfo.rank;
+    info.nullity = lllInfo.nullity;
+    info.numSwaps = numSwaps;
+    info.numEnums = mpi::AllReduce( localEnums, g.VCComm() );
+    info.numEnumFailures = mpi::AllReduce( localEnumFailures, g.VCComm() );
+    info.logVol = lllInfo.logVol;
+    return info;
+}
+
+#define PROTO(F) \
+  template LLLInfo<Base<F>> LLL \
+  ( AbstractDistMatrix<F>& B, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template LLLInfo<Base<F>> LLL \
+  ( AbstractDistMatrix<F>& B, \
+    AbstractDistMatrix<F>& R, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template BKZInfo<Base<F>> BKZ \
+  ( AbstractDistMatrix<F>& B, \
+    const BKZCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -225,6 +225,261 @@ Matrix<Real> PrunedUpperBounds( Int n, Real normUpperBound, bool linear )
     return upperBounds;
 }
 
+template<typename Real>
+Matrix<Real> PruningCoefficients( Int n, bool linear )
+{
+    DEBUG_CSE
+    return PrunedUpperBounds( n, Real(1), linear );
+}
+
+template<typename Real>
+Matrix<Real> GNRUpperBounds
+( Int n, Real normUpperBound, const EnumCtrl<Real>& ctrl )
+{
+    if( !ctrl.customPruning )
+        return PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
+    if( ctrl.pruningCoeffs.Height() != n || ctrl.pruningCoeffs.Width() != 1 )
+        LogicError
+        ("Expected ",n," x 1 pruning coefficients but they were ",
+         ctrl.pruningCoeffs.Height()," x ",ctrl.pruningCoeffs.Width());
+    auto upperBounds( ctrl.pruningCoeffs );
+    upperBounds *= normUpperBound;
+    return upperBounds;
+}
+
+// Apply the (weakly) pseudorandom unimodular transformation defined by
+// adding scales[j] times column sources[j] to each column j of B (unless
+// 'sources' is empty), fix up the result with a cheap BKZ, and run a pruned
+// enumeration. Since the unimodular matrix is tracked, 'v' is returned
+// relative to the original lattice basis.
+template<typename F>
+Base<F> PrunedTrial
+( const Matrix<F>& B,
+  const Matrix<Base<F>>& upperBounds,
+  const vector<Int>& sources,
+  const vector<Int>& scales,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int minDim = Min(m,n);
+    const Real normUpperBound = upperBounds(n-1);
+    Timer timer;
+
+    Matrix<F> BNew( B ), RNew, U;
+    Identity( U, n, n );
+    const bool randomized = !sources.empty();
+    if( randomized )
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            const Int c = sources[j];
+            const Int scale = scales[j];
+            if( c == j || scale == 0 )
+                continue; // if scale=-1, we could have singularity
+            if( ctrl.progress )
+                Output("  B(:,",j,") += ",scale,"*B(:,",c,")");
+
+            auto bj = BNew( ALL, j );
+            auto bc = BNew( ALL, c );
+            Axpy( scale, bc, bj );
+
+            auto uj = U(ALL,j);
+            auto uc = U(ALL,c);
+            Axpy( scale, uc, uj );
+        }
+
+        // The BKZ does not need to be particularly powerful
+        BKZCtrl<Real> bkzCtrl;
+        bkzCtrl.jumpstart = true; // accumulate into U
+        bkzCtrl.blocksize = 10;
+        bkzCtrl.recursive = false;
+        bkzCtrl.lllCtrl.recursive = false;
+        if( ctrl.time )
+            timer.Start();
+        BKZ( BNew, U, RNew, bkzCtrl );
+        if( ctrl.time )
+            Output("  Fix-up BKZ: ",timer.Stop()," seconds");
+    }
+    RNew = BNew;
+    qr::ExplicitTriang( RNew ); 
+
+    auto dNew = GetRealPartOfDiagonal( RNew );
+    auto NNew( RNew );
+    auto NNewT = NNew( IR(0,minDim), ALL );
+    DiagonalSolve( LEFT, NORMAL, dNew, NNewT );
+
+    if( ctrl.time )
+        timer.Start();
+    Real result =
+      ( ctrl.parallel ?
+        ParallelGNREnumeration( dNew, NNew, upperBounds, v, ctrl ) :
+        GNREnumeration( dNew, NNew, upperBounds, v, ctrl ) );
+    if( ctrl.time )
+        Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
+    if( result < normUpperBound )
+    {
+        if( ctrl.progress )
+            Output("Found lattice member with norm ",result);
+        if( randomized )
+        {
+            if( ctrl.progress )
+            {
+                Print( v, "vInner" );
+                Matrix<F> y;
+                CoordinatesToSparse( NNew, v, y );
+                Print( y, "y" );
+            }
+            auto vCopy( v );
+            Gemv( NORMAL, F(1), U, vCopy, F(0), v );
+        }
+        if( ctrl.progress )
+        {
+            Matrix<F> b;
+            Zeros( b, m, 1 );
+            Gemv( NORMAL, F(1), B, v, F(0), b );
+            Print( v, "v" );
+            Print( b, "b" );
+        }
+    }
+    return result;
+}
+
+inline void SampleCombinations
+( Int n, vector<Int>& sources, vector<Int>& scales )
+{
+    sources.resize( n );
+    scales.resize( n );
+    for( Int j=0; j<n; ++j )
+    {
+        sources[j] = SampleUniform( Int(0), n );
+        scales[j] = SampleUniform( Int(-5), Int(5) );
+    }
+}
+
+// Run up to ctrl.numTrials pruned enumerations until one succeeds. If
+// ctrl.parallel is true, a single trial is run with a parallel enumeration,
+// whereas multiple trials are run concurrently over the threads of each of
+// the processes in ctrl.comm (the threads are only used for fixed-precision
+// types since the BigFloat precision is global).
+template<typename F>
+Base<F> PrunedTrials
+( const Matrix<F>& B,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    const Real normUpperBound = upperBounds(n-1);
+    const Real failure = 2*normUpperBound+1;
+
+    vector<Int> sources, scales;
+    if( !ctrl.parallel || ctrl.numTrials <= 1 )
+    {
+        for( Int trial=0; trial<ctrl.numTrials; ++trial )
+        {
+            if( trial != 0 )
+                SampleCombinations( n, sources, scales );
+            if( ctrl.progress )
+                Output("Starting trial ",trial);
+            Real result =
+              PrunedTrial( B, upperBounds, sources, scales, v, ctrl );
+            if( result < normUpperBound )
+                return result;
+        }
+        return failure;
+    }
+
+    const Int commRank = mpi::Rank( ctrl.comm );
+    const Int commSize = mpi::Size( ctrl.comm );
+    Int numThreads = 1;
+#ifdef EL_HYBRID
+    if( IsFixedPrecision<Real>::value )
+        numThreads = omp_get_max_threads();
+#endif
+    auto ctrlTrial( ctrl );
+    ctrlTrial.parallel = false;
+    ctrlTrial.progress = false;
+    ctrlTrial.innerProgress = false;
+    ctrlTrial.time = false;
+
+    const Int batchSize = commSize*numThreads;
+    vector<vector<Int>> threadSources(numThreads), threadScales(numThreads);
+    vector<Matrix<F>> threadVs(numThreads);
+    vector<Real> results(numThreads);
+    vector<string> errors(numThreads);
+    for( Int batchBeg=0; batchBeg<ctrl.numTrials; batchBeg+=batchSize )
+    {
+        if( ctrl.progress && commRank == 0 )
+            Output("Starting trials ",batchBeg," through ",
+                   Min(batchBeg+batchSize,ctrl.numTrials)-1);
+
+        // The random combinations are sampled up front since the random
+        // number generator is shared
+        const Int trialBeg = batchBeg + commRank*numThreads;
+        for( Int t=0; t<numThreads; ++t )
+        {
+            threadSources[t].clear();
+            threadScales[t].clear();
+            if( trialBeg+t != 0 && trialBeg+t < ctrl.numTrials )
+                SampleCombinations( n, threadSources[t], threadScales[t] );
+        }
+
+        EL_PARALLEL_FOR
+        for( Int t=0; t<numThreads; ++t )
+        {
+            results[t] = failure;
+            errors[t].clear();
+            if( trialBeg+t >= ctrl.numTrials )
+                continue;
+            try
+            {
+                results[t] = PrunedTrial
+                  ( B, upperBounds, threadSources[t], threadScales[t],
+                    threadVs[t], ctrlTrial );
+            }
+            catch( std::exception& e )
+            { errors[t] = e.what(); }
+        }
+        for( Int t=0; t<numThreads; ++t )
+            if( !errors[t].empty() )
+                RuntimeError
+                ("Pruning trial ",trialBeg+t," failed: ",errors[t]);
+
+        Int best = 0;
+        for( Int t=1; t<numThreads; ++t )
+            if( results[t] < results[best] )
+                best = t;
+        Real result = results[best];
+        Int owner = commRank;
+        if( commSize > 1 )
+        {
+            result = mpi::AllReduce( results[best], mpi::MIN, ctrl.comm );
+            const Int candidate =
+              ( results[best] == result ? commRank : commSize );
+            owner = mpi::AllReduce( candidate, mpi::MIN, ctrl.comm );
+        }
+        if( result < normUpperBound )
+        {
+            if( commRank == owner )
+                v = threadVs[best];
+            else
+                Zeros( v, n, 1 );
+            if( commSize > 1 )
+                mpi::Broadcast( v.Buffer(), n, owner, ctrl.comm );
+            if( ctrl.progress && commRank == 0 )
+                Output("Found lattice member with norm ",result);
+            return result;
+        }
+    }
+    return failure;
+}
+
 } // namespace svp
 
 // NOTE: This norm upper bound is *non-inclusive*
@@ -293,98 +548,9 @@ Base<F> ShortVectorEnumeration
 
     if( ctrl.enumType == GNR_ENUM )
     {
-        auto upperBounds =
-          svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
-
-        // Since we will manually build up a (weakly) pseudorandom
-        // unimodular matrix so that the probabalistic enumerations traverse
-        // different paths, we must keep track of the unimodular matrix so that
-        //  'v' can be returned relative to the original lattice basis
-        auto RNew( R );
-        Matrix<F> BNew, U;
-
-        for( Int trial=0; trial<ctrl.numTrials; ++trial )
-        {
-            BNew = B;
-            Identity( U, n, n );
-            if( trial != 0 )
-            {
-                // Apply a small random unimodular transformation to B
-                const Int numCombines = n;
-                for( Int j=0; j<numCombines; ++j )
-                {
-                    const Int c = SampleUniform( Int(0), n );
-                    const Int scale = SampleUniform( Int(-5), Int(5) );
-                    if( c == j || scale == 0 )
-                        continue; // if scale=-1, we could have singularity
-                    if( ctrl.progress )
-                        Output("  B(:,",j,") += ",scale,"*B(:,",c,")");
-
-                    auto bj = BNew( ALL, j );
-                    auto bc = BNew( ALL, c );
-                    Axpy( scale, bc, bj );
-
-                    auto uj = U(ALL,j);
-                    auto uc = U(ALL,c);
-                    Axpy( scale, uc, uj );
-                }
+        auto upperBounds = svp::GNRUpperBounds( n, normUpperBound, ctrl );
 
-                // The BKZ does not need to be particularly powerful
-                BKZCtrl<Real> ctrl;
-                ctrl.jumpstart = true; // accumulate into U
-                ctrl.blocksize = 10;
-                ctrl.recursive = false;
-                ctrl.lllCtrl.recursive = false;
-                if( ctrl.time )
-                    timer.Start();
-                BKZ( BNew, U, RNew, ctrl );
-                if( ctrl.time )
-                    Output("  Fix-up BKZ: ",timer.Stop()," seconds");
-            }
-            RNew = BNew;
-            qr::ExplicitTriang( RNew ); 
-
-            auto dNew = GetRealPartOfDiagonal( RNew );
-            auto NNew( RNew );
-            auto NNewT = NNew( IR(0,minDim), ALL );
-            DiagonalSolve( LEFT, NORMAL, dNew, NNewT );
-
-            if( ctrl.progress )
-                Output("Starting trial ",trial);
-            if( ctrl.time )
-                timer.Start();
-            Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
-            if( ctrl.time )
-                Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
-            if( result < normUpperBound )
-            {
-                if( ctrl.progress )
-                    Output("Found lattice member with norm ",result);
-                if( trial > 0 )
-                {
-                    if( ctrl.progress )
-                    {
-                        Print( v, "vInner" );
-                        Matrix<F> y;
-                        svp::CoordinatesToSparse( NNew, v, y );
-                        Print( y, "y" );
-                    }
-                    auto vCopy( v );
-                    Gemv( NORMAL, F(1), U, vCopy, F(0), v );
-                }
-                if( ctrl.progress )
-                {
-                    Matrix<F> b;
-                    Zeros( b, m, 1 );
-                    Gemv( NORMAL, F(1), B, v, F(0), b );
-                    Print( v, "v" );
-                    Print( b, "b" );
-                }
-                return result;
-            }
-        }
-        return 2*normUpperBound+1; // return a value above the upper bound
+        return svp::PrunedTrials( B, upperBounds, v, ctrl );
     }
     else if( ctrl.enumType == YSPARSE_ENUM )
     {
@@ -422,6 +588,12 @@ Base<F> ShortVectorEnumeration
             Output("YSPARSE_ENUM(",n,"): ",timer.Stop()," seconds");
         return result;
     }
+    else if( ctrl.enumType == SIEVE_ENUM )
+    {
+        if( ctrl.progress )
+            Output("Starting SIEVE_ENUM(",n,")");
+        return svp::GaussSieve( d, N, normUpperBound, v, ctrl );
+    }
     else
     {
         Matrix<Real> upperBounds;
@@ -431,7 +603,10 @@ Base<F> ShortVectorEnumeration
             Output("Starting FULL_ENUM(",n,")");
         if( ctrl.time )
             timer.Start();
-        Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
+        Real result =
+          ( ctrl.parallel ?
+            svp::ParallelGNREnumeration( d, N, upperBounds, v, ctrl ) :
+            svp::GNREnumeration( d, N, upperBounds, v, ctrl ) );
         if( ctrl.time )
             Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
         return result;
@@ -509,97 +684,11 @@ MultiShortVectorEnumeration
         // GNR enumeration does not yet support multi-enumeration
         const Real normUpperBound = modNormUpperBounds(0);
 
-        auto upperBounds =
-          svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
-
-        // Since we will manually build up a (weakly) pseudorandom
-        // unimodular matrix so that the probabalistic enumerations traverse
-        // different paths, we must keep track of the unimodular matrix so that
-        //  'v' can be returned relative to the original lattice basis
-        auto RNew( R );
-        Matrix<F> BNew, U;
+        auto upperBounds = svp::GNRUpperBounds( n, normUpperBound, ctrl );
 
-        for( Int trial=0; trial<ctrl.numTrials; ++trial )
-        {
-            BNew = B;
-            Identity( U, n, n );
-            if( trial != 0 )
-            {
-                // Apply a small random unimodular transformation to B
-                const Int numCombines = n;
-                for( Int j=0; j<numCombines; ++j )
-                {
-                    const Int c = SampleUniform( Int(0), n );
-                    const Int scale = SampleUniform( Int(-5), Int(5) );
-                    if( c == j || scale == 0 )
-                        continue; // if scale=-1, we could have singularity
-                    if( ctrl.progress )
-                        Output("  B(:,",j,") += ",scale,"*B(:,",c,")");
-
-                    auto bj = BNew( ALL, j );
-                    auto bc = BNew( ALL, c );
-                    Axpy( scale, bc, bj );
-
-                    auto uj = U(ALL,j);
-                    auto uc = U(ALL,c);
-                    Axpy( scale, uc, uj );
-                }
-
-                // The BKZ does not need to be particularly powerful
-                BKZCtrl<Real> ctrl;
-                ctrl.jumpstart = true; // accumulate into U
-                ctrl.blocksize = 10;
-                ctrl.recursive = false;
-                ctrl.lllCtrl.recursive = false;
-                if( ctrl.time )
-                    timer.Start();
-                BKZ( BNew, U, RNew, ctrl );
-                if( ctrl.time )
-                    Output("  Fix-up BKZ: ",timer.Stop()," seconds");
-            }
-            RNew = BNew;
-            qr::ExplicitTriang( RNew ); 
-
-            auto dNew = GetRealPartOfDiagonal( RNew );
-            auto NNew( RNew );
-            auto NNewT = NNew( IR(0,minDim), ALL );
-            DiagonalSolve( LEFT, NORMAL, dNew, NNewT );
-
-            if( ctrl.progress )
-                Output("Starting trial ",trial);
-            if( ctrl.time )
-                timer.Start();
-            Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
-            if( ctrl.time )
-                Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
-            if( result < normUpperBound )
-            {
-                if( ctrl.progress )
-                    Output("Found lattice member with norm ",result);
-                if( trial > 0 )
-                {
-                    if( ctrl.progress )
-                    {
-                        Print( v, "vInner" );
-                        Matrix<F> y;
-                        svp::CoordinatesToSparse( NNew, v, y );
-                        Print( y, "y" );
-                    }
-                    auto vCopy( v );
-                    Gemv( NORMAL, F(1), U, vCopy, F(0), v );
-                }
-                if( ctrl.progress )
-                {
-                    Matrix<F> b;
-                    Zeros( b, m, 1 );
-                    Gemv( NORMAL, F(1), B, v, F(0), b );
-                    Print( v, "v" );
-                    Print( b, "b" );
-                }
-                return pair<Real,Int>(result,0);
-            }
-        }
+        const Real result = svp::PrunedTrials( B, upperBounds, v, ctrl );
+        if( result < normUpperBound )
+            return pair<Real,Int>(result,0);
         for( Int j=0; j<numNested; ++j )
         {
             if( modNormUpperBounds(j) < normUpperBounds(j) )
@@ -647,6 +736,26 @@ MultiShortVectorEnumeration
             Output("YSPARSE_ENUM(",n,"): ",timer.Stop()," seconds");
         return result;
     }
+    else if( ctrl.enumType == SIEVE_ENUM )
+    {
+        // The sieve only searches for the shortest vector
+        const Real normUpperBound = modNormUpperBounds(0);
+        if( ctrl.progress )
+            Output("Starting SIEVE_ENUM(",n,")");
+        const Real result = svp::GaussSieve( d, N, normUpperBound, v, ctrl );
+        if( result < normUpperBound )
+            return pair<Real,Int>(result,0);
+        for( Int j=0; j<numNested; ++j )
+        {
+            if( modNormUpperBounds(j) < normUpperBounds(j) )
+            {
+                Zeros( v, n-j, 1 );
+                v(0) = F(1);
+                return pair<Real,Int>(modNormUpperBounds(j),j);
+            }
+        }
+        return pair<Real,Int>(result,0);
+    }
     else
     {
         // Full enumeration does not (yet) support multi-enumeration
@@ -659,7 +768,10 @@ MultiShortVectorEnumeration
             Output("Starting FULL_ENUM(",n,")");
         if( ctrl.time )
             timer.Start();
-        Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
+        Real result =
+          ( ctrl.parallel ?
+            svp::ParallelGNREnumeration( d, N, upperBounds, v, ctrl ) :
+            svp::GNREnumeration( d, N, upperBounds, v, ctrl ) );
         if( ctrl.time )
             Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
 
@@ -801,8 +913,10 @@ Base<F> ShortestVectorEnumeration
             v = vCand;
             targetNorm = result;
             satisfiedBound = true;
-            // Y-sparse enumeration does not benefit from repetition
-            if( ctrl.enumType == YSPARSE_ENUM ) 
+            // Neither y-sparse enumeration nor sieving benefit from
+            // repetition
+            if( ctrl.enumType == YSPARSE_ENUM ||
+                ctrl.enumType == SIEVE_ENUM ) 
                 return result;
         }
         else if( satisfiedBound )
@@ -895,8 +1009,10 @@ MultiShortestVectorEnumeration
             targetNorms(indexCand) = normCand;
             satisfiedBound = true;
             satisfiedIndex = indexCand;
-            // Y-sparse enumeration does not benefit from repetition
-            if( ctrl.enumType == YSPARSE_ENUM ) 
+            // Neither y-sparse enumeration nor sieving benefit from
+            // repetition
+            if( ctrl.enumType == YSPARSE_ENUM ||
+                ctrl.enumType == SIEVE_ENUM ) 
                 return result;
         }
         else if( satisfiedBound )
@@ -1086,6 +1202,10 @@ MultiShortestVectorEnrichment
           Matrix<F>& v, \
     const EnumCtrl<Base<F>>& ctrl );
 
+#define PROTO_REAL(Real) \
+  PROTO(Real) \
+  template Matrix<Real> svp::PruningCoefficients( Int n, bool linear );
+
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
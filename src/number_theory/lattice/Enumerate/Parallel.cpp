@@ -0,0 +1,351 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace svp {
+
+// The enumeration tree is split by fixing the coordinates v(k:n-1) for each
+// admissible choice of the top nonzero coordinate and the (splitDepth-1)
+// coordinates beneath it; as in GNR enumeration, the top nonzero coordinate
+// is restricted to a coset of Z (or Z[i]) modulo multiplication by the units
+// so that each pair of vectors +-v is only visited once. The resulting
+// subtrees are then traversed independently using the same
+// Schnorr-Euchner zig-zag (or spiral) as GNREnumeration, but with the bounds
+// scaled by the ratio of the current radius to the initial one.
+
+namespace parallel_enum {
+
+template<typename F>
+struct Subtree
+{
+    // The coordinates v(level:n-1) are fixed (and the rest are zero)
+    Int level;
+    Base<F> partialNorm;
+    Matrix<F> v;
+};
+
+template<typename F>
+struct Incumbent
+{
+    // The radius shared with the other processes
+    Base<F> radius;
+
+    // The shortest vector found by this process
+    Base<F> norm;
+    Matrix<F> v;
+};
+
+template<typename F>
+void GenerateSubtrees
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int splitDepth,
+        Int k,
+        Int topNonzero,
+        Base<F> parentNorm,
+        Matrix<F>& v,
+        vector<Subtree<F>>& subtrees )
+{
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    const Real bound = upperBounds((n-1)-k);
+
+    auto visit = [&]( Real partialNorm, Int top )
+    {
+        if( k == 0 || (top < n && top-k+1 >= splitDepth) )
+        {
+            Subtree<F> subtree;
+            subtree.level = k;
+            subtree.partialNorm = partialNorm;
+            subtree.v = v;
+            subtrees.push_back( subtree );
+        }
+        else
+            GenerateSubtrees
+            ( d, NTrans, upperBounds, splitDepth, k-1, top, partialNorm, v,
+              subtrees );
+    };
+
+    SpiralState<F> spiral;
+    if( topNonzero == n )
+    {
+        // Every coordinate above this level is zero
+        if( k > 0 )
+        {
+            v(k) = F(0);
+            visit( parentNorm, topNonzero );
+        }
+        spiral.Initialize( true );
+        while( true )
+        {
+            v(k) = spiral.Step();
+            const Real partialNorm = SafeNorm( parentNorm, d(k)*v(k) );
+            if( partialNorm >= bound )
+                break;
+            visit( partialNorm, k );
+        }
+    }
+    else
+    {
+        F center = 0;
+        const F* nBuf = &NTrans(0,k);
+        for( Int i=k+1; i<n; ++i )
+            center -= nBuf[i]*v(i);
+        spiral.Initialize( center );
+        v(k) = Round(center);
+        while( true )
+        {
+            const Real partialNorm =
+              SafeNorm( parentNorm, d(k)*(v(k)-center) );
+            if( partialNorm >= bound )
+                break;
+            visit( partialNorm, topNonzero );
+            v(k) = spiral.Step();
+        }
+    }
+    v(k) = F(0);
+}
+
+// Record a new shortest vector and return the updated radius
+template<typename F>
+Base<F> Update
+( Incumbent<F>& incumbent,
+  Base<F> partialNorm,
+  const Matrix<F>& v )
+{
+    Base<F> radius;
+#ifdef EL_HYBRID
+    #pragma omp critical(El_svp_ParallelEnumeration)
+#endif
+    {
+        if( partialNorm < incumbent.radius )
+            incumbent.radius = partialNorm;
+        if( partialNorm < incumbent.norm )
+        {
+            incumbent.norm = partialNorm;
+            incumbent.v = v;
+        }
+        radius = incumbent.radius;
+    }
+    return radius;
+}
+
+template<typename F>
+Base<F> Radius( const Incumbent<F>& incumbent )
+{
+    Base<F> radius;
+#ifdef EL_HYBRID
+    #pragma omp critical(El_svp_ParallelEnumeration)
+#endif
+    {
+        radius = incumbent.radius;
+    }
+    return radius;
+}
+
+template<typename F>
+void SearchSubtree
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+  const Subtree<F>& subtree,
+        Incumbent<F>& incumbent )
+{
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    const Int kTop = subtree.level;
+    const Real initialRadius = upperBounds(n-1);
+    // The number of nodes between reads of the shared radius
+    const Int refreshInterval = 4096;
+
+    Real scale = Radius( incumbent ) / initialRadius;
+    if( subtree.partialNorm >= upperBounds((n-1)-kTop)*scale )
+        return;
+    auto v( subtree.v );
+    if( kTop == 0 )
+    {
+        Update( incumbent, subtree.partialNorm, v );
+        return;
+    }
+
+    // See GNREnumeration for the meaning of these variables; since the
+    // coordinates above kTop are arbitrary, every partial sum is initially
+    // marked as unsynchronized
+    Matrix<F> partialSums;
+    Zeros( partialSums, n+1, n );
+    Matrix<Int> sumIndices;
+    Zeros( sumIndices, n+1, 1 );
+    Fill( sumIndices, n-1 );
+    Matrix<Real> partialNorms;
+    Zeros( partialNorms, n+1, 1 );
+    partialNorms(kTop) = subtree.partialNorm;
+    Matrix<F> centers;
+    Zeros( centers, n, 1 );
+    vector<SpiralState<F>> spiralStates(n);
+
+    F* vBuf = v.Buffer();
+    auto moveDown = [&]( Int k )
+    {
+        sumIndices(k) = Max(sumIndices(k),sumIndices(k+1));
+              F* s = &partialSums(0,k);
+        const F* nBuf = &NTrans(0,k);
+        for( Int i=sumIndices(k+1); i>=k+1; --i )
+            s[i] = s[i+1] + nBuf[i]*vBuf[i];
+        centers(k) = -partialSums(k+1,k);
+        vBuf[k] = Round(centers(k));
+        spiralStates[k].Initialize( centers(k) );
+    };
+
+    Int k = kTop-1;
+    moveDown( k );
+    Int numNodes = 0;
+    while( true )
+    {
+        if( ++numNodes == refreshInterval )
+        {
+            numNodes = 0;
+            scale = Radius( incumbent ) / initialRadius;
+        }
+
+        const F entry = d(k)*(vBuf[k] - centers(k));
+        const Real partialNorm = SafeNorm( partialNorms(k+1), entry );
+        partialNorms(k) = partialNorm;
+        if( partialNorm < upperBounds((n-1)-k)*scale )
+        {
+            if( k > 0 )
+            {
+                --k;
+                moveDown( k );
+                continue;
+            }
+            // The remaining siblings are no shorter, so move up afterwards
+            scale = Update( incumbent, partialNorm, v ) / initialRadius;
+        }
+
+        // Move up the tree
+        ++k;
+        if( k == kTop )
+            return;
+        sumIndices(k) = k;
+        vBuf[k] = spiralStates[k].Step();
+    }
+}
+
+} // namespace parallel_enum
+
+template<typename F>
+Base<F> ParallelGNREnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = N.Height();
+    const Int n = N.Width();
+    if( n > m )
+        LogicError("Expected height(N) >= width(N)");
+    if( ctrl.splitDepth < 1 || ctrl.syncInterval < 1 )
+        LogicError("splitDepth and syncInterval must be positive");
+
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+    const Real normUpperBound = upperBounds(n-1);
+    const Real failure = 2*normUpperBound+1;
+    const Int commRank = mpi::Rank( ctrl.comm );
+    const Int commSize = mpi::Size( ctrl.comm );
+
+    Matrix<F> NTrans;
+    Transpose( N, NTrans );
+
+    // Every process redundantly generates the same list of subtrees
+    vector<parallel_enum::Subtree<F>> subtrees;
+    parallel_enum::GenerateSubtrees
+    ( d, NTrans, upperBounds, ctrl.splitDepth, n-1, n, Real(0), v, subtrees );
+    const Int numSubtrees = subtrees.size();
+    if( ctrl.progress && commRank == 0 )
+        Output("Split the enumeration tree into ",numSubtrees," subtrees");
+
+    parallel_enum::Incumbent<F> incumbent;
+    incumbent.radius = normUpperBound;
+    incumbent.norm = failure;
+
+    // Traverse the subtrees cyclically assigned to this process in rounds,
+    // sharing the radius after each
+    const Int localSize =
+      ( commRank < numSubtrees ? (numSubtrees-commRank-1)/commSize+1 : 0 );
+    const Int maxLocalSize = (numSubtrees+commSize-1)/commSize;
+    const Int numRounds = (maxLocalSize+ctrl.syncInterval-1)/ctrl.syncInterval;
+#ifdef EL_HAVE_MPC
+    // MPFR's default precision is per-thread
+    const mpfr_prec_t prec = mpfr::Precision();
+#endif
+    for( Int round=0; round<numRounds; ++round )
+    {
+        const Int localBeg = round*ctrl.syncInterval;
+        const Int localEnd = Min(localBeg+ctrl.syncInterval,localSize);
+        EL_PARALLEL_FOR_DYNAMIC
+        for( Int localIndex=localBeg; localIndex<localEnd; ++localIndex )
+        {
+#ifdef EL_HAVE_MPC
+            mpfr::SetThreadPrecision( prec );
+#endif
+            const Int index = commRank + localIndex*commSize;
+            parallel_enum::SearchSubtree
+            ( d, NTrans, upperBounds, subtrees[index], incumbent );
+        }
+        if( commSize > 1 )
+            incumbent.radius =
+              mpi::AllReduce( incumbent.radius, mpi::MIN, ctrl.comm );
+        if( ctrl.progress && commRank == 0 )
+            Output("Round ",round,": radius=",incumbent.radius);
+    }
+
+    // Broadcast the shortest vector from the (first) process which found it
+    Real norm = incumbent.norm;
+    Int owner = 0;
+    if( commSize > 1 )
+    {
+        norm = mpi::AllReduce( incumbent.norm, mpi::MIN, ctrl.comm );
+        const Int candidate = ( incumbent.norm == norm ? commRank : commSize );
+        owner = mpi::AllReduce( candidate, mpi::MIN, ctrl.comm );
+    }
+    if( norm >= normUpperBound )
+        return failure;
+    if( commRank == owner )
+        v = incumbent.v;
+    if( commSize > 1 )
+        mpi::Broadcast( v.Buffer(), n, owner, ctrl.comm );
+    return norm;
+}
+
+} // namespace svp
+
+#define PROTO(F) \
+  template Base<F> svp::ParallelGNREnumeration \
+  ( const Matrix<Base<F>>& d, \
+    const Matrix<F>& N, \
+    const Matrix<Base<F>>& u, \
+          Matrix<F>& v, \
+    const EnumCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,426 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <cstdint>
+
+namespace El {
+
+namespace svp {
+
+// See Algorithm 1 (the "Gauss sieve") from:
+//
+//   Daniele Micciancio and Panagiotis Voulgaris,
+//   "Faster exponential time algorithms for the shortest vector problem",
+//   SODA 2010.
+//
+// The list of pairwise-reduced vectors is stored compactly: each vector is
+// represented by the single-precision coordinates of R v (scaled so that the
+// first basis vector has unit norm) and its int16 coordinates v relative to
+// the basis. Each scan of the list for a vector which reduces (or is reduced
+// by) the new vector p is split across threads, and the decisions are made
+// using single-precision inner products; only the shortest vector is
+// reevaluated in the working precision.
+
+namespace sieve {
+
+// Use independent partial sums so that the compiler may vectorize the inner
+// product without license to reassociate floating-point sums
+inline float Dot( const float* x, const float* y, Int n )
+{
+    float sum0=0, sum1=0, sum2=0, sum3=0;
+    Int i=0;
+    for( ; i+4<=n; i+=4 )
+    {
+        sum0 += x[i]*y[i];
+        sum1 += x[i+1]*y[i+1];
+        sum2 += x[i+2]*y[i+2];
+        sum3 += x[i+3]*y[i+3];
+    }
+    for( ; i<n; ++i )
+        sum0 += x[i]*y[i];
+    return (sum0+sum1) + (sum2+sum3);
+}
+
+struct Vector
+{
+    vector<float> coords;
+    vector<std::int32_t> coeffs;
+    float normSquared;
+};
+
+class List
+{
+public:
+    explicit List( Int n ) : n_(n) { }
+
+    Int Size() const { return normsSquared_.size(); }
+    const float* Coords( Int i ) const { return &coords_[i*n_]; }
+    const std::int16_t* Coeffs( Int i ) const { return &coeffs_[i*n_]; }
+    float NormSquared( Int i ) const { return normsSquared_[i]; }
+
+    void Push( const Vector& p )
+    {
+        coords_.insert( coords_.end(), p.coords.begin(), p.coords.end() );
+        for( Int i=0; i<n_; ++i )
+            coeffs_.push_back( std::int16_t(p.coeffs[i]) );
+        normsSquared_.push_back( p.normSquared );
+    }
+
+    void Get( Int i, Vector& p ) const
+    {
+        p.coords.assign( Coords(i), Coords(i)+n_ );
+        p.coeffs.assign( Coeffs(i), Coeffs(i)+n_ );
+        p.normSquared = normsSquared_[i];
+    }
+
+    // Overwrite entry i with the last entry
+    void Remove( Int i )
+    {
+        const Int last = Size()-1;
+        if( i != last )
+        {
+            std::copy
+            ( coords_.begin()+last*n_, coords_.begin()+(last+1)*n_,
+              coords_.begin()+i*n_ );
+            std::copy
+            ( coeffs_.begin()+last*n_, coeffs_.begin()+(last+1)*n_,
+              coeffs_.begin()+i*n_ );
+            normsSquared_[i] = normsSquared_[last];
+        }
+        coords_.resize( last*n_ );
+        coeffs_.resize( last*n_ );
+        normsSquared_.pop_back();
+    }
+
+private:
+    Int n_;
+    vector<float> coords_;
+    vector<std::int16_t> coeffs_;
+    vector<float> normsSquared_;
+};
+
+// Recompute the coordinates (and squared norm) of p from its coefficients
+// to avoid the accumulation of rounding errors
+inline void Refresh( const Matrix<float>& RTrans, Vector& p )
+{
+    const Int n = RTrans.Height();
+    p.normSquared = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        const float* rBuf = &RTrans(0,i);
+        float eta = 0;
+        for( Int j=i; j<n; ++j )
+            eta += rBuf[j]*float(p.coeffs[j]);
+        p.coords[i] = eta;
+        p.normSquared += eta*eta;
+    }
+}
+
+// Return false if the coefficients of p - alpha u would overflow int16
+template<typename Coeff>
+bool Subtract
+( Vector& p, float alpha, const float* uCoords, const Coeff* uCoeffs, Int n )
+{
+    const std::int32_t alphaInt = std::int32_t(alpha);
+    for( Int i=0; i<n; ++i )
+    {
+        p.coeffs[i] -= alphaInt*std::int32_t(uCoeffs[i]);
+        if( p.coeffs[i] > INT16_MAX || p.coeffs[i] < INT16_MIN )
+            return false;
+    }
+    for( Int i=0; i<n; ++i )
+        p.coords[i] -= alpha*uCoords[i];
+    return true;
+}
+
+inline bool IsZero( const Vector& p )
+{
+    for( const auto& coeff : p.coeffs )
+        if( coeff != 0 )
+            return false;
+    return true;
+}
+
+// Return true if the vector with squared norm 'uNormSquared' reduces a vector
+// with which it has the inner product 'dot'. The condition is tightened by a
+// small multiple of the single-precision epsilon so that rounding errors
+// cannot cause cycles of reductions.
+inline bool Reduces( float dot, float uNormSquared )
+{
+    const float slack = 1 + 16*limits::Epsilon<float>();
+    return 2*Abs(dot) > slack*uNormSquared;
+}
+
+// Mark the list entries which could reduce p (if 'shorter' is true) or be
+// reduced by p (otherwise)
+inline void MarkCandidates
+( const List& list, const Vector& p, bool shorter, vector<byte>& marks )
+{
+    const Int n = p.coords.size();
+    const Int size = list.Size();
+    marks.resize( size );
+    EL_PARALLEL_FOR
+    for( Int i=0; i<size; ++i )
+    {
+        const float uNormSquared = list.NormSquared(i);
+        const float dot = Dot( list.Coords(i), p.coords.data(), n );
+        if( shorter )
+            marks[i] = ( uNormSquared <= p.normSquared &&
+                         Reduces( dot, uNormSquared ) );
+        else
+            marks[i] = ( uNormSquared > p.normSquared &&
+                         Reduces( dot, p.normSquared ) );
+    }
+}
+
+// Sample an (integral) lattice vector using Klein's randomized rounding
+inline void Sample
+( const Matrix<float>& NTrans,
+  const Matrix<float>& d,
+  const Matrix<float>& RTrans,
+  float width,
+  Vector& p )
+{
+    const Int n = NTrans.Height();
+    p.coeffs.assign( n, 0 );
+    p.coords.resize( n );
+    const float maxCoeff = 1<<10;
+    while( true )
+    {
+        for( Int k=n-1; k>=0; --k )
+        {
+            const float* nBuf = &NTrans(0,k);
+            float center = 0;
+            for( Int i=k+1; i<n; ++i )
+                center -= nBuf[i]*float(p.coeffs[i]);
+            const float stddev = Min( width/d(k), maxCoeff );
+            const float coeff = Round( SampleNormal( center, stddev ) );
+            p.coeffs[k] = std::int32_t(Max(Min(coeff,maxCoeff),-maxCoeff));
+        }
+        if( !IsZero( p ) )
+            break;
+    }
+    Refresh( RTrans, p );
+}
+
+template<typename Real>
+Real Helper
+( const Matrix<Real>& d,
+  const Matrix<Real>& N,
+        Real normUpperBound,
+        Matrix<Real>& v,
+  const EnumCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = N.Height();
+    const Int n = N.Width();
+    if( n > m )
+        LogicError("Expected height(N) >= width(N)");
+    const Real failure = 2*normUpperBound+1;
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+    if( d(0) == Real(0) )
+        LogicError("The first basis vector was zero");
+
+    // Scale the basis so that the first vector has unit norm
+    const Real scale = d(0);
+    Matrix<float> NTrans, RTrans, dFloat;
+    Zeros( NTrans, n, n );
+    Zeros( RTrans, n, n );
+    Zeros( dFloat, n, 1 );
+    for( Int i=0; i<n; ++i )
+    {
+        dFloat(i) = float(d(i)/scale);
+        for( Int j=i; j<n; ++j )
+        {
+            NTrans(j,i) = float(N(i,j));
+            RTrans(j,i) = float(d(i)*N(i,j)/scale);
+        }
+    }
+
+    // The basis vectors themselves are the first entries of the stack
+    vector<Vector> stack(n);
+    for( Int j=0; j<n; ++j )
+    {
+        auto& p = stack[n-1-j];
+        p.coeffs.assign( n, 0 );
+        p.coeffs[j] = 1;
+        p.coords.resize( n );
+        Refresh( RTrans, p );
+    }
+
+    List list( n );
+    Vector p, u;
+    vector<byte> marks;
+    Int numCollisions=0, numSamples=0;
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    while( numCollisions <
+           ctrl.sieveMinCollisions + ctrl.sieveCollisionRatio*list.Size() &&
+           list.Size() < ctrl.sieveMaxListSize )
+    {
+        if( stack.empty() )
+        {
+            Sample( NTrans, dFloat, RTrans, float(ctrl.sieveWidth), p );
+            ++numSamples;
+        }
+        else
+        {
+            p = std::move( stack.back() );
+            stack.pop_back();
+        }
+
+        // Reduce p by the shorter list entries until it is stable
+        bool overflowed = false;
+        bool reduced = true;
+        while( reduced && !overflowed )
+        {
+            reduced = false;
+            MarkCandidates( list, p, true, marks );
+            for( Int i=0; i<list.Size() && !overflowed; ++i )
+            {
+                if( !marks[i] )
+                    continue;
+                const float* uCoords = list.Coords(i);
+                const float uNormSquared = list.NormSquared(i);
+                const float dot = Dot( uCoords, p.coords.data(), n );
+                if( !Reduces( dot, uNormSquared ) )
+                    continue;
+                const float alpha = Round(dot/uNormSquared);
+                overflowed =
+                  !Subtract( p, alpha, uCoords, list.Coeffs(i), n );
+                p.normSquared = Dot( p.coords.data(), p.coords.data(), n );
+                reduced = true;
+            }
+        }
+        if( overflowed || IsZero( p ) )
+        {
+            ++numCollisions;
+            continue;
+        }
+        Refresh( RTrans, p );
+
+        // Move the list entries which p reduces back onto the stack, in
+        // decreasing order so that the swaps in List::Remove are harmless
+        MarkCandidates( list, p, false, marks );
+        for( Int i=list.Size()-1; i>=0; --i )
+        {
+            if( !marks[i] )
+                continue;
+            list.Get( i, u );
+            list.Remove( i );
+            const float dot = Dot( u.coords.data(), p.coords.data(), n );
+            const float alpha = Round(dot/p.normSquared);
+            if( !Subtract( u, alpha, p.coords.data(), p.coeffs.data(), n ) ||
+                IsZero( u ) )
+            {
+                ++numCollisions;
+                continue;
+            }
+            Refresh( RTrans, u );
+            stack.push_back( std::move(u) );
+        }
+        list.Push( p );
+    }
+    if( ctrl.progress )
+        Output
+        ("Gauss sieve of dimension ",n," finished with ",list.Size(),
+         " vectors after ",numSamples," samples and ",numCollisions,
+         " collisions");
+    if( ctrl.time )
+        Output("SIEVE_ENUM(",n,"): ",timer.Stop()," seconds");
+
+    // Find the shortest vector (the stack may contain freshly reduced
+    // vectors which are shorter than any list entry)
+    const std::int16_t* bestCoeffs = nullptr;
+    vector<std::int16_t> stackCoeffs;
+    float bestNormSquared = limits::Infinity<float>();
+    for( Int i=0; i<list.Size(); ++i )
+    {
+        if( list.NormSquared(i) < bestNormSquared )
+        {
+            bestNormSquared = list.NormSquared(i);
+            bestCoeffs = list.Coeffs(i);
+        }
+    }
+    for( const auto& q : stack )
+    {
+        if( q.normSquared < bestNormSquared )
+        {
+            bestNormSquared = q.normSquared;
+            stackCoeffs.assign( q.coeffs.begin(), q.coeffs.end() );
+            bestCoeffs = stackCoeffs.data();
+        }
+    }
+    if( bestCoeffs == nullptr )
+        return failure;
+
+    // Evaluate the norm of the shortest vector in the working precision
+    for( Int j=0; j<n; ++j )
+        v(j) = Real(bestCoeffs[j]);
+    Real normSquared = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        Real eta = 0;
+        for( Int j=i; j<n; ++j )
+            eta += N(i,j)*v(j);
+        eta *= d(i);
+        normSquared += eta*eta;
+    }
+    const Real norm = Sqrt(normSquared);
+    return ( norm < normUpperBound ? norm : failure );
+}
+
+template<typename Real>
+Real Helper
+( const Matrix<Real>& d,
+  const Matrix<Complex<Real>>& N,
+        Real normUpperBound,
+        Matrix<Complex<Real>>& v,
+  const EnumCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    LogicError("Sieving is not yet supported for complex lattices");
+    return Real(0);
+}
+
+} // namespace sieve
+
+template<typename F>
+Base<F> GaussSieve
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return sieve::Helper( d, N, normUpperBound, v, ctrl );
+}
+
+} // namespace svp
+
+#define PROTO(F) \
+  template Base<F> svp::GaussSieve \
+  ( const Matrix<Base<F>>& d, \
+    const Matrix<F>& N, \
+          Base<F> normUpperBound, \
+          Matrix<F>& v, \
+    const EnumCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
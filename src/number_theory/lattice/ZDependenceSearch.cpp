@@ -36,12 +36,97 @@ Int ZDependenceSearch
     return info.nullity;
 }
 
+template<typename F>
+Int ZDependenceSearch
+( const Matrix<F>& z,
+        Base<F> NSqrt,
+        Matrix<F>& B,
+        Matrix<F>& U,
+        Int numStages,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( z.Width() != 1 )
+        LogicError("z was assumed to be a column vector");
+    if( numStages < 1 )
+        LogicError("The number of stages must be positive");
+
+    const Int n = z.Height();
+    const Int m = n+1;
+
+    // Since the reduced basis is [U; sqrt(N) z^T U], the top of B always
+    // holds the accumulated unimodular transformation
+    Identity( B, m, n );
+    auto BTop = B( IR(0,n), ALL );
+    auto bLastRow = B( IR(m-1), ALL );
+
+    Matrix<F> R, UStage;
+    LLLInfo<Real> info;
+    for( Int stage=0; stage<numStages; ++stage )
+    {
+        const Real NSqrtStage =
+          ( stage == numStages-1 ?
+            NSqrt :
+            Pow( NSqrt, Real(stage+1)/Real(numStages) ) );
+        Gemm( TRANSPOSE, NORMAL, F(NSqrtStage), z, BTop, F(0), bLastRow );
+        if( ctrl.progress )
+            Output("Stage ",stage," with sqrt(N)=",NSqrtStage);
+        info = LLL( B, UStage, R, ctrl );
+    }
+    U = BTop;
+
+    return info.nullity;
+}
+
+template<typename F>
+vector<Int> ZDependenceSearch
+( const Matrix<F>& z,
+  const vector<Base<F>>& NSqrtList,
+        vector<Matrix<F>>& BList,
+        vector<Matrix<F>>& UList,
+        Int numStages,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    const Int numSearches = NSqrtList.size();
+    BList.resize( numSearches );
+    UList.resize( numSearches );
+    vector<Int> nullities( numSearches );
+
+    // The LLL timers are shared and the output would be interleaved
+    auto searchCtrl( ctrl );
+    searchCtrl.progress = false;
+    searchCtrl.time = false;
+
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int k=0; k<numSearches; ++k )
+        nullities[k] =
+          ZDependenceSearch
+          ( z, NSqrtList[k], BList[k], UList[k], numStages, searchCtrl );
+    return nullities;
+}
+
 #define PROTO(F) \
   template Int ZDependenceSearch \
   ( const Matrix<F>& z, \
           Base<F> NSqrt, \
           Matrix<F>& B, \
           Matrix<F>& U, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template Int ZDependenceSearch \
+  ( const Matrix<F>& z, \
+          Base<F> NSqrt, \
+          Matrix<F>& B, \
+          Matrix<F>& U, \
+          Int numStages, \
+    const LLLCtrl<Base<F>>& ctrl ); \
+  template vector<Int> ZDependenceSearch \
+  ( const Matrix<F>& z, \
+    const vector<Base<F>>& NSqrtList, \
+          vector<Matrix<F>>& BList, \
+          vector<Matrix<F>>& UList, \
+          Int numStages, \
     const LLLCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
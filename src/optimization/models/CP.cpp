@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Sparsify.hpp"
 
 // A Chebyshev point (CP) minimizes the supremum norm of A x - b, i.e.,
 //
@@ -36,6 +37,15 @@ void CP
   const lp::affine::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( sparsify::Prefer
+        ( A, ctrl.sparseDensity, ctrl.mehrotraCtrl.print, "CP" ) )
+    {
+        SparseMatrix<Real> ASparse;
+        sparsify::Sparsify( A, ASparse );
+        CP( ASparse, b, x, ctrl );
+        return;
+    }
+
     const Int m = A.Height();
     const Int n = A.Width();
     Matrix<Real> c, AHat, bHat, G, h;
@@ -91,6 +101,19 @@ void CP
   const lp::affine::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( sparsify::Prefer
+        ( A, ctrl.sparseDensity, ctrl.mehrotraCtrl.print, "CP" ) )
+    {
+        mpi::Comm comm = A.Grid().Comm();
+        DistSparseMatrix<Real> ASparse(comm);
+        DistMultiVec<Real> bDMV(comm), xDMV(comm);
+        sparsify::Sparsify( A, ASparse );
+        Copy( b, bDMV );
+        CP( ASparse, bDMV, xDMV, ctrl );
+        Copy( xDMV, x );
+        return;
+    }
+
     const Int m = A.Height();
     const Int n = A.Width();
     const Grid& g = A.Grid();
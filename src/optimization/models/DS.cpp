@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Sparsify.hpp"
 
 // The Dantzig selector [1] seeks the solution to the problem
 //
@@ -565,6 +566,14 @@ void DS
   const lp::affine::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( sparsify::Prefer
+        ( A, ctrl.sparseDensity, ctrl.mehrotraCtrl.print, "DS" ) )
+    {
+        SparseMatrix<Real> ASparse;
+        sparsify::Sparsify( A, ASparse );
+        DS( ASparse, b, lambda, x, ctrl );
+        return;
+    }
     ds::Var1( A, b, lambda, x, ctrl );
 }
 
@@ -577,6 +586,18 @@ void DS
   const lp::affine::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( sparsify::Prefer
+        ( A, ctrl.sparseDensity, ctrl.mehrotraCtrl.print, "DS" ) )
+    {
+        mpi::Comm comm = A.Grid().Comm();
+        DistSparseMatrix<Real> ASparse(comm);
+        DistMultiVec<Real> bDMV(comm), xDMV(comm);
+        sparsify::Sparsify( A, ASparse );
+        Copy( b, bDMV );
+        DS( ASparse, bDMV, lambda, xDMV, ctrl );
+        Copy( xDMV, x );
+        return;
+    }
     ds::Var1( A, b, lambda, x, ctrl );
 }
 
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Sparsify.hpp"
 
 // Least Absolute Value (LAV) regression minimizes the one norm of the 
 // residual of a system of equations, i.e.,
@@ -41,6 +42,15 @@ void LAV
   const lp::affine::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( sparsify::Prefer
+        ( A, ctrl.sparseDensity, ctrl.mehrotraCtrl.print, "LAV" ) )
+    {
+        SparseMatrix<Real> ASparse;
+        sparsify::Sparsify( A, ASparse );
+        LAV( ASparse, b, x, ctrl );
+        return;
+    }
+
     const Int m = A.Height();
     const Int n = A.Width();
     const Range<Int> xInd(0,n), uInd(n,n+m), vInd(n+m,n+2*m);
@@ -92,6 +102,19 @@ void LAV
   const lp::affine::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( sparsify::Prefer
+        ( A, ctrl.sparseDensity, ctrl.mehrotraCtrl.print, "LAV" ) )
+    {
+        mpi::Comm comm = A.Grid().Comm();
+        DistSparseMatrix<Real> ASparse(comm);
+        DistMultiVec<Real> bDMV(comm), xDMV(comm);
+        sparsify::Sparsify( A, ASparse );
+        Copy( b, bDMV );
+        LAV( ASparse, bDMV, xDMV, ctrl );
+        Copy( xDMV, x );
+        return;
+    }
+
     const Int m = A.Height();
     const Int n = A.Width();
     const Grid& g = A.Grid();
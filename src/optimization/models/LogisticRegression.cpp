@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Streaming.hpp"
 
 // NOTE: This is adapted from a MATLAB script written by AJ Friend.
 
@@ -134,6 +135,117 @@ Int LogisticRegression
     return ModelFit( logisticFunc, proxFunc, A, b, w, ctrl );
 }
 
+// The proximal SVRG method of
+//
+//   L. Xiao and T. Zhang, "A proximal stochastic gradient method with
+//   progressive variance reduction", SIAM Journal on Optimization, Vol. 24,
+//   No. 4, pp. 2057--2075, 2014,
+//
+// applied to the same objective as above, i.e.,
+//
+//   (1/m) sum_i log(1+exp(-a_i^T w)) + gamma r(w_T),
+//
+// where a_i^T is the i'th row of [diag(q) G, q] and w_T excludes the bias.
+// Each epoch makes one pass over the data to form the full gradient at a
+// snapshot and a second (randomly ordered) pass of minibatch steps.
+
+template<typename Real>
+Int LogisticRegression
+( const string& GFile,
+  const string& qFile,
+        Matrix<Real>& w,
+        Real gamma,
+        Regularization penalty,
+  const StreamingCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    Int numExamples, numFeatures;
+    streaming::Dimensions( GFile, qFile, numExamples, numFeatures );
+    const Int n = numFeatures+1;
+    const Int batchSize = Max(Min(ctrl.batchSize,numExamples),Int(1));
+    const Int numBlocks = (numExamples+batchSize-1) / batchSize;
+
+    // The derivative of log(1+exp(-y)) is -1/(1+exp(y))
+    auto logisticDeriv =
+      []( Real alpha ) -> Real { return -1/(1+Exp(alpha)); };
+    auto lossDeriv = function<Real(Real)>(logisticDeriv);
+
+    auto regProx = [&]( Matrix<Real>& x, Real eta )
+      {
+        auto xT = x( IR(0,n-1), ALL );
+        if( penalty == L1_PENALTY )
+            SoftThreshold( xT, gamma*eta );
+        else if( penalty == L2_PENALTY )
+            FrobeniusProx( xT, 1/(gamma*eta) );
+      };
+
+    Real eta = ctrl.stepSize;
+    Real maxRowNormSq = 0;
+    Zeros( w, n, 1 );
+    Matrix<Real> A, y, Y, W, wSnap, mu, g;
+    Zeros( W, n, 2 );
+    auto wCol = W( ALL, IR(0) );
+    auto wSnapCol = W( ALL, IR(1) );
+    Int numEpochs=0;
+    while( numEpochs < ctrl.maxEpochs )
+    {
+        // Form the full gradient at the snapshot
+        // ======================================
+        wSnap = w;
+        Zeros( mu, n, 1 );
+        for( Int k=0; k<numBlocks; ++k )
+        {
+            const Int rowBeg = k*batchSize;
+            const Int rowEnd = Min(rowBeg+batchSize,numExamples);
+            streaming::ReadLabeledRows( GFile, qFile, rowBeg, rowEnd, A );
+            if( numEpochs == 0 )
+                for( Int i=0; i<A.Height(); ++i )
+                    maxRowNormSq =
+                      Max( maxRowNormSq, Dot(A(IR(i),ALL),A(IR(i),ALL)) );
+            Gemv( NORMAL, Real(1), A, wSnap, y );
+            EntrywiseMap( y, lossDeriv );
+            Gemv( TRANSPOSE, Real(1)/numExamples, A, y, Real(1), mu );
+        }
+        // Each loss is (|| a_i ||_2^2/4)-smooth and the step size is
+        // conservatively chosen as 1/(4 L_max)
+        if( eta <= Real(0) )
+            eta = 1/Max(maxRowNormSq,limits::Epsilon<Real>());
+
+        // Take variance-reduced minibatch steps
+        // =====================================
+        const auto order = streaming::ShuffledBlocks( numBlocks );
+        for( Int k : order )
+        {
+            const Int rowBeg = k*batchSize;
+            const Int rowEnd = Min(rowBeg+batchSize,numExamples);
+            streaming::ReadLabeledRows( GFile, qFile, rowBeg, rowEnd, A );
+
+            // Y := A [w, wSnap]
+            wCol = w;
+            wSnapCol = wSnap;
+            Gemm( NORMAL, NORMAL, Real(1), A, W, Y );
+            EntrywiseMap( Y, lossDeriv );
+            g = Y( ALL, IR(0) );
+            g -= Y( ALL, IR(1) );
+
+            // w := prox(w - eta (mu + A^T g / |B|))
+            Gemv( TRANSPOSE, -eta/(rowEnd-rowBeg), A, g, Real(1), w );
+            Axpy( -eta, mu, w );
+            regProx( w, eta );
+        }
+        ++numEpochs;
+
+        wSnap -= w;
+        const Real change =
+          FrobeniusNorm(wSnap) / Max(FrobeniusNorm(w),Real(1));
+        if( ctrl.progress )
+            Output("epoch ",numEpochs,": relative change of ",change);
+        if( change <= ctrl.tol )
+            break;
+    }
+    return numEpochs;
+}
+
 #define PROTO(Real) \
   template Int LogisticRegression \
   ( const Matrix<Real>& G, \
@@ -148,7 +260,14 @@ Int LogisticRegression
           ElementalMatrix<Real>& w, \
           Real gamma, \
           Regularization penalty, \
-    const ModelFitCtrl<Real>& ctrl );
+    const ModelFitCtrl<Real>& ctrl ); \
+  template Int LogisticRegression \
+  ( const string& GFile, \
+    const string& qFile, \
+          Matrix<Real>& w, \
+          Real gamma, \
+          Regularization penalty, \
+    const StreamingCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
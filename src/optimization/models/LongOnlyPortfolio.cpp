@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./LongOnlyPortfolio/Woodbury.hpp"
 
 namespace El {
 
@@ -430,6 +431,93 @@ void LongOnlyPortfolio
     }
 }
 
+template<typename Real>
+LongOnlyPortfolioSolver<Real>::LongOnlyPortfolioSolver
+( const Matrix<Real>& d,
+  const SparseMatrix<Real>& F,
+        Real gamma,
+  const MehrotraCtrl<Real>& ctrl )
+: gamma_(gamma), ctrl_(ctrl), d_(d), F_(F), haveSolution_(false), y_(0)
+{
+    DEBUG_CSE
+    if( d.Height() != F.Height() )
+        LogicError("d and F should have the same height");
+}
+
+template<typename Real>
+Int LongOnlyPortfolioSolver<Real>::Solve
+( const Matrix<Real>& c, Matrix<Real>& x )
+{
+    DEBUG_CSE
+    if( c.Height() != d_.Height() )
+        LogicError("c should have the same height as d");
+    const Int numIts =
+      portfolio::IPM
+      ( d_, F_, c, gamma_, x_, y_, z_, haveSolution_, ctrl_,
+        mpi::COMM_SELF );
+    haveSolution_ = true;
+    x = x_;
+    return numIts;
+}
+
+template<typename Real>
+void LongOnlyPortfolioSolver<Real>::Reset()
+{
+    DEBUG_CSE
+    haveSolution_ = false;
+}
+
+template<typename Real>
+DistLongOnlyPortfolioSolver<Real>::DistLongOnlyPortfolioSolver
+( const DistMultiVec<Real>& d,
+  const DistSparseMatrix<Real>& F,
+        Real gamma,
+  const MehrotraCtrl<Real>& ctrl )
+: comm_(F.Comm()), gamma_(gamma), ctrl_(ctrl), dLoc_(d.LockedMatrix()),
+  haveSolution_(false), y_(0)
+{
+    DEBUG_CSE
+    if( d.Height() != F.Height() )
+        LogicError("d and F should have the same height");
+    if( d.LocalHeight() != F.LocalHeight() )
+        LogicError("d and F should have the same row distribution");
+
+    // Extract the local rows of F
+    const Int localHeight = F.LocalHeight();
+    const Int firstLocalRow = F.FirstLocalRow();
+    const Int numLocalEntries = F.NumLocalEntries();
+    Zeros( FLoc_, localHeight, F.Width() );
+    FLoc_.Reserve( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        FLoc_.QueueUpdate( F.Row(e)-firstLocalRow, F.Col(e), F.Value(e) );
+    FLoc_.ProcessQueues();
+}
+
+template<typename Real>
+Int DistLongOnlyPortfolioSolver<Real>::Solve
+( const DistMultiVec<Real>& c, DistMultiVec<Real>& x )
+{
+    DEBUG_CSE
+    if( c.LocalHeight() != dLoc_.Height() )
+        LogicError("c should have the same row distribution as d");
+    const Int numIts =
+      portfolio::IPM
+      ( dLoc_, FLoc_, c.LockedMatrix(), gamma_, xLoc_, y_, zLoc_,
+        haveSolution_, ctrl_, comm_ );
+    haveSolution_ = true;
+    x.SetComm( comm_ );
+    x.Resize( c.Height(), 1 );
+    x.Matrix() = xLoc_;
+    return numIts;
+}
+
+template<typename Real>
+void DistLongOnlyPortfolioSolver<Real>::Reset()
+{
+    DEBUG_CSE
+    haveSolution_ = false;
+}
+
 #define PROTO(Real) \
   template void LongOnlyPortfolio \
   ( const SparseMatrix<Real>& Sigma, \
@@ -456,7 +544,9 @@ void LongOnlyPortfolio
     const DistMultiVec<Real>& c, \
           Real gamma, \
           DistMultiVec<Real>& x, \
-    const socp::affine::Ctrl<Real>& ctrl );
+    const socp::affine::Ctrl<Real>& ctrl ); \
+  template class LongOnlyPortfolioSolver<Real>; \
+  template class DistLongOnlyPortfolioSolver<Real>;
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -0,0 +1,351 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace portfolio {
+
+// Solve the long-only portfolio problem
+//
+//   min -c^T x + gamma x^T (D + F F^T) x
+//   s.t. 1^T x = 1, x >= 0,
+//
+// with a Mehrotra predictor-corrector Interior Point Method specialized to
+// the factor structure of the covariance. After eliminating the update of
+// the dual variable z, each search direction requires solves against
+//
+//   M = Delta + 2 gamma F F^T,  where Delta = 2 gamma D + inv(X) Z,
+//
+// which, by the Sherman-Morrison-Woodbury identity,
+//
+//   inv(M) = inv(Delta) - inv(Delta) F inv(K) F^T inv(Delta),
+//   K = I / (2 gamma) + F^T inv(Delta) F,
+//
+// only requires the Cholesky factorization of the r x r matrix K. The single
+// equality constraint is then eliminated via its (scalar) Schur complement,
+// 1^T inv(M) 1.
+//
+// Each process owns a contiguous set of the rows of d, F, c, x, and z, where
+// F is stored as a local sparse matrix, and the reductions onto r-vectors,
+// r x r matrices, and scalars are summed over 'comm'.
+//
+
+// Sigma v := (D + F F^T) v
+template<typename Real>
+void ApplyCovariance
+( const Matrix<Real>& d,
+  const SparseMatrix<Real>& F,
+  const Matrix<Real>& v,
+        Matrix<Real>& Sigmav,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    const Int localHeight = F.Height();
+    const Int r = F.Width();
+    const Int* colBuf = F.LockedTargetBuffer();
+    const Real* valBuf = F.LockedValueBuffer();
+
+    Matrix<Real> w;
+    Zeros( w, r, 1 );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( Int e=F.RowOffset(iLoc); e<F.RowOffset(iLoc+1); ++e )
+            w(colBuf[e]) += valBuf[e]*v(iLoc);
+    mpi::AllReduce( w.Buffer(), r, comm );
+
+    Sigmav.Resize( localHeight, 1 );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        Real value = d(iLoc)*v(iLoc);
+        for( Int e=F.RowOffset(iLoc); e<F.RowOffset(iLoc+1); ++e )
+            value += valBuf[e]*w(colBuf[e]);
+        Sigmav(iLoc) = value;
+    }
+}
+
+// Form inv(Delta) and the lower Cholesky factor of
+// K = I / (2 gamma) + F^T inv(Delta) F
+template<typename Real>
+void WoodburyFactor
+( const SparseMatrix<Real>& F,
+        Real gamma,
+  const Matrix<Real>& delta,
+        Matrix<Real>& invDelta,
+        Matrix<Real>& K,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    const Int localHeight = F.Height();
+    const Int r = F.Width();
+    const Int* colBuf = F.LockedTargetBuffer();
+    const Real* valBuf = F.LockedValueBuffer();
+
+    invDelta.Resize( localHeight, 1 );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        invDelta(iLoc) = 1/delta(iLoc);
+
+    Zeros( K, r, r );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int rowBeg = F.RowOffset(iLoc);
+        const Int rowEnd = F.RowOffset(iLoc+1);
+        for( Int e=rowBeg; e<rowEnd; ++e )
+        {
+            const Real scaledValue = valBuf[e]*invDelta(iLoc);
+            for( Int f=rowBeg; f<rowEnd; ++f )
+                K(colBuf[e],colBuf[f]) += scaledValue*valBuf[f];
+        }
+    }
+    AllReduce( K, comm );
+    ShiftDiagonal( K, 1/(2*gamma) );
+    Cholesky( LOWER, K );
+}
+
+// v := inv(M) v
+template<typename Real>
+void WoodburySolve
+( const SparseMatrix<Real>& F,
+  const Matrix<Real>& invDelta,
+  const Matrix<Real>& K,
+        Matrix<Real>& v,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    const Int localHeight = F.Height();
+    const Int r = F.Width();
+    const Int* colBuf = F.LockedTargetBuffer();
+    const Real* valBuf = F.LockedValueBuffer();
+
+    // v := inv(Delta) v and w := inv(K) F^T v
+    Matrix<Real> w;
+    Zeros( w, r, 1 );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        v(iLoc) *= invDelta(iLoc);
+        for( Int e=F.RowOffset(iLoc); e<F.RowOffset(iLoc+1); ++e )
+            w(colBuf[e]) += valBuf[e]*v(iLoc);
+    }
+    mpi::AllReduce( w.Buffer(), r, comm );
+    cholesky::SolveAfter( LOWER, NORMAL, K, w );
+
+    // v := v - inv(Delta) F w
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        Real update = 0;
+        for( Int e=F.RowOffset(iLoc); e<F.RowOffset(iLoc+1); ++e )
+            update += valBuf[e]*w(colBuf[e]);
+        v(iLoc) -= invDelta(iLoc)*update;
+    }
+}
+
+template<typename Real>
+Real LocalSum( const Matrix<Real>& v )
+{
+    Real sum = 0;
+    for( Int i=0; i<v.Height(); ++i )
+        sum += v(i);
+    return sum;
+}
+
+// The largest alpha in [0,1] such that v + alpha dv >= 0
+template<typename Real>
+Real MaxStep
+( const Matrix<Real>& v,
+  const Matrix<Real>& dv,
+        mpi::Comm comm )
+{
+    Real alpha = 1;
+    for( Int i=0; i<v.Height(); ++i )
+        if( dv(i) < Real(0) )
+            alpha = Min( alpha, -v(i)/dv(i) );
+    return mpi::AllReduce( alpha, mpi::MIN, comm );
+}
+
+// Back the previous solution off of the boundary of the nonnegative orthant
+// in the same manner as the Mehrotra warm starts
+template<typename Real>
+void WarmStart
+( Matrix<Real>& x,
+  Matrix<Real>& z,
+  Int n,
+  const MehrotraCtrl<Real>& ctrl,
+  mpi::Comm comm )
+{
+    DEBUG_CSE
+    const Int localHeight = x.Height();
+    const Real xShift =
+      ctrl.warmStartShift*mpi::AllReduce( MaxNorm(x), mpi::MAX, comm );
+    const Real zShift =
+      ctrl.warmStartShift*mpi::AllReduce( MaxNorm(z), mpi::MAX, comm );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        x(iLoc) = Max( x(iLoc), Real(0) ) + xShift;
+        z(iLoc) = Max( z(iLoc), Real(0) ) + zShift;
+    }
+    const Real mu = mpi::AllReduce( Dot(x,z), comm ) / n;
+    const Real minProduct = ctrl.warmStartCentrality*mu;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real product = x(iLoc)*z(iLoc);
+        if( product < minProduct )
+        {
+            const Real scale = Sqrt( minProduct/product );
+            x(iLoc) *= scale;
+            z(iLoc) *= scale;
+        }
+    }
+}
+
+// Returns the number of iterations
+template<typename Real>
+Int IPM
+( const Matrix<Real>& d,
+  const SparseMatrix<Real>& F,
+  const Matrix<Real>& c,
+        Real gamma,
+        Matrix<Real>& x,
+        Real& y,
+        Matrix<Real>& z,
+        bool warmStart,
+  const MehrotraCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    const Int localHeight = c.Height();
+    const Int n = mpi::AllReduce( localHeight, comm );
+    const bool print = ctrl.print && mpi::Rank(comm) == 0;
+    if( F.Height() != localHeight || d.Height() != localHeight )
+        LogicError("d, F, and c should have the same (local) heights");
+
+    if( warmStart )
+    {
+        WarmStart( x, z, n, ctrl, comm );
+    }
+    else
+    {
+        x.Resize( localHeight, 1 );
+        Fill( x, Real(1)/n );
+        Ones( z, localHeight, 1 );
+        y = 0;
+    }
+
+    const Real cNorm = Sqrt( mpi::AllReduce( Dot(c,c), comm ) );
+    Matrix<Real> Sigmax, rd, rc, delta, invDelta, K, MInvOnes,
+      dxAff, dzAff, dx, dz;
+    Real dyAff, dy;
+
+    // Solve for the search direction with complementarity residual rc,
+    //
+    //   | 2 gamma Sigma  -1  -I | | dx |    | rd |
+    //   |     1^T         0   0 | | dy | = -| rp |,
+    //   |      Z          0   X | | dz |    | rc |
+    //
+    // using the latest factorization of M
+    auto solveDirection =
+      [&]( Real rp, Matrix<Real>& dxDir, Real& dyDir, Matrix<Real>& dzDir )
+      -> void
+      {
+          dxDir.Resize( localHeight, 1 );
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+              dxDir(iLoc) = -rd(iLoc) - rc(iLoc)/x(iLoc);
+          WoodburySolve( F, invDelta, K, dxDir, comm );
+          const Real onesMInvOnes =
+            mpi::AllReduce( LocalSum(MInvOnes), comm );
+          const Real onesDx = mpi::AllReduce( LocalSum(dxDir), comm );
+          dyDir = (-rp - onesDx) / onesMInvOnes;
+          Axpy( dyDir, MInvOnes, dxDir );
+          dzDir.Resize( localHeight, 1 );
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+              dzDir(iLoc) = -(rc(iLoc) + z(iLoc)*dxDir(iLoc)) / x(iLoc);
+      };
+
+    Int numIts = 0;
+    for( ; numIts<=ctrl.maxIts; ++numIts )
+    {
+        // Compute the residuals
+        // =====================
+        ApplyCovariance( d, F, x, Sigmax, comm );
+        rd.Resize( localHeight, 1 );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            rd(iLoc) = 2*gamma*Sigmax(iLoc) - c(iLoc) - y - z(iLoc);
+        const Real rp = mpi::AllReduce( LocalSum(x), comm ) - 1;
+        const Real mu = mpi::AllReduce( Dot(x,z), comm ) / n;
+        const Real primObj =
+          gamma*mpi::AllReduce( Dot(x,Sigmax), comm ) -
+          mpi::AllReduce( Dot(c,x), comm );
+
+        const Real rdNorm = Sqrt( mpi::AllReduce( Dot(rd,rd), comm ) );
+        const Real dualErr = rdNorm / (1+cNorm);
+        const Real primErr = Abs(rp);
+        const Real relGap = n*mu / (1+Abs(primObj));
+        const Real error = Max( Max(dualErr,primErr), relGap );
+        if( print )
+            Output
+            ("iter ",numIts,":\n",Indent(),
+             "  primal objective: ",primObj,"\n",Indent(),
+             "  || r_d ||_2 / (1 + || c ||_2) = ",dualErr,"\n",Indent(),
+             "  | 1^T x - 1 | = ",primErr,"\n",Indent(),
+             "  n mu / (1 + |primal objective|) = ",relGap);
+        if( error <= ctrl.targetTol )
+            break;
+        if( numIts == ctrl.maxIts )
+        {
+            if( error > ctrl.minTol )
+                RuntimeError
+                ("Maximum number of iterations (",ctrl.maxIts,") exceeded "
+                 "without achieving minTol=",ctrl.minTol);
+            break;
+        }
+
+        // Factor M = 2 gamma (D + F F^T) + inv(X) Z and solve against 1
+        // ==============================================================
+        delta.Resize( localHeight, 1 );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            delta(iLoc) = 2*gamma*d(iLoc) + z(iLoc)/x(iLoc);
+        WoodburyFactor( F, gamma, delta, invDelta, K, comm );
+        Ones( MInvOnes, localHeight, 1 );
+        WoodburySolve( F, invDelta, K, MInvOnes, comm );
+
+        // Compute the affine search direction
+        // ===================================
+        rc.Resize( localHeight, 1 );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            rc(iLoc) = x(iLoc)*z(iLoc);
+        solveDirection( rp, dxAff, dyAff, dzAff );
+        const Real alphaAff =
+          Min( MaxStep(x,dxAff,comm), MaxStep(z,dzAff,comm) );
+        Real muAffLoc = 0;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            muAffLoc += (x(iLoc)+alphaAff*dxAff(iLoc))*
+                        (z(iLoc)+alphaAff*dzAff(iLoc));
+        const Real muAff = mpi::AllReduce( muAffLoc, comm ) / n;
+        const Real sigma = Min( Pow(muAff/mu,Real(3)), Real(1) );
+
+        // Compute the combined search direction
+        // =====================================
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            rc(iLoc) -= sigma*mu;
+            if( ctrl.mehrotra )
+                rc(iLoc) += dxAff(iLoc)*dzAff(iLoc);
+        }
+        solveDirection( rp, dx, dy, dz );
+
+        // Take a step towards (but not onto) the boundary
+        // ===============================================
+        const Real alphaMax = Min( MaxStep(x,dx,comm), MaxStep(z,dz,comm) );
+        const Real alpha = Min( ctrl.maxStepRatio*alphaMax, Real(1) );
+        Axpy( alpha, dx, x );
+        y += alpha*dy;
+        Axpy( alpha, dz, z );
+    }
+    return numIts;
+}
+
+} // namespace portfolio
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./ModelFit/ProxGrad.hpp"
 
 // NOTE: 
 // This abstract ADMM routine is adapted from a MATLAB script written by 
@@ -200,6 +201,54 @@ Int ModelFit
     return numIter;
 }
 
+namespace model_fit {
+
+template<typename Real>
+Int FISTA
+( function<Real(Real,Real&)> loss,
+  const CompositeReg<Real>& reg,
+  const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& w,
+  const ProxGradCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    return Accelerated
+      ( loss, reg, A, b, w, ctrl, mpi::COMM_SELF, ctrl.progress );
+}
+
+template<typename Real>
+Int FISTA
+( function<Real(Real,Real&)> loss,
+  const CompositeReg<Real>& reg,
+  const ElementalMatrix<Real>& APre,
+  const ElementalMatrix<Real>& bPre,
+        ElementalMatrix<Real>& wPre,
+  const ProxGradCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR>
+      AProx( APre ),
+      bProx( bPre );
+    auto& A = AProx.GetLocked();
+    auto& b = bProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    // Every entry of the [MC,MR] vectors is owned by a single process, so
+    // the local contributions may be summed over the entire grid
+    DistMatrix<Real> w(g);
+    if( wPre.Height() == A.Width() && wPre.Width() == 1 )
+        Copy( wPre, w );
+    const Int numIter =
+      Accelerated
+      ( loss, reg, A, b, w, ctrl, g.Comm(),
+        ctrl.progress && g.Rank() == 0 );
+    Copy( w, wPre );
+    return numIter;
+}
+
+} // namespace model_fit
+
 #define PROTO(Real) \
   template Int ModelFit \
   ( function<void(Matrix<Real>&,Real)> lossProx, \
@@ -214,7 +263,28 @@ Int ModelFit
     const ElementalMatrix<Real>& A, \
     const ElementalMatrix<Real>& b, \
           ElementalMatrix<Real>& w, \
-    const ModelFitCtrl<Real>& ctrl );
+    const ModelFitCtrl<Real>& ctrl ); \
+  template Int model_fit::FISTA \
+  ( function<Real(Real,Real&)> loss, \
+    const CompositeReg<Real>& reg, \
+    const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+          Matrix<Real>& w, \
+    const model_fit::ProxGradCtrl<Real>& ctrl ); \
+  template Int model_fit::FISTA \
+  ( function<Real(Real,Real&)> loss, \
+    const CompositeReg<Real>& reg, \
+    const ElementalMatrix<Real>& A, \
+    const ElementalMatrix<Real>& b, \
+          ElementalMatrix<Real>& w, \
+    const model_fit::ProxGradCtrl<Real>& ctrl ); \
+  template Int model_fit::BlockCoordinate \
+  ( function<Real(Real,Real&)> loss, \
+    const CompositeReg<Real>& reg, \
+    const ElementalMatrix<Real>& A, \
+    const ElementalMatrix<Real>& b, \
+          ElementalMatrix<Real>& w, \
+    const model_fit::ProxGradCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -0,0 +1,289 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace model_fit {
+
+// Proximal gradient methods for
+//
+//   min_w sum_i f((A w + b)_i) + g(w),
+//
+// where f is a smooth entrywise loss and g is a CompositeReg. Every local
+// loop over the iterates is fused with the composite proximal map, and the
+// scalars needed for the objective, the stopping criterion, and the restart
+// test are combined into a single allreduce per iteration.
+//
+
+template<typename Real>
+inline Matrix<Real>& Local( Matrix<Real>& A ) { return A; }
+template<typename Real>
+inline Matrix<Real>& Local( DistMatrix<Real>& A ) { return A.Matrix(); }
+
+template<typename Real>
+Real RegValue( const CompositeReg<Real>& reg, Real oneNorm, Real sumSquares )
+{
+    return reg.l1*oneNorm + reg.frobenius*Sqrt(sumSquares) +
+           reg.ridge*sumSquares/2;
+}
+
+// Overwrite each entry y_i of Y with f'(y_i) and return the local sum of the
+// f(y_i)
+template<typename Real>
+Real ApplyLoss( const function<Real(Real,Real&)>& loss, Matrix<Real>& Y )
+{
+    DEBUG_CSE
+    const Int height = Y.Height();
+    const Int width = Y.Width();
+    Real lossSum = 0;
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+        {
+            Real& upsilon = Y(i,j);
+            const Real value = upsilon;
+            lossSum += loss( value, upsilon );
+        }
+    return lossSum;
+}
+
+// FISTA with the gradient-based adaptive restart of
+//
+//   B. O'Donoghue and E. Candes, "Adaptive restart for accelerated gradient
+//   schemes", Foundations of Computational Mathematics, Vol. 15, No. 3,
+//   pp. 715--732, 2015.
+//
+template<typename Real,class MatrixType,class VectorType>
+Int Accelerated
+( const function<Real(Real,Real&)>& loss,
+  const CompositeReg<Real>& reg,
+  const MatrixType& A,
+  const VectorType& b,
+        VectorType& w,
+  const ProxGradCtrl<Real>& ctrl,
+        mpi::Comm comm,
+        bool print )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    if( w.Height() != n || w.Width() != 1 )
+        Zeros( w, n, 1 );
+
+    Real tau = ctrl.stepSize;
+    if( tau <= Real(0) )
+    {
+        const Real twoNorm = TwoNormEstimate( A );
+        tau = 1 / (ctrl.lipschitz*Max(twoNorm*twoNorm,limits::Min<Real>()));
+    }
+
+    VectorType v(w), wOld(w), u(w), y(b);
+    Real t = 1;
+    Int numIter = 0;
+    while( numIter < ctrl.maxIter )
+    {
+        ++numIter;
+
+        // u := v - tau A^T f'(A v + b)
+        // ============================
+        y = b;
+        Gemv( NORMAL, Real(1), A, v, Real(1), y );
+        const Real lossLoc = ApplyLoss( loss, Local(y) );
+        u = v;
+        Gemv( ADJOINT, -tau, A, y, Real(1), u );
+
+        // w := prox_{tau g}(u)
+        // ====================
+        wOld = w;
+        w = u;
+        CompositeProx( w, reg, tau );
+
+        // Reduce the objective at v, || w - wOld ||_2, || w ||_2, and the
+        // restart test (v - w)^T (w - wOld)
+        // =================================
+        auto& vLoc = Local(v);
+        auto& wLoc = Local(w);
+        auto& wOldLoc = Local(wOld);
+        Real partials[6] = { lossLoc, 0, 0, 0, 0, 0 };
+        for( Int j=0; j<wLoc.Width(); ++j )
+            for( Int i=0; i<wLoc.Height(); ++i )
+            {
+                const Real omega = wLoc(i,j);
+                const Real diff = omega - wOldLoc(i,j);
+                const Real nu = vLoc(i,j);
+                partials[1] += (nu-omega)*diff;
+                partials[2] += diff*diff;
+                partials[3] += omega*omega;
+                partials[4] += Abs(nu);
+                partials[5] += nu*nu;
+            }
+        mpi::AllReduce( partials, 6, comm );
+        const Real diffNorm = Sqrt(partials[2]);
+        const Real wNorm = Sqrt(partials[3]);
+        if( print )
+            Output
+            ("iter ",numIter,": objective at v = ",
+             partials[0]+RegValue(reg,partials[4],partials[5]),
+             ", || w - wOld ||_2 = ",diffNorm);
+        if( diffNorm <= ctrl.tol*(1+wNorm) )
+            break;
+
+        // Update the momentum (or restart it)
+        // ===================================
+        if( ctrl.restart && partials[1] > Real(0) )
+        {
+            t = 1;
+            v = w;
+        }
+        else
+        {
+            const Real tNew = (1+Sqrt(1+4*t*t))/2;
+            const Real beta = (t-1)/tNew;
+            v = w;
+            v *= 1+beta;
+            Axpy( -beta, wOld, v );
+            t = tNew;
+        }
+    }
+    return numIter;
+}
+
+// A parallel block-coordinate descent in which each process owns a block of
+// the columns of A (and the corresponding entries of w) and all blocks are
+// updated simultaneously using the residual from the start of the sweep, as
+// analyzed in
+//
+//   P. Richtarik and M. Takac, "Parallel coordinate descent methods for big
+//   data optimization", Mathematical Programming, Vol. 156, pp. 433--484,
+//   2016.
+//
+// The step for block k is 1/(omega L_k), where L_k = lipschitz ||A_k||_2^2
+// and omega is the maximum number of blocks with a nonzero in any row of A,
+// so that the nearly block-separable problems typical of sparse data are
+// solved with nearly independent updates. Each sweep requires a single
+// allreduce of the m-vector of residual updates (augmented with the scalars
+// for the objective and the stopping criterion); no process otherwise waits
+// upon the blocks of the others.
+template<typename Real>
+Int BlockCoordinate
+( function<Real(Real,Real&)> loss,
+  const CompositeReg<Real>& reg,
+  const ElementalMatrix<Real>& APre,
+  const ElementalMatrix<Real>& bPre,
+        ElementalMatrix<Real>& wPre,
+  const ProxGradCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    if( reg.frobenius != Real(0) )
+        LogicError("The Frobenius penalty is not block-separable");
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Grid& g = APre.Grid();
+    const bool print = ctrl.progress && g.Rank() == 0;
+
+    // Give each process whole columns of A and replicate the residual
+    DistMatrix<Real,STAR,VR> A_STAR_VR( APre );
+    DistMatrix<Real,STAR,STAR> y( bPre );
+    DistMatrix<Real,VR,STAR> x(g);
+    x.AlignColsWith( A_STAR_VR.DistData() );
+    if( wPre.Height() == n && wPre.Width() == 1 )
+        Copy( wPre, x );
+    else
+        Zeros( x, n, 1 );
+    mpi::Comm comm = A_STAR_VR.DistComm();
+    const auto& ALoc = A_STAR_VR.LockedMatrix();
+    auto& xLoc = x.Matrix();
+    auto& yLoc = y.Matrix();
+    const Int localWidth = ALoc.Width();
+
+    // Count the number of blocks touching each row
+    // ============================================
+    Matrix<Real> workspace;
+    Zeros( workspace, m+4, 1 );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int i=0; i<m; ++i )
+            if( ALoc(i,jLoc) != Real(0) )
+                workspace(i) = 1;
+    mpi::AllReduce( workspace.Buffer(), m, comm );
+    Real omega = 1;
+    for( Int i=0; i<m; ++i )
+        omega = Max( omega, workspace(i) );
+
+    Real tau = ctrl.stepSize;
+    if( tau <= Real(0) && localWidth > 0 )
+    {
+        const Real twoNorm = TwoNormEstimate( ALoc );
+        tau = 1 /
+          (omega*ctrl.lipschitz*Max(twoNorm*twoNorm,limits::Min<Real>()));
+    }
+
+    // y := A x + b
+    // ============
+    auto dy = workspace( IR(0,m), ALL );
+    Zero( dy );
+    Gemv( NORMAL, Real(1), ALoc, xLoc, Real(1), dy );
+    mpi::AllReduce( workspace.Buffer(), m, comm );
+    yLoc += dy;
+
+    Matrix<Real> gradient, xNew;
+    Int numIter = 0;
+    while( numIter < ctrl.maxIter )
+    {
+        ++numIter;
+
+        // The loss and its derivative are computed redundantly
+        gradient = yLoc;
+        const Real lossValue = ApplyLoss( loss, gradient );
+
+        // Update the local block
+        // ======================
+        xNew = xLoc;
+        if( localWidth > 0 )
+        {
+            Gemv( ADJOINT, -tau, ALoc, gradient, Real(1), xNew );
+            CompositeProx( xNew, reg, tau );
+        }
+        Real diffSquares=0, newSquares=0, oneNorm=0, sumSquares=0;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Real chi = xLoc(jLoc);
+            const Real chiNew = xNew(jLoc);
+            xLoc(jLoc) = chiNew - chi;
+            diffSquares += (chiNew-chi)*(chiNew-chi);
+            newSquares += chiNew*chiNew;
+            oneNorm += Abs(chi);
+            sumSquares += chi*chi;
+        }
+
+        // Sum the residual updates and the scalars in a single allreduce
+        // ==============================================================
+        Zero( dy );
+        Gemv( NORMAL, Real(1), ALoc, xLoc, Real(1), dy );
+        workspace(m) = diffSquares;
+        workspace(m+1) = newSquares;
+        workspace(m+2) = oneNorm;
+        workspace(m+3) = sumSquares;
+        mpi::AllReduce( workspace.Buffer(), m+4, comm );
+        yLoc += dy;
+        xLoc = xNew;
+
+        const Real diffNorm = Sqrt(workspace(m));
+        const Real xNorm = Sqrt(workspace(m+1));
+        if( print )
+            Output
+            ("iter ",numIter,": objective = ",
+             lossValue+RegValue(reg,workspace(m+2),workspace(m+3)),
+             ", || x - xOld ||_2 = ",diffNorm);
+        if( diffNorm <= ctrl.tol*(1+xNorm) )
+            break;
+    }
+    Copy( x, wPre );
+    return numIter;
+}
+
+} // namespace model_fit
+} // namespace El
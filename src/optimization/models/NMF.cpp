@@ -2,42 +2,209 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./NMF/HALS.hpp"
+#include "./NMF/BPP.hpp"
 
 namespace El {
 
-// TODO: Better convergence criterions. E.g., accept a relative tolerance
-//       in addition to the maximum number of iterations.
+namespace nmf {
+
+// C := op(A) B
+// ============
+
+template<typename Real>
+void Product
+( Orientation orientation,
+  const Matrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& C )
+{
+    DEBUG_CSE
+    Gemm( orientation, NORMAL, Real(1), A, B, C );
+}
+
+template<typename Real>
+void Product
+( Orientation orientation,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& C )
+{
+    DEBUG_CSE
+    const Int height = ( orientation==NORMAL ? A.Height() : A.Width() );
+    Zeros( C, height, B.Width() );
+    Multiply( orientation, Real(1), A, B, Real(0), C );
+}
+
+template<typename Real>
+void Product
+( Orientation orientation,
+  const DistMatrix<Real>& A,
+  const DistMatrix<Real>& B,
+        DistMatrix<Real>& C )
+{
+    DEBUG_CSE
+    Gemm( orientation, NORMAL, Real(1), A, B, C );
+}
+
+template<typename Real>
+void Product
+( Orientation orientation,
+  const DistSparseMatrix<Real>& A,
+  const DistMatrix<Real>& B,
+        DistMatrix<Real>& C )
+{
+    DEBUG_CSE
+    const Int height = ( orientation==NORMAL ? A.Height() : A.Width() );
+    Zeros( C, height, B.Width() );
+    Multiply( orientation, Real(1), A, B, Real(0), C );
+}
+
+template<typename Real>
+void UpdateFactor
+( const Matrix<Real>& G,
+  const Matrix<Real>& R,
+        Matrix<Real>& F,
+  const NMFCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.approach == NMF_HALS )
+        HALS( G, R, F, ctrl.maxInnerSweeps );
+    else if( ctrl.approach == NMF_ANLS_BPP )
+        BPP( G, R, F, ctrl.maxPivotIts );
+    else
+        LogicError("Unsupported NMF approach");
+}
+
+template<typename Real>
+void UpdateFactor
+( const DistMatrix<Real>& G,
+  const DistMatrix<Real>& R,
+        DistMatrix<Real>& F,
+  const NMFCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    // The rows are updated independently, so redistribute the factor and
+    // its right-hand sides by rows and replicate the Gram matrix
+    DistMatrix<Real,STAR,STAR> G_STAR_STAR( G );
+    DistMatrix<Real,VC,STAR> R_VC_STAR( R ), F_VC_STAR( F );
+    UpdateFactor
+    ( G_STAR_STAR.LockedMatrix(), R_VC_STAR.LockedMatrix(),
+      F_VC_STAR.Matrix(), ctrl );
+    F = F_VC_STAR;
+}
+
+// Update Y^T and X in turn, where each update only requires the product of
+// A (or A^T) with the fixed factor and the Gram matrix of the fixed factor.
+// Both the Gram matrices and the products are reused to cheaply monitor
+//
+//   || A - X Y ||_F^2 = || A ||_F^2 - 2 < A^T X, Y^T > + < X^T X, Y Y^T >,
+//
+// which is printed if 'print' is true (i.e., on the root process).
+//
+template<typename Real,class AMatrix,class FMatrix>
+void Alternate
+( const AMatrix& A,
+        FMatrix& X,
+        FMatrix& YTrans,
+  const NMFCtrl<Real>& ctrl,
+        bool print )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    if( X.Height() != m )
+        LogicError("X should have the same height as A");
+    const Real frobA = FrobeniusNorm( A );
+
+    FMatrix R(X), Q(X), G(X), H(X);
+    Real residLast = -1;
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
+    {
+        // Update Y^T using R := A^T X and G := X^T X
+        // ===========================================
+        Product( TRANSPOSE, A, X, R );
+        Gemm( TRANSPOSE, NORMAL, Real(1), X, X, G );
+        UpdateFactor( G, R, YTrans, ctrl );
+
+        // Monitor the residual norm using H := Y Y^T
+        // ==========================================
+        Gemm( TRANSPOSE, NORMAL, Real(1), YTrans, YTrans, H );
+        const Real residSq =
+          frobA*frobA - 2*Dot(R,YTrans) + Dot(G,H);
+        const Real resid = Sqrt( Max(residSq,Real(0)) );
+        if( print )
+            Output
+            ("iter ",iter,": || A - X Y ||_F / || A ||_F = ",
+             resid/Max(frobA,limits::Epsilon<Real>()));
+        if( ctrl.tol > Real(0) && residLast >= Real(0) &&
+            Abs(residLast-resid) <= ctrl.tol*residLast )
+            break;
+        residLast = resid;
+
+        // Update X using Q := A Y^T and H
+        // ===============================
+        Product( NORMAL, A, YTrans, Q );
+        UpdateFactor( H, Q, X, ctrl );
+    }
+}
+
+} // namespace nmf
 
 template<typename Real>
 void NMF
-( const Matrix<Real>& A, 
+( const Matrix<Real>& A,
         Matrix<Real>& X,
         Matrix<Real>& Y,
   const NMFCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.approach != NMF_NNLS )
+    {
+        Matrix<Real> YTrans;
+        Zeros( YTrans, A.Width(), X.Width() );
+        nmf::Alternate( A, X, YTrans, ctrl, ctrl.progress );
+        Transpose( YTrans, Y );
+        return;
+    }
 
-    Matrix<Real> AAdj, XAdj, YAdj;
+    Matrix<Real> AAdj, XAdj, YAdj, E;
     Adjoint( A, AAdj );
+    const Real frobA = FrobeniusNorm( A );
 
+    Real residLast = -1;
     for( Int iter=0; iter<ctrl.maxIter; ++iter )
     {
         NNLS( X, A, YAdj, ctrl.nnlsCtrl );
         Adjoint( YAdj, Y );
         NNLS( Y, AAdj, XAdj, ctrl.nnlsCtrl );
         Adjoint( XAdj, X );
+
+        if( ctrl.tol > Real(0) || ctrl.progress )
+        {
+            E = A;
+            Gemm( NORMAL, NORMAL, Real(-1), X, Y, Real(1), E );
+            const Real resid = FrobeniusNorm( E );
+            if( ctrl.progress )
+                Output
+                ("iter ",iter,": || A - X Y ||_F / || A ||_F = ",
+                 resid/Max(frobA,limits::Epsilon<Real>()));
+            if( ctrl.tol > Real(0) && residLast >= Real(0) &&
+                Abs(residLast-resid) <= ctrl.tol*residLast )
+                break;
+            residLast = resid;
+        }
     }
 }
 
 template<typename Real>
 void NMF
-( const ElementalMatrix<Real>& APre, 
-        ElementalMatrix<Real>& XPre, 
+( const ElementalMatrix<Real>& APre,
+        ElementalMatrix<Real>& XPre,
         ElementalMatrix<Real>& YPre,
   const NMFCtrl<Real>& ctrl )
 {
@@ -53,18 +220,87 @@ void NMF
     auto& X = XProx.Get();
     auto& Y = YProx.Get();
 
-    DistMatrix<Real> AAdj(A.Grid()), XAdj(A.Grid()), YAdj(A.Grid());
+    if( ctrl.approach != NMF_NNLS )
+    {
+        DistMatrix<Real> YTrans(A.Grid());
+        Zeros( YTrans, A.Width(), X.Width() );
+        nmf::Alternate
+        ( A, X, YTrans, ctrl, ctrl.progress && A.Grid().Rank() == 0 );
+        Transpose( YTrans, Y );
+        return;
+    }
+
+    DistMatrix<Real> AAdj(A.Grid()), XAdj(A.Grid()), YAdj(A.Grid()),
+      E(A.Grid());
     Adjoint( A, AAdj );
+    const Real frobA = FrobeniusNorm( A );
 
+    Real residLast = -1;
     for( Int iter=0; iter<ctrl.maxIter; ++iter )
     {
         NNLS( X, A, YAdj, ctrl.nnlsCtrl );
         Adjoint( YAdj, Y );
         NNLS( Y, AAdj, XAdj, ctrl.nnlsCtrl );
         Adjoint( XAdj, X );
+
+        if( ctrl.tol > Real(0) || ctrl.progress )
+        {
+            E = A;
+            Gemm( NORMAL, NORMAL, Real(-1), X, Y, Real(1), E );
+            const Real resid = FrobeniusNorm( E );
+            if( ctrl.progress && A.Grid().Rank() == 0 )
+                Output
+                ("iter ",iter,": || A - X Y ||_F / || A ||_F = ",
+                 resid/Max(frobA,limits::Epsilon<Real>()));
+            if( ctrl.tol > Real(0) && residLast >= Real(0) &&
+                Abs(residLast-resid) <= ctrl.tol*residLast )
+                break;
+            residLast = resid;
+        }
     }
 }
 
+template<typename Real>
+void NMF
+( const SparseMatrix<Real>& A,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.approach == NMF_NNLS )
+        LogicError("NNLS-based NMF not yet supported for sparse matrices");
+    Matrix<Real> YTrans;
+    Zeros( YTrans, A.Width(), X.Width() );
+    nmf::Alternate( A, X, YTrans, ctrl, ctrl.progress );
+    Transpose( YTrans, Y );
+}
+
+template<typename Real>
+void NMF
+( const DistSparseMatrix<Real>& A,
+        ElementalMatrix<Real>& XPre,
+        ElementalMatrix<Real>& YPre,
+  const NMFCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.approach == NMF_NNLS )
+        LogicError("NNLS-based NMF not yet supported for sparse matrices");
+
+    DistMatrixReadWriteProxy<Real,Real,MC,MR>
+      XProx( XPre );
+    DistMatrixWriteProxy<Real,Real,MC,MR>
+      YProx( YPre );
+    auto& X = XProx.Get();
+    auto& Y = YProx.Get();
+
+    DistMatrix<Real> YTrans(X.Grid());
+    Zeros( YTrans, A.Width(), X.Width() );
+    nmf::Alternate
+    ( A, X, YTrans, ctrl, ctrl.progress && X.Grid().Rank() == 0 );
+    Transpose( YTrans, Y );
+}
+
 #define PROTO(Real) \
   template void NMF \
   ( const Matrix<Real>& A, \
@@ -75,6 +311,16 @@ void NMF
   ( const ElementalMatrix<Real>& A, \
           ElementalMatrix<Real>& X, \
           ElementalMatrix<Real>& Y, \
+    const NMFCtrl<Real>& ctrl ); \
+  template void NMF \
+  ( const SparseMatrix<Real>& A, \
+          Matrix<Real>& X, \
+          Matrix<Real>& Y, \
+    const NMFCtrl<Real>& ctrl ); \
+  template void NMF \
+  ( const DistSparseMatrix<Real>& A, \
+          ElementalMatrix<Real>& X, \
+          ElementalMatrix<Real>& Y, \
     const NMFCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
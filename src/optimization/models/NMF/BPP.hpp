@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace nmf {
+
+// Each row f of F is overwritten with the solution of
+//
+//   min (1/2) f^T G f - r^T f
+//   s.t. f >= 0,
+//
+// where r is the corresponding row of R, via the block principal pivoting
+// method of
+//
+//   J. Kim and H. Park, "Fast nonnegative matrix factorization: An
+//   active-set-like method and comparisons", SIAM Journal on Scientific
+//   Computing, Vol. 33, No. 6, pp. 3261--3281, 2011.
+//
+// Each subproblem is warm-started with the passive set implied by the
+// current row of F. As with nmf::HALS, F and R may be the local portions of
+// identically-aligned [VC,STAR] matrices.
+//
+
+template<typename Real>
+void BPP
+( const Matrix<Real>& G,
+  const Matrix<Real>& R,
+        Matrix<Real>& F,
+        Int maxIts )
+{
+    DEBUG_CSE
+    const Int numRows = F.Height();
+    const Int k = F.Width();
+    // The number of full exchanges allowed without a reduction in the number
+    // of infeasible variables before falling back to single exchanges
+    const Int maxBackups = 3;
+
+    vector<bool> passive(k);
+    vector<Int> passiveInds;
+    Matrix<Real> f, grad, GPP, fP;
+    for( Int i=0; i<numRows; ++i )
+    {
+        for( Int l=0; l<k; ++l )
+            passive[l] = ( F(i,l) > Real(0) );
+
+        Int numBackups = maxBackups;
+        Int bestNumInfeasible = k+1;
+        for( Int it=0; it<maxIts; ++it )
+        {
+            // Solve for the passive variables
+            // ===============================
+            passiveInds.resize( 0 );
+            for( Int l=0; l<k; ++l )
+                if( passive[l] )
+                    passiveInds.push_back( l );
+            const Int numPassive = passiveInds.size();
+            Zeros( f, k, 1 );
+            if( numPassive > 0 )
+            {
+                GetSubmatrix( G, passiveInds, passiveInds, GPP );
+                fP.Resize( numPassive, 1 );
+                for( Int j=0; j<numPassive; ++j )
+                    fP(j) = R(i,passiveInds[j]);
+                LinearSolve( GPP, fP );
+                for( Int j=0; j<numPassive; ++j )
+                    f(passiveInds[j]) = fP(j);
+            }
+
+            // grad := G f - r
+            // ===============
+            Gemv( NORMAL, Real(1), G, f, grad );
+            for( Int l=0; l<k; ++l )
+                grad(l) -= R(i,l);
+
+            // Exchange the infeasible variables
+            // =================================
+            Int numInfeasible = 0, lastInfeasible = -1;
+            for( Int l=0; l<k; ++l )
+            {
+                if( (passive[l] && f(l) < Real(0)) ||
+                    (!passive[l] && grad(l) < Real(0)) )
+                {
+                    ++numInfeasible;
+                    lastInfeasible = l;
+                }
+            }
+            if( numInfeasible == 0 )
+                break;
+            if( numInfeasible < bestNumInfeasible )
+            {
+                bestNumInfeasible = numInfeasible;
+                numBackups = maxBackups;
+            }
+            else if( numBackups > 0 )
+                --numBackups;
+            else
+            {
+                passive[lastInfeasible] = !passive[lastInfeasible];
+                continue;
+            }
+            for( Int l=0; l<k; ++l )
+                if( (passive[l] && f(l) < Real(0)) ||
+                    (!passive[l] && grad(l) < Real(0)) )
+                    passive[l] = !passive[l];
+        }
+
+        for( Int l=0; l<k; ++l )
+            F(i,l) = Max( f(l), Real(0) );
+    }
+}
+
+} // namespace nmf
+} // namespace El
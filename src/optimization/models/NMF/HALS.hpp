@@ -0,0 +1,74 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace nmf {
+
+// Each row f of F is (approximately) updated to solve
+//
+//   min (1/2) f^T G f - r^T f
+//   s.t. f >= 0,
+//
+// where r is the corresponding row of R, using cyclic coordinate descent.
+// With G = X^T X and R = A^T X, this is the hierarchical alternating least
+// squares (HALS) update of Y^T; as G and R are reused, several sweeps are
+// taken until the change in the row falls below a fraction of the change
+// during the first sweep, as in the accelerated HALS of
+//
+//   N. Gillis and F. Glineur, "Accelerated multiplicative updates and
+//   hierarchical ALS algorithms for nonnegative matrix factorization",
+//   Neural Computation, Vol. 24, No. 4, pp. 1085--1105, 2012.
+//
+// The entries are kept above machine epsilon so that no column of F can be
+// permanently zeroed (and its diagonal entry of the next Gram matrix with
+// it). Since the rows are independent, F and R may be the local portions of
+// identically-aligned [VC,STAR] matrices, with G the full Gram matrix.
+//
+
+template<typename Real>
+void HALS
+( const Matrix<Real>& G,
+  const Matrix<Real>& R,
+        Matrix<Real>& F,
+        Int maxSweeps )
+{
+    DEBUG_CSE
+    const Int numRows = F.Height();
+    const Int k = F.Width();
+    const Real floor = limits::Epsilon<Real>();
+    const Real sweepRatio = Real(1)/Real(100);
+    for( Int i=0; i<numRows; ++i )
+    {
+        Real firstChange = 0;
+        for( Int sweep=0; sweep<maxSweeps; ++sweep )
+        {
+            Real change = 0;
+            for( Int l=0; l<k; ++l )
+            {
+                const Real delta = G(l,l);
+                if( delta <= Real(0) )
+                    continue;
+                Real gamma = R(i,l);
+                for( Int j=0; j<k; ++j )
+                    gamma -= F(i,j)*G(j,l);
+                const Real fNew = Max( F(i,l)+gamma/delta, floor );
+                change += (fNew-F(i,l))*(fNew-F(i,l));
+                F(i,l) = fNew;
+            }
+            if( sweep == 0 )
+                firstChange = change;
+            else if( change <= sweepRatio*firstChange )
+                break;
+        }
+    }
+}
+
+} // namespace nmf
+} // namespace El
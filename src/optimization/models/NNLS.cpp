@@ -10,6 +10,7 @@
 #include "./NNLS/SOCP.hpp"
 #include "./NNLS/QP.hpp"
 #include "./NNLS/ADMM.hpp"
+#include "./NNLS/ActiveSet.hpp"
 
 namespace El {
 
@@ -42,6 +43,14 @@ namespace El {
 // Note that the matrix A^T A is cached amongst all instances
 // (and this caching is the reason NNLS supports X and B as matrices).
 //
+// Active-set formulation
+// ----------------------
+//
+// The Lawson-Hanson active-set method is applied to each column of A^T B
+// using the cached Gram matrix A^T A (see nnls::GramActiveSet), with
+// the Cholesky factor of the passive block updated as indices are added
+// and removed.
+//
 
 template<typename Real>
 void NNLS
@@ -55,6 +64,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        nnls::ActiveSet( A, B, X, ctrl.activeSetCtrl );
     else
         nnls::ADMM( A, B, X, ctrl.admmCtrl );
 }
@@ -71,6 +82,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        nnls::ActiveSet( A, B, X, ctrl.activeSetCtrl );
     else
         nnls::ADMM( A, B, X, ctrl.admmCtrl );
 }
@@ -87,6 +100,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        nnls::ActiveSet( A, B, X, ctrl.activeSetCtrl );
     else
         LogicError("ADMM NNLS not yet supported for sparse matrices");
 }
@@ -103,6 +118,9 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        LogicError
+        ("Active-set NNLS not yet supported for distributed sparse matrices");
     else
         LogicError("ADMM NNLS not yet supported for sparse matrices");
 }
@@ -127,7 +145,17 @@ void NNLS
   ( const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& B, \
           DistMultiVec<Real>& X, \
-    const NNLSCtrl<Real>& ctrl );
+    const NNLSCtrl<Real>& ctrl ); \
+  template Int nnls::GramActiveSet \
+  ( const Matrix<Real>& G, \
+    const Matrix<Real>& C, \
+          Matrix<Real>& X, \
+    const nnls::ActiveSetCtrl<Real>& ctrl ); \
+  template Int nnls::GramActiveSet \
+  ( const ElementalMatrix<Real>& G, \
+    const ElementalMatrix<Real>& C, \
+          ElementalMatrix<Real>& X, \
+    const nnls::ActiveSetCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
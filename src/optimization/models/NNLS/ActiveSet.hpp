@@ -0,0 +1,331 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace nnls {
+
+// Solve each problem
+//
+//   min || A x - b ||_2
+//   s.t. x >= 0
+//
+// with the active-set method of Lawson and Hanson, expressed purely in terms
+// of G = A^T A and c = A^T b as in
+//
+//   R. Bro and S. De Jong, "A fast non-negativity-constrained least squares
+//   algorithm", Journal of Chemometrics, Vol. 11, pp. 393--401, 1997.
+//
+// The Cholesky factor of G restricted to the passive set is maintained with
+// the passive indices in the order they were added: an addition appends a
+// row to the factor, while a removal deletes a row and column and restores
+// the trailing block with a rank-one update via CholeskyMod.
+//
+
+namespace active_set {
+
+// Append index j to the factor L of G(P,P), returning false if G(P+j,P+j)
+// is numerically singular
+template<typename Real>
+bool Append
+( const Matrix<Real>& G,
+  const vector<Int>& passiveInds,
+        Int j,
+        Matrix<Real>& L )
+{
+    DEBUG_CSE
+    const Int numPassive = passiveInds.size();
+    const Int n = G.Height();
+    Matrix<Real> l;
+    l.Resize( numPassive, 1 );
+    for( Int q=0; q<numPassive; ++q )
+        l(q) = G(passiveInds[q],j);
+    Real delta = G(j,j);
+    if( numPassive > 0 )
+    {
+        auto LPP = L( IR(0,numPassive), IR(0,numPassive) );
+        Trsv( LOWER, NORMAL, NON_UNIT, LPP, l );
+        delta -= Dot( l, l );
+    }
+    if( delta <= n*limits::Epsilon<Real>()*G(j,j) )
+        return false;
+    for( Int q=0; q<numPassive; ++q )
+        L(numPassive,q) = l(q);
+    L(numPassive,numPassive) = Sqrt(delta);
+    return true;
+}
+
+// Delete the q'th passive index from the factor L of G(P,P)
+template<typename Real>
+void Remove( Int numPassive, Int q, Matrix<Real>& L )
+{
+    DEBUG_CSE
+    if( q < numPassive-1 )
+    {
+        // Fold the deleted column into the trailing block,
+        //   L33 L33^T := L33 L33^T + l32 l32^T,
+        // and then shift the trailing rows up and columns left
+        const Range<Int> ind1(0,q), ind3(q+1,numPassive),
+          ind3Shift(q,numPassive-1);
+        Matrix<Real> v, L31, L33;
+        v = L( ind3, IR(q) );
+        auto L33View = L( ind3, ind3 );
+        CholeskyMod( LOWER, L33View, Real(1), v );
+        L31 = L( ind3, ind1 );
+        L33 = L33View;
+        auto L31Shift = L( ind3Shift, ind1 );
+        auto L33Shift = L( ind3Shift, ind3Shift );
+        L31Shift = L31;
+        L33Shift = L33;
+    }
+    auto lastRow = L( IR(numPassive-1), IR(0,numPassive) );
+    Zero( lastRow );
+}
+
+// s := G(P,P) \ c(P)
+template<typename Real>
+void SolvePassive
+( const Matrix<Real>& L,
+  const Matrix<Real>& c,
+  const vector<Int>& passiveInds,
+        Matrix<Real>& s )
+{
+    DEBUG_CSE
+    const Int numPassive = passiveInds.size();
+    s.Resize( numPassive, 1 );
+    for( Int q=0; q<numPassive; ++q )
+        s(q) = c(passiveInds[q]);
+    auto LPP = L( IR(0,numPassive), IR(0,numPassive) );
+    Trsv( LOWER, NORMAL, NON_UNIT, LPP, s );
+    Trsv( LOWER, TRANSPOSE, NON_UNIT, LPP, s );
+}
+
+} // namespace active_set
+
+template<typename Real>
+Int GramActiveSetLocal
+( const Matrix<Real>& G,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = G.Height();
+    const Int numRHS = C.Width();
+    const Int maxIts = ( ctrl.maxIts > 0 ? ctrl.maxIts : 3*n );
+
+    Zeros( X, n, numRHS );
+    Matrix<Real> L, s, w;
+    Zeros( L, n, n );
+    vector<Int> passiveInds;
+    vector<bool> passive(n), excluded(n);
+    Int maxNumIts = 0;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto c = C( ALL, IR(j) );
+        auto x = X( ALL, IR(j) );
+        const Real tol = ctrl.tol*MaxNorm(c);
+        passiveInds.resize( 0 );
+        for( Int i=0; i<n; ++i )
+        {
+            passive[i] = false;
+            excluded[i] = false;
+        }
+        Zero( L );
+
+        Int numIts = 0;
+        for( ; numIts<maxIts; ++numIts )
+        {
+            // Add the zero variable with the largest dual residual
+            // ====================================================
+            w = c;
+            Gemv( NORMAL, Real(-1), G, x, Real(1), w );
+            Int iMax = -1;
+            Real wMax = tol;
+            for( Int i=0; i<n; ++i )
+            {
+                if( !passive[i] && !excluded[i] && w(i) > wMax )
+                {
+                    iMax = i;
+                    wMax = w(i);
+                }
+            }
+            if( iMax < 0 )
+                break;
+            if( !active_set::Append( G, passiveInds, iMax, L ) )
+            {
+                excluded[iMax] = true;
+                continue;
+            }
+            passive[iMax] = true;
+            passiveInds.push_back( iMax );
+
+            // Step towards the unconstrained passive solution until feasible
+            // ===============================================================
+            bool firstSolve = true;
+            while( true )
+            {
+                const Int numPassive = passiveInds.size();
+                active_set::SolvePassive( L, c, passiveInds, s );
+                if( firstSolve && s(numPassive-1) <= Real(0) )
+                {
+                    // Roundoff has made the new variable inadmissible
+                    active_set::Remove( numPassive, numPassive-1, L );
+                    passive[iMax] = false;
+                    excluded[iMax] = true;
+                    passiveInds.pop_back();
+                    break;
+                }
+                firstSolve = false;
+
+                Real alpha = 1;
+                Int qBlock = -1;
+                for( Int q=0; q<numPassive; ++q )
+                {
+                    if( s(q) <= Real(0) )
+                    {
+                        const Real xi = x(passiveInds[q]);
+                        const Real ratio = xi / (xi-s(q));
+                        if( ratio < alpha )
+                        {
+                            alpha = ratio;
+                            qBlock = q;
+                        }
+                    }
+                }
+                if( qBlock < 0 )
+                {
+                    for( Int q=0; q<numPassive; ++q )
+                        x(passiveInds[q]) = s(q);
+                    break;
+                }
+
+                for( Int q=0; q<numPassive; ++q )
+                {
+                    Real& xi = x(passiveInds[q]);
+                    xi += alpha*(s(q)-xi);
+                }
+                x(passiveInds[qBlock]) = 0;
+                for( Int q=numPassive-1; q>=0; --q )
+                {
+                    const Int i = passiveInds[q];
+                    if( x(i) <= Real(0) )
+                    {
+                        x(i) = 0;
+                        active_set::Remove( Int(passiveInds.size()), q, L );
+                        passive[i] = false;
+                        passiveInds.erase( passiveInds.begin()+q );
+                    }
+                }
+            }
+        }
+        maxNumIts = Max( maxNumIts, numIts );
+    }
+    return maxNumIts;
+}
+
+template<typename Real>
+Int GramActiveSet
+( const Matrix<Real>& G,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    return GramActiveSetLocal( G, C, X, ctrl );
+}
+
+template<typename Real>
+Int GramActiveSet
+( const ElementalMatrix<Real>& G,
+  const ElementalMatrix<Real>& C,
+        ElementalMatrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Grid& grid = C.Grid();
+    DistMatrix<Real,STAR,STAR> G_STAR_STAR( G );
+    DistMatrix<Real,STAR,VR> C_STAR_VR( C ), X_STAR_VR( grid );
+    X_STAR_VR.AlignWith( C_STAR_VR );
+    X_STAR_VR.Resize( G.Height(), C.Width() );
+    Int numIts =
+      GramActiveSetLocal
+      ( G_STAR_STAR.LockedMatrix(), C_STAR_VR.LockedMatrix(),
+        X_STAR_VR.Matrix(), ctrl );
+    numIts = mpi::AllReduce( numIts, mpi::MAX, grid.Comm() );
+    Copy( X_STAR_VR, X );
+    return numIts;
+}
+
+template<typename Real>
+Int ActiveSet
+( const Matrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    Matrix<Real> G, C;
+    Herk( LOWER, ADJOINT, Real(1), A, G );
+    MakeSymmetric( LOWER, G );
+    Gemm( ADJOINT, NORMAL, Real(1), A, B, C );
+    return GramActiveSetLocal( G, C, X, ctrl );
+}
+
+template<typename Real>
+Int ActiveSet
+( const ElementalMatrix<Real>& APre,
+  const ElementalMatrix<Real>& B,
+        ElementalMatrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    DistMatrix<Real> G(A.Grid()), C(A.Grid());
+    Herk( LOWER, ADJOINT, Real(1), A, G );
+    MakeSymmetric( LOWER, G );
+    Gemm( ADJOINT, NORMAL, Real(1), A, B, C );
+    return GramActiveSet( G, C, X, ctrl );
+}
+
+template<typename Real>
+Int ActiveSet
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // G := sum_i a_i a_i^T, where a_i^T is the i'th row of A
+    Matrix<Real> G;
+    Zeros( G, n, n );
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+    for( Int i=0; i<m; ++i )
+    {
+        const Int rowBeg = A.RowOffset(i);
+        const Int rowEnd = A.RowOffset(i+1);
+        for( Int e=rowBeg; e<rowEnd; ++e )
+            for( Int f=rowBeg; f<rowEnd; ++f )
+                G(colBuf[e],colBuf[f]) += valBuf[e]*valBuf[f];
+    }
+
+    Matrix<Real> C;
+    Zeros( C, n, B.Width() );
+    Multiply( ADJOINT, Real(1), A, B, Real(0), C );
+    return GramActiveSetLocal( G, C, X, ctrl );
+}
+
+} // namespace nnls
+} // namespace El
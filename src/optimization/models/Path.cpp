@@ -0,0 +1,461 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Both BPDN and (after halving its objective) the elastic net are instances
+// of
+//
+//   min (1/2) || b - A x ||_2^2 + t || x ||_1 + (mu/2) || x ||_2^2,
+//
+// with (t,mu) = (lambda,0) for BPDN and (t,mu) = (lambda_1/2,lambda_2) for
+// EN. The path is computed with warm-started cyclic coordinate descent [1]
+// restricted to the columns which survive the SAFE test [2] and the
+// sequential strong rule [3]; the latter is heuristic, and so each solve
+// is followed by a KKT check over the columns it discarded.
+//
+// [1] J. Friedman, T. Hastie, and R. Tibshirani, "Regularization paths for
+//     generalized linear models via coordinate descent", Journal of
+//     Statistical Software, Vol. 33, No. 1, 2010.
+//
+// [2] L. El Ghaoui, V. Viallon, and T. Rabbani, "Safe feature elimination in
+//     sparse supervised learning", Pacific Journal of Optimization, Vol. 8,
+//     No. 4, pp. 667--698, 2012.
+//
+// [3] R. Tibshirani, J. Bien, J. Friedman, T. Hastie, N. Simon, J. Taylor,
+//     and R. Tibshirani, "Strong rules for discarding predictors in
+//     lasso-type problems", Journal of the Royal Statistical Society:
+//     Series B, Vol. 74, No. 2, pp. 245--266, 2012.
+//
+
+namespace El {
+
+namespace {
+
+template<typename Real>
+class DenseColumns
+{
+public:
+    DenseColumns( const Matrix<Real>& A ) : A_(A) { }
+
+    Int Height() const { return A_.Height(); }
+    Int Width() const { return A_.Width(); }
+
+    Real Dot( Int j, const Matrix<Real>& r ) const
+    {
+        return blas::Dot
+          ( A_.Height(), A_.LockedBuffer(0,j), 1, r.LockedBuffer(), 1 );
+    }
+
+    void Axpy( Int j, Real alpha, Matrix<Real>& r ) const
+    {
+        blas::Axpy
+        ( A_.Height(), alpha, A_.LockedBuffer(0,j), 1, r.Buffer(), 1 );
+    }
+
+    Real NormSquared( Int j ) const
+    {
+        const Real* aBuf = A_.LockedBuffer(0,j);
+        return blas::Dot( A_.Height(), aBuf, 1, aBuf, 1 );
+    }
+
+private:
+    const Matrix<Real>& A_;
+};
+
+// Coordinate descent needs column access, so store the rows of A^T
+template<typename Real>
+class SparseColumns
+{
+public:
+    SparseColumns( const SparseMatrix<Real>& A )
+    : height_(A.Height())
+    { Transpose( A, AT_ ); }
+
+    Int Height() const { return height_; }
+    Int Width() const { return AT_.Height(); }
+
+    Real Dot( Int j, const Matrix<Real>& r ) const
+    {
+        const Int* targetBuf = AT_.LockedTargetBuffer();
+        const Real* valueBuf = AT_.LockedValueBuffer();
+        const Real* rBuf = r.LockedBuffer();
+        const Int entryEnd = AT_.RowOffset(j+1);
+        Real gamma = 0;
+        for( Int e=AT_.RowOffset(j); e<entryEnd; ++e )
+            gamma += valueBuf[e]*rBuf[targetBuf[e]];
+        return gamma;
+    }
+
+    void Axpy( Int j, Real alpha, Matrix<Real>& r ) const
+    {
+        const Int* targetBuf = AT_.LockedTargetBuffer();
+        const Real* valueBuf = AT_.LockedValueBuffer();
+        Real* rBuf = r.Buffer();
+        const Int entryEnd = AT_.RowOffset(j+1);
+        for( Int e=AT_.RowOffset(j); e<entryEnd; ++e )
+            rBuf[targetBuf[e]] += alpha*valueBuf[e];
+    }
+
+    Real NormSquared( Int j ) const
+    {
+        const Real* valueBuf = AT_.LockedValueBuffer();
+        const Int entryEnd = AT_.RowOffset(j+1);
+        Real gamma = 0;
+        for( Int e=AT_.RowOffset(j); e<entryEnd; ++e )
+            gamma += valueBuf[e]*valueBuf[e];
+        return gamma;
+    }
+
+private:
+    Int height_;
+    SparseMatrix<Real> AT_;
+};
+
+// Alternate between sweeps over the entire strong set and sweeps over its
+// nonzero coordinates, keeping the residual r = b - A x up to date
+template<typename Real,class Columns>
+void CoordinateDescent
+( const Columns& A,
+  const vector<Int>& strongSet,
+  const vector<Real>& colNormsSq,
+        Real t,
+        Real mu,
+        Real tol,
+        Matrix<Real>& x,
+        Matrix<Real>& r,
+  const PathCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    Real* xBuf = x.Buffer();
+    auto update = [&]( Int j ) -> Real
+    {
+        const Real denom = colNormsSq[j] + mu;
+        if( denom == Real(0) )
+            return Real(0);
+        const Real rho = A.Dot( j, r ) + colNormsSq[j]*xBuf[j];
+        const Real xNew = SoftThreshold( rho, t ) / denom;
+        const Real delta = xNew - xBuf[j];
+        if( delta == Real(0) )
+            return Real(0);
+        A.Axpy( j, -delta, r );
+        xBuf[j] = xNew;
+        return Abs(delta)*Sqrt(denom);
+    };
+
+    vector<Int> nonzeros;
+    Int numSweeps = 0;
+    while( numSweeps < ctrl.maxSweeps )
+    {
+        Real maxChange = 0;
+        nonzeros.resize( 0 );
+        for( const Int j : strongSet )
+        {
+            maxChange = Max( maxChange, update(j) );
+            if( xBuf[j] != Real(0) )
+                nonzeros.push_back( j );
+        }
+        ++numSweeps;
+        if( maxChange <= tol )
+            break;
+
+        while( numSweeps < ctrl.maxSweeps )
+        {
+            maxChange = 0;
+            for( const Int j : nonzeros )
+                maxChange = Max( maxChange, update(j) );
+            ++numSweeps;
+            if( maxChange <= tol )
+                break;
+        }
+    }
+}
+
+template<typename Real,class Columns,class Solver>
+void Path
+( const Columns& A,
+  const Matrix<Real>& b,
+        Real scale,
+        Real mu,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl,
+        Solver solve )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( b.Height() != m || b.Width() != 1 )
+        LogicError("b should be a column vector of height ",m);
+    const Real bNorm = FrobeniusNorm( b );
+
+    vector<Real> colNormsSq(n), bCorr(n);
+    Real tMax = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        colNormsSq[j] = A.NormSquared( j );
+        bCorr[j] = A.Dot( j, b );
+        tMax = Max( tMax, Abs(bCorr[j]) );
+    }
+
+    if( lambdas.Height() == 0 )
+    {
+        const Int numLambdas = ctrl.numLambdas;
+        const Real lambdaMax = tMax / scale;
+        lambdas.Resize( numLambdas, 1 );
+        for( Int k=0; k<numLambdas; ++k )
+            lambdas(k) = lambdaMax*
+              Pow( ctrl.minLambdaRatio, Real(k)/Real(Max(numLambdas-1,1)) );
+    }
+    else
+    {
+        if( lambdas.Width() != 1 )
+            LogicError("lambdas should be a column vector");
+        for( Int k=1; k<lambdas.Height(); ++k )
+            if( lambdas(k) > lambdas(k-1) )
+                LogicError("lambdas should be nonincreasing");
+    }
+    const Int numLambdas = lambdas.Height();
+    Zeros( X, n, numLambdas );
+
+    Matrix<Real> x, r;
+    Zeros( x, n, 1 );
+    r = b;
+    vector<Real> corr( bCorr );
+    vector<bool> discarded(n,false), inStrong(n,false);
+    vector<Int> strongSet;
+    const Real tol = ctrl.tol*Max(bNorm,Real(1));
+    Real tPrev = tMax;
+    for( Int k=0; k<numLambdas; ++k )
+    {
+        const Real t = scale*lambdas(k);
+
+        // Screen the columns
+        // ==================
+        strongSet.resize( 0 );
+        for( Int j=0; j<n; ++j )
+        {
+            discarded[j] = false;
+            inStrong[j] = true;
+            if( ctrl.screen && x(j) == Real(0) )
+            {
+                // The SAFE test for the lasso applied to [A; sqrt(mu) I]
+                if( tMax > Real(0) &&
+                    Abs(bCorr[j]) <
+                    t - Sqrt(colNormsSq[j]+mu)*bNorm*(tMax-t)/tMax )
+                    discarded[j] = true;
+                if( discarded[j] || Abs(corr[j]) < 2*t-tPrev )
+                    inStrong[j] = false;
+            }
+            if( inStrong[j] )
+                strongSet.push_back( j );
+        }
+
+        while( true )
+        {
+            solve( strongSet, colNormsSq, t, tol, x, r );
+
+            // Check the KKT conditions of the columns rejected by the
+            // strong rule
+            // =======================================================
+            Int numViolations = 0;
+            for( Int j=0; j<n; ++j )
+            {
+                if( discarded[j] )
+                    continue;
+                corr[j] = A.Dot( j, r );
+                if( !inStrong[j] && Abs(corr[j]) > t )
+                {
+                    inStrong[j] = true;
+                    strongSet.push_back( j );
+                    ++numViolations;
+                }
+            }
+            if( numViolations == 0 )
+                break;
+            if( ctrl.progress )
+                Output
+                ("  ",numViolations," KKT violations for lambda=",lambdas(k));
+        }
+
+        auto xk = X( ALL, IR(k) );
+        xk = x;
+        if( ctrl.progress )
+            Output
+            ("lambda=",lambdas(k),": ",strongSet.size()," of ",n,
+             " columns solved for, ",ZeroNorm(x)," nonzeros");
+        tPrev = t;
+    }
+}
+
+template<typename Real>
+void IPMPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Real scale,
+        Real mu,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    auto solve =
+      [&]( const vector<Int>& strongSet, const vector<Real>& colNormsSq,
+           Real t, Real tol, Matrix<Real>& x, Matrix<Real>& r )
+      {
+          Zeros( x, n, 1 );
+          r = b;
+          const Int numStrong = strongSet.size();
+          if( numStrong == 0 )
+              return;
+          Matrix<Real> AStrong, xStrong;
+          GetSubmatrix( A, IR(0,m), strongSet, AStrong );
+          if( mu == Real(0) )
+          {
+              BPDNCtrl<Real> bpdnCtrl;
+              bpdnCtrl.ipmCtrl = ctrl.ipmCtrl;
+              BPDN( AStrong, b, t, xStrong, bpdnCtrl );
+          }
+          else
+              EN( AStrong, b, 2*t, mu, xStrong, ctrl.ipmCtrl );
+          for( Int i=0; i<numStrong; ++i )
+              x(strongSet[i]) = xStrong(i);
+          Gemv( NORMAL, Real(-1), AStrong, xStrong, Real(1), r );
+      };
+    Path( DenseColumns<Real>(A), b, scale, mu, lambdas, X, ctrl, solve );
+}
+
+template<typename Real,class Columns>
+void CoordinateDescentPath
+( const Columns& A,
+  const Matrix<Real>& b,
+        Real scale,
+        Real mu,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    auto solve =
+      [&]( const vector<Int>& strongSet, const vector<Real>& colNormsSq,
+           Real t, Real tol, Matrix<Real>& x, Matrix<Real>& r )
+      {
+          CoordinateDescent
+          ( A, strongSet, colNormsSq, t, mu, tol, x, r, ctrl );
+      };
+    Path( A, b, scale, mu, lambdas, X, ctrl, solve );
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void BPDNPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.useIPM )
+        IPMPath( A, b, Real(1), Real(0), lambdas, X, ctrl );
+    else
+        CoordinateDescentPath
+        ( DenseColumns<Real>(A), b, Real(1), Real(0), lambdas, X, ctrl );
+}
+
+template<typename Real>
+void BPDNPath
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.useIPM )
+        LogicError
+        ("IPM-based BPDN paths not yet supported for sparse matrices");
+    CoordinateDescentPath
+    ( SparseColumns<Real>(A), b, Real(1), Real(0), lambdas, X, ctrl );
+}
+
+template<typename Real>
+void ENPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda2,
+        Matrix<Real>& lambda1s,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.useIPM )
+        IPMPath( A, b, Real(1)/Real(2), lambda2, lambda1s, X, ctrl );
+    else
+        CoordinateDescentPath
+        ( DenseColumns<Real>(A), b, Real(1)/Real(2), lambda2,
+          lambda1s, X, ctrl );
+}
+
+template<typename Real>
+void ENPath
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda2,
+        Matrix<Real>& lambda1s,
+        Matrix<Real>& X,
+  const PathCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.useIPM )
+        LogicError("IPM-based EN paths not yet supported for sparse matrices");
+    CoordinateDescentPath
+    ( SparseColumns<Real>(A), b, Real(1)/Real(2), lambda2,
+      lambda1s, X, ctrl );
+}
+
+#define PROTO(Real) \
+  template void BPDNPath \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+          Matrix<Real>& lambdas, \
+          Matrix<Real>& X, \
+    const PathCtrl<Real>& ctrl ); \
+  template void BPDNPath \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+          Matrix<Real>& lambdas, \
+          Matrix<Real>& X, \
+    const PathCtrl<Real>& ctrl ); \
+  template void ENPath \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+          Real lambda2, \
+          Matrix<Real>& lambda1s, \
+          Matrix<Real>& X, \
+    const PathCtrl<Real>& ctrl ); \
+  template void ENPath \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+          Real lambda2, \
+          Matrix<Real>& lambda1s, \
+          Matrix<Real>& X, \
+    const PathCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
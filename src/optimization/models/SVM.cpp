@@ -9,6 +9,7 @@
 #include <El.hpp>
 #include "./SVM/ADMM.hpp"
 #include "./SVM/IPM.hpp"
+#include "./SVM/Streaming.hpp"
 
 namespace El {
 
@@ -70,6 +71,18 @@ void SVM
     svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
+template<typename Real>
+Int SVM
+( const string& AFile,
+  const string& dFile,
+        Real lambda,
+        Matrix<Real>& x,
+  const StreamingCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    return svm::Streaming( AFile, dFile, lambda, x, ctrl );
+}
+
 #define PROTO(Real) \
   template void SVM \
   ( const Matrix<Real>& A, \
@@ -94,7 +107,13 @@ void SVM
     const DistMultiVec<Real>& d, \
           Real lambda, \
           DistMultiVec<Real>& x, \
-    const SVMCtrl<Real>& ctrl );
+    const SVMCtrl<Real>& ctrl ); \
+  template Int SVM \
+  ( const string& AFile, \
+    const string& dFile, \
+          Real lambda, \
+          Matrix<Real>& x, \
+    const StreamingCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
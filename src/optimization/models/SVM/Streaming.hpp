@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../Streaming.hpp"
+
+// With the bias appended to the weights, the dual of
+//
+//   min_x (1/2) || x ||_2^2 + lambda sum_i max(0, 1 - a_i^T x),
+//
+// where a_i^T is the i'th row of [diag(d) A, d], is
+//
+//   max_{0 <= alpha <= lambda} 1^T alpha - (1/2) || A^T alpha ||_2^2,
+//
+// with x = A^T alpha. Each minibatch takes a projected gradient step on its
+// block of alpha, with step size 1/Q, where Q is an upper bound on the
+// squared two-norm of the block of rows. By the Moreau decomposition, the
+// step can be written in terms of the proximal map of the hinge loss as
+//
+//   alpha_B := (prox(y) - y) / Q,  with y = A_B x - Q alpha_B,
+//
+// where prox is the hinge-loss proximal map with parameter 1/(lambda Q).
+// See, e.g., C.-J. Hsieh et al., "A dual coordinate descent method for
+// large-scale linear SVM", Proceedings of ICML, 2008, for the case of
+// single-row blocks.
+
+namespace El {
+namespace svm {
+
+namespace {
+
+// An upper bound on the square of the two-norm of A formed from a few steps
+// of the power method (with a safety factor) and the Frobenius norm
+template<typename Real>
+Real SquaredTwoNormBound( const Matrix<Real>& A )
+{
+    DEBUG_CSE
+    const Int numPowerIts = 10;
+    const Real safety = Real(11)/Real(10);
+    const Real frobSq = Pow( FrobeniusNorm(A), Real(2) );
+    if( frobSq == Real(0) )
+        return Real(1);
+
+    Matrix<Real> u, v;
+    Ones( v, A.Width(), 1 );
+    v *= 1/FrobeniusNorm(v);
+    Real estimate = 0;
+    for( Int it=0; it<numPowerIts; ++it )
+    {
+        Gemv( NORMAL, Real(1), A, v, u );
+        Gemv( TRANSPOSE, Real(1), A, u, v );
+        estimate = FrobeniusNorm( v );
+        if( estimate == Real(0) )
+            break;
+        v *= 1/estimate;
+    }
+    return Min( safety*estimate, frobSq );
+}
+
+} // anonymous namespace
+
+template<typename Real>
+Int Streaming
+( const string& AFile,
+  const string& dFile,
+        Real lambda,
+        Matrix<Real>& x,
+  const StreamingCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    Int numExamples, numFeatures;
+    streaming::Dimensions( AFile, dFile, numExamples, numFeatures );
+    const Int n = numFeatures+1;
+    const Int batchSize = Max(Min(ctrl.batchSize,numExamples),Int(1));
+    const Int numBlocks = (numExamples+batchSize-1) / batchSize;
+
+    Matrix<Real> alpha, blockBounds;
+    Zeros( alpha, numExamples, 1 );
+    Zeros( blockBounds, numBlocks, 1 );
+    Zeros( x, n, 1 );
+
+    Matrix<Real> A, y, prox, xOld;
+    Int numEpochs=0;
+    while( numEpochs < ctrl.maxEpochs )
+    {
+        xOld = x;
+        const auto order = streaming::ShuffledBlocks( numBlocks );
+        for( Int k : order )
+        {
+            const Int rowBeg = k*batchSize;
+            const Int rowEnd = Min(rowBeg+batchSize,numExamples);
+            streaming::ReadLabeledRows( AFile, dFile, rowBeg, rowEnd, A );
+            if( blockBounds(k) == Real(0) )
+                blockBounds(k) = SquaredTwoNormBound( A );
+            const Real Q = blockBounds(k);
+            auto alphaB = alpha( IR(rowBeg,rowEnd), ALL );
+
+            // y := A_B x - Q alpha_B
+            y = alphaB;
+            Gemv( NORMAL, Real(1), A, x, -Q, y );
+
+            // alpha_B := (prox(y) - y) / Q, and x += A_B^T (change in alpha_B)
+            prox = y;
+            HingeLossProx( prox, 1/(lambda*Q) );
+            prox -= y;
+            prox *= 1/Q;
+            y = prox;
+            y -= alphaB;
+            alphaB = prox;
+            Gemv( TRANSPOSE, Real(1), A, y, Real(1), x );
+        }
+        ++numEpochs;
+
+        xOld -= x;
+        const Real change =
+          FrobeniusNorm(xOld) / Max(FrobeniusNorm(x),Real(1));
+        if( ctrl.progress )
+            Output("epoch ",numEpochs,": relative change of ",change);
+        if( change <= ctrl.tol )
+            break;
+    }
+    return numEpochs;
+}
+
+} // namespace svm
+} // namespace El
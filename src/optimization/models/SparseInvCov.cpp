@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./SparseInvCov/QUIC.hpp"
 
 // These implementations are adaptations of the solver described at
 //    http://www.stanford.edu/~boyd/papers/admm/covsel/covsel.html
@@ -16,6 +17,10 @@
 //     minimize Tr(S*X) - log det X + lambda ||X||_1
 // where S is the empirical covariance of the data matrix D.
 //
+// For real data, the same problem can instead be solved with the
+// second-order QUIC method after splitting it into independent subproblems
+// (see SparseInvCov/QUIC.hpp).
+//
 
 namespace El {
 
@@ -33,6 +38,20 @@ Int SparseInvCov
     Matrix<F> S;
     Covariance( D, S );
     MakeHermitian( LOWER, S );
+
+    if( ctrl.useQUIC )
+    {
+        Zeros( Z, n, n );
+        function<void(const vector<Int>&,const Matrix<F>&)> store =
+          [&]( const vector<Int>& inds, const Matrix<F>& ZSub )
+          {
+              const Int size = inds.size();
+              for( Int jSub=0; jSub<size; ++jSub )
+                  for( Int iSub=0; iSub<size; ++iSub )
+                      Z(inds[iSub],inds[jSub]) = ZSub(iSub,jSub);
+          };
+        return sparse_inv_cov::QUIC( S, lambda, ctrl, store );
+    }
    
     Int numIter=0;
     Matrix<F> X, U, ZOld, XHat, T;
@@ -128,6 +147,32 @@ Int SparseInvCov
     DistMatrix<F> S(g);
     Covariance( D, S );
     MakeHermitian( LOWER, S );
+
+    if( ctrl.useQUIC )
+    {
+        // Each process solves the components assigned to it and the
+        // (disjoint) blocks are then summed
+        DistMatrix<F,STAR,STAR> S_STAR_STAR( S ), Z_STAR_STAR( g );
+        Zeros( Z_STAR_STAR, n, n );
+        auto& ZLoc = Z_STAR_STAR.Matrix();
+        function<void(const vector<Int>&,const Matrix<F>&)> store =
+          [&]( const vector<Int>& inds, const Matrix<F>& ZSub )
+          {
+              const Int size = inds.size();
+              for( Int jSub=0; jSub<size; ++jSub )
+                  for( Int iSub=0; iSub<size; ++iSub )
+                      ZLoc(inds[iSub],inds[jSub]) = ZSub(iSub,jSub);
+          };
+        Int numIter =
+          sparse_inv_cov::QUIC
+          ( S_STAR_STAR.LockedMatrix(), lambda, ctrl, store,
+            g.Rank(), g.Size() );
+        for( Int j=0; j<n; ++j )
+            mpi::AllReduce( ZLoc.Buffer(0,j), n, g.Comm() );
+        numIter = mpi::AllReduce( numIter, mpi::MAX, g.Comm() );
+        Copy( Z_STAR_STAR, Z );
+        return numIter;
+    }
    
     Int numIter=0;
     DistMatrix<F> X(g), U(g), ZOld(g), XHat(g), T(g);
@@ -205,6 +250,37 @@ Int SparseInvCov
     return numIter;
 }
 
+template<typename F>
+Int SparseInvCov
+( const Matrix<F>& D,
+        Base<F> lambda,
+        SparseMatrix<F>& Z,
+  const SparseInvCovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( !ctrl.useQUIC )
+        LogicError("Sparse storage of the precision matrix requires QUIC");
+    const Int n = D.Width();
+
+    Matrix<F> S;
+    Covariance( D, S );
+    MakeHermitian( LOWER, S );
+
+    Zeros( Z, n, n );
+    function<void(const vector<Int>&,const Matrix<F>&)> store =
+      [&]( const vector<Int>& inds, const Matrix<F>& ZSub )
+      {
+          const Int size = inds.size();
+          for( Int jSub=0; jSub<size; ++jSub )
+              for( Int iSub=0; iSub<size; ++iSub )
+                  if( ZSub(iSub,jSub) != F(0) )
+                      Z.QueueUpdate( inds[iSub], inds[jSub], ZSub(iSub,jSub) );
+      };
+    const Int numIter = sparse_inv_cov::QUIC( S, lambda, ctrl, store );
+    Z.ProcessQueues();
+    return numIter;
+}
+
 #define PROTO(F) \
   template Int SparseInvCov \
   ( const Matrix<F>& D, \
@@ -215,6 +291,11 @@ Int SparseInvCov
   ( const ElementalMatrix<F>& D, \
           Base<F> lambda, \
           ElementalMatrix<F>& Z, \
+    const SparseInvCovCtrl<Base<F>>& ctrl ); \
+  template Int SparseInvCov \
+  ( const Matrix<F>& D, \
+          Base<F> lambda, \
+          SparseMatrix<F>& Z, \
     const SparseInvCovCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
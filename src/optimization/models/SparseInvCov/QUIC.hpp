@@ -0,0 +1,322 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace sparse_inv_cov {
+
+// The second-order method of
+//
+//   C.-J. Hsieh, M.A. Sustik, I.S. Dhillon, and P. Ravikumar, "QUIC:
+//   Quadratic approximation for sparse inverse covariance estimation",
+//   Journal of Machine Learning Research, Vol. 15, pp. 2911--2947, 2014,
+//
+// for minimizing Tr(S*X) - log det X + lambda ||X||_1. Each Newton
+// direction is computed with coordinate descent restricted to the free set
+// (the nonzeros of X and the entries whose gradient exceeds lambda in
+// magnitude), and the step length is chosen with an Armijo line search whose
+// positive-definiteness test and log-determinant come from a Cholesky
+// factorization.
+//
+// Before running QUIC, the variables are split into the connected
+// components of the graph with edges |S(i,j)| > lambda, as the solution is
+// block diagonal over them; see
+//
+//   R. Mazumder and T. Hastie, "Exact covariance thresholding into connected
+//   components for large-scale graphical lasso", Journal of Machine Learning
+//   Research, Vol. 13, pp. 781--794, 2012.
+//
+
+template<typename Real>
+bool CholeskyLogDet( const Matrix<Real>& X, Matrix<Real>& L, Real& logDet )
+{
+    DEBUG_CSE
+    L = X;
+    try
+    {
+        Cholesky( LOWER, L );
+    }
+    catch( NonHPDMatrixException& e )
+    {
+        return false;
+    }
+    const Int n = L.Height();
+    logDet = 0;
+    for( Int i=0; i<n; ++i )
+        logDet += 2*Log(L(i,i));
+    return true;
+}
+
+template<typename Real>
+Int QUICBlock
+( const Matrix<Real>& S,
+        Real lambda,
+        Matrix<Real>& X,
+  const SparseInvCovCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int n = S.Height();
+    const Int maxLineSearchIts = 50;
+    const Real sigma = Real(1)/Real(1000);
+
+    Zeros( X, n, n );
+    for( Int i=0; i<n; ++i )
+        X(i,i) = 1/(S(i,i)+lambda);
+
+    Matrix<Real> L, LTrial, W, G, D, U, XTrial;
+    Real logDet;
+    if( !CholeskyLogDet( X, L, logDet ) )
+        LogicError("Initial guess was not positive-definite");
+    Real f = -logDet + Dot(S,X) + lambda*EntrywiseNorm(X,Real(1));
+
+    vector<Int> freeRows, freeCols;
+    Int numIter=0;
+    for( ; numIter<ctrl.maxIter; ++numIter )
+    {
+        // W := inv(X) and G := S - W
+        // ==========================
+        Identity( W, n, n );
+        cholesky::SolveAfter( LOWER, NORMAL, L, W );
+        G = S;
+        G -= W;
+
+        // Form the free set and the minimum-norm subgradient
+        // ==================================================
+        freeRows.resize( 0 );
+        freeCols.resize( 0 );
+        Real subgradNorm = 0;
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=j; i<n; ++i )
+            {
+                const Real xi = X(i,j);
+                const Real gamma = G(i,j);
+                Real subgrad;
+                bool isFree = true;
+                if( xi != Real(0) )
+                    subgrad = Abs(gamma + lambda*Sgn(xi));
+                else
+                {
+                    subgrad = Max( Abs(gamma)-lambda, Real(0) );
+                    isFree = ( subgrad > Real(0) );
+                }
+                subgradNorm += ( i==j ? subgrad : 2*subgrad );
+                if( isFree )
+                {
+                    freeRows.push_back( i );
+                    freeCols.push_back( j );
+                }
+            }
+        }
+        const Real XOne = EntrywiseNorm( X, Real(1) );
+        if( ctrl.progress )
+            Output
+            ("QUIC iter ",numIter,": objective=",f,", ||subgrad||_1=",
+             subgradNorm,", ||X||_1=",XOne,", |free|=",freeRows.size());
+        if( subgradNorm <= ctrl.relTol*XOne )
+            break;
+
+        // Coordinate descent for the Newton direction D, with U = D W
+        // ===========================================================
+        Zeros( D, n, n );
+        Zeros( U, n, n );
+        const Int numSweeps = 1 + numIter/3;
+        const Int numFree = freeRows.size();
+        for( Int sweep=0; sweep<numSweeps; ++sweep )
+        {
+            for( Int e=0; e<numFree; ++e )
+            {
+                const Int i = freeRows[e];
+                const Int j = freeCols[e];
+                const Real wDw =
+                  blas::Dot
+                  ( n, W.LockedBuffer(0,i), 1, U.LockedBuffer(0,j), 1 );
+                const Real a =
+                  ( i==j ? W(i,i)*W(i,i) : W(i,j)*W(i,j) + W(i,i)*W(j,j) );
+                const Real b = S(i,j) - W(i,j) + wDw;
+                const Real c = X(i,j) + D(i,j);
+                const Real mu = -c + SoftThreshold( c-b/a, lambda/a );
+                if( mu == Real(0) )
+                    continue;
+                D(i,j) += mu;
+                blas::Axpy
+                ( n, mu, W.LockedBuffer(j,0), W.LDim(),
+                         U.Buffer(i,0), U.LDim() );
+                if( i != j )
+                {
+                    D(j,i) += mu;
+                    blas::Axpy
+                    ( n, mu, W.LockedBuffer(i,0), W.LDim(),
+                             U.Buffer(j,0), U.LDim() );
+                }
+            }
+        }
+
+        // Armijo line search over positive-definite iterates
+        // ==================================================
+        XTrial = X;
+        XTrial += D;
+        const Real delta =
+          Dot(G,D) + lambda*(EntrywiseNorm(XTrial,Real(1))-XOne);
+        Real alpha = 1;
+        bool accepted = false;
+        Real fTrial = f;
+        for( Int lsIt=0; lsIt<maxLineSearchIts; ++lsIt )
+        {
+            XTrial = X;
+            Axpy( alpha, D, XTrial );
+            Real logDetTrial;
+            if( CholeskyLogDet( XTrial, LTrial, logDetTrial ) )
+            {
+                fTrial = -logDetTrial + Dot(S,XTrial) +
+                  lambda*EntrywiseNorm(XTrial,Real(1));
+                if( fTrial <= f + sigma*alpha*delta )
+                {
+                    accepted = true;
+                    break;
+                }
+            }
+            alpha /= 2;
+        }
+        if( !accepted )
+        {
+            if( ctrl.progress )
+                Output("QUIC line search failed to make progress");
+            break;
+        }
+        X = XTrial;
+        L = LTrial;
+        f = fTrial;
+    }
+    return numIter;
+}
+
+// Partition the variables into the connected components of the graph with
+// edges |S(i,j)| > lambda (or return a single component if not screening)
+template<typename Real>
+vector<vector<Int>>
+Components( const Matrix<Real>& S, Real lambda, bool screen )
+{
+    DEBUG_CSE
+    const Int n = S.Height();
+    vector<Int> parent(n);
+    for( Int i=0; i<n; ++i )
+        parent[i] = ( screen ? i : 0 );
+    auto root = [&]( Int i ) -> Int
+    {
+        while( parent[i] != i )
+        {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    if( screen )
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=j+1; i<n; ++i )
+            {
+                if( Abs(S(i,j)) > lambda )
+                {
+                    const Int iRoot = root(i);
+                    const Int jRoot = root(j);
+                    if( iRoot != jRoot )
+                        parent[Max(iRoot,jRoot)] = Min(iRoot,jRoot);
+                }
+            }
+        }
+    }
+
+    vector<vector<Int>> components;
+    vector<Int> componentOf(n,-1);
+    for( Int i=0; i<n; ++i )
+    {
+        const Int iRoot = root(i);
+        if( componentOf[iRoot] < 0 )
+        {
+            componentOf[iRoot] = components.size();
+            components.emplace_back();
+        }
+        components[componentOf[iRoot]].push_back( i );
+    }
+    return components;
+}
+
+// Solve for the components assigned to this process (the components are
+// greedily assigned, largest first, to the least-loaded process, with the
+// cost of a component modeled as the cube of its size) and pass each
+// component's indices and precision block to 'store', so that the solution
+// need never be formed densely. The maximum number of QUIC iterations over
+// the local components is returned.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+Int QUIC
+( const Matrix<Real>& S,
+        Real lambda,
+  const SparseInvCovCtrl<Real>& ctrl,
+        function<void(const vector<Int>&,const Matrix<Real>&)> store,
+        int commRank=0,
+        int commSize=1 )
+{
+    DEBUG_CSE
+    auto components = Components( S, lambda, ctrl.screen );
+    const Int numComponents = components.size();
+    vector<Int> order(numComponents);
+    for( Int c=0; c<numComponents; ++c )
+        order[c] = c;
+    std::sort
+    ( order.begin(), order.end(),
+      [&]( Int c0, Int c1 )
+      { return components[c0].size() > components[c1].size(); } );
+    vector<double> load(commSize,0.);
+
+    Matrix<Real> SSub, XSub;
+    Int numIter = 0;
+    for( const Int c : order )
+    {
+        const auto& inds = components[c];
+        const Int size = inds.size();
+        const int owner =
+          std::min_element( load.begin(), load.end() ) - load.begin();
+        load[owner] += double(size)*double(size)*double(size);
+        if( owner != commRank )
+            continue;
+
+        if( size == 1 )
+        {
+            XSub.Resize( 1, 1 );
+            XSub(0,0) = 1/(S(inds[0],inds[0])+lambda);
+        }
+        else
+        {
+            GetSubmatrix( S, inds, inds, SSub );
+            numIter = Max( numIter, QUICBlock( SSub, lambda, XSub, ctrl ) );
+        }
+        store( inds, XSub );
+    }
+    return numIter;
+}
+
+template<typename Real>
+Int QUIC
+( const Matrix<Complex<Real>>& S,
+        Real lambda,
+  const SparseInvCovCtrl<Real>& ctrl,
+        function<void(const vector<Int>&,const Matrix<Complex<Real>>&)>
+          store,
+        int commRank=0,
+        int commSize=1 )
+{
+    DEBUG_CSE
+    LogicError("QUIC is only supported for real data");
+    return 0;
+}
+
+} // namespace sparse_inv_cov
+} // namespace El
@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace sparsify {
+
+// Models such as LAV, DS, and CP have both dense and sparse formulations, and
+// the latter are typically much cheaper when only a small fraction of the
+// entries of a dense input matrix are nonzero. The following routines decide
+// between the two formulations based upon the measured density and convert
+// the dense input into its sparse equivalent.
+
+// Return true if at most 'ratio' of the entries of A are nonzero, printing
+// the decision if 'print' is true
+template<typename Real>
+bool Prefer
+( const Matrix<Real>& A,
+        Real ratio,
+        bool print,
+  const string& model )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( ratio <= Real(0) || m == 0 || n == 0 )
+        return false;
+    const Real density = Real(ZeroNorm(A)) / (Real(m)*Real(n));
+    const bool useSparse = ( density <= ratio );
+    if( print )
+        Output
+        (model,": A has density ",density,", so the ",
+         (useSparse ? "sparse" : "dense")," formulation will be used");
+    return useSparse;
+}
+
+template<typename Real>
+bool Prefer
+( const ElementalMatrix<Real>& A,
+        Real ratio,
+        bool print,
+  const string& model )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( ratio <= Real(0) || m == 0 || n == 0 )
+        return false;
+    const Real density = Real(ZeroNorm(A)) / (Real(m)*Real(n));
+    const bool useSparse = ( density <= ratio );
+    if( print && A.Grid().Rank() == 0 )
+        Output
+        (model,": A has density ",density,", so the ",
+         (useSparse ? "sparse" : "dense")," formulation will be used");
+    return useSparse;
+}
+
+// ASparse := A
+template<typename Real>
+void Sparsify( const Matrix<Real>& A, SparseMatrix<Real>& ASparse )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( ASparse, m, n );
+    ASparse.Reserve( ZeroNorm(A) );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A(i,j) != Real(0) )
+                ASparse.QueueUpdate( i, j, A(i,j) );
+    ASparse.ProcessQueues();
+}
+
+// ASparse := A, where ASparse is distributed over the communicator of the
+// grid of A
+template<typename Real>
+void Sparsify
+( const ElementalMatrix<Real>& APre,
+        DistSparseMatrix<Real>& ASparse )
+{
+    DEBUG_CSE
+    // Ensure that each entry is owned by a single process
+    DistMatrixReadProxy<Real,Real,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Real* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+
+    ASparse.SetComm( A.Grid().Comm() );
+    Zeros( ASparse, m, n );
+    const int commRank = mpi::Rank( ASparse.Comm() );
+    Int numLocal=0, numRemote=0;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            if( ABuf[iLoc+jLoc*ALDim] != Real(0) )
+            {
+                if( ASparse.RowOwner(A.GlobalRow(iLoc)) == commRank )
+                    ++numLocal;
+                else
+                    ++numRemote;
+            }
+    ASparse.Reserve( numLocal, numRemote );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Real value = ABuf[iLoc+jLoc*ALDim];
+            if( value != Real(0) )
+                ASparse.QueueUpdate( A.GlobalRow(iLoc), j, value );
+        }
+    }
+    ASparse.ProcessQueues();
+}
+
+} // namespace sparsify
+} // namespace El
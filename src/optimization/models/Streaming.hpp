@@ -0,0 +1,64 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace streaming {
+
+// Return the number of examples and features of a design matrix and its
+// labels stored in the given (BINARY format) files
+inline void Dimensions
+( const string& GFile,
+  const string& qFile,
+        Int& numExamples,
+        Int& numFeatures )
+{
+    DEBUG_CSE
+    Int qHeight, qWidth;
+    ReadBinaryDimensions( GFile, numExamples, numFeatures );
+    ReadBinaryDimensions( qFile, qHeight, qWidth );
+    if( qHeight != numExamples || qWidth != 1 )
+        LogicError
+        ("Expected a ",numExamples," x 1 label vector but found a ",
+         qHeight," x ",qWidth," matrix");
+}
+
+// Read rows [rowBeg,rowEnd) of the labeled design matrix, [diag(q) G, q]
+template<typename Real>
+void ReadLabeledRows
+( const string& GFile,
+  const string& qFile,
+  Int rowBeg, Int rowEnd,
+  Matrix<Real>& A )
+{
+    DEBUG_CSE
+    Matrix<Real> G, q;
+    ReadBinaryRows( G, GFile, rowBeg, rowEnd );
+    ReadBinaryRows( q, qFile, rowBeg, rowEnd );
+    const Int numFeatures = G.Width();
+    A.Resize( G.Height(), numFeatures+1 );
+    auto AL = A( ALL, IR(0,numFeatures) );
+    auto aR = A( ALL, IR(numFeatures) );
+    AL = G;
+    DiagonalScale( LEFT, NORMAL, q, AL );
+    aR = q;
+}
+
+// A random ordering of the row blocks
+inline vector<Int> ShuffledBlocks( Int numBlocks )
+{
+    vector<Int> order(numBlocks);
+    for( Int k=0; k<numBlocks; ++k )
+        order[k] = k;
+    std::shuffle( order.begin(), order.end(), Generator() );
+    return order;
+}
+
+} // namespace streaming
+} // namespace El
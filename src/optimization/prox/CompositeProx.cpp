@@ -0,0 +1,149 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The composite proximal map returns the solution to
+//
+//   arg min tau g(A) + 1/2 || A - A0 ||_F^2
+//      A
+//
+// for g(A) = l1 || vec(A) ||_1 + frobenius || A ||_F + ridge/2 || A ||_F^2,
+// restricted to lower <= A <= upper. Writing S = SoftThreshold(A0,tau l1),
+// the solution is
+//
+//   Clip( max(0,1-tau frobenius/|| S ||_F) S / (1+tau ridge), lower, upper ),
+//
+// where the clipping is only exact for separable g, i.e., frobenius = 0.
+
+namespace El {
+
+namespace {
+
+template<typename Real>
+Real SoftThresholdedSquare( const Matrix<Real>& A, Real threshold )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    Real sumSquares = 0;
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+        {
+            const Real sigma = Max( Abs(A(i,j))-threshold, Real(0) );
+            sumSquares += sigma*sigma;
+        }
+    return sumSquares;
+}
+
+template<typename Real>
+void ScaledSoftThresholdClip
+( Matrix<Real>& A,
+  Real threshold,
+  Real scale,
+  Real lower,
+  Real upper )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    Real* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<width; ++j )
+    {
+        Real* aCol = &ABuf[j*ALDim];
+        for( Int i=0; i<height; ++i )
+        {
+            const Real alpha = aCol[i];
+            Real sigma = Max( Abs(alpha)-threshold, Real(0) )*scale;
+            if( alpha < Real(0) )
+                sigma = -sigma;
+            aCol[i] = Max( lower, Min( upper, sigma ) );
+        }
+    }
+}
+
+template<typename Real>
+void CheckCompositeReg( const CompositeReg<Real>& reg )
+{
+    if( reg.frobenius != Real(0) &&
+        (reg.lower != -limits::Infinity<Real>() ||
+         reg.upper != limits::Infinity<Real>()) )
+        LogicError("Cannot combine a Frobenius penalty with clipping");
+    if( reg.l1 < Real(0) || reg.frobenius < Real(0) || reg.ridge < Real(0) )
+        LogicError("The penalty weights should be nonnegative");
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void CompositeProx( Matrix<Real>& A, const CompositeReg<Real>& reg, Real tau )
+{
+    DEBUG_CSE
+    CheckCompositeReg( reg );
+    const Real threshold = tau*reg.l1;
+    Real scale = 1/(1+tau*reg.ridge);
+    if( reg.frobenius != Real(0) )
+    {
+        const Real frobS = Sqrt( SoftThresholdedSquare( A, threshold ) );
+        if( frobS <= tau*reg.frobenius )
+        {
+            Zero( A );
+            return;
+        }
+        scale *= 1-tau*reg.frobenius/frobS;
+    }
+    ScaledSoftThresholdClip( A, threshold, scale, reg.lower, reg.upper );
+}
+
+template<typename Real>
+void CompositeProx
+( AbstractDistMatrix<Real>& A,
+  const CompositeReg<Real>& reg,
+        Real tau )
+{
+    DEBUG_CSE
+    CheckCompositeReg( reg );
+    const Real threshold = tau*reg.l1;
+    Real scale = 1/(1+tau*reg.ridge);
+    if( reg.frobenius != Real(0) )
+    {
+        Real sumSquares = 0;
+        if( A.Participating() )
+        {
+            sumSquares = SoftThresholdedSquare( A.LockedMatrix(), threshold );
+            sumSquares = mpi::AllReduce( sumSquares, A.DistComm() );
+        }
+        mpi::Broadcast( sumSquares, A.Root(), A.CrossComm() );
+        const Real frobS = Sqrt( sumSquares );
+        if( frobS <= tau*reg.frobenius )
+        {
+            Zero( A );
+            return;
+        }
+        scale *= 1-tau*reg.frobenius/frobS;
+    }
+    ScaledSoftThresholdClip
+    ( A.Matrix(), threshold, scale, reg.lower, reg.upper );
+}
+
+#define PROTO(Real) \
+  template void CompositeProx \
+  ( Matrix<Real>& A, const CompositeReg<Real>& reg, Real tau ); \
+  template void CompositeProx \
+  ( AbstractDistMatrix<Real>& A, const CompositeReg<Real>& reg, Real tau );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_RANDOMIZED_HPP
+#define EL_SVT_RANDOMIZED_HPP
+
+namespace El {
+
+namespace svt {
+
+// Soft-threshold the singular values of A using a randomized range finder
+// (see Halko, Martinsson, and Tropp, "Finding structure with randomness",
+// SIAM Review, 2011) whose sketch is warm-started with the right singular
+// subspace 'V' returned by the previous call. The width of 'V' serves as the
+// rank estimate; if the smallest sampled singular value still exceeds the
+// threshold, the sample size is doubled until the sketch captures every
+// singular value which survives the thresholding. On exit, 'V' holds the
+// right singular vectors of the surviving singular values.
+
+template<typename F>
+Int Randomized
+( Matrix<F>& A,
+  Base<F> tau,
+  Matrix<F>& V,
+  Int oversample,
+  Int numPowerIts,
+  bool relative )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        V.Resize( n, 0 );
+        return 0;
+    }
+    if( V.Height() != n )
+        V.Resize( n, 0 );
+
+    Int sampleSize = Min( Max(V.Width(),Int(1))+oversample, minDim );
+    Matrix<F> Omega, Q, B, U, UB, VB;
+    Matrix<Real> s;
+    while( true )
+    {
+        Gaussian( Omega, n, sampleSize );
+        const Int numWarm = Min( V.Width(), sampleSize );
+        if( numWarm > 0 )
+        {
+            auto OmegaWarm = Omega( ALL, IR(0,numWarm) );
+            OmegaWarm = V( ALL, IR(0,numWarm) );
+        }
+
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        for( Int it=0; it<numPowerIts; ++it )
+        {
+            qr::ExplicitUnitary( Q );
+            Gemm( ADJOINT, NORMAL, F(1), A, Q, Omega );
+            qr::ExplicitUnitary( Omega );
+            Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        }
+        qr::ExplicitUnitary( Q );
+
+        Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( B, UB, s, VB, ctrl );
+
+        const Real threshold = ( relative ? tau*s(0) : tau );
+        if( sampleSize == minDim || s(sampleSize-1) <= threshold )
+            break;
+        sampleSize = Min( 2*sampleSize, minDim );
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+    if( rank == 0 )
+    {
+        Zero( A );
+        V.Resize( n, 0 );
+        return 0;
+    }
+    auto UBL = UB( ALL, IR(0,rank) );
+    auto VBL = VB( ALL, IR(0,rank) );
+    auto sT = s( IR(0,rank), ALL );
+    Gemm( NORMAL, NORMAL, F(1), Q, UBL, U );
+    DiagonalScale( RIGHT, NORMAL, sT, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, VBL, F(0), A );
+    V = VBL;
+
+    return rank;
+}
+
+template<typename F>
+Int Randomized
+( ElementalMatrix<F>& APre,
+  Base<F> tau,
+  ElementalMatrix<F>& VPre,
+  Int oversample,
+  Int numPowerIts,
+  bool relative )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre ), VProx( VPre );
+    auto& A = AProx.Get();
+    auto& V = VProx.Get();
+    const Grid& g = A.Grid();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        V.Resize( n, 0 );
+        return 0;
+    }
+    if( V.Height() != n )
+        V.Resize( n, 0 );
+
+    Int sampleSize = Min( Max(V.Width(),Int(1))+oversample, minDim );
+    DistMatrix<F> Omega(g), Q(g), B(g), U(g), UB(g), VB(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    while( true )
+    {
+        Gaussian( Omega, n, sampleSize );
+        const Int numWarm = Min( V.Width(), sampleSize );
+        if( numWarm > 0 )
+        {
+            auto OmegaWarm = Omega( ALL, IR(0,numWarm) );
+            OmegaWarm = V( ALL, IR(0,numWarm) );
+        }
+
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        for( Int it=0; it<numPowerIts; ++it )
+        {
+            qr::ExplicitUnitary( Q );
+            Gemm( ADJOINT, NORMAL, F(1), A, Q, Omega );
+            qr::ExplicitUnitary( Omega );
+            Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        }
+        qr::ExplicitUnitary( Q );
+
+        Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( B, UB, s, VB, ctrl );
+
+        const Real threshold = ( relative ? tau*s.Get(0,0) : tau );
+        if( sampleSize == minDim || s.Get(sampleSize-1,0) <= threshold )
+            break;
+        sampleSize = Min( 2*sampleSize, minDim );
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+    if( rank == 0 )
+    {
+        Zero( A );
+        V.Resize( n, 0 );
+        return 0;
+    }
+    auto UBL = UB( ALL, IR(0,rank) );
+    auto VBL = VB( ALL, IR(0,rank) );
+    auto sT = s( IR(0,rank), ALL );
+    Gemm( NORMAL, NORMAL, F(1), Q, UBL, U );
+    DiagonalScale( RIGHT, NORMAL, sT, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, VBL, F(0), A );
+    V = VBL;
+
+    return rank;
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_RANDOMIZED_HPP
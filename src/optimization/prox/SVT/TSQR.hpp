@@ -15,7 +15,11 @@ namespace svt {
 // Singular-value soft-thresholding based on TSQR
 
 template<typename F>
-Int TSQR( ElementalMatrix<F>& APre, Base<F> tau, bool relative )
+Int TSQR
+( ElementalMatrix<F>& APre,
+  Base<F> tau,
+  qr::TreeData<F>& treeData,
+  bool relative )
 {
     DEBUG_CSE
 
@@ -27,10 +31,7 @@ Int TSQR( ElementalMatrix<F>& APre, Base<F> tau, bool relative )
         return SVT( A.Matrix(), tau, relative );
 
     Int zeroNorm;
-    qr::TreeData<F> treeData;
-    treeData.QR0 = A.LockedMatrix();
-    QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
-    qr::ts::Reduce( A, treeData );
+    qr::ts::Refactor( A, treeData );
     if( A.ColRank() == 0 )
         zeroNorm = SVT( qr::ts::RootQR(A,treeData), tau, relative );
     qr::ts::Scatter( A, treeData );
@@ -39,6 +40,14 @@ Int TSQR( ElementalMatrix<F>& APre, Base<F> tau, bool relative )
     return zeroNorm;
 }
 
+template<typename F>
+Int TSQR( ElementalMatrix<F>& A, Base<F> tau, bool relative )
+{
+    DEBUG_CSE
+    qr::TreeData<F> treeData;
+    return TSQR( A, tau, treeData, relative );
+}
+
 } // namespace svt
 } // namespace El
 
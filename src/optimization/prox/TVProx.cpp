@@ -0,0 +1,275 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The 1D total variation proximal map,
+//
+//   argmin_x (1/2) || b - x ||_2^2 + rho || D x ||_1,
+//
+// where D is the 1D finite-difference operator, is computed with the direct
+// (and, in practice, linear-time) algorithm of
+//
+//   L. Condat, "A direct algorithm for 1D total variation denoising",
+//   IEEE Signal Processing Letters, Vol. 20, No. 11, pp. 1054--1057, 2013,
+//
+// which greedily extends each segment of the taut string for as long as a
+// constant value stays within the lower and upper bounds implied by rho.
+//
+// The anisotropic 2D map, which penalizes the differences along both the
+// columns and rows, is computed with the proximal variant of Dykstra's
+// algorithm, alternating between the (independent) 1D maps of the columns
+// and of the rows; see
+//
+//   A. Barbero and S. Sra, "Modular proximal optimization for multidimensional
+//   total-variation regularization", arXiv:1411.0589, 2014.
+//
+
+namespace El {
+
+namespace {
+
+template<typename Real>
+void Condat
+( Int n, const Real* b, Int bStride, Real* x, Int xStride, Real rho )
+{
+    if( n == 0 )
+        return;
+    const Real twoRho = 2*rho;
+    Int k=0, k0=0, kMinus=0, kPlus=0;
+    Real uMin=rho, uMax=-rho;
+    Real vMin=b[0]-rho, vMax=b[0]+rho;
+    while( true )
+    {
+        while( k == n-1 )
+        {
+            if( uMin < Real(0) )
+            {
+                // Close the segment [k0,kMinus] at the lower bound
+                do { x[k0*xStride] = vMin; ++k0; } while( k0 <= kMinus );
+                k = kMinus = k0;
+                vMin = b[k*bStride];
+                uMin = rho;
+                uMax = vMin + uMin - vMax;
+            }
+            else if( uMax > Real(0) )
+            {
+                // Close the segment [k0,kPlus] at the upper bound
+                do { x[k0*xStride] = vMax; ++k0; } while( k0 <= kPlus );
+                k = kPlus = k0;
+                vMax = b[k*bStride];
+                uMax = -rho;
+                uMin = vMax + uMax - vMin;
+            }
+            else
+            {
+                vMin += uMin / (k-k0+1);
+                do { x[k0*xStride] = vMin; ++k0; } while( k0 <= k );
+                return;
+            }
+        }
+        const Real bNext = b[(k+1)*bStride];
+        uMin += bNext - vMin;
+        if( uMin < -rho )
+        {
+            do { x[k0*xStride] = vMin; ++k0; } while( k0 <= kMinus );
+            k = kMinus = kPlus = k0;
+            vMin = b[k*bStride];
+            vMax = vMin + twoRho;
+            uMin = rho;
+            uMax = -rho;
+            continue;
+        }
+        uMax += bNext - vMax;
+        if( uMax > rho )
+        {
+            do { x[k0*xStride] = vMax; ++k0; } while( k0 <= kPlus );
+            k = kMinus = kPlus = k0;
+            vMax = b[k*bStride];
+            vMin = vMax - twoRho;
+            uMin = rho;
+            uMax = -rho;
+            continue;
+        }
+        ++k;
+        if( uMin >= rho )
+        {
+            kMinus = k;
+            vMin += (uMin-rho) / (kMinus-k0+1);
+            uMin = rho;
+        }
+        if( uMax <= -rho )
+        {
+            kPlus = k;
+            vMax += (uMax+rho) / (kPlus-k0+1);
+            uMax = -rho;
+        }
+    }
+}
+
+template<typename Real>
+void ColumnTVProx( Matrix<Real>& A, Real rho )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Real* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        Real* aCol = &ABuf[j*ALDim];
+        vector<Real> b( aCol, aCol+m );
+        Condat( m, b.data(), 1, aCol, 1, rho );
+    }
+}
+
+template<typename Real>
+void RowTVProx( Matrix<Real>& A, Real rho )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Real* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int i=0; i<m; ++i )
+    {
+        vector<Real> b( n );
+        for( Int j=0; j<n; ++j )
+            b[j] = ABuf[i+j*ALDim];
+        Condat( n, b.data(), 1, &ABuf[i], ALDim, rho );
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void TVProx( Matrix<Real>& A, Real rho )
+{
+    DEBUG_CSE
+    ColumnTVProx( A, rho );
+}
+
+template<typename Real>
+void TVProx( AbstractDistMatrix<Real>& A, Real rho )
+{
+    DEBUG_CSE
+    // Give each process entire columns
+    DistMatrix<Real,STAR,VR> A_STAR_VR( A );
+    ColumnTVProx( A_STAR_VR.Matrix(), rho );
+    Copy( A_STAR_VR, A );
+}
+
+template<typename Real>
+Int TV2DProx( Matrix<Real>& A, Real rho, const TV2DCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real frobB = FrobeniusNorm( A );
+
+    // Dykstra's iteration for the sum of the column and row penalties,
+    //   y := prox_col(x + p), p := x + p - y,
+    //   x := prox_row(y + q), q := y + q - x
+    Matrix<Real> p, q, y, xOld;
+    Zeros( p, m, n );
+    Zeros( q, m, n );
+    Int numIts = 0;
+    while( numIts < ctrl.maxIter )
+    {
+        ++numIts;
+        xOld = A;
+
+        y = A;
+        y += p;
+        p += A;
+        ColumnTVProx( y, rho );
+        p -= y;
+
+        A = y;
+        A += q;
+        q += y;
+        RowTVProx( A, rho );
+        q -= A;
+
+        xOld -= A;
+        const Real change = FrobeniusNorm( xOld );
+        if( ctrl.progress )
+            Output("iter ",numIts,": || x - xOld ||_F = ",change);
+        if( change <= ctrl.tol*frobB )
+            break;
+    }
+    return numIts;
+}
+
+template<typename Real>
+Int TV2DProx
+( AbstractDistMatrix<Real>& APre, Real rho, const TV2DCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Grid& grid = APre.Grid();
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Real frobB = FrobeniusNorm( APre );
+
+    // The column maps act on [STAR,VR] iterates and the row maps on [VC,STAR]
+    // iterates, so that each iteration requires two redistributions of the
+    // image
+    DistMatrix<Real,VC,STAR> x( APre ), q(grid), yRows(grid), xOld(grid);
+    DistMatrix<Real,STAR,VR> p(grid), y(grid), xCols(grid);
+    Zeros( p, m, n );
+    Zeros( q, m, n );
+    Int numIts = 0;
+    while( numIts < ctrl.maxIter )
+    {
+        ++numIts;
+        xOld = x;
+
+        xCols = x;
+        y = xCols;
+        y += p;
+        p += xCols;
+        ColumnTVProx( y.Matrix(), rho );
+        p -= y;
+
+        yRows = y;
+        x = yRows;
+        x += q;
+        q += yRows;
+        RowTVProx( x.Matrix(), rho );
+        q -= x;
+
+        xOld -= x;
+        const Real change = FrobeniusNorm( xOld );
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output("iter ",numIts,": || x - xOld ||_F = ",change);
+        if( change <= ctrl.tol*frobB )
+            break;
+    }
+    Copy( x, APre );
+    return numIts;
+}
+
+#define PROTO(Real) \
+  template void TVProx( Matrix<Real>& A, Real rho ); \
+  template void TVProx( AbstractDistMatrix<Real>& A, Real rho ); \
+  template Int TV2DProx \
+  ( Matrix<Real>& A, Real rho, const TV2DCtrl<Real>& ctrl ); \
+  template Int TV2DProx \
+  ( AbstractDistMatrix<Real>& A, Real rho, const TV2DCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -12,6 +12,32 @@
 
 namespace El {
 
+namespace lp {
+namespace direct {
+
+// The high-level interface has no means of returning a certificate
+// of infeasibility, and so its detection is reported as an error
+template<class AMatType,typename Real>
+void HSDAndCheck
+( const AMatType& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const IPMStatus status = HSD( A, b, c, x, y, z, ctrl );
+    if( status == IPM_PRIMAL_INFEASIBLE )
+        RuntimeError("The LP was detected to be primal infeasible");
+    else if( status == IPM_DUAL_INFEASIBLE )
+        RuntimeError("The LP was detected to be dual infeasible");
+}
+
+} // namespace direct
+} // namespace lp
+
 template<typename Real>
 void LP
 ( const Matrix<Real>& A, 
@@ -27,6 +53,8 @@ void LP
         lp::direct::ADMM( A, b, c, x, ctrl.admmCtrl );
     else if( ctrl.approach == LP_MEHROTRA )
         lp::direct::Mehrotra( A, b, c, x, y, z, ctrl.mehrotraCtrl );
+    else if( ctrl.approach == LP_HSD )
+        lp::direct::HSDAndCheck( A, b, c, x, y, z, ctrl.mehrotraCtrl );
     else
         LogicError("Unsupported solver");
 }
@@ -101,8 +129,37 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.presolve )
+    {
+        SparseMatrix<Real> ARed;
+        Matrix<Real> bRed, cRed, xRed, yRed, zRed;
+        PresolveInfo<Real> info;
+        lp::direct::Presolve
+        ( A, b, c, ARed, bRed, cRed, info, ctrl.presolveCtrl );
+
+        auto redCtrl( ctrl );
+        redCtrl.presolve = false;
+        redCtrl.mehrotraCtrl.primalInit = false;
+        redCtrl.mehrotraCtrl.dualInit = false;
+        redCtrl.mehrotraCtrl.warmStart = false;
+        if( ARed.Width() > 0 )
+            LP( ARed, bRed, cRed, xRed, yRed, zRed, redCtrl );
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+            Zeros( zRed, 0, 1 );
+        }
+        lp::direct::Postsolve( A, c, info, xRed, yRed, zRed, x, y, z );
+        return;
+    }
+
     if( ctrl.approach == LP_MEHROTRA )
         lp::direct::Mehrotra( A, b, c, x, y, z, ctrl.mehrotraCtrl );
+    else if( ctrl.approach == LP_HSD )
+        lp::direct::HSDAndCheck( A, b, c, x, y, z, ctrl.mehrotraCtrl );
+    else if( ctrl.approach == LP_PDHG )
+        lp::direct::PDHG( A, b, c, x, y, z, ctrl.pdhgCtrl );
     else
         LogicError("Unsupported solver");
 }
@@ -138,8 +195,37 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.presolve )
+    {
+        mpi::Comm comm = A.Comm();
+        DistSparseMatrix<Real> ARed(comm);
+        DistMultiVec<Real> bRed(comm), cRed(comm),
+                           xRed(comm), yRed(comm), zRed(comm);
+        DistPresolveInfo<Real> info;
+        lp::direct::Presolve
+        ( A, b, c, ARed, bRed, cRed, info, ctrl.presolveCtrl );
+
+        auto redCtrl( ctrl );
+        redCtrl.presolve = false;
+        redCtrl.mehrotraCtrl.primalInit = false;
+        redCtrl.mehrotraCtrl.dualInit = false;
+        redCtrl.mehrotraCtrl.warmStart = false;
+        if( ARed.Width() > 0 )
+            LP( ARed, bRed, cRed, xRed, yRed, zRed, redCtrl );
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+            Zeros( zRed, 0, 1 );
+        }
+        lp::direct::Postsolve( A, c, info, xRed, yRed, zRed, x, y, z );
+        return;
+    }
+
     if( ctrl.approach == LP_MEHROTRA )
         lp::direct::Mehrotra( A, b, c, x, y, z, ctrl.mehrotraCtrl );
+    else if( ctrl.approach == LP_PDHG )
+        lp::direct::PDHG( A, b, c, x, y, z, ctrl.pdhgCtrl );
     else
         LogicError("Unsupported solver");
 }
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../util/KKTValueMap.hpp"
 
 namespace El {
 namespace lp {
@@ -788,7 +789,12 @@ void Mehrotra
     ( JStatic, regTmp, b, c, h, x, y, z, s, map, invMap, rootSep, info, 
       ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
 
+    // Only the barrier block, -s <> z, of the KKT system changes between
+    // iterations, and so it is refreshed in place within the static pattern
     SparseMatrix<Real> J, JOrig;
+    kkt::DiagonalValueMap<Real> kktMap;
+    kktMap.Initialize( JStatic, n+m, k, JOrig );
+    Matrix<Real> barrier;
     ldl::Front<Real> JFront;
     Matrix<Real> d,
                  w,
@@ -895,9 +901,10 @@ void Mehrotra
 
         // Construct the KKT system
         // ------------------------
-        JOrig = JStatic;
-        JOrig.FreezeSparsity();
-        FinishKKT( m, n, s, z, JOrig );
+        barrier = s;
+        DiagonalSolve( LEFT, NORMAL, z, barrier );
+        barrier *= -1;
+        kktMap.Refresh( JStatic, barrier, JOrig );
         KKTRHS( rc, rb, rh, rmu, z, d );
 
         // Solve for the direction
@@ -1205,7 +1212,13 @@ void Mehrotra
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
+    // Only the barrier block, -s <> z, of the KKT system changes between
+    // iterations, and so it is refreshed in place within the static pattern
     DistSparseMatrix<Real> J(comm), JOrig(comm);
+    kkt::DistDiagonalValueMap<Real> kktMap;
+    kktMap.Initialize( JStatic, n+m, k, JOrig );
+    JOrig.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
+    DistMultiVec<Real> barrier(comm);
     ldl::DistFront<Real> JFront;
     DistMultiVec<Real> d(comm),
                        w(comm),
@@ -1314,10 +1327,10 @@ void Mehrotra
 
         // Construct the KKT system
         // ------------------------
-        JOrig = JStatic;
-        JOrig.FreezeSparsity();
-        JOrig.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
-        FinishKKT( m, n, s, z, JOrig );
+        barrier = s;
+        DiagonalSolve( LEFT, NORMAL, z, barrier );
+        barrier *= -1;
+        kktMap.Refresh( JStatic, barrier, JOrig );
         KKTRHS( rc, rb, rh, rmu, z, d );
 
         // Solve for the direction
@@ -65,6 +65,26 @@ Int ADMM
         ElementalMatrix<Real>& z,
   const ADMMCtrl<Real>& ctrl=ADMMCtrl<Real>() );
 
+// NOTE: This should also be in a different header
+template<typename Real>
+Int PDHG
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const PDHGCtrl<Real>& ctrl=PDHGCtrl<Real>() );
+template<typename Real>
+Int PDHG
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const PDHGCtrl<Real>& ctrl=PDHGCtrl<Real>() );
+
 } // namespace direct
 } // namespace lp
 } // namespace El
@@ -0,0 +1,543 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./util.hpp"
+
+namespace El {
+namespace lp {
+namespace direct {
+
+// The following solves the homogeneous self-dual embedding of the pair of
+// linear programs in "direct" conic form:
+//
+//   min c^T x
+//   s.t. A x = b, x >= 0,
+//
+//   max -b^T y
+//   s.t. A^T y - z + c = 0, z >= 0,
+//
+// i.e.,
+//
+//   A x - b tau = 0,
+//   A^T y - z + c tau = 0,
+//   c^T x + b^T y + kappa = 0,
+//   x, z, tau, kappa >= 0,
+//
+// using a Mehrotra Predictor-Corrector scheme. Since the embedding is always
+// feasible, infeasibility of the original pair is detected by tau tending to
+// zero relative to kappa rather than by the iteration limit.
+//
+// Each Newton step requires the solution of
+//
+//   | A dx - b dtau                 |   | -eta r_b |
+//   | A^T dy - dz + c dtau          | = | -eta r_c |,
+//   | c^T dx + b^T dy + dkappa      |   | -eta r_g |
+//   | z o dx + x o dz               |   | -r_mu    |
+//   | kappa dtau + tau dkappa       |   | -r_tau   |
+//
+// which, after eliminating dz and dkappa, involves the same augmented system
+// as the Mehrotra solvers,
+//
+//   | (x <> z)  A^T | | dx | = | -eta r_c - x <> r_mu | + dtau | -c |,
+//   |    A       0  | | dy |   | -eta r_b             |        |  b |
+//
+// and so dtau is recovered from the gap equation using a second solve with
+// the right-hand side [-c; b] (which only changes with the factorization).
+//
+
+namespace hsd {
+
+template<typename Real,class ApplyAType,class FactorType,class SolveType>
+IPMStatus Solve
+( const ApplyAType& applyA,
+  const FactorType& factor,
+  const SolveType& solve,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+
+    // TODO: Move these into the control structure
+    const bool stepLengthSigma = true;
+    function<Real(Real,Real,Real,Real)> centralityRule;
+    if( stepLengthSigma )
+        centralityRule = StepLengthCentrality<Real>;
+    else
+        centralityRule = MehrotraCentrality<Real>;
+
+    const Int m = b.Height();
+    const Int n = c.Height();
+    const Int degree = n+1;
+    const IR xInd(0,n), yInd(n,n+m);
+    const Real bNrm2 = Nrm2( b );
+    const Real cNrm2 = Nrm2( c );
+
+    // Start from the center of the (always feasible) embedding
+    Ones( x, n, 1 );
+    Zeros( y, m, 1 );
+    Ones( z, n, 1 );
+    Real tau=1, kappa=1;
+
+    Matrix<Real> d, g,
+                 rb,    rc,    rmu,
+                 rbEta, rcEta,
+                 dxAff, dyAff, dzAff,
+                 dx,    dy,    dz,
+                 cert;
+    Real dTauAff, dKappaAff, dTau, dKappa, gDen;
+
+    // Solve for (dx,dy,dz,dtau,dkappa) given eta, r_mu, and r_tau
+    auto computeDirection =
+      [&]( Real eta, const Matrix<Real>& rmu, Real rTau,
+           Matrix<Real>& dx, Matrix<Real>& dy, Matrix<Real>& dz,
+           Real& dTau, Real& dKappa )
+      {
+        rbEta = rb;
+        rbEta *= eta;
+        rcEta = rc;
+        rcEta *= eta;
+        AugmentedKKTRHS( x, rcEta, rbEta, rmu, d );
+        solve( d );
+        const Real rg = Dot(c,x) + Dot(b,y) + kappa;
+        const Real gapUpdate = Dot(c,d(xInd,ALL)) + Dot(b,d(yInd,ALL));
+        dTau = (-eta*rg - gapUpdate + rTau/tau) / gDen;
+        Axpy( dTau, g, d );
+        ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+        dKappa = -(rTau + kappa*dTau) / tau;
+      };
+    auto maxStep =
+      [&]( const Matrix<Real>& dx, const Matrix<Real>& dz,
+           Real dTau, Real dKappa, Real upperBound )
+      {
+        Real alpha = Min( pos_orth::MaxStep( x, dx, upperBound ),
+                          pos_orth::MaxStep( z, dz, upperBound ) );
+        if( dTau < Real(0) )
+            alpha = Min( alpha, -tau/dTau );
+        if( dKappa < Real(0) )
+            alpha = Min( alpha, -kappa/dKappa );
+        return alpha;
+      };
+
+    IPMStatus status = IPM_SOLVED;
+    const Int indent = PushIndent();
+    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    {
+        // Ensure that x and z are in the cone
+        // ===================================
+        const Int xNumNonPos = pos_orth::NumOutside( x );
+        const Int zNumNonPos = pos_orth::NumOutside( z );
+        if( xNumNonPos > 0 || zNumNonPos > 0 )
+            LogicError
+            (xNumNonPos," entries of x were nonpositive and ",
+             zNumNonPos," entries of z were nonpositive");
+
+        // Compute the barrier parameter
+        // =============================
+        const Real mu = (Dot(x,z) + tau*kappa) / degree;
+
+        // Form the residuals of the embedding
+        // ===================================
+        // r_b := A x - b tau
+        // ------------------
+        rb = b;
+        rb *= -tau;
+        applyA( NORMAL, Real(1), x, Real(1), rb );
+        const Real rbNrm2 = Nrm2( rb );
+        // r_c := A^T y - z + c tau
+        // ------------------------
+        rc = c;
+        rc *= tau;
+        applyA( TRANSPOSE, Real(1), y, Real(1), rc );
+        rc -= z;
+        const Real rcNrm2 = Nrm2( rc );
+
+        // Check for convergence of the original problem
+        // =============================================
+        const Real primObj = Dot(c,x) / tau;
+        const Real dualObj = -Dot(b,y) / tau;
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        const Real rbConv = rbNrm2 / (tau*(1+bNrm2));
+        const Real rcConv = rcNrm2 / (tau*(1+cNrm2));
+        const Real relError = Max(Max(objConv,rbConv),rcConv);
+        if( ctrl.print )
+        {
+            const Real xNrm2 = Nrm2( x );
+            const Real yNrm2 = Nrm2( y );
+            const Real zNrm2 = Nrm2( z );
+            Output
+            ("iter ",numIts,":\n",Indent(),
+             "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
+             "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+             "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
+             "  tau = ",tau,", kappa = ",kappa,"\n",Indent(),
+             "  || r_b ||_2 / (tau (1 + || b ||_2)) = ",rbConv,"\n",Indent(),
+             "  || r_c ||_2 / (tau (1 + || c ||_2)) = ",rcConv,"\n",Indent(),
+             "  primal = ",primObj,"\n",Indent(),
+             "  dual   = ",dualObj,"\n",Indent(),
+             "  |primal - dual| / (1 + |primal|) = ",objConv);
+        }
+        if( relError <= ctrl.targetTol )
+            break;
+
+        // Check for certificates of infeasibility
+        // =======================================
+        if( kappa > tau )
+        {
+            // || A^T y - z ||_2 <= tol (-b^T y) ?
+            // -----------------------------------
+            const Real bTy = Dot(b,y);
+            if( bTy < Real(0) )
+            {
+                cert = rc;
+                Axpy( -tau, c, cert );
+                if( Nrm2(cert) <= -ctrl.targetTol*bTy )
+                {
+                    if( ctrl.print )
+                        Output("Found a certificate of primal infeasibility");
+                    y *= Real(-1)/bTy;
+                    z *= Real(-1)/bTy;
+                    status = IPM_PRIMAL_INFEASIBLE;
+                    break;
+                }
+            }
+            // || A x ||_2 <= tol (-c^T x) ?
+            // -----------------------------
+            const Real cTx = Dot(c,x);
+            if( cTx < Real(0) )
+            {
+                cert = rb;
+                Axpy( tau, b, cert );
+                if( Nrm2(cert) <= -ctrl.targetTol*cTx )
+                {
+                    if( ctrl.print )
+                        Output("Found a certificate of dual infeasibility");
+                    x *= Real(-1)/cTx;
+                    status = IPM_DUAL_INFEASIBLE;
+                    break;
+                }
+            }
+        }
+
+        if( numIts == ctrl.maxIts )
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            RuntimeError
+            ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
+             "achieving minTol=",ctrl.minTol);
+        }
+
+        // Factor the augmented system and solve against [-c; b]
+        // =====================================================
+        try
+        {
+            factor( x, z );
+            Zeros( g, n+m, 1 );
+            auto gx = g(xInd,ALL);
+            auto gy = g(yInd,ALL);
+            gx = c;
+            gx *= -1;
+            gy = b;
+            solve( g );
+            gDen = Dot(c,gx) + Dot(b,gy) - kappa/tau;
+        }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+
+        // Compute the affine search direction
+        // ===================================
+        rmu = z;
+        DiagonalScale( LEFT, NORMAL, x, rmu );
+        try
+        {
+            computeDirection
+            ( Real(1), rmu, tau*kappa,
+              dxAff, dyAff, dzAff, dTauAff, dKappaAff );
+        }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+
+        // Compute a centrality parameter
+        // ==============================
+        // NOTE: The primal and dual step lengths must be equal in order to
+        //       preserve the homogeneity of the embedding
+        const Real alphaAff =
+          maxStep( dxAff, dzAff, dTauAff, dKappaAff, Real(1) );
+        // NOTE: dz and dx are used as temporaries
+        dx = x;
+        dz = z;
+        Axpy( alphaAff, dxAff, dx );
+        Axpy( alphaAff, dzAff, dz );
+        const Real muAff =
+          (Dot(dx,dz) + (tau+alphaAff*dTauAff)*(kappa+alphaAff*dKappaAff)) /
+          degree;
+        const Real sigma = centralityRule(mu,muAff,alphaAff,alphaAff);
+        if( ctrl.print )
+            Output
+            ("alphaAff = ",alphaAff,", muAff = ",muAff,", mu = ",mu,
+             ", sigma = ",sigma);
+
+        // Solve for the combined direction
+        // ================================
+        Shift( rmu, -sigma*mu );
+        Real rTau = tau*kappa - sigma*mu;
+        if( ctrl.mehrotra )
+        {
+            // r_mu += dxAff o dzAff
+            // ---------------------
+            // NOTE: We are using dz as a temporary
+            dz = dzAff;
+            DiagonalScale( LEFT, NORMAL, dxAff, dz );
+            rmu += dz;
+            rTau += dTauAff*dKappaAff;
+        }
+        try
+        {
+            computeDirection( 1-sigma, rmu, rTau, dx, dy, dz, dTau, dKappa );
+        }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+
+        // Update the current estimates
+        // ============================
+        Real alpha = maxStep( dx, dz, dTau, dKappa, 1/ctrl.maxStepRatio );
+        alpha = Min(ctrl.maxStepRatio*alpha,Real(1));
+        if( ctrl.print )
+            Output("alpha = ",alpha);
+        Axpy( alpha, dx, x );
+        Axpy( alpha, dy, y );
+        Axpy( alpha, dz, z );
+        tau += alpha*dTau;
+        kappa += alpha*dKappa;
+        if( alpha == Real(0) )
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+    }
+    SetIndent( indent );
+
+    if( status == IPM_SOLVED )
+    {
+        x *= Real(1)/tau;
+        y *= Real(1)/tau;
+        z *= Real(1)/tau;
+    }
+    return status;
+}
+
+} // namespace hsd
+
+template<typename Real>
+IPMStatus HSD
+( const Matrix<Real>& APre,
+  const Matrix<Real>& bPre,
+  const Matrix<Real>& cPre,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+
+    // Equilibrate the LP by diagonally scaling A
+    auto A = APre;
+    auto b = bPre;
+    auto c = cPre;
+    Matrix<Real> dRow, dCol;
+    if( ctrl.outerEquil )
+    {
+        RuizEquil( A, dRow, dCol, ctrl.print );
+        DiagonalSolve( LEFT, NORMAL, dRow, b );
+        DiagonalSolve( LEFT, NORMAL, dCol, c );
+    }
+
+    auto applyA =
+      [&]( Orientation orient, Real alpha, const Matrix<Real>& X,
+           Real beta, Matrix<Real>& Y )
+      { Gemv( orient, alpha, A, X, beta, Y ); };
+    Matrix<Real> J, dSub;
+    Permutation p;
+    auto factor =
+      [&]( const Matrix<Real>& x, const Matrix<Real>& z )
+      {
+        AugmentedKKT( A, x, z, J );
+        LDL( J, dSub, p, false );
+      };
+    auto solve =
+      [&]( Matrix<Real>& d )
+      { ldl::SolveAfter( J, dSub, p, d, false ); };
+
+    const IPMStatus status =
+      hsd::Solve( applyA, factor, solve, b, c, x, y, z, ctrl );
+
+    if( ctrl.outerEquil )
+    {
+        DiagonalSolve( LEFT, NORMAL, dCol, x );
+        DiagonalSolve( LEFT, NORMAL, dRow, y );
+        DiagonalScale( LEFT, NORMAL, dCol, z );
+    }
+    return status;
+}
+
+template<typename Real>
+IPMStatus HSD
+( const SparseMatrix<Real>& APre,
+  const Matrix<Real>& bPre,
+  const Matrix<Real>& cPre,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+
+    // Equilibrate the LP by diagonally scaling A
+    auto A = APre;
+    auto b = bPre;
+    auto c = cPre;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<Real> dRow, dCol;
+    if( ctrl.outerEquil )
+    {
+        RuizEquil( A, dRow, dCol, ctrl.print );
+        DiagonalSolve( LEFT, NORMAL, dRow, b );
+        DiagonalSolve( LEFT, NORMAL, dCol, c );
+    }
+
+    // The augmented system is temporarily regularized and then the
+    // regularization is resolved with iterative refinement
+    const Real twoNormEstA = TwoNormEstimate( A, ctrl.basisSize );
+    const Real origTwoNormEst = twoNormEstA + 1;
+    Matrix<Real> regTmp;
+    regTmp.Resize( n+m, 1 );
+    for( Int i=0; i<n+m; ++i )
+    {
+        if( i < n ) regTmp(i) =  ctrl.reg0Tmp*ctrl.reg0Tmp;
+        else        regTmp(i) = -ctrl.reg1Tmp*ctrl.reg1Tmp;
+    }
+    regTmp *= origTwoNormEst;
+
+    auto applyA =
+      [&]( Orientation orient, Real alpha, const Matrix<Real>& X,
+           Real beta, Matrix<Real>& Y )
+      { Multiply( orient, alpha, A, X, beta, Y ); };
+    SparseMatrix<Real> J, JOrig;
+    ldl::Front<Real> JFront;
+    vector<Int> map, invMap;
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    Matrix<Real> w, dInner;
+    bool analyzed = false;
+    auto factor =
+      [&]( const Matrix<Real>& x, const Matrix<Real>& z )
+      {
+        AugmentedKKT( A, Real(0), Real(0), x, z, JOrig, false );
+        J = JOrig;
+        UpdateDiagonal( J, Real(1), regTmp );
+
+        pos_orth::NesterovTodd( x, z, w );
+        const Real wMaxNorm = MaxNorm( w );
+        if( wMaxNorm >= ctrl.ruizEquilTol )
+            SymmetricRuizEquil( J, dInner, ctrl.ruizMaxIter, ctrl.print );
+        else if( wMaxNorm >= ctrl.diagEquilTol )
+            SymmetricDiagonalEquil( J, dInner, ctrl.print );
+        else
+            Ones( dInner, J.Height(), 1 );
+
+        if( !analyzed )
+        {
+            NestedDissection( J.LockedGraph(), map, rootSep, info );
+            InvertMap( map, invMap );
+            analyzed = true;
+        }
+        JFront.Pull( J, map, info );
+        LDL( info, JFront, LDL_2D );
+      };
+    auto solve =
+      [&]( Matrix<Real>& d )
+      {
+        if( ctrl.resolveReg )
+            reg_ldl::SolveAfter
+            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+              ctrl.solveCtrl );
+        else
+            reg_ldl::RegularizedSolveAfter
+            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+              ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+      };
+
+    const IPMStatus status =
+      hsd::Solve( applyA, factor, solve, b, c, x, y, z, ctrl );
+
+    if( ctrl.outerEquil )
+    {
+        DiagonalSolve( LEFT, NORMAL, dCol, x );
+        DiagonalSolve( LEFT, NORMAL, dRow, y );
+        DiagonalScale( LEFT, NORMAL, dCol, z );
+    }
+    return status;
+}
+
+#define PROTO(Real) \
+  template IPMStatus HSD \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template IPMStatus HSD \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace lp
+} // namespace El
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../util/KKTValueMap.hpp"
 
 namespace El {
 namespace lp {
@@ -43,6 +44,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -53,6 +55,8 @@ void Mehrotra
     else
         centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
     const Real balanceTol = Pow(eps,Real(-0.19));
 
     // TODO: Implement nonzero regularization
@@ -74,9 +78,9 @@ void Mehrotra
 
         DiagonalSolve( LEFT, NORMAL, dRow, b ); 
         DiagonalSolve( LEFT, NORMAL, dCol, c );
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -87,11 +91,11 @@ void Mehrotra
         cScale = Max(MaxNorm(c),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             x *= Real(1)/bScale;
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             y *= Real(1)/cScale;
             z *= Real(1)/cScale;
@@ -121,9 +125,13 @@ void Mehrotra
     }
 
     Initialize
-    ( A, b, c, x, y, z, ctrl.primalInit, ctrl.dualInit, standardShift ); 
+    ( A, b, c, x, y, z, primalInit, dualInit, standardShift ); 
+    if( ctrl.warmStart )
+        pos_orth::WarmStart
+        ( x, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real muOld = 0.1;
+    const Int firstIt = RestoreIterates( ctrl, x, y, z, muOld );
     Real relError = 1;
     Matrix<Real> J, d, 
                  rb,    rc,    rmu,
@@ -133,12 +141,28 @@ void Mehrotra
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( Int numIts=firstIt; numIts<=ctrl.maxIts; ++numIts )
     {
+        if( ctrl.checkpoint && numIts > firstIt &&
+            numIts % ctrl.checkpointFreq == 0 )
+            SaveIterates( ctrl, numIts, x, y, z, muOld );
+
+        // Form the residuals
+        // ==================
+        rb = b;
+        Gemv( NORMAL, Real(1), A, x, Real(-1), rb );
+        rc = c;
+        Gemv( TRANSPOSE, Real(1), A, y, Real(1), rc );
+        rc -= z;
+
+        // Accumulate all of the reductions over the iterates at once
+        // ==========================================================
+        const auto stats = ComputeIterateStats( b, c, x, y, z, rb, rc );
+
         // Ensure that x and z are in the cone
         // ===================================
-        const Int xNumNonPos = pos_orth::NumOutside( x );
-        const Int zNumNonPos = pos_orth::NumOutside( z );
+        const Int xNumNonPos = stats.xNumNonPos;
+        const Int zNumNonPos = stats.zNumNonPos;
         if( xNumNonPos > 0 || zNumNonPos > 0 )
             LogicError
             (xNumNonPos," entries of x were nonpositive and ",
@@ -146,8 +170,8 @@ void Mehrotra
 
         // Compute the barrier parameter
         // =============================
-        Real mu = Dot(x,z) / degree;
-        const Real compRatio = pos_orth::ComplementRatio( x, z );
+        Real mu = stats.xDotZ / degree;
+        const Real compRatio = stats.compRatio;
         mu = ( compRatio > balanceTol ? muOld : Min(mu,muOld) );
         muOld = mu;
 
@@ -155,22 +179,17 @@ void Mehrotra
         // =====================
         // |primal - dual| / (1 + |primal|) <= tol ?
         // -----------------------------------------
-        const Real primObj = Dot(c,x);
-        const Real dualObj = -Dot(b,y); 
+        const Real primObj = stats.primObj;
+        const Real dualObj = stats.dualObj;
         const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
         // || r_b ||_2 / (1 + || b ||_2) <= tol ?
         // --------------------------------------
-        rb = b;
-        Gemv( NORMAL, Real(1), A, x, Real(-1), rb );
-        const Real rbNrm2 = Nrm2( rb );
+        const Real rbNrm2 = stats.rbNrm2;
         const Real rbConv = rbNrm2 / (1+bNrm2);
         Axpy( -deltaPerm*deltaPerm, y, rb ); 
         // || r_c ||_2 / (1 + || c ||_2) <= tol ?
         // --------------------------------------
-        rc = c;
-        Gemv( TRANSPOSE, Real(1), A, y, Real(1), rc );
-        rc -= z;
-        const Real rcNrm2 = Nrm2( rc );
+        const Real rcNrm2 = stats.rcNrm2;
         const Real rcConv = rcNrm2 / (1+cNrm2);
         Axpy( gammaPerm*gammaPerm, x, rc );
         // Now check the pieces
@@ -477,6 +496,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -487,6 +507,8 @@ void Mehrotra
     else
         centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
     const Real balanceTol = Pow(eps,Real(-0.19));
     // TODO: Implement nonzero regularization
     const Real gammaPerm = 0;
@@ -511,9 +533,9 @@ void Mehrotra
     control.rowAlign = 0;
 
     DistMatrixReadWriteProxy<Real,Real,MC,MR>
-    // NOTE: x does not need to be a read proxy when !ctrl.primalInit
+    // NOTE: x does not need to be a read proxy when !primalInit
       xProx( xPre, control ),
-    // NOTE: {y,z} do not need to be read proxies when !ctrl.dualInit
+    // NOTE: {y,z} do not need to be read proxies when !dualInit
       yProx( yPre, control ),
       zProx( zPre, control );
     auto& x = xProx.Get();
@@ -533,9 +555,9 @@ void Mehrotra
 
         DiagonalSolve( LEFT, NORMAL, dRow, b ); 
         DiagonalSolve( LEFT, NORMAL, dCol, c );
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -546,11 +568,11 @@ void Mehrotra
         cScale = Max(MaxNorm(c),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             x *= Real(1)/bScale;
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             y *= Real(1)/cScale;
             z *= Real(1)/cScale;
@@ -583,9 +605,13 @@ void Mehrotra
     }
 
     Initialize
-    ( A, b, c, x, y, z, ctrl.primalInit, ctrl.dualInit, standardShift ); 
+    ( A, b, c, x, y, z, primalInit, dualInit, standardShift ); 
+    if( ctrl.warmStart )
+        pos_orth::WarmStart
+        ( x, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real muOld = 0.1;
+    const Int firstIt = RestoreIterates( ctrl, x, y, z, muOld );
     Real relError = 1;
     DistMatrix<Real> 
         J(grid), d(grid), 
@@ -602,12 +628,28 @@ void Mehrotra
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( Int numIts=firstIt; numIts<=ctrl.maxIts; ++numIts )
     {
+        if( ctrl.checkpoint && numIts > firstIt &&
+            numIts % ctrl.checkpointFreq == 0 )
+            SaveIterates( ctrl, numIts, x, y, z, muOld );
+
+        // Form the residuals
+        // ==================
+        rb = b;
+        Gemv( NORMAL, Real(1), A, x, Real(-1), rb );
+        rc = c;
+        Gemv( TRANSPOSE, Real(1), A, y, Real(1), rc );
+        rc -= z;
+
+        // Accumulate all of the reductions over the iterates at once
+        // ==========================================================
+        const auto stats = ComputeIterateStats( b, c, x, y, z, rb, rc );
+
         // Ensure that x and z are in the cone
         // ===================================
-        const Int xNumNonPos = pos_orth::NumOutside( x );
-        const Int zNumNonPos = pos_orth::NumOutside( z );
+        const Int xNumNonPos = stats.xNumNonPos;
+        const Int zNumNonPos = stats.zNumNonPos;
         if( xNumNonPos > 0 || zNumNonPos > 0 )
             LogicError
             (xNumNonPos," entries of x were nonpositive and ",
@@ -615,8 +657,8 @@ void Mehrotra
 
         // Compute the barrier parameter
         // =============================
-        Real mu = Dot(x,z) / degree;
-        const Real compRatio = pos_orth::ComplementRatio( x, z );
+        Real mu = stats.xDotZ / degree;
+        const Real compRatio = stats.compRatio;
         mu = ( compRatio > balanceTol ? muOld : Min(mu,muOld) );
         muOld = mu;
 
@@ -624,22 +666,17 @@ void Mehrotra
         // =====================
         // |primal - dual| / (1 + |primal|) <= tol ?
         // -----------------------------------------
-        const Real primObj = Dot(c,x);
-        const Real dualObj = -Dot(b,y); 
+        const Real primObj = stats.primObj;
+        const Real dualObj = stats.dualObj;
         const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
         // || r_b ||_2 / (1 + || b ||_2) <= tol ?
         // --------------------------------------
-        rb = b;
-        Gemv( NORMAL, Real(1), A, x, Real(-1), rb );
-        const Real rbNrm2 = Nrm2( rb );
+        const Real rbNrm2 = stats.rbNrm2;
         const Real rbConv = rbNrm2 / (1+bNrm2);
         Axpy( -deltaPerm*deltaPerm, y, rb ); 
         // || r_c ||_2 / (1 + || c ||_2) <= tol ?
         // --------------------------------------
-        rc = c;
-        Gemv( TRANSPOSE, Real(1), A, y, Real(1), rc );
-        rc -= z;
-        const Real rcNrm2 = Nrm2( rc );
+        const Real rcNrm2 = stats.rcNrm2;
         const Real rcConv = rcNrm2 / (1+cNrm2);
         Axpy( gammaPerm*gammaPerm, x, rc );
         // Now check the pieces
@@ -788,8 +825,10 @@ void Mehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
-        Real alphaAffDual = pos_orth::MaxStep( z, dzAff, Real(1) );
+        const auto alphasAff =
+          pos_orth::MaxSteps( x, dxAff, z, dzAff, Real(1) );
+        Real alphaAffPri = alphasAff.first;
+        Real alphaAffDual = alphasAff.second;
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
@@ -883,8 +922,10 @@ void Mehrotra
 
         // Update the current estimates
         // ============================
-        Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
-        Real alphaDual = pos_orth::MaxStep( z, dz, 1/ctrl.maxStepRatio );
+        const auto alphas =
+          pos_orth::MaxSteps( x, dx, z, dz, 1/ctrl.maxStepRatio );
+        Real alphaPri = alphas.first;
+        Real alphaDual = alphas.second;
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -949,6 +990,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -959,6 +1001,8 @@ void Mehrotra
     else
         centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
     Real gammaPerm, deltaPerm, betaPerm, gammaTmp, deltaTmp, betaTmp;
     if( ctrl.system == NORMAL_KKT )
     {
@@ -983,16 +1027,30 @@ void Mehrotra
     const Int n = A.Width();
     const Int degree = n;
     Real bScale, cScale;
-    Matrix<Real> dRow, dCol;
+    // Reuse the equilibration and symbolic analysis of a previous solve with
+    // the same sparsity pattern when a cache was provided
+    MehrotraCache<Real> localCache;
+    auto& cache = ( ctrl.cache ? *ctrl.cache : localCache );
+    auto& dRow = cache.dRowA;
+    auto& dCol = cache.dCol;
     if( ctrl.outerEquil )
     {
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( cache.equilibrated )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            cache.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b ); 
         DiagonalSolve( LEFT, NORMAL, dCol, c );
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -1003,11 +1061,11 @@ void Mehrotra
         cScale = Max(MaxNorm(c),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             x *= Real(1)/bScale;
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             y *= Real(1)/cScale;
             z *= Real(1)/cScale;
@@ -1024,6 +1082,7 @@ void Mehrotra
         cScale = 1;
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        cache.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -1037,17 +1096,20 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
+    if( cache.analyzed && cache.system != ctrl.system )
+        LogicError("The cached analysis is of a different KKT system");
+    auto& map = cache.map;
+    auto& invMap = cache.invMap;
+    auto& info = cache.info;
+    auto& rootSep = cache.rootSep;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.system == AUGMENTED_KKT && !cache.analyzed )
     {
         Initialize
         ( A, b, c, x, y, z, map, invMap, rootSep, info,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
     {
@@ -1056,8 +1118,17 @@ void Mehrotra
         ldl::Separator augRootSep;
         Initialize
         ( A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }
+    if( ctrl.warmStart )
+        pos_orth::WarmStart
+        ( x, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
+
+    // Split off the dense columns of A for the matrix-free normal system
+    const bool normalPCG = ( ctrl.system == NORMAL_KKT && ctrl.normalPCG );
+    NormalPCGState<Real> pcgState;
+    if( normalPCG )
+        NormalPCGSetup( A, ctrl.pcgDenseColumnRatio, ctrl.pcgRank, pcgState );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -1086,21 +1157,62 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
-    SparseMatrix<Real> J, JOrig;
+    // The full and augmented KKT systems are assembled once, with a zero
+    // barrier block, and only the barrier block is refreshed each iteration
+    SparseMatrix<Real> J, JOrig, JStatic;
+    kkt::DiagonalValueMap<Real> kktMap;
+    Matrix<Real> barrier;
+    if( ctrl.system == FULL_KKT || ctrl.system == AUGMENTED_KKT )
+    {
+        Matrix<Real> zeroVec, oneVec;
+        Zeros( zeroVec, n, 1 );
+        Ones( oneVec, n, 1 );
+        if( ctrl.system == FULL_KKT )
+        {
+            KKT
+            ( A, gammaPerm, deltaPerm, betaPerm, zeroVec, oneVec, JStatic,
+              false );
+            kktMap.Initialize( JStatic, n+m, n, JOrig );
+        }
+        else
+        {
+            AugmentedKKT
+            ( A, gammaPerm, deltaPerm, oneVec, zeroVec, JStatic, false );
+            kktMap.Initialize( JStatic, 0, n, JOrig );
+        }
+    }
     ldl::Front<Real> JFront;
     Matrix<Real> d, 
                  w,
                  rc,    rb,    rmu, 
                  dxAff, dyAff, dzAff,
                  dx,    dy,    dz;
+    Matrix<Real> rmuCorr, dxCorr, dyCorr, dzCorr;
 
     Real muOld = 0.1;
+    const Int firstIt = RestoreIterates( ctrl, x, y, z, muOld );
+    if( normalPCG && firstIt > 0 )
+    {
+        ctrl.checkpoint->RestoreValue( "pcgRank", pcgState.rank );
+        ctrl.checkpoint->RestoreValue( "pcgLastIts", pcgState.lastIts );
+    }
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( Int numIts=firstIt; numIts<=ctrl.maxIts; ++numIts )
     {
+        if( ctrl.checkpoint && numIts > firstIt &&
+            numIts % ctrl.checkpointFreq == 0 )
+        {
+            if( normalPCG )
+            {
+                ctrl.checkpoint->RecordValue( "pcgRank", pcgState.rank );
+                ctrl.checkpoint->RecordValue( "pcgLastIts", pcgState.lastIts );
+            }
+            SaveIterates( ctrl, numIts, x, y, z, muOld );
+        }
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -1189,20 +1301,27 @@ void Mehrotra
             // ------------------------
             if( ctrl.system == FULL_KKT )
             {
-                KKT( A, gammaPerm, deltaPerm, betaPerm, x, z, JOrig, false );
+                // The barrier block is -x <> z
+                barrier = x;
+                DiagonalSolve( LEFT, NORMAL, z, barrier );
+                barrier *= -1;
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT( A, gammaPerm, deltaPerm, x, z, JOrig, false );
+                // The barrier block is z <> x
+                barrier = z;
+                DiagonalSolve( LEFT, NORMAL, x, barrier );
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
+            kktMap.Refresh( JStatic, barrier, JOrig );
 
             // Solve for the direction
             // -----------------------
             try
             {
                 J = JOrig;
+                J.FreezeSparsity();
                 UpdateDiagonal( J, Real(1), regTmp );
 
                 if( wMaxNorm >= ctrl.ruizEquilTol )
@@ -1221,10 +1340,12 @@ void Mehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 )
+                if( !cache.analyzed )
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
+                    cache.analyzed = true;
+                    cache.system = ctrl.system;
                 }
                 JFront.Pull( J, map, info );
 
@@ -1252,6 +1373,31 @@ void Mehrotra
             else
                 ExpandAugmentedSolution( x, z, rmu, d, dxAff, dyAff, dzAff );
         }
+        else if( normalPCG )
+        {
+            // Precondition the normal system and solve for the direction
+            // ----------------------------------------------------------
+            NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dyAff );
+            try
+            {
+                NormalPCGPrecondition
+                ( x, z, gammaPerm, deltaPerm,
+                  ctrl.pcgTargetIts, ctrl.pcgMaxRank, pcgState );
+                NormalPCGSolve
+                ( pcgState, dyAff, ctrl.pcgRelTol, ctrl.pcgMaxIts,
+                  ctrl.print );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    break;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandNormalSolution
+            ( A, gammaPerm, x, z, rc, rmu, dxAff, dyAff, dzAff );
+        }
         else // ctrl.system == NORMAL_KKT
         {
             // Construct the KKT system
@@ -1265,10 +1411,12 @@ void Mehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( !cache.analyzed )
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
+                    cache.analyzed = true;
+                    cache.system = ctrl.system;
                 }
                 JFront.Pull( J, map, info );
 
@@ -1325,8 +1473,10 @@ void Mehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
-        Real alphaAffDual = pos_orth::MaxStep( z, dzAff, Real(1) );
+        const auto alphasAff =
+          pos_orth::MaxSteps( x, dxAff, z, dzAff, Real(1) );
+        Real alphaAffPri = alphasAff.first;
+        Real alphaAffDual = alphasAff.second;
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print )
@@ -1349,7 +1499,6 @@ void Mehrotra
         rc *= 1-sigma;
         rb *= 1-sigma;
         Shift( rmu, -sigma*mu );
-        // TODO: Gondzio's corrections 
         if( ctrl.mehrotra )
         {
             // r_mu += dxAff o dzAff
@@ -1360,11 +1509,13 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            KKTRHS( rc, rb, rmu, z, d );
-            try
+        auto solveForDirection =
+          [&]( const Matrix<Real>& rmu,
+               Matrix<Real>& dx, Matrix<Real>& dy, Matrix<Real>& dz )
+          {
+            if( ctrl.system == FULL_KKT )
             {
+                KKTRHS( rc, rb, rmu, z, d );
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
@@ -1374,22 +1525,11 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                ExpandSolution( m, n, d, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            try
+            else if( ctrl.system == AUGMENTED_KKT )
             {
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
@@ -1399,44 +1539,101 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
             }
-            catch(...)
+            else if( normalPCG )
             {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+                NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
+                NormalPCGSolve
+                ( pcgState, dy, ctrl.pcgRelTol, ctrl.pcgMaxIts, ctrl.print );
+                ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
             }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-        {
-            NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
-            try
+            else
             {
+                NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
                 // NOTE: regTmp should be all zeros; replace with unregularized
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, invMap, info, JFront, dy,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+                ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
             }
-            catch(...)
+          };
+        try { solveForDirection( rmu, dx, dy, dz ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        if( ctrl.gondzio )
+        {
+            // NOTE: Preconditioning the normal system is (at most) as
+            //       expensive as a few iterations of PCG
+            const Real costRatio =
+              normalPCG ? Real(1) :
+              Real(JFront.FactorGFlops()) / Real(JFront.SolveGFlops());
+            Int numCorrectors = 0;
+            while( numCorrectors < ctrl.maxGondzioCorrectors &&
+                   (numCorrectors+1)*ctrl.gondzioCostRatio <= costRatio )
+                ++numCorrectors;
+
+            const auto alphas =
+              pos_orth::MaxSteps( x, dx, z, dz, Real(1) );
+            Real alphaPri = alphas.first;
+            Real alphaDual = alphas.second;
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            const Real minIncrease =
+              ctrl.gondzioAcceptRatio*ctrl.gondzioStepIncrease;
+            for( Int corr=0; corr<numCorrectors; ++corr )
             {
-                if( relError <= ctrl.minTol )
+                const Real alpha = Min(alphaPri,alphaDual);
+                if( alpha >= Real(1) )
                     break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+                rmuCorr = rmu;
+                pos_orth::CentralityCorrection
+                ( x, dx, z, dz,
+                  Min(alphaPri+ctrl.gondzioStepIncrease,Real(1)),
+                  Min(alphaDual+ctrl.gondzioStepIncrease,Real(1)),
+                  sigma*mu, ctrl.gondzioBeta, rmuCorr );
+                try { solveForDirection( rmuCorr, dxCorr, dyCorr, dzCorr ); }
+                catch(...) { break; }
+
+                const auto alphasCorr =
+                  pos_orth::MaxSteps( x, dxCorr, z, dzCorr, Real(1) );
+                Real alphaPriCorr = alphasCorr.first;
+                Real alphaDualCorr = alphasCorr.second;
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) < alpha+minIncrease )
+                    break;
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corr,": alphaPri = ",alphaPriCorr,
+                     ", alphaDual = ",alphaDualCorr);
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
             }
-            ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
         }
         // TODO: Residual checks 
 
         // Update the current estimates
         // ============================
-        Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
-        Real alphaDual = pos_orth::MaxStep( z, dz, 1/ctrl.maxStepRatio );
+        const auto alphas =
+          pos_orth::MaxSteps( x, dx, z, dz, 1/ctrl.maxStepRatio );
+        Real alphaPri = alphas.first;
+        Real alphaDual = alphas.second;
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -1503,6 +1700,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -1513,6 +1711,8 @@ void Mehrotra
     else
         centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
     Real gammaPerm, deltaPerm, betaPerm, gammaTmp, deltaTmp, betaTmp;
     if( ctrl.system == NORMAL_KKT )
     {
@@ -1541,20 +1741,34 @@ void Mehrotra
     const Int n = A.Width();
     const Int degree = n;
     Real bScale, cScale;
-    DistMultiVec<Real> dRow(comm), dCol(comm);
+    // Reuse the equilibration and symbolic analysis of a previous solve with
+    // the same sparsity pattern when a cache was provided
+    DistMehrotraCache<Real> localCache;
+    auto& cache = ( ctrl.distCache ? *ctrl.distCache : localCache );
+    auto& dRow = cache.dRowA;
+    auto& dCol = cache.dCol;
     if( ctrl.outerEquil )
     {
-        if( commRank == 0 && ctrl.time )
-            timer.Start();
-        RuizEquil( A, dRow, dCol, ctrl.print );
-        if( commRank == 0 && ctrl.time )
-            Output("RuizEquil: ",timer.Stop()," secs");
+        if( cache.equilibrated )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            if( commRank == 0 && ctrl.time )
+                timer.Start();
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            if( commRank == 0 && ctrl.time )
+                Output("RuizEquil: ",timer.Stop()," secs");
+            cache.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b ); 
         DiagonalSolve( LEFT, NORMAL, dCol, c );
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -1565,11 +1779,11 @@ void Mehrotra
         cScale = Max(MaxNorm(c),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             x *= Real(1)/bScale;
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             y *= Real(1)/cScale;
             z *= Real(1)/cScale;
@@ -1584,8 +1798,11 @@ void Mehrotra
     {
         bScale = 1;
         cScale = 1;
+        dRow.SetComm( comm );
+        dCol.SetComm( comm );
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        cache.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -1604,21 +1821,26 @@ void Mehrotra
         }
     }
 
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
-    vector<Int> mappedSources, mappedTargets, colOffs;
+    if( cache.analyzed && cache.system != ctrl.system )
+        LogicError("The cached analysis is of a different KKT system");
+    auto& map = cache.map;
+    auto& invMap = cache.invMap;
+    auto& info = cache.info;
+    auto& rootSep = cache.rootSep;
+    auto& mappedSources = cache.mappedSources;
+    auto& mappedTargets = cache.mappedTargets;
+    auto& colOffs = cache.colOffs;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.system == AUGMENTED_KKT && !cache.analyzed )
     {
         Initialize
         ( A, b, c, x, y, z, map, invMap, rootSep, info, 
           mappedSources, mappedTargets, colOffs,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
     {
@@ -1629,8 +1851,11 @@ void Mehrotra
         Initialize
         ( A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
           augMappedSources, augMappedTargets, augColOffs,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }
+    if( ctrl.warmStart )
+        pos_orth::WarmStart
+        ( x, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1664,26 +1889,67 @@ void Mehrotra
     regTmp *= origTwoNormEst;
 
     DistGraphMultMeta metaOrig, meta;
-    DistSparseMatrix<Real> J(comm), JOrig(comm);
+    // The full and augmented KKT systems are assembled once, with a zero
+    // barrier block, and only the barrier block is refreshed each iteration
+    DistSparseMatrix<Real> J(comm), JOrig(comm), JStatic(comm);
+    kkt::DistDiagonalValueMap<Real> kktMap;
+    DistMultiVec<Real> barrier(comm);
+    if( ctrl.system == FULL_KKT || ctrl.system == AUGMENTED_KKT )
+    {
+        DistMultiVec<Real> zeroVec(comm), oneVec(comm);
+        Zeros( zeroVec, n, 1 );
+        Ones( oneVec, n, 1 );
+        if( ctrl.system == FULL_KKT )
+        {
+            KKT
+            ( A, gammaPerm, deltaPerm, betaPerm, zeroVec, oneVec, JStatic,
+              false );
+            kktMap.Initialize( JStatic, n+m, n, JOrig );
+        }
+        else
+        {
+            AugmentedKKT
+            ( A, gammaPerm, deltaPerm, oneVec, zeroVec, JStatic, false );
+            kktMap.Initialize( JStatic, 0, n, JOrig );
+        }
+    }
     ldl::DistFront<Real> JFront;
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
                        dxAff(comm), dyAff(comm), dzAff(comm),
                        dx(comm),    dy(comm),    dz(comm);
+    DistMultiVec<Real> rmuCorr(comm), dxCorr(comm), dyCorr(comm), dzCorr(comm);
 
     Real muOld = 0.1;
+    const Int firstIt = RestoreIterates( ctrl, x, y, z, muOld );
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( Int numIts=firstIt; numIts<=ctrl.maxIts; ++numIts )
     {
+        if( ctrl.checkpoint && numIts > firstIt &&
+            numIts % ctrl.checkpointFreq == 0 )
+            SaveIterates( ctrl, numIts, x, y, z, muOld );
+
+        // Form the residuals
+        // ==================
+        rb = b;
+        Multiply( NORMAL, Real(1), A, x, Real(-1), rb );
+        rc = c;
+        Multiply( TRANSPOSE, Real(1), A, y, Real(1), rc );
+        rc -= z;
+
+        // Accumulate all of the reductions over the iterates at once
+        // ==========================================================
+        const auto stats = ComputeIterateStats( b, c, x, y, z, rb, rc );
+
         // Ensure that x and z are in the cone
         // ===================================
-        const Int xNumNonPos = pos_orth::NumOutside( x );
-        const Int zNumNonPos = pos_orth::NumOutside( z );
+        const Int xNumNonPos = stats.xNumNonPos;
+        const Int zNumNonPos = stats.zNumNonPos;
         if( xNumNonPos > 0 || zNumNonPos > 0 )
             LogicError
             (xNumNonPos," entries of x were nonpositive and ",
@@ -1691,8 +1957,8 @@ void Mehrotra
 
         // Compute the barrier parameter
         // =============================
-        Real mu = Dot(x,z) / degree;
-        const Real compRatio = pos_orth::ComplementRatio( x, z );
+        Real mu = stats.xDotZ / degree;
+        const Real compRatio = stats.compRatio;
         mu = ( compRatio > balanceTol ? muOld : Min(mu,muOld) );
         muOld = mu;
 
@@ -1703,22 +1969,17 @@ void Mehrotra
         // =====================
         // |primal - dual| / (1 + |primal|) <= tol ?
         // -----------------------------------------
-        const Real primObj = Dot(c,x);
-        const Real dualObj = -Dot(b,y); 
+        const Real primObj = stats.primObj;
+        const Real dualObj = stats.dualObj;
         const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
         // || r_b ||_2 / (1 + || b ||_2) <= tol ?
         // --------------------------------------
-        rb = b;
-        Multiply( NORMAL, Real(1), A, x, Real(-1), rb );
-        const Real rbNrm2 = Nrm2( rb );
+        const Real rbNrm2 = stats.rbNrm2;
         const Real rbConv = rbNrm2 / (1+bNrm2);
         Axpy( -deltaPerm*deltaPerm, y, rb ); 
         // || r_c ||_2 / (1 + || c ||_2) <= tol ?
         // --------------------------------------
-        rc = c;
-        Multiply( TRANSPOSE, Real(1), A, y, Real(1), rc );
-        rc -= z;
-        const Real rcNrm2 = Nrm2( rc );
+        const Real rcNrm2 = stats.rcNrm2;
         const Real rcConv = rcNrm2 / (1+cNrm2);
         Axpy( gammaPerm*gammaPerm, x, rc );
         // Now check the pieces
@@ -1765,14 +2026,20 @@ void Mehrotra
             // -----------------------
             if( ctrl.system == FULL_KKT )
             {
-                KKT( A, gammaPerm, deltaPerm, betaPerm, x, z, JOrig, false );
+                // The barrier block is -x <> z
+                barrier = x;
+                DiagonalSolve( LEFT, NORMAL, z, barrier );
+                barrier *= -1;
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT( A, gammaPerm, deltaPerm, x, z, JOrig, false );
+                // The barrier block is z <> x
+                barrier = z;
+                DiagonalSolve( LEFT, NORMAL, x, barrier );
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
+            kktMap.Refresh( JStatic, barrier, JOrig );
 
             // Solve for the direction
             // -----------------------
@@ -1797,15 +2064,20 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
+                }
+                else
+                    J.LockedDistGraph().multMeta = meta;
+                if( !cache.analyzed )
+                {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
                     NestedDissection( J.LockedDistGraph(), map, rootSep, info );
                     if( commRank == 0 && ctrl.time )
                         Output("ND: ",timer.Stop()," secs");
                     InvertMap( map, invMap );
+                    cache.analyzed = true;
+                    cache.system = ctrl.system;
                 }
-                else
-                    J.LockedDistGraph().multMeta = meta;
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -1888,15 +2160,20 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
+                }
+                else
+                    J.LockedDistGraph().multMeta = meta;
+                if( !cache.analyzed )
+                {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
                     NestedDissection( J.LockedDistGraph(), map, rootSep, info );
                     if( commRank == 0 && ctrl.time )
                         Output("ND: ",timer.Stop()," secs");
                     InvertMap( map, invMap );
+                    cache.analyzed = true;
+                    cache.system = ctrl.system;
                 }
-                else
-                    J.LockedDistGraph().multMeta = meta;
                 JFront.Pull
                 ( J, map, rootSep, info, 
                   mappedSources, mappedTargets, colOffs );
@@ -1963,8 +2240,10 @@ void Mehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
-        Real alphaAffDual = pos_orth::MaxStep( z, dzAff, Real(1) );
+        const auto alphasAff =
+          pos_orth::MaxSteps( x, dxAff, z, dzAff, Real(1) );
+        Real alphaAffPri = alphasAff.first;
+        Real alphaAffDual = alphasAff.second;
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
@@ -1997,13 +2276,17 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
-        {
-            KKTRHS( rc, rb, rmu, z, d );
-            try
+        auto solveForDirection =
+          [&]( const DistMultiVec<Real>& rmu,
+               DistMultiVec<Real>& dx,
+               DistMultiVec<Real>& dy,
+               DistMultiVec<Real>& dz )
+          {
+            if( commRank == 0 && ctrl.time )
+                timer.Start();
+            if( ctrl.system == FULL_KKT )
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                KKTRHS( rc, rb, rmu, z, d );
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -2013,26 +2296,11 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                ExpandSolution( m, n, d, dx, dy, dz );
             }
-            catch(...)
+            else if( ctrl.system == AUGMENTED_KKT )
             {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            try
-            {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -2042,49 +2310,93 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
             }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-        {
-            NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
-            try
+            else
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, invMap, info, JFront, dy, dmvMeta,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
             }
-            catch(...)
+            if( commRank == 0 && ctrl.time )
+                Output("Corrector: ",timer.Stop()," secs");
+          };
+        try { solveForDirection( rmu, dx, dy, dz ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+        }
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        if( ctrl.gondzio )
+        {
+            const Real costRatio =
+              Real(mpi::AllReduce(JFront.LocalFactorGFlops(),comm)) /
+              Real(mpi::AllReduce(JFront.LocalSolveGFlops(),comm));
+            Int numCorrectors = 0;
+            while( numCorrectors < ctrl.maxGondzioCorrectors &&
+                   (numCorrectors+1)*ctrl.gondzioCostRatio <= costRatio )
+                ++numCorrectors;
+
+            const auto alphas =
+              pos_orth::MaxSteps( x, dx, z, dz, Real(1) );
+            Real alphaPri = alphas.first;
+            Real alphaDual = alphas.second;
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            const Real minIncrease =
+              ctrl.gondzioAcceptRatio*ctrl.gondzioStepIncrease;
+            for( Int corr=0; corr<numCorrectors; ++corr )
             {
-                if( relError <= ctrl.minTol )
+                const Real alpha = Min(alphaPri,alphaDual);
+                if( alpha >= Real(1) )
                     break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+                rmuCorr = rmu;
+                pos_orth::CentralityCorrection
+                ( x, dx, z, dz,
+                  Min(alphaPri+ctrl.gondzioStepIncrease,Real(1)),
+                  Min(alphaDual+ctrl.gondzioStepIncrease,Real(1)),
+                  sigma*mu, ctrl.gondzioBeta, rmuCorr );
+                try { solveForDirection( rmuCorr, dxCorr, dyCorr, dzCorr ); }
+                catch(...) { break; }
+
+                const auto alphasCorr =
+                  pos_orth::MaxSteps( x, dxCorr, z, dzCorr, Real(1) );
+                Real alphaPriCorr = alphasCorr.first;
+                Real alphaDualCorr = alphasCorr.second;
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) < alpha+minIncrease )
+                    break;
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corr,": alphaPri = ",alphaPriCorr,
+                     ", alphaDual = ",alphaDualCorr);
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
             }
-            ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
         }
         // TODO: Residual checks 
 
         // Update the current estimates
         // ============================
-        Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
-        Real alphaDual = pos_orth::MaxStep( z, dz, 1/ctrl.maxStepRatio );
+        const auto alphas =
+          pos_orth::MaxSteps( x, dx, z, dz, 1/ctrl.maxStepRatio );
+        Real alphaPri = alphas.first;
+        Real alphaDual = alphas.second;
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -268,6 +268,161 @@ void ExpandNormalSolution
   const DistMultiVec<Real>& dy, 
         DistMultiVec<Real>& dz );
 
+// Iterate statistics
+// ==================
+// The quantities examined at the start of each iteration: the number of
+// nonpositive entries of x and z, x^T z, the primal and dual objectives,
+// c^T x and -b^T y, the complementarity ratio, max(x o z) / min(x o z), and
+// the two-norms of the residuals r_b and r_c. They are accumulated in a
+// single local pass, so that the distributed variants only require one
+// summation and one maximization rather than a reduction per quantity.
+template<typename Real>
+struct IterateStats
+{
+    Int xNumNonPos, zNumNonPos;
+    Real xDotZ;
+    Real primObj, dualObj;
+    Real compRatio;
+    Real rbNrm2, rcNrm2;
+};
+
+template<typename Real>
+IterateStats<Real> ComputeIterateStats
+( const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& x,
+  const Matrix<Real>& y,
+  const Matrix<Real>& z,
+  const Matrix<Real>& rb,
+  const Matrix<Real>& rc );
+template<typename Real>
+IterateStats<Real> ComputeIterateStats
+( const ElementalMatrix<Real>& b,
+  const ElementalMatrix<Real>& c,
+  const ElementalMatrix<Real>& x,
+  const ElementalMatrix<Real>& y,
+  const ElementalMatrix<Real>& z,
+  const ElementalMatrix<Real>& rb,
+  const ElementalMatrix<Real>& rc );
+template<typename Real>
+IterateStats<Real> ComputeIterateStats
+( const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& rb,
+  const DistMultiVec<Real>& rc );
+
+// Matrix-free normal system
+// =========================
+// The state of a Preconditioned Conjugate Gradient solver for
+//
+//   (A D^2 A^T + delta^2 I) dy = d,
+//
+// with A = [A_s, A_d] split into its sparse and dense columns. The
+// preconditioner is a partial Cholesky factorization of the sparse part,
+//
+//   A_s D_s^2 A_s^T + delta^2 I ~= P = | L11 0 | | I 0  | | L11^T L21^T |,
+//                                      | L21 I | | 0 Ds | |   0     I   |
+//
+// (after a symmetric permutation of the pivots to the front), corrected for
+// the dense part, U U^T = A_d D_d^2 A_d^T, via the Sherman-Morrison-Woodbury
+// formula
+//
+//   inv(P + U U^T) = inv(P) - inv(P) U inv(I + U^T inv(P) U) U^T inv(P).
+//
+template<typename Real>
+struct NormalPCGState
+{
+    // The original indices of the dense columns, A_d, and A_s (which is A with
+    // its dense columns removed)
+    vector<Int> denseCols;
+    Matrix<Real> ADense;
+    SparseMatrix<Real> ASparse;
+
+    // The current regularization, D^2, and U = A_d D_d
+    Real delta;
+    Matrix<Real> dSq, U;
+
+    // The partial Cholesky factorization, where 'pivotInds' holds the position
+    // of each row within 'pivots' (or -1) and the pivot rows of L21 are zero
+    Int rank;
+    vector<Int> pivots, pivotInds;
+    Matrix<Real> L11, L21, schurDiag;
+
+    // inv(P) U and the Cholesky factor of I + U^T inv(P) U
+    Matrix<Real> PInvU, capacitance;
+
+    // The number of iterations required by the last solve
+    Int lastIts;
+};
+
+template<typename Real>
+void NormalPCGSetup
+( const SparseMatrix<Real>& A,
+        Real denseColumnRatio,
+        Int rank,
+        NormalPCGState<Real>& state );
+
+template<typename Real>
+void NormalPCGPrecondition
+( const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Real gamma,
+        Real delta,
+        Int targetIts,
+        Int maxRank,
+        NormalPCGState<Real>& state );
+
+// Overwrite d with the solution of the normal system and return the number of
+// iterations
+template<typename Real>
+Int NormalPCGSolve
+(       NormalPCGState<Real>& state,
+        Matrix<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress=false );
+
+// Checkpointing
+// =============
+
+// If requested, restore the iterates and the barrier parameter from the
+// latest complete snapshot, and return the iteration to resume from
+template<typename Real,class MatrixType>
+Int RestoreIterates
+( const MehrotraCtrl<Real>& ctrl,
+  MatrixType& x, MatrixType& y, MatrixType& z, Real& muOld )
+{
+    DEBUG_CSE
+    if( !ctrl.checkpoint || !ctrl.resume || !ctrl.checkpoint->Load() )
+        return 0;
+    ctrl.checkpoint->Restore( "x", x );
+    ctrl.checkpoint->Restore( "y", y );
+    ctrl.checkpoint->Restore( "z", z );
+    ctrl.checkpoint->RestoreValue( "muOld", muOld );
+    return ctrl.checkpoint->Step();
+}
+
+// Record the iterates and the barrier parameter at the beginning of iteration
+// 'numIts' and save them in the background (any additional state should be
+// recorded beforehand)
+template<typename Real,class MatrixType>
+void SaveIterates
+( const MehrotraCtrl<Real>& ctrl,
+        Int numIts,
+  const MatrixType& x, const MatrixType& y, const MatrixType& z,
+        Real muOld )
+{
+    DEBUG_CSE
+    ctrl.checkpoint->Record( "x", x );
+    ctrl.checkpoint->Record( "y", y );
+    ctrl.checkpoint->Record( "z", z );
+    ctrl.checkpoint->RecordValue( "muOld", muOld );
+    ctrl.checkpoint->Save( numIts );
+}
+
 } // namespace direct
 } // namespace lp
 } // namespace El
@@ -0,0 +1,235 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../util.hpp"
+
+namespace El {
+namespace lp {
+namespace direct {
+
+namespace iterate_stats {
+
+// The local contributions are accumulated into
+//
+//   sums  = [# x_i <= 0, # z_i <= 0, x^T z, c^T x, b^T y, || r_b ||_2^2,
+//            || r_c ||_2^2],
+//   maxes = [max(x o z), -min(x o z)],
+//
+// which are then each combined with a single reduction.
+const Int numSums = 7;
+const Int numMaxes = 2;
+
+template<typename Real>
+void AccumulatePrimal
+( Int localHeight,
+  const Real* cBuf,
+  const Real* xBuf,
+  const Real* zBuf,
+  const Real* rcBuf,
+  Real* sums, Real* maxes )
+{
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real xi = xBuf[iLoc];
+        const Real zi = zBuf[iLoc];
+        const Real rci = rcBuf[iLoc];
+        const Real prod = xi*zi;
+        if( xi <= Real(0) )
+            sums[0] += Real(1);
+        if( zi <= Real(0) )
+            sums[1] += Real(1);
+        sums[2] += prod;
+        sums[3] += cBuf[iLoc]*xi;
+        sums[6] += rci*rci;
+        maxes[0] = Max( maxes[0], prod );
+        maxes[1] = Max( maxes[1], -prod );
+    }
+}
+
+template<typename Real>
+void AccumulateDual
+( Int localHeight,
+  const Real* bBuf,
+  const Real* yBuf,
+  const Real* rbBuf,
+  Real* sums )
+{
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real rbi = rbBuf[iLoc];
+        sums[4] += bBuf[iLoc]*yBuf[iLoc];
+        sums[5] += rbi*rbi;
+    }
+}
+
+template<typename Real>
+IterateStats<Real> Finish( const Real* sums, const Real* maxes )
+{
+    IterateStats<Real> stats;
+    stats.xNumNonPos = Int(sums[0]);
+    stats.zNumNonPos = Int(sums[1]);
+    stats.xDotZ = sums[2];
+    stats.primObj = sums[3];
+    stats.dualObj = -sums[4];
+    stats.rbNrm2 = Sqrt( sums[5] );
+    stats.rcNrm2 = Sqrt( sums[6] );
+    stats.compRatio = maxes[0] / (-maxes[1]);
+    return stats;
+}
+
+} // namespace iterate_stats
+
+template<typename Real>
+IterateStats<Real> ComputeIterateStats
+( const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& x,
+  const Matrix<Real>& y,
+  const Matrix<Real>& z,
+  const Matrix<Real>& rb,
+  const Matrix<Real>& rc )
+{
+    DEBUG_CSE
+    Real sums[iterate_stats::numSums], maxes[iterate_stats::numMaxes];
+    for( Int k=0; k<iterate_stats::numSums; ++k )
+        sums[k] = 0;
+    maxes[0] = 0;
+    maxes[1] = limits::Lowest<Real>();
+    iterate_stats::AccumulatePrimal
+    ( x.Height(),
+      c.LockedBuffer(), x.LockedBuffer(), z.LockedBuffer(),
+      rc.LockedBuffer(), sums, maxes );
+    iterate_stats::AccumulateDual
+    ( y.Height(), b.LockedBuffer(), y.LockedBuffer(), rb.LockedBuffer(), sums );
+    return iterate_stats::Finish( sums, maxes );
+}
+
+template<typename Real>
+IterateStats<Real> ComputeIterateStats
+( const ElementalMatrix<Real>& bPre,
+  const ElementalMatrix<Real>& cPre,
+  const ElementalMatrix<Real>& xPre,
+  const ElementalMatrix<Real>& yPre,
+  const ElementalMatrix<Real>& zPre,
+  const ElementalMatrix<Real>& rbPre,
+  const ElementalMatrix<Real>& rcPre )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> xProx( xPre ), yProx( yPre );
+    auto& x = xProx.GetLocked();
+    auto& y = yProx.GetLocked();
+
+    ElementalProxyCtrl xCtrl, yCtrl;
+    xCtrl.colConstrain = yCtrl.colConstrain = true;
+    xCtrl.rowConstrain = yCtrl.rowConstrain = true;
+    xCtrl.colAlign = x.ColAlign();
+    xCtrl.rowAlign = x.RowAlign();
+    yCtrl.colAlign = y.ColAlign();
+    yCtrl.rowAlign = y.RowAlign();
+
+    DistMatrixReadProxy<Real,Real,MC,MR>
+      cProx( cPre, xCtrl ),
+      zProx( zPre, xCtrl ),
+      rcProx( rcPre, xCtrl ),
+      bProx( bPre, yCtrl ),
+      rbProx( rbPre, yCtrl );
+    auto& c = cProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    auto& rc = rcProx.GetLocked();
+    auto& b = bProx.GetLocked();
+    auto& rb = rbProx.GetLocked();
+
+    Real sums[iterate_stats::numSums], maxes[iterate_stats::numMaxes];
+    for( Int k=0; k<iterate_stats::numSums; ++k )
+        sums[k] = 0;
+    maxes[0] = 0;
+    maxes[1] = limits::Lowest<Real>();
+    if( x.IsLocalCol(0) )
+        iterate_stats::AccumulatePrimal
+        ( x.LocalHeight(),
+          c.LockedBuffer(), x.LockedBuffer(), z.LockedBuffer(),
+          rc.LockedBuffer(), sums, maxes );
+    if( y.IsLocalCol(0) )
+        iterate_stats::AccumulateDual
+        ( y.LocalHeight(),
+          b.LockedBuffer(), y.LockedBuffer(), rb.LockedBuffer(), sums );
+    mpi::AllReduce( sums, iterate_stats::numSums, mpi::SUM, x.DistComm() );
+    mpi::AllReduce( maxes, iterate_stats::numMaxes, mpi::MAX, x.DistComm() );
+    return iterate_stats::Finish( sums, maxes );
+}
+
+template<typename Real>
+IterateStats<Real> ComputeIterateStats
+( const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& rb,
+  const DistMultiVec<Real>& rc )
+{
+    DEBUG_CSE
+    Real sums[iterate_stats::numSums], maxes[iterate_stats::numMaxes];
+    for( Int k=0; k<iterate_stats::numSums; ++k )
+        sums[k] = 0;
+    maxes[0] = 0;
+    maxes[1] = limits::Lowest<Real>();
+    iterate_stats::AccumulatePrimal
+    ( x.LocalHeight(),
+      c.LockedMatrix().LockedBuffer(),
+      x.LockedMatrix().LockedBuffer(),
+      z.LockedMatrix().LockedBuffer(),
+      rc.LockedMatrix().LockedBuffer(), sums, maxes );
+    iterate_stats::AccumulateDual
+    ( y.LocalHeight(),
+      b.LockedMatrix().LockedBuffer(),
+      y.LockedMatrix().LockedBuffer(),
+      rb.LockedMatrix().LockedBuffer(), sums );
+    mpi::AllReduce( sums, iterate_stats::numSums, mpi::SUM, x.Comm() );
+    mpi::AllReduce( maxes, iterate_stats::numMaxes, mpi::MAX, x.Comm() );
+    return iterate_stats::Finish( sums, maxes );
+}
+
+#define PROTO(Real) \
+  template IterateStats<Real> ComputeIterateStats \
+  ( const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& y, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& rb, \
+    const Matrix<Real>& rc ); \
+  template IterateStats<Real> ComputeIterateStats \
+  ( const ElementalMatrix<Real>& b, \
+    const ElementalMatrix<Real>& c, \
+    const ElementalMatrix<Real>& x, \
+    const ElementalMatrix<Real>& y, \
+    const ElementalMatrix<Real>& z, \
+    const ElementalMatrix<Real>& rb, \
+    const ElementalMatrix<Real>& rc ); \
+  template IterateStats<Real> ComputeIterateStats \
+  ( const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& y, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& rb, \
+    const DistMultiVec<Real>& rc );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace lp
+} // namespace El
@@ -0,0 +1,367 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../util.hpp"
+
+namespace El {
+namespace lp {
+namespace direct {
+
+// See J. Gondzio, "Matrix-free interior point method", Computational
+// Optimization and Applications, Vol. 51, pp. 457--480, 2012, for the
+// partial Cholesky preconditioner, and E.D. Andersen, "A modified Schur
+// complement method for handling dense columns in interior-point methods
+// for linear programming", ACM Transactions on Mathematical Software,
+// Vol. 22, pp. 348--356, 1996, for the treatment of dense columns.
+
+namespace {
+
+// Overwrite r with inv(P) r, where P is the partial Cholesky preconditioner
+// of the sparse part of the normal matrix
+template<typename Real>
+void ApplySparsePreconditioner
+( const NormalPCGState<Real>& state, Matrix<Real>& r )
+{
+    DEBUG_CSE
+    const Int m = r.Height();
+    const Int k = state.pivots.size();
+    Matrix<Real> y1;
+    y1.Resize( k, 1 );
+    for( Int t=0; t<k; ++t )
+        y1(t) = r(state.pivots[t]);
+
+    // Solve against the block unit lower-triangular factor
+    Trsv( LOWER, NORMAL, NON_UNIT, state.L11, y1 );
+    Gemv( NORMAL, Real(-1), state.L21, y1, Real(1), r );
+
+    // Solve against the block diagonal
+    for( Int i=0; i<m; ++i )
+    {
+        if( state.pivotInds[i] >= 0 )
+            r(i) = 0;
+        else
+            r(i) /= state.schurDiag(i);
+    }
+
+    // Solve against the transpose of the block unit lower-triangular factor
+    Gemv( TRANSPOSE, Real(-1), state.L21, r, Real(1), y1 );
+    Trsv( LOWER, TRANSPOSE, NON_UNIT, state.L11, y1 );
+    for( Int t=0; t<k; ++t )
+        r(state.pivots[t]) = y1(t);
+}
+
+// Overwrite r with inv(P + U U^T) r
+template<typename Real>
+void ApplyPreconditioner
+( const NormalPCGState<Real>& state, Matrix<Real>& r )
+{
+    DEBUG_CSE
+    ApplySparsePreconditioner( state, r );
+    if( state.U.Width() == 0 )
+        return;
+    // r := r - inv(P) U inv(I + U^T inv(P) U) U^T inv(P) r
+    Matrix<Real> t;
+    Gemv( TRANSPOSE, Real(1), state.U, r, t );
+    Trsv( LOWER, NORMAL, NON_UNIT, state.capacitance, t );
+    Trsv( LOWER, TRANSPOSE, NON_UNIT, state.capacitance, t );
+    Gemv( NORMAL, Real(-1), state.PInvU, t, Real(1), r );
+}
+
+// q := (A D^2 A^T + delta^2 I) p
+template<typename Real>
+void ApplyNormal
+( const NormalPCGState<Real>& state,
+  const Matrix<Real>& p,
+        Matrix<Real>& q,
+        Matrix<Real>& tmp )
+{
+    DEBUG_CSE
+    Zeros( tmp, state.ASparse.Width(), 1 );
+    Multiply( TRANSPOSE, Real(1), state.ASparse, p, Real(0), tmp );
+    DiagonalScale( LEFT, NORMAL, state.dSq, tmp );
+    q = p;
+    q *= state.delta*state.delta;
+    Multiply( NORMAL, Real(1), state.ASparse, tmp, Real(1), q );
+    if( state.U.Width() > 0 )
+    {
+        Matrix<Real> t;
+        Gemv( TRANSPOSE, Real(1), state.U, p, t );
+        Gemv( NORMAL, Real(1), state.U, t, Real(1), q );
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void NormalPCGSetup
+( const SparseMatrix<Real>& A,
+        Real denseColumnRatio,
+        Int rank,
+        NormalPCGState<Real>& state )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    const Int* rowBuf = A.LockedSourceBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+
+    // Columns with only a handful of nonzeros are never treated as dense
+    const Int minDenseCount = 10;
+    vector<Int> colCounts(n,0);
+    for( Int e=0; e<numEntries; ++e )
+        ++colCounts[colBuf[e]];
+    vector<Int> denseInds(n,-1);
+    state.denseCols.clear();
+    for( Int j=0; j<n; ++j )
+    {
+        if( colCounts[j] > minDenseCount &&
+            Real(colCounts[j]) > denseColumnRatio*m )
+        {
+            denseInds[j] = state.denseCols.size();
+            state.denseCols.push_back( j );
+        }
+    }
+    const Int numDense = state.denseCols.size();
+
+    Zeros( state.ADense, m, numDense );
+    Zeros( state.ASparse, m, n );
+    state.ASparse.Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int j = colBuf[e];
+        if( denseInds[j] >= 0 )
+            state.ADense(rowBuf[e],denseInds[j]) = valBuf[e];
+        else
+            state.ASparse.QueueUpdate( rowBuf[e], j, valBuf[e] );
+    }
+    state.ASparse.ProcessQueues();
+
+    state.delta = 0;
+    state.rank = rank;
+    state.lastIts = 0;
+}
+
+template<typename Real>
+void NormalPCGPrecondition
+( const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Real gamma,
+        Real delta,
+        Int targetIts,
+        Int maxRank,
+        NormalPCGState<Real>& state )
+{
+    DEBUG_CSE
+    const auto& ASparse = state.ASparse;
+    const Int m = ASparse.Height();
+    const Int n = ASparse.Width();
+    const Int numDense = state.denseCols.size();
+    const Int* colBuf = ASparse.LockedTargetBuffer();
+    const Int* rowBuf = ASparse.LockedSourceBuffer();
+    const Real* valBuf = ASparse.LockedValueBuffer();
+    const Real eps = limits::Epsilon<Real>();
+
+    // Enrich the preconditioner if the last solve was too expensive
+    if( state.lastIts > targetIts )
+        state.rank = Min( 2*state.rank, maxRank );
+    const Int k = Min( state.rank, m );
+    state.delta = delta;
+
+    // D^2 := inv( inv(X) Z + gamma^2 I )
+    // ==================================
+    state.dSq.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        state.dSq(j) = Real(1) / (z(j)/x(j) + gamma*gamma);
+
+    // Form the diagonal of A_s D_s^2 A_s^T + delta^2 I
+    // ================================================
+    Matrix<Real> diag;
+    diag.Resize( m, 1 );
+    Fill( diag, delta*delta );
+    const Int numEntries = ASparse.NumEntries();
+    for( Int e=0; e<numEntries; ++e )
+        diag(rowBuf[e]) += valBuf[e]*valBuf[e]*state.dSq(colBuf[e]);
+    const Real minPivot = eps*Max(MaxNorm(diag),Real(1));
+
+    // Pivot on the k largest diagonal entries
+    // =======================================
+    vector<Int> perm(m);
+    for( Int i=0; i<m; ++i )
+        perm[i] = i;
+    std::partial_sort
+    ( perm.begin(), perm.begin()+k, perm.end(),
+      [&]( Int i, Int j ) { return diag(i) > diag(j); } );
+    state.pivots.assign( perm.begin(), perm.begin()+k );
+    state.pivotInds.assign( m, -1 );
+    for( Int t=0; t<k; ++t )
+        state.pivotInds[state.pivots[t]] = t;
+
+    // Form the pivot columns of A_s D_s^2 A_s^T + delta^2 I
+    // =====================================================
+    Zeros( state.L21, m, k );
+    Matrix<Real> v;
+    Zeros( v, n, 1 );
+    for( Int t=0; t<k; ++t )
+    {
+        const Int i = state.pivots[t];
+        const Int rowBeg = ASparse.RowOffset(i);
+        const Int rowEnd = ASparse.RowOffset(i+1);
+        for( Int e=rowBeg; e<rowEnd; ++e )
+            v(colBuf[e]) = valBuf[e]*state.dSq(colBuf[e]);
+        auto l = state.L21( ALL, IR(t) );
+        Multiply( NORMAL, Real(1), ASparse, v, Real(0), l );
+        l(i) += delta*delta;
+        for( Int e=rowBeg; e<rowEnd; ++e )
+            v(colBuf[e]) = 0;
+    }
+
+    // Factor the pivot block and eliminate it from the remaining rows
+    // ===============================================================
+    state.L11.Resize( k, k );
+    for( Int t=0; t<k; ++t )
+    {
+        const Int i = state.pivots[t];
+        for( Int s=0; s<k; ++s )
+        {
+            state.L11(t,s) = state.L21(i,s);
+            state.L21(i,s) = 0;
+        }
+    }
+    ShiftDiagonal( state.L11, minPivot );
+    Cholesky( LOWER, state.L11 );
+    Trsm
+    ( RIGHT, LOWER, TRANSPOSE, NON_UNIT,
+      Real(1), state.L11, state.L21 );
+
+    // Approximate the Schur complement by its diagonal
+    // ================================================
+    state.schurDiag.Resize( m, 1 );
+    for( Int i=0; i<m; ++i )
+    {
+        if( state.pivotInds[i] >= 0 )
+        {
+            state.schurDiag(i) = 1;
+            continue;
+        }
+        Real schur = diag(i);
+        for( Int t=0; t<k; ++t )
+            schur -= state.L21(i,t)*state.L21(i,t);
+        state.schurDiag(i) = Max( schur, minPivot );
+    }
+
+    // Form the Sherman-Morrison-Woodbury correction for the dense columns
+    // ===================================================================
+    state.U = state.ADense;
+    for( Int t=0; t<numDense; ++t )
+    {
+        auto u = state.U( ALL, IR(t) );
+        u *= Sqrt(state.dSq(state.denseCols[t]));
+    }
+    state.PInvU = state.U;
+    for( Int t=0; t<numDense; ++t )
+    {
+        auto PInvu = state.PInvU( ALL, IR(t) );
+        ApplySparsePreconditioner( state, PInvu );
+    }
+    Identity( state.capacitance, numDense, numDense );
+    Gemm
+    ( TRANSPOSE, NORMAL,
+      Real(1), state.U, state.PInvU, Real(1), state.capacitance );
+    if( numDense > 0 )
+        Cholesky( LOWER, state.capacitance );
+}
+
+template<typename Real>
+Int NormalPCGSolve
+(       NormalPCGState<Real>& state,
+        Matrix<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress )
+{
+    DEBUG_CSE
+    const Int m = d.Height();
+    const Real dNrm2 = Nrm2( d );
+    Matrix<Real> y, r, p, q, t, tmp;
+    Zeros( y, m, 1 );
+    if( dNrm2 == Real(0) )
+    {
+        state.lastIts = 0;
+        d = y;
+        return 0;
+    }
+
+    r = d;
+    t = r;
+    ApplyPreconditioner( state, t );
+    p = t;
+    Real rt = Dot( r, t );
+    Real rNrm2 = dNrm2;
+    Int numIts = 0;
+    while( numIts < maxIts && rNrm2 > relTol*dNrm2 )
+    {
+        ApplyNormal( state, p, q, tmp );
+        const Real alpha = rt / Dot( p, q );
+        Axpy( alpha, p, y );
+        Axpy( -alpha, q, r );
+        rNrm2 = Nrm2( r );
+        ++numIts;
+
+        t = r;
+        ApplyPreconditioner( state, t );
+        const Real rtNew = Dot( r, t );
+        const Real beta = rtNew / rt;
+        rt = rtNew;
+        p *= beta;
+        p += t;
+    }
+    if( progress )
+        Output
+        ("PCG took ",numIts," iterations with rank ",state.pivots.size(),
+         " and ",state.denseCols.size()," dense columns to reach ",
+         "|| r ||_2 / || d ||_2 = ",rNrm2/dNrm2);
+    state.lastIts = numIts;
+    d = y;
+    return numIts;
+}
+
+#define PROTO(Real) \
+  template void NormalPCGSetup \
+  ( const SparseMatrix<Real>& A, \
+          Real denseColumnRatio, \
+          Int rank, \
+          NormalPCGState<Real>& state ); \
+  template void NormalPCGPrecondition \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          Real gamma, \
+          Real delta, \
+          Int targetIts, \
+          Int maxRank, \
+          NormalPCGState<Real>& state ); \
+  template Int NormalPCGSolve \
+  (       NormalPCGState<Real>& state, \
+          Matrix<Real>& d, \
+          Real relTol, \
+          Int maxIts, \
+          bool progress );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace lp
+} // namespace El
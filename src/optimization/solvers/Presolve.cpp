@@ -0,0 +1,1118 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Presolve for "direct" conic-form LPs and QPs,
+//
+//   min (1/2) x^T Q x + c^T x
+//   s.t. A x = b, x >= 0,
+//
+// with Q = 0 in the LP case. Each round classifies the rows which are still
+// active with respect to the columns which are still active: empty rows and
+// rows which are multiples of an earlier row are dropped (after checking
+// their consistency), while rows whose active coefficients share a sign and
+// whose residual right-hand side is zero ("forcing" rows), as well as
+// singleton rows, imply values for each of their active columns. Since
+// several such rows may claim the same column, each column is awarded to the
+// first row claiming it, and only the rows which were awarded all of their
+// columns are removed (the rest are reconsidered in the next round). Lastly,
+// columns without any active coefficients (or quadratic terms) are fixed at
+// zero.
+//
+// The postsolve processes the rounds in reverse order: the multiplier of a
+// row whose removal fixed a set of columns is chosen so that the reduced
+// costs of those columns are nonnegative (and, for a singleton row, zero),
+// which is always possible since their coefficients in the row share a sign.
+// Every other removed row is given a zero multiplier.
+
+namespace El {
+
+namespace {
+
+template<typename Real>
+Int ClassifyRows
+( Int round,
+  Int firstRow,
+  Int localHeight,
+  const Int* offBuf,
+  const Int* colBuf,
+  const Real* valBuf,
+  const vector<Int>& entryActive,
+  const Real* bBuf,
+  const Real* bResBuf,
+        Int* rowRoundBuf,
+        vector<Int>& candidates,
+        vector<Real>& candidateValues,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Real tol = ctrl.tol;
+    auto isActive = [&]( Int e )
+      { return entryActive[e] && valBuf[e] != Real(0); };
+
+    // Drop the empty rows and hash the active sparsity patterns of the rest
+    // =====================================================================
+    Int numRemoved = 0;
+    vector<pair<size_t,Int>> hashes;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        if( rowRoundBuf[iLoc] != -1 )
+            continue;
+        Int numActive = 0;
+        size_t hash = 0;
+        for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+        {
+            if( isActive(e) )
+            {
+                ++numActive;
+                hash = hash*size_t(1000003) ^ size_t(colBuf[e]);
+            }
+        }
+        if( numActive == 0 )
+        {
+            if( Abs(bResBuf[iLoc]) > tol*Max(Real(1),Abs(bBuf[iLoc])) )
+                RuntimeError
+                ("Presolve detected primal infeasibility in row ",
+                 firstRow+iLoc);
+            rowRoundBuf[iLoc] = round;
+            ++numRemoved;
+        }
+        else
+            hashes.push_back( pair<size_t,Int>(hash,iLoc) );
+    }
+
+    // Drop the rows which are multiples of an earlier row
+    // ===================================================
+    if( ctrl.duplicateRows )
+    {
+        auto isMultiple = [&]( Int iLoc, Int kLoc, Real& lambda )
+          {
+            Int e = offBuf[iLoc], f = offBuf[kLoc];
+            const Int eEnd = offBuf[iLoc+1], fEnd = offBuf[kLoc+1];
+            bool first = true;
+            while( true )
+            {
+                while( e < eEnd && !isActive(e) )
+                    ++e;
+                while( f < fEnd && !isActive(f) )
+                    ++f;
+                if( e == eEnd || f == fEnd )
+                    return e == eEnd && f == fEnd;
+                if( colBuf[e] != colBuf[f] )
+                    return false;
+                if( first )
+                {
+                    lambda = valBuf[f] / valBuf[e];
+                    first = false;
+                }
+                else if( Abs(valBuf[f]-lambda*valBuf[e]) > tol*Abs(valBuf[f]) )
+                    return false;
+                ++e;
+                ++f;
+            }
+          };
+
+        std::sort( hashes.begin(), hashes.end() );
+        const Int numHashes = hashes.size();
+        for( Int sBeg=0; sBeg<numHashes; )
+        {
+            Int sEnd = sBeg+1;
+            const size_t hash = hashes[sBeg].first;
+            while( sEnd < numHashes && hashes[sEnd].first == hash )
+                ++sEnd;
+            for( Int t=sBeg+1; t<sEnd; ++t )
+            {
+                const Int kLoc = hashes[t].second;
+                for( Int s=sBeg; s<t; ++s )
+                {
+                    const Int iLoc = hashes[s].second;
+                    Real lambda;
+                    if( rowRoundBuf[iLoc] != -1 ||
+                        !isMultiple( iLoc, kLoc, lambda ) )
+                        continue;
+                    if( Abs(bResBuf[kLoc]-lambda*bResBuf[iLoc]) >
+                        tol*Max(Real(1),Abs(bBuf[kLoc])) )
+                        RuntimeError
+                        ("Presolve detected primal infeasibility in row ",
+                         firstRow+kLoc);
+                    rowRoundBuf[kLoc] = round;
+                    ++numRemoved;
+                    break;
+                }
+            }
+            sBeg = sEnd;
+        }
+    }
+
+    // Find the forcing and singleton rows
+    // ===================================
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        if( rowRoundBuf[iLoc] != -1 )
+            continue;
+        Int numActive=0, numPositive=0;
+        Real pivot = 0;
+        for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+        {
+            if( isActive(e) )
+            {
+                ++numActive;
+                if( valBuf[e] > Real(0) )
+                    ++numPositive;
+                pivot = valBuf[e];
+            }
+        }
+        if( numPositive != 0 && numPositive != numActive )
+            continue;
+
+        const Real sgn = ( numPositive != 0 ? Real(1) : Real(-1) );
+        const Real bTol = tol*Max(Real(1),Abs(bBuf[iLoc]));
+        if( sgn*bResBuf[iLoc] < -bTol )
+            RuntimeError
+            ("Presolve detected primal infeasibility in row ",firstRow+iLoc);
+        if( ctrl.forcingRows && Abs(bResBuf[iLoc]) <= bTol )
+        {
+            candidates.push_back( iLoc );
+            candidateValues.push_back( Real(0) );
+        }
+        else if( ctrl.singletonRows && numActive == 1 )
+        {
+            candidates.push_back( iLoc );
+            candidateValues.push_back( Max(bResBuf[iLoc]/pivot,Real(0)) );
+        }
+    }
+    return numRemoved;
+}
+
+// Return the values of the requested (global) rows of a column vector
+template<typename T>
+void PullEntries
+( const DistMultiVec<T>& v,
+  const vector<Int>& inds,
+        vector<T>& values )
+{
+    DEBUG_CSE
+    mpi::Comm comm = v.Comm();
+    const int commSize = mpi::Size( comm );
+    const Int firstLocalRow = v.FirstLocalRow();
+    const Int numInds = inds.size();
+
+    // Count how many entries we need from each process
+    vector<int> requestSizes( commSize, 0 );
+    for( Int s=0; s<numInds; ++s )
+        ++requestSizes[v.RowOwner(inds[s])];
+    vector<int> fulfillSizes( commSize );
+    mpi::AllToAll( requestSizes.data(), 1, fulfillSizes.data(), 1, comm );
+    vector<int> requestOffs, fulfillOffs;
+    const int numRequests = Scan( requestSizes, requestOffs );
+    const int numFulfills = Scan( fulfillSizes, fulfillOffs );
+
+    // Exchange the requested indices
+    vector<Int> requests( numRequests );
+    auto offs = requestOffs;
+    for( Int s=0; s<numInds; ++s )
+        requests[offs[v.RowOwner(inds[s])]++] = inds[s];
+    vector<Int> fulfills( numFulfills );
+    mpi::AllToAll
+    ( requests.data(), requestSizes.data(), requestOffs.data(),
+      fulfills.data(), fulfillSizes.data(), fulfillOffs.data(), comm );
+
+    // Send back the requested values
+    const T* vBuf = v.LockedMatrix().LockedBuffer();
+    vector<T> fulfillValues( numFulfills );
+    for( int s=0; s<numFulfills; ++s )
+        fulfillValues[s] = vBuf[fulfills[s]-firstLocalRow];
+    vector<T> requestValues( numRequests );
+    mpi::AllToAll
+    ( fulfillValues.data(), fulfillSizes.data(), fulfillOffs.data(),
+      requestValues.data(), requestSizes.data(), requestOffs.data(), comm );
+
+    values.resize( numInds );
+    offs = requestOffs;
+    for( Int s=0; s<numInds; ++s )
+        values[s] = requestValues[offs[v.RowOwner(inds[s])]++];
+}
+
+template<typename Real>
+void DirectPresolve
+( const SparseMatrix<Real>* Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>* QRed,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    const Int* offBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+    const Real* bBuf = b.LockedBuffer();
+    const Real* cBuf = c.LockedBuffer();
+
+    Matrix<Int> colActive;
+    Ones( colActive, n, 1 );
+    info.rowRounds.Resize( m, 1 );
+    Fill( info.rowRounds, Int(-1) );
+    info.colFixers.Resize( n, 1 );
+    Fill( info.colFixers, Int(-1) );
+    Zeros( info.xFixed, n, 1 );
+    Int* colActiveBuf = colActive.Buffer();
+    Int* rowRoundBuf = info.rowRounds.Buffer();
+    Int* colFixerBuf = info.colFixers.Buffer();
+    Real* xFixedBuf = info.xFixed.Buffer();
+
+    Matrix<Real> bRes;
+    vector<Int> entryActive(numEntries), candidates, winners(n), colCounts(n);
+    vector<Real> candidateValues;
+    auto isActive = [&]( Int e )
+      { return entryActive[e] && valBuf[e] != Real(0); };
+    info.numRounds = 0;
+    for( Int round=0; round<ctrl.maxRounds; ++round )
+    {
+        bRes = b;
+        Multiply( NORMAL, Real(-1), A, info.xFixed, Real(1), bRes );
+        for( Int e=0; e<numEntries; ++e )
+            entryActive[e] = colActiveBuf[colBuf[e]];
+
+        candidates.clear();
+        candidateValues.clear();
+        Int numRemoved =
+          ClassifyRows
+          ( round, 0, m, offBuf, colBuf, valBuf, entryActive,
+            bBuf, bRes.LockedBuffer(), rowRoundBuf,
+            candidates, candidateValues, ctrl );
+
+        // Award each claimed column to the first candidate row claiming it
+        // ================================================================
+        std::fill( winners.begin(), winners.end(), -1 );
+        for( const Int i : candidates )
+            for( Int e=offBuf[i]; e<offBuf[i+1]; ++e )
+                if( isActive(e) && winners[colBuf[e]] == -1 )
+                    winners[colBuf[e]] = i;
+        const Int numCandidates = candidates.size();
+        for( Int s=0; s<numCandidates; ++s )
+        {
+            const Int i = candidates[s];
+            bool awarded = true;
+            for( Int e=offBuf[i]; e<offBuf[i+1]; ++e )
+                if( isActive(e) && winners[colBuf[e]] != i )
+                    awarded = false;
+            if( !awarded )
+                continue;
+            rowRoundBuf[i] = round;
+            ++numRemoved;
+            for( Int e=offBuf[i]; e<offBuf[i+1]; ++e )
+            {
+                if( isActive(e) )
+                {
+                    const Int j = colBuf[e];
+                    colActiveBuf[j] = 0;
+                    colFixerBuf[j] = i;
+                    xFixedBuf[j] = candidateValues[s];
+                }
+            }
+        }
+
+        // Fix the columns which no longer have active coefficients
+        // ========================================================
+        if( ctrl.emptyCols )
+        {
+            std::fill( colCounts.begin(), colCounts.end(), 0 );
+            for( Int i=0; i<m; ++i )
+                if( rowRoundBuf[i] == -1 )
+                    for( Int e=offBuf[i]; e<offBuf[i+1]; ++e )
+                        if( isActive(e) )
+                            ++colCounts[colBuf[e]];
+            for( Int j=0; j<n; ++j )
+            {
+                if( !colActiveBuf[j] || colCounts[j] != 0 ||
+                    (Q != nullptr && Q->NumConnections(j) != 0) )
+                    continue;
+                if( cBuf[j] < -ctrl.tol*Max(Real(1),Abs(cBuf[j])) )
+                    RuntimeError
+                    ("Presolve detected dual infeasibility in column ",j);
+                colActiveBuf[j] = 0;
+                ++numRemoved;
+            }
+        }
+
+        if( numRemoved == 0 )
+            break;
+        info.numRounds = round+1;
+    }
+
+    // Renumber the surviving rows and columns
+    // =======================================
+    info.rowMap.Resize( m, 1 );
+    info.colMap.Resize( n, 1 );
+    Int* rowMapBuf = info.rowMap.Buffer();
+    Int* colMapBuf = info.colMap.Buffer();
+    Int mRed=0, nRed=0;
+    for( Int i=0; i<m; ++i )
+        rowMapBuf[i] = ( rowRoundBuf[i] == -1 ? mRed++ : -1 );
+    for( Int j=0; j<n; ++j )
+        colMapBuf[j] = ( colActiveBuf[j] ? nRed++ : -1 );
+
+    // Form the reduced problem
+    // ========================
+    bRes = b;
+    Multiply( NORMAL, Real(-1), A, info.xFixed, Real(1), bRes );
+    Matrix<Real> cRes( c );
+    if( Q != nullptr )
+        Multiply( NORMAL, Real(1), *Q, info.xFixed, Real(1), cRes );
+
+    ARed.Resize( mRed, nRed );
+    Zero( ARed );
+    Int numRedEntries = 0;
+    for( Int i=0; i<m; ++i )
+        if( rowMapBuf[i] != -1 )
+            for( Int e=offBuf[i]; e<offBuf[i+1]; ++e )
+                if( colMapBuf[colBuf[e]] != -1 && valBuf[e] != Real(0) )
+                    ++numRedEntries;
+    ARed.Reserve( numRedEntries );
+    for( Int i=0; i<m; ++i )
+        if( rowMapBuf[i] != -1 )
+            for( Int e=offBuf[i]; e<offBuf[i+1]; ++e )
+                if( colMapBuf[colBuf[e]] != -1 && valBuf[e] != Real(0) )
+                    ARed.QueueUpdate
+                    ( rowMapBuf[i], colMapBuf[colBuf[e]], valBuf[e] );
+    ARed.ProcessQueues();
+
+    bRed.Resize( mRed, 1 );
+    for( Int i=0; i<m; ++i )
+        if( rowMapBuf[i] != -1 )
+            bRed(rowMapBuf[i]) = bRes(i);
+    cRed.Resize( nRed, 1 );
+    for( Int j=0; j<n; ++j )
+        if( colMapBuf[j] != -1 )
+            cRed(colMapBuf[j]) = cRes(j);
+
+    if( Q != nullptr )
+    {
+        const Int* QOffBuf = Q->LockedOffsetBuffer();
+        const Int* QColBuf = Q->LockedTargetBuffer();
+        const Real* QValBuf = Q->LockedValueBuffer();
+        QRed->Resize( nRed, nRed );
+        Zero( *QRed );
+        Int numQRedEntries = 0;
+        for( Int j=0; j<n; ++j )
+            if( colMapBuf[j] != -1 )
+                for( Int e=QOffBuf[j]; e<QOffBuf[j+1]; ++e )
+                    if( colMapBuf[QColBuf[e]] != -1 )
+                        ++numQRedEntries;
+        QRed->Reserve( numQRedEntries );
+        for( Int j=0; j<n; ++j )
+            if( colMapBuf[j] != -1 )
+                for( Int e=QOffBuf[j]; e<QOffBuf[j+1]; ++e )
+                    if( colMapBuf[QColBuf[e]] != -1 )
+                        QRed->QueueUpdate
+                        ( colMapBuf[j], colMapBuf[QColBuf[e]], QValBuf[e] );
+        QRed->ProcessQueues();
+    }
+
+    if( ctrl.print )
+        Output
+        ("Presolve removed ",m-mRed," of ",m," rows and ",n-nRed," of ",n,
+         " columns in ",info.numRounds," rounds");
+}
+
+template<typename Real>
+void DirectPresolve
+( const DistSparseMatrix<Real>* Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>* QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        DistPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    mpi::Comm comm = A.Comm();
+    const int commRank = mpi::Rank( comm );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* offBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+    const Real* bBuf = b.LockedMatrix().LockedBuffer();
+    const Real* cBuf = c.LockedMatrix().LockedBuffer();
+    const vector<Int> localCols( colBuf, colBuf+numLocalEntries );
+
+    DistMultiVec<Int> colActive(comm), winners(comm), colCounts(comm);
+    Ones( colActive, n, 1 );
+    info.rowRounds.SetComm( comm );
+    info.colFixers.SetComm( comm );
+    info.xFixed.SetComm( comm );
+    info.rowRounds.Resize( m, 1 );
+    Fill( info.rowRounds, Int(-1) );
+    info.colFixers.Resize( n, 1 );
+    Fill( info.colFixers, Int(-1) );
+    Zeros( info.xFixed, n, 1 );
+    const Int localWidth = colActive.LocalHeight();
+    const Int firstLocalCol = colActive.FirstLocalRow();
+    Int* colActiveBuf = colActive.Matrix().Buffer();
+    Int* rowRoundBuf = info.rowRounds.Matrix().Buffer();
+
+    DistMultiVec<Real> bRes(comm);
+    vector<Int> entryActive, candidates, claimCols, claimWinners;
+    vector<Real> candidateValues;
+    auto isActive = [&]( Int e )
+      { return entryActive[e] && valBuf[e] != Real(0); };
+    info.numRounds = 0;
+    for( Int round=0; round<ctrl.maxRounds; ++round )
+    {
+        bRes = b;
+        Multiply( NORMAL, Real(-1), A, info.xFixed, Real(1), bRes );
+        PullEntries( colActive, localCols, entryActive );
+
+        candidates.clear();
+        candidateValues.clear();
+        Int numRemoved =
+          ClassifyRows
+          ( round, firstLocalRow, localHeight, offBuf, colBuf, valBuf,
+            entryActive, bBuf, bRes.LockedMatrix().LockedBuffer(),
+            rowRoundBuf, candidates, candidateValues, ctrl );
+
+        // Award each claimed column to the first candidate row claiming it
+        // ================================================================
+        // The owner of each column receives the (sorted) list of the rows
+        // claiming it as the targets of the corresponding graph source
+        claimCols.clear();
+        for( const Int iLoc : candidates )
+            for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+                if( isActive(e) )
+                    claimCols.push_back( colBuf[e] );
+        const Int numClaims = claimCols.size();
+        DistGraph claims(n,m,comm);
+        claims.Reserve( numClaims, numClaims );
+        Int claim = 0;
+        for( const Int iLoc : candidates )
+            for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+                if( isActive(e) )
+                    claims.QueueConnection
+                    ( claimCols[claim++], firstLocalRow+iLoc );
+        claims.ProcessQueues();
+        Zeros( winners, n, 1 );
+        Int* winnerBuf = winners.Matrix().Buffer();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            winnerBuf[jLoc] =
+              ( claims.NumConnections(jLoc) != 0 ?
+                claims.Target(claims.SourceOffset(jLoc)) : -1 );
+        PullEntries( winners, claimCols, claimWinners );
+
+        const Int numCandidates = candidates.size();
+        info.colFixers.Reserve( numClaims );
+        info.xFixed.Reserve( numClaims );
+        colActive.Reserve( numClaims );
+        claim = 0;
+        for( Int s=0; s<numCandidates; ++s )
+        {
+            const Int iLoc = candidates[s];
+            const Int i = firstLocalRow + iLoc;
+            const Int claimBeg = claim;
+            bool awarded = true;
+            for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+                if( isActive(e) && claimWinners[claim++] != i )
+                    awarded = false;
+            if( !awarded )
+                continue;
+            rowRoundBuf[iLoc] = round;
+            ++numRemoved;
+            for( Int t=claimBeg; t<claim; ++t )
+            {
+                const Int j = claimCols[t];
+                colActive.QueueUpdate( j, 0, Int(-1) );
+                info.colFixers.QueueUpdate( j, 0, i+1 );
+                info.xFixed.QueueUpdate( j, 0, candidateValues[s] );
+            }
+        }
+        colActive.ProcessQueues();
+        info.colFixers.ProcessQueues();
+        info.xFixed.ProcessQueues();
+
+        // Fix the columns which no longer have active coefficients
+        // ========================================================
+        // The column activity at the start of the round is still accurate
+        // for each column which remains active
+        if( ctrl.emptyCols )
+        {
+            Zeros( colCounts, n, 1 );
+            Int numCounts = 0;
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                if( rowRoundBuf[iLoc] == -1 )
+                    for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+                        if( isActive(e) )
+                            ++numCounts;
+            colCounts.Reserve( numCounts );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                if( rowRoundBuf[iLoc] == -1 )
+                    for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+                        if( isActive(e) )
+                            colCounts.QueueUpdate( colBuf[e], 0, Int(1) );
+            colCounts.ProcessQueues();
+            const Int* colCountBuf = colCounts.LockedMatrix().LockedBuffer();
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                if( !colActiveBuf[jLoc] || colCountBuf[jLoc] != 0 ||
+                    (Q != nullptr && Q->NumConnections(jLoc) != 0) )
+                    continue;
+                if( cBuf[jLoc] < -ctrl.tol*Max(Real(1),Abs(cBuf[jLoc])) )
+                    RuntimeError
+                    ("Presolve detected dual infeasibility in column ",
+                     firstLocalCol+jLoc);
+                colActiveBuf[jLoc] = 0;
+                ++numRemoved;
+            }
+        }
+
+        numRemoved = mpi::AllReduce( numRemoved, comm );
+        if( numRemoved == 0 )
+            break;
+        info.numRounds = round+1;
+    }
+
+    // Renumber the surviving rows and columns
+    // =======================================
+    info.rowMap.SetComm( comm );
+    info.colMap.SetComm( comm );
+    info.rowMap.Resize( m, 1 );
+    info.colMap.Resize( n, 1 );
+    Int* rowMapBuf = info.rowMap.Matrix().Buffer();
+    Int* colMapBuf = info.colMap.Matrix().Buffer();
+    Int numLocalRows=0, numLocalCols=0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( rowRoundBuf[iLoc] == -1 )
+            ++numLocalRows;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        if( colActiveBuf[jLoc] )
+            ++numLocalCols;
+    Int rowOff = mpi::Scan( numLocalRows, mpi::SUM, comm ) - numLocalRows;
+    Int colOff = mpi::Scan( numLocalCols, mpi::SUM, comm ) - numLocalCols;
+    const Int mRed = mpi::AllReduce( numLocalRows, comm );
+    const Int nRed = mpi::AllReduce( numLocalCols, comm );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rowMapBuf[iLoc] = ( rowRoundBuf[iLoc] == -1 ? rowOff++ : -1 );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        colMapBuf[jLoc] = ( colActiveBuf[jLoc] ? colOff++ : -1 );
+
+    // Form the reduced problem
+    // ========================
+    bRes = b;
+    Multiply( NORMAL, Real(-1), A, info.xFixed, Real(1), bRes );
+    DistMultiVec<Real> cRes(comm);
+    cRes = c;
+    if( Q != nullptr )
+        Multiply( NORMAL, Real(1), *Q, info.xFixed, Real(1), cRes );
+    const Real* bResBuf = bRes.LockedMatrix().LockedBuffer();
+    const Real* cResBuf = cRes.LockedMatrix().LockedBuffer();
+
+    vector<Int> redCols;
+    PullEntries( info.colMap, localCols, redCols );
+    ARed.SetComm( comm );
+    ARed.Resize( mRed, nRed );
+    Zero( ARed );
+    Int numRedEntries = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( rowMapBuf[iLoc] != -1 )
+            for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+                if( redCols[e] != -1 && valBuf[e] != Real(0) )
+                    ++numRedEntries;
+    ARed.Reserve( numRedEntries, numRedEntries );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( rowMapBuf[iLoc] != -1 )
+            for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+                if( redCols[e] != -1 && valBuf[e] != Real(0) )
+                    ARed.QueueUpdate( rowMapBuf[iLoc], redCols[e], valBuf[e] );
+    ARed.ProcessQueues();
+
+    bRed.SetComm( comm );
+    Zeros( bRed, mRed, 1 );
+    bRed.Reserve( numLocalRows );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( rowMapBuf[iLoc] != -1 )
+            bRed.QueueUpdate( rowMapBuf[iLoc], 0, bResBuf[iLoc] );
+    bRed.ProcessQueues();
+    cRed.SetComm( comm );
+    Zeros( cRed, nRed, 1 );
+    cRed.Reserve( numLocalCols );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        if( colMapBuf[jLoc] != -1 )
+            cRed.QueueUpdate( colMapBuf[jLoc], 0, cResBuf[jLoc] );
+    cRed.ProcessQueues();
+
+    if( Q != nullptr )
+    {
+        const Int numQLocalEntries = Q->NumLocalEntries();
+        const Int* QOffBuf = Q->LockedOffsetBuffer();
+        const Int* QColBuf = Q->LockedTargetBuffer();
+        const Real* QValBuf = Q->LockedValueBuffer();
+        const vector<Int> QCols( QColBuf, QColBuf+numQLocalEntries );
+        vector<Int> QRedCols;
+        PullEntries( info.colMap, QCols, QRedCols );
+        QRed->SetComm( comm );
+        QRed->Resize( nRed, nRed );
+        Zero( *QRed );
+        Int numQRedEntries = 0;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            if( colMapBuf[jLoc] != -1 )
+                for( Int e=QOffBuf[jLoc]; e<QOffBuf[jLoc+1]; ++e )
+                    if( QRedCols[e] != -1 )
+                        ++numQRedEntries;
+        QRed->Reserve( numQRedEntries, numQRedEntries );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            if( colMapBuf[jLoc] != -1 )
+                for( Int e=QOffBuf[jLoc]; e<QOffBuf[jLoc+1]; ++e )
+                    if( QRedCols[e] != -1 )
+                        QRed->QueueUpdate
+                        ( colMapBuf[jLoc], QRedCols[e], QValBuf[e] );
+        QRed->ProcessQueues();
+    }
+
+    if( ctrl.print && commRank == 0 )
+        Output
+        ("Presolve removed ",m-mRed," of ",m," rows and ",n-nRed," of ",n,
+         " columns in ",info.numRounds," rounds");
+}
+
+template<typename Real>
+void DirectPostsolve
+( const SparseMatrix<Real>* Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const PresolveInfo<Real>& info,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int* offBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+    const Int* rowMapBuf = info.rowMap.LockedBuffer();
+    const Int* colMapBuf = info.colMap.LockedBuffer();
+    const Int* rowRoundBuf = info.rowRounds.LockedBuffer();
+    const Int* colFixerBuf = info.colFixers.LockedBuffer();
+
+    x.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        x(j) = ( colMapBuf[j] != -1 ? xRed(colMapBuf[j]) : info.xFixed(j) );
+    Zeros( y, m, 1 );
+    for( Int i=0; i<m; ++i )
+        if( rowMapBuf[i] != -1 )
+            y(i) = yRed(rowMapBuf[i]);
+
+    // w := c + Q x + A^T y
+    Matrix<Real> w;
+    auto formReducedCosts = [&]()
+      {
+        w = c;
+        if( Q != nullptr )
+            Multiply( NORMAL, Real(1), *Q, x, Real(1), w );
+        Multiply( TRANSPOSE, Real(1), A, y, Real(1), w );
+      };
+    for( Int round=info.numRounds-1; round>=0; --round )
+    {
+        formReducedCosts();
+        for( Int i=0; i<m; ++i )
+        {
+            if( rowRoundBuf[i] != round )
+                continue;
+            bool fixing = false;
+            Real sgn=1, maxRatio=0;
+            for( Int e=offBuf[i]; e<offBuf[i+1]; ++e )
+            {
+                const Int j = colBuf[e];
+                if( colFixerBuf[j] != i )
+                    continue;
+                const Real ratio = -w(j)/Abs(valBuf[e]);
+                if( !fixing || ratio > maxRatio )
+                    maxRatio = ratio;
+                sgn = ( valBuf[e] > Real(0) ? Real(1) : Real(-1) );
+                fixing = true;
+            }
+            if( fixing )
+                y(i) = sgn*maxRatio;
+        }
+    }
+    formReducedCosts();
+
+    z.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        z(j) = ( colMapBuf[j] != -1 ? zRed(colMapBuf[j]) : w(j) );
+}
+
+template<typename Real>
+void DirectPostsolve
+( const DistSparseMatrix<Real>* Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DistPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    DEBUG_CSE
+    mpi::Comm comm = A.Comm();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* offBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+    const Int localWidth = info.colMap.LocalHeight();
+    const Int* rowMapBuf = info.rowMap.LockedMatrix().LockedBuffer();
+    const Int* colMapBuf = info.colMap.LockedMatrix().LockedBuffer();
+    const Int* rowRoundBuf = info.rowRounds.LockedMatrix().LockedBuffer();
+    const Real* xFixedBuf = info.xFixed.LockedMatrix().LockedBuffer();
+
+    // Gather the kept entries of the reduced solution
+    vector<Int> redRows, redCols;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( rowMapBuf[iLoc] != -1 )
+            redRows.push_back( rowMapBuf[iLoc] );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        if( colMapBuf[jLoc] != -1 )
+            redCols.push_back( colMapBuf[jLoc] );
+    vector<Real> xRedVals, yRedVals, zRedVals;
+    PullEntries( xRed, redCols, xRedVals );
+    PullEntries( yRed, redRows, yRedVals );
+    PullEntries( zRed, redCols, zRedVals );
+
+    x.SetComm( comm );
+    Zeros( x, n, 1 );
+    Real* xBuf = x.Matrix().Buffer();
+    for( Int jLoc=0, s=0; jLoc<localWidth; ++jLoc )
+        xBuf[jLoc] =
+          ( colMapBuf[jLoc] != -1 ? xRedVals[s++] : xFixedBuf[jLoc] );
+    y.SetComm( comm );
+    Zeros( y, m, 1 );
+    Real* yBuf = y.Matrix().Buffer();
+    for( Int iLoc=0, s=0; iLoc<localHeight; ++iLoc )
+        if( rowMapBuf[iLoc] != -1 )
+            yBuf[iLoc] = yRedVals[s++];
+
+    const vector<Int> localCols( colBuf, colBuf+numLocalEntries );
+    vector<Int> entryFixers;
+    PullEntries( info.colFixers, localCols, entryFixers );
+
+    // w := c + Q x + A^T y
+    DistMultiVec<Real> w(comm);
+    auto formReducedCosts = [&]()
+      {
+        w = c;
+        if( Q != nullptr )
+            Multiply( NORMAL, Real(1), *Q, x, Real(1), w );
+        Multiply( TRANSPOSE, Real(1), A, y, Real(1), w );
+      };
+    vector<Int> fixedCols;
+    vector<Real> wVals;
+    for( Int round=info.numRounds-1; round>=0; --round )
+    {
+        formReducedCosts();
+        fixedCols.clear();
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            if( rowRoundBuf[iLoc] == round )
+                for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+                    if( entryFixers[e] == firstLocalRow+iLoc )
+                        fixedCols.push_back( colBuf[e] );
+        PullEntries( w, fixedCols, wVals );
+
+        Int s = 0;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            if( rowRoundBuf[iLoc] != round )
+                continue;
+            bool fixing = false;
+            Real sgn=1, maxRatio=0;
+            for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+            {
+                if( entryFixers[e] != firstLocalRow+iLoc )
+                    continue;
+                const Real ratio = -wVals[s++]/Abs(valBuf[e]);
+                if( !fixing || ratio > maxRatio )
+                    maxRatio = ratio;
+                sgn = ( valBuf[e] > Real(0) ? Real(1) : Real(-1) );
+                fixing = true;
+            }
+            if( fixing )
+                yBuf[iLoc] = sgn*maxRatio;
+        }
+    }
+    formReducedCosts();
+
+    z.SetComm( comm );
+    Zeros( z, n, 1 );
+    Real* zBuf = z.Matrix().Buffer();
+    const Real* wBuf = w.LockedMatrix().LockedBuffer();
+    for( Int jLoc=0, s=0; jLoc<localWidth; ++jLoc )
+        zBuf[jLoc] = ( colMapBuf[jLoc] != -1 ? zRedVals[s++] : wBuf[jLoc] );
+}
+
+} // anonymous namespace
+
+namespace lp {
+namespace direct {
+
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    DirectPresolve<Real>
+    ( nullptr, A, b, c, nullptr, ARed, bRed, cRed, info, ctrl );
+}
+
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        DistPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    DirectPresolve<Real>
+    ( nullptr, A, b, c, nullptr, ARed, bRed, cRed, info, ctrl );
+}
+
+template<typename Real>
+void Postsolve
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const PresolveInfo<Real>& info,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    DEBUG_CSE
+    DirectPostsolve<Real>( nullptr, A, c, info, xRed, yRed, zRed, x, y, z );
+}
+
+template<typename Real>
+void Postsolve
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DistPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    DEBUG_CSE
+    DirectPostsolve<Real>( nullptr, A, c, info, xRed, yRed, zRed, x, y, z );
+}
+
+} // namespace direct
+} // namespace lp
+
+namespace qp {
+namespace direct {
+
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        PresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    DirectPresolve( &Q, A, b, c, &QRed, ARed, bRed, cRed, info, ctrl );
+}
+
+template<typename Real>
+void Presolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& QRed,
+        DistSparseMatrix<Real>& ARed,
+        DistMultiVec<Real>& bRed,
+        DistMultiVec<Real>& cRed,
+        DistPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    DirectPresolve( &Q, A, b, c, &QRed, ARed, bRed, cRed, info, ctrl );
+}
+
+template<typename Real>
+void Postsolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const PresolveInfo<Real>& info,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    DEBUG_CSE
+    DirectPostsolve( &Q, A, c, info, xRed, yRed, zRed, x, y, z );
+}
+
+template<typename Real>
+void Postsolve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DistPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xRed,
+  const DistMultiVec<Real>& yRed,
+  const DistMultiVec<Real>& zRed,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    DEBUG_CSE
+    DirectPostsolve( &Q, A, c, info, xRed, yRed, zRed, x, y, z );
+}
+
+} // namespace direct
+} // namespace qp
+
+#define PROTO(Real) \
+  template void lp::direct::Presolve \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          SparseMatrix<Real>& ARed, \
+          Matrix<Real>& bRed, \
+          Matrix<Real>& cRed, \
+          PresolveInfo<Real>& info, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void lp::direct::Presolve \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistSparseMatrix<Real>& ARed, \
+          DistMultiVec<Real>& bRed, \
+          DistMultiVec<Real>& cRed, \
+          DistPresolveInfo<Real>& info, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void lp::direct::Postsolve \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& c, \
+    const PresolveInfo<Real>& info, \
+    const Matrix<Real>& xRed, \
+    const Matrix<Real>& yRed, \
+    const Matrix<Real>& zRed, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z ); \
+  template void lp::direct::Postsolve \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& c, \
+    const DistPresolveInfo<Real>& info, \
+    const DistMultiVec<Real>& xRed, \
+    const DistMultiVec<Real>& yRed, \
+    const DistMultiVec<Real>& zRed, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z ); \
+  template void qp::direct::Presolve \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          SparseMatrix<Real>& QRed, \
+          SparseMatrix<Real>& ARed, \
+          Matrix<Real>& bRed, \
+          Matrix<Real>& cRed, \
+          PresolveInfo<Real>& info, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void qp::direct::Presolve \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistSparseMatrix<Real>& QRed, \
+          DistSparseMatrix<Real>& ARed, \
+          DistMultiVec<Real>& bRed, \
+          DistMultiVec<Real>& cRed, \
+          DistPresolveInfo<Real>& info, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void qp::direct::Postsolve \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& c, \
+    const PresolveInfo<Real>& info, \
+    const Matrix<Real>& xRed, \
+    const Matrix<Real>& yRed, \
+    const Matrix<Real>& zRed, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z ); \
+  template void qp::direct::Postsolve \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& c, \
+    const DistPresolveInfo<Real>& info, \
+    const DistMultiVec<Real>& xRed, \
+    const DistMultiVec<Real>& yRed, \
+    const DistMultiVec<Real>& zRed, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
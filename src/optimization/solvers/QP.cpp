@@ -62,6 +62,31 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.presolve )
+    {
+        SparseMatrix<Real> QRed, ARed;
+        Matrix<Real> bRed, cRed, xRed, yRed, zRed;
+        PresolveInfo<Real> info;
+        qp::direct::Presolve
+        ( Q, A, b, c, QRed, ARed, bRed, cRed, info, ctrl.presolveCtrl );
+
+        auto redCtrl( ctrl );
+        redCtrl.presolve = false;
+        redCtrl.mehrotraCtrl.primalInit = false;
+        redCtrl.mehrotraCtrl.dualInit = false;
+        redCtrl.mehrotraCtrl.warmStart = false;
+        if( ARed.Width() > 0 )
+            QP( QRed, ARed, bRed, cRed, xRed, yRed, zRed, redCtrl );
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+            Zeros( zRed, 0, 1 );
+        }
+        qp::direct::Postsolve( Q, A, c, info, xRed, yRed, zRed, x, y, z );
+        return;
+    }
+
     if( ctrl.approach == QP_MEHROTRA )
         qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
     else
@@ -80,6 +105,33 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.presolve )
+    {
+        mpi::Comm comm = A.Comm();
+        DistSparseMatrix<Real> QRed(comm), ARed(comm);
+        DistMultiVec<Real> bRed(comm), cRed(comm),
+                           xRed(comm), yRed(comm), zRed(comm);
+        DistPresolveInfo<Real> info;
+        qp::direct::Presolve
+        ( Q, A, b, c, QRed, ARed, bRed, cRed, info, ctrl.presolveCtrl );
+
+        auto redCtrl( ctrl );
+        redCtrl.presolve = false;
+        redCtrl.mehrotraCtrl.primalInit = false;
+        redCtrl.mehrotraCtrl.dualInit = false;
+        redCtrl.mehrotraCtrl.warmStart = false;
+        if( ARed.Width() > 0 )
+            QP( QRed, ARed, bRed, cRed, xRed, yRed, zRed, redCtrl );
+        else
+        {
+            Zeros( xRed, 0, 1 );
+            Zeros( yRed, ARed.Height(), 1 );
+            Zeros( zRed, 0, 1 );
+        }
+        qp::direct::Postsolve( Q, A, c, info, xRed, yRed, zRed, x, y, z );
+        return;
+    }
+
     if( ctrl.approach == QP_MEHROTRA )
         qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
     else
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../util/KKTValueMap.hpp"
 
 namespace El {
 namespace qp {
@@ -57,6 +58,8 @@ void Mehrotra
     else
         centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
 
     // Equilibrate the QP by diagonally scaling [A;G]
     auto A = APre;
@@ -81,12 +84,12 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol,  Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -117,7 +120,10 @@ void Mehrotra
 
     Initialize
     ( Q, A, G, b, c, h, x, y, z, s, 
-      ctrl.primalInit, ctrl.dualInit, standardShift );
+      primalInit, dualInit, standardShift );
+    if( ctrl.warmStart )
+        pos_orth::WarmStart
+        ( s, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real relError = 1;
     Matrix<Real> J, d,
@@ -366,6 +372,8 @@ void Mehrotra
     else
         centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
 
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
@@ -391,11 +399,11 @@ void Mehrotra
     control.colAlign = 0;
     control.rowAlign = 0;
 
-    // NOTE: {x,s} do not need to be a read proxy when !ctrl.primalInit
+    // NOTE: {x,s} do not need to be a read proxy when !primalInit
     DistMatrixReadWriteProxy<Real,Real,MC,MR>
       xProx( xPre, control ),
       sProx( sPre, control ),
-    // NOTE: {y,z} do not need to be read proxies when !ctrl.dualInit
+    // NOTE: {y,z} do not need to be read proxies when !dualInit
       yProx( yPre, control ),
       zProx( zPre, control );
     auto& x = xProx.Get();
@@ -426,12 +434,12 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol,  Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -467,7 +475,10 @@ void Mehrotra
         timer.Start();
     Initialize
     ( Q, A, G, b, c, h, x, y, z, s, 
-      ctrl.primalInit, ctrl.dualInit, standardShift );
+      primalInit, dualInit, standardShift );
+    if( ctrl.warmStart )
+        pos_orth::WarmStart
+        ( s, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
     if( ctrl.time && commRank == 0 )
         Output("Init time: ",timer.Stop()," secs");
 
@@ -752,6 +763,8 @@ void Mehrotra
     else
         centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
 
     // Equilibrate the QP by diagonally scaling [A;G]
     auto Q = QPre;
@@ -764,10 +777,27 @@ void Mehrotra
     const Int k = G.Height();
     const Int n = A.Width();
     const Int degree = k;
-    Matrix<Real> dRowA, dRowG, dCol;
+    // Reuse the equilibration and symbolic analysis of a previous solve with
+    // the same sparsity pattern when a cache was provided
+    MehrotraCache<Real> localCache;
+    auto& cache = ( ctrl.cache ? *ctrl.cache : localCache );
+    auto& dRowA = cache.dRowA;
+    auto& dRowG = cache.dRowG;
+    auto& dCol = cache.dCol;
     if( ctrl.outerEquil )
     {
-        StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
+        if( cache.equilibrated )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRowA, A );
+            DiagonalSolve( LEFT, NORMAL, dRowG, G );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, G );
+        }
+        else
+        {
+            StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
+            cache.equilibrated = true;
+        }
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
         DiagonalSolve( LEFT, NORMAL, dCol,  c );
@@ -776,12 +806,12 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol, Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -792,6 +822,7 @@ void Mehrotra
         Ones( dRowA, m, 1 );
         Ones( dRowG, k, 1 );
         Ones( dCol,  n, 1 );
+        cache.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -827,17 +858,30 @@ void Mehrotra
     SparseMatrix<Real> JStatic;
     StaticKKT
     ( Q, A, G, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, JStatic, false );
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
-    NestedDissection( JStatic.LockedGraph(), map, rootSep, info );
-    InvertMap( map, invMap );
+    auto& map = cache.map;
+    auto& invMap = cache.invMap;
+    auto& info = cache.info;
+    auto& rootSep = cache.rootSep;
+    if( !cache.analyzed )
+    {
+        NestedDissection( JStatic.LockedGraph(), map, rootSep, info );
+        InvertMap( map, invMap );
+        cache.analyzed = true;
+    }
 
     Initialize
     ( JStatic, regTmp, b, c, h, x, y, z, s, map, invMap, rootSep, info, 
-      ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+      primalInit, dualInit, standardShift, ctrl.solveCtrl );
+    if( ctrl.warmStart )
+        pos_orth::WarmStart
+        ( s, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
 
+    // Only the barrier block, -s <> z, of the KKT system changes between
+    // iterations, and so it is refreshed in place within the static pattern
     SparseMatrix<Real> J, JOrig;
+    kkt::DiagonalValueMap<Real> kktMap;
+    kktMap.Initialize( JStatic, n+m, k, JOrig );
+    Matrix<Real> barrier;
     ldl::Front<Real> JFront;
     Matrix<Real> d,
                  w,
@@ -943,9 +987,10 @@ void Mehrotra
 
         // Construct the KKT system
         // ------------------------
-        JOrig = JStatic;
-        JOrig.FreezeSparsity();
-        FinishKKT( m, n, s, z, JOrig );
+        barrier = s;
+        DiagonalSolve( LEFT, NORMAL, z, barrier );
+        barrier *= -1;
+        kktMap.Refresh( JStatic, barrier, JOrig );
         KKTRHS( rc, rb, rh, rmu, z, d );
 
         // Solve for the direction
@@ -1137,6 +1182,8 @@ void Mehrotra
     else
         centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
     //const Real selInvTol = Pow(eps,Real(-0.25));
     const Real selInvTol = 0;
 
@@ -1155,14 +1202,31 @@ void Mehrotra
     const Int k = G.Height();
     const Int n = A.Width();
     const Int degree = k;
-    DistMultiVec<Real> dRowA(comm), dRowG(comm), dCol(comm);
+    // Reuse the equilibration and symbolic analysis of a previous solve with
+    // the same sparsity pattern when a cache was provided
+    DistMehrotraCache<Real> localCache;
+    auto& cache = ( ctrl.distCache ? *ctrl.distCache : localCache );
+    auto& dRowA = cache.dRowA;
+    auto& dRowG = cache.dRowG;
+    auto& dCol = cache.dCol;
     if( ctrl.outerEquil )
     {
-        if( commRank == 0 && ctrl.time )
-            timer.Start();
-        StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
-        if( commRank == 0 && ctrl.time )
-            Output("RuizEquil: ",timer.Stop()," secs");
+        if( cache.equilibrated )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRowA, A );
+            DiagonalSolve( LEFT, NORMAL, dRowG, G );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, G );
+        }
+        else
+        {
+            if( commRank == 0 && ctrl.time )
+                timer.Start();
+            StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
+            if( commRank == 0 && ctrl.time )
+                Output("RuizEquil: ",timer.Stop()," secs");
+            cache.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
@@ -1172,12 +1236,12 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol, Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -1185,9 +1249,13 @@ void Mehrotra
     }
     else
     {
+        dRowA.SetComm( comm );
+        dRowG.SetComm( comm );
+        dCol.SetComm( comm );
         Ones( dRowA, m, 1 );
         Ones( dRowG, k, 1 );
         Ones( dCol,  n, 1 );
+        cache.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -1243,30 +1311,46 @@ void Mehrotra
             Output("Imbalance factor of J: ",imbalanceJ);
     }
 
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
-    NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
-    if( commRank == 0 && ctrl.time )
-        Output("ND: ",timer.Stop()," secs");
-    InvertMap( map, invMap );
+    auto& map = cache.map;
+    auto& invMap = cache.invMap;
+    auto& info = cache.info;
+    auto& rootSep = cache.rootSep;
+    auto& mappedSources = cache.mappedSources;
+    auto& mappedTargets = cache.mappedTargets;
+    auto& colOffs = cache.colOffs;
+    if( !cache.analyzed )
+    {
+        if( commRank == 0 && ctrl.time )
+            timer.Start();
+        NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
+        if( commRank == 0 && ctrl.time )
+            Output("ND: ",timer.Stop()," secs");
+        InvertMap( map, invMap );
 
-    vector<Int> mappedSources, mappedTargets, colOffs;
-    JStatic.MappedSources( map, mappedSources );
-    JStatic.MappedTargets( map, mappedTargets, colOffs );
+        JStatic.MappedSources( map, mappedSources );
+        JStatic.MappedTargets( map, mappedTargets, colOffs );
+        cache.analyzed = true;
+    }
 
     if( commRank == 0 && ctrl.time )
         timer.Start();
     Initialize
     ( JStatic, regTmp, b, c, h, x, y, z, s, 
       map, invMap, rootSep, info, mappedSources, mappedTargets, colOffs, 
-      ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+      primalInit, dualInit, standardShift, ctrl.solveCtrl );
+    if( ctrl.warmStart )
+        pos_orth::WarmStart
+        ( s, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
+    // Only the barrier block, -s <> z, of the KKT system changes between
+    // iterations, and so it is refreshed in place within the static pattern
     DistSparseMatrix<Real> J(comm), JOrig(comm);
+    kkt::DistDiagonalValueMap<Real> kktMap;
+    kktMap.Initialize( JStatic, n+m, k, JOrig );
+    JOrig.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
+    DistMultiVec<Real> barrier(comm);
     ldl::DistFront<Real> JFront;
     DistMultiVec<Real> d(comm),
                        w(comm),
@@ -1378,10 +1462,10 @@ void Mehrotra
 
         // Construct the KKT system
         // ------------------------
-        JOrig = JStatic;
-        JOrig.FreezeSparsity();
-        JOrig.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
-        FinishKKT( m, n, s, z, JOrig );
+        barrier = s;
+        DiagonalSolve( LEFT, NORMAL, z, barrier );
+        barrier *= -1;
+        kktMap.Refresh( JStatic, barrier, JOrig );
         KKTRHS( rc, rb, rh, rmu, z, d );
 
         // Solve for the direction
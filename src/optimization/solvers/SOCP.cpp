@@ -68,6 +68,9 @@ void SOCP
     if( ctrl.approach == SOCP_MEHROTRA )
         socp::direct::Mehrotra
         ( A, b, c, orders, firstInds, x, y, z, ctrl.mehrotraCtrl );
+    else if( ctrl.approach == SOCP_PDHG )
+        socp::direct::PDHG
+        ( A, b, c, orders, firstInds, x, y, z, ctrl.pdhgCtrl );
     else
         LogicError("Unsupported solver");
 }
@@ -88,6 +91,9 @@ void SOCP
     if( ctrl.approach == SOCP_MEHROTRA )
         socp::direct::Mehrotra
         ( A, b, c, orders, firstInds, x, y, z, ctrl.mehrotraCtrl );
+    else if( ctrl.approach == SOCP_PDHG )
+        socp::direct::PDHG
+        ( A, b, c, orders, firstInds, x, y, z, ctrl.pdhgCtrl );
     else
         LogicError("Unsupported solver");
 }
@@ -188,6 +194,32 @@ void SOCP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void SOCP
+( const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+  const socp::affine::Ctrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.approach == SOCP_MEHROTRA )
+        socp::affine::Mehrotra
+        ( A, G, b, c, h, orders, firstInds, psdOrders, psdFirstInds,
+          x, y, z, s, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 #define PROTO(Real) \
   template void SOCP \
   ( const Matrix<Real>& A, \
@@ -280,6 +312,21 @@ void SOCP
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
           DistMultiVec<Real>& s, \
+    const socp::affine::Ctrl<Real>& ctrl ); \
+  template void SOCP \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& G, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Real>& h, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    const Matrix<Int>& psdOrders, \
+    const Matrix<Int>& psdFirstInds, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          Matrix<Real>& s, \
     const socp::affine::Ctrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
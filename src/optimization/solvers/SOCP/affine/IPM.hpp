@@ -68,6 +68,22 @@ void Mehrotra
         DistMultiVec<Real>& z,
         DistMultiVec<Real>& s,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+template<typename Real>
+void Mehrotra
+( const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
 } // namespace affine
 } // namespace socp
@@ -59,6 +59,8 @@ void Mehrotra
     else
         centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
 
     auto A = APre;
     auto G = GPre;
@@ -77,12 +79,12 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
         DiagonalSolve( LEFT, NORMAL, dCol,  c );
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -111,7 +113,11 @@ void Mehrotra
 
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, standardShift );
+      primalInit, dualInit, standardShift );
+    if( ctrl.warmStart )
+        soc::WarmStart
+        ( s, z, orders, firstInds,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real relError = 1;
     Matrix<Real> J, d, 
@@ -406,6 +412,8 @@ void Mehrotra
         centralityRule = MehrotraCentrality<Real>;
     const Int cutoffPar = 1000;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
 
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
@@ -429,10 +437,10 @@ void Mehrotra
     control.rowAlign = 0;
 
     DistMatrixReadWriteProxy<Real,Real,MC,MR>
-    // NOTE: {x,s} do not need to be a read proxy when !ctrl.primalInit
+    // NOTE: {x,s} do not need to be a read proxy when !primalInit
       xProx( xPre, control ),
       sProx( sPre, control ),
-    // NOTE: {y,z} do not need to be read proxies when !ctrl.dualInit
+    // NOTE: {y,z} do not need to be read proxies when !dualInit
       yProx( yPre, control ),
       zProx( zPre, control );
     auto& x = xProx.Get();
@@ -477,7 +485,11 @@ void Mehrotra
 
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, standardShift, cutoffPar );
+      primalInit, dualInit, standardShift, cutoffPar );
+    if( ctrl.warmStart )
+        soc::WarmStart
+        ( s, z, orders, firstInds,
+          ctrl.warmStartShift, ctrl.warmStartCentrality, cutoffPar );
 
     Real relError = 1;
     DistMatrix<Real> J(grid),     d(grid),     
@@ -792,6 +804,8 @@ void Mehrotra
         centralityRule = MehrotraCentrality<Real>;
     const bool cutoffSparse = 64;
     const bool standardShift = true;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
 
     auto A = APre;
     auto G = GPre;
@@ -802,21 +816,38 @@ void Mehrotra
     const Int k = G.Height();
     const Int n = A.Width();
     const Int degree = soc::Degree( firstInds );
-    Matrix<Real> dRowA, dRowG, dCol;
+    // Reuse the equilibration and symbolic analysis of a previous solve with
+    // the same sparsity pattern and cones when a cache was provided
+    MehrotraCache<Real> localCache;
+    auto& cache = ( ctrl.cache ? *ctrl.cache : localCache );
+    auto& dRowA = cache.dRowA;
+    auto& dRowG = cache.dRowG;
+    auto& dCol = cache.dCol;
     if( ctrl.outerEquil )
     {
-        cone::RuizEquil
-        ( A, G, dRowA, dRowG, dCol, orders, firstInds, ctrl.print );
+        if( cache.equilibrated )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRowA, A );
+            DiagonalSolve( LEFT, NORMAL, dRowG, G );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, G );
+        }
+        else
+        {
+            cone::RuizEquil
+            ( A, G, dRowA, dRowG, dCol, orders, firstInds, ctrl.print );
+            cache.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
         DiagonalSolve( LEFT, NORMAL, dCol,  c );
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -827,6 +858,7 @@ void Mehrotra
         Ones( dRowA, m, 1 );
         Ones( dRowG, k, 1 );
         Ones( dCol,  n, 1 );
+        cache.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -846,7 +878,11 @@ void Mehrotra
 
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+      primalInit, dualInit, standardShift, ctrl.solveCtrl );
+    if( ctrl.warmStart )
+        soc::WarmStart
+        ( s, z, orders, firstInds,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     // Form the offsets for the sparse embedding of the barrier's Hessian
     // ==================================================================
@@ -910,11 +946,16 @@ void Mehrotra
       orders, firstInds, origToSparseOrders, origToSparseFirstInds, 
       kSparse, JStatic, onlyLower );
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
-    NestedDissection( JStatic.LockedGraph(), map, rootSep, info );
-    InvertMap( map, invMap );
+    auto& map = cache.map;
+    auto& invMap = cache.invMap;
+    auto& info = cache.info;
+    auto& rootSep = cache.rootSep;
+    if( !cache.analyzed )
+    {
+        NestedDissection( JStatic.LockedGraph(), map, rootSep, info );
+        InvertMap( map, invMap );
+        cache.analyzed = true;
+    }
  
     Real relError = 1;
     Matrix<Real> dInner;
@@ -1248,6 +1289,8 @@ void Mehrotra
     const Int cutoffSparse = 64;
     const Int cutoffPar = 1000;
     const bool standardShift = false;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
 
     auto A = APre;
     auto G = GPre;
@@ -1263,25 +1306,43 @@ void Mehrotra
     const int commRank = mpi::Rank(comm);
     Timer timer, iterTimer;
 
-    DistMultiVec<Real> dRowA(comm), dRowG(comm), dCol(comm);
+    // Reuse the equilibration and symbolic analysis of a previous solve with
+    // the same sparsity pattern and cones when a cache was provided
+    DistMehrotraCache<Real> localCache;
+    auto& cache = ( ctrl.distCache ? *ctrl.distCache : localCache );
+    auto& dRowA = cache.dRowA;
+    auto& dRowG = cache.dRowG;
+    auto& dCol = cache.dCol;
     if( ctrl.outerEquil )
     {
-        if( commRank == 0 && ctrl.time )
-            timer.Start();
-        cone::RuizEquil
-        ( A, G, dRowA, dRowG, dCol, orders, firstInds, cutoffPar, ctrl.print );
-        if( commRank == 0 && ctrl.time )
-            Output("cone::RuizEquil: ",timer.Stop()," secs");
+        if( cache.equilibrated )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRowA, A );
+            DiagonalSolve( LEFT, NORMAL, dRowG, G );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, G );
+        }
+        else
+        {
+            if( commRank == 0 && ctrl.time )
+                timer.Start();
+            cone::RuizEquil
+            ( A, G, dRowA, dRowG, dCol, orders, firstInds, cutoffPar,
+              ctrl.print );
+            if( commRank == 0 && ctrl.time )
+                Output("cone::RuizEquil: ",timer.Stop()," secs");
+            cache.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
         DiagonalSolve( LEFT, NORMAL, dCol,  c );
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -1289,9 +1350,13 @@ void Mehrotra
     }
     else
     {
+        dRowA.SetComm( comm );
+        dRowG.SetComm( comm );
+        dCol.SetComm( comm );
         Ones( dRowA, m, 1 );
         Ones( dRowG, k, 1 );
         Ones( dCol,  n, 1 );
+        cache.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -1320,8 +1385,12 @@ void Mehrotra
         timer.Start();
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, standardShift, cutoffPar, 
+      primalInit, dualInit, standardShift, cutoffPar, 
       ctrl.solveCtrl );
+    if( ctrl.warmStart )
+        soc::WarmStart
+        ( s, z, orders, firstInds,
+          ctrl.warmStartShift, ctrl.warmStartCentrality, cutoffPar );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1405,19 +1474,26 @@ void Mehrotra
     }
 
     auto meta = JStatic.InitializeMultMeta();
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
-    NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
-    if( commRank == 0 && ctrl.time )
-        Output("ND: ",timer.Stop()," secs");
-    InvertMap( map, invMap );
+    auto& map = cache.map;
+    auto& invMap = cache.invMap;
+    auto& info = cache.info;
+    auto& rootSep = cache.rootSep;
+    auto& mappedSources = cache.mappedSources;
+    auto& mappedTargets = cache.mappedTargets;
+    auto& colOffs = cache.colOffs;
+    if( !cache.analyzed )
+    {
+        if( commRank == 0 && ctrl.time )
+            timer.Start();
+        NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
+        if( commRank == 0 && ctrl.time )
+            Output("ND: ",timer.Stop()," secs");
+        InvertMap( map, invMap );
 
-    vector<Int> mappedSources, mappedTargets, colOffs;
-    JStatic.MappedSources( map, mappedSources );
-    JStatic.MappedTargets( map, mappedTargets, colOffs );
+        JStatic.MappedSources( map, mappedSources );
+        JStatic.MappedTargets( map, mappedTargets, colOffs );
+        cache.analyzed = true;
+    }
 
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
@@ -1810,8 +1886,352 @@ void Mehrotra
     }
 }
 
+// The following generalizes the sequential dense Mehrotra Predictor-Corrector
+// scheme to the case where the cone K is the product of a collection of
+// second-order cones (occupying the first orders.Height() entries of s and
+// z) and of a collection of cones of symmetric positive semi-definite
+// matrices (occupying the remaining entries; see the psd namespace for their
+// storage format). The semidefinite blocks use the Nesterov-Todd scaling
+// W_i = R_i R_i^T, with the diagonal matrix Lambda_i = R_i^T Z_i R_i playing
+// the role of the scaled point l = W z.
+//
+// Outer geometric equilibration is not yet supported in this case since it
+// would need to preserve the symmetry of each semidefinite block.
+//
+
+template<typename Real>
+void Mehrotra
+( const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Real eps = limits::Epsilon<Real>();
+
+    // TODO: Move these into the control structure
+    const bool stepLengthSigma = true;
+    function<Real(Real,Real,Real,Real)> centralityRule;
+    if( stepLengthSigma )
+        centralityRule = StepLengthCentrality<Real>;
+    else
+        centralityRule = MehrotraCentrality<Real>;
+    const bool primalInit = ctrl.primalInit || ctrl.warmStart;
+    const bool dualInit = ctrl.dualInit || ctrl.warmStart;
+
+    const Int m = A.Height();
+    const Int k = G.Height();
+    const Int n = A.Width();
+    const Int kSOC = orders.Height();
+    const Int kPSD = psdOrders.Height();
+    if( kSOC+kPSD != k )
+        LogicError("Cone sizes do not sum to the height of G");
+    const Int degree =
+      soc::Degree( firstInds ) + psd::Degree( psdOrders, psdFirstInds );
+    const IR socInd(0,kSOC), psdInd(kSOC,k);
+
+    const Real bNrm2 = Nrm2( b );
+    const Real cNrm2 = Nrm2( c );
+    const Real hNrm2 = Nrm2( h );
+    if( ctrl.print )
+    {
+        const Real ANrm1 = OneNorm( A );
+        const Real GNrm1 = OneNorm( G );
+        Output("|| A ||_1 = ",ANrm1);
+        Output("|| G ||_1 = ",GNrm1);
+        Output("|| b ||_2 = ",bNrm2);
+        Output("|| c ||_2 = ",cNrm2);
+        Output("|| h ||_2 = ",hNrm2);
+    }
+
+    Initialize
+    ( A, G, b, c, h, orders, firstInds, psdOrders, psdFirstInds,
+      x, y, z, s, primalInit, dualInit );
+
+    // Views of the second-order and semidefinite portions of a cone member
+    auto socPart = [&]( Matrix<Real>& q ) { return q(socInd,ALL); };
+    auto psdPart = [&]( Matrix<Real>& q ) { return q(psdInd,ALL); };
+
+    // The maximum step length over both classes of cones
+    auto maxStep =
+      [&]( Matrix<Real>& q, Matrix<Real>& dq, Real upperBound ) -> Real
+      {
+          Real alpha = upperBound;
+          if( kSOC > 0 )
+              alpha =
+                soc::MaxStep
+                ( socPart(q), socPart(dq), orders, firstInds, alpha );
+          if( kPSD > 0 )
+              alpha =
+                psd::MaxStep
+                ( psdPart(q), psdPart(dq), psdOrders, psdFirstInds, alpha );
+          return alpha;
+      };
+
+    Real relError = 1;
+    Matrix<Real> J, d,
+                 w, wRoot, wRootInv,
+                 l, lInv,
+                 r, lambda, e,
+                 rmu,   rc,    rb,    rh,
+                 dxAff, dyAff, dzAff, dsAff,
+                 dx,    dy,    dz,    ds,
+                 dzAffScaled, dsAffScaled;
+    Matrix<Real> dSub;
+    Permutation p;
+    Zeros( e, kPSD, 1 );
+    psd::Identity( e, psdOrders, psdFirstInds );
+    const Int indent = PushIndent();
+    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    {
+        // Ensure that s and z are in the cone
+        // ===================================
+        const Real minDist = eps;
+        auto sSOC = socPart(s); auto sPSD = psdPart(s);
+        auto zSOC = socPart(z); auto zPSD = psdPart(z);
+        soc::PushInto( sSOC, orders, firstInds, minDist );
+        soc::PushInto( zSOC, orders, firstInds, minDist );
+        psd::PushInto( sPSD, psdOrders, psdFirstInds, minDist );
+        psd::PushInto( zPSD, psdOrders, psdFirstInds, minDist );
+        soc::NesterovTodd( sSOC, zSOC, w, orders, firstInds );
+        psd::NesterovTodd( sPSD, zPSD, r, lambda, psdOrders, psdFirstInds );
+
+        // Check for convergence
+        // =====================
+        const Real primObj = Dot(c,x);
+        const Real dualObj = -Dot(b,y) - Dot(h,z);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        rb = b;
+        rb *= -1;
+        Gemv( NORMAL, Real(1), A, x, Real(1), rb );
+        const Real rbNrm2 = Nrm2( rb );
+        const Real rbConv = rbNrm2 / (1+bNrm2);
+        rc = c;
+        Gemv( TRANSPOSE, Real(1), A, y, Real(1), rc );
+        Gemv( TRANSPOSE, Real(1), G, z, Real(1), rc );
+        const Real rcNrm2 = Nrm2( rc );
+        const Real rcConv = rcNrm2 / (1+cNrm2);
+        rh = h;
+        rh *= -1;
+        Gemv( NORMAL, Real(1), G, x, Real(1), rh );
+        rh += s;
+        const Real rhNrm2 = Nrm2( rh );
+        const Real rhConv = rhNrm2 / (1+hNrm2);
+        relError = Max(Max(Max(objConv,rbConv),rcConv),rhConv);
+        if( ctrl.print )
+            Output
+            ("iter ",numIts,":\n",Indent(),
+             "  || r_b ||_2 / (1 + || b ||_2) = ",rbConv,"\n",Indent(),
+             "  || r_c ||_2 / (1 + || c ||_2) = ",rcConv,"\n",Indent(),
+             "  || r_h ||_2 / (1 + || h ||_2) = ",rhConv,"\n",Indent(),
+             "  primal = ",primObj,"\n",Indent(),
+             "  dual   = ",dualObj,"\n",Indent(),
+             "  |primal - dual| / (1 + |primal|) = ",objConv);
+        if( relError <= ctrl.targetTol )
+            break;
+        if( numIts == ctrl.maxIts && relError > ctrl.minTol )
+            RuntimeError
+            ("Reached maximum number of iterations, ",ctrl.maxIts,
+             ", with rel. error ",relError," which does not meet the minimum ",
+             "tolerance of ",ctrl.minTol);
+
+        // Compute the affine search direction
+        // ===================================
+        soc::SquareRoot( w, wRoot, orders, firstInds );
+        soc::Inverse( wRoot, wRootInv, orders, firstInds );
+        soc::ApplyQuadratic( wRoot, zSOC, l, orders, firstInds );
+        soc::Inverse( l, lInv, orders, firstInds );
+        const Real mu = Dot(s,z) / degree;
+
+        // r_mu := [l; lambda]
+        // -------------------
+        rmu.Resize( k, 1 );
+        socPart(rmu) = l;
+        psdPart(rmu) = lambda;
+
+        // Construct the KKT system
+        // ------------------------
+        KKT
+        ( A, G, w, orders, firstInds, r, psdOrders, psdFirstInds, J );
+        KKTRHS
+        ( rc, rb, rh, rmu, wRoot, orders, firstInds,
+          r, psdOrders, psdFirstInds, d );
+
+        // Solve for the direction
+        // -----------------------
+        try
+        {
+            LDL( J, dSub, p, false );
+            ldl::SolveAfter( J, dSub, p, d, false );
+        }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Solve failed with rel. error ",relError,
+                 " which does not meet the minimum tolerance of ",ctrl.minTol);
+        }
+        ExpandSolution
+        ( m, n, d, rmu, wRoot, orders, firstInds,
+          r, psdOrders, psdFirstInds, dxAff, dyAff, dzAff, dsAff );
+
+        // dzAffScaled := W dzAff, dsAffScaled := inv(W)^T dsAff
+        // -----------------------------------------------------
+        dzAffScaled.Resize( k, 1 );
+        dsAffScaled.Resize( k, 1 );
+        {
+            auto dzAffScaledSOC = socPart(dzAffScaled);
+            auto dsAffScaledSOC = socPart(dsAffScaled);
+            soc::ApplyQuadratic
+            ( wRoot, socPart(dzAff), dzAffScaledSOC, orders, firstInds );
+            soc::ApplyQuadratic
+            ( wRootInv, socPart(dsAff), dsAffScaledSOC, orders, firstInds );
+
+            // Since R^T dZ R + inv(R) dS inv(R)^T = -Lambda, the latter need
+            // not be formed explicitly
+            auto dzAffScaledPSD = psdPart(dzAffScaled);
+            auto dsAffScaledPSD = psdPart(dsAffScaled);
+            dzAffScaledPSD = psdPart(dzAff);
+            psd::ApplyScaling
+            ( TRANSPOSE, r, dzAffScaledPSD, psdOrders, psdFirstInds );
+            dsAffScaledPSD = lambda;
+            dsAffScaledPSD += dzAffScaledPSD;
+            dsAffScaledPSD *= -1;
+        }
+
+        // Compute a centrality parameter
+        // ==============================
+        Real alphaAffPri = maxStep( s, dsAff, Real(1) );
+        Real alphaAffDual = maxStep( z, dzAff, Real(1) );
+        if( ctrl.forceSameStep )
+            alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
+        if( ctrl.print )
+            Output
+            ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
+        // NOTE: dz and ds are used as temporaries
+        ds = s;
+        dz = z;
+        Axpy( alphaAffPri,  dsAff, ds );
+        Axpy( alphaAffDual, dzAff, dz );
+        const Real muAff = Dot(ds,dz) / degree;
+        if( ctrl.print )
+            Output("muAff = ",muAff,", mu = ",mu);
+        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        if( ctrl.print )
+            Output("sigma=",sigma);
+
+        // Solve for the combined direction
+        // ================================
+        rc *= 1-sigma;
+        rb *= 1-sigma;
+        rh *= 1-sigma;
+        auto rmuSOC = socPart(rmu);
+        auto rmuPSD = psdPart(rmu);
+        if( ctrl.mehrotra )
+        {
+            // r_mu := l + inv(l) o ((inv(W)^T dsAff) o (W dzAff) - sigma*mu)
+            // --------------------------------------------------------------
+            soc::Apply
+            ( socPart(dsAffScaled), socPart(dzAffScaled), rmuSOC,
+              orders, firstInds );
+            soc::Shift( rmuSOC, -sigma*mu, orders, firstInds );
+            soc::Apply( lInv, rmuSOC, orders, firstInds );
+            rmuSOC += l;
+
+            psd::Apply
+            ( psdPart(dsAffScaled), psdPart(dzAffScaled), rmuPSD,
+              psdOrders, psdFirstInds );
+            Axpy( -sigma*mu, e, rmuPSD );
+            psd::SymmetricSolve( lambda, rmuPSD, psdOrders, psdFirstInds );
+            rmuPSD += lambda;
+        }
+        else
+        {
+            // r_mu -= sigma*mu*inv(l)
+            // -----------------------
+            Axpy( -sigma*mu, lInv, rmuSOC );
+            // NOTE: dsAffScaled is used as a temporary
+            auto tmp = psdPart(dsAffScaled);
+            tmp = e;
+            psd::SymmetricSolve( lambda, tmp, psdOrders, psdFirstInds );
+            Axpy( -sigma*mu, tmp, rmuPSD );
+        }
+
+        // Compute the proposed step from the KKT system
+        // ---------------------------------------------
+        KKTRHS
+        ( rc, rb, rh, rmu, wRoot, orders, firstInds,
+          r, psdOrders, psdFirstInds, d );
+        try { ldl::SolveAfter( J, dSub, p, d, false ); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Solve failed with rel. error ",relError,
+                 " which does not meet the minimum tolerance of ",ctrl.minTol);
+        }
+        ExpandSolution
+        ( m, n, d, rmu, wRoot, orders, firstInds,
+          r, psdOrders, psdFirstInds, dx, dy, dz, ds );
+
+        // Update the current estimates
+        // ============================
+        Real alphaPri = maxStep( s, ds, 1/ctrl.maxStepRatio );
+        Real alphaDual = maxStep( z, dz, 1/ctrl.maxStepRatio );
+        alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
+        alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.print )
+            Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
+        Axpy( alphaPri,  dx, x );
+        Axpy( alphaPri,  ds, s );
+        Axpy( alphaDual, dy, y );
+        Axpy( alphaDual, dz, z );
+        if( alphaPri == Real(0) && alphaDual == Real(0) )
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Zero step length computed before reaching minimum tolerance "
+                 "of ",ctrl.minTol);
+        }
+    }
+    SetIndent( indent );
+}
+
 #define PROTO(Real) \
   template void Mehrotra \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& G, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Real>& h, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    const Matrix<Int>& psdOrders, \
+    const Matrix<Int>& psdFirstInds, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          Matrix<Real>& s, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const Matrix<Real>& A, \
     const Matrix<Real>& G, \
     const Matrix<Real>& b, \
@@ -275,6 +275,65 @@ void ExpandSolution
         DistMultiVec<Real>& ds,
   Int cutoffPar=1000 );
 
+// Products of second-order and semidefinite cones
+// ===============================================
+template<typename Real>
+void Initialize
+( const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+  bool primalInit, bool dualInit );
+template<typename Real>
+void KKT
+( const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& w,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Real>& r,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& J,
+  bool onlyLower=true );
+template<typename Real>
+void KKTRHS
+( const Matrix<Real>& rc,
+  const Matrix<Real>& rb,
+  const Matrix<Real>& rh,
+  const Matrix<Real>& rmu,
+  const Matrix<Real>& wRoot,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Real>& r,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& d );
+template<typename Real>
+void ExpandSolution
+( Int m, Int n,
+  const Matrix<Real>& d,
+  const Matrix<Real>& rmu,
+  const Matrix<Real>& wRoot,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Real>& r,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& dx,
+        Matrix<Real>& dy,
+        Matrix<Real>& dz,
+        Matrix<Real>& ds );
+
 } // namespace affine
 } // namespace socp
 } // namespace El
@@ -0,0 +1,367 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../util.hpp"
+
+namespace El {
+namespace socp {
+namespace affine {
+
+// The following extends the (dense) full KKT system to a cone K which is the
+// product of second-order cones (the first orders.Height() entries of s and
+// z) and of cones of symmetric positive semi-definite matrices (the
+// remaining entries, see the documentation of the psd namespace).
+//
+// For each semidefinite block, the Nesterov-Todd scaling point is
+// W = R R^T, where R^T Z R = inv(R) S inv(R)^T = Lambda, and the action of
+// W on the vectorization of a symmetric matrix X is that of the Kronecker
+// product W (x) W, i.e.,
+//
+//   vec(W X W) = (W (x) W) vec(X).
+//
+// The role of W^T r_mu in the second-order cone case is played by
+// R r_mu R^T, and the role of W dz by R^T dZ R.
+
+// The two-stage initialization procedure of the second-order cone case (see
+// Initialize.cpp) carries over verbatim since the identity scaling of a
+// semidefinite block is the identity map on its vectorization; only the
+// final shift into the interior of the cone differs.
+
+template<typename Real>
+void Initialize
+( const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+  bool primalInit, bool dualInit )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = G.Height();
+    const Int kSOC = orders.Height();
+    const Int kPSD = psdOrders.Height();
+    if( kSOC+kPSD != k )
+        LogicError("Cone sizes do not sum to the height of G");
+    if( primalInit )
+    {
+        if( x.Height() != n || x.Width() != 1 )
+            LogicError("x was of the wrong size");
+        if( s.Height() != k || s.Width() != 1 )
+            LogicError("s was of the wrong size");
+    }
+    if( dualInit )
+    {
+        if( y.Height() != m || y.Width() != 1 )
+            LogicError("y was of the wrong size");
+        if( z.Height() != k || z.Width() != 1 )
+            LogicError("z was of the wrong size");
+    }
+    if( primalInit && dualInit )
+        return;
+
+    Matrix<Real> J, ones;
+    Ones( ones, k, 1 );
+    lp::affine::KKT( A, G, ones, ones, J, true );
+    Matrix<Real> dSub;
+    Permutation p;
+    LDL( J, dSub, p, false );
+
+    Matrix<Real> rc, rb, rh, rmu, u, d;
+    Zeros( rmu, k, 1 );
+    if( !primalInit )
+    {
+        Zeros( rc, n, 1 );
+        rb = b;
+        rb *= -1;
+        rh = h;
+        rh *= -1;
+        lp::affine::KKTRHS( rc, rb, rh, rmu, ones, d );
+        ldl::SolveAfter( J, dSub, p, d, false );
+        lp::affine::ExpandCoreSolution( m, n, k, d, x, u, s );
+        s *= -1;
+    }
+    if( !dualInit )
+    {
+        rc = c;
+        Zeros( rb, m, 1 );
+        Zeros( rh, k, 1 );
+        lp::affine::KKTRHS( rc, rb, rh, rmu, ones, d );
+        ldl::SolveAfter( J, dSub, p, d, false );
+        lp::affine::ExpandCoreSolution( m, n, k, d, u, y, z );
+    }
+
+    // Shift s and z by (1 + alpha) e if alpha := -min eig >= -gamma
+    // =============================================================
+    Matrix<Real> e;
+    Zeros( e, k, 1 );
+    auto eSOC = e(IR(0,kSOC),ALL);
+    auto ePSD = e(IR(kSOC,k),ALL);
+    soc::Identity( eSOC, orders, firstInds );
+    psd::Identity( ePSD, psdOrders, psdFirstInds );
+    auto minEig = [&]( const Matrix<Real>& q ) -> Real
+      {
+          Real qMinEig = limits::Max<Real>();
+          if( kSOC > 0 )
+              qMinEig = soc::MinEig( q(IR(0,kSOC),ALL), orders, firstInds );
+          if( kPSD > 0 )
+              qMinEig =
+                Min
+                ( qMinEig,
+                  psd::MinEig( q(IR(kSOC,k),ALL), psdOrders, psdFirstInds ) );
+          return qMinEig;
+      };
+    const Real eps = limits::Epsilon<Real>();
+    const Real gammaPrimal = Sqrt(eps)*Max(Nrm2(s),Real(1));
+    const Real gammaDual   = Sqrt(eps)*Max(Nrm2(z),Real(1));
+    const Real alphaPrimal = -minEig( s );
+    if( alphaPrimal >= Real(0) && primalInit )
+        RuntimeError("initialized s was non-positive");
+    const Real alphaDual = -minEig( z );
+    if( alphaDual >= Real(0) && dualInit )
+        RuntimeError("initialized z was non-positive");
+    if( alphaPrimal >= -gammaPrimal )
+        Axpy( alphaPrimal+1, e, s );
+    if( alphaDual >= -gammaDual )
+        Axpy( alphaDual+1, e, z );
+}
+
+template<typename Real>
+void KKT
+( const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& w,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Real>& r,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& J,
+  bool onlyLower )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = G.Height();
+    const Int kSOC = w.Height();
+    const Int kPSD = r.Height();
+    if( kSOC+kPSD != k )
+        LogicError("Cone sizes do not sum to the height of G");
+
+    Zeros( J, n+m+k, n+m+k );
+    const IR xInd(0,n), yInd(n,n+m), zInd(n+m,n+m+k);
+    auto Jxy = J(xInd,yInd); auto Jxz = J(xInd,zInd);
+    auto Jyx = J(yInd,xInd); auto Jzx = J(zInd,xInd);
+    auto Jzz = J(zInd,zInd);
+
+    // Jyx := A and Jzx := G
+    // =====================
+    Jyx = A;
+    Jzx = G;
+    if( !onlyLower )
+    {
+        Transpose( A, Jxy );
+        Transpose( G, Jxz );
+    }
+
+    // Jzz := -W^2 for the second-order cones
+    // ======================================
+    Matrix<Real> wDets;
+    soc::Dets( w, wDets, orders, firstInds );
+    for( Int i=0; i<kSOC; )
+    {
+        const Int order = orders(i);
+        const Int firstInd = firstInds(i);
+        if( i != firstInd )
+            LogicError("Inconsistency between firstInds and orders");
+
+        auto Jzzi = Jzz(IR(i,i+order),IR(i,i+order));
+        auto wi = w(IR(i,i+order),ALL);
+        const Real wiDet = wDets(i);
+        // Jzzi := det(w_i) R - 2 w w^T
+        ShiftDiagonal( Jzzi, -wiDet );
+        Jzzi(0,0) += 2*wiDet;
+        Syr( LOWER, Real(-2), wi, Jzzi );
+        if( !onlyLower )
+            MakeSymmetric( LOWER, Jzzi );
+
+        i += order;
+    }
+
+    // Jzz := -(W (x) W) for the semidefinite cones
+    // ============================================
+    Matrix<Real> R, W;
+    for( Int i=0; i<kPSD; )
+    {
+        const Int order = psdOrders(i);
+        const Int firstInd = psdFirstInds(i);
+        if( i != firstInd )
+            LogicError("Inconsistency between psdFirstInds and psdOrders");
+
+        R.LockedAttach( order, order, r.LockedBuffer(i,0), order );
+        Gemm( NORMAL, TRANSPOSE, Real(1), R, R, W );
+
+        const Int offset = kSOC + i;
+        for( Int d=0; d<order; ++d )
+          for( Int c=0; c<order; ++c )
+            for( Int bCol=0; bCol<order; ++bCol )
+              for( Int a=0; a<order; ++a )
+                Jzz(offset+a+bCol*order,offset+c+d*order) =
+                  -W(a,c)*W(bCol,d);
+
+        i += order*order;
+    }
+}
+
+template<typename Real>
+void KKTRHS
+( const Matrix<Real>& rc,
+  const Matrix<Real>& rb,
+  const Matrix<Real>& rh,
+  const Matrix<Real>& rmu,
+  const Matrix<Real>& wRoot,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Real>& r,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& d )
+{
+    DEBUG_CSE
+    const Int n = rc.Height();
+    const Int m = rb.Height();
+    const Int k = rh.Height();
+    const Int kSOC = wRoot.Height();
+    Zeros( d, n+m+k, 1 );
+
+    auto dx = d(IR(0,n),ALL);
+    dx = rc;
+    dx *= -1;
+
+    auto dy = d(IR(n,n+m),ALL);
+    dy = rb;
+    dy *= -1;
+
+    auto dz = d(IR(n+m,n+m+k),ALL);
+    dz = rmu;
+    auto dzSOC = dz(IR(0,kSOC),ALL);
+    auto dzPSD = dz(IR(kSOC,k),ALL);
+    soc::ApplyQuadratic( wRoot, dzSOC, orders, firstInds );
+    psd::ApplyScaling( NORMAL, r, dzPSD, psdOrders, psdFirstInds );
+    dz -= rh;
+}
+
+template<typename Real>
+void ExpandSolution
+( Int m, Int n,
+  const Matrix<Real>& d,
+  const Matrix<Real>& rmu,
+  const Matrix<Real>& wRoot,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  const Matrix<Real>& r,
+  const Matrix<Int>& psdOrders,
+  const Matrix<Int>& psdFirstInds,
+        Matrix<Real>& dx,
+        Matrix<Real>& dy,
+        Matrix<Real>& dz,
+        Matrix<Real>& ds )
+{
+    DEBUG_CSE
+    const Int kSOC = wRoot.Height();
+    const Int k = kSOC + r.Height();
+    qp::affine::ExpandCoreSolution( m, n, k, d, dx, dy, dz );
+
+    // ds := - W^T ( rmu + W dz )
+    // ==========================
+    ds = dz;
+    auto dsSOC = ds(IR(0,kSOC),ALL);
+    auto dsPSD = ds(IR(kSOC,k),ALL);
+    soc::ApplyQuadratic( wRoot, dsSOC, orders, firstInds );
+    psd::ApplyScaling( TRANSPOSE, r, dsPSD, psdOrders, psdFirstInds );
+    ds += rmu;
+    soc::ApplyQuadratic( wRoot, dsSOC, orders, firstInds );
+    psd::ApplyScaling( NORMAL, r, dsPSD, psdOrders, psdFirstInds );
+    ds *= -1;
+}
+
+#define PROTO(Real) \
+  template void Initialize \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& G, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Real>& h, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    const Matrix<Int>& psdOrders, \
+    const Matrix<Int>& psdFirstInds, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          Matrix<Real>& s, \
+    bool primalInit, bool dualInit ); \
+  template void KKT \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& G, \
+    const Matrix<Real>& w, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    const Matrix<Real>& r, \
+    const Matrix<Int>& psdOrders, \
+    const Matrix<Int>& psdFirstInds, \
+          Matrix<Real>& J, \
+    bool onlyLower ); \
+  template void KKTRHS \
+  ( const Matrix<Real>& rc, \
+    const Matrix<Real>& rb, \
+    const Matrix<Real>& rh, \
+    const Matrix<Real>& rmu, \
+    const Matrix<Real>& wRoot, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    const Matrix<Real>& r, \
+    const Matrix<Int>& psdOrders, \
+    const Matrix<Int>& psdFirstInds, \
+          Matrix<Real>& d ); \
+  template void ExpandSolution \
+  ( Int m, Int n, \
+    const Matrix<Real>& d, \
+    const Matrix<Real>& rmu, \
+    const Matrix<Real>& wRoot, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    const Matrix<Real>& r, \
+    const Matrix<Int>& psdOrders, \
+    const Matrix<Int>& psdFirstInds, \
+          Matrix<Real>& dx, \
+          Matrix<Real>& dy, \
+          Matrix<Real>& dz, \
+          Matrix<Real>& ds );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace affine
+} // namespace socp
+} // namespace El
@@ -57,6 +57,30 @@ void Mehrotra
         DistMultiVec<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
+// NOTE: This should be in a different header
+template<typename Real>
+Int PDHG
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const PDHGCtrl<Real>& ctrl=PDHGCtrl<Real>() );
+template<typename Real>
+Int PDHG
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const PDHGCtrl<Real>& ctrl=PDHGCtrl<Real>() );
+
 } // namespace direct
 } // namespace socp
 } // namespace El
@@ -0,0 +1,172 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../../util/PDHG.hpp"
+
+namespace El {
+namespace socp {
+namespace direct {
+
+// Solve the second-order cone program
+//
+//   min c^T x, s.t. A x = b, x in K,
+//
+// with the Primal-Dual Hybrid Gradient method. Since an arbitrary diagonal
+// scaling does not preserve a second-order cone, the column scaling produced
+// by Ruiz equilibration is replaced by its maximum over each cone, which
+// only rescales each cone as a whole. As in the LP case, the saddle-point
+// dual variable is negated to match the convention
+//
+//   A^T y - z + c = 0.
+//
+
+template<typename Real>
+Int PDHG
+( const SparseMatrix<Real>& APre,
+  const Matrix<Real>& bPre,
+  const Matrix<Real>& cPre,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const PDHGCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+
+    auto A = APre;
+    auto b = bPre;
+    auto c = cPre;
+    Matrix<Real> dRow, dCol;
+    if( ctrl.equilibrate )
+    {
+        RuizEquil( A, dRow, dCol, ctrl.print );
+        Matrix<Real> dColCone( dCol );
+        cone::AllReduce( dColCone, orders, firstInds, mpi::MAX );
+        DiagonalScale( RIGHT, NORMAL, dCol, A );
+        DiagonalSolve( RIGHT, NORMAL, dColCone, A );
+        dCol = dColCone;
+
+        DiagonalSolve( LEFT, NORMAL, dRow, b );
+        DiagonalSolve( LEFT, NORMAL, dCol, c );
+    }
+    else
+    {
+        Ones( dRow, m, 1 );
+        Ones( dCol, n, 1 );
+    }
+
+    auto project =
+      [&]( Matrix<Real>& w ) { soc::Project( w, orders, firstInds ); };
+    const Int numIts =
+      pdhg::Solve( A, b, c, x, y, project, ctrl, ctrl.print );
+
+    z = c;
+    Multiply( TRANSPOSE, Real(-1), A, y, Real(1), z );
+
+    DiagonalSolve( LEFT, NORMAL, dCol, x );
+    DiagonalSolve( LEFT, NORMAL, dRow, y );
+    y *= -1;
+    DiagonalScale( LEFT, NORMAL, dCol, z );
+    return numIts;
+}
+
+template<typename Real>
+Int PDHG
+( const DistSparseMatrix<Real>& APre,
+  const DistMultiVec<Real>& bPre,
+  const DistMultiVec<Real>& cPre,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const PDHGCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    mpi::Comm comm = APre.Comm();
+    const int commRank = mpi::Rank(comm);
+
+    auto A = APre;
+    auto b = bPre;
+    auto c = cPre;
+    DistMultiVec<Real> dRow(comm), dCol(comm);
+    if( ctrl.equilibrate )
+    {
+        RuizEquil( A, dRow, dCol, ctrl.print );
+        DistMultiVec<Real> dColCone( dCol );
+        cone::AllReduce( dColCone, orders, firstInds, mpi::MAX );
+        DiagonalScale( RIGHT, NORMAL, dCol, A );
+        DiagonalSolve( RIGHT, NORMAL, dColCone, A );
+        dCol = dColCone;
+
+        DiagonalSolve( LEFT, NORMAL, dRow, b );
+        DiagonalSolve( LEFT, NORMAL, dCol, c );
+    }
+    else
+    {
+        Ones( dRow, m, 1 );
+        Ones( dCol, n, 1 );
+    }
+
+    x.SetComm( comm );
+    y.SetComm( comm );
+    z.SetComm( comm );
+    auto project =
+      [&]( DistMultiVec<Real>& w ) { soc::Project( w, orders, firstInds ); };
+    const Int numIts =
+      pdhg::Solve( A, b, c, x, y, project, ctrl, ctrl.print && commRank == 0 );
+
+    z = c;
+    Multiply( TRANSPOSE, Real(-1), A, y, Real(1), z );
+
+    DiagonalSolve( LEFT, NORMAL, dCol, x );
+    DiagonalSolve( LEFT, NORMAL, dRow, y );
+    y *= -1;
+    DiagonalScale( LEFT, NORMAL, dCol, z );
+    return numIts;
+}
+
+#define PROTO(Real) \
+  template Int PDHG \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const PDHGCtrl<Real>& ctrl ); \
+  template Int PDHG \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const PDHGCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace socp
+} // namespace El
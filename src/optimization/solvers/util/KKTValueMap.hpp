@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace kkt {
+
+// Within an Interior Point Method, the sparsity pattern of a KKT system is
+// fixed and only a diagonal block (the barrier term, e.g., z <> x) changes
+// between iterations. Rather than requeueing (and sorting and exchanging) all
+// of the entries of the KKT system each iteration, the system is assembled
+// once with the barrier block zeroed, and the offsets of the diagonal entries
+// J(offset+i,offset+i) within the value buffer are recorded so that
+//
+//   J := JStatic + diag(0,d,0)
+//
+// can be formed by copying the values of JStatic and then adding d in place.
+// Since the pattern of J is then never modified, the symbolic analysis of J
+// can be reused as-is.
+
+template<typename Real>
+class DiagonalValueMap
+{
+public:
+    // Record the offsets of the diagonal entries and copy the pattern (and
+    // values) of JStatic into J
+    void Initialize
+    ( const SparseMatrix<Real>& JStatic, Int offset, Int size,
+            SparseMatrix<Real>& J )
+    {
+        DEBUG_CSE
+        J = JStatic;
+        J.FreezeSparsity();
+        numEntries_ = J.NumEntries();
+        slots_.resize( size );
+        for( Int i=0; i<size; ++i )
+        {
+            const Int row = offset + i;
+            const Int slot = J.Offset( row, row );
+            if( slot >= numEntries_ ||
+                J.Row(slot) != row || J.Col(slot) != row )
+                LogicError("Diagonal entry ",row," is not in the pattern");
+            slots_[i] = slot;
+        }
+    }
+
+    // J := JStatic + diag(0,d,0), where J must have been initialized from a
+    // matrix with the same pattern as JStatic
+    void Refresh
+    ( const SparseMatrix<Real>& JStatic, const Matrix<Real>& d,
+            SparseMatrix<Real>& J ) const
+    {
+        DEBUG_CSE
+        const Int size = slots_.size();
+        if( JStatic.NumEntries() != numEntries_ ||
+            J.NumEntries() != numEntries_ )
+            LogicError("The KKT pattern changed since initialization");
+        if( d.Height() != size || d.Width() != 1 )
+            LogicError
+            ("d was ",d.Height()," x ",d.Width()," but should have been ",
+             size," x 1");
+        Real* valBuf = J.ValueBuffer();
+        MemCopy( valBuf, JStatic.LockedValueBuffer(), numEntries_ );
+        for( Int i=0; i<size; ++i )
+            valBuf[slots_[i]] += d(i);
+    }
+
+private:
+    Int numEntries_=0;
+    vector<Int> slots_;
+};
+
+// The distributed analogue, where d is distributed with its own (1D) row
+// partition and so its entries must be routed to the owners of the
+// corresponding rows of J. The communication pattern is computed once, and
+// each refresh requires a single AllToAll of the values (which arrive in the
+// order of the local rows of J, as both partitions are contiguous).
+template<typename Real>
+class DistDiagonalValueMap
+{
+public:
+    void Initialize
+    ( const DistSparseMatrix<Real>& JStatic, Int offset, Int size,
+            DistSparseMatrix<Real>& J )
+    {
+        DEBUG_CSE
+        J = JStatic;
+        J.FreezeSparsity();
+        numLocalEntries_ = J.NumLocalEntries();
+        size_ = size;
+        mpi::Comm comm = J.Comm();
+        const int commSize = mpi::Size( comm );
+
+        // Find the local rows of J within the diagonal block
+        const Int firstLocalRow = J.FirstLocalRow();
+        const Int localHeight = J.LocalHeight();
+        const Int rowBeg = Max( offset, firstLocalRow );
+        const Int rowEnd = Min( offset+size, firstLocalRow+localHeight );
+        slots_.clear();
+        for( Int row=rowBeg; row<rowEnd; ++row )
+        {
+            const Int rowLoc = row - firstLocalRow;
+            const Int slot = J.Offset( rowLoc, row );
+            if( slot >= numLocalEntries_ ||
+                J.Row(slot) != row || J.Col(slot) != row )
+                LogicError("Diagonal entry ",row," is not in the pattern");
+            slots_.push_back( slot );
+        }
+
+        // The entries of d are distributed over the same communicator with
+        // the default blocksize for a height of 'size'
+        DistMultiVec<Real> dProto( size, 1, comm );
+        recvCounts_.assign( commSize, 0 );
+        for( Int row=rowBeg; row<rowEnd; ++row )
+            ++recvCounts_[dProto.RowOwner(row-offset)];
+        sendCounts_.assign( commSize, 0 );
+        for( Int iLoc=0; iLoc<dProto.LocalHeight(); ++iLoc )
+            ++sendCounts_[J.RowOwner(offset+dProto.GlobalRow(iLoc))];
+        Scan( sendCounts_, sendOffs_ );
+        Scan( recvCounts_, recvOffs_ );
+    }
+
+    // J := JStatic + diag(0,d,0)
+    void Refresh
+    ( const DistSparseMatrix<Real>& JStatic, const DistMultiVec<Real>& d,
+            DistSparseMatrix<Real>& J ) const
+    {
+        DEBUG_CSE
+        if( JStatic.NumLocalEntries() != numLocalEntries_ ||
+            J.NumLocalEntries() != numLocalEntries_ )
+            LogicError("The KKT pattern changed since initialization");
+        if( d.Height() != size_ || d.Width() != 1 )
+            LogicError
+            ("d was ",d.Height()," x ",d.Width()," but should have been ",
+             size_," x 1");
+
+        // Since the local rows of d map to contiguous rows of J, they are
+        // already packed in the order of their destinations
+        const Int numRecv = slots_.size();
+        vector<Real> recvBuf( numRecv );
+        mpi::AllToAll
+        ( d.LockedMatrix().LockedBuffer(),
+          sendCounts_.data(), sendOffs_.data(),
+          recvBuf.data(), recvCounts_.data(), recvOffs_.data(), J.Comm() );
+
+        Real* valBuf = J.ValueBuffer();
+        MemCopy( valBuf, JStatic.LockedValueBuffer(), numLocalEntries_ );
+        for( Int k=0; k<numRecv; ++k )
+            valBuf[slots_[k]] += recvBuf[k];
+    }
+
+private:
+    Int numLocalEntries_=0, size_=0;
+    vector<Int> slots_;
+    vector<int> sendCounts_, sendOffs_, recvCounts_, recvOffs_;
+};
+
+} // namespace kkt
+} // namespace El
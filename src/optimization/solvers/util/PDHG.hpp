@@ -0,0 +1,250 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pdhg {
+
+// A matrix-free Primal-Dual Hybrid Gradient method for the saddle-point
+// formulation
+//
+//   min_{x in K} max_y c^T x - y^T (A x - b)
+//
+// of a "direct" conic-form program, where K is self-dual and 'project'
+// overwrites its argument with its Euclidean projection onto K. Each
+// iteration requires one multiplication with A and one with A^T, as A x and
+// A^T y are carried along with x and y. The restart scheme and the primal
+// weight update follow
+//
+//   D. Applegate et al., "Practical large-scale linear programming using
+//   primal-dual hybrid gradient", NeurIPS, 2021.
+//
+// Note that the returned dual variable follows the saddle-point sign
+// convention, i.e., c - A^T y is (approximately) a member of K.
+
+template<typename Real>
+struct KKTError
+{
+    Real primalRes, dualRes, gap;
+
+    // The (unweighted) magnitude used to drive restarts
+    Real Magnitude() const
+    { return Sqrt(primalRes*primalRes+dualRes*dualRes+gap*gap); }
+};
+
+template<typename Real,class SparseMat,class MultiVec,class Projector>
+Int Solve
+( const SparseMat& A,
+  const MultiVec& b,
+  const MultiVec& c,
+        MultiVec& x,
+        MultiVec& y,
+        Projector project,
+  const PDHGCtrl<Real>& ctrl,
+        bool print )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real bNorm = Nrm2( b );
+    const Real cNorm = Nrm2( c );
+
+    // Estimate || A ||_2 with the power method applied to A^T A
+    MultiVec v(c), Av(b);
+    Ones( v, n, 1 );
+    Zeros( Av, m, 1 );
+    Real twoNormA = 0;
+    if( n > 0 )
+    {
+        v *= 1/Sqrt(Real(n));
+        for( Int iter=0; iter<ctrl.powerIters; ++iter )
+        {
+            Multiply( NORMAL, Real(1), A, v, Real(0), Av );
+            Multiply( TRANSPOSE, Real(1), A, Av, Real(0), v );
+            const Real vNorm = Nrm2( v );
+            if( vNorm == Real(0) )
+                break;
+            twoNormA = Sqrt(vNorm);
+            v *= 1/vNorm;
+        }
+    }
+    if( twoNormA == Real(0) )
+        twoNormA = 1;
+    const Real eta = ctrl.stepRatio / twoNormA;
+    Real omega =
+      ( bNorm > Real(0) && cNorm > Real(0) ? cNorm/bNorm : Real(1) );
+    Real tau = eta/omega;
+    Real sigma = eta*omega;
+
+    Zeros( x, n, 1 );
+    Zeros( y, m, 1 );
+    MultiVec Ax(b), ATy(c);
+    Zeros( Ax, m, 1 );
+    Zeros( ATy, n, 1 );
+
+    MultiVec t(c), r(b);
+    auto kktError =
+      [&]( const MultiVec& xCand, const MultiVec& yCand,
+           const MultiVec& AxCand, const MultiVec& ATyCand )
+      {
+          KKTError<Real> error;
+
+          // || A x - b ||_2
+          r = AxCand;
+          r -= b;
+          error.primalRes = Nrm2( r );
+
+          // || (c - A^T y) - Proj_K(c - A^T y) ||_2
+          t = c;
+          t -= ATyCand;
+          v = t;
+          project( v );
+          t -= v;
+          error.dualRes = Nrm2( t );
+
+          error.gap = Abs(Dot(c,xCand)-Dot(b,yCand));
+          return error;
+      };
+    auto relError =
+      [&]( const KKTError<Real>& error,
+           const MultiVec& xCand, const MultiVec& yCand )
+      {
+          const Real primObj = Dot(c,xCand);
+          const Real dualObj = Dot(b,yCand);
+          return Max( Max( error.primalRes/(1+bNorm),
+                           error.dualRes/(1+cNorm) ),
+                      error.gap/(1+Abs(primObj)+Abs(dualObj)) );
+      };
+
+    // The running averages since the last restart
+    MultiVec xAvg(x), yAvg(y), AxAvg(Ax), ATyAvg(ATy);
+    // The iterates at the last restart
+    MultiVec xLast(x), yLast(y);
+    Real lastMagnitude = kktError( x, y, Ax, ATy ).Magnitude();
+    Real prevCandMagnitude = limits::Infinity<Real>();
+
+    MultiVec xNew(x), AxNew(Ax);
+    Int numIts=0, numInner=0;
+    bool converged = false;
+    while( numIts < ctrl.maxIter )
+    {
+        // x := Proj_K(x - tau (c - A^T y))
+        xNew = x;
+        Axpy( -tau, c, xNew );
+        Axpy( tau, ATy, xNew );
+        project( xNew );
+        Multiply( NORMAL, Real(1), A, xNew, Real(0), AxNew );
+
+        // y := y + sigma (b - A (2 xNew - x))
+        Axpy( sigma, b, y );
+        Axpy( -2*sigma, AxNew, y );
+        Axpy( sigma, Ax, y );
+        Multiply( TRANSPOSE, Real(1), A, y, Real(0), ATy );
+
+        x = xNew;
+        Ax = AxNew;
+        ++numIts;
+        ++numInner;
+
+        const Real weight = Real(1)/numInner;
+        xAvg *= 1-weight;
+        Axpy( weight, x, xAvg );
+        yAvg *= 1-weight;
+        Axpy( weight, y, yAvg );
+        AxAvg *= 1-weight;
+        Axpy( weight, Ax, AxAvg );
+        ATyAvg *= 1-weight;
+        Axpy( weight, ATy, ATyAvg );
+
+        if( numIts % ctrl.checkFreq != 0 && numIts != ctrl.maxIter )
+            continue;
+
+        // Choose the better of the current and average iterates
+        const auto curError = kktError( x, y, Ax, ATy );
+        const auto avgError = kktError( xAvg, yAvg, AxAvg, ATyAvg );
+        const bool useAvg = avgError.Magnitude() < curError.Magnitude();
+        const auto& candError = ( useAvg ? avgError : curError );
+        const Real candMagnitude = candError.Magnitude();
+        const Real candRelError =
+          ( useAvg ? relError( candError, xAvg, yAvg )
+                   : relError( candError, x, y ) );
+        if( print )
+            Output
+            ("iter ",numIts,": ",
+             "|| A x - b ||_2 = ",candError.primalRes,", ",
+             "dist(c - A^T y,K) = ",candError.dualRes,", ",
+             "|gap| = ",candError.gap,", ",
+             "omega = ",omega,
+             ( useAvg ? " (average)" : "" ));
+        if( candRelError <= ctrl.tol )
+        {
+            if( useAvg )
+            {
+                x = xAvg;
+                y = yAvg;
+            }
+            converged = true;
+            break;
+        }
+        if( !ctrl.restart )
+            continue;
+
+        bool restart = false;
+        if( candMagnitude <= ctrl.sufficientDecay*lastMagnitude )
+            restart = true;
+        else if( candMagnitude <= ctrl.necessaryDecay*lastMagnitude &&
+                 candMagnitude > prevCandMagnitude )
+            restart = true;
+        else if( numInner >= ctrl.artificialRestartRatio*numIts )
+            restart = true;
+        prevCandMagnitude = candMagnitude;
+        if( !restart )
+            continue;
+
+        if( useAvg )
+        {
+            x = xAvg;
+            y = yAvg;
+            Ax = AxAvg;
+            ATy = ATyAvg;
+        }
+
+        // Rebalance the primal and dual step sizes using the movement
+        // since the last restart
+        xLast -= x;
+        yLast -= y;
+        const Real deltaX = Nrm2( xLast );
+        const Real deltaY = Nrm2( yLast );
+        if( deltaX > Real(0) && deltaY > Real(0) )
+        {
+            const Real theta = ctrl.primalWeightSmoothing;
+            omega = Exp( theta*Log(deltaY/deltaX) + (1-theta)*Log(omega) );
+            tau = eta/omega;
+            sigma = eta*omega;
+        }
+        if( print )
+            Output("Restarted with primal weight ",omega);
+
+        xLast = x;
+        yLast = y;
+        xAvg = x;
+        yAvg = y;
+        AxAvg = Ax;
+        ATyAvg = ATy;
+        lastMagnitude = candMagnitude;
+        prevCandMagnitude = limits::Infinity<Real>();
+        numInner = 0;
+    }
+    if( !converged && print )
+        Output("PDHG failed to converge");
+    return numIts;
+}
+
+} // namespace pdhg
+} // namespace El
@@ -10,34 +10,42 @@
 
 namespace El {
 
+// The coherence, max_{j != k} |a_j^H a_k| / (|| a_j ||_2 || a_k ||_2), is
+// computed by scaling the Gramian A^H A from both sides rather than by first
+// forming a copy of A with normalized columns
+
 template<typename F>
 Base<F> Coherence( const Matrix<F>& A )
 {
     DEBUG_CSE
-    Matrix<F> B( A );
     Matrix<Base<F>> norms;
-    ColumnTwoNorms( B, norms );
+    ColumnTwoNorms( A, norms );
 
-    DiagonalSolve( RIGHT, NORMAL, norms, B, true );
     Matrix<F> C;
-    Identity( C, A.Width(), A.Width() );
-    Herk( UPPER, ADJOINT, Base<F>(-1), B, Base<F>(1), C );
+    Herk( UPPER, ADJOINT, Base<F>(1), A, C );
+    DiagonalSolve( LEFT, NORMAL, norms, C, true );
+    DiagonalSolve( RIGHT, NORMAL, norms, C, true );
+    ShiftDiagonal( C, F(-1) );
 
     return HermitianMaxNorm( UPPER, C );
 }
 
 template<typename F>
-Base<F> Coherence( const ElementalMatrix<F>& A )
+Base<F> Coherence( const ElementalMatrix<F>& APre )
 {
     DEBUG_CSE
-    DistMatrix<F> B( A );
-    DistMatrix<Base<F>,MR,STAR> norms(B.Grid());
-    ColumnTwoNorms( B, norms );
-
-    DiagonalSolve( RIGHT, NORMAL, norms, B, true );
-    DistMatrix<F> C(B.Grid());
-    Identity( C, A.Width(), A.Width() );
-    Herk( UPPER, ADJOINT, Base<F>(-1), B, Base<F>(1), C );
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<Base<F>,MR,STAR> norms(g);
+    ColumnTwoNorms( A, norms );
+
+    DistMatrix<F> C(g);
+    Herk( UPPER, ADJOINT, Base<F>(1), A, C );
+    DiagonalSolve( LEFT, NORMAL, norms, C, true );
+    DiagonalSolve( RIGHT, NORMAL, norms, C, true );
+    ShiftDiagonal( C, F(-1) );
 
     return HermitianMaxNorm( UPPER, C );
 }
@@ -11,29 +11,164 @@
 namespace El {
 
 template<typename F>
-void Covariance( const Matrix<F>& D, Matrix<F>& S )
+CovarianceAccumulator<F>::CovarianceAccumulator()
+: numObs_(0)
+{ }
+
+template<typename F>
+CovarianceAccumulator<F>::CovarianceAccumulator( Int n )
+{ Reset( n ); }
+
+template<typename F>
+void CovarianceAccumulator<F>::Reset( Int n )
 {
     DEBUG_CSE
-    const Int numObs = D.Height();
-    const Int n = D.Width();
+    numObs_ = 0;
+    Zeros( mean_, n, 1 );
+    Zeros( scatter_, n, n );
+}
 
-    // Compute the average column
-    Matrix<F> ones, xMean;
-    Ones( ones, numObs, 1 );
-    Gemv( TRANSPOSE, F(1)/F(numObs), D, ones, xMean );
+template<typename F>
+void CovarianceAccumulator<F>::Update( const Matrix<F>& DBlock )
+{
+    DEBUG_CSE
+    const Int numObsB = DBlock.Height();
+    const Int n = DBlock.Width();
+    if( n != mean_.Height() )
+        LogicError("Expected ",mean_.Height()," variables but received ",n);
+    if( numObsB == 0 )
+        return;
+
+    // Compute the average column of the block
+    Matrix<F> ones, meanB;
+    Ones( ones, numObsB, 1 );
+    Gemv( TRANSPOSE, F(1)/F(numObsB), DBlock, ones, meanB );
 
-    // Subtract the mean from each column of D
-    Matrix<F> DDev( D );
-    for( Int i=0; i<numObs; ++i )
+    // Add the scatter of the block about its own mean
+    Matrix<F> DDev( DBlock );
+    for( Int i=0; i<numObsB; ++i )
         blas::Axpy
-        ( n, F(-1), xMean.LockedBuffer(), 1, DDev.Buffer(i,0), DDev.LDim() );
+        ( n, F(-1), meanB.LockedBuffer(), 1, DDev.Buffer(i,0), DDev.LDim() );
+    Herk( LOWER, ADJOINT, Base<F>(1), DDev, Base<F>(1), scatter_ );
 
-    // Form S := 1/(numObs-1) DDev DDev'
-    Herk( LOWER, ADJOINT, Base<F>(1)/Base<F>(numObs-1), DDev, S );
+    Combine( numObsB, meanB );
+}
+
+template<typename F>
+void CovarianceAccumulator<F>::Merge( const CovarianceAccumulator<F>& other )
+{
+    DEBUG_CSE
+    if( other.mean_.Height() != mean_.Height() )
+        LogicError("Accumulators have different numbers of variables");
+    if( other.numObs_ == 0 )
+        return;
+    Axpy( F(1), other.scatter_, scatter_ );
+    Combine( other.numObs_, other.mean_ );
+}
+
+template<typename F>
+void CovarianceAccumulator<F>::Combine( Int numObsB, const Matrix<F>& meanB )
+{
+    DEBUG_CSE
+    const Int numObsA = numObs_;
+    const Int numObsAB = numObsA + numObsB;
+    if( numObsA == 0 )
+    {
+        mean_ = meanB;
+        numObs_ = numObsB;
+        return;
+    }
+
+    // M_AB = M_A + M_B + (n_A n_B / n_AB) delta delta^H, where
+    // delta = mean_B - mean_A, and mean_AB = mean_A + (n_B / n_AB) delta
+    Matrix<F> delta( meanB ), deltaTrans;
+    Axpy( F(-1), mean_, delta );
+    Transpose( delta, deltaTrans );
+    const Base<F> weight =
+      Base<F>(numObsA)*Base<F>(numObsB)/Base<F>(numObsAB);
+    Herk( LOWER, ADJOINT, weight, deltaTrans, Base<F>(1), scatter_ );
+    Axpy( F(numObsB)/F(numObsAB), delta, mean_ );
+    numObs_ = numObsAB;
+}
+
+template<typename F>
+Int CovarianceAccumulator<F>::NumObservations() const
+{ return numObs_; }
+
+template<typename F>
+const Matrix<F>& CovarianceAccumulator<F>::Mean() const
+{ return mean_; }
+
+template<typename F>
+void CovarianceAccumulator<F>::Finalize( Matrix<F>& S ) const
+{
+    DEBUG_CSE
+    if( numObs_ < 2 )
+        LogicError("At least two observations are required");
+    S = scatter_;
+    S *= F(1)/F(numObs_-1);
+    Conjugate( S );
+    MakeHermitian( LOWER, S );
+}
+
+template<typename F>
+void CovarianceAccumulator<F>::Finalize( ElementalMatrix<F>& SPre ) const
+{
+    DEBUG_CSE
+    DistMatrixWriteProxy<F,F,MC,MR> SProx( SPre );
+    auto& S = SProx.Get();
+    const Grid& g = S.Grid();
+    const Int n = mean_.Height();
+
+    // Form the global mean from the weighted local means
+    const Int numObs = mpi::AllReduce( numObs_, g.Comm() );
+    if( numObs < 2 )
+        LogicError("At least two observations are required");
+    Matrix<F> mean;
+    Zeros( mean, n, 1 );
+    if( numObs_ > 0 )
+        Axpy( F(numObs_), mean_, mean );
+    mpi::AllReduce( mean.Buffer(), n, g.Comm() );
+    mean *= F(1)/F(numObs);
+
+    // Each process contributes M_p + n_p delta_p delta_p^H, where
+    // delta_p = mean_p - mean, which are summed directly into S
+    DistMatrix<F,STAR,STAR> contrib(g);
+    contrib.Resize( n, n );
+    contrib.Matrix() = scatter_;
+    if( numObs_ > 0 )
+    {
+        Matrix<F> delta( mean_ ), deltaTrans;
+        Axpy( F(-1), mean, delta );
+        Transpose( delta, deltaTrans );
+        Herk
+        ( LOWER, ADJOINT, Base<F>(numObs_), deltaTrans,
+          Base<F>(1), contrib.Matrix() );
+    }
+    Zeros( S, n, n );
+    AxpyContract( F(1)/F(numObs-1), contrib, S );
     Conjugate( S );
     MakeHermitian( LOWER, S );
 }
 
+template<typename F>
+void Covariance( const Matrix<F>& D, Matrix<F>& S )
+{
+    DEBUG_CSE
+    const Int numObs = D.Height();
+    const Int n = D.Width();
+
+    // Stream over blocks of rows so that only one block is ever centered
+    CovarianceAccumulator<F> accumulator( n );
+    const Int bsize = Blocksize();
+    for( Int k=0; k<numObs; k+=bsize )
+    {
+        const Int nb = Min(bsize,numObs-k);
+        accumulator.Update( D( IR(k,k+nb), ALL ) );
+    }
+    accumulator.Finalize( S );
+}
+
 template<typename F>
 void Covariance
 ( const ElementalMatrix<F>& DPre, ElementalMatrix<F>& SPre )
@@ -49,30 +184,50 @@ void Covariance
 
     const Grid& g = D.Grid();
     const Int numObs = D.Height();
+    const Int n = D.Width();
 
     // Compute the average column
     DistMatrix<F> ones(g), xMean(g);
     Ones( ones, numObs, 1 );
     Gemv( TRANSPOSE, F(1)/F(numObs), D, ones, xMean );
-    DistMatrix<F,MR,STAR> xMean_MR(g);
-    xMean_MR.AlignWith( D );
-    xMean_MR = xMean;
 
-    // Subtract the mean from each column of D
-    DistMatrix<F> DDev( D );
-    for( Int iLoc=0; iLoc<DDev.LocalHeight(); ++iLoc )
-        blas::Axpy
-        ( DDev.LocalWidth(), F(-1), 
-          xMean_MR.LockedBuffer(), 1, 
-          DDev.Buffer(iLoc,0),     DDev.LDim() );
+    // Form conj(S) := 1/(numObs-1) DDev' DDev, where DDev = D - ones xMean^T,
+    // one block of rows at a time (as in the lower adjoint Herk), centering
+    // only the redistributed copies of the current block of D
+    Zeros( S, n, n );
+    DistMatrix<F,MR,  STAR> xMean_MR_STAR(g), D1Trans_MR_STAR(g);
+    DistMatrix<F,STAR,VR  > D1_STAR_VR(g);
+    DistMatrix<F,STAR,MC  > D1_STAR_MC(g);
+    xMean_MR_STAR.AlignWith( S );
+    D1Trans_MR_STAR.AlignWith( S );
+    D1_STAR_MC.AlignWith( S );
+    xMean_MR_STAR = xMean;
+    const F scale = F(1)/F(numObs-1);
+    const Int bsize = Blocksize();
+    for( Int k=0; k<numObs; k+=bsize )
+    {
+        const Int nb = Min(bsize,numObs-k);
+        auto D1 = D( IR(k,k+nb), ALL );
+
+        Transpose( D1, D1Trans_MR_STAR );
+        for( Int i=0; i<nb; ++i )
+            blas::Axpy
+            ( D1Trans_MR_STAR.LocalHeight(), F(-1),
+              xMean_MR_STAR.LockedBuffer(), 1,
+              D1Trans_MR_STAR.Buffer(0,i),  1 );
+        Transpose( D1Trans_MR_STAR, D1_STAR_VR );
+        D1_STAR_MC = D1_STAR_VR;
 
-    // Form S := 1/(numObs-1) DDev DDev'
-    Herk( LOWER, ADJOINT, Base<F>(1)/Base<F>(numObs-1), DDev, S );
+        LocalTrrk
+        ( LOWER, ADJOINT, TRANSPOSE,
+          scale, D1_STAR_MC, D1Trans_MR_STAR, F(1), S );
+    }
     Conjugate( S );
     MakeHermitian( LOWER, S );
 }
 
 #define PROTO(F) \
+  template class CovarianceAccumulator<F>; \
   template void Covariance( const Matrix<F>& D, Matrix<F>& S ); \
   template void Covariance \
   ( const ElementalMatrix<F>& D, ElementalMatrix<F>& S );
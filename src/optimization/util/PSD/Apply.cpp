@@ -0,0 +1,64 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace psd {
+
+// Z_i := (X_i Y_i + Y_i X_i) / 2, which is symmetric when X_i and Y_i are
+
+template<typename Real,typename>
+void Apply
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+        Matrix<Real>& z,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds )
+{
+    DEBUG_CSE
+    const Int height = x.Height();
+    Matrix<Real> zCopy;
+    Zeros( zCopy, height, 1 );
+
+    Matrix<Real> X, Y, Z;
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        X.LockedAttach( order, order, x.LockedBuffer(i,0), order );
+        Y.LockedAttach( order, order, y.LockedBuffer(i,0), order );
+        Z.Attach( order, order, zCopy.Buffer(i,0), order );
+        Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, Y, Real(0), Z );
+        Gemm( NORMAL, NORMAL, Real(1)/Real(2), Y, X, Real(1), Z );
+        i += order*order;
+    }
+    z = zCopy;
+}
+
+#define PROTO(Real) \
+  template void Apply \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
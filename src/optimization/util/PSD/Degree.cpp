@@ -0,0 +1,33 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace psd {
+
+Int Degree( const Matrix<Int>& orders, const Matrix<Int>& firstInds )
+{
+    DEBUG_CSE
+    const Int height = orders.Height();
+    Int degree = 0;
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        degree += order;
+        i += order*order;
+    }
+    return degree;
+}
+
+} // namespace psd
+} // namespace El
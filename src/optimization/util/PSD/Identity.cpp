@@ -0,0 +1,51 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace psd {
+
+template<typename Real,typename>
+void Identity
+(       Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds )
+{
+    DEBUG_CSE
+    const Int height = orders.Height();
+    Zeros( x, height, 1 );
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        for( Int j=0; j<order; ++j )
+            x(i+j*(order+1)) = 1;
+        i += order*order;
+    }
+}
+
+#define PROTO(Real) \
+  template void Identity \
+  (       Matrix<Real>& x, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
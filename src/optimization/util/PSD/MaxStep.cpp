@@ -0,0 +1,74 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace psd {
+
+// Given a positive-definite X = L L^T, X + alpha Y is positive semi-definite
+// if and only if I + alpha inv(L) Y inv(L)^T is, and so the maximum step is
+// -1 / lambda_min(inv(L) Y inv(L)^T) when said eigenvalue is negative and
+// unbounded otherwise.
+
+template<typename Real,typename>
+Real MaxStep
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real upperBound )
+{
+    DEBUG_CSE
+    const Int height = x.Height();
+    Real alpha = upperBound;
+
+    Matrix<Real> XView, YView, L, M, w;
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        XView.LockedAttach( order, order, x.LockedBuffer(i,0), order );
+        YView.LockedAttach( order, order, y.LockedBuffer(i,0), order );
+        L = XView;
+        M = YView;
+        Cholesky( LOWER, L );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), L, M );
+        Trsm( RIGHT, LOWER, TRANSPOSE, NON_UNIT, Real(1), L, M );
+        HermitianEig( LOWER, M, w );
+        Real minEig = limits::Max<Real>();
+        for( Int j=0; j<order; ++j )
+            minEig = Min( minEig, w(j) );
+        if( minEig < Real(0) )
+            alpha = Min( alpha, -1/minEig );
+        i += order*order;
+    }
+    return alpha;
+}
+
+#define PROTO(Real) \
+  template Real MaxStep \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& y, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    Real upperBound );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
@@ -0,0 +1,89 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace psd {
+
+// See Section 4.3 of
+// http://www.seas.ucla.edu/~vandenbe/publications/coneprog.pdf
+//
+// With S = L_s L_s^T, Z = L_z L_z^T, and L_z^T L_s = U Lambda V^T, the
+// factor R = L_s V inv(sqrt(Lambda)) satisfies
+//
+//   R^T Z R = inv(R) S inv(R)^T = Lambda,
+//
+// and so W = R R^T is the Nesterov-Todd scaling point, W Z W = S.
+
+template<typename Real,typename>
+void NesterovTodd
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+        Matrix<Real>& r,
+        Matrix<Real>& lambda,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds )
+{
+    DEBUG_CSE
+    const Int height = s.Height();
+    Zeros( r, height, 1 );
+    Zeros( lambda, height, 1 );
+
+    Matrix<Real> SView, ZView, LS, LZ, M, U, V, sigma, R;
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        SView.LockedAttach( order, order, s.LockedBuffer(i,0), order );
+        ZView.LockedAttach( order, order, z.LockedBuffer(i,0), order );
+        LS = SView;
+        LZ = ZView;
+        Cholesky( LOWER, LS );
+        Cholesky( LOWER, LZ );
+        MakeTrapezoidal( LOWER, LS );
+        MakeTrapezoidal( LOWER, LZ );
+
+        Gemm( TRANSPOSE, NORMAL, Real(1), LZ, LS, M );
+        SVD( M, U, sigma, V );
+
+        R.Attach( order, order, r.Buffer(i,0), order );
+        Gemm( NORMAL, NORMAL, Real(1), LS, V, Real(0), R );
+        for( Int j=0; j<order; ++j )
+        {
+            const Real sigmaJ = sigma(j);
+            auto rj = R( ALL, IR(j) );
+            rj *= 1/Sqrt(sigmaJ);
+            lambda(i+j*(order+1)) = sigmaJ;
+        }
+        i += order*order;
+    }
+}
+
+#define PROTO(Real) \
+  template void NesterovTodd \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& r, \
+          Matrix<Real>& lambda, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
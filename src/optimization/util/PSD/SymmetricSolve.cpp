@@ -0,0 +1,65 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace psd {
+
+// Since Lambda_i is diagonal, the Lyapunov equation
+//
+//   (Lambda_i X_i + X_i Lambda_i) / 2 = B_i
+//
+// decouples into (X_i)_{jk} = 2 (B_i)_{jk} / (lambda_j + lambda_k).
+
+template<typename Real,typename>
+void SymmetricSolve
+( const Matrix<Real>& lambda,
+        Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds )
+{
+    DEBUG_CSE
+    const Int height = x.Height();
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        for( Int k=0; k<order; ++k )
+        {
+            const Real lambdaK = lambda(i+k*(order+1));
+            for( Int j=0; j<order; ++j )
+            {
+                const Real lambdaJ = lambda(i+j*(order+1));
+                x(i+j+k*order) *= 2/(lambdaJ+lambdaK);
+            }
+        }
+        i += order*order;
+    }
+}
+
+#define PROTO(Real) \
+  template void SymmetricSolve \
+  ( const Matrix<Real>& lambda, \
+          Matrix<Real>& x, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace psd
+} // namespace El
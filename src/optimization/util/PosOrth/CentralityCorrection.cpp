@@ -0,0 +1,179 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+// See J. Gondzio, "Multiple centrality corrections in a primal-dual method
+// for linear programming", Computational Optimization and Applications,
+// Vol. 6, pp. 137--156, 1996.
+
+namespace {
+
+template<typename Real>
+Real Correction
+( Real s, Real ds, Real z, Real dz,
+  Real alphaPri, Real alphaDual, Real lower, Real upper )
+{
+    const Real prod = (s+alphaPri*ds)*(z+alphaDual*dz);
+    if( prod < lower )
+        return lower - prod;
+    else if( prod > upper )
+        return Max( upper-prod, -upper );
+    else
+        return Real(0);
+}
+
+} // anonymous namespace
+
+template<typename Real,typename>
+void CentralityCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real beta,
+        Matrix<Real>& rmu )
+{
+    DEBUG_CSE
+    const Int k = s.Height();
+    const Real lower = target/beta;
+    const Real upper = target*beta;
+    const Real* sBuf = s.LockedBuffer();
+    const Real* dsBuf = ds.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+    const Real* dzBuf = dz.LockedBuffer();
+    Real* rmuBuf = rmu.Buffer();
+    for( Int i=0; i<k; ++i )
+        rmuBuf[i] -=
+          Correction
+          ( sBuf[i], dsBuf[i], zBuf[i], dzBuf[i],
+            alphaPri, alphaDual, lower, upper );
+}
+
+template<typename Real,typename>
+void CentralityCorrection
+( const ElementalMatrix<Real>& sPre,
+  const ElementalMatrix<Real>& dsPre,
+  const ElementalMatrix<Real>& zPre,
+  const ElementalMatrix<Real>& dzPre,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real beta,
+        ElementalMatrix<Real>& rmuPre )
+{
+    DEBUG_CSE
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      dsProx( dsPre, ctrl ),
+      zProx( zPre, ctrl ),
+      dzProx( dzPre, ctrl );
+    DistMatrixReadWriteProxy<Real,Real,VC,STAR>
+      rmuProx( rmuPre, ctrl );
+    auto& s = sProx.GetLocked();
+    auto& ds = dsProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+    auto& rmu = rmuProx.Get();
+
+    const Int localHeight = s.LocalHeight();
+    const Real lower = target/beta;
+    const Real upper = target*beta;
+    const Real* sBuf = s.LockedBuffer();
+    const Real* dsBuf = ds.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+    const Real* dzBuf = dz.LockedBuffer();
+    Real* rmuBuf = rmu.Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rmuBuf[iLoc] -=
+          Correction
+          ( sBuf[iLoc], dsBuf[iLoc], zBuf[iLoc], dzBuf[iLoc],
+            alphaPri, alphaDual, lower, upper );
+}
+
+template<typename Real,typename>
+void CentralityCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real target,
+  Real beta,
+        DistMultiVec<Real>& rmu )
+{
+    DEBUG_CSE
+    const Int localHeight = s.LocalHeight();
+    const Real lower = target/beta;
+    const Real upper = target*beta;
+    const Real* sBuf = s.LockedMatrix().LockedBuffer();
+    const Real* dsBuf = ds.LockedMatrix().LockedBuffer();
+    const Real* zBuf = z.LockedMatrix().LockedBuffer();
+    const Real* dzBuf = dz.LockedMatrix().LockedBuffer();
+    Real* rmuBuf = rmu.Matrix().Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rmuBuf[iLoc] -=
+          Correction
+          ( sBuf[iLoc], dsBuf[iLoc], zBuf[iLoc], dzBuf[iLoc],
+            alphaPri, alphaDual, lower, upper );
+}
+
+#define PROTO(Real) \
+  template void CentralityCorrection \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& dz, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real target, \
+    Real beta, \
+          Matrix<Real>& rmu ); \
+  template void CentralityCorrection \
+  ( const ElementalMatrix<Real>& s, \
+    const ElementalMatrix<Real>& ds, \
+    const ElementalMatrix<Real>& z, \
+    const ElementalMatrix<Real>& dz, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real target, \
+    Real beta, \
+          ElementalMatrix<Real>& rmu ); \
+  template void CentralityCorrection \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& dz, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real target, \
+    Real beta, \
+          DistMultiVec<Real>& rmu );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
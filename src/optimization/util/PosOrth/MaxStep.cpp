@@ -90,6 +90,102 @@ Real MaxStep
     return mpi::AllReduce( alpha, mpi::MIN, s.Comm() );
 }
 
+namespace max_step {
+
+template<typename Real>
+Real LocalMaxStep
+( Int kLocal, const Real* sBuf, const Real* dsBuf, Real upperBound )
+{
+    Real alpha = upperBound;
+    for( Int iLoc=0; iLoc<kLocal; ++iLoc )
+    {
+        const Real si = sBuf[iLoc];
+        const Real dsi = dsBuf[iLoc];
+        if( dsi < Real(0) )
+            alpha = Min(alpha,-si/dsi);
+    }
+    return alpha;
+}
+
+} // namespace max_step
+
+template<typename Real,typename>
+pair<Real,Real> MaxSteps
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  Real upperBound )
+{
+    DEBUG_CSE
+    return std::make_pair
+      ( MaxStep( s, ds, upperBound ), MaxStep( z, dz, upperBound ) );
+}
+
+template<typename Real,typename>
+pair<Real,Real> MaxSteps
+( const ElementalMatrix<Real>& sPre,
+  const ElementalMatrix<Real>& dsPre,
+  const ElementalMatrix<Real>& zPre,
+  const ElementalMatrix<Real>& dzPre,
+  Real upperBound )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> sProx( sPre ), zProx( zPre );
+    auto& s = sProx.GetLocked();
+    auto& z = zProx.GetLocked();
+
+    ElementalProxyCtrl sCtrl, zCtrl;
+    sCtrl.colConstrain = zCtrl.colConstrain = true;
+    sCtrl.rowConstrain = zCtrl.rowConstrain = true;
+    sCtrl.colAlign = s.ColAlign();
+    sCtrl.rowAlign = s.RowAlign();
+    zCtrl.colAlign = z.ColAlign();
+    zCtrl.rowAlign = z.RowAlign();
+
+    DistMatrixReadProxy<Real,Real,MC,MR>
+      dsProx( dsPre, sCtrl ),
+      dzProx( dzPre, zCtrl );
+    auto& ds = dsProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+
+    Real alphas[2] = { upperBound, upperBound };
+    if( s.IsLocalCol(0) )
+        alphas[0] =
+          max_step::LocalMaxStep
+          ( s.LocalHeight(), s.LockedBuffer(), ds.LockedBuffer(), upperBound );
+    if( z.IsLocalCol(0) )
+        alphas[1] =
+          max_step::LocalMaxStep
+          ( z.LocalHeight(), z.LockedBuffer(), dz.LockedBuffer(), upperBound );
+    mpi::AllReduce( alphas, 2, mpi::MIN, s.DistComm() );
+    return std::make_pair( alphas[0], alphas[1] );
+}
+
+template<typename Real,typename>
+pair<Real,Real> MaxSteps
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+  Real upperBound )
+{
+    DEBUG_CSE
+    Real alphas[2];
+    alphas[0] =
+      max_step::LocalMaxStep
+      ( s.LocalHeight(),
+        s.LockedMatrix().LockedBuffer(),
+        ds.LockedMatrix().LockedBuffer(), upperBound );
+    alphas[1] =
+      max_step::LocalMaxStep
+      ( z.LocalHeight(),
+        z.LockedMatrix().LockedBuffer(),
+        dz.LockedMatrix().LockedBuffer(), upperBound );
+    mpi::AllReduce( alphas, 2, mpi::MIN, s.Comm() );
+    return std::make_pair( alphas[0], alphas[1] );
+}
+
 #define PROTO(Real) \
   template Real MaxStep \
   ( const Matrix<Real>& s, \
@@ -102,6 +198,24 @@ Real MaxStep
   template Real MaxStep \
   ( const DistMultiVec<Real>& s, \
     const DistMultiVec<Real>& ds, \
+    Real upperBound ); \
+  template pair<Real,Real> MaxSteps \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& dz, \
+    Real upperBound ); \
+  template pair<Real,Real> MaxSteps \
+  ( const ElementalMatrix<Real>& s, \
+    const ElementalMatrix<Real>& ds, \
+    const ElementalMatrix<Real>& z, \
+    const ElementalMatrix<Real>& dz, \
+    Real upperBound ); \
+  template pair<Real,Real> MaxSteps \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& dz, \
     Real upperBound );
 
 #define EL_NO_INT_PROTO
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+// The solution of a nearby problem is (nearly) complementary, and so at least
+// one member of each pair (s_i,z_i) typically lies on the boundary of the
+// positive orthant. Restarting an Interior Point Method from such a point
+// stalls, so each entry is first shifted into the interior and the pairs
+// which are then far below the central path are scaled up to it.
+
+template<typename Real,typename>
+void WarmStart
+( Matrix<Real>& s,
+  Matrix<Real>& z,
+  Real shift,
+  Real centrality )
+{
+    DEBUG_CSE
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Real maxNorm = Max(Max(MaxNorm(s),MaxNorm(z)),Real(1));
+    LowerClip( s, shift*maxNorm );
+    LowerClip( z, shift*maxNorm );
+
+    const Real minProd = centrality*Dot(s,z)/k;
+    Real* sBuf = s.Buffer();
+    Real* zBuf = z.Buffer();
+    for( Int i=0; i<k; ++i )
+    {
+        const Real prod = sBuf[i]*zBuf[i];
+        if( prod < minProd )
+        {
+            const Real scale = Sqrt(minProd/prod);
+            sBuf[i] *= scale;
+            zBuf[i] *= scale;
+        }
+    }
+}
+
+template<typename Real,typename>
+void WarmStart
+( ElementalMatrix<Real>& sPre,
+  ElementalMatrix<Real>& zPre,
+  Real shift,
+  Real centrality )
+{
+    DEBUG_CSE
+    AssertSameGrids( sPre, zPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadWriteProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      zProx( zPre, ctrl );
+    auto& s = sProx.Get();
+    auto& z = zProx.Get();
+
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Real maxNorm = Max(Max(MaxNorm(s),MaxNorm(z)),Real(1));
+    LowerClip( s, shift*maxNorm );
+    LowerClip( z, shift*maxNorm );
+
+    const Real minProd = centrality*Dot(s,z)/k;
+    const Int localHeight = s.LocalHeight();
+    Real* sBuf = s.Buffer();
+    Real* zBuf = z.Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real prod = sBuf[iLoc]*zBuf[iLoc];
+        if( prod < minProd )
+        {
+            const Real scale = Sqrt(minProd/prod);
+            sBuf[iLoc] *= scale;
+            zBuf[iLoc] *= scale;
+        }
+    }
+}
+
+template<typename Real,typename>
+void WarmStart
+( DistMultiVec<Real>& s,
+  DistMultiVec<Real>& z,
+  Real shift,
+  Real centrality )
+{
+    DEBUG_CSE
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Real maxNorm = Max(Max(MaxNorm(s),MaxNorm(z)),Real(1));
+    LowerClip( s, shift*maxNorm );
+    LowerClip( z, shift*maxNorm );
+
+    const Real minProd = centrality*Dot(s,z)/k;
+    const Int localHeight = s.LocalHeight();
+    Real* sBuf = s.Matrix().Buffer();
+    Real* zBuf = z.Matrix().Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real prod = sBuf[iLoc]*zBuf[iLoc];
+        if( prod < minProd )
+        {
+            const Real scale = Sqrt(minProd/prod);
+            sBuf[iLoc] *= scale;
+            zBuf[iLoc] *= scale;
+        }
+    }
+}
+
+#define PROTO(Real) \
+  template void WarmStart \
+  ( Matrix<Real>& s, \
+    Matrix<Real>& z, \
+    Real shift, \
+    Real centrality ); \
+  template void WarmStart \
+  ( ElementalMatrix<Real>& s, \
+    ElementalMatrix<Real>& z, \
+    Real shift, \
+    Real centrality ); \
+  template void WarmStart \
+  ( DistMultiVec<Real>& s, \
+    DistMultiVec<Real>& z, \
+    Real shift, \
+    Real centrality );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Kernels.hpp"
 
 namespace El {
 namespace soc {
@@ -22,16 +23,22 @@ void Apply
   const Matrix<Int>& firstInds )
 {
     DEBUG_CSE
-    soc::Dots( x, y, z, orders, firstInds );
-    auto xRoots = x;
-    auto yRoots = y;
-    cone::Broadcast( xRoots, orders, firstInds );
-    cone::Broadcast( yRoots, orders, firstInds );
-
     const Int height = x.Height();
-    for( Int i=0; i<height; ++i )
-        if( i != firstInds(i) )
-            z(i) += xRoots(i)*y(i) + yRoots(i)*x(i);
+    z.Resize( height, 1 );
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        const Real x0 = x(i);
+        const Real y0 = y(i);
+        z(i) = x0*y0 + kernel::TailDot( order, &x(i), &y(i) );
+        for( Int j=i+1; j<i+order; ++j )
+            z(j) = x0*y(j) + y0*x(j);
+        i += order;
+    }
 }
 
 template<typename Real,typename>
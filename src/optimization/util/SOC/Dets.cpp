@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Kernels.hpp"
 
 namespace El {
 namespace soc {
@@ -19,9 +20,18 @@ void Dets
   const Matrix<Int>& firstInds )
 {
     DEBUG_CSE
-    auto Rx = x;
-    soc::Reflect( Rx, orders, firstInds );
-    soc::Dots( x, Rx, d, orders, firstInds );
+    const Int height = x.Height();
+    Zeros( d, height, 1 );
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        d(i) = x(i)*x(i) - kernel::TailDot( order, &x(i), &x(i) );
+        i += order;
+    }
 }
 
 template<typename Real,typename>
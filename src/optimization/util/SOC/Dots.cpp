@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Kernels.hpp"
 
 namespace El {
 namespace soc {
@@ -38,15 +39,14 @@ void Dots
     for( Int i=0; i<height; )
     {
         const Int order = orders(i);
-        const Int firstInd = firstInds(i);
         DEBUG_ONLY(
-          if( i != firstInd )
+          if( i != firstInds(i) )
               LogicError("Inconsistency in orders and firstInds");
         )
 
-        // Compute the inner-product between two SOC members and broadcast
-        // the result over an equivalently-sized z_i
-        z(i) = blas::Dot( order, &x(i), 1, &y(i), 1 );
+        // Compute the inner-product between two SOC members and store the
+        // result in the root of z_i
+        z(i) = x(i)*y(i) + kernel::TailDot( order, &x(i), &y(i) );
         i += order;
     }
 }
@@ -82,8 +82,8 @@ void Dots
     auto& orders = ordersProx.GetLocked();
     auto& firstInds = firstIndsProx.GetLocked();
 
-    const Int height = x.Height();
     DEBUG_ONLY(
+      const Int height = x.Height();
       if( x.Width() != 1 || orders.Width() != 1 || firstInds.Width() != 1 ) 
           LogicError("x, orders, and firstInds should be column vectors");
       if( orders.Height() != height || firstInds.Height() != height )
@@ -194,8 +194,8 @@ void Dots
     const Int localHeight = x.LocalHeight();
     const Int firstLocalRow = x.FirstLocalRow();
 
-    const Int height = x.Height();
     DEBUG_ONLY(
+      const Int height = x.Height();
       if( x.Width() != 1 || orders.Width() != 1 || firstInds.Width() != 1 ) 
           LogicError("x, orders, and firstInds should be column vectors");
       if( orders.Height() != height || firstInds.Height() != height )
@@ -0,0 +1,58 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace soc {
+namespace kernel {
+
+// Per-cone kernels for the sequential SOC utilities. Since the members of
+// each cone are stored contiguously, a single sweep over the cone roots
+// (stepping by the order of each cone) visits every cone exactly once, and
+// all of the reductions needed for a cone can be formed while its entries
+// are in cache rather than with separate passes and root broadcasts.
+//
+// Products of many small cones (e.g., of order three) are common, and so the
+// inner products are dispatched to kernels with a compile-time order which
+// the compiler can fully unroll.
+
+template<Int order,typename Real,typename PReal=Real>
+inline PReal TailDot( const Real* x, const Real* y )
+{
+    PReal sum = 0;
+    for( Int j=1; j<order; ++j )
+        sum += PReal(x[j])*PReal(y[j]);
+    return sum;
+}
+
+// Return x_1^T y_1 for a single cone with members x = (x_0,x_1) and
+// y = (y_0,y_1)
+template<typename Real,typename PReal=Real>
+inline PReal TailDot( Int order, const Real* x, const Real* y )
+{
+    switch( order )
+    {
+    case 1: return PReal(0);
+    case 2: return TailDot<2,Real,PReal>( x, y );
+    case 3: return TailDot<3,Real,PReal>( x, y );
+    case 4: return TailDot<4,Real,PReal>( x, y );
+    case 5: return TailDot<5,Real,PReal>( x, y );
+    default:
+    {
+        PReal sum = 0;
+        for( Int j=1; j<order; ++j )
+            sum += PReal(x[j])*PReal(y[j]);
+        return sum;
+    }
+    }
+}
+
+} // namespace kernel
+} // namespace soc
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Kernels.hpp"
 
 namespace El {
 namespace soc {
@@ -169,41 +170,28 @@ Real MaxStep
     typedef Promote<Real> PReal;
     const Int height = x.Height();
 
-    Matrix<PReal> xProm, yProm;
-    Copy( x, xProm );
-    Copy( y, yProm );
-
-    Matrix<PReal> xDets, yDets, xTRys, maxSteps;
-    soc::Dets( xProm, xDets, orders, firstInds );
-    soc::Dets( yProm, yDets, orders, firstInds );
-
-    auto Ry = yProm;
-    soc::Reflect( Ry, orders, firstInds );
-    soc::Dots( xProm, Ry, xTRys, orders, firstInds );
-
     const Int* orderBuf = orders.LockedBuffer();
-    const Int* firstIndBuf = firstInds.LockedBuffer();
-    const PReal* xBuf = xProm.LockedBuffer();
-    const PReal* yBuf = yProm.LockedBuffer();
-    const PReal* xDetBuf = xDets.LockedBuffer();
-    const PReal* yDetBuf = yDets.LockedBuffer();
-    const PReal* xTRyBuf = xTRys.LockedBuffer();
+    const Real* xBuf = x.LockedBuffer();
+    const Real* yBuf = y.LockedBuffer();
 
+    // Form det(x), det(y), and x^T R y with a single sweep over each cone
     PReal alpha = upperBound;
     for( Int i=0; i<height; )
     {
         const Int order = orderBuf[i];
-        const Int firstInd = firstIndBuf[i];
         DEBUG_ONLY(
-          if( i != firstInd )
+          if( i != firstInds(i) )
               LogicError("Inconsistency in orders and firstInds");
         )
 
         const PReal x0 = xBuf[i];
         const PReal y0 = yBuf[i];
-        const PReal xDet = xDetBuf[i];
-        const PReal yDet = yDetBuf[i];
-        const PReal xTRy = xTRyBuf[i];
+        const PReal xDet =
+          x0*x0 - kernel::TailDot<Real,PReal>( order, &xBuf[i], &xBuf[i] );
+        const PReal yDet =
+          y0*y0 - kernel::TailDot<Real,PReal>( order, &yBuf[i], &yBuf[i] );
+        const PReal xTRy =
+          x0*y0 - kernel::TailDot<Real,PReal>( order, &xBuf[i], &yBuf[i] );
 
         alpha = ChooseStepLength(x0,y0,xDet,yDet,xTRy,alpha);
 
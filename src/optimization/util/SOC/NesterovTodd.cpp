@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Kernels.hpp"
 
 namespace El {
 namespace soc {
@@ -149,6 +150,11 @@ void ClassicalNT
 
 // See Section 4.2 of 
 // http://www.seas.ucla.edu/~vandenbe/publications/coneprog.pdf
+//
+// In the sequential case, the Jordan determinants, the 'gamma' coefficient,
+// and the scaling point of each cone are all formed in a single sweep over
+// the cone rather than with separate calls to soc::Dets, soc::Dots, and
+// cone::Broadcast.
 
 template<typename Real,typename=EnableIf<IsReal<Real>>>
 void VandenbergheNT
@@ -161,52 +167,50 @@ void VandenbergheNT
     DEBUG_CSE
     typedef Promote<Real> PReal;
     const Int n = s.Height();
+    w.Resize( n, 1 );
 
-    // Promote the floating-point precision
-    // ====================================
-    Matrix<PReal> sProm, zProm;
-    Copy( s, sProm );
-    Copy( z, zProm );
-
-    // Normalize with respect to the Jordan determinant
-    // ================================================
-    Matrix<PReal> sDets, zDets;
-    soc::Dets( sProm, sDets, orders, firstInds );
-    soc::Dets( zProm, zDets, orders, firstInds );
-    cone::Broadcast( sDets, orders, firstInds );
-    cone::Broadcast( zDets, orders, firstInds );
-    for( Int i=0; i<n; ++i )
-    {
-        sProm(i) /= Sqrt(sDets(i));
-        zProm(i) /= Sqrt(zDets(i));
-    }
-
-    // Compute the 'gamma' coefficients
-    // ================================
-    Matrix<PReal> gammas;
-    soc::Dots( zProm, sProm, gammas, orders, firstInds );
-    cone::Broadcast( gammas, orders, firstInds );
-    for( Int i=0; i<n; ++i )
-        gammas(i) = Sqrt((PReal(1)+gammas(i))/PReal(2));
-
-    // Compute the normalized scaling point
-    // ====================================
-    auto wProm = zProm;
-    soc::Reflect( wProm, orders, firstInds );
-    wProm += sProm;
-    DiagonalSolve( LEFT, NORMAL, gammas, wProm );
-    wProm *= PReal(1)/PReal(2);
-
-    // Rescale the scaling point
-    // =========================
-    for( Int i=0; i<n; ++i )
+    const Real* sBuf = s.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+          Real* wBuf = w.Buffer();
+    const Int* orderBuf = orders.LockedBuffer();
+    for( Int i=0; i<n; )
     {
-        const PReal sDet = sDets(i);
-        const PReal zDet = zDets(i);
-        const PReal scale = Pow(sDet,PReal(0.25))/Pow(zDet,PReal(0.25));
-        wProm(i) *= scale;
+        const Int order = orderBuf[i];
+        DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        const Real* sCone = &sBuf[i];
+        const Real* zCone = &zBuf[i];
+        const PReal s0 = sCone[0];
+        const PReal z0 = zCone[0];
+
+        // Normalize with respect to the Jordan determinant
+        // ================================================
+        const PReal sDet =
+          s0*s0 - kernel::TailDot<Real,PReal>( order, sCone, sCone );
+        const PReal zDet =
+          z0*z0 - kernel::TailDot<Real,PReal>( order, zCone, zCone );
+        const PReal sScale = PReal(1)/Sqrt(sDet);
+        const PReal zScale = PReal(1)/Sqrt(zDet);
+
+        // Compute the 'gamma' coefficient
+        // ===============================
+        const PReal szDot =
+          s0*z0 + kernel::TailDot<Real,PReal>( order, sCone, zCone );
+        const PReal gamma = Sqrt((PReal(1)+szDot*sScale*zScale)/PReal(2));
+
+        // Form the rescaled, normalized scaling point
+        // ===========================================
+        const PReal scale =
+          Pow(sDet,PReal(0.25))/Pow(zDet,PReal(0.25)) / (2*gamma);
+        wBuf[i] = Real((s0*sScale + z0*zScale)*scale);
+        for( Int j=1; j<order; ++j )
+            wBuf[i+j] =
+              Real((PReal(sCone[j])*sScale - PReal(zCone[j])*zScale)*scale);
+
+        i += order;
     }
-    Copy( wProm, w );
 }
 
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace soc {
+
+// The projection of (x0,x1) onto the SOC is (x0,x1) if || x1 ||_2 <= x0,
+// zero if || x1 ||_2 <= -x0, and otherwise
+//
+//   ((x0+|| x1 ||_2)/2) (1, x1/|| x1 ||_2).
+//
+// The root of each cone is updated in place while the scaling of the
+// remainder of the cone is broadcast from the root.
+
+template<typename Real,typename>
+void Project
+(       Matrix<Real>& x,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds )
+{
+    DEBUG_CSE
+    Matrix<Real> d;
+    soc::LowerNorms( x, d, orders, firstInds );
+
+    const Int height = x.Height();
+    Matrix<Real> scales;
+    Zeros( scales, height, 1 );
+    for( Int i=0; i<height; ++i )
+    {
+        if( i != firstInds(i) )
+            continue;
+        Real& x0 = x(i);
+        const Real lowerNorm = d(i);
+        if( lowerNorm <= x0 )
+            scales(i) = 1;
+        else if( lowerNorm <= -x0 )
+            x0 = 0;
+        else
+        {
+            scales(i) = (x0+lowerNorm)/(2*lowerNorm);
+            x0 = (x0+lowerNorm)/2;
+        }
+    }
+    cone::Broadcast( scales, orders, firstInds );
+    for( Int i=0; i<height; ++i )
+        if( i != firstInds(i) )
+            x(i) *= scales(i);
+}
+
+template<typename Real,typename>
+void Project
+(       ElementalMatrix<Real>& xPre,
+  const ElementalMatrix<Int>& ordersPre,
+  const ElementalMatrix<Int>& firstIndsPre,
+  Int cutoff )
+{
+    DEBUG_CSE
+    AssertSameGrids( xPre, ordersPre, firstIndsPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadWriteProxy<Real,Real,VC,STAR>
+      xProx( xPre, ctrl );
+    DistMatrixReadProxy<Int,Int,VC,STAR>
+      ordersProx( ordersPre, ctrl ),
+      firstIndsProx( firstIndsPre, ctrl );
+    auto& x = xProx.Get();
+    auto& orders = ordersProx.GetLocked();
+    auto& firstInds = firstIndsProx.GetLocked();
+
+    DistMatrix<Real,VC,STAR> d(x.Grid());
+    soc::LowerNorms( x, d, orders, firstInds, cutoff );
+
+    DistMatrix<Real,VC,STAR> scales(x.Grid());
+    Zeros( scales, x.Height(), 1 );
+    const Int localHeight = x.LocalHeight();
+    auto& xLoc = x.Matrix();
+    auto& dLoc = d.LockedMatrix();
+    auto& scalesLoc = scales.Matrix();
+    auto& firstIndsLoc = firstInds.LockedMatrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        if( x.GlobalRow(iLoc) != firstIndsLoc(iLoc) )
+            continue;
+        Real& x0 = xLoc(iLoc);
+        const Real lowerNorm = dLoc(iLoc);
+        if( lowerNorm <= x0 )
+            scalesLoc(iLoc) = 1;
+        else if( lowerNorm <= -x0 )
+            x0 = 0;
+        else
+        {
+            scalesLoc(iLoc) = (x0+lowerNorm)/(2*lowerNorm);
+            x0 = (x0+lowerNorm)/2;
+        }
+    }
+    cone::Broadcast( scales, orders, firstInds, cutoff );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( x.GlobalRow(iLoc) != firstIndsLoc(iLoc) )
+            xLoc(iLoc) *= scalesLoc(iLoc);
+}
+
+template<typename Real,typename>
+void Project
+(       DistMultiVec<Real>& x,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    DEBUG_CSE
+    DistMultiVec<Real> d(x.Comm());
+    soc::LowerNorms( x, d, orders, firstInds, cutoff );
+
+    DistMultiVec<Real> scales(x.Comm());
+    Zeros( scales, x.Height(), 1 );
+    const Int localHeight = x.LocalHeight();
+    auto& xLoc = x.Matrix();
+    auto& dLoc = d.LockedMatrix();
+    auto& scalesLoc = scales.Matrix();
+    auto& firstIndsLoc = firstInds.LockedMatrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        if( x.GlobalRow(iLoc) != firstIndsLoc(iLoc) )
+            continue;
+        Real& x0 = xLoc(iLoc);
+        const Real lowerNorm = dLoc(iLoc);
+        if( lowerNorm <= x0 )
+            scalesLoc(iLoc) = 1;
+        else if( lowerNorm <= -x0 )
+            x0 = 0;
+        else
+        {
+            scalesLoc(iLoc) = (x0+lowerNorm)/(2*lowerNorm);
+            x0 = (x0+lowerNorm)/2;
+        }
+    }
+    cone::Broadcast( scales, orders, firstInds, cutoff );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( x.GlobalRow(iLoc) != firstIndsLoc(iLoc) )
+            xLoc(iLoc) *= scalesLoc(iLoc);
+}
+
+#define PROTO(Real) \
+  template void Project \
+  (       Matrix<Real>& x, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds ); \
+  template void Project \
+  (       ElementalMatrix<Real>& x, \
+    const ElementalMatrix<Int>& orders, \
+    const ElementalMatrix<Int>& firstInds, \
+    Int cutoff ); \
+  template void Project \
+  (       DistMultiVec<Real>& x, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace soc
+} // namespace El
@@ -0,0 +1,182 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace soc {
+
+// Since scaling a member of a second-order cone keeps it within the cone,
+// the centrality correction scales both members of each offending pair by
+// the same factor, which is broadcast from the root of each cone.
+
+template<typename Real,typename>
+void WarmStart
+(       Matrix<Real>& s,
+        Matrix<Real>& z,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real shift,
+  Real centrality )
+{
+    DEBUG_CSE
+    const Int height = s.Height();
+    if( height == 0 )
+        return;
+    const Real minEig = shift*Max(Max(MaxNorm(s),MaxNorm(z)),Real(1));
+    const Real sMinEig = soc::MinEig( s, orders, firstInds );
+    if( sMinEig < minEig )
+        soc::Shift( s, minEig-sMinEig, orders, firstInds );
+    const Real zMinEig = soc::MinEig( z, orders, firstInds );
+    if( zMinEig < minEig )
+        soc::Shift( z, minEig-zMinEig, orders, firstInds );
+
+    const Int degree = soc::Degree( firstInds );
+    const Real minDot = centrality*Dot(s,z)/degree;
+    Matrix<Real> scales;
+    soc::Dots( s, z, scales, orders, firstInds );
+    for( Int i=0; i<height; ++i )
+        if( i == firstInds(i) )
+            scales(i) =
+              ( scales(i) < minDot ? Sqrt(minDot/scales(i)) : Real(1) );
+    cone::Broadcast( scales, orders, firstInds );
+    DiagonalScale( LEFT, NORMAL, scales, s );
+    DiagonalScale( LEFT, NORMAL, scales, z );
+}
+
+template<typename Real,typename>
+void WarmStart
+(       ElementalMatrix<Real>& sPre,
+        ElementalMatrix<Real>& zPre,
+  const ElementalMatrix<Int>& ordersPre,
+  const ElementalMatrix<Int>& firstIndsPre,
+  Real shift,
+  Real centrality,
+  Int cutoff )
+{
+    DEBUG_CSE
+    AssertSameGrids( sPre, zPre, ordersPre, firstIndsPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadWriteProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      zProx( zPre, ctrl );
+    DistMatrixReadProxy<Int,Int,VC,STAR>
+      ordersProx( ordersPre, ctrl ),
+      firstIndsProx( firstIndsPre, ctrl );
+    auto& s = sProx.Get();
+    auto& z = zProx.Get();
+    auto& orders = ordersProx.GetLocked();
+    auto& firstInds = firstIndsProx.GetLocked();
+
+    const Int height = s.Height();
+    if( height == 0 )
+        return;
+    const Real minEig = shift*Max(Max(MaxNorm(s),MaxNorm(z)),Real(1));
+    const Real sMinEig = soc::MinEig( s, orders, firstInds, cutoff );
+    if( sMinEig < minEig )
+        soc::Shift( s, minEig-sMinEig, orders, firstInds );
+    const Real zMinEig = soc::MinEig( z, orders, firstInds, cutoff );
+    if( zMinEig < minEig )
+        soc::Shift( z, minEig-zMinEig, orders, firstInds );
+
+    const Int degree = soc::Degree( firstInds );
+    const Real minDot = centrality*Dot(s,z)/degree;
+    DistMatrix<Real,VC,STAR> scales(s.Grid());
+    soc::Dots( s, z, scales, orders, firstInds, cutoff );
+    const Int localHeight = scales.LocalHeight();
+    Real* scaleBuf = scales.Buffer();
+    const Int* firstIndBuf = firstInds.LockedBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( scales.GlobalRow(iLoc) == firstIndBuf[iLoc] )
+            scaleBuf[iLoc] =
+              ( scaleBuf[iLoc] < minDot ?
+                Sqrt(minDot/scaleBuf[iLoc]) : Real(1) );
+    cone::Broadcast( scales, orders, firstInds, cutoff );
+    DiagonalScale( LEFT, NORMAL, scales, s );
+    DiagonalScale( LEFT, NORMAL, scales, z );
+}
+
+template<typename Real,typename>
+void WarmStart
+(       DistMultiVec<Real>& s,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real shift,
+  Real centrality,
+  Int cutoff )
+{
+    DEBUG_CSE
+    const Int height = s.Height();
+    if( height == 0 )
+        return;
+    const Real minEig = shift*Max(Max(MaxNorm(s),MaxNorm(z)),Real(1));
+    const Real sMinEig = soc::MinEig( s, orders, firstInds, cutoff );
+    if( sMinEig < minEig )
+        soc::Shift( s, minEig-sMinEig, orders, firstInds );
+    const Real zMinEig = soc::MinEig( z, orders, firstInds, cutoff );
+    if( zMinEig < minEig )
+        soc::Shift( z, minEig-zMinEig, orders, firstInds );
+
+    const Int degree = soc::Degree( firstInds );
+    const Real minDot = centrality*Dot(s,z)/degree;
+    DistMultiVec<Real> scales(s.Comm());
+    soc::Dots( s, z, scales, orders, firstInds, cutoff );
+    const Int firstLocalRow = scales.FirstLocalRow();
+    const Int localHeight = scales.LocalHeight();
+    Real* scaleBuf = scales.Matrix().Buffer();
+    const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( iLoc+firstLocalRow == firstIndBuf[iLoc] )
+            scaleBuf[iLoc] =
+              ( scaleBuf[iLoc] < minDot ?
+                Sqrt(minDot/scaleBuf[iLoc]) : Real(1) );
+    cone::Broadcast( scales, orders, firstInds, cutoff );
+    DiagonalScale( LEFT, NORMAL, scales, s );
+    DiagonalScale( LEFT, NORMAL, scales, z );
+}
+
+#define PROTO(Real) \
+  template void WarmStart \
+  (       Matrix<Real>& s, \
+          Matrix<Real>& z, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    Real shift, \
+    Real centrality ); \
+  template void WarmStart \
+  (       ElementalMatrix<Real>& s, \
+          ElementalMatrix<Real>& z, \
+    const ElementalMatrix<Int>& orders, \
+    const ElementalMatrix<Int>& firstInds, \
+    Real shift, \
+    Real centrality, \
+    Int cutoff ); \
+  template void WarmStart \
+  (       DistMultiVec<Real>& s, \
+          DistMultiVec<Real>& z, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Real shift, \
+    Real centrality, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace soc
+} // namespace El
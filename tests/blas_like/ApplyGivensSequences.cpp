@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestSequences
+( LeftOrRight side,
+  ForwardOrBackward direction,
+  Int m,
+  Int n,
+  Int numSeqs,
+  Int blocksize )
+{
+    typedef Base<F> Real;
+    Output
+    ("Testing ",(side==LEFT?"LEFT":"RIGHT")," ",
+     (direction==FORWARD?"FORWARD":"BACKWARD")," with ",TypeName<F>());
+    PushIndent();
+
+    const Int numRots = ( side==LEFT ? m : n ) - 1;
+    Matrix<Real> cList(numRots,numSeqs), sList(numRots,numSeqs);
+    for( Int p=0; p<numSeqs; ++p )
+    {
+        for( Int j=0; j<numRots; ++j )
+        {
+            const Real theta = SampleUniform( Real(0), Real(2)*Pi<Real>() );
+            cList(j,p) = Cos(theta);
+            sList(j,p) = Sin(theta);
+        }
+    }
+    Matrix<F> A, ARef;
+    Uniform( A, m, n );
+    ARef = A;
+
+    Timer timer;
+    timer.Start();
+    Matrix<Real> c, s;
+    for( Int p=0; p<numSeqs; ++p )
+    {
+        LockedView( c, cList, ALL, IR(p) );
+        LockedView( s, sList, ALL, IR(p) );
+        ApplyGivensSequence
+        ( side, VARIABLE_GIVENS_SEQUENCE, direction, c, s, ARef );
+    }
+    Output("Unblocked: ",timer.Stop()," secs");
+    timer.Start();
+    ApplyGivensSequences( side, direction, cList, sList, A, blocksize );
+    Output("Blocked: ",timer.Stop()," secs");
+
+    const Real frobRef = FrobeniusNorm( ARef );
+    A -= ARef;
+    const Real relError = FrobeniusNorm( A ) / frobRef;
+    Output("|| A - ARef ||_F / || ARef ||_F = ",relError);
+    if( relError > Sqrt(limits::Epsilon<Real>()) )
+        LogicError("Unacceptably large relative error");
+
+    // Apply the same sequences through an accumulator (from the right)
+    if( side == RIGHT )
+    {
+        Uniform( A, m, n );
+        ARef = A;
+        GivensSequenceAccumulator<F> accum( A, numSeqs/2+1, blocksize );
+        for( Int p=0; p<numSeqs; ++p )
+        {
+            // Restrict every other sequence to a sub-window
+            const Int offset = ( p % 2 == 0 ? 0 : numRots/4 );
+            const Int numSubRots = numRots - 2*offset;
+            LockedView( c, cList, IR(offset,offset+numSubRots), IR(p) );
+            LockedView( s, sList, IR(offset,offset+numSubRots), IR(p) );
+            accum.Push( direction, offset, c, s );
+            auto ARefSub = ARef( ALL, IR(offset,offset+numSubRots+1) );
+            ApplyGivensSequence
+            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, direction, c, s, ARefSub );
+        }
+        accum.Flush();
+        A -= ARef;
+        const Real accumRelError = FrobeniusNorm( A ) / FrobeniusNorm( ARef );
+        Output("Accumulated relative error: ",accumRelError);
+        if( accumRelError > Sqrt(limits::Epsilon<Real>()) )
+            LogicError("Unacceptably large relative error");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",500);
+        const Int n = Input("--n","width of matrix",300);
+        const Int numSeqs = Input("--numSeqs","number of sequences",20);
+        const Int nb = Input("--nb","blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            for( auto side : {LEFT,RIGHT} )
+            {
+                for( auto direction : {FORWARD,BACKWARD} )
+                {
+                    TestSequences<double>( side, direction, m, n, numSeqs, nb );
+                    TestSequences<Complex<double>>
+                    ( side, direction, m, n, numSeqs, nb );
+                }
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
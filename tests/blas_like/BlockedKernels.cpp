@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares the blocked Gemm, Gemv, and Trsm kernels for the extended
+// precisions against the (naive) reference implementations, which are the
+// explicit instantiations of the blas::Gemm, blas::Gemv, and blas::Trsm
+// templates. The dimensions are chosen so that the register tiles and cache
+// blocks are only partially filled and the Trsm recursion reaches several
+// levels.
+
+template<typename T>
+void CheckError
+( const string& label, const Matrix<T>& X, const Matrix<T>& XRef,
+  Base<T> scale, Base<T> tol )
+{
+    typedef Base<T> Real;
+    Matrix<T> E( X );
+    E -= XRef;
+    const Real relError = FrobeniusNorm( E ) / scale;
+    Output(label,": relative error of ",relError);
+    if( relError > tol )
+        LogicError
+        (label," had an unacceptably large relative error of ",relError);
+}
+
+template<typename T>
+void TestGemm( Int m, Int n, Int k )
+{
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const T alpha( 3 ), beta( -2 );
+    for( const char transA : {'N','T'} )
+    {
+        for( const char transB : {'N','T'} )
+        {
+            Matrix<T> A, B, C, CRef;
+            if( transA == 'N' )
+                Uniform( A, m, k );
+            else
+                Uniform( A, k, m );
+            if( transB == 'N' )
+                Uniform( B, k, n );
+            else
+                Uniform( B, n, k );
+            Uniform( C, m, n );
+            CRef = C;
+
+            blas::Gemm
+            ( transA, transB, m, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     B.LockedBuffer(), B.LDim(),
+              beta,  C.Buffer(),       C.LDim() );
+            blas::Gemm<T>
+            ( transA, transB, m, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     B.LockedBuffer(), B.LDim(),
+              beta,  CRef.Buffer(),    CRef.LDim() );
+
+            const Real scale = Abs(alpha)*FrobeniusNorm(A)*FrobeniusNorm(B) +
+              Abs(beta)*FrobeniusNorm(CRef);
+            CheckError
+            (BuildString("Gemm ",transA,transB), C, CRef, scale,
+             10*k*eps);
+        }
+    }
+}
+
+template<typename T>
+void TestGemv( Int m, Int n )
+{
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const T alpha( -1 ), beta( 2 );
+    for( const char trans : {'N','T'} )
+    {
+        const Int xLength = ( trans == 'N' ? n : m );
+        const Int yLength = ( trans == 'N' ? m : n );
+        Matrix<T> A, x, y, yRef;
+        Uniform( A, m, n );
+        Uniform( x, xLength, 1 );
+        Uniform( y, yLength, 1 );
+        yRef = y;
+
+        blas::Gemv
+        ( trans, m, n,
+          alpha, A.LockedBuffer(), A.LDim(), x.LockedBuffer(), 1,
+          beta,  y.Buffer(), 1 );
+        blas::Gemv<T>
+        ( trans, m, n,
+          alpha, A.LockedBuffer(), A.LDim(), x.LockedBuffer(), 1,
+          beta,  yRef.Buffer(), 1 );
+
+        const Real scale = Abs(alpha)*FrobeniusNorm(A)*FrobeniusNorm(x) +
+          Abs(beta)*FrobeniusNorm(yRef);
+        CheckError
+        (BuildString("Gemv ",trans), y, yRef, scale, 10*xLength*eps);
+    }
+}
+
+template<typename T>
+void TestTrsm( Int m, Int n )
+{
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const T alpha( 2 );
+    for( const char side : {'L','R'} )
+    {
+        const Int triSize = ( side == 'L' ? m : n );
+
+        // A well-conditioned triangle whether or not its diagonal is used
+        Matrix<T> A;
+        Uniform( A, triSize, triSize );
+        A *= Real(1) / Real(triSize);
+        ShiftDiagonal( A, T(1) );
+        for( const char uplo : {'L','U'} )
+        {
+            for( const char trans : {'N','T'} )
+            {
+                for( const char unit : {'N','U'} )
+                {
+                    Matrix<T> B, BRef;
+                    Uniform( B, m, n );
+                    BRef = B;
+
+                    blas::Trsm
+                    ( side, uplo, trans, unit, m, n,
+                      alpha, A.LockedBuffer(), A.LDim(),
+                             B.Buffer(), B.LDim() );
+                    blas::Trsm<T>
+                    ( side, uplo, trans, unit, m, n,
+                      alpha, A.LockedBuffer(), A.LDim(),
+                             BRef.Buffer(), BRef.LDim() );
+
+                    CheckError
+                    (BuildString("Trsm ",side,uplo,trans,unit), B, BRef,
+                     FrobeniusNorm(BRef), 10*triSize*eps);
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+void TestKernels( Int m, Int n, Int k )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    TestGemm<T>( m, n, k );
+    TestGemv<T>( m, k );
+    TestTrsm<T>( m, n );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of C",150);
+        const Int n = Input("--n","width of C",37);
+        const Int k = Input("--k","inner dimension",300);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+#ifdef EL_HAVE_QD
+            TestKernels<DoubleDouble>( m, n, k );
+            TestKernels<QuadDouble>( m, n, k );
+#endif
+#ifdef EL_HAVE_QUAD
+            TestKernels<Quad>( m, n, k );
+#endif
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void CheckRelError
+( const string& label, const Matrix<F>& X, const Matrix<F>& XRef )
+{
+    typedef Base<F> Real;
+    Matrix<F> E( XRef );
+    E -= X;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    Output(label,": relative error ",relError);
+    if( relError > Sqrt(limits::Epsilon<Real>()) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename F>
+void TestReshape( Int m, Int n )
+{
+    Output("Testing Reshape with ",TypeName<F>());
+    PushIndent();
+
+    // Reshape a non-contiguous submatrix by copying and compare against an
+    // entrywise reshape
+    Matrix<F> A;
+    Uniform( A, m+3, n );
+    auto ASub = A( IR(1,m+1), ALL );
+    const Int mNew = n, nNew = m;
+    Matrix<F> B, BRef( mNew, nNew );
+    Reshape( mNew, nNew, ASub, B );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            BRef((i+j*m)%mNew,(i+j*m)/mNew) = ASub(i,j);
+    CheckRelError( "Strided reshape", B, BRef );
+
+    // A contiguous matrix can be viewed in-place
+    Matrix<F> AContig( ASub );
+    Reshape( mNew, nNew, AContig, B );
+    CheckRelError( "Contiguous reshape", B, BRef );
+    Matrix<F> BView;
+    ReshapeView( mNew, nNew, AContig, BView );
+    if( BView.Buffer() != AContig.Buffer() )
+        LogicError("ReshapeView copied the data");
+    CheckRelError( "Reshape view", BView, BRef );
+    BView(0,0) = F(7);
+    if( AContig(0,0) != F(7) )
+        LogicError("ReshapeView did not alias the original matrix");
+
+    bool caught = false;
+    try { LockedReshapeView( mNew, nNew, ASub, BView ); }
+    catch( std::exception& ) { caught = true; }
+    if( !caught )
+        LogicError("Viewing strided data should have failed");
+    PopIndent();
+}
+
+template<typename F>
+void TestComposite( Int m, Int n, Int numRHS )
+{
+    Output("Testing CompositeMatrix with ",TypeName<F>());
+    PushIndent();
+
+    // Form the KKT-like matrix
+    //
+    //   | 2 D  [A; 0]^H |,  with S = | I       -B |,
+    //   | [A; 0]     S  |            | C^T  0.5 I |
+    //
+    // where S is itself composite and C is sparse
+    Matrix<F> d, A, B;
+    Uniform( d, n, 1 );
+    Uniform( A, m, n );
+    Uniform( B, m, m );
+    SparseMatrix<F> C;
+    Laplacian( C, m );
+
+    CompositeMatrix<F> S( 2, 2 );
+    S.SetIdentityBlock( 0, 0, m );
+    S.SetBlock( 0, 1, B, F(-1) );
+    S.SetBlock( 1, 0, C, F(1), TRANSPOSE );
+    S.SetIdentityBlock( 1, 1, m, F(0.5) );
+
+    // S is 2m x 2m, and so A is extended with zeros
+    CompositeMatrix<F> AExt( 2, 1 );
+    AExt.SetBlock( 0, 0, A );
+    AExt.SetZeroBlock( 1, 0, m, n );
+    CompositeMatrix<F> K( 2, 2 );
+    K.SetDiagonalBlock( 0, 0, d, F(2) );
+    K.SetBlock( 0, 1, AExt, F(1), ADJOINT );
+    K.SetBlock( 1, 0, AExt );
+    K.SetBlock( 1, 1, S );
+    if( K.Height() != n+2*m || K.Width() != n+2*m )
+        LogicError("Composite matrix had the wrong dimensions");
+
+    Matrix<F> KDense;
+    K.Materialize( KDense );
+    SparseMatrix<F> KSparse;
+    K.Materialize( KSparse );
+    Matrix<F> KFromSparse;
+    Copy( KSparse, KFromSparse );
+    CheckRelError( "Sparse materialization", KFromSparse, KDense );
+
+    // Spot-check the materialization against the definition
+    Matrix<F> KRef;
+    Zeros( KRef, n+2*m, n+2*m );
+    for( Int i=0; i<n; ++i )
+        KRef(i,i) = F(2)*d(i);
+    auto KRef10 = KRef( IR(n,n+m), IR(0,n) );
+    KRef10 = A;
+    auto KRef01 = KRef( IR(0,n), IR(n,n+m) );
+    Adjoint( A, KRef01 );
+    for( Int i=0; i<m; ++i )
+    {
+        KRef(n+i,n+i) = F(1);
+        KRef(n+m+i,n+m+i) = F(0.5);
+    }
+    auto KRef12 = KRef( IR(n,n+m), IR(n+m,n+2*m) );
+    KRef12 = B;
+    KRef12 *= F(-1);
+    Matrix<F> CDense;
+    Copy( C, CDense );
+    auto KRef21 = KRef( IR(n+m,n+2*m), IR(n,n+m) );
+    Transpose( CDense, KRef21 );
+    CheckRelError( "Dense materialization", KDense, KRef );
+
+    Matrix<F> X, Y, YRef;
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        Uniform( X, n+2*m, numRHS );
+        Uniform( Y, n+2*m, numRHS );
+        YRef = Y;
+        Multiply( orientation, F(3), K, X, F(-2), Y );
+        Gemm( orientation, NORMAL, F(3), KRef, X, F(-2), YRef );
+        CheckRelError( "Multiply", Y, YRef );
+
+        auto x = X( ALL, IR(0) );
+        Matrix<F> y, yRef;
+        Gemv( orientation, F(1), K, x, F(0), y );
+        Gemv( orientation, F(1), KRef, x, F(0), yRef );
+        CheckRelError( "Gemv", y, yRef );
+    }
+
+    // Updates to the referenced matrices are reflected without reassembly
+    Uniform( d, n, 1 );
+    K( X, Y );
+    for( Int i=0; i<n; ++i )
+        KRef(i,i) = F(2)*d(i);
+    Gemm( NORMAL, NORMAL, F(1), KRef, X, YRef );
+    CheckRelError( "Refreshed multiply", Y, YRef );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of off-diagonal block",30);
+        const Int n = Input("--n","width of off-diagonal block",20);
+        const Int numRHS = Input("--numRHS","number of vectors",4);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestReshape<double>( m, n );
+            TestReshape<Complex<double>>( m, n );
+            TestComposite<double>( m, n, numRHS );
+            TestComposite<Complex<double>>( m, n, numRHS );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestCopyPlan( Int m, Int n, const Grid& g, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    const std::pair<Dist,Dist> dists[] =
+    { {MC,  MR  }, {MC,  STAR}, {MD,  STAR}, {MR,  MC  }, {MR,  STAR},
+      {STAR,MC  }, {STAR,MD  }, {STAR,MR  }, {STAR,STAR}, {STAR,VC  },
+      {STAR,VR  }, {VC,  STAR}, {VR,  STAR} };
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    for( const auto& sourceDist : dists )
+    {
+        auto ASource =
+          copy::MakeIntermediate<T>( sourceDist.first, sourceDist.second, g );
+        Copy( A, *ASource );
+        for( const auto& targetDist : dists )
+        {
+            auto BPlanned =
+              copy::MakeIntermediate<T>
+              ( targetDist.first, targetDist.second, g );
+            auto BDirect =
+              copy::MakeIntermediate<T>
+              ( targetDist.first, targetDist.second, g );
+            PlannedCopy( *ASource, *BPlanned );
+            Copy( *ASource, *BDirect );
+
+            DistMatrix<T> E( *BPlanned ), EDirect( *BDirect );
+            E -= EDirect;
+            if( FrobeniusNorm( E ) != Base<T>(0) )
+                LogicError
+                ("Planned copy from [",DistToString(sourceDist.first),",",
+                 DistToString(sourceDist.second),"] to [",
+                 DistToString(targetDist.first),",",
+                 DistToString(targetDist.second),"] was incorrect");
+        }
+    }
+    if( print && g.Rank() == 0 )
+        PrintCopyPlans();
+    OutputFromRoot(g.Comm(),"passed");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        const bool print = Input("--print","print plans?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        TestCopyPlan<float>( m, n, g, print );
+        TestCopyPlan<Complex<float>>( m, n, g, print );
+        TestCopyPlan<double>( m, n, g, print );
+        TestCopyPlan<Complex<double>>( m, n, g, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
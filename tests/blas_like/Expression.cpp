@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestExpression( Int m, Int n, const Grid& g, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    typedef Base<T> Real;
+    const T alpha = T(2);
+    const T beta = T(-3);
+
+    DistMatrix<T> X(g), Y(g), Z(g), W(g);
+    Uniform( X, m, n );
+    Uniform( Y, m, n );
+    Uniform( Z, m, n );
+    Uniform( W, m, n );
+
+    // Form Y + alpha X + beta (Z o W) one sweep at a time
+    DistMatrix<T> YRef( Y ), ZW(g);
+    Hadamard( Z, W, ZW );
+    Axpy( alpha, X, YRef );
+    Axpy( beta, ZW, YRef );
+
+    Timer timer;
+    timer.Start();
+    Evaluate( Expr(Y) + alpha*Expr(X) + beta*Hadamard(Expr(Z),Expr(W)), Y );
+    const double runTime = timer.Stop();
+    OutputFromRoot(g.Comm(),"Fused update took ",runTime," seconds");
+    if( print )
+    {
+        Print( YRef, "YRef" );
+        Print( Y, "Y" );
+    }
+
+    Y -= YRef;
+    const Real refNorm = FrobeniusNorm( YRef );
+    const Real errNorm = FrobeniusNorm( Y );
+    OutputFromRoot
+    (g.Comm(),"|| Y - YRef ||_F / || YRef ||_F = ",errNorm/refNorm);
+    if( errNorm > 10*limits::Epsilon<Real>()*refNorm )
+        LogicError("Fused evaluation did not match the unfused result");
+
+    // Sequential matrices and entrywise maps
+    Matrix<T> A, B;
+    Uniform( A, m, n );
+    Evaluate( EntrywiseMap(Expr(A),[]( T a ) { return a*a; }), B );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( B(i,j) != A(i,j)*A(i,j) )
+                LogicError("Fused entrywise map was incorrect");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",100);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        TestExpression<float>( m, n, g, print );
+        TestExpression<Complex<float>>( m, n, g, print );
+
+        TestExpression<double>( m, n, g, print );
+        TestExpression<Complex<double>>( m, n, g, print );
+
+#ifdef EL_HAVE_QD
+        TestExpression<DoubleDouble>( m, n, g, print );
+        TestExpression<QuadDouble>( m, n, g, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+        TestExpression<Quad>( m, n, g, print );
+        TestExpression<Complex<Quad>>( m, n, g, print );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
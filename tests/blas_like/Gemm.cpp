@@ -141,6 +141,26 @@ void TestGemm
     if( correctness )
         TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
     PopIndent();
+
+    // Test the 2.5D algorithm, which replicates C over Gemm25DLayers()
+    // layers (or falls back to the 2D algorithms for a single layer)
+    C = COrig;
+    OutputFromRoot(g.Comm(),"2.5D Algorithm:");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_25D );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
     
     if( orientA == NORMAL && orientB == NORMAL )
     {
@@ -183,6 +203,7 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int numLayers = Input("--layers","number of 2.5D layers",0);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
@@ -201,6 +222,7 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemm25DLayers( numLayers );
 
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test Gemm",transA,transB);
@@ -0,0 +1,94 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V,Dist X,Dist Y>
+void CheckICopy( const DistMatrix<T,U,V>& A, bool print )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,X,Y> B(g), BRef(g);
+    BRef = A;
+
+    CopyRequest<T> request = ICopy( A, B );
+    // Overlap the communication with a local update of an unrelated matrix
+    Matrix<T> C;
+    Uniform( C, 100, 100 );
+    Scale( T(2), C );
+    request.Wait();
+    if( request.Active() )
+        LogicError("Request was still active after Wait");
+    if( print )
+    {
+        Print( BRef, "BRef" );
+        Print( B, "B" );
+    }
+
+    B -= BRef;
+    if( FrobeniusNorm( B ) != Base<T>(0) )
+        LogicError
+        ("ICopy ",DistToString(U),",",DistToString(V)," -> ",
+         DistToString(X),",",DistToString(Y)," was incorrect");
+}
+
+template<typename T>
+void TestICopy( Int m, Int n, const Grid& g, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    CheckICopy<T,MC,MR,MC,STAR>( A, print );
+    CheckICopy<T,MC,MR,STAR,MR>( A, print );
+    CheckICopy<T,MC,MR,STAR,STAR>( A, print );
+
+    DistMatrix<T,VC,STAR> AVC(g);
+    Uniform( AVC, m, n );
+    CheckICopy<T,VC,STAR,STAR,STAR>( AVC, print );
+
+    // Test() must eventually complete the redistribution
+    DistMatrix<T,MC,STAR> B(g);
+    CopyRequest<T> request = ICopy( A, B );
+    while( !request.Test() ) { }
+    DistMatrix<T,MC,STAR> BRef( A );
+    B -= BRef;
+    if( FrobeniusNorm( B ) != Base<T>(0) )
+        LogicError("ICopy completed with Test was incorrect");
+
+    OutputFromRoot(g.Comm(),"passed");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",100);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        TestICopy<float>( m, n, g, print );
+        TestICopy<Complex<float>>( m, n, g, print );
+
+        TestICopy<double>( m, n, g, print );
+        TestICopy<Complex<double>>( m, n, g, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
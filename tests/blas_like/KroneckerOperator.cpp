@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void CheckRelError
+( const string& label, const Matrix<F>& X, const Matrix<F>& XRef )
+{
+    typedef Base<F> Real;
+    Matrix<F> E( XRef );
+    E -= X;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    OutputFromRoot(mpi::COMM_WORLD,label,": relative error ",relError);
+    if( relError > Sqrt(limits::Epsilon<Real>()) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename F>
+void TestSequential( Int mA, Int nA, Int mB, Int nB, Int numRHS )
+{
+    OutputFromRoot
+    (mpi::COMM_WORLD,"Testing sequential operators with ",TypeName<F>());
+    PushIndent();
+
+    Matrix<F> A, B, C;
+    Uniform( A, mA, nA );
+    Uniform( B, mB, nB );
+    Kronecker( A, B, C );
+    KroneckerOperator<F> kronOp( A, B );
+
+    Matrix<F> X, Y, YRef;
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        const Int width = ( orientation==NORMAL ? C.Width() : C.Height() );
+        Uniform( X, width, numRHS );
+        kronOp.Apply( orientation, X, Y );
+        Gemm( orientation, NORMAL, F(1), C, X, YRef );
+        CheckRelError( "Kronecker product", Y, YRef );
+    }
+
+    // The Kronecker sum, A \oplus B = A \otimes I + I \otimes B
+    Matrix<F> ASq, BSq, I, CSum;
+    Uniform( ASq, nA, nA );
+    Uniform( BSq, nB, nB );
+    Identity( I, nB, nB );
+    Kronecker( ASq, I, CSum );
+    Identity( I, nA, nA );
+    Kronecker( I, BSq, C );
+    CSum += C;
+    KroneckerSumOperator<F> sumOp( ASq, BSq );
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        Uniform( X, nA*nB, numRHS );
+        sumOp.Apply( orientation, X, Y );
+        Gemm( orientation, NORMAL, F(1), CSum, X, YRef );
+        CheckRelError( "Kronecker sum", Y, YRef );
+    }
+
+    // Solve a Hermitian positive-definite Kronecker sum both directly and with
+    // a Krylov method applying the lazy operator
+    HermitianUniformSpectrum( ASq, nA, 1, 10 );
+    HermitianUniformSpectrum( BSq, nB, 1, 10 );
+    Matrix<F> XMat, XMatRef;
+    Uniform( XMatRef, nB, nA );
+    auto x = Reshape( nA*nB, 1, XMatRef );
+    Matrix<F> b;
+    sumOp( x, b );
+    XMat = Reshape( nB, nA, b );
+    KroneckerSumSolve( LOWER, ASq, BSq, XMat );
+    CheckRelError( "Direct Kronecker-sum solve", XMat, XMatRef );
+
+    KrylovSolveCtrl<Base<F>> ctrl;
+    ctrl.relTol = Pow(limits::Epsilon<Base<F>>(),Base<F>(0.75));
+    Zeros( x, nA*nB, 1 );
+    auto noPrecond = []( Matrix<F>& ) { };
+    KrylovSolve( sumOp, noPrecond, b, x, ctrl );
+    CheckRelError
+    ( "Krylov Kronecker-sum solve", Reshape( nB, nA, x ), XMatRef );
+    PopIndent();
+}
+
+template<typename F>
+void TestDistributed
+( const Grid& g, Int mA, Int nA, Int mB, Int nB, Int numRHS )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing distributed operators with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), B(g);
+    Uniform( A, mA, nA );
+    Uniform( B, mB, nB );
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    KroneckerOperator<F> kronOp
+    ( A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix() );
+    DistKroneckerOperator<F> distKronOp( A, B );
+
+    DistMultiVec<F> X(g.Comm()), Y(g.Comm());
+    DistMatrix<F,STAR,STAR> X_STAR_STAR(g), Y_STAR_STAR(g);
+    Matrix<F> YRef;
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        const Int width = ( orientation==NORMAL ? nA*nB : mA*mB );
+        Uniform( X, width, numRHS );
+        distKronOp.Apply( orientation, X, Y );
+        Copy( X, X_STAR_STAR );
+        Copy( Y, Y_STAR_STAR );
+        kronOp.Apply( orientation, X_STAR_STAR.LockedMatrix(), YRef );
+        CheckRelError
+        ( "Distributed Kronecker product", Y_STAR_STAR.LockedMatrix(), YRef );
+    }
+
+    DistMatrix<F> ASq(g), BSq(g);
+    HermitianUniformSpectrum( ASq, nA, 1, 10 );
+    HermitianUniformSpectrum( BSq, nB, 1, 10 );
+    DistKroneckerSumOperator<F> distSumOp( ASq, BSq );
+    DistMatrix<F> XMat(g), XMatRef(g), BMat(g);
+    Uniform( XMatRef, nB, nA );
+    distSumOp.ApplyMatricized( NORMAL, XMatRef, BMat );
+    XMat = BMat;
+    KroneckerSumSolve( LOWER, ASq, BSq, XMat );
+    DistMatrix<F,STAR,STAR> XMat_STAR_STAR( XMat ),
+      XMatRef_STAR_STAR( XMatRef );
+    CheckRelError
+    ( "Distributed Kronecker-sum solve", XMat_STAR_STAR.LockedMatrix(),
+      XMatRef_STAR_STAR.LockedMatrix() );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int mA = Input("--mA","height of A",12);
+        const Int nA = Input("--nA","width of A",10);
+        const Int mB = Input("--mB","height of B",9);
+        const Int nB = Input("--nB","width of B",11);
+        const Int numRHS = Input("--numRHS","number of vectors",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestSequential<double>( mA, nA, mB, nB, numRHS );
+        TestSequential<Complex<double>>( mA, nA, mB, nB, numRHS );
+        TestDistributed<double>( g, mA, nA, mB, nB, numRHS );
+        TestDistributed<Complex<double>>( g, mA, nA, mB, nB, numRHS );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
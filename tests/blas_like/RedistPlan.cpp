@@ -0,0 +1,77 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void TestPlan( const DistMatrix<T>& A, Int numApplies )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V> B(g);
+    RedistPlan<T> plan( A, B );
+    DistMatrix<T> ACopy( A ), E(g);
+    for( Int apply=0; apply<numApplies; ++apply )
+    {
+        // Reuse the plan with new values in the same configuration
+        plan.Apply( ACopy, B );
+        E = B;
+        E -= ACopy;
+        if( FrobeniusNorm( E ) != Base<T>(0) )
+            LogicError
+            ("Planned redistribution to [",DistToString(U),",",
+             DistToString(V),"] was incorrect");
+        ACopy *= T(2);
+    }
+}
+
+template<typename T>
+void TestRedistPlan( Int m, Int n, Int numApplies, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    TestPlan<T,MC,  MR  >( A, numApplies );
+    TestPlan<T,MR,  MC  >( A, numApplies );
+    TestPlan<T,VC,  STAR>( A, numApplies );
+    TestPlan<T,STAR,VR  >( A, numApplies );
+    TestPlan<T,MC,  STAR>( A, numApplies );
+    TestPlan<T,STAR,STAR>( A, numApplies );
+    TestPlan<T,CIRC,CIRC>( A, numApplies );
+    OutputFromRoot(g.Comm(),"passed");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        const Int numApplies = Input("--numApplies","applications per plan",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        TestRedistPlan<float>( m, n, numApplies, g );
+        TestRedistPlan<Complex<float>>( m, n, numApplies, g );
+        TestRedistPlan<double>( m, n, numApplies, g );
+        TestRedistPlan<Complex<double>>( m, n, numApplies, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
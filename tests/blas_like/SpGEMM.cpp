@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares the sparse-times-sparse products, C := alpha A B, against dense
+// products of the same matrices, both when C is formed from scratch and when
+// the values of a C with frozen sparsity are refreshed for new values of A.
+// Every sixth row of each factor is empty, and some entries are queued
+// twice (and therefore summed).
+
+// The nonzeros of row i of an m x n factor, with values depending on 'seed'
+template<typename T>
+vector<Entry<T>> FactorRow( Int i, Int n, Int seed )
+{
+    vector<Entry<T>> row;
+    if( i % 6 == 5 )
+        return row;
+    for( Int t=0; t<3; ++t )
+    {
+        const Int j = (7*i+13*t) % n;
+        const T value = T( (1+(i+2*j+seed)%5) * (t==1 ? -1 : 1) );
+        row.push_back( Entry<T>{ i, j, value } );
+        if( t == 2 )
+            row.push_back( Entry<T>{ i, j, value } );
+    }
+    return row;
+}
+
+template<typename T>
+void BuildFactor( SparseMatrix<T>& A, Int m, Int n, Int seed )
+{
+    A.Resize( m, n );
+    A.Reserve( 4*m );
+    for( Int i=0; i<m; ++i )
+        for( const auto& entry : FactorRow<T>( i, n, seed ) )
+            A.QueueUpdate( entry );
+    A.ProcessQueues();
+}
+
+template<typename T>
+void BuildFactor( DistSparseMatrix<T>& A, Int m, Int n, Int seed )
+{
+    A.Resize( m, n );
+    A.Reserve( 4*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        for( const auto& entry : FactorRow<T>( A.GlobalRow(iLoc), n, seed ) )
+            A.QueueLocalUpdate( iLoc, entry.j, entry.value );
+    A.ProcessLocalQueues();
+}
+
+template<typename T>
+Base<T> ProductError
+( T alpha, const SparseMatrix<T>& A, const SparseMatrix<T>& B,
+  const SparseMatrix<T>& C )
+{
+    Matrix<T> ADense, BDense, CDense, E;
+    Copy( A, ADense );
+    Copy( B, BDense );
+    Copy( C, E );
+    Zeros( CDense, A.Height(), B.Width() );
+    Gemm( NORMAL, NORMAL, alpha, ADense, BDense, T(0), CDense );
+    E -= CDense;
+    return FrobeniusNorm(E) / FrobeniusNorm(CDense);
+}
+
+template<typename T>
+Base<T> ProductError
+( T alpha, const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B,
+  const DistSparseMatrix<T>& C, const Grid& g )
+{
+    DistMatrix<T> ADense(g), BDense(g), CDense(g), E(g);
+    Copy( A, ADense );
+    Copy( B, BDense );
+    Copy( C, E );
+    Zeros( CDense, A.Height(), B.Width() );
+    Gemm( NORMAL, NORMAL, alpha, ADense, BDense, T(0), CDense );
+    E -= CDense;
+    return FrobeniusNorm(E) / FrobeniusNorm(CDense);
+}
+
+template<typename T>
+void CheckError( const string& label, Base<T> relError, mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,label,": || C - alpha A B ||_F / || alpha A B ||_F = ",relError);
+    if( relError > 100*limits::Epsilon<Base<T>>() )
+        LogicError(label," SpGEMM was incorrect");
+}
+
+template<typename T>
+void TestSequential( Int m, Int k, Int n, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing sequential SpGEMM with ",TypeName<T>());
+    PushIndent();
+    const T alpha( 3 );
+
+    SparseMatrix<T> A, B, C;
+    BuildFactor( A, m, k, 0 );
+    BuildFactor( B, k, n, 1 );
+    Multiply( alpha, A, B, C );
+    CheckError<T>( "Initial", ProductError( alpha, A, B, C ), comm );
+
+    // Refresh the values of C after changing those of A
+    C.FreezeSparsity();
+    BuildFactor( A, m, k, 2 );
+    Multiply( alpha, A, B, C );
+    CheckError<T>( "Refreshed", ProductError( alpha, A, B, C ), comm );
+
+    // A D A^T, as formed within Interior Point Methods
+    SparseMatrix<T> AT, DAT, ADAT;
+    Transpose( A, AT );
+    DAT = AT;
+    for( Int e=0; e<DAT.NumEntries(); ++e )
+        DAT.ValueBuffer()[e] *= T(1+DAT.Row(e)%4);
+    Multiply( alpha, A, DAT, ADAT );
+    CheckError<T>( "A D A^T", ProductError( alpha, A, DAT, ADAT ), comm );
+
+    // A frozen pattern which does not contain that of A B is rejected
+    SparseMatrix<T> CSmall;
+    Identity( CSmall, m, n );
+    CSmall.FreezeSparsity();
+    bool rejected = false;
+    try { Multiply( alpha, A, B, CSmall ); }
+    catch( std::logic_error& ) { rejected = true; }
+    if( !rejected )
+        LogicError("An insufficient frozen pattern was not rejected");
+
+    PopIndent();
+}
+
+template<typename T>
+void TestDistributed( Int m, Int k, Int n, const Grid& g )
+{
+    mpi::Comm comm = g.Comm();
+    OutputFromRoot(comm,"Testing distributed SpGEMM with ",TypeName<T>());
+    PushIndent();
+    const T alpha( 3 );
+
+    DistSparseMatrix<T> A(comm), B(comm), C(comm);
+    BuildFactor( A, m, k, 0 );
+    BuildFactor( B, k, n, 1 );
+    Multiply( alpha, A, B, C );
+    CheckError<T>( "Initial", ProductError( alpha, A, B, C, g ), comm );
+
+    C.FreezeSparsity();
+    BuildFactor( A, m, k, 2 );
+    Multiply( alpha, A, B, C );
+    CheckError<T>( "Refreshed", ProductError( alpha, A, B, C, g ), comm );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",300);
+        const Int k = Input("--k","width of A",200);
+        const Int n = Input("--n","width of B",250);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSequential<double>( m, k, n, mpi::COMM_SELF );
+            TestSequential<Complex<double>>( m, k, n, mpi::COMM_SELF );
+        }
+
+        const Grid g( comm );
+        TestDistributed<double>( m, k, n, g );
+        TestDistributed<Complex<double>>( m, k, n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
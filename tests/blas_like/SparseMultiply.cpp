@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestSparseMultiply( Int n, Int numRHS, Int numFar, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    mpi::Comm comm = g.Comm();
+
+    // A banded matrix (whose multiplies only involve neighboring processes)
+    // plus 'numFar' distant entries per row
+    DistSparseMatrix<F> A(comm);
+    A.Resize( n, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( (3+numFar)*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, F(2) );
+        if( i > 0 )
+            A.QueueLocalUpdate( iLoc, i-1, F(-1) );
+        if( i < n-1 )
+            A.QueueLocalUpdate( iLoc, i+1, F(-1) );
+        for( Int k=0; k<numFar; ++k )
+            A.QueueLocalUpdate( iLoc, (i*7919+(k+1)*n/(numFar+1)) % n, F(1) );
+    }
+    A.ProcessLocalQueues();
+
+    DistMultiVec<F> X(comm), Y(comm);
+    Uniform( X, n, numRHS );
+    DistMatrix<F> ADense(g), XDense(g), YDense(g), E(g);
+    Copy( A, ADense );
+    Copy( X, XDense );
+    for( auto orientation : { NORMAL, ADJOINT } )
+    {
+        Uniform( Y, n, numRHS );
+        Copy( Y, YDense );
+        Multiply( orientation, F(2), A, X, F(-1), Y );
+        Gemm( orientation, NORMAL, F(2), ADense, XDense, F(-1), YDense );
+        Copy( Y, E );
+        E -= YDense;
+        const Real relError = FrobeniusNorm(E) / FrobeniusNorm(YDense);
+        OutputFromRoot
+        (comm,"|| Y - YDense ||_F / || YDense ||_F = ",relError,
+         (orientation==NORMAL ? " (normal)" : " (adjoint)"));
+        if( relError > 100*limits::Epsilon<Real>() )
+            LogicError("Sparse multiply was incorrect");
+    }
+    OutputFromRoot(comm,"passed");
+
+    PopIndent();
+}
+
+template<typename F>
+void TestLocalSparseMultiply( Int n, Int numRHS, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing sequential multiply with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+
+    SparseMatrix<F> A;
+    A.Resize( n, n );
+    A.Reserve( 4*n );
+    for( Int i=0; i<n; ++i )
+    {
+        A.QueueUpdate( i, i, F(2) );
+        if( i > 0 )
+            A.QueueUpdate( i, i-1, F(-1) );
+        if( i < n-1 )
+            A.QueueUpdate( i, i+1, F(-1) );
+        A.QueueUpdate( i, (i*7919) % n, F(1) );
+    }
+    A.ProcessQueues();
+
+    Matrix<F> ADense, X, Y, YDense;
+    Copy( A, ADense );
+    Uniform( X, n, numRHS );
+    A.FreezeSparsity();
+    for( auto format : { CSR_FORMAT, SELL_FORMAT, BCSR_FORMAT } )
+    {
+        if( format == SELL_FORMAT )
+            A.ConvertToSELL( 4, 16 );
+        else if( format == BCSR_FORMAT )
+            A.ConvertToBCSR( 3 );
+        else
+            A.ConvertToCSR();
+        if( A.Format() != format )
+            LogicError("The sparse format was not converted");
+        for( auto orientation : { NORMAL, ADJOINT } )
+        {
+            Uniform( Y, n, numRHS );
+            YDense = Y;
+            Multiply( orientation, F(2), A, X, F(-1), Y );
+            Gemm( orientation, NORMAL, F(2), ADense, X, F(-1), YDense );
+            Y -= YDense;
+            const Real relError = FrobeniusNorm(Y) / FrobeniusNorm(YDense);
+            OutputFromRoot
+            (comm,"|| Y - YDense ||_F / || YDense ||_F = ",relError,
+             (orientation==NORMAL ? " (normal" : " (adjoint"),
+             (format==CSR_FORMAT ? ", CSR)" :
+              format==SELL_FORMAT ? ", SELL)" : ", BCSR)"));
+            if( relError > 100*limits::Epsilon<Real>() )
+                LogicError("Sequential sparse multiply was incorrect");
+        }
+    }
+
+    // Modifying the matrix reverts it to CSR
+    A.QueueUpdate( 0, 0, F(1) );
+    if( A.Format() != CSR_FORMAT )
+        LogicError("Updating the matrix did not revert it to CSR");
+    OutputFromRoot(comm,"passed");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","height of matrix",500);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const Int numFar = Input("--numFar","distant entries per row",1);
+        ProcessInput();
+        PrintInputReport();
+
+        TestLocalSparseMultiply<float>( n, 1, comm );
+        TestLocalSparseMultiply<Complex<double>>( n, numRHS, comm );
+
+        const Grid g( comm );
+        TestSparseMultiply<float>( n, numRHS, 0, g );
+        TestSparseMultiply<float>( n, numRHS, numFar, g );
+        TestSparseMultiply<Complex<double>>( n, numRHS, 0, g );
+        TestSparseMultiply<Complex<double>>( n, numRHS, numFar, g );
+
+        // Fall back to exchanges over the entire communicator
+        OutputFromRoot(comm,"Without neighborhood collectives");
+        DisableNeighborCollectives();
+        TestSparseMultiply<double>( n, numRHS, numFar, g );
+        EnableNeighborCollectives();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
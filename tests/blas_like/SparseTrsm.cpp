@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void CheckRelError
+( const string& label, const Matrix<F>& X, const Matrix<F>& XRef )
+{
+    typedef Base<F> Real;
+    Matrix<F> E( XRef );
+    E -= X;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    Output(label,": relative error ",relError);
+    if( relError > Sqrt(limits::Epsilon<Real>()) )
+        LogicError("Unacceptably large relative error");
+}
+
+// A diagonally dominant matrix with a handful of random off-diagonal entries
+// in both triangles
+template<typename F>
+void RandomSparse( SparseMatrix<F>& A, Int n, Int numOffDiag )
+{
+    Zeros( A, n, n );
+    A.Reserve( n*(2*numOffDiag+1) );
+    for( Int i=0; i<n; ++i )
+    {
+        A.QueueUpdate( i, i, F(2*numOffDiag+2)+SampleUniform<F>() );
+        for( Int k=0; k<2*numOffDiag; ++k )
+        {
+            const Int j = SampleUniform<Int>(0,n);
+            if( j != i )
+                A.QueueUpdate( i, j, SampleUniform<F>() );
+        }
+    }
+    A.ProcessQueues();
+}
+
+template<typename F>
+void TestSparseTrsm( Int n, Int numOffDiag, Int numRHS )
+{
+    Output("Testing sparse Trsm with ",TypeName<F>());
+    PushIndent();
+
+    SparseMatrix<F> A;
+    RandomSparse( A, n, numOffDiag );
+    Matrix<F> ADense;
+    Copy( A, ADense );
+
+    const F alpha = F(3);
+    Matrix<F> B, X, XRef, ATri;
+    for( auto uplo : {LOWER,UPPER} )
+    {
+        for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+        {
+            for( auto diag : {NON_UNIT,UNIT} )
+            {
+                Uniform( B, n, numRHS );
+                X = B;
+                XRef = B;
+                Trsm( LEFT, uplo, orientation, diag, alpha, A, X, true );
+                ATri = ADense;
+                MakeTrapezoidal( uplo, ATri );
+                if( diag == UNIT )
+                    FillDiagonal( ATri, F(1) );
+                Trsm( LEFT, uplo, orientation, diag, alpha, ATri, XRef );
+                CheckRelError( "Sparse Trsm", X, XRef );
+            }
+        }
+    }
+
+    // A structurally missing diagonal entry should be detected
+    SparseMatrix<F> L;
+    Zeros( L, 2, 2 );
+    L.QueueUpdate( 1, 0, F(1) );
+    L.QueueUpdate( 1, 1, F(1) );
+    L.ProcessQueues();
+    Uniform( B, 2, numRHS );
+    bool caught = false;
+    try { Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), L, B, true ); }
+    catch( SingularMatrixException& ) { caught = true; }
+    if( !caught )
+        LogicError("Failed to detect a singular sparse triangle");
+
+    // Refine all of the right-hand sides of a (block) Gauss-Seidel solve at
+    // once, with one sparse product and one sparse triangular solve per sweep
+    auto applyA = [&]( const Matrix<F>& Z, Matrix<F>& Y )
+      { Multiply( NORMAL, F(1), A, Z, F(0), Y ); };
+    auto applyAInv = [&]( Matrix<F>& Z )
+      { Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), A, Z ); };
+    Uniform( XRef, n, numRHS );
+    Zeros( B, n, numRHS );
+    applyA( XRef, B );
+    X = B;
+    const Base<F> relTol = Pow(limits::Epsilon<Base<F>>(),Base<F>(0.75));
+    const Int numIts = RefinedSolve( applyA, applyAInv, X, relTol, 200, true );
+    Output("Block refinement required ",numIts," iterations");
+    CheckRelError( "Refined Gauss-Seidel", X, XRef );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","matrix size",200);
+        const Int numOffDiag = Input("--numOffDiag","off-diagonals per side",3);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestSparseTrsm<double>( n, numOffDiag, numRHS );
+            TestSparseTrsm<Complex<double>>( n, numOffDiag, numRHS );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
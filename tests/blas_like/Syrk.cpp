@@ -161,6 +161,61 @@ void TestSyrk
     PopIndent();
 }
 
+// The dot-product variants are only used when the inner dimension is more
+// than ten times the order of C, so check them against Gemm with a reduced
+// block size so that C spans several diagonal (and off-diagonal) blocks
+template<typename T>
+void TestSyrkDot( Int n, Int nbDot, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing dot variants with ",TypeName<T>());
+    PushIndent();
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int k = 11*n;
+    const T alpha( 3 ), beta( 4 );
+
+    const Int nbDotOrig = SyrkDotBlocksize<T>();
+    SetSyrkDotBlocksize<T>( nbDot );
+    for( const bool conjugate : {false,true} )
+    {
+        const Orientation orient = ( conjugate ? ADJOINT : TRANSPOSE );
+        for( const UpperOrLower uplo : {LOWER,UPPER} )
+        {
+            for( const Orientation orientation : {NORMAL,orient} )
+            {
+                DistMatrix<T> A(g), C(g), CRef(g);
+                if( orientation == NORMAL )
+                    Uniform( A, n, k );
+                else
+                    Uniform( A, k, n );
+                Uniform( C, n, n );
+                MakeSymmetric( uplo, C, conjugate );
+                CRef = C;
+
+                Syrk( uplo, orientation, alpha, A, beta, C, conjugate );
+                if( orientation == NORMAL )
+                    Gemm( NORMAL, orient, alpha, A, A, beta, CRef );
+                else
+                    Gemm( orient, NORMAL, alpha, A, A, beta, CRef );
+
+                MakeTrapezoidal( uplo, C );
+                MakeTrapezoidal( uplo, CRef );
+                C -= CRef;
+                const Real relError =
+                  FrobeniusNorm( C ) / FrobeniusNorm( CRef );
+                if( relError > 10*k*eps )
+                    LogicError
+                    ((conjugate?"Herk ":"Syrk "),UpperOrLowerToChar(uplo),
+                     OrientationToChar(orientation),
+                     " dot variant had a relative error of ",relError);
+            }
+        }
+    }
+    SetSyrkDotBlocksize<T>( nbDotOrig );
+    OutputFromRoot(g.Comm(),"Passed");
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -186,6 +241,9 @@ main( int argc, char* argv[] )
         const Int rowAlignC = Input("--rowAlignC","row align of C",0);
         const bool contigA = Input("--contigA","contiguous A?",true);
         const bool contigC = Input("--contigC","contiguous C?",true);
+        const bool testDot = Input("--testDot","test dot variants?",true);
+        const Int nDot = Input("--nDot","height of dot-variant result",50);
+        const Int nbDot = Input("--nbDot","dot-variant blocksize",16);
         ProcessInput();
         PrintInputReport();
 
@@ -283,6 +341,14 @@ main( int argc, char* argv[] )
           colAlignA, rowAlignA, colAlignC, rowAlignC,
           contigA, contigC );
 #endif
+
+        if( testDot )
+        {
+            TestSyrkDot<float>( nDot, nbDot, g );
+            TestSyrkDot<Complex<float>>( nDot, nbDot, g );
+            TestSyrkDot<double>( nDot, nbDot, g );
+            TestSyrkDot<Complex<double>>( nDot, nbDot, g );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -77,6 +77,63 @@ void TestTrsm
     PopIndent();
 }
 
+// Sweep the fan-in algorithms used for LEFT solves against a handful of
+// right-hand sides (which TRSM_DEFAULT selects for up to 8 columns) over
+// every lower/upper, orientation, and diagonal combination
+template<typename F>
+void TestNarrowTrsm( Int m, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing narrow Trsm with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const F alpha( 3 );
+
+    // Keep the triangle well-conditioned whether or not its diagonal is used
+    DistMatrix<F> A(g);
+    Uniform( A, m, m );
+    A *= Real(1) / Real(m);
+    ShiftDiagonal( A, F(1) );
+
+    for( const UpperOrLower uplo : {LOWER,UPPER} )
+    {
+        for( const Orientation orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+        {
+            for( const UnitOrNonUnit diag : {NON_UNIT,UNIT} )
+            {
+                auto S( A );
+                MakeTrapezoidal( uplo, S );
+                if( diag == UNIT )
+                    FillDiagonal( S, F(1) );
+                for( Int n=1; n<=8; ++n )
+                {
+                    for( const TrsmAlgorithm alg : {TRSM_DEFAULT,TRSM_NARROW} )
+                    {
+                        DistMatrix<F> X(g), Y(g);
+                        Uniform( X, m, n );
+                        Gemm( orientation, NORMAL, F(1)/alpha, S, X, Y );
+                        Trsm
+                        ( LEFT, uplo, orientation, diag, alpha, A, Y,
+                          false, alg );
+                        Y -= X;
+                        const Real relError =
+                          FrobeniusNorm( Y ) / FrobeniusNorm( X );
+                        if( relError > 100*m*eps )
+                            LogicError
+                            ("Narrow Trsm ",UpperOrLowerToChar(uplo),
+                             OrientationToChar(orientation),
+                             UnitOrNonUnitToChar(diag)," with ",n,
+                             " right-hand sides had a relative error of ",
+                             relError);
+                    }
+                }
+            }
+        }
+    }
+    OutputFromRoot(g.Comm(),"Passed");
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -97,6 +154,10 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const bool print = Input("--print","print matrices?",false);
+        const bool testNarrow =
+          Input("--testNarrow","sweep the narrow algorithms?",true);
+        const Int narrowHeight =
+          Input("--narrowHeight","height of the narrow solves",250);
         ProcessInput();
         PrintInputReport();
 
@@ -185,6 +246,28 @@ main( int argc, char* argv[] )
           Complex<BigFloat>(3),
           g, print );
 #endif
+
+        if( testNarrow )
+        {
+            // Sweep a column of processes, the default grid, and a row
+            const int commSize = mpi::Size( comm );
+            vector<int> narrowHeights = { 1, gridHeight, commSize };
+            std::sort( narrowHeights.begin(), narrowHeights.end() );
+            narrowHeights.erase
+            ( std::unique( narrowHeights.begin(), narrowHeights.end() ),
+              narrowHeights.end() );
+            for( const int narrowGridHeight : narrowHeights )
+            {
+                const Grid narrowGrid( comm, narrowGridHeight, order );
+                OutputFromRoot
+                (comm,"Narrow sweep over a ",narrowGrid.Height()," x ",
+                 narrowGrid.Width()," grid");
+                TestNarrowTrsm<float>( narrowHeight, narrowGrid );
+                TestNarrowTrsm<Complex<float>>( narrowHeight, narrowGrid );
+                TestNarrowTrsm<double>( narrowHeight, narrowGrid );
+                TestNarrowTrsm<Complex<double>>( narrowHeight, narrowGrid );
+            }
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
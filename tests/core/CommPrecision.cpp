@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestCommPrecision
+( mpi::CommPrecision precision, Base<T> tol, Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> AExact( A );
+    DistMatrix<T,VC,STAR> AExactVC( A );
+
+    mpi::SetCommPrecision( precision );
+    DistMatrix<T,STAR,STAR> AStarStar( A );
+    DistMatrix<T,VR,STAR> AVR( AExactVC );
+    mpi::SetCommPrecision( mpi::FULL_COMM_PRECISION );
+
+    const Base<T> frobA = FrobeniusNorm( AExact );
+    AStarStar -= AExact;
+    const Base<T> starStarError = FrobeniusNorm( AStarStar ) / frobA;
+    DistMatrix<T,VR,STAR> E( AExactVC );
+    E -= AVR;
+    const Base<T> vrError = FrobeniusNorm( E ) / frobA;
+    OutputFromRoot
+    (g.Comm(),"[*,*] error: ",starStarError,", [VR,*] error: ",vrError);
+    if( starStarError > tol || vrError > tol )
+        LogicError("Reduced-precision redistribution was too inaccurate");
+    OutputFromRoot(g.Comm(),"passed");
+
+    PopIndent();
+}
+
+// The receive buffer of a variable-count AllToAll with gaps between the
+// segments: the entries in the gaps must be left untouched
+template<typename T>
+void TestGaps( mpi::CommPrecision precision, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing gaps with ",TypeName<T>());
+    PushIndent();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    vector<int> sendCounts( commSize, 1 ), sendDispls( commSize ),
+                recvCounts( commSize, 1 ), recvDispls( commSize );
+    vector<T> sendBuf( commSize ), recvBuf( 2*commSize, T(-1) );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendDispls[q] = q;
+        recvDispls[q] = 2*q;
+        sendBuf[q] = T(commRank+1);
+    }
+
+    mpi::SetCommPrecision( precision );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendDispls.data(),
+      recvBuf.data(), recvCounts.data(), recvDispls.data(), comm );
+    mpi::SetCommPrecision( mpi::FULL_COMM_PRECISION );
+
+    // Small integers are exactly representable in each format
+    for( int q=0; q<commSize; ++q )
+    {
+        if( recvBuf[2*q] != T(q+1) )
+            LogicError("Received the wrong value from process ",q);
+        if( recvBuf[2*q+1] != T(-1) )
+            LogicError("The gap after the segment from ",q," was overwritten");
+    }
+    OutputFromRoot(comm,"passed");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        OutputFromRoot(comm,"Single-precision communication");
+        TestCommPrecision<double>
+        ( mpi::SINGLE_COMM_PRECISION, 10*limits::Epsilon<float>(), m, n, g );
+        TestCommPrecision<Complex<double>>
+        ( mpi::SINGLE_COMM_PRECISION, 10*limits::Epsilon<float>(), m, n, g );
+        // Single-precision data is already sent at single precision
+        TestCommPrecision<float>( mpi::SINGLE_COMM_PRECISION, 0, m, n, g );
+
+        OutputFromRoot(comm,"bfloat16 communication");
+        TestCommPrecision<double>( mpi::BFLOAT16_COMM_PRECISION, 0.01, m, n, g );
+        TestCommPrecision<float>( mpi::BFLOAT16_COMM_PRECISION, 0.01, m, n, g );
+
+        TestGaps<double>( mpi::SINGLE_COMM_PRECISION, comm );
+        TestGaps<double>( mpi::BFLOAT16_COMM_PRECISION, comm );
+        TestGaps<Complex<float>>( mpi::BFLOAT16_COMM_PRECISION, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
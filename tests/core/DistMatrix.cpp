@@ -157,6 +157,35 @@ void CheckAll( Int m, Int n, const Grid& g, bool print )
     }
 }
 
+template<typename T,Dist U,Dist V>
+void CheckMove( Int m, Int n, const Grid& g )
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckMove"))
+    OutputFromRoot
+    (g.Comm(),
+     "Testing moves of [",DistToString(U),",",DistToString(V),"] rvalues");
+    DistMatrix<T,U,V> A(g);
+    Uniform( A, m, n );
+    const T* ABuf = A.LockedBuffer();
+
+    // Moving through a type-erased rvalue should steal the buffer
+    ElementalMatrix<T>& AElem = A;
+    DistMatrix<T,U,V> B( std::move(AElem) );
+    DistMatrix<T,U,V> C(g);
+    C = std::move(static_cast<AbstractDistMatrix<T>&>(B));
+    if( C.Height() != m || C.Width() != n )
+        LogicError("Moved matrix had the wrong dimensions");
+    if( C.Participating() && C.LockedBuffer() != ABuf )
+        LogicError("Move of a conforming rvalue copied its buffer");
+
+    // So should a read proxy of a conforming rvalue
+    DistMatrixReadProxy<T,T,U,V> CProx( std::move(C) );
+    if( CProx.GetLocked().Participating() &&
+        CProx.GetLocked().LockedBuffer() != ABuf )
+        LogicError("Read proxy of a conforming rvalue copied its buffer");
+    OutputFromRoot(g.Comm(),"PASSED");
+}
+
 template<typename T>
 void
 DistMatrixTest( Int m, Int n, const Grid& g, bool print )
@@ -177,6 +206,10 @@ DistMatrixTest( Int m, Int n, const Grid& g, bool print )
     CheckAll<T,STAR,VR  >( m, n, g, print );
     CheckAll<T,VC,  STAR>( m, n, g, print );
     CheckAll<T,VR,  STAR>( m, n, g, print );
+
+    CheckMove<T,MC,  MR  >( m, n, g );
+    CheckMove<T,VC,  STAR>( m, n, g );
+    CheckMove<T,STAR,STAR>( m, n, g );
 }
 
 int 
@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the gathered member of a batch against a reference computed over
+// the full grid
+template<typename T>
+void Compare
+( const string& label, Int k,
+  const DistMatrixBatch<T>& batch, const DistMatrix<T>& ref )
+{
+    typedef Base<T> Real;
+    DistMatrix<T> X( ref.Grid() );
+    batch.Gather( k, X );
+    const Real refNorm = FrobeniusNorm( ref );
+    X -= ref;
+    const Real relErr = FrobeniusNorm( X ) / Max( refNorm, Real(1) );
+    const Real tol = Real(100)*ref.Height()*limits::Epsilon<Real>();
+    if( relErr > tol )
+        LogicError
+        (label," of member ",k," had relative error ",relErr," > ",tol);
+}
+
+template<typename F>
+void TestBatch( Int numMatrices, Int n, int groupSize, const Grid& g )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrixBatch<F> A( g, numMatrices, groupSize );
+    DistMatrixBatch<F> B(A), C(A), LUFact(A), CholFact(A);
+    DistMatrixBatch<Int> p(A);
+    DistMatrixBatch<Real> w(A);
+    OutputFromRoot
+    (g.Comm(),numMatrices," matrices over ",A.NumGroups(),
+     " groups of ",A.GroupSize()," processes");
+
+    vector<unique_ptr<DistMatrix<F>>> ARef(numMatrices), BRef(numMatrices);
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        ARef[k].reset( new DistMatrix<F>(g) );
+        BRef[k].reset( new DistMatrix<F>(g) );
+        HermitianUniformSpectrum( *ARef[k], n, Real(1), Real(10) );
+        Uniform( *BRef[k], n, n );
+        A.Scatter( k, *ARef[k] );
+        B.Scatter( k, *BRef[k] );
+    }
+    C.Resize( n, n );
+    for( const Int k : C.LocalIndices() )
+        Zero( C(k) );
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        LUFact.Scatter( k, *ARef[k] );
+        CholFact.Scatter( k, *ARef[k] );
+    }
+
+    Gemm( NORMAL, NORMAL, F(1), A, B, F(0), C );
+    Cholesky( LOWER, CholFact );
+    LU( LUFact, p );
+    HermitianEig( LOWER, A, w );
+
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        DistMatrix<F> CRef(g), CholRef(*ARef[k]), LURef(*ARef[k]);
+        Zeros( CRef, n, n );
+        Gemm( NORMAL, NORMAL, F(1), *ARef[k], *BRef[k], F(0), CRef );
+        Compare( "Gemm", k, C, CRef );
+
+        Cholesky( LOWER, CholRef );
+        MakeTrapezoidal( LOWER, CholRef );
+        DistMatrix<F> CholGathered(g);
+        CholFact.Gather( k, CholGathered );
+        MakeTrapezoidal( LOWER, CholGathered );
+        CholGathered -= CholRef;
+        const Real cholErr =
+          FrobeniusNorm( CholGathered ) / FrobeniusNorm( CholRef );
+        if( cholErr > Real(100)*n*limits::Epsilon<Real>() )
+            LogicError("Cholesky of member ",k," had relative error ",cholErr);
+
+        DistPermutation P(g);
+        LU( LURef, P );
+        Compare( "LU", k, LUFact, LURef );
+
+        DistMatrix<Real> wRef(g);
+        HermitianEig( LOWER, *ARef[k], wRef );
+        Compare( "HermitianEig", k, w, wRef );
+    }
+    OutputFromRoot(g.Comm(),"passed");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int numMatrices = Input("--numMatrices","size of batch",8);
+        const Int n = Input("--n","size of each matrix",50);
+        const Int groupSize = Input("--groupSize","processes per matrix",1);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        TestBatch<float>( numMatrices, n, groupSize, g );
+        TestBatch<Complex<float>>( numMatrices, n, groupSize, g );
+        TestBatch<double>( numMatrices, n, groupSize, g );
+        TestBatch<Complex<double>>( numMatrices, n, groupSize, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void CheckTile
+( const Matrix<double>& tile, const Matrix<double>& tileRef, string label )
+{
+    Matrix<double> E( tileRef );
+    E -= tile;
+    const double error = FrobeniusNorm( E );
+    const double frobRef = FrobeniusNorm( tileRef );
+    Output(label,": || tile - tileRef ||_F / || tileRef ||_F = ",
+           error/frobRef);
+    if( error > 1e-12*frobRef )
+        LogicError("Distributed tile did not match the sequential tile");
+}
+
+template<typename T>
+void TestDense( Int m, Int n, Int mPix, Int nPix, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing dense downsampling with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    // Zero a band of columns so that the density tile is nontrivial
+    auto ABand = A( ALL, IR(n/4,n/2) );
+    Zero( ABand );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+
+    const DownsampleMode modes[] = { DOWNSAMPLE_DENSITY, DOWNSAMPLE_MAX_ABS };
+    for( const auto mode : modes )
+    {
+        Matrix<double> tile, tileRef;
+        Downsample( A, tile, mPix, nPix, mode );
+        Downsample( A_STAR_STAR.LockedMatrix(), tileRef, mPix, nPix, mode );
+        if( tileRef.Height() != Min(m,mPix) || tileRef.Width() != Min(n,nPix) )
+            LogicError("Tile had the wrong dimensions");
+        // Only the owner of the distributed tile can check it
+        if( A.DistRank() == 0 && A.RedundantRank() == 0 )
+            CheckTile
+            ( tile, tileRef, mode==DOWNSAMPLE_DENSITY ? "density" : "max-abs" );
+    }
+    PopIndent();
+}
+
+template<typename T>
+void TestSparse( Int n1, Int n2, Int n3, Int nPix, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing sparse downsampling with ",TypeName<T>());
+    PushIndent();
+
+    DistSparseMatrix<T> A(comm);
+    Laplacian( A, n1, n2, n3 );
+    const int commRank = mpi::Rank( comm );
+
+    const DownsampleMode modes[] = { DOWNSAMPLE_DENSITY, DOWNSAMPLE_MAX_ABS };
+    for( const auto mode : modes )
+    {
+        Matrix<double> tile;
+        Downsample( A, tile, nPix, nPix, mode );
+        if( commRank == 0 )
+        {
+            SparseMatrix<T> ASeq;
+            CopyFromRoot( A, ASeq );
+            Matrix<T> ADense;
+            Copy( ASeq, ADense );
+            Matrix<double> tileSparse, tileDense;
+            Downsample( ASeq, tileSparse, nPix, nPix, mode );
+            Downsample( ADense, tileDense, nPix, nPix, mode );
+            CheckTile( tile, tileSparse, "sparse" );
+            CheckTile( tile, tileDense, "dense" );
+        }
+        else
+            CopyFromNonRoot( A, 0 );
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of dense matrix",300);
+        const Int n = Input("--n","width of dense matrix",200);
+        const Int mPix = Input("--mPix","height of the tile",64);
+        const Int nPix = Input("--nPix","width of the tile",48);
+        const Int n1 = Input("--n1","first grid dimension",8);
+        const Int n2 = Input("--n2","second grid dimension",8);
+        const Int n3 = Input("--n3","third grid dimension",8);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestDense<double>( m, n, mPix, nPix, g );
+        TestDense<Complex<double>>( m, n, mPix, nPix, g );
+        TestSparse<double>( n1, n2, n3, nPix, comm );
+        TestSparse<Complex<double>>( n1, n2, n3, nPix, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
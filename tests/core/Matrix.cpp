@@ -38,6 +38,72 @@ void TestMatrix( Int m, Int n, Int ldim )
     Output("passed");
 }
 
+// With padded leading dimensions enabled, checks the leading dimension of a
+// freshly allocated matrix and that the matrix collectives, which must pack
+// the non-contiguous columns, as well as a round trip through a DistMatrix,
+// preserve every entry
+template<typename T>
+void TestPadding( Int m, Int n, const Grid& g )
+{
+    mpi::Comm comm = g.Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    OutputFromRoot
+    (comm,"Testing padded leading dimensions with ",TypeName<T>());
+    EnableLDimPadding();
+
+    Matrix<T> A( m, n );
+    if( A.LDim() != DefaultLDim<T>(m) || A.LDim() < Max(m,1) )
+        LogicError("Unexpected leading dimension of ",A.LDim());
+    const Int entriesPerLine = CACHE_LINE_SIZE / sizeof(T);
+    if( CACHE_LINE_SIZE % sizeof(T) == 0 && m >= 4*entriesPerLine &&
+        A.LDim() % entriesPerLine != 0 )
+        LogicError("Leading dimension of ",A.LDim()," was not padded");
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A(i,j) = T(i+j*m+commRank);
+
+    // Broadcast the root's entries
+    Matrix<T> B( A );
+    Broadcast( B, comm, 0 );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( B(i,j) != T(i+j*m) )
+                LogicError("Broadcast of a padded matrix was incorrect");
+
+    // Sum the entries over the team
+    B = A;
+    AllReduce( B, comm );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( B(i,j) != T(commSize*(i+j*m)+commSize*(commSize-1)/2) )
+                LogicError("AllReduce of a padded matrix was incorrect");
+
+    // Shift the entries around a ring
+    const int sendRank = Mod( commRank+1, commSize );
+    const int recvRank = Mod( commRank-1, commSize );
+    Zeros( B, m, n );
+    SendRecv( A, B, comm, sendRank, recvRank );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( B(i,j) != T(i+j*m+recvRank) )
+                LogicError("SendRecv of a padded matrix was incorrect");
+
+    // Redistribute the root's entries
+    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( m, n, g );
+    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+        A_CIRC_CIRC.Matrix() = A;
+    DistMatrix<T> ADist( A_CIRC_CIRC );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( ADist );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != T(i+j*m) )
+                LogicError("Redistribution of a padded matrix was incorrect");
+
+    DisableLDimPadding();
+    OutputFromRoot(comm,"passed");
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -74,6 +140,12 @@ main( int argc, char* argv[] )
             TestMatrix<Complex<BigFloat>>( m, n, ldim );
 #endif
         }
+
+        const Grid g( mpi::COMM_WORLD );
+        TestPadding<float>( m, n, g );
+        TestPadding<Complex<float>>( m, n, g );
+        TestPadding<double>( m, n, g );
+        TestPadding<Complex<double>>( m, n, g );
     }
     catch( std::exception& e ) { ReportException(e); }
 
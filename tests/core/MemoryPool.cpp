@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestMemoryPool( Int m, Int n, Int numRepeats )
+{
+    Output("Testing with ",TypeName<T>());
+
+    EnableMemoryPool();
+    {
+        Matrix<T> A( m, n );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                A.Set( i, j, T(i+j*m) );
+        const size_t residentBytes = MemoryPoolResidentBytes();
+        if( residentBytes < size_t(m*n)*sizeof(T) )
+            LogicError("Pool did not account for the matrix buffer");
+
+        // Repeatedly allocating and freeing the same size should not
+        // increase the resident footprint
+        for( Int repeat=0; repeat<numRepeats; ++repeat )
+        {
+            Matrix<T> B( A );
+            if( B.Get(m-1,n-1) != A.Get(m-1,n-1) )
+                LogicError("Copy of pooled matrix was incorrect");
+        }
+        if( MemoryPoolResidentBytes() > 2*residentBytes )
+            LogicError("Pooled buffers were not reused");
+    }
+    ReleaseMemoryPool();
+    if( MemoryPoolResidentBytes() != 0 )
+        LogicError("Released pool still holds memory");
+    if( MemoryPoolPeakBytes() < size_t(m*n)*sizeof(T) )
+        LogicError("Peak pool usage was not tracked");
+
+    // Buffers drawn from the pool must still be freed after disabling it
+    Matrix<T> C( m, n );
+    DisableMemoryPool();
+    C.Empty();
+    if( MemoryPoolResidentBytes() != 0 )
+        LogicError("Buffer freed after disabling pool was not released");
+
+    Output("passed");
+}
+
+template<typename T>
+void TestFootprint( Int m, Int n )
+{
+    Output("Testing footprint accounting with ",TypeName<T>());
+
+    EnableMemoryTracking();
+    const size_t liveBytes = MemoryLiveBytes();
+    ResetMemoryPeak();
+    {
+        Matrix<T> A( m, n, m );
+        if( MemoryLiveBytes() != liveBytes+size_t(m*n)*sizeof(T) )
+            LogicError("Live footprint did not account for the matrix");
+    }
+    if( MemoryLiveBytes() != liveBytes )
+        LogicError("Live footprint did not account for the freed matrix");
+    if( MemoryPeakBytes() < liveBytes+size_t(m*n)*sizeof(T) )
+        LogicError("Peak footprint was not tracked");
+    ResetMemoryPeak();
+    if( MemoryPeakBytes() != liveBytes )
+        LogicError("Peak footprint was not reset");
+    DisableMemoryTracking();
+
+    ostringstream os;
+    PrintMemoryReport( os );
+    if( os.str().empty() )
+        LogicError("Memory report was empty");
+
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int numRepeats = Input("--numRepeats","number of repeats",10);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestMemoryPool<float>( m, n, numRepeats );
+            TestFootprint<float>( m, n );
+            TestMemoryPool<Complex<float>>( m, n, numRepeats );
+            TestFootprint<Complex<float>>( m, n );
+
+            TestMemoryPool<double>( m, n, numRepeats );
+            TestFootprint<double>( m, n );
+            TestMemoryPool<Complex<double>>( m, n, numRepeats );
+            TestFootprint<Complex<double>>( m, n );
+
+#ifdef EL_HAVE_QD
+            TestMemoryPool<DoubleDouble>( m, n, numRepeats );
+            TestMemoryPool<QuadDouble>( m, n, numRepeats );
+#endif
+
+#ifdef EL_HAVE_QUAD
+            TestMemoryPool<Quad>( m, n, numRepeats );
+            TestMemoryPool<Complex<Quad>>( m, n, numRepeats );
+#endif
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
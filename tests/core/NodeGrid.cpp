@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const bool localCols = Input("--localCols","node-local columns?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const GridLayout layout =
+          ( localCols ? NODE_LOCAL_COLS : NODE_LOCAL_ROWS );
+        const Grid grid( comm, order ), nodeGrid( comm, layout, order );
+        grid.PrintTopology();
+        nodeGrid.PrintTopology();
+        if( nodeGrid.IntraNodeSize(localCols ? MC : MR) > 1 &&
+            !nodeGrid.NodeLocal(localCols ? MC : MR) )
+            LogicError("Requested communicators were not node-local");
+
+        // Redistributing to and within the node-aware grid should be exact
+        DistMatrix<double> A(grid), ANode(nodeGrid), B(nodeGrid);
+        Uniform( A, m, n );
+        ANode = A;
+        if( print )
+            Print( ANode, "ANode" );
+        DistMatrix<double,STAR,MR> ANode_STAR_MR( ANode );
+        DistMatrix<double,MC,STAR> ANode_MC_STAR( ANode );
+        B = ANode_STAR_MR;
+        B -= ANode;
+        const double errorRow = FrobeniusNorm( B );
+        B = ANode_MC_STAR;
+        B -= ANode;
+        const double errorCol = FrobeniusNorm( B );
+        DistMatrix<double> ABack(grid);
+        ABack = ANode;
+        ABack -= A;
+        if( FrobeniusNorm( ABack ) != 0. )
+            LogicError("Copying between grids changed the matrix");
+        OutputFromRoot
+        (comm,"|| ANode - [*,MR] ||_F = ",errorRow,
+         ", || ANode - [MC,*] ||_F = ",errorCol);
+        if( errorRow != 0. || errorCol != 0. )
+            LogicError("Redistribution over the node-aware grid failed");
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual( const vector<T>& x, const vector<T>& y, const string& name )
+{
+    for( size_t k=0; k<x.size(); ++k )
+        if( x[k] != y[k] )
+            LogicError("Non-blocking ",name," disagreed with the blocking one");
+}
+
+template<typename T>
+void TestNonblocking( Int count, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    PushIndent();
+
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int total = count*commSize;
+    vector<T> sendBuf( total );
+    for( Int k=0; k<total; ++k )
+        sendBuf[k] = T(commRank*total+k);
+
+    // AllReduce
+    vector<T> blocking( total ), nonblocking( total );
+    mpi::AllReduce( sendBuf.data(), blocking.data(), total, comm );
+    mpi::Request<T> request;
+    mpi::IAllReduce( sendBuf.data(), nonblocking.data(), total, comm, request );
+    mpi::Wait( request );
+    CheckEqual( blocking, nonblocking, "AllReduce" );
+
+    // In-place AllReduce
+    nonblocking = sendBuf;
+    mpi::IAllReduce( nonblocking.data(), total, comm, request );
+    mpi::Wait( request );
+    CheckEqual( blocking, nonblocking, "in-place AllReduce" );
+
+    // AllToAll
+    mpi::AllToAll( sendBuf.data(), count, blocking.data(), count, comm );
+    mpi::IAllToAll
+    ( sendBuf.data(), count, nonblocking.data(), count, comm, request );
+    mpi::Wait( request );
+    CheckEqual( blocking, nonblocking, "AllToAll" );
+
+    // AllToAll with (uniform) counts and displacements
+    vector<int> counts( commSize, count ), offsets;
+    Scan( counts, offsets );
+    mpi::IAllToAll
+    ( sendBuf.data(), counts.data(), offsets.data(),
+      nonblocking.data(), counts.data(), offsets.data(), comm, request );
+    mpi::Wait( request );
+    CheckEqual( blocking, nonblocking, "variable AllToAll" );
+
+    // ReduceScatter
+    vector<T> sendCopy( sendBuf );
+    blocking.resize( count );
+    nonblocking.resize( count );
+    mpi::ReduceScatter( sendCopy.data(), blocking.data(), count, comm );
+    sendCopy = sendBuf;
+    mpi::IReduceScatter
+    ( sendCopy.data(), nonblocking.data(), count, comm, request );
+    mpi::Wait( request );
+    CheckEqual( blocking, nonblocking, "ReduceScatter" );
+
+    OutputFromRoot(comm,"passed");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int count = Input("--count","entries per process",100);
+        ProcessInput();
+        PrintInputReport();
+
+        TestNonblocking<int>( count, comm );
+        TestNonblocking<float>( count, comm );
+        TestNonblocking<Complex<float>>( count, comm );
+        TestNonblocking<double>( count, comm );
+        TestNonblocking<Complex<double>>( count, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
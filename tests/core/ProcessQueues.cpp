@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Queues duplicate and remote updates and pulls of a DistMatrix with
+// nonzero alignments (or a nonzero root) and checks the results of
+// ProcessQueues and ProcessPullQueue against applying the same updates one
+// at a time with Update and reading the entries with Get.
+
+// The k'th update queued by process 'rank'. Every process repeatedly updates
+// the (0,0) entry, and the other updates come in pairs with the same target.
+template<typename T>
+Entry<T> QueuedUpdate( int rank, Int k, Int m, Int n )
+{
+    if( k % 5 == 0 )
+        return Entry<T>{ 0, 0, T(1) };
+    const Int kHalf = k/2;
+    return Entry<T>{ (3*rank+5*kHalf) % m, (rank+7*kHalf) % n,
+                     T(rank+1+kHalf%3) };
+}
+
+template<typename T,Dist U,Dist V>
+void TestQueues
+( Int m, Int n, Int numUpdates, bool includeViewers, const Grid& g )
+{
+    mpi::Comm comm = g.Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    DistMatrix<T,U,V> A(g), B(g);
+    if( U == CIRC && V == CIRC )
+        A.SetRoot( Mod(1,commSize) );
+    else
+        A.Align( Mod(1,A.ColStride()), Mod(2,A.RowStride()) );
+    Zeros( A, m, n );
+    Zeros( B, m, n );
+
+    // Queue the updates, then apply those of every process one at a time
+    A.Reserve( numUpdates );
+    for( Int k=0; k<numUpdates; ++k )
+        A.QueueUpdate( QueuedUpdate<T>( commRank, k, m, n ) );
+    A.ProcessQueues( includeViewers );
+    for( int q=0; q<commSize; ++q )
+        for( Int k=0; k<numUpdates; ++k )
+            B.Update( QueuedUpdate<T>( q, k, m, n ) );
+
+    Int numMismatches = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+                ++numMismatches;
+    if( numMismatches != 0 )
+        LogicError
+        ("ProcessQueues for ",DistToString(U),",",DistToString(V),
+         " had ",numMismatches," mismatched entries");
+
+    // Pull entries (with repeats) that are mostly owned by other processes
+    const Int numPulls = 2*numUpdates;
+    A.ReservePulls( numPulls );
+    for( Int k=0; k<numPulls; ++k )
+        A.QueuePull( (commRank+2*k) % m, (5*commRank+k/2) % n );
+    vector<T> pulls;
+    A.ProcessPullQueue( pulls, includeViewers );
+
+    DistMatrix<T,STAR,STAR> B_STAR_STAR( B );
+    Int numLocalMismatches = 0;
+    for( Int k=0; k<numPulls; ++k )
+    {
+        const Int i = (commRank+2*k) % m;
+        const Int j = (5*commRank+k/2) % n;
+        if( pulls[k] != B_STAR_STAR.GetLocal(i,j) )
+            ++numLocalMismatches;
+    }
+    numMismatches = mpi::AllReduce( numLocalMismatches, comm );
+    if( numMismatches != 0 )
+        LogicError
+        ("ProcessPullQueue for ",DistToString(U),",",DistToString(V),
+         " had ",numMismatches," mismatched entries");
+}
+
+template<typename T>
+void TestAllDists( Int m, Int n, Int numUpdates, const Grid& g )
+{
+    mpi::Comm comm = g.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    PushIndent();
+    for( const bool includeViewers : { true, false } )
+    {
+        TestQueues<T,MC,  MR  >( m, n, numUpdates, includeViewers, g );
+        TestQueues<T,MR,  MC  >( m, n, numUpdates, includeViewers, g );
+        TestQueues<T,MC,  STAR>( m, n, numUpdates, includeViewers, g );
+        TestQueues<T,STAR,MR  >( m, n, numUpdates, includeViewers, g );
+        TestQueues<T,VC,  STAR>( m, n, numUpdates, includeViewers, g );
+        TestQueues<T,STAR,VR  >( m, n, numUpdates, includeViewers, g );
+        TestQueues<T,CIRC,CIRC>( m, n, numUpdates, includeViewers, g );
+        OutputFromRoot
+        (comm,"includeViewers=",includeViewers," passed");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--m","height of matrix",23);
+        const Int n = Input("--n","width of matrix",17);
+        const Int numUpdates =
+          Input("--numUpdates","number of updates per process",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+
+        // Sweep a column of processes, the default grid, and a row
+        const int commSize = mpi::Size( comm );
+        vector<int> gridHeights = { 1, gridHeight, commSize };
+        std::sort( gridHeights.begin(), gridHeights.end() );
+        gridHeights.erase
+        ( std::unique( gridHeights.begin(), gridHeights.end() ),
+          gridHeights.end() );
+        for( const int height : gridHeights )
+        {
+            const Grid g( comm, height );
+            OutputFromRoot
+            (comm,"Testing over a ",g.Height()," x ",g.Width()," grid");
+            TestAllDists<double>( m, n, numUpdates, g );
+            TestAllDists<Complex<double>>( m, n, numUpdates, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
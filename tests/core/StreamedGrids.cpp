@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void TestStreamed
+( const DistMatrix<T>& A, const Grid& gridB, Int panelWidth, bool print )
+{
+    const Grid& gridA = A.Grid();
+    DistMatrix<T,U,V> AFrom( A ), B(gridB), BDirect(gridB);
+    copy::TranslateBetweenGrids( AFrom, BDirect );
+
+    // Compute the Frobenius norm of each panel as it arrives
+    typedef Base<T> Real;
+    Real sumSquares = 0;
+    Int numPanels = 0;
+    auto onPanel =
+      [&]( Range<Int> J )
+      {
+          if( B.Participating() )
+          {
+              auto BPanel = B( ALL, J );
+              const Real panelNorm = FrobeniusNorm( BPanel );
+              sumSquares += panelNorm*panelNorm;
+          }
+          ++numPanels;
+      };
+    copy::TranslateBetweenGrids( AFrom, B, panelWidth, onPanel );
+    if( B.Participating() )
+    {
+        if( print )
+            Print( B, "B" );
+        DistMatrix<T,U,V> E( B );
+        E -= BDirect;
+        const Real error = FrobeniusNorm( E );
+        const Real normB = FrobeniusNorm( BDirect );
+        if( error != Real(0) )
+            LogicError("Streamed translation differed by ",error);
+        if( Abs(Sqrt(sumSquares)-normB) > 10*limits::Epsilon<Real>()*normB )
+            LogicError("Panel callbacks did not see the translated panels");
+    }
+    OutputFromRoot
+    (gridA.Comm(),"[",DistToString(U),",",DistToString(V),"]: ",numPanels,
+     " panels passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        const Int panelWidth = Input("--panelWidth","width of panels",16);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // Translate from the full grid onto a grid over the first half
+        // of the processes (or the single process)
+        const int sizeB = Max( commSize/2, 1 );
+        vector<int> ranksB( sizeB );
+        for( int q=0; q<sizeB; ++q )
+            ranksB[q] = q;
+        mpi::Group group, groupB;
+        mpi::CommGroup( comm, group );
+        mpi::Incl( group, sizeB, ranksB.data(), groupB );
+        const Grid gridA( comm ),
+                   gridB( comm, groupB, Grid::FindFactor(sizeB) );
+
+        DistMatrix<double> A(gridA);
+        Uniform( A, m, n );
+        TestStreamed<double,MC,MR>( A, gridB, panelWidth, print );
+        TestStreamed<double,STAR,STAR>( A, gridB, panelWidth, print );
+
+        mpi::Free( groupB );
+        mpi::Free( group );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
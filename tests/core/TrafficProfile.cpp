@@ -0,0 +1,58 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","height of matrix",100);
+        const bool print = Input("--print","print the profile?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        DistMatrix<double> A(g), B(g), C(g);
+        Uniform( A, n, n );
+        Uniform( B, n, n );
+        Zeros( C, n, n );
+
+        mpi::EnableTrafficProfiling();
+        Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+        const double frobNorm = FrobeniusNorm( C );
+        mpi::DisableTrafficProfiling();
+        mpi::AllReduce( frobNorm, comm );
+
+        std::ostringstream os;
+        mpi::PrintTrafficProfile( os );
+        const string profile = os.str();
+        if( print && mpi::Rank(comm) == 0 )
+            cout << profile;
+        if( mpi::Size(comm) > 1 &&
+            profile.find("\"op\": \"AllReduce\"") == string::npos )
+            LogicError("The profile did not record the AllReduce");
+
+        // Nothing should be recorded while profiling is disabled
+        mpi::ResetTrafficProfile();
+        mpi::AllReduce( frobNorm, comm );
+        std::ostringstream emptyOS;
+        mpi::PrintTrafficProfile( emptyOS );
+        if( emptyOS.str().find("\"calls\"") != string::npos )
+            LogicError("Traffic was recorded while profiling was disabled");
+        OutputFromRoot(comm,"passed");
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
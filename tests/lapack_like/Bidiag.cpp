@@ -99,6 +99,7 @@ void TestCorrectness
 ( const DistMatrix<F>& A, 
   const DistMatrix<F,STAR,STAR>& householderScalarsP,
   const DistMatrix<F,STAR,STAR>& householderScalarsQ,
+  const bidiag::BulgeReflectors<F>& bulgeReflectors,
         DistMatrix<F>& AOrig,
   bool print,
   bool display )
@@ -132,8 +133,10 @@ void TestCorrectness
         DistMatrix<F> Q(g), P(g);
         Identity( Q, m, m );
         Identity( P, n, n );
-        bidiag::ApplyQ( LEFT,  NORMAL, A, householderScalarsQ, Q );
-        bidiag::ApplyP( RIGHT, NORMAL, A, householderScalarsP, P );
+        bidiag::ApplyQ
+        ( LEFT,  NORMAL, A, householderScalarsQ, bulgeReflectors, Q );
+        bidiag::ApplyP
+        ( RIGHT, NORMAL, A, householderScalarsP, bulgeReflectors, P );
         if( print )
         {
             Print( Q, "Q" );
@@ -147,8 +150,10 @@ void TestCorrectness
     }
 
     // Reverse the accumulated Householder transforms
-    bidiag::ApplyQ( LEFT,  ADJOINT, A, householderScalarsQ, AOrig );
-    bidiag::ApplyP( RIGHT, NORMAL,  A, householderScalarsP, AOrig );
+    bidiag::ApplyQ
+    ( LEFT,  ADJOINT, A, householderScalarsQ, bulgeReflectors, AOrig );
+    bidiag::ApplyP
+    ( RIGHT, NORMAL,  A, householderScalarsP, bulgeReflectors, AOrig );
     if( print )
         Print( AOrig, "Manual bidiagonal" );
     if( display )
@@ -229,32 +234,27 @@ void TestBidiag
 }
 
 template<typename F>
-void TestBidiag
-( const Grid& g,
-  Int m,
-  Int n,
+void InnerTestBidiag
+( DistMatrix<F>& A,
+  const BidiagCtrl& ctrl,
   bool correctness,
   bool print,
   bool display )
 {
-    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
-    PushIndent();
-    DistMatrix<F> A(g), AOrig(g);
+    const Grid& g = A.Grid();
+    DistMatrix<F> AOrig(g);
     DistMatrix<F,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
+    bidiag::BulgeReflectors<F> bulgeReflectors;
 
-    Uniform( A, m, n );
     if( correctness )
         AOrig = A;
-    if( print )
-        Print( A, "A" );
-    if( display )
-        Display( A, "A" );
 
     OutputFromRoot(g.Comm(),"Starting bidiagonalization");
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    Bidiag
+    ( A, householderScalarsP, householderScalarsQ, bulgeReflectors, ctrl );
     mpi::Barrier( g.Comm() );
     // TODO: Flop calculation
     OutputFromRoot(g.Comm(),"Time = ",timer.Stop()," seconds.");
@@ -272,7 +272,40 @@ void TestBidiag
     }
     if( correctness )
         TestCorrectness
-        ( A, householderScalarsP, householderScalarsQ, AOrig, print, display );
+        ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+          AOrig, print, display );
+}
+
+template<typename F>
+void TestBidiag
+( const Grid& g,
+  Int m,
+  Int n,
+  Int bandwidth,
+  bool correctness,
+  bool print,
+  bool display )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    DistMatrix<F> A(g), ACopy(g);
+    BidiagCtrl ctrl;
+
+    Uniform( A, m, n );
+    ACopy = A;
+    if( print )
+        Print( A, "A" );
+    if( display )
+        Display( A, "A" );
+
+    OutputFromRoot(g.Comm(),"One-stage algorithm:");
+    InnerTestBidiag( A, ctrl, correctness, print, display );
+    A = ACopy;
+
+    OutputFromRoot(g.Comm(),"Two-stage algorithm:");
+    ctrl.twoStage = true;
+    ctrl.bandwidth = bandwidth;
+    InnerTestBidiag( A, ctrl, correctness, print, display );
     PopIndent();
 }
 
@@ -289,6 +322,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int bandwidth =
+          Input("--bandwidth","bandwidth of two-stage reduction",8);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness = 
           Input("--correctness","test correctness?",true);
@@ -350,38 +385,38 @@ main( int argc, char* argv[] )
         }
 
         TestBidiag<float>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<float>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 
         TestBidiag<double>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<double>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 
 #ifdef EL_HAVE_QD
         TestBidiag<DoubleDouble>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<QuadDouble>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<DoubleDouble>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<QuadDouble>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestBidiag<Quad>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<Quad>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestBidiag<BigFloat>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<BigFloat>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// || A X - X diag(w) ||_F / (|| w ||_max || X ||_F)
+template<typename F,typename G>
+Base<F> RelativeResidual
+( const DistSparseMatrix<G>& A,
+  const Matrix<F>& w,
+  const DistMultiVec<F>& X )
+{
+    typedef Base<F> Real;
+    DistSparseMatrix<F> AF(A.Comm());
+    Copy( A, AF );
+    DistMultiVec<F> R(A.Comm());
+    Zeros( R, X.Height(), X.Width() );
+    Multiply( NORMAL, F(1), AF, X, F(0), R );
+    auto& RLoc = R.Matrix();
+    const auto& XLoc = X.LockedMatrix();
+    Real wMax = 0;
+    for( Int j=0; j<X.Width(); ++j )
+    {
+        wMax = Max( wMax, Abs(w(j)) );
+        for( Int iLoc=0; iLoc<XLoc.Height(); ++iLoc )
+            RLoc(iLoc,j) -= XLoc(iLoc,j)*w(j);
+    }
+    return FrobeniusNorm(R) / (wMax*FrobeniusNorm(X));
+}
+
+template<typename F>
+void TestBlockKrylov
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numWanted,
+  Int blockSize,
+  Int maxBasisSize,
+  bool print,
+  mpi::Comm& comm )
+{
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    PushIndent();
+
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, n1, n2, n3 );
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = Pow(eps,Real(0.5));
+
+    BlockKrylovCtrl<Real> ctrl;
+    ctrl.numWanted = numWanted;
+    ctrl.blockSize = blockSize;
+    ctrl.maxBasisSize = maxBasisSize;
+
+    Timer timer;
+    {
+        Matrix<Real> w;
+        DistMultiVec<F> X(comm);
+        timer.Start();
+        auto info = BlockLanczos( A, w, X, ctrl );
+        OutputFromRoot
+        (comm,"Block Lanczos: ",timer.Stop()," seconds, ",info.numConverged,
+         " converged after ",info.numRestarts," restarts");
+        if( print && mpi::Rank(comm) == 0 )
+            Print( w, "largest eigenvalues" );
+        Matrix<F> wF;
+        Copy( w, wF );
+        const Real relResid = RelativeResidual( A, wF, X );
+        OutputFromRoot(comm,"|| A X - X W ||_F / || W ||_max || X ||_F = ",
+          relResid);
+        if( relResid > tol )
+            LogicError("Unacceptably large relative residual");
+    }
+    {
+        auto siCtrl = ctrl;
+        siCtrl.shiftInvert = true;
+        siCtrl.shift = Real(0);
+        Matrix<Real> w;
+        DistMultiVec<F> X(comm);
+        timer.Start();
+        auto info = BlockLanczos( A, w, X, siCtrl );
+        OutputFromRoot
+        (comm,"Shift-invert block Lanczos: ",timer.Stop()," seconds, ",
+         info.numConverged," converged after ",info.numRestarts," restarts");
+        if( print && mpi::Rank(comm) == 0 )
+            Print( w, "eigenvalues nearest zero" );
+        Matrix<F> wF;
+        Copy( w, wF );
+        const Real relResid = RelativeResidual( A, wF, X );
+        OutputFromRoot(comm,"|| A X - X W ||_F / || W ||_max || X ||_F = ",
+          relResid);
+        if( relResid > tol )
+            LogicError("Unacceptably large relative residual");
+    }
+    {
+        Matrix<C> w;
+        DistMultiVec<C> X(comm);
+        timer.Start();
+        auto info = KrylovSchur( A, w, X, ctrl );
+        OutputFromRoot
+        (comm,"Block Krylov-Schur: ",timer.Stop()," seconds, ",
+         info.numConverged," converged after ",info.numRestarts," restarts");
+        if( print && mpi::Rank(comm) == 0 )
+            Print( w, "largest eigenvalues" );
+        const Real relResid = RelativeResidual( A, w, X );
+        OutputFromRoot(comm,"|| A X - X W ||_F / || W ||_max || X ||_F = ",
+          relResid);
+        if( relResid > tol )
+            LogicError("Unacceptably large relative residual");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numWanted = Input("--numWanted","number of eigenpairs",6);
+        const Int blockSize = Input("--blockSize","Krylov block size",2);
+        const Int maxBasisSize = Input("--maxBasis","maximum basis size",0);
+        const bool print = Input("--print","print eigenvalues?",false);
+        const bool padLDims =
+          Input("--padLDims","also test padded leading dimensions?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        TestBlockKrylov<double>
+        ( n1, n2, n3, numWanted, blockSize, maxBasisSize, print, comm );
+        TestBlockKrylov<Complex<double>>
+        ( n1, n2, n3, numWanted, blockSize, maxBasisSize, print, comm );
+        if( padLDims )
+        {
+            OutputFromRoot(comm,"Testing with padded leading dimensions");
+            EnableLDimPadding();
+            TestBlockKrylov<double>
+            ( n1, n2, n3, numWanted, blockSize, maxBasisSize, print, comm );
+            TestBlockKrylov<Complex<double>>
+            ( n1, n2, n3, numWanted, blockSize, maxBasisSize, print, comm );
+            DisableLDimPadding();
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -139,7 +139,7 @@ void TestCholesky
   bool print,
   bool printDiag,
   bool correctness,
-  bool scalapack )
+  const CholeskyCtrl& ctrl )
 {
     OutputFromRoot(g.Comm(),"Testing distributed Cholesky with ",TypeName<F>());
     PushIndent();
@@ -154,7 +154,7 @@ void TestCholesky
     if( print )
         Print( A, "A" );
 
-    if( scalapack && !pivot )
+    if( ctrl.scalapack && !pivot )
         OutputFromRoot
         (g.Comm(),"ScaLAPACK Cholesky (including round-trip conversion)...");
     else
@@ -165,7 +165,7 @@ void TestCholesky
     if( pivot )
         Cholesky( uplo, A, p );
     else
-        Cholesky( uplo, A, scalapack );
+        Cholesky( uplo, A, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -208,6 +208,7 @@ main( int argc, char* argv[] )
         const bool print = Input("--print","print matrices?",false);
         const bool printDiag = Input("--printDiag","print diag of fact?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const Int lookAhead = Input("--lookAhead","look-ahead depth",0);
 #ifdef EL_HAVE_SCALAPACK
         const bool scalapack = Input("--scalapack","test ScaLAPACK?",false);
 #else
@@ -230,6 +231,10 @@ main( int argc, char* argv[] )
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
 
+        CholeskyCtrl ctrl;
+        ctrl.scalapack = scalapack;
+        ctrl.lookAhead = lookAhead;
+
         ComplainIfDebug();
 
         if( sequential && mpi::Rank(comm) == 0 )
@@ -272,49 +277,49 @@ main( int argc, char* argv[] )
 
         TestCholesky<float>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<float>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<double>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<double>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
 
 #ifdef EL_HAVE_QD
         TestCholesky<DoubleDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<QuadDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
 
         TestCholesky<Complex<DoubleDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<QuadDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestCholesky<Quad>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<Quad>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestCholesky<BigFloat>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<BigFloat>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
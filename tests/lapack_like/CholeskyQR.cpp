@@ -53,15 +53,27 @@ void TestCorrectness
         LogicError("Relative error was unacceptably large");
 }
 
+string VariantName( CholeskyQRVariant variant )
+{
+    if( variant == CHOLESKY_QR )
+        return "CholeskyQR";
+    else if( variant == CHOLESKY_QR2 )
+        return "CholeskyQR2";
+    else
+        return "shifted CholeskyQR3";
+}
+
 template<typename F>
 void TestQR
 ( const Grid& g,
   Int m, 
   Int n,
+  CholeskyQRVariant variant,
   bool testCorrectness,
   bool print )
 {
-    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    OutputFromRoot
+    (g.Comm(),"Testing ",VariantName(variant)," with ",TypeName<F>());
     PushIndent();
     DistMatrix<F,VC,STAR> A(g), Q(g);
     DistMatrix<F,STAR,STAR> R(g);
@@ -71,16 +83,23 @@ void TestQR
         Print( A, "A" );
     Q = A;
 
+    CholeskyQRCtrl<Base<F>> ctrl;
+    ctrl.variant = variant;
+
     OutputFromRoot(g.Comm(),"Starting Cholesky QR factorization");
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    qr::Cholesky( Q, R );
+    qr::Cholesky( Q, R, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double mD = double(m);
     const double nD = double(n);
-    const double gFlops = (2.*mD*nD*nD + 1./3.*nD*nD*nD)/(1.e9*runTime);
+    const double numPasses =
+      ( variant == CHOLESKY_QR ? 1. :
+        variant == CHOLESKY_QR2 ? 2. : 3. );
+    const double gFlops =
+      numPasses*(2.*mD*nD*nD + 1./3.*nD*nD*nD)/(1.e9*runTime);
     OutputFromRoot(g.Comm(),"Time: ",runTime," seconds (",gFlops," GFlop/s)");
     if( print )
     {
@@ -122,26 +141,32 @@ main( int argc, char* argv[] )
         SetBlocksize( nb );
         ComplainIfDebug();
 
-        TestQR<float>( g, m, n, testCorrectness, print );
-        TestQR<Complex<float>>( g, m, n, testCorrectness, print );
+        const CholeskyQRVariant variants[] =
+          { CHOLESKY_QR, CHOLESKY_QR2, SHIFTED_CHOLESKY_QR3 };
+        for( const CholeskyQRVariant variant : variants )
+        {
+            TestQR<float>( g, m, n, variant, testCorrectness, print );
+            TestQR<Complex<float>>( g, m, n, variant, testCorrectness, print );
 
-        TestQR<double>( g, m, n, testCorrectness, print );
-        TestQR<Complex<double>>( g, m, n, testCorrectness, print );
+            TestQR<double>( g, m, n, variant, testCorrectness, print );
+            TestQR<Complex<double>>( g, m, n, variant, testCorrectness, print );
 
 #ifdef EL_HAVE_QD
-        TestQR<DoubleDouble>( g, m, n, testCorrectness, print );
-        TestQR<QuadDouble>( g, m, n, testCorrectness, print );
+            TestQR<DoubleDouble>( g, m, n, variant, testCorrectness, print );
+            TestQR<QuadDouble>( g, m, n, variant, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestQR<Quad>( g, m, n, testCorrectness, print );
-        TestQR<Complex<Quad>>( g, m, n, testCorrectness, print );
+            TestQR<Quad>( g, m, n, variant, testCorrectness, print );
+            TestQR<Complex<Quad>>( g, m, n, variant, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestQR<BigFloat>( g, m, n, testCorrectness, print );
-        TestQR<Complex<BigFloat>>( g, m, n, testCorrectness, print );
+            TestQR<BigFloat>( g, m, n, variant, testCorrectness, print );
+            TestQR<Complex<BigFloat>>
+            ( g, m, n, variant, testCorrectness, print );
 #endif
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,268 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Equilibrates a sparse matrix whose rows and columns are scaled over many
+// orders of magnitude with RuizEquil and GeomEquil, checks the extrema of
+// each row and column of the result, and checks that the Matrix, DistMatrix,
+// SparseMatrix, and DistSparseMatrix versions agree.
+
+template<typename F>
+F Value( Int i, Int j, Int n )
+{
+    typedef Base<F> Real;
+    if( (i+2*j) % 3 != 0 && i % n != j )
+        return F(0);
+    const Real rowScale = Pow( Real(10), Real((i%9)-4) );
+    const Real colScale = Pow( Real(10), Real((j%7)-3) );
+    const Real sign = ( (i+j) % 2 ? Real(-1) : Real(1) );
+    const Real magnitude = (1 + Real((7*i+3*j)%5)/Real(4)) / Real(2);
+    F phase(1);
+    if( IsComplex<F>::value )
+        SetImagPart( phase, Real(i%2) );
+    return rowScale*colScale*sign*magnitude*phase/Abs(phase);
+}
+
+template<typename F>
+void BuildMatrices
+( Int m, Int n,
+  Matrix<F>& A, DistMatrix<F>& ADist,
+  SparseMatrix<F>& ASparse, DistSparseMatrix<F>& ADistSparse )
+{
+    Zeros( A, m, n );
+    ASparse.Resize( m, n );
+    for( Int i=0; i<m; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            const F value = Value<F>( i, j, n );
+            A(i,j) = value;
+            if( value != F(0) )
+                ASparse.QueueUpdate( i, j, value );
+        }
+    }
+    ASparse.ProcessQueues();
+
+    Zeros( ADist, m, n );
+    for( Int jLoc=0; jLoc<ADist.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<ADist.LocalHeight(); ++iLoc )
+            ADist.SetLocal
+            ( iLoc, jLoc,
+              Value<F>( ADist.GlobalRow(iLoc), ADist.GlobalCol(jLoc), n ) );
+
+    ADistSparse.Resize( m, n );
+    for( Int iLoc=0; iLoc<ADistSparse.LocalHeight(); ++iLoc )
+    {
+        const Int i = ADistSparse.GlobalRow(iLoc);
+        for( Int j=0; j<n; ++j )
+        {
+            const F value = Value<F>( i, j, n );
+            if( value != F(0) )
+                ADistSparse.QueueLocalUpdate( iLoc, j, value );
+        }
+    }
+    ADistSparse.ProcessLocalQueues();
+}
+
+// The maximum entrywise relative difference between two matrices
+template<typename T>
+Base<T> RelativeDifference( const Matrix<T>& A, const Matrix<T>& B )
+{
+    typedef Base<T> Real;
+    Real maxDiff = 0;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            maxDiff = Max( maxDiff, Abs(A(i,j)-B(i,j))/Max(Abs(B(i,j)),1) );
+    return maxDiff;
+}
+
+template<typename T>
+Base<T> RelativeDifference( const DistMatrix<T>& A, const Matrix<T>& B )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    return RelativeDifference( A_STAR_STAR.Matrix(), B );
+}
+
+template<typename T>
+Base<T> RelativeDifference( const DistMultiVec<T>& A, const Matrix<T>& B )
+{
+    DistMatrix<T> ADist;
+    Copy( A, ADist );
+    return RelativeDifference( ADist, B );
+}
+
+template<typename F>
+void CheckAgreement
+( const string& label,
+  const Matrix<F>& A, const Matrix<Base<F>>& dRow,
+  const Matrix<Base<F>>& dCol,
+  const DistMatrix<F>& ADist, const DistMatrix<Base<F>>& dRowDist,
+  const DistMatrix<Base<F>>& dColDist,
+  const SparseMatrix<F>& ASparse, const Matrix<Base<F>>& dRowSparse,
+  const Matrix<Base<F>>& dColSparse,
+  const DistSparseMatrix<F>& ADistSparse,
+  const DistMultiVec<Base<F>>& dRowDistSparse,
+  const DistMultiVec<Base<F>>& dColDistSparse )
+{
+    typedef Base<F> Real;
+    const Real tol = 100*limits::Epsilon<Real>();
+    mpi::Comm comm = ADist.Grid().Comm();
+
+    Matrix<F> ASparseDense;
+    Copy( ASparse, ASparseDense );
+    DistMatrix<F> ADistSparseDense(ADist.Grid());
+    Copy( ADistSparse, ADistSparseDense );
+    const Real distDiff =
+      Max( RelativeDifference( ADist, A ),
+      Max( RelativeDifference( dRowDist, dRow ),
+           RelativeDifference( dColDist, dCol ) ) );
+    const Real sparseDiff =
+      Max( RelativeDifference( ASparseDense, A ),
+      Max( RelativeDifference( dRowSparse, dRow ),
+           RelativeDifference( dColSparse, dCol ) ) );
+    const Real distSparseDiff =
+      Max( RelativeDifference( ADistSparseDense, A ),
+      Max( RelativeDifference( dRowDistSparse, dRow ),
+           RelativeDifference( dColDistSparse, dCol ) ) );
+    OutputFromRoot
+    (comm,label," relative differences from the sequential dense result: ",
+     distDiff," (DistMatrix), ",sparseDiff," (SparseMatrix), ",
+     distSparseDiff," (DistSparseMatrix)");
+    if( distDiff > tol || sparseDiff > tol || distSparseDiff > tol )
+        LogicError(label," results did not agree");
+}
+
+// Each row and column of the Ruiz-equilibrated matrix should have a maximum
+// magnitude close to one, while the geometric equilibration should leave a
+// modest ratio of the largest to smallest nonzero magnitudes of each row and
+// column (and normalizes each column to have a maximum of one). The original
+// matrix has ratios of up to 10^8.
+template<typename F>
+void CheckExtrema
+( const string& label, const Matrix<F>& A,
+  Base<F> minMax, Base<F> maxMax, Base<F> maxRatio, mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real huge = limits::Max<Real>();
+    vector<Real> rowMax(m,0), rowMin(m,huge), colMax(n,0), colMin(n,huge);
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const Real alpha = Abs(A(i,j));
+            if( alpha == Real(0) )
+                continue;
+            rowMax[i] = Max( rowMax[i], alpha );
+            rowMin[i] = Min( rowMin[i], alpha );
+            colMax[j] = Max( colMax[j], alpha );
+            colMin[j] = Min( colMin[j], alpha );
+        }
+    }
+    Real smallestMax = huge, largestMax = 0, largestRatio = 1;
+    for( Int i=0; i<m; ++i )
+    {
+        smallestMax = Min( smallestMax, rowMax[i] );
+        largestMax = Max( largestMax, rowMax[i] );
+        largestRatio = Max( largestRatio, rowMax[i]/rowMin[i] );
+    }
+    for( Int j=0; j<n; ++j )
+    {
+        smallestMax = Min( smallestMax, colMax[j] );
+        largestMax = Max( largestMax, colMax[j] );
+        largestRatio = Max( largestRatio, colMax[j]/colMin[j] );
+    }
+    OutputFromRoot
+    (comm,label," row/column maxima lie in [",smallestMax,",",largestMax,
+     "] with a max/min ratio of at most ",largestRatio);
+    if( smallestMax < minMax || largestMax > maxMax )
+        LogicError(label," row or column maximum was out of bounds");
+    if( largestRatio > maxRatio )
+        LogicError(label," row or column ratio was too large");
+}
+
+template<typename F>
+void TestEquilibration( Int m, Int n, const Grid& g, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    mpi::Comm comm = g.Comm();
+
+    Matrix<F> A;
+    DistMatrix<F> ADist(g);
+    SparseMatrix<F> ASparse;
+    DistSparseMatrix<F> ADistSparse(comm);
+    Matrix<Real> dRow, dCol, dRowSparse, dColSparse;
+    DistMatrix<Real> dRowDist(g), dColDist(g);
+    DistMultiVec<Real> dRowDistSparse(comm), dColDistSparse(comm);
+
+    // Ruiz equilibration
+    BuildMatrices( m, n, A, ADist, ASparse, ADistSparse );
+    RuizEquil( A, dRow, dCol, print );
+    RuizEquil( ADist, dRowDist, dColDist, print );
+    RuizEquil( ASparse, dRowSparse, dColSparse, print );
+    RuizEquil( ADistSparse, dRowDistSparse, dColDistSparse, print );
+    CheckExtrema
+    ( "Ruiz", A, Real(1)/Real(2), 1+Sqrt(eps), Real(1000), comm );
+    CheckAgreement
+    ( "Ruiz",
+      A, dRow, dCol,
+      ADist, dRowDist, dColDist,
+      ASparse, dRowSparse, dColSparse,
+      ADistSparse, dRowDistSparse, dColDistSparse );
+
+    // Geometric equilibration
+    BuildMatrices( m, n, A, ADist, ASparse, ADistSparse );
+    GeomEquil( A, dRow, dCol, print );
+    GeomEquil( ADist, dRowDist, dColDist, print );
+    GeomEquil( ASparse, dRowSparse, dColSparse, print );
+    GeomEquil( ADistSparse, dRowDistSparse, dColDistSparse, print );
+    CheckExtrema
+    ( "Geometric", A, Real(1)/Real(16), 1+Sqrt(eps), Real(16), comm );
+    CheckAgreement
+    ( "Geometric",
+      A, dRow, dCol,
+      ADist, dRowDist, dColDist,
+      ASparse, dRowSparse, dColSparse,
+      ADistSparse, dRowDistSparse, dColDistSparse );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--m","height of matrix",60);
+        const Int n = Input("--n","width of matrix",40);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( m < n )
+            LogicError("The test matrix requires m >= n");
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+
+        TestEquilibration<double>( m, n, g, print );
+        TestEquilibration<Complex<double>>( m, n, g, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
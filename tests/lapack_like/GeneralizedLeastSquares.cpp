@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestGLM
+( Int m, Int n, Int p, Int numRHS, Int numBatches, const Grid& g )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing GLM solver with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), B(g);
+    Uniform( A, m, n );
+    Uniform( B, m, p );
+
+    Timer timer;
+    timer.Start();
+    DistGLMSolver<F> solver( A, B );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"Factorization: ",timer.Stop()," secs");
+
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<F> D(g), X(g), Y(g), XRef(g), YRef(g);
+    for( Int batch=0; batch<numBatches; ++batch )
+    {
+        Uniform( D, m, numRHS );
+        timer.Start();
+        solver.Solve( D, X, Y );
+        mpi::Barrier( g.Comm() );
+        const double solveTime = timer.Stop();
+
+        GLM( A, B, D, XRef, YRef );
+        const Real frobX = FrobeniusNorm( XRef );
+        const Real frobY = FrobeniusNorm( YRef );
+        XRef -= X;
+        YRef -= Y;
+        const Real errX = FrobeniusNorm( XRef ) / frobX;
+        const Real errY = FrobeniusNorm( YRef ) / frobY;
+        OutputFromRoot
+        (g.Comm(),"batch ",batch,": solve ",solveTime," secs, relative ",
+         "errors of X and Y: ",errX,", ",errY);
+        if( errX > Sqrt(eps) || errY > Sqrt(eps) )
+            LogicError("Unacceptably large relative error");
+    }
+    PopIndent();
+}
+
+template<typename F>
+void TestLSE
+( Int m, Int n, Int p, Int numRHS, Int numBatches, const Grid& g )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing LSE solver with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), B(g);
+    Uniform( A, m, n );
+    Uniform( B, p, n );
+
+    Timer timer;
+    timer.Start();
+    DistLSESolver<F> solver( A, B );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"Factorization: ",timer.Stop()," secs");
+
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<F> C(g), D(g), X(g), XRef(g);
+    for( Int batch=0; batch<numBatches; ++batch )
+    {
+        Uniform( C, m, numRHS );
+        Uniform( D, p, numRHS );
+        timer.Start();
+        solver.Solve( C, D, X );
+        mpi::Barrier( g.Comm() );
+        const double solveTime = timer.Stop();
+
+        LSE( A, B, C, D, XRef );
+        const Real frobX = FrobeniusNorm( XRef );
+        XRef -= X;
+        const Real errX = FrobeniusNorm( XRef ) / frobX;
+        OutputFromRoot
+        (g.Comm(),"batch ",batch,": solve ",solveTime," secs, relative ",
+         "error of X: ",errX);
+        if( errX > Sqrt(eps) )
+            LogicError("Unacceptably large relative error");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",200);
+        const Int n = Input("--n","width of A",100);
+        const Int p = Input("--p","width (height) of B for GLM (LSE)",50);
+        const Int numRHS = Input("--numRHS","# of right-hand sides",20);
+        const Int numBatches = Input("--numBatches","# of batches",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestGLM<double>( m, n, p, numRHS, numBatches, g );
+        TestGLM<Complex<double>>( m, n, p, numRHS, numBatches, g );
+        TestLSE<double>( m, n, p, numRHS, numBatches, g );
+        TestLSE<Complex<double>>( m, n, p, numRHS, numBatches, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
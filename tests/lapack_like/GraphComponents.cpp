@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The graph of a 3D n x n x n 7-point stencil in natural ordering, but with
+// the connections between the planes z=n/2-1 and z=n/2 removed so that there
+// are two components
+void SplitStencil( Int n, DistGraph& graph )
+{
+    const Int numVertices = n*n*n;
+    graph.Resize( numVertices );
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalSources = graph.NumLocalSources();
+    graph.Reserve( 7*numLocalSources );
+    for( Int iLocal=0; iLocal<numLocalSources; ++iLocal )
+    {
+        const Int i = firstLocalSource + iLocal;
+        const Int x = i % n;
+        const Int y = (i/n) % n;
+        const Int z = i/(n*n);
+
+        graph.QueueLocalConnection( iLocal, i );
+        if( x != 0 )
+            graph.QueueLocalConnection( iLocal, i-1 );
+        if( x != n-1 )
+            graph.QueueLocalConnection( iLocal, i+1 );
+        if( y != 0 )
+            graph.QueueLocalConnection( iLocal, i-n );
+        if( y != n-1 )
+            graph.QueueLocalConnection( iLocal, i+n );
+        if( z != 0 && z != n/2 )
+            graph.QueueLocalConnection( iLocal, i-n*n );
+        if( z != n-1 && z != n/2-1 )
+            graph.QueueLocalConnection( iLocal, i+n*n );
+    }
+    graph.ProcessQueues();
+}
+
+Int Bandwidth( const Graph& graph, const vector<Int>& perm )
+{
+    Int bandwidth = 0;
+    for( Int e=0; e<graph.NumEdges(); ++e )
+        bandwidth =
+          Max( bandwidth, Abs(perm[graph.Source(e)]-perm[graph.Target(e)]) );
+    return bandwidth;
+}
+
+void TestSequential( Int m )
+{
+    Output("Testing sequential graph utilities");
+    PushIndent();
+
+    // A path whose vertices are labeled in a scrambled order
+    Int stride = m/2+1;
+    while( GCD(stride,m) != 1 )
+        ++stride;
+    Graph path( m );
+    path.Reserve( 2*m );
+    for( Int k=0; k<m-1; ++k )
+    {
+        const Int i = (k*stride) % m;
+        const Int j = ((k+1)*stride) % m;
+        path.QueueConnection( i, j );
+        path.QueueConnection( j, i );
+    }
+    path.ProcessQueues();
+
+    vector<Int> components;
+    if( ConnectedComponents( path, components ) != 1 )
+        LogicError("The path should have had a single component");
+
+    vector<Int> perm;
+    ReverseCuthillMcKee( path, perm );
+    EnsurePermutation( perm );
+    const Int bandwidth = Bandwidth( path, perm );
+    Output("RCM bandwidth of scrambled path: ",bandwidth);
+    if( bandwidth != 1 )
+        LogicError("RCM should have recovered the path ordering");
+
+    // A contiguous piece of a naturally-ordered path is itself a path
+    Graph natural( m );
+    for( Int i=0; i<m-1; ++i )
+    {
+        natural.QueueConnection( i, i+1 );
+        natural.QueueConnection( i+1, i );
+    }
+    natural.ProcessQueues();
+    Graph sub;
+    GetSubgraph( natural, IR(m/4,3*m/4), IR(m/4,3*m/4), sub );
+    if( ConnectedComponents( sub, components ) != 1 )
+        LogicError("A contiguous piece of a path should be connected");
+    if( sub.NumEdges() != 2*(3*m/4-m/4-1) )
+        LogicError("Subgraph had ",sub.NumEdges()," edges");
+    PopIndent();
+}
+
+void TestDistributed( Int n )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    OutputFromRoot(comm,"Testing distributed graph utilities");
+    PushIndent();
+
+    DistGraph graph( comm );
+    SplitStencil( n, graph );
+    const Int numVertices = graph.NumSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalSources = graph.NumLocalSources();
+
+    DistMap components( comm );
+    const Int numComponents = ConnectedComponents( graph, components );
+    OutputFromRoot(comm,"Found ",numComponents," components");
+    if( numComponents != 2 )
+        LogicError("Expected two components");
+    for( Int s=0; s<numLocalSources; ++s )
+    {
+        const Int z = (firstLocalSource+s)/(n*n);
+        if( components.GetLocal(s) != ( z < n/2 ? 0 : 1 ) )
+            LogicError("Vertex ",firstLocalSource+s," was mislabeled");
+    }
+
+    // The subgraph of the upper half should be a single component with all
+    // of the edges between its vertices
+    const Int halfBeg = (n/2)*n*n;
+    DistGraph upper( comm );
+    GetSubgraph
+    ( graph, IR(halfBeg,numVertices), IR(halfBeg,numVertices), upper );
+    Int numLocalUpperEdges = 0;
+    for( Int e=0; e<graph.NumLocalEdges(); ++e )
+        if( graph.Source(e) >= halfBeg && graph.Target(e) >= halfBeg )
+            ++numLocalUpperEdges;
+    if( mpi::AllReduce( numLocalUpperEdges, comm ) != upper.NumEdges() )
+        LogicError("The subgraph had the wrong number of edges");
+    DistMap upperComponents( comm );
+    if( ConnectedComponents( upper, upperComponents ) != 1 )
+        LogicError("The upper half should have been connected");
+
+    // The distributed RCM ordering should be a permutation which agrees with
+    // the sequential ordering of the same graph
+    DistMap perm( comm );
+    ReverseCuthillMcKee( graph, perm );
+    EnsurePermutation( perm );
+    if( mpi::Size(comm) == 1 )
+    {
+        Graph seqGraph( graph );
+        vector<Int> seqPerm;
+        ReverseCuthillMcKee( seqGraph, seqPerm );
+        for( Int s=0; s<numLocalSources; ++s )
+            if( perm.GetLocal(s) != seqPerm[s] )
+                LogicError("Sequential and distributed RCM differed");
+        Output("RCM bandwidth: ",Bandwidth( seqGraph, seqPerm ));
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","length of path",100);
+        const Int n = Input("--n","size of n x n x n grid",10);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+            TestSequential( m );
+        TestDistributed( n );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -224,6 +224,13 @@ void TestSuite
     ctrl.tridiagEigCtrl.alg = ctrlDbl.tridiagEigCtrl.alg;
     ctrl.tridiagEigCtrl.subset = subset;
     ctrl.tridiagEigCtrl.progress = ctrlDbl.tridiagEigCtrl.progress;
+    ctrl.useSpectrumSlicing = ctrlDbl.useSpectrumSlicing;
+    ctrl.sliceCtrl.numSlices = ctrlDbl.sliceCtrl.numSlices;
+    ctrl.sliceCtrl.groupSize = ctrlDbl.sliceCtrl.groupSize;
+    ctrl.sliceCtrl.progress = ctrlDbl.sliceCtrl.progress;
+    ctrl.useQDWHEig = ctrlDbl.useQDWHEig;
+    ctrl.sdcCtrl.cutoff = ctrlDbl.sdcCtrl.cutoff;
+    ctrl.sdcCtrl.progress = ctrlDbl.sdcCtrl.progress;
 
     if( sequential && g.Rank() == 0 )
     {
@@ -290,6 +297,16 @@ main( int argc, char* argv[] )
         const bool useScaLAPACK =
           Input("--useScaLAPACK","test ScaLAPACK?",false);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
+        const bool slice =
+          Input("--slice","use spectrum slicing for the subset?",false);
+        const Int numSlices =
+          Input("--numSlices","number of slices (0 for one per sub-grid)",0);
+        const int groupSize =
+          Input("--groupSize","processes per spectrum-slicing sub-grid",1);
+        const bool qdwhEig =
+          Input("--qdwhEig","use QDWH-eig divide and conquer?",false);
+        const Int sdcCutoff =
+          Input("--sdcCutoff","divide and conquer cutoff",256);
         const bool sequential =
           Input("--sequential","test sequential?",true);
         const bool distributed = 
@@ -344,6 +361,13 @@ main( int argc, char* argv[] )
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
         ctrl.tridiagEigCtrl.progress = progress;
+        ctrl.useSpectrumSlicing = slice;
+        ctrl.sliceCtrl.numSlices = numSlices;
+        ctrl.sliceCtrl.groupSize = groupSize;
+        ctrl.sliceCtrl.progress = progress;
+        ctrl.useQDWHEig = qdwhEig;
+        ctrl.sdcCtrl.cutoff = sdcCutoff;
+        ctrl.sdcCtrl.progress = progress;
 
         if( testReal )
         {
@@ -303,6 +303,7 @@ void TestHermitianGenDefEigSequential
   UpperOrLower uplo,
   Pencil pencil,
   bool onlyEigvals,
+  bool reuse,
   bool correctness,
   bool print,
   const HermitianEigCtrl<F>& ctrl )
@@ -341,7 +342,16 @@ void TestHermitianGenDefEigSequential
     Output("Starting Hermitian Generalized-Definite Eigensolver...");
     Timer timer;
     timer.Start();
-    if( onlyEigvals )
+    if( reuse )
+    {
+        HermitianGenDefEigSolver<F> solver( pencil, uplo, B );
+        if( onlyEigvals )
+            solver.Eig( A, w, ctrl );
+        else
+            solver.Eig( A, w, X, ctrl );
+        B = solver.Factor();
+    }
+    else if( onlyEigvals )
         HermitianGenDefEig( pencil, uplo, A, B, w, ctrl );
     else
         HermitianGenDefEig( pencil, uplo, A, B, w, X, ctrl );
@@ -364,6 +374,7 @@ void TestHermitianGenDefEig
   UpperOrLower uplo,
   Pencil pencil,
   bool onlyEigvals,
+  bool reuse,
   bool correctness,
   bool print,
   const Grid& g, 
@@ -405,7 +416,16 @@ void TestHermitianGenDefEig
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    if( onlyEigvals )
+    if( reuse )
+    {
+        DistHermitianGenDefEigSolver<F> solver( pencil, uplo, B );
+        if( onlyEigvals )
+            solver.Eig( A, w, ctrl );
+        else
+            solver.Eig( A, w, X, ctrl );
+        B = solver.Factor();
+    }
+    else if( onlyEigvals )
         HermitianGenDefEig( pencil, uplo, A, B, w, ctrl );
     else
         HermitianGenDefEig( pencil, uplo, A, B, w, X, ctrl );
@@ -429,6 +449,7 @@ void TestSuite
   UpperOrLower uplo,
   Pencil pencil,
   bool onlyEigvals,
+  bool reuse,
   bool sequential,
   bool distributed,
   bool correctness,
@@ -463,31 +484,31 @@ void TestSuite
     if( sequential )
     {
         TestHermitianGenDefEigSequential<F>
-        ( m, uplo, pencil, onlyEigvals, correctness, print, ctrl );
+        ( m, uplo, pencil, onlyEigvals, reuse, correctness, print, ctrl );
     }
     if( distributed )
     {
         OutputFromRoot(g.Comm(),"Normal tridiag algorithms:");
         ctrl.tridiagCtrl.approach = HERMITIAN_TRIDIAG_NORMAL;
         TestHermitianGenDefEig<F>
-        ( m, uplo, pencil, onlyEigvals, correctness, print, g, ctrl );
+        ( m, uplo, pencil, onlyEigvals, reuse, correctness, print, g, ctrl );
 
         OutputFromRoot(g.Comm(),"Square row-major algorithms:");
         ctrl.tridiagCtrl.approach = HERMITIAN_TRIDIAG_SQUARE;
         ctrl.tridiagCtrl.order = ROW_MAJOR;
         TestHermitianGenDefEig<F>
-        ( m, uplo, pencil, onlyEigvals, correctness, print, g, ctrl );
+        ( m, uplo, pencil, onlyEigvals, reuse, correctness, print, g, ctrl );
 
         OutputFromRoot(g.Comm(),"Square column-major algorithms:");
         ctrl.tridiagCtrl.approach = HERMITIAN_TRIDIAG_SQUARE;
         ctrl.tridiagCtrl.order = COLUMN_MAJOR;
         TestHermitianGenDefEig<F>
-        ( m, uplo, pencil, onlyEigvals, correctness, print, g, ctrl );
+        ( m, uplo, pencil, onlyEigvals, reuse, correctness, print, g, ctrl );
 
         // Also test with non-standard distributions
         OutputFromRoot(g.Comm(),"Nonstandard distributions:");
         TestHermitianGenDefEig<F,MR,MC,MC>
-        ( m, uplo, pencil, onlyEigvals, correctness, print, g, ctrl );
+        ( m, uplo, pencil, onlyEigvals, reuse, correctness, print, g, ctrl );
     }
 
     PopIndent();
@@ -510,6 +531,8 @@ main( int argc, char* argv[] )
              "3 is B A x = lambda x",1);
         const bool onlyEigvals = Input 
             ("--onlyEigvals","only compute eigenvalues?",false);
+        const bool reuse =
+          Input("--reuse","use a solver which retains the factor of B?",false);
         const char range = Input
             ("--range",
              "range of eigenpairs: 'A' for all, 'I' for index range, "
@@ -606,64 +629,64 @@ main( int argc, char* argv[] )
         if( testReal )
         {
             TestSuite<float>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 
             TestSuite<double>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 
 #ifdef EL_HAVE_QD
             TestSuite<DoubleDouble>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 
             TestSuite<QuadDouble>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestSuite<Quad>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestSuite<BigFloat>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 #endif
         }
         if( testCpx )
         {
             TestSuite<Complex<float>>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 
             TestSuite<Complex<double>>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 
 #ifdef EL_HAVE_QD
             TestSuite<Complex<DoubleDouble>>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 
             TestSuite<Complex<QuadDouble>>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestSuite<Complex<Quad>>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestSuite<Complex<BigFloat>>
-            ( m, uplo, pencil, onlyEigvals,
+            ( m, uplo, pencil, onlyEigvals, reuse,
               sequential, distributed, correctness, print, g, ctrl );
 #endif
         }
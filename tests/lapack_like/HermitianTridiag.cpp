@@ -90,6 +90,7 @@ void TestCorrectness
 ( UpperOrLower uplo, 
   const DistMatrix<F>& A, 
   const DistMatrix<F,STAR,STAR>& householderScalars,
+  const herm_tridiag::BulgeReflectors<F>& bulgeReflectors,
         DistMatrix<F>& AOrig,
   bool print,
   bool display )
@@ -121,8 +122,12 @@ void TestCorrectness
         Display( B, "Tridiagonal" );
 
     // Reverse the accumulated Householder transforms, ignoring symmetry
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL,
+      A, householderScalars, bulgeReflectors, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, uplo, ADJOINT,
+      A, householderScalars, bulgeReflectors, B );
     if( print )
         Print( B, "Rotated tridiagonal" );
     if( display )
@@ -143,13 +148,19 @@ void TestCorrectness
 
     // Compute || I - Q Q^H ||
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, uplo, ADJOINT,
+      A, householderScalars, bulgeReflectors, B );
     DistMatrix<F> QHAdj( g );
     Adjoint( B, QHAdj );
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL,
+      A, householderScalars, bulgeReflectors, B );
     QHAdj -= B;
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, uplo, ADJOINT,
+      A, householderScalars, bulgeReflectors, B );
     ShiftDiagonal( B, F(-1) );
     const Real infOrthogError = InfinityNorm( B );
     const Real relOrthogError = infOrthogError / (eps*m);
@@ -219,7 +230,8 @@ void InnerTestHermitianTridiag
     OutputFromRoot(g.Comm(),"Starting tridiagonalization...");
     mpi::Barrier( g.Comm() );
     timer.Start();
-    HermitianTridiag( uplo, A, householderScalars, ctrl );
+    herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+    HermitianTridiag( uplo, A, householderScalars, bulgeReflectors, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -238,7 +250,9 @@ void InnerTestHermitianTridiag
         ( householderScalars, "householderScalars after HermitianTridiag" );
     }
     if( correctness )
-        TestCorrectness( uplo, A, householderScalars, AOrig, print, display );
+        TestCorrectness
+        ( uplo, A, householderScalars, bulgeReflectors, AOrig,
+          print, display );
     A = ACopy;
 }
 
@@ -277,6 +291,7 @@ void TestHermitianTridiag
   Int m,
   Int nbLocal,
   bool avoidTrmv,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -314,6 +329,13 @@ void TestHermitianTridiag
     ctrl.order = COLUMN_MAJOR;
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, ctrl, correctness, print, display );
+
+    OutputFromRoot(g.Comm(),"Two-stage algorithm:");
+    ctrl.approach = HERMITIAN_TRIDIAG_NORMAL;
+    ctrl.twoStage = true;
+    ctrl.bandwidth = bandwidth;
+    InnerTestHermitianTridiag
+    ( uplo, A, householderScalars, ctrl, correctness, print, display );
     PopIndent();
 }
 
@@ -333,6 +355,8 @@ main( int argc, char* argv[] )
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool avoidTrmv = 
           Input("--avoidTrmv","avoid Trmv local Symv",true);
+        const Int bandwidth =
+          Input("--bandwidth","bandwidth of two-stage reduction",8);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -411,48 +435,59 @@ main( int argc, char* argv[] )
 
         if( testReal )
             TestHermitianTridiag<float>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<float>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
         if( testReal )
             TestHermitianTridiag<double>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
 #ifdef EL_HAVE_QD
         if( testReal )
         {
             TestHermitianTridiag<DoubleDouble>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<QuadDouble>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
         if( testCpx )
         {
             TestHermitianTridiag<Complex<DoubleDouble>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<Complex<QuadDouble>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
 #endif
 
 #ifdef EL_HAVE_QUAD
         if( testReal )
             TestHermitianTridiag<Quad>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<Quad>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         if( testReal )
             TestHermitianTridiag<BigFloat>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
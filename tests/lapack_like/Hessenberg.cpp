@@ -236,6 +236,84 @@ void TestHessenberg
     PopIndent();
 }
 
+template<typename F>
+void TestBlockHessenberg
+( const Grid& g,
+  Int n,
+  Int nb,
+  bool correctness,
+  bool print,
+  bool display )
+{
+    typedef Base<F> Real;
+    DistMatrix<F,MC,MR,BLOCK> A(n,n,g,nb,nb), Q(n,n,g,nb,nb);
+    DistMatrix<F,STAR,STAR> householderScalars(g);
+    OutputFromRoot
+    (g.Comm(),"Testing block-cyclic reduction with ",TypeName<F>());
+    PushIndent();
+
+    Uniform( A, n, n );
+    DistMatrix<F> AOrig( A );
+    if( print )
+        Print( A, "A" );
+    if( display )
+        Display( A, "A" );
+
+    OutputFromRoot(g.Comm(),"Starting reduction to Hessenberg form...");
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    Hessenberg( UPPER, A, householderScalars );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),timer.Stop()," seconds");
+
+    OutputFromRoot(g.Comm(),"Starting compact-WY formation of Q...");
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    hessenberg::FormQ( UPPER, A, householderScalars, Q );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),timer.Stop()," seconds");
+
+    if( correctness )
+    {
+        const Real eps = limits::Epsilon<Real>();
+        const Real oneNormAOrig = OneNorm( AOrig );
+        PushIndent();
+
+        DistMatrix<F> H( A ), QElem( Q ), QHA(g);
+        MakeTrapezoidal( UPPER, H, -1 );
+        if( print )
+        {
+            Print( H, "Hessenberg" );
+            Print( QElem, "Q" );
+        }
+        if( display )
+        {
+            Display( H, "Hessenberg" );
+            Display( QElem, "Q" );
+        }
+
+        Gemm( ADJOINT, NORMAL, F(1), QElem, AOrig, QHA );
+        Gemm( NORMAL, NORMAL, F(-1), QHA, QElem, F(1), H );
+        const Real relError = InfinityNorm( H ) / (n*eps*oneNormAOrig);
+        OutputFromRoot
+        (g.Comm(),"||H - Q^H A Q||_oo / (eps n || A ||_1) = ",relError);
+
+        DistMatrix<F> E(g);
+        Identity( E, n, n );
+        Herk( LOWER, ADJOINT, Real(-1), QElem, Real(1), E );
+        const Real orthogError = HermitianMaxNorm( LOWER, E ) / (n*eps);
+        OutputFromRoot
+        (g.Comm(),"||I - Q^H Q||_max / (eps n) = ",orthogError);
+
+        // TODO: Use a more refined failure condition
+        if( relError > Real(1) || orthogError > Real(1) )
+            LogicError("Unacceptably large relative error");
+        PopIndent();
+    }
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -321,6 +399,10 @@ main( int argc, char* argv[] )
         TestHessenberg<Complex<double>>
         ( g, uplo, n, correctness, print, display );
 
+        TestBlockHessenberg<double>( g, n, nb, correctness, print, display );
+        TestBlockHessenberg<Complex<double>>
+        ( g, n, nb, correctness, print, display );
+
 #ifdef EL_HAVE_QD
         TestHessenberg<DoubleDouble>
         ( g, uplo, n, correctness, print, display );
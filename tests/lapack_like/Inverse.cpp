@@ -0,0 +1,214 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares the blocked Gauss-Jordan inversion against inversion after an LU
+// factorization with partial pivoting, both for uniform matrices and for
+// matrices whose pivots lie outside of the current panel, and checks that an
+// exactly singular matrix is detected.
+
+// Add a large entry to row (j+shift) mod n of each column j so that, for a
+// shift larger than the blocksize, nearly every pivot lies below the panel
+template<typename F>
+void ForceOffPanelPivots( Matrix<F>& A, Int shift )
+{
+    const Int n = A.Height();
+    for( Int j=0; j<n; ++j )
+        A((j+shift)%n,j) += F(2*n);
+}
+
+template<typename F>
+void ForceOffPanelPivots( DistMatrix<F>& A, Int shift )
+{
+    const Int n = A.Height();
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GlobalRow(iLoc) == (j+shift)%n )
+                A.UpdateLocal( iLoc, jLoc, F(2*n) );
+    }
+}
+
+// || A X - I ||_F / (|| A ||_F || X ||_F)
+template<typename F>
+Base<F> InverseResidual( const Matrix<F>& A, const Matrix<F>& X )
+{
+    Matrix<F> E;
+    Identity( E, A.Height(), A.Height() );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+    return FrobeniusNorm(E) / (FrobeniusNorm(A)*FrobeniusNorm(X));
+}
+
+template<typename F>
+Base<F> InverseResidual( const DistMatrix<F>& A, const DistMatrix<F>& X )
+{
+    DistMatrix<F> E(A.Grid());
+    Identity( E, A.Height(), A.Height() );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+    return FrobeniusNorm(E) / (FrobeniusNorm(A)*FrobeniusNorm(X));
+}
+
+template<typename F>
+void CheckResiduals
+( const string& label, Base<F> gaussJordanResid, Base<F> luResid, Int n,
+  mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot
+    (comm,label,": || A inv(A) - I ||_F / (|| A ||_F || inv(A) ||_F) = ",
+     gaussJordanResid," (Gauss-Jordan), ",luResid," (LU)");
+    if( gaussJordanResid > Max( 10*luResid, n*eps ) )
+        LogicError
+        (label," Gauss-Jordan residual of ",gaussJordanResid,
+         " was much larger than the LU residual of ",luResid);
+}
+
+template<typename F>
+void TestInverse( Int n, Int shift, bool print )
+{
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+    mpi::Comm comm = mpi::COMM_SELF;
+
+    for( const bool offPanel : { false, true } )
+    {
+        Matrix<F> A;
+        Uniform( A, n, n );
+        if( offPanel )
+            ForceOffPanelPivots( A, shift );
+        if( print )
+            Print( A, "A" );
+
+        Matrix<F> XGaussJordan( A );
+        inverse::GaussJordan( XGaussJordan );
+        Matrix<F> XLU( A );
+        Permutation P;
+        LU( XLU, P );
+        inverse::AfterLUPartialPiv( XLU, P );
+        if( print )
+            Print( XGaussJordan, "inv(A)" );
+
+        CheckResiduals<F>
+        ( offPanel ? "Off-panel pivots" : "Uniform",
+          InverseResidual( A, XGaussJordan ), InverseResidual( A, XLU ), n,
+          comm );
+    }
+
+    // A zero column remains exactly zero throughout the elimination
+    Matrix<F> A;
+    Uniform( A, n, n );
+    auto aCol = A( ALL, IR(n/2) );
+    Zero( aCol );
+    bool detected = false;
+    try { inverse::GaussJordan( A ); }
+    catch( SingularMatrixException& ) { detected = true; }
+    if( !detected )
+        LogicError("Singular matrix was not detected");
+    Output("Singular matrix was detected");
+
+    PopIndent();
+}
+
+template<typename F>
+void TestInverse( const Grid& g, Int n, Int shift, bool print )
+{
+    mpi::Comm comm = g.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    PushIndent();
+
+    for( const bool offPanel : { false, true } )
+    {
+        DistMatrix<F> A(g);
+        Uniform( A, n, n );
+        if( offPanel )
+            ForceOffPanelPivots( A, shift );
+        if( print )
+            Print( A, "A" );
+
+        DistMatrix<F> XGaussJordan( A );
+        inverse::GaussJordan( XGaussJordan );
+        DistMatrix<F> XLU( A );
+        DistPermutation P(g);
+        LU( XLU, P );
+        inverse::AfterLUPartialPiv( XLU, P );
+        if( print )
+            Print( XGaussJordan, "inv(A)" );
+
+        CheckResiduals<F>
+        ( offPanel ? "Off-panel pivots" : "Uniform",
+          InverseResidual( A, XGaussJordan ), InverseResidual( A, XLU ), n,
+          comm );
+    }
+
+    DistMatrix<F> A(g);
+    Uniform( A, n, n );
+    auto aCol = A( ALL, IR(n/2) );
+    Zero( aCol );
+    bool detected = false;
+    try { inverse::GaussJordan( A ); }
+    catch( SingularMatrixException& ) { detected = true; }
+    if( !detected )
+        LogicError("Singular matrix was not detected");
+    OutputFromRoot(comm,"Singular matrix was detected");
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int n = Input("--n","size of matrix",75);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // Place the pivots beyond the end of each panel
+        const Int shift = nb + 3;
+        if( n <= shift )
+            LogicError("The matrix size must exceed the blocksize plus three");
+        SetBlocksize( nb );
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+
+        if( sequential && mpi::Rank() == 0 )
+        {
+            TestInverse<double>( n, shift, print );
+            TestInverse<Complex<double>>( n, shift, print );
+        }
+
+        // Sweep a column of processes, the default grid, and a row
+        const int commSize = mpi::Size( comm );
+        vector<int> gridHeights = { 1, gridHeight, commSize };
+        std::sort( gridHeights.begin(), gridHeights.end() );
+        gridHeights.erase
+        ( std::unique( gridHeights.begin(), gridHeights.end() ),
+          gridHeights.end() );
+        for( const int height : gridHeights )
+        {
+            const Grid g( comm, height );
+            OutputFromRoot
+            (comm,"Testing over a ",g.Height()," x ",g.Width()," grid");
+            TestInverse<double>( g, n, shift, print );
+            TestInverse<Complex<double>>( g, n, shift, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
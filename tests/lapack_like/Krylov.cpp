@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The maximum over the columns of || b - A x ||_2 / || b ||_2
+template<typename F>
+Base<F> RelativeResidual
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+  const DistMultiVec<F>& X )
+{
+    typedef Base<F> Real;
+    DistMultiVec<F> R(A.Comm());
+    R = B;
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    Matrix<Real> rNorms, bNorms;
+    ColumnTwoNorms( R, rNorms );
+    ColumnTwoNorms( B, bNorms );
+    Real relResid = 0;
+    for( Int j=0; j<B.Width(); ++j )
+        relResid = Max( relResid, rNorms(j)/bNorms(j) );
+    return relResid;
+}
+
+template<typename F>
+void TestKrylov
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numRHS,
+  bool progress,
+  mpi::Comm& comm )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    PushIndent();
+
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, n1, n2, n3 );
+    const Int n = A.Height();
+
+    DistMultiVec<F> B(comm);
+    Uniform( B, n, numRHS );
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 10*Pow(eps,Real(0.5));
+
+    const KrylovSolveAlg algs[] =
+      { KRYLOV_CG, KRYLOV_MINRES, KRYLOV_GMRES, KRYLOV_BICGSTAB };
+    const string algNames[] = { "CG", "MINRES", "GMRES", "BiCGStab" };
+    Timer timer;
+    for( Int k=0; k<4; ++k )
+    {
+        for( Int pipelined=0; pipelined<2; ++pipelined )
+        {
+            KrylovSolveCtrl<Real> ctrl;
+            ctrl.alg = algs[k];
+            ctrl.pipelined = pipelined;
+            ctrl.maxIts = 10*n;
+            ctrl.progress = progress;
+            auto X = B;
+            timer.Start();
+            auto info = KrylovSolve( A, X, ctrl );
+            OutputFromRoot
+            (comm,(pipelined?"Pipelined ":""),algNames[k],": ",timer.Stop(),
+             " seconds, ",info.numConverged," converged after ",info.numIts,
+             " iterations");
+            const Real relResid = RelativeResidual( A, B, X );
+            OutputFromRoot(comm,"max || b - A x ||_2 / || b ||_2 = ",relResid);
+            if( relResid > tol )
+                LogicError("Unacceptably large relative residual");
+        }
+    }
+
+    // Precondition with the factorization of a shifted (negative-definite)
+    // Laplacian
+    {
+        DistSparseMatrix<F> AShift( A );
+        ShiftDiagonal( AShift, F(1) );
+        DistSparseLDLFactorization<F> factorization;
+        factorization.Initialize( AShift, true );
+
+        KrylovSolveCtrl<Real> ctrl;
+        ctrl.progress = progress;
+        auto X = B;
+        timer.Start();
+        auto info = KrylovSolve( A, factorization, X, ctrl );
+        OutputFromRoot
+        (comm,"LDL-preconditioned GMRES: ",timer.Stop()," seconds, ",
+         info.numConverged," converged after ",info.numIts," iterations");
+        const Real relResid = RelativeResidual( A, B, X );
+        OutputFromRoot(comm,"max || b - A x ||_2 / || b ||_2 = ",relResid);
+        if( relResid > tol )
+            LogicError("Unacceptably large relative residual");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool padLDims =
+          Input("--padLDims","also test padded leading dimensions?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        TestKrylov<double>( n1, n2, n3, numRHS, progress, comm );
+        TestKrylov<Complex<double>>( n1, n2, n3, numRHS, progress, comm );
+        if( padLDims )
+        {
+            OutputFromRoot(comm,"Testing with padded leading dimensions");
+            EnableLDimPadding();
+            TestKrylov<double>( n1, n2, n3, numRHS, progress, comm );
+            TestKrylov<Complex<double>>( n1, n2, n3, numRHS, progress, comm );
+            DisableLDimPadding();
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -186,6 +186,92 @@ void TestLDL
     PopIndent();
 }
 
+// Solve against a symmetric (Hermitian) indefinite matrix using the unpivoted
+// LDL factorization of a random butterfly transformation of it followed by
+// iterative refinement. Since the distributed butterfly is broadcast from the
+// root, this is repeated with padded leading dimensions.
+template<typename F>
+void TestButterflyResidual
+( const string& label,
+  Base<F> ANorm, Base<F> XNorm, Base<F> residNorm, mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    const Real relResid = residNorm / (ANorm*XNorm);
+    OutputFromRoot
+    (comm,label," || B - A X ||_F / (|| A ||_F || X ||_F) = ",relResid);
+    if( relResid > Sqrt(limits::Epsilon<Real>()) )
+        LogicError(label," butterfly LDL solve was inaccurate");
+}
+
+template<typename F>
+void TestButterflyLDL( Int m, bool conjugated, Int numRHS=10 )
+{
+    Output("Testing butterfly LDL with ",TypeName<F>());
+    PushIndent();
+    for( const bool pad : {false,true} )
+    {
+        if( pad )
+            EnableLDimPadding();
+        Matrix<F> A, AFact, B, X;
+        if( conjugated )
+            HermitianUniformSpectrum( A, m, -100, 100 );
+        else
+        {
+            Uniform( A, m, m );
+            MakeSymmetric( LOWER, A );
+        }
+        AFact = A;
+        ButterflyTransform<Base<F>> U;
+        LDL( AFact, U, conjugated );
+
+        Uniform( B, m, numRHS );
+        X = B;
+        ldl::SolveAfter( A, AFact, U, X, conjugated );
+        Symm( LEFT, LOWER, F(-1), A, X, F(1), B, conjugated );
+        TestButterflyResidual<F>
+        ( (pad ? "Padded" : "Unpadded"), FrobeniusNorm(A), FrobeniusNorm(X),
+          FrobeniusNorm(B), mpi::COMM_SELF );
+        if( pad )
+            DisableLDimPadding();
+    }
+    PopIndent();
+}
+
+template<typename F>
+void TestButterflyLDL
+( const Grid& g, Int m, bool conjugated, Int numRHS=10 )
+{
+    OutputFromRoot(g.Comm(),"Testing butterfly LDL with ",TypeName<F>());
+    PushIndent();
+    for( const bool pad : {false,true} )
+    {
+        if( pad )
+            EnableLDimPadding();
+        DistMatrix<F> A(g), AFact(g), B(g), X(g);
+        if( conjugated )
+            HermitianUniformSpectrum( A, m, -100, 100 );
+        else
+        {
+            Uniform( A, m, m );
+            MakeSymmetric( LOWER, A );
+        }
+        AFact = A;
+        ButterflyTransform<Base<F>> U;
+        LDL( AFact, U, conjugated );
+
+        Uniform( B, m, numRHS );
+        X = B;
+        ldl::SolveAfter( A, AFact, U, X, conjugated );
+        Symm( LEFT, LOWER, F(-1), A, X, F(1), B, conjugated );
+        TestButterflyResidual<F>
+        ( (pad ? "Padded" : "Unpadded"), FrobeniusNorm(A), FrobeniusNorm(X),
+          FrobeniusNorm(B), g.Comm() );
+        if( pad )
+            DisableLDimPadding();
+    }
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -204,6 +290,8 @@ main( int argc, char* argv[] )
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
+        const bool butterfly =
+          Input("--butterfly","test butterfly LDL with refinement?",true);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
 #endif
@@ -295,6 +383,17 @@ main( int argc, char* argv[] )
         TestLDL<Complex<BigFloat>>
         ( g, m, conjugated, nbLocal, correctness, print );
 #endif
+
+        if( butterfly )
+        {
+            if( sequential && mpi::Rank() == 0 )
+            {
+                TestButterflyLDL<double>( m, conjugated );
+                TestButterflyLDL<Complex<double>>( m, conjugated );
+            }
+            TestButterflyLDL<double>( g, m, conjugated );
+            TestButterflyLDL<Complex<double>>( g, m, conjugated );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
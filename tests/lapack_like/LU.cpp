@@ -181,7 +181,8 @@ void TestLU
   Int pivoting, 
   bool correctness,
   bool forceGrowth,
-  bool print )
+  bool print,
+  const LUCtrl& ctrl )
 {
     OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
     PushIndent();
@@ -205,7 +206,7 @@ void TestLU
     if( pivoting == 0 )
         LU( A );
     else if( pivoting == 1 )
-        LU( A, P );
+        LU( A, P, ctrl );
     else if( pivoting == 2 )
         LU( A, P, Q );
     mpi::Barrier( g.Comm() );
@@ -264,6 +265,9 @@ main( int argc, char* argv[] )
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const Int lookAhead = Input("--lookAhead","look-ahead depth",0);
+        const bool tournament =
+          Input("--tournament","tournament pivoting for distributed?",false);
         const bool correctness = 
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -284,9 +288,15 @@ main( int argc, char* argv[] )
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
         const Grid g( comm, gridHeight, order );
         SetBlocksize( nb );
+        LUCtrl ctrl;
+        ctrl.lookAhead = lookAhead;
+        if( tournament )
+            ctrl.pivot = LU_TOURNAMENT;
         ComplainIfDebug();
         if( pivot == 0 )
             OutputFromRoot(g.Comm(),"Testing LU with no pivoting");
+        else if( pivot == 1 && tournament )
+            OutputFromRoot(g.Comm(),"Testing LU with tournament pivoting");
         else if( pivot == 1 )
             OutputFromRoot(g.Comm(),"Testing LU with partial pivoting");
         else if( pivot == 2 )
@@ -332,39 +342,39 @@ main( int argc, char* argv[] )
         }
 
         TestLU<float>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
         TestLU<Complex<float>>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
 
         TestLU<double>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
         TestLU<Complex<double>>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
 
 #ifdef EL_HAVE_QD
         TestLU<DoubleDouble>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
         TestLU<QuadDouble>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
 
         TestLU<Complex<DoubleDouble>>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
         TestLU<Complex<QuadDouble>>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestLU<Quad>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
         TestLU<Complex<Quad>>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestLU<BigFloat>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
         TestLU<Complex<BigFloat>>
-        ( g, m, pivot, correctness, forceGrowth, print );
+        ( g, m, pivot, correctness, forceGrowth, print, ctrl );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
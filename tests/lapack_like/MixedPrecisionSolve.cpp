@@ -0,0 +1,219 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( bool hermitian,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& X )
+{
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> R( B );
+    if( hermitian )
+        Hemm( LEFT, LOWER, F(-1), A, X, F(1), R );
+    else
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    const Real relError =
+      MaxNorm( R ) / (eps*n*OneNorm(A)*MaxNorm(X));
+    Output("||B - A X||_max / (eps n ||A||_1 ||X||_max) = ",relError);
+
+    // TODO: More rigorous failure condition
+    if( relError > Real(10) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename F>
+void TestCorrectness
+( bool hermitian,
+  const DistMatrix<F>& A,
+  const DistMatrix<F>& B,
+  const DistMatrix<F>& X )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<F> R( B );
+    if( hermitian )
+        Hemm( LEFT, LOWER, F(-1), A, X, F(1), R );
+    else
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    const Real relError =
+      MaxNorm( R ) / (eps*n*OneNorm(A)*MaxNorm(X));
+    OutputFromRoot
+    (g.Comm(),"||B - A X||_max / (eps n ||A||_1 ||X||_max) = ",relError);
+
+    // TODO: More rigorous failure condition
+    if( relError > Real(10) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename F>
+void TestMixedPrecision
+( Int n,
+  Int numRHS,
+  bool progress,
+  bool print )
+{
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+
+    RegSolveCtrl<Base<F>> ctrl;
+    ctrl.progress = progress;
+
+    Matrix<F> A, B, X;
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(n) );
+    Uniform( B, n, numRHS );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+
+    Output("General matrix");
+    PushIndent();
+    X = B;
+    Timer timer;
+    timer.Start();
+    const Int refineIts = lin_solve::MixedPrecision( A, X, ctrl );
+    Output(timer.Stop()," seconds and ",refineIts," refinement steps");
+    TestCorrectness( false, A, B, X );
+    PopIndent();
+
+    Output("HPD matrix");
+    PushIndent();
+    Matrix<F> AHPD;
+    Identity( AHPD, n, n );
+    Herk( LOWER, ADJOINT, Base<F>(1), A, Base<F>(1), AHPD );
+    X = B;
+    timer.Start();
+    const Int hpdRefineIts =
+      hpd_solve::MixedPrecision( LOWER, NORMAL, AHPD, X, ctrl );
+    Output(timer.Stop()," seconds and ",hpdRefineIts," refinement steps");
+    TestCorrectness( true, AHPD, B, X );
+    PopIndent();
+
+    PopIndent();
+}
+
+template<typename F>
+void TestMixedPrecision
+( const Grid& g,
+  Int n,
+  Int numRHS,
+  bool progress,
+  bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    RegSolveCtrl<Base<F>> ctrl;
+    ctrl.progress = progress;
+
+    DistMatrix<F> A(g), B(g), X(g);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(n) );
+    Uniform( B, n, numRHS );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+
+    OutputFromRoot(g.Comm(),"General matrix");
+    PushIndent();
+    X = B;
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    const Int refineIts = lin_solve::MixedPrecision( A, X, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot
+    (g.Comm(),timer.Stop()," seconds and ",refineIts," refinement steps");
+    TestCorrectness( false, A, B, X );
+    PopIndent();
+
+    OutputFromRoot(g.Comm(),"HPD matrix");
+    PushIndent();
+    DistMatrix<F> AHPD(g);
+    Identity( AHPD, n, n );
+    Herk( LOWER, ADJOINT, Base<F>(1), A, Base<F>(1), AHPD );
+    X = B;
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    const Int hpdRefineIts =
+      hpd_solve::MixedPrecision( LOWER, NORMAL, AHPD, X, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot
+    (g.Comm(),timer.Stop()," seconds and ",hpdRefineIts," refinement steps");
+    TestCorrectness( true, AHPD, B, X );
+    PopIndent();
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--n","height of matrix",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, gridHeight, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( sequential && mpi::Rank() == 0 )
+        {
+            TestMixedPrecision<double>( n, numRHS, progress, print );
+            TestMixedPrecision<Complex<double>>( n, numRHS, progress, print );
+#ifdef EL_HAVE_QD
+            TestMixedPrecision<DoubleDouble>( n, numRHS, progress, print );
+#endif
+#ifdef EL_HAVE_QUAD
+            TestMixedPrecision<Quad>( n, numRHS, progress, print );
+#endif
+        }
+
+        TestMixedPrecision<double>( g, n, numRHS, progress, print );
+        TestMixedPrecision<Complex<double>>( g, n, numRHS, progress, print );
+#ifdef EL_HAVE_QD
+        TestMixedPrecision<DoubleDouble>( g, n, numRHS, progress, print );
+#endif
+#ifdef EL_HAVE_QUAD
+        TestMixedPrecision<Quad>( g, n, numRHS, progress, print );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
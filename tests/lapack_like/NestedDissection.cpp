@@ -28,6 +28,9 @@ int main( int argc, char* argv[] )
             ("--numSeqSeps",
              "number of separators to try per sequential partition",1);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const string cache =
+          Input("--cache","basename for saving and reloading the ordering",
+                string(""));
         const bool print = Input("--print","print graph?",false);
         const bool display = Input("--display","display graph?",false);
         ProcessInput();
@@ -82,8 +85,34 @@ int main( int argc, char* argv[] )
         ldl::NestedDissection( graph, map, sep, info, ctrl );
 
         const int rootSepSize = info.size;
-        // TODO: Print more than just the root separator size
         OutputFromRoot(comm,rootSepSize," vertices in root separator");
+        const auto summary = ldl::Summarize( info );
+        OutputFromRoot
+        (comm,summary.numNodes," supernodes, ",summary.numNonzeros,
+         " predicted nonzeros in L, ",summary.factorFlops/1.e9,
+         " predicted GFlops, ",summary.maxFrontEntries,
+         " entries in the largest front, and ",summary.peakUpdateEntries,
+         " peak update entries");
+
+        if( cache != "" )
+        {
+            OutputFromRoot(comm,"Saving and reloading the ordering");
+            ldl::SaveNestedDissection( cache, sep, info );
+            ldl::DistNodeInfo cachedInfo;
+            ldl::DistSeparator cachedSep;
+            DistMap cachedMap;
+            ldl::LoadNestedDissection
+            ( cache, comm, cachedMap, cachedSep, cachedInfo );
+
+            const Int numLocalMapped = map.NumLocalSources();
+            for( Int s=0; s<numLocalMapped; ++s )
+                if( cachedMap.GetLocal(s) != map.GetLocal(s) )
+                    LogicError("Reloaded map did not match");
+            const auto cachedSummary = ldl::Summarize( cachedInfo );
+            if( cachedSummary.numNodes != summary.numNodes ||
+                cachedSummary.numNonzeros != summary.numNonzeros )
+                LogicError("Reloaded analysis did not match");
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
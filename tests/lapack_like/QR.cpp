@@ -267,6 +267,94 @@ void TestQR
     PopIndent();
 }
 
+template<typename F>
+void TestPivotedQR
+( Int m,
+  Int n,
+  bool randomized,
+  bool correctness,
+  bool print )
+{
+    Output
+    ("Testing ",(randomized?"HQRRP":"Businger-Golub")," with ",TypeName<F>());
+    PushIndent();
+    Matrix<F> A, AOrig;
+    Matrix<F> householderScalars;
+    Matrix<Base<F>> signature;
+    Permutation Omega;
+
+    Uniform( A, m, n );
+    if( correctness )
+        AOrig = A;
+    if( print )
+        Print( A, "A" );
+
+    QRCtrl<Base<F>> ctrl;
+    ctrl.randomizedPivoting = randomized;
+    Timer timer;
+    timer.Start();
+    QR( A, householderScalars, signature, Omega, ctrl );
+    Output("Pivoted QR: ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( A, "A after factorization" );
+        Print( householderScalars, "householderScalars" );
+        Print( signature, "signature" );
+    }
+    if( correctness )
+    {
+        Omega.PermuteCols( AOrig );
+        TestCorrectness( A, householderScalars, signature, AOrig );
+    }
+    PopIndent();
+}
+
+template<typename F>
+void TestPivotedQR
+( const Grid& g,
+  Int m,
+  Int n,
+  bool randomized,
+  bool correctness,
+  bool print )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing ",(randomized?"HQRRP":"Businger-Golub")," with ",
+     TypeName<F>());
+    PushIndent();
+    DistMatrix<F> A(g), AOrig(g);
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    DistPermutation Omega(g);
+
+    Uniform( A, m, n );
+    if( correctness )
+        AOrig = A;
+    if( print )
+        Print( A, "A" );
+
+    QRCtrl<Base<F>> ctrl;
+    ctrl.randomizedPivoting = randomized;
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    QR( A, householderScalars, signature, Omega, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"Pivoted QR: ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( A, "A after factorization" );
+        Print( householderScalars, "householderScalars" );
+        Print( signature, "signature" );
+    }
+    if( correctness )
+    {
+        Omega.PermuteCols( AOrig );
+        TestCorrectness( A, householderScalars, signature, AOrig );
+    }
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -380,6 +468,21 @@ main( int argc, char* argv[] )
         TestQR<Complex<BigFloat>>
         ( g, m, n, correctness, print );
 #endif
+
+        for( const bool randomized : { false, true } )
+        {
+            if( sequential && mpi::Rank() == 0 )
+            {
+                TestPivotedQR<double>
+                ( m, n, randomized, correctness, print );
+                TestPivotedQR<Complex<double>>
+                ( m, n, randomized, correctness, print );
+            }
+            TestPivotedQR<double>
+            ( g, m, n, randomized, correctness, print );
+            TestPivotedQR<Complex<double>>
+            ( g, m, n, randomized, correctness, print );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,295 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Explicitly form the modified matrices for comparison
+// ====================================================
+
+template<class MatType>
+void ExplicitInsertRows
+( const MatType& A, Int i, const MatType& B, MatType& ANew )
+{
+    const Int m = A.Height();
+    const Int k = B.Height();
+    ANew.Resize( m+k, A.Width() );
+    auto ANewT = ANew( IR(0,i), ALL );
+    auto ANewM = ANew( IR(i,i+k), ALL );
+    auto ANewB = ANew( IR(i+k,m+k), ALL );
+    ANewT = A( IR(0,i), ALL );
+    ANewM = B;
+    ANewB = A( IR(i,m), ALL );
+}
+
+template<class MatType>
+void ExplicitDeleteRows( const MatType& A, Int i, Int k, MatType& ANew )
+{
+    const Int m = A.Height();
+    ANew.Resize( m-k, A.Width() );
+    auto ANewT = ANew( IR(0,i), ALL );
+    auto ANewB = ANew( IR(i,m-k), ALL );
+    ANewT = A( IR(0,i), ALL );
+    ANewB = A( IR(i+k,m), ALL );
+}
+
+template<class MatType>
+void ExplicitInsertCols
+( const MatType& A, Int j, const MatType& C, MatType& ANew )
+{
+    const Int n = A.Width();
+    const Int k = C.Width();
+    ANew.Resize( A.Height(), n+k );
+    auto ANewL = ANew( ALL, IR(0,j) );
+    auto ANewM = ANew( ALL, IR(j,j+k) );
+    auto ANewR = ANew( ALL, IR(j+k,n+k) );
+    ANewL = A( ALL, IR(0,j) );
+    ANewM = C;
+    ANewR = A( ALL, IR(j,n) );
+}
+
+template<class MatType>
+void ExplicitDeleteCols( const MatType& A, Int j, Int k, MatType& ANew )
+{
+    const Int n = A.Width();
+    ANew.Resize( A.Height(), n-k );
+    auto ANewL = ANew( ALL, IR(0,j) );
+    auto ANewR = ANew( ALL, IR(j,n-k) );
+    ANewL = A( ALL, IR(0,j) );
+    ANewR = A( ALL, IR(j+k,n) );
+}
+
+template<typename F>
+void TestCorrectness
+( const Matrix<F>& Q,
+  const Matrix<F>& R,
+  const Matrix<F>& A )
+{
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobA = FrobeniusNorm( A );
+
+    Matrix<F> E;
+    Identity( E, m, m );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    const Real orthogError = HermitianFrobeniusNorm( LOWER, E ) / (eps*m);
+    Output("||Q^H Q - I||_F / (eps m) = ",orthogError);
+
+    E = A;
+    Gemm( NORMAL, NORMAL, F(-1), Q, R, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / (eps*m*frobA);
+    Output("||A - Q R||_F / (eps m ||A||_F) = ",relError);
+
+    Matrix<F> RLower( R );
+    MakeTrapezoidal( LOWER, RLower, -1 );
+    const Real lowerNorm = FrobeniusNorm( RLower ) / (eps*frobA);
+    Output("|| tril(R,-1) ||_F / (eps ||A||_F) = ",lowerNorm);
+
+    // TODO: More rigorous failure condition
+    if( orthogError > Real(100) || relError > Real(100) )
+        LogicError("Unacceptably large relative error");
+    if( lowerNorm > Real(100) )
+        LogicError("R was not upper-trapezoidal");
+}
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& Q,
+  const DistMatrix<F>& R,
+  const DistMatrix<F>& A )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobA = FrobeniusNorm( A );
+
+    DistMatrix<F> E(g);
+    Identity( E, m, m );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    const Real orthogError = HermitianFrobeniusNorm( LOWER, E ) / (eps*m);
+    OutputFromRoot(g.Comm(),"||Q^H Q - I||_F / (eps m) = ",orthogError);
+
+    E = A;
+    Gemm( NORMAL, NORMAL, F(-1), Q, R, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / (eps*m*frobA);
+    OutputFromRoot(g.Comm(),"||A - Q R||_F / (eps m ||A||_F) = ",relError);
+
+    DistMatrix<F> RLower( R );
+    MakeTrapezoidal( LOWER, RLower, -1 );
+    const Real lowerNorm = FrobeniusNorm( RLower ) / (eps*frobA);
+    OutputFromRoot
+    (g.Comm(),"|| tril(R,-1) ||_F / (eps ||A||_F) = ",lowerNorm);
+
+    // TODO: More rigorous failure condition
+    if( orthogError > Real(100) || relError > Real(100) )
+        LogicError("Unacceptably large relative error");
+    if( lowerNorm > Real(100) )
+        LogicError("R was not upper-trapezoidal");
+}
+
+template<typename F>
+void TestQRMod
+( Int m,
+  Int n,
+  Int k,
+  bool print )
+{
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+
+    Matrix<F> A, Q, R, householderScalars;
+    Matrix<Base<F>> signature;
+    Uniform( A, m, n );
+    R = A;
+    QR( R, householderScalars, signature );
+    Identity( Q, m, m );
+    qr::ApplyQ( LEFT, NORMAL, R, householderScalars, signature, Q );
+    MakeTrapezoidal( UPPER, R );
+
+    Matrix<F> B, C, ANew;
+    const Int i = m/3;
+    const Int j = n/3;
+
+    Output("Inserting ",k," rows before row ",i);
+    Uniform( B, k, n );
+    qr::InsertRows( Q, R, i, B );
+    ExplicitInsertRows( A, i, B, ANew );
+    A = ANew;
+    TestCorrectness( Q, R, A );
+
+    Output("Deleting ",k," rows starting at row ",j);
+    qr::DeleteRows( Q, R, j, k );
+    ExplicitDeleteRows( A, j, k, ANew );
+    A = ANew;
+    TestCorrectness( Q, R, A );
+
+    Output("Inserting ",k," columns before column ",j);
+    Uniform( C, A.Height(), k );
+    qr::InsertCols( Q, R, j, C );
+    ExplicitInsertCols( A, j, C, ANew );
+    A = ANew;
+    TestCorrectness( Q, R, A );
+
+    Output("Deleting ",k," columns starting at column ",i);
+    qr::DeleteCols( Q, R, i, k );
+    ExplicitDeleteCols( A, i, k, ANew );
+    A = ANew;
+    TestCorrectness( Q, R, A );
+    if( print )
+    {
+        Print( Q, "Q" );
+        Print( R, "R" );
+    }
+
+    PopIndent();
+}
+
+template<typename F>
+void TestQRMod
+( const Grid& g,
+  Int m,
+  Int n,
+  Int k,
+  bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), Q(g), R(g);
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    Uniform( A, m, n );
+    R = A;
+    QR( R, householderScalars, signature );
+    Identity( Q, m, m );
+    qr::ApplyQ( LEFT, NORMAL, R, householderScalars, signature, Q );
+    MakeTrapezoidal( UPPER, R );
+
+    DistMatrix<F> B(g), C(g), ANew(g);
+    const Int i = m/3;
+    const Int j = n/3;
+
+    OutputFromRoot(g.Comm(),"Inserting ",k," rows before row ",i);
+    Uniform( B, k, n );
+    qr::InsertRows( Q, R, i, B );
+    ExplicitInsertRows( A, i, B, ANew );
+    A = ANew;
+    TestCorrectness( Q, R, A );
+
+    OutputFromRoot(g.Comm(),"Deleting ",k," rows starting at row ",j);
+    qr::DeleteRows( Q, R, j, k );
+    ExplicitDeleteRows( A, j, k, ANew );
+    A = ANew;
+    TestCorrectness( Q, R, A );
+
+    OutputFromRoot(g.Comm(),"Inserting ",k," columns before column ",j);
+    Uniform( C, A.Height(), k );
+    qr::InsertCols( Q, R, j, C );
+    ExplicitInsertCols( A, j, C, ANew );
+    A = ANew;
+    TestCorrectness( Q, R, A );
+
+    OutputFromRoot(g.Comm(),"Deleting ",k," columns starting at column ",i);
+    qr::DeleteCols( Q, R, i, k );
+    ExplicitDeleteCols( A, i, k, ANew );
+    A = ANew;
+    TestCorrectness( Q, R, A );
+    if( print )
+    {
+        Print( Q, "Q" );
+        Print( R, "R" );
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",60);
+        const Int k = Input("--k","number of rows/columns to modify",3);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, gridHeight, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( sequential && mpi::Rank() == 0 )
+        {
+            TestQRMod<float>( m, n, k, print );
+            TestQRMod<Complex<float>>( m, n, k, print );
+            TestQRMod<double>( m, n, k, print );
+            TestQRMod<Complex<double>>( m, n, k, print );
+        }
+
+        TestQRMod<float>( g, m, n, k, print );
+        TestQRMod<Complex<float>>( g, m, n, k, print );
+        TestQRMod<double>( g, m, n, k, print );
+        TestQRMod<Complex<double>>( g, m, n, k, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+string SketchName( SketchType sketch )
+{
+    if( sketch == GAUSSIAN_SKETCH )
+        return "Gaussian";
+    else if( sketch == SRFT_SKETCH )
+        return "SRFT";
+    else
+        return "sparse sign";
+}
+
+template<typename F>
+void CheckError( Base<F> relError )
+{
+    typedef Base<F> Real;
+    // TODO: More rigorous failure condition
+    const Real eps = limits::Epsilon<Real>();
+    if( relError > Pow(eps,Real(0.5)) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename F>
+void TestRandomized
+( Int m,
+  Int n,
+  Int rank,
+  SketchType sketch,
+  Int numPowerIts,
+  bool print )
+{
+    typedef Base<F> Real;
+    Output("Testing ",SketchName(sketch)," sketch with ",TypeName<F>());
+    PushIndent();
+
+    Matrix<F> X, Y, A;
+    Gaussian( X, m, rank );
+    Gaussian( Y, n, rank );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, A );
+    const Real frobA = FrobeniusNorm( A );
+    if( print )
+        Print( A, "A" );
+
+    RandomizedCtrl<Real> ctrl;
+    ctrl.sketch = sketch;
+    ctrl.numPowerIts = numPowerIts;
+
+    // Check || A - U diag(s) V^H ||_F / || A ||_F
+    Matrix<F> U, V;
+    Matrix<Real> s;
+    Timer timer;
+    timer.Start();
+    RandomizedSVD( A, U, s, V, rank, ctrl );
+    Output("RandomizedSVD: ",timer.Stop()," seconds");
+    if( print )
+        Print( s, "s" );
+    Matrix<F> E( A );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(-1), U, V, F(1), E );
+    const Real svdError = FrobeniusNorm( E ) / frobA;
+    Output("|| A - U S V^H ||_F / || A ||_F = ",svdError);
+    CheckError<F>( svdError );
+
+    // Check || A Omega^T - \hat{A} [I, Z] ||_F / || A ||_F
+    Permutation Omega;
+    Matrix<F> Z;
+    timer.Start();
+    RandomizedID( A, Omega, Z, rank, ctrl );
+    Output("RandomizedID: ",timer.Stop()," seconds");
+    const Int numSkel = Z.Height();
+    E = A;
+    Omega.PermuteCols( E );
+    auto hatA = E( ALL, IR(0,numSkel) );
+    auto ER = E( ALL, IR(numSkel,n) );
+    Gemm( NORMAL, NORMAL, F(-1), hatA, Z, F(1), ER );
+    Zero( hatA );
+    const Real idError = FrobeniusNorm( E ) / frobA;
+    Output("|| A Omega^T - \\hat{A} [I, Z] ||_F / || A ||_F = ",idError);
+    CheckError<F>( idError );
+
+    PopIndent();
+}
+
+template<typename F>
+void TestRandomized
+( const Grid& g,
+  Int m,
+  Int n,
+  Int rank,
+  SketchType sketch,
+  Int numPowerIts,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing ",SketchName(sketch)," sketch with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> X(g), Y(g), A(g);
+    Gaussian( X, m, rank );
+    Gaussian( Y, n, rank );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, A );
+    const Real frobA = FrobeniusNorm( A );
+    if( print )
+        Print( A, "A" );
+
+    RandomizedCtrl<Real> ctrl;
+    ctrl.sketch = sketch;
+    ctrl.numPowerIts = numPowerIts;
+
+    // Check || A - U diag(s) V^H ||_F / || A ||_F
+    DistMatrix<F> U(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    RandomizedSVD( A, U, s, V, rank, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"RandomizedSVD: ",timer.Stop()," seconds");
+    if( print )
+        Print( s, "s" );
+    DistMatrix<F> E( A );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(-1), U, V, F(1), E );
+    const Real svdError = FrobeniusNorm( E ) / frobA;
+    OutputFromRoot(g.Comm(),"|| A - U S V^H ||_F / || A ||_F = ",svdError);
+    CheckError<F>( svdError );
+
+    // Check || A Omega^T - \hat{A} [I, Z] ||_F / || A ||_F
+    DistPermutation Omega(g);
+    DistMatrix<F> Z(g);
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    RandomizedID( A, Omega, Z, rank, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"RandomizedID: ",timer.Stop()," seconds");
+    const Int numSkel = Z.Height();
+    E = A;
+    Omega.PermuteCols( E );
+    auto hatA = E( ALL, IR(0,numSkel) );
+    auto ER = E( ALL, IR(numSkel,n) );
+    Gemm( NORMAL, NORMAL, F(-1), hatA, Z, F(1), ER );
+    Zero( hatA );
+    const Real idError = FrobeniusNorm( E ) / frobA;
+    OutputFromRoot
+    (g.Comm(),"|| A Omega^T - \\hat{A} [I, Z] ||_F / || A ||_F = ",idError);
+    CheckError<F>( idError );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",200);
+        const Int n = Input("--n","width of matrix",150);
+        const Int rank = Input("--rank","rank of matrix",10);
+        const Int numPowerIts = Input("--numPowerIts","power iterations",1);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, gridHeight, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        const SketchType sketches[] =
+          { GAUSSIAN_SKETCH, SRFT_SKETCH, SPARSE_SIGN_SKETCH };
+        for( const SketchType sketch : sketches )
+        {
+            if( sequential && mpi::Rank() == 0 )
+            {
+                TestRandomized<double>
+                ( m, n, rank, sketch, numPowerIts, print );
+                TestRandomized<Complex<double>>
+                ( m, n, rank, sketch, numPowerIts, print );
+            }
+            TestRandomized<double>
+            ( g, m, n, rank, sketch, numPowerIts, print );
+            TestRandomized<Complex<double>>
+            ( g, m, n, rank, sketch, numPowerIts, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+vector<Real> Gammas( Int numGammas, double minGamma, double maxGamma )
+{
+    vector<Real> gammas( numGammas );
+    for( Int k=0; k<numGammas; ++k )
+    {
+        const double theta =
+          ( numGammas == 1 ? 0. : double(k)/double(numGammas-1) );
+        gammas[k] = Real(minGamma*Pow(maxGamma/minGamma,theta));
+    }
+    return gammas;
+}
+
+template<typename F>
+void TestDense
+( Int m,
+  Int n,
+  Int numRHS,
+  const vector<Base<F>>& gammas,
+  const Grid& g )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing dense sweep with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), B(g);
+    Uniform( A, m, n );
+    Uniform( B, m, numRHS );
+
+    Timer timer;
+    timer.Start();
+    DistRidgeSolver<F> solver( NORMAL, A );
+    vector<DistMatrix<F>> X;
+    solver.Solve( B, gammas, X );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot
+    (g.Comm(),"Sweep over ",gammas.size()," gammas: ",timer.Stop()," secs");
+
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<F> XRef(g);
+    for( Int k=0; k<Int(gammas.size()); ++k )
+    {
+        Ridge( NORMAL, A, B, gammas[k], XRef, RIDGE_SVD );
+        const Real frobRef = FrobeniusNorm( XRef );
+        XRef -= X[k];
+        const Real relError = FrobeniusNorm( XRef ) / frobRef;
+        OutputFromRoot
+        (g.Comm(),"gamma=",gammas[k],": || X - XRef ||_F / || XRef ||_F = ",
+         relError);
+        if( relError > Sqrt(eps) )
+            LogicError("Unacceptably large relative error");
+    }
+    PopIndent();
+}
+
+template<typename F>
+void TestSparse
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numRHS,
+  const vector<Base<F>>& gammas,
+  mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(comm,"Testing sparse sweep with ",TypeName<F>());
+    PushIndent();
+    const Int N = n1*n2*n3;
+
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, n1, n2, n3 );
+    DistMultiVec<F> B(comm);
+    Uniform( B, N, numRHS );
+
+    Timer timer;
+    timer.Start();
+    vector<DistMultiVec<F>> X;
+    Ridge( NORMAL, A, B, gammas, X );
+    mpi::Barrier( comm );
+    OutputFromRoot
+    (comm,"Sweep over ",gammas.size()," gammas: ",timer.Stop()," secs");
+
+    // Check the residuals of the normal equations,
+    // (A^H A + gamma^2 I) X = A^H B
+    const Real eps = limits::Epsilon<Real>();
+    DistMultiVec<F> AAdjB(comm), AX(comm), E(comm);
+    Zeros( AAdjB, N, numRHS );
+    Multiply( ADJOINT, F(1), A, B, F(0), AAdjB );
+    const Real frobAAdjB = FrobeniusNorm( AAdjB );
+    for( Int k=0; k<Int(gammas.size()); ++k )
+    {
+        Zeros( AX, N, numRHS );
+        Multiply( NORMAL, F(1), A, X[k], F(0), AX );
+        E = X[k];
+        E *= F(gammas[k]*gammas[k]);
+        Multiply( ADJOINT, F(1), A, AX, F(1), E );
+        E -= AAdjB;
+        const Real relResid = FrobeniusNorm( E ) / frobAAdjB;
+        OutputFromRoot
+        (comm,"gamma=",gammas[k],": relative normal-equation residual = ",
+         relResid);
+        if( relResid > Pow(eps,Real(0.5)) )
+            LogicError("Unacceptably large relative residual");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of dense matrix",200);
+        const Int n = Input("--n","width of dense matrix",100);
+        const Int n1 = Input("--n1","first grid dimension",10);
+        const Int n2 = Input("--n2","second grid dimension",10);
+        const Int n3 = Input("--n3","third grid dimension",10);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const Int numGammas = Input("--numGammas","number of gammas",10);
+        const double minGamma = Input("--minGamma","smallest gamma",0.01);
+        const double maxGamma = Input("--maxGamma","largest gamma",10.);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestDense<double>
+        ( m, n, numRHS, Gammas<double>(numGammas,minGamma,maxGamma), g );
+        TestDense<Complex<double>>
+        ( m, n, numRHS, Gammas<double>(numGammas,minGamma,maxGamma), g );
+
+        TestSparse<double>
+        ( n1, n2, n3, numRHS, Gammas<double>(numGammas,minGamma,maxGamma),
+          comm );
+        TestSparse<Complex<double>>
+        ( n1, n2, n3, numRHS, Gammas<double>(numGammas,minGamma,maxGamma),
+          comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -20,6 +20,7 @@ void TestSequentialSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool jacobi,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -41,6 +42,7 @@ void TestSequentialSVD
 
     SVDCtrl<Real> ctrl;
     ctrl.bidiagSVDCtrl.useQR = useQR;
+    ctrl.useJacobi = jacobi;
     ctrl.bidiagSVDCtrl.wantU = wantU; 
     ctrl.bidiagSVDCtrl.wantV = wantV;
     ctrl.bidiagSVDCtrl.approach = approach;
@@ -161,6 +163,7 @@ void TestDistributedSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool jacobi,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -182,6 +185,7 @@ void TestDistributedSVD
     // Compute the SVD of A 
     SVDCtrl<Real> ctrl;
     ctrl.bidiagSVDCtrl.useQR = useQR;
+    ctrl.useJacobi = jacobi;
     ctrl.bidiagSVDCtrl.wantU = wantU; 
     ctrl.bidiagSVDCtrl.wantV = wantV;
     ctrl.bidiagSVDCtrl.approach = approach;
@@ -327,6 +331,7 @@ void TestSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool jacobi,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -336,13 +341,14 @@ void TestSVD
     {
         TestSequentialSVD<F>
         ( m, n, rank, approach, tolType, tol, time, progress, wantU, wantV,
-          useQR, penalizeDerivative, divideCutoff, print );
+          useQR, jacobi, penalizeDerivative, divideCutoff, print );
     }
     if( testDist )
     {
         TestDistributedSVD<F> 
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+          wantU, wantV, useQR, jacobi, penalizeDerivative, divideCutoff,
+          print );
     }
 }
 
@@ -377,6 +383,7 @@ main( int argc, char* argv[] )
         const bool wantU = Input("--wantU","compute U?",true);
         const bool wantV = Input("--wantV","compute V?",true);
         const bool useQR = Input("--useQR","force use of QR algorithm?",false);
+        const bool jacobi = Input("--jacobi","use one-sided Jacobi?",false);
         const bool penalizeDerivative =
           Input
           ("--penalizeDerivative","penalize secular derivative in D&C?",false);
@@ -404,61 +411,61 @@ main( int argc, char* argv[] )
 
         TestSVD<float>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<float>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
 
         TestSVD<double>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<double>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
 
 #ifdef EL_HAVE_QD
         TestSVD<DoubleDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<DoubleDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
 
         TestSVD<QuadDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<QuadDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestSVD<Quad>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<Quad>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestSVD<BigFloat>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<BigFloat>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
+          testSeq, testDist, wantU, wantV, useQR, jacobi, penalizeDerivative,
           divideCutoff, print );
 #endif
     }
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestSelectedInversion
+( Int n1,
+  Int n2,
+  LDLFrontType frontType,
+  const BisectCtrl& ctrl,
+  bool print )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+
+    SparseMatrix<F> A;
+    Helmholtz( A, n1, n2, F(-1) );
+    const Int n = A.Height();
+
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    vector<Int> map, invMap;
+    ldl::NestedDissection( A.LockedGraph(), map, rootSep, info, ctrl );
+    InvertMap( map, invMap );
+    ldl::Front<F> front( A, map, info );
+    LDL( info, front, frontType );
+
+    Timer timer;
+    timer.Start();
+    Matrix<F> diagInv;
+    ldl::SelectedInversion( invMap, info, front, diagInv );
+    Output("Diagonal selected inversion: ",timer.Stop()," seconds");
+    timer.Start();
+    SparseMatrix<F> AInv;
+    ldl::SelectedInversion( A, invMap, info, front, AInv );
+    Output("Pattern selected inversion: ",timer.Stop()," seconds");
+
+    // Form the explicit inverse with one solve per column for comparison
+    Matrix<F> X;
+    Identity( X, n, n );
+    timer.Start();
+    ldl::SolveAfter( invMap, info, front, X );
+    Output("Explicit inversion: ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( diagInv, "diag(inv(A))" );
+        Print( AInv, "inv(A) on pattern of A" );
+    }
+
+    const Real frobX = FrobeniusNorm( X );
+    Matrix<F> diagX;
+    GetDiagonal( X, diagX );
+    diagX -= diagInv;
+    const Real diagError = FrobeniusNorm( diagX ) / frobX;
+    Output("|| diag(inv(A)) - d ||_F / || inv(A) ||_F = ",diagError);
+
+    Real patternErrorSquared = 0;
+    const Int numEntries = AInv.NumEntries();
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const F diff = X(AInv.Row(e),AInv.Col(e)) - AInv.Value(e);
+        patternErrorSquared += RealPart(diff*Conj(diff));
+    }
+    const Real patternError = Sqrt(patternErrorSquared) / frobX;
+    Output("|| P_A( inv(A) - Z ) ||_F / || inv(A) ||_F = ",patternError);
+
+    // TODO: More rigorous failure condition
+    const Real eps = limits::Epsilon<Real>();
+    if( diagError > n*eps*Real(100) || patternError > n*eps*Real(100) )
+        LogicError("Unacceptably large relative error");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",30);
+        const Int n2 = Input("--n2","second grid dimension",25);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        const bool block = Input("--block","block LDL fronts?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+        const LDLFrontType frontType = ( block ? BLOCK_LDL_2D : LDL_2D );
+
+        if( mpi::Rank() == 0 )
+        {
+            TestSelectedInversion<float>( n1, n2, frontType, ctrl, print );
+            TestSelectedInversion<Complex<float>>
+            ( n1, n2, frontType, ctrl, print );
+            TestSelectedInversion<double>( n1, n2, frontType, ctrl, print );
+            TestSelectedInversion<Complex<double>>
+            ( n1, n2, frontType, ctrl, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
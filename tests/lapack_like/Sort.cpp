@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares the distributed Sort and Median against gathering onto a single
+// process and sorting there. The heights straddle the square of the number
+// of processes, below which Sort falls back to the gather, and the entries
+// are either uniform or drawn from only a few distinct values.
+
+template<typename Real>
+void FillMatrix( AbstractDistMatrix<Real>& X, Int m, Int n, bool duplicates )
+{
+    Uniform( X, m, n );
+    if( duplicates )
+    {
+        // Round to one of five distinct values
+        auto& XLoc = X.Matrix();
+        for( Int jLoc=0; jLoc<XLoc.Width(); ++jLoc )
+            for( Int iLoc=0; iLoc<XLoc.Height(); ++iLoc )
+                XLoc(iLoc,jLoc) = Round( 2*XLoc(iLoc,jLoc) );
+    }
+}
+
+template<typename Real>
+void TestSort
+( Int m, Int n, bool duplicates, SortType sort, const Grid& g )
+{
+    DistMatrix<Real> X(g);
+    FillMatrix( X, m, n, duplicates );
+
+    // Gather onto a single process and sort there
+    DistMatrix<Real,CIRC,CIRC> XRef( X );
+    Sort( XRef, sort );
+    DistMatrix<Real,STAR,STAR> XRef_STAR_STAR( XRef );
+
+    Sort( X, sort );
+    DistMatrix<Real,STAR,STAR> X_STAR_STAR( X );
+
+    Int numMismatches = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( X_STAR_STAR.GetLocal(i,j) != XRef_STAR_STAR.GetLocal(i,j) )
+                ++numMismatches;
+    if( numMismatches != 0 )
+        LogicError
+        ("Sorting a ",m," x ",n," matrix ",
+         (sort==ASCENDING ? "in ascending order" : "in descending order"),
+         (duplicates ? " with duplicates" : "")," had ",numMismatches,
+         " mismatched entries");
+}
+
+template<typename Real>
+void TestMedian( Int k, bool duplicates, bool rowVector, const Grid& g )
+{
+    DistMatrix<Real> x(g);
+    if( rowVector )
+        FillMatrix( x, 1, k, duplicates );
+    else
+        FillMatrix( x, k, 1, duplicates );
+    const auto median = Median( x );
+
+    // Gather onto a single process and sort there
+    DistMatrix<Real,CIRC,CIRC> xRef( x );
+    Sort( xRef );
+    DistMatrix<Real,STAR,STAR> xRef_STAR_STAR( xRef );
+    const Real refValue =
+      ( rowVector ? xRef_STAR_STAR.GetLocal(0,k/2)
+                  : xRef_STAR_STAR.GetLocal(k/2,0) );
+    if( median.value != refValue )
+        LogicError
+        ("Median of ",k," entries",(duplicates ? " with duplicates" : ""),
+         " was ",median.value," rather than ",refValue);
+
+    // The returned index must point to an entry with the median value
+    const Real indexValue =
+      ( rowVector ? x.Get(0,median.index) : x.Get(median.index,0) );
+    if( indexValue != median.value )
+        LogicError
+        ("Median index ",median.index," pointed to ",indexValue,
+         " rather than ",median.value);
+}
+
+template<typename Real>
+void TestSortAndMedian( Int n, const Grid& g )
+{
+    mpi::Comm comm = g.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<Real>());
+    PushIndent();
+
+    // Straddle the height at which Sort switches to regular sampling
+    const Int cutoff = g.Size()*g.Size();
+    vector<Int> heights = { Max(cutoff-1,1), cutoff, cutoff+1, 3*cutoff+5 };
+    for( const Int m : heights )
+    {
+        for( const bool duplicates : { false, true } )
+        {
+            for( const SortType sort : { ASCENDING, DESCENDING } )
+                TestSort<Real>( m, n, duplicates, sort, g );
+            for( const bool rowVector : { false, true } )
+                TestMedian<Real>( m, duplicates, rowVector, g );
+        }
+        OutputFromRoot(comm,"Height ",m," passed");
+    }
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--n","number of columns to sort",3);
+        ProcessInput();
+        PrintInputReport();
+
+        // Sweep a single process, half of the processes, and all of them
+        vector<int> teamSizes = { 1, Max(commSize/2,1), commSize };
+        std::sort( teamSizes.begin(), teamSizes.end() );
+        teamSizes.erase
+        ( std::unique( teamSizes.begin(), teamSizes.end() ),
+          teamSizes.end() );
+        for( const int teamSize : teamSizes )
+        {
+            mpi::Comm teamComm;
+            const bool inTeam = ( commRank < teamSize );
+            mpi::Split( comm, inTeam ? 0 : 1, commRank, teamComm );
+            if( inTeam )
+            {
+                const Grid g( teamComm, Grid::FindFactor(teamSize) );
+                OutputFromRoot
+                (teamComm,"Testing over a ",g.Height()," x ",g.Width(),
+                 " grid");
+                TestSortAndMedian<float>( n, g );
+                TestSortAndMedian<double>( n, g );
+            }
+            mpi::Free( teamComm );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
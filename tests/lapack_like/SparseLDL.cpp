@@ -246,6 +246,12 @@ int main( int argc, char* argv[] )
         const Int nbFact = Input("--nbFact","factorization blocksize",96);
         const Int nbSolve = Input("--nbSolve","solve blocksize",96);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool amalgamate =
+          Input("--amalgamate","amalgamate supernodes?",false);
+        const Int amalgamateSize =
+          Input("--amalgamateSize","always merge up to this size",16);
+        const double amalgamateFillTol =
+          Input("--amalgamateFillTol","relative fill for merges",0.05);
         const bool unpack = Input("--unpack","unpack frontal matrix?",true);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
@@ -259,6 +265,9 @@ int main( int argc, char* argv[] )
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        ctrl.amalgamate = amalgamate;
+        ctrl.amalgamateSize = amalgamateSize;
+        ctrl.amalgamateFillTol = amalgamateFillTol;
 
         // TODO(poulson): Call complex variants as well
 
@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestBLR
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numRHS,
+  Int maxRefineIts,
+  const ldl::BLRCtrl<Base<F>>& blrCtrl,
+  const BisectCtrl& ctrl,
+  bool print )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+
+    SparseMatrix<F> A;
+    Helmholtz( A, n1, n2, n3, F(-1) );
+    const Int n = A.Height();
+
+    Matrix<F> X, B;
+    Uniform( X, n, numRHS );
+    Zeros( B, n, numRHS );
+    Multiply( NORMAL, F(1), A, X, F(0), B );
+    const Real frobB = FrobeniusNorm( B );
+
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    vector<Int> map, invMap;
+    ldl::NestedDissection( A.LockedGraph(), map, rootSep, info, ctrl );
+    InvertMap( map, invMap );
+
+    Timer timer;
+    ldl::Front<F> front( A, map, info );
+    timer.Start();
+    LDL( info, front, BLR_LDL_2D, blrCtrl );
+    Output("BLR factorization: ",timer.Stop()," seconds");
+
+    // A single solve only recovers the accuracy of the compression
+    Matrix<F> Y( B );
+    ldl::SolveAfter( invMap, info, front, Y );
+    Matrix<F> E( B );
+    Multiply( NORMAL, F(-1), A, Y, F(1), E );
+    const Real solveResidual = FrobeniusNorm( E ) / frobB;
+    Output("|| B - A inv(L D L^T) B ||_F / || B ||_F = ",solveResidual);
+
+    Y = B;
+    timer.Start();
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto y = Y( ALL, IR(j) );
+        ldl::SolveWithIterativeRefinement
+        ( A, invMap, info, front, y, Real(0.5), maxRefineIts );
+    }
+    Output("Refined solves: ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( X, "X" );
+        Print( Y, "Y" );
+    }
+    E = B;
+    Multiply( NORMAL, F(-1), A, Y, F(1), E );
+    const Real refinedResidual = FrobeniusNorm( E ) / frobB;
+    Output("|| B - A Y ||_F / || B ||_F = ",refinedResidual);
+
+    // TODO: More rigorous failure condition
+    if( refinedResidual > solveResidual &&
+        refinedResidual > Sqrt(limits::Epsilon<Real>()) )
+        LogicError("Iterative refinement did not improve the solution");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",12);
+        const Int n2 = Input("--n2","second grid dimension",12);
+        const Int n3 = Input("--n3","third grid dimension",12);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        const Int minFrontSize =
+          Input("--minFrontSize","smallest compressed front",128);
+        const Int tileSize = Input("--tileSize","BLR tile size",32);
+        const double tol = Input("--tol","BLR compression tolerance",1e-4);
+        const Int maxRefineIts =
+          Input("--maxRefineIts","max refinement iterations",20);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+
+        if( mpi::Rank() == 0 )
+        {
+            ldl::BLRCtrl<float> blrCtrlFloat;
+            blrCtrlFloat.minFrontSize = minFrontSize;
+            blrCtrlFloat.tileSize = tileSize;
+            blrCtrlFloat.tol = tol;
+            TestBLR<float>
+            ( n1, n2, n3, numRHS, maxRefineIts, blrCtrlFloat, ctrl, print );
+            TestBLR<Complex<float>>
+            ( n1, n2, n3, numRHS, maxRefineIts, blrCtrlFloat, ctrl, print );
+
+            ldl::BLRCtrl<double> blrCtrlDouble;
+            blrCtrlDouble.minFrontSize = minFrontSize;
+            blrCtrlDouble.tileSize = tileSize;
+            blrCtrlDouble.tol = tol;
+            TestBLR<double>
+            ( n1, n2, n3, numRHS, maxRefineIts, blrCtrlDouble, ctrl, print );
+            TestBLR<Complex<double>>
+            ( n1, n2, n3, numRHS, maxRefineIts, blrCtrlDouble, ctrl, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
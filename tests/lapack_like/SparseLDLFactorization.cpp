@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestFactorization
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numRepeats,
+  LDLFrontType frontType,
+  const BisectCtrl& ctrl,
+  mpi::Comm& comm )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    PushIndent();
+    const Int N = n1*n2*n3;
+
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    Timer timer;
+    DistSparseLDLFactorization<F> factorization;
+    timer.Start();
+    factorization.Initialize( A, false, frontType, ctrl );
+    mpi::Barrier( comm );
+    OutputFromRoot(comm,"Analysis and factorization: ",timer.Stop()," seconds");
+
+    const Real eps = limits::Epsilon<Real>();
+    for( Int repeat=0; repeat<numRepeats; ++repeat )
+    {
+        if( repeat != 0 )
+        {
+            // Change the values while keeping the sparsity pattern
+            ShiftDiagonal( A, F(-1) );
+            timer.Start();
+            factorization.Refactor( A );
+            mpi::Barrier( comm );
+            OutputFromRoot(comm,"Refactorization: ",timer.Stop()," seconds");
+        }
+
+        DistMultiVec<F> X(comm), B(comm);
+        Uniform( X, N, 1 );
+        Zeros( B, N, 1 );
+        Multiply( NORMAL, F(1), A, X, F(0), B );
+        const Real frobB = FrobeniusNorm( B );
+
+        DistMultiVec<F> Y(comm);
+        Y = B;
+        timer.Start();
+        factorization.Solve( Y );
+        mpi::Barrier( comm );
+        OutputFromRoot(comm,"Solve: ",timer.Stop()," seconds");
+        Multiply( NORMAL, F(-1), A, Y, F(1), B );
+        const Real relResid = FrobeniusNorm( B ) / frobB;
+        OutputFromRoot(comm,"|| B - A Y ||_F / || B ||_F = ",relResid);
+
+        // TODO: More rigorous failure condition
+        if( relResid > Sqrt(eps) )
+            LogicError("Unacceptably large relative residual");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRepeats = Input
+            ("--numRepeats","number of repeated factorizations",3);
+        const bool block = Input("--block","block LDL fronts?",false);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+        const LDLFrontType frontType = ( block ? BLOCK_LDL_2D : LDL_2D );
+
+        TestFactorization<float>
+        ( n1, n2, n3, numRepeats, frontType, ctrl, comm );
+        TestFactorization<double>
+        ( n1, n2, n3, numRepeats, frontType, ctrl, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
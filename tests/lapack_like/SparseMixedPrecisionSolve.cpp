@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestMixedPrecision
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numRHS,
+  Base<F> regMag,
+  bool progress,
+  mpi::Comm& comm )
+{
+    typedef Base<F> Real;
+    typedef Demote<F> FLow;
+    OutputFromRoot
+    (comm,"Testing with ",TypeName<F>()," and ",TypeName<FLow>()," factors");
+    PushIndent();
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 10*Pow(eps,Real(0.5));
+    RegSolveCtrl<Real> ctrl;
+    ctrl.progress = progress;
+    Timer timer;
+
+    if( mpi::Rank(comm) == 0 )
+    {
+        SparseMatrix<F> A;
+        Laplacian( A, n1, n2, n3 );
+        const Int n = A.Height();
+        Matrix<Real> reg;
+        Ones( reg, n, 1 );
+        reg *= regMag;
+        Matrix<F> B;
+        Uniform( B, n, numRHS );
+
+        // Factor A + diag(reg) in the demoted precision
+        SparseMatrix<FLow> ALow;
+        Copy( A, ALow );
+        Matrix<FLow> regLow;
+        Copy( reg, regLow );
+        UpdateDiagonal( ALow, FLow(1), regLow );
+        ldl::NodeInfo info;
+        ldl::Separator sep;
+        vector<Int> map, invMap;
+        ldl::NestedDissection( ALow.LockedGraph(), map, sep, info );
+        InvertMap( map, invMap );
+        ldl::Front<FLow> front( ALow, map, info );
+        LDL( info, front, LDL_2D );
+
+        auto X( B );
+        timer.Start();
+        reg_ldl::MixedPrecisionSolveAfter
+        ( A, reg, invMap, info, front, X, ctrl );
+        Output("Sequential solve: ",timer.Stop()," seconds");
+        auto R( B );
+        Multiply( NORMAL, F(-1), A, X, F(1), R );
+        const Real relResid = FrobeniusNorm(R) / FrobeniusNorm(B);
+        Output("|| B - A X ||_F / || B ||_F = ",relResid);
+        if( relResid > tol )
+            LogicError("Unacceptably large relative residual");
+    }
+
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, n1, n2, n3 );
+    const Int n = A.Height();
+    DistMultiVec<Real> reg(comm);
+    Ones( reg, n, 1 );
+    reg *= regMag;
+    DistMultiVec<F> B(comm);
+    Uniform( B, n, numRHS );
+
+    DistSparseMatrix<FLow> ALow(comm);
+    Copy( A, ALow );
+    DistMultiVec<FLow> regLow(comm);
+    Copy( reg, regLow );
+    UpdateDiagonal( ALow, FLow(1), regLow );
+    ldl::DistNodeInfo info;
+    ldl::DistSeparator sep;
+    DistMap map, invMap;
+    ldl::NestedDissection( ALow.LockedDistGraph(), map, sep, info );
+    InvertMap( map, invMap );
+    ldl::DistFront<FLow> front( ALow, map, sep, info );
+    LDL( info, front, LDL_2D );
+
+    DistMultiVec<F> X(comm);
+    X = B;
+    timer.Start();
+    reg_ldl::MixedPrecisionSolveAfter( A, reg, invMap, info, front, X, ctrl );
+    OutputFromRoot(comm,"Distributed solve: ",timer.Stop()," seconds");
+    DistMultiVec<F> R(comm);
+    R = B;
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    const Real relResid = FrobeniusNorm(R) / FrobeniusNorm(B);
+    OutputFromRoot(comm,"|| B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > tol )
+        LogicError("Unacceptably large relative residual");
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",15);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int n3 = Input("--n3","third grid dimension",15);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const double regMag =
+          Input("--regMag","magnitude of the regularization",1e-6);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        TestMixedPrecision<double>
+        ( n1, n2, n3, numRHS, regMag, progress, comm );
+        TestMixedPrecision<Complex<double>>
+        ( n1, n2, n3, numRHS, regMag, progress, comm );
+#ifdef EL_HAVE_QD
+        TestMixedPrecision<DoubleDouble>
+        ( n1, n2, n3, numRHS, regMag, progress, comm );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+Base<F> RelativeResidual
+( const SparseMatrix<F>& A, const Matrix<F>& B, const Matrix<F>& X )
+{
+    auto R( B );
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    return FrobeniusNorm(R) / FrobeniusNorm(B);
+}
+
+template<typename F>
+Base<F> RelativeResidual
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+  const DistMultiVec<F>& X )
+{
+    DistMultiVec<F> R(A.Comm());
+    R = B;
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    return FrobeniusNorm(R) / FrobeniusNorm(B);
+}
+
+template<typename F>
+void TestPreconditioners
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numRHS,
+  Int procsPerSubdomain,
+  bool progress,
+  mpi::Comm& comm )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    PushIndent();
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 10*Pow(eps,Real(0.5));
+    Timer timer;
+
+    // An incomplete LDL factorization of a (sequential) Laplacian
+    {
+        SparseMatrix<F> A;
+        Laplacian( A, n1, n2, n3 );
+        Matrix<F> B;
+        Uniform( B, A.Height(), numRHS );
+
+        IncompleteLDLFactorization<F> factorization;
+        timer.Start();
+        factorization.Initialize( A );
+        OutputFromRoot
+        (comm,"Incomplete LDL: ",timer.Stop()," seconds, ",
+         factorization.NumEntries()," entries in L");
+
+        KrylovSolveCtrl<Real> ctrl;
+        ctrl.alg = KRYLOV_CG;
+        ctrl.progress = progress;
+        Matrix<F> X;
+        Zeros( X, A.Height(), numRHS );
+        timer.Start();
+        auto info = KrylovSolve
+          ( [&]( const Matrix<F>& Y, Matrix<F>& Z )
+            {
+                Zeros( Z, A.Height(), Y.Width() );
+                Multiply( NORMAL, F(1), A, Y, F(0), Z );
+            },
+            factorization, B, X, ctrl );
+        OutputFromRoot
+        (comm,"ILDL-preconditioned CG: ",timer.Stop()," seconds, ",
+         info.numConverged," converged after ",info.numIts," iterations");
+        Real relResid = RelativeResidual( A, B, X );
+        OutputFromRoot(comm,"|| B - A X ||_F / || B ||_F = ",relResid);
+        if( relResid > tol )
+            LogicError("Unacceptably large relative residual");
+
+        RegSolveCtrl<Real> regCtrl;
+        regCtrl.maxIts = 100;
+        regCtrl.restart = 30;
+        regCtrl.progress = progress;
+        X = B;
+        timer.Start();
+        SolveWithPreconditioner( A, factorization, X, regCtrl );
+        OutputFromRoot
+        (comm,"ILDL-preconditioned FGMRES: ",timer.Stop()," seconds");
+        relResid = RelativeResidual( A, B, X );
+        OutputFromRoot(comm,"|| B - A X ||_F / || B ||_F = ",relResid);
+        if( relResid > tol )
+            LogicError("Unacceptably large relative residual");
+    }
+
+    // Block Jacobi preconditioners of a distributed Laplacian
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, n1, n2, n3 );
+    DistMultiVec<F> B(comm);
+    Uniform( B, A.Height(), numRHS );
+    for( Int incomplete=0; incomplete<2; ++incomplete )
+    {
+        BlockJacobiCtrl<Real> jacobiCtrl;
+        jacobiCtrl.incomplete = incomplete;
+        jacobiCtrl.procsPerSubdomain = ( incomplete ? 1 : procsPerSubdomain );
+        BlockJacobiPreconditioner<F> precond;
+        timer.Start();
+        precond.Initialize( A, jacobiCtrl );
+        OutputFromRoot
+        (comm,(incomplete?"Incomplete b":"B"),"lock Jacobi setup: ",
+         timer.Stop()," seconds");
+
+        KrylovSolveCtrl<Real> ctrl;
+        ctrl.progress = progress;
+        DistMultiVec<F> X(comm);
+        Zeros( X, A.Height(), numRHS );
+        timer.Start();
+        auto info = KrylovSolve
+          ( [&]( const DistMultiVec<F>& Y, DistMultiVec<F>& Z )
+            {
+                Zeros( Z, A.Height(), Y.Width() );
+                Multiply( NORMAL, F(1), A, Y, F(0), Z );
+            },
+            precond, B, X, ctrl );
+        OutputFromRoot
+        (comm,"Block-Jacobi-preconditioned GMRES: ",timer.Stop(),
+         " seconds, ",info.numConverged," converged after ",info.numIts,
+         " iterations");
+        const Real relResid = RelativeResidual( A, B, X );
+        OutputFromRoot(comm,"|| B - A X ||_F / || B ||_F = ",relResid);
+        if( relResid > tol )
+            LogicError("Unacceptably large relative residual");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",15);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int n3 = Input("--n3","third grid dimension",15);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const Int procsPerSubdomain =
+          Input("--procsPerSubdomain","processes per subdomain",2);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        TestPreconditioners<double>
+        ( n1, n2, n3, numRHS, procsPerSubdomain, progress, comm );
+        TestPreconditioners<Complex<double>>
+        ( n1, n2, n3, numRHS, procsPerSubdomain, progress, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
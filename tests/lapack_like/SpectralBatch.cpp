@@ -0,0 +1,176 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestHermitianEigBatch
+( Int n,
+  Int numMatrices,
+  const BatchSpectralCtrl<F>& ctrl,
+  bool print )
+{
+    typedef Base<F> Real;
+    Output("Testing HermitianEigBatch with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> ABatch, QBatch;
+    Matrix<Real> wBatch;
+    Uniform( ABatch, n, n*numMatrices );
+    Zeros( QBatch, n, n*numMatrices );
+    Zeros( wBatch, n, numMatrices );
+    auto AOrig( ABatch );
+
+    Timer timer;
+    timer.Start();
+    HermitianEigBatch
+    ( LOWER, n, numMatrices,
+      ABatch.Buffer(), ABatch.LDim(), n*ABatch.LDim(),
+      wBatch.Buffer(), wBatch.LDim(),
+      QBatch.Buffer(), QBatch.LDim(), n*QBatch.LDim(), ctrl );
+    Output("Time = ",timer.Stop()," seconds");
+
+    Real maxOrthogError=0, maxError=0;
+    Matrix<F> X, QW;
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        auto A = AOrig( ALL, IR(k*n,(k+1)*n) );
+        auto Q = QBatch( ALL, IR(k*n,(k+1)*n) );
+        auto w = wBatch( ALL, IR(k) );
+        if( print )
+        {
+            Print( w, "w" );
+            Print( Q, "Q" );
+        }
+        for( Int j=1; j<n; ++j )
+            if( w(j) < w(j-1) )
+                LogicError("Eigenvalues were not sorted in ascending order");
+
+        Identity( X, n, n );
+        Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), X );
+        maxOrthogError =
+          Max( maxOrthogError, HermitianInfinityNorm(LOWER,X)/(eps*n) );
+
+        Zeros( X, n, n );
+        Hemm( LEFT, LOWER, F(1), A, Q, F(0), X );
+        QW = Q;
+        DiagonalScale( RIGHT, NORMAL, w, QW );
+        X -= QW;
+        const Real oneNormA = HermitianOneNorm( LOWER, A );
+        maxError = Max( maxError, InfinityNorm(X)/(eps*n*oneNormA) );
+    }
+    Output("max ||Q^H Q - I||_oo / (eps n) = ",maxOrthogError);
+    Output("max ||A Q - Q W||_oo / (eps n ||A||_1) = ",maxError);
+    if( maxOrthogError > Real(200) )
+        LogicError("Relative orthogonality error was unacceptably large");
+    if( maxError > Real(10) )
+        LogicError("Relative error was unacceptably large");
+    PopIndent();
+}
+
+template<typename F>
+void TestSVDBatch
+( Int m,
+  Int n,
+  Int numMatrices,
+  const BatchSpectralCtrl<F>& ctrl,
+  bool print )
+{
+    typedef Base<F> Real;
+    Output("Testing SVDBatch with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+    const Int minDim = Min(m,n);
+    const Int maxDim = Max(m,n);
+
+    Matrix<F> ABatch, UBatch, VBatch;
+    Matrix<Real> sBatch;
+    Uniform( ABatch, m, n*numMatrices );
+    Zeros( UBatch, m, minDim*numMatrices );
+    Zeros( VBatch, n, minDim*numMatrices );
+    Zeros( sBatch, minDim, numMatrices );
+
+    Timer timer;
+    timer.Start();
+    SVDBatch
+    ( m, n, numMatrices,
+      ABatch.LockedBuffer(), ABatch.LDim(), n*ABatch.LDim(),
+      UBatch.Buffer(), UBatch.LDim(), minDim*UBatch.LDim(),
+      sBatch.Buffer(), sBatch.LDim(),
+      VBatch.Buffer(), VBatch.LDim(), minDim*VBatch.LDim(), ctrl );
+    Output("Time = ",timer.Stop()," seconds");
+
+    Real maxError=0;
+    Matrix<F> X;
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        auto A = ABatch( ALL, IR(k*n,(k+1)*n) );
+        auto U = UBatch( ALL, IR(k*minDim,(k+1)*minDim) );
+        auto V = VBatch( ALL, IR(k*minDim,(k+1)*minDim) );
+        auto s = sBatch( ALL, IR(k) );
+        if( print )
+            Print( s, "s" );
+        for( Int j=1; j<minDim; ++j )
+            if( s(j) > s(j-1) )
+                LogicError
+                ("Singular values were not sorted in descending order");
+
+        X = V;
+        DiagonalScale( RIGHT, NORMAL, s, X );
+        Matrix<F> E( A );
+        Gemm( NORMAL, ADJOINT, F(-1), U, X, F(1), E );
+        maxError = Max( maxError, InfinityNorm(E)/(eps*maxDim*OneNorm(A)) );
+    }
+    Output("max ||A - U S V'||_oo / (eps Max(m,n) ||A||_1) = ",maxError);
+    if( maxError > Real(10) )
+        LogicError("Relative error was unacceptably large");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--height","height of SVD matrices",12);
+        const Int n = Input("--n","size of the matrices",8);
+        const Int numMatrices = Input("--numMatrices","batch size",100);
+        const Int jacobiCutoff =
+          Input("--jacobiCutoff","largest size handled by Jacobi",32);
+        const bool print = Input("--print","print results?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        BatchSpectralCtrl<float> ctrlFloat;
+        BatchSpectralCtrl<Complex<float>> ctrlComplexFloat;
+        BatchSpectralCtrl<double> ctrlDouble;
+        BatchSpectralCtrl<Complex<double>> ctrlComplexDouble;
+        ctrlFloat.jacobiCutoff = jacobiCutoff;
+        ctrlComplexFloat.jacobiCutoff = jacobiCutoff;
+        ctrlDouble.jacobiCutoff = jacobiCutoff;
+        ctrlComplexDouble.jacobiCutoff = jacobiCutoff;
+
+        TestHermitianEigBatch( n, numMatrices, ctrlFloat, print );
+        TestHermitianEigBatch( n, numMatrices, ctrlComplexFloat, print );
+        TestHermitianEigBatch( n, numMatrices, ctrlDouble, print );
+        TestHermitianEigBatch( n, numMatrices, ctrlComplexDouble, print );
+
+        TestSVDBatch( m, n, numMatrices, ctrlFloat, print );
+        TestSVDBatch( m, n, numMatrices, ctrlComplexFloat, print );
+        TestSVDBatch( m, n, numMatrices, ctrlDouble, print );
+        TestSVDBatch( m, n, numMatrices, ctrlComplexDouble, print );
+        TestSVDBatch( n, m, numMatrices, ctrlDouble, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares the Gohberg-Kailath-Olshevsky (GKO) solvers for Cauchy-like and
+// Toeplitz systems against a dense LU solve of the explicitly formed
+// matrices, and checks CauchyLike against its defining formula.
+
+template<typename F>
+Base<F> Residual( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& X )
+{
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    Matrix<F> R( B );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    return MaxNorm( R ) / (eps*n*OneNorm(A)*MaxNorm(X));
+}
+
+template<typename F>
+void CompareResiduals
+( const string& label, const Matrix<F>& A, const Matrix<F>& B,
+  const Matrix<F>& XGKO )
+{
+    typedef Base<F> Real;
+    Matrix<F> XLU( B );
+    LinearSolve( A, XLU );
+    const Real gkoResid = Residual( A, B, XGKO );
+    const Real luResid = Residual( A, B, XLU );
+    Output
+    (label,": ||B - A X||_max / (eps n ||A||_1 ||X||_max) = ",gkoResid,
+     " (GKO), ",luResid," (LU)");
+    if( gkoResid > Max( Real(10), 10*luResid ) )
+        LogicError(label," GKO residual was unacceptably large");
+}
+
+template<typename F>
+void TestCauchyLike( Int n, Int r, Int numRHS )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    // Interlaced nodes keep the matrices well-conditioned
+    vector<F> x(n), y(n);
+    for( Int i=0; i<n; ++i )
+    {
+        x[i] = F(i);
+        y[i] = F(i) + F(Real(1)/Real(2));
+    }
+
+    // A(i,j) = G(i,:) H(j,:)^T / (x[i]-y[j])
+    Matrix<F> G, H, A;
+    Uniform( G, n, r );
+    Uniform( H, n, r );
+    Zeros( A, n, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+        {
+            F gamma = 0;
+            for( Int q=0; q<r; ++q )
+                gamma += G(i,q)*H(j,q);
+            A(i,j) = gamma / (x[i]-y[j]);
+        }
+
+    Matrix<F> B, X;
+    Uniform( B, n, numRHS );
+    X = B;
+    CauchyLikeSolve( G, H, x, y, X );
+    CompareResiduals( "Cauchy-like", A, B, X );
+
+    // The factors must also be usable with lu::SolveAfter
+    Matrix<F> LU;
+    Permutation P;
+    CauchyLikeLU( G, H, x, y, LU, P );
+    X = B;
+    lu::SolveAfter( NORMAL, LU, P, X );
+    CompareResiduals( "Cauchy-like LU", A, B, X );
+
+    // The rank-one generators of CauchyLike
+    vector<F> rVec(n), sVec(n);
+    for( Int i=0; i<n; ++i )
+    {
+        rVec[i] = G(i,0);
+        sVec[i] = H(i,0);
+    }
+    Matrix<F> C, CRef;
+    CauchyLike( C, rVec, sVec, x, y );
+    Zeros( CRef, n, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            CRef(i,j) = rVec[i]*sVec[j] / (x[i]-y[j]);
+    C -= CRef;
+    const Real formulaErr = MaxNorm(C) / MaxNorm(CRef);
+    if( formulaErr > 10*eps )
+        LogicError("CauchyLike differed from its formula by ",formulaErr);
+    auto G0 = G( ALL, IR(0) );
+    auto H0 = H( ALL, IR(0) );
+    X = B;
+    CauchyLikeSolve( G0, H0, x, y, X );
+    CompareResiduals( "Cauchy-like (rank one)", CRef, B, X );
+}
+
+template<typename F>
+void TestToeplitz( Int n, Int numRHS )
+{
+    vector<F> a(2*n-1);
+    for( auto& alpha : a )
+        alpha = SampleUniform<F>();
+    Matrix<F> T;
+    Toeplitz( T, n, n, a );
+
+    Matrix<F> B, X;
+    Uniform( B, n, numRHS );
+    X = B;
+    ToeplitzSolve( a, X );
+    CompareResiduals( "Toeplitz", T, B, X );
+}
+
+template<typename F>
+void TestStructuredSolve( Int n, Int r, Int numRHS )
+{
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+    // Include a trivial and an odd size along with the requested one
+    vector<Int> sizes = { 1, 17, n };
+    std::sort( sizes.begin(), sizes.end() );
+    sizes.erase( std::unique( sizes.begin(), sizes.end() ), sizes.end() );
+    for( const Int size : sizes )
+    {
+        Output("n=",size);
+        PushIndent();
+        TestCauchyLike<F>( size, r, numRHS );
+        TestToeplitz<F>( size, numRHS );
+        PopIndent();
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",64);
+        const Int r = Input("--r","displacement rank",3);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestStructuredSolve<double>( n, r, numRHS );
+            TestStructuredSolve<Complex<double>>( n, r, numRHS );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
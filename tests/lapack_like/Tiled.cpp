@@ -0,0 +1,179 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void CheckRelError
+( const string& label, const Matrix<F>& X, const Matrix<F>& XRef )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    Matrix<F> E( XRef );
+    E -= X;
+    const Real frobRef = FrobeniusNorm( XRef );
+    const Real relError = FrobeniusNorm( E ) / Max(frobRef,Real(1));
+    Output(label,": || X - XRef ||_F / || XRef ||_F = ",relError);
+    if( relError > Sqrt(eps) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename F>
+void TestCholesky( UpperOrLower uplo, Int n, const TileCtrl& ctrl )
+{
+    Output("Testing tiled Cholesky with ",TypeName<F>());
+    PushIndent();
+    Matrix<F> A, ARef;
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    ARef = A;
+
+    Timer timer;
+    timer.Start();
+    cholesky::Tiled( uplo, A, ctrl );
+    Output("Tiled: ",timer.Stop()," secs");
+    timer.Start();
+    Cholesky( uplo, ARef );
+    Output("Standard: ",timer.Stop()," secs");
+
+    MakeTrapezoidal( uplo, A );
+    MakeTrapezoidal( uplo, ARef );
+    CheckRelError( "Cholesky", A, ARef );
+    PopIndent();
+}
+
+template<typename F>
+void TestLU( Int m, Int n, const TileCtrl& ctrl )
+{
+    typedef Base<F> Real;
+    Output("Testing tiled LU with ",TypeName<F>());
+    PushIndent();
+    Matrix<F> A, AOrig, ARef;
+    Uniform( A, m, n );
+    AOrig = A;
+    ARef = A;
+
+    Timer timer;
+    Permutation P, PRef;
+    timer.Start();
+    lu::Tiled( A, P, ctrl );
+    Output("Tiled: ",timer.Stop()," secs");
+    timer.Start();
+    LU( ARef, PRef );
+    Output("Standard: ",timer.Stop()," secs");
+
+    // Check that P A = L U (rounding may break pivot ties differently than
+    // in the standard factorization)
+    const Int minDim = Min(m,n);
+    auto L = A( ALL, IR(0,minDim) );
+    auto U = A( IR(0,minDim), ALL );
+    Matrix<F> LExpl( L ), UExpl( U );
+    MakeTrapezoidal( LOWER, LExpl );
+    FillDiagonal( LExpl, F(1) );
+    MakeTrapezoidal( UPPER, UExpl );
+    P.PermuteRows( AOrig );
+    const Real frobA = FrobeniusNorm( AOrig );
+    Gemm( NORMAL, NORMAL, F(-1), LExpl, UExpl, F(1), AOrig );
+    const Real relResid = FrobeniusNorm( AOrig ) / frobA;
+    Output("|| P A - L U ||_F / || A ||_F = ",relResid);
+    if( relResid > Sqrt(limits::Epsilon<Real>()) )
+        LogicError("Unacceptably large relative residual");
+    PopIndent();
+}
+
+template<typename F>
+void TestQR( Int m, Int n, const TileCtrl& ctrl )
+{
+    typedef Base<F> Real;
+    Output("Testing tiled QR with ",TypeName<F>());
+    PushIndent();
+    Matrix<F> A, ARef;
+    Uniform( A, m, n );
+    ARef = A;
+
+    Timer timer;
+    Matrix<F> householderScalars, householderScalarsRef;
+    Matrix<Real> signature, signatureRef;
+    timer.Start();
+    qr::Tiled( A, householderScalars, signature, ctrl );
+    Output("Tiled: ",timer.Stop()," secs");
+    timer.Start();
+    QR( ARef, householderScalarsRef, signatureRef );
+    Output("Standard: ",timer.Stop()," secs");
+
+    CheckRelError( "QR", A, ARef );
+    CheckRelError
+    ( "Householder scalars", householderScalars, householderScalarsRef );
+    PopIndent();
+}
+
+template<typename F>
+void TestHermitianTridiag( Int n, const TileCtrl& ctrl )
+{
+    typedef Base<F> Real;
+    Output("Testing tiled HermitianTridiag with ",TypeName<F>());
+    PushIndent();
+    Matrix<F> A, ARef;
+    HermitianUniformSpectrum( A, n, -10, 10 );
+    ARef = A;
+
+    Timer timer;
+    Matrix<F> householderScalars;
+    herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+    timer.Start();
+    herm_tridiag::Tiled( A, householderScalars, bulgeReflectors, ctrl );
+    Output("Tiled: ",timer.Stop()," secs");
+
+    // The tridiagonal matrix should be similar to the original matrix
+    auto d = GetRealPartOfDiagonal( A );
+    auto dSub = GetDiagonal( A, -1 );
+    Matrix<Real> w, wRef;
+    HermitianTridiagEig( d, dSub, w );
+    HermitianEig( LOWER, ARef, wRef );
+    Sort( w );
+    Sort( wRef );
+    CheckRelError( "Eigenvalues", w, wRef );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",300);
+        const Int n = Input("--n","width of matrix",200);
+        const Int tileSize = Input("--tileSize","tile size",32);
+        const Int numThreads = Input("--numThreads","number of threads",0);
+        ProcessInput();
+        PrintInputReport();
+
+        TileCtrl ctrl;
+        ctrl.tileSize = tileSize;
+        ctrl.numThreads = numThreads;
+
+        if( mpi::Rank() == 0 )
+        {
+            TestCholesky<double>( LOWER, n, ctrl );
+            TestCholesky<double>( UPPER, n, ctrl );
+            TestCholesky<Complex<double>>( LOWER, n, ctrl );
+            TestLU<double>( m, n, ctrl );
+            TestLU<double>( n, m, ctrl );
+            TestLU<Complex<double>>( m, n, ctrl );
+            TestQR<double>( m, n, ctrl );
+            TestQR<double>( n, m, ctrl );
+            TestQR<Complex<double>>( m, n, ctrl );
+            TestHermitianTridiag<double>( n, ctrl );
+            TestHermitianTridiag<Complex<double>>( n, ctrl );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
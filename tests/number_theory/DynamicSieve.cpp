@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares the sequential and bulk interfaces of the segmented wheel sieve
+// against primes found by trial division. Several segment sizes are tested,
+// including a single byte (thirty integers), so that the lower bounds and
+// ranges straddle many segment boundaries.
+
+typedef unsigned long long TSieve;
+typedef unsigned TSieveSmall;
+
+// All of the primes up to 'limit' via trial division
+vector<TSieve> ReferencePrimes( TSieve limit )
+{
+    vector<TSieve> primes;
+    for( TSieve n=2; n<=limit; ++n )
+    {
+        bool isPrime = true;
+        for( TSieve d=2; d*d<=n; ++d )
+        {
+            if( n % d == 0 )
+            {
+                isPrime = false;
+                break;
+            }
+        }
+        if( isPrime )
+            primes.push_back( n );
+    }
+    return primes;
+}
+
+// The primes in [lowerBound,upperBound]
+vector<TSieve> PrimesInRange
+( const vector<TSieve>& primes, TSieve lowerBound, TSieve upperBound )
+{
+    vector<TSieve> range;
+    for( const TSieve p : primes )
+        if( p >= lowerBound && p <= upperBound )
+            range.push_back( p );
+    return range;
+}
+
+void TestNextPrime( const vector<TSieve>& primes, TSieveSmall segmentSize )
+{
+    // Step through every odd prime
+    DynamicSieve<TSieve,TSieveSmall> sieve( 3, false, segmentSize );
+    for( std::size_t k=1; k<primes.size(); ++k )
+    {
+        const TSieve p = sieve.NextPrime();
+        if( p != primes[k] )
+            LogicError
+            ("NextPrime returned ",p," rather than ",primes[k]);
+    }
+
+    // Jump to bounds near the stored primes, multiples of thirty, and
+    // segment boundaries, both forwards and backwards
+    const TSieve span = 30*TSieve(segmentSize);
+    const TSieve maxBound = primes.back() - 1;
+    vector<TSieve> bounds =
+      { 53, 54, 55, 59, 60, 61, 119, 120, 121,
+        span-1, span, span+1, 3*span+29, 3*span+31, 3, maxBound, 7, 1000 };
+    for( const TSieve bound : bounds )
+    {
+        if( bound < 3 || bound > maxBound )
+            continue;
+        sieve.SetLowerBound( bound );
+        const TSieve p = sieve.NextPrime();
+        const TSieve pRef =
+          *std::lower_bound( primes.begin()+1, primes.end(), bound );
+        if( p != pRef )
+            LogicError
+            ("The first prime >= ",bound," was ",p," rather than ",pRef);
+    }
+}
+
+void TestGenerate( const vector<TSieve>& primes, TSieveSmall segmentSize )
+{
+    const TSieve limit = primes.back();
+    const TSieve span = 30*TSieve(segmentSize);
+
+    // The bulk generation of a range without storage
+    vector<pair<TSieve,TSieve>> ranges =
+      { {0,1}, {0,100}, {2,2}, {4,6}, {7,7}, {8,10}, {31,30},
+        {span-1,span+1}, {span,3*span+7}, {limit/3,limit}, {0,limit} };
+    for( const auto& range : ranges )
+    {
+        if( range.second > limit )
+            continue;
+        DynamicSieve<TSieve,TSieveSmall> sieve( 3, false, segmentSize );
+        const auto sievePrimes = sieve.Generate( range.first, range.second );
+        const auto refPrimes =
+          PrimesInRange( primes, range.first, range.second );
+        if( sievePrimes != refPrimes )
+            LogicError
+            ("Generate(",range.first,",",range.second,") returned ",
+             sievePrimes.size()," primes rather than ",refPrimes.size());
+    }
+
+    // The stored odd primes must begin with every odd prime up to the bound
+    for( const TSieve upperBound : { TSieve(60), span+1, limit } )
+    {
+        DynamicSieve<TSieve,TSieveSmall> sieve( 3, false, segmentSize );
+        sieve.Generate( upperBound );
+        const auto refPrimes = PrimesInRange( primes, 3, upperBound );
+        if( sieve.oddPrimes.size() < refPrimes.size() ||
+            !std::equal
+             ( refPrimes.begin(), refPrimes.end(), sieve.oddPrimes.begin() ) )
+            LogicError
+            ("Generate(",upperBound,") did not store the odd primes");
+    }
+
+    // Keeping all of the primes should store those below the lower bound
+    // followed by those returned by NextPrime
+    const TSieve lowerBound = Min( limit/2, TSieve(1000) );
+    const Int numNext = 10;
+    DynamicSieve<TSieve,TSieveSmall> sieve( lowerBound, true, segmentSize );
+    for( Int k=0; k<numNext; ++k )
+        sieve.NextPrime();
+    const std::size_t numKept =
+      PrimesInRange( primes, 3, lowerBound-1 ).size() + numNext;
+    if( sieve.oddPrimes.size() < numKept ||
+        !std::equal
+         ( primes.begin()+1, primes.begin()+1+numKept,
+           sieve.oddPrimes.begin() ) )
+        LogicError("The kept primes were incorrect");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const TSieve limit =
+          Input("--limit","largest prime to check",TSieve(50000));
+        ProcessInput();
+        PrintInputReport();
+
+        if( limit < 100 )
+            LogicError("The limit must be at least 100");
+        if( mpi::Rank() == 0 )
+        {
+            const auto primes = ReferencePrimes( limit );
+            for( const TSieveSmall segmentSize : { 1u, 4u, 32768u } )
+            {
+                Output("Testing with segments of ",segmentSize," bytes");
+                PushIndent();
+                TestNextPrime( primes, segmentSize );
+                Output("NextPrime passed");
+                TestGenerate( primes, segmentSize );
+                Output("Generate passed");
+                PopIndent();
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,226 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares Montgomery arithmetic against reductions of the plain products
+// for moduli spanning one to three limbs, and compares the factorizations
+// from Brent's variant of Pollard's rho method (individually and batched)
+// against trial division.
+
+#ifdef EL_HAVE_MPC
+
+// a^e mod n by repeated multiplication
+BigInt NaivePowMod( const BigInt& a, unsigned long long e, const BigInt& n )
+{
+    BigInt result(1), base( a );
+    base %= n;
+    for( unsigned long long k=0; k<e; ++k )
+    {
+        result *= base;
+        result %= n;
+    }
+    return result;
+}
+
+void CheckEqual
+( const string& label, const BigInt& value, const BigInt& refValue,
+  const BigInt& n )
+{
+    if( value != refValue )
+        LogicError
+        (label," modulo ",n," was ",value," rather than ",refValue);
+}
+
+void TestMontgomery( const BigInt& n, Int numTrials )
+{
+    Montgomery mont( n );
+    BigInt aHat, bHat, cHat, c;
+    mont.FromMontgomery( mont.One(), c );
+    CheckEqual( "One", c, BigInt(1), n );
+
+    // Negative integers are reduced into [0,n)
+    mont.ToMontgomery( BigInt(-1), aHat );
+    mont.FromMontgomery( aHat, c );
+    CheckEqual( "-1", c, n-1, n );
+
+    vector<BigInt> operands = { BigInt(0), BigInt(1), BigInt(2), n-1 };
+    for( Int trial=0; trial<numTrials; ++trial )
+        operands.push_back( SampleUniform( BigInt(0), n ) );
+    for( const auto& a : operands )
+    {
+        mont.ToMontgomery( a, aHat );
+        mont.FromMontgomery( aHat, c );
+        CheckEqual( BuildString("The round trip of ",a), c, a, n );
+
+        mont.Square( aHat, cHat );
+        mont.FromMontgomery( cHat, c );
+        CheckEqual( "a^2", c, (a*a) % n, n );
+
+        for( const unsigned long long e : { 0ULL, 1ULL, 2ULL, 7ULL, 64ULL } )
+        {
+            mont.PowMod( aHat, e, cHat );
+            mont.FromMontgomery( cHat, c );
+            CheckEqual
+            ("a^"+std::to_string(e), c, NaivePowMod( a, e, n ), n );
+        }
+
+        for( const auto& b : operands )
+        {
+            mont.ToMontgomery( b, bHat );
+            mont.Multiply( aHat, bHat, cHat );
+            mont.FromMontgomery( cHat, c );
+            CheckEqual( "a b", c, (a*b) % n, n );
+
+            mont.AddMod( a, b, c );
+            CheckEqual( "a + b", c, (a+b) % n, n );
+            mont.SubtractMod( a, b, c );
+            CheckEqual( "a - b", c, (a+(n-b)) % n, n );
+
+            // The output may alias an input
+            cHat = aHat;
+            mont.Multiply( cHat, bHat, cHat );
+            mont.FromMontgomery( cHat, c );
+            CheckEqual( "a b (in place)", c, (a*b) % n, n );
+        }
+    }
+}
+
+void TestInvalidModuli()
+{
+    for( const BigInt& n : { BigInt(1), BigInt(1000002), BigInt(-7) } )
+    {
+        bool threw = false;
+        try { Montgomery mont( n ); }
+        catch( std::logic_error& ) { threw = true; }
+        if( !threw )
+            LogicError("Montgomery accepted the invalid modulus ",n);
+    }
+}
+
+// The prime factors of n in ascending order (with repeats)
+vector<BigInt> TrialDivisionFactors( unsigned long long n )
+{
+    vector<BigInt> factors;
+    for( unsigned long long d=2; d*d<=n; ++d )
+    {
+        while( n % d == 0 )
+        {
+            factors.push_back( BigInt(d) );
+            n /= d;
+        }
+    }
+    if( n > 1 )
+        factors.push_back( BigInt(n) );
+    return factors;
+}
+
+void CheckFactors
+( const BigInt& n, const vector<BigInt>& factors,
+  const vector<BigInt>& refFactors )
+{
+    if( factors != refFactors )
+    {
+        string factorString;
+        for( const auto& factor : factors )
+            factorString += BuildString(" ",factor);
+        LogicError("Pollard rho factored ",n," as",factorString);
+    }
+}
+
+void TestPollardRho( const factor::PollardRhoCtrl& ctrl )
+{
+    // Semiprimes, prime powers, numbers with tiny factors, and primes, all
+    // small enough for trial division
+    const vector<unsigned long long> smallNumbers =
+      { 999983ULL*1000003ULL, 600851475143ULL, 1099511627775ULL,
+        1000003ULL*1000003ULL, 2147483647ULL, 3ULL*3*3*3*3*7*1000003ULL,
+        65537ULL*65539ULL*8191ULL, 4294967297ULL, 97ULL, 1ULL };
+    vector<BigInt> numbers;
+    vector<vector<BigInt>> refFactorizations;
+    for( const auto n : smallNumbers )
+    {
+        numbers.push_back( BigInt(n) );
+        refFactorizations.push_back( TrialDivisionFactors( n ) );
+    }
+
+    // Products of Mersenne primes which are too large for trial division
+    // (the smaller factor keeps the rho iterations cheap)
+    const BigInt p31 = Pow( BigInt(2), unsigned(31) ) - 1;
+    const BigInt p61 = Pow( BigInt(2), unsigned(61) ) - 1;
+    const BigInt p89 = Pow( BigInt(2), unsigned(89) ) - 1;
+    numbers.push_back( p31*p61 );
+    refFactorizations.push_back( { p31, p61 } );
+    numbers.push_back( p31*p89 );
+    refFactorizations.push_back( { p31, p89 } );
+
+    for( std::size_t k=0; k<numbers.size(); ++k )
+        CheckFactors
+        ( numbers[k], factor::PollardRho( numbers[k], ctrl ),
+          refFactorizations[k] );
+    Output("Individual factorizations passed");
+
+    const auto factorizations = factor::PollardRho( numbers, ctrl );
+    if( factorizations.size() != numbers.size() )
+        LogicError("The batched driver returned the wrong number of results");
+    for( std::size_t k=0; k<numbers.size(); ++k )
+        CheckFactors( numbers[k], factorizations[k], refFactorizations[k] );
+    Output("Batched factorizations passed");
+}
+
+#endif // ifdef EL_HAVE_MPC
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+#ifdef EL_HAVE_MPC
+    try
+    {
+        const Int numTrials =
+          Input("--numTrials","number of random operands per modulus",10);
+        const Int gcdDelay = Input("--gcdDelay","steps between GCDs",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            // Odd moduli with one, two, and three limbs, including some
+            // with a nearly empty leading limb
+            const BigInt two64 = Pow( BigInt(2), unsigned(64) );
+            const vector<BigInt> moduli =
+              { BigInt(3), BigInt(1000003), two64-59, two64+13,
+                two64*two64-159, two64*two64*BigInt(5)+1,
+                two64*two64*two64-317 };
+            Output("Testing Montgomery arithmetic");
+            PushIndent();
+            TestInvalidModuli();
+            for( const auto& n : moduli )
+            {
+                TestMontgomery( n, numTrials );
+                Output("Modulus ",n," passed");
+            }
+            PopIndent();
+
+            Output("Testing Pollard rho");
+            PushIndent();
+            factor::PollardRhoCtrl ctrl;
+            ctrl.gcdDelay = gcdDelay;
+            TestPollardRho( ctrl );
+            // Taking a GCD after every step disables the accumulated products
+            ctrl.gcdDelay = 1;
+            TestPollardRho( ctrl );
+            PopIndent();
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,252 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solves dense and sparse direct-form LPs with the homogeneous self-dual
+// embedding and compares the objectives against Mehrotra's IPM, then checks
+// the certificates returned for a primal infeasible and a dual infeasible
+// (unbounded) variant of the same problem.
+//
+// The feasible problem has an m x n constraint matrix with a (scaled)
+// diagonal and a few more nonzeros per row, b = A x0 for a positive x0, and
+// c = z0 - A^T y0 for a positive z0 (so that the problem is bounded). The
+// primal infeasible variant appends the row sum(x) = -1, while the dual
+// infeasible variant appends the columns a_0 and -a_0, each with a cost of
+// -1/2, so that increasing both decreases the objective without bound.
+
+enum ProblemType { FEASIBLE, PRIMAL_INFEASIBLE, DUAL_INFEASIBLE };
+
+template<typename Real>
+Real BaseEntry( Int i, Int j )
+{
+    if( i == j )
+        return Real(4);
+    if( (i+2*j) % 5 != 0 )
+        return Real(0);
+    return Real(1+(i*j)%4) * ((i+j)%2 ? Real(-1) : Real(1));
+}
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n, ProblemType type,
+  Matrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    const Int mFull = ( type == PRIMAL_INFEASIBLE ? m+1 : m );
+    const Int nFull = ( type == DUAL_INFEASIBLE ? n+2 : n );
+    Zeros( A, mFull, nFull );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A(i,j) = BaseEntry<Real>( i, j );
+
+    Matrix<Real> x0, y0, z0;
+    Zeros( x0, n, 1 );
+    Zeros( y0, m, 1 );
+    Zeros( z0, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        x0(j) = 1 + Real(j%3)/Real(2);
+        z0(j) = 1 + Real(j%2);
+    }
+    for( Int i=0; i<m; ++i )
+        y0(i) = Real(i%3) - 1;
+    auto ABase = A( IR(0,m), IR(0,n) );
+    Zeros( b, mFull, 1 );
+    auto bBase = b( IR(0,m), ALL );
+    Gemv( NORMAL, Real(1), ABase, x0, Real(0), bBase );
+    Zeros( c, nFull, 1 );
+    auto cBase = c( IR(0,n), ALL );
+    cBase = z0;
+    Gemv( TRANSPOSE, Real(-1), ABase, y0, Real(1), cBase );
+
+    if( type == PRIMAL_INFEASIBLE )
+    {
+        for( Int j=0; j<n; ++j )
+            A(m,j) = 1;
+        b(m) = -1;
+    }
+    else if( type == DUAL_INFEASIBLE )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            A(i,n) = A(i,0);
+            A(i,n+1) = -A(i,0);
+        }
+        c(n) = c(n+1) = Real(-1)/Real(2);
+    }
+}
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n, ProblemType type,
+  SparseMatrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    Matrix<Real> ADense;
+    BuildProblem( m, n, type, ADense, b, c );
+    A.Resize( ADense.Height(), ADense.Width() );
+    A.Reserve( 4*ADense.Height()+ADense.Width() );
+    for( Int j=0; j<ADense.Width(); ++j )
+        for( Int i=0; i<ADense.Height(); ++i )
+            if( ADense(i,j) != Real(0) )
+                A.QueueUpdate( i, j, ADense(i,j) );
+    A.ProcessQueues();
+}
+
+// y := alpha op(A) x + beta y for dense and sparse A
+template<typename Real>
+void ApplyA
+( Orientation orientation, Real alpha, const Matrix<Real>& A,
+  const Matrix<Real>& x, Real beta, Matrix<Real>& y )
+{ Gemv( orientation, alpha, A, x, beta, y ); }
+
+template<typename Real>
+void ApplyA
+( Orientation orientation, Real alpha, const SparseMatrix<Real>& A,
+  const Matrix<Real>& x, Real beta, Matrix<Real>& y )
+{ Multiply( orientation, alpha, A, x, beta, y ); }
+
+template<typename Real,class AMatType>
+void TestFeasible( Int m, Int n, bool print )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    AMatType A;
+    Matrix<Real> b, c, x, y, z;
+    BuildProblem( m, n, FEASIBLE, A, b, c );
+
+    lp::direct::Ctrl<Real> ctrl( IsSame<AMatType,SparseMatrix<Real>>::value );
+    ctrl.mehrotraCtrl.print = print;
+    LP( A, b, c, x, y, z, ctrl );
+    const Real mehrotraObj = Dot( c, x );
+
+    ctrl.approach = LP_HSD;
+    LP( A, b, c, x, y, z, ctrl );
+    const Real hsdObj = Dot( c, x );
+
+    // Check the primal and dual residuals of the HSD solution
+    Matrix<Real> rb( b ), rc( c );
+    ApplyA( NORMAL, Real(-1), A, x, Real(1), rb );
+    ApplyA( TRANSPOSE, Real(1), A, y, Real(1), rc );
+    rc -= z;
+    const Real rbErr = FrobeniusNorm(rb) / (1+FrobeniusNorm(b));
+    const Real rcErr = FrobeniusNorm(rc) / (1+FrobeniusNorm(c));
+    const Real relGap = Abs(hsdObj-mehrotraObj) / (1+Abs(mehrotraObj));
+    Output
+    ("Feasible: HSD objective=",hsdObj,", Mehrotra objective=",mehrotraObj,
+     ", relative gap=",relGap,", || b - A x ||_2 / (1+|| b ||_2)=",rbErr,
+     ", || A^T y - z + c ||_2 / (1+|| c ||_2)=",rcErr);
+    if( relGap > tol )
+        LogicError("The HSD and Mehrotra objectives differed by ",relGap);
+    if( rbErr > tol || rcErr > tol )
+        LogicError("The HSD solution had large residuals");
+}
+
+template<typename Real,class AMatType>
+void TestInfeasible( Int m, Int n, bool print )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    MehrotraCtrl<Real> ctrl;
+    ctrl.print = print;
+
+    // (y,z) should satisfy A^T y - z = 0, z >= 0, and -b^T y = 1
+    {
+        AMatType A;
+        Matrix<Real> b, c, x, y, z;
+        BuildProblem( m, n, PRIMAL_INFEASIBLE, A, b, c );
+        const IPMStatus status = lp::direct::HSD( A, b, c, x, y, z, ctrl );
+        if( status != IPM_PRIMAL_INFEASIBLE )
+            LogicError("Primal infeasibility was not detected");
+        Matrix<Real> cert( z );
+        ApplyA( TRANSPOSE, Real(1), A, y, Real(-1), cert );
+        const Real certErr =
+          FrobeniusNorm(cert) / (1+FrobeniusNorm(y)+FrobeniusNorm(z));
+        const Real normErr = Abs(Dot(b,y)+1);
+        const Real zMin = -MaxNorm(z)*tol;
+        Output
+        ("Primal infeasible: || A^T y - z ||_2 / (1+|| y ||_2+|| z ||_2)=",
+         certErr,", |b^T y + 1|=",normErr);
+        if( certErr > tol || normErr > tol )
+            LogicError("The primal infeasibility certificate was inaccurate");
+        for( Int j=0; j<z.Height(); ++j )
+            if( z(j) < zMin )
+                LogicError("The primal infeasibility certificate had z < 0");
+
+        // The high-level interface reports the infeasibility as an error
+        lp::direct::Ctrl<Real> lpCtrl
+        ( IsSame<AMatType,SparseMatrix<Real>>::value );
+        lpCtrl.approach = LP_HSD;
+        lpCtrl.mehrotraCtrl = ctrl;
+        bool reported = false;
+        try { LP( A, b, c, x, y, z, lpCtrl ); }
+        catch( std::runtime_error& ) { reported = true; }
+        if( !reported )
+            LogicError("LP did not report the primal infeasibility");
+    }
+
+    // x should satisfy A x = 0, x >= 0, and -c^T x = 1
+    {
+        AMatType A;
+        Matrix<Real> b, c, x, y, z;
+        BuildProblem( m, n, DUAL_INFEASIBLE, A, b, c );
+        const IPMStatus status = lp::direct::HSD( A, b, c, x, y, z, ctrl );
+        if( status != IPM_DUAL_INFEASIBLE )
+            LogicError("Dual infeasibility was not detected");
+        Matrix<Real> cert;
+        Zeros( cert, b.Height(), 1 );
+        ApplyA( NORMAL, Real(1), A, x, Real(0), cert );
+        const Real certErr = FrobeniusNorm(cert) / (1+FrobeniusNorm(x));
+        const Real normErr = Abs(Dot(c,x)+1);
+        const Real xMin = -MaxNorm(x)*tol;
+        Output
+        ("Dual infeasible: || A x ||_2 / (1+|| x ||_2)=",certErr,
+         ", |c^T x + 1|=",normErr);
+        if( certErr > tol || normErr > tol )
+            LogicError("The dual infeasibility certificate was inaccurate");
+        for( Int j=0; j<x.Height(); ++j )
+            if( x(j) < xMin )
+                LogicError("The dual infeasibility certificate had x < 0");
+    }
+}
+
+template<typename Real>
+void TestHSD( Int m, Int n, bool print )
+{
+    Output("Testing dense problems with ",TypeName<Real>());
+    PushIndent();
+    TestFeasible<Real,Matrix<Real>>( m, n, print );
+    TestInfeasible<Real,Matrix<Real>>( m, n, print );
+    PopIndent();
+
+    Output("Testing sparse problems with ",TypeName<Real>());
+    PushIndent();
+    TestFeasible<Real,SparseMatrix<Real>>( m, n, print );
+    TestInfeasible<Real,SparseMatrix<Real>>( m, n, print );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","number of constraints",20);
+        const Int n = Input("--n","number of variables",40);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( m > n )
+            LogicError("The test problems require m <= n");
+        if( mpi::Rank() == 0 )
+            TestHSD<double>( m, n, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,379 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Checks that the fused step-length reduction, pos_orth::MaxSteps, agrees
+// with separate calls to pos_orth::MaxStep, and that Mehrotra's IPM, whose
+// per-iteration reductions are fused, reaches the same optimum for the
+// dense, distributed dense, sparse, and distributed sparse versions of a
+// direct-form LP. The m x n constraint matrix has a (scaled) diagonal and a
+// few more mixed-sign nonzeros per row, b = A x0 for a positive x0, and
+// c = z0 - A^T y0 for a positive z0, so that the LP is feasible and bounded.
+
+template<typename Real>
+Real ConstraintEntry( Int i, Int j )
+{
+    if( i == j )
+        return Real(4);
+    if( (i+2*j) % 5 != 0 )
+        return Real(0);
+    return Real(1+(i*j)%4) * ((i+j)%2 ? -1 : 1);
+}
+
+template<typename Real>
+Real PrimalEntry( Int j ) { return 1 + Real(j%3)/Real(2); }
+template<typename Real>
+Real DualEntry( Int i ) { return Real(i%3) - 1; }
+template<typename Real>
+Real SlackEntry( Int j ) { return 1 + Real(j%2); }
+
+// A nonnegative point and a direction which is negative in some entries
+template<typename Real>
+Real PointEntry( Int i, Int seed ) { return Real(1+(3*i+seed)%7)/Real(4); }
+template<typename Real>
+Real DirectionEntry( Int i, Int seed )
+{ return Real((5*i+seed)%9) - Real(5); }
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n, Matrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    Zeros( A, m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A(i,j) = ConstraintEntry<Real>( i, j );
+    Matrix<Real> x0, y0;
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        x0(j) = PrimalEntry<Real>( j );
+        c(j) = SlackEntry<Real>( j );
+    }
+    Zeros( y0, m, 1 );
+    for( Int i=0; i<m; ++i )
+        y0(i) = DualEntry<Real>( i );
+    Zeros( b, m, 1 );
+    Gemv( NORMAL, Real(1), A, x0, Real(0), b );
+    Gemv( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n,
+  DistMatrix<Real>& A, DistMatrix<Real>& b, DistMatrix<Real>& c )
+{
+    const Grid& g = A.Grid();
+    Zeros( A, m, n );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc,
+              ConstraintEntry<Real>( A.GlobalRow(iLoc), A.GlobalCol(jLoc) ) );
+    DistMatrix<Real> x0(g), y0(g);
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        x0.Set( j, 0, PrimalEntry<Real>( j ) );
+        c.Set( j, 0, SlackEntry<Real>( j ) );
+    }
+    Zeros( y0, m, 1 );
+    for( Int i=0; i<m; ++i )
+        y0.Set( i, 0, DualEntry<Real>( i ) );
+    Zeros( b, m, 1 );
+    Gemv( NORMAL, Real(1), A, x0, Real(0), b );
+    Gemv( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n, SparseMatrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    Matrix<Real> ADense;
+    BuildProblem( m, n, ADense, b, c );
+    A.Resize( m, n );
+    A.Reserve( (n/5+2)*m );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( ADense(i,j) != Real(0) )
+                A.QueueUpdate( i, j, ADense(i,j) );
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n,
+  DistSparseMatrix<Real>& A, DistMultiVec<Real>& b, DistMultiVec<Real>& c )
+{
+    A.Resize( m, n );
+    A.Reserve( (n/5+2)*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int j=0; j<n; ++j )
+        {
+            const Real value = ConstraintEntry<Real>( i, j );
+            if( value != Real(0) )
+                A.QueueLocalUpdate( iLoc, j, value );
+        }
+    }
+    A.ProcessLocalQueues();
+
+    DistMultiVec<Real> x0(A.Comm()), y0(A.Comm());
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int jLoc=0; jLoc<x0.LocalHeight(); ++jLoc )
+    {
+        const Int j = x0.GlobalRow(jLoc);
+        x0.SetLocal( jLoc, 0, PrimalEntry<Real>( j ) );
+        c.SetLocal( jLoc, 0, SlackEntry<Real>( j ) );
+    }
+    Zeros( y0, m, 1 );
+    for( Int iLoc=0; iLoc<y0.LocalHeight(); ++iLoc )
+        y0.SetLocal( iLoc, 0, DualEntry<Real>( y0.GlobalRow(iLoc) ) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real>
+void CheckMaxSteps
+( const string& label, const pair<Real,Real>& alphas,
+  Real alphaPri, Real alphaDual, mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,label,": MaxSteps=(",alphas.first,",",alphas.second,
+     "), MaxStep=(",alphaPri,",",alphaDual,")");
+    if( alphas.first != alphaPri || alphas.second != alphaDual )
+        LogicError(label," MaxSteps disagreed with MaxStep");
+}
+
+template<typename Real>
+void TestMaxSteps( Int n, const Grid& g )
+{
+    mpi::Comm comm = g.Comm();
+    OutputFromRoot(comm,"Testing MaxSteps with ",TypeName<Real>());
+    PushIndent();
+
+    // The dual direction is nonnegative for the second upper bound, so that
+    // the dual step is limited only by the bound
+    for( const Real upperBound : { Real(1), Real(100) } )
+    {
+        const bool positiveDual = ( upperBound != Real(1) );
+        Matrix<Real> s, ds, z, dz;
+        Zeros( s, n, 1 );
+        Zeros( ds, n, 1 );
+        Zeros( z, n, 1 );
+        Zeros( dz, n, 1 );
+        for( Int i=0; i<n; ++i )
+        {
+            s(i) = PointEntry<Real>( i, 0 );
+            ds(i) = DirectionEntry<Real>( i, 1 );
+            z(i) = PointEntry<Real>( i, 3 );
+            const Real delta = DirectionEntry<Real>( i, 2 );
+            dz(i) = ( positiveDual ? Abs(delta) : delta );
+        }
+        CheckMaxSteps
+        ( "Sequential", pos_orth::MaxSteps( s, ds, z, dz, upperBound ),
+          pos_orth::MaxStep( s, ds, upperBound ),
+          pos_orth::MaxStep( z, dz, upperBound ), comm );
+
+        // Use a different distribution and alignment for z and dz
+        DistMatrix<Real> sDist(g), dsDist(g);
+        DistMatrix<Real,VC,STAR> zDist(g), dzDist(g);
+        zDist.Align( Mod(1,g.Size()), 0 );
+        dzDist.Align( Mod(2,g.Size()), 0 );
+        Zeros( sDist, n, 1 );
+        Zeros( dsDist, n, 1 );
+        Zeros( zDist, n, 1 );
+        Zeros( dzDist, n, 1 );
+        for( Int i=0; i<n; ++i )
+        {
+            sDist.Set( i, 0, s(i) );
+            dsDist.Set( i, 0, ds(i) );
+            zDist.Set( i, 0, z(i) );
+            dzDist.Set( i, 0, dz(i) );
+        }
+        CheckMaxSteps
+        ( "DistMatrix",
+          pos_orth::MaxSteps( sDist, dsDist, zDist, dzDist, upperBound ),
+          pos_orth::MaxStep( sDist, dsDist, upperBound ),
+          pos_orth::MaxStep( zDist, dzDist, upperBound ), comm );
+
+        DistMultiVec<Real> sMV(comm), dsMV(comm), zMV(comm), dzMV(comm);
+        Zeros( sMV, n, 1 );
+        Zeros( dsMV, n, 1 );
+        Zeros( zMV, n, 1 );
+        Zeros( dzMV, n, 1 );
+        for( Int iLoc=0; iLoc<sMV.LocalHeight(); ++iLoc )
+        {
+            const Int i = sMV.GlobalRow(iLoc);
+            sMV.SetLocal( iLoc, 0, s(i) );
+            dsMV.SetLocal( iLoc, 0, ds(i) );
+            zMV.SetLocal( iLoc, 0, z(i) );
+            dzMV.SetLocal( iLoc, 0, dz(i) );
+        }
+        CheckMaxSteps
+        ( "DistMultiVec",
+          pos_orth::MaxSteps( sMV, dsMV, zMV, dzMV, upperBound ),
+          pos_orth::MaxStep( sMV, dsMV, upperBound ),
+          pos_orth::MaxStep( zMV, dzMV, upperBound ), comm );
+    }
+
+    PopIndent();
+}
+
+// y := alpha op(A) x + beta y for each of the matrix types
+template<typename Real>
+void ApplyA
+( Orientation orientation, Real alpha, const Matrix<Real>& A,
+  const Matrix<Real>& x, Real beta, Matrix<Real>& y )
+{ Gemv( orientation, alpha, A, x, beta, y ); }
+
+template<typename Real>
+void ApplyA
+( Orientation orientation, Real alpha, const DistMatrix<Real>& A,
+  const DistMatrix<Real>& x, Real beta, DistMatrix<Real>& y )
+{ Gemv( orientation, alpha, A, x, beta, y ); }
+
+template<typename Real>
+void ApplyA
+( Orientation orientation, Real alpha, const SparseMatrix<Real>& A,
+  const Matrix<Real>& x, Real beta, Matrix<Real>& y )
+{ Multiply( orientation, alpha, A, x, beta, y ); }
+
+template<typename Real>
+void ApplyA
+( Orientation orientation, Real alpha, const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& x, Real beta, DistMultiVec<Real>& y )
+{ Multiply( orientation, alpha, A, x, beta, y ); }
+
+// Returns the objective after checking the primal residual, b - A x, and the
+// dual residual, A^T y - z + c, relative to the problem data
+template<typename Real,class AMat,class Vec>
+Real CheckSolution
+( const AMat& A, const Vec& b, const Vec& c,
+  const Vec& x, const Vec& y, const Vec& z,
+  const string& label, mpi::Comm comm )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.4));
+
+    Vec primalRes( b );
+    ApplyA( NORMAL, Real(-1), A, x, Real(1), primalRes );
+    const Real primalErr = FrobeniusNorm(primalRes) / (1+FrobeniusNorm(b));
+
+    Vec dualRes( c );
+    ApplyA( TRANSPOSE, Real(1), A, y, Real(1), dualRes );
+    Axpy( Real(-1), z, dualRes );
+    const Real dualErr = FrobeniusNorm(dualRes) / (1+FrobeniusNorm(c));
+
+    const Real objective = Dot(c,x);
+    OutputFromRoot
+    (comm,label,": objective=",objective,", || b - A x ||_2 / (1+|| b ||_2)=",
+     primalErr,", || A^T y - z + c ||_2 / (1+|| c ||_2)=",dualErr);
+    if( primalErr > tol )
+        LogicError(label," had a primal residual of ",primalErr);
+    if( dualErr > tol )
+        LogicError(label," had a dual residual of ",dualErr);
+    return objective;
+}
+
+template<typename Real>
+void CompareObjectives
+( const string& label, Real objective, Real refObjective, mpi::Comm comm )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.4));
+    const Real relGap =
+      Abs(objective-refObjective) / (1+Abs(refObjective));
+    OutputFromRoot(comm,label," relative objective gap: ",relGap);
+    if( relGap > tol )
+        LogicError(label," objective differed by ",relGap);
+}
+
+template<typename Real>
+void TestLP( Int m, Int n, bool print, const Grid& g )
+{
+    mpi::Comm comm = g.Comm();
+    OutputFromRoot(comm,"Testing LPs with ",TypeName<Real>());
+    PushIndent();
+
+    // Every process solves the sequential problems redundantly
+    Real denseObj, sparseObj;
+    {
+        Matrix<Real> A, b, c, x, y, z;
+        BuildProblem( m, n, A, b, c );
+        lp::direct::Ctrl<Real> ctrl(false);
+        ctrl.mehrotraCtrl.print = print && mpi::Rank(comm) == 0;
+        LP( A, b, c, x, y, z, ctrl );
+        denseObj = CheckSolution<Real>( A, b, c, x, y, z, "Dense", comm );
+    }
+    {
+        SparseMatrix<Real> A;
+        Matrix<Real> b, c, x, y, z;
+        BuildProblem( m, n, A, b, c );
+        lp::direct::Ctrl<Real> ctrl(true);
+        ctrl.mehrotraCtrl.print = print && mpi::Rank(comm) == 0;
+        LP( A, b, c, x, y, z, ctrl );
+        sparseObj = CheckSolution<Real>( A, b, c, x, y, z, "Sparse", comm );
+    }
+    CompareObjectives( "Sparse", sparseObj, denseObj, comm );
+    {
+        DistMatrix<Real> A(g), b(g), c(g), x(g), y(g), z(g);
+        BuildProblem( m, n, A, b, c );
+        lp::direct::Ctrl<Real> ctrl(false);
+        ctrl.mehrotraCtrl.print = print;
+        LP( A, b, c, x, y, z, ctrl );
+        const Real distObj =
+          CheckSolution<Real>( A, b, c, x, y, z, "Distributed dense", comm );
+        CompareObjectives( "Distributed dense", distObj, denseObj, comm );
+    }
+    {
+        DistSparseMatrix<Real> A(comm);
+        DistMultiVec<Real> b(comm), c(comm), x(comm), y(comm), z(comm);
+        BuildProblem( m, n, A, b, c );
+        lp::direct::Ctrl<Real> ctrl(true);
+        ctrl.mehrotraCtrl.print = print;
+        LP( A, b, c, x, y, z, ctrl );
+        const Real distObj =
+          CheckSolution<Real>( A, b, c, x, y, z, "Distributed sparse", comm );
+        CompareObjectives( "Distributed sparse", distObj, denseObj, comm );
+    }
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--m","number of constraints",20);
+        const Int n = Input("--n","number of variables",40);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( m > n )
+            LogicError("The LP requires m <= n");
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+
+        const Grid g( comm, gridHeight );
+        TestMaxSteps<double>( n, g );
+        TestLP<double>( m, n, print, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
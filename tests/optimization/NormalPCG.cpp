@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solves a sparse direct-form LP whose last few columns are dense with
+// Mehrotra's IPM, once with the matrix-free PCG solution of the normal
+// equations and once each with the sparse-direct augmented and normal
+// systems, and checks that the solutions are feasible and that their
+// objectives agree. The initial rank of the partial Cholesky preconditioner
+// is kept small so that it must be increased during the solve.
+
+// The nonzeros of column j of the m x n constraint matrix
+template<typename Real>
+vector<Entry<Real>> ConstraintColumn( Int j, Int m, Int n, Int numDense )
+{
+    vector<Entry<Real>> column;
+    if( j >= n-numDense )
+    {
+        for( Int i=0; i<m; ++i )
+            column.push_back
+            ( Entry<Real>{ i, j, Real(1+(i+j)%3)/Real(2) } );
+        return column;
+    }
+    for( Int i=0; i<m; ++i )
+    {
+        if( i == j % m )
+            column.push_back( Entry<Real>{ i, j, Real(4) } );
+        else if( (i+3*j) % 17 == 0 )
+            column.push_back
+            ( Entry<Real>{ i, j, Real(1+(i*j)%4)*((i+j)%2 ? -1 : 1) } );
+    }
+    return column;
+}
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n, Int numDense,
+  SparseMatrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    A.Resize( m, n );
+    A.Reserve( numDense*m + (m/17+2)*n );
+    for( Int j=0; j<n; ++j )
+        for( const auto& entry : ConstraintColumn<Real>( j, m, n, numDense ) )
+            A.QueueUpdate( entry );
+    A.ProcessQueues();
+
+    // b = A x0 and c = z0 - A^T y0 for positive x0 and z0
+    Matrix<Real> x0, y0;
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        x0(j) = 1 + Real(j%3)/Real(2);
+        c(j) = 1 + Real(j%2);
+    }
+    Zeros( y0, m, 1 );
+    for( Int i=0; i<m; ++i )
+        y0(i) = Real(i%3) - 1;
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+// Returns the objective after checking the primal residual, b - A x, and the
+// dual residual, A^T y - z + c, relative to the problem data
+template<typename Real>
+Real CheckSolution
+( const SparseMatrix<Real>& A, const Matrix<Real>& b, const Matrix<Real>& c,
+  const Matrix<Real>& x, const Matrix<Real>& y, const Matrix<Real>& z,
+  const string& label )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.4));
+
+    Matrix<Real> primalRes( b );
+    Multiply( NORMAL, Real(-1), A, x, Real(1), primalRes );
+    const Real primalErr = FrobeniusNorm(primalRes) / (1+FrobeniusNorm(b));
+
+    Matrix<Real> dualRes( c );
+    Multiply( TRANSPOSE, Real(1), A, y, Real(1), dualRes );
+    dualRes -= z;
+    const Real dualErr = FrobeniusNorm(dualRes) / (1+FrobeniusNorm(c));
+
+    const Real objective = Dot(c,x);
+    Output
+    (label,": objective=",objective,", || b - A x ||_2 / (1+|| b ||_2)=",
+     primalErr,", || A^T y - z + c ||_2 / (1+|| c ||_2)=",dualErr);
+    if( primalErr > tol )
+        LogicError(label," had a primal residual of ",primalErr);
+    if( dualErr > tol )
+        LogicError(label," had a dual residual of ",dualErr);
+    return objective;
+}
+
+template<typename Real>
+void CompareObjectives
+( const string& label, Real pcgObjective, Real objective )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.4));
+    const Real relGap = Abs(pcgObjective-objective) / (1+Abs(objective));
+    Output("Relative objective gap with the ",label,": ",relGap);
+    if( relGap > tol )
+        LogicError("PCG objective differed from the ",label," by ",relGap);
+}
+
+template<typename Real>
+void TestNormalPCG( Int m, Int n, Int numDense, Int rank, bool print )
+{
+    Output("Testing with ",TypeName<Real>());
+    PushIndent();
+
+    SparseMatrix<Real> A;
+    Matrix<Real> b, c, x, y, z;
+    BuildProblem( m, n, numDense, A, b, c );
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = print;
+    LP( A, b, c, x, y, z, ctrl );
+    const Real augmentedObj =
+      CheckSolution( A, b, c, x, y, z, "Augmented system" );
+
+    ctrl.mehrotraCtrl.system = NORMAL_KKT;
+    LP( A, b, c, x, y, z, ctrl );
+    const Real normalObj = CheckSolution( A, b, c, x, y, z, "Normal system" );
+
+    ctrl.mehrotraCtrl.normalPCG = true;
+    ctrl.mehrotraCtrl.pcgRank = rank;
+    LP( A, b, c, x, y, z, ctrl );
+    const Real pcgObj = CheckSolution( A, b, c, x, y, z, "Normal PCG" );
+
+    CompareObjectives( "augmented system", pcgObj, augmentedObj );
+    CompareObjectives( "normal system", pcgObj, normalObj );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","number of constraints",60);
+        const Int n = Input("--n","number of variables",120);
+        const Int numDense = Input("--numDense","number of dense columns",3);
+        const Int rank =
+          Input("--rank","initial rank of the partial Cholesky",2);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( m > n-numDense )
+            LogicError("The problem requires m <= n - numDense");
+
+        if( mpi::Rank() == 0 )
+            TestNormalPCG<double>( m, n, numDense, rank, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
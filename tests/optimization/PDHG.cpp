@@ -0,0 +1,230 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solves sparse and distributed sparse direct-form LPs and SOCPs with the
+// Primal-Dual Hybrid Gradient method and compares the objectives against
+// those of Mehrotra's IPM. The m x n constraint matrix has a (scaled)
+// diagonal and a few more mixed-sign nonzeros per row, b = A x0 for an x0 in
+// the interior of the cone, and c = z0 - A^T y0 for a z0 in the interior of
+// the (self-dual) cone, so that both problems are feasible and bounded. The
+// SOCP cone is a product of cones of order three.
+
+// The nonzeros of row i of the m x n constraint matrix
+template<typename Real>
+vector<Entry<Real>> ConstraintRow( Int i, Int n )
+{
+    vector<Entry<Real>> row;
+    for( Int j=0; j<n; ++j )
+    {
+        if( j == i )
+            row.push_back( Entry<Real>{ i, j, Real(4) } );
+        else if( (i+2*j) % 5 == 0 )
+            row.push_back
+            ( Entry<Real>{ i, j, Real(1+(i*j)%4)*((i+j)%2 ? -1 : 1) } );
+    }
+    return row;
+}
+
+// Entries of x0 and z0, which lie in the interior of the positive orthant
+// and of the product of second-order cones of order three
+template<typename Real>
+Real PrimalEntry( Int j )
+{
+    const Int k = j % 3;
+    return ( k == 0 ? Real(2) : (k == 1 ? Real(1)/Real(2) : -Real(1)/Real(2)) );
+}
+template<typename Real>
+Real SlackEntry( Int j )
+{
+    const Int k = j % 3;
+    return ( k == 0 ? Real(3)/Real(2) : Real(1)/Real(2) );
+}
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n, bool conic,
+  SparseMatrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c,
+  Matrix<Int>& orders, Matrix<Int>& firstInds )
+{
+    A.Resize( m, n );
+    A.Reserve( (n/5+2)*m );
+    for( Int i=0; i<m; ++i )
+        for( const auto& entry : ConstraintRow<Real>( i, n ) )
+            A.QueueUpdate( entry );
+    A.ProcessQueues();
+
+    Matrix<Real> x0, y0;
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    Zeros( orders, n, 1 );
+    Zeros( firstInds, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        x0.Set( j, 0, conic ? PrimalEntry<Real>(j) : 1+Real(j%3)/Real(2) );
+        c.Set( j, 0, conic ? SlackEntry<Real>(j) : 1+Real(j%2) );
+        orders.Set( j, 0, 3 );
+        firstInds.Set( j, 0, j-(j%3) );
+    }
+    Zeros( y0, m, 1 );
+    for( Int i=0; i<m; ++i )
+        y0.Set( i, 0, Real(i%3)-1 );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n, bool conic,
+  DistSparseMatrix<Real>& A, DistMultiVec<Real>& b, DistMultiVec<Real>& c,
+  DistMultiVec<Int>& orders, DistMultiVec<Int>& firstInds )
+{
+    A.Resize( m, n );
+    A.Reserve( (n/5+2)*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( const auto& entry : ConstraintRow<Real>( i, n ) )
+            A.QueueLocalUpdate( iLoc, entry.j, entry.value );
+    }
+    A.ProcessLocalQueues();
+
+    DistMultiVec<Real> x0(A.Comm()), y0(A.Comm());
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    Zeros( orders, n, 1 );
+    Zeros( firstInds, n, 1 );
+    for( Int jLoc=0; jLoc<x0.LocalHeight(); ++jLoc )
+    {
+        const Int j = x0.GlobalRow(jLoc);
+        x0.SetLocal
+        ( jLoc, 0, conic ? PrimalEntry<Real>(j) : 1+Real(j%3)/Real(2) );
+        c.SetLocal( jLoc, 0, conic ? SlackEntry<Real>(j) : 1+Real(j%2) );
+        orders.SetLocal( jLoc, 0, 3 );
+        firstInds.SetLocal( jLoc, 0, j-(j%3) );
+    }
+    Zeros( y0, m, 1 );
+    for( Int iLoc=0; iLoc<y0.LocalHeight(); ++iLoc )
+        y0.SetLocal( iLoc, 0, Real(y0.GlobalRow(iLoc)%3)-1 );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+// Returns the objective after checking the relative primal residual
+template<typename Real,class SparseMat,class Vec>
+Real CheckSolution
+( const SparseMat& A, const Vec& b, const Vec& c, const Vec& x,
+  Real tol, const string& label, mpi::Comm comm )
+{
+    Vec primalRes( b );
+    Multiply( NORMAL, Real(-1), A, x, Real(1), primalRes );
+    const Real primalErr = FrobeniusNorm(primalRes) / (1+FrobeniusNorm(b));
+    const Real objective = Dot(c,x);
+    OutputFromRoot
+    (comm,label,": objective=",objective,", || b - A x ||_2 / (1+|| b ||_2)=",
+     primalErr);
+    if( primalErr > tol )
+        LogicError(label," had a primal residual of ",primalErr);
+    return objective;
+}
+
+template<typename Real>
+void CompareObjectives
+( Real pdhgObj, Real mehrotraObj, Real tol, mpi::Comm comm )
+{
+    const Real relGap = Abs(pdhgObj-mehrotraObj) / (1+Abs(mehrotraObj));
+    OutputFromRoot(comm,"Relative objective gap: ",relGap);
+    if( relGap > tol )
+        LogicError("The PDHG objective differed by ",relGap);
+}
+
+template<typename Real,class SparseMat,class Vec,class IntVec>
+void TestPDHG
+( Int m, Int n, Real pdhgTol, bool print,
+  SparseMat& A, Vec& b, Vec& c, Vec& x, Vec& y, Vec& z,
+  IntVec& orders, IntVec& firstInds, mpi::Comm comm )
+{
+    // The PDHG solution is only accurate to roughly 'pdhgTol'
+    const Real tol = 100*pdhgTol;
+
+    BuildProblem( m, n, false, A, b, c, orders, firstInds );
+    lp::direct::Ctrl<Real> lpCtrl(true);
+    lpCtrl.mehrotraCtrl.print = print;
+    LP( A, b, c, x, y, z, lpCtrl );
+    const Real lpObj =
+      CheckSolution<Real>( A, b, c, x, tol, "Mehrotra LP", comm );
+    lpCtrl.approach = LP_PDHG;
+    lpCtrl.pdhgCtrl.tol = pdhgTol;
+    lpCtrl.pdhgCtrl.print = print;
+    LP( A, b, c, x, y, z, lpCtrl );
+    const Real lpObjPDHG =
+      CheckSolution<Real>( A, b, c, x, tol, "PDHG LP", comm );
+    CompareObjectives( lpObjPDHG, lpObj, tol, comm );
+
+    BuildProblem( m, n, true, A, b, c, orders, firstInds );
+    socp::direct::Ctrl<Real> socpCtrl;
+    socpCtrl.mehrotraCtrl.print = print;
+    SOCP( A, b, c, orders, firstInds, x, y, z, socpCtrl );
+    const Real socpObj =
+      CheckSolution<Real>( A, b, c, x, tol, "Mehrotra SOCP", comm );
+    socpCtrl.approach = SOCP_PDHG;
+    socpCtrl.pdhgCtrl.tol = pdhgTol;
+    socpCtrl.pdhgCtrl.print = print;
+    SOCP( A, b, c, orders, firstInds, x, y, z, socpCtrl );
+    const Real socpObjPDHG =
+      CheckSolution<Real>( A, b, c, x, tol, "PDHG SOCP", comm );
+    CompareObjectives( socpObjPDHG, socpObj, tol, comm );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of constraints",20);
+        const Int n = Input("--n","number of variables",42);
+        const double pdhgTol = Input("--pdhgTol","PDHG tolerance",1e-6);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( m > n || n % 3 != 0 )
+            LogicError("The problems require m <= n and n divisible by 3");
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            Output("Testing sequential PDHG with ",TypeName<double>());
+            PushIndent();
+            SparseMatrix<double> A;
+            Matrix<double> b, c, x, y, z;
+            Matrix<Int> orders, firstInds;
+            TestPDHG
+            ( m, n, pdhgTol, print, A, b, c, x, y, z, orders, firstInds,
+              mpi::COMM_SELF );
+            PopIndent();
+        }
+        OutputFromRoot
+        (comm,"Testing distributed PDHG with ",TypeName<double>());
+        PushIndent();
+        DistSparseMatrix<double> A(comm);
+        DistMultiVec<double> b(comm), c(comm), x(comm), y(comm), z(comm);
+        DistMultiVec<Int> orders(comm), firstInds(comm);
+        TestPDHG
+        ( m, n, pdhgTol, print, A, b, c, x, y, z, orders, firstInds, comm );
+        PopIndent();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
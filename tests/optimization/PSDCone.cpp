@@ -0,0 +1,238 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Checks the maximum step and Nesterov-Todd scaling utilities for products
+// of positive semi-definite cones and then solves a small SOCP with both
+// second-order and semidefinite constraints whose optimum is known.
+
+// Fill the orders and first indices of a product of PSD blocks
+void PSDStructure
+( const vector<Int>& blockOrders,
+  Matrix<Int>& orders, Matrix<Int>& firstInds )
+{
+    Int height = 0;
+    for( const Int order : blockOrders )
+        height += order*order;
+    Zeros( orders, height, 1 );
+    Zeros( firstInds, height, 1 );
+    Int first = 0;
+    for( const Int order : blockOrders )
+    {
+        for( Int i=first; i<first+order*order; ++i )
+        {
+            orders(i) = order;
+            firstInds(i) = first;
+        }
+        first += order*order;
+    }
+}
+
+// Overwrite the block starting at 'first' with a copy of the n x n matrix B
+template<typename Real>
+void SetBlock( Matrix<Real>& x, Int first, const Matrix<Real>& B )
+{
+    const Int n = B.Height();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            x(first+i+j*n) = B(i,j);
+}
+
+template<typename Real>
+void TestMaxStep()
+{
+    Output("Testing psd::MaxStep with ",TypeName<Real>());
+    PushIndent();
+    const Real tol = 100*limits::Epsilon<Real>();
+    Matrix<Int> orders, firstInds;
+    PSDStructure( {2,3}, orders, firstInds );
+
+    // From the identity, the maximum step in the direction -D is the
+    // reciprocal of the largest eigenvalue of D. The eigenvalues of the
+    // first block are {1,3} and those of the second are {1/2,4,1}.
+    Matrix<Real> x, y, Y0, Y1;
+    Zeros( x, orders.Height(), 1 );
+    psd::Identity( x, orders, firstInds );
+    Zeros( Y0, 2, 2 );
+    Y0(0,0) = -2; Y0(1,0) = -1;
+    Y0(0,1) = -1; Y0(1,1) = -2;
+    Zeros( Y1, 3, 3 );
+    Y1(0,0) = Real(-1)/Real(2); Y1(1,1) = -4; Y1(2,2) = -1;
+    Zeros( y, orders.Height(), 1 );
+    SetBlock( y, 0, Y0 );
+    SetBlock( y, 4, Y1 );
+    Real alpha = psd::MaxStep( x, y, orders, firstInds, Real(1) );
+    Output("Step from the identity: ",alpha);
+    if( Abs(alpha-Real(1)/Real(4)) > tol )
+        LogicError("Expected a maximum step of 1/4 but found ",alpha);
+
+    // The upper bound is returned when the direction lies within the cone
+    y *= -1;
+    alpha = psd::MaxStep( x, y, orders, firstInds, Real(1) );
+    if( alpha != Real(1) )
+        LogicError("Expected the upper bound but found ",alpha);
+
+    // From X = diag(2,1) (and the identity), the direction -I can be taken
+    // for a single unit step
+    Matrix<Real> X0;
+    Zeros( X0, 2, 2 );
+    X0(0,0) = 2; X0(1,1) = 1;
+    SetBlock( x, 0, X0 );
+    Zeros( y, orders.Height(), 1 );
+    psd::Identity( y, orders, firstInds );
+    y *= -1;
+    alpha = psd::MaxStep( x, y, orders, firstInds, Real(10) );
+    Output("Step from diag(2,1): ",alpha);
+    if( Abs(alpha-Real(1)) > tol )
+        LogicError("Expected a maximum step of 1 but found ",alpha);
+    PopIndent();
+}
+
+template<typename Real>
+void TestNesterovTodd()
+{
+    Output("Testing psd::NesterovTodd with ",TypeName<Real>());
+    PushIndent();
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.75));
+    const vector<Int> blockOrders = {1,2,4};
+    Matrix<Int> orders, firstInds;
+    PSDStructure( blockOrders, orders, firstInds );
+
+    // Random positive-definite blocks, B B^T + I
+    Matrix<Real> s, z;
+    Zeros( s, orders.Height(), 1 );
+    Zeros( z, orders.Height(), 1 );
+    Int first = 0;
+    for( const Int order : blockOrders )
+    {
+        Matrix<Real> B, S, Z;
+        Uniform( B, order, order );
+        Identity( S, order, order );
+        Herk( LOWER, NORMAL, Real(1), B, Real(1), S );
+        MakeSymmetric( LOWER, S );
+        Uniform( B, order, order );
+        Identity( Z, order, order );
+        Herk( LOWER, NORMAL, Real(1), B, Real(1), Z );
+        MakeSymmetric( LOWER, Z );
+        SetBlock( s, first, S );
+        SetBlock( z, first, Z );
+        first += order*order;
+    }
+
+    Matrix<Real> r, lambda;
+    psd::NesterovTodd( s, z, r, lambda, orders, firstInds );
+
+    // Lambda should be diagonal
+    first = 0;
+    Real offDiagMax = 0;
+    for( const Int order : blockOrders )
+    {
+        for( Int j=0; j<order; ++j )
+            for( Int i=0; i<order; ++i )
+                if( i != j )
+                    offDiagMax =
+                      Max( offDiagMax, Abs(lambda(first+i+j*order)) );
+        first += order*order;
+    }
+
+    // R^T Z R = Lambda and R Lambda R^T = S, so that W Z W = S
+    Matrix<Real> scaledZ( z ), scaledLambda( lambda );
+    psd::ApplyScaling( TRANSPOSE, r, scaledZ, orders, firstInds );
+    psd::ApplyScaling( NORMAL, r, scaledLambda, orders, firstInds );
+    scaledZ -= lambda;
+    scaledLambda -= s;
+    const Real lambdaErr = FrobeniusNorm(scaledZ) / FrobeniusNorm(lambda);
+    const Real sErr = FrobeniusNorm(scaledLambda) / FrobeniusNorm(s);
+    Output
+    ("max |offdiag(Lambda)| = ",offDiagMax,
+     ", || R^T Z R - Lambda ||_F / || Lambda ||_F = ",lambdaErr,
+     ", || R Lambda R^T - S ||_F / || S ||_F = ",sErr);
+    if( offDiagMax > tol*FrobeniusNorm(lambda) )
+        LogicError("Lambda was not diagonal");
+    if( lambdaErr > tol || sErr > tol )
+        LogicError("The Nesterov-Todd scaling was inaccurate");
+    PopIndent();
+}
+
+// Minimize t subject to || (x1,x2) ||_2 <= t, x1 = x2, and
+//
+//   [x1, 1; 1, x2] positive semi-definite,
+//
+// so that x1 x2 >= 1 and, since x1^2 + x2^2 >= 2 x1 x2, the optimum is
+// (t,x1,x2) = (sqrt(2),1,1).
+template<typename Real>
+void TestMixedSOCP( bool print )
+{
+    Output("Testing a mixed SOC/PSD SOCP with ",TypeName<Real>());
+    PushIndent();
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+
+    Matrix<Real> A, G, b, c, h;
+    Zeros( A, 1, 3 );
+    A(0,1) = 1; A(0,2) = -1;
+    Zeros( b, 1, 1 );
+    Zeros( c, 3, 1 );
+    c(0) = 1;
+
+    // s = h - G x holds (t,x1,x2) followed by vec([x1, 1; 1, x2])
+    Zeros( G, 7, 3 );
+    Zeros( h, 7, 1 );
+    G(0,0) = G(1,1) = G(2,2) = -1;
+    G(3,1) = -1;
+    h(4) = h(5) = 1;
+    G(6,2) = -1;
+    Matrix<Int> orders, firstInds, psdOrders, psdFirstInds;
+    Zeros( orders, 3, 1 );
+    Zeros( firstInds, 3, 1 );
+    Fill( orders, Int(3) );
+    PSDStructure( {2}, psdOrders, psdFirstInds );
+
+    Matrix<Real> x, y, z, s;
+    socp::affine::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print;
+    SOCP
+    ( A, G, b, c, h, orders, firstInds, psdOrders, psdFirstInds,
+      x, y, z, s, ctrl );
+    if( print )
+        Print( x, "x" );
+
+    Matrix<Real> xOpt;
+    Zeros( xOpt, 3, 1 );
+    xOpt(0) = Sqrt(Real(2));
+    xOpt(1) = xOpt(2) = 1;
+    xOpt -= x;
+    const Real error = FrobeniusNorm( xOpt );
+    Output("|| x - xOpt ||_2 = ",error);
+    if( error > tol )
+        LogicError("The mixed SOCP solution was inaccurate");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestMaxStep<double>();
+            TestNesterovTodd<double>();
+            TestMixedSOCP<double>( print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,286 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solves small direct-form LPs and QPs with and without the presolve stage
+// and checks that both solutions are (nearly) primal and dual feasible for
+// the original problem and that their objectives agree. The constraints
+// consist of 'mBase' mixed-sign rows followed by a scaled duplicate of the
+// first row, a singleton row, an empty row, and a forcing row, and the last
+// column has no coefficients, so that every reduction is exercised.
+
+// The nonzeros of row i of the m x n constraint matrix
+template<typename Real>
+vector<Entry<Real>> ConstraintRow( Int i, Int mBase, Int n )
+{
+    vector<Entry<Real>> row;
+    if( i < mBase || i == mBase )
+    {
+        // The duplicate row is twice the first row
+        const Int iBase = ( i < mBase ? i : 0 );
+        const Real scale = ( i < mBase ? Real(1) : Real(2) );
+        for( Int t=0; t<4; ++t )
+        {
+            const Int j = (3*iBase+t) % (n-1);
+            const Real value = Real(1+(iBase+2*t)%4) * (t==3 ? -1 : 1);
+            row.push_back( Entry<Real>{ i, j, scale*value } );
+        }
+    }
+    else if( i == mBase+1 )
+    {
+        // A singleton row
+        row.push_back( Entry<Real>{ i, n-2, Real(2) } );
+    }
+    else if( i == mBase+3 )
+    {
+        // A forcing row (with a zero right-hand side)
+        row.push_back( Entry<Real>{ i, n-4, Real(1) } );
+        row.push_back( Entry<Real>{ i, n-3, Real(3) } );
+    }
+    // Row mBase+2 is empty
+    return row;
+}
+
+// A feasible point (the variables of the forcing row must vanish)
+template<typename Real>
+Real FeasibleEntry( Int j, Int n )
+{ return ( j == n-4 || j == n-3 ? Real(0) : Real(1) + Real(j%5)/Real(5) ); }
+
+// Strictly positive costs keep the problems bounded
+template<typename Real>
+Real CostEntry( Int j )
+{ return Real(1) + Real(j%3)/Real(2); }
+
+template<typename Real>
+void BuildProblem
+( Int mBase, Int n, bool quadratic,
+  SparseMatrix<Real>& Q, SparseMatrix<Real>& A,
+  Matrix<Real>& b, Matrix<Real>& c )
+{
+    const Int m = mBase + 4;
+    A.Resize( m, n );
+    A.Reserve( 4*m );
+    for( Int i=0; i<m; ++i )
+        for( const auto& entry : ConstraintRow<Real>( i, mBase, n ) )
+            A.QueueUpdate( entry );
+    A.ProcessQueues();
+
+    // The empty column must not have a quadratic term
+    Q.Resize( n, n );
+    if( quadratic )
+    {
+        Q.Reserve( n-1 );
+        for( Int j=0; j<n-1; ++j )
+            Q.QueueUpdate( j, j, Real(1) );
+    }
+    Q.ProcessQueues();
+
+    Matrix<Real> x0;
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        x0.Set( j, 0, FeasibleEntry<Real>( j, n ) );
+        c.Set( j, 0, CostEntry<Real>( j ) );
+    }
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+}
+
+template<typename Real>
+void BuildProblem
+( Int mBase, Int n, bool quadratic,
+  DistSparseMatrix<Real>& Q, DistSparseMatrix<Real>& A,
+  DistMultiVec<Real>& b, DistMultiVec<Real>& c )
+{
+    const Int m = mBase + 4;
+    A.Resize( m, n );
+    A.Reserve( 4*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( const auto& entry : ConstraintRow<Real>( i, mBase, n ) )
+            A.QueueLocalUpdate( iLoc, entry.j, entry.value );
+    }
+    A.ProcessLocalQueues();
+
+    Q.Resize( n, n );
+    if( quadratic )
+    {
+        Q.Reserve( Q.LocalHeight() );
+        for( Int jLoc=0; jLoc<Q.LocalHeight(); ++jLoc )
+        {
+            const Int j = Q.GlobalRow(jLoc);
+            if( j < n-1 )
+                Q.QueueLocalUpdate( jLoc, j, Real(1) );
+        }
+    }
+    Q.ProcessLocalQueues();
+
+    DistMultiVec<Real> x0(A.Comm());
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int jLoc=0; jLoc<x0.LocalHeight(); ++jLoc )
+    {
+        const Int j = x0.GlobalRow(jLoc);
+        x0.SetLocal( jLoc, 0, FeasibleEntry<Real>( j, n ) );
+        c.SetLocal( jLoc, 0, CostEntry<Real>( j ) );
+    }
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+}
+
+// Returns the objective after checking the primal residual, b - A x, and the
+// dual residual, Q x + A^T y - z + c, relative to the problem data
+template<typename Real,class SparseMat,class Vec>
+Real CheckSolution
+( const SparseMat& Q, const SparseMat& A, const Vec& b, const Vec& c,
+  const Vec& x, const Vec& y, const Vec& z,
+  const string& label, mpi::Comm comm )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.4));
+
+    Vec primalRes( b );
+    Multiply( NORMAL, Real(-1), A, x, Real(1), primalRes );
+    const Real primalErr = FrobeniusNorm(primalRes) / (1+FrobeniusNorm(b));
+
+    Vec Qx( c );
+    Multiply( NORMAL, Real(1), Q, x, Real(0), Qx );
+    Vec dualRes( c );
+    Axpy( Real(1), Qx, dualRes );
+    Multiply( TRANSPOSE, Real(1), A, y, Real(1), dualRes );
+    Axpy( Real(-1), z, dualRes );
+    const Real dualErr = FrobeniusNorm(dualRes) / (1+FrobeniusNorm(c));
+
+    const Real objective = Dot(c,x) + Dot(x,Qx)/Real(2);
+    OutputFromRoot
+    (comm,label,": objective=",objective,", || b - A x ||_2 / (1+|| b ||_2)=",
+     primalErr,", || Q x + A^T y - z + c ||_2 / (1+|| c ||_2)=",dualErr);
+    if( primalErr > tol )
+        LogicError(label," had a primal residual of ",primalErr);
+    if( dualErr > tol )
+        LogicError(label," had a dual residual of ",dualErr);
+    return objective;
+}
+
+template<typename Real>
+void CompareObjectives
+( Real objective, Real presolvedObjective, mpi::Comm comm )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.4));
+    const Real relGap =
+      Abs(objective-presolvedObjective) / (1+Abs(objective));
+    OutputFromRoot(comm,"Relative objective gap: ",relGap);
+    if( relGap > tol )
+        LogicError("Presolved objective differed by ",relGap);
+}
+
+template<typename Real>
+void TestSequential( Int mBase, Int n, bool print, mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,"Testing sequential presolve with ",TypeName<Real>());
+    PushIndent();
+
+    SparseMatrix<Real> Q, A;
+    Matrix<Real> b, c, x, y, z;
+
+    BuildProblem( mBase, n, false, Q, A, b, c );
+    lp::direct::Ctrl<Real> lpCtrl(true);
+    lpCtrl.mehrotraCtrl.print = print;
+    lpCtrl.presolveCtrl.print = print;
+    LP( A, b, c, x, y, z, lpCtrl );
+    const Real lpObj =
+      CheckSolution<Real>( Q, A, b, c, x, y, z, "LP", comm );
+    lpCtrl.presolve = true;
+    LP( A, b, c, x, y, z, lpCtrl );
+    const Real lpObjPre =
+      CheckSolution<Real>( Q, A, b, c, x, y, z, "Presolved LP", comm );
+    CompareObjectives( lpObj, lpObjPre, comm );
+
+    BuildProblem( mBase, n, true, Q, A, b, c );
+    qp::direct::Ctrl<Real> qpCtrl;
+    qpCtrl.mehrotraCtrl.print = print;
+    qpCtrl.presolveCtrl.print = print;
+    QP( Q, A, b, c, x, y, z, qpCtrl );
+    const Real qpObj =
+      CheckSolution<Real>( Q, A, b, c, x, y, z, "QP", comm );
+    qpCtrl.presolve = true;
+    QP( Q, A, b, c, x, y, z, qpCtrl );
+    const Real qpObjPre =
+      CheckSolution<Real>( Q, A, b, c, x, y, z, "Presolved QP", comm );
+    CompareObjectives( qpObj, qpObjPre, comm );
+
+    PopIndent();
+}
+
+template<typename Real>
+void TestDistributed( Int mBase, Int n, bool print, mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,"Testing distributed presolve with ",TypeName<Real>());
+    PushIndent();
+
+    DistSparseMatrix<Real> Q(comm), A(comm);
+    DistMultiVec<Real> b(comm), c(comm), x(comm), y(comm), z(comm);
+
+    BuildProblem( mBase, n, false, Q, A, b, c );
+    lp::direct::Ctrl<Real> lpCtrl(true);
+    lpCtrl.mehrotraCtrl.print = print;
+    lpCtrl.presolveCtrl.print = print;
+    LP( A, b, c, x, y, z, lpCtrl );
+    const Real lpObj =
+      CheckSolution<Real>( Q, A, b, c, x, y, z, "LP", comm );
+    lpCtrl.presolve = true;
+    LP( A, b, c, x, y, z, lpCtrl );
+    const Real lpObjPre =
+      CheckSolution<Real>( Q, A, b, c, x, y, z, "Presolved LP", comm );
+    CompareObjectives( lpObj, lpObjPre, comm );
+
+    BuildProblem( mBase, n, true, Q, A, b, c );
+    qp::direct::Ctrl<Real> qpCtrl;
+    qpCtrl.mehrotraCtrl.print = print;
+    qpCtrl.presolveCtrl.print = print;
+    QP( Q, A, b, c, x, y, z, qpCtrl );
+    const Real qpObj =
+      CheckSolution<Real>( Q, A, b, c, x, y, z, "QP", comm );
+    qpCtrl.presolve = true;
+    QP( Q, A, b, c, x, y, z, qpCtrl );
+    const Real qpObjPre =
+      CheckSolution<Real>( Q, A, b, c, x, y, z, "Presolved QP", comm );
+    CompareObjectives( qpObj, qpObjPre, comm );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int mBase = Input("--mBase","number of general rows",20);
+        const Int n = Input("--n","number of variables",40);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( n < 5 )
+            LogicError("The problems require at least five variables");
+
+        if( mpi::Rank(comm) == 0 )
+            TestSequential<double>( mBase, n, print, mpi::COMM_SELF );
+        TestDistributed<double>( mBase, n, print, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
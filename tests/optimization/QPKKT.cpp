@@ -0,0 +1,214 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Checks that the distributed sparse direct-form QP IPM forms the same full
+// and augmented KKT systems as the sequential one by comparing the iterates
+// after a few iterations (where any difference in the systems would
+// immediately show up) as well as the final solutions. The QP is strictly
+// convex, with a tridiagonal Q, and the constraint matrix has a (scaled)
+// diagonal and a few more mixed-sign nonzeros per row.
+
+template<typename Real>
+vector<Entry<Real>> QuadraticRow( Int i, Int n )
+{
+    vector<Entry<Real>> row;
+    if( i > 0 )
+        row.push_back( Entry<Real>{ i, i-1, Real(-1)/Real(2) } );
+    row.push_back( Entry<Real>{ i, i, Real(2) } );
+    if( i < n-1 )
+        row.push_back( Entry<Real>{ i, i+1, Real(-1)/Real(2) } );
+    return row;
+}
+
+template<typename Real>
+vector<Entry<Real>> ConstraintRow( Int i, Int n )
+{
+    vector<Entry<Real>> row;
+    for( Int j=0; j<n; ++j )
+    {
+        if( j == i )
+            row.push_back( Entry<Real>{ i, j, Real(4) } );
+        else if( (i+2*j) % 5 == 0 )
+            row.push_back
+            ( Entry<Real>{ i, j, Real(1+(i*j)%4)*((i+j)%2 ? -1 : 1) } );
+    }
+    return row;
+}
+
+// b = A x0 for a positive x0, and c has entries of both signs
+template<typename Real>
+Real PrimalEntry( Int j ) { return 1 + Real(j%3)/Real(2); }
+template<typename Real>
+Real CostEntry( Int j ) { return Real(j%4) - Real(3)/Real(2); }
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n,
+  SparseMatrix<Real>& Q, SparseMatrix<Real>& A,
+  Matrix<Real>& b, Matrix<Real>& c )
+{
+    Q.Resize( n, n );
+    Q.Reserve( 3*n );
+    for( Int i=0; i<n; ++i )
+        for( const auto& entry : QuadraticRow<Real>( i, n ) )
+            Q.QueueUpdate( entry );
+    Q.ProcessQueues();
+
+    A.Resize( m, n );
+    A.Reserve( (n/5+2)*m );
+    for( Int i=0; i<m; ++i )
+        for( const auto& entry : ConstraintRow<Real>( i, n ) )
+            A.QueueUpdate( entry );
+    A.ProcessQueues();
+
+    Matrix<Real> x0;
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        x0(j) = PrimalEntry<Real>( j );
+        c(j) = CostEntry<Real>( j );
+    }
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+}
+
+template<typename Real>
+void BuildProblem
+( Int m, Int n,
+  DistSparseMatrix<Real>& Q, DistSparseMatrix<Real>& A,
+  DistMultiVec<Real>& b, DistMultiVec<Real>& c )
+{
+    Q.Resize( n, n );
+    Q.Reserve( 3*Q.LocalHeight() );
+    for( Int iLoc=0; iLoc<Q.LocalHeight(); ++iLoc )
+        for( const auto& entry : QuadraticRow<Real>( Q.GlobalRow(iLoc), n ) )
+            Q.QueueLocalUpdate( iLoc, entry.j, entry.value );
+    Q.ProcessLocalQueues();
+
+    A.Resize( m, n );
+    A.Reserve( (n/5+2)*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        for( const auto& entry : ConstraintRow<Real>( A.GlobalRow(iLoc), n ) )
+            A.QueueLocalUpdate( iLoc, entry.j, entry.value );
+    A.ProcessLocalQueues();
+
+    DistMultiVec<Real> x0(A.Comm());
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int jLoc=0; jLoc<x0.LocalHeight(); ++jLoc )
+    {
+        const Int j = x0.GlobalRow(jLoc);
+        x0.SetLocal( jLoc, 0, PrimalEntry<Real>( j ) );
+        c.SetLocal( jLoc, 0, CostEntry<Real>( j ) );
+    }
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+}
+
+// max_i |v(i) - vDist(i)| / (1 + || v ||_max)
+template<typename Real>
+Real Difference( const Matrix<Real>& v, const DistMultiVec<Real>& vDist )
+{
+    Real localDiff = 0;
+    for( Int iLoc=0; iLoc<vDist.LocalHeight(); ++iLoc )
+        localDiff =
+          Max( localDiff,
+               Abs(v(vDist.GlobalRow(iLoc))-vDist.GetLocal(iLoc,0)) );
+    const Real diff = mpi::AllReduce( localDiff, mpi::MAX, vDist.Comm() );
+    return diff / (1+MaxNorm(v));
+}
+
+template<typename Real>
+void CompareIterates
+( const string& label,
+  const Matrix<Real>& x, const Matrix<Real>& y, const Matrix<Real>& z,
+  const DistMultiVec<Real>& xDist, const DistMultiVec<Real>& yDist,
+  const DistMultiVec<Real>& zDist, mpi::Comm comm )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    const Real xDiff = Difference( x, xDist );
+    const Real yDiff = Difference( y, yDist );
+    const Real zDiff = Difference( z, zDist );
+    OutputFromRoot
+    (comm,label,": relative differences in (x,y,z) = (",xDiff,",",yDiff,",",
+     zDiff,")");
+    if( xDiff > tol || yDiff > tol || zDiff > tol )
+        LogicError(label," distributed iterates differed from sequential");
+}
+
+template<typename Real>
+void TestKKT
+( Int m, Int n, Int numIts, KKTSystem system, bool print, mpi::Comm comm )
+{
+    const string systemName =
+      ( system == FULL_KKT ? "full KKT" : "augmented KKT" );
+    OutputFromRoot
+    (comm,"Testing the ",systemName," system with ",TypeName<Real>());
+    PushIndent();
+
+    // Every process solves the sequential problem redundantly
+    SparseMatrix<Real> Q, A;
+    Matrix<Real> b, c, x, y, z;
+    BuildProblem( m, n, Q, A, b, c );
+    DistSparseMatrix<Real> QDist(comm), ADist(comm);
+    DistMultiVec<Real> bDist(comm), cDist(comm),
+                       xDist(comm), yDist(comm), zDist(comm);
+    BuildProblem( m, n, QDist, ADist, bDist, cDist );
+
+    qp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.system = system;
+
+    // Stop after a few iterations without requiring convergence
+    ctrl.mehrotraCtrl.maxIts = numIts;
+    ctrl.mehrotraCtrl.minTol = limits::Max<Real>();
+    QP( Q, A, b, c, x, y, z, ctrl );
+    QP( QDist, ADist, bDist, cDist, xDist, yDist, zDist, ctrl );
+    CompareIterates
+    ( "After "+std::to_string(numIts)+" iterations",
+      x, y, z, xDist, yDist, zDist, comm );
+
+    ctrl = qp::direct::Ctrl<Real>();
+    ctrl.mehrotraCtrl.system = system;
+    ctrl.mehrotraCtrl.print = print && mpi::Rank(comm) == 0;
+    QP( Q, A, b, c, x, y, z, ctrl );
+    ctrl.mehrotraCtrl.print = print;
+    QP( QDist, ADist, bDist, cDist, xDist, yDist, zDist, ctrl );
+    CompareIterates( "Solution", x, y, z, xDist, yDist, zDist, comm );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of constraints",20);
+        const Int n = Input("--n","number of variables",40);
+        const Int numIts =
+          Input("--numIts","number of iterations to compare",3);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( m > n )
+            LogicError("The QP requires m <= n");
+
+        TestKKT<double>( m, n, numIts, FULL_KKT, print, comm );
+        TestKKT<double>( m, n, numIts, AUGMENTED_KKT, print, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}